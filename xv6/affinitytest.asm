@@ -0,0 +1,1377 @@
+
+_affinitytest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+
+#define NHOGS 4
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+	int hog_pid[NHOGS];
+	int i, j;
+
+	for(i = 0; i < NHOGS; i++){
+    1010:	31 db                	xor    %ebx,%ebx
+{
+    1012:	51                   	push   %ecx
+    1013:	81 ec 38 0b 00 00    	sub    $0xb38,%esp
+		hog_pid[i] = fork();
+    1019:	e8 bd 03 00 00       	call   13db <fork>
+    101e:	89 84 9d d4 f4 ff ff 	mov    %eax,-0xb2c(%ebp,%ebx,4)
+    1025:	89 c6                	mov    %eax,%esi
+		if(hog_pid[i] == 0)
+    1027:	85 c0                	test   %eax,%eax
+    1029:	74 20                	je     104b <main+0x4b>
+			for (;;);
+		if(i < NHOGS/2 && setaffinity(hog_pid[i], 1) < 0)
+    102b:	83 fb 01             	cmp    $0x1,%ebx
+    102e:	7f 20                	jg     1050 <main+0x50>
+    1030:	83 ec 08             	sub    $0x8,%esp
+    1033:	6a 01                	push   $0x1
+    1035:	50                   	push   %eax
+    1036:	e8 b8 04 00 00       	call   14f3 <setaffinity>
+    103b:	83 c4 10             	add    $0x10,%esp
+    103e:	85 c0                	test   %eax,%eax
+    1040:	0f 88 23 01 00 00    	js     1169 <main+0x169>
+	for(i = 0; i < NHOGS; i++){
+    1046:	83 c3 01             	add    $0x1,%ebx
+    1049:	eb ce                	jmp    1019 <main+0x19>
+			for (;;);
+    104b:	eb fe                	jmp    104b <main+0x4b>
+    104d:	8d 76 00             	lea    0x0(%esi),%esi
+	for(i = 0; i < NHOGS; i++){
+    1050:	83 fb 03             	cmp    $0x3,%ebx
+    1053:	0f 85 06 01 00 00    	jne    115f <main+0x15f>
+			printf(1, "setaffinity(%d, 1) failed\n", hog_pid[i]);
+	}
+	if(setaffinity(getpid(), 0) == 0)
+    1059:	e8 05 04 00 00       	call   1463 <getpid>
+    105e:	83 ec 08             	sub    $0x8,%esp
+    1061:	6a 00                	push   $0x0
+    1063:	50                   	push   %eax
+    1064:	e8 8a 04 00 00       	call   14f3 <setaffinity>
+    1069:	83 c4 10             	add    $0x10,%esp
+    106c:	85 c0                	test   %eax,%eax
+    106e:	0f 84 0e 01 00 00    	je     1182 <main+0x182>
+		printf(1, "setaffinity accepted an empty mask\n");
+
+	sleep(500);
+    1074:	83 ec 0c             	sub    $0xc,%esp
+    1077:	8d bd e4 f5 ff ff    	lea    -0xa1c(%ebp),%edi
+    107d:	68 f4 01 00 00       	push   $0x1f4
+    1082:	e8 ec 03 00 00       	call   1473 <sleep>
+
+	struct pstat st;
+	st.next = 0;
+    1087:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    108e:	83 c4 10             	add    $0x10,%esp
+	do {
+		getpinfo(&st);
+    1091:	83 ec 0c             	sub    $0xc,%esp
+    1094:	8d 85 e4 f4 ff ff    	lea    -0xb1c(%ebp),%eax
+    109a:	50                   	push   %eax
+    109b:	e8 eb 03 00 00       	call   148b <getpinfo>
+		for(j = 0; j < NHOGS; j++)
+    10a0:	8d 85 d4 f4 ff ff    	lea    -0xb2c(%ebp),%eax
+    10a6:	83 c4 10             	add    $0x10,%esp
+    10a9:	31 c9                	xor    %ecx,%ecx
+    10ab:	89 85 bc f4 ff ff    	mov    %eax,-0xb44(%ebp)
+		getpinfo(&st);
+    10b1:	89 c6                	mov    %eax,%esi
+			for (i = 0; i < sizeof(st.pid)/sizeof(st.pid[0]); i++)
+    10b3:	bb 2d 19 00 00       	mov    $0x192d,%ebx
+    10b8:	83 f9 01             	cmp    $0x1,%ecx
+    10bb:	b8 34 19 00 00       	mov    $0x1934,%eax
+    10c0:	89 8d c0 f4 ff ff    	mov    %ecx,-0xb40(%ebp)
+    10c6:	0f 4e c3             	cmovle %ebx,%eax
+    10c9:	8d 9d e4 f4 ff ff    	lea    -0xb1c(%ebp),%ebx
+    10cf:	89 85 c4 f4 ff ff    	mov    %eax,-0xb3c(%ebp)
+    10d5:	89 f0                	mov    %esi,%eax
+    10d7:	89 de                	mov    %ebx,%esi
+    10d9:	89 c3                	mov    %eax,%ebx
+    10db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10df:	90                   	nop
+				if(st.inuse[i] && st.pid[i] == hog_pid[j])
+    10e0:	8b 16                	mov    (%esi),%edx
+    10e2:	85 d2                	test   %edx,%edx
+    10e4:	74 2a                	je     1110 <main+0x110>
+    10e6:	8b 13                	mov    (%ebx),%edx
+    10e8:	39 96 00 02 00 00    	cmp    %edx,0x200(%esi)
+    10ee:	75 20                	jne    1110 <main+0x110>
+					printf(1, "pid %d %s: %d migrations\n", hog_pid[j],
+    10f0:	83 ec 0c             	sub    $0xc,%esp
+    10f3:	ff b6 00 07 00 00    	push   0x700(%esi)
+    10f9:	ff b5 c4 f4 ff ff    	push   -0xb3c(%ebp)
+    10ff:	52                   	push   %edx
+    1100:	68 13 19 00 00       	push   $0x1913
+    1105:	6a 01                	push   $0x1
+    1107:	e8 c4 04 00 00       	call   15d0 <printf>
+    110c:	83 c4 20             	add    $0x20,%esp
+    110f:	90                   	nop
+			for (i = 0; i < sizeof(st.pid)/sizeof(st.pid[0]); i++)
+    1110:	83 c6 04             	add    $0x4,%esi
+    1113:	39 fe                	cmp    %edi,%esi
+    1115:	75 c9                	jne    10e0 <main+0xe0>
+		for(j = 0; j < NHOGS; j++)
+    1117:	8b 8d c0 f4 ff ff    	mov    -0xb40(%ebp),%ecx
+    111d:	89 de                	mov    %ebx,%esi
+    111f:	83 c6 04             	add    $0x4,%esi
+    1122:	83 c1 01             	add    $0x1,%ecx
+    1125:	83 f9 04             	cmp    $0x4,%ecx
+    1128:	75 89                	jne    10b3 <main+0xb3>
+					       j < NHOGS/2 ? "pinned" : "free", st.migrations[i]);
+	} while(st.next);
+    112a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    112d:	85 c0                	test   %eax,%eax
+    112f:	0f 85 5c ff ff ff    	jne    1091 <main+0x91>
+    1135:	8b b5 bc f4 ff ff    	mov    -0xb44(%ebp),%esi
+    113b:	8d 9d e4 f4 ff ff    	lea    -0xb1c(%ebp),%ebx
+
+	for(i = 0; i < NHOGS; i++){
+		kill(hog_pid[i]);
+    1141:	83 ec 0c             	sub    $0xc,%esp
+    1144:	ff 36                	push   (%esi)
+	for(i = 0; i < NHOGS; i++){
+    1146:	83 c6 04             	add    $0x4,%esi
+		kill(hog_pid[i]);
+    1149:	e8 c5 02 00 00       	call   1413 <kill>
+		wait();
+    114e:	e8 98 02 00 00       	call   13eb <wait>
+	for(i = 0; i < NHOGS; i++){
+    1153:	83 c4 10             	add    $0x10,%esp
+    1156:	39 f3                	cmp    %esi,%ebx
+    1158:	75 e7                	jne    1141 <main+0x141>
+	}
+	exit();
+    115a:	e8 84 02 00 00       	call   13e3 <exit>
+	for(i = 0; i < NHOGS; i++){
+    115f:	bb 03 00 00 00       	mov    $0x3,%ebx
+    1164:	e9 b0 fe ff ff       	jmp    1019 <main+0x19>
+			printf(1, "setaffinity(%d, 1) failed\n", hog_pid[i]);
+    1169:	57                   	push   %edi
+	for(i = 0; i < NHOGS; i++){
+    116a:	83 c3 01             	add    $0x1,%ebx
+			printf(1, "setaffinity(%d, 1) failed\n", hog_pid[i]);
+    116d:	56                   	push   %esi
+    116e:	68 f8 18 00 00       	push   $0x18f8
+    1173:	6a 01                	push   $0x1
+    1175:	e8 56 04 00 00       	call   15d0 <printf>
+	for(i = 0; i < NHOGS; i++){
+    117a:	83 c4 10             	add    $0x10,%esp
+    117d:	e9 97 fe ff ff       	jmp    1019 <main+0x19>
+		printf(1, "setaffinity accepted an empty mask\n");
+    1182:	51                   	push   %ecx
+    1183:	51                   	push   %ecx
+    1184:	68 3c 19 00 00       	push   $0x193c
+    1189:	6a 01                	push   $0x1
+    118b:	e8 40 04 00 00       	call   15d0 <printf>
+    1190:	83 c4 10             	add    $0x10,%esp
+    1193:	e9 dc fe ff ff       	jmp    1074 <main+0x74>
+    1198:	66 90                	xchg   %ax,%ax
+    119a:	66 90                	xchg   %ax,%ax
+    119c:	66 90                	xchg   %ax,%ax
+    119e:	66 90                	xchg   %ax,%ax
+
+000011a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    11a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    11a1:	31 c0                	xor    %eax,%eax
+{
+    11a3:	89 e5                	mov    %esp,%ebp
+    11a5:	53                   	push   %ebx
+    11a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    11a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    11ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    11b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    11b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    11b7:	83 c0 01             	add    $0x1,%eax
+    11ba:	84 d2                	test   %dl,%dl
+    11bc:	75 f2                	jne    11b0 <strcpy+0x10>
+    ;
+  return os;
+}
+    11be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11c1:	89 c8                	mov    %ecx,%eax
+    11c3:	c9                   	leave
+    11c4:	c3                   	ret
+    11c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000011d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    11d0:	55                   	push   %ebp
+    11d1:	89 e5                	mov    %esp,%ebp
+    11d3:	53                   	push   %ebx
+    11d4:	8b 55 08             	mov    0x8(%ebp),%edx
+    11d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    11da:	0f b6 02             	movzbl (%edx),%eax
+    11dd:	84 c0                	test   %al,%al
+    11df:	75 17                	jne    11f8 <strcmp+0x28>
+    11e1:	eb 3a                	jmp    121d <strcmp+0x4d>
+    11e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11e7:	90                   	nop
+    11e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    11ec:	83 c2 01             	add    $0x1,%edx
+    11ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    11f2:	84 c0                	test   %al,%al
+    11f4:	74 1a                	je     1210 <strcmp+0x40>
+    p++, q++;
+    11f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    11f8:	0f b6 19             	movzbl (%ecx),%ebx
+    11fb:	38 c3                	cmp    %al,%bl
+    11fd:	74 e9                	je     11e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    11ff:	29 d8                	sub    %ebx,%eax
+}
+    1201:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1204:	c9                   	leave
+    1205:	c3                   	ret
+    1206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1210:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1214:	31 c0                	xor    %eax,%eax
+    1216:	29 d8                	sub    %ebx,%eax
+}
+    1218:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    121b:	c9                   	leave
+    121c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    121d:	0f b6 19             	movzbl (%ecx),%ebx
+    1220:	31 c0                	xor    %eax,%eax
+    1222:	eb db                	jmp    11ff <strcmp+0x2f>
+    1224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    122f:	90                   	nop
+
+00001230 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1236:	80 3a 00             	cmpb   $0x0,(%edx)
+    1239:	74 15                	je     1250 <strlen+0x20>
+    123b:	31 c0                	xor    %eax,%eax
+    123d:	8d 76 00             	lea    0x0(%esi),%esi
+    1240:	83 c0 01             	add    $0x1,%eax
+    1243:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1247:	89 c1                	mov    %eax,%ecx
+    1249:	75 f5                	jne    1240 <strlen+0x10>
+    ;
+  return n;
+}
+    124b:	89 c8                	mov    %ecx,%eax
+    124d:	5d                   	pop    %ebp
+    124e:	c3                   	ret
+    124f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1250:	31 c9                	xor    %ecx,%ecx
+}
+    1252:	5d                   	pop    %ebp
+    1253:	89 c8                	mov    %ecx,%eax
+    1255:	c3                   	ret
+    1256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001260 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	57                   	push   %edi
+    1264:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1267:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    126a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    126d:	89 d7                	mov    %edx,%edi
+    126f:	fc                   	cld
+    1270:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1272:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1275:	89 d0                	mov    %edx,%eax
+    1277:	c9                   	leave
+    1278:	c3                   	ret
+    1279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001280 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	8b 45 08             	mov    0x8(%ebp),%eax
+    1286:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    128a:	0f b6 10             	movzbl (%eax),%edx
+    128d:	84 d2                	test   %dl,%dl
+    128f:	75 12                	jne    12a3 <strchr+0x23>
+    1291:	eb 1d                	jmp    12b0 <strchr+0x30>
+    1293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1297:	90                   	nop
+    1298:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    129c:	83 c0 01             	add    $0x1,%eax
+    129f:	84 d2                	test   %dl,%dl
+    12a1:	74 0d                	je     12b0 <strchr+0x30>
+    if(*s == c)
+    12a3:	38 d1                	cmp    %dl,%cl
+    12a5:	75 f1                	jne    1298 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    12a7:	5d                   	pop    %ebp
+    12a8:	c3                   	ret
+    12a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    12b0:	31 c0                	xor    %eax,%eax
+}
+    12b2:	5d                   	pop    %ebp
+    12b3:	c3                   	ret
+    12b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12bf:	90                   	nop
+
+000012c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	57                   	push   %edi
+    12c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    12c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    12c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    12c9:	31 db                	xor    %ebx,%ebx
+{
+    12cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    12ce:	eb 27                	jmp    12f7 <gets+0x37>
+    cc = read(0, &c, 1);
+    12d0:	83 ec 04             	sub    $0x4,%esp
+    12d3:	6a 01                	push   $0x1
+    12d5:	56                   	push   %esi
+    12d6:	6a 00                	push   $0x0
+    12d8:	e8 1e 01 00 00       	call   13fb <read>
+    if(cc < 1)
+    12dd:	83 c4 10             	add    $0x10,%esp
+    12e0:	85 c0                	test   %eax,%eax
+    12e2:	7e 1d                	jle    1301 <gets+0x41>
+      break;
+    buf[i++] = c;
+    12e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    12e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    12eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    12ef:	3c 0a                	cmp    $0xa,%al
+    12f1:	74 10                	je     1303 <gets+0x43>
+    12f3:	3c 0d                	cmp    $0xd,%al
+    12f5:	74 0c                	je     1303 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    12f7:	89 df                	mov    %ebx,%edi
+    12f9:	83 c3 01             	add    $0x1,%ebx
+    12fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    12ff:	7c cf                	jl     12d0 <gets+0x10>
+    1301:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1303:	8b 45 08             	mov    0x8(%ebp),%eax
+    1306:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    130a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    130d:	5b                   	pop    %ebx
+    130e:	5e                   	pop    %esi
+    130f:	5f                   	pop    %edi
+    1310:	5d                   	pop    %ebp
+    1311:	c3                   	ret
+    1312:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001320 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	56                   	push   %esi
+    1324:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1325:	83 ec 08             	sub    $0x8,%esp
+    1328:	6a 00                	push   $0x0
+    132a:	ff 75 08             	push   0x8(%ebp)
+    132d:	e8 f1 00 00 00       	call   1423 <open>
+  if(fd < 0)
+    1332:	83 c4 10             	add    $0x10,%esp
+    1335:	85 c0                	test   %eax,%eax
+    1337:	78 27                	js     1360 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1339:	83 ec 08             	sub    $0x8,%esp
+    133c:	ff 75 0c             	push   0xc(%ebp)
+    133f:	89 c3                	mov    %eax,%ebx
+    1341:	50                   	push   %eax
+    1342:	e8 f4 00 00 00       	call   143b <fstat>
+  close(fd);
+    1347:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    134a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    134c:	e8 ba 00 00 00       	call   140b <close>
+  return r;
+    1351:	83 c4 10             	add    $0x10,%esp
+}
+    1354:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1357:	89 f0                	mov    %esi,%eax
+    1359:	5b                   	pop    %ebx
+    135a:	5e                   	pop    %esi
+    135b:	5d                   	pop    %ebp
+    135c:	c3                   	ret
+    135d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1360:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1365:	eb ed                	jmp    1354 <stat+0x34>
+    1367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136e:	66 90                	xchg   %ax,%ax
+
+00001370 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	53                   	push   %ebx
+    1374:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1377:	0f be 02             	movsbl (%edx),%eax
+    137a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    137d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1380:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1385:	77 1e                	ja     13a5 <atoi+0x35>
+    1387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    138e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1390:	83 c2 01             	add    $0x1,%edx
+    1393:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1396:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    139a:	0f be 02             	movsbl (%edx),%eax
+    139d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    13a0:	80 fb 09             	cmp    $0x9,%bl
+    13a3:	76 eb                	jbe    1390 <atoi+0x20>
+  return n;
+}
+    13a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13a8:	89 c8                	mov    %ecx,%eax
+    13aa:	c9                   	leave
+    13ab:	c3                   	ret
+    13ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000013b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    13b0:	55                   	push   %ebp
+    13b1:	89 e5                	mov    %esp,%ebp
+    13b3:	57                   	push   %edi
+    13b4:	56                   	push   %esi
+    13b5:	8b 45 10             	mov    0x10(%ebp),%eax
+    13b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    13bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    13be:	85 c0                	test   %eax,%eax
+    13c0:	7e 13                	jle    13d5 <memmove+0x25>
+    13c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    13c4:	89 d7                	mov    %edx,%edi
+    13c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    13d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    13d1:	39 f8                	cmp    %edi,%eax
+    13d3:	75 fb                	jne    13d0 <memmove+0x20>
+  return vdst;
+}
+    13d5:	5e                   	pop    %esi
+    13d6:	89 d0                	mov    %edx,%eax
+    13d8:	5f                   	pop    %edi
+    13d9:	5d                   	pop    %ebp
+    13da:	c3                   	ret
+
+000013db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    13db:	b8 01 00 00 00       	mov    $0x1,%eax
+    13e0:	cd 40                	int    $0x40
+    13e2:	c3                   	ret
+
+000013e3 <exit>:
+SYSCALL(exit)
+    13e3:	b8 02 00 00 00       	mov    $0x2,%eax
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+
+000013eb <wait>:
+SYSCALL(wait)
+    13eb:	b8 03 00 00 00       	mov    $0x3,%eax
+    13f0:	cd 40                	int    $0x40
+    13f2:	c3                   	ret
+
+000013f3 <pipe>:
+SYSCALL(pipe)
+    13f3:	b8 04 00 00 00       	mov    $0x4,%eax
+    13f8:	cd 40                	int    $0x40
+    13fa:	c3                   	ret
+
+000013fb <read>:
+SYSCALL(read)
+    13fb:	b8 05 00 00 00       	mov    $0x5,%eax
+    1400:	cd 40                	int    $0x40
+    1402:	c3                   	ret
+
+00001403 <write>:
+SYSCALL(write)
+    1403:	b8 10 00 00 00       	mov    $0x10,%eax
+    1408:	cd 40                	int    $0x40
+    140a:	c3                   	ret
+
+0000140b <close>:
+SYSCALL(close)
+    140b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1410:	cd 40                	int    $0x40
+    1412:	c3                   	ret
+
+00001413 <kill>:
+SYSCALL(kill)
+    1413:	b8 06 00 00 00       	mov    $0x6,%eax
+    1418:	cd 40                	int    $0x40
+    141a:	c3                   	ret
+
+0000141b <exec>:
+SYSCALL(exec)
+    141b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1420:	cd 40                	int    $0x40
+    1422:	c3                   	ret
+
+00001423 <open>:
+SYSCALL(open)
+    1423:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1428:	cd 40                	int    $0x40
+    142a:	c3                   	ret
+
+0000142b <mknod>:
+SYSCALL(mknod)
+    142b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1430:	cd 40                	int    $0x40
+    1432:	c3                   	ret
+
+00001433 <unlink>:
+SYSCALL(unlink)
+    1433:	b8 12 00 00 00       	mov    $0x12,%eax
+    1438:	cd 40                	int    $0x40
+    143a:	c3                   	ret
+
+0000143b <fstat>:
+SYSCALL(fstat)
+    143b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1440:	cd 40                	int    $0x40
+    1442:	c3                   	ret
+
+00001443 <link>:
+SYSCALL(link)
+    1443:	b8 13 00 00 00       	mov    $0x13,%eax
+    1448:	cd 40                	int    $0x40
+    144a:	c3                   	ret
+
+0000144b <mkdir>:
+SYSCALL(mkdir)
+    144b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1450:	cd 40                	int    $0x40
+    1452:	c3                   	ret
+
+00001453 <chdir>:
+SYSCALL(chdir)
+    1453:	b8 09 00 00 00       	mov    $0x9,%eax
+    1458:	cd 40                	int    $0x40
+    145a:	c3                   	ret
+
+0000145b <dup>:
+SYSCALL(dup)
+    145b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1460:	cd 40                	int    $0x40
+    1462:	c3                   	ret
+
+00001463 <getpid>:
+SYSCALL(getpid)
+    1463:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1468:	cd 40                	int    $0x40
+    146a:	c3                   	ret
+
+0000146b <sbrk>:
+SYSCALL(sbrk)
+    146b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1470:	cd 40                	int    $0x40
+    1472:	c3                   	ret
+
+00001473 <sleep>:
+SYSCALL(sleep)
+    1473:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1478:	cd 40                	int    $0x40
+    147a:	c3                   	ret
+
+0000147b <uptime>:
+SYSCALL(uptime)
+    147b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1480:	cd 40                	int    $0x40
+    1482:	c3                   	ret
+
+00001483 <settickets>:
+SYSCALL(settickets)
+    1483:	b8 16 00 00 00       	mov    $0x16,%eax
+    1488:	cd 40                	int    $0x40
+    148a:	c3                   	ret
+
+0000148b <getpinfo>:
+SYSCALL(getpinfo)
+    148b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1490:	cd 40                	int    $0x40
+    1492:	c3                   	ret
+
+00001493 <mprotect>:
+SYSCALL(mprotect)
+    1493:	b8 18 00 00 00       	mov    $0x18,%eax
+    1498:	cd 40                	int    $0x40
+    149a:	c3                   	ret
+
+0000149b <munprotect>:
+SYSCALL(munprotect)
+    149b:	b8 19 00 00 00       	mov    $0x19,%eax
+    14a0:	cd 40                	int    $0x40
+    14a2:	c3                   	ret
+
+000014a3 <clone>:
+SYSCALL(clone)
+    14a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    14a8:	cd 40                	int    $0x40
+    14aa:	c3                   	ret
+
+000014ab <join>:
+SYSCALL(join)
+    14ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    14b0:	cd 40                	int    $0x40
+    14b2:	c3                   	ret
+
+000014b3 <initlock_t>:
+SYSCALL(initlock_t)
+    14b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    14b8:	cd 40                	int    $0x40
+    14ba:	c3                   	ret
+
+000014bb <acquire_t>:
+SYSCALL(acquire_t)
+    14bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    14c0:	cd 40                	int    $0x40
+    14c2:	c3                   	ret
+
+000014c3 <release_t>:
+SYSCALL(release_t)
+    14c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    14c8:	cd 40                	int    $0x40
+    14ca:	c3                   	ret
+
+000014cb <setsched>:
+SYSCALL(setsched)
+    14cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    14d0:	cd 40                	int    $0x40
+    14d2:	c3                   	ret
+
+000014d3 <mkgroup>:
+SYSCALL(mkgroup)
+    14d3:	b8 20 00 00 00       	mov    $0x20,%eax
+    14d8:	cd 40                	int    $0x40
+    14da:	c3                   	ret
+
+000014db <joingroup>:
+SYSCALL(joingroup)
+    14db:	b8 21 00 00 00       	mov    $0x21,%eax
+    14e0:	cd 40                	int    $0x40
+    14e2:	c3                   	ret
+
+000014e3 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    14e3:	b8 22 00 00 00       	mov    $0x22,%eax
+    14e8:	cd 40                	int    $0x40
+    14ea:	c3                   	ret
+
+000014eb <setdeadline>:
+SYSCALL(setdeadline)
+    14eb:	b8 23 00 00 00       	mov    $0x23,%eax
+    14f0:	cd 40                	int    $0x40
+    14f2:	c3                   	ret
+
+000014f3 <setaffinity>:
+SYSCALL(setaffinity)
+    14f3:	b8 24 00 00 00       	mov    $0x24,%eax
+    14f8:	cd 40                	int    $0x40
+    14fa:	c3                   	ret
+
+000014fb <yield_to>:
+SYSCALL(yield_to)
+    14fb:	b8 25 00 00 00       	mov    $0x25,%eax
+    1500:	cd 40                	int    $0x40
+    1502:	c3                   	ret
+
+00001503 <getlatency>:
+SYSCALL(getlatency)
+    1503:	b8 26 00 00 00       	mov    $0x26,%eax
+    1508:	cd 40                	int    $0x40
+    150a:	c3                   	ret
+
+0000150b <futex_wait>:
+SYSCALL(futex_wait)
+    150b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1510:	cd 40                	int    $0x40
+    1512:	c3                   	ret
+
+00001513 <futex_wake>:
+SYSCALL(futex_wake)
+    1513:	b8 28 00 00 00       	mov    $0x28,%eax
+    1518:	cd 40                	int    $0x40
+    151a:	c3                   	ret
+
+0000151b <mguard>:
+SYSCALL(mguard)
+    151b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1520:	cd 40                	int    $0x40
+    1522:	c3                   	ret
+
+00001523 <join_any>:
+SYSCALL(join_any)
+    1523:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1528:	cd 40                	int    $0x40
+    152a:	c3                   	ret
+    152b:	66 90                	xchg   %ax,%ax
+    152d:	66 90                	xchg   %ax,%ax
+    152f:	90                   	nop
+
+00001530 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1530:	55                   	push   %ebp
+    1531:	89 e5                	mov    %esp,%ebp
+    1533:	57                   	push   %edi
+    1534:	56                   	push   %esi
+    1535:	53                   	push   %ebx
+    1536:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1538:	89 d1                	mov    %edx,%ecx
+{
+    153a:	83 ec 3c             	sub    $0x3c,%esp
+    153d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1540:	85 d2                	test   %edx,%edx
+    1542:	0f 89 80 00 00 00    	jns    15c8 <printint+0x98>
+    1548:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    154c:	74 7a                	je     15c8 <printint+0x98>
+    x = -xx;
+    154e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1550:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1555:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1558:	31 f6                	xor    %esi,%esi
+    155a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1560:	89 c8                	mov    %ecx,%eax
+    1562:	31 d2                	xor    %edx,%edx
+    1564:	89 f7                	mov    %esi,%edi
+    1566:	f7 f3                	div    %ebx
+    1568:	8d 76 01             	lea    0x1(%esi),%esi
+    156b:	0f b6 92 c0 19 00 00 	movzbl 0x19c0(%edx),%edx
+    1572:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1576:	89 ca                	mov    %ecx,%edx
+    1578:	89 c1                	mov    %eax,%ecx
+    157a:	39 da                	cmp    %ebx,%edx
+    157c:	73 e2                	jae    1560 <printint+0x30>
+  if(neg)
+    157e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1581:	85 c0                	test   %eax,%eax
+    1583:	74 07                	je     158c <printint+0x5c>
+    buf[i++] = '-';
+    1585:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    158a:	89 f7                	mov    %esi,%edi
+    158c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    158f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1592:	01 df                	add    %ebx,%edi
+    1594:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1598:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    159b:	83 ec 04             	sub    $0x4,%esp
+    159e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    15a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    15a4:	6a 01                	push   $0x1
+    15a6:	50                   	push   %eax
+    15a7:	56                   	push   %esi
+    15a8:	e8 56 fe ff ff       	call   1403 <write>
+  while(--i >= 0)
+    15ad:	89 f8                	mov    %edi,%eax
+    15af:	83 c4 10             	add    $0x10,%esp
+    15b2:	83 ef 01             	sub    $0x1,%edi
+    15b5:	39 d8                	cmp    %ebx,%eax
+    15b7:	75 df                	jne    1598 <printint+0x68>
+}
+    15b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15bc:	5b                   	pop    %ebx
+    15bd:	5e                   	pop    %esi
+    15be:	5f                   	pop    %edi
+    15bf:	5d                   	pop    %ebp
+    15c0:	c3                   	ret
+    15c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    15c8:	31 c0                	xor    %eax,%eax
+    15ca:	eb 89                	jmp    1555 <printint+0x25>
+    15cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000015d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    15d0:	55                   	push   %ebp
+    15d1:	89 e5                	mov    %esp,%ebp
+    15d3:	57                   	push   %edi
+    15d4:	56                   	push   %esi
+    15d5:	53                   	push   %ebx
+    15d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    15d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    15dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    15df:	0f b6 1e             	movzbl (%esi),%ebx
+    15e2:	83 c6 01             	add    $0x1,%esi
+    15e5:	84 db                	test   %bl,%bl
+    15e7:	74 67                	je     1650 <printf+0x80>
+    15e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    15ec:	31 d2                	xor    %edx,%edx
+    15ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    15f1:	eb 34                	jmp    1627 <printf+0x57>
+    15f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15f7:	90                   	nop
+    15f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    15fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1600:	83 f8 25             	cmp    $0x25,%eax
+    1603:	74 18                	je     161d <printf+0x4d>
+  write(fd, &c, 1);
+    1605:	83 ec 04             	sub    $0x4,%esp
+    1608:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    160b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    160e:	6a 01                	push   $0x1
+    1610:	50                   	push   %eax
+    1611:	57                   	push   %edi
+    1612:	e8 ec fd ff ff       	call   1403 <write>
+    1617:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    161a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    161d:	0f b6 1e             	movzbl (%esi),%ebx
+    1620:	83 c6 01             	add    $0x1,%esi
+    1623:	84 db                	test   %bl,%bl
+    1625:	74 29                	je     1650 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1627:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    162a:	85 d2                	test   %edx,%edx
+    162c:	74 ca                	je     15f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    162e:	83 fa 25             	cmp    $0x25,%edx
+    1631:	75 ea                	jne    161d <printf+0x4d>
+      if(c == 'd'){
+    1633:	83 f8 25             	cmp    $0x25,%eax
+    1636:	0f 84 24 01 00 00    	je     1760 <printf+0x190>
+    163c:	83 e8 63             	sub    $0x63,%eax
+    163f:	83 f8 15             	cmp    $0x15,%eax
+    1642:	77 1c                	ja     1660 <printf+0x90>
+    1644:	ff 24 85 68 19 00 00 	jmp    *0x1968(,%eax,4)
+    164b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    164f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1653:	5b                   	pop    %ebx
+    1654:	5e                   	pop    %esi
+    1655:	5f                   	pop    %edi
+    1656:	5d                   	pop    %ebp
+    1657:	c3                   	ret
+    1658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    165f:	90                   	nop
+  write(fd, &c, 1);
+    1660:	83 ec 04             	sub    $0x4,%esp
+    1663:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1666:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    166a:	6a 01                	push   $0x1
+    166c:	52                   	push   %edx
+    166d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1670:	57                   	push   %edi
+    1671:	e8 8d fd ff ff       	call   1403 <write>
+    1676:	83 c4 0c             	add    $0xc,%esp
+    1679:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    167c:	6a 01                	push   $0x1
+    167e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1681:	52                   	push   %edx
+    1682:	57                   	push   %edi
+    1683:	e8 7b fd ff ff       	call   1403 <write>
+        putc(fd, c);
+    1688:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    168b:	31 d2                	xor    %edx,%edx
+    168d:	eb 8e                	jmp    161d <printf+0x4d>
+    168f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1693:	83 ec 0c             	sub    $0xc,%esp
+    1696:	b9 10 00 00 00       	mov    $0x10,%ecx
+    169b:	8b 13                	mov    (%ebx),%edx
+    169d:	6a 00                	push   $0x0
+    169f:	89 f8                	mov    %edi,%eax
+        ap++;
+    16a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    16a4:	e8 87 fe ff ff       	call   1530 <printint>
+        ap++;
+    16a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    16ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    16af:	31 d2                	xor    %edx,%edx
+    16b1:	e9 67 ff ff ff       	jmp    161d <printf+0x4d>
+    16b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    16c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    16c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    16c5:	83 c0 04             	add    $0x4,%eax
+    16c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    16cb:	85 db                	test   %ebx,%ebx
+    16cd:	0f 84 9d 00 00 00    	je     1770 <printf+0x1a0>
+        while(*s != 0){
+    16d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    16d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    16d8:	84 c0                	test   %al,%al
+    16da:	0f 84 3d ff ff ff    	je     161d <printf+0x4d>
+    16e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    16e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    16e6:	89 de                	mov    %ebx,%esi
+    16e8:	89 d3                	mov    %edx,%ebx
+    16ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    16f0:	83 ec 04             	sub    $0x4,%esp
+    16f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    16f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    16f9:	6a 01                	push   $0x1
+    16fb:	53                   	push   %ebx
+    16fc:	57                   	push   %edi
+    16fd:	e8 01 fd ff ff       	call   1403 <write>
+        while(*s != 0){
+    1702:	0f b6 06             	movzbl (%esi),%eax
+    1705:	83 c4 10             	add    $0x10,%esp
+    1708:	84 c0                	test   %al,%al
+    170a:	75 e4                	jne    16f0 <printf+0x120>
+      state = 0;
+    170c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    170f:	31 d2                	xor    %edx,%edx
+    1711:	e9 07 ff ff ff       	jmp    161d <printf+0x4d>
+    1716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    171d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1723:	83 ec 0c             	sub    $0xc,%esp
+    1726:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    172b:	8b 13                	mov    (%ebx),%edx
+    172d:	6a 01                	push   $0x1
+    172f:	e9 6b ff ff ff       	jmp    169f <printf+0xcf>
+    1734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1738:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    173b:	83 ec 04             	sub    $0x4,%esp
+    173e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1741:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1743:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1746:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1749:	6a 01                	push   $0x1
+    174b:	52                   	push   %edx
+    174c:	57                   	push   %edi
+    174d:	e8 b1 fc ff ff       	call   1403 <write>
+        ap++;
+    1752:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1755:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1758:	31 d2                	xor    %edx,%edx
+    175a:	e9 be fe ff ff       	jmp    161d <printf+0x4d>
+    175f:	90                   	nop
+  write(fd, &c, 1);
+    1760:	83 ec 04             	sub    $0x4,%esp
+    1763:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1766:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1769:	6a 01                	push   $0x1
+    176b:	e9 11 ff ff ff       	jmp    1681 <printf+0xb1>
+    1770:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1775:	bb 60 19 00 00       	mov    $0x1960,%ebx
+    177a:	e9 61 ff ff ff       	jmp    16e0 <printf+0x110>
+    177f:	90                   	nop
+
+00001780 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1780:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1781:	a1 6c 1c 00 00       	mov    0x1c6c,%eax
+{
+    1786:	89 e5                	mov    %esp,%ebp
+    1788:	57                   	push   %edi
+    1789:	56                   	push   %esi
+    178a:	53                   	push   %ebx
+    178b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    178e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1798:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    179a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    179c:	39 ca                	cmp    %ecx,%edx
+    179e:	73 30                	jae    17d0 <free+0x50>
+    17a0:	39 c1                	cmp    %eax,%ecx
+    17a2:	72 04                	jb     17a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17a4:	39 c2                	cmp    %eax,%edx
+    17a6:	72 f0                	jb     1798 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    17a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    17ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    17ae:	39 f8                	cmp    %edi,%eax
+    17b0:	74 2e                	je     17e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    17b5:	8b 42 04             	mov    0x4(%edx),%eax
+    17b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    17bb:	39 f1                	cmp    %esi,%ecx
+    17bd:	74 38                	je     17f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    17bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    17c1:	5b                   	pop    %ebx
+  freep = p;
+    17c2:	89 15 6c 1c 00 00    	mov    %edx,0x1c6c
+}
+    17c8:	5e                   	pop    %esi
+    17c9:	5f                   	pop    %edi
+    17ca:	5d                   	pop    %ebp
+    17cb:	c3                   	ret
+    17cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17d0:	39 c1                	cmp    %eax,%ecx
+    17d2:	72 d0                	jb     17a4 <free+0x24>
+    17d4:	eb c2                	jmp    1798 <free+0x18>
+    17d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    17e0:	03 70 04             	add    0x4(%eax),%esi
+    17e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17e6:	8b 02                	mov    (%edx),%eax
+    17e8:	8b 00                	mov    (%eax),%eax
+    17ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    17ed:	8b 42 04             	mov    0x4(%edx),%eax
+    17f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    17f3:	39 f1                	cmp    %esi,%ecx
+    17f5:	75 c8                	jne    17bf <free+0x3f>
+    p->s.size += bp->s.size;
+    17f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    17fa:	89 15 6c 1c 00 00    	mov    %edx,0x1c6c
+    p->s.size += bp->s.size;
+    1800:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1803:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1806:	89 0a                	mov    %ecx,(%edx)
+}
+    1808:	5b                   	pop    %ebx
+    1809:	5e                   	pop    %esi
+    180a:	5f                   	pop    %edi
+    180b:	5d                   	pop    %ebp
+    180c:	c3                   	ret
+    180d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001810 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1810:	55                   	push   %ebp
+    1811:	89 e5                	mov    %esp,%ebp
+    1813:	57                   	push   %edi
+    1814:	56                   	push   %esi
+    1815:	53                   	push   %ebx
+    1816:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1819:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    181c:	8b 15 6c 1c 00 00    	mov    0x1c6c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1822:	8d 78 07             	lea    0x7(%eax),%edi
+    1825:	c1 ef 03             	shr    $0x3,%edi
+    1828:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    182b:	85 d2                	test   %edx,%edx
+    182d:	0f 84 8d 00 00 00    	je     18c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1833:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1835:	8b 48 04             	mov    0x4(%eax),%ecx
+    1838:	39 f9                	cmp    %edi,%ecx
+    183a:	73 64                	jae    18a0 <malloc+0x90>
+  if(nu < 4096)
+    183c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1841:	39 df                	cmp    %ebx,%edi
+    1843:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1846:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    184d:	eb 0a                	jmp    1859 <malloc+0x49>
+    184f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1850:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1852:	8b 48 04             	mov    0x4(%eax),%ecx
+    1855:	39 f9                	cmp    %edi,%ecx
+    1857:	73 47                	jae    18a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1859:	89 c2                	mov    %eax,%edx
+    185b:	39 05 6c 1c 00 00    	cmp    %eax,0x1c6c
+    1861:	75 ed                	jne    1850 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1863:	83 ec 0c             	sub    $0xc,%esp
+    1866:	56                   	push   %esi
+    1867:	e8 ff fb ff ff       	call   146b <sbrk>
+  if(p == (char*)-1)
+    186c:	83 c4 10             	add    $0x10,%esp
+    186f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1872:	74 1c                	je     1890 <malloc+0x80>
+  hp->s.size = nu;
+    1874:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1877:	83 ec 0c             	sub    $0xc,%esp
+    187a:	83 c0 08             	add    $0x8,%eax
+    187d:	50                   	push   %eax
+    187e:	e8 fd fe ff ff       	call   1780 <free>
+  return freep;
+    1883:	8b 15 6c 1c 00 00    	mov    0x1c6c,%edx
+      if((p = morecore(nunits)) == 0)
+    1889:	83 c4 10             	add    $0x10,%esp
+    188c:	85 d2                	test   %edx,%edx
+    188e:	75 c0                	jne    1850 <malloc+0x40>
+        return 0;
+  }
+}
+    1890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1893:	31 c0                	xor    %eax,%eax
+}
+    1895:	5b                   	pop    %ebx
+    1896:	5e                   	pop    %esi
+    1897:	5f                   	pop    %edi
+    1898:	5d                   	pop    %ebp
+    1899:	c3                   	ret
+    189a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    18a0:	39 cf                	cmp    %ecx,%edi
+    18a2:	74 4c                	je     18f0 <malloc+0xe0>
+        p->s.size -= nunits;
+    18a4:	29 f9                	sub    %edi,%ecx
+    18a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    18a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    18ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    18af:	89 15 6c 1c 00 00    	mov    %edx,0x1c6c
+}
+    18b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    18b8:	83 c0 08             	add    $0x8,%eax
+}
+    18bb:	5b                   	pop    %ebx
+    18bc:	5e                   	pop    %esi
+    18bd:	5f                   	pop    %edi
+    18be:	5d                   	pop    %ebp
+    18bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    18c0:	c7 05 6c 1c 00 00 70 	movl   $0x1c70,0x1c6c
+    18c7:	1c 00 00 
+    base.s.size = 0;
+    18ca:	b8 70 1c 00 00       	mov    $0x1c70,%eax
+    base.s.ptr = freep = prevp = &base;
+    18cf:	c7 05 70 1c 00 00 70 	movl   $0x1c70,0x1c70
+    18d6:	1c 00 00 
+    base.s.size = 0;
+    18d9:	c7 05 74 1c 00 00 00 	movl   $0x0,0x1c74
+    18e0:	00 00 00 
+    if(p->s.size >= nunits){
+    18e3:	e9 54 ff ff ff       	jmp    183c <malloc+0x2c>
+    18e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    18f0:	8b 08                	mov    (%eax),%ecx
+    18f2:	89 0a                	mov    %ecx,(%edx)
+    18f4:	eb b9                	jmp    18af <malloc+0x9f>
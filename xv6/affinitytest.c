@@ -0,0 +1,45 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "pstat.h"
+
+// Hogs pinned to CPU 0 should stay there: once pinned they
+// should not migrate, while unpinned hogs may move around.
+
+#define NHOGS 4
+
+int
+main(int argc, char *argv[])
+{
+	int hog_pid[NHOGS];
+	int i, j;
+
+	for(i = 0; i < NHOGS; i++){
+		hog_pid[i] = fork();
+		if(hog_pid[i] == 0)
+			for (;;);
+		if(i < NHOGS/2 && setaffinity(hog_pid[i], 1) < 0)
+			printf(1, "setaffinity(%d, 1) failed\n", hog_pid[i]);
+	}
+	if(setaffinity(getpid(), 0) == 0)
+		printf(1, "setaffinity accepted an empty mask\n");
+
+	sleep(500);
+
+	struct pstat st;
+	st.next = 0;
+	do {
+		getpinfo(&st);
+		for(j = 0; j < NHOGS; j++)
+			for (i = 0; i < sizeof(st.pid)/sizeof(st.pid[0]); i++)
+				if(st.inuse[i] && st.pid[i] == hog_pid[j])
+					printf(1, "pid %d %s: %d migrations\n", hog_pid[j],
+					       j < NHOGS/2 ? "pinned" : "free", st.migrations[i]);
+	} while(st.next);
+
+	for(i = 0; i < NHOGS; i++){
+		kill(hog_pid[i]);
+		wait();
+	}
+	exit();
+}
@@ -0,0 +1,1336 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	be 01 00 00 00       	mov    $0x1,%esi
+    1014:	53                   	push   %ebx
+    1015:	51                   	push   %ecx
+    1016:	83 ec 18             	sub    $0x18,%esp
+    1019:	8b 01                	mov    (%ecx),%eax
+    101b:	8b 59 04             	mov    0x4(%ecx),%ebx
+    101e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1021:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+    1024:	83 f8 01             	cmp    $0x1,%eax
+    1027:	7f 26                	jg     104f <main+0x4f>
+    1029:	eb 52                	jmp    107d <main+0x7d>
+    102b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    102f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+    1030:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+    1033:	83 c6 01             	add    $0x1,%esi
+    1036:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+    1039:	50                   	push   %eax
+    103a:	e8 51 00 00 00       	call   1090 <cat>
+    close(fd);
+    103f:	89 3c 24             	mov    %edi,(%esp)
+    1042:	e8 34 03 00 00       	call   137b <close>
+  for(i = 1; i < argc; i++){
+    1047:	83 c4 10             	add    $0x10,%esp
+    104a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+    104d:	74 29                	je     1078 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+    104f:	83 ec 08             	sub    $0x8,%esp
+    1052:	6a 00                	push   $0x0
+    1054:	ff 33                	push   (%ebx)
+    1056:	e8 38 03 00 00       	call   1393 <open>
+    105b:	83 c4 10             	add    $0x10,%esp
+    105e:	89 c7                	mov    %eax,%edi
+    1060:	85 c0                	test   %eax,%eax
+    1062:	79 cc                	jns    1030 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+    1064:	50                   	push   %eax
+    1065:	ff 33                	push   (%ebx)
+    1067:	68 8b 18 00 00       	push   $0x188b
+    106c:	6a 01                	push   $0x1
+    106e:	e8 cd 04 00 00       	call   1540 <printf>
+      exit();
+    1073:	e8 db 02 00 00       	call   1353 <exit>
+  }
+  exit();
+    1078:	e8 d6 02 00 00       	call   1353 <exit>
+    cat(0);
+    107d:	83 ec 0c             	sub    $0xc,%esp
+    1080:	6a 00                	push   $0x0
+    1082:	e8 09 00 00 00       	call   1090 <cat>
+    exit();
+    1087:	e8 c7 02 00 00       	call   1353 <exit>
+    108c:	66 90                	xchg   %ax,%ax
+    108e:	66 90                	xchg   %ax,%ax
+
+00001090 <cat>:
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	56                   	push   %esi
+    1094:	53                   	push   %ebx
+    1095:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+    1098:	eb 1d                	jmp    10b7 <cat+0x27>
+    109a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+    10a0:	83 ec 04             	sub    $0x4,%esp
+    10a3:	53                   	push   %ebx
+    10a4:	68 e0 1b 00 00       	push   $0x1be0
+    10a9:	6a 01                	push   $0x1
+    10ab:	e8 c3 02 00 00       	call   1373 <write>
+    10b0:	83 c4 10             	add    $0x10,%esp
+    10b3:	39 d8                	cmp    %ebx,%eax
+    10b5:	75 25                	jne    10dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+    10b7:	83 ec 04             	sub    $0x4,%esp
+    10ba:	68 00 02 00 00       	push   $0x200
+    10bf:	68 e0 1b 00 00       	push   $0x1be0
+    10c4:	56                   	push   %esi
+    10c5:	e8 a1 02 00 00       	call   136b <read>
+    10ca:	83 c4 10             	add    $0x10,%esp
+    10cd:	89 c3                	mov    %eax,%ebx
+    10cf:	85 c0                	test   %eax,%eax
+    10d1:	7f cd                	jg     10a0 <cat+0x10>
+  if(n < 0){
+    10d3:	75 1b                	jne    10f0 <cat+0x60>
+}
+    10d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10d8:	5b                   	pop    %ebx
+    10d9:	5e                   	pop    %esi
+    10da:	5d                   	pop    %ebp
+    10db:	c3                   	ret
+      printf(1, "cat: write error\n");
+    10dc:	83 ec 08             	sub    $0x8,%esp
+    10df:	68 68 18 00 00       	push   $0x1868
+    10e4:	6a 01                	push   $0x1
+    10e6:	e8 55 04 00 00       	call   1540 <printf>
+      exit();
+    10eb:	e8 63 02 00 00       	call   1353 <exit>
+    printf(1, "cat: read error\n");
+    10f0:	50                   	push   %eax
+    10f1:	50                   	push   %eax
+    10f2:	68 7a 18 00 00       	push   $0x187a
+    10f7:	6a 01                	push   $0x1
+    10f9:	e8 42 04 00 00       	call   1540 <printf>
+    exit();
+    10fe:	e8 50 02 00 00       	call   1353 <exit>
+    1103:	66 90                	xchg   %ax,%ax
+    1105:	66 90                	xchg   %ax,%ax
+    1107:	66 90                	xchg   %ax,%ax
+    1109:	66 90                	xchg   %ax,%ax
+    110b:	66 90                	xchg   %ax,%ax
+    110d:	66 90                	xchg   %ax,%ax
+    110f:	90                   	nop
+
+00001110 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1111:	31 c0                	xor    %eax,%eax
+{
+    1113:	89 e5                	mov    %esp,%ebp
+    1115:	53                   	push   %ebx
+    1116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    111c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1127:	83 c0 01             	add    $0x1,%eax
+    112a:	84 d2                	test   %dl,%dl
+    112c:	75 f2                	jne    1120 <strcpy+0x10>
+    ;
+  return os;
+}
+    112e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1131:	89 c8                	mov    %ecx,%eax
+    1133:	c9                   	leave
+    1134:	c3                   	ret
+    1135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	53                   	push   %ebx
+    1144:	8b 55 08             	mov    0x8(%ebp),%edx
+    1147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    114a:	0f b6 02             	movzbl (%edx),%eax
+    114d:	84 c0                	test   %al,%al
+    114f:	75 17                	jne    1168 <strcmp+0x28>
+    1151:	eb 3a                	jmp    118d <strcmp+0x4d>
+    1153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1157:	90                   	nop
+    1158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    115c:	83 c2 01             	add    $0x1,%edx
+    115f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1162:	84 c0                	test   %al,%al
+    1164:	74 1a                	je     1180 <strcmp+0x40>
+    p++, q++;
+    1166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1168:	0f b6 19             	movzbl (%ecx),%ebx
+    116b:	38 c3                	cmp    %al,%bl
+    116d:	74 e9                	je     1158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    116f:	29 d8                	sub    %ebx,%eax
+}
+    1171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1174:	c9                   	leave
+    1175:	c3                   	ret
+    1176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1184:	31 c0                	xor    %eax,%eax
+    1186:	29 d8                	sub    %ebx,%eax
+}
+    1188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    118b:	c9                   	leave
+    118c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    118d:	0f b6 19             	movzbl (%ecx),%ebx
+    1190:	31 c0                	xor    %eax,%eax
+    1192:	eb db                	jmp    116f <strcmp+0x2f>
+    1194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    119b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    119f:	90                   	nop
+
+000011a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    11a0:	55                   	push   %ebp
+    11a1:	89 e5                	mov    %esp,%ebp
+    11a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    11a6:	80 3a 00             	cmpb   $0x0,(%edx)
+    11a9:	74 15                	je     11c0 <strlen+0x20>
+    11ab:	31 c0                	xor    %eax,%eax
+    11ad:	8d 76 00             	lea    0x0(%esi),%esi
+    11b0:	83 c0 01             	add    $0x1,%eax
+    11b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    11b7:	89 c1                	mov    %eax,%ecx
+    11b9:	75 f5                	jne    11b0 <strlen+0x10>
+    ;
+  return n;
+}
+    11bb:	89 c8                	mov    %ecx,%eax
+    11bd:	5d                   	pop    %ebp
+    11be:	c3                   	ret
+    11bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    11c0:	31 c9                	xor    %ecx,%ecx
+}
+    11c2:	5d                   	pop    %ebp
+    11c3:	89 c8                	mov    %ecx,%eax
+    11c5:	c3                   	ret
+    11c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000011d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    11d0:	55                   	push   %ebp
+    11d1:	89 e5                	mov    %esp,%ebp
+    11d3:	57                   	push   %edi
+    11d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    11d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    11da:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11dd:	89 d7                	mov    %edx,%edi
+    11df:	fc                   	cld
+    11e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    11e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    11e5:	89 d0                	mov    %edx,%eax
+    11e7:	c9                   	leave
+    11e8:	c3                   	ret
+    11e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    11f0:	55                   	push   %ebp
+    11f1:	89 e5                	mov    %esp,%ebp
+    11f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    11fa:	0f b6 10             	movzbl (%eax),%edx
+    11fd:	84 d2                	test   %dl,%dl
+    11ff:	75 12                	jne    1213 <strchr+0x23>
+    1201:	eb 1d                	jmp    1220 <strchr+0x30>
+    1203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1207:	90                   	nop
+    1208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    120c:	83 c0 01             	add    $0x1,%eax
+    120f:	84 d2                	test   %dl,%dl
+    1211:	74 0d                	je     1220 <strchr+0x30>
+    if(*s == c)
+    1213:	38 d1                	cmp    %dl,%cl
+    1215:	75 f1                	jne    1208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1217:	5d                   	pop    %ebp
+    1218:	c3                   	ret
+    1219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1220:	31 c0                	xor    %eax,%eax
+}
+    1222:	5d                   	pop    %ebp
+    1223:	c3                   	ret
+    1224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    122f:	90                   	nop
+
+00001230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	57                   	push   %edi
+    1234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1239:	31 db                	xor    %ebx,%ebx
+{
+    123b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    123e:	eb 27                	jmp    1267 <gets+0x37>
+    cc = read(0, &c, 1);
+    1240:	83 ec 04             	sub    $0x4,%esp
+    1243:	6a 01                	push   $0x1
+    1245:	56                   	push   %esi
+    1246:	6a 00                	push   $0x0
+    1248:	e8 1e 01 00 00       	call   136b <read>
+    if(cc < 1)
+    124d:	83 c4 10             	add    $0x10,%esp
+    1250:	85 c0                	test   %eax,%eax
+    1252:	7e 1d                	jle    1271 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1258:	8b 55 08             	mov    0x8(%ebp),%edx
+    125b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    125f:	3c 0a                	cmp    $0xa,%al
+    1261:	74 10                	je     1273 <gets+0x43>
+    1263:	3c 0d                	cmp    $0xd,%al
+    1265:	74 0c                	je     1273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1267:	89 df                	mov    %ebx,%edi
+    1269:	83 c3 01             	add    $0x1,%ebx
+    126c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    126f:	7c cf                	jl     1240 <gets+0x10>
+    1271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1273:	8b 45 08             	mov    0x8(%ebp),%eax
+    1276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    127a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    127d:	5b                   	pop    %ebx
+    127e:	5e                   	pop    %esi
+    127f:	5f                   	pop    %edi
+    1280:	5d                   	pop    %ebp
+    1281:	c3                   	ret
+    1282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	56                   	push   %esi
+    1294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1295:	83 ec 08             	sub    $0x8,%esp
+    1298:	6a 00                	push   $0x0
+    129a:	ff 75 08             	push   0x8(%ebp)
+    129d:	e8 f1 00 00 00       	call   1393 <open>
+  if(fd < 0)
+    12a2:	83 c4 10             	add    $0x10,%esp
+    12a5:	85 c0                	test   %eax,%eax
+    12a7:	78 27                	js     12d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    12a9:	83 ec 08             	sub    $0x8,%esp
+    12ac:	ff 75 0c             	push   0xc(%ebp)
+    12af:	89 c3                	mov    %eax,%ebx
+    12b1:	50                   	push   %eax
+    12b2:	e8 f4 00 00 00       	call   13ab <fstat>
+  close(fd);
+    12b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    12ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+    12bc:	e8 ba 00 00 00       	call   137b <close>
+  return r;
+    12c1:	83 c4 10             	add    $0x10,%esp
+}
+    12c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12c7:	89 f0                	mov    %esi,%eax
+    12c9:	5b                   	pop    %ebx
+    12ca:	5e                   	pop    %esi
+    12cb:	5d                   	pop    %ebp
+    12cc:	c3                   	ret
+    12cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    12d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    12d5:	eb ed                	jmp    12c4 <stat+0x34>
+    12d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12de:	66 90                	xchg   %ax,%ax
+
+000012e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    12e0:	55                   	push   %ebp
+    12e1:	89 e5                	mov    %esp,%ebp
+    12e3:	53                   	push   %ebx
+    12e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    12e7:	0f be 02             	movsbl (%edx),%eax
+    12ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    12ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    12f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    12f5:	77 1e                	ja     1315 <atoi+0x35>
+    12f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1300:	83 c2 01             	add    $0x1,%edx
+    1303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    130a:	0f be 02             	movsbl (%edx),%eax
+    130d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1310:	80 fb 09             	cmp    $0x9,%bl
+    1313:	76 eb                	jbe    1300 <atoi+0x20>
+  return n;
+}
+    1315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1318:	89 c8                	mov    %ecx,%eax
+    131a:	c9                   	leave
+    131b:	c3                   	ret
+    131c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	57                   	push   %edi
+    1324:	56                   	push   %esi
+    1325:	8b 45 10             	mov    0x10(%ebp),%eax
+    1328:	8b 55 08             	mov    0x8(%ebp),%edx
+    132b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    132e:	85 c0                	test   %eax,%eax
+    1330:	7e 13                	jle    1345 <memmove+0x25>
+    1332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1334:	89 d7                	mov    %edx,%edi
+    1336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1341:	39 f8                	cmp    %edi,%eax
+    1343:	75 fb                	jne    1340 <memmove+0x20>
+  return vdst;
+}
+    1345:	5e                   	pop    %esi
+    1346:	89 d0                	mov    %edx,%eax
+    1348:	5f                   	pop    %edi
+    1349:	5d                   	pop    %ebp
+    134a:	c3                   	ret
+
+0000134b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    134b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1350:	cd 40                	int    $0x40
+    1352:	c3                   	ret
+
+00001353 <exit>:
+SYSCALL(exit)
+    1353:	b8 02 00 00 00       	mov    $0x2,%eax
+    1358:	cd 40                	int    $0x40
+    135a:	c3                   	ret
+
+0000135b <wait>:
+SYSCALL(wait)
+    135b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1360:	cd 40                	int    $0x40
+    1362:	c3                   	ret
+
+00001363 <pipe>:
+SYSCALL(pipe)
+    1363:	b8 04 00 00 00       	mov    $0x4,%eax
+    1368:	cd 40                	int    $0x40
+    136a:	c3                   	ret
+
+0000136b <read>:
+SYSCALL(read)
+    136b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1370:	cd 40                	int    $0x40
+    1372:	c3                   	ret
+
+00001373 <write>:
+SYSCALL(write)
+    1373:	b8 10 00 00 00       	mov    $0x10,%eax
+    1378:	cd 40                	int    $0x40
+    137a:	c3                   	ret
+
+0000137b <close>:
+SYSCALL(close)
+    137b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1380:	cd 40                	int    $0x40
+    1382:	c3                   	ret
+
+00001383 <kill>:
+SYSCALL(kill)
+    1383:	b8 06 00 00 00       	mov    $0x6,%eax
+    1388:	cd 40                	int    $0x40
+    138a:	c3                   	ret
+
+0000138b <exec>:
+SYSCALL(exec)
+    138b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1390:	cd 40                	int    $0x40
+    1392:	c3                   	ret
+
+00001393 <open>:
+SYSCALL(open)
+    1393:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1398:	cd 40                	int    $0x40
+    139a:	c3                   	ret
+
+0000139b <mknod>:
+SYSCALL(mknod)
+    139b:	b8 11 00 00 00       	mov    $0x11,%eax
+    13a0:	cd 40                	int    $0x40
+    13a2:	c3                   	ret
+
+000013a3 <unlink>:
+SYSCALL(unlink)
+    13a3:	b8 12 00 00 00       	mov    $0x12,%eax
+    13a8:	cd 40                	int    $0x40
+    13aa:	c3                   	ret
+
+000013ab <fstat>:
+SYSCALL(fstat)
+    13ab:	b8 08 00 00 00       	mov    $0x8,%eax
+    13b0:	cd 40                	int    $0x40
+    13b2:	c3                   	ret
+
+000013b3 <link>:
+SYSCALL(link)
+    13b3:	b8 13 00 00 00       	mov    $0x13,%eax
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+
+000013bb <mkdir>:
+SYSCALL(mkdir)
+    13bb:	b8 14 00 00 00       	mov    $0x14,%eax
+    13c0:	cd 40                	int    $0x40
+    13c2:	c3                   	ret
+
+000013c3 <chdir>:
+SYSCALL(chdir)
+    13c3:	b8 09 00 00 00       	mov    $0x9,%eax
+    13c8:	cd 40                	int    $0x40
+    13ca:	c3                   	ret
+
+000013cb <dup>:
+SYSCALL(dup)
+    13cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    13d0:	cd 40                	int    $0x40
+    13d2:	c3                   	ret
+
+000013d3 <getpid>:
+SYSCALL(getpid)
+    13d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    13d8:	cd 40                	int    $0x40
+    13da:	c3                   	ret
+
+000013db <sbrk>:
+SYSCALL(sbrk)
+    13db:	b8 0c 00 00 00       	mov    $0xc,%eax
+    13e0:	cd 40                	int    $0x40
+    13e2:	c3                   	ret
+
+000013e3 <sleep>:
+SYSCALL(sleep)
+    13e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+
+000013eb <uptime>:
+SYSCALL(uptime)
+    13eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    13f0:	cd 40                	int    $0x40
+    13f2:	c3                   	ret
+
+000013f3 <settickets>:
+SYSCALL(settickets)
+    13f3:	b8 16 00 00 00       	mov    $0x16,%eax
+    13f8:	cd 40                	int    $0x40
+    13fa:	c3                   	ret
+
+000013fb <getpinfo>:
+SYSCALL(getpinfo)
+    13fb:	b8 17 00 00 00       	mov    $0x17,%eax
+    1400:	cd 40                	int    $0x40
+    1402:	c3                   	ret
+
+00001403 <mprotect>:
+SYSCALL(mprotect)
+    1403:	b8 18 00 00 00       	mov    $0x18,%eax
+    1408:	cd 40                	int    $0x40
+    140a:	c3                   	ret
+
+0000140b <munprotect>:
+SYSCALL(munprotect)
+    140b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1410:	cd 40                	int    $0x40
+    1412:	c3                   	ret
+
+00001413 <clone>:
+SYSCALL(clone)
+    1413:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1418:	cd 40                	int    $0x40
+    141a:	c3                   	ret
+
+0000141b <join>:
+SYSCALL(join)
+    141b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1420:	cd 40                	int    $0x40
+    1422:	c3                   	ret
+
+00001423 <initlock_t>:
+SYSCALL(initlock_t)
+    1423:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1428:	cd 40                	int    $0x40
+    142a:	c3                   	ret
+
+0000142b <acquire_t>:
+SYSCALL(acquire_t)
+    142b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1430:	cd 40                	int    $0x40
+    1432:	c3                   	ret
+
+00001433 <release_t>:
+SYSCALL(release_t)
+    1433:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1438:	cd 40                	int    $0x40
+    143a:	c3                   	ret
+
+0000143b <setsched>:
+SYSCALL(setsched)
+    143b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1440:	cd 40                	int    $0x40
+    1442:	c3                   	ret
+
+00001443 <mkgroup>:
+SYSCALL(mkgroup)
+    1443:	b8 20 00 00 00       	mov    $0x20,%eax
+    1448:	cd 40                	int    $0x40
+    144a:	c3                   	ret
+
+0000144b <joingroup>:
+SYSCALL(joingroup)
+    144b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1450:	cd 40                	int    $0x40
+    1452:	c3                   	ret
+
+00001453 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1453:	b8 22 00 00 00       	mov    $0x22,%eax
+    1458:	cd 40                	int    $0x40
+    145a:	c3                   	ret
+
+0000145b <setdeadline>:
+SYSCALL(setdeadline)
+    145b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1460:	cd 40                	int    $0x40
+    1462:	c3                   	ret
+
+00001463 <setaffinity>:
+SYSCALL(setaffinity)
+    1463:	b8 24 00 00 00       	mov    $0x24,%eax
+    1468:	cd 40                	int    $0x40
+    146a:	c3                   	ret
+
+0000146b <yield_to>:
+SYSCALL(yield_to)
+    146b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1470:	cd 40                	int    $0x40
+    1472:	c3                   	ret
+
+00001473 <getlatency>:
+SYSCALL(getlatency)
+    1473:	b8 26 00 00 00       	mov    $0x26,%eax
+    1478:	cd 40                	int    $0x40
+    147a:	c3                   	ret
+
+0000147b <futex_wait>:
+SYSCALL(futex_wait)
+    147b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1480:	cd 40                	int    $0x40
+    1482:	c3                   	ret
+
+00001483 <futex_wake>:
+SYSCALL(futex_wake)
+    1483:	b8 28 00 00 00       	mov    $0x28,%eax
+    1488:	cd 40                	int    $0x40
+    148a:	c3                   	ret
+
+0000148b <mguard>:
+SYSCALL(mguard)
+    148b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1490:	cd 40                	int    $0x40
+    1492:	c3                   	ret
+
+00001493 <join_any>:
+SYSCALL(join_any)
+    1493:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1498:	cd 40                	int    $0x40
+    149a:	c3                   	ret
+    149b:	66 90                	xchg   %ax,%ax
+    149d:	66 90                	xchg   %ax,%ax
+    149f:	90                   	nop
+
+000014a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    14a0:	55                   	push   %ebp
+    14a1:	89 e5                	mov    %esp,%ebp
+    14a3:	57                   	push   %edi
+    14a4:	56                   	push   %esi
+    14a5:	53                   	push   %ebx
+    14a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    14a8:	89 d1                	mov    %edx,%ecx
+{
+    14aa:	83 ec 3c             	sub    $0x3c,%esp
+    14ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    14b0:	85 d2                	test   %edx,%edx
+    14b2:	0f 89 80 00 00 00    	jns    1538 <printint+0x98>
+    14b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    14bc:	74 7a                	je     1538 <printint+0x98>
+    x = -xx;
+    14be:	f7 d9                	neg    %ecx
+    neg = 1;
+    14c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    14c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    14c8:	31 f6                	xor    %esi,%esi
+    14ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    14d0:	89 c8                	mov    %ecx,%eax
+    14d2:	31 d2                	xor    %edx,%edx
+    14d4:	89 f7                	mov    %esi,%edi
+    14d6:	f7 f3                	div    %ebx
+    14d8:	8d 76 01             	lea    0x1(%esi),%esi
+    14db:	0f b6 92 00 19 00 00 	movzbl 0x1900(%edx),%edx
+    14e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    14e6:	89 ca                	mov    %ecx,%edx
+    14e8:	89 c1                	mov    %eax,%ecx
+    14ea:	39 da                	cmp    %ebx,%edx
+    14ec:	73 e2                	jae    14d0 <printint+0x30>
+  if(neg)
+    14ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    14f1:	85 c0                	test   %eax,%eax
+    14f3:	74 07                	je     14fc <printint+0x5c>
+    buf[i++] = '-';
+    14f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    14fa:	89 f7                	mov    %esi,%edi
+    14fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    14ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1502:	01 df                	add    %ebx,%edi
+    1504:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1508:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    150b:	83 ec 04             	sub    $0x4,%esp
+    150e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1511:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1514:	6a 01                	push   $0x1
+    1516:	50                   	push   %eax
+    1517:	56                   	push   %esi
+    1518:	e8 56 fe ff ff       	call   1373 <write>
+  while(--i >= 0)
+    151d:	89 f8                	mov    %edi,%eax
+    151f:	83 c4 10             	add    $0x10,%esp
+    1522:	83 ef 01             	sub    $0x1,%edi
+    1525:	39 d8                	cmp    %ebx,%eax
+    1527:	75 df                	jne    1508 <printint+0x68>
+}
+    1529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    152c:	5b                   	pop    %ebx
+    152d:	5e                   	pop    %esi
+    152e:	5f                   	pop    %edi
+    152f:	5d                   	pop    %ebp
+    1530:	c3                   	ret
+    1531:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1538:	31 c0                	xor    %eax,%eax
+    153a:	eb 89                	jmp    14c5 <printint+0x25>
+    153c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001540 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1540:	55                   	push   %ebp
+    1541:	89 e5                	mov    %esp,%ebp
+    1543:	57                   	push   %edi
+    1544:	56                   	push   %esi
+    1545:	53                   	push   %ebx
+    1546:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1549:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    154c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    154f:	0f b6 1e             	movzbl (%esi),%ebx
+    1552:	83 c6 01             	add    $0x1,%esi
+    1555:	84 db                	test   %bl,%bl
+    1557:	74 67                	je     15c0 <printf+0x80>
+    1559:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    155c:	31 d2                	xor    %edx,%edx
+    155e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1561:	eb 34                	jmp    1597 <printf+0x57>
+    1563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1567:	90                   	nop
+    1568:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    156b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1570:	83 f8 25             	cmp    $0x25,%eax
+    1573:	74 18                	je     158d <printf+0x4d>
+  write(fd, &c, 1);
+    1575:	83 ec 04             	sub    $0x4,%esp
+    1578:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    157b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    157e:	6a 01                	push   $0x1
+    1580:	50                   	push   %eax
+    1581:	57                   	push   %edi
+    1582:	e8 ec fd ff ff       	call   1373 <write>
+    1587:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    158a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    158d:	0f b6 1e             	movzbl (%esi),%ebx
+    1590:	83 c6 01             	add    $0x1,%esi
+    1593:	84 db                	test   %bl,%bl
+    1595:	74 29                	je     15c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1597:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    159a:	85 d2                	test   %edx,%edx
+    159c:	74 ca                	je     1568 <printf+0x28>
+      }
+    } else if(state == '%'){
+    159e:	83 fa 25             	cmp    $0x25,%edx
+    15a1:	75 ea                	jne    158d <printf+0x4d>
+      if(c == 'd'){
+    15a3:	83 f8 25             	cmp    $0x25,%eax
+    15a6:	0f 84 24 01 00 00    	je     16d0 <printf+0x190>
+    15ac:	83 e8 63             	sub    $0x63,%eax
+    15af:	83 f8 15             	cmp    $0x15,%eax
+    15b2:	77 1c                	ja     15d0 <printf+0x90>
+    15b4:	ff 24 85 a8 18 00 00 	jmp    *0x18a8(,%eax,4)
+    15bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    15c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15c3:	5b                   	pop    %ebx
+    15c4:	5e                   	pop    %esi
+    15c5:	5f                   	pop    %edi
+    15c6:	5d                   	pop    %ebp
+    15c7:	c3                   	ret
+    15c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15cf:	90                   	nop
+  write(fd, &c, 1);
+    15d0:	83 ec 04             	sub    $0x4,%esp
+    15d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    15d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    15da:	6a 01                	push   $0x1
+    15dc:	52                   	push   %edx
+    15dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    15e0:	57                   	push   %edi
+    15e1:	e8 8d fd ff ff       	call   1373 <write>
+    15e6:	83 c4 0c             	add    $0xc,%esp
+    15e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    15ec:	6a 01                	push   $0x1
+    15ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    15f1:	52                   	push   %edx
+    15f2:	57                   	push   %edi
+    15f3:	e8 7b fd ff ff       	call   1373 <write>
+        putc(fd, c);
+    15f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    15fb:	31 d2                	xor    %edx,%edx
+    15fd:	eb 8e                	jmp    158d <printf+0x4d>
+    15ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1600:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1603:	83 ec 0c             	sub    $0xc,%esp
+    1606:	b9 10 00 00 00       	mov    $0x10,%ecx
+    160b:	8b 13                	mov    (%ebx),%edx
+    160d:	6a 00                	push   $0x0
+    160f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1611:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1614:	e8 87 fe ff ff       	call   14a0 <printint>
+        ap++;
+    1619:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    161c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    161f:	31 d2                	xor    %edx,%edx
+    1621:	e9 67 ff ff ff       	jmp    158d <printf+0x4d>
+    1626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    162d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1630:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1633:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1635:	83 c0 04             	add    $0x4,%eax
+    1638:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    163b:	85 db                	test   %ebx,%ebx
+    163d:	0f 84 9d 00 00 00    	je     16e0 <printf+0x1a0>
+        while(*s != 0){
+    1643:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1646:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1648:	84 c0                	test   %al,%al
+    164a:	0f 84 3d ff ff ff    	je     158d <printf+0x4d>
+    1650:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1653:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1656:	89 de                	mov    %ebx,%esi
+    1658:	89 d3                	mov    %edx,%ebx
+    165a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1660:	83 ec 04             	sub    $0x4,%esp
+    1663:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1666:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1669:	6a 01                	push   $0x1
+    166b:	53                   	push   %ebx
+    166c:	57                   	push   %edi
+    166d:	e8 01 fd ff ff       	call   1373 <write>
+        while(*s != 0){
+    1672:	0f b6 06             	movzbl (%esi),%eax
+    1675:	83 c4 10             	add    $0x10,%esp
+    1678:	84 c0                	test   %al,%al
+    167a:	75 e4                	jne    1660 <printf+0x120>
+      state = 0;
+    167c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    167f:	31 d2                	xor    %edx,%edx
+    1681:	e9 07 ff ff ff       	jmp    158d <printf+0x4d>
+    1686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    168d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1693:	83 ec 0c             	sub    $0xc,%esp
+    1696:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    169b:	8b 13                	mov    (%ebx),%edx
+    169d:	6a 01                	push   $0x1
+    169f:	e9 6b ff ff ff       	jmp    160f <printf+0xcf>
+    16a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    16a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    16ab:	83 ec 04             	sub    $0x4,%esp
+    16ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    16b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    16b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    16b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    16b9:	6a 01                	push   $0x1
+    16bb:	52                   	push   %edx
+    16bc:	57                   	push   %edi
+    16bd:	e8 b1 fc ff ff       	call   1373 <write>
+        ap++;
+    16c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    16c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    16c8:	31 d2                	xor    %edx,%edx
+    16ca:	e9 be fe ff ff       	jmp    158d <printf+0x4d>
+    16cf:	90                   	nop
+  write(fd, &c, 1);
+    16d0:	83 ec 04             	sub    $0x4,%esp
+    16d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    16d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    16d9:	6a 01                	push   $0x1
+    16db:	e9 11 ff ff ff       	jmp    15f1 <printf+0xb1>
+    16e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    16e5:	bb a0 18 00 00       	mov    $0x18a0,%ebx
+    16ea:	e9 61 ff ff ff       	jmp    1650 <printf+0x110>
+    16ef:	90                   	nop
+
+000016f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    16f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16f1:	a1 e0 1d 00 00       	mov    0x1de0,%eax
+{
+    16f6:	89 e5                	mov    %esp,%ebp
+    16f8:	57                   	push   %edi
+    16f9:	56                   	push   %esi
+    16fa:	53                   	push   %ebx
+    16fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    16fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1708:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    170a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    170c:	39 ca                	cmp    %ecx,%edx
+    170e:	73 30                	jae    1740 <free+0x50>
+    1710:	39 c1                	cmp    %eax,%ecx
+    1712:	72 04                	jb     1718 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1714:	39 c2                	cmp    %eax,%edx
+    1716:	72 f0                	jb     1708 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1718:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    171b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    171e:	39 f8                	cmp    %edi,%eax
+    1720:	74 2e                	je     1750 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1722:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1725:	8b 42 04             	mov    0x4(%edx),%eax
+    1728:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    172b:	39 f1                	cmp    %esi,%ecx
+    172d:	74 38                	je     1767 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    172f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1731:	5b                   	pop    %ebx
+  freep = p;
+    1732:	89 15 e0 1d 00 00    	mov    %edx,0x1de0
+}
+    1738:	5e                   	pop    %esi
+    1739:	5f                   	pop    %edi
+    173a:	5d                   	pop    %ebp
+    173b:	c3                   	ret
+    173c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1740:	39 c1                	cmp    %eax,%ecx
+    1742:	72 d0                	jb     1714 <free+0x24>
+    1744:	eb c2                	jmp    1708 <free+0x18>
+    1746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    174d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1750:	03 70 04             	add    0x4(%eax),%esi
+    1753:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1756:	8b 02                	mov    (%edx),%eax
+    1758:	8b 00                	mov    (%eax),%eax
+    175a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    175d:	8b 42 04             	mov    0x4(%edx),%eax
+    1760:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1763:	39 f1                	cmp    %esi,%ecx
+    1765:	75 c8                	jne    172f <free+0x3f>
+    p->s.size += bp->s.size;
+    1767:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    176a:	89 15 e0 1d 00 00    	mov    %edx,0x1de0
+    p->s.size += bp->s.size;
+    1770:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1773:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1776:	89 0a                	mov    %ecx,(%edx)
+}
+    1778:	5b                   	pop    %ebx
+    1779:	5e                   	pop    %esi
+    177a:	5f                   	pop    %edi
+    177b:	5d                   	pop    %ebp
+    177c:	c3                   	ret
+    177d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001780 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1780:	55                   	push   %ebp
+    1781:	89 e5                	mov    %esp,%ebp
+    1783:	57                   	push   %edi
+    1784:	56                   	push   %esi
+    1785:	53                   	push   %ebx
+    1786:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1789:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    178c:	8b 15 e0 1d 00 00    	mov    0x1de0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1792:	8d 78 07             	lea    0x7(%eax),%edi
+    1795:	c1 ef 03             	shr    $0x3,%edi
+    1798:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    179b:	85 d2                	test   %edx,%edx
+    179d:	0f 84 8d 00 00 00    	je     1830 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    17a5:	8b 48 04             	mov    0x4(%eax),%ecx
+    17a8:	39 f9                	cmp    %edi,%ecx
+    17aa:	73 64                	jae    1810 <malloc+0x90>
+  if(nu < 4096)
+    17ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    17b1:	39 df                	cmp    %ebx,%edi
+    17b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    17b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    17bd:	eb 0a                	jmp    17c9 <malloc+0x49>
+    17bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    17c2:	8b 48 04             	mov    0x4(%eax),%ecx
+    17c5:	39 f9                	cmp    %edi,%ecx
+    17c7:	73 47                	jae    1810 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    17c9:	89 c2                	mov    %eax,%edx
+    17cb:	39 05 e0 1d 00 00    	cmp    %eax,0x1de0
+    17d1:	75 ed                	jne    17c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    17d3:	83 ec 0c             	sub    $0xc,%esp
+    17d6:	56                   	push   %esi
+    17d7:	e8 ff fb ff ff       	call   13db <sbrk>
+  if(p == (char*)-1)
+    17dc:	83 c4 10             	add    $0x10,%esp
+    17df:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17e2:	74 1c                	je     1800 <malloc+0x80>
+  hp->s.size = nu;
+    17e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    17e7:	83 ec 0c             	sub    $0xc,%esp
+    17ea:	83 c0 08             	add    $0x8,%eax
+    17ed:	50                   	push   %eax
+    17ee:	e8 fd fe ff ff       	call   16f0 <free>
+  return freep;
+    17f3:	8b 15 e0 1d 00 00    	mov    0x1de0,%edx
+      if((p = morecore(nunits)) == 0)
+    17f9:	83 c4 10             	add    $0x10,%esp
+    17fc:	85 d2                	test   %edx,%edx
+    17fe:	75 c0                	jne    17c0 <malloc+0x40>
+        return 0;
+  }
+}
+    1800:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1803:	31 c0                	xor    %eax,%eax
+}
+    1805:	5b                   	pop    %ebx
+    1806:	5e                   	pop    %esi
+    1807:	5f                   	pop    %edi
+    1808:	5d                   	pop    %ebp
+    1809:	c3                   	ret
+    180a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1810:	39 cf                	cmp    %ecx,%edi
+    1812:	74 4c                	je     1860 <malloc+0xe0>
+        p->s.size -= nunits;
+    1814:	29 f9                	sub    %edi,%ecx
+    1816:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1819:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    181c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    181f:	89 15 e0 1d 00 00    	mov    %edx,0x1de0
+}
+    1825:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1828:	83 c0 08             	add    $0x8,%eax
+}
+    182b:	5b                   	pop    %ebx
+    182c:	5e                   	pop    %esi
+    182d:	5f                   	pop    %edi
+    182e:	5d                   	pop    %ebp
+    182f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1830:	c7 05 e0 1d 00 00 e4 	movl   $0x1de4,0x1de0
+    1837:	1d 00 00 
+    base.s.size = 0;
+    183a:	b8 e4 1d 00 00       	mov    $0x1de4,%eax
+    base.s.ptr = freep = prevp = &base;
+    183f:	c7 05 e4 1d 00 00 e4 	movl   $0x1de4,0x1de4
+    1846:	1d 00 00 
+    base.s.size = 0;
+    1849:	c7 05 e8 1d 00 00 00 	movl   $0x0,0x1de8
+    1850:	00 00 00 
+    if(p->s.size >= nunits){
+    1853:	e9 54 ff ff ff       	jmp    17ac <malloc+0x2c>
+    1858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    185f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1860:	8b 08                	mov    (%eax),%ecx
+    1862:	89 0a                	mov    %ecx,(%edx)
+    1864:	eb b9                	jmp    181f <malloc+0x9f>
@@ -0,0 +1,7 @@
+// Flags to clone() and join_any().
+#define CLONE_DETACHED 0x1  // free the thread as soon as it exits; it is never joined
+#define CLONE_FILES    0x2  // share the file descriptor table rather than copy it
+#define CLONE_FS       0x4  // share the current directory rather than copy it
+
+#define JOIN_NOHANG    0x1  // return 0 rather than wait for a thread to exit
+#define JOIN_DETACHED  0x2  // only collect stacks of exited detached threads
@@ -1,7 +1,10 @@
 struct buf;
 struct context;
+struct cwd;
+struct fdtable;
 struct file;
 struct inode;
+struct mm;
 struct pipe;
 struct proc;
 struct rtcdate;
@@ -35,6 +38,16 @@ void            fileinit(void);
 int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+struct fdtable* fdtalloc(void);
+struct fdtable* fdtcopy(struct fdtable*);
+struct fdtable* fdtdup(struct fdtable*);
+void            fdtput(struct fdtable*);
+struct cwd*     cwdalloc(struct inode*);
+struct cwd*     cwdcopy(struct cwd*);
+struct cwd*     cwddup(struct cwd*);
+void            cwdput(struct cwd*);
+struct inode*   cwdget(struct cwd*);
+struct inode*   cwdset(struct cwd*, struct inode*);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
@@ -81,6 +94,8 @@ extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
 void            lapicstartap(uchar, uint);
+uint            lapictimer(void);
+void            lapicipi(int, int);
 void            microdelay(int);
 
 // log.c
@@ -121,14 +136,28 @@ void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
+void            wakeone(void*);
 void            yield(void);
 int             settickets(int);
 int             getpinfo(struct pstat*);
-int		 clone(void(*)(void*, void*),void *, void *,void *);
+int		 clone(void(*)(void*, void*),void *, void *,void *, int);
 int 		 join(void**);
+int             join_any(int*, void**, int, int);
 void 		 initlock_t(struct ticketlock *lk);
 void 		 acquire_t(struct ticketlock *lk);
 void 		 release_t(struct ticketlock *lk);
+int             setsched(int);
+int             mkgroup(int);
+int             joingroup(int);
+int             transfer_tickets(int);
+int             setdeadline(int, int);
+int             setaffinity(int, int);
+int             yield_to(int);
+void            cputime(int);
+int             getlatency(int, uint*);
+int             futex_wait(uint, int);
+int             futex_wake(uint, int);
+void            schedtick(void);
 
 // swtch.S
 void            swtch(struct context**, struct context*);
@@ -186,7 +215,13 @@ pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
+void            shrinkuvm(struct mm*, uint, uint);
+void            tlbshootdown(struct mm*);
 void            freevm(pde_t*);
+void            mminit(void);
+struct mm*      mmalloc(pde_t*, uint);
+void            mmdup(struct mm*);
+void            mmput(struct mm*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
@@ -196,6 +231,7 @@ int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
 int             mprotect(void *addr, int len);
 int             munprotect(void *addr, int len);
+int             mguard(void *addr, int len);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
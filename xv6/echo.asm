@@ -0,0 +1,1250 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	51                   	push   %ecx
+    1011:	83 ec 08             	sub    $0x8,%esp
+    1014:	8b 31                	mov    (%ecx),%esi
+    1016:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+    1019:	83 fe 01             	cmp    $0x1,%esi
+    101c:	7e 47                	jle    1065 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+    101e:	8b 47 04             	mov    0x4(%edi),%eax
+    1021:	83 fe 02             	cmp    $0x2,%esi
+    1024:	74 2a                	je     1050 <main+0x50>
+    1026:	bb 02 00 00 00       	mov    $0x2,%ebx
+    102b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    102f:	90                   	nop
+    1030:	68 c8 17 00 00       	push   $0x17c8
+    1035:	83 c3 01             	add    $0x1,%ebx
+    1038:	50                   	push   %eax
+    1039:	68 ca 17 00 00       	push   $0x17ca
+    103e:	6a 01                	push   $0x1
+    1040:	e8 5b 04 00 00       	call   14a0 <printf>
+    1045:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+    1049:	83 c4 10             	add    $0x10,%esp
+    104c:	39 f3                	cmp    %esi,%ebx
+    104e:	75 e0                	jne    1030 <main+0x30>
+    1050:	68 cf 17 00 00       	push   $0x17cf
+    1055:	50                   	push   %eax
+    1056:	68 ca 17 00 00       	push   $0x17ca
+    105b:	6a 01                	push   $0x1
+    105d:	e8 3e 04 00 00       	call   14a0 <printf>
+    1062:	83 c4 10             	add    $0x10,%esp
+  exit();
+    1065:	e8 49 02 00 00       	call   12b3 <exit>
+    106a:	66 90                	xchg   %ax,%ax
+    106c:	66 90                	xchg   %ax,%ax
+    106e:	66 90                	xchg   %ax,%ax
+
+00001070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1070:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1071:	31 c0                	xor    %eax,%eax
+{
+    1073:	89 e5                	mov    %esp,%ebp
+    1075:	53                   	push   %ebx
+    1076:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1079:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    107c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1080:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1084:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1087:	83 c0 01             	add    $0x1,%eax
+    108a:	84 d2                	test   %dl,%dl
+    108c:	75 f2                	jne    1080 <strcpy+0x10>
+    ;
+  return os;
+}
+    108e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1091:	89 c8                	mov    %ecx,%eax
+    1093:	c9                   	leave
+    1094:	c3                   	ret
+    1095:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000010a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    10a0:	55                   	push   %ebp
+    10a1:	89 e5                	mov    %esp,%ebp
+    10a3:	53                   	push   %ebx
+    10a4:	8b 55 08             	mov    0x8(%ebp),%edx
+    10a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    10aa:	0f b6 02             	movzbl (%edx),%eax
+    10ad:	84 c0                	test   %al,%al
+    10af:	75 17                	jne    10c8 <strcmp+0x28>
+    10b1:	eb 3a                	jmp    10ed <strcmp+0x4d>
+    10b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10b7:	90                   	nop
+    10b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    10bc:	83 c2 01             	add    $0x1,%edx
+    10bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    10c2:	84 c0                	test   %al,%al
+    10c4:	74 1a                	je     10e0 <strcmp+0x40>
+    p++, q++;
+    10c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    10c8:	0f b6 19             	movzbl (%ecx),%ebx
+    10cb:	38 c3                	cmp    %al,%bl
+    10cd:	74 e9                	je     10b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    10cf:	29 d8                	sub    %ebx,%eax
+}
+    10d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10d4:	c9                   	leave
+    10d5:	c3                   	ret
+    10d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    10e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    10e4:	31 c0                	xor    %eax,%eax
+    10e6:	29 d8                	sub    %ebx,%eax
+}
+    10e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10eb:	c9                   	leave
+    10ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    10ed:	0f b6 19             	movzbl (%ecx),%ebx
+    10f0:	31 c0                	xor    %eax,%eax
+    10f2:	eb db                	jmp    10cf <strcmp+0x2f>
+    10f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10ff:	90                   	nop
+
+00001100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1106:	80 3a 00             	cmpb   $0x0,(%edx)
+    1109:	74 15                	je     1120 <strlen+0x20>
+    110b:	31 c0                	xor    %eax,%eax
+    110d:	8d 76 00             	lea    0x0(%esi),%esi
+    1110:	83 c0 01             	add    $0x1,%eax
+    1113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1117:	89 c1                	mov    %eax,%ecx
+    1119:	75 f5                	jne    1110 <strlen+0x10>
+    ;
+  return n;
+}
+    111b:	89 c8                	mov    %ecx,%eax
+    111d:	5d                   	pop    %ebp
+    111e:	c3                   	ret
+    111f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1120:	31 c9                	xor    %ecx,%ecx
+}
+    1122:	5d                   	pop    %ebp
+    1123:	89 c8                	mov    %ecx,%eax
+    1125:	c3                   	ret
+    1126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	57                   	push   %edi
+    1134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    113a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    113d:	89 d7                	mov    %edx,%edi
+    113f:	fc                   	cld
+    1140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1145:	89 d0                	mov    %edx,%eax
+    1147:	c9                   	leave
+    1148:	c3                   	ret
+    1149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	8b 45 08             	mov    0x8(%ebp),%eax
+    1156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    115a:	0f b6 10             	movzbl (%eax),%edx
+    115d:	84 d2                	test   %dl,%dl
+    115f:	75 12                	jne    1173 <strchr+0x23>
+    1161:	eb 1d                	jmp    1180 <strchr+0x30>
+    1163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1167:	90                   	nop
+    1168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    116c:	83 c0 01             	add    $0x1,%eax
+    116f:	84 d2                	test   %dl,%dl
+    1171:	74 0d                	je     1180 <strchr+0x30>
+    if(*s == c)
+    1173:	38 d1                	cmp    %dl,%cl
+    1175:	75 f1                	jne    1168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1177:	5d                   	pop    %ebp
+    1178:	c3                   	ret
+    1179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1180:	31 c0                	xor    %eax,%eax
+}
+    1182:	5d                   	pop    %ebp
+    1183:	c3                   	ret
+    1184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    118f:	90                   	nop
+
+00001190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	57                   	push   %edi
+    1194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1199:	31 db                	xor    %ebx,%ebx
+{
+    119b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    119e:	eb 27                	jmp    11c7 <gets+0x37>
+    cc = read(0, &c, 1);
+    11a0:	83 ec 04             	sub    $0x4,%esp
+    11a3:	6a 01                	push   $0x1
+    11a5:	56                   	push   %esi
+    11a6:	6a 00                	push   $0x0
+    11a8:	e8 1e 01 00 00       	call   12cb <read>
+    if(cc < 1)
+    11ad:	83 c4 10             	add    $0x10,%esp
+    11b0:	85 c0                	test   %eax,%eax
+    11b2:	7e 1d                	jle    11d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    11b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    11b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    11bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    11bf:	3c 0a                	cmp    $0xa,%al
+    11c1:	74 10                	je     11d3 <gets+0x43>
+    11c3:	3c 0d                	cmp    $0xd,%al
+    11c5:	74 0c                	je     11d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    11c7:	89 df                	mov    %ebx,%edi
+    11c9:	83 c3 01             	add    $0x1,%ebx
+    11cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    11cf:	7c cf                	jl     11a0 <gets+0x10>
+    11d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    11d3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    11da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11dd:	5b                   	pop    %ebx
+    11de:	5e                   	pop    %esi
+    11df:	5f                   	pop    %edi
+    11e0:	5d                   	pop    %ebp
+    11e1:	c3                   	ret
+    11e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    11f0:	55                   	push   %ebp
+    11f1:	89 e5                	mov    %esp,%ebp
+    11f3:	56                   	push   %esi
+    11f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    11f5:	83 ec 08             	sub    $0x8,%esp
+    11f8:	6a 00                	push   $0x0
+    11fa:	ff 75 08             	push   0x8(%ebp)
+    11fd:	e8 f1 00 00 00       	call   12f3 <open>
+  if(fd < 0)
+    1202:	83 c4 10             	add    $0x10,%esp
+    1205:	85 c0                	test   %eax,%eax
+    1207:	78 27                	js     1230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1209:	83 ec 08             	sub    $0x8,%esp
+    120c:	ff 75 0c             	push   0xc(%ebp)
+    120f:	89 c3                	mov    %eax,%ebx
+    1211:	50                   	push   %eax
+    1212:	e8 f4 00 00 00       	call   130b <fstat>
+  close(fd);
+    1217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    121a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    121c:	e8 ba 00 00 00       	call   12db <close>
+  return r;
+    1221:	83 c4 10             	add    $0x10,%esp
+}
+    1224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1227:	89 f0                	mov    %esi,%eax
+    1229:	5b                   	pop    %ebx
+    122a:	5e                   	pop    %esi
+    122b:	5d                   	pop    %ebp
+    122c:	c3                   	ret
+    122d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1235:	eb ed                	jmp    1224 <stat+0x34>
+    1237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123e:	66 90                	xchg   %ax,%ax
+
+00001240 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	53                   	push   %ebx
+    1244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1247:	0f be 02             	movsbl (%edx),%eax
+    124a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    124d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1255:	77 1e                	ja     1275 <atoi+0x35>
+    1257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1260:	83 c2 01             	add    $0x1,%edx
+    1263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    126a:	0f be 02             	movsbl (%edx),%eax
+    126d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1270:	80 fb 09             	cmp    $0x9,%bl
+    1273:	76 eb                	jbe    1260 <atoi+0x20>
+  return n;
+}
+    1275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1278:	89 c8                	mov    %ecx,%eax
+    127a:	c9                   	leave
+    127b:	c3                   	ret
+    127c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	57                   	push   %edi
+    1284:	56                   	push   %esi
+    1285:	8b 45 10             	mov    0x10(%ebp),%eax
+    1288:	8b 55 08             	mov    0x8(%ebp),%edx
+    128b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    128e:	85 c0                	test   %eax,%eax
+    1290:	7e 13                	jle    12a5 <memmove+0x25>
+    1292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1294:	89 d7                	mov    %edx,%edi
+    1296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    12a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    12a1:	39 f8                	cmp    %edi,%eax
+    12a3:	75 fb                	jne    12a0 <memmove+0x20>
+  return vdst;
+}
+    12a5:	5e                   	pop    %esi
+    12a6:	89 d0                	mov    %edx,%eax
+    12a8:	5f                   	pop    %edi
+    12a9:	5d                   	pop    %ebp
+    12aa:	c3                   	ret
+
+000012ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    12ab:	b8 01 00 00 00       	mov    $0x1,%eax
+    12b0:	cd 40                	int    $0x40
+    12b2:	c3                   	ret
+
+000012b3 <exit>:
+SYSCALL(exit)
+    12b3:	b8 02 00 00 00       	mov    $0x2,%eax
+    12b8:	cd 40                	int    $0x40
+    12ba:	c3                   	ret
+
+000012bb <wait>:
+SYSCALL(wait)
+    12bb:	b8 03 00 00 00       	mov    $0x3,%eax
+    12c0:	cd 40                	int    $0x40
+    12c2:	c3                   	ret
+
+000012c3 <pipe>:
+SYSCALL(pipe)
+    12c3:	b8 04 00 00 00       	mov    $0x4,%eax
+    12c8:	cd 40                	int    $0x40
+    12ca:	c3                   	ret
+
+000012cb <read>:
+SYSCALL(read)
+    12cb:	b8 05 00 00 00       	mov    $0x5,%eax
+    12d0:	cd 40                	int    $0x40
+    12d2:	c3                   	ret
+
+000012d3 <write>:
+SYSCALL(write)
+    12d3:	b8 10 00 00 00       	mov    $0x10,%eax
+    12d8:	cd 40                	int    $0x40
+    12da:	c3                   	ret
+
+000012db <close>:
+SYSCALL(close)
+    12db:	b8 15 00 00 00       	mov    $0x15,%eax
+    12e0:	cd 40                	int    $0x40
+    12e2:	c3                   	ret
+
+000012e3 <kill>:
+SYSCALL(kill)
+    12e3:	b8 06 00 00 00       	mov    $0x6,%eax
+    12e8:	cd 40                	int    $0x40
+    12ea:	c3                   	ret
+
+000012eb <exec>:
+SYSCALL(exec)
+    12eb:	b8 07 00 00 00       	mov    $0x7,%eax
+    12f0:	cd 40                	int    $0x40
+    12f2:	c3                   	ret
+
+000012f3 <open>:
+SYSCALL(open)
+    12f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    12f8:	cd 40                	int    $0x40
+    12fa:	c3                   	ret
+
+000012fb <mknod>:
+SYSCALL(mknod)
+    12fb:	b8 11 00 00 00       	mov    $0x11,%eax
+    1300:	cd 40                	int    $0x40
+    1302:	c3                   	ret
+
+00001303 <unlink>:
+SYSCALL(unlink)
+    1303:	b8 12 00 00 00       	mov    $0x12,%eax
+    1308:	cd 40                	int    $0x40
+    130a:	c3                   	ret
+
+0000130b <fstat>:
+SYSCALL(fstat)
+    130b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1310:	cd 40                	int    $0x40
+    1312:	c3                   	ret
+
+00001313 <link>:
+SYSCALL(link)
+    1313:	b8 13 00 00 00       	mov    $0x13,%eax
+    1318:	cd 40                	int    $0x40
+    131a:	c3                   	ret
+
+0000131b <mkdir>:
+SYSCALL(mkdir)
+    131b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1320:	cd 40                	int    $0x40
+    1322:	c3                   	ret
+
+00001323 <chdir>:
+SYSCALL(chdir)
+    1323:	b8 09 00 00 00       	mov    $0x9,%eax
+    1328:	cd 40                	int    $0x40
+    132a:	c3                   	ret
+
+0000132b <dup>:
+SYSCALL(dup)
+    132b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1330:	cd 40                	int    $0x40
+    1332:	c3                   	ret
+
+00001333 <getpid>:
+SYSCALL(getpid)
+    1333:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1338:	cd 40                	int    $0x40
+    133a:	c3                   	ret
+
+0000133b <sbrk>:
+SYSCALL(sbrk)
+    133b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1340:	cd 40                	int    $0x40
+    1342:	c3                   	ret
+
+00001343 <sleep>:
+SYSCALL(sleep)
+    1343:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1348:	cd 40                	int    $0x40
+    134a:	c3                   	ret
+
+0000134b <uptime>:
+SYSCALL(uptime)
+    134b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1350:	cd 40                	int    $0x40
+    1352:	c3                   	ret
+
+00001353 <settickets>:
+SYSCALL(settickets)
+    1353:	b8 16 00 00 00       	mov    $0x16,%eax
+    1358:	cd 40                	int    $0x40
+    135a:	c3                   	ret
+
+0000135b <getpinfo>:
+SYSCALL(getpinfo)
+    135b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1360:	cd 40                	int    $0x40
+    1362:	c3                   	ret
+
+00001363 <mprotect>:
+SYSCALL(mprotect)
+    1363:	b8 18 00 00 00       	mov    $0x18,%eax
+    1368:	cd 40                	int    $0x40
+    136a:	c3                   	ret
+
+0000136b <munprotect>:
+SYSCALL(munprotect)
+    136b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1370:	cd 40                	int    $0x40
+    1372:	c3                   	ret
+
+00001373 <clone>:
+SYSCALL(clone)
+    1373:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1378:	cd 40                	int    $0x40
+    137a:	c3                   	ret
+
+0000137b <join>:
+SYSCALL(join)
+    137b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1380:	cd 40                	int    $0x40
+    1382:	c3                   	ret
+
+00001383 <initlock_t>:
+SYSCALL(initlock_t)
+    1383:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1388:	cd 40                	int    $0x40
+    138a:	c3                   	ret
+
+0000138b <acquire_t>:
+SYSCALL(acquire_t)
+    138b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1390:	cd 40                	int    $0x40
+    1392:	c3                   	ret
+
+00001393 <release_t>:
+SYSCALL(release_t)
+    1393:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1398:	cd 40                	int    $0x40
+    139a:	c3                   	ret
+
+0000139b <setsched>:
+SYSCALL(setsched)
+    139b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    13a0:	cd 40                	int    $0x40
+    13a2:	c3                   	ret
+
+000013a3 <mkgroup>:
+SYSCALL(mkgroup)
+    13a3:	b8 20 00 00 00       	mov    $0x20,%eax
+    13a8:	cd 40                	int    $0x40
+    13aa:	c3                   	ret
+
+000013ab <joingroup>:
+SYSCALL(joingroup)
+    13ab:	b8 21 00 00 00       	mov    $0x21,%eax
+    13b0:	cd 40                	int    $0x40
+    13b2:	c3                   	ret
+
+000013b3 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    13b3:	b8 22 00 00 00       	mov    $0x22,%eax
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+
+000013bb <setdeadline>:
+SYSCALL(setdeadline)
+    13bb:	b8 23 00 00 00       	mov    $0x23,%eax
+    13c0:	cd 40                	int    $0x40
+    13c2:	c3                   	ret
+
+000013c3 <setaffinity>:
+SYSCALL(setaffinity)
+    13c3:	b8 24 00 00 00       	mov    $0x24,%eax
+    13c8:	cd 40                	int    $0x40
+    13ca:	c3                   	ret
+
+000013cb <yield_to>:
+SYSCALL(yield_to)
+    13cb:	b8 25 00 00 00       	mov    $0x25,%eax
+    13d0:	cd 40                	int    $0x40
+    13d2:	c3                   	ret
+
+000013d3 <getlatency>:
+SYSCALL(getlatency)
+    13d3:	b8 26 00 00 00       	mov    $0x26,%eax
+    13d8:	cd 40                	int    $0x40
+    13da:	c3                   	ret
+
+000013db <futex_wait>:
+SYSCALL(futex_wait)
+    13db:	b8 27 00 00 00       	mov    $0x27,%eax
+    13e0:	cd 40                	int    $0x40
+    13e2:	c3                   	ret
+
+000013e3 <futex_wake>:
+SYSCALL(futex_wake)
+    13e3:	b8 28 00 00 00       	mov    $0x28,%eax
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+
+000013eb <mguard>:
+SYSCALL(mguard)
+    13eb:	b8 29 00 00 00       	mov    $0x29,%eax
+    13f0:	cd 40                	int    $0x40
+    13f2:	c3                   	ret
+
+000013f3 <join_any>:
+SYSCALL(join_any)
+    13f3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    13f8:	cd 40                	int    $0x40
+    13fa:	c3                   	ret
+    13fb:	66 90                	xchg   %ax,%ax
+    13fd:	66 90                	xchg   %ax,%ax
+    13ff:	90                   	nop
+
+00001400 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	57                   	push   %edi
+    1404:	56                   	push   %esi
+    1405:	53                   	push   %ebx
+    1406:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1408:	89 d1                	mov    %edx,%ecx
+{
+    140a:	83 ec 3c             	sub    $0x3c,%esp
+    140d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1410:	85 d2                	test   %edx,%edx
+    1412:	0f 89 80 00 00 00    	jns    1498 <printint+0x98>
+    1418:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    141c:	74 7a                	je     1498 <printint+0x98>
+    x = -xx;
+    141e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1420:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1425:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1428:	31 f6                	xor    %esi,%esi
+    142a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1430:	89 c8                	mov    %ecx,%eax
+    1432:	31 d2                	xor    %edx,%edx
+    1434:	89 f7                	mov    %esi,%edi
+    1436:	f7 f3                	div    %ebx
+    1438:	8d 76 01             	lea    0x1(%esi),%esi
+    143b:	0f b6 92 30 18 00 00 	movzbl 0x1830(%edx),%edx
+    1442:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1446:	89 ca                	mov    %ecx,%edx
+    1448:	89 c1                	mov    %eax,%ecx
+    144a:	39 da                	cmp    %ebx,%edx
+    144c:	73 e2                	jae    1430 <printint+0x30>
+  if(neg)
+    144e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1451:	85 c0                	test   %eax,%eax
+    1453:	74 07                	je     145c <printint+0x5c>
+    buf[i++] = '-';
+    1455:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    145a:	89 f7                	mov    %esi,%edi
+    145c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    145f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1462:	01 df                	add    %ebx,%edi
+    1464:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1468:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    146b:	83 ec 04             	sub    $0x4,%esp
+    146e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1471:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1474:	6a 01                	push   $0x1
+    1476:	50                   	push   %eax
+    1477:	56                   	push   %esi
+    1478:	e8 56 fe ff ff       	call   12d3 <write>
+  while(--i >= 0)
+    147d:	89 f8                	mov    %edi,%eax
+    147f:	83 c4 10             	add    $0x10,%esp
+    1482:	83 ef 01             	sub    $0x1,%edi
+    1485:	39 d8                	cmp    %ebx,%eax
+    1487:	75 df                	jne    1468 <printint+0x68>
+}
+    1489:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    148c:	5b                   	pop    %ebx
+    148d:	5e                   	pop    %esi
+    148e:	5f                   	pop    %edi
+    148f:	5d                   	pop    %ebp
+    1490:	c3                   	ret
+    1491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1498:	31 c0                	xor    %eax,%eax
+    149a:	eb 89                	jmp    1425 <printint+0x25>
+    149c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000014a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    14a0:	55                   	push   %ebp
+    14a1:	89 e5                	mov    %esp,%ebp
+    14a3:	57                   	push   %edi
+    14a4:	56                   	push   %esi
+    14a5:	53                   	push   %ebx
+    14a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    14a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    14ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    14af:	0f b6 1e             	movzbl (%esi),%ebx
+    14b2:	83 c6 01             	add    $0x1,%esi
+    14b5:	84 db                	test   %bl,%bl
+    14b7:	74 67                	je     1520 <printf+0x80>
+    14b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    14bc:	31 d2                	xor    %edx,%edx
+    14be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    14c1:	eb 34                	jmp    14f7 <printf+0x57>
+    14c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14c7:	90                   	nop
+    14c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    14cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    14d0:	83 f8 25             	cmp    $0x25,%eax
+    14d3:	74 18                	je     14ed <printf+0x4d>
+  write(fd, &c, 1);
+    14d5:	83 ec 04             	sub    $0x4,%esp
+    14d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    14db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    14de:	6a 01                	push   $0x1
+    14e0:	50                   	push   %eax
+    14e1:	57                   	push   %edi
+    14e2:	e8 ec fd ff ff       	call   12d3 <write>
+    14e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    14ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    14ed:	0f b6 1e             	movzbl (%esi),%ebx
+    14f0:	83 c6 01             	add    $0x1,%esi
+    14f3:	84 db                	test   %bl,%bl
+    14f5:	74 29                	je     1520 <printf+0x80>
+    c = fmt[i] & 0xff;
+    14f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    14fa:	85 d2                	test   %edx,%edx
+    14fc:	74 ca                	je     14c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    14fe:	83 fa 25             	cmp    $0x25,%edx
+    1501:	75 ea                	jne    14ed <printf+0x4d>
+      if(c == 'd'){
+    1503:	83 f8 25             	cmp    $0x25,%eax
+    1506:	0f 84 24 01 00 00    	je     1630 <printf+0x190>
+    150c:	83 e8 63             	sub    $0x63,%eax
+    150f:	83 f8 15             	cmp    $0x15,%eax
+    1512:	77 1c                	ja     1530 <printf+0x90>
+    1514:	ff 24 85 d8 17 00 00 	jmp    *0x17d8(,%eax,4)
+    151b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    151f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1523:	5b                   	pop    %ebx
+    1524:	5e                   	pop    %esi
+    1525:	5f                   	pop    %edi
+    1526:	5d                   	pop    %ebp
+    1527:	c3                   	ret
+    1528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    152f:	90                   	nop
+  write(fd, &c, 1);
+    1530:	83 ec 04             	sub    $0x4,%esp
+    1533:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1536:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    153a:	6a 01                	push   $0x1
+    153c:	52                   	push   %edx
+    153d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1540:	57                   	push   %edi
+    1541:	e8 8d fd ff ff       	call   12d3 <write>
+    1546:	83 c4 0c             	add    $0xc,%esp
+    1549:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    154c:	6a 01                	push   $0x1
+    154e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1551:	52                   	push   %edx
+    1552:	57                   	push   %edi
+    1553:	e8 7b fd ff ff       	call   12d3 <write>
+        putc(fd, c);
+    1558:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    155b:	31 d2                	xor    %edx,%edx
+    155d:	eb 8e                	jmp    14ed <printf+0x4d>
+    155f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1560:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1563:	83 ec 0c             	sub    $0xc,%esp
+    1566:	b9 10 00 00 00       	mov    $0x10,%ecx
+    156b:	8b 13                	mov    (%ebx),%edx
+    156d:	6a 00                	push   $0x0
+    156f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1571:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1574:	e8 87 fe ff ff       	call   1400 <printint>
+        ap++;
+    1579:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    157c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    157f:	31 d2                	xor    %edx,%edx
+    1581:	e9 67 ff ff ff       	jmp    14ed <printf+0x4d>
+    1586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    158d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1590:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1593:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1595:	83 c0 04             	add    $0x4,%eax
+    1598:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    159b:	85 db                	test   %ebx,%ebx
+    159d:	0f 84 9d 00 00 00    	je     1640 <printf+0x1a0>
+        while(*s != 0){
+    15a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    15a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    15a8:	84 c0                	test   %al,%al
+    15aa:	0f 84 3d ff ff ff    	je     14ed <printf+0x4d>
+    15b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    15b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    15b6:	89 de                	mov    %ebx,%esi
+    15b8:	89 d3                	mov    %edx,%ebx
+    15ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    15c0:	83 ec 04             	sub    $0x4,%esp
+    15c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    15c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    15c9:	6a 01                	push   $0x1
+    15cb:	53                   	push   %ebx
+    15cc:	57                   	push   %edi
+    15cd:	e8 01 fd ff ff       	call   12d3 <write>
+        while(*s != 0){
+    15d2:	0f b6 06             	movzbl (%esi),%eax
+    15d5:	83 c4 10             	add    $0x10,%esp
+    15d8:	84 c0                	test   %al,%al
+    15da:	75 e4                	jne    15c0 <printf+0x120>
+      state = 0;
+    15dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    15df:	31 d2                	xor    %edx,%edx
+    15e1:	e9 07 ff ff ff       	jmp    14ed <printf+0x4d>
+    15e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    15f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    15f3:	83 ec 0c             	sub    $0xc,%esp
+    15f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    15fb:	8b 13                	mov    (%ebx),%edx
+    15fd:	6a 01                	push   $0x1
+    15ff:	e9 6b ff ff ff       	jmp    156f <printf+0xcf>
+    1604:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1608:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    160b:	83 ec 04             	sub    $0x4,%esp
+    160e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1611:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1613:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1616:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1619:	6a 01                	push   $0x1
+    161b:	52                   	push   %edx
+    161c:	57                   	push   %edi
+    161d:	e8 b1 fc ff ff       	call   12d3 <write>
+        ap++;
+    1622:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1625:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1628:	31 d2                	xor    %edx,%edx
+    162a:	e9 be fe ff ff       	jmp    14ed <printf+0x4d>
+    162f:	90                   	nop
+  write(fd, &c, 1);
+    1630:	83 ec 04             	sub    $0x4,%esp
+    1633:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1636:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1639:	6a 01                	push   $0x1
+    163b:	e9 11 ff ff ff       	jmp    1551 <printf+0xb1>
+    1640:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1645:	bb d1 17 00 00       	mov    $0x17d1,%ebx
+    164a:	e9 61 ff ff ff       	jmp    15b0 <printf+0x110>
+    164f:	90                   	nop
+
+00001650 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1650:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1651:	a1 d8 1a 00 00       	mov    0x1ad8,%eax
+{
+    1656:	89 e5                	mov    %esp,%ebp
+    1658:	57                   	push   %edi
+    1659:	56                   	push   %esi
+    165a:	53                   	push   %ebx
+    165b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    165e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1668:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    166a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    166c:	39 ca                	cmp    %ecx,%edx
+    166e:	73 30                	jae    16a0 <free+0x50>
+    1670:	39 c1                	cmp    %eax,%ecx
+    1672:	72 04                	jb     1678 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1674:	39 c2                	cmp    %eax,%edx
+    1676:	72 f0                	jb     1668 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1678:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    167b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    167e:	39 f8                	cmp    %edi,%eax
+    1680:	74 2e                	je     16b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1682:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1685:	8b 42 04             	mov    0x4(%edx),%eax
+    1688:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    168b:	39 f1                	cmp    %esi,%ecx
+    168d:	74 38                	je     16c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    168f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1691:	5b                   	pop    %ebx
+  freep = p;
+    1692:	89 15 d8 1a 00 00    	mov    %edx,0x1ad8
+}
+    1698:	5e                   	pop    %esi
+    1699:	5f                   	pop    %edi
+    169a:	5d                   	pop    %ebp
+    169b:	c3                   	ret
+    169c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16a0:	39 c1                	cmp    %eax,%ecx
+    16a2:	72 d0                	jb     1674 <free+0x24>
+    16a4:	eb c2                	jmp    1668 <free+0x18>
+    16a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    16b0:	03 70 04             	add    0x4(%eax),%esi
+    16b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    16b6:	8b 02                	mov    (%edx),%eax
+    16b8:	8b 00                	mov    (%eax),%eax
+    16ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    16bd:	8b 42 04             	mov    0x4(%edx),%eax
+    16c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    16c3:	39 f1                	cmp    %esi,%ecx
+    16c5:	75 c8                	jne    168f <free+0x3f>
+    p->s.size += bp->s.size;
+    16c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    16ca:	89 15 d8 1a 00 00    	mov    %edx,0x1ad8
+    p->s.size += bp->s.size;
+    16d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    16d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    16d6:	89 0a                	mov    %ecx,(%edx)
+}
+    16d8:	5b                   	pop    %ebx
+    16d9:	5e                   	pop    %esi
+    16da:	5f                   	pop    %edi
+    16db:	5d                   	pop    %ebp
+    16dc:	c3                   	ret
+    16dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000016e0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    16e0:	55                   	push   %ebp
+    16e1:	89 e5                	mov    %esp,%ebp
+    16e3:	57                   	push   %edi
+    16e4:	56                   	push   %esi
+    16e5:	53                   	push   %ebx
+    16e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    16e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    16ec:	8b 15 d8 1a 00 00    	mov    0x1ad8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    16f2:	8d 78 07             	lea    0x7(%eax),%edi
+    16f5:	c1 ef 03             	shr    $0x3,%edi
+    16f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    16fb:	85 d2                	test   %edx,%edx
+    16fd:	0f 84 8d 00 00 00    	je     1790 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1703:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1705:	8b 48 04             	mov    0x4(%eax),%ecx
+    1708:	39 f9                	cmp    %edi,%ecx
+    170a:	73 64                	jae    1770 <malloc+0x90>
+  if(nu < 4096)
+    170c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1711:	39 df                	cmp    %ebx,%edi
+    1713:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1716:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    171d:	eb 0a                	jmp    1729 <malloc+0x49>
+    171f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1720:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1722:	8b 48 04             	mov    0x4(%eax),%ecx
+    1725:	39 f9                	cmp    %edi,%ecx
+    1727:	73 47                	jae    1770 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1729:	89 c2                	mov    %eax,%edx
+    172b:	39 05 d8 1a 00 00    	cmp    %eax,0x1ad8
+    1731:	75 ed                	jne    1720 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1733:	83 ec 0c             	sub    $0xc,%esp
+    1736:	56                   	push   %esi
+    1737:	e8 ff fb ff ff       	call   133b <sbrk>
+  if(p == (char*)-1)
+    173c:	83 c4 10             	add    $0x10,%esp
+    173f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1742:	74 1c                	je     1760 <malloc+0x80>
+  hp->s.size = nu;
+    1744:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1747:	83 ec 0c             	sub    $0xc,%esp
+    174a:	83 c0 08             	add    $0x8,%eax
+    174d:	50                   	push   %eax
+    174e:	e8 fd fe ff ff       	call   1650 <free>
+  return freep;
+    1753:	8b 15 d8 1a 00 00    	mov    0x1ad8,%edx
+      if((p = morecore(nunits)) == 0)
+    1759:	83 c4 10             	add    $0x10,%esp
+    175c:	85 d2                	test   %edx,%edx
+    175e:	75 c0                	jne    1720 <malloc+0x40>
+        return 0;
+  }
+}
+    1760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1763:	31 c0                	xor    %eax,%eax
+}
+    1765:	5b                   	pop    %ebx
+    1766:	5e                   	pop    %esi
+    1767:	5f                   	pop    %edi
+    1768:	5d                   	pop    %ebp
+    1769:	c3                   	ret
+    176a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1770:	39 cf                	cmp    %ecx,%edi
+    1772:	74 4c                	je     17c0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1774:	29 f9                	sub    %edi,%ecx
+    1776:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1779:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    177c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    177f:	89 15 d8 1a 00 00    	mov    %edx,0x1ad8
+}
+    1785:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1788:	83 c0 08             	add    $0x8,%eax
+}
+    178b:	5b                   	pop    %ebx
+    178c:	5e                   	pop    %esi
+    178d:	5f                   	pop    %edi
+    178e:	5d                   	pop    %ebp
+    178f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1790:	c7 05 d8 1a 00 00 dc 	movl   $0x1adc,0x1ad8
+    1797:	1a 00 00 
+    base.s.size = 0;
+    179a:	b8 dc 1a 00 00       	mov    $0x1adc,%eax
+    base.s.ptr = freep = prevp = &base;
+    179f:	c7 05 dc 1a 00 00 dc 	movl   $0x1adc,0x1adc
+    17a6:	1a 00 00 
+    base.s.size = 0;
+    17a9:	c7 05 e0 1a 00 00 00 	movl   $0x0,0x1ae0
+    17b0:	00 00 00 
+    if(p->s.size >= nunits){
+    17b3:	e9 54 ff ff ff       	jmp    170c <malloc+0x2c>
+    17b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    17c0:	8b 08                	mov    (%eax),%ecx
+    17c2:	89 0a                	mov    %ecx,(%edx)
+    17c4:	eb b9                	jmp    177f <malloc+0x9f>
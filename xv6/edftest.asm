@@ -0,0 +1,1400 @@
+
+_edftest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#define RUNTIME 2
+#define NJOBS   50
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	8d 9d d8 f4 ff ff    	lea    -0xb28(%ebp),%ebx
+    1016:	51                   	push   %ecx
+    1017:	81 ec 18 0b 00 00    	sub    $0xb18,%esp
+	int hog_pid[3];
+	int i, j, start;
+
+	for(i = 0; i < 3; i++){
+		hog_pid[i] = fork();
+    101d:	e8 c9 03 00 00       	call   13eb <fork>
+    1022:	89 03                	mov    %eax,(%ebx)
+		if(hog_pid[i] == 0){
+    1024:	85 c0                	test   %eax,%eax
+    1026:	0f 84 69 01 00 00    	je     1195 <main+0x195>
+	for(i = 0; i < 3; i++){
+    102c:	83 c3 04             	add    $0x4,%ebx
+    102f:	8d 85 e4 f4 ff ff    	lea    -0xb1c(%ebp),%eax
+    1035:	39 d8                	cmp    %ebx,%eax
+    1037:	75 e4                	jne    101d <main+0x1d>
+			settickets(100);
+			for (;;);
+		}
+	}
+
+	if(setdeadline(PERIOD, RUNTIME) < 0){
+    1039:	83 ec 08             	sub    $0x8,%esp
+    103c:	6a 02                	push   $0x2
+    103e:	6a 0a                	push   $0xa
+    1040:	e8 b6 04 00 00       	call   14fb <setdeadline>
+    1045:	83 c4 10             	add    $0x10,%esp
+    1048:	85 c0                	test   %eax,%eax
+    104a:	0f 88 1a 01 00 00    	js     116a <main+0x16a>
+		printf(1, "setdeadline(%d, %d) failed\n", PERIOD, RUNTIME);
+		exit();
+	}
+	if(setdeadline(PERIOD, PERIOD) == 0)
+    1050:	50                   	push   %eax
+    1051:	50                   	push   %eax
+    1052:	6a 0a                	push   $0xa
+    1054:	6a 0a                	push   $0xa
+    1056:	e8 a0 04 00 00       	call   14fb <setdeadline>
+    105b:	83 c4 10             	add    $0x10,%esp
+    105e:	85 c0                	test   %eax,%eax
+    1060:	0f 84 19 01 00 00    	je     117f <main+0x17f>
+		printf(1, "admission control accepted 100%% of a CPU\n");
+	setdeadline(PERIOD, RUNTIME);
+    1066:	50                   	push   %eax
+    1067:	be 32 00 00 00       	mov    $0x32,%esi
+	// each job spins for about one tick, then waits for the next period
+	for(j = 0; j < NJOBS; j++){
+		start = uptime();
+		while(uptime() == start)
+			;
+		sleep(PERIOD - (uptime() - start));
+    106c:	bf 0a 00 00 00       	mov    $0xa,%edi
+	setdeadline(PERIOD, RUNTIME);
+    1071:	50                   	push   %eax
+    1072:	6a 02                	push   $0x2
+    1074:	6a 0a                	push   $0xa
+    1076:	e8 80 04 00 00       	call   14fb <setdeadline>
+    107b:	83 c4 10             	add    $0x10,%esp
+    107e:	66 90                	xchg   %ax,%ax
+		start = uptime();
+    1080:	e8 06 04 00 00       	call   148b <uptime>
+    1085:	89 c3                	mov    %eax,%ebx
+		while(uptime() == start)
+    1087:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108e:	66 90                	xchg   %ax,%ax
+    1090:	e8 f6 03 00 00       	call   148b <uptime>
+    1095:	39 d8                	cmp    %ebx,%eax
+    1097:	74 f7                	je     1090 <main+0x90>
+		sleep(PERIOD - (uptime() - start));
+    1099:	e8 ed 03 00 00       	call   148b <uptime>
+    109e:	89 fa                	mov    %edi,%edx
+    10a0:	83 ec 0c             	sub    $0xc,%esp
+    10a3:	29 d8                	sub    %ebx,%eax
+    10a5:	29 c2                	sub    %eax,%edx
+    10a7:	52                   	push   %edx
+    10a8:	e8 d6 03 00 00       	call   1483 <sleep>
+	for(j = 0; j < NJOBS; j++){
+    10ad:	83 c4 10             	add    $0x10,%esp
+    10b0:	83 ee 01             	sub    $0x1,%esi
+    10b3:	75 cb                	jne    1080 <main+0x80>
+	}
+
+	struct pstat st;
+	st.next = 0;
+    10b5:	31 c0                	xor    %eax,%eax
+    10b7:	8d bd e4 f5 ff ff    	lea    -0xa1c(%ebp),%edi
+    10bd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	do {
+		getpinfo(&st);
+    10c0:	83 ec 0c             	sub    $0xc,%esp
+    10c3:	8d 85 e4 f4 ff ff    	lea    -0xb1c(%ebp),%eax
+    10c9:	8d 9d e4 f4 ff ff    	lea    -0xb1c(%ebp),%ebx
+    10cf:	50                   	push   %eax
+    10d0:	e8 c6 03 00 00       	call   149b <getpinfo>
+		for (i = 0; i < sizeof(st.pid)/sizeof(st.pid[0]); i++)
+    10d5:	83 c4 10             	add    $0x10,%esp
+    10d8:	eb 0d                	jmp    10e7 <main+0xe7>
+    10da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    10e0:	83 c3 04             	add    $0x4,%ebx
+    10e3:	39 fb                	cmp    %edi,%ebx
+    10e5:	74 39                	je     1120 <main+0x120>
+			if(st.inuse[i] && st.pid[i] == getpid())
+    10e7:	8b 03                	mov    (%ebx),%eax
+    10e9:	85 c0                	test   %eax,%eax
+    10eb:	74 f3                	je     10e0 <main+0xe0>
+    10ed:	8b b3 00 02 00 00    	mov    0x200(%ebx),%esi
+    10f3:	e8 7b 03 00 00       	call   1473 <getpid>
+    10f8:	39 c6                	cmp    %eax,%esi
+    10fa:	75 e4                	jne    10e0 <main+0xe0>
+				printf(1, "%d jobs, %d deadlines missed\n", NJOBS, st.misses[i]);
+    10fc:	ff b3 00 06 00 00    	push   0x600(%ebx)
+		for (i = 0; i < sizeof(st.pid)/sizeof(st.pid[0]); i++)
+    1102:	83 c3 04             	add    $0x4,%ebx
+				printf(1, "%d jobs, %d deadlines missed\n", NJOBS, st.misses[i]);
+    1105:	6a 32                	push   $0x32
+    1107:	68 24 19 00 00       	push   $0x1924
+    110c:	6a 01                	push   $0x1
+    110e:	e8 cd 04 00 00       	call   15e0 <printf>
+    1113:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < sizeof(st.pid)/sizeof(st.pid[0]); i++)
+    1116:	39 fb                	cmp    %edi,%ebx
+    1118:	75 cd                	jne    10e7 <main+0xe7>
+    111a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+	} while(st.next);
+    1120:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1123:	85 f6                	test   %esi,%esi
+    1125:	75 99                	jne    10c0 <main+0xc0>
+
+	setdeadline(0, 0);
+    1127:	50                   	push   %eax
+    1128:	50                   	push   %eax
+    1129:	6a 00                	push   $0x0
+    112b:	6a 00                	push   $0x0
+    112d:	e8 c9 03 00 00       	call   14fb <setdeadline>
+	for(i = 0; i < 3; i++){
+		kill(hog_pid[i]);
+    1132:	5a                   	pop    %edx
+    1133:	ff b5 d8 f4 ff ff    	push   -0xb28(%ebp)
+    1139:	e8 e5 02 00 00       	call   1423 <kill>
+		wait();
+    113e:	e8 b8 02 00 00       	call   13fb <wait>
+		kill(hog_pid[i]);
+    1143:	59                   	pop    %ecx
+    1144:	ff b5 dc f4 ff ff    	push   -0xb24(%ebp)
+    114a:	e8 d4 02 00 00       	call   1423 <kill>
+		wait();
+    114f:	e8 a7 02 00 00       	call   13fb <wait>
+		kill(hog_pid[i]);
+    1154:	5b                   	pop    %ebx
+    1155:	ff b5 e0 f4 ff ff    	push   -0xb20(%ebp)
+    115b:	e8 c3 02 00 00       	call   1423 <kill>
+		wait();
+    1160:	e8 96 02 00 00       	call   13fb <wait>
+	}
+	exit();
+    1165:	e8 89 02 00 00       	call   13f3 <exit>
+		printf(1, "setdeadline(%d, %d) failed\n", PERIOD, RUNTIME);
+    116a:	6a 02                	push   $0x2
+    116c:	6a 0a                	push   $0xa
+    116e:	68 08 19 00 00       	push   $0x1908
+    1173:	6a 01                	push   $0x1
+    1175:	e8 66 04 00 00       	call   15e0 <printf>
+		exit();
+    117a:	e8 74 02 00 00       	call   13f3 <exit>
+		printf(1, "admission control accepted 100%% of a CPU\n");
+    117f:	50                   	push   %eax
+    1180:	50                   	push   %eax
+    1181:	68 44 19 00 00       	push   $0x1944
+    1186:	6a 01                	push   $0x1
+    1188:	e8 53 04 00 00       	call   15e0 <printf>
+    118d:	83 c4 10             	add    $0x10,%esp
+    1190:	e9 d1 fe ff ff       	jmp    1066 <main+0x66>
+			settickets(100);
+    1195:	83 ec 0c             	sub    $0xc,%esp
+    1198:	6a 64                	push   $0x64
+    119a:	e8 f4 02 00 00       	call   1493 <settickets>
+    119f:	83 c4 10             	add    $0x10,%esp
+			for (;;);
+    11a2:	eb fe                	jmp    11a2 <main+0x1a2>
+    11a4:	66 90                	xchg   %ax,%ax
+    11a6:	66 90                	xchg   %ax,%ax
+    11a8:	66 90                	xchg   %ax,%ax
+    11aa:	66 90                	xchg   %ax,%ax
+    11ac:	66 90                	xchg   %ax,%ax
+    11ae:	66 90                	xchg   %ax,%ax
+
+000011b0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    11b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    11b1:	31 c0                	xor    %eax,%eax
+{
+    11b3:	89 e5                	mov    %esp,%ebp
+    11b5:	53                   	push   %ebx
+    11b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    11b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    11bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    11c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    11c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    11c7:	83 c0 01             	add    $0x1,%eax
+    11ca:	84 d2                	test   %dl,%dl
+    11cc:	75 f2                	jne    11c0 <strcpy+0x10>
+    ;
+  return os;
+}
+    11ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11d1:	89 c8                	mov    %ecx,%eax
+    11d3:	c9                   	leave
+    11d4:	c3                   	ret
+    11d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000011e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	53                   	push   %ebx
+    11e4:	8b 55 08             	mov    0x8(%ebp),%edx
+    11e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    11ea:	0f b6 02             	movzbl (%edx),%eax
+    11ed:	84 c0                	test   %al,%al
+    11ef:	75 17                	jne    1208 <strcmp+0x28>
+    11f1:	eb 3a                	jmp    122d <strcmp+0x4d>
+    11f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11f7:	90                   	nop
+    11f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    11fc:	83 c2 01             	add    $0x1,%edx
+    11ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1202:	84 c0                	test   %al,%al
+    1204:	74 1a                	je     1220 <strcmp+0x40>
+    p++, q++;
+    1206:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1208:	0f b6 19             	movzbl (%ecx),%ebx
+    120b:	38 c3                	cmp    %al,%bl
+    120d:	74 e9                	je     11f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    120f:	29 d8                	sub    %ebx,%eax
+}
+    1211:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1214:	c9                   	leave
+    1215:	c3                   	ret
+    1216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1220:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1224:	31 c0                	xor    %eax,%eax
+    1226:	29 d8                	sub    %ebx,%eax
+}
+    1228:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    122b:	c9                   	leave
+    122c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    122d:	0f b6 19             	movzbl (%ecx),%ebx
+    1230:	31 c0                	xor    %eax,%eax
+    1232:	eb db                	jmp    120f <strcmp+0x2f>
+    1234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    123f:	90                   	nop
+
+00001240 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1246:	80 3a 00             	cmpb   $0x0,(%edx)
+    1249:	74 15                	je     1260 <strlen+0x20>
+    124b:	31 c0                	xor    %eax,%eax
+    124d:	8d 76 00             	lea    0x0(%esi),%esi
+    1250:	83 c0 01             	add    $0x1,%eax
+    1253:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1257:	89 c1                	mov    %eax,%ecx
+    1259:	75 f5                	jne    1250 <strlen+0x10>
+    ;
+  return n;
+}
+    125b:	89 c8                	mov    %ecx,%eax
+    125d:	5d                   	pop    %ebp
+    125e:	c3                   	ret
+    125f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1260:	31 c9                	xor    %ecx,%ecx
+}
+    1262:	5d                   	pop    %ebp
+    1263:	89 c8                	mov    %ecx,%eax
+    1265:	c3                   	ret
+    1266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    126d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001270 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	57                   	push   %edi
+    1274:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1277:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    127a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    127d:	89 d7                	mov    %edx,%edi
+    127f:	fc                   	cld
+    1280:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1282:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1285:	89 d0                	mov    %edx,%eax
+    1287:	c9                   	leave
+    1288:	c3                   	ret
+    1289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001290 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	8b 45 08             	mov    0x8(%ebp),%eax
+    1296:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    129a:	0f b6 10             	movzbl (%eax),%edx
+    129d:	84 d2                	test   %dl,%dl
+    129f:	75 12                	jne    12b3 <strchr+0x23>
+    12a1:	eb 1d                	jmp    12c0 <strchr+0x30>
+    12a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12a7:	90                   	nop
+    12a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    12ac:	83 c0 01             	add    $0x1,%eax
+    12af:	84 d2                	test   %dl,%dl
+    12b1:	74 0d                	je     12c0 <strchr+0x30>
+    if(*s == c)
+    12b3:	38 d1                	cmp    %dl,%cl
+    12b5:	75 f1                	jne    12a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    12b7:	5d                   	pop    %ebp
+    12b8:	c3                   	ret
+    12b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    12c0:	31 c0                	xor    %eax,%eax
+}
+    12c2:	5d                   	pop    %ebp
+    12c3:	c3                   	ret
+    12c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12cf:	90                   	nop
+
+000012d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	57                   	push   %edi
+    12d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    12d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    12d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    12d9:	31 db                	xor    %ebx,%ebx
+{
+    12db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    12de:	eb 27                	jmp    1307 <gets+0x37>
+    cc = read(0, &c, 1);
+    12e0:	83 ec 04             	sub    $0x4,%esp
+    12e3:	6a 01                	push   $0x1
+    12e5:	56                   	push   %esi
+    12e6:	6a 00                	push   $0x0
+    12e8:	e8 1e 01 00 00       	call   140b <read>
+    if(cc < 1)
+    12ed:	83 c4 10             	add    $0x10,%esp
+    12f0:	85 c0                	test   %eax,%eax
+    12f2:	7e 1d                	jle    1311 <gets+0x41>
+      break;
+    buf[i++] = c;
+    12f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    12f8:	8b 55 08             	mov    0x8(%ebp),%edx
+    12fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    12ff:	3c 0a                	cmp    $0xa,%al
+    1301:	74 10                	je     1313 <gets+0x43>
+    1303:	3c 0d                	cmp    $0xd,%al
+    1305:	74 0c                	je     1313 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1307:	89 df                	mov    %ebx,%edi
+    1309:	83 c3 01             	add    $0x1,%ebx
+    130c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    130f:	7c cf                	jl     12e0 <gets+0x10>
+    1311:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1313:	8b 45 08             	mov    0x8(%ebp),%eax
+    1316:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    131a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    131d:	5b                   	pop    %ebx
+    131e:	5e                   	pop    %esi
+    131f:	5f                   	pop    %edi
+    1320:	5d                   	pop    %ebp
+    1321:	c3                   	ret
+    1322:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001330 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1330:	55                   	push   %ebp
+    1331:	89 e5                	mov    %esp,%ebp
+    1333:	56                   	push   %esi
+    1334:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1335:	83 ec 08             	sub    $0x8,%esp
+    1338:	6a 00                	push   $0x0
+    133a:	ff 75 08             	push   0x8(%ebp)
+    133d:	e8 f1 00 00 00       	call   1433 <open>
+  if(fd < 0)
+    1342:	83 c4 10             	add    $0x10,%esp
+    1345:	85 c0                	test   %eax,%eax
+    1347:	78 27                	js     1370 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1349:	83 ec 08             	sub    $0x8,%esp
+    134c:	ff 75 0c             	push   0xc(%ebp)
+    134f:	89 c3                	mov    %eax,%ebx
+    1351:	50                   	push   %eax
+    1352:	e8 f4 00 00 00       	call   144b <fstat>
+  close(fd);
+    1357:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    135a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    135c:	e8 ba 00 00 00       	call   141b <close>
+  return r;
+    1361:	83 c4 10             	add    $0x10,%esp
+}
+    1364:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1367:	89 f0                	mov    %esi,%eax
+    1369:	5b                   	pop    %ebx
+    136a:	5e                   	pop    %esi
+    136b:	5d                   	pop    %ebp
+    136c:	c3                   	ret
+    136d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1370:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1375:	eb ed                	jmp    1364 <stat+0x34>
+    1377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    137e:	66 90                	xchg   %ax,%ax
+
+00001380 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1380:	55                   	push   %ebp
+    1381:	89 e5                	mov    %esp,%ebp
+    1383:	53                   	push   %ebx
+    1384:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1387:	0f be 02             	movsbl (%edx),%eax
+    138a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    138d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1390:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1395:	77 1e                	ja     13b5 <atoi+0x35>
+    1397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    139e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    13a0:	83 c2 01             	add    $0x1,%edx
+    13a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    13a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    13aa:	0f be 02             	movsbl (%edx),%eax
+    13ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    13b0:	80 fb 09             	cmp    $0x9,%bl
+    13b3:	76 eb                	jbe    13a0 <atoi+0x20>
+  return n;
+}
+    13b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13b8:	89 c8                	mov    %ecx,%eax
+    13ba:	c9                   	leave
+    13bb:	c3                   	ret
+    13bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000013c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	57                   	push   %edi
+    13c4:	56                   	push   %esi
+    13c5:	8b 45 10             	mov    0x10(%ebp),%eax
+    13c8:	8b 55 08             	mov    0x8(%ebp),%edx
+    13cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    13ce:	85 c0                	test   %eax,%eax
+    13d0:	7e 13                	jle    13e5 <memmove+0x25>
+    13d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    13d4:	89 d7                	mov    %edx,%edi
+    13d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    13e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    13e1:	39 f8                	cmp    %edi,%eax
+    13e3:	75 fb                	jne    13e0 <memmove+0x20>
+  return vdst;
+}
+    13e5:	5e                   	pop    %esi
+    13e6:	89 d0                	mov    %edx,%eax
+    13e8:	5f                   	pop    %edi
+    13e9:	5d                   	pop    %ebp
+    13ea:	c3                   	ret
+
+000013eb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    13eb:	b8 01 00 00 00       	mov    $0x1,%eax
+    13f0:	cd 40                	int    $0x40
+    13f2:	c3                   	ret
+
+000013f3 <exit>:
+SYSCALL(exit)
+    13f3:	b8 02 00 00 00       	mov    $0x2,%eax
+    13f8:	cd 40                	int    $0x40
+    13fa:	c3                   	ret
+
+000013fb <wait>:
+SYSCALL(wait)
+    13fb:	b8 03 00 00 00       	mov    $0x3,%eax
+    1400:	cd 40                	int    $0x40
+    1402:	c3                   	ret
+
+00001403 <pipe>:
+SYSCALL(pipe)
+    1403:	b8 04 00 00 00       	mov    $0x4,%eax
+    1408:	cd 40                	int    $0x40
+    140a:	c3                   	ret
+
+0000140b <read>:
+SYSCALL(read)
+    140b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1410:	cd 40                	int    $0x40
+    1412:	c3                   	ret
+
+00001413 <write>:
+SYSCALL(write)
+    1413:	b8 10 00 00 00       	mov    $0x10,%eax
+    1418:	cd 40                	int    $0x40
+    141a:	c3                   	ret
+
+0000141b <close>:
+SYSCALL(close)
+    141b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1420:	cd 40                	int    $0x40
+    1422:	c3                   	ret
+
+00001423 <kill>:
+SYSCALL(kill)
+    1423:	b8 06 00 00 00       	mov    $0x6,%eax
+    1428:	cd 40                	int    $0x40
+    142a:	c3                   	ret
+
+0000142b <exec>:
+SYSCALL(exec)
+    142b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1430:	cd 40                	int    $0x40
+    1432:	c3                   	ret
+
+00001433 <open>:
+SYSCALL(open)
+    1433:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1438:	cd 40                	int    $0x40
+    143a:	c3                   	ret
+
+0000143b <mknod>:
+SYSCALL(mknod)
+    143b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1440:	cd 40                	int    $0x40
+    1442:	c3                   	ret
+
+00001443 <unlink>:
+SYSCALL(unlink)
+    1443:	b8 12 00 00 00       	mov    $0x12,%eax
+    1448:	cd 40                	int    $0x40
+    144a:	c3                   	ret
+
+0000144b <fstat>:
+SYSCALL(fstat)
+    144b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1450:	cd 40                	int    $0x40
+    1452:	c3                   	ret
+
+00001453 <link>:
+SYSCALL(link)
+    1453:	b8 13 00 00 00       	mov    $0x13,%eax
+    1458:	cd 40                	int    $0x40
+    145a:	c3                   	ret
+
+0000145b <mkdir>:
+SYSCALL(mkdir)
+    145b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1460:	cd 40                	int    $0x40
+    1462:	c3                   	ret
+
+00001463 <chdir>:
+SYSCALL(chdir)
+    1463:	b8 09 00 00 00       	mov    $0x9,%eax
+    1468:	cd 40                	int    $0x40
+    146a:	c3                   	ret
+
+0000146b <dup>:
+SYSCALL(dup)
+    146b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1470:	cd 40                	int    $0x40
+    1472:	c3                   	ret
+
+00001473 <getpid>:
+SYSCALL(getpid)
+    1473:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1478:	cd 40                	int    $0x40
+    147a:	c3                   	ret
+
+0000147b <sbrk>:
+SYSCALL(sbrk)
+    147b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1480:	cd 40                	int    $0x40
+    1482:	c3                   	ret
+
+00001483 <sleep>:
+SYSCALL(sleep)
+    1483:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1488:	cd 40                	int    $0x40
+    148a:	c3                   	ret
+
+0000148b <uptime>:
+SYSCALL(uptime)
+    148b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1490:	cd 40                	int    $0x40
+    1492:	c3                   	ret
+
+00001493 <settickets>:
+SYSCALL(settickets)
+    1493:	b8 16 00 00 00       	mov    $0x16,%eax
+    1498:	cd 40                	int    $0x40
+    149a:	c3                   	ret
+
+0000149b <getpinfo>:
+SYSCALL(getpinfo)
+    149b:	b8 17 00 00 00       	mov    $0x17,%eax
+    14a0:	cd 40                	int    $0x40
+    14a2:	c3                   	ret
+
+000014a3 <mprotect>:
+SYSCALL(mprotect)
+    14a3:	b8 18 00 00 00       	mov    $0x18,%eax
+    14a8:	cd 40                	int    $0x40
+    14aa:	c3                   	ret
+
+000014ab <munprotect>:
+SYSCALL(munprotect)
+    14ab:	b8 19 00 00 00       	mov    $0x19,%eax
+    14b0:	cd 40                	int    $0x40
+    14b2:	c3                   	ret
+
+000014b3 <clone>:
+SYSCALL(clone)
+    14b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    14b8:	cd 40                	int    $0x40
+    14ba:	c3                   	ret
+
+000014bb <join>:
+SYSCALL(join)
+    14bb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    14c0:	cd 40                	int    $0x40
+    14c2:	c3                   	ret
+
+000014c3 <initlock_t>:
+SYSCALL(initlock_t)
+    14c3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    14c8:	cd 40                	int    $0x40
+    14ca:	c3                   	ret
+
+000014cb <acquire_t>:
+SYSCALL(acquire_t)
+    14cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    14d0:	cd 40                	int    $0x40
+    14d2:	c3                   	ret
+
+000014d3 <release_t>:
+SYSCALL(release_t)
+    14d3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    14d8:	cd 40                	int    $0x40
+    14da:	c3                   	ret
+
+000014db <setsched>:
+SYSCALL(setsched)
+    14db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    14e0:	cd 40                	int    $0x40
+    14e2:	c3                   	ret
+
+000014e3 <mkgroup>:
+SYSCALL(mkgroup)
+    14e3:	b8 20 00 00 00       	mov    $0x20,%eax
+    14e8:	cd 40                	int    $0x40
+    14ea:	c3                   	ret
+
+000014eb <joingroup>:
+SYSCALL(joingroup)
+    14eb:	b8 21 00 00 00       	mov    $0x21,%eax
+    14f0:	cd 40                	int    $0x40
+    14f2:	c3                   	ret
+
+000014f3 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    14f3:	b8 22 00 00 00       	mov    $0x22,%eax
+    14f8:	cd 40                	int    $0x40
+    14fa:	c3                   	ret
+
+000014fb <setdeadline>:
+SYSCALL(setdeadline)
+    14fb:	b8 23 00 00 00       	mov    $0x23,%eax
+    1500:	cd 40                	int    $0x40
+    1502:	c3                   	ret
+
+00001503 <setaffinity>:
+SYSCALL(setaffinity)
+    1503:	b8 24 00 00 00       	mov    $0x24,%eax
+    1508:	cd 40                	int    $0x40
+    150a:	c3                   	ret
+
+0000150b <yield_to>:
+SYSCALL(yield_to)
+    150b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1510:	cd 40                	int    $0x40
+    1512:	c3                   	ret
+
+00001513 <getlatency>:
+SYSCALL(getlatency)
+    1513:	b8 26 00 00 00       	mov    $0x26,%eax
+    1518:	cd 40                	int    $0x40
+    151a:	c3                   	ret
+
+0000151b <futex_wait>:
+SYSCALL(futex_wait)
+    151b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1520:	cd 40                	int    $0x40
+    1522:	c3                   	ret
+
+00001523 <futex_wake>:
+SYSCALL(futex_wake)
+    1523:	b8 28 00 00 00       	mov    $0x28,%eax
+    1528:	cd 40                	int    $0x40
+    152a:	c3                   	ret
+
+0000152b <mguard>:
+SYSCALL(mguard)
+    152b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1530:	cd 40                	int    $0x40
+    1532:	c3                   	ret
+
+00001533 <join_any>:
+SYSCALL(join_any)
+    1533:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1538:	cd 40                	int    $0x40
+    153a:	c3                   	ret
+    153b:	66 90                	xchg   %ax,%ax
+    153d:	66 90                	xchg   %ax,%ax
+    153f:	90                   	nop
+
+00001540 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1540:	55                   	push   %ebp
+    1541:	89 e5                	mov    %esp,%ebp
+    1543:	57                   	push   %edi
+    1544:	56                   	push   %esi
+    1545:	53                   	push   %ebx
+    1546:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1548:	89 d1                	mov    %edx,%ecx
+{
+    154a:	83 ec 3c             	sub    $0x3c,%esp
+    154d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1550:	85 d2                	test   %edx,%edx
+    1552:	0f 89 80 00 00 00    	jns    15d8 <printint+0x98>
+    1558:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    155c:	74 7a                	je     15d8 <printint+0x98>
+    x = -xx;
+    155e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1560:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1565:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1568:	31 f6                	xor    %esi,%esi
+    156a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1570:	89 c8                	mov    %ecx,%eax
+    1572:	31 d2                	xor    %edx,%edx
+    1574:	89 f7                	mov    %esi,%edi
+    1576:	f7 f3                	div    %ebx
+    1578:	8d 76 01             	lea    0x1(%esi),%esi
+    157b:	0f b6 92 d0 19 00 00 	movzbl 0x19d0(%edx),%edx
+    1582:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1586:	89 ca                	mov    %ecx,%edx
+    1588:	89 c1                	mov    %eax,%ecx
+    158a:	39 da                	cmp    %ebx,%edx
+    158c:	73 e2                	jae    1570 <printint+0x30>
+  if(neg)
+    158e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1591:	85 c0                	test   %eax,%eax
+    1593:	74 07                	je     159c <printint+0x5c>
+    buf[i++] = '-';
+    1595:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    159a:	89 f7                	mov    %esi,%edi
+    159c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    159f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    15a2:	01 df                	add    %ebx,%edi
+    15a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    15a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    15ab:	83 ec 04             	sub    $0x4,%esp
+    15ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+    15b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    15b4:	6a 01                	push   $0x1
+    15b6:	50                   	push   %eax
+    15b7:	56                   	push   %esi
+    15b8:	e8 56 fe ff ff       	call   1413 <write>
+  while(--i >= 0)
+    15bd:	89 f8                	mov    %edi,%eax
+    15bf:	83 c4 10             	add    $0x10,%esp
+    15c2:	83 ef 01             	sub    $0x1,%edi
+    15c5:	39 d8                	cmp    %ebx,%eax
+    15c7:	75 df                	jne    15a8 <printint+0x68>
+}
+    15c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15cc:	5b                   	pop    %ebx
+    15cd:	5e                   	pop    %esi
+    15ce:	5f                   	pop    %edi
+    15cf:	5d                   	pop    %ebp
+    15d0:	c3                   	ret
+    15d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    15d8:	31 c0                	xor    %eax,%eax
+    15da:	eb 89                	jmp    1565 <printint+0x25>
+    15dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000015e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    15e0:	55                   	push   %ebp
+    15e1:	89 e5                	mov    %esp,%ebp
+    15e3:	57                   	push   %edi
+    15e4:	56                   	push   %esi
+    15e5:	53                   	push   %ebx
+    15e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    15e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    15ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    15ef:	0f b6 1e             	movzbl (%esi),%ebx
+    15f2:	83 c6 01             	add    $0x1,%esi
+    15f5:	84 db                	test   %bl,%bl
+    15f7:	74 67                	je     1660 <printf+0x80>
+    15f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    15fc:	31 d2                	xor    %edx,%edx
+    15fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1601:	eb 34                	jmp    1637 <printf+0x57>
+    1603:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1607:	90                   	nop
+    1608:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    160b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1610:	83 f8 25             	cmp    $0x25,%eax
+    1613:	74 18                	je     162d <printf+0x4d>
+  write(fd, &c, 1);
+    1615:	83 ec 04             	sub    $0x4,%esp
+    1618:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    161b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    161e:	6a 01                	push   $0x1
+    1620:	50                   	push   %eax
+    1621:	57                   	push   %edi
+    1622:	e8 ec fd ff ff       	call   1413 <write>
+    1627:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    162a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    162d:	0f b6 1e             	movzbl (%esi),%ebx
+    1630:	83 c6 01             	add    $0x1,%esi
+    1633:	84 db                	test   %bl,%bl
+    1635:	74 29                	je     1660 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1637:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    163a:	85 d2                	test   %edx,%edx
+    163c:	74 ca                	je     1608 <printf+0x28>
+      }
+    } else if(state == '%'){
+    163e:	83 fa 25             	cmp    $0x25,%edx
+    1641:	75 ea                	jne    162d <printf+0x4d>
+      if(c == 'd'){
+    1643:	83 f8 25             	cmp    $0x25,%eax
+    1646:	0f 84 24 01 00 00    	je     1770 <printf+0x190>
+    164c:	83 e8 63             	sub    $0x63,%eax
+    164f:	83 f8 15             	cmp    $0x15,%eax
+    1652:	77 1c                	ja     1670 <printf+0x90>
+    1654:	ff 24 85 78 19 00 00 	jmp    *0x1978(,%eax,4)
+    165b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    165f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1663:	5b                   	pop    %ebx
+    1664:	5e                   	pop    %esi
+    1665:	5f                   	pop    %edi
+    1666:	5d                   	pop    %ebp
+    1667:	c3                   	ret
+    1668:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    166f:	90                   	nop
+  write(fd, &c, 1);
+    1670:	83 ec 04             	sub    $0x4,%esp
+    1673:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1676:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    167a:	6a 01                	push   $0x1
+    167c:	52                   	push   %edx
+    167d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1680:	57                   	push   %edi
+    1681:	e8 8d fd ff ff       	call   1413 <write>
+    1686:	83 c4 0c             	add    $0xc,%esp
+    1689:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    168c:	6a 01                	push   $0x1
+    168e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1691:	52                   	push   %edx
+    1692:	57                   	push   %edi
+    1693:	e8 7b fd ff ff       	call   1413 <write>
+        putc(fd, c);
+    1698:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    169b:	31 d2                	xor    %edx,%edx
+    169d:	eb 8e                	jmp    162d <printf+0x4d>
+    169f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    16a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    16a3:	83 ec 0c             	sub    $0xc,%esp
+    16a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    16ab:	8b 13                	mov    (%ebx),%edx
+    16ad:	6a 00                	push   $0x0
+    16af:	89 f8                	mov    %edi,%eax
+        ap++;
+    16b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    16b4:	e8 87 fe ff ff       	call   1540 <printint>
+        ap++;
+    16b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    16bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    16bf:	31 d2                	xor    %edx,%edx
+    16c1:	e9 67 ff ff ff       	jmp    162d <printf+0x4d>
+    16c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    16d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    16d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    16d5:	83 c0 04             	add    $0x4,%eax
+    16d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    16db:	85 db                	test   %ebx,%ebx
+    16dd:	0f 84 9d 00 00 00    	je     1780 <printf+0x1a0>
+        while(*s != 0){
+    16e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    16e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    16e8:	84 c0                	test   %al,%al
+    16ea:	0f 84 3d ff ff ff    	je     162d <printf+0x4d>
+    16f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    16f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    16f6:	89 de                	mov    %ebx,%esi
+    16f8:	89 d3                	mov    %edx,%ebx
+    16fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1700:	83 ec 04             	sub    $0x4,%esp
+    1703:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1706:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1709:	6a 01                	push   $0x1
+    170b:	53                   	push   %ebx
+    170c:	57                   	push   %edi
+    170d:	e8 01 fd ff ff       	call   1413 <write>
+        while(*s != 0){
+    1712:	0f b6 06             	movzbl (%esi),%eax
+    1715:	83 c4 10             	add    $0x10,%esp
+    1718:	84 c0                	test   %al,%al
+    171a:	75 e4                	jne    1700 <printf+0x120>
+      state = 0;
+    171c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    171f:	31 d2                	xor    %edx,%edx
+    1721:	e9 07 ff ff ff       	jmp    162d <printf+0x4d>
+    1726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    172d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1730:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1733:	83 ec 0c             	sub    $0xc,%esp
+    1736:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    173b:	8b 13                	mov    (%ebx),%edx
+    173d:	6a 01                	push   $0x1
+    173f:	e9 6b ff ff ff       	jmp    16af <printf+0xcf>
+    1744:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1748:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    174b:	83 ec 04             	sub    $0x4,%esp
+    174e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1751:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1753:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1756:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1759:	6a 01                	push   $0x1
+    175b:	52                   	push   %edx
+    175c:	57                   	push   %edi
+    175d:	e8 b1 fc ff ff       	call   1413 <write>
+        ap++;
+    1762:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1765:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1768:	31 d2                	xor    %edx,%edx
+    176a:	e9 be fe ff ff       	jmp    162d <printf+0x4d>
+    176f:	90                   	nop
+  write(fd, &c, 1);
+    1770:	83 ec 04             	sub    $0x4,%esp
+    1773:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1776:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1779:	6a 01                	push   $0x1
+    177b:	e9 11 ff ff ff       	jmp    1691 <printf+0xb1>
+    1780:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1785:	bb 6f 19 00 00       	mov    $0x196f,%ebx
+    178a:	e9 61 ff ff ff       	jmp    16f0 <printf+0x110>
+    178f:	90                   	nop
+
+00001790 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1790:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1791:	a1 7c 1c 00 00       	mov    0x1c7c,%eax
+{
+    1796:	89 e5                	mov    %esp,%ebp
+    1798:	57                   	push   %edi
+    1799:	56                   	push   %esi
+    179a:	53                   	push   %ebx
+    179b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    179e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17a8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17aa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17ac:	39 ca                	cmp    %ecx,%edx
+    17ae:	73 30                	jae    17e0 <free+0x50>
+    17b0:	39 c1                	cmp    %eax,%ecx
+    17b2:	72 04                	jb     17b8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17b4:	39 c2                	cmp    %eax,%edx
+    17b6:	72 f0                	jb     17a8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    17b8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    17bb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    17be:	39 f8                	cmp    %edi,%eax
+    17c0:	74 2e                	je     17f0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17c2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    17c5:	8b 42 04             	mov    0x4(%edx),%eax
+    17c8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    17cb:	39 f1                	cmp    %esi,%ecx
+    17cd:	74 38                	je     1807 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    17cf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    17d1:	5b                   	pop    %ebx
+  freep = p;
+    17d2:	89 15 7c 1c 00 00    	mov    %edx,0x1c7c
+}
+    17d8:	5e                   	pop    %esi
+    17d9:	5f                   	pop    %edi
+    17da:	5d                   	pop    %ebp
+    17db:	c3                   	ret
+    17dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17e0:	39 c1                	cmp    %eax,%ecx
+    17e2:	72 d0                	jb     17b4 <free+0x24>
+    17e4:	eb c2                	jmp    17a8 <free+0x18>
+    17e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    17f0:	03 70 04             	add    0x4(%eax),%esi
+    17f3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17f6:	8b 02                	mov    (%edx),%eax
+    17f8:	8b 00                	mov    (%eax),%eax
+    17fa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    17fd:	8b 42 04             	mov    0x4(%edx),%eax
+    1800:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1803:	39 f1                	cmp    %esi,%ecx
+    1805:	75 c8                	jne    17cf <free+0x3f>
+    p->s.size += bp->s.size;
+    1807:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    180a:	89 15 7c 1c 00 00    	mov    %edx,0x1c7c
+    p->s.size += bp->s.size;
+    1810:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1813:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1816:	89 0a                	mov    %ecx,(%edx)
+}
+    1818:	5b                   	pop    %ebx
+    1819:	5e                   	pop    %esi
+    181a:	5f                   	pop    %edi
+    181b:	5d                   	pop    %ebp
+    181c:	c3                   	ret
+    181d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001820 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1820:	55                   	push   %ebp
+    1821:	89 e5                	mov    %esp,%ebp
+    1823:	57                   	push   %edi
+    1824:	56                   	push   %esi
+    1825:	53                   	push   %ebx
+    1826:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1829:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    182c:	8b 15 7c 1c 00 00    	mov    0x1c7c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1832:	8d 78 07             	lea    0x7(%eax),%edi
+    1835:	c1 ef 03             	shr    $0x3,%edi
+    1838:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    183b:	85 d2                	test   %edx,%edx
+    183d:	0f 84 8d 00 00 00    	je     18d0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1843:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1845:	8b 48 04             	mov    0x4(%eax),%ecx
+    1848:	39 f9                	cmp    %edi,%ecx
+    184a:	73 64                	jae    18b0 <malloc+0x90>
+  if(nu < 4096)
+    184c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1851:	39 df                	cmp    %ebx,%edi
+    1853:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1856:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    185d:	eb 0a                	jmp    1869 <malloc+0x49>
+    185f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1860:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1862:	8b 48 04             	mov    0x4(%eax),%ecx
+    1865:	39 f9                	cmp    %edi,%ecx
+    1867:	73 47                	jae    18b0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1869:	89 c2                	mov    %eax,%edx
+    186b:	39 05 7c 1c 00 00    	cmp    %eax,0x1c7c
+    1871:	75 ed                	jne    1860 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1873:	83 ec 0c             	sub    $0xc,%esp
+    1876:	56                   	push   %esi
+    1877:	e8 ff fb ff ff       	call   147b <sbrk>
+  if(p == (char*)-1)
+    187c:	83 c4 10             	add    $0x10,%esp
+    187f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1882:	74 1c                	je     18a0 <malloc+0x80>
+  hp->s.size = nu;
+    1884:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1887:	83 ec 0c             	sub    $0xc,%esp
+    188a:	83 c0 08             	add    $0x8,%eax
+    188d:	50                   	push   %eax
+    188e:	e8 fd fe ff ff       	call   1790 <free>
+  return freep;
+    1893:	8b 15 7c 1c 00 00    	mov    0x1c7c,%edx
+      if((p = morecore(nunits)) == 0)
+    1899:	83 c4 10             	add    $0x10,%esp
+    189c:	85 d2                	test   %edx,%edx
+    189e:	75 c0                	jne    1860 <malloc+0x40>
+        return 0;
+  }
+}
+    18a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    18a3:	31 c0                	xor    %eax,%eax
+}
+    18a5:	5b                   	pop    %ebx
+    18a6:	5e                   	pop    %esi
+    18a7:	5f                   	pop    %edi
+    18a8:	5d                   	pop    %ebp
+    18a9:	c3                   	ret
+    18aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    18b0:	39 cf                	cmp    %ecx,%edi
+    18b2:	74 4c                	je     1900 <malloc+0xe0>
+        p->s.size -= nunits;
+    18b4:	29 f9                	sub    %edi,%ecx
+    18b6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    18b9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    18bc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    18bf:	89 15 7c 1c 00 00    	mov    %edx,0x1c7c
+}
+    18c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    18c8:	83 c0 08             	add    $0x8,%eax
+}
+    18cb:	5b                   	pop    %ebx
+    18cc:	5e                   	pop    %esi
+    18cd:	5f                   	pop    %edi
+    18ce:	5d                   	pop    %ebp
+    18cf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    18d0:	c7 05 7c 1c 00 00 80 	movl   $0x1c80,0x1c7c
+    18d7:	1c 00 00 
+    base.s.size = 0;
+    18da:	b8 80 1c 00 00       	mov    $0x1c80,%eax
+    base.s.ptr = freep = prevp = &base;
+    18df:	c7 05 80 1c 00 00 80 	movl   $0x1c80,0x1c80
+    18e6:	1c 00 00 
+    base.s.size = 0;
+    18e9:	c7 05 84 1c 00 00 00 	movl   $0x0,0x1c84
+    18f0:	00 00 00 
+    if(p->s.size >= nunits){
+    18f3:	e9 54 ff ff ff       	jmp    184c <malloc+0x2c>
+    18f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1900:	8b 08                	mov    (%eax),%ecx
+    1902:	89 0a                	mov    %ecx,(%edx)
+    1904:	eb b9                	jmp    18bf <malloc+0x9f>
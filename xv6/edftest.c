@@ -0,0 +1,59 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "pstat.h"
+
+// A periodic real-time task reserving 2 ticks out of every 10
+// should meet its deadlines next to CPU hogs, and admission
+// control should refuse reservations beyond what is left.
+
+#define PERIOD  10
+#define RUNTIME 2
+#define NJOBS   50
+
+int
+main(int argc, char *argv[])
+{
+	int hog_pid[3];
+	int i, j, start;
+
+	for(i = 0; i < 3; i++){
+		hog_pid[i] = fork();
+		if(hog_pid[i] == 0){
+			settickets(100);
+			for (;;);
+		}
+	}
+
+	if(setdeadline(PERIOD, RUNTIME) < 0){
+		printf(1, "setdeadline(%d, %d) failed\n", PERIOD, RUNTIME);
+		exit();
+	}
+	if(setdeadline(PERIOD, PERIOD) == 0)
+		printf(1, "admission control accepted 100%% of a CPU\n");
+	setdeadline(PERIOD, RUNTIME);
+
+	// each job spins for about one tick, then waits for the next period
+	for(j = 0; j < NJOBS; j++){
+		start = uptime();
+		while(uptime() == start)
+			;
+		sleep(PERIOD - (uptime() - start));
+	}
+
+	struct pstat st;
+	st.next = 0;
+	do {
+		getpinfo(&st);
+		for (i = 0; i < sizeof(st.pid)/sizeof(st.pid[0]); i++)
+			if(st.inuse[i] && st.pid[i] == getpid())
+				printf(1, "%d jobs, %d deadlines missed\n", NJOBS, st.misses[i]);
+	} while(st.next);
+
+	setdeadline(0, 0);
+	for(i = 0; i < 3; i++){
+		kill(hog_pid[i]);
+		wait();
+	}
+	exit();
+}
@@ -3,6 +3,9 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "mm.h"
 #include "defs.h"
 #include "x86.h"
 #include "elf.h"
@@ -16,7 +19,8 @@ exec(char *path, char **argv)
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
-  pde_t *pgdir, *oldpgdir;
+  pde_t *pgdir;
+  struct mm *mm, *oldmm;
   struct proc *curproc = myproc();
 
   begin_op();
@@ -86,6 +90,8 @@ exec(char *path, char **argv)
   sp -= (3+argc+1) * 4;
   if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
     goto bad;
+  if((mm = mmalloc(pgdir, sz)) == 0)
+    goto bad;
 
   // Save program name for debugging.
   for(last=s=path; *s; s++)
@@ -93,14 +99,14 @@ exec(char *path, char **argv)
       last = s+1;
   safestrcpy(curproc->name, last, sizeof(curproc->name));
 
-  // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
-  curproc->sz = sz;
+  // Commit to the user image, leaving any other threads
+  // the address space they were running in.
+  oldmm = curproc->mm;
+  curproc->mm = mm;
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
   switchuvm(curproc);
-  freevm(oldpgdir);
+  mmput(oldmm);
   return 0;
 
  bad:
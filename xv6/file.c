@@ -5,6 +5,7 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
@@ -16,10 +17,19 @@ struct {
   struct file file[NFILE];
 } ftable;
 
+// Descriptor tables and current directories not in use,
+// carved from pages as needed.
+static struct {
+  struct spinlock lock;
+  struct fdtable *fdtfree;
+  struct cwd *cwdfree;
+} fdcache;
+
 void
 fileinit(void)
 {
   initlock(&ftable.lock, "ftable");
+  initlock(&fdcache.lock, "fdcache");
 }
 
 // Allocate a file structure.
@@ -155,3 +165,179 @@ filewrite(struct file *f, char *addr, int n)
   panic("filewrite");
 }
 
+
+// Take an object of size bytes off the free list *free, whose
+// objects are linked through their first word, carving a new
+// page into objects if it is empty.  Caller holds fdcache.lock.
+static void*
+carve(void **free, int size)
+{
+  char *page;
+  void *o;
+  int i;
+
+  if(*free == 0){
+    if((page = kalloc()) == 0)
+      return 0;
+    for(i = 0; i + size <= PGSIZE; i += size){
+      *(void**)(page + i) = *free;
+      *free = page + i;
+    }
+  }
+  o = *free;
+  *free = *(void**)o;
+  return o;
+}
+
+// Allocate an empty descriptor table with one reference.
+struct fdtable*
+fdtalloc(void)
+{
+  struct fdtable *fdt;
+
+  acquire(&fdcache.lock);
+  fdt = carve((void**)&fdcache.fdtfree, sizeof(*fdt));
+  release(&fdcache.lock);
+  if(fdt == 0)
+    return 0;
+  memset(fdt, 0, sizeof(*fdt));
+  initlock(&fdt->lock, "fdtable");
+  fdt->ref = 1;
+  return fdt;
+}
+
+// Allocate a table holding the files open in fdt, for fork().
+struct fdtable*
+fdtcopy(struct fdtable *fdt)
+{
+  struct fdtable *nfdt;
+  int fd;
+
+  if((nfdt = fdtalloc()) == 0)
+    return 0;
+  acquire(&fdt->lock);
+  for(fd = 0; fd < NOFILE; fd++)
+    if(fdt->ofile[fd])
+      nfdt->ofile[fd] = filedup(fdt->ofile[fd]);
+  release(&fdt->lock);
+  return nfdt;
+}
+
+// Increment ref count for descriptor table fdt.
+struct fdtable*
+fdtdup(struct fdtable *fdt)
+{
+  acquire(&fdt->lock);
+  fdt->ref++;
+  release(&fdt->lock);
+  return fdt;
+}
+
+// Drop a reference to fdt, closing its files with the last.
+void
+fdtput(struct fdtable *fdt)
+{
+  int fd, ref;
+
+  acquire(&fdt->lock);
+  ref = --fdt->ref;
+  release(&fdt->lock);
+  if(ref > 0)
+    return;
+  for(fd = 0; fd < NOFILE; fd++){
+    if(fdt->ofile[fd]){
+      fileclose(fdt->ofile[fd]);
+      fdt->ofile[fd] = 0;
+    }
+  }
+  acquire(&fdcache.lock);
+  fdt->next = fdcache.fdtfree;
+  fdcache.fdtfree = fdt;
+  release(&fdcache.lock);
+}
+
+// Allocate a current directory at ip, taking over the
+// caller's reference to ip.
+struct cwd*
+cwdalloc(struct inode *ip)
+{
+  struct cwd *cwd;
+
+  acquire(&fdcache.lock);
+  cwd = carve((void**)&fdcache.cwdfree, sizeof(*cwd));
+  release(&fdcache.lock);
+  if(cwd == 0)
+    return 0;
+  initlock(&cwd->lock, "cwd");
+  cwd->ref = 1;
+  cwd->ip = ip;
+  return cwd;
+}
+
+// Allocate a current directory at the same inode as cwd.
+struct cwd*
+cwdcopy(struct cwd *cwd)
+{
+  struct cwd *ncwd;
+
+  if((ncwd = cwdalloc(0)) == 0)
+    return 0;
+  ncwd->ip = cwdget(cwd);
+  return ncwd;
+}
+
+// Increment ref count for current directory cwd.
+struct cwd*
+cwddup(struct cwd *cwd)
+{
+  acquire(&cwd->lock);
+  cwd->ref++;
+  release(&cwd->lock);
+  return cwd;
+}
+
+// Drop a reference to cwd, releasing its inode with the last.
+void
+cwdput(struct cwd *cwd)
+{
+  int ref;
+
+  acquire(&cwd->lock);
+  ref = --cwd->ref;
+  release(&cwd->lock);
+  if(ref > 0)
+    return;
+  begin_op();
+  iput(cwd->ip);
+  end_op();
+  acquire(&fdcache.lock);
+  cwd->next = fdcache.cwdfree;
+  fdcache.cwdfree = cwd;
+  release(&fdcache.lock);
+}
+
+// Return a new reference to the inode cwd is at.
+struct inode*
+cwdget(struct cwd *cwd)
+{
+  struct inode *ip;
+
+  acquire(&cwd->lock);
+  ip = idup(cwd->ip);
+  release(&cwd->lock);
+  return ip;
+}
+
+// Move cwd to ip, taking over the caller's reference to ip,
+// and return the inode it was at for the caller to iput().
+struct inode*
+cwdset(struct cwd *cwd, struct inode *ip)
+{
+  struct inode *old;
+
+  acquire(&cwd->lock);
+  old = cwd->ip;
+  cwd->ip = ip;
+  release(&cwd->lock);
+  return old;
+}
@@ -8,6 +8,24 @@ struct file {
   uint off;
 };
 
+// Open files of a process, by descriptor; threads cloned
+// with CLONE_FILES share one.
+struct fdtable {
+  struct fdtable *next;  // Next on the free list
+  struct spinlock lock;  // Protects ofile and ref
+  int ref;               // Processes using it
+  struct file *ofile[NOFILE];
+};
+
+// Current directory of a process; threads cloned with
+// CLONE_FS share one.
+struct cwd {
+  struct cwd *next;      // Next on the free list
+  struct spinlock lock;  // Protects ip and ref
+  int ref;               // Processes using it
+  struct inode *ip;
+};
+
 
 // in-memory copy of an inode
 struct inode {
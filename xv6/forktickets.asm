@@ -0,0 +1,1319 @@
+
+_forktickets:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#include "user.h"
+#include "pstat.h"
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	51                   	push   %ecx
+    1011:	81 ec 28 0b 00 00    	sub    $0xb28,%esp
+    1017:	8b 59 04             	mov    0x4(%ecx),%ebx
+
+	int parent_pid = getpid();
+    101a:	e8 a4 03 00 00       	call   13c3 <getpid>
+	int tickets = atoi(argv[1]);
+    101f:	83 ec 0c             	sub    $0xc,%esp
+    1022:	ff 73 04             	push   0x4(%ebx)
+	int parent_pid = getpid();
+    1025:	89 c6                	mov    %eax,%esi
+	int tickets = atoi(argv[1]);
+    1027:	e8 a4 02 00 00       	call   12d0 <atoi>
+	settickets(tickets);
+    102c:	89 04 24             	mov    %eax,(%esp)
+    102f:	e8 af 03 00 00       	call   13e3 <settickets>
+
+	
+	if(fork() == 0)
+    1034:	e8 02 03 00 00       	call   133b <fork>
+    1039:	83 c4 10             	add    $0x10,%esp
+    103c:	85 c0                	test   %eax,%eax
+    103e:	74 0e                	je     104e <main+0x4e>
+		printf(1, "parent: %d, child: %d\n", parent_tickets, child_tickets);
+    		
+    		exit();
+	}
+	
+  	while (wait() > 0) ;
+    1040:	e8 06 03 00 00       	call   134b <wait>
+    1045:	85 c0                	test   %eax,%eax
+    1047:	7f f7                	jg     1040 <main+0x40>
+  
+	exit();
+    1049:	e8 f5 02 00 00       	call   1343 <exit>
+		int child_pid = getpid();
+    104e:	e8 70 03 00 00       	call   13c3 <getpid>
+		st.next = 0;
+    1053:	31 db                	xor    %ebx,%ebx
+		int parent_tickets = -1, child_tickets = -1;
+    1055:	83 ca ff             	or     $0xffffffff,%edx
+    1058:	c7 85 d4 f4 ff ff ff 	movl   $0xffffffff,-0xb2c(%ebp)
+    105f:	ff ff ff 
+		st.next = 0;
+    1062:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+		int child_pid = getpid();
+    1065:	89 c7                	mov    %eax,%edi
+		st.next = 0;
+    1067:	8d 9d e4 f5 ff ff    	lea    -0xa1c(%ebp),%ebx
+    106d:	8d 76 00             	lea    0x0(%esi),%esi
+			getpinfo(&st);
+    1070:	83 ec 0c             	sub    $0xc,%esp
+    1073:	8d 85 e4 f4 ff ff    	lea    -0xb1c(%ebp),%eax
+    1079:	89 95 d0 f4 ff ff    	mov    %edx,-0xb30(%ebp)
+    107f:	50                   	push   %eax
+    1080:	e8 66 03 00 00       	call   13eb <getpinfo>
+			for (i = 0; i < sizeof(st.pid)/sizeof(st.pid[0]); i++)
+    1085:	8b 95 d0 f4 ff ff    	mov    -0xb30(%ebp),%edx
+    108b:	8d 85 e4 f4 ff ff    	lea    -0xb1c(%ebp),%eax
+    1091:	83 c4 10             	add    $0x10,%esp
+    1094:	eb 21                	jmp    10b7 <main+0xb7>
+    1096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109d:	8d 76 00             	lea    0x0(%esi),%esi
+				else if(st.pid[i] ==child_pid)
+    10a0:	39 cf                	cmp    %ecx,%edi
+    10a2:	75 0c                	jne    10b0 <main+0xb0>
+					child_tickets=st.tickets[i];
+    10a4:	8b 88 00 01 00 00    	mov    0x100(%eax),%ecx
+    10aa:	89 8d d4 f4 ff ff    	mov    %ecx,-0xb2c(%ebp)
+			for (i = 0; i < sizeof(st.pid)/sizeof(st.pid[0]); i++)
+    10b0:	83 c0 04             	add    $0x4,%eax
+    10b3:	39 c3                	cmp    %eax,%ebx
+    10b5:	74 1d                	je     10d4 <main+0xd4>
+				if(!st.inuse[i])
+    10b7:	8b 08                	mov    (%eax),%ecx
+    10b9:	85 c9                	test   %ecx,%ecx
+    10bb:	74 f3                	je     10b0 <main+0xb0>
+				if(st.pid[i] ==parent_pid)
+    10bd:	8b 88 00 02 00 00    	mov    0x200(%eax),%ecx
+    10c3:	39 ce                	cmp    %ecx,%esi
+    10c5:	75 d9                	jne    10a0 <main+0xa0>
+					parent_tickets=st.tickets[i];
+    10c7:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+			for (i = 0; i < sizeof(st.pid)/sizeof(st.pid[0]); i++)
+    10cd:	83 c0 04             	add    $0x4,%eax
+    10d0:	39 c3                	cmp    %eax,%ebx
+    10d2:	75 e3                	jne    10b7 <main+0xb7>
+		} while(st.next);
+    10d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    10d7:	85 c0                	test   %eax,%eax
+    10d9:	75 95                	jne    1070 <main+0x70>
+		printf(1, "parent: %d, child: %d\n", parent_tickets, child_tickets);
+    10db:	ff b5 d4 f4 ff ff    	push   -0xb2c(%ebp)
+    10e1:	52                   	push   %edx
+    10e2:	68 58 18 00 00       	push   $0x1858
+    10e7:	6a 01                	push   $0x1
+    10e9:	e8 42 04 00 00       	call   1530 <printf>
+    		exit();
+    10ee:	e8 50 02 00 00       	call   1343 <exit>
+    10f3:	66 90                	xchg   %ax,%ax
+    10f5:	66 90                	xchg   %ax,%ax
+    10f7:	66 90                	xchg   %ax,%ax
+    10f9:	66 90                	xchg   %ax,%ax
+    10fb:	66 90                	xchg   %ax,%ax
+    10fd:	66 90                	xchg   %ax,%ax
+    10ff:	90                   	nop
+
+00001100 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1100:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1101:	31 c0                	xor    %eax,%eax
+{
+    1103:	89 e5                	mov    %esp,%ebp
+    1105:	53                   	push   %ebx
+    1106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1109:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    110c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1110:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1114:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1117:	83 c0 01             	add    $0x1,%eax
+    111a:	84 d2                	test   %dl,%dl
+    111c:	75 f2                	jne    1110 <strcpy+0x10>
+    ;
+  return os;
+}
+    111e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1121:	89 c8                	mov    %ecx,%eax
+    1123:	c9                   	leave
+    1124:	c3                   	ret
+    1125:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001130 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	53                   	push   %ebx
+    1134:	8b 55 08             	mov    0x8(%ebp),%edx
+    1137:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    113a:	0f b6 02             	movzbl (%edx),%eax
+    113d:	84 c0                	test   %al,%al
+    113f:	75 17                	jne    1158 <strcmp+0x28>
+    1141:	eb 3a                	jmp    117d <strcmp+0x4d>
+    1143:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1147:	90                   	nop
+    1148:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    114c:	83 c2 01             	add    $0x1,%edx
+    114f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1152:	84 c0                	test   %al,%al
+    1154:	74 1a                	je     1170 <strcmp+0x40>
+    p++, q++;
+    1156:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1158:	0f b6 19             	movzbl (%ecx),%ebx
+    115b:	38 c3                	cmp    %al,%bl
+    115d:	74 e9                	je     1148 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    115f:	29 d8                	sub    %ebx,%eax
+}
+    1161:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1164:	c9                   	leave
+    1165:	c3                   	ret
+    1166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    116d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1170:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1174:	31 c0                	xor    %eax,%eax
+    1176:	29 d8                	sub    %ebx,%eax
+}
+    1178:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    117b:	c9                   	leave
+    117c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    117d:	0f b6 19             	movzbl (%ecx),%ebx
+    1180:	31 c0                	xor    %eax,%eax
+    1182:	eb db                	jmp    115f <strcmp+0x2f>
+    1184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    118f:	90                   	nop
+
+00001190 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1196:	80 3a 00             	cmpb   $0x0,(%edx)
+    1199:	74 15                	je     11b0 <strlen+0x20>
+    119b:	31 c0                	xor    %eax,%eax
+    119d:	8d 76 00             	lea    0x0(%esi),%esi
+    11a0:	83 c0 01             	add    $0x1,%eax
+    11a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    11a7:	89 c1                	mov    %eax,%ecx
+    11a9:	75 f5                	jne    11a0 <strlen+0x10>
+    ;
+  return n;
+}
+    11ab:	89 c8                	mov    %ecx,%eax
+    11ad:	5d                   	pop    %ebp
+    11ae:	c3                   	ret
+    11af:	90                   	nop
+  for(n = 0; s[n]; n++)
+    11b0:	31 c9                	xor    %ecx,%ecx
+}
+    11b2:	5d                   	pop    %ebp
+    11b3:	89 c8                	mov    %ecx,%eax
+    11b5:	c3                   	ret
+    11b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000011c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    11c0:	55                   	push   %ebp
+    11c1:	89 e5                	mov    %esp,%ebp
+    11c3:	57                   	push   %edi
+    11c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    11c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    11ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11cd:	89 d7                	mov    %edx,%edi
+    11cf:	fc                   	cld
+    11d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    11d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    11d5:	89 d0                	mov    %edx,%eax
+    11d7:	c9                   	leave
+    11d8:	c3                   	ret
+    11d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    11ea:	0f b6 10             	movzbl (%eax),%edx
+    11ed:	84 d2                	test   %dl,%dl
+    11ef:	75 12                	jne    1203 <strchr+0x23>
+    11f1:	eb 1d                	jmp    1210 <strchr+0x30>
+    11f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11f7:	90                   	nop
+    11f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    11fc:	83 c0 01             	add    $0x1,%eax
+    11ff:	84 d2                	test   %dl,%dl
+    1201:	74 0d                	je     1210 <strchr+0x30>
+    if(*s == c)
+    1203:	38 d1                	cmp    %dl,%cl
+    1205:	75 f1                	jne    11f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1207:	5d                   	pop    %ebp
+    1208:	c3                   	ret
+    1209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1210:	31 c0                	xor    %eax,%eax
+}
+    1212:	5d                   	pop    %ebp
+    1213:	c3                   	ret
+    1214:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    121f:	90                   	nop
+
+00001220 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	57                   	push   %edi
+    1224:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1225:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1228:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1229:	31 db                	xor    %ebx,%ebx
+{
+    122b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    122e:	eb 27                	jmp    1257 <gets+0x37>
+    cc = read(0, &c, 1);
+    1230:	83 ec 04             	sub    $0x4,%esp
+    1233:	6a 01                	push   $0x1
+    1235:	56                   	push   %esi
+    1236:	6a 00                	push   $0x0
+    1238:	e8 1e 01 00 00       	call   135b <read>
+    if(cc < 1)
+    123d:	83 c4 10             	add    $0x10,%esp
+    1240:	85 c0                	test   %eax,%eax
+    1242:	7e 1d                	jle    1261 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1244:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1248:	8b 55 08             	mov    0x8(%ebp),%edx
+    124b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    124f:	3c 0a                	cmp    $0xa,%al
+    1251:	74 10                	je     1263 <gets+0x43>
+    1253:	3c 0d                	cmp    $0xd,%al
+    1255:	74 0c                	je     1263 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1257:	89 df                	mov    %ebx,%edi
+    1259:	83 c3 01             	add    $0x1,%ebx
+    125c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    125f:	7c cf                	jl     1230 <gets+0x10>
+    1261:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1263:	8b 45 08             	mov    0x8(%ebp),%eax
+    1266:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    126a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    126d:	5b                   	pop    %ebx
+    126e:	5e                   	pop    %esi
+    126f:	5f                   	pop    %edi
+    1270:	5d                   	pop    %ebp
+    1271:	c3                   	ret
+    1272:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001280 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	56                   	push   %esi
+    1284:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1285:	83 ec 08             	sub    $0x8,%esp
+    1288:	6a 00                	push   $0x0
+    128a:	ff 75 08             	push   0x8(%ebp)
+    128d:	e8 f1 00 00 00       	call   1383 <open>
+  if(fd < 0)
+    1292:	83 c4 10             	add    $0x10,%esp
+    1295:	85 c0                	test   %eax,%eax
+    1297:	78 27                	js     12c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1299:	83 ec 08             	sub    $0x8,%esp
+    129c:	ff 75 0c             	push   0xc(%ebp)
+    129f:	89 c3                	mov    %eax,%ebx
+    12a1:	50                   	push   %eax
+    12a2:	e8 f4 00 00 00       	call   139b <fstat>
+  close(fd);
+    12a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    12aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+    12ac:	e8 ba 00 00 00       	call   136b <close>
+  return r;
+    12b1:	83 c4 10             	add    $0x10,%esp
+}
+    12b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12b7:	89 f0                	mov    %esi,%eax
+    12b9:	5b                   	pop    %ebx
+    12ba:	5e                   	pop    %esi
+    12bb:	5d                   	pop    %ebp
+    12bc:	c3                   	ret
+    12bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    12c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    12c5:	eb ed                	jmp    12b4 <stat+0x34>
+    12c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ce:	66 90                	xchg   %ax,%ax
+
+000012d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	53                   	push   %ebx
+    12d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    12d7:	0f be 02             	movsbl (%edx),%eax
+    12da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    12dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    12e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    12e5:	77 1e                	ja     1305 <atoi+0x35>
+    12e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    12f0:	83 c2 01             	add    $0x1,%edx
+    12f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    12f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    12fa:	0f be 02             	movsbl (%edx),%eax
+    12fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1300:	80 fb 09             	cmp    $0x9,%bl
+    1303:	76 eb                	jbe    12f0 <atoi+0x20>
+  return n;
+}
+    1305:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1308:	89 c8                	mov    %ecx,%eax
+    130a:	c9                   	leave
+    130b:	c3                   	ret
+    130c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001310 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1310:	55                   	push   %ebp
+    1311:	89 e5                	mov    %esp,%ebp
+    1313:	57                   	push   %edi
+    1314:	56                   	push   %esi
+    1315:	8b 45 10             	mov    0x10(%ebp),%eax
+    1318:	8b 55 08             	mov    0x8(%ebp),%edx
+    131b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    131e:	85 c0                	test   %eax,%eax
+    1320:	7e 13                	jle    1335 <memmove+0x25>
+    1322:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1324:	89 d7                	mov    %edx,%edi
+    1326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1330:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1331:	39 f8                	cmp    %edi,%eax
+    1333:	75 fb                	jne    1330 <memmove+0x20>
+  return vdst;
+}
+    1335:	5e                   	pop    %esi
+    1336:	89 d0                	mov    %edx,%eax
+    1338:	5f                   	pop    %edi
+    1339:	5d                   	pop    %ebp
+    133a:	c3                   	ret
+
+0000133b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    133b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1340:	cd 40                	int    $0x40
+    1342:	c3                   	ret
+
+00001343 <exit>:
+SYSCALL(exit)
+    1343:	b8 02 00 00 00       	mov    $0x2,%eax
+    1348:	cd 40                	int    $0x40
+    134a:	c3                   	ret
+
+0000134b <wait>:
+SYSCALL(wait)
+    134b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1350:	cd 40                	int    $0x40
+    1352:	c3                   	ret
+
+00001353 <pipe>:
+SYSCALL(pipe)
+    1353:	b8 04 00 00 00       	mov    $0x4,%eax
+    1358:	cd 40                	int    $0x40
+    135a:	c3                   	ret
+
+0000135b <read>:
+SYSCALL(read)
+    135b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1360:	cd 40                	int    $0x40
+    1362:	c3                   	ret
+
+00001363 <write>:
+SYSCALL(write)
+    1363:	b8 10 00 00 00       	mov    $0x10,%eax
+    1368:	cd 40                	int    $0x40
+    136a:	c3                   	ret
+
+0000136b <close>:
+SYSCALL(close)
+    136b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1370:	cd 40                	int    $0x40
+    1372:	c3                   	ret
+
+00001373 <kill>:
+SYSCALL(kill)
+    1373:	b8 06 00 00 00       	mov    $0x6,%eax
+    1378:	cd 40                	int    $0x40
+    137a:	c3                   	ret
+
+0000137b <exec>:
+SYSCALL(exec)
+    137b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1380:	cd 40                	int    $0x40
+    1382:	c3                   	ret
+
+00001383 <open>:
+SYSCALL(open)
+    1383:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1388:	cd 40                	int    $0x40
+    138a:	c3                   	ret
+
+0000138b <mknod>:
+SYSCALL(mknod)
+    138b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1390:	cd 40                	int    $0x40
+    1392:	c3                   	ret
+
+00001393 <unlink>:
+SYSCALL(unlink)
+    1393:	b8 12 00 00 00       	mov    $0x12,%eax
+    1398:	cd 40                	int    $0x40
+    139a:	c3                   	ret
+
+0000139b <fstat>:
+SYSCALL(fstat)
+    139b:	b8 08 00 00 00       	mov    $0x8,%eax
+    13a0:	cd 40                	int    $0x40
+    13a2:	c3                   	ret
+
+000013a3 <link>:
+SYSCALL(link)
+    13a3:	b8 13 00 00 00       	mov    $0x13,%eax
+    13a8:	cd 40                	int    $0x40
+    13aa:	c3                   	ret
+
+000013ab <mkdir>:
+SYSCALL(mkdir)
+    13ab:	b8 14 00 00 00       	mov    $0x14,%eax
+    13b0:	cd 40                	int    $0x40
+    13b2:	c3                   	ret
+
+000013b3 <chdir>:
+SYSCALL(chdir)
+    13b3:	b8 09 00 00 00       	mov    $0x9,%eax
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+
+000013bb <dup>:
+SYSCALL(dup)
+    13bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    13c0:	cd 40                	int    $0x40
+    13c2:	c3                   	ret
+
+000013c3 <getpid>:
+SYSCALL(getpid)
+    13c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    13c8:	cd 40                	int    $0x40
+    13ca:	c3                   	ret
+
+000013cb <sbrk>:
+SYSCALL(sbrk)
+    13cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    13d0:	cd 40                	int    $0x40
+    13d2:	c3                   	ret
+
+000013d3 <sleep>:
+SYSCALL(sleep)
+    13d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    13d8:	cd 40                	int    $0x40
+    13da:	c3                   	ret
+
+000013db <uptime>:
+SYSCALL(uptime)
+    13db:	b8 0e 00 00 00       	mov    $0xe,%eax
+    13e0:	cd 40                	int    $0x40
+    13e2:	c3                   	ret
+
+000013e3 <settickets>:
+SYSCALL(settickets)
+    13e3:	b8 16 00 00 00       	mov    $0x16,%eax
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+
+000013eb <getpinfo>:
+SYSCALL(getpinfo)
+    13eb:	b8 17 00 00 00       	mov    $0x17,%eax
+    13f0:	cd 40                	int    $0x40
+    13f2:	c3                   	ret
+
+000013f3 <mprotect>:
+SYSCALL(mprotect)
+    13f3:	b8 18 00 00 00       	mov    $0x18,%eax
+    13f8:	cd 40                	int    $0x40
+    13fa:	c3                   	ret
+
+000013fb <munprotect>:
+SYSCALL(munprotect)
+    13fb:	b8 19 00 00 00       	mov    $0x19,%eax
+    1400:	cd 40                	int    $0x40
+    1402:	c3                   	ret
+
+00001403 <clone>:
+SYSCALL(clone)
+    1403:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1408:	cd 40                	int    $0x40
+    140a:	c3                   	ret
+
+0000140b <join>:
+SYSCALL(join)
+    140b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1410:	cd 40                	int    $0x40
+    1412:	c3                   	ret
+
+00001413 <initlock_t>:
+SYSCALL(initlock_t)
+    1413:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1418:	cd 40                	int    $0x40
+    141a:	c3                   	ret
+
+0000141b <acquire_t>:
+SYSCALL(acquire_t)
+    141b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1420:	cd 40                	int    $0x40
+    1422:	c3                   	ret
+
+00001423 <release_t>:
+SYSCALL(release_t)
+    1423:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1428:	cd 40                	int    $0x40
+    142a:	c3                   	ret
+
+0000142b <setsched>:
+SYSCALL(setsched)
+    142b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1430:	cd 40                	int    $0x40
+    1432:	c3                   	ret
+
+00001433 <mkgroup>:
+SYSCALL(mkgroup)
+    1433:	b8 20 00 00 00       	mov    $0x20,%eax
+    1438:	cd 40                	int    $0x40
+    143a:	c3                   	ret
+
+0000143b <joingroup>:
+SYSCALL(joingroup)
+    143b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1440:	cd 40                	int    $0x40
+    1442:	c3                   	ret
+
+00001443 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1443:	b8 22 00 00 00       	mov    $0x22,%eax
+    1448:	cd 40                	int    $0x40
+    144a:	c3                   	ret
+
+0000144b <setdeadline>:
+SYSCALL(setdeadline)
+    144b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1450:	cd 40                	int    $0x40
+    1452:	c3                   	ret
+
+00001453 <setaffinity>:
+SYSCALL(setaffinity)
+    1453:	b8 24 00 00 00       	mov    $0x24,%eax
+    1458:	cd 40                	int    $0x40
+    145a:	c3                   	ret
+
+0000145b <yield_to>:
+SYSCALL(yield_to)
+    145b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1460:	cd 40                	int    $0x40
+    1462:	c3                   	ret
+
+00001463 <getlatency>:
+SYSCALL(getlatency)
+    1463:	b8 26 00 00 00       	mov    $0x26,%eax
+    1468:	cd 40                	int    $0x40
+    146a:	c3                   	ret
+
+0000146b <futex_wait>:
+SYSCALL(futex_wait)
+    146b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1470:	cd 40                	int    $0x40
+    1472:	c3                   	ret
+
+00001473 <futex_wake>:
+SYSCALL(futex_wake)
+    1473:	b8 28 00 00 00       	mov    $0x28,%eax
+    1478:	cd 40                	int    $0x40
+    147a:	c3                   	ret
+
+0000147b <mguard>:
+SYSCALL(mguard)
+    147b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1480:	cd 40                	int    $0x40
+    1482:	c3                   	ret
+
+00001483 <join_any>:
+SYSCALL(join_any)
+    1483:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1488:	cd 40                	int    $0x40
+    148a:	c3                   	ret
+    148b:	66 90                	xchg   %ax,%ax
+    148d:	66 90                	xchg   %ax,%ax
+    148f:	90                   	nop
+
+00001490 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1490:	55                   	push   %ebp
+    1491:	89 e5                	mov    %esp,%ebp
+    1493:	57                   	push   %edi
+    1494:	56                   	push   %esi
+    1495:	53                   	push   %ebx
+    1496:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1498:	89 d1                	mov    %edx,%ecx
+{
+    149a:	83 ec 3c             	sub    $0x3c,%esp
+    149d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    14a0:	85 d2                	test   %edx,%edx
+    14a2:	0f 89 80 00 00 00    	jns    1528 <printint+0x98>
+    14a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    14ac:	74 7a                	je     1528 <printint+0x98>
+    x = -xx;
+    14ae:	f7 d9                	neg    %ecx
+    neg = 1;
+    14b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    14b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    14b8:	31 f6                	xor    %esi,%esi
+    14ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    14c0:	89 c8                	mov    %ecx,%eax
+    14c2:	31 d2                	xor    %edx,%edx
+    14c4:	89 f7                	mov    %esi,%edi
+    14c6:	f7 f3                	div    %ebx
+    14c8:	8d 76 01             	lea    0x1(%esi),%esi
+    14cb:	0f b6 92 d0 18 00 00 	movzbl 0x18d0(%edx),%edx
+    14d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    14d6:	89 ca                	mov    %ecx,%edx
+    14d8:	89 c1                	mov    %eax,%ecx
+    14da:	39 da                	cmp    %ebx,%edx
+    14dc:	73 e2                	jae    14c0 <printint+0x30>
+  if(neg)
+    14de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    14e1:	85 c0                	test   %eax,%eax
+    14e3:	74 07                	je     14ec <printint+0x5c>
+    buf[i++] = '-';
+    14e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    14ea:	89 f7                	mov    %esi,%edi
+    14ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    14ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    14f2:	01 df                	add    %ebx,%edi
+    14f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    14f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    14fb:	83 ec 04             	sub    $0x4,%esp
+    14fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1501:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1504:	6a 01                	push   $0x1
+    1506:	50                   	push   %eax
+    1507:	56                   	push   %esi
+    1508:	e8 56 fe ff ff       	call   1363 <write>
+  while(--i >= 0)
+    150d:	89 f8                	mov    %edi,%eax
+    150f:	83 c4 10             	add    $0x10,%esp
+    1512:	83 ef 01             	sub    $0x1,%edi
+    1515:	39 d8                	cmp    %ebx,%eax
+    1517:	75 df                	jne    14f8 <printint+0x68>
+}
+    1519:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    151c:	5b                   	pop    %ebx
+    151d:	5e                   	pop    %esi
+    151e:	5f                   	pop    %edi
+    151f:	5d                   	pop    %ebp
+    1520:	c3                   	ret
+    1521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1528:	31 c0                	xor    %eax,%eax
+    152a:	eb 89                	jmp    14b5 <printint+0x25>
+    152c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001530 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1530:	55                   	push   %ebp
+    1531:	89 e5                	mov    %esp,%ebp
+    1533:	57                   	push   %edi
+    1534:	56                   	push   %esi
+    1535:	53                   	push   %ebx
+    1536:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1539:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    153c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    153f:	0f b6 1e             	movzbl (%esi),%ebx
+    1542:	83 c6 01             	add    $0x1,%esi
+    1545:	84 db                	test   %bl,%bl
+    1547:	74 67                	je     15b0 <printf+0x80>
+    1549:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    154c:	31 d2                	xor    %edx,%edx
+    154e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1551:	eb 34                	jmp    1587 <printf+0x57>
+    1553:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1557:	90                   	nop
+    1558:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    155b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1560:	83 f8 25             	cmp    $0x25,%eax
+    1563:	74 18                	je     157d <printf+0x4d>
+  write(fd, &c, 1);
+    1565:	83 ec 04             	sub    $0x4,%esp
+    1568:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    156b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    156e:	6a 01                	push   $0x1
+    1570:	50                   	push   %eax
+    1571:	57                   	push   %edi
+    1572:	e8 ec fd ff ff       	call   1363 <write>
+    1577:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    157a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    157d:	0f b6 1e             	movzbl (%esi),%ebx
+    1580:	83 c6 01             	add    $0x1,%esi
+    1583:	84 db                	test   %bl,%bl
+    1585:	74 29                	je     15b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1587:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    158a:	85 d2                	test   %edx,%edx
+    158c:	74 ca                	je     1558 <printf+0x28>
+      }
+    } else if(state == '%'){
+    158e:	83 fa 25             	cmp    $0x25,%edx
+    1591:	75 ea                	jne    157d <printf+0x4d>
+      if(c == 'd'){
+    1593:	83 f8 25             	cmp    $0x25,%eax
+    1596:	0f 84 24 01 00 00    	je     16c0 <printf+0x190>
+    159c:	83 e8 63             	sub    $0x63,%eax
+    159f:	83 f8 15             	cmp    $0x15,%eax
+    15a2:	77 1c                	ja     15c0 <printf+0x90>
+    15a4:	ff 24 85 78 18 00 00 	jmp    *0x1878(,%eax,4)
+    15ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    15b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15b3:	5b                   	pop    %ebx
+    15b4:	5e                   	pop    %esi
+    15b5:	5f                   	pop    %edi
+    15b6:	5d                   	pop    %ebp
+    15b7:	c3                   	ret
+    15b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15bf:	90                   	nop
+  write(fd, &c, 1);
+    15c0:	83 ec 04             	sub    $0x4,%esp
+    15c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    15c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    15ca:	6a 01                	push   $0x1
+    15cc:	52                   	push   %edx
+    15cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    15d0:	57                   	push   %edi
+    15d1:	e8 8d fd ff ff       	call   1363 <write>
+    15d6:	83 c4 0c             	add    $0xc,%esp
+    15d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    15dc:	6a 01                	push   $0x1
+    15de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    15e1:	52                   	push   %edx
+    15e2:	57                   	push   %edi
+    15e3:	e8 7b fd ff ff       	call   1363 <write>
+        putc(fd, c);
+    15e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    15eb:	31 d2                	xor    %edx,%edx
+    15ed:	eb 8e                	jmp    157d <printf+0x4d>
+    15ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    15f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    15f3:	83 ec 0c             	sub    $0xc,%esp
+    15f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    15fb:	8b 13                	mov    (%ebx),%edx
+    15fd:	6a 00                	push   $0x0
+    15ff:	89 f8                	mov    %edi,%eax
+        ap++;
+    1601:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1604:	e8 87 fe ff ff       	call   1490 <printint>
+        ap++;
+    1609:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    160c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    160f:	31 d2                	xor    %edx,%edx
+    1611:	e9 67 ff ff ff       	jmp    157d <printf+0x4d>
+    1616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    161d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1620:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1623:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1625:	83 c0 04             	add    $0x4,%eax
+    1628:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    162b:	85 db                	test   %ebx,%ebx
+    162d:	0f 84 9d 00 00 00    	je     16d0 <printf+0x1a0>
+        while(*s != 0){
+    1633:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1636:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1638:	84 c0                	test   %al,%al
+    163a:	0f 84 3d ff ff ff    	je     157d <printf+0x4d>
+    1640:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1643:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1646:	89 de                	mov    %ebx,%esi
+    1648:	89 d3                	mov    %edx,%ebx
+    164a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1650:	83 ec 04             	sub    $0x4,%esp
+    1653:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1656:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1659:	6a 01                	push   $0x1
+    165b:	53                   	push   %ebx
+    165c:	57                   	push   %edi
+    165d:	e8 01 fd ff ff       	call   1363 <write>
+        while(*s != 0){
+    1662:	0f b6 06             	movzbl (%esi),%eax
+    1665:	83 c4 10             	add    $0x10,%esp
+    1668:	84 c0                	test   %al,%al
+    166a:	75 e4                	jne    1650 <printf+0x120>
+      state = 0;
+    166c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    166f:	31 d2                	xor    %edx,%edx
+    1671:	e9 07 ff ff ff       	jmp    157d <printf+0x4d>
+    1676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    167d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1680:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1683:	83 ec 0c             	sub    $0xc,%esp
+    1686:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    168b:	8b 13                	mov    (%ebx),%edx
+    168d:	6a 01                	push   $0x1
+    168f:	e9 6b ff ff ff       	jmp    15ff <printf+0xcf>
+    1694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1698:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    169b:	83 ec 04             	sub    $0x4,%esp
+    169e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    16a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    16a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    16a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    16a9:	6a 01                	push   $0x1
+    16ab:	52                   	push   %edx
+    16ac:	57                   	push   %edi
+    16ad:	e8 b1 fc ff ff       	call   1363 <write>
+        ap++;
+    16b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    16b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    16b8:	31 d2                	xor    %edx,%edx
+    16ba:	e9 be fe ff ff       	jmp    157d <printf+0x4d>
+    16bf:	90                   	nop
+  write(fd, &c, 1);
+    16c0:	83 ec 04             	sub    $0x4,%esp
+    16c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    16c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    16c9:	6a 01                	push   $0x1
+    16cb:	e9 11 ff ff ff       	jmp    15e1 <printf+0xb1>
+    16d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    16d5:	bb 6f 18 00 00       	mov    $0x186f,%ebx
+    16da:	e9 61 ff ff ff       	jmp    1640 <printf+0x110>
+    16df:	90                   	nop
+
+000016e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    16e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16e1:	a1 78 1b 00 00       	mov    0x1b78,%eax
+{
+    16e6:	89 e5                	mov    %esp,%ebp
+    16e8:	57                   	push   %edi
+    16e9:	56                   	push   %esi
+    16ea:	53                   	push   %ebx
+    16eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    16ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16fc:	39 ca                	cmp    %ecx,%edx
+    16fe:	73 30                	jae    1730 <free+0x50>
+    1700:	39 c1                	cmp    %eax,%ecx
+    1702:	72 04                	jb     1708 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1704:	39 c2                	cmp    %eax,%edx
+    1706:	72 f0                	jb     16f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1708:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    170b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    170e:	39 f8                	cmp    %edi,%eax
+    1710:	74 2e                	je     1740 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1712:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1715:	8b 42 04             	mov    0x4(%edx),%eax
+    1718:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    171b:	39 f1                	cmp    %esi,%ecx
+    171d:	74 38                	je     1757 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    171f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1721:	5b                   	pop    %ebx
+  freep = p;
+    1722:	89 15 78 1b 00 00    	mov    %edx,0x1b78
+}
+    1728:	5e                   	pop    %esi
+    1729:	5f                   	pop    %edi
+    172a:	5d                   	pop    %ebp
+    172b:	c3                   	ret
+    172c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1730:	39 c1                	cmp    %eax,%ecx
+    1732:	72 d0                	jb     1704 <free+0x24>
+    1734:	eb c2                	jmp    16f8 <free+0x18>
+    1736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    173d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1740:	03 70 04             	add    0x4(%eax),%esi
+    1743:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1746:	8b 02                	mov    (%edx),%eax
+    1748:	8b 00                	mov    (%eax),%eax
+    174a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    174d:	8b 42 04             	mov    0x4(%edx),%eax
+    1750:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1753:	39 f1                	cmp    %esi,%ecx
+    1755:	75 c8                	jne    171f <free+0x3f>
+    p->s.size += bp->s.size;
+    1757:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    175a:	89 15 78 1b 00 00    	mov    %edx,0x1b78
+    p->s.size += bp->s.size;
+    1760:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1763:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1766:	89 0a                	mov    %ecx,(%edx)
+}
+    1768:	5b                   	pop    %ebx
+    1769:	5e                   	pop    %esi
+    176a:	5f                   	pop    %edi
+    176b:	5d                   	pop    %ebp
+    176c:	c3                   	ret
+    176d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001770 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1770:	55                   	push   %ebp
+    1771:	89 e5                	mov    %esp,%ebp
+    1773:	57                   	push   %edi
+    1774:	56                   	push   %esi
+    1775:	53                   	push   %ebx
+    1776:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1779:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    177c:	8b 15 78 1b 00 00    	mov    0x1b78,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1782:	8d 78 07             	lea    0x7(%eax),%edi
+    1785:	c1 ef 03             	shr    $0x3,%edi
+    1788:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    178b:	85 d2                	test   %edx,%edx
+    178d:	0f 84 8d 00 00 00    	je     1820 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1793:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1795:	8b 48 04             	mov    0x4(%eax),%ecx
+    1798:	39 f9                	cmp    %edi,%ecx
+    179a:	73 64                	jae    1800 <malloc+0x90>
+  if(nu < 4096)
+    179c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    17a1:	39 df                	cmp    %ebx,%edi
+    17a3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    17a6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    17ad:	eb 0a                	jmp    17b9 <malloc+0x49>
+    17af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17b0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    17b2:	8b 48 04             	mov    0x4(%eax),%ecx
+    17b5:	39 f9                	cmp    %edi,%ecx
+    17b7:	73 47                	jae    1800 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    17b9:	89 c2                	mov    %eax,%edx
+    17bb:	39 05 78 1b 00 00    	cmp    %eax,0x1b78
+    17c1:	75 ed                	jne    17b0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    17c3:	83 ec 0c             	sub    $0xc,%esp
+    17c6:	56                   	push   %esi
+    17c7:	e8 ff fb ff ff       	call   13cb <sbrk>
+  if(p == (char*)-1)
+    17cc:	83 c4 10             	add    $0x10,%esp
+    17cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17d2:	74 1c                	je     17f0 <malloc+0x80>
+  hp->s.size = nu;
+    17d4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    17d7:	83 ec 0c             	sub    $0xc,%esp
+    17da:	83 c0 08             	add    $0x8,%eax
+    17dd:	50                   	push   %eax
+    17de:	e8 fd fe ff ff       	call   16e0 <free>
+  return freep;
+    17e3:	8b 15 78 1b 00 00    	mov    0x1b78,%edx
+      if((p = morecore(nunits)) == 0)
+    17e9:	83 c4 10             	add    $0x10,%esp
+    17ec:	85 d2                	test   %edx,%edx
+    17ee:	75 c0                	jne    17b0 <malloc+0x40>
+        return 0;
+  }
+}
+    17f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    17f3:	31 c0                	xor    %eax,%eax
+}
+    17f5:	5b                   	pop    %ebx
+    17f6:	5e                   	pop    %esi
+    17f7:	5f                   	pop    %edi
+    17f8:	5d                   	pop    %ebp
+    17f9:	c3                   	ret
+    17fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1800:	39 cf                	cmp    %ecx,%edi
+    1802:	74 4c                	je     1850 <malloc+0xe0>
+        p->s.size -= nunits;
+    1804:	29 f9                	sub    %edi,%ecx
+    1806:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1809:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    180c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    180f:	89 15 78 1b 00 00    	mov    %edx,0x1b78
+}
+    1815:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1818:	83 c0 08             	add    $0x8,%eax
+}
+    181b:	5b                   	pop    %ebx
+    181c:	5e                   	pop    %esi
+    181d:	5f                   	pop    %edi
+    181e:	5d                   	pop    %ebp
+    181f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1820:	c7 05 78 1b 00 00 7c 	movl   $0x1b7c,0x1b78
+    1827:	1b 00 00 
+    base.s.size = 0;
+    182a:	b8 7c 1b 00 00       	mov    $0x1b7c,%eax
+    base.s.ptr = freep = prevp = &base;
+    182f:	c7 05 7c 1b 00 00 7c 	movl   $0x1b7c,0x1b7c
+    1836:	1b 00 00 
+    base.s.size = 0;
+    1839:	c7 05 80 1b 00 00 00 	movl   $0x0,0x1b80
+    1840:	00 00 00 
+    if(p->s.size >= nunits){
+    1843:	e9 54 ff ff ff       	jmp    179c <malloc+0x2c>
+    1848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    184f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1850:	8b 08                	mov    (%eax),%ecx
+    1852:	89 0a                	mov    %ecx,(%edx)
+    1854:	eb b9                	jmp    180f <malloc+0x9f>
@@ -16,19 +16,24 @@ main(int argc, char *argv[])
 	{
 		int child_pid = getpid();
 		struct pstat st;
-		getpinfo(&st);
 
 		int parent_tickets = -1, child_tickets = -1;
         
         	int i;
-		for (i = 0; i < sizeof(st.pid)/sizeof(st.pid[0]); i++)
-		{
-			if(st.pid[i] ==parent_pid)
-				parent_tickets=st.tickets[i];
+		st.next = 0;
+		do {
+			getpinfo(&st);
+			for (i = 0; i < sizeof(st.pid)/sizeof(st.pid[0]); i++)
+			{
+				if(!st.inuse[i])
+					continue;
+				if(st.pid[i] ==parent_pid)
+					parent_tickets=st.tickets[i];
 			
-			else if(st.pid[i] ==child_pid)
-				child_tickets=st.tickets[i];
-		}
+				else if(st.pid[i] ==child_pid)
+					child_tickets=st.tickets[i];
+			}
+		} while(st.next);
 		
 		printf(1, "parent: %d, child: %d\n", parent_tickets, child_tickets);
     		
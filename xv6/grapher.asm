@@ -0,0 +1,1400 @@
+
+_grapher:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#include "fcntl.h"
+#include "sched.h"
+
+
+int
+main(int argc, char *argv[]){
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	51                   	push   %ecx
+    1011:	81 ec 38 0b 00 00    	sub    $0xb38,%esp
+ 	int numtickets[]={10,20,30};
+	int child_pid[3];
+
+	if(argc > 1 && strcmp(argv[1], "stride") == 0)
+    1017:	83 39 01             	cmpl   $0x1,(%ecx)
+main(int argc, char *argv[]){
+    101a:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 	int numtickets[]={10,20,30};
+    101d:	c7 85 cc f4 ff ff 0a 	movl   $0xa,-0xb34(%ebp)
+    1024:	00 00 00 
+    1027:	c7 85 d0 f4 ff ff 14 	movl   $0x14,-0xb30(%ebp)
+    102e:	00 00 00 
+    1031:	c7 85 d4 f4 ff ff 1e 	movl   $0x1e,-0xb2c(%ebp)
+    1038:	00 00 00 
+	if(argc > 1 && strcmp(argv[1], "stride") == 0)
+    103b:	7e 3f                	jle    107c <main+0x7c>
+    103d:	56                   	push   %esi
+    103e:	56                   	push   %esi
+    103f:	68 38 19 00 00       	push   $0x1938
+    1044:	ff 73 04             	push   0x4(%ebx)
+    1047:	e8 c4 01 00 00       	call   1210 <strcmp>
+    104c:	83 c4 10             	add    $0x10,%esp
+    104f:	85 c0                	test   %eax,%eax
+    1051:	75 0f                	jne    1062 <main+0x62>
+		setsched(SCHED_STRIDE);
+    1053:	83 ec 0c             	sub    $0xc,%esp
+    1056:	6a 01                	push   $0x1
+    1058:	e8 ae 04 00 00       	call   150b <setsched>
+    105d:	83 c4 10             	add    $0x10,%esp
+    1060:	eb 27                	jmp    1089 <main+0x89>
+	else if(argc > 1 && strcmp(argv[1], "mlfq") == 0)
+    1062:	51                   	push   %ecx
+    1063:	51                   	push   %ecx
+    1064:	68 3f 19 00 00       	push   $0x193f
+    1069:	ff 73 04             	push   0x4(%ebx)
+    106c:	e8 9f 01 00 00       	call   1210 <strcmp>
+    1071:	83 c4 10             	add    $0x10,%esp
+    1074:	85 c0                	test   %eax,%eax
+    1076:	0f 84 48 01 00 00    	je     11c4 <main+0x1c4>
+		setsched(SCHED_MLFQ);
+	else
+		setsched(SCHED_LOTTERY);
+    107c:	83 ec 0c             	sub    $0xc,%esp
+    107f:	6a 00                	push   $0x0
+    1081:	e8 85 04 00 00       	call   150b <setsched>
+    1086:	83 c4 10             	add    $0x10,%esp
+
+	settickets(10);//change intial value of parent
+    1089:	83 ec 0c             	sub    $0xc,%esp
+	
+	int i;
+	for(i=0;i<3;i++){
+    108c:	31 db                	xor    %ebx,%ebx
+	settickets(10);//change intial value of parent
+    108e:	6a 0a                	push   $0xa
+    1090:	e8 2e 04 00 00       	call   14c3 <settickets>
+    1095:	83 c4 10             	add    $0x10,%esp
+		child_pid[i]=fork();
+    1098:	e8 7e 03 00 00       	call   141b <fork>
+    109d:	89 84 9d d8 f4 ff ff 	mov    %eax,-0xb28(%ebp,%ebx,4)
+
+		if(child_pid[i]==0){
+    10a4:	85 c0                	test   %eax,%eax
+    10a6:	0f 84 04 01 00 00    	je     11b0 <main+0x1b0>
+	for(i=0;i<3;i++){
+    10ac:	83 c3 01             	add    $0x1,%ebx
+    10af:	83 fb 03             	cmp    $0x3,%ebx
+    10b2:	75 e4                	jne    1098 <main+0x98>
+	}
+    
+	struct pstat st;
+	int time=50;
+
+	printf(1,"\nProcess A (%d tickets)\tProcess B (%d tickets)\tProcess C (%d tickets)\n",numtickets[0],numtickets[1],numtickets[2]);
+    10b4:	83 ec 0c             	sub    $0xc,%esp
+    10b7:	8d 9d e4 f4 ff ff    	lea    -0xb1c(%ebp),%ebx
+    10bd:	8d b5 e4 f5 ff ff    	lea    -0xa1c(%ebp),%esi
+    10c3:	6a 1e                	push   $0x1e
+    10c5:	89 df                	mov    %ebx,%edi
+    10c7:	6a 14                	push   $0x14
+    10c9:	6a 0a                	push   $0xa
+    10cb:	68 4c 19 00 00       	push   $0x194c
+    10d0:	6a 01                	push   $0x1
+    10d2:	e8 39 05 00 00       	call   1610 <printf>
+    10d7:	83 c4 20             	add    $0x20,%esp
+    10da:	c7 85 c0 f4 ff ff 32 	movl   $0x32,-0xb40(%ebp)
+    10e1:	00 00 00 
+	
+	while(time--){
+		st.next = 0;
+    10e4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    10eb:	89 fa                	mov    %edi,%edx
+		do {
+			getpinfo(&st);
+    10ed:	83 ec 0c             	sub    $0xc,%esp
+    10f0:	8d bd d8 f4 ff ff    	lea    -0xb28(%ebp),%edi
+    10f6:	52                   	push   %edx
+    10f7:	e8 cf 03 00 00       	call   14cb <getpinfo>
+		
+			for(i=0;i<3;i++){
+    10fc:	8d 95 e4 f4 ff ff    	lea    -0xb1c(%ebp),%edx
+    1102:	83 c4 10             	add    $0x10,%esp
+    1105:	89 95 c4 f4 ff ff    	mov    %edx,-0xb3c(%ebp)
+				for (int j = 0; j < sizeof(st.pid)/sizeof(st.pid[0]); j++)
+    110b:	8d 9d e4 f4 ff ff    	lea    -0xb1c(%ebp),%ebx
+    1111:	eb 0c                	jmp    111f <main+0x11f>
+    1113:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1117:	90                   	nop
+    1118:	83 c3 04             	add    $0x4,%ebx
+    111b:	39 f3                	cmp    %esi,%ebx
+    111d:	74 41                	je     1160 <main+0x160>
+				{
+					// CPU time used, in 2^20s of TSC cycles
+					if(st.inuse[j] && st.pid[j] ==child_pid[i])
+    111f:	8b 13                	mov    (%ebx),%edx
+    1121:	85 d2                	test   %edx,%edx
+    1123:	74 f3                	je     1118 <main+0x118>
+    1125:	8b 07                	mov    (%edi),%eax
+    1127:	39 83 00 02 00 00    	cmp    %eax,0x200(%ebx)
+    112d:	75 e9                	jne    1118 <main+0x118>
+						printf(1, "%d\t",(st.utime[j]+st.stime[j])>>10);
+    112f:	8b 83 00 0a 00 00    	mov    0xa00(%ebx),%eax
+    1135:	03 83 00 09 00 00    	add    0x900(%ebx),%eax
+    113b:	83 ec 04             	sub    $0x4,%esp
+				for (int j = 0; j < sizeof(st.pid)/sizeof(st.pid[0]); j++)
+    113e:	83 c3 04             	add    $0x4,%ebx
+						printf(1, "%d\t",(st.utime[j]+st.stime[j])>>10);
+    1141:	c1 e8 0a             	shr    $0xa,%eax
+    1144:	50                   	push   %eax
+    1145:	68 44 19 00 00       	push   $0x1944
+    114a:	6a 01                	push   $0x1
+    114c:	e8 bf 04 00 00       	call   1610 <printf>
+    1151:	83 c4 10             	add    $0x10,%esp
+				for (int j = 0; j < sizeof(st.pid)/sizeof(st.pid[0]); j++)
+    1154:	39 f3                	cmp    %esi,%ebx
+    1156:	75 c7                	jne    111f <main+0x11f>
+    1158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115f:	90                   	nop
+			for(i=0;i<3;i++){
+    1160:	83 c7 04             	add    $0x4,%edi
+    1163:	8d 85 e4 f4 ff ff    	lea    -0xb1c(%ebp),%eax
+    1169:	39 c7                	cmp    %eax,%edi
+    116b:	75 9e                	jne    110b <main+0x10b>
+				}
+			}
+		} while(st.next);
+    116d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1170:	8b 95 c4 f4 ff ff    	mov    -0xb3c(%ebp),%edx
+    1176:	85 c0                	test   %eax,%eax
+    1178:	0f 85 6f ff ff ff    	jne    10ed <main+0xed>
+		printf(1,"\n");
+    117e:	83 ec 08             	sub    $0x8,%esp
+    1181:	89 d7                	mov    %edx,%edi
+    1183:	68 48 19 00 00       	push   $0x1948
+    1188:	6a 01                	push   $0x1
+    118a:	e8 81 04 00 00       	call   1610 <printf>
+		sleep(200);
+    118f:	c7 04 24 c8 00 00 00 	movl   $0xc8,(%esp)
+    1196:	e8 18 03 00 00       	call   14b3 <sleep>
+	while(time--){
+    119b:	83 c4 10             	add    $0x10,%esp
+    119e:	83 ad c0 f4 ff ff 01 	subl   $0x1,-0xb40(%ebp)
+    11a5:	0f 85 39 ff ff ff    	jne    10e4 <main+0xe4>
+    }
+
+	exit();
+    11ab:	e8 73 02 00 00       	call   1423 <exit>
+			settickets(numtickets[i]);
+    11b0:	83 ec 0c             	sub    $0xc,%esp
+    11b3:	ff b4 9d cc f4 ff ff 	push   -0xb34(%ebp,%ebx,4)
+    11ba:	e8 04 03 00 00       	call   14c3 <settickets>
+    11bf:	83 c4 10             	add    $0x10,%esp
+			for (;;);
+    11c2:	eb fe                	jmp    11c2 <main+0x1c2>
+		setsched(SCHED_MLFQ);
+    11c4:	83 ec 0c             	sub    $0xc,%esp
+    11c7:	6a 02                	push   $0x2
+    11c9:	e8 3d 03 00 00       	call   150b <setsched>
+    11ce:	83 c4 10             	add    $0x10,%esp
+    11d1:	e9 b3 fe ff ff       	jmp    1089 <main+0x89>
+    11d6:	66 90                	xchg   %ax,%ax
+    11d8:	66 90                	xchg   %ax,%ax
+    11da:	66 90                	xchg   %ax,%ax
+    11dc:	66 90                	xchg   %ax,%ax
+    11de:	66 90                	xchg   %ax,%ax
+
+000011e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    11e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    11e1:	31 c0                	xor    %eax,%eax
+{
+    11e3:	89 e5                	mov    %esp,%ebp
+    11e5:	53                   	push   %ebx
+    11e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    11e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    11ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    11f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    11f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    11f7:	83 c0 01             	add    $0x1,%eax
+    11fa:	84 d2                	test   %dl,%dl
+    11fc:	75 f2                	jne    11f0 <strcpy+0x10>
+    ;
+  return os;
+}
+    11fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1201:	89 c8                	mov    %ecx,%eax
+    1203:	c9                   	leave
+    1204:	c3                   	ret
+    1205:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001210 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1210:	55                   	push   %ebp
+    1211:	89 e5                	mov    %esp,%ebp
+    1213:	53                   	push   %ebx
+    1214:	8b 55 08             	mov    0x8(%ebp),%edx
+    1217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    121a:	0f b6 02             	movzbl (%edx),%eax
+    121d:	84 c0                	test   %al,%al
+    121f:	75 17                	jne    1238 <strcmp+0x28>
+    1221:	eb 3a                	jmp    125d <strcmp+0x4d>
+    1223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1227:	90                   	nop
+    1228:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    122c:	83 c2 01             	add    $0x1,%edx
+    122f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1232:	84 c0                	test   %al,%al
+    1234:	74 1a                	je     1250 <strcmp+0x40>
+    p++, q++;
+    1236:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1238:	0f b6 19             	movzbl (%ecx),%ebx
+    123b:	38 c3                	cmp    %al,%bl
+    123d:	74 e9                	je     1228 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    123f:	29 d8                	sub    %ebx,%eax
+}
+    1241:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1244:	c9                   	leave
+    1245:	c3                   	ret
+    1246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    124d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1250:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1254:	31 c0                	xor    %eax,%eax
+    1256:	29 d8                	sub    %ebx,%eax
+}
+    1258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    125b:	c9                   	leave
+    125c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    125d:	0f b6 19             	movzbl (%ecx),%ebx
+    1260:	31 c0                	xor    %eax,%eax
+    1262:	eb db                	jmp    123f <strcmp+0x2f>
+    1264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    126b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    126f:	90                   	nop
+
+00001270 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1276:	80 3a 00             	cmpb   $0x0,(%edx)
+    1279:	74 15                	je     1290 <strlen+0x20>
+    127b:	31 c0                	xor    %eax,%eax
+    127d:	8d 76 00             	lea    0x0(%esi),%esi
+    1280:	83 c0 01             	add    $0x1,%eax
+    1283:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1287:	89 c1                	mov    %eax,%ecx
+    1289:	75 f5                	jne    1280 <strlen+0x10>
+    ;
+  return n;
+}
+    128b:	89 c8                	mov    %ecx,%eax
+    128d:	5d                   	pop    %ebp
+    128e:	c3                   	ret
+    128f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1290:	31 c9                	xor    %ecx,%ecx
+}
+    1292:	5d                   	pop    %ebp
+    1293:	89 c8                	mov    %ecx,%eax
+    1295:	c3                   	ret
+    1296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    12a0:	55                   	push   %ebp
+    12a1:	89 e5                	mov    %esp,%ebp
+    12a3:	57                   	push   %edi
+    12a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    12a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    12aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12ad:	89 d7                	mov    %edx,%edi
+    12af:	fc                   	cld
+    12b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    12b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    12b5:	89 d0                	mov    %edx,%eax
+    12b7:	c9                   	leave
+    12b8:	c3                   	ret
+    12b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000012c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	8b 45 08             	mov    0x8(%ebp),%eax
+    12c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    12ca:	0f b6 10             	movzbl (%eax),%edx
+    12cd:	84 d2                	test   %dl,%dl
+    12cf:	75 12                	jne    12e3 <strchr+0x23>
+    12d1:	eb 1d                	jmp    12f0 <strchr+0x30>
+    12d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12d7:	90                   	nop
+    12d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    12dc:	83 c0 01             	add    $0x1,%eax
+    12df:	84 d2                	test   %dl,%dl
+    12e1:	74 0d                	je     12f0 <strchr+0x30>
+    if(*s == c)
+    12e3:	38 d1                	cmp    %dl,%cl
+    12e5:	75 f1                	jne    12d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    12e7:	5d                   	pop    %ebp
+    12e8:	c3                   	ret
+    12e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    12f0:	31 c0                	xor    %eax,%eax
+}
+    12f2:	5d                   	pop    %ebp
+    12f3:	c3                   	ret
+    12f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12ff:	90                   	nop
+
+00001300 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	57                   	push   %edi
+    1304:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1305:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1308:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1309:	31 db                	xor    %ebx,%ebx
+{
+    130b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    130e:	eb 27                	jmp    1337 <gets+0x37>
+    cc = read(0, &c, 1);
+    1310:	83 ec 04             	sub    $0x4,%esp
+    1313:	6a 01                	push   $0x1
+    1315:	56                   	push   %esi
+    1316:	6a 00                	push   $0x0
+    1318:	e8 1e 01 00 00       	call   143b <read>
+    if(cc < 1)
+    131d:	83 c4 10             	add    $0x10,%esp
+    1320:	85 c0                	test   %eax,%eax
+    1322:	7e 1d                	jle    1341 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1324:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1328:	8b 55 08             	mov    0x8(%ebp),%edx
+    132b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    132f:	3c 0a                	cmp    $0xa,%al
+    1331:	74 10                	je     1343 <gets+0x43>
+    1333:	3c 0d                	cmp    $0xd,%al
+    1335:	74 0c                	je     1343 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1337:	89 df                	mov    %ebx,%edi
+    1339:	83 c3 01             	add    $0x1,%ebx
+    133c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    133f:	7c cf                	jl     1310 <gets+0x10>
+    1341:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1343:	8b 45 08             	mov    0x8(%ebp),%eax
+    1346:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    134a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    134d:	5b                   	pop    %ebx
+    134e:	5e                   	pop    %esi
+    134f:	5f                   	pop    %edi
+    1350:	5d                   	pop    %ebp
+    1351:	c3                   	ret
+    1352:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001360 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1360:	55                   	push   %ebp
+    1361:	89 e5                	mov    %esp,%ebp
+    1363:	56                   	push   %esi
+    1364:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1365:	83 ec 08             	sub    $0x8,%esp
+    1368:	6a 00                	push   $0x0
+    136a:	ff 75 08             	push   0x8(%ebp)
+    136d:	e8 f1 00 00 00       	call   1463 <open>
+  if(fd < 0)
+    1372:	83 c4 10             	add    $0x10,%esp
+    1375:	85 c0                	test   %eax,%eax
+    1377:	78 27                	js     13a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1379:	83 ec 08             	sub    $0x8,%esp
+    137c:	ff 75 0c             	push   0xc(%ebp)
+    137f:	89 c3                	mov    %eax,%ebx
+    1381:	50                   	push   %eax
+    1382:	e8 f4 00 00 00       	call   147b <fstat>
+  close(fd);
+    1387:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    138a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    138c:	e8 ba 00 00 00       	call   144b <close>
+  return r;
+    1391:	83 c4 10             	add    $0x10,%esp
+}
+    1394:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1397:	89 f0                	mov    %esi,%eax
+    1399:	5b                   	pop    %ebx
+    139a:	5e                   	pop    %esi
+    139b:	5d                   	pop    %ebp
+    139c:	c3                   	ret
+    139d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    13a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    13a5:	eb ed                	jmp    1394 <stat+0x34>
+    13a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ae:	66 90                	xchg   %ax,%ax
+
+000013b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    13b0:	55                   	push   %ebp
+    13b1:	89 e5                	mov    %esp,%ebp
+    13b3:	53                   	push   %ebx
+    13b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    13b7:	0f be 02             	movsbl (%edx),%eax
+    13ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    13bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    13c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    13c5:	77 1e                	ja     13e5 <atoi+0x35>
+    13c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    13d0:	83 c2 01             	add    $0x1,%edx
+    13d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    13d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    13da:	0f be 02             	movsbl (%edx),%eax
+    13dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    13e0:	80 fb 09             	cmp    $0x9,%bl
+    13e3:	76 eb                	jbe    13d0 <atoi+0x20>
+  return n;
+}
+    13e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13e8:	89 c8                	mov    %ecx,%eax
+    13ea:	c9                   	leave
+    13eb:	c3                   	ret
+    13ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000013f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    13f0:	55                   	push   %ebp
+    13f1:	89 e5                	mov    %esp,%ebp
+    13f3:	57                   	push   %edi
+    13f4:	56                   	push   %esi
+    13f5:	8b 45 10             	mov    0x10(%ebp),%eax
+    13f8:	8b 55 08             	mov    0x8(%ebp),%edx
+    13fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    13fe:	85 c0                	test   %eax,%eax
+    1400:	7e 13                	jle    1415 <memmove+0x25>
+    1402:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1404:	89 d7                	mov    %edx,%edi
+    1406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    140d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1410:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1411:	39 f8                	cmp    %edi,%eax
+    1413:	75 fb                	jne    1410 <memmove+0x20>
+  return vdst;
+}
+    1415:	5e                   	pop    %esi
+    1416:	89 d0                	mov    %edx,%eax
+    1418:	5f                   	pop    %edi
+    1419:	5d                   	pop    %ebp
+    141a:	c3                   	ret
+
+0000141b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    141b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1420:	cd 40                	int    $0x40
+    1422:	c3                   	ret
+
+00001423 <exit>:
+SYSCALL(exit)
+    1423:	b8 02 00 00 00       	mov    $0x2,%eax
+    1428:	cd 40                	int    $0x40
+    142a:	c3                   	ret
+
+0000142b <wait>:
+SYSCALL(wait)
+    142b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1430:	cd 40                	int    $0x40
+    1432:	c3                   	ret
+
+00001433 <pipe>:
+SYSCALL(pipe)
+    1433:	b8 04 00 00 00       	mov    $0x4,%eax
+    1438:	cd 40                	int    $0x40
+    143a:	c3                   	ret
+
+0000143b <read>:
+SYSCALL(read)
+    143b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1440:	cd 40                	int    $0x40
+    1442:	c3                   	ret
+
+00001443 <write>:
+SYSCALL(write)
+    1443:	b8 10 00 00 00       	mov    $0x10,%eax
+    1448:	cd 40                	int    $0x40
+    144a:	c3                   	ret
+
+0000144b <close>:
+SYSCALL(close)
+    144b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1450:	cd 40                	int    $0x40
+    1452:	c3                   	ret
+
+00001453 <kill>:
+SYSCALL(kill)
+    1453:	b8 06 00 00 00       	mov    $0x6,%eax
+    1458:	cd 40                	int    $0x40
+    145a:	c3                   	ret
+
+0000145b <exec>:
+SYSCALL(exec)
+    145b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1460:	cd 40                	int    $0x40
+    1462:	c3                   	ret
+
+00001463 <open>:
+SYSCALL(open)
+    1463:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1468:	cd 40                	int    $0x40
+    146a:	c3                   	ret
+
+0000146b <mknod>:
+SYSCALL(mknod)
+    146b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1470:	cd 40                	int    $0x40
+    1472:	c3                   	ret
+
+00001473 <unlink>:
+SYSCALL(unlink)
+    1473:	b8 12 00 00 00       	mov    $0x12,%eax
+    1478:	cd 40                	int    $0x40
+    147a:	c3                   	ret
+
+0000147b <fstat>:
+SYSCALL(fstat)
+    147b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1480:	cd 40                	int    $0x40
+    1482:	c3                   	ret
+
+00001483 <link>:
+SYSCALL(link)
+    1483:	b8 13 00 00 00       	mov    $0x13,%eax
+    1488:	cd 40                	int    $0x40
+    148a:	c3                   	ret
+
+0000148b <mkdir>:
+SYSCALL(mkdir)
+    148b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1490:	cd 40                	int    $0x40
+    1492:	c3                   	ret
+
+00001493 <chdir>:
+SYSCALL(chdir)
+    1493:	b8 09 00 00 00       	mov    $0x9,%eax
+    1498:	cd 40                	int    $0x40
+    149a:	c3                   	ret
+
+0000149b <dup>:
+SYSCALL(dup)
+    149b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    14a0:	cd 40                	int    $0x40
+    14a2:	c3                   	ret
+
+000014a3 <getpid>:
+SYSCALL(getpid)
+    14a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    14a8:	cd 40                	int    $0x40
+    14aa:	c3                   	ret
+
+000014ab <sbrk>:
+SYSCALL(sbrk)
+    14ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+    14b0:	cd 40                	int    $0x40
+    14b2:	c3                   	ret
+
+000014b3 <sleep>:
+SYSCALL(sleep)
+    14b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    14b8:	cd 40                	int    $0x40
+    14ba:	c3                   	ret
+
+000014bb <uptime>:
+SYSCALL(uptime)
+    14bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    14c0:	cd 40                	int    $0x40
+    14c2:	c3                   	ret
+
+000014c3 <settickets>:
+SYSCALL(settickets)
+    14c3:	b8 16 00 00 00       	mov    $0x16,%eax
+    14c8:	cd 40                	int    $0x40
+    14ca:	c3                   	ret
+
+000014cb <getpinfo>:
+SYSCALL(getpinfo)
+    14cb:	b8 17 00 00 00       	mov    $0x17,%eax
+    14d0:	cd 40                	int    $0x40
+    14d2:	c3                   	ret
+
+000014d3 <mprotect>:
+SYSCALL(mprotect)
+    14d3:	b8 18 00 00 00       	mov    $0x18,%eax
+    14d8:	cd 40                	int    $0x40
+    14da:	c3                   	ret
+
+000014db <munprotect>:
+SYSCALL(munprotect)
+    14db:	b8 19 00 00 00       	mov    $0x19,%eax
+    14e0:	cd 40                	int    $0x40
+    14e2:	c3                   	ret
+
+000014e3 <clone>:
+SYSCALL(clone)
+    14e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    14e8:	cd 40                	int    $0x40
+    14ea:	c3                   	ret
+
+000014eb <join>:
+SYSCALL(join)
+    14eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    14f0:	cd 40                	int    $0x40
+    14f2:	c3                   	ret
+
+000014f3 <initlock_t>:
+SYSCALL(initlock_t)
+    14f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    14f8:	cd 40                	int    $0x40
+    14fa:	c3                   	ret
+
+000014fb <acquire_t>:
+SYSCALL(acquire_t)
+    14fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1500:	cd 40                	int    $0x40
+    1502:	c3                   	ret
+
+00001503 <release_t>:
+SYSCALL(release_t)
+    1503:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1508:	cd 40                	int    $0x40
+    150a:	c3                   	ret
+
+0000150b <setsched>:
+SYSCALL(setsched)
+    150b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1510:	cd 40                	int    $0x40
+    1512:	c3                   	ret
+
+00001513 <mkgroup>:
+SYSCALL(mkgroup)
+    1513:	b8 20 00 00 00       	mov    $0x20,%eax
+    1518:	cd 40                	int    $0x40
+    151a:	c3                   	ret
+
+0000151b <joingroup>:
+SYSCALL(joingroup)
+    151b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1520:	cd 40                	int    $0x40
+    1522:	c3                   	ret
+
+00001523 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1523:	b8 22 00 00 00       	mov    $0x22,%eax
+    1528:	cd 40                	int    $0x40
+    152a:	c3                   	ret
+
+0000152b <setdeadline>:
+SYSCALL(setdeadline)
+    152b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1530:	cd 40                	int    $0x40
+    1532:	c3                   	ret
+
+00001533 <setaffinity>:
+SYSCALL(setaffinity)
+    1533:	b8 24 00 00 00       	mov    $0x24,%eax
+    1538:	cd 40                	int    $0x40
+    153a:	c3                   	ret
+
+0000153b <yield_to>:
+SYSCALL(yield_to)
+    153b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1540:	cd 40                	int    $0x40
+    1542:	c3                   	ret
+
+00001543 <getlatency>:
+SYSCALL(getlatency)
+    1543:	b8 26 00 00 00       	mov    $0x26,%eax
+    1548:	cd 40                	int    $0x40
+    154a:	c3                   	ret
+
+0000154b <futex_wait>:
+SYSCALL(futex_wait)
+    154b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1550:	cd 40                	int    $0x40
+    1552:	c3                   	ret
+
+00001553 <futex_wake>:
+SYSCALL(futex_wake)
+    1553:	b8 28 00 00 00       	mov    $0x28,%eax
+    1558:	cd 40                	int    $0x40
+    155a:	c3                   	ret
+
+0000155b <mguard>:
+SYSCALL(mguard)
+    155b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1560:	cd 40                	int    $0x40
+    1562:	c3                   	ret
+
+00001563 <join_any>:
+SYSCALL(join_any)
+    1563:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1568:	cd 40                	int    $0x40
+    156a:	c3                   	ret
+    156b:	66 90                	xchg   %ax,%ax
+    156d:	66 90                	xchg   %ax,%ax
+    156f:	90                   	nop
+
+00001570 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1570:	55                   	push   %ebp
+    1571:	89 e5                	mov    %esp,%ebp
+    1573:	57                   	push   %edi
+    1574:	56                   	push   %esi
+    1575:	53                   	push   %ebx
+    1576:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1578:	89 d1                	mov    %edx,%ecx
+{
+    157a:	83 ec 3c             	sub    $0x3c,%esp
+    157d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1580:	85 d2                	test   %edx,%edx
+    1582:	0f 89 80 00 00 00    	jns    1608 <printint+0x98>
+    1588:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    158c:	74 7a                	je     1608 <printint+0x98>
+    x = -xx;
+    158e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1590:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1595:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1598:	31 f6                	xor    %esi,%esi
+    159a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    15a0:	89 c8                	mov    %ecx,%eax
+    15a2:	31 d2                	xor    %edx,%edx
+    15a4:	89 f7                	mov    %esi,%edi
+    15a6:	f7 f3                	div    %ebx
+    15a8:	8d 76 01             	lea    0x1(%esi),%esi
+    15ab:	0f b6 92 f4 19 00 00 	movzbl 0x19f4(%edx),%edx
+    15b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    15b6:	89 ca                	mov    %ecx,%edx
+    15b8:	89 c1                	mov    %eax,%ecx
+    15ba:	39 da                	cmp    %ebx,%edx
+    15bc:	73 e2                	jae    15a0 <printint+0x30>
+  if(neg)
+    15be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    15c1:	85 c0                	test   %eax,%eax
+    15c3:	74 07                	je     15cc <printint+0x5c>
+    buf[i++] = '-';
+    15c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    15ca:	89 f7                	mov    %esi,%edi
+    15cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    15cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    15d2:	01 df                	add    %ebx,%edi
+    15d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    15d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    15db:	83 ec 04             	sub    $0x4,%esp
+    15de:	88 45 d7             	mov    %al,-0x29(%ebp)
+    15e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    15e4:	6a 01                	push   $0x1
+    15e6:	50                   	push   %eax
+    15e7:	56                   	push   %esi
+    15e8:	e8 56 fe ff ff       	call   1443 <write>
+  while(--i >= 0)
+    15ed:	89 f8                	mov    %edi,%eax
+    15ef:	83 c4 10             	add    $0x10,%esp
+    15f2:	83 ef 01             	sub    $0x1,%edi
+    15f5:	39 d8                	cmp    %ebx,%eax
+    15f7:	75 df                	jne    15d8 <printint+0x68>
+}
+    15f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15fc:	5b                   	pop    %ebx
+    15fd:	5e                   	pop    %esi
+    15fe:	5f                   	pop    %edi
+    15ff:	5d                   	pop    %ebp
+    1600:	c3                   	ret
+    1601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1608:	31 c0                	xor    %eax,%eax
+    160a:	eb 89                	jmp    1595 <printint+0x25>
+    160c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001610 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1610:	55                   	push   %ebp
+    1611:	89 e5                	mov    %esp,%ebp
+    1613:	57                   	push   %edi
+    1614:	56                   	push   %esi
+    1615:	53                   	push   %ebx
+    1616:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1619:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    161c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    161f:	0f b6 1e             	movzbl (%esi),%ebx
+    1622:	83 c6 01             	add    $0x1,%esi
+    1625:	84 db                	test   %bl,%bl
+    1627:	74 67                	je     1690 <printf+0x80>
+    1629:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    162c:	31 d2                	xor    %edx,%edx
+    162e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1631:	eb 34                	jmp    1667 <printf+0x57>
+    1633:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1637:	90                   	nop
+    1638:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    163b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1640:	83 f8 25             	cmp    $0x25,%eax
+    1643:	74 18                	je     165d <printf+0x4d>
+  write(fd, &c, 1);
+    1645:	83 ec 04             	sub    $0x4,%esp
+    1648:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    164b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    164e:	6a 01                	push   $0x1
+    1650:	50                   	push   %eax
+    1651:	57                   	push   %edi
+    1652:	e8 ec fd ff ff       	call   1443 <write>
+    1657:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    165a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    165d:	0f b6 1e             	movzbl (%esi),%ebx
+    1660:	83 c6 01             	add    $0x1,%esi
+    1663:	84 db                	test   %bl,%bl
+    1665:	74 29                	je     1690 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1667:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    166a:	85 d2                	test   %edx,%edx
+    166c:	74 ca                	je     1638 <printf+0x28>
+      }
+    } else if(state == '%'){
+    166e:	83 fa 25             	cmp    $0x25,%edx
+    1671:	75 ea                	jne    165d <printf+0x4d>
+      if(c == 'd'){
+    1673:	83 f8 25             	cmp    $0x25,%eax
+    1676:	0f 84 24 01 00 00    	je     17a0 <printf+0x190>
+    167c:	83 e8 63             	sub    $0x63,%eax
+    167f:	83 f8 15             	cmp    $0x15,%eax
+    1682:	77 1c                	ja     16a0 <printf+0x90>
+    1684:	ff 24 85 9c 19 00 00 	jmp    *0x199c(,%eax,4)
+    168b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    168f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1690:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1693:	5b                   	pop    %ebx
+    1694:	5e                   	pop    %esi
+    1695:	5f                   	pop    %edi
+    1696:	5d                   	pop    %ebp
+    1697:	c3                   	ret
+    1698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    169f:	90                   	nop
+  write(fd, &c, 1);
+    16a0:	83 ec 04             	sub    $0x4,%esp
+    16a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    16a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    16aa:	6a 01                	push   $0x1
+    16ac:	52                   	push   %edx
+    16ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    16b0:	57                   	push   %edi
+    16b1:	e8 8d fd ff ff       	call   1443 <write>
+    16b6:	83 c4 0c             	add    $0xc,%esp
+    16b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    16bc:	6a 01                	push   $0x1
+    16be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    16c1:	52                   	push   %edx
+    16c2:	57                   	push   %edi
+    16c3:	e8 7b fd ff ff       	call   1443 <write>
+        putc(fd, c);
+    16c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    16cb:	31 d2                	xor    %edx,%edx
+    16cd:	eb 8e                	jmp    165d <printf+0x4d>
+    16cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    16d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    16d3:	83 ec 0c             	sub    $0xc,%esp
+    16d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    16db:	8b 13                	mov    (%ebx),%edx
+    16dd:	6a 00                	push   $0x0
+    16df:	89 f8                	mov    %edi,%eax
+        ap++;
+    16e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    16e4:	e8 87 fe ff ff       	call   1570 <printint>
+        ap++;
+    16e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    16ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    16ef:	31 d2                	xor    %edx,%edx
+    16f1:	e9 67 ff ff ff       	jmp    165d <printf+0x4d>
+    16f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1700:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1703:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1705:	83 c0 04             	add    $0x4,%eax
+    1708:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    170b:	85 db                	test   %ebx,%ebx
+    170d:	0f 84 9d 00 00 00    	je     17b0 <printf+0x1a0>
+        while(*s != 0){
+    1713:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1716:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1718:	84 c0                	test   %al,%al
+    171a:	0f 84 3d ff ff ff    	je     165d <printf+0x4d>
+    1720:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1723:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1726:	89 de                	mov    %ebx,%esi
+    1728:	89 d3                	mov    %edx,%ebx
+    172a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1730:	83 ec 04             	sub    $0x4,%esp
+    1733:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1736:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1739:	6a 01                	push   $0x1
+    173b:	53                   	push   %ebx
+    173c:	57                   	push   %edi
+    173d:	e8 01 fd ff ff       	call   1443 <write>
+        while(*s != 0){
+    1742:	0f b6 06             	movzbl (%esi),%eax
+    1745:	83 c4 10             	add    $0x10,%esp
+    1748:	84 c0                	test   %al,%al
+    174a:	75 e4                	jne    1730 <printf+0x120>
+      state = 0;
+    174c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    174f:	31 d2                	xor    %edx,%edx
+    1751:	e9 07 ff ff ff       	jmp    165d <printf+0x4d>
+    1756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    175d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1760:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1763:	83 ec 0c             	sub    $0xc,%esp
+    1766:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    176b:	8b 13                	mov    (%ebx),%edx
+    176d:	6a 01                	push   $0x1
+    176f:	e9 6b ff ff ff       	jmp    16df <printf+0xcf>
+    1774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1778:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    177b:	83 ec 04             	sub    $0x4,%esp
+    177e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1781:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1783:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1786:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1789:	6a 01                	push   $0x1
+    178b:	52                   	push   %edx
+    178c:	57                   	push   %edi
+    178d:	e8 b1 fc ff ff       	call   1443 <write>
+        ap++;
+    1792:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1795:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1798:	31 d2                	xor    %edx,%edx
+    179a:	e9 be fe ff ff       	jmp    165d <printf+0x4d>
+    179f:	90                   	nop
+  write(fd, &c, 1);
+    17a0:	83 ec 04             	sub    $0x4,%esp
+    17a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    17a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    17a9:	6a 01                	push   $0x1
+    17ab:	e9 11 ff ff ff       	jmp    16c1 <printf+0xb1>
+    17b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    17b5:	bb 93 19 00 00       	mov    $0x1993,%ebx
+    17ba:	e9 61 ff ff ff       	jmp    1720 <printf+0x110>
+    17bf:	90                   	nop
+
+000017c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    17c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17c1:	a1 9c 1c 00 00       	mov    0x1c9c,%eax
+{
+    17c6:	89 e5                	mov    %esp,%ebp
+    17c8:	57                   	push   %edi
+    17c9:	56                   	push   %esi
+    17ca:	53                   	push   %ebx
+    17cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    17ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17dc:	39 ca                	cmp    %ecx,%edx
+    17de:	73 30                	jae    1810 <free+0x50>
+    17e0:	39 c1                	cmp    %eax,%ecx
+    17e2:	72 04                	jb     17e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17e4:	39 c2                	cmp    %eax,%edx
+    17e6:	72 f0                	jb     17d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    17e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    17eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    17ee:	39 f8                	cmp    %edi,%eax
+    17f0:	74 2e                	je     1820 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    17f5:	8b 42 04             	mov    0x4(%edx),%eax
+    17f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    17fb:	39 f1                	cmp    %esi,%ecx
+    17fd:	74 38                	je     1837 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    17ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1801:	5b                   	pop    %ebx
+  freep = p;
+    1802:	89 15 9c 1c 00 00    	mov    %edx,0x1c9c
+}
+    1808:	5e                   	pop    %esi
+    1809:	5f                   	pop    %edi
+    180a:	5d                   	pop    %ebp
+    180b:	c3                   	ret
+    180c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1810:	39 c1                	cmp    %eax,%ecx
+    1812:	72 d0                	jb     17e4 <free+0x24>
+    1814:	eb c2                	jmp    17d8 <free+0x18>
+    1816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    181d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1820:	03 70 04             	add    0x4(%eax),%esi
+    1823:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1826:	8b 02                	mov    (%edx),%eax
+    1828:	8b 00                	mov    (%eax),%eax
+    182a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    182d:	8b 42 04             	mov    0x4(%edx),%eax
+    1830:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1833:	39 f1                	cmp    %esi,%ecx
+    1835:	75 c8                	jne    17ff <free+0x3f>
+    p->s.size += bp->s.size;
+    1837:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    183a:	89 15 9c 1c 00 00    	mov    %edx,0x1c9c
+    p->s.size += bp->s.size;
+    1840:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1843:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1846:	89 0a                	mov    %ecx,(%edx)
+}
+    1848:	5b                   	pop    %ebx
+    1849:	5e                   	pop    %esi
+    184a:	5f                   	pop    %edi
+    184b:	5d                   	pop    %ebp
+    184c:	c3                   	ret
+    184d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001850 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1850:	55                   	push   %ebp
+    1851:	89 e5                	mov    %esp,%ebp
+    1853:	57                   	push   %edi
+    1854:	56                   	push   %esi
+    1855:	53                   	push   %ebx
+    1856:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1859:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    185c:	8b 15 9c 1c 00 00    	mov    0x1c9c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1862:	8d 78 07             	lea    0x7(%eax),%edi
+    1865:	c1 ef 03             	shr    $0x3,%edi
+    1868:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    186b:	85 d2                	test   %edx,%edx
+    186d:	0f 84 8d 00 00 00    	je     1900 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1873:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1875:	8b 48 04             	mov    0x4(%eax),%ecx
+    1878:	39 f9                	cmp    %edi,%ecx
+    187a:	73 64                	jae    18e0 <malloc+0x90>
+  if(nu < 4096)
+    187c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1881:	39 df                	cmp    %ebx,%edi
+    1883:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1886:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    188d:	eb 0a                	jmp    1899 <malloc+0x49>
+    188f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1890:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1892:	8b 48 04             	mov    0x4(%eax),%ecx
+    1895:	39 f9                	cmp    %edi,%ecx
+    1897:	73 47                	jae    18e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1899:	89 c2                	mov    %eax,%edx
+    189b:	39 05 9c 1c 00 00    	cmp    %eax,0x1c9c
+    18a1:	75 ed                	jne    1890 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    18a3:	83 ec 0c             	sub    $0xc,%esp
+    18a6:	56                   	push   %esi
+    18a7:	e8 ff fb ff ff       	call   14ab <sbrk>
+  if(p == (char*)-1)
+    18ac:	83 c4 10             	add    $0x10,%esp
+    18af:	83 f8 ff             	cmp    $0xffffffff,%eax
+    18b2:	74 1c                	je     18d0 <malloc+0x80>
+  hp->s.size = nu;
+    18b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    18b7:	83 ec 0c             	sub    $0xc,%esp
+    18ba:	83 c0 08             	add    $0x8,%eax
+    18bd:	50                   	push   %eax
+    18be:	e8 fd fe ff ff       	call   17c0 <free>
+  return freep;
+    18c3:	8b 15 9c 1c 00 00    	mov    0x1c9c,%edx
+      if((p = morecore(nunits)) == 0)
+    18c9:	83 c4 10             	add    $0x10,%esp
+    18cc:	85 d2                	test   %edx,%edx
+    18ce:	75 c0                	jne    1890 <malloc+0x40>
+        return 0;
+  }
+}
+    18d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    18d3:	31 c0                	xor    %eax,%eax
+}
+    18d5:	5b                   	pop    %ebx
+    18d6:	5e                   	pop    %esi
+    18d7:	5f                   	pop    %edi
+    18d8:	5d                   	pop    %ebp
+    18d9:	c3                   	ret
+    18da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    18e0:	39 cf                	cmp    %ecx,%edi
+    18e2:	74 4c                	je     1930 <malloc+0xe0>
+        p->s.size -= nunits;
+    18e4:	29 f9                	sub    %edi,%ecx
+    18e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    18e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    18ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    18ef:	89 15 9c 1c 00 00    	mov    %edx,0x1c9c
+}
+    18f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    18f8:	83 c0 08             	add    $0x8,%eax
+}
+    18fb:	5b                   	pop    %ebx
+    18fc:	5e                   	pop    %esi
+    18fd:	5f                   	pop    %edi
+    18fe:	5d                   	pop    %ebp
+    18ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1900:	c7 05 9c 1c 00 00 a0 	movl   $0x1ca0,0x1c9c
+    1907:	1c 00 00 
+    base.s.size = 0;
+    190a:	b8 a0 1c 00 00       	mov    $0x1ca0,%eax
+    base.s.ptr = freep = prevp = &base;
+    190f:	c7 05 a0 1c 00 00 a0 	movl   $0x1ca0,0x1ca0
+    1916:	1c 00 00 
+    base.s.size = 0;
+    1919:	c7 05 a4 1c 00 00 00 	movl   $0x0,0x1ca4
+    1920:	00 00 00 
+    if(p->s.size >= nunits){
+    1923:	e9 54 ff ff ff       	jmp    187c <malloc+0x2c>
+    1928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    192f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1930:	8b 08                	mov    (%eax),%ecx
+    1932:	89 0a                	mov    %ecx,(%edx)
+    1934:	eb b9                	jmp    18ef <malloc+0x9f>
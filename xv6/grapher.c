@@ -3,6 +3,7 @@
 #include "user.h"
 #include "pstat.h"
 #include "fcntl.h"
+#include "sched.h"
 
 
 int
@@ -10,6 +11,13 @@ main(int argc, char *argv[]){
  	int numtickets[]={10,20,30};
 	int child_pid[3];
 
+	if(argc > 1 && strcmp(argv[1], "stride") == 0)
+		setsched(SCHED_STRIDE);
+	else if(argc > 1 && strcmp(argv[1], "mlfq") == 0)
+		setsched(SCHED_MLFQ);
+	else
+		setsched(SCHED_LOTTERY);
+
 	settickets(10);//change intial value of parent
 	
 	int i;
@@ -31,15 +39,19 @@ main(int argc, char *argv[]){
 	printf(1,"\nProcess A (%d tickets)\tProcess B (%d tickets)\tProcess C (%d tickets)\n",numtickets[0],numtickets[1],numtickets[2]);
 	
 	while(time--){
-		getpinfo(&st);
+		st.next = 0;
+		do {
+			getpinfo(&st);
 		
-		for(i=0;i<3;i++){
-			for (int j = 0; j < sizeof(st.pid)/sizeof(st.pid[0]); j++)
-			{
-				if(st.pid[j] ==child_pid[i])
-					printf(1, "%d\t",st.ticks[j]);
+			for(i=0;i<3;i++){
+				for (int j = 0; j < sizeof(st.pid)/sizeof(st.pid[0]); j++)
+				{
+					// CPU time used, in 2^20s of TSC cycles
+					if(st.inuse[j] && st.pid[j] ==child_pid[i])
+						printf(1, "%d\t",(st.utime[j]+st.stime[j])>>10);
+				}
 			}
-		}
+		} while(st.next);
 		printf(1,"\n");
 		sleep(200);
     }
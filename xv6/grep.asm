@@ -0,0 +1,1684 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	51                   	push   %ecx
+    1011:	83 ec 18             	sub    $0x18,%esp
+    1014:	8b 01                	mov    (%ecx),%eax
+    1016:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1019:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+    101c:	83 f8 01             	cmp    $0x1,%eax
+    101f:	7e 6f                	jle    1090 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+    1021:	8b 43 04             	mov    0x4(%ebx),%eax
+    1024:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+    1027:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+    102b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+    1030:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+    1033:	75 2d                	jne    1062 <main+0x62>
+    1035:	eb 6c                	jmp    10a3 <main+0xa3>
+    1037:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+    1040:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+    1043:	83 c6 01             	add    $0x1,%esi
+    1046:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+    1049:	50                   	push   %eax
+    104a:	ff 75 e0             	push   -0x20(%ebp)
+    104d:	e8 9e 01 00 00       	call   11f0 <grep>
+    close(fd);
+    1052:	89 3c 24             	mov    %edi,(%esp)
+    1055:	e8 b1 05 00 00       	call   160b <close>
+  for(i = 2; i < argc; i++){
+    105a:	83 c4 10             	add    $0x10,%esp
+    105d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+    1060:	7e 29                	jle    108b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+    1062:	83 ec 08             	sub    $0x8,%esp
+    1065:	6a 00                	push   $0x0
+    1067:	ff 33                	push   (%ebx)
+    1069:	e8 b5 05 00 00       	call   1623 <open>
+    106e:	83 c4 10             	add    $0x10,%esp
+    1071:	89 c7                	mov    %eax,%edi
+    1073:	85 c0                	test   %eax,%eax
+    1075:	79 c9                	jns    1040 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+    1077:	50                   	push   %eax
+    1078:	ff 33                	push   (%ebx)
+    107a:	68 18 1b 00 00       	push   $0x1b18
+    107f:	6a 01                	push   $0x1
+    1081:	e8 4a 07 00 00       	call   17d0 <printf>
+      exit();
+    1086:	e8 58 05 00 00       	call   15e3 <exit>
+  }
+  exit();
+    108b:	e8 53 05 00 00       	call   15e3 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+    1090:	51                   	push   %ecx
+    1091:	51                   	push   %ecx
+    1092:	68 f8 1a 00 00       	push   $0x1af8
+    1097:	6a 02                	push   $0x2
+    1099:	e8 32 07 00 00       	call   17d0 <printf>
+    exit();
+    109e:	e8 40 05 00 00       	call   15e3 <exit>
+    grep(pattern, 0);
+    10a3:	52                   	push   %edx
+    10a4:	52                   	push   %edx
+    10a5:	6a 00                	push   $0x0
+    10a7:	50                   	push   %eax
+    10a8:	e8 43 01 00 00       	call   11f0 <grep>
+    exit();
+    10ad:	e8 31 05 00 00       	call   15e3 <exit>
+    10b2:	66 90                	xchg   %ax,%ax
+    10b4:	66 90                	xchg   %ax,%ax
+    10b6:	66 90                	xchg   %ax,%ax
+    10b8:	66 90                	xchg   %ax,%ax
+    10ba:	66 90                	xchg   %ax,%ax
+    10bc:	66 90                	xchg   %ax,%ax
+    10be:	66 90                	xchg   %ax,%ax
+
+000010c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+    10c0:	55                   	push   %ebp
+    10c1:	89 e5                	mov    %esp,%ebp
+    10c3:	57                   	push   %edi
+    10c4:	56                   	push   %esi
+    10c5:	53                   	push   %ebx
+    10c6:	83 ec 0c             	sub    $0xc,%esp
+    10c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+    10cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+    10cf:	0f b6 0f             	movzbl (%edi),%ecx
+    10d2:	84 c9                	test   %cl,%cl
+    10d4:	0f 84 96 00 00 00    	je     1170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+    10da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+    10de:	3c 2a                	cmp    $0x2a,%al
+    10e0:	74 2d                	je     110f <matchhere+0x4f>
+    10e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+    10e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+    10eb:	80 f9 24             	cmp    $0x24,%cl
+    10ee:	74 50                	je     1140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+    10f0:	89 f2                	mov    %esi,%edx
+    10f2:	84 d2                	test   %dl,%dl
+    10f4:	74 6e                	je     1164 <matchhere+0xa4>
+    10f6:	80 f9 2e             	cmp    $0x2e,%cl
+    10f9:	75 65                	jne    1160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+    10fb:	83 c3 01             	add    $0x1,%ebx
+    10fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+    1101:	84 c0                	test   %al,%al
+    1103:	74 6b                	je     1170 <matchhere+0xb0>
+    1105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+    1107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+    110b:	3c 2a                	cmp    $0x2a,%al
+    110d:	75 d9                	jne    10e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+    110f:	8d 77 02             	lea    0x2(%edi),%esi
+    1112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+    1115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+    1118:	83 ec 08             	sub    $0x8,%esp
+    111b:	53                   	push   %ebx
+    111c:	56                   	push   %esi
+    111d:	e8 9e ff ff ff       	call   10c0 <matchhere>
+    1122:	83 c4 10             	add    $0x10,%esp
+    1125:	85 c0                	test   %eax,%eax
+    1127:	75 47                	jne    1170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+    1129:	0f be 13             	movsbl (%ebx),%edx
+    112c:	84 d2                	test   %dl,%dl
+    112e:	74 45                	je     1175 <matchhere+0xb5>
+    1130:	83 c3 01             	add    $0x1,%ebx
+    1133:	39 fa                	cmp    %edi,%edx
+    1135:	74 e1                	je     1118 <matchhere+0x58>
+    1137:	83 ff 2e             	cmp    $0x2e,%edi
+    113a:	74 dc                	je     1118 <matchhere+0x58>
+    113c:	eb 37                	jmp    1175 <matchhere+0xb5>
+    113e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+    1140:	84 c0                	test   %al,%al
+    1142:	74 39                	je     117d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+    1144:	89 f2                	mov    %esi,%edx
+    1146:	84 d2                	test   %dl,%dl
+    1148:	74 1a                	je     1164 <matchhere+0xa4>
+    114a:	80 fa 24             	cmp    $0x24,%dl
+    114d:	75 15                	jne    1164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+    114f:	83 c3 01             	add    $0x1,%ebx
+    1152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+    1155:	89 c1                	mov    %eax,%ecx
+    1157:	eb ae                	jmp    1107 <matchhere+0x47>
+    1159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+    1160:	38 ca                	cmp    %cl,%dl
+    1162:	74 97                	je     10fb <matchhere+0x3b>
+}
+    1164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+    1167:	31 c0                	xor    %eax,%eax
+}
+    1169:	5b                   	pop    %ebx
+    116a:	5e                   	pop    %esi
+    116b:	5f                   	pop    %edi
+    116c:	5d                   	pop    %ebp
+    116d:	c3                   	ret
+    116e:	66 90                	xchg   %ax,%ax
+    return 1;
+    1170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    1175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1178:	5b                   	pop    %ebx
+    1179:	5e                   	pop    %esi
+    117a:	5f                   	pop    %edi
+    117b:	5d                   	pop    %ebp
+    117c:	c3                   	ret
+    return *text == '\0';
+    117d:	89 f0                	mov    %esi,%eax
+    117f:	84 c0                	test   %al,%al
+    1181:	0f 94 c0             	sete   %al
+    1184:	0f b6 c0             	movzbl %al,%eax
+    1187:	eb ec                	jmp    1175 <matchhere+0xb5>
+    1189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001190 <match>:
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	56                   	push   %esi
+    1194:	53                   	push   %ebx
+    1195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+    119b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+    119e:	75 11                	jne    11b1 <match+0x21>
+    11a0:	eb 2e                	jmp    11d0 <match+0x40>
+    11a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+    11a8:	83 c6 01             	add    $0x1,%esi
+    11ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+    11af:	74 16                	je     11c7 <match+0x37>
+    if(matchhere(re, text))
+    11b1:	83 ec 08             	sub    $0x8,%esp
+    11b4:	56                   	push   %esi
+    11b5:	53                   	push   %ebx
+    11b6:	e8 05 ff ff ff       	call   10c0 <matchhere>
+    11bb:	83 c4 10             	add    $0x10,%esp
+    11be:	85 c0                	test   %eax,%eax
+    11c0:	74 e6                	je     11a8 <match+0x18>
+      return 1;
+    11c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    11c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11ca:	5b                   	pop    %ebx
+    11cb:	5e                   	pop    %esi
+    11cc:	5d                   	pop    %ebp
+    11cd:	c3                   	ret
+    11ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+    11d0:	83 c3 01             	add    $0x1,%ebx
+    11d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    11d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11d9:	5b                   	pop    %ebx
+    11da:	5e                   	pop    %esi
+    11db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+    11dc:	e9 df fe ff ff       	jmp    10c0 <matchhere>
+    11e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ef:	90                   	nop
+
+000011f0 <grep>:
+{
+    11f0:	55                   	push   %ebp
+    11f1:	89 e5                	mov    %esp,%ebp
+    11f3:	57                   	push   %edi
+  m = 0;
+    11f4:	31 ff                	xor    %edi,%edi
+{
+    11f6:	56                   	push   %esi
+    11f7:	53                   	push   %ebx
+    11f8:	83 ec 1c             	sub    $0x1c,%esp
+    11fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    11fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+    1201:	8d 43 01             	lea    0x1(%ebx),%eax
+    1204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    1207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+    1210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+    1218:	83 ec 04             	sub    $0x4,%esp
+    121b:	29 c8                	sub    %ecx,%eax
+    121d:	50                   	push   %eax
+    121e:	8d 81 20 1f 00 00    	lea    0x1f20(%ecx),%eax
+    1224:	50                   	push   %eax
+    1225:	ff 75 0c             	push   0xc(%ebp)
+    1228:	e8 ce 03 00 00       	call   15fb <read>
+    122d:	83 c4 10             	add    $0x10,%esp
+    1230:	85 c0                	test   %eax,%eax
+    1232:	0f 8e fd 00 00 00    	jle    1335 <grep+0x145>
+    m += n;
+    1238:	01 45 e0             	add    %eax,-0x20(%ebp)
+    123b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+    123e:	bf 20 1f 00 00       	mov    $0x1f20,%edi
+    1243:	89 de                	mov    %ebx,%esi
+    1245:	c6 81 20 1f 00 00 00 	movb   $0x0,0x1f20(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+    124c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1250:	83 ec 08             	sub    $0x8,%esp
+    1253:	6a 0a                	push   $0xa
+    1255:	57                   	push   %edi
+    1256:	e8 25 02 00 00       	call   1480 <strchr>
+    125b:	83 c4 10             	add    $0x10,%esp
+    125e:	89 c2                	mov    %eax,%edx
+    1260:	85 c0                	test   %eax,%eax
+    1262:	0f 84 88 00 00 00    	je     12f0 <grep+0x100>
+      *q = 0;
+    1268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+    126b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+    126e:	74 58                	je     12c8 <grep+0xd8>
+    1270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    1273:	89 d3                	mov    %edx,%ebx
+    1275:	eb 12                	jmp    1289 <grep+0x99>
+    1277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    127e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+    1280:	83 c7 01             	add    $0x1,%edi
+    1283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+    1287:	74 37                	je     12c0 <grep+0xd0>
+    if(matchhere(re, text))
+    1289:	83 ec 08             	sub    $0x8,%esp
+    128c:	57                   	push   %edi
+    128d:	56                   	push   %esi
+    128e:	e8 2d fe ff ff       	call   10c0 <matchhere>
+    1293:	83 c4 10             	add    $0x10,%esp
+    1296:	85 c0                	test   %eax,%eax
+    1298:	74 e6                	je     1280 <grep+0x90>
+        write(1, p, q+1 - p);
+    129a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    129d:	89 da                	mov    %ebx,%edx
+    129f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+    12a2:	89 d8                	mov    %ebx,%eax
+    12a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+    12a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+    12aa:	29 f8                	sub    %edi,%eax
+    12ac:	50                   	push   %eax
+    12ad:	57                   	push   %edi
+    12ae:	89 df                	mov    %ebx,%edi
+    12b0:	6a 01                	push   $0x1
+    12b2:	e8 4c 03 00 00       	call   1603 <write>
+    12b7:	83 c4 10             	add    $0x10,%esp
+    12ba:	eb 94                	jmp    1250 <grep+0x60>
+    12bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+    12c3:	eb 8b                	jmp    1250 <grep+0x60>
+    12c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+    12c8:	83 ec 08             	sub    $0x8,%esp
+    12cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    12ce:	57                   	push   %edi
+    12cf:	ff 75 dc             	push   -0x24(%ebp)
+    12d2:	e8 e9 fd ff ff       	call   10c0 <matchhere>
+        write(1, p, q+1 - p);
+    12d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+    12da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+    12dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+    12e0:	85 c0                	test   %eax,%eax
+    12e2:	75 be                	jne    12a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+    12e4:	89 df                	mov    %ebx,%edi
+    12e6:	e9 65 ff ff ff       	jmp    1250 <grep+0x60>
+    12eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12ef:	90                   	nop
+    if(p == buf)
+    12f0:	89 f3                	mov    %esi,%ebx
+    12f2:	81 ff 20 1f 00 00    	cmp    $0x1f20,%edi
+    12f8:	74 2f                	je     1329 <grep+0x139>
+    if(m > 0){
+    12fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    12fd:	85 c0                	test   %eax,%eax
+    12ff:	0f 8e 0b ff ff ff    	jle    1210 <grep+0x20>
+      m -= p - buf;
+    1305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+    1307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+    130a:	2d 20 1f 00 00       	sub    $0x1f20,%eax
+    130f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+    1312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+    1315:	51                   	push   %ecx
+    1316:	57                   	push   %edi
+    1317:	68 20 1f 00 00       	push   $0x1f20
+    131c:	e8 8f 02 00 00       	call   15b0 <memmove>
+    1321:	83 c4 10             	add    $0x10,%esp
+    1324:	e9 e7 fe ff ff       	jmp    1210 <grep+0x20>
+      m = 0;
+    1329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+    1330:	e9 db fe ff ff       	jmp    1210 <grep+0x20>
+}
+    1335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1338:	5b                   	pop    %ebx
+    1339:	5e                   	pop    %esi
+    133a:	5f                   	pop    %edi
+    133b:	5d                   	pop    %ebp
+    133c:	c3                   	ret
+    133d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001340 <matchstar>:
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	57                   	push   %edi
+    1344:	56                   	push   %esi
+    1345:	53                   	push   %ebx
+    1346:	83 ec 0c             	sub    $0xc,%esp
+    1349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    134c:	8b 75 0c             	mov    0xc(%ebp),%esi
+    134f:	8b 7d 10             	mov    0x10(%ebp),%edi
+    1352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+    1358:	83 ec 08             	sub    $0x8,%esp
+    135b:	57                   	push   %edi
+    135c:	56                   	push   %esi
+    135d:	e8 5e fd ff ff       	call   10c0 <matchhere>
+    1362:	83 c4 10             	add    $0x10,%esp
+    1365:	85 c0                	test   %eax,%eax
+    1367:	75 1f                	jne    1388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+    1369:	0f be 17             	movsbl (%edi),%edx
+    136c:	84 d2                	test   %dl,%dl
+    136e:	74 0c                	je     137c <matchstar+0x3c>
+    1370:	83 c7 01             	add    $0x1,%edi
+    1373:	39 da                	cmp    %ebx,%edx
+    1375:	74 e1                	je     1358 <matchstar+0x18>
+    1377:	83 fb 2e             	cmp    $0x2e,%ebx
+    137a:	74 dc                	je     1358 <matchstar+0x18>
+}
+    137c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    137f:	5b                   	pop    %ebx
+    1380:	5e                   	pop    %esi
+    1381:	5f                   	pop    %edi
+    1382:	5d                   	pop    %ebp
+    1383:	c3                   	ret
+    1384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+    138b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    1390:	5b                   	pop    %ebx
+    1391:	5e                   	pop    %esi
+    1392:	5f                   	pop    %edi
+    1393:	5d                   	pop    %ebp
+    1394:	c3                   	ret
+    1395:	66 90                	xchg   %ax,%ax
+    1397:	66 90                	xchg   %ax,%ax
+    1399:	66 90                	xchg   %ax,%ax
+    139b:	66 90                	xchg   %ax,%ax
+    139d:	66 90                	xchg   %ax,%ax
+    139f:	90                   	nop
+
+000013a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    13a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    13a1:	31 c0                	xor    %eax,%eax
+{
+    13a3:	89 e5                	mov    %esp,%ebp
+    13a5:	53                   	push   %ebx
+    13a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    13a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    13ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    13b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    13b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    13b7:	83 c0 01             	add    $0x1,%eax
+    13ba:	84 d2                	test   %dl,%dl
+    13bc:	75 f2                	jne    13b0 <strcpy+0x10>
+    ;
+  return os;
+}
+    13be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13c1:	89 c8                	mov    %ecx,%eax
+    13c3:	c9                   	leave
+    13c4:	c3                   	ret
+    13c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000013d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	53                   	push   %ebx
+    13d4:	8b 55 08             	mov    0x8(%ebp),%edx
+    13d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    13da:	0f b6 02             	movzbl (%edx),%eax
+    13dd:	84 c0                	test   %al,%al
+    13df:	75 17                	jne    13f8 <strcmp+0x28>
+    13e1:	eb 3a                	jmp    141d <strcmp+0x4d>
+    13e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13e7:	90                   	nop
+    13e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    13ec:	83 c2 01             	add    $0x1,%edx
+    13ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    13f2:	84 c0                	test   %al,%al
+    13f4:	74 1a                	je     1410 <strcmp+0x40>
+    p++, q++;
+    13f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    13f8:	0f b6 19             	movzbl (%ecx),%ebx
+    13fb:	38 c3                	cmp    %al,%bl
+    13fd:	74 e9                	je     13e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    13ff:	29 d8                	sub    %ebx,%eax
+}
+    1401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1404:	c9                   	leave
+    1405:	c3                   	ret
+    1406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    140d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1414:	31 c0                	xor    %eax,%eax
+    1416:	29 d8                	sub    %ebx,%eax
+}
+    1418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    141b:	c9                   	leave
+    141c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    141d:	0f b6 19             	movzbl (%ecx),%ebx
+    1420:	31 c0                	xor    %eax,%eax
+    1422:	eb db                	jmp    13ff <strcmp+0x2f>
+    1424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    142b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    142f:	90                   	nop
+
+00001430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1430:	55                   	push   %ebp
+    1431:	89 e5                	mov    %esp,%ebp
+    1433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1436:	80 3a 00             	cmpb   $0x0,(%edx)
+    1439:	74 15                	je     1450 <strlen+0x20>
+    143b:	31 c0                	xor    %eax,%eax
+    143d:	8d 76 00             	lea    0x0(%esi),%esi
+    1440:	83 c0 01             	add    $0x1,%eax
+    1443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1447:	89 c1                	mov    %eax,%ecx
+    1449:	75 f5                	jne    1440 <strlen+0x10>
+    ;
+  return n;
+}
+    144b:	89 c8                	mov    %ecx,%eax
+    144d:	5d                   	pop    %ebp
+    144e:	c3                   	ret
+    144f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1450:	31 c9                	xor    %ecx,%ecx
+}
+    1452:	5d                   	pop    %ebp
+    1453:	89 c8                	mov    %ecx,%eax
+    1455:	c3                   	ret
+    1456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    145d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	57                   	push   %edi
+    1464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    146a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    146d:	89 d7                	mov    %edx,%edi
+    146f:	fc                   	cld
+    1470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1475:	89 d0                	mov    %edx,%eax
+    1477:	c9                   	leave
+    1478:	c3                   	ret
+    1479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1480:	55                   	push   %ebp
+    1481:	89 e5                	mov    %esp,%ebp
+    1483:	8b 45 08             	mov    0x8(%ebp),%eax
+    1486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    148a:	0f b6 10             	movzbl (%eax),%edx
+    148d:	84 d2                	test   %dl,%dl
+    148f:	75 12                	jne    14a3 <strchr+0x23>
+    1491:	eb 1d                	jmp    14b0 <strchr+0x30>
+    1493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1497:	90                   	nop
+    1498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    149c:	83 c0 01             	add    $0x1,%eax
+    149f:	84 d2                	test   %dl,%dl
+    14a1:	74 0d                	je     14b0 <strchr+0x30>
+    if(*s == c)
+    14a3:	38 d1                	cmp    %dl,%cl
+    14a5:	75 f1                	jne    1498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    14a7:	5d                   	pop    %ebp
+    14a8:	c3                   	ret
+    14a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    14b0:	31 c0                	xor    %eax,%eax
+}
+    14b2:	5d                   	pop    %ebp
+    14b3:	c3                   	ret
+    14b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14bf:	90                   	nop
+
+000014c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    14c0:	55                   	push   %ebp
+    14c1:	89 e5                	mov    %esp,%ebp
+    14c3:	57                   	push   %edi
+    14c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    14c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    14c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    14c9:	31 db                	xor    %ebx,%ebx
+{
+    14cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    14ce:	eb 27                	jmp    14f7 <gets+0x37>
+    cc = read(0, &c, 1);
+    14d0:	83 ec 04             	sub    $0x4,%esp
+    14d3:	6a 01                	push   $0x1
+    14d5:	56                   	push   %esi
+    14d6:	6a 00                	push   $0x0
+    14d8:	e8 1e 01 00 00       	call   15fb <read>
+    if(cc < 1)
+    14dd:	83 c4 10             	add    $0x10,%esp
+    14e0:	85 c0                	test   %eax,%eax
+    14e2:	7e 1d                	jle    1501 <gets+0x41>
+      break;
+    buf[i++] = c;
+    14e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    14e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    14eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    14ef:	3c 0a                	cmp    $0xa,%al
+    14f1:	74 10                	je     1503 <gets+0x43>
+    14f3:	3c 0d                	cmp    $0xd,%al
+    14f5:	74 0c                	je     1503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    14f7:	89 df                	mov    %ebx,%edi
+    14f9:	83 c3 01             	add    $0x1,%ebx
+    14fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    14ff:	7c cf                	jl     14d0 <gets+0x10>
+    1501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1503:	8b 45 08             	mov    0x8(%ebp),%eax
+    1506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    150a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    150d:	5b                   	pop    %ebx
+    150e:	5e                   	pop    %esi
+    150f:	5f                   	pop    %edi
+    1510:	5d                   	pop    %ebp
+    1511:	c3                   	ret
+    1512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001520 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1520:	55                   	push   %ebp
+    1521:	89 e5                	mov    %esp,%ebp
+    1523:	56                   	push   %esi
+    1524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1525:	83 ec 08             	sub    $0x8,%esp
+    1528:	6a 00                	push   $0x0
+    152a:	ff 75 08             	push   0x8(%ebp)
+    152d:	e8 f1 00 00 00       	call   1623 <open>
+  if(fd < 0)
+    1532:	83 c4 10             	add    $0x10,%esp
+    1535:	85 c0                	test   %eax,%eax
+    1537:	78 27                	js     1560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1539:	83 ec 08             	sub    $0x8,%esp
+    153c:	ff 75 0c             	push   0xc(%ebp)
+    153f:	89 c3                	mov    %eax,%ebx
+    1541:	50                   	push   %eax
+    1542:	e8 f4 00 00 00       	call   163b <fstat>
+  close(fd);
+    1547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    154a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    154c:	e8 ba 00 00 00       	call   160b <close>
+  return r;
+    1551:	83 c4 10             	add    $0x10,%esp
+}
+    1554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1557:	89 f0                	mov    %esi,%eax
+    1559:	5b                   	pop    %ebx
+    155a:	5e                   	pop    %esi
+    155b:	5d                   	pop    %ebp
+    155c:	c3                   	ret
+    155d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1565:	eb ed                	jmp    1554 <stat+0x34>
+    1567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    156e:	66 90                	xchg   %ax,%ax
+
+00001570 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1570:	55                   	push   %ebp
+    1571:	89 e5                	mov    %esp,%ebp
+    1573:	53                   	push   %ebx
+    1574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1577:	0f be 02             	movsbl (%edx),%eax
+    157a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    157d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1585:	77 1e                	ja     15a5 <atoi+0x35>
+    1587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    158e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1590:	83 c2 01             	add    $0x1,%edx
+    1593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    159a:	0f be 02             	movsbl (%edx),%eax
+    159d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    15a0:	80 fb 09             	cmp    $0x9,%bl
+    15a3:	76 eb                	jbe    1590 <atoi+0x20>
+  return n;
+}
+    15a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    15a8:	89 c8                	mov    %ecx,%eax
+    15aa:	c9                   	leave
+    15ab:	c3                   	ret
+    15ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000015b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    15b0:	55                   	push   %ebp
+    15b1:	89 e5                	mov    %esp,%ebp
+    15b3:	57                   	push   %edi
+    15b4:	56                   	push   %esi
+    15b5:	8b 45 10             	mov    0x10(%ebp),%eax
+    15b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    15bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    15be:	85 c0                	test   %eax,%eax
+    15c0:	7e 13                	jle    15d5 <memmove+0x25>
+    15c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    15c4:	89 d7                	mov    %edx,%edi
+    15c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    15d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    15d1:	39 f8                	cmp    %edi,%eax
+    15d3:	75 fb                	jne    15d0 <memmove+0x20>
+  return vdst;
+}
+    15d5:	5e                   	pop    %esi
+    15d6:	89 d0                	mov    %edx,%eax
+    15d8:	5f                   	pop    %edi
+    15d9:	5d                   	pop    %ebp
+    15da:	c3                   	ret
+
+000015db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    15db:	b8 01 00 00 00       	mov    $0x1,%eax
+    15e0:	cd 40                	int    $0x40
+    15e2:	c3                   	ret
+
+000015e3 <exit>:
+SYSCALL(exit)
+    15e3:	b8 02 00 00 00       	mov    $0x2,%eax
+    15e8:	cd 40                	int    $0x40
+    15ea:	c3                   	ret
+
+000015eb <wait>:
+SYSCALL(wait)
+    15eb:	b8 03 00 00 00       	mov    $0x3,%eax
+    15f0:	cd 40                	int    $0x40
+    15f2:	c3                   	ret
+
+000015f3 <pipe>:
+SYSCALL(pipe)
+    15f3:	b8 04 00 00 00       	mov    $0x4,%eax
+    15f8:	cd 40                	int    $0x40
+    15fa:	c3                   	ret
+
+000015fb <read>:
+SYSCALL(read)
+    15fb:	b8 05 00 00 00       	mov    $0x5,%eax
+    1600:	cd 40                	int    $0x40
+    1602:	c3                   	ret
+
+00001603 <write>:
+SYSCALL(write)
+    1603:	b8 10 00 00 00       	mov    $0x10,%eax
+    1608:	cd 40                	int    $0x40
+    160a:	c3                   	ret
+
+0000160b <close>:
+SYSCALL(close)
+    160b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1610:	cd 40                	int    $0x40
+    1612:	c3                   	ret
+
+00001613 <kill>:
+SYSCALL(kill)
+    1613:	b8 06 00 00 00       	mov    $0x6,%eax
+    1618:	cd 40                	int    $0x40
+    161a:	c3                   	ret
+
+0000161b <exec>:
+SYSCALL(exec)
+    161b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1620:	cd 40                	int    $0x40
+    1622:	c3                   	ret
+
+00001623 <open>:
+SYSCALL(open)
+    1623:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1628:	cd 40                	int    $0x40
+    162a:	c3                   	ret
+
+0000162b <mknod>:
+SYSCALL(mknod)
+    162b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1630:	cd 40                	int    $0x40
+    1632:	c3                   	ret
+
+00001633 <unlink>:
+SYSCALL(unlink)
+    1633:	b8 12 00 00 00       	mov    $0x12,%eax
+    1638:	cd 40                	int    $0x40
+    163a:	c3                   	ret
+
+0000163b <fstat>:
+SYSCALL(fstat)
+    163b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1640:	cd 40                	int    $0x40
+    1642:	c3                   	ret
+
+00001643 <link>:
+SYSCALL(link)
+    1643:	b8 13 00 00 00       	mov    $0x13,%eax
+    1648:	cd 40                	int    $0x40
+    164a:	c3                   	ret
+
+0000164b <mkdir>:
+SYSCALL(mkdir)
+    164b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1650:	cd 40                	int    $0x40
+    1652:	c3                   	ret
+
+00001653 <chdir>:
+SYSCALL(chdir)
+    1653:	b8 09 00 00 00       	mov    $0x9,%eax
+    1658:	cd 40                	int    $0x40
+    165a:	c3                   	ret
+
+0000165b <dup>:
+SYSCALL(dup)
+    165b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1660:	cd 40                	int    $0x40
+    1662:	c3                   	ret
+
+00001663 <getpid>:
+SYSCALL(getpid)
+    1663:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1668:	cd 40                	int    $0x40
+    166a:	c3                   	ret
+
+0000166b <sbrk>:
+SYSCALL(sbrk)
+    166b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1670:	cd 40                	int    $0x40
+    1672:	c3                   	ret
+
+00001673 <sleep>:
+SYSCALL(sleep)
+    1673:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1678:	cd 40                	int    $0x40
+    167a:	c3                   	ret
+
+0000167b <uptime>:
+SYSCALL(uptime)
+    167b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1680:	cd 40                	int    $0x40
+    1682:	c3                   	ret
+
+00001683 <settickets>:
+SYSCALL(settickets)
+    1683:	b8 16 00 00 00       	mov    $0x16,%eax
+    1688:	cd 40                	int    $0x40
+    168a:	c3                   	ret
+
+0000168b <getpinfo>:
+SYSCALL(getpinfo)
+    168b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1690:	cd 40                	int    $0x40
+    1692:	c3                   	ret
+
+00001693 <mprotect>:
+SYSCALL(mprotect)
+    1693:	b8 18 00 00 00       	mov    $0x18,%eax
+    1698:	cd 40                	int    $0x40
+    169a:	c3                   	ret
+
+0000169b <munprotect>:
+SYSCALL(munprotect)
+    169b:	b8 19 00 00 00       	mov    $0x19,%eax
+    16a0:	cd 40                	int    $0x40
+    16a2:	c3                   	ret
+
+000016a3 <clone>:
+SYSCALL(clone)
+    16a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    16a8:	cd 40                	int    $0x40
+    16aa:	c3                   	ret
+
+000016ab <join>:
+SYSCALL(join)
+    16ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    16b0:	cd 40                	int    $0x40
+    16b2:	c3                   	ret
+
+000016b3 <initlock_t>:
+SYSCALL(initlock_t)
+    16b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    16b8:	cd 40                	int    $0x40
+    16ba:	c3                   	ret
+
+000016bb <acquire_t>:
+SYSCALL(acquire_t)
+    16bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    16c0:	cd 40                	int    $0x40
+    16c2:	c3                   	ret
+
+000016c3 <release_t>:
+SYSCALL(release_t)
+    16c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    16c8:	cd 40                	int    $0x40
+    16ca:	c3                   	ret
+
+000016cb <setsched>:
+SYSCALL(setsched)
+    16cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    16d0:	cd 40                	int    $0x40
+    16d2:	c3                   	ret
+
+000016d3 <mkgroup>:
+SYSCALL(mkgroup)
+    16d3:	b8 20 00 00 00       	mov    $0x20,%eax
+    16d8:	cd 40                	int    $0x40
+    16da:	c3                   	ret
+
+000016db <joingroup>:
+SYSCALL(joingroup)
+    16db:	b8 21 00 00 00       	mov    $0x21,%eax
+    16e0:	cd 40                	int    $0x40
+    16e2:	c3                   	ret
+
+000016e3 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    16e3:	b8 22 00 00 00       	mov    $0x22,%eax
+    16e8:	cd 40                	int    $0x40
+    16ea:	c3                   	ret
+
+000016eb <setdeadline>:
+SYSCALL(setdeadline)
+    16eb:	b8 23 00 00 00       	mov    $0x23,%eax
+    16f0:	cd 40                	int    $0x40
+    16f2:	c3                   	ret
+
+000016f3 <setaffinity>:
+SYSCALL(setaffinity)
+    16f3:	b8 24 00 00 00       	mov    $0x24,%eax
+    16f8:	cd 40                	int    $0x40
+    16fa:	c3                   	ret
+
+000016fb <yield_to>:
+SYSCALL(yield_to)
+    16fb:	b8 25 00 00 00       	mov    $0x25,%eax
+    1700:	cd 40                	int    $0x40
+    1702:	c3                   	ret
+
+00001703 <getlatency>:
+SYSCALL(getlatency)
+    1703:	b8 26 00 00 00       	mov    $0x26,%eax
+    1708:	cd 40                	int    $0x40
+    170a:	c3                   	ret
+
+0000170b <futex_wait>:
+SYSCALL(futex_wait)
+    170b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1710:	cd 40                	int    $0x40
+    1712:	c3                   	ret
+
+00001713 <futex_wake>:
+SYSCALL(futex_wake)
+    1713:	b8 28 00 00 00       	mov    $0x28,%eax
+    1718:	cd 40                	int    $0x40
+    171a:	c3                   	ret
+
+0000171b <mguard>:
+SYSCALL(mguard)
+    171b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1720:	cd 40                	int    $0x40
+    1722:	c3                   	ret
+
+00001723 <join_any>:
+SYSCALL(join_any)
+    1723:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1728:	cd 40                	int    $0x40
+    172a:	c3                   	ret
+    172b:	66 90                	xchg   %ax,%ax
+    172d:	66 90                	xchg   %ax,%ax
+    172f:	90                   	nop
+
+00001730 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1730:	55                   	push   %ebp
+    1731:	89 e5                	mov    %esp,%ebp
+    1733:	57                   	push   %edi
+    1734:	56                   	push   %esi
+    1735:	53                   	push   %ebx
+    1736:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1738:	89 d1                	mov    %edx,%ecx
+{
+    173a:	83 ec 3c             	sub    $0x3c,%esp
+    173d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1740:	85 d2                	test   %edx,%edx
+    1742:	0f 89 80 00 00 00    	jns    17c8 <printint+0x98>
+    1748:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    174c:	74 7a                	je     17c8 <printint+0x98>
+    x = -xx;
+    174e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1750:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1755:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1758:	31 f6                	xor    %esi,%esi
+    175a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1760:	89 c8                	mov    %ecx,%eax
+    1762:	31 d2                	xor    %edx,%edx
+    1764:	89 f7                	mov    %esi,%edi
+    1766:	f7 f3                	div    %ebx
+    1768:	8d 76 01             	lea    0x1(%esi),%esi
+    176b:	0f b6 92 90 1b 00 00 	movzbl 0x1b90(%edx),%edx
+    1772:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1776:	89 ca                	mov    %ecx,%edx
+    1778:	89 c1                	mov    %eax,%ecx
+    177a:	39 da                	cmp    %ebx,%edx
+    177c:	73 e2                	jae    1760 <printint+0x30>
+  if(neg)
+    177e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1781:	85 c0                	test   %eax,%eax
+    1783:	74 07                	je     178c <printint+0x5c>
+    buf[i++] = '-';
+    1785:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    178a:	89 f7                	mov    %esi,%edi
+    178c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    178f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1792:	01 df                	add    %ebx,%edi
+    1794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1798:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    179b:	83 ec 04             	sub    $0x4,%esp
+    179e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    17a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    17a4:	6a 01                	push   $0x1
+    17a6:	50                   	push   %eax
+    17a7:	56                   	push   %esi
+    17a8:	e8 56 fe ff ff       	call   1603 <write>
+  while(--i >= 0)
+    17ad:	89 f8                	mov    %edi,%eax
+    17af:	83 c4 10             	add    $0x10,%esp
+    17b2:	83 ef 01             	sub    $0x1,%edi
+    17b5:	39 d8                	cmp    %ebx,%eax
+    17b7:	75 df                	jne    1798 <printint+0x68>
+}
+    17b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17bc:	5b                   	pop    %ebx
+    17bd:	5e                   	pop    %esi
+    17be:	5f                   	pop    %edi
+    17bf:	5d                   	pop    %ebp
+    17c0:	c3                   	ret
+    17c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    17c8:	31 c0                	xor    %eax,%eax
+    17ca:	eb 89                	jmp    1755 <printint+0x25>
+    17cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000017d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    17d0:	55                   	push   %ebp
+    17d1:	89 e5                	mov    %esp,%ebp
+    17d3:	57                   	push   %edi
+    17d4:	56                   	push   %esi
+    17d5:	53                   	push   %ebx
+    17d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    17d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    17dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    17df:	0f b6 1e             	movzbl (%esi),%ebx
+    17e2:	83 c6 01             	add    $0x1,%esi
+    17e5:	84 db                	test   %bl,%bl
+    17e7:	74 67                	je     1850 <printf+0x80>
+    17e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    17ec:	31 d2                	xor    %edx,%edx
+    17ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    17f1:	eb 34                	jmp    1827 <printf+0x57>
+    17f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17f7:	90                   	nop
+    17f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    17fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1800:	83 f8 25             	cmp    $0x25,%eax
+    1803:	74 18                	je     181d <printf+0x4d>
+  write(fd, &c, 1);
+    1805:	83 ec 04             	sub    $0x4,%esp
+    1808:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    180b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    180e:	6a 01                	push   $0x1
+    1810:	50                   	push   %eax
+    1811:	57                   	push   %edi
+    1812:	e8 ec fd ff ff       	call   1603 <write>
+    1817:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    181a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    181d:	0f b6 1e             	movzbl (%esi),%ebx
+    1820:	83 c6 01             	add    $0x1,%esi
+    1823:	84 db                	test   %bl,%bl
+    1825:	74 29                	je     1850 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1827:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    182a:	85 d2                	test   %edx,%edx
+    182c:	74 ca                	je     17f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    182e:	83 fa 25             	cmp    $0x25,%edx
+    1831:	75 ea                	jne    181d <printf+0x4d>
+      if(c == 'd'){
+    1833:	83 f8 25             	cmp    $0x25,%eax
+    1836:	0f 84 24 01 00 00    	je     1960 <printf+0x190>
+    183c:	83 e8 63             	sub    $0x63,%eax
+    183f:	83 f8 15             	cmp    $0x15,%eax
+    1842:	77 1c                	ja     1860 <printf+0x90>
+    1844:	ff 24 85 38 1b 00 00 	jmp    *0x1b38(,%eax,4)
+    184b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    184f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1853:	5b                   	pop    %ebx
+    1854:	5e                   	pop    %esi
+    1855:	5f                   	pop    %edi
+    1856:	5d                   	pop    %ebp
+    1857:	c3                   	ret
+    1858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    185f:	90                   	nop
+  write(fd, &c, 1);
+    1860:	83 ec 04             	sub    $0x4,%esp
+    1863:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1866:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    186a:	6a 01                	push   $0x1
+    186c:	52                   	push   %edx
+    186d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1870:	57                   	push   %edi
+    1871:	e8 8d fd ff ff       	call   1603 <write>
+    1876:	83 c4 0c             	add    $0xc,%esp
+    1879:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    187c:	6a 01                	push   $0x1
+    187e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1881:	52                   	push   %edx
+    1882:	57                   	push   %edi
+    1883:	e8 7b fd ff ff       	call   1603 <write>
+        putc(fd, c);
+    1888:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    188b:	31 d2                	xor    %edx,%edx
+    188d:	eb 8e                	jmp    181d <printf+0x4d>
+    188f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1890:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1893:	83 ec 0c             	sub    $0xc,%esp
+    1896:	b9 10 00 00 00       	mov    $0x10,%ecx
+    189b:	8b 13                	mov    (%ebx),%edx
+    189d:	6a 00                	push   $0x0
+    189f:	89 f8                	mov    %edi,%eax
+        ap++;
+    18a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    18a4:	e8 87 fe ff ff       	call   1730 <printint>
+        ap++;
+    18a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    18ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    18af:	31 d2                	xor    %edx,%edx
+    18b1:	e9 67 ff ff ff       	jmp    181d <printf+0x4d>
+    18b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    18c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    18c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    18c5:	83 c0 04             	add    $0x4,%eax
+    18c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    18cb:	85 db                	test   %ebx,%ebx
+    18cd:	0f 84 9d 00 00 00    	je     1970 <printf+0x1a0>
+        while(*s != 0){
+    18d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    18d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    18d8:	84 c0                	test   %al,%al
+    18da:	0f 84 3d ff ff ff    	je     181d <printf+0x4d>
+    18e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    18e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    18e6:	89 de                	mov    %ebx,%esi
+    18e8:	89 d3                	mov    %edx,%ebx
+    18ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    18f0:	83 ec 04             	sub    $0x4,%esp
+    18f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    18f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    18f9:	6a 01                	push   $0x1
+    18fb:	53                   	push   %ebx
+    18fc:	57                   	push   %edi
+    18fd:	e8 01 fd ff ff       	call   1603 <write>
+        while(*s != 0){
+    1902:	0f b6 06             	movzbl (%esi),%eax
+    1905:	83 c4 10             	add    $0x10,%esp
+    1908:	84 c0                	test   %al,%al
+    190a:	75 e4                	jne    18f0 <printf+0x120>
+      state = 0;
+    190c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    190f:	31 d2                	xor    %edx,%edx
+    1911:	e9 07 ff ff ff       	jmp    181d <printf+0x4d>
+    1916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    191d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1920:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1923:	83 ec 0c             	sub    $0xc,%esp
+    1926:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    192b:	8b 13                	mov    (%ebx),%edx
+    192d:	6a 01                	push   $0x1
+    192f:	e9 6b ff ff ff       	jmp    189f <printf+0xcf>
+    1934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1938:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    193b:	83 ec 04             	sub    $0x4,%esp
+    193e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1941:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1943:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1946:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1949:	6a 01                	push   $0x1
+    194b:	52                   	push   %edx
+    194c:	57                   	push   %edi
+    194d:	e8 b1 fc ff ff       	call   1603 <write>
+        ap++;
+    1952:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1955:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1958:	31 d2                	xor    %edx,%edx
+    195a:	e9 be fe ff ff       	jmp    181d <printf+0x4d>
+    195f:	90                   	nop
+  write(fd, &c, 1);
+    1960:	83 ec 04             	sub    $0x4,%esp
+    1963:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1966:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1969:	6a 01                	push   $0x1
+    196b:	e9 11 ff ff ff       	jmp    1881 <printf+0xb1>
+    1970:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1975:	bb 2e 1b 00 00       	mov    $0x1b2e,%ebx
+    197a:	e9 61 ff ff ff       	jmp    18e0 <printf+0x110>
+    197f:	90                   	nop
+
+00001980 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1980:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1981:	a1 20 23 00 00       	mov    0x2320,%eax
+{
+    1986:	89 e5                	mov    %esp,%ebp
+    1988:	57                   	push   %edi
+    1989:	56                   	push   %esi
+    198a:	53                   	push   %ebx
+    198b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    198e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1998:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    199a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    199c:	39 ca                	cmp    %ecx,%edx
+    199e:	73 30                	jae    19d0 <free+0x50>
+    19a0:	39 c1                	cmp    %eax,%ecx
+    19a2:	72 04                	jb     19a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    19a4:	39 c2                	cmp    %eax,%edx
+    19a6:	72 f0                	jb     1998 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    19a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    19ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    19ae:	39 f8                	cmp    %edi,%eax
+    19b0:	74 2e                	je     19e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    19b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    19b5:	8b 42 04             	mov    0x4(%edx),%eax
+    19b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    19bb:	39 f1                	cmp    %esi,%ecx
+    19bd:	74 38                	je     19f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    19bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    19c1:	5b                   	pop    %ebx
+  freep = p;
+    19c2:	89 15 20 23 00 00    	mov    %edx,0x2320
+}
+    19c8:	5e                   	pop    %esi
+    19c9:	5f                   	pop    %edi
+    19ca:	5d                   	pop    %ebp
+    19cb:	c3                   	ret
+    19cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    19d0:	39 c1                	cmp    %eax,%ecx
+    19d2:	72 d0                	jb     19a4 <free+0x24>
+    19d4:	eb c2                	jmp    1998 <free+0x18>
+    19d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    19e0:	03 70 04             	add    0x4(%eax),%esi
+    19e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    19e6:	8b 02                	mov    (%edx),%eax
+    19e8:	8b 00                	mov    (%eax),%eax
+    19ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    19ed:	8b 42 04             	mov    0x4(%edx),%eax
+    19f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    19f3:	39 f1                	cmp    %esi,%ecx
+    19f5:	75 c8                	jne    19bf <free+0x3f>
+    p->s.size += bp->s.size;
+    19f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    19fa:	89 15 20 23 00 00    	mov    %edx,0x2320
+    p->s.size += bp->s.size;
+    1a00:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1a03:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1a06:	89 0a                	mov    %ecx,(%edx)
+}
+    1a08:	5b                   	pop    %ebx
+    1a09:	5e                   	pop    %esi
+    1a0a:	5f                   	pop    %edi
+    1a0b:	5d                   	pop    %ebp
+    1a0c:	c3                   	ret
+    1a0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001a10 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1a10:	55                   	push   %ebp
+    1a11:	89 e5                	mov    %esp,%ebp
+    1a13:	57                   	push   %edi
+    1a14:	56                   	push   %esi
+    1a15:	53                   	push   %ebx
+    1a16:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1a19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    1a1c:	8b 15 20 23 00 00    	mov    0x2320,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1a22:	8d 78 07             	lea    0x7(%eax),%edi
+    1a25:	c1 ef 03             	shr    $0x3,%edi
+    1a28:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    1a2b:	85 d2                	test   %edx,%edx
+    1a2d:	0f 84 8d 00 00 00    	je     1ac0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1a33:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1a35:	8b 48 04             	mov    0x4(%eax),%ecx
+    1a38:	39 f9                	cmp    %edi,%ecx
+    1a3a:	73 64                	jae    1aa0 <malloc+0x90>
+  if(nu < 4096)
+    1a3c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1a41:	39 df                	cmp    %ebx,%edi
+    1a43:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1a46:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1a4d:	eb 0a                	jmp    1a59 <malloc+0x49>
+    1a4f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1a50:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1a52:	8b 48 04             	mov    0x4(%eax),%ecx
+    1a55:	39 f9                	cmp    %edi,%ecx
+    1a57:	73 47                	jae    1aa0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1a59:	89 c2                	mov    %eax,%edx
+    1a5b:	39 05 20 23 00 00    	cmp    %eax,0x2320
+    1a61:	75 ed                	jne    1a50 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1a63:	83 ec 0c             	sub    $0xc,%esp
+    1a66:	56                   	push   %esi
+    1a67:	e8 ff fb ff ff       	call   166b <sbrk>
+  if(p == (char*)-1)
+    1a6c:	83 c4 10             	add    $0x10,%esp
+    1a6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a72:	74 1c                	je     1a90 <malloc+0x80>
+  hp->s.size = nu;
+    1a74:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1a77:	83 ec 0c             	sub    $0xc,%esp
+    1a7a:	83 c0 08             	add    $0x8,%eax
+    1a7d:	50                   	push   %eax
+    1a7e:	e8 fd fe ff ff       	call   1980 <free>
+  return freep;
+    1a83:	8b 15 20 23 00 00    	mov    0x2320,%edx
+      if((p = morecore(nunits)) == 0)
+    1a89:	83 c4 10             	add    $0x10,%esp
+    1a8c:	85 d2                	test   %edx,%edx
+    1a8e:	75 c0                	jne    1a50 <malloc+0x40>
+        return 0;
+  }
+}
+    1a90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1a93:	31 c0                	xor    %eax,%eax
+}
+    1a95:	5b                   	pop    %ebx
+    1a96:	5e                   	pop    %esi
+    1a97:	5f                   	pop    %edi
+    1a98:	5d                   	pop    %ebp
+    1a99:	c3                   	ret
+    1a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1aa0:	39 cf                	cmp    %ecx,%edi
+    1aa2:	74 4c                	je     1af0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1aa4:	29 f9                	sub    %edi,%ecx
+    1aa6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1aa9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    1aac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    1aaf:	89 15 20 23 00 00    	mov    %edx,0x2320
+}
+    1ab5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1ab8:	83 c0 08             	add    $0x8,%eax
+}
+    1abb:	5b                   	pop    %ebx
+    1abc:	5e                   	pop    %esi
+    1abd:	5f                   	pop    %edi
+    1abe:	5d                   	pop    %ebp
+    1abf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1ac0:	c7 05 20 23 00 00 24 	movl   $0x2324,0x2320
+    1ac7:	23 00 00 
+    base.s.size = 0;
+    1aca:	b8 24 23 00 00       	mov    $0x2324,%eax
+    base.s.ptr = freep = prevp = &base;
+    1acf:	c7 05 24 23 00 00 24 	movl   $0x2324,0x2324
+    1ad6:	23 00 00 
+    base.s.size = 0;
+    1ad9:	c7 05 28 23 00 00 00 	movl   $0x0,0x2328
+    1ae0:	00 00 00 
+    if(p->s.size >= nunits){
+    1ae3:	e9 54 ff ff ff       	jmp    1a3c <malloc+0x2c>
+    1ae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1aef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1af0:	8b 08                	mov    (%eax),%ecx
+    1af2:	89 0a                	mov    %ecx,(%edx)
+    1af4:	eb b9                	jmp    1aaf <malloc+0x9f>
@@ -0,0 +1,1413 @@
+
+_grouptest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+// process should get about as much CPU as that process, however
+// many workers it has.
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	51                   	push   %ecx
+    1011:	81 ec 48 0b 00 00    	sub    $0xb48,%esp
+	int nworkers = 4;
+	int lone_pid, worker_pid[8];
+	int i, j;
+
+	if(argc > 1)
+    1017:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+    101a:	8b 41 04             	mov    0x4(%ecx),%eax
+	if(argc > 1)
+    101d:	0f 8f 80 00 00 00    	jg     10a3 <main+0xa3>
+	int nworkers = 4;
+    1023:	c7 85 a8 f4 ff ff 04 	movl   $0x4,-0xb58(%ebp)
+    102a:	00 00 00 
+		nworkers = atoi(argv[1]);
+	if(nworkers < 1 || nworkers > 8)
+		nworkers = 4;
+
+	settickets(100); //keep the parent responsive
+    102d:	83 ec 0c             	sub    $0xc,%esp
+    1030:	6a 64                	push   $0x64
+    1032:	e8 7c 04 00 00       	call   14b3 <settickets>
+
+	lone_pid = fork();
+    1037:	e8 cf 03 00 00       	call   140b <fork>
+	if(lone_pid == 0){
+    103c:	83 c4 10             	add    $0x10,%esp
+	lone_pid = fork();
+    103f:	89 85 b4 f4 ff ff    	mov    %eax,-0xb4c(%ebp)
+	if(lone_pid == 0){
+    1045:	85 c0                	test   %eax,%eax
+    1047:	75 0f                	jne    1058 <main+0x58>
+		settickets(30);
+    1049:	83 ec 0c             	sub    $0xc,%esp
+    104c:	6a 1e                	push   $0x1e
+    104e:	e8 60 04 00 00       	call   14b3 <settickets>
+    1053:	83 c4 10             	add    $0x10,%esp
+		for (;;);
+    1056:	eb fe                	jmp    1056 <main+0x56>
+	}
+
+	if(fork() == 0){
+    1058:	e8 ae 03 00 00       	call   140b <fork>
+    105d:	89 85 ac f4 ff ff    	mov    %eax,-0xb54(%ebp)
+    1063:	85 c0                	test   %eax,%eax
+    1065:	75 61                	jne    10c8 <main+0xc8>
+		if(mkgroup(30) < 0){
+    1067:	83 ec 0c             	sub    $0xc,%esp
+    106a:	6a 1e                	push   $0x1e
+    106c:	e8 92 04 00 00       	call   1503 <mkgroup>
+    1071:	83 c4 10             	add    $0x10,%esp
+    1074:	85 c0                	test   %eax,%eax
+    1076:	78 6d                	js     10e5 <main+0xe5>
+    1078:	8b 85 a8 f4 ff ff    	mov    -0xb58(%ebp),%eax
+    107e:	8d b5 c4 f4 ff ff    	lea    -0xb3c(%ebp),%esi
+    1084:	89 b5 b0 f4 ff ff    	mov    %esi,-0xb50(%ebp)
+    108a:	8d 1c 86             	lea    (%esi,%eax,4),%ebx
+    108d:	eb 07                	jmp    1096 <main+0x96>
+			printf(1, "mkgroup failed\n");
+			exit();
+		}
+		for(i = 0; i < nworkers; i++){
+    108f:	83 c6 04             	add    $0x4,%esi
+    1092:	39 de                	cmp    %ebx,%esi
+    1094:	74 62                	je     10f8 <main+0xf8>
+			worker_pid[i] = fork();
+    1096:	e8 70 03 00 00       	call   140b <fork>
+    109b:	89 06                	mov    %eax,(%esi)
+			if(worker_pid[i] == 0)
+    109d:	85 c0                	test   %eax,%eax
+    109f:	75 ee                	jne    108f <main+0x8f>
+				for (;;);
+    10a1:	eb fe                	jmp    10a1 <main+0xa1>
+		nworkers = atoi(argv[1]);
+    10a3:	83 ec 0c             	sub    $0xc,%esp
+    10a6:	ff 70 04             	push   0x4(%eax)
+    10a9:	e8 f2 02 00 00       	call   13a0 <atoi>
+	if(nworkers < 1 || nworkers > 8)
+    10ae:	83 c4 10             	add    $0x10,%esp
+		nworkers = atoi(argv[1]);
+    10b1:	89 85 a8 f4 ff ff    	mov    %eax,-0xb58(%ebp)
+	if(nworkers < 1 || nworkers > 8)
+    10b7:	83 e8 01             	sub    $0x1,%eax
+    10ba:	83 f8 07             	cmp    $0x7,%eax
+    10bd:	0f 87 60 ff ff ff    	ja     1023 <main+0x23>
+    10c3:	e9 65 ff ff ff       	jmp    102d <main+0x2d>
+			wait();
+		}
+		exit();
+	}
+
+	wait();
+    10c8:	e8 4e 03 00 00       	call   141b <wait>
+	kill(lone_pid);
+    10cd:	83 ec 0c             	sub    $0xc,%esp
+    10d0:	ff b5 b4 f4 ff ff    	push   -0xb4c(%ebp)
+    10d6:	e8 68 03 00 00       	call   1443 <kill>
+	wait();
+    10db:	e8 3b 03 00 00       	call   141b <wait>
+	exit();
+    10e0:	e8 2e 03 00 00       	call   1413 <exit>
+			printf(1, "mkgroup failed\n");
+    10e5:	57                   	push   %edi
+    10e6:	57                   	push   %edi
+    10e7:	68 28 19 00 00       	push   $0x1928
+    10ec:	6a 01                	push   $0x1
+    10ee:	e8 0d 05 00 00       	call   1600 <printf>
+			exit();
+    10f3:	e8 1b 03 00 00       	call   1413 <exit>
+		sleep(500);
+    10f8:	83 ec 0c             	sub    $0xc,%esp
+		st.next = 0;
+    10fb:	31 f6                	xor    %esi,%esi
+    10fd:	8d bd e4 f5 ff ff    	lea    -0xa1c(%ebp),%edi
+		sleep(500);
+    1103:	68 f4 01 00 00       	push   $0x1f4
+    1108:	e8 96 03 00 00       	call   14a3 <sleep>
+		st.next = 0;
+    110d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    1110:	83 c4 10             	add    $0x10,%esp
+		int lone_ticks = 0, group_ticks = 0;
+    1113:	31 f6                	xor    %esi,%esi
+			getpinfo(&st);
+    1115:	83 ec 0c             	sub    $0xc,%esp
+    1118:	8d 85 e4 f4 ff ff    	lea    -0xb1c(%ebp),%eax
+    111e:	50                   	push   %eax
+    111f:	e8 97 03 00 00       	call   14bb <getpinfo>
+			for (j = 0; j < sizeof(st.pid)/sizeof(st.pid[0]); j++){
+    1124:	8d 95 e4 f4 ff ff    	lea    -0xb1c(%ebp),%edx
+    112a:	83 c4 10             	add    $0x10,%esp
+    112d:	eb 08                	jmp    1137 <main+0x137>
+    112f:	90                   	nop
+    1130:	83 c2 04             	add    $0x4,%edx
+    1133:	39 fa                	cmp    %edi,%edx
+    1135:	74 41                	je     1178 <main+0x178>
+				if(!st.inuse[j])
+    1137:	8b 0a                	mov    (%edx),%ecx
+    1139:	85 c9                	test   %ecx,%ecx
+    113b:	74 f3                	je     1130 <main+0x130>
+				if(st.pid[j] == lone_pid)
+    113d:	8b 8a 00 02 00 00    	mov    0x200(%edx),%ecx
+    1143:	8b 85 b4 f4 ff ff    	mov    -0xb4c(%ebp),%eax
+    1149:	39 c1                	cmp    %eax,%ecx
+    114b:	75 0c                	jne    1159 <main+0x159>
+					lone_ticks = st.ticks[j];
+    114d:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+    1153:	89 85 ac f4 ff ff    	mov    %eax,-0xb54(%ebp)
+		int lone_ticks = 0, group_ticks = 0;
+    1159:	8b 85 b0 f4 ff ff    	mov    -0xb50(%ebp),%eax
+    115f:	90                   	nop
+					if(st.pid[j] == worker_pid[i])
+    1160:	3b 08                	cmp    (%eax),%ecx
+    1162:	75 06                	jne    116a <main+0x16a>
+						group_ticks += st.ticks[j];
+    1164:	03 b2 00 03 00 00    	add    0x300(%edx),%esi
+				for(i = 0; i < nworkers; i++)
+    116a:	83 c0 04             	add    $0x4,%eax
+    116d:	39 d8                	cmp    %ebx,%eax
+    116f:	75 ef                	jne    1160 <main+0x160>
+			for (j = 0; j < sizeof(st.pid)/sizeof(st.pid[0]); j++){
+    1171:	83 c2 04             	add    $0x4,%edx
+    1174:	39 fa                	cmp    %edi,%edx
+    1176:	75 bf                	jne    1137 <main+0x137>
+		} while(st.next);
+    1178:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    117b:	85 c0                	test   %eax,%eax
+    117d:	75 96                	jne    1115 <main+0x115>
+		printf(1, "lone process: %d ticks, group of %d: %d ticks\n", lone_ticks, nworkers, group_ticks);
+    117f:	83 ec 0c             	sub    $0xc,%esp
+    1182:	56                   	push   %esi
+    1183:	ff b5 a8 f4 ff ff    	push   -0xb58(%ebp)
+    1189:	ff b5 ac f4 ff ff    	push   -0xb54(%ebp)
+    118f:	68 38 19 00 00       	push   $0x1938
+    1194:	6a 01                	push   $0x1
+    1196:	e8 65 04 00 00       	call   1600 <printf>
+    119b:	8b b5 b0 f4 ff ff    	mov    -0xb50(%ebp),%esi
+    11a1:	83 c4 20             	add    $0x20,%esp
+			kill(worker_pid[i]);
+    11a4:	83 ec 0c             	sub    $0xc,%esp
+    11a7:	ff 36                	push   (%esi)
+		for(i = 0; i < nworkers; i++){
+    11a9:	83 c6 04             	add    $0x4,%esi
+			kill(worker_pid[i]);
+    11ac:	e8 92 02 00 00       	call   1443 <kill>
+			wait();
+    11b1:	e8 65 02 00 00       	call   141b <wait>
+		for(i = 0; i < nworkers; i++){
+    11b6:	83 c4 10             	add    $0x10,%esp
+    11b9:	39 de                	cmp    %ebx,%esi
+    11bb:	75 e7                	jne    11a4 <main+0x1a4>
+		exit();
+    11bd:	e8 51 02 00 00       	call   1413 <exit>
+    11c2:	66 90                	xchg   %ax,%ax
+    11c4:	66 90                	xchg   %ax,%ax
+    11c6:	66 90                	xchg   %ax,%ax
+    11c8:	66 90                	xchg   %ax,%ax
+    11ca:	66 90                	xchg   %ax,%ax
+    11cc:	66 90                	xchg   %ax,%ax
+    11ce:	66 90                	xchg   %ax,%ax
+
+000011d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    11d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    11d1:	31 c0                	xor    %eax,%eax
+{
+    11d3:	89 e5                	mov    %esp,%ebp
+    11d5:	53                   	push   %ebx
+    11d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    11d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    11dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    11e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    11e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    11e7:	83 c0 01             	add    $0x1,%eax
+    11ea:	84 d2                	test   %dl,%dl
+    11ec:	75 f2                	jne    11e0 <strcpy+0x10>
+    ;
+  return os;
+}
+    11ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11f1:	89 c8                	mov    %ecx,%eax
+    11f3:	c9                   	leave
+    11f4:	c3                   	ret
+    11f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001200 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	53                   	push   %ebx
+    1204:	8b 55 08             	mov    0x8(%ebp),%edx
+    1207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    120a:	0f b6 02             	movzbl (%edx),%eax
+    120d:	84 c0                	test   %al,%al
+    120f:	75 17                	jne    1228 <strcmp+0x28>
+    1211:	eb 3a                	jmp    124d <strcmp+0x4d>
+    1213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1217:	90                   	nop
+    1218:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    121c:	83 c2 01             	add    $0x1,%edx
+    121f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1222:	84 c0                	test   %al,%al
+    1224:	74 1a                	je     1240 <strcmp+0x40>
+    p++, q++;
+    1226:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1228:	0f b6 19             	movzbl (%ecx),%ebx
+    122b:	38 c3                	cmp    %al,%bl
+    122d:	74 e9                	je     1218 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    122f:	29 d8                	sub    %ebx,%eax
+}
+    1231:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1234:	c9                   	leave
+    1235:	c3                   	ret
+    1236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1240:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1244:	31 c0                	xor    %eax,%eax
+    1246:	29 d8                	sub    %ebx,%eax
+}
+    1248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    124b:	c9                   	leave
+    124c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    124d:	0f b6 19             	movzbl (%ecx),%ebx
+    1250:	31 c0                	xor    %eax,%eax
+    1252:	eb db                	jmp    122f <strcmp+0x2f>
+    1254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    125f:	90                   	nop
+
+00001260 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1266:	80 3a 00             	cmpb   $0x0,(%edx)
+    1269:	74 15                	je     1280 <strlen+0x20>
+    126b:	31 c0                	xor    %eax,%eax
+    126d:	8d 76 00             	lea    0x0(%esi),%esi
+    1270:	83 c0 01             	add    $0x1,%eax
+    1273:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1277:	89 c1                	mov    %eax,%ecx
+    1279:	75 f5                	jne    1270 <strlen+0x10>
+    ;
+  return n;
+}
+    127b:	89 c8                	mov    %ecx,%eax
+    127d:	5d                   	pop    %ebp
+    127e:	c3                   	ret
+    127f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1280:	31 c9                	xor    %ecx,%ecx
+}
+    1282:	5d                   	pop    %ebp
+    1283:	89 c8                	mov    %ecx,%eax
+    1285:	c3                   	ret
+    1286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001290 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	57                   	push   %edi
+    1294:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1297:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    129a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    129d:	89 d7                	mov    %edx,%edi
+    129f:	fc                   	cld
+    12a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    12a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    12a5:	89 d0                	mov    %edx,%eax
+    12a7:	c9                   	leave
+    12a8:	c3                   	ret
+    12a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000012b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	8b 45 08             	mov    0x8(%ebp),%eax
+    12b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    12ba:	0f b6 10             	movzbl (%eax),%edx
+    12bd:	84 d2                	test   %dl,%dl
+    12bf:	75 12                	jne    12d3 <strchr+0x23>
+    12c1:	eb 1d                	jmp    12e0 <strchr+0x30>
+    12c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12c7:	90                   	nop
+    12c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    12cc:	83 c0 01             	add    $0x1,%eax
+    12cf:	84 d2                	test   %dl,%dl
+    12d1:	74 0d                	je     12e0 <strchr+0x30>
+    if(*s == c)
+    12d3:	38 d1                	cmp    %dl,%cl
+    12d5:	75 f1                	jne    12c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    12d7:	5d                   	pop    %ebp
+    12d8:	c3                   	ret
+    12d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    12e0:	31 c0                	xor    %eax,%eax
+}
+    12e2:	5d                   	pop    %ebp
+    12e3:	c3                   	ret
+    12e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12ef:	90                   	nop
+
+000012f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    12f0:	55                   	push   %ebp
+    12f1:	89 e5                	mov    %esp,%ebp
+    12f3:	57                   	push   %edi
+    12f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    12f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    12f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    12f9:	31 db                	xor    %ebx,%ebx
+{
+    12fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    12fe:	eb 27                	jmp    1327 <gets+0x37>
+    cc = read(0, &c, 1);
+    1300:	83 ec 04             	sub    $0x4,%esp
+    1303:	6a 01                	push   $0x1
+    1305:	56                   	push   %esi
+    1306:	6a 00                	push   $0x0
+    1308:	e8 1e 01 00 00       	call   142b <read>
+    if(cc < 1)
+    130d:	83 c4 10             	add    $0x10,%esp
+    1310:	85 c0                	test   %eax,%eax
+    1312:	7e 1d                	jle    1331 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1314:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1318:	8b 55 08             	mov    0x8(%ebp),%edx
+    131b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    131f:	3c 0a                	cmp    $0xa,%al
+    1321:	74 10                	je     1333 <gets+0x43>
+    1323:	3c 0d                	cmp    $0xd,%al
+    1325:	74 0c                	je     1333 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1327:	89 df                	mov    %ebx,%edi
+    1329:	83 c3 01             	add    $0x1,%ebx
+    132c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    132f:	7c cf                	jl     1300 <gets+0x10>
+    1331:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1333:	8b 45 08             	mov    0x8(%ebp),%eax
+    1336:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    133a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    133d:	5b                   	pop    %ebx
+    133e:	5e                   	pop    %esi
+    133f:	5f                   	pop    %edi
+    1340:	5d                   	pop    %ebp
+    1341:	c3                   	ret
+    1342:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001350 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1350:	55                   	push   %ebp
+    1351:	89 e5                	mov    %esp,%ebp
+    1353:	56                   	push   %esi
+    1354:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1355:	83 ec 08             	sub    $0x8,%esp
+    1358:	6a 00                	push   $0x0
+    135a:	ff 75 08             	push   0x8(%ebp)
+    135d:	e8 f1 00 00 00       	call   1453 <open>
+  if(fd < 0)
+    1362:	83 c4 10             	add    $0x10,%esp
+    1365:	85 c0                	test   %eax,%eax
+    1367:	78 27                	js     1390 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1369:	83 ec 08             	sub    $0x8,%esp
+    136c:	ff 75 0c             	push   0xc(%ebp)
+    136f:	89 c3                	mov    %eax,%ebx
+    1371:	50                   	push   %eax
+    1372:	e8 f4 00 00 00       	call   146b <fstat>
+  close(fd);
+    1377:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    137a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    137c:	e8 ba 00 00 00       	call   143b <close>
+  return r;
+    1381:	83 c4 10             	add    $0x10,%esp
+}
+    1384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1387:	89 f0                	mov    %esi,%eax
+    1389:	5b                   	pop    %ebx
+    138a:	5e                   	pop    %esi
+    138b:	5d                   	pop    %ebp
+    138c:	c3                   	ret
+    138d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1390:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1395:	eb ed                	jmp    1384 <stat+0x34>
+    1397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    139e:	66 90                	xchg   %ax,%ax
+
+000013a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    13a0:	55                   	push   %ebp
+    13a1:	89 e5                	mov    %esp,%ebp
+    13a3:	53                   	push   %ebx
+    13a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    13a7:	0f be 02             	movsbl (%edx),%eax
+    13aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    13ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    13b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    13b5:	77 1e                	ja     13d5 <atoi+0x35>
+    13b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    13c0:	83 c2 01             	add    $0x1,%edx
+    13c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    13c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    13ca:	0f be 02             	movsbl (%edx),%eax
+    13cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    13d0:	80 fb 09             	cmp    $0x9,%bl
+    13d3:	76 eb                	jbe    13c0 <atoi+0x20>
+  return n;
+}
+    13d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13d8:	89 c8                	mov    %ecx,%eax
+    13da:	c9                   	leave
+    13db:	c3                   	ret
+    13dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000013e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	57                   	push   %edi
+    13e4:	56                   	push   %esi
+    13e5:	8b 45 10             	mov    0x10(%ebp),%eax
+    13e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    13eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    13ee:	85 c0                	test   %eax,%eax
+    13f0:	7e 13                	jle    1405 <memmove+0x25>
+    13f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    13f4:	89 d7                	mov    %edx,%edi
+    13f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1400:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1401:	39 f8                	cmp    %edi,%eax
+    1403:	75 fb                	jne    1400 <memmove+0x20>
+  return vdst;
+}
+    1405:	5e                   	pop    %esi
+    1406:	89 d0                	mov    %edx,%eax
+    1408:	5f                   	pop    %edi
+    1409:	5d                   	pop    %ebp
+    140a:	c3                   	ret
+
+0000140b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    140b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1410:	cd 40                	int    $0x40
+    1412:	c3                   	ret
+
+00001413 <exit>:
+SYSCALL(exit)
+    1413:	b8 02 00 00 00       	mov    $0x2,%eax
+    1418:	cd 40                	int    $0x40
+    141a:	c3                   	ret
+
+0000141b <wait>:
+SYSCALL(wait)
+    141b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1420:	cd 40                	int    $0x40
+    1422:	c3                   	ret
+
+00001423 <pipe>:
+SYSCALL(pipe)
+    1423:	b8 04 00 00 00       	mov    $0x4,%eax
+    1428:	cd 40                	int    $0x40
+    142a:	c3                   	ret
+
+0000142b <read>:
+SYSCALL(read)
+    142b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1430:	cd 40                	int    $0x40
+    1432:	c3                   	ret
+
+00001433 <write>:
+SYSCALL(write)
+    1433:	b8 10 00 00 00       	mov    $0x10,%eax
+    1438:	cd 40                	int    $0x40
+    143a:	c3                   	ret
+
+0000143b <close>:
+SYSCALL(close)
+    143b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1440:	cd 40                	int    $0x40
+    1442:	c3                   	ret
+
+00001443 <kill>:
+SYSCALL(kill)
+    1443:	b8 06 00 00 00       	mov    $0x6,%eax
+    1448:	cd 40                	int    $0x40
+    144a:	c3                   	ret
+
+0000144b <exec>:
+SYSCALL(exec)
+    144b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1450:	cd 40                	int    $0x40
+    1452:	c3                   	ret
+
+00001453 <open>:
+SYSCALL(open)
+    1453:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1458:	cd 40                	int    $0x40
+    145a:	c3                   	ret
+
+0000145b <mknod>:
+SYSCALL(mknod)
+    145b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1460:	cd 40                	int    $0x40
+    1462:	c3                   	ret
+
+00001463 <unlink>:
+SYSCALL(unlink)
+    1463:	b8 12 00 00 00       	mov    $0x12,%eax
+    1468:	cd 40                	int    $0x40
+    146a:	c3                   	ret
+
+0000146b <fstat>:
+SYSCALL(fstat)
+    146b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1470:	cd 40                	int    $0x40
+    1472:	c3                   	ret
+
+00001473 <link>:
+SYSCALL(link)
+    1473:	b8 13 00 00 00       	mov    $0x13,%eax
+    1478:	cd 40                	int    $0x40
+    147a:	c3                   	ret
+
+0000147b <mkdir>:
+SYSCALL(mkdir)
+    147b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1480:	cd 40                	int    $0x40
+    1482:	c3                   	ret
+
+00001483 <chdir>:
+SYSCALL(chdir)
+    1483:	b8 09 00 00 00       	mov    $0x9,%eax
+    1488:	cd 40                	int    $0x40
+    148a:	c3                   	ret
+
+0000148b <dup>:
+SYSCALL(dup)
+    148b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1490:	cd 40                	int    $0x40
+    1492:	c3                   	ret
+
+00001493 <getpid>:
+SYSCALL(getpid)
+    1493:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1498:	cd 40                	int    $0x40
+    149a:	c3                   	ret
+
+0000149b <sbrk>:
+SYSCALL(sbrk)
+    149b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    14a0:	cd 40                	int    $0x40
+    14a2:	c3                   	ret
+
+000014a3 <sleep>:
+SYSCALL(sleep)
+    14a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    14a8:	cd 40                	int    $0x40
+    14aa:	c3                   	ret
+
+000014ab <uptime>:
+SYSCALL(uptime)
+    14ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+    14b0:	cd 40                	int    $0x40
+    14b2:	c3                   	ret
+
+000014b3 <settickets>:
+SYSCALL(settickets)
+    14b3:	b8 16 00 00 00       	mov    $0x16,%eax
+    14b8:	cd 40                	int    $0x40
+    14ba:	c3                   	ret
+
+000014bb <getpinfo>:
+SYSCALL(getpinfo)
+    14bb:	b8 17 00 00 00       	mov    $0x17,%eax
+    14c0:	cd 40                	int    $0x40
+    14c2:	c3                   	ret
+
+000014c3 <mprotect>:
+SYSCALL(mprotect)
+    14c3:	b8 18 00 00 00       	mov    $0x18,%eax
+    14c8:	cd 40                	int    $0x40
+    14ca:	c3                   	ret
+
+000014cb <munprotect>:
+SYSCALL(munprotect)
+    14cb:	b8 19 00 00 00       	mov    $0x19,%eax
+    14d0:	cd 40                	int    $0x40
+    14d2:	c3                   	ret
+
+000014d3 <clone>:
+SYSCALL(clone)
+    14d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    14d8:	cd 40                	int    $0x40
+    14da:	c3                   	ret
+
+000014db <join>:
+SYSCALL(join)
+    14db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    14e0:	cd 40                	int    $0x40
+    14e2:	c3                   	ret
+
+000014e3 <initlock_t>:
+SYSCALL(initlock_t)
+    14e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    14e8:	cd 40                	int    $0x40
+    14ea:	c3                   	ret
+
+000014eb <acquire_t>:
+SYSCALL(acquire_t)
+    14eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    14f0:	cd 40                	int    $0x40
+    14f2:	c3                   	ret
+
+000014f3 <release_t>:
+SYSCALL(release_t)
+    14f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    14f8:	cd 40                	int    $0x40
+    14fa:	c3                   	ret
+
+000014fb <setsched>:
+SYSCALL(setsched)
+    14fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1500:	cd 40                	int    $0x40
+    1502:	c3                   	ret
+
+00001503 <mkgroup>:
+SYSCALL(mkgroup)
+    1503:	b8 20 00 00 00       	mov    $0x20,%eax
+    1508:	cd 40                	int    $0x40
+    150a:	c3                   	ret
+
+0000150b <joingroup>:
+SYSCALL(joingroup)
+    150b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1510:	cd 40                	int    $0x40
+    1512:	c3                   	ret
+
+00001513 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1513:	b8 22 00 00 00       	mov    $0x22,%eax
+    1518:	cd 40                	int    $0x40
+    151a:	c3                   	ret
+
+0000151b <setdeadline>:
+SYSCALL(setdeadline)
+    151b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1520:	cd 40                	int    $0x40
+    1522:	c3                   	ret
+
+00001523 <setaffinity>:
+SYSCALL(setaffinity)
+    1523:	b8 24 00 00 00       	mov    $0x24,%eax
+    1528:	cd 40                	int    $0x40
+    152a:	c3                   	ret
+
+0000152b <yield_to>:
+SYSCALL(yield_to)
+    152b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1530:	cd 40                	int    $0x40
+    1532:	c3                   	ret
+
+00001533 <getlatency>:
+SYSCALL(getlatency)
+    1533:	b8 26 00 00 00       	mov    $0x26,%eax
+    1538:	cd 40                	int    $0x40
+    153a:	c3                   	ret
+
+0000153b <futex_wait>:
+SYSCALL(futex_wait)
+    153b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1540:	cd 40                	int    $0x40
+    1542:	c3                   	ret
+
+00001543 <futex_wake>:
+SYSCALL(futex_wake)
+    1543:	b8 28 00 00 00       	mov    $0x28,%eax
+    1548:	cd 40                	int    $0x40
+    154a:	c3                   	ret
+
+0000154b <mguard>:
+SYSCALL(mguard)
+    154b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1550:	cd 40                	int    $0x40
+    1552:	c3                   	ret
+
+00001553 <join_any>:
+SYSCALL(join_any)
+    1553:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1558:	cd 40                	int    $0x40
+    155a:	c3                   	ret
+    155b:	66 90                	xchg   %ax,%ax
+    155d:	66 90                	xchg   %ax,%ax
+    155f:	90                   	nop
+
+00001560 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1560:	55                   	push   %ebp
+    1561:	89 e5                	mov    %esp,%ebp
+    1563:	57                   	push   %edi
+    1564:	56                   	push   %esi
+    1565:	53                   	push   %ebx
+    1566:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1568:	89 d1                	mov    %edx,%ecx
+{
+    156a:	83 ec 3c             	sub    $0x3c,%esp
+    156d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1570:	85 d2                	test   %edx,%edx
+    1572:	0f 89 80 00 00 00    	jns    15f8 <printint+0x98>
+    1578:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    157c:	74 7a                	je     15f8 <printint+0x98>
+    x = -xx;
+    157e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1580:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1585:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1588:	31 f6                	xor    %esi,%esi
+    158a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1590:	89 c8                	mov    %ecx,%eax
+    1592:	31 d2                	xor    %edx,%edx
+    1594:	89 f7                	mov    %esi,%edi
+    1596:	f7 f3                	div    %ebx
+    1598:	8d 76 01             	lea    0x1(%esi),%esi
+    159b:	0f b6 92 c8 19 00 00 	movzbl 0x19c8(%edx),%edx
+    15a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    15a6:	89 ca                	mov    %ecx,%edx
+    15a8:	89 c1                	mov    %eax,%ecx
+    15aa:	39 da                	cmp    %ebx,%edx
+    15ac:	73 e2                	jae    1590 <printint+0x30>
+  if(neg)
+    15ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    15b1:	85 c0                	test   %eax,%eax
+    15b3:	74 07                	je     15bc <printint+0x5c>
+    buf[i++] = '-';
+    15b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    15ba:	89 f7                	mov    %esi,%edi
+    15bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    15bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    15c2:	01 df                	add    %ebx,%edi
+    15c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    15c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    15cb:	83 ec 04             	sub    $0x4,%esp
+    15ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+    15d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    15d4:	6a 01                	push   $0x1
+    15d6:	50                   	push   %eax
+    15d7:	56                   	push   %esi
+    15d8:	e8 56 fe ff ff       	call   1433 <write>
+  while(--i >= 0)
+    15dd:	89 f8                	mov    %edi,%eax
+    15df:	83 c4 10             	add    $0x10,%esp
+    15e2:	83 ef 01             	sub    $0x1,%edi
+    15e5:	39 d8                	cmp    %ebx,%eax
+    15e7:	75 df                	jne    15c8 <printint+0x68>
+}
+    15e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15ec:	5b                   	pop    %ebx
+    15ed:	5e                   	pop    %esi
+    15ee:	5f                   	pop    %edi
+    15ef:	5d                   	pop    %ebp
+    15f0:	c3                   	ret
+    15f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    15f8:	31 c0                	xor    %eax,%eax
+    15fa:	eb 89                	jmp    1585 <printint+0x25>
+    15fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001600 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1600:	55                   	push   %ebp
+    1601:	89 e5                	mov    %esp,%ebp
+    1603:	57                   	push   %edi
+    1604:	56                   	push   %esi
+    1605:	53                   	push   %ebx
+    1606:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1609:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    160c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    160f:	0f b6 1e             	movzbl (%esi),%ebx
+    1612:	83 c6 01             	add    $0x1,%esi
+    1615:	84 db                	test   %bl,%bl
+    1617:	74 67                	je     1680 <printf+0x80>
+    1619:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    161c:	31 d2                	xor    %edx,%edx
+    161e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1621:	eb 34                	jmp    1657 <printf+0x57>
+    1623:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1627:	90                   	nop
+    1628:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    162b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1630:	83 f8 25             	cmp    $0x25,%eax
+    1633:	74 18                	je     164d <printf+0x4d>
+  write(fd, &c, 1);
+    1635:	83 ec 04             	sub    $0x4,%esp
+    1638:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    163b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    163e:	6a 01                	push   $0x1
+    1640:	50                   	push   %eax
+    1641:	57                   	push   %edi
+    1642:	e8 ec fd ff ff       	call   1433 <write>
+    1647:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    164a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    164d:	0f b6 1e             	movzbl (%esi),%ebx
+    1650:	83 c6 01             	add    $0x1,%esi
+    1653:	84 db                	test   %bl,%bl
+    1655:	74 29                	je     1680 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1657:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    165a:	85 d2                	test   %edx,%edx
+    165c:	74 ca                	je     1628 <printf+0x28>
+      }
+    } else if(state == '%'){
+    165e:	83 fa 25             	cmp    $0x25,%edx
+    1661:	75 ea                	jne    164d <printf+0x4d>
+      if(c == 'd'){
+    1663:	83 f8 25             	cmp    $0x25,%eax
+    1666:	0f 84 24 01 00 00    	je     1790 <printf+0x190>
+    166c:	83 e8 63             	sub    $0x63,%eax
+    166f:	83 f8 15             	cmp    $0x15,%eax
+    1672:	77 1c                	ja     1690 <printf+0x90>
+    1674:	ff 24 85 70 19 00 00 	jmp    *0x1970(,%eax,4)
+    167b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    167f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1683:	5b                   	pop    %ebx
+    1684:	5e                   	pop    %esi
+    1685:	5f                   	pop    %edi
+    1686:	5d                   	pop    %ebp
+    1687:	c3                   	ret
+    1688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    168f:	90                   	nop
+  write(fd, &c, 1);
+    1690:	83 ec 04             	sub    $0x4,%esp
+    1693:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1696:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    169a:	6a 01                	push   $0x1
+    169c:	52                   	push   %edx
+    169d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    16a0:	57                   	push   %edi
+    16a1:	e8 8d fd ff ff       	call   1433 <write>
+    16a6:	83 c4 0c             	add    $0xc,%esp
+    16a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    16ac:	6a 01                	push   $0x1
+    16ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    16b1:	52                   	push   %edx
+    16b2:	57                   	push   %edi
+    16b3:	e8 7b fd ff ff       	call   1433 <write>
+        putc(fd, c);
+    16b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    16bb:	31 d2                	xor    %edx,%edx
+    16bd:	eb 8e                	jmp    164d <printf+0x4d>
+    16bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    16c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    16c3:	83 ec 0c             	sub    $0xc,%esp
+    16c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    16cb:	8b 13                	mov    (%ebx),%edx
+    16cd:	6a 00                	push   $0x0
+    16cf:	89 f8                	mov    %edi,%eax
+        ap++;
+    16d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    16d4:	e8 87 fe ff ff       	call   1560 <printint>
+        ap++;
+    16d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    16dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    16df:	31 d2                	xor    %edx,%edx
+    16e1:	e9 67 ff ff ff       	jmp    164d <printf+0x4d>
+    16e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    16f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    16f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    16f5:	83 c0 04             	add    $0x4,%eax
+    16f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    16fb:	85 db                	test   %ebx,%ebx
+    16fd:	0f 84 9d 00 00 00    	je     17a0 <printf+0x1a0>
+        while(*s != 0){
+    1703:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1706:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1708:	84 c0                	test   %al,%al
+    170a:	0f 84 3d ff ff ff    	je     164d <printf+0x4d>
+    1710:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1713:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1716:	89 de                	mov    %ebx,%esi
+    1718:	89 d3                	mov    %edx,%ebx
+    171a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1720:	83 ec 04             	sub    $0x4,%esp
+    1723:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1726:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1729:	6a 01                	push   $0x1
+    172b:	53                   	push   %ebx
+    172c:	57                   	push   %edi
+    172d:	e8 01 fd ff ff       	call   1433 <write>
+        while(*s != 0){
+    1732:	0f b6 06             	movzbl (%esi),%eax
+    1735:	83 c4 10             	add    $0x10,%esp
+    1738:	84 c0                	test   %al,%al
+    173a:	75 e4                	jne    1720 <printf+0x120>
+      state = 0;
+    173c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    173f:	31 d2                	xor    %edx,%edx
+    1741:	e9 07 ff ff ff       	jmp    164d <printf+0x4d>
+    1746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    174d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1750:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1753:	83 ec 0c             	sub    $0xc,%esp
+    1756:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    175b:	8b 13                	mov    (%ebx),%edx
+    175d:	6a 01                	push   $0x1
+    175f:	e9 6b ff ff ff       	jmp    16cf <printf+0xcf>
+    1764:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1768:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    176b:	83 ec 04             	sub    $0x4,%esp
+    176e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1771:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1773:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1776:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1779:	6a 01                	push   $0x1
+    177b:	52                   	push   %edx
+    177c:	57                   	push   %edi
+    177d:	e8 b1 fc ff ff       	call   1433 <write>
+        ap++;
+    1782:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1785:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1788:	31 d2                	xor    %edx,%edx
+    178a:	e9 be fe ff ff       	jmp    164d <printf+0x4d>
+    178f:	90                   	nop
+  write(fd, &c, 1);
+    1790:	83 ec 04             	sub    $0x4,%esp
+    1793:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1796:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1799:	6a 01                	push   $0x1
+    179b:	e9 11 ff ff ff       	jmp    16b1 <printf+0xb1>
+    17a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    17a5:	bb 67 19 00 00       	mov    $0x1967,%ebx
+    17aa:	e9 61 ff ff ff       	jmp    1710 <printf+0x110>
+    17af:	90                   	nop
+
+000017b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    17b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17b1:	a1 70 1c 00 00       	mov    0x1c70,%eax
+{
+    17b6:	89 e5                	mov    %esp,%ebp
+    17b8:	57                   	push   %edi
+    17b9:	56                   	push   %esi
+    17ba:	53                   	push   %ebx
+    17bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    17be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17cc:	39 ca                	cmp    %ecx,%edx
+    17ce:	73 30                	jae    1800 <free+0x50>
+    17d0:	39 c1                	cmp    %eax,%ecx
+    17d2:	72 04                	jb     17d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17d4:	39 c2                	cmp    %eax,%edx
+    17d6:	72 f0                	jb     17c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    17d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    17db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    17de:	39 f8                	cmp    %edi,%eax
+    17e0:	74 2e                	je     1810 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    17e5:	8b 42 04             	mov    0x4(%edx),%eax
+    17e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    17eb:	39 f1                	cmp    %esi,%ecx
+    17ed:	74 38                	je     1827 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    17ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    17f1:	5b                   	pop    %ebx
+  freep = p;
+    17f2:	89 15 70 1c 00 00    	mov    %edx,0x1c70
+}
+    17f8:	5e                   	pop    %esi
+    17f9:	5f                   	pop    %edi
+    17fa:	5d                   	pop    %ebp
+    17fb:	c3                   	ret
+    17fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1800:	39 c1                	cmp    %eax,%ecx
+    1802:	72 d0                	jb     17d4 <free+0x24>
+    1804:	eb c2                	jmp    17c8 <free+0x18>
+    1806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    180d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1810:	03 70 04             	add    0x4(%eax),%esi
+    1813:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1816:	8b 02                	mov    (%edx),%eax
+    1818:	8b 00                	mov    (%eax),%eax
+    181a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    181d:	8b 42 04             	mov    0x4(%edx),%eax
+    1820:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1823:	39 f1                	cmp    %esi,%ecx
+    1825:	75 c8                	jne    17ef <free+0x3f>
+    p->s.size += bp->s.size;
+    1827:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    182a:	89 15 70 1c 00 00    	mov    %edx,0x1c70
+    p->s.size += bp->s.size;
+    1830:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1833:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1836:	89 0a                	mov    %ecx,(%edx)
+}
+    1838:	5b                   	pop    %ebx
+    1839:	5e                   	pop    %esi
+    183a:	5f                   	pop    %edi
+    183b:	5d                   	pop    %ebp
+    183c:	c3                   	ret
+    183d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001840 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1840:	55                   	push   %ebp
+    1841:	89 e5                	mov    %esp,%ebp
+    1843:	57                   	push   %edi
+    1844:	56                   	push   %esi
+    1845:	53                   	push   %ebx
+    1846:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1849:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    184c:	8b 15 70 1c 00 00    	mov    0x1c70,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1852:	8d 78 07             	lea    0x7(%eax),%edi
+    1855:	c1 ef 03             	shr    $0x3,%edi
+    1858:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    185b:	85 d2                	test   %edx,%edx
+    185d:	0f 84 8d 00 00 00    	je     18f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1863:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1865:	8b 48 04             	mov    0x4(%eax),%ecx
+    1868:	39 f9                	cmp    %edi,%ecx
+    186a:	73 64                	jae    18d0 <malloc+0x90>
+  if(nu < 4096)
+    186c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1871:	39 df                	cmp    %ebx,%edi
+    1873:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1876:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    187d:	eb 0a                	jmp    1889 <malloc+0x49>
+    187f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1880:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1882:	8b 48 04             	mov    0x4(%eax),%ecx
+    1885:	39 f9                	cmp    %edi,%ecx
+    1887:	73 47                	jae    18d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1889:	89 c2                	mov    %eax,%edx
+    188b:	39 05 70 1c 00 00    	cmp    %eax,0x1c70
+    1891:	75 ed                	jne    1880 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1893:	83 ec 0c             	sub    $0xc,%esp
+    1896:	56                   	push   %esi
+    1897:	e8 ff fb ff ff       	call   149b <sbrk>
+  if(p == (char*)-1)
+    189c:	83 c4 10             	add    $0x10,%esp
+    189f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    18a2:	74 1c                	je     18c0 <malloc+0x80>
+  hp->s.size = nu;
+    18a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    18a7:	83 ec 0c             	sub    $0xc,%esp
+    18aa:	83 c0 08             	add    $0x8,%eax
+    18ad:	50                   	push   %eax
+    18ae:	e8 fd fe ff ff       	call   17b0 <free>
+  return freep;
+    18b3:	8b 15 70 1c 00 00    	mov    0x1c70,%edx
+      if((p = morecore(nunits)) == 0)
+    18b9:	83 c4 10             	add    $0x10,%esp
+    18bc:	85 d2                	test   %edx,%edx
+    18be:	75 c0                	jne    1880 <malloc+0x40>
+        return 0;
+  }
+}
+    18c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    18c3:	31 c0                	xor    %eax,%eax
+}
+    18c5:	5b                   	pop    %ebx
+    18c6:	5e                   	pop    %esi
+    18c7:	5f                   	pop    %edi
+    18c8:	5d                   	pop    %ebp
+    18c9:	c3                   	ret
+    18ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    18d0:	39 cf                	cmp    %ecx,%edi
+    18d2:	74 4c                	je     1920 <malloc+0xe0>
+        p->s.size -= nunits;
+    18d4:	29 f9                	sub    %edi,%ecx
+    18d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    18d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    18dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    18df:	89 15 70 1c 00 00    	mov    %edx,0x1c70
+}
+    18e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    18e8:	83 c0 08             	add    $0x8,%eax
+}
+    18eb:	5b                   	pop    %ebx
+    18ec:	5e                   	pop    %esi
+    18ed:	5f                   	pop    %edi
+    18ee:	5d                   	pop    %ebp
+    18ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    18f0:	c7 05 70 1c 00 00 74 	movl   $0x1c74,0x1c70
+    18f7:	1c 00 00 
+    base.s.size = 0;
+    18fa:	b8 74 1c 00 00       	mov    $0x1c74,%eax
+    base.s.ptr = freep = prevp = &base;
+    18ff:	c7 05 74 1c 00 00 74 	movl   $0x1c74,0x1c74
+    1906:	1c 00 00 
+    base.s.size = 0;
+    1909:	c7 05 78 1c 00 00 00 	movl   $0x0,0x1c78
+    1910:	00 00 00 
+    if(p->s.size >= nunits){
+    1913:	e9 54 ff ff ff       	jmp    186c <malloc+0x2c>
+    1918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    191f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1920:	8b 08                	mov    (%eax),%ecx
+    1922:	89 0a                	mov    %ecx,(%edx)
+    1924:	eb b9                	jmp    18df <malloc+0x9f>
@@ -0,0 +1,70 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "pstat.h"
+
+// A group of workers funded with as many tickets as one lone
+// process should get about as much CPU as that process, however
+// many workers it has.
+
+int
+main(int argc, char *argv[])
+{
+	int nworkers = 4;
+	int lone_pid, worker_pid[8];
+	int i, j;
+
+	if(argc > 1)
+		nworkers = atoi(argv[1]);
+	if(nworkers < 1 || nworkers > 8)
+		nworkers = 4;
+
+	settickets(100); //keep the parent responsive
+
+	lone_pid = fork();
+	if(lone_pid == 0){
+		settickets(30);
+		for (;;);
+	}
+
+	if(fork() == 0){
+		if(mkgroup(30) < 0){
+			printf(1, "mkgroup failed\n");
+			exit();
+		}
+		for(i = 0; i < nworkers; i++){
+			worker_pid[i] = fork();
+			if(worker_pid[i] == 0)
+				for (;;);
+		}
+		sleep(500);
+
+		struct pstat st;
+		int lone_ticks = 0, group_ticks = 0;
+		st.next = 0;
+		do {
+			getpinfo(&st);
+			for (j = 0; j < sizeof(st.pid)/sizeof(st.pid[0]); j++){
+				if(!st.inuse[j])
+					continue;
+				if(st.pid[j] == lone_pid)
+					lone_ticks = st.ticks[j];
+				for(i = 0; i < nworkers; i++)
+					if(st.pid[j] == worker_pid[i])
+						group_ticks += st.ticks[j];
+			}
+		} while(st.next);
+		printf(1, "lone process: %d ticks, group of %d: %d ticks\n", lone_ticks, nworkers, group_ticks);
+
+		for(i = 0; i < nworkers; i++){
+			kill(worker_pid[i]);
+			wait();
+		}
+		exit();
+	}
+
+	wait();
+	kill(lone_pid);
+	wait();
+	exit();
+}
@@ -0,0 +1,1312 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	53                   	push   %ebx
+    100e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+    100f:	83 ec 08             	sub    $0x8,%esp
+    1012:	6a 02                	push   $0x2
+    1014:	68 48 18 00 00       	push   $0x1848
+    1019:	e8 55 03 00 00       	call   1373 <open>
+    101e:	83 c4 10             	add    $0x10,%esp
+    1021:	85 c0                	test   %eax,%eax
+    1023:	0f 88 9f 00 00 00    	js     10c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+    1029:	83 ec 0c             	sub    $0xc,%esp
+    102c:	6a 00                	push   $0x0
+    102e:	e8 78 03 00 00       	call   13ab <dup>
+  dup(0);  // stderr
+    1033:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    103a:	e8 6c 03 00 00       	call   13ab <dup>
+    103f:	83 c4 10             	add    $0x10,%esp
+    1042:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+    1048:	83 ec 08             	sub    $0x8,%esp
+    104b:	68 50 18 00 00       	push   $0x1850
+    1050:	6a 01                	push   $0x1
+    1052:	e8 c9 04 00 00       	call   1520 <printf>
+    pid = fork();
+    1057:	e8 cf 02 00 00       	call   132b <fork>
+    if(pid < 0){
+    105c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    105f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1061:	85 c0                	test   %eax,%eax
+    1063:	78 2c                	js     1091 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    1065:	74 3d                	je     10a4 <main+0xa4>
+    1067:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+    1070:	e8 c6 02 00 00       	call   133b <wait>
+    1075:	85 c0                	test   %eax,%eax
+    1077:	78 cf                	js     1048 <main+0x48>
+    1079:	39 c3                	cmp    %eax,%ebx
+    107b:	74 cb                	je     1048 <main+0x48>
+      printf(1, "zombie!\n");
+    107d:	83 ec 08             	sub    $0x8,%esp
+    1080:	68 8f 18 00 00       	push   $0x188f
+    1085:	6a 01                	push   $0x1
+    1087:	e8 94 04 00 00       	call   1520 <printf>
+    108c:	83 c4 10             	add    $0x10,%esp
+    108f:	eb df                	jmp    1070 <main+0x70>
+      printf(1, "init: fork failed\n");
+    1091:	53                   	push   %ebx
+    1092:	53                   	push   %ebx
+    1093:	68 63 18 00 00       	push   $0x1863
+    1098:	6a 01                	push   $0x1
+    109a:	e8 81 04 00 00       	call   1520 <printf>
+      exit();
+    109f:	e8 8f 02 00 00       	call   1333 <exit>
+      exec("sh", argv);
+    10a4:	50                   	push   %eax
+    10a5:	50                   	push   %eax
+    10a6:	68 98 1b 00 00       	push   $0x1b98
+    10ab:	68 76 18 00 00       	push   $0x1876
+    10b0:	e8 b6 02 00 00       	call   136b <exec>
+      printf(1, "init: exec sh failed\n");
+    10b5:	5a                   	pop    %edx
+    10b6:	59                   	pop    %ecx
+    10b7:	68 79 18 00 00       	push   $0x1879
+    10bc:	6a 01                	push   $0x1
+    10be:	e8 5d 04 00 00       	call   1520 <printf>
+      exit();
+    10c3:	e8 6b 02 00 00       	call   1333 <exit>
+    mknod("console", 1, 1);
+    10c8:	50                   	push   %eax
+    10c9:	6a 01                	push   $0x1
+    10cb:	6a 01                	push   $0x1
+    10cd:	68 48 18 00 00       	push   $0x1848
+    10d2:	e8 a4 02 00 00       	call   137b <mknod>
+    open("console", O_RDWR);
+    10d7:	58                   	pop    %eax
+    10d8:	5a                   	pop    %edx
+    10d9:	6a 02                	push   $0x2
+    10db:	68 48 18 00 00       	push   $0x1848
+    10e0:	e8 8e 02 00 00       	call   1373 <open>
+    10e5:	83 c4 10             	add    $0x10,%esp
+    10e8:	e9 3c ff ff ff       	jmp    1029 <main+0x29>
+    10ed:	66 90                	xchg   %ax,%ax
+    10ef:	90                   	nop
+
+000010f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    10f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    10f1:	31 c0                	xor    %eax,%eax
+{
+    10f3:	89 e5                	mov    %esp,%ebp
+    10f5:	53                   	push   %ebx
+    10f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    10f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    10fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1100:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1104:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1107:	83 c0 01             	add    $0x1,%eax
+    110a:	84 d2                	test   %dl,%dl
+    110c:	75 f2                	jne    1100 <strcpy+0x10>
+    ;
+  return os;
+}
+    110e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1111:	89 c8                	mov    %ecx,%eax
+    1113:	c9                   	leave
+    1114:	c3                   	ret
+    1115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	53                   	push   %ebx
+    1124:	8b 55 08             	mov    0x8(%ebp),%edx
+    1127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    112a:	0f b6 02             	movzbl (%edx),%eax
+    112d:	84 c0                	test   %al,%al
+    112f:	75 17                	jne    1148 <strcmp+0x28>
+    1131:	eb 3a                	jmp    116d <strcmp+0x4d>
+    1133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1137:	90                   	nop
+    1138:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    113c:	83 c2 01             	add    $0x1,%edx
+    113f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1142:	84 c0                	test   %al,%al
+    1144:	74 1a                	je     1160 <strcmp+0x40>
+    p++, q++;
+    1146:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1148:	0f b6 19             	movzbl (%ecx),%ebx
+    114b:	38 c3                	cmp    %al,%bl
+    114d:	74 e9                	je     1138 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    114f:	29 d8                	sub    %ebx,%eax
+}
+    1151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1154:	c9                   	leave
+    1155:	c3                   	ret
+    1156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1160:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1164:	31 c0                	xor    %eax,%eax
+    1166:	29 d8                	sub    %ebx,%eax
+}
+    1168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    116b:	c9                   	leave
+    116c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    116d:	0f b6 19             	movzbl (%ecx),%ebx
+    1170:	31 c0                	xor    %eax,%eax
+    1172:	eb db                	jmp    114f <strcmp+0x2f>
+    1174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    117f:	90                   	nop
+
+00001180 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1186:	80 3a 00             	cmpb   $0x0,(%edx)
+    1189:	74 15                	je     11a0 <strlen+0x20>
+    118b:	31 c0                	xor    %eax,%eax
+    118d:	8d 76 00             	lea    0x0(%esi),%esi
+    1190:	83 c0 01             	add    $0x1,%eax
+    1193:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1197:	89 c1                	mov    %eax,%ecx
+    1199:	75 f5                	jne    1190 <strlen+0x10>
+    ;
+  return n;
+}
+    119b:	89 c8                	mov    %ecx,%eax
+    119d:	5d                   	pop    %ebp
+    119e:	c3                   	ret
+    119f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    11a0:	31 c9                	xor    %ecx,%ecx
+}
+    11a2:	5d                   	pop    %ebp
+    11a3:	89 c8                	mov    %ecx,%eax
+    11a5:	c3                   	ret
+    11a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000011b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	57                   	push   %edi
+    11b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    11b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    11ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11bd:	89 d7                	mov    %edx,%edi
+    11bf:	fc                   	cld
+    11c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    11c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    11c5:	89 d0                	mov    %edx,%eax
+    11c7:	c9                   	leave
+    11c8:	c3                   	ret
+    11c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    11d0:	55                   	push   %ebp
+    11d1:	89 e5                	mov    %esp,%ebp
+    11d3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    11da:	0f b6 10             	movzbl (%eax),%edx
+    11dd:	84 d2                	test   %dl,%dl
+    11df:	75 12                	jne    11f3 <strchr+0x23>
+    11e1:	eb 1d                	jmp    1200 <strchr+0x30>
+    11e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11e7:	90                   	nop
+    11e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    11ec:	83 c0 01             	add    $0x1,%eax
+    11ef:	84 d2                	test   %dl,%dl
+    11f1:	74 0d                	je     1200 <strchr+0x30>
+    if(*s == c)
+    11f3:	38 d1                	cmp    %dl,%cl
+    11f5:	75 f1                	jne    11e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    11f7:	5d                   	pop    %ebp
+    11f8:	c3                   	ret
+    11f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1200:	31 c0                	xor    %eax,%eax
+}
+    1202:	5d                   	pop    %ebp
+    1203:	c3                   	ret
+    1204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    120f:	90                   	nop
+
+00001210 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1210:	55                   	push   %ebp
+    1211:	89 e5                	mov    %esp,%ebp
+    1213:	57                   	push   %edi
+    1214:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1215:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1218:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1219:	31 db                	xor    %ebx,%ebx
+{
+    121b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    121e:	eb 27                	jmp    1247 <gets+0x37>
+    cc = read(0, &c, 1);
+    1220:	83 ec 04             	sub    $0x4,%esp
+    1223:	6a 01                	push   $0x1
+    1225:	56                   	push   %esi
+    1226:	6a 00                	push   $0x0
+    1228:	e8 1e 01 00 00       	call   134b <read>
+    if(cc < 1)
+    122d:	83 c4 10             	add    $0x10,%esp
+    1230:	85 c0                	test   %eax,%eax
+    1232:	7e 1d                	jle    1251 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1234:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1238:	8b 55 08             	mov    0x8(%ebp),%edx
+    123b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    123f:	3c 0a                	cmp    $0xa,%al
+    1241:	74 10                	je     1253 <gets+0x43>
+    1243:	3c 0d                	cmp    $0xd,%al
+    1245:	74 0c                	je     1253 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1247:	89 df                	mov    %ebx,%edi
+    1249:	83 c3 01             	add    $0x1,%ebx
+    124c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    124f:	7c cf                	jl     1220 <gets+0x10>
+    1251:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1253:	8b 45 08             	mov    0x8(%ebp),%eax
+    1256:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    125a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    125d:	5b                   	pop    %ebx
+    125e:	5e                   	pop    %esi
+    125f:	5f                   	pop    %edi
+    1260:	5d                   	pop    %ebp
+    1261:	c3                   	ret
+    1262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001270 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	56                   	push   %esi
+    1274:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1275:	83 ec 08             	sub    $0x8,%esp
+    1278:	6a 00                	push   $0x0
+    127a:	ff 75 08             	push   0x8(%ebp)
+    127d:	e8 f1 00 00 00       	call   1373 <open>
+  if(fd < 0)
+    1282:	83 c4 10             	add    $0x10,%esp
+    1285:	85 c0                	test   %eax,%eax
+    1287:	78 27                	js     12b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1289:	83 ec 08             	sub    $0x8,%esp
+    128c:	ff 75 0c             	push   0xc(%ebp)
+    128f:	89 c3                	mov    %eax,%ebx
+    1291:	50                   	push   %eax
+    1292:	e8 f4 00 00 00       	call   138b <fstat>
+  close(fd);
+    1297:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    129a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    129c:	e8 ba 00 00 00       	call   135b <close>
+  return r;
+    12a1:	83 c4 10             	add    $0x10,%esp
+}
+    12a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12a7:	89 f0                	mov    %esi,%eax
+    12a9:	5b                   	pop    %ebx
+    12aa:	5e                   	pop    %esi
+    12ab:	5d                   	pop    %ebp
+    12ac:	c3                   	ret
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    12b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    12b5:	eb ed                	jmp    12a4 <stat+0x34>
+    12b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12be:	66 90                	xchg   %ax,%ax
+
+000012c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	53                   	push   %ebx
+    12c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    12c7:	0f be 02             	movsbl (%edx),%eax
+    12ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    12cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    12d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    12d5:	77 1e                	ja     12f5 <atoi+0x35>
+    12d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    12e0:	83 c2 01             	add    $0x1,%edx
+    12e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    12e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    12ea:	0f be 02             	movsbl (%edx),%eax
+    12ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    12f0:	80 fb 09             	cmp    $0x9,%bl
+    12f3:	76 eb                	jbe    12e0 <atoi+0x20>
+  return n;
+}
+    12f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12f8:	89 c8                	mov    %ecx,%eax
+    12fa:	c9                   	leave
+    12fb:	c3                   	ret
+    12fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001300 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	57                   	push   %edi
+    1304:	56                   	push   %esi
+    1305:	8b 45 10             	mov    0x10(%ebp),%eax
+    1308:	8b 55 08             	mov    0x8(%ebp),%edx
+    130b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    130e:	85 c0                	test   %eax,%eax
+    1310:	7e 13                	jle    1325 <memmove+0x25>
+    1312:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1314:	89 d7                	mov    %edx,%edi
+    1316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    131d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1320:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1321:	39 f8                	cmp    %edi,%eax
+    1323:	75 fb                	jne    1320 <memmove+0x20>
+  return vdst;
+}
+    1325:	5e                   	pop    %esi
+    1326:	89 d0                	mov    %edx,%eax
+    1328:	5f                   	pop    %edi
+    1329:	5d                   	pop    %ebp
+    132a:	c3                   	ret
+
+0000132b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    132b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1330:	cd 40                	int    $0x40
+    1332:	c3                   	ret
+
+00001333 <exit>:
+SYSCALL(exit)
+    1333:	b8 02 00 00 00       	mov    $0x2,%eax
+    1338:	cd 40                	int    $0x40
+    133a:	c3                   	ret
+
+0000133b <wait>:
+SYSCALL(wait)
+    133b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1340:	cd 40                	int    $0x40
+    1342:	c3                   	ret
+
+00001343 <pipe>:
+SYSCALL(pipe)
+    1343:	b8 04 00 00 00       	mov    $0x4,%eax
+    1348:	cd 40                	int    $0x40
+    134a:	c3                   	ret
+
+0000134b <read>:
+SYSCALL(read)
+    134b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1350:	cd 40                	int    $0x40
+    1352:	c3                   	ret
+
+00001353 <write>:
+SYSCALL(write)
+    1353:	b8 10 00 00 00       	mov    $0x10,%eax
+    1358:	cd 40                	int    $0x40
+    135a:	c3                   	ret
+
+0000135b <close>:
+SYSCALL(close)
+    135b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1360:	cd 40                	int    $0x40
+    1362:	c3                   	ret
+
+00001363 <kill>:
+SYSCALL(kill)
+    1363:	b8 06 00 00 00       	mov    $0x6,%eax
+    1368:	cd 40                	int    $0x40
+    136a:	c3                   	ret
+
+0000136b <exec>:
+SYSCALL(exec)
+    136b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1370:	cd 40                	int    $0x40
+    1372:	c3                   	ret
+
+00001373 <open>:
+SYSCALL(open)
+    1373:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1378:	cd 40                	int    $0x40
+    137a:	c3                   	ret
+
+0000137b <mknod>:
+SYSCALL(mknod)
+    137b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1380:	cd 40                	int    $0x40
+    1382:	c3                   	ret
+
+00001383 <unlink>:
+SYSCALL(unlink)
+    1383:	b8 12 00 00 00       	mov    $0x12,%eax
+    1388:	cd 40                	int    $0x40
+    138a:	c3                   	ret
+
+0000138b <fstat>:
+SYSCALL(fstat)
+    138b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1390:	cd 40                	int    $0x40
+    1392:	c3                   	ret
+
+00001393 <link>:
+SYSCALL(link)
+    1393:	b8 13 00 00 00       	mov    $0x13,%eax
+    1398:	cd 40                	int    $0x40
+    139a:	c3                   	ret
+
+0000139b <mkdir>:
+SYSCALL(mkdir)
+    139b:	b8 14 00 00 00       	mov    $0x14,%eax
+    13a0:	cd 40                	int    $0x40
+    13a2:	c3                   	ret
+
+000013a3 <chdir>:
+SYSCALL(chdir)
+    13a3:	b8 09 00 00 00       	mov    $0x9,%eax
+    13a8:	cd 40                	int    $0x40
+    13aa:	c3                   	ret
+
+000013ab <dup>:
+SYSCALL(dup)
+    13ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+    13b0:	cd 40                	int    $0x40
+    13b2:	c3                   	ret
+
+000013b3 <getpid>:
+SYSCALL(getpid)
+    13b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+
+000013bb <sbrk>:
+SYSCALL(sbrk)
+    13bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    13c0:	cd 40                	int    $0x40
+    13c2:	c3                   	ret
+
+000013c3 <sleep>:
+SYSCALL(sleep)
+    13c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    13c8:	cd 40                	int    $0x40
+    13ca:	c3                   	ret
+
+000013cb <uptime>:
+SYSCALL(uptime)
+    13cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    13d0:	cd 40                	int    $0x40
+    13d2:	c3                   	ret
+
+000013d3 <settickets>:
+SYSCALL(settickets)
+    13d3:	b8 16 00 00 00       	mov    $0x16,%eax
+    13d8:	cd 40                	int    $0x40
+    13da:	c3                   	ret
+
+000013db <getpinfo>:
+SYSCALL(getpinfo)
+    13db:	b8 17 00 00 00       	mov    $0x17,%eax
+    13e0:	cd 40                	int    $0x40
+    13e2:	c3                   	ret
+
+000013e3 <mprotect>:
+SYSCALL(mprotect)
+    13e3:	b8 18 00 00 00       	mov    $0x18,%eax
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+
+000013eb <munprotect>:
+SYSCALL(munprotect)
+    13eb:	b8 19 00 00 00       	mov    $0x19,%eax
+    13f0:	cd 40                	int    $0x40
+    13f2:	c3                   	ret
+
+000013f3 <clone>:
+SYSCALL(clone)
+    13f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    13f8:	cd 40                	int    $0x40
+    13fa:	c3                   	ret
+
+000013fb <join>:
+SYSCALL(join)
+    13fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1400:	cd 40                	int    $0x40
+    1402:	c3                   	ret
+
+00001403 <initlock_t>:
+SYSCALL(initlock_t)
+    1403:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1408:	cd 40                	int    $0x40
+    140a:	c3                   	ret
+
+0000140b <acquire_t>:
+SYSCALL(acquire_t)
+    140b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1410:	cd 40                	int    $0x40
+    1412:	c3                   	ret
+
+00001413 <release_t>:
+SYSCALL(release_t)
+    1413:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1418:	cd 40                	int    $0x40
+    141a:	c3                   	ret
+
+0000141b <setsched>:
+SYSCALL(setsched)
+    141b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1420:	cd 40                	int    $0x40
+    1422:	c3                   	ret
+
+00001423 <mkgroup>:
+SYSCALL(mkgroup)
+    1423:	b8 20 00 00 00       	mov    $0x20,%eax
+    1428:	cd 40                	int    $0x40
+    142a:	c3                   	ret
+
+0000142b <joingroup>:
+SYSCALL(joingroup)
+    142b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1430:	cd 40                	int    $0x40
+    1432:	c3                   	ret
+
+00001433 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1433:	b8 22 00 00 00       	mov    $0x22,%eax
+    1438:	cd 40                	int    $0x40
+    143a:	c3                   	ret
+
+0000143b <setdeadline>:
+SYSCALL(setdeadline)
+    143b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1440:	cd 40                	int    $0x40
+    1442:	c3                   	ret
+
+00001443 <setaffinity>:
+SYSCALL(setaffinity)
+    1443:	b8 24 00 00 00       	mov    $0x24,%eax
+    1448:	cd 40                	int    $0x40
+    144a:	c3                   	ret
+
+0000144b <yield_to>:
+SYSCALL(yield_to)
+    144b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1450:	cd 40                	int    $0x40
+    1452:	c3                   	ret
+
+00001453 <getlatency>:
+SYSCALL(getlatency)
+    1453:	b8 26 00 00 00       	mov    $0x26,%eax
+    1458:	cd 40                	int    $0x40
+    145a:	c3                   	ret
+
+0000145b <futex_wait>:
+SYSCALL(futex_wait)
+    145b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1460:	cd 40                	int    $0x40
+    1462:	c3                   	ret
+
+00001463 <futex_wake>:
+SYSCALL(futex_wake)
+    1463:	b8 28 00 00 00       	mov    $0x28,%eax
+    1468:	cd 40                	int    $0x40
+    146a:	c3                   	ret
+
+0000146b <mguard>:
+SYSCALL(mguard)
+    146b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1470:	cd 40                	int    $0x40
+    1472:	c3                   	ret
+
+00001473 <join_any>:
+SYSCALL(join_any)
+    1473:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1478:	cd 40                	int    $0x40
+    147a:	c3                   	ret
+    147b:	66 90                	xchg   %ax,%ax
+    147d:	66 90                	xchg   %ax,%ax
+    147f:	90                   	nop
+
+00001480 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1480:	55                   	push   %ebp
+    1481:	89 e5                	mov    %esp,%ebp
+    1483:	57                   	push   %edi
+    1484:	56                   	push   %esi
+    1485:	53                   	push   %ebx
+    1486:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1488:	89 d1                	mov    %edx,%ecx
+{
+    148a:	83 ec 3c             	sub    $0x3c,%esp
+    148d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1490:	85 d2                	test   %edx,%edx
+    1492:	0f 89 80 00 00 00    	jns    1518 <printint+0x98>
+    1498:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    149c:	74 7a                	je     1518 <printint+0x98>
+    x = -xx;
+    149e:	f7 d9                	neg    %ecx
+    neg = 1;
+    14a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    14a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    14a8:	31 f6                	xor    %esi,%esi
+    14aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    14b0:	89 c8                	mov    %ecx,%eax
+    14b2:	31 d2                	xor    %edx,%edx
+    14b4:	89 f7                	mov    %esi,%edi
+    14b6:	f7 f3                	div    %ebx
+    14b8:	8d 76 01             	lea    0x1(%esi),%esi
+    14bb:	0f b6 92 f8 18 00 00 	movzbl 0x18f8(%edx),%edx
+    14c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    14c6:	89 ca                	mov    %ecx,%edx
+    14c8:	89 c1                	mov    %eax,%ecx
+    14ca:	39 da                	cmp    %ebx,%edx
+    14cc:	73 e2                	jae    14b0 <printint+0x30>
+  if(neg)
+    14ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    14d1:	85 c0                	test   %eax,%eax
+    14d3:	74 07                	je     14dc <printint+0x5c>
+    buf[i++] = '-';
+    14d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    14da:	89 f7                	mov    %esi,%edi
+    14dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    14df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    14e2:	01 df                	add    %ebx,%edi
+    14e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    14e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    14eb:	83 ec 04             	sub    $0x4,%esp
+    14ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+    14f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    14f4:	6a 01                	push   $0x1
+    14f6:	50                   	push   %eax
+    14f7:	56                   	push   %esi
+    14f8:	e8 56 fe ff ff       	call   1353 <write>
+  while(--i >= 0)
+    14fd:	89 f8                	mov    %edi,%eax
+    14ff:	83 c4 10             	add    $0x10,%esp
+    1502:	83 ef 01             	sub    $0x1,%edi
+    1505:	39 d8                	cmp    %ebx,%eax
+    1507:	75 df                	jne    14e8 <printint+0x68>
+}
+    1509:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    150c:	5b                   	pop    %ebx
+    150d:	5e                   	pop    %esi
+    150e:	5f                   	pop    %edi
+    150f:	5d                   	pop    %ebp
+    1510:	c3                   	ret
+    1511:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1518:	31 c0                	xor    %eax,%eax
+    151a:	eb 89                	jmp    14a5 <printint+0x25>
+    151c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001520 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1520:	55                   	push   %ebp
+    1521:	89 e5                	mov    %esp,%ebp
+    1523:	57                   	push   %edi
+    1524:	56                   	push   %esi
+    1525:	53                   	push   %ebx
+    1526:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1529:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    152c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    152f:	0f b6 1e             	movzbl (%esi),%ebx
+    1532:	83 c6 01             	add    $0x1,%esi
+    1535:	84 db                	test   %bl,%bl
+    1537:	74 67                	je     15a0 <printf+0x80>
+    1539:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    153c:	31 d2                	xor    %edx,%edx
+    153e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1541:	eb 34                	jmp    1577 <printf+0x57>
+    1543:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1547:	90                   	nop
+    1548:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    154b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1550:	83 f8 25             	cmp    $0x25,%eax
+    1553:	74 18                	je     156d <printf+0x4d>
+  write(fd, &c, 1);
+    1555:	83 ec 04             	sub    $0x4,%esp
+    1558:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    155b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    155e:	6a 01                	push   $0x1
+    1560:	50                   	push   %eax
+    1561:	57                   	push   %edi
+    1562:	e8 ec fd ff ff       	call   1353 <write>
+    1567:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    156a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    156d:	0f b6 1e             	movzbl (%esi),%ebx
+    1570:	83 c6 01             	add    $0x1,%esi
+    1573:	84 db                	test   %bl,%bl
+    1575:	74 29                	je     15a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1577:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    157a:	85 d2                	test   %edx,%edx
+    157c:	74 ca                	je     1548 <printf+0x28>
+      }
+    } else if(state == '%'){
+    157e:	83 fa 25             	cmp    $0x25,%edx
+    1581:	75 ea                	jne    156d <printf+0x4d>
+      if(c == 'd'){
+    1583:	83 f8 25             	cmp    $0x25,%eax
+    1586:	0f 84 24 01 00 00    	je     16b0 <printf+0x190>
+    158c:	83 e8 63             	sub    $0x63,%eax
+    158f:	83 f8 15             	cmp    $0x15,%eax
+    1592:	77 1c                	ja     15b0 <printf+0x90>
+    1594:	ff 24 85 a0 18 00 00 	jmp    *0x18a0(,%eax,4)
+    159b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    159f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    15a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15a3:	5b                   	pop    %ebx
+    15a4:	5e                   	pop    %esi
+    15a5:	5f                   	pop    %edi
+    15a6:	5d                   	pop    %ebp
+    15a7:	c3                   	ret
+    15a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15af:	90                   	nop
+  write(fd, &c, 1);
+    15b0:	83 ec 04             	sub    $0x4,%esp
+    15b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    15b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    15ba:	6a 01                	push   $0x1
+    15bc:	52                   	push   %edx
+    15bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    15c0:	57                   	push   %edi
+    15c1:	e8 8d fd ff ff       	call   1353 <write>
+    15c6:	83 c4 0c             	add    $0xc,%esp
+    15c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    15cc:	6a 01                	push   $0x1
+    15ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    15d1:	52                   	push   %edx
+    15d2:	57                   	push   %edi
+    15d3:	e8 7b fd ff ff       	call   1353 <write>
+        putc(fd, c);
+    15d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    15db:	31 d2                	xor    %edx,%edx
+    15dd:	eb 8e                	jmp    156d <printf+0x4d>
+    15df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    15e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    15e3:	83 ec 0c             	sub    $0xc,%esp
+    15e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    15eb:	8b 13                	mov    (%ebx),%edx
+    15ed:	6a 00                	push   $0x0
+    15ef:	89 f8                	mov    %edi,%eax
+        ap++;
+    15f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    15f4:	e8 87 fe ff ff       	call   1480 <printint>
+        ap++;
+    15f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    15fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    15ff:	31 d2                	xor    %edx,%edx
+    1601:	e9 67 ff ff ff       	jmp    156d <printf+0x4d>
+    1606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    160d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1610:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1613:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1615:	83 c0 04             	add    $0x4,%eax
+    1618:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    161b:	85 db                	test   %ebx,%ebx
+    161d:	0f 84 9d 00 00 00    	je     16c0 <printf+0x1a0>
+        while(*s != 0){
+    1623:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1626:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1628:	84 c0                	test   %al,%al
+    162a:	0f 84 3d ff ff ff    	je     156d <printf+0x4d>
+    1630:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1633:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1636:	89 de                	mov    %ebx,%esi
+    1638:	89 d3                	mov    %edx,%ebx
+    163a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1640:	83 ec 04             	sub    $0x4,%esp
+    1643:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1646:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1649:	6a 01                	push   $0x1
+    164b:	53                   	push   %ebx
+    164c:	57                   	push   %edi
+    164d:	e8 01 fd ff ff       	call   1353 <write>
+        while(*s != 0){
+    1652:	0f b6 06             	movzbl (%esi),%eax
+    1655:	83 c4 10             	add    $0x10,%esp
+    1658:	84 c0                	test   %al,%al
+    165a:	75 e4                	jne    1640 <printf+0x120>
+      state = 0;
+    165c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    165f:	31 d2                	xor    %edx,%edx
+    1661:	e9 07 ff ff ff       	jmp    156d <printf+0x4d>
+    1666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    166d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1670:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1673:	83 ec 0c             	sub    $0xc,%esp
+    1676:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    167b:	8b 13                	mov    (%ebx),%edx
+    167d:	6a 01                	push   $0x1
+    167f:	e9 6b ff ff ff       	jmp    15ef <printf+0xcf>
+    1684:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1688:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    168b:	83 ec 04             	sub    $0x4,%esp
+    168e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1691:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1693:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1696:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1699:	6a 01                	push   $0x1
+    169b:	52                   	push   %edx
+    169c:	57                   	push   %edi
+    169d:	e8 b1 fc ff ff       	call   1353 <write>
+        ap++;
+    16a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    16a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    16a8:	31 d2                	xor    %edx,%edx
+    16aa:	e9 be fe ff ff       	jmp    156d <printf+0x4d>
+    16af:	90                   	nop
+  write(fd, &c, 1);
+    16b0:	83 ec 04             	sub    $0x4,%esp
+    16b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    16b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    16b9:	6a 01                	push   $0x1
+    16bb:	e9 11 ff ff ff       	jmp    15d1 <printf+0xb1>
+    16c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    16c5:	bb 98 18 00 00       	mov    $0x1898,%ebx
+    16ca:	e9 61 ff ff ff       	jmp    1630 <printf+0x110>
+    16cf:	90                   	nop
+
+000016d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    16d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16d1:	a1 a0 1b 00 00       	mov    0x1ba0,%eax
+{
+    16d6:	89 e5                	mov    %esp,%ebp
+    16d8:	57                   	push   %edi
+    16d9:	56                   	push   %esi
+    16da:	53                   	push   %ebx
+    16db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    16de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16ec:	39 ca                	cmp    %ecx,%edx
+    16ee:	73 30                	jae    1720 <free+0x50>
+    16f0:	39 c1                	cmp    %eax,%ecx
+    16f2:	72 04                	jb     16f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16f4:	39 c2                	cmp    %eax,%edx
+    16f6:	72 f0                	jb     16e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    16f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    16fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    16fe:	39 f8                	cmp    %edi,%eax
+    1700:	74 2e                	je     1730 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1702:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1705:	8b 42 04             	mov    0x4(%edx),%eax
+    1708:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    170b:	39 f1                	cmp    %esi,%ecx
+    170d:	74 38                	je     1747 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    170f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1711:	5b                   	pop    %ebx
+  freep = p;
+    1712:	89 15 a0 1b 00 00    	mov    %edx,0x1ba0
+}
+    1718:	5e                   	pop    %esi
+    1719:	5f                   	pop    %edi
+    171a:	5d                   	pop    %ebp
+    171b:	c3                   	ret
+    171c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1720:	39 c1                	cmp    %eax,%ecx
+    1722:	72 d0                	jb     16f4 <free+0x24>
+    1724:	eb c2                	jmp    16e8 <free+0x18>
+    1726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    172d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1730:	03 70 04             	add    0x4(%eax),%esi
+    1733:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1736:	8b 02                	mov    (%edx),%eax
+    1738:	8b 00                	mov    (%eax),%eax
+    173a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    173d:	8b 42 04             	mov    0x4(%edx),%eax
+    1740:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1743:	39 f1                	cmp    %esi,%ecx
+    1745:	75 c8                	jne    170f <free+0x3f>
+    p->s.size += bp->s.size;
+    1747:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    174a:	89 15 a0 1b 00 00    	mov    %edx,0x1ba0
+    p->s.size += bp->s.size;
+    1750:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1753:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1756:	89 0a                	mov    %ecx,(%edx)
+}
+    1758:	5b                   	pop    %ebx
+    1759:	5e                   	pop    %esi
+    175a:	5f                   	pop    %edi
+    175b:	5d                   	pop    %ebp
+    175c:	c3                   	ret
+    175d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001760 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1760:	55                   	push   %ebp
+    1761:	89 e5                	mov    %esp,%ebp
+    1763:	57                   	push   %edi
+    1764:	56                   	push   %esi
+    1765:	53                   	push   %ebx
+    1766:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1769:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    176c:	8b 15 a0 1b 00 00    	mov    0x1ba0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1772:	8d 78 07             	lea    0x7(%eax),%edi
+    1775:	c1 ef 03             	shr    $0x3,%edi
+    1778:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    177b:	85 d2                	test   %edx,%edx
+    177d:	0f 84 8d 00 00 00    	je     1810 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1783:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1785:	8b 48 04             	mov    0x4(%eax),%ecx
+    1788:	39 f9                	cmp    %edi,%ecx
+    178a:	73 64                	jae    17f0 <malloc+0x90>
+  if(nu < 4096)
+    178c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1791:	39 df                	cmp    %ebx,%edi
+    1793:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1796:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    179d:	eb 0a                	jmp    17a9 <malloc+0x49>
+    179f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    17a2:	8b 48 04             	mov    0x4(%eax),%ecx
+    17a5:	39 f9                	cmp    %edi,%ecx
+    17a7:	73 47                	jae    17f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    17a9:	89 c2                	mov    %eax,%edx
+    17ab:	39 05 a0 1b 00 00    	cmp    %eax,0x1ba0
+    17b1:	75 ed                	jne    17a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    17b3:	83 ec 0c             	sub    $0xc,%esp
+    17b6:	56                   	push   %esi
+    17b7:	e8 ff fb ff ff       	call   13bb <sbrk>
+  if(p == (char*)-1)
+    17bc:	83 c4 10             	add    $0x10,%esp
+    17bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17c2:	74 1c                	je     17e0 <malloc+0x80>
+  hp->s.size = nu;
+    17c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    17c7:	83 ec 0c             	sub    $0xc,%esp
+    17ca:	83 c0 08             	add    $0x8,%eax
+    17cd:	50                   	push   %eax
+    17ce:	e8 fd fe ff ff       	call   16d0 <free>
+  return freep;
+    17d3:	8b 15 a0 1b 00 00    	mov    0x1ba0,%edx
+      if((p = morecore(nunits)) == 0)
+    17d9:	83 c4 10             	add    $0x10,%esp
+    17dc:	85 d2                	test   %edx,%edx
+    17de:	75 c0                	jne    17a0 <malloc+0x40>
+        return 0;
+  }
+}
+    17e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    17e3:	31 c0                	xor    %eax,%eax
+}
+    17e5:	5b                   	pop    %ebx
+    17e6:	5e                   	pop    %esi
+    17e7:	5f                   	pop    %edi
+    17e8:	5d                   	pop    %ebp
+    17e9:	c3                   	ret
+    17ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    17f0:	39 cf                	cmp    %ecx,%edi
+    17f2:	74 4c                	je     1840 <malloc+0xe0>
+        p->s.size -= nunits;
+    17f4:	29 f9                	sub    %edi,%ecx
+    17f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    17f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    17fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    17ff:	89 15 a0 1b 00 00    	mov    %edx,0x1ba0
+}
+    1805:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1808:	83 c0 08             	add    $0x8,%eax
+}
+    180b:	5b                   	pop    %ebx
+    180c:	5e                   	pop    %esi
+    180d:	5f                   	pop    %edi
+    180e:	5d                   	pop    %ebp
+    180f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1810:	c7 05 a0 1b 00 00 a4 	movl   $0x1ba4,0x1ba0
+    1817:	1b 00 00 
+    base.s.size = 0;
+    181a:	b8 a4 1b 00 00       	mov    $0x1ba4,%eax
+    base.s.ptr = freep = prevp = &base;
+    181f:	c7 05 a4 1b 00 00 a4 	movl   $0x1ba4,0x1ba4
+    1826:	1b 00 00 
+    base.s.size = 0;
+    1829:	c7 05 a8 1b 00 00 00 	movl   $0x0,0x1ba8
+    1830:	00 00 00 
+    if(p->s.size >= nunits){
+    1833:	e9 54 ff ff ff       	jmp    178c <malloc+0x2c>
+    1838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    183f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1840:	8b 08                	mov    (%eax),%ecx
+    1842:	89 0a                	mov    %ecx,(%edx)
+    1844:	eb b9                	jmp    17ff <malloc+0x9f>
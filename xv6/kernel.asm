@@ -0,0 +1,24206 @@
+
+kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 e0 10 00       	mov    $0x10e000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc a0 b4 13 80       	mov    $0x8013b4a0,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 90 35 10 80       	mov    $0x80103590,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+80100034:	66 90                	xchg   %ax,%ax
+80100036:	66 90                	xchg   %ax,%ax
+80100038:	66 90                	xchg   %ax,%ax
+8010003a:	66 90                	xchg   %ax,%ax
+8010003c:	66 90                	xchg   %ax,%ax
+8010003e:	66 90                	xchg   %ax,%ax
+
+80100040 <binit>:
+  struct buf head;
+} bcache;
+
+void
+binit(void)
+{
+80100040:	55                   	push   %ebp
+80100041:	89 e5                	mov    %esp,%ebp
+80100043:	53                   	push   %ebx
+
+//PAGEBREAK!
+  // Create linked list of buffers
+  bcache.head.prev = &bcache.head;
+  bcache.head.next = &bcache.head;
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100044:	bb 54 f5 10 80       	mov    $0x8010f554,%ebx
+{
+80100049:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&bcache.lock, "bcache");
+8010004c:	68 20 ba 10 80       	push   $0x8010ba20
+80100051:	68 20 f5 10 80       	push   $0x8010f520
+80100056:	e8 95 7c 00 00       	call   80107cf0 <initlock>
+  bcache.head.next = &bcache.head;
+8010005b:	83 c4 10             	add    $0x10,%esp
+8010005e:	b8 1c 3c 11 80       	mov    $0x80113c1c,%eax
+  bcache.head.prev = &bcache.head;
+80100063:	c7 05 6c 3c 11 80 1c 	movl   $0x80113c1c,0x80113c6c
+8010006a:	3c 11 80 
+  bcache.head.next = &bcache.head;
+8010006d:	c7 05 70 3c 11 80 1c 	movl   $0x80113c1c,0x80113c70
+80100074:	3c 11 80 
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100077:	eb 09                	jmp    80100082 <binit+0x42>
+80100079:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100080:	89 d3                	mov    %edx,%ebx
+    b->next = bcache.head.next;
+80100082:	89 43 54             	mov    %eax,0x54(%ebx)
+    b->prev = &bcache.head;
+    initsleeplock(&b->lock, "buffer");
+80100085:	83 ec 08             	sub    $0x8,%esp
+80100088:	8d 43 0c             	lea    0xc(%ebx),%eax
+    b->prev = &bcache.head;
+8010008b:	c7 43 50 1c 3c 11 80 	movl   $0x80113c1c,0x50(%ebx)
+    initsleeplock(&b->lock, "buffer");
+80100092:	68 27 ba 10 80       	push   $0x8010ba27
+80100097:	50                   	push   %eax
+80100098:	e8 23 7b 00 00       	call   80107bc0 <initsleeplock>
+    bcache.head.next->prev = b;
+8010009d:	a1 70 3c 11 80       	mov    0x80113c70,%eax
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801000a2:	8d 93 5c 02 00 00    	lea    0x25c(%ebx),%edx
+801000a8:	83 c4 10             	add    $0x10,%esp
+    bcache.head.next->prev = b;
+801000ab:	89 58 50             	mov    %ebx,0x50(%eax)
+    bcache.head.next = b;
+801000ae:	89 d8                	mov    %ebx,%eax
+801000b0:	89 1d 70 3c 11 80    	mov    %ebx,0x80113c70
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801000b6:	81 fb c0 39 11 80    	cmp    $0x801139c0,%ebx
+801000bc:	75 c2                	jne    80100080 <binit+0x40>
+  }
+}
+801000be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801000c1:	c9                   	leave
+801000c2:	c3                   	ret
+801000c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801000ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801000d0 <bread>:
+}
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+801000d0:	55                   	push   %ebp
+801000d1:	89 e5                	mov    %esp,%ebp
+801000d3:	57                   	push   %edi
+801000d4:	56                   	push   %esi
+801000d5:	53                   	push   %ebx
+801000d6:	83 ec 18             	sub    $0x18,%esp
+801000d9:	8b 75 08             	mov    0x8(%ebp),%esi
+801000dc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  acquire(&bcache.lock);
+801000df:	68 20 f5 10 80       	push   $0x8010f520
+801000e4:	e8 e7 7d 00 00       	call   80107ed0 <acquire>
+  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+801000e9:	8b 1d 70 3c 11 80    	mov    0x80113c70,%ebx
+801000ef:	83 c4 10             	add    $0x10,%esp
+801000f2:	81 fb 1c 3c 11 80    	cmp    $0x80113c1c,%ebx
+801000f8:	75 11                	jne    8010010b <bread+0x3b>
+801000fa:	eb 24                	jmp    80100120 <bread+0x50>
+801000fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100100:	8b 5b 54             	mov    0x54(%ebx),%ebx
+80100103:	81 fb 1c 3c 11 80    	cmp    $0x80113c1c,%ebx
+80100109:	74 15                	je     80100120 <bread+0x50>
+    if(b->dev == dev && b->blockno == blockno){
+8010010b:	3b 73 04             	cmp    0x4(%ebx),%esi
+8010010e:	75 f0                	jne    80100100 <bread+0x30>
+80100110:	3b 7b 08             	cmp    0x8(%ebx),%edi
+80100113:	75 eb                	jne    80100100 <bread+0x30>
+      b->refcnt++;
+80100115:	83 43 4c 01          	addl   $0x1,0x4c(%ebx)
+      release(&bcache.lock);
+80100119:	eb 3f                	jmp    8010015a <bread+0x8a>
+8010011b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010011f:	90                   	nop
+  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+80100120:	8b 1d 6c 3c 11 80    	mov    0x80113c6c,%ebx
+80100126:	81 fb 1c 3c 11 80    	cmp    $0x80113c1c,%ebx
+8010012c:	75 0d                	jne    8010013b <bread+0x6b>
+8010012e:	eb 6e                	jmp    8010019e <bread+0xce>
+80100130:	8b 5b 50             	mov    0x50(%ebx),%ebx
+80100133:	81 fb 1c 3c 11 80    	cmp    $0x80113c1c,%ebx
+80100139:	74 63                	je     8010019e <bread+0xce>
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
+8010013b:	8b 43 4c             	mov    0x4c(%ebx),%eax
+8010013e:	85 c0                	test   %eax,%eax
+80100140:	75 ee                	jne    80100130 <bread+0x60>
+80100142:	f6 03 04             	testb  $0x4,(%ebx)
+80100145:	75 e9                	jne    80100130 <bread+0x60>
+      b->dev = dev;
+80100147:	89 73 04             	mov    %esi,0x4(%ebx)
+      b->blockno = blockno;
+8010014a:	89 7b 08             	mov    %edi,0x8(%ebx)
+      b->flags = 0;
+8010014d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+      b->refcnt = 1;
+80100153:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+      release(&bcache.lock);
+8010015a:	83 ec 0c             	sub    $0xc,%esp
+8010015d:	68 20 f5 10 80       	push   $0x8010f520
+80100162:	e8 09 7d 00 00       	call   80107e70 <release>
+      acquiresleep(&b->lock);
+80100167:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010016a:	89 04 24             	mov    %eax,(%esp)
+8010016d:	e8 8e 7a 00 00       	call   80107c00 <acquiresleep>
+      return b;
+80100172:	83 c4 10             	add    $0x10,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  if((b->flags & B_VALID) == 0) {
+80100175:	f6 03 02             	testb  $0x2,(%ebx)
+80100178:	74 0e                	je     80100188 <bread+0xb8>
+    iderw(b);
+  }
+  return b;
+}
+8010017a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010017d:	89 d8                	mov    %ebx,%eax
+8010017f:	5b                   	pop    %ebx
+80100180:	5e                   	pop    %esi
+80100181:	5f                   	pop    %edi
+80100182:	5d                   	pop    %ebp
+80100183:	c3                   	ret
+80100184:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iderw(b);
+80100188:	83 ec 0c             	sub    $0xc,%esp
+8010018b:	53                   	push   %ebx
+8010018c:	e8 ff 25 00 00       	call   80102790 <iderw>
+80100191:	83 c4 10             	add    $0x10,%esp
+}
+80100194:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100197:	89 d8                	mov    %ebx,%eax
+80100199:	5b                   	pop    %ebx
+8010019a:	5e                   	pop    %esi
+8010019b:	5f                   	pop    %edi
+8010019c:	5d                   	pop    %ebp
+8010019d:	c3                   	ret
+  panic("bget: no buffers");
+8010019e:	83 ec 0c             	sub    $0xc,%esp
+801001a1:	68 2e ba 10 80       	push   $0x8010ba2e
+801001a6:	e8 d5 01 00 00       	call   80100380 <panic>
+801001ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801001af:	90                   	nop
+
+801001b0 <bwrite>:
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+801001b0:	55                   	push   %ebp
+801001b1:	89 e5                	mov    %esp,%ebp
+801001b3:	53                   	push   %ebx
+801001b4:	83 ec 10             	sub    $0x10,%esp
+801001b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+801001ba:	8d 43 0c             	lea    0xc(%ebx),%eax
+801001bd:	50                   	push   %eax
+801001be:	e8 dd 7a 00 00       	call   80107ca0 <holdingsleep>
+801001c3:	83 c4 10             	add    $0x10,%esp
+801001c6:	85 c0                	test   %eax,%eax
+801001c8:	74 0f                	je     801001d9 <bwrite+0x29>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+801001ca:	83 0b 04             	orl    $0x4,(%ebx)
+  iderw(b);
+801001cd:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+801001d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801001d3:	c9                   	leave
+  iderw(b);
+801001d4:	e9 b7 25 00 00       	jmp    80102790 <iderw>
+    panic("bwrite");
+801001d9:	83 ec 0c             	sub    $0xc,%esp
+801001dc:	68 3f ba 10 80       	push   $0x8010ba3f
+801001e1:	e8 9a 01 00 00       	call   80100380 <panic>
+801001e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801001ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801001f0 <brelse>:
+
+// Release a locked buffer.
+// Move to the head of the MRU list.
+void
+brelse(struct buf *b)
+{
+801001f0:	55                   	push   %ebp
+801001f1:	89 e5                	mov    %esp,%ebp
+801001f3:	56                   	push   %esi
+801001f4:	53                   	push   %ebx
+801001f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+801001f8:	8d 73 0c             	lea    0xc(%ebx),%esi
+801001fb:	83 ec 0c             	sub    $0xc,%esp
+801001fe:	56                   	push   %esi
+801001ff:	e8 9c 7a 00 00       	call   80107ca0 <holdingsleep>
+80100204:	83 c4 10             	add    $0x10,%esp
+80100207:	85 c0                	test   %eax,%eax
+80100209:	74 63                	je     8010026e <brelse+0x7e>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+8010020b:	83 ec 0c             	sub    $0xc,%esp
+8010020e:	56                   	push   %esi
+8010020f:	e8 4c 7a 00 00       	call   80107c60 <releasesleep>
+
+  acquire(&bcache.lock);
+80100214:	c7 04 24 20 f5 10 80 	movl   $0x8010f520,(%esp)
+8010021b:	e8 b0 7c 00 00       	call   80107ed0 <acquire>
+  b->refcnt--;
+80100220:	8b 43 4c             	mov    0x4c(%ebx),%eax
+  if (b->refcnt == 0) {
+80100223:	83 c4 10             	add    $0x10,%esp
+  b->refcnt--;
+80100226:	83 e8 01             	sub    $0x1,%eax
+80100229:	89 43 4c             	mov    %eax,0x4c(%ebx)
+  if (b->refcnt == 0) {
+8010022c:	85 c0                	test   %eax,%eax
+8010022e:	75 2c                	jne    8010025c <brelse+0x6c>
+    // no one is waiting for it.
+    b->next->prev = b->prev;
+80100230:	8b 53 54             	mov    0x54(%ebx),%edx
+80100233:	8b 43 50             	mov    0x50(%ebx),%eax
+80100236:	89 42 50             	mov    %eax,0x50(%edx)
+    b->prev->next = b->next;
+80100239:	8b 53 54             	mov    0x54(%ebx),%edx
+8010023c:	89 50 54             	mov    %edx,0x54(%eax)
+    b->next = bcache.head.next;
+8010023f:	a1 70 3c 11 80       	mov    0x80113c70,%eax
+    b->prev = &bcache.head;
+80100244:	c7 43 50 1c 3c 11 80 	movl   $0x80113c1c,0x50(%ebx)
+    b->next = bcache.head.next;
+8010024b:	89 43 54             	mov    %eax,0x54(%ebx)
+    bcache.head.next->prev = b;
+8010024e:	a1 70 3c 11 80       	mov    0x80113c70,%eax
+80100253:	89 58 50             	mov    %ebx,0x50(%eax)
+    bcache.head.next = b;
+80100256:	89 1d 70 3c 11 80    	mov    %ebx,0x80113c70
+  }
+  
+  release(&bcache.lock);
+8010025c:	c7 45 08 20 f5 10 80 	movl   $0x8010f520,0x8(%ebp)
+}
+80100263:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100266:	5b                   	pop    %ebx
+80100267:	5e                   	pop    %esi
+80100268:	5d                   	pop    %ebp
+  release(&bcache.lock);
+80100269:	e9 02 7c 00 00       	jmp    80107e70 <release>
+    panic("brelse");
+8010026e:	83 ec 0c             	sub    $0xc,%esp
+80100271:	68 46 ba 10 80       	push   $0x8010ba46
+80100276:	e8 05 01 00 00       	call   80100380 <panic>
+8010027b:	66 90                	xchg   %ax,%ax
+8010027d:	66 90                	xchg   %ax,%ax
+8010027f:	90                   	nop
+
+80100280 <consoleread>:
+  }
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+80100280:	55                   	push   %ebp
+80100281:	89 e5                	mov    %esp,%ebp
+80100283:	57                   	push   %edi
+80100284:	56                   	push   %esi
+80100285:	53                   	push   %ebx
+80100286:	83 ec 18             	sub    $0x18,%esp
+80100289:	8b 5d 10             	mov    0x10(%ebp),%ebx
+8010028c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  uint target;
+  int c;
+
+  iunlock(ip);
+8010028f:	ff 75 08             	push   0x8(%ebp)
+  target = n;
+80100292:	89 df                	mov    %ebx,%edi
+  iunlock(ip);
+80100294:	e8 67 1a 00 00       	call   80101d00 <iunlock>
+  acquire(&cons.lock);
+80100299:	c7 04 24 20 3f 11 80 	movl   $0x80113f20,(%esp)
+801002a0:	e8 2b 7c 00 00       	call   80107ed0 <acquire>
+  while(n > 0){
+801002a5:	83 c4 10             	add    $0x10,%esp
+801002a8:	85 db                	test   %ebx,%ebx
+801002aa:	0f 8e 94 00 00 00    	jle    80100344 <consoleread+0xc4>
+    while(input.r == input.w){
+801002b0:	a1 00 3f 11 80       	mov    0x80113f00,%eax
+801002b5:	39 05 04 3f 11 80    	cmp    %eax,0x80113f04
+801002bb:	74 25                	je     801002e2 <consoleread+0x62>
+801002bd:	eb 59                	jmp    80100318 <consoleread+0x98>
+801002bf:	90                   	nop
+      if(myproc()->killed){
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+801002c0:	83 ec 08             	sub    $0x8,%esp
+801002c3:	68 20 3f 11 80       	push   $0x80113f20
+801002c8:	68 00 3f 11 80       	push   $0x80113f00
+801002cd:	e8 6e 64 00 00       	call   80106740 <sleep>
+    while(input.r == input.w){
+801002d2:	a1 00 3f 11 80       	mov    0x80113f00,%eax
+801002d7:	83 c4 10             	add    $0x10,%esp
+801002da:	3b 05 04 3f 11 80    	cmp    0x80113f04,%eax
+801002e0:	75 36                	jne    80100318 <consoleread+0x98>
+      if(myproc()->killed){
+801002e2:	e8 19 57 00 00       	call   80105a00 <myproc>
+801002e7:	8b 48 3c             	mov    0x3c(%eax),%ecx
+801002ea:	85 c9                	test   %ecx,%ecx
+801002ec:	74 d2                	je     801002c0 <consoleread+0x40>
+        release(&cons.lock);
+801002ee:	83 ec 0c             	sub    $0xc,%esp
+801002f1:	68 20 3f 11 80       	push   $0x80113f20
+801002f6:	e8 75 7b 00 00       	call   80107e70 <release>
+        ilock(ip);
+801002fb:	5a                   	pop    %edx
+801002fc:	ff 75 08             	push   0x8(%ebp)
+801002ff:	e8 1c 19 00 00       	call   80101c20 <ilock>
+        return -1;
+80100304:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+80100307:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return -1;
+8010030a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010030f:	5b                   	pop    %ebx
+80100310:	5e                   	pop    %esi
+80100311:	5f                   	pop    %edi
+80100312:	5d                   	pop    %ebp
+80100313:	c3                   	ret
+80100314:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = input.buf[input.r++ % INPUT_BUF];
+80100318:	8d 50 01             	lea    0x1(%eax),%edx
+8010031b:	89 15 00 3f 11 80    	mov    %edx,0x80113f00
+80100321:	89 c2                	mov    %eax,%edx
+80100323:	83 e2 7f             	and    $0x7f,%edx
+80100326:	0f be 8a 80 3e 11 80 	movsbl -0x7feec180(%edx),%ecx
+    if(c == C('D')){  // EOF
+8010032d:	80 f9 04             	cmp    $0x4,%cl
+80100330:	74 37                	je     80100369 <consoleread+0xe9>
+    *dst++ = c;
+80100332:	83 c6 01             	add    $0x1,%esi
+    --n;
+80100335:	83 eb 01             	sub    $0x1,%ebx
+    *dst++ = c;
+80100338:	88 4e ff             	mov    %cl,-0x1(%esi)
+    if(c == '\n')
+8010033b:	83 f9 0a             	cmp    $0xa,%ecx
+8010033e:	0f 85 64 ff ff ff    	jne    801002a8 <consoleread+0x28>
+  release(&cons.lock);
+80100344:	83 ec 0c             	sub    $0xc,%esp
+80100347:	68 20 3f 11 80       	push   $0x80113f20
+8010034c:	e8 1f 7b 00 00       	call   80107e70 <release>
+  ilock(ip);
+80100351:	58                   	pop    %eax
+80100352:	ff 75 08             	push   0x8(%ebp)
+80100355:	e8 c6 18 00 00       	call   80101c20 <ilock>
+  return target - n;
+8010035a:	89 f8                	mov    %edi,%eax
+8010035c:	83 c4 10             	add    $0x10,%esp
+}
+8010035f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return target - n;
+80100362:	29 d8                	sub    %ebx,%eax
+}
+80100364:	5b                   	pop    %ebx
+80100365:	5e                   	pop    %esi
+80100366:	5f                   	pop    %edi
+80100367:	5d                   	pop    %ebp
+80100368:	c3                   	ret
+      if(n < target){
+80100369:	39 fb                	cmp    %edi,%ebx
+8010036b:	73 d7                	jae    80100344 <consoleread+0xc4>
+        input.r--;
+8010036d:	a3 00 3f 11 80       	mov    %eax,0x80113f00
+80100372:	eb d0                	jmp    80100344 <consoleread+0xc4>
+80100374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010037b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010037f:	90                   	nop
+
+80100380 <panic>:
+{
+80100380:	55                   	push   %ebp
+80100381:	89 e5                	mov    %esp,%ebp
+80100383:	56                   	push   %esi
+80100384:	53                   	push   %ebx
+80100385:	83 ec 30             	sub    $0x30,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+80100388:	fa                   	cli
+  cons.locking = 0;
+80100389:	c7 05 54 3f 11 80 00 	movl   $0x0,0x80113f54
+80100390:	00 00 00 
+  getcallerpcs(&s, pcs);
+80100393:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+80100396:	8d 75 f8             	lea    -0x8(%ebp),%esi
+  cprintf("lapicid %d: panic: ", lapicid());
+80100399:	e8 02 2a 00 00       	call   80102da0 <lapicid>
+8010039e:	83 ec 08             	sub    $0x8,%esp
+801003a1:	50                   	push   %eax
+801003a2:	68 4d ba 10 80       	push   $0x8010ba4d
+801003a7:	e8 04 03 00 00       	call   801006b0 <cprintf>
+  cprintf(s);
+801003ac:	58                   	pop    %eax
+801003ad:	ff 75 08             	push   0x8(%ebp)
+801003b0:	e8 fb 02 00 00       	call   801006b0 <cprintf>
+  cprintf("\n");
+801003b5:	c7 04 24 b3 c4 10 80 	movl   $0x8010c4b3,(%esp)
+801003bc:	e8 ef 02 00 00       	call   801006b0 <cprintf>
+  getcallerpcs(&s, pcs);
+801003c1:	8d 45 08             	lea    0x8(%ebp),%eax
+801003c4:	5a                   	pop    %edx
+801003c5:	59                   	pop    %ecx
+801003c6:	53                   	push   %ebx
+801003c7:	50                   	push   %eax
+801003c8:	e8 43 79 00 00       	call   80107d10 <getcallerpcs>
+  for(i=0; i<10; i++)
+801003cd:	83 c4 10             	add    $0x10,%esp
+    cprintf(" %p", pcs[i]);
+801003d0:	83 ec 08             	sub    $0x8,%esp
+801003d3:	ff 33                	push   (%ebx)
+  for(i=0; i<10; i++)
+801003d5:	83 c3 04             	add    $0x4,%ebx
+    cprintf(" %p", pcs[i]);
+801003d8:	68 61 ba 10 80       	push   $0x8010ba61
+801003dd:	e8 ce 02 00 00       	call   801006b0 <cprintf>
+  for(i=0; i<10; i++)
+801003e2:	83 c4 10             	add    $0x10,%esp
+801003e5:	39 f3                	cmp    %esi,%ebx
+801003e7:	75 e7                	jne    801003d0 <panic+0x50>
+  panicked = 1; // freeze other CPU
+801003e9:	c7 05 58 3f 11 80 01 	movl   $0x1,0x80113f58
+801003f0:	00 00 00 
+  for(;;)
+801003f3:	eb fe                	jmp    801003f3 <panic+0x73>
+801003f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801003fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100400 <consputc.part.0>:
+consputc(int c)
+80100400:	55                   	push   %ebp
+80100401:	89 e5                	mov    %esp,%ebp
+80100403:	57                   	push   %edi
+80100404:	56                   	push   %esi
+80100405:	53                   	push   %ebx
+80100406:	83 ec 1c             	sub    $0x1c,%esp
+  if(c == BACKSPACE){
+80100409:	3d 00 01 00 00       	cmp    $0x100,%eax
+8010040e:	0f 84 cc 00 00 00    	je     801004e0 <consputc.part.0+0xe0>
+    uartputc(c);
+80100414:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100417:	bf d4 03 00 00       	mov    $0x3d4,%edi
+8010041c:	89 c3                	mov    %eax,%ebx
+8010041e:	50                   	push   %eax
+8010041f:	e8 1c 9a 00 00       	call   80109e40 <uartputc>
+80100424:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100429:	89 fa                	mov    %edi,%edx
+8010042b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010042c:	be d5 03 00 00       	mov    $0x3d5,%esi
+80100431:	89 f2                	mov    %esi,%edx
+80100433:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100434:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100437:	89 fa                	mov    %edi,%edx
+80100439:	b8 0f 00 00 00       	mov    $0xf,%eax
+8010043e:	c1 e1 08             	shl    $0x8,%ecx
+80100441:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100442:	89 f2                	mov    %esi,%edx
+80100444:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100445:	0f b6 c0             	movzbl %al,%eax
+  if(c == '\n')
+80100448:	83 c4 10             	add    $0x10,%esp
+  pos |= inb(CRTPORT+1);
+8010044b:	09 c8                	or     %ecx,%eax
+  if(c == '\n')
+8010044d:	83 fb 0a             	cmp    $0xa,%ebx
+80100450:	75 76                	jne    801004c8 <consputc.part.0+0xc8>
+    pos += 80 - pos%80;
+80100452:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+80100457:	f7 e2                	mul    %edx
+80100459:	c1 ea 06             	shr    $0x6,%edx
+8010045c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+8010045f:	c1 e0 04             	shl    $0x4,%eax
+80100462:	8d 70 50             	lea    0x50(%eax),%esi
+  if(pos < 0 || pos > 25*80)
+80100465:	81 fe d0 07 00 00    	cmp    $0x7d0,%esi
+8010046b:	0f 8f 2f 01 00 00    	jg     801005a0 <consputc.part.0+0x1a0>
+  if((pos/80) >= 24){  // Scroll up.
+80100471:	81 fe 7f 07 00 00    	cmp    $0x77f,%esi
+80100477:	0f 8f c3 00 00 00    	jg     80100540 <consputc.part.0+0x140>
+  outb(CRTPORT+1, pos>>8);
+8010047d:	89 f0                	mov    %esi,%eax
+  crt[pos] = ' ' | 0x0700;
+8010047f:	8d b4 36 00 80 0b 80 	lea    -0x7ff48000(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+80100486:	88 45 e7             	mov    %al,-0x19(%ebp)
+  outb(CRTPORT+1, pos>>8);
+80100489:	0f b6 fc             	movzbl %ah,%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010048c:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+80100491:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100496:	89 da                	mov    %ebx,%edx
+80100498:	ee                   	out    %al,(%dx)
+80100499:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+8010049e:	89 f8                	mov    %edi,%eax
+801004a0:	89 ca                	mov    %ecx,%edx
+801004a2:	ee                   	out    %al,(%dx)
+801004a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+801004a8:	89 da                	mov    %ebx,%edx
+801004aa:	ee                   	out    %al,(%dx)
+801004ab:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+801004af:	89 ca                	mov    %ecx,%edx
+801004b1:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+801004b2:	b8 20 07 00 00       	mov    $0x720,%eax
+801004b7:	66 89 06             	mov    %ax,(%esi)
+}
+801004ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801004bd:	5b                   	pop    %ebx
+801004be:	5e                   	pop    %esi
+801004bf:	5f                   	pop    %edi
+801004c0:	5d                   	pop    %ebp
+801004c1:	c3                   	ret
+801004c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+801004c8:	0f b6 db             	movzbl %bl,%ebx
+801004cb:	8d 70 01             	lea    0x1(%eax),%esi
+801004ce:	80 cf 07             	or     $0x7,%bh
+801004d1:	66 89 9c 00 00 80 0b 	mov    %bx,-0x7ff48000(%eax,%eax,1)
+801004d8:	80 
+801004d9:	eb 8a                	jmp    80100465 <consputc.part.0+0x65>
+801004db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801004df:	90                   	nop
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+801004e0:	83 ec 0c             	sub    $0xc,%esp
+801004e3:	be d4 03 00 00       	mov    $0x3d4,%esi
+801004e8:	6a 08                	push   $0x8
+801004ea:	e8 51 99 00 00       	call   80109e40 <uartputc>
+801004ef:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+801004f6:	e8 45 99 00 00       	call   80109e40 <uartputc>
+801004fb:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80100502:	e8 39 99 00 00       	call   80109e40 <uartputc>
+80100507:	b8 0e 00 00 00       	mov    $0xe,%eax
+8010050c:	89 f2                	mov    %esi,%edx
+8010050e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010050f:	bb d5 03 00 00       	mov    $0x3d5,%ebx
+80100514:	89 da                	mov    %ebx,%edx
+80100516:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100517:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010051a:	89 f2                	mov    %esi,%edx
+8010051c:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100521:	c1 e1 08             	shl    $0x8,%ecx
+80100524:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100525:	89 da                	mov    %ebx,%edx
+80100527:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100528:	0f b6 f0             	movzbl %al,%esi
+    if(pos > 0) --pos;
+8010052b:	83 c4 10             	add    $0x10,%esp
+8010052e:	09 ce                	or     %ecx,%esi
+80100530:	74 5e                	je     80100590 <consputc.part.0+0x190>
+80100532:	83 ee 01             	sub    $0x1,%esi
+80100535:	e9 2b ff ff ff       	jmp    80100465 <consputc.part.0+0x65>
+8010053a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100540:	83 ec 04             	sub    $0x4,%esp
+    pos -= 80;
+80100543:	8d 5e b0             	lea    -0x50(%esi),%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100546:	8d b4 36 60 7f 0b 80 	lea    -0x7ff480a0(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+8010054d:	bf 07 00 00 00       	mov    $0x7,%edi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100552:	68 60 0e 00 00       	push   $0xe60
+80100557:	68 a0 80 0b 80       	push   $0x800b80a0
+8010055c:	68 00 80 0b 80       	push   $0x800b8000
+80100561:	e8 da 7a 00 00       	call   80108040 <memmove>
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100566:	b8 80 07 00 00       	mov    $0x780,%eax
+8010056b:	83 c4 0c             	add    $0xc,%esp
+8010056e:	29 d8                	sub    %ebx,%eax
+80100570:	01 c0                	add    %eax,%eax
+80100572:	50                   	push   %eax
+80100573:	6a 00                	push   $0x0
+80100575:	56                   	push   %esi
+80100576:	e8 35 7a 00 00       	call   80107fb0 <memset>
+  outb(CRTPORT+1, pos);
+8010057b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+8010057e:	83 c4 10             	add    $0x10,%esp
+80100581:	e9 06 ff ff ff       	jmp    8010048c <consputc.part.0+0x8c>
+80100586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010058d:	8d 76 00             	lea    0x0(%esi),%esi
+80100590:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+80100594:	be 00 80 0b 80       	mov    $0x800b8000,%esi
+80100599:	31 ff                	xor    %edi,%edi
+8010059b:	e9 ec fe ff ff       	jmp    8010048c <consputc.part.0+0x8c>
+    panic("pos under/overflow");
+801005a0:	83 ec 0c             	sub    $0xc,%esp
+801005a3:	68 65 ba 10 80       	push   $0x8010ba65
+801005a8:	e8 d3 fd ff ff       	call   80100380 <panic>
+801005ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801005b0 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+801005b0:	55                   	push   %ebp
+801005b1:	89 e5                	mov    %esp,%ebp
+801005b3:	57                   	push   %edi
+801005b4:	56                   	push   %esi
+801005b5:	53                   	push   %ebx
+801005b6:	83 ec 18             	sub    $0x18,%esp
+801005b9:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+801005bc:	ff 75 08             	push   0x8(%ebp)
+801005bf:	e8 3c 17 00 00       	call   80101d00 <iunlock>
+  acquire(&cons.lock);
+801005c4:	c7 04 24 20 3f 11 80 	movl   $0x80113f20,(%esp)
+801005cb:	e8 00 79 00 00       	call   80107ed0 <acquire>
+  for(i = 0; i < n; i++)
+801005d0:	83 c4 10             	add    $0x10,%esp
+801005d3:	85 f6                	test   %esi,%esi
+801005d5:	7e 25                	jle    801005fc <consolewrite+0x4c>
+801005d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+801005da:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+  if(panicked){
+801005dd:	8b 15 58 3f 11 80    	mov    0x80113f58,%edx
+    consputc(buf[i] & 0xff);
+801005e3:	0f b6 03             	movzbl (%ebx),%eax
+  if(panicked){
+801005e6:	85 d2                	test   %edx,%edx
+801005e8:	74 06                	je     801005f0 <consolewrite+0x40>
+  asm volatile("cli");
+801005ea:	fa                   	cli
+    for(;;)
+801005eb:	eb fe                	jmp    801005eb <consolewrite+0x3b>
+801005ed:	8d 76 00             	lea    0x0(%esi),%esi
+801005f0:	e8 0b fe ff ff       	call   80100400 <consputc.part.0>
+  for(i = 0; i < n; i++)
+801005f5:	83 c3 01             	add    $0x1,%ebx
+801005f8:	39 df                	cmp    %ebx,%edi
+801005fa:	75 e1                	jne    801005dd <consolewrite+0x2d>
+  release(&cons.lock);
+801005fc:	83 ec 0c             	sub    $0xc,%esp
+801005ff:	68 20 3f 11 80       	push   $0x80113f20
+80100604:	e8 67 78 00 00       	call   80107e70 <release>
+  ilock(ip);
+80100609:	58                   	pop    %eax
+8010060a:	ff 75 08             	push   0x8(%ebp)
+8010060d:	e8 0e 16 00 00       	call   80101c20 <ilock>
+
+  return n;
+}
+80100612:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100615:	89 f0                	mov    %esi,%eax
+80100617:	5b                   	pop    %ebx
+80100618:	5e                   	pop    %esi
+80100619:	5f                   	pop    %edi
+8010061a:	5d                   	pop    %ebp
+8010061b:	c3                   	ret
+8010061c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100620 <printint>:
+{
+80100620:	55                   	push   %ebp
+80100621:	89 e5                	mov    %esp,%ebp
+80100623:	57                   	push   %edi
+80100624:	56                   	push   %esi
+80100625:	89 c6                	mov    %eax,%esi
+80100627:	53                   	push   %ebx
+80100628:	89 d3                	mov    %edx,%ebx
+8010062a:	83 ec 2c             	sub    $0x2c,%esp
+  if(sign && (sign = xx < 0))
+8010062d:	85 c9                	test   %ecx,%ecx
+8010062f:	74 04                	je     80100635 <printint+0x15>
+80100631:	85 c0                	test   %eax,%eax
+80100633:	78 63                	js     80100698 <printint+0x78>
+    x = xx;
+80100635:	89 f1                	mov    %esi,%ecx
+80100637:	31 c0                	xor    %eax,%eax
+  i = 0;
+80100639:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+8010063c:	31 f6                	xor    %esi,%esi
+8010063e:	66 90                	xchg   %ax,%ax
+    buf[i++] = digits[x % base];
+80100640:	89 c8                	mov    %ecx,%eax
+80100642:	31 d2                	xor    %edx,%edx
+80100644:	89 f7                	mov    %esi,%edi
+80100646:	f7 f3                	div    %ebx
+80100648:	8d 76 01             	lea    0x1(%esi),%esi
+8010064b:	0f b6 92 90 ba 10 80 	movzbl -0x7fef4570(%edx),%edx
+80100652:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+80100656:	89 ca                	mov    %ecx,%edx
+80100658:	89 c1                	mov    %eax,%ecx
+8010065a:	39 da                	cmp    %ebx,%edx
+8010065c:	73 e2                	jae    80100640 <printint+0x20>
+  if(sign)
+8010065e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100661:	85 c0                	test   %eax,%eax
+80100663:	74 07                	je     8010066c <printint+0x4c>
+    buf[i++] = '-';
+80100665:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+8010066a:	89 f7                	mov    %esi,%edi
+8010066c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+8010066f:	01 df                	add    %ebx,%edi
+  if(panicked){
+80100671:	8b 15 58 3f 11 80    	mov    0x80113f58,%edx
+    consputc(buf[i]);
+80100677:	0f be 07             	movsbl (%edi),%eax
+  if(panicked){
+8010067a:	85 d2                	test   %edx,%edx
+8010067c:	74 0a                	je     80100688 <printint+0x68>
+8010067e:	fa                   	cli
+    for(;;)
+8010067f:	eb fe                	jmp    8010067f <printint+0x5f>
+80100681:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100688:	e8 73 fd ff ff       	call   80100400 <consputc.part.0>
+  while(--i >= 0)
+8010068d:	8d 47 ff             	lea    -0x1(%edi),%eax
+80100690:	39 df                	cmp    %ebx,%edi
+80100692:	74 0c                	je     801006a0 <printint+0x80>
+80100694:	89 c7                	mov    %eax,%edi
+80100696:	eb d9                	jmp    80100671 <printint+0x51>
+80100698:	89 c8                	mov    %ecx,%eax
+    x = -xx;
+8010069a:	89 f1                	mov    %esi,%ecx
+8010069c:	f7 d9                	neg    %ecx
+8010069e:	eb 99                	jmp    80100639 <printint+0x19>
+}
+801006a0:	83 c4 2c             	add    $0x2c,%esp
+801006a3:	5b                   	pop    %ebx
+801006a4:	5e                   	pop    %esi
+801006a5:	5f                   	pop    %edi
+801006a6:	5d                   	pop    %ebp
+801006a7:	c3                   	ret
+801006a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801006af:	90                   	nop
+
+801006b0 <cprintf>:
+{
+801006b0:	55                   	push   %ebp
+801006b1:	89 e5                	mov    %esp,%ebp
+801006b3:	57                   	push   %edi
+801006b4:	56                   	push   %esi
+801006b5:	53                   	push   %ebx
+801006b6:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+801006b9:	8b 3d 54 3f 11 80    	mov    0x80113f54,%edi
+  if (fmt == 0)
+801006bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(locking)
+801006c2:	85 ff                	test   %edi,%edi
+801006c4:	0f 85 36 01 00 00    	jne    80100800 <cprintf+0x150>
+  if (fmt == 0)
+801006ca:	85 f6                	test   %esi,%esi
+801006cc:	0f 84 e0 01 00 00    	je     801008b2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801006d2:	0f b6 06             	movzbl (%esi),%eax
+801006d5:	85 c0                	test   %eax,%eax
+801006d7:	74 6b                	je     80100744 <cprintf+0x94>
+  argp = (uint*)(void*)(&fmt + 1);
+801006d9:	8d 55 0c             	lea    0xc(%ebp),%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801006dc:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+801006df:	31 db                	xor    %ebx,%ebx
+801006e1:	89 d7                	mov    %edx,%edi
+    if(c != '%'){
+801006e3:	83 f8 25             	cmp    $0x25,%eax
+801006e6:	0f 85 dc 00 00 00    	jne    801007c8 <cprintf+0x118>
+    c = fmt[++i] & 0xff;
+801006ec:	83 c3 01             	add    $0x1,%ebx
+801006ef:	0f b6 0c 1e          	movzbl (%esi,%ebx,1),%ecx
+    if(c == 0)
+801006f3:	85 c9                	test   %ecx,%ecx
+801006f5:	74 42                	je     80100739 <cprintf+0x89>
+    switch(c){
+801006f7:	83 f9 70             	cmp    $0x70,%ecx
+801006fa:	0f 84 99 00 00 00    	je     80100799 <cprintf+0xe9>
+80100700:	7f 4e                	jg     80100750 <cprintf+0xa0>
+80100702:	83 f9 25             	cmp    $0x25,%ecx
+80100705:	0f 84 cd 00 00 00    	je     801007d8 <cprintf+0x128>
+8010070b:	83 f9 64             	cmp    $0x64,%ecx
+8010070e:	0f 85 24 01 00 00    	jne    80100838 <cprintf+0x188>
+      printint(*argp++, 10, 1);
+80100714:	8d 47 04             	lea    0x4(%edi),%eax
+80100717:	b9 01 00 00 00       	mov    $0x1,%ecx
+8010071c:	ba 0a 00 00 00       	mov    $0xa,%edx
+80100721:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100724:	8b 07                	mov    (%edi),%eax
+80100726:	e8 f5 fe ff ff       	call   80100620 <printint>
+8010072b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010072e:	83 c3 01             	add    $0x1,%ebx
+80100731:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100735:	85 c0                	test   %eax,%eax
+80100737:	75 aa                	jne    801006e3 <cprintf+0x33>
+80100739:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  if(locking)
+8010073c:	85 ff                	test   %edi,%edi
+8010073e:	0f 85 df 00 00 00    	jne    80100823 <cprintf+0x173>
+}
+80100744:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100747:	5b                   	pop    %ebx
+80100748:	5e                   	pop    %esi
+80100749:	5f                   	pop    %edi
+8010074a:	5d                   	pop    %ebp
+8010074b:	c3                   	ret
+8010074c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100750:	83 f9 73             	cmp    $0x73,%ecx
+80100753:	75 3b                	jne    80100790 <cprintf+0xe0>
+      if((s = (char*)*argp++) == 0)
+80100755:	8b 17                	mov    (%edi),%edx
+80100757:	8d 47 04             	lea    0x4(%edi),%eax
+8010075a:	85 d2                	test   %edx,%edx
+8010075c:	0f 85 0e 01 00 00    	jne    80100870 <cprintf+0x1c0>
+80100762:	b9 28 00 00 00       	mov    $0x28,%ecx
+        s = "(null)";
+80100767:	bf 78 ba 10 80       	mov    $0x8010ba78,%edi
+8010076c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+8010076f:	89 fb                	mov    %edi,%ebx
+80100771:	89 f7                	mov    %esi,%edi
+80100773:	89 c6                	mov    %eax,%esi
+80100775:	0f be c1             	movsbl %cl,%eax
+  if(panicked){
+80100778:	8b 15 58 3f 11 80    	mov    0x80113f58,%edx
+8010077e:	85 d2                	test   %edx,%edx
+80100780:	0f 84 fe 00 00 00    	je     80100884 <cprintf+0x1d4>
+80100786:	fa                   	cli
+    for(;;)
+80100787:	eb fe                	jmp    80100787 <cprintf+0xd7>
+80100789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100790:	83 f9 78             	cmp    $0x78,%ecx
+80100793:	0f 85 9f 00 00 00    	jne    80100838 <cprintf+0x188>
+      printint(*argp++, 16, 0);
+80100799:	8d 47 04             	lea    0x4(%edi),%eax
+8010079c:	31 c9                	xor    %ecx,%ecx
+8010079e:	ba 10 00 00 00       	mov    $0x10,%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801007a3:	83 c3 01             	add    $0x1,%ebx
+      printint(*argp++, 16, 0);
+801007a6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801007a9:	8b 07                	mov    (%edi),%eax
+801007ab:	e8 70 fe ff ff       	call   80100620 <printint>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801007b0:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+      printint(*argp++, 16, 0);
+801007b4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801007b7:	85 c0                	test   %eax,%eax
+801007b9:	0f 85 24 ff ff ff    	jne    801006e3 <cprintf+0x33>
+801007bf:	e9 75 ff ff ff       	jmp    80100739 <cprintf+0x89>
+801007c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(panicked){
+801007c8:	8b 0d 58 3f 11 80    	mov    0x80113f58,%ecx
+801007ce:	85 c9                	test   %ecx,%ecx
+801007d0:	74 15                	je     801007e7 <cprintf+0x137>
+801007d2:	fa                   	cli
+    for(;;)
+801007d3:	eb fe                	jmp    801007d3 <cprintf+0x123>
+801007d5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(panicked){
+801007d8:	8b 0d 58 3f 11 80    	mov    0x80113f58,%ecx
+801007de:	85 c9                	test   %ecx,%ecx
+801007e0:	75 7e                	jne    80100860 <cprintf+0x1b0>
+801007e2:	b8 25 00 00 00       	mov    $0x25,%eax
+801007e7:	e8 14 fc ff ff       	call   80100400 <consputc.part.0>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801007ec:	83 c3 01             	add    $0x1,%ebx
+801007ef:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+801007f3:	85 c0                	test   %eax,%eax
+801007f5:	0f 85 e8 fe ff ff    	jne    801006e3 <cprintf+0x33>
+801007fb:	e9 39 ff ff ff       	jmp    80100739 <cprintf+0x89>
+    acquire(&cons.lock);
+80100800:	83 ec 0c             	sub    $0xc,%esp
+80100803:	68 20 3f 11 80       	push   $0x80113f20
+80100808:	e8 c3 76 00 00       	call   80107ed0 <acquire>
+  if (fmt == 0)
+8010080d:	83 c4 10             	add    $0x10,%esp
+80100810:	85 f6                	test   %esi,%esi
+80100812:	0f 84 9a 00 00 00    	je     801008b2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100818:	0f b6 06             	movzbl (%esi),%eax
+8010081b:	85 c0                	test   %eax,%eax
+8010081d:	0f 85 b6 fe ff ff    	jne    801006d9 <cprintf+0x29>
+    release(&cons.lock);
+80100823:	83 ec 0c             	sub    $0xc,%esp
+80100826:	68 20 3f 11 80       	push   $0x80113f20
+8010082b:	e8 40 76 00 00       	call   80107e70 <release>
+80100830:	83 c4 10             	add    $0x10,%esp
+80100833:	e9 0c ff ff ff       	jmp    80100744 <cprintf+0x94>
+  if(panicked){
+80100838:	8b 15 58 3f 11 80    	mov    0x80113f58,%edx
+8010083e:	85 d2                	test   %edx,%edx
+80100840:	75 26                	jne    80100868 <cprintf+0x1b8>
+80100842:	b8 25 00 00 00       	mov    $0x25,%eax
+80100847:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010084a:	e8 b1 fb ff ff       	call   80100400 <consputc.part.0>
+8010084f:	a1 58 3f 11 80       	mov    0x80113f58,%eax
+80100854:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80100857:	85 c0                	test   %eax,%eax
+80100859:	74 4b                	je     801008a6 <cprintf+0x1f6>
+8010085b:	fa                   	cli
+    for(;;)
+8010085c:	eb fe                	jmp    8010085c <cprintf+0x1ac>
+8010085e:	66 90                	xchg   %ax,%ax
+80100860:	fa                   	cli
+80100861:	eb fe                	jmp    80100861 <cprintf+0x1b1>
+80100863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100867:	90                   	nop
+80100868:	fa                   	cli
+80100869:	eb fe                	jmp    80100869 <cprintf+0x1b9>
+8010086b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010086f:	90                   	nop
+      for(; *s; s++)
+80100870:	0f b6 0a             	movzbl (%edx),%ecx
+      if((s = (char*)*argp++) == 0)
+80100873:	89 d7                	mov    %edx,%edi
+      for(; *s; s++)
+80100875:	84 c9                	test   %cl,%cl
+80100877:	0f 85 ef fe ff ff    	jne    8010076c <cprintf+0xbc>
+      if((s = (char*)*argp++) == 0)
+8010087d:	89 c7                	mov    %eax,%edi
+8010087f:	e9 aa fe ff ff       	jmp    8010072e <cprintf+0x7e>
+80100884:	e8 77 fb ff ff       	call   80100400 <consputc.part.0>
+      for(; *s; s++)
+80100889:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+8010088d:	83 c3 01             	add    $0x1,%ebx
+80100890:	84 c0                	test   %al,%al
+80100892:	0f 85 e0 fe ff ff    	jne    80100778 <cprintf+0xc8>
+      if((s = (char*)*argp++) == 0)
+80100898:	89 f0                	mov    %esi,%eax
+8010089a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+8010089d:	89 fe                	mov    %edi,%esi
+8010089f:	89 c7                	mov    %eax,%edi
+801008a1:	e9 88 fe ff ff       	jmp    8010072e <cprintf+0x7e>
+801008a6:	89 c8                	mov    %ecx,%eax
+801008a8:	e8 53 fb ff ff       	call   80100400 <consputc.part.0>
+801008ad:	e9 7c fe ff ff       	jmp    8010072e <cprintf+0x7e>
+    panic("null fmt");
+801008b2:	83 ec 0c             	sub    $0xc,%esp
+801008b5:	68 7f ba 10 80       	push   $0x8010ba7f
+801008ba:	e8 c1 fa ff ff       	call   80100380 <panic>
+801008bf:	90                   	nop
+
+801008c0 <consoleintr>:
+{
+801008c0:	55                   	push   %ebp
+801008c1:	89 e5                	mov    %esp,%ebp
+801008c3:	57                   	push   %edi
+801008c4:	56                   	push   %esi
+  int c, doprocdump = 0;
+801008c5:	31 f6                	xor    %esi,%esi
+{
+801008c7:	53                   	push   %ebx
+801008c8:	83 ec 18             	sub    $0x18,%esp
+801008cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  acquire(&cons.lock);
+801008ce:	68 20 3f 11 80       	push   $0x80113f20
+801008d3:	e8 f8 75 00 00       	call   80107ed0 <acquire>
+  while((c = getc()) >= 0){
+801008d8:	83 c4 10             	add    $0x10,%esp
+801008db:	eb 1a                	jmp    801008f7 <consoleintr+0x37>
+801008dd:	8d 76 00             	lea    0x0(%esi),%esi
+    switch(c){
+801008e0:	83 fb 08             	cmp    $0x8,%ebx
+801008e3:	0f 84 d7 00 00 00    	je     801009c0 <consoleintr+0x100>
+801008e9:	83 fb 10             	cmp    $0x10,%ebx
+801008ec:	0f 85 2d 01 00 00    	jne    80100a1f <consoleintr+0x15f>
+801008f2:	be 01 00 00 00       	mov    $0x1,%esi
+  while((c = getc()) >= 0){
+801008f7:	ff d7                	call   *%edi
+801008f9:	89 c3                	mov    %eax,%ebx
+801008fb:	85 c0                	test   %eax,%eax
+801008fd:	0f 88 e5 00 00 00    	js     801009e8 <consoleintr+0x128>
+    switch(c){
+80100903:	83 fb 15             	cmp    $0x15,%ebx
+80100906:	74 7a                	je     80100982 <consoleintr+0xc2>
+80100908:	7e d6                	jle    801008e0 <consoleintr+0x20>
+8010090a:	83 fb 7f             	cmp    $0x7f,%ebx
+8010090d:	0f 84 ad 00 00 00    	je     801009c0 <consoleintr+0x100>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100913:	a1 08 3f 11 80       	mov    0x80113f08,%eax
+80100918:	89 c2                	mov    %eax,%edx
+8010091a:	2b 15 00 3f 11 80    	sub    0x80113f00,%edx
+80100920:	83 fa 7f             	cmp    $0x7f,%edx
+80100923:	77 d2                	ja     801008f7 <consoleintr+0x37>
+  if(panicked){
+80100925:	8b 15 58 3f 11 80    	mov    0x80113f58,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+8010092b:	8d 48 01             	lea    0x1(%eax),%ecx
+8010092e:	83 e0 7f             	and    $0x7f,%eax
+80100931:	89 0d 08 3f 11 80    	mov    %ecx,0x80113f08
+80100937:	88 98 80 3e 11 80    	mov    %bl,-0x7feec180(%eax)
+  if(panicked){
+8010093d:	85 d2                	test   %edx,%edx
+8010093f:	0f 85 47 01 00 00    	jne    80100a8c <consoleintr+0x1cc>
+80100945:	89 d8                	mov    %ebx,%eax
+80100947:	e8 b4 fa ff ff       	call   80100400 <consputc.part.0>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+8010094c:	83 fb 0a             	cmp    $0xa,%ebx
+8010094f:	0f 84 18 01 00 00    	je     80100a6d <consoleintr+0x1ad>
+80100955:	83 fb 04             	cmp    $0x4,%ebx
+80100958:	0f 84 0f 01 00 00    	je     80100a6d <consoleintr+0x1ad>
+8010095e:	a1 00 3f 11 80       	mov    0x80113f00,%eax
+80100963:	83 e8 80             	sub    $0xffffff80,%eax
+80100966:	39 05 08 3f 11 80    	cmp    %eax,0x80113f08
+8010096c:	75 89                	jne    801008f7 <consoleintr+0x37>
+8010096e:	e9 ff 00 00 00       	jmp    80100a72 <consoleintr+0x1b2>
+80100973:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100977:	90                   	nop
+80100978:	b8 00 01 00 00       	mov    $0x100,%eax
+8010097d:	e8 7e fa ff ff       	call   80100400 <consputc.part.0>
+      while(input.e != input.w &&
+80100982:	a1 08 3f 11 80       	mov    0x80113f08,%eax
+80100987:	3b 05 04 3f 11 80    	cmp    0x80113f04,%eax
+8010098d:	0f 84 64 ff ff ff    	je     801008f7 <consoleintr+0x37>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+80100993:	83 e8 01             	sub    $0x1,%eax
+80100996:	89 c2                	mov    %eax,%edx
+80100998:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+8010099b:	80 ba 80 3e 11 80 0a 	cmpb   $0xa,-0x7feec180(%edx)
+801009a2:	0f 84 4f ff ff ff    	je     801008f7 <consoleintr+0x37>
+  if(panicked){
+801009a8:	8b 15 58 3f 11 80    	mov    0x80113f58,%edx
+        input.e--;
+801009ae:	a3 08 3f 11 80       	mov    %eax,0x80113f08
+  if(panicked){
+801009b3:	85 d2                	test   %edx,%edx
+801009b5:	74 c1                	je     80100978 <consoleintr+0xb8>
+801009b7:	fa                   	cli
+    for(;;)
+801009b8:	eb fe                	jmp    801009b8 <consoleintr+0xf8>
+801009ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(input.e != input.w){
+801009c0:	a1 08 3f 11 80       	mov    0x80113f08,%eax
+801009c5:	3b 05 04 3f 11 80    	cmp    0x80113f04,%eax
+801009cb:	0f 84 26 ff ff ff    	je     801008f7 <consoleintr+0x37>
+        input.e--;
+801009d1:	83 e8 01             	sub    $0x1,%eax
+801009d4:	a3 08 3f 11 80       	mov    %eax,0x80113f08
+  if(panicked){
+801009d9:	a1 58 3f 11 80       	mov    0x80113f58,%eax
+801009de:	85 c0                	test   %eax,%eax
+801009e0:	74 22                	je     80100a04 <consoleintr+0x144>
+801009e2:	fa                   	cli
+    for(;;)
+801009e3:	eb fe                	jmp    801009e3 <consoleintr+0x123>
+801009e5:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&cons.lock);
+801009e8:	83 ec 0c             	sub    $0xc,%esp
+801009eb:	68 20 3f 11 80       	push   $0x80113f20
+801009f0:	e8 7b 74 00 00       	call   80107e70 <release>
+  if(doprocdump) {
+801009f5:	83 c4 10             	add    $0x10,%esp
+801009f8:	85 f6                	test   %esi,%esi
+801009fa:	75 17                	jne    80100a13 <consoleintr+0x153>
+}
+801009fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801009ff:	5b                   	pop    %ebx
+80100a00:	5e                   	pop    %esi
+80100a01:	5f                   	pop    %edi
+80100a02:	5d                   	pop    %ebp
+80100a03:	c3                   	ret
+80100a04:	b8 00 01 00 00       	mov    $0x100,%eax
+80100a09:	e8 f2 f9 ff ff       	call   80100400 <consputc.part.0>
+80100a0e:	e9 e4 fe ff ff       	jmp    801008f7 <consoleintr+0x37>
+80100a13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100a16:	5b                   	pop    %ebx
+80100a17:	5e                   	pop    %esi
+80100a18:	5f                   	pop    %edi
+80100a19:	5d                   	pop    %ebp
+    procdump();  // now call procdump() wo. cons.lock held
+80100a1a:	e9 11 5f 00 00       	jmp    80106930 <procdump>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100a1f:	85 db                	test   %ebx,%ebx
+80100a21:	0f 84 d0 fe ff ff    	je     801008f7 <consoleintr+0x37>
+80100a27:	a1 08 3f 11 80       	mov    0x80113f08,%eax
+80100a2c:	89 c2                	mov    %eax,%edx
+80100a2e:	2b 15 00 3f 11 80    	sub    0x80113f00,%edx
+80100a34:	83 fa 7f             	cmp    $0x7f,%edx
+80100a37:	0f 87 ba fe ff ff    	ja     801008f7 <consoleintr+0x37>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100a3d:	8d 48 01             	lea    0x1(%eax),%ecx
+  if(panicked){
+80100a40:	8b 15 58 3f 11 80    	mov    0x80113f58,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100a46:	83 e0 7f             	and    $0x7f,%eax
+        c = (c == '\r') ? '\n' : c;
+80100a49:	83 fb 0d             	cmp    $0xd,%ebx
+80100a4c:	0f 85 df fe ff ff    	jne    80100931 <consoleintr+0x71>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100a52:	89 0d 08 3f 11 80    	mov    %ecx,0x80113f08
+80100a58:	c6 80 80 3e 11 80 0a 	movb   $0xa,-0x7feec180(%eax)
+  if(panicked){
+80100a5f:	85 d2                	test   %edx,%edx
+80100a61:	75 29                	jne    80100a8c <consoleintr+0x1cc>
+80100a63:	b8 0a 00 00 00       	mov    $0xa,%eax
+80100a68:	e8 93 f9 ff ff       	call   80100400 <consputc.part.0>
+          input.w = input.e;
+80100a6d:	a1 08 3f 11 80       	mov    0x80113f08,%eax
+          wakeup(&input.r);
+80100a72:	83 ec 0c             	sub    $0xc,%esp
+          input.w = input.e;
+80100a75:	a3 04 3f 11 80       	mov    %eax,0x80113f04
+          wakeup(&input.r);
+80100a7a:	68 00 3f 11 80       	push   $0x80113f00
+80100a7f:	e8 8c 5d 00 00       	call   80106810 <wakeup>
+80100a84:	83 c4 10             	add    $0x10,%esp
+80100a87:	e9 6b fe ff ff       	jmp    801008f7 <consoleintr+0x37>
+80100a8c:	fa                   	cli
+    for(;;)
+80100a8d:	eb fe                	jmp    80100a8d <consoleintr+0x1cd>
+80100a8f:	90                   	nop
+
+80100a90 <consoleinit>:
+
+void
+consoleinit(void)
+{
+80100a90:	55                   	push   %ebp
+80100a91:	89 e5                	mov    %esp,%ebp
+80100a93:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80100a96:	68 88 ba 10 80       	push   $0x8010ba88
+80100a9b:	68 20 3f 11 80       	push   $0x80113f20
+80100aa0:	e8 4b 72 00 00       	call   80107cf0 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80100aa5:	c7 05 0c 49 11 80 b0 	movl   $0x801005b0,0x8011490c
+80100aac:	05 10 80 
+  devsw[CONSOLE].read = consoleread;
+80100aaf:	c7 05 08 49 11 80 80 	movl   $0x80100280,0x80114908
+80100ab6:	02 10 80 
+  cons.locking = 1;
+80100ab9:	c7 05 54 3f 11 80 01 	movl   $0x1,0x80113f54
+80100ac0:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+80100ac3:	58                   	pop    %eax
+80100ac4:	5a                   	pop    %edx
+80100ac5:	6a 00                	push   $0x0
+80100ac7:	6a 01                	push   $0x1
+80100ac9:	e8 52 1e 00 00       	call   80102920 <ioapicenable>
+}
+80100ace:	83 c4 10             	add    $0x10,%esp
+80100ad1:	c9                   	leave
+80100ad2:	c3                   	ret
+80100ad3:	66 90                	xchg   %ax,%ax
+80100ad5:	66 90                	xchg   %ax,%ax
+80100ad7:	66 90                	xchg   %ax,%ax
+80100ad9:	66 90                	xchg   %ax,%ax
+80100adb:	66 90                	xchg   %ax,%ax
+80100add:	66 90                	xchg   %ax,%ax
+80100adf:	90                   	nop
+
+80100ae0 <exec>:
+#include "x86.h"
+#include "elf.h"
+
+int
+exec(char *path, char **argv)
+{
+80100ae0:	55                   	push   %ebp
+80100ae1:	89 e5                	mov    %esp,%ebp
+80100ae3:	57                   	push   %edi
+80100ae4:	56                   	push   %esi
+80100ae5:	53                   	push   %ebx
+80100ae6:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+  struct elfhdr elf;
+  struct inode *ip;
+  struct proghdr ph;
+  pde_t *pgdir;
+  struct mm *mm, *oldmm;
+  struct proc *curproc = myproc();
+80100aec:	e8 0f 4f 00 00       	call   80105a00 <myproc>
+80100af1:	89 85 ec fe ff ff    	mov    %eax,-0x114(%ebp)
+
+  begin_op();
+80100af7:	e8 84 27 00 00       	call   80103280 <begin_op>
+
+  if((ip = namei(path)) == 0){
+80100afc:	83 ec 0c             	sub    $0xc,%esp
+80100aff:	ff 75 08             	push   0x8(%ebp)
+80100b02:	e8 39 1a 00 00       	call   80102540 <namei>
+80100b07:	83 c4 10             	add    $0x10,%esp
+80100b0a:	85 c0                	test   %eax,%eax
+80100b0c:	0f 84 3f 03 00 00    	je     80100e51 <exec+0x371>
+    end_op();
+    cprintf("exec: fail\n");
+    return -1;
+  }
+  ilock(ip);
+80100b12:	83 ec 0c             	sub    $0xc,%esp
+80100b15:	89 c7                	mov    %eax,%edi
+80100b17:	50                   	push   %eax
+80100b18:	e8 03 11 00 00       	call   80101c20 <ilock>
+  pgdir = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+80100b1d:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+80100b23:	6a 34                	push   $0x34
+80100b25:	6a 00                	push   $0x0
+80100b27:	50                   	push   %eax
+80100b28:	57                   	push   %edi
+80100b29:	e8 02 14 00 00       	call   80101f30 <readi>
+80100b2e:	83 c4 20             	add    $0x20,%esp
+80100b31:	83 f8 34             	cmp    $0x34,%eax
+80100b34:	0f 85 01 01 00 00    	jne    80100c3b <exec+0x15b>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+80100b3a:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+80100b41:	45 4c 46 
+80100b44:	0f 85 f1 00 00 00    	jne    80100c3b <exec+0x15b>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+80100b4a:	e8 a1 a6 00 00       	call   8010b1f0 <setupkvm>
+80100b4f:	89 85 f4 fe ff ff    	mov    %eax,-0x10c(%ebp)
+80100b55:	85 c0                	test   %eax,%eax
+80100b57:	0f 84 de 00 00 00    	je     80100c3b <exec+0x15b>
+    goto bad;
+
+  // Load program into memory.
+  sz = PGSIZE;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100b5d:	66 83 bd 50 ff ff ff 	cmpw   $0x0,-0xb0(%ebp)
+80100b64:	00 
+80100b65:	8b b5 40 ff ff ff    	mov    -0xc0(%ebp),%esi
+80100b6b:	0f 84 ad 02 00 00    	je     80100e1e <exec+0x33e>
+  sz = PGSIZE;
+80100b71:	c7 85 f0 fe ff ff 00 	movl   $0x1000,-0x110(%ebp)
+80100b78:	10 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100b7b:	31 db                	xor    %ebx,%ebx
+80100b7d:	e9 8c 00 00 00       	jmp    80100c0e <exec+0x12e>
+80100b82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+      goto bad;
+    if(ph.type != ELF_PROG_LOAD)
+80100b88:	83 bd 04 ff ff ff 01 	cmpl   $0x1,-0xfc(%ebp)
+80100b8f:	75 6c                	jne    80100bfd <exec+0x11d>
+      continue;
+    if(ph.memsz < ph.filesz)
+80100b91:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+80100b97:	3b 85 14 ff ff ff    	cmp    -0xec(%ebp),%eax
+80100b9d:	0f 82 87 00 00 00    	jb     80100c2a <exec+0x14a>
+      goto bad;
+    if(ph.vaddr + ph.memsz < ph.vaddr)
+80100ba3:	03 85 0c ff ff ff    	add    -0xf4(%ebp),%eax
+80100ba9:	72 7f                	jb     80100c2a <exec+0x14a>
+      goto bad;
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+80100bab:	83 ec 04             	sub    $0x4,%esp
+80100bae:	50                   	push   %eax
+80100baf:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+80100bb5:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100bbb:	e8 30 a2 00 00       	call   8010adf0 <allocuvm>
+80100bc0:	83 c4 10             	add    $0x10,%esp
+80100bc3:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80100bc9:	85 c0                	test   %eax,%eax
+80100bcb:	74 5d                	je     80100c2a <exec+0x14a>
+      goto bad;
+    if(ph.vaddr % PGSIZE != 0)
+80100bcd:	8b 85 0c ff ff ff    	mov    -0xf4(%ebp),%eax
+80100bd3:	a9 ff 0f 00 00       	test   $0xfff,%eax
+80100bd8:	75 50                	jne    80100c2a <exec+0x14a>
+      goto bad;
+    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+80100bda:	83 ec 0c             	sub    $0xc,%esp
+80100bdd:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+80100be3:	ff b5 08 ff ff ff    	push   -0xf8(%ebp)
+80100be9:	57                   	push   %edi
+80100bea:	50                   	push   %eax
+80100beb:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100bf1:	e8 2a a1 00 00       	call   8010ad20 <loaduvm>
+80100bf6:	83 c4 20             	add    $0x20,%esp
+80100bf9:	85 c0                	test   %eax,%eax
+80100bfb:	78 2d                	js     80100c2a <exec+0x14a>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100bfd:	0f b7 85 50 ff ff ff 	movzwl -0xb0(%ebp),%eax
+80100c04:	83 c3 01             	add    $0x1,%ebx
+80100c07:	83 c6 20             	add    $0x20,%esi
+80100c0a:	39 d8                	cmp    %ebx,%eax
+80100c0c:	7e 52                	jle    80100c60 <exec+0x180>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+80100c0e:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+80100c14:	6a 20                	push   $0x20
+80100c16:	56                   	push   %esi
+80100c17:	50                   	push   %eax
+80100c18:	57                   	push   %edi
+80100c19:	e8 12 13 00 00       	call   80101f30 <readi>
+80100c1e:	83 c4 10             	add    $0x10,%esp
+80100c21:	83 f8 20             	cmp    $0x20,%eax
+80100c24:	0f 84 5e ff ff ff    	je     80100b88 <exec+0xa8>
+  mmput(oldmm);
+  return 0;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+80100c2a:	83 ec 0c             	sub    $0xc,%esp
+80100c2d:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100c33:	e8 38 a5 00 00       	call   8010b170 <freevm>
+  if(ip){
+80100c38:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+80100c3b:	83 ec 0c             	sub    $0xc,%esp
+80100c3e:	57                   	push   %edi
+80100c3f:	e8 6c 12 00 00       	call   80101eb0 <iunlockput>
+    end_op();
+80100c44:	e8 a7 26 00 00       	call   801032f0 <end_op>
+80100c49:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80100c4c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  return -1;
+}
+80100c51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100c54:	5b                   	pop    %ebx
+80100c55:	5e                   	pop    %esi
+80100c56:	5f                   	pop    %edi
+80100c57:	5d                   	pop    %ebp
+80100c58:	c3                   	ret
+80100c59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sz = PGROUNDUP(sz);
+80100c60:	8b b5 f0 fe ff ff    	mov    -0x110(%ebp),%esi
+80100c66:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+80100c6c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80100c72:	8d 9e 00 20 00 00    	lea    0x2000(%esi),%ebx
+  iunlockput(ip);
+80100c78:	83 ec 0c             	sub    $0xc,%esp
+80100c7b:	57                   	push   %edi
+80100c7c:	e8 2f 12 00 00       	call   80101eb0 <iunlockput>
+  end_op();
+80100c81:	e8 6a 26 00 00       	call   801032f0 <end_op>
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80100c86:	83 c4 0c             	add    $0xc,%esp
+80100c89:	53                   	push   %ebx
+80100c8a:	56                   	push   %esi
+80100c8b:	8b b5 f4 fe ff ff    	mov    -0x10c(%ebp),%esi
+80100c91:	56                   	push   %esi
+80100c92:	e8 59 a1 00 00       	call   8010adf0 <allocuvm>
+80100c97:	83 c4 10             	add    $0x10,%esp
+80100c9a:	89 c7                	mov    %eax,%edi
+80100c9c:	85 c0                	test   %eax,%eax
+80100c9e:	0f 84 86 00 00 00    	je     80100d2a <exec+0x24a>
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100ca4:	83 ec 08             	sub    $0x8,%esp
+80100ca7:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+  for(argc = 0; argv[argc]; argc++) {
+80100cad:	89 fb                	mov    %edi,%ebx
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100caf:	50                   	push   %eax
+80100cb0:	56                   	push   %esi
+  for(argc = 0; argv[argc]; argc++) {
+80100cb1:	31 f6                	xor    %esi,%esi
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100cb3:	e8 78 a7 00 00       	call   8010b430 <clearpteu>
+  for(argc = 0; argv[argc]; argc++) {
+80100cb8:	8b 45 0c             	mov    0xc(%ebp),%eax
+80100cbb:	83 c4 10             	add    $0x10,%esp
+80100cbe:	8b 10                	mov    (%eax),%edx
+80100cc0:	85 d2                	test   %edx,%edx
+80100cc2:	0f 84 65 01 00 00    	je     80100e2d <exec+0x34d>
+80100cc8:	89 bd f0 fe ff ff    	mov    %edi,-0x110(%ebp)
+80100cce:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80100cd1:	eb 23                	jmp    80100cf6 <exec+0x216>
+80100cd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100cd7:	90                   	nop
+80100cd8:	8d 46 01             	lea    0x1(%esi),%eax
+    ustack[3+argc] = sp;
+80100cdb:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+80100ce2:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+  for(argc = 0; argv[argc]; argc++) {
+80100ce8:	8b 14 87             	mov    (%edi,%eax,4),%edx
+80100ceb:	85 d2                	test   %edx,%edx
+80100ced:	74 51                	je     80100d40 <exec+0x260>
+    if(argc >= MAXARG)
+80100cef:	83 f8 20             	cmp    $0x20,%eax
+80100cf2:	74 36                	je     80100d2a <exec+0x24a>
+  for(argc = 0; argv[argc]; argc++) {
+80100cf4:	89 c6                	mov    %eax,%esi
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80100cf6:	83 ec 0c             	sub    $0xc,%esp
+80100cf9:	52                   	push   %edx
+80100cfa:	e8 a1 74 00 00       	call   801081a0 <strlen>
+80100cff:	29 c3                	sub    %eax,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80100d01:	58                   	pop    %eax
+80100d02:	ff 34 b7             	push   (%edi,%esi,4)
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80100d05:	83 eb 01             	sub    $0x1,%ebx
+80100d08:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80100d0b:	e8 90 74 00 00       	call   801081a0 <strlen>
+80100d10:	83 c0 01             	add    $0x1,%eax
+80100d13:	50                   	push   %eax
+80100d14:	ff 34 b7             	push   (%edi,%esi,4)
+80100d17:	53                   	push   %ebx
+80100d18:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100d1e:	e8 dd a8 00 00       	call   8010b600 <copyout>
+80100d23:	83 c4 20             	add    $0x20,%esp
+80100d26:	85 c0                	test   %eax,%eax
+80100d28:	79 ae                	jns    80100cd8 <exec+0x1f8>
+    freevm(pgdir);
+80100d2a:	83 ec 0c             	sub    $0xc,%esp
+80100d2d:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100d33:	e8 38 a4 00 00       	call   8010b170 <freevm>
+80100d38:	83 c4 10             	add    $0x10,%esp
+80100d3b:	e9 0c ff ff ff       	jmp    80100c4c <exec+0x16c>
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100d40:	8d 14 b5 08 00 00 00 	lea    0x8(,%esi,4),%edx
+  ustack[3+argc] = 0;
+80100d47:	8b bd f0 fe ff ff    	mov    -0x110(%ebp),%edi
+80100d4d:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80100d53:	8d 46 04             	lea    0x4(%esi),%eax
+  sp -= (3+argc+1) * 4;
+80100d56:	8d 72 0c             	lea    0xc(%edx),%esi
+  ustack[3+argc] = 0;
+80100d59:	c7 84 85 58 ff ff ff 	movl   $0x0,-0xa8(%ebp,%eax,4)
+80100d60:	00 00 00 00 
+  ustack[1] = argc;
+80100d64:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  ustack[0] = 0xffffffff;  // fake return PC
+80100d6a:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80100d71:	ff ff ff 
+  ustack[1] = argc;
+80100d74:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100d7a:	89 d8                	mov    %ebx,%eax
+  sp -= (3+argc+1) * 4;
+80100d7c:	29 f3                	sub    %esi,%ebx
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100d7e:	29 d0                	sub    %edx,%eax
+80100d80:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+80100d86:	56                   	push   %esi
+80100d87:	51                   	push   %ecx
+80100d88:	53                   	push   %ebx
+80100d89:	8b b5 f4 fe ff ff    	mov    -0x10c(%ebp),%esi
+80100d8f:	56                   	push   %esi
+80100d90:	e8 6b a8 00 00       	call   8010b600 <copyout>
+80100d95:	83 c4 10             	add    $0x10,%esp
+80100d98:	85 c0                	test   %eax,%eax
+80100d9a:	78 8e                	js     80100d2a <exec+0x24a>
+  if((mm = mmalloc(pgdir, sz)) == 0)
+80100d9c:	83 ec 08             	sub    $0x8,%esp
+80100d9f:	57                   	push   %edi
+80100da0:	56                   	push   %esi
+80100da1:	e8 0a a5 00 00       	call   8010b2b0 <mmalloc>
+80100da6:	83 c4 10             	add    $0x10,%esp
+80100da9:	89 c6                	mov    %eax,%esi
+80100dab:	85 c0                	test   %eax,%eax
+80100dad:	0f 84 77 ff ff ff    	je     80100d2a <exec+0x24a>
+  for(last=s=path; *s; s++)
+80100db3:	8b 45 08             	mov    0x8(%ebp),%eax
+80100db6:	8b 55 08             	mov    0x8(%ebp),%edx
+80100db9:	0f b6 00             	movzbl (%eax),%eax
+80100dbc:	84 c0                	test   %al,%al
+80100dbe:	74 17                	je     80100dd7 <exec+0x2f7>
+80100dc0:	89 d1                	mov    %edx,%ecx
+80100dc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      last = s+1;
+80100dc8:	83 c1 01             	add    $0x1,%ecx
+80100dcb:	3c 2f                	cmp    $0x2f,%al
+  for(last=s=path; *s; s++)
+80100dcd:	0f b6 01             	movzbl (%ecx),%eax
+      last = s+1;
+80100dd0:	0f 44 d1             	cmove  %ecx,%edx
+  for(last=s=path; *s; s++)
+80100dd3:	84 c0                	test   %al,%al
+80100dd5:	75 f1                	jne    80100dc8 <exec+0x2e8>
+  safestrcpy(curproc->name, last, sizeof(curproc->name));
+80100dd7:	83 ec 04             	sub    $0x4,%esp
+80100dda:	6a 10                	push   $0x10
+80100ddc:	52                   	push   %edx
+80100ddd:	8b bd ec fe ff ff    	mov    -0x114(%ebp),%edi
+80100de3:	8d 47 48             	lea    0x48(%edi),%eax
+80100de6:	50                   	push   %eax
+80100de7:	e8 74 73 00 00       	call   80108160 <safestrcpy>
+  oldmm = curproc->mm;
+80100dec:	89 f9                	mov    %edi,%ecx
+80100dee:	8b 3f                	mov    (%edi),%edi
+  curproc->tf->eip = elf.entry;  // main
+80100df0:	8b 41 24             	mov    0x24(%ecx),%eax
+  curproc->mm = mm;
+80100df3:	89 31                	mov    %esi,(%ecx)
+  curproc->tf->eip = elf.entry;  // main
+80100df5:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+80100dfb:	89 50 38             	mov    %edx,0x38(%eax)
+  curproc->tf->esp = sp;
+80100dfe:	8b 41 24             	mov    0x24(%ecx),%eax
+80100e01:	89 58 44             	mov    %ebx,0x44(%eax)
+  switchuvm(curproc);
+80100e04:	89 0c 24             	mov    %ecx,(%esp)
+80100e07:	e8 74 9d 00 00       	call   8010ab80 <switchuvm>
+  mmput(oldmm);
+80100e0c:	89 3c 24             	mov    %edi,(%esp)
+80100e0f:	e8 ac a5 00 00       	call   8010b3c0 <mmput>
+  return 0;
+80100e14:	83 c4 10             	add    $0x10,%esp
+80100e17:	31 c0                	xor    %eax,%eax
+80100e19:	e9 33 fe ff ff       	jmp    80100c51 <exec+0x171>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100e1e:	bb 00 30 00 00       	mov    $0x3000,%ebx
+80100e23:	be 00 10 00 00       	mov    $0x1000,%esi
+80100e28:	e9 4b fe ff ff       	jmp    80100c78 <exec+0x198>
+  for(argc = 0; argv[argc]; argc++) {
+80100e2d:	be 10 00 00 00       	mov    $0x10,%esi
+80100e32:	ba 04 00 00 00       	mov    $0x4,%edx
+80100e37:	b8 03 00 00 00       	mov    $0x3,%eax
+80100e3c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80100e43:	00 00 00 
+80100e46:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+80100e4c:	e9 08 ff ff ff       	jmp    80100d59 <exec+0x279>
+    end_op();
+80100e51:	e8 9a 24 00 00       	call   801032f0 <end_op>
+    cprintf("exec: fail\n");
+80100e56:	83 ec 0c             	sub    $0xc,%esp
+80100e59:	68 a1 ba 10 80       	push   $0x8010baa1
+80100e5e:	e8 4d f8 ff ff       	call   801006b0 <cprintf>
+    return -1;
+80100e63:	83 c4 10             	add    $0x10,%esp
+80100e66:	e9 e1 fd ff ff       	jmp    80100c4c <exec+0x16c>
+80100e6b:	66 90                	xchg   %ax,%ax
+80100e6d:	66 90                	xchg   %ax,%ax
+80100e6f:	90                   	nop
+
+80100e70 <fileinit>:
+  struct cwd *cwdfree;
+} fdcache;
+
+void
+fileinit(void)
+{
+80100e70:	55                   	push   %ebp
+80100e71:	89 e5                	mov    %esp,%ebp
+80100e73:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80100e76:	68 ad ba 10 80       	push   $0x8010baad
+80100e7b:	68 60 3f 11 80       	push   $0x80113f60
+80100e80:	e8 6b 6e 00 00       	call   80107cf0 <initlock>
+  initlock(&fdcache.lock, "fdcache");
+80100e85:	58                   	pop    %eax
+80100e86:	5a                   	pop    %edx
+80100e87:	68 b4 ba 10 80       	push   $0x8010bab4
+80100e8c:	68 60 49 11 80       	push   $0x80114960
+80100e91:	e8 5a 6e 00 00       	call   80107cf0 <initlock>
+}
+80100e96:	83 c4 10             	add    $0x10,%esp
+80100e99:	c9                   	leave
+80100e9a:	c3                   	ret
+80100e9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100e9f:	90                   	nop
+
+80100ea0 <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+80100ea0:	55                   	push   %ebp
+80100ea1:	89 e5                	mov    %esp,%ebp
+80100ea3:	53                   	push   %ebx
+  struct file *f;
+
+  acquire(&ftable.lock);
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80100ea4:	bb 94 3f 11 80       	mov    $0x80113f94,%ebx
+{
+80100ea9:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ftable.lock);
+80100eac:	68 60 3f 11 80       	push   $0x80113f60
+80100eb1:	e8 1a 70 00 00       	call   80107ed0 <acquire>
+80100eb6:	83 c4 10             	add    $0x10,%esp
+80100eb9:	eb 10                	jmp    80100ecb <filealloc+0x2b>
+80100ebb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100ebf:	90                   	nop
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80100ec0:	83 c3 18             	add    $0x18,%ebx
+80100ec3:	81 fb f4 48 11 80    	cmp    $0x801148f4,%ebx
+80100ec9:	74 25                	je     80100ef0 <filealloc+0x50>
+    if(f->ref == 0){
+80100ecb:	8b 43 04             	mov    0x4(%ebx),%eax
+80100ece:	85 c0                	test   %eax,%eax
+80100ed0:	75 ee                	jne    80100ec0 <filealloc+0x20>
+      f->ref = 1;
+      release(&ftable.lock);
+80100ed2:	83 ec 0c             	sub    $0xc,%esp
+      f->ref = 1;
+80100ed5:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+      release(&ftable.lock);
+80100edc:	68 60 3f 11 80       	push   $0x80113f60
+80100ee1:	e8 8a 6f 00 00       	call   80107e70 <release>
+      return f;
+    }
+  }
+  release(&ftable.lock);
+  return 0;
+}
+80100ee6:	89 d8                	mov    %ebx,%eax
+      return f;
+80100ee8:	83 c4 10             	add    $0x10,%esp
+}
+80100eeb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100eee:	c9                   	leave
+80100eef:	c3                   	ret
+  release(&ftable.lock);
+80100ef0:	83 ec 0c             	sub    $0xc,%esp
+  return 0;
+80100ef3:	31 db                	xor    %ebx,%ebx
+  release(&ftable.lock);
+80100ef5:	68 60 3f 11 80       	push   $0x80113f60
+80100efa:	e8 71 6f 00 00       	call   80107e70 <release>
+}
+80100eff:	89 d8                	mov    %ebx,%eax
+  return 0;
+80100f01:	83 c4 10             	add    $0x10,%esp
+}
+80100f04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100f07:	c9                   	leave
+80100f08:	c3                   	ret
+80100f09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80100f10 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+80100f10:	55                   	push   %ebp
+80100f11:	89 e5                	mov    %esp,%ebp
+80100f13:	53                   	push   %ebx
+80100f14:	83 ec 10             	sub    $0x10,%esp
+80100f17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+80100f1a:	68 60 3f 11 80       	push   $0x80113f60
+80100f1f:	e8 ac 6f 00 00       	call   80107ed0 <acquire>
+  if(f->ref < 1)
+80100f24:	8b 43 04             	mov    0x4(%ebx),%eax
+80100f27:	83 c4 10             	add    $0x10,%esp
+80100f2a:	85 c0                	test   %eax,%eax
+80100f2c:	7e 1a                	jle    80100f48 <filedup+0x38>
+    panic("filedup");
+  f->ref++;
+80100f2e:	83 c0 01             	add    $0x1,%eax
+  release(&ftable.lock);
+80100f31:	83 ec 0c             	sub    $0xc,%esp
+  f->ref++;
+80100f34:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+80100f37:	68 60 3f 11 80       	push   $0x80113f60
+80100f3c:	e8 2f 6f 00 00       	call   80107e70 <release>
+  return f;
+}
+80100f41:	89 d8                	mov    %ebx,%eax
+80100f43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100f46:	c9                   	leave
+80100f47:	c3                   	ret
+    panic("filedup");
+80100f48:	83 ec 0c             	sub    $0xc,%esp
+80100f4b:	68 bc ba 10 80       	push   $0x8010babc
+80100f50:	e8 2b f4 ff ff       	call   80100380 <panic>
+80100f55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100f5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100f60 <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+80100f60:	55                   	push   %ebp
+80100f61:	89 e5                	mov    %esp,%ebp
+80100f63:	57                   	push   %edi
+80100f64:	56                   	push   %esi
+80100f65:	53                   	push   %ebx
+80100f66:	83 ec 28             	sub    $0x28,%esp
+80100f69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct file ff;
+
+  acquire(&ftable.lock);
+80100f6c:	68 60 3f 11 80       	push   $0x80113f60
+80100f71:	e8 5a 6f 00 00       	call   80107ed0 <acquire>
+  if(f->ref < 1)
+80100f76:	8b 53 04             	mov    0x4(%ebx),%edx
+80100f79:	83 c4 10             	add    $0x10,%esp
+80100f7c:	85 d2                	test   %edx,%edx
+80100f7e:	0f 8e a5 00 00 00    	jle    80101029 <fileclose+0xc9>
+    panic("fileclose");
+  if(--f->ref > 0){
+80100f84:	83 ea 01             	sub    $0x1,%edx
+80100f87:	89 53 04             	mov    %edx,0x4(%ebx)
+80100f8a:	75 44                	jne    80100fd0 <fileclose+0x70>
+    release(&ftable.lock);
+    return;
+  }
+  ff = *f;
+80100f8c:	0f b6 43 09          	movzbl 0x9(%ebx),%eax
+  f->ref = 0;
+  f->type = FD_NONE;
+  release(&ftable.lock);
+80100f90:	83 ec 0c             	sub    $0xc,%esp
+  ff = *f;
+80100f93:	8b 3b                	mov    (%ebx),%edi
+  f->type = FD_NONE;
+80100f95:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  ff = *f;
+80100f9b:	8b 73 0c             	mov    0xc(%ebx),%esi
+80100f9e:	88 45 e7             	mov    %al,-0x19(%ebp)
+80100fa1:	8b 43 10             	mov    0x10(%ebx),%eax
+80100fa4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  release(&ftable.lock);
+80100fa7:	68 60 3f 11 80       	push   $0x80113f60
+80100fac:	e8 bf 6e 00 00       	call   80107e70 <release>
+
+  if(ff.type == FD_PIPE)
+80100fb1:	83 c4 10             	add    $0x10,%esp
+80100fb4:	83 ff 01             	cmp    $0x1,%edi
+80100fb7:	74 57                	je     80101010 <fileclose+0xb0>
+    pipeclose(ff.pipe, ff.writable);
+  else if(ff.type == FD_INODE){
+80100fb9:	83 ff 02             	cmp    $0x2,%edi
+80100fbc:	74 2a                	je     80100fe8 <fileclose+0x88>
+    begin_op();
+    iput(ff.ip);
+    end_op();
+  }
+}
+80100fbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100fc1:	5b                   	pop    %ebx
+80100fc2:	5e                   	pop    %esi
+80100fc3:	5f                   	pop    %edi
+80100fc4:	5d                   	pop    %ebp
+80100fc5:	c3                   	ret
+80100fc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100fcd:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&ftable.lock);
+80100fd0:	c7 45 08 60 3f 11 80 	movl   $0x80113f60,0x8(%ebp)
+}
+80100fd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100fda:	5b                   	pop    %ebx
+80100fdb:	5e                   	pop    %esi
+80100fdc:	5f                   	pop    %edi
+80100fdd:	5d                   	pop    %ebp
+    release(&ftable.lock);
+80100fde:	e9 8d 6e 00 00       	jmp    80107e70 <release>
+80100fe3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100fe7:	90                   	nop
+    begin_op();
+80100fe8:	e8 93 22 00 00       	call   80103280 <begin_op>
+    iput(ff.ip);
+80100fed:	83 ec 0c             	sub    $0xc,%esp
+80100ff0:	ff 75 e0             	push   -0x20(%ebp)
+80100ff3:	e8 58 0d 00 00       	call   80101d50 <iput>
+    end_op();
+80100ff8:	83 c4 10             	add    $0x10,%esp
+}
+80100ffb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100ffe:	5b                   	pop    %ebx
+80100fff:	5e                   	pop    %esi
+80101000:	5f                   	pop    %edi
+80101001:	5d                   	pop    %ebp
+    end_op();
+80101002:	e9 e9 22 00 00       	jmp    801032f0 <end_op>
+80101007:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010100e:	66 90                	xchg   %ax,%ax
+    pipeclose(ff.pipe, ff.writable);
+80101010:	0f be 5d e7          	movsbl -0x19(%ebp),%ebx
+80101014:	83 ec 08             	sub    $0x8,%esp
+80101017:	53                   	push   %ebx
+80101018:	56                   	push   %esi
+80101019:	e8 42 2a 00 00       	call   80103a60 <pipeclose>
+8010101e:	83 c4 10             	add    $0x10,%esp
+}
+80101021:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101024:	5b                   	pop    %ebx
+80101025:	5e                   	pop    %esi
+80101026:	5f                   	pop    %edi
+80101027:	5d                   	pop    %ebp
+80101028:	c3                   	ret
+    panic("fileclose");
+80101029:	83 ec 0c             	sub    $0xc,%esp
+8010102c:	68 c4 ba 10 80       	push   $0x8010bac4
+80101031:	e8 4a f3 ff ff       	call   80100380 <panic>
+80101036:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010103d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101040 <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+80101040:	55                   	push   %ebp
+80101041:	89 e5                	mov    %esp,%ebp
+80101043:	53                   	push   %ebx
+80101044:	83 ec 04             	sub    $0x4,%esp
+80101047:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+8010104a:	83 3b 02             	cmpl   $0x2,(%ebx)
+8010104d:	75 31                	jne    80101080 <filestat+0x40>
+    ilock(f->ip);
+8010104f:	83 ec 0c             	sub    $0xc,%esp
+80101052:	ff 73 10             	push   0x10(%ebx)
+80101055:	e8 c6 0b 00 00       	call   80101c20 <ilock>
+    stati(f->ip, st);
+8010105a:	58                   	pop    %eax
+8010105b:	5a                   	pop    %edx
+8010105c:	ff 75 0c             	push   0xc(%ebp)
+8010105f:	ff 73 10             	push   0x10(%ebx)
+80101062:	e8 99 0e 00 00       	call   80101f00 <stati>
+    iunlock(f->ip);
+80101067:	59                   	pop    %ecx
+80101068:	ff 73 10             	push   0x10(%ebx)
+8010106b:	e8 90 0c 00 00       	call   80101d00 <iunlock>
+    return 0;
+  }
+  return -1;
+}
+80101070:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80101073:	83 c4 10             	add    $0x10,%esp
+80101076:	31 c0                	xor    %eax,%eax
+}
+80101078:	c9                   	leave
+80101079:	c3                   	ret
+8010107a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101080:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+80101083:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80101088:	c9                   	leave
+80101089:	c3                   	ret
+8010108a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101090 <fileread>:
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+80101090:	55                   	push   %ebp
+80101091:	89 e5                	mov    %esp,%ebp
+80101093:	57                   	push   %edi
+80101094:	56                   	push   %esi
+80101095:	53                   	push   %ebx
+80101096:	83 ec 0c             	sub    $0xc,%esp
+80101099:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010109c:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010109f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int r;
+
+  if(f->readable == 0)
+801010a2:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+801010a6:	74 60                	je     80101108 <fileread+0x78>
+    return -1;
+  if(f->type == FD_PIPE)
+801010a8:	8b 03                	mov    (%ebx),%eax
+801010aa:	83 f8 01             	cmp    $0x1,%eax
+801010ad:	74 41                	je     801010f0 <fileread+0x60>
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+801010af:	83 f8 02             	cmp    $0x2,%eax
+801010b2:	75 5b                	jne    8010110f <fileread+0x7f>
+    ilock(f->ip);
+801010b4:	83 ec 0c             	sub    $0xc,%esp
+801010b7:	ff 73 10             	push   0x10(%ebx)
+801010ba:	e8 61 0b 00 00       	call   80101c20 <ilock>
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+801010bf:	57                   	push   %edi
+801010c0:	ff 73 14             	push   0x14(%ebx)
+801010c3:	56                   	push   %esi
+801010c4:	ff 73 10             	push   0x10(%ebx)
+801010c7:	e8 64 0e 00 00       	call   80101f30 <readi>
+801010cc:	83 c4 20             	add    $0x20,%esp
+801010cf:	89 c6                	mov    %eax,%esi
+801010d1:	85 c0                	test   %eax,%eax
+801010d3:	7e 03                	jle    801010d8 <fileread+0x48>
+      f->off += r;
+801010d5:	01 43 14             	add    %eax,0x14(%ebx)
+    iunlock(f->ip);
+801010d8:	83 ec 0c             	sub    $0xc,%esp
+801010db:	ff 73 10             	push   0x10(%ebx)
+801010de:	e8 1d 0c 00 00       	call   80101d00 <iunlock>
+    return r;
+801010e3:	83 c4 10             	add    $0x10,%esp
+  }
+  panic("fileread");
+}
+801010e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801010e9:	89 f0                	mov    %esi,%eax
+801010eb:	5b                   	pop    %ebx
+801010ec:	5e                   	pop    %esi
+801010ed:	5f                   	pop    %edi
+801010ee:	5d                   	pop    %ebp
+801010ef:	c3                   	ret
+    return piperead(f->pipe, addr, n);
+801010f0:	8b 43 0c             	mov    0xc(%ebx),%eax
+801010f3:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+801010f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801010f9:	5b                   	pop    %ebx
+801010fa:	5e                   	pop    %esi
+801010fb:	5f                   	pop    %edi
+801010fc:	5d                   	pop    %ebp
+    return piperead(f->pipe, addr, n);
+801010fd:	e9 1e 2b 00 00       	jmp    80103c20 <piperead>
+80101102:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80101108:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010110d:	eb d7                	jmp    801010e6 <fileread+0x56>
+  panic("fileread");
+8010110f:	83 ec 0c             	sub    $0xc,%esp
+80101112:	68 ce ba 10 80       	push   $0x8010bace
+80101117:	e8 64 f2 ff ff       	call   80100380 <panic>
+8010111c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101120 <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+80101120:	55                   	push   %ebp
+80101121:	89 e5                	mov    %esp,%ebp
+80101123:	57                   	push   %edi
+80101124:	56                   	push   %esi
+80101125:	53                   	push   %ebx
+80101126:	83 ec 1c             	sub    $0x1c,%esp
+80101129:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010112c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010112f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80101132:	8b 45 10             	mov    0x10(%ebp),%eax
+  int r;
+
+  if(f->writable == 0)
+80101135:	80 7b 09 00          	cmpb   $0x0,0x9(%ebx)
+{
+80101139:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(f->writable == 0)
+8010113c:	0f 84 bb 00 00 00    	je     801011fd <filewrite+0xdd>
+    return -1;
+  if(f->type == FD_PIPE)
+80101142:	8b 03                	mov    (%ebx),%eax
+80101144:	83 f8 01             	cmp    $0x1,%eax
+80101147:	0f 84 bf 00 00 00    	je     8010120c <filewrite+0xec>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+8010114d:	83 f8 02             	cmp    $0x2,%eax
+80101150:	0f 85 c8 00 00 00    	jne    8010121e <filewrite+0xfe>
+    // and 2 blocks of slop for non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int i = 0;
+    while(i < n){
+80101156:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    int i = 0;
+80101159:	31 f6                	xor    %esi,%esi
+    while(i < n){
+8010115b:	85 c0                	test   %eax,%eax
+8010115d:	7f 30                	jg     8010118f <filewrite+0x6f>
+8010115f:	e9 94 00 00 00       	jmp    801011f8 <filewrite+0xd8>
+80101164:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        n1 = max;
+
+      begin_op();
+      ilock(f->ip);
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+        f->off += r;
+80101168:	01 43 14             	add    %eax,0x14(%ebx)
+      iunlock(f->ip);
+8010116b:	83 ec 0c             	sub    $0xc,%esp
+        f->off += r;
+8010116e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(f->ip);
+80101171:	ff 73 10             	push   0x10(%ebx)
+80101174:	e8 87 0b 00 00       	call   80101d00 <iunlock>
+      end_op();
+80101179:	e8 72 21 00 00       	call   801032f0 <end_op>
+
+      if(r < 0)
+        break;
+      if(r != n1)
+8010117e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101181:	83 c4 10             	add    $0x10,%esp
+80101184:	39 c7                	cmp    %eax,%edi
+80101186:	75 5c                	jne    801011e4 <filewrite+0xc4>
+        panic("short filewrite");
+      i += r;
+80101188:	01 fe                	add    %edi,%esi
+    while(i < n){
+8010118a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+8010118d:	7e 69                	jle    801011f8 <filewrite+0xd8>
+      int n1 = n - i;
+8010118f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if(n1 > max)
+80101192:	b8 00 06 00 00       	mov    $0x600,%eax
+      int n1 = n - i;
+80101197:	29 f7                	sub    %esi,%edi
+      if(n1 > max)
+80101199:	39 c7                	cmp    %eax,%edi
+8010119b:	0f 4f f8             	cmovg  %eax,%edi
+      begin_op();
+8010119e:	e8 dd 20 00 00       	call   80103280 <begin_op>
+      ilock(f->ip);
+801011a3:	83 ec 0c             	sub    $0xc,%esp
+801011a6:	ff 73 10             	push   0x10(%ebx)
+801011a9:	e8 72 0a 00 00       	call   80101c20 <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+801011ae:	57                   	push   %edi
+801011af:	ff 73 14             	push   0x14(%ebx)
+801011b2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801011b5:	01 f0                	add    %esi,%eax
+801011b7:	50                   	push   %eax
+801011b8:	ff 73 10             	push   0x10(%ebx)
+801011bb:	e8 70 0e 00 00       	call   80102030 <writei>
+801011c0:	83 c4 20             	add    $0x20,%esp
+801011c3:	85 c0                	test   %eax,%eax
+801011c5:	7f a1                	jg     80101168 <filewrite+0x48>
+801011c7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(f->ip);
+801011ca:	83 ec 0c             	sub    $0xc,%esp
+801011cd:	ff 73 10             	push   0x10(%ebx)
+801011d0:	e8 2b 0b 00 00       	call   80101d00 <iunlock>
+      end_op();
+801011d5:	e8 16 21 00 00       	call   801032f0 <end_op>
+      if(r < 0)
+801011da:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801011dd:	83 c4 10             	add    $0x10,%esp
+801011e0:	85 c0                	test   %eax,%eax
+801011e2:	75 14                	jne    801011f8 <filewrite+0xd8>
+        panic("short filewrite");
+801011e4:	83 ec 0c             	sub    $0xc,%esp
+801011e7:	68 d7 ba 10 80       	push   $0x8010bad7
+801011ec:	e8 8f f1 ff ff       	call   80100380 <panic>
+801011f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+    return i == n ? n : -1;
+801011f8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+801011fb:	74 05                	je     80101202 <filewrite+0xe2>
+    return -1;
+801011fd:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  }
+  panic("filewrite");
+}
+80101202:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101205:	89 f0                	mov    %esi,%eax
+80101207:	5b                   	pop    %ebx
+80101208:	5e                   	pop    %esi
+80101209:	5f                   	pop    %edi
+8010120a:	5d                   	pop    %ebp
+8010120b:	c3                   	ret
+    return pipewrite(f->pipe, addr, n);
+8010120c:	8b 43 0c             	mov    0xc(%ebx),%eax
+8010120f:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80101212:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101215:	5b                   	pop    %ebx
+80101216:	5e                   	pop    %esi
+80101217:	5f                   	pop    %edi
+80101218:	5d                   	pop    %ebp
+    return pipewrite(f->pipe, addr, n);
+80101219:	e9 e2 28 00 00       	jmp    80103b00 <pipewrite>
+  panic("filewrite");
+8010121e:	83 ec 0c             	sub    $0xc,%esp
+80101221:	68 dd ba 10 80       	push   $0x8010badd
+80101226:	e8 55 f1 ff ff       	call   80100380 <panic>
+8010122b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010122f:	90                   	nop
+
+80101230 <fdtalloc>:
+}
+
+// Allocate an empty descriptor table with one reference.
+struct fdtable*
+fdtalloc(void)
+{
+80101230:	55                   	push   %ebp
+80101231:	89 e5                	mov    %esp,%ebp
+80101233:	56                   	push   %esi
+80101234:	53                   	push   %ebx
+  struct fdtable *fdt;
+
+  acquire(&fdcache.lock);
+80101235:	83 ec 0c             	sub    $0xc,%esp
+80101238:	68 60 49 11 80       	push   $0x80114960
+8010123d:	e8 8e 6c 00 00       	call   80107ed0 <acquire>
+  if(*free == 0){
+80101242:	8b 1d 94 49 11 80    	mov    0x80114994,%ebx
+80101248:	83 c4 10             	add    $0x10,%esp
+8010124b:	85 db                	test   %ebx,%ebx
+8010124d:	74 49                	je     80101298 <fdtalloc+0x68>
+  *free = *(void**)o;
+8010124f:	8b 03                	mov    (%ebx),%eax
+  fdt = carve((void**)&fdcache.fdtfree, sizeof(*fdt));
+  release(&fdcache.lock);
+80101251:	83 ec 0c             	sub    $0xc,%esp
+  *free = *(void**)o;
+80101254:	a3 94 49 11 80       	mov    %eax,0x80114994
+  release(&fdcache.lock);
+80101259:	68 60 49 11 80       	push   $0x80114960
+8010125e:	e8 0d 6c 00 00       	call   80107e70 <release>
+  if(fdt == 0)
+    return 0;
+  memset(fdt, 0, sizeof(*fdt));
+80101263:	83 c4 0c             	add    $0xc,%esp
+80101266:	6a 7c                	push   $0x7c
+80101268:	6a 00                	push   $0x0
+8010126a:	53                   	push   %ebx
+8010126b:	e8 40 6d 00 00       	call   80107fb0 <memset>
+  initlock(&fdt->lock, "fdtable");
+80101270:	58                   	pop    %eax
+80101271:	8d 43 04             	lea    0x4(%ebx),%eax
+80101274:	5a                   	pop    %edx
+80101275:	68 e7 ba 10 80       	push   $0x8010bae7
+8010127a:	50                   	push   %eax
+8010127b:	e8 70 6a 00 00       	call   80107cf0 <initlock>
+  fdt->ref = 1;
+80101280:	c7 43 38 01 00 00 00 	movl   $0x1,0x38(%ebx)
+  return fdt;
+80101287:	83 c4 10             	add    $0x10,%esp
+}
+8010128a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010128d:	89 d8                	mov    %ebx,%eax
+8010128f:	5b                   	pop    %ebx
+80101290:	5e                   	pop    %esi
+80101291:	5d                   	pop    %ebp
+80101292:	c3                   	ret
+80101293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101297:	90                   	nop
+    if((page = kalloc()) == 0)
+80101298:	e8 83 18 00 00       	call   80102b20 <kalloc>
+8010129d:	89 c3                	mov    %eax,%ebx
+8010129f:	85 c0                	test   %eax,%eax
+801012a1:	74 29                	je     801012cc <fdtalloc+0x9c>
+      *(void**)(page + i) = *free;
+801012a3:	8b 15 94 49 11 80    	mov    0x80114994,%edx
+801012a9:	8d b0 fc 0f 00 00    	lea    0xffc(%eax),%esi
+801012af:	90                   	nop
+801012b0:	89 d1                	mov    %edx,%ecx
+801012b2:	89 c2                	mov    %eax,%edx
+    for(i = 0; i + size <= PGSIZE; i += size){
+801012b4:	83 c0 7c             	add    $0x7c,%eax
+      *(void**)(page + i) = *free;
+801012b7:	89 48 84             	mov    %ecx,-0x7c(%eax)
+    for(i = 0; i + size <= PGSIZE; i += size){
+801012ba:	39 f0                	cmp    %esi,%eax
+801012bc:	75 f2                	jne    801012b0 <fdtalloc+0x80>
+801012be:	89 15 94 49 11 80    	mov    %edx,0x80114994
+      *(void**)(page + i) = *free;
+801012c4:	81 c3 80 0f 00 00    	add    $0xf80,%ebx
+801012ca:	eb 83                	jmp    8010124f <fdtalloc+0x1f>
+  release(&fdcache.lock);
+801012cc:	83 ec 0c             	sub    $0xc,%esp
+801012cf:	68 60 49 11 80       	push   $0x80114960
+801012d4:	e8 97 6b 00 00       	call   80107e70 <release>
+801012d9:	83 c4 10             	add    $0x10,%esp
+801012dc:	eb ac                	jmp    8010128a <fdtalloc+0x5a>
+801012de:	66 90                	xchg   %ax,%ax
+
+801012e0 <fdtcopy>:
+
+// Allocate a table holding the files open in fdt, for fork().
+struct fdtable*
+fdtcopy(struct fdtable *fdt)
+{
+801012e0:	55                   	push   %ebp
+801012e1:	89 e5                	mov    %esp,%ebp
+801012e3:	57                   	push   %edi
+801012e4:	56                   	push   %esi
+801012e5:	53                   	push   %ebx
+801012e6:	83 ec 1c             	sub    $0x1c,%esp
+801012e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct fdtable *nfdt;
+  int fd;
+
+  if((nfdt = fdtalloc()) == 0)
+801012ec:	e8 3f ff ff ff       	call   80101230 <fdtalloc>
+801012f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801012f4:	85 c0                	test   %eax,%eax
+801012f6:	74 6a                	je     80101362 <fdtcopy+0x82>
+    return 0;
+  acquire(&fdt->lock);
+801012f8:	8d 43 04             	lea    0x4(%ebx),%eax
+801012fb:	83 ec 0c             	sub    $0xc,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+801012fe:	31 ff                	xor    %edi,%edi
+  acquire(&fdt->lock);
+80101300:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101303:	50                   	push   %eax
+80101304:	e8 c7 6b 00 00       	call   80107ed0 <acquire>
+80101309:	83 c4 10             	add    $0x10,%esp
+8010130c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(fdt->ofile[fd])
+80101310:	8b 74 bb 3c          	mov    0x3c(%ebx,%edi,4),%esi
+80101314:	85 f6                	test   %esi,%esi
+80101316:	74 34                	je     8010134c <fdtcopy+0x6c>
+  acquire(&ftable.lock);
+80101318:	83 ec 0c             	sub    $0xc,%esp
+8010131b:	68 60 3f 11 80       	push   $0x80113f60
+80101320:	e8 ab 6b 00 00       	call   80107ed0 <acquire>
+  if(f->ref < 1)
+80101325:	8b 4e 04             	mov    0x4(%esi),%ecx
+80101328:	83 c4 10             	add    $0x10,%esp
+8010132b:	85 c9                	test   %ecx,%ecx
+8010132d:	7e 3e                	jle    8010136d <fdtcopy+0x8d>
+  release(&ftable.lock);
+8010132f:	83 ec 0c             	sub    $0xc,%esp
+  f->ref++;
+80101332:	83 c1 01             	add    $0x1,%ecx
+80101335:	89 4e 04             	mov    %ecx,0x4(%esi)
+  release(&ftable.lock);
+80101338:	68 60 3f 11 80       	push   $0x80113f60
+8010133d:	e8 2e 6b 00 00       	call   80107e70 <release>
+      nfdt->ofile[fd] = filedup(fdt->ofile[fd]);
+80101342:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101345:	83 c4 10             	add    $0x10,%esp
+80101348:	89 74 b8 3c          	mov    %esi,0x3c(%eax,%edi,4)
+  for(fd = 0; fd < NOFILE; fd++)
+8010134c:	83 c7 01             	add    $0x1,%edi
+8010134f:	83 ff 10             	cmp    $0x10,%edi
+80101352:	75 bc                	jne    80101310 <fdtcopy+0x30>
+  release(&fdt->lock);
+80101354:	83 ec 0c             	sub    $0xc,%esp
+80101357:	ff 75 e0             	push   -0x20(%ebp)
+8010135a:	e8 11 6b 00 00       	call   80107e70 <release>
+  return nfdt;
+8010135f:	83 c4 10             	add    $0x10,%esp
+}
+80101362:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101365:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101368:	5b                   	pop    %ebx
+80101369:	5e                   	pop    %esi
+8010136a:	5f                   	pop    %edi
+8010136b:	5d                   	pop    %ebp
+8010136c:	c3                   	ret
+    panic("filedup");
+8010136d:	83 ec 0c             	sub    $0xc,%esp
+80101370:	68 bc ba 10 80       	push   $0x8010babc
+80101375:	e8 06 f0 ff ff       	call   80100380 <panic>
+8010137a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101380 <fdtdup>:
+
+// Increment ref count for descriptor table fdt.
+struct fdtable*
+fdtdup(struct fdtable *fdt)
+{
+80101380:	55                   	push   %ebp
+80101381:	89 e5                	mov    %esp,%ebp
+80101383:	56                   	push   %esi
+80101384:	53                   	push   %ebx
+80101385:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&fdt->lock);
+80101388:	8d 73 04             	lea    0x4(%ebx),%esi
+8010138b:	83 ec 0c             	sub    $0xc,%esp
+8010138e:	56                   	push   %esi
+8010138f:	e8 3c 6b 00 00       	call   80107ed0 <acquire>
+  fdt->ref++;
+80101394:	83 43 38 01          	addl   $0x1,0x38(%ebx)
+  release(&fdt->lock);
+80101398:	89 34 24             	mov    %esi,(%esp)
+8010139b:	e8 d0 6a 00 00       	call   80107e70 <release>
+  return fdt;
+}
+801013a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801013a3:	89 d8                	mov    %ebx,%eax
+801013a5:	5b                   	pop    %ebx
+801013a6:	5e                   	pop    %esi
+801013a7:	5d                   	pop    %ebp
+801013a8:	c3                   	ret
+801013a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801013b0 <fdtput>:
+
+// Drop a reference to fdt, closing its files with the last.
+void
+fdtput(struct fdtable *fdt)
+{
+801013b0:	55                   	push   %ebp
+801013b1:	89 e5                	mov    %esp,%ebp
+801013b3:	57                   	push   %edi
+801013b4:	56                   	push   %esi
+801013b5:	53                   	push   %ebx
+801013b6:	83 ec 18             	sub    $0x18,%esp
+801013b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int fd, ref;
+
+  acquire(&fdt->lock);
+801013bc:	8d 77 04             	lea    0x4(%edi),%esi
+801013bf:	56                   	push   %esi
+801013c0:	e8 0b 6b 00 00       	call   80107ed0 <acquire>
+  ref = --fdt->ref;
+801013c5:	8b 47 38             	mov    0x38(%edi),%eax
+801013c8:	8d 58 ff             	lea    -0x1(%eax),%ebx
+801013cb:	89 5f 38             	mov    %ebx,0x38(%edi)
+  release(&fdt->lock);
+801013ce:	89 34 24             	mov    %esi,(%esp)
+801013d1:	e8 9a 6a 00 00       	call   80107e70 <release>
+  if(ref > 0)
+801013d6:	83 c4 10             	add    $0x10,%esp
+801013d9:	85 db                	test   %ebx,%ebx
+801013db:	7f 63                	jg     80101440 <fdtput+0x90>
+801013dd:	8d 5f 3c             	lea    0x3c(%edi),%ebx
+801013e0:	8d 77 7c             	lea    0x7c(%edi),%esi
+801013e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801013e7:	90                   	nop
+    return;
+  for(fd = 0; fd < NOFILE; fd++){
+    if(fdt->ofile[fd]){
+801013e8:	8b 03                	mov    (%ebx),%eax
+801013ea:	85 c0                	test   %eax,%eax
+801013ec:	74 12                	je     80101400 <fdtput+0x50>
+      fileclose(fdt->ofile[fd]);
+801013ee:	83 ec 0c             	sub    $0xc,%esp
+801013f1:	50                   	push   %eax
+801013f2:	e8 69 fb ff ff       	call   80100f60 <fileclose>
+      fdt->ofile[fd] = 0;
+801013f7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+801013fd:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++){
+80101400:	83 c3 04             	add    $0x4,%ebx
+80101403:	39 f3                	cmp    %esi,%ebx
+80101405:	75 e1                	jne    801013e8 <fdtput+0x38>
+    }
+  }
+  acquire(&fdcache.lock);
+80101407:	83 ec 0c             	sub    $0xc,%esp
+8010140a:	68 60 49 11 80       	push   $0x80114960
+8010140f:	e8 bc 6a 00 00       	call   80107ed0 <acquire>
+  fdt->next = fdcache.fdtfree;
+80101414:	a1 94 49 11 80       	mov    0x80114994,%eax
+  fdcache.fdtfree = fdt;
+  release(&fdcache.lock);
+80101419:	83 c4 10             	add    $0x10,%esp
+  fdt->next = fdcache.fdtfree;
+8010141c:	89 07                	mov    %eax,(%edi)
+  fdcache.fdtfree = fdt;
+8010141e:	89 3d 94 49 11 80    	mov    %edi,0x80114994
+  release(&fdcache.lock);
+80101424:	c7 45 08 60 49 11 80 	movl   $0x80114960,0x8(%ebp)
+}
+8010142b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010142e:	5b                   	pop    %ebx
+8010142f:	5e                   	pop    %esi
+80101430:	5f                   	pop    %edi
+80101431:	5d                   	pop    %ebp
+  release(&fdcache.lock);
+80101432:	e9 39 6a 00 00       	jmp    80107e70 <release>
+80101437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010143e:	66 90                	xchg   %ax,%ax
+}
+80101440:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101443:	5b                   	pop    %ebx
+80101444:	5e                   	pop    %esi
+80101445:	5f                   	pop    %edi
+80101446:	5d                   	pop    %ebp
+80101447:	c3                   	ret
+80101448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010144f:	90                   	nop
+
+80101450 <cwdalloc>:
+
+// Allocate a current directory at ip, taking over the
+// caller's reference to ip.
+struct cwd*
+cwdalloc(struct inode *ip)
+{
+80101450:	55                   	push   %ebp
+80101451:	89 e5                	mov    %esp,%ebp
+80101453:	56                   	push   %esi
+80101454:	53                   	push   %ebx
+  struct cwd *cwd;
+
+  acquire(&fdcache.lock);
+80101455:	83 ec 0c             	sub    $0xc,%esp
+80101458:	68 60 49 11 80       	push   $0x80114960
+8010145d:	e8 6e 6a 00 00       	call   80107ed0 <acquire>
+  if(*free == 0){
+80101462:	8b 1d 98 49 11 80    	mov    0x80114998,%ebx
+80101468:	83 c4 10             	add    $0x10,%esp
+8010146b:	85 db                	test   %ebx,%ebx
+8010146d:	74 41                	je     801014b0 <cwdalloc+0x60>
+  *free = *(void**)o;
+8010146f:	8b 03                	mov    (%ebx),%eax
+  cwd = carve((void**)&fdcache.cwdfree, sizeof(*cwd));
+  release(&fdcache.lock);
+80101471:	83 ec 0c             	sub    $0xc,%esp
+  *free = *(void**)o;
+80101474:	a3 98 49 11 80       	mov    %eax,0x80114998
+  release(&fdcache.lock);
+80101479:	68 60 49 11 80       	push   $0x80114960
+8010147e:	e8 ed 69 00 00       	call   80107e70 <release>
+  if(cwd == 0)
+    return 0;
+  initlock(&cwd->lock, "cwd");
+80101483:	58                   	pop    %eax
+80101484:	8d 43 04             	lea    0x4(%ebx),%eax
+80101487:	5a                   	pop    %edx
+80101488:	68 ef ba 10 80       	push   $0x8010baef
+8010148d:	50                   	push   %eax
+8010148e:	e8 5d 68 00 00       	call   80107cf0 <initlock>
+  cwd->ref = 1;
+  cwd->ip = ip;
+80101493:	8b 45 08             	mov    0x8(%ebp),%eax
+  cwd->ref = 1;
+80101496:	c7 43 38 01 00 00 00 	movl   $0x1,0x38(%ebx)
+  return cwd;
+8010149d:	83 c4 10             	add    $0x10,%esp
+  cwd->ip = ip;
+801014a0:	89 43 3c             	mov    %eax,0x3c(%ebx)
+}
+801014a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801014a6:	89 d8                	mov    %ebx,%eax
+801014a8:	5b                   	pop    %ebx
+801014a9:	5e                   	pop    %esi
+801014aa:	5d                   	pop    %ebp
+801014ab:	c3                   	ret
+801014ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((page = kalloc()) == 0)
+801014b0:	e8 6b 16 00 00       	call   80102b20 <kalloc>
+801014b5:	89 c3                	mov    %eax,%ebx
+801014b7:	85 c0                	test   %eax,%eax
+801014b9:	74 31                	je     801014ec <cwdalloc+0x9c>
+      *(void**)(page + i) = *free;
+801014bb:	8b 15 98 49 11 80    	mov    0x80114998,%edx
+801014c1:	8d b0 00 10 00 00    	lea    0x1000(%eax),%esi
+801014c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801014ce:	66 90                	xchg   %ax,%ax
+801014d0:	89 d1                	mov    %edx,%ecx
+801014d2:	89 c2                	mov    %eax,%edx
+    for(i = 0; i + size <= PGSIZE; i += size){
+801014d4:	83 c0 40             	add    $0x40,%eax
+      *(void**)(page + i) = *free;
+801014d7:	89 48 c0             	mov    %ecx,-0x40(%eax)
+    for(i = 0; i + size <= PGSIZE; i += size){
+801014da:	39 f0                	cmp    %esi,%eax
+801014dc:	75 f2                	jne    801014d0 <cwdalloc+0x80>
+801014de:	89 15 98 49 11 80    	mov    %edx,0x80114998
+      *(void**)(page + i) = *free;
+801014e4:	81 c3 c0 0f 00 00    	add    $0xfc0,%ebx
+801014ea:	eb 83                	jmp    8010146f <cwdalloc+0x1f>
+  release(&fdcache.lock);
+801014ec:	83 ec 0c             	sub    $0xc,%esp
+801014ef:	68 60 49 11 80       	push   $0x80114960
+801014f4:	e8 77 69 00 00       	call   80107e70 <release>
+801014f9:	83 c4 10             	add    $0x10,%esp
+801014fc:	eb a5                	jmp    801014a3 <cwdalloc+0x53>
+801014fe:	66 90                	xchg   %ax,%ax
+
+80101500 <cwdcopy>:
+
+// Allocate a current directory at the same inode as cwd.
+struct cwd*
+cwdcopy(struct cwd *cwd)
+{
+80101500:	55                   	push   %ebp
+80101501:	89 e5                	mov    %esp,%ebp
+80101503:	57                   	push   %edi
+80101504:	56                   	push   %esi
+80101505:	53                   	push   %ebx
+80101506:	83 ec 18             	sub    $0x18,%esp
+80101509:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct cwd *ncwd;
+
+  if((ncwd = cwdalloc(0)) == 0)
+8010150c:	6a 00                	push   $0x0
+8010150e:	e8 3d ff ff ff       	call   80101450 <cwdalloc>
+80101513:	83 c4 10             	add    $0x10,%esp
+80101516:	89 c3                	mov    %eax,%ebx
+80101518:	85 c0                	test   %eax,%eax
+8010151a:	74 25                	je     80101541 <cwdcopy+0x41>
+struct inode*
+cwdget(struct cwd *cwd)
+{
+  struct inode *ip;
+
+  acquire(&cwd->lock);
+8010151c:	83 ec 0c             	sub    $0xc,%esp
+8010151f:	8d 7e 04             	lea    0x4(%esi),%edi
+80101522:	57                   	push   %edi
+80101523:	e8 a8 69 00 00       	call   80107ed0 <acquire>
+  ip = idup(cwd->ip);
+80101528:	58                   	pop    %eax
+80101529:	ff 76 3c             	push   0x3c(%esi)
+8010152c:	e8 bf 06 00 00       	call   80101bf0 <idup>
+  release(&cwd->lock);
+80101531:	89 3c 24             	mov    %edi,(%esp)
+  ip = idup(cwd->ip);
+80101534:	89 c6                	mov    %eax,%esi
+  release(&cwd->lock);
+80101536:	e8 35 69 00 00       	call   80107e70 <release>
+  ncwd->ip = cwdget(cwd);
+8010153b:	89 73 3c             	mov    %esi,0x3c(%ebx)
+  return ncwd;
+8010153e:	83 c4 10             	add    $0x10,%esp
+}
+80101541:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101544:	89 d8                	mov    %ebx,%eax
+80101546:	5b                   	pop    %ebx
+80101547:	5e                   	pop    %esi
+80101548:	5f                   	pop    %edi
+80101549:	5d                   	pop    %ebp
+8010154a:	c3                   	ret
+8010154b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010154f:	90                   	nop
+
+80101550 <cwddup>:
+{
+80101550:	55                   	push   %ebp
+80101551:	89 e5                	mov    %esp,%ebp
+80101553:	56                   	push   %esi
+80101554:	53                   	push   %ebx
+80101555:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&cwd->lock);
+80101558:	8d 73 04             	lea    0x4(%ebx),%esi
+8010155b:	83 ec 0c             	sub    $0xc,%esp
+8010155e:	56                   	push   %esi
+8010155f:	e8 6c 69 00 00       	call   80107ed0 <acquire>
+  cwd->ref++;
+80101564:	83 43 38 01          	addl   $0x1,0x38(%ebx)
+  release(&cwd->lock);
+80101568:	89 34 24             	mov    %esi,(%esp)
+8010156b:	e8 00 69 00 00       	call   80107e70 <release>
+}
+80101570:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101573:	89 d8                	mov    %ebx,%eax
+80101575:	5b                   	pop    %ebx
+80101576:	5e                   	pop    %esi
+80101577:	5d                   	pop    %ebp
+80101578:	c3                   	ret
+80101579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101580 <cwdput>:
+{
+80101580:	55                   	push   %ebp
+80101581:	89 e5                	mov    %esp,%ebp
+80101583:	57                   	push   %edi
+80101584:	56                   	push   %esi
+80101585:	53                   	push   %ebx
+80101586:	83 ec 18             	sub    $0x18,%esp
+80101589:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&cwd->lock);
+8010158c:	8d 7b 04             	lea    0x4(%ebx),%edi
+8010158f:	57                   	push   %edi
+80101590:	e8 3b 69 00 00       	call   80107ed0 <acquire>
+  ref = --cwd->ref;
+80101595:	8b 43 38             	mov    0x38(%ebx),%eax
+80101598:	8d 70 ff             	lea    -0x1(%eax),%esi
+8010159b:	89 73 38             	mov    %esi,0x38(%ebx)
+  release(&cwd->lock);
+8010159e:	89 3c 24             	mov    %edi,(%esp)
+801015a1:	e8 ca 68 00 00       	call   80107e70 <release>
+  if(ref > 0)
+801015a6:	83 c4 10             	add    $0x10,%esp
+801015a9:	85 f6                	test   %esi,%esi
+801015ab:	7e 0b                	jle    801015b8 <cwdput+0x38>
+}
+801015ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801015b0:	5b                   	pop    %ebx
+801015b1:	5e                   	pop    %esi
+801015b2:	5f                   	pop    %edi
+801015b3:	5d                   	pop    %ebp
+801015b4:	c3                   	ret
+801015b5:	8d 76 00             	lea    0x0(%esi),%esi
+  begin_op();
+801015b8:	e8 c3 1c 00 00       	call   80103280 <begin_op>
+  iput(cwd->ip);
+801015bd:	83 ec 0c             	sub    $0xc,%esp
+801015c0:	ff 73 3c             	push   0x3c(%ebx)
+801015c3:	e8 88 07 00 00       	call   80101d50 <iput>
+  end_op();
+801015c8:	e8 23 1d 00 00       	call   801032f0 <end_op>
+  acquire(&fdcache.lock);
+801015cd:	c7 04 24 60 49 11 80 	movl   $0x80114960,(%esp)
+801015d4:	e8 f7 68 00 00       	call   80107ed0 <acquire>
+  cwd->next = fdcache.cwdfree;
+801015d9:	a1 98 49 11 80       	mov    0x80114998,%eax
+  release(&fdcache.lock);
+801015de:	83 c4 10             	add    $0x10,%esp
+  cwd->next = fdcache.cwdfree;
+801015e1:	89 03                	mov    %eax,(%ebx)
+  fdcache.cwdfree = cwd;
+801015e3:	89 1d 98 49 11 80    	mov    %ebx,0x80114998
+  release(&fdcache.lock);
+801015e9:	c7 45 08 60 49 11 80 	movl   $0x80114960,0x8(%ebp)
+}
+801015f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801015f3:	5b                   	pop    %ebx
+801015f4:	5e                   	pop    %esi
+801015f5:	5f                   	pop    %edi
+801015f6:	5d                   	pop    %ebp
+  release(&fdcache.lock);
+801015f7:	e9 74 68 00 00       	jmp    80107e70 <release>
+801015fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101600 <cwdget>:
+{
+80101600:	55                   	push   %ebp
+80101601:	89 e5                	mov    %esp,%ebp
+80101603:	56                   	push   %esi
+80101604:	53                   	push   %ebx
+80101605:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&cwd->lock);
+80101608:	8d 73 04             	lea    0x4(%ebx),%esi
+8010160b:	83 ec 0c             	sub    $0xc,%esp
+8010160e:	56                   	push   %esi
+8010160f:	e8 bc 68 00 00       	call   80107ed0 <acquire>
+  ip = idup(cwd->ip);
+80101614:	58                   	pop    %eax
+80101615:	ff 73 3c             	push   0x3c(%ebx)
+80101618:	e8 d3 05 00 00       	call   80101bf0 <idup>
+  release(&cwd->lock);
+8010161d:	89 34 24             	mov    %esi,(%esp)
+  ip = idup(cwd->ip);
+80101620:	89 c3                	mov    %eax,%ebx
+  release(&cwd->lock);
+80101622:	e8 49 68 00 00       	call   80107e70 <release>
+  return ip;
+}
+80101627:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010162a:	89 d8                	mov    %ebx,%eax
+8010162c:	5b                   	pop    %ebx
+8010162d:	5e                   	pop    %esi
+8010162e:	5d                   	pop    %ebp
+8010162f:	c3                   	ret
+
+80101630 <cwdset>:
+
+// Move cwd to ip, taking over the caller's reference to ip,
+// and return the inode it was at for the caller to iput().
+struct inode*
+cwdset(struct cwd *cwd, struct inode *ip)
+{
+80101630:	55                   	push   %ebp
+80101631:	89 e5                	mov    %esp,%ebp
+80101633:	57                   	push   %edi
+80101634:	56                   	push   %esi
+80101635:	53                   	push   %ebx
+80101636:	83 ec 18             	sub    $0x18,%esp
+80101639:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct inode *old;
+
+  acquire(&cwd->lock);
+8010163c:	8d 73 04             	lea    0x4(%ebx),%esi
+8010163f:	56                   	push   %esi
+80101640:	e8 8b 68 00 00       	call   80107ed0 <acquire>
+  old = cwd->ip;
+  cwd->ip = ip;
+80101645:	8b 45 0c             	mov    0xc(%ebp),%eax
+  old = cwd->ip;
+80101648:	8b 7b 3c             	mov    0x3c(%ebx),%edi
+  cwd->ip = ip;
+8010164b:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  release(&cwd->lock);
+8010164e:	89 34 24             	mov    %esi,(%esp)
+80101651:	e8 1a 68 00 00       	call   80107e70 <release>
+  return old;
+}
+80101656:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101659:	89 f8                	mov    %edi,%eax
+8010165b:	5b                   	pop    %ebx
+8010165c:	5e                   	pop    %esi
+8010165d:	5f                   	pop    %edi
+8010165e:	5d                   	pop    %ebp
+8010165f:	c3                   	ret
+
+80101660 <balloc>:
+// Blocks.
+
+// Allocate a zeroed disk block.
+static uint
+balloc(uint dev)
+{
+80101660:	55                   	push   %ebp
+80101661:	89 e5                	mov    %esp,%ebp
+80101663:	57                   	push   %edi
+80101664:	56                   	push   %esi
+80101665:	53                   	push   %ebx
+80101666:	83 ec 1c             	sub    $0x1c,%esp
+  int b, bi, m;
+  struct buf *bp;
+
+  bp = 0;
+  for(b = 0; b < sb.size; b += BPB){
+80101669:	8b 0d f4 65 11 80    	mov    0x801165f4,%ecx
+{
+8010166f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(b = 0; b < sb.size; b += BPB){
+80101672:	85 c9                	test   %ecx,%ecx
+80101674:	0f 84 8c 00 00 00    	je     80101706 <balloc+0xa6>
+8010167a:	31 ff                	xor    %edi,%edi
+    bp = bread(dev, BBLOCK(b, sb));
+8010167c:	89 f8                	mov    %edi,%eax
+8010167e:	83 ec 08             	sub    $0x8,%esp
+80101681:	89 fe                	mov    %edi,%esi
+80101683:	c1 f8 0c             	sar    $0xc,%eax
+80101686:	03 05 0c 66 11 80    	add    0x8011660c,%eax
+8010168c:	50                   	push   %eax
+8010168d:	ff 75 dc             	push   -0x24(%ebp)
+80101690:	e8 3b ea ff ff       	call   801000d0 <bread>
+80101695:	89 7d d8             	mov    %edi,-0x28(%ebp)
+80101698:	83 c4 10             	add    $0x10,%esp
+8010169b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+8010169e:	a1 f4 65 11 80       	mov    0x801165f4,%eax
+801016a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801016a6:	31 c0                	xor    %eax,%eax
+801016a8:	eb 32                	jmp    801016dc <balloc+0x7c>
+801016aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      m = 1 << (bi % 8);
+801016b0:	89 c1                	mov    %eax,%ecx
+801016b2:	bb 01 00 00 00       	mov    $0x1,%ebx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+801016b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      m = 1 << (bi % 8);
+801016ba:	83 e1 07             	and    $0x7,%ecx
+801016bd:	d3 e3                	shl    %cl,%ebx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+801016bf:	89 c1                	mov    %eax,%ecx
+801016c1:	c1 f9 03             	sar    $0x3,%ecx
+801016c4:	0f b6 7c 0f 5c       	movzbl 0x5c(%edi,%ecx,1),%edi
+801016c9:	89 fa                	mov    %edi,%edx
+801016cb:	85 df                	test   %ebx,%edi
+801016cd:	74 49                	je     80101718 <balloc+0xb8>
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+801016cf:	83 c0 01             	add    $0x1,%eax
+801016d2:	83 c6 01             	add    $0x1,%esi
+801016d5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+801016da:	74 07                	je     801016e3 <balloc+0x83>
+801016dc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801016df:	39 d6                	cmp    %edx,%esi
+801016e1:	72 cd                	jb     801016b0 <balloc+0x50>
+        brelse(bp);
+        bzero(dev, b + bi);
+        return b + bi;
+      }
+    }
+    brelse(bp);
+801016e3:	8b 7d d8             	mov    -0x28(%ebp),%edi
+801016e6:	83 ec 0c             	sub    $0xc,%esp
+801016e9:	ff 75 e4             	push   -0x1c(%ebp)
+  for(b = 0; b < sb.size; b += BPB){
+801016ec:	81 c7 00 10 00 00    	add    $0x1000,%edi
+    brelse(bp);
+801016f2:	e8 f9 ea ff ff       	call   801001f0 <brelse>
+  for(b = 0; b < sb.size; b += BPB){
+801016f7:	83 c4 10             	add    $0x10,%esp
+801016fa:	3b 3d f4 65 11 80    	cmp    0x801165f4,%edi
+80101700:	0f 82 76 ff ff ff    	jb     8010167c <balloc+0x1c>
+  }
+  panic("balloc: out of blocks");
+80101706:	83 ec 0c             	sub    $0xc,%esp
+80101709:	68 f3 ba 10 80       	push   $0x8010baf3
+8010170e:	e8 6d ec ff ff       	call   80100380 <panic>
+80101713:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101717:	90                   	nop
+        bp->data[bi/8] |= m;  // Mark block in use.
+80101718:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+        log_write(bp);
+8010171b:	83 ec 0c             	sub    $0xc,%esp
+        bp->data[bi/8] |= m;  // Mark block in use.
+8010171e:	09 da                	or     %ebx,%edx
+80101720:	88 54 0f 5c          	mov    %dl,0x5c(%edi,%ecx,1)
+        log_write(bp);
+80101724:	57                   	push   %edi
+80101725:	e8 36 1d 00 00       	call   80103460 <log_write>
+        brelse(bp);
+8010172a:	89 3c 24             	mov    %edi,(%esp)
+8010172d:	e8 be ea ff ff       	call   801001f0 <brelse>
+  bp = bread(dev, bno);
+80101732:	58                   	pop    %eax
+80101733:	5a                   	pop    %edx
+80101734:	56                   	push   %esi
+80101735:	ff 75 dc             	push   -0x24(%ebp)
+80101738:	e8 93 e9 ff ff       	call   801000d0 <bread>
+  memset(bp->data, 0, BSIZE);
+8010173d:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, bno);
+80101740:	89 c3                	mov    %eax,%ebx
+  memset(bp->data, 0, BSIZE);
+80101742:	8d 40 5c             	lea    0x5c(%eax),%eax
+80101745:	68 00 02 00 00       	push   $0x200
+8010174a:	6a 00                	push   $0x0
+8010174c:	50                   	push   %eax
+8010174d:	e8 5e 68 00 00       	call   80107fb0 <memset>
+  log_write(bp);
+80101752:	89 1c 24             	mov    %ebx,(%esp)
+80101755:	e8 06 1d 00 00       	call   80103460 <log_write>
+  brelse(bp);
+8010175a:	89 1c 24             	mov    %ebx,(%esp)
+8010175d:	e8 8e ea ff ff       	call   801001f0 <brelse>
+}
+80101762:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101765:	89 f0                	mov    %esi,%eax
+80101767:	5b                   	pop    %ebx
+80101768:	5e                   	pop    %esi
+80101769:	5f                   	pop    %edi
+8010176a:	5d                   	pop    %ebp
+8010176b:	c3                   	ret
+8010176c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101770 <iget>:
+// Find the inode with number inum on device dev
+// and return the in-memory copy. Does not lock
+// the inode and does not read it from disk.
+static struct inode*
+iget(uint dev, uint inum)
+{
+80101770:	55                   	push   %ebp
+80101771:	89 e5                	mov    %esp,%ebp
+80101773:	57                   	push   %edi
+  struct inode *ip, *empty;
+
+  acquire(&icache.lock);
+
+  // Is the inode already cached?
+  empty = 0;
+80101774:	31 ff                	xor    %edi,%edi
+{
+80101776:	56                   	push   %esi
+80101777:	89 c6                	mov    %eax,%esi
+80101779:	53                   	push   %ebx
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+8010177a:	bb d4 49 11 80       	mov    $0x801149d4,%ebx
+{
+8010177f:	83 ec 28             	sub    $0x28,%esp
+80101782:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  acquire(&icache.lock);
+80101785:	68 a0 49 11 80       	push   $0x801149a0
+8010178a:	e8 41 67 00 00       	call   80107ed0 <acquire>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+8010178f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  acquire(&icache.lock);
+80101792:	83 c4 10             	add    $0x10,%esp
+80101795:	eb 1b                	jmp    801017b2 <iget+0x42>
+80101797:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010179e:	66 90                	xchg   %ax,%ax
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+801017a0:	39 33                	cmp    %esi,(%ebx)
+801017a2:	74 6c                	je     80101810 <iget+0xa0>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+801017a4:	81 c3 90 00 00 00    	add    $0x90,%ebx
+801017aa:	81 fb f4 65 11 80    	cmp    $0x801165f4,%ebx
+801017b0:	74 26                	je     801017d8 <iget+0x68>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+801017b2:	8b 43 08             	mov    0x8(%ebx),%eax
+801017b5:	85 c0                	test   %eax,%eax
+801017b7:	7f e7                	jg     801017a0 <iget+0x30>
+      ip->ref++;
+      release(&icache.lock);
+      return ip;
+    }
+    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
+801017b9:	85 ff                	test   %edi,%edi
+801017bb:	75 e7                	jne    801017a4 <iget+0x34>
+801017bd:	85 c0                	test   %eax,%eax
+801017bf:	75 76                	jne    80101837 <iget+0xc7>
+801017c1:	89 df                	mov    %ebx,%edi
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+801017c3:	81 c3 90 00 00 00    	add    $0x90,%ebx
+801017c9:	81 fb f4 65 11 80    	cmp    $0x801165f4,%ebx
+801017cf:	75 e1                	jne    801017b2 <iget+0x42>
+801017d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      empty = ip;
+  }
+
+  // Recycle an inode cache entry.
+  if(empty == 0)
+801017d8:	85 ff                	test   %edi,%edi
+801017da:	74 79                	je     80101855 <iget+0xe5>
+  ip = empty;
+  ip->dev = dev;
+  ip->inum = inum;
+  ip->ref = 1;
+  ip->valid = 0;
+  release(&icache.lock);
+801017dc:	83 ec 0c             	sub    $0xc,%esp
+  ip->dev = dev;
+801017df:	89 37                	mov    %esi,(%edi)
+  ip->inum = inum;
+801017e1:	89 57 04             	mov    %edx,0x4(%edi)
+  ip->ref = 1;
+801017e4:	c7 47 08 01 00 00 00 	movl   $0x1,0x8(%edi)
+  ip->valid = 0;
+801017eb:	c7 47 4c 00 00 00 00 	movl   $0x0,0x4c(%edi)
+  release(&icache.lock);
+801017f2:	68 a0 49 11 80       	push   $0x801149a0
+801017f7:	e8 74 66 00 00       	call   80107e70 <release>
+
+  return ip;
+801017fc:	83 c4 10             	add    $0x10,%esp
+}
+801017ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101802:	89 f8                	mov    %edi,%eax
+80101804:	5b                   	pop    %ebx
+80101805:	5e                   	pop    %esi
+80101806:	5f                   	pop    %edi
+80101807:	5d                   	pop    %ebp
+80101808:	c3                   	ret
+80101809:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101810:	39 53 04             	cmp    %edx,0x4(%ebx)
+80101813:	75 8f                	jne    801017a4 <iget+0x34>
+      ip->ref++;
+80101815:	83 c0 01             	add    $0x1,%eax
+      release(&icache.lock);
+80101818:	83 ec 0c             	sub    $0xc,%esp
+      return ip;
+8010181b:	89 df                	mov    %ebx,%edi
+      ip->ref++;
+8010181d:	89 43 08             	mov    %eax,0x8(%ebx)
+      release(&icache.lock);
+80101820:	68 a0 49 11 80       	push   $0x801149a0
+80101825:	e8 46 66 00 00       	call   80107e70 <release>
+      return ip;
+8010182a:	83 c4 10             	add    $0x10,%esp
+}
+8010182d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101830:	89 f8                	mov    %edi,%eax
+80101832:	5b                   	pop    %ebx
+80101833:	5e                   	pop    %esi
+80101834:	5f                   	pop    %edi
+80101835:	5d                   	pop    %ebp
+80101836:	c3                   	ret
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101837:	81 c3 90 00 00 00    	add    $0x90,%ebx
+8010183d:	81 fb f4 65 11 80    	cmp    $0x801165f4,%ebx
+80101843:	74 10                	je     80101855 <iget+0xe5>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101845:	8b 43 08             	mov    0x8(%ebx),%eax
+80101848:	85 c0                	test   %eax,%eax
+8010184a:	0f 8f 50 ff ff ff    	jg     801017a0 <iget+0x30>
+80101850:	e9 68 ff ff ff       	jmp    801017bd <iget+0x4d>
+    panic("iget: no inodes");
+80101855:	83 ec 0c             	sub    $0xc,%esp
+80101858:	68 09 bb 10 80       	push   $0x8010bb09
+8010185d:	e8 1e eb ff ff       	call   80100380 <panic>
+80101862:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101870 <bfree>:
+{
+80101870:	55                   	push   %ebp
+80101871:	89 c1                	mov    %eax,%ecx
+  bp = bread(dev, BBLOCK(b, sb));
+80101873:	89 d0                	mov    %edx,%eax
+80101875:	c1 e8 0c             	shr    $0xc,%eax
+{
+80101878:	89 e5                	mov    %esp,%ebp
+8010187a:	56                   	push   %esi
+8010187b:	53                   	push   %ebx
+  bp = bread(dev, BBLOCK(b, sb));
+8010187c:	03 05 0c 66 11 80    	add    0x8011660c,%eax
+{
+80101882:	89 d3                	mov    %edx,%ebx
+  bp = bread(dev, BBLOCK(b, sb));
+80101884:	83 ec 08             	sub    $0x8,%esp
+80101887:	50                   	push   %eax
+80101888:	51                   	push   %ecx
+80101889:	e8 42 e8 ff ff       	call   801000d0 <bread>
+  m = 1 << (bi % 8);
+8010188e:	89 d9                	mov    %ebx,%ecx
+  if((bp->data[bi/8] & m) == 0)
+80101890:	c1 fb 03             	sar    $0x3,%ebx
+80101893:	83 c4 10             	add    $0x10,%esp
+  bp = bread(dev, BBLOCK(b, sb));
+80101896:	89 c6                	mov    %eax,%esi
+  m = 1 << (bi % 8);
+80101898:	83 e1 07             	and    $0x7,%ecx
+8010189b:	b8 01 00 00 00       	mov    $0x1,%eax
+  if((bp->data[bi/8] & m) == 0)
+801018a0:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  m = 1 << (bi % 8);
+801018a6:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+801018a8:	0f b6 4c 1e 5c       	movzbl 0x5c(%esi,%ebx,1),%ecx
+801018ad:	85 c1                	test   %eax,%ecx
+801018af:	74 23                	je     801018d4 <bfree+0x64>
+  bp->data[bi/8] &= ~m;
+801018b1:	f7 d0                	not    %eax
+  log_write(bp);
+801018b3:	83 ec 0c             	sub    $0xc,%esp
+  bp->data[bi/8] &= ~m;
+801018b6:	21 c8                	and    %ecx,%eax
+801018b8:	88 44 1e 5c          	mov    %al,0x5c(%esi,%ebx,1)
+  log_write(bp);
+801018bc:	56                   	push   %esi
+801018bd:	e8 9e 1b 00 00       	call   80103460 <log_write>
+  brelse(bp);
+801018c2:	89 34 24             	mov    %esi,(%esp)
+801018c5:	e8 26 e9 ff ff       	call   801001f0 <brelse>
+}
+801018ca:	83 c4 10             	add    $0x10,%esp
+801018cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801018d0:	5b                   	pop    %ebx
+801018d1:	5e                   	pop    %esi
+801018d2:	5d                   	pop    %ebp
+801018d3:	c3                   	ret
+    panic("freeing free block");
+801018d4:	83 ec 0c             	sub    $0xc,%esp
+801018d7:	68 19 bb 10 80       	push   $0x8010bb19
+801018dc:	e8 9f ea ff ff       	call   80100380 <panic>
+801018e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801018e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801018ef:	90                   	nop
+
+801018f0 <bmap>:
+
+// Return the disk block address of the nth block in inode ip.
+// If there is no such block, bmap allocates one.
+static uint
+bmap(struct inode *ip, uint bn)
+{
+801018f0:	55                   	push   %ebp
+801018f1:	89 e5                	mov    %esp,%ebp
+801018f3:	57                   	push   %edi
+801018f4:	56                   	push   %esi
+801018f5:	89 c6                	mov    %eax,%esi
+801018f7:	53                   	push   %ebx
+801018f8:	83 ec 1c             	sub    $0x1c,%esp
+  uint addr, *a;
+  struct buf *bp;
+
+  if(bn < NDIRECT){
+801018fb:	83 fa 0b             	cmp    $0xb,%edx
+801018fe:	0f 86 8c 00 00 00    	jbe    80101990 <bmap+0xa0>
+    if((addr = ip->addrs[bn]) == 0)
+      ip->addrs[bn] = addr = balloc(ip->dev);
+    return addr;
+  }
+  bn -= NDIRECT;
+80101904:	8d 5a f4             	lea    -0xc(%edx),%ebx
+
+  if(bn < NINDIRECT){
+80101907:	83 fb 7f             	cmp    $0x7f,%ebx
+8010190a:	0f 87 a2 00 00 00    	ja     801019b2 <bmap+0xc2>
+    // Load indirect block, allocating if necessary.
+    if((addr = ip->addrs[NDIRECT]) == 0)
+80101910:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+80101916:	85 c0                	test   %eax,%eax
+80101918:	74 5e                	je     80101978 <bmap+0x88>
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+    bp = bread(ip->dev, addr);
+8010191a:	83 ec 08             	sub    $0x8,%esp
+8010191d:	50                   	push   %eax
+8010191e:	ff 36                	push   (%esi)
+80101920:	e8 ab e7 ff ff       	call   801000d0 <bread>
+    a = (uint*)bp->data;
+    if((addr = a[bn]) == 0){
+80101925:	83 c4 10             	add    $0x10,%esp
+80101928:	8d 5c 98 5c          	lea    0x5c(%eax,%ebx,4),%ebx
+    bp = bread(ip->dev, addr);
+8010192c:	89 c2                	mov    %eax,%edx
+    if((addr = a[bn]) == 0){
+8010192e:	8b 3b                	mov    (%ebx),%edi
+80101930:	85 ff                	test   %edi,%edi
+80101932:	74 1c                	je     80101950 <bmap+0x60>
+      a[bn] = addr = balloc(ip->dev);
+      log_write(bp);
+    }
+    brelse(bp);
+80101934:	83 ec 0c             	sub    $0xc,%esp
+80101937:	52                   	push   %edx
+80101938:	e8 b3 e8 ff ff       	call   801001f0 <brelse>
+8010193d:	83 c4 10             	add    $0x10,%esp
+    return addr;
+  }
+
+  panic("bmap: out of range");
+}
+80101940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101943:	89 f8                	mov    %edi,%eax
+80101945:	5b                   	pop    %ebx
+80101946:	5e                   	pop    %esi
+80101947:	5f                   	pop    %edi
+80101948:	5d                   	pop    %ebp
+80101949:	c3                   	ret
+8010194a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101950:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      a[bn] = addr = balloc(ip->dev);
+80101953:	8b 06                	mov    (%esi),%eax
+80101955:	e8 06 fd ff ff       	call   80101660 <balloc>
+      log_write(bp);
+8010195a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010195d:	83 ec 0c             	sub    $0xc,%esp
+      a[bn] = addr = balloc(ip->dev);
+80101960:	89 03                	mov    %eax,(%ebx)
+80101962:	89 c7                	mov    %eax,%edi
+      log_write(bp);
+80101964:	52                   	push   %edx
+80101965:	e8 f6 1a 00 00       	call   80103460 <log_write>
+8010196a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010196d:	83 c4 10             	add    $0x10,%esp
+80101970:	eb c2                	jmp    80101934 <bmap+0x44>
+80101972:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+80101978:	8b 06                	mov    (%esi),%eax
+8010197a:	e8 e1 fc ff ff       	call   80101660 <balloc>
+8010197f:	89 86 8c 00 00 00    	mov    %eax,0x8c(%esi)
+80101985:	eb 93                	jmp    8010191a <bmap+0x2a>
+80101987:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010198e:	66 90                	xchg   %ax,%ax
+    if((addr = ip->addrs[bn]) == 0)
+80101990:	8d 5a 14             	lea    0x14(%edx),%ebx
+80101993:	8b 7c 98 0c          	mov    0xc(%eax,%ebx,4),%edi
+80101997:	85 ff                	test   %edi,%edi
+80101999:	75 a5                	jne    80101940 <bmap+0x50>
+      ip->addrs[bn] = addr = balloc(ip->dev);
+8010199b:	8b 00                	mov    (%eax),%eax
+8010199d:	e8 be fc ff ff       	call   80101660 <balloc>
+801019a2:	89 44 9e 0c          	mov    %eax,0xc(%esi,%ebx,4)
+801019a6:	89 c7                	mov    %eax,%edi
+}
+801019a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801019ab:	5b                   	pop    %ebx
+801019ac:	89 f8                	mov    %edi,%eax
+801019ae:	5e                   	pop    %esi
+801019af:	5f                   	pop    %edi
+801019b0:	5d                   	pop    %ebp
+801019b1:	c3                   	ret
+  panic("bmap: out of range");
+801019b2:	83 ec 0c             	sub    $0xc,%esp
+801019b5:	68 2c bb 10 80       	push   $0x8010bb2c
+801019ba:	e8 c1 e9 ff ff       	call   80100380 <panic>
+801019bf:	90                   	nop
+
+801019c0 <readsb>:
+{
+801019c0:	55                   	push   %ebp
+801019c1:	89 e5                	mov    %esp,%ebp
+801019c3:	56                   	push   %esi
+801019c4:	53                   	push   %ebx
+801019c5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  bp = bread(dev, 1);
+801019c8:	83 ec 08             	sub    $0x8,%esp
+801019cb:	6a 01                	push   $0x1
+801019cd:	ff 75 08             	push   0x8(%ebp)
+801019d0:	e8 fb e6 ff ff       	call   801000d0 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+801019d5:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, 1);
+801019d8:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+801019da:	8d 40 5c             	lea    0x5c(%eax),%eax
+801019dd:	6a 1c                	push   $0x1c
+801019df:	50                   	push   %eax
+801019e0:	56                   	push   %esi
+801019e1:	e8 5a 66 00 00       	call   80108040 <memmove>
+  brelse(bp);
+801019e6:	89 5d 08             	mov    %ebx,0x8(%ebp)
+801019e9:	83 c4 10             	add    $0x10,%esp
+}
+801019ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801019ef:	5b                   	pop    %ebx
+801019f0:	5e                   	pop    %esi
+801019f1:	5d                   	pop    %ebp
+  brelse(bp);
+801019f2:	e9 f9 e7 ff ff       	jmp    801001f0 <brelse>
+801019f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801019fe:	66 90                	xchg   %ax,%ax
+
+80101a00 <iinit>:
+{
+80101a00:	55                   	push   %ebp
+80101a01:	89 e5                	mov    %esp,%ebp
+80101a03:	53                   	push   %ebx
+80101a04:	bb e0 49 11 80       	mov    $0x801149e0,%ebx
+80101a09:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&icache.lock, "icache");
+80101a0c:	68 3f bb 10 80       	push   $0x8010bb3f
+80101a11:	68 a0 49 11 80       	push   $0x801149a0
+80101a16:	e8 d5 62 00 00       	call   80107cf0 <initlock>
+  for(i = 0; i < NINODE; i++) {
+80101a1b:	83 c4 10             	add    $0x10,%esp
+80101a1e:	66 90                	xchg   %ax,%ax
+    initsleeplock(&icache.inode[i].lock, "inode");
+80101a20:	83 ec 08             	sub    $0x8,%esp
+80101a23:	68 46 bb 10 80       	push   $0x8010bb46
+80101a28:	53                   	push   %ebx
+  for(i = 0; i < NINODE; i++) {
+80101a29:	81 c3 90 00 00 00    	add    $0x90,%ebx
+    initsleeplock(&icache.inode[i].lock, "inode");
+80101a2f:	e8 8c 61 00 00       	call   80107bc0 <initsleeplock>
+  for(i = 0; i < NINODE; i++) {
+80101a34:	83 c4 10             	add    $0x10,%esp
+80101a37:	81 fb 00 66 11 80    	cmp    $0x80116600,%ebx
+80101a3d:	75 e1                	jne    80101a20 <iinit+0x20>
+  bp = bread(dev, 1);
+80101a3f:	83 ec 08             	sub    $0x8,%esp
+80101a42:	6a 01                	push   $0x1
+80101a44:	ff 75 08             	push   0x8(%ebp)
+80101a47:	e8 84 e6 ff ff       	call   801000d0 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80101a4c:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, 1);
+80101a4f:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80101a51:	8d 40 5c             	lea    0x5c(%eax),%eax
+80101a54:	6a 1c                	push   $0x1c
+80101a56:	50                   	push   %eax
+80101a57:	68 f4 65 11 80       	push   $0x801165f4
+80101a5c:	e8 df 65 00 00       	call   80108040 <memmove>
+  brelse(bp);
+80101a61:	89 1c 24             	mov    %ebx,(%esp)
+80101a64:	e8 87 e7 ff ff       	call   801001f0 <brelse>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+80101a69:	ff 35 0c 66 11 80    	push   0x8011660c
+80101a6f:	ff 35 08 66 11 80    	push   0x80116608
+80101a75:	ff 35 04 66 11 80    	push   0x80116604
+80101a7b:	ff 35 00 66 11 80    	push   0x80116600
+80101a81:	ff 35 fc 65 11 80    	push   0x801165fc
+80101a87:	ff 35 f8 65 11 80    	push   0x801165f8
+80101a8d:	ff 35 f4 65 11 80    	push   0x801165f4
+80101a93:	68 ac bb 10 80       	push   $0x8010bbac
+80101a98:	e8 13 ec ff ff       	call   801006b0 <cprintf>
+}
+80101a9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101aa0:	83 c4 30             	add    $0x30,%esp
+80101aa3:	c9                   	leave
+80101aa4:	c3                   	ret
+80101aa5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101aac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101ab0 <ialloc>:
+{
+80101ab0:	55                   	push   %ebp
+80101ab1:	89 e5                	mov    %esp,%ebp
+80101ab3:	57                   	push   %edi
+80101ab4:	56                   	push   %esi
+80101ab5:	53                   	push   %ebx
+80101ab6:	83 ec 1c             	sub    $0x1c,%esp
+80101ab9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101abc:	83 3d fc 65 11 80 01 	cmpl   $0x1,0x801165fc
+{
+80101ac3:	8b 75 08             	mov    0x8(%ebp),%esi
+80101ac6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101ac9:	0f 86 91 00 00 00    	jbe    80101b60 <ialloc+0xb0>
+80101acf:	bf 01 00 00 00       	mov    $0x1,%edi
+80101ad4:	eb 21                	jmp    80101af7 <ialloc+0x47>
+80101ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101add:	8d 76 00             	lea    0x0(%esi),%esi
+    brelse(bp);
+80101ae0:	83 ec 0c             	sub    $0xc,%esp
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101ae3:	83 c7 01             	add    $0x1,%edi
+    brelse(bp);
+80101ae6:	53                   	push   %ebx
+80101ae7:	e8 04 e7 ff ff       	call   801001f0 <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101aec:	83 c4 10             	add    $0x10,%esp
+80101aef:	3b 3d fc 65 11 80    	cmp    0x801165fc,%edi
+80101af5:	73 69                	jae    80101b60 <ialloc+0xb0>
+    bp = bread(dev, IBLOCK(inum, sb));
+80101af7:	89 f8                	mov    %edi,%eax
+80101af9:	83 ec 08             	sub    $0x8,%esp
+80101afc:	c1 e8 03             	shr    $0x3,%eax
+80101aff:	03 05 08 66 11 80    	add    0x80116608,%eax
+80101b05:	50                   	push   %eax
+80101b06:	56                   	push   %esi
+80101b07:	e8 c4 e5 ff ff       	call   801000d0 <bread>
+    if(dip->type == 0){  // a free inode
+80101b0c:	83 c4 10             	add    $0x10,%esp
+    bp = bread(dev, IBLOCK(inum, sb));
+80101b0f:	89 c3                	mov    %eax,%ebx
+    dip = (struct dinode*)bp->data + inum%IPB;
+80101b11:	89 f8                	mov    %edi,%eax
+80101b13:	83 e0 07             	and    $0x7,%eax
+80101b16:	c1 e0 06             	shl    $0x6,%eax
+80101b19:	8d 4c 03 5c          	lea    0x5c(%ebx,%eax,1),%ecx
+    if(dip->type == 0){  // a free inode
+80101b1d:	66 83 39 00          	cmpw   $0x0,(%ecx)
+80101b21:	75 bd                	jne    80101ae0 <ialloc+0x30>
+      memset(dip, 0, sizeof(*dip));
+80101b23:	83 ec 04             	sub    $0x4,%esp
+80101b26:	6a 40                	push   $0x40
+80101b28:	6a 00                	push   $0x0
+80101b2a:	51                   	push   %ecx
+80101b2b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80101b2e:	e8 7d 64 00 00       	call   80107fb0 <memset>
+      dip->type = type;
+80101b33:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+80101b37:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80101b3a:	66 89 01             	mov    %ax,(%ecx)
+      log_write(bp);   // mark it allocated on the disk
+80101b3d:	89 1c 24             	mov    %ebx,(%esp)
+80101b40:	e8 1b 19 00 00       	call   80103460 <log_write>
+      brelse(bp);
+80101b45:	89 1c 24             	mov    %ebx,(%esp)
+80101b48:	e8 a3 e6 ff ff       	call   801001f0 <brelse>
+      return iget(dev, inum);
+80101b4d:	83 c4 10             	add    $0x10,%esp
+}
+80101b50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return iget(dev, inum);
+80101b53:	89 fa                	mov    %edi,%edx
+}
+80101b55:	5b                   	pop    %ebx
+      return iget(dev, inum);
+80101b56:	89 f0                	mov    %esi,%eax
+}
+80101b58:	5e                   	pop    %esi
+80101b59:	5f                   	pop    %edi
+80101b5a:	5d                   	pop    %ebp
+      return iget(dev, inum);
+80101b5b:	e9 10 fc ff ff       	jmp    80101770 <iget>
+  panic("ialloc: no inodes");
+80101b60:	83 ec 0c             	sub    $0xc,%esp
+80101b63:	68 4c bb 10 80       	push   $0x8010bb4c
+80101b68:	e8 13 e8 ff ff       	call   80100380 <panic>
+80101b6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101b70 <iupdate>:
+{
+80101b70:	55                   	push   %ebp
+80101b71:	89 e5                	mov    %esp,%ebp
+80101b73:	56                   	push   %esi
+80101b74:	53                   	push   %ebx
+80101b75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80101b78:	8b 43 04             	mov    0x4(%ebx),%eax
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80101b7b:	83 c3 5c             	add    $0x5c,%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80101b7e:	83 ec 08             	sub    $0x8,%esp
+80101b81:	c1 e8 03             	shr    $0x3,%eax
+80101b84:	03 05 08 66 11 80    	add    0x80116608,%eax
+80101b8a:	50                   	push   %eax
+80101b8b:	ff 73 a4             	push   -0x5c(%ebx)
+80101b8e:	e8 3d e5 ff ff       	call   801000d0 <bread>
+  dip->type = ip->type;
+80101b93:	0f b7 53 f4          	movzwl -0xc(%ebx),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80101b97:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80101b9a:	89 c6                	mov    %eax,%esi
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+80101b9c:	8b 43 a8             	mov    -0x58(%ebx),%eax
+80101b9f:	83 e0 07             	and    $0x7,%eax
+80101ba2:	c1 e0 06             	shl    $0x6,%eax
+80101ba5:	8d 44 06 5c          	lea    0x5c(%esi,%eax,1),%eax
+  dip->type = ip->type;
+80101ba9:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+80101bac:	0f b7 53 f6          	movzwl -0xa(%ebx),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80101bb0:	83 c0 0c             	add    $0xc,%eax
+  dip->major = ip->major;
+80101bb3:	66 89 50 f6          	mov    %dx,-0xa(%eax)
+  dip->minor = ip->minor;
+80101bb7:	0f b7 53 f8          	movzwl -0x8(%ebx),%edx
+80101bbb:	66 89 50 f8          	mov    %dx,-0x8(%eax)
+  dip->nlink = ip->nlink;
+80101bbf:	0f b7 53 fa          	movzwl -0x6(%ebx),%edx
+80101bc3:	66 89 50 fa          	mov    %dx,-0x6(%eax)
+  dip->size = ip->size;
+80101bc7:	8b 53 fc             	mov    -0x4(%ebx),%edx
+80101bca:	89 50 fc             	mov    %edx,-0x4(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80101bcd:	6a 34                	push   $0x34
+80101bcf:	53                   	push   %ebx
+80101bd0:	50                   	push   %eax
+80101bd1:	e8 6a 64 00 00       	call   80108040 <memmove>
+  log_write(bp);
+80101bd6:	89 34 24             	mov    %esi,(%esp)
+80101bd9:	e8 82 18 00 00       	call   80103460 <log_write>
+  brelse(bp);
+80101bde:	89 75 08             	mov    %esi,0x8(%ebp)
+80101be1:	83 c4 10             	add    $0x10,%esp
+}
+80101be4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101be7:	5b                   	pop    %ebx
+80101be8:	5e                   	pop    %esi
+80101be9:	5d                   	pop    %ebp
+  brelse(bp);
+80101bea:	e9 01 e6 ff ff       	jmp    801001f0 <brelse>
+80101bef:	90                   	nop
+
+80101bf0 <idup>:
+{
+80101bf0:	55                   	push   %ebp
+80101bf1:	89 e5                	mov    %esp,%ebp
+80101bf3:	53                   	push   %ebx
+80101bf4:	83 ec 10             	sub    $0x10,%esp
+80101bf7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+80101bfa:	68 a0 49 11 80       	push   $0x801149a0
+80101bff:	e8 cc 62 00 00       	call   80107ed0 <acquire>
+  ip->ref++;
+80101c04:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+  release(&icache.lock);
+80101c08:	c7 04 24 a0 49 11 80 	movl   $0x801149a0,(%esp)
+80101c0f:	e8 5c 62 00 00       	call   80107e70 <release>
+}
+80101c14:	89 d8                	mov    %ebx,%eax
+80101c16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101c19:	c9                   	leave
+80101c1a:	c3                   	ret
+80101c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101c1f:	90                   	nop
+
+80101c20 <ilock>:
+{
+80101c20:	55                   	push   %ebp
+80101c21:	89 e5                	mov    %esp,%ebp
+80101c23:	56                   	push   %esi
+80101c24:	53                   	push   %ebx
+80101c25:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80101c28:	85 db                	test   %ebx,%ebx
+80101c2a:	0f 84 b7 00 00 00    	je     80101ce7 <ilock+0xc7>
+80101c30:	8b 53 08             	mov    0x8(%ebx),%edx
+80101c33:	85 d2                	test   %edx,%edx
+80101c35:	0f 8e ac 00 00 00    	jle    80101ce7 <ilock+0xc7>
+  acquiresleep(&ip->lock);
+80101c3b:	83 ec 0c             	sub    $0xc,%esp
+80101c3e:	8d 43 0c             	lea    0xc(%ebx),%eax
+80101c41:	50                   	push   %eax
+80101c42:	e8 b9 5f 00 00       	call   80107c00 <acquiresleep>
+  if(ip->valid == 0){
+80101c47:	8b 43 4c             	mov    0x4c(%ebx),%eax
+80101c4a:	83 c4 10             	add    $0x10,%esp
+80101c4d:	85 c0                	test   %eax,%eax
+80101c4f:	74 0f                	je     80101c60 <ilock+0x40>
+}
+80101c51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101c54:	5b                   	pop    %ebx
+80101c55:	5e                   	pop    %esi
+80101c56:	5d                   	pop    %ebp
+80101c57:	c3                   	ret
+80101c58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101c5f:	90                   	nop
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80101c60:	8b 43 04             	mov    0x4(%ebx),%eax
+80101c63:	83 ec 08             	sub    $0x8,%esp
+80101c66:	c1 e8 03             	shr    $0x3,%eax
+80101c69:	03 05 08 66 11 80    	add    0x80116608,%eax
+80101c6f:	50                   	push   %eax
+80101c70:	ff 33                	push   (%ebx)
+80101c72:	e8 59 e4 ff ff       	call   801000d0 <bread>
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80101c77:	83 c4 0c             	add    $0xc,%esp
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80101c7a:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+80101c7c:	8b 43 04             	mov    0x4(%ebx),%eax
+80101c7f:	83 e0 07             	and    $0x7,%eax
+80101c82:	c1 e0 06             	shl    $0x6,%eax
+80101c85:	8d 44 06 5c          	lea    0x5c(%esi,%eax,1),%eax
+    ip->type = dip->type;
+80101c89:	0f b7 10             	movzwl (%eax),%edx
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80101c8c:	83 c0 0c             	add    $0xc,%eax
+    ip->type = dip->type;
+80101c8f:	66 89 53 50          	mov    %dx,0x50(%ebx)
+    ip->major = dip->major;
+80101c93:	0f b7 50 f6          	movzwl -0xa(%eax),%edx
+80101c97:	66 89 53 52          	mov    %dx,0x52(%ebx)
+    ip->minor = dip->minor;
+80101c9b:	0f b7 50 f8          	movzwl -0x8(%eax),%edx
+80101c9f:	66 89 53 54          	mov    %dx,0x54(%ebx)
+    ip->nlink = dip->nlink;
+80101ca3:	0f b7 50 fa          	movzwl -0x6(%eax),%edx
+80101ca7:	66 89 53 56          	mov    %dx,0x56(%ebx)
+    ip->size = dip->size;
+80101cab:	8b 50 fc             	mov    -0x4(%eax),%edx
+80101cae:	89 53 58             	mov    %edx,0x58(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80101cb1:	6a 34                	push   $0x34
+80101cb3:	50                   	push   %eax
+80101cb4:	8d 43 5c             	lea    0x5c(%ebx),%eax
+80101cb7:	50                   	push   %eax
+80101cb8:	e8 83 63 00 00       	call   80108040 <memmove>
+    brelse(bp);
+80101cbd:	89 34 24             	mov    %esi,(%esp)
+80101cc0:	e8 2b e5 ff ff       	call   801001f0 <brelse>
+    if(ip->type == 0)
+80101cc5:	83 c4 10             	add    $0x10,%esp
+80101cc8:	66 83 7b 50 00       	cmpw   $0x0,0x50(%ebx)
+    ip->valid = 1;
+80101ccd:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+    if(ip->type == 0)
+80101cd4:	0f 85 77 ff ff ff    	jne    80101c51 <ilock+0x31>
+      panic("ilock: no type");
+80101cda:	83 ec 0c             	sub    $0xc,%esp
+80101cdd:	68 64 bb 10 80       	push   $0x8010bb64
+80101ce2:	e8 99 e6 ff ff       	call   80100380 <panic>
+    panic("ilock");
+80101ce7:	83 ec 0c             	sub    $0xc,%esp
+80101cea:	68 5e bb 10 80       	push   $0x8010bb5e
+80101cef:	e8 8c e6 ff ff       	call   80100380 <panic>
+80101cf4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101cfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101cff:	90                   	nop
+
+80101d00 <iunlock>:
+{
+80101d00:	55                   	push   %ebp
+80101d01:	89 e5                	mov    %esp,%ebp
+80101d03:	56                   	push   %esi
+80101d04:	53                   	push   %ebx
+80101d05:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80101d08:	85 db                	test   %ebx,%ebx
+80101d0a:	74 28                	je     80101d34 <iunlock+0x34>
+80101d0c:	83 ec 0c             	sub    $0xc,%esp
+80101d0f:	8d 73 0c             	lea    0xc(%ebx),%esi
+80101d12:	56                   	push   %esi
+80101d13:	e8 88 5f 00 00       	call   80107ca0 <holdingsleep>
+80101d18:	83 c4 10             	add    $0x10,%esp
+80101d1b:	85 c0                	test   %eax,%eax
+80101d1d:	74 15                	je     80101d34 <iunlock+0x34>
+80101d1f:	8b 43 08             	mov    0x8(%ebx),%eax
+80101d22:	85 c0                	test   %eax,%eax
+80101d24:	7e 0e                	jle    80101d34 <iunlock+0x34>
+  releasesleep(&ip->lock);
+80101d26:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80101d29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101d2c:	5b                   	pop    %ebx
+80101d2d:	5e                   	pop    %esi
+80101d2e:	5d                   	pop    %ebp
+  releasesleep(&ip->lock);
+80101d2f:	e9 2c 5f 00 00       	jmp    80107c60 <releasesleep>
+    panic("iunlock");
+80101d34:	83 ec 0c             	sub    $0xc,%esp
+80101d37:	68 73 bb 10 80       	push   $0x8010bb73
+80101d3c:	e8 3f e6 ff ff       	call   80100380 <panic>
+80101d41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101d4f:	90                   	nop
+
+80101d50 <iput>:
+{
+80101d50:	55                   	push   %ebp
+80101d51:	89 e5                	mov    %esp,%ebp
+80101d53:	57                   	push   %edi
+80101d54:	56                   	push   %esi
+80101d55:	53                   	push   %ebx
+80101d56:	83 ec 28             	sub    $0x28,%esp
+80101d59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquiresleep(&ip->lock);
+80101d5c:	8d 7b 0c             	lea    0xc(%ebx),%edi
+80101d5f:	57                   	push   %edi
+80101d60:	e8 9b 5e 00 00       	call   80107c00 <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+80101d65:	8b 53 4c             	mov    0x4c(%ebx),%edx
+80101d68:	83 c4 10             	add    $0x10,%esp
+80101d6b:	85 d2                	test   %edx,%edx
+80101d6d:	74 07                	je     80101d76 <iput+0x26>
+80101d6f:	66 83 7b 56 00       	cmpw   $0x0,0x56(%ebx)
+80101d74:	74 32                	je     80101da8 <iput+0x58>
+  releasesleep(&ip->lock);
+80101d76:	83 ec 0c             	sub    $0xc,%esp
+80101d79:	57                   	push   %edi
+80101d7a:	e8 e1 5e 00 00       	call   80107c60 <releasesleep>
+  acquire(&icache.lock);
+80101d7f:	c7 04 24 a0 49 11 80 	movl   $0x801149a0,(%esp)
+80101d86:	e8 45 61 00 00       	call   80107ed0 <acquire>
+  ip->ref--;
+80101d8b:	83 6b 08 01          	subl   $0x1,0x8(%ebx)
+  release(&icache.lock);
+80101d8f:	83 c4 10             	add    $0x10,%esp
+80101d92:	c7 45 08 a0 49 11 80 	movl   $0x801149a0,0x8(%ebp)
+}
+80101d99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101d9c:	5b                   	pop    %ebx
+80101d9d:	5e                   	pop    %esi
+80101d9e:	5f                   	pop    %edi
+80101d9f:	5d                   	pop    %ebp
+  release(&icache.lock);
+80101da0:	e9 cb 60 00 00       	jmp    80107e70 <release>
+80101da5:	8d 76 00             	lea    0x0(%esi),%esi
+    acquire(&icache.lock);
+80101da8:	83 ec 0c             	sub    $0xc,%esp
+80101dab:	68 a0 49 11 80       	push   $0x801149a0
+80101db0:	e8 1b 61 00 00       	call   80107ed0 <acquire>
+    int r = ip->ref;
+80101db5:	8b 73 08             	mov    0x8(%ebx),%esi
+    release(&icache.lock);
+80101db8:	c7 04 24 a0 49 11 80 	movl   $0x801149a0,(%esp)
+80101dbf:	e8 ac 60 00 00       	call   80107e70 <release>
+    if(r == 1){
+80101dc4:	83 c4 10             	add    $0x10,%esp
+80101dc7:	83 fe 01             	cmp    $0x1,%esi
+80101dca:	75 aa                	jne    80101d76 <iput+0x26>
+80101dcc:	8d 8b 8c 00 00 00    	lea    0x8c(%ebx),%ecx
+80101dd2:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80101dd5:	8d 73 5c             	lea    0x5c(%ebx),%esi
+80101dd8:	89 df                	mov    %ebx,%edi
+80101dda:	89 cb                	mov    %ecx,%ebx
+80101ddc:	eb 09                	jmp    80101de7 <iput+0x97>
+80101dde:	66 90                	xchg   %ax,%ax
+{
+  int i, j;
+  struct buf *bp;
+  uint *a;
+
+  for(i = 0; i < NDIRECT; i++){
+80101de0:	83 c6 04             	add    $0x4,%esi
+80101de3:	39 de                	cmp    %ebx,%esi
+80101de5:	74 19                	je     80101e00 <iput+0xb0>
+    if(ip->addrs[i]){
+80101de7:	8b 16                	mov    (%esi),%edx
+80101de9:	85 d2                	test   %edx,%edx
+80101deb:	74 f3                	je     80101de0 <iput+0x90>
+      bfree(ip->dev, ip->addrs[i]);
+80101ded:	8b 07                	mov    (%edi),%eax
+80101def:	e8 7c fa ff ff       	call   80101870 <bfree>
+      ip->addrs[i] = 0;
+80101df4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80101dfa:	eb e4                	jmp    80101de0 <iput+0x90>
+80101dfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  if(ip->addrs[NDIRECT]){
+80101e00:	89 fb                	mov    %edi,%ebx
+80101e02:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80101e05:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+80101e0b:	85 c0                	test   %eax,%eax
+80101e0d:	75 2d                	jne    80101e3c <iput+0xec>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+    ip->addrs[NDIRECT] = 0;
+  }
+
+  ip->size = 0;
+  iupdate(ip);
+80101e0f:	83 ec 0c             	sub    $0xc,%esp
+  ip->size = 0;
+80101e12:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  iupdate(ip);
+80101e19:	53                   	push   %ebx
+80101e1a:	e8 51 fd ff ff       	call   80101b70 <iupdate>
+      ip->type = 0;
+80101e1f:	31 c0                	xor    %eax,%eax
+80101e21:	66 89 43 50          	mov    %ax,0x50(%ebx)
+      iupdate(ip);
+80101e25:	89 1c 24             	mov    %ebx,(%esp)
+80101e28:	e8 43 fd ff ff       	call   80101b70 <iupdate>
+      ip->valid = 0;
+80101e2d:	c7 43 4c 00 00 00 00 	movl   $0x0,0x4c(%ebx)
+80101e34:	83 c4 10             	add    $0x10,%esp
+80101e37:	e9 3a ff ff ff       	jmp    80101d76 <iput+0x26>
+    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+80101e3c:	83 ec 08             	sub    $0x8,%esp
+80101e3f:	50                   	push   %eax
+80101e40:	ff 33                	push   (%ebx)
+80101e42:	e8 89 e2 ff ff       	call   801000d0 <bread>
+    for(j = 0; j < NINDIRECT; j++){
+80101e47:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80101e4a:	83 c4 10             	add    $0x10,%esp
+80101e4d:	8d 88 5c 02 00 00    	lea    0x25c(%eax),%ecx
+80101e53:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101e56:	8d 70 5c             	lea    0x5c(%eax),%esi
+80101e59:	89 cf                	mov    %ecx,%edi
+80101e5b:	eb 0a                	jmp    80101e67 <iput+0x117>
+80101e5d:	8d 76 00             	lea    0x0(%esi),%esi
+80101e60:	83 c6 04             	add    $0x4,%esi
+80101e63:	39 fe                	cmp    %edi,%esi
+80101e65:	74 0f                	je     80101e76 <iput+0x126>
+      if(a[j])
+80101e67:	8b 16                	mov    (%esi),%edx
+80101e69:	85 d2                	test   %edx,%edx
+80101e6b:	74 f3                	je     80101e60 <iput+0x110>
+        bfree(ip->dev, a[j]);
+80101e6d:	8b 03                	mov    (%ebx),%eax
+80101e6f:	e8 fc f9 ff ff       	call   80101870 <bfree>
+80101e74:	eb ea                	jmp    80101e60 <iput+0x110>
+    brelse(bp);
+80101e76:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101e79:	83 ec 0c             	sub    $0xc,%esp
+80101e7c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80101e7f:	50                   	push   %eax
+80101e80:	e8 6b e3 ff ff       	call   801001f0 <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+80101e85:	8b 93 8c 00 00 00    	mov    0x8c(%ebx),%edx
+80101e8b:	8b 03                	mov    (%ebx),%eax
+80101e8d:	e8 de f9 ff ff       	call   80101870 <bfree>
+    ip->addrs[NDIRECT] = 0;
+80101e92:	83 c4 10             	add    $0x10,%esp
+80101e95:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+80101e9c:	00 00 00 
+80101e9f:	e9 6b ff ff ff       	jmp    80101e0f <iput+0xbf>
+80101ea4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101eab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101eaf:	90                   	nop
+
+80101eb0 <iunlockput>:
+{
+80101eb0:	55                   	push   %ebp
+80101eb1:	89 e5                	mov    %esp,%ebp
+80101eb3:	56                   	push   %esi
+80101eb4:	53                   	push   %ebx
+80101eb5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80101eb8:	85 db                	test   %ebx,%ebx
+80101eba:	74 34                	je     80101ef0 <iunlockput+0x40>
+80101ebc:	83 ec 0c             	sub    $0xc,%esp
+80101ebf:	8d 73 0c             	lea    0xc(%ebx),%esi
+80101ec2:	56                   	push   %esi
+80101ec3:	e8 d8 5d 00 00       	call   80107ca0 <holdingsleep>
+80101ec8:	83 c4 10             	add    $0x10,%esp
+80101ecb:	85 c0                	test   %eax,%eax
+80101ecd:	74 21                	je     80101ef0 <iunlockput+0x40>
+80101ecf:	8b 43 08             	mov    0x8(%ebx),%eax
+80101ed2:	85 c0                	test   %eax,%eax
+80101ed4:	7e 1a                	jle    80101ef0 <iunlockput+0x40>
+  releasesleep(&ip->lock);
+80101ed6:	83 ec 0c             	sub    $0xc,%esp
+80101ed9:	56                   	push   %esi
+80101eda:	e8 81 5d 00 00       	call   80107c60 <releasesleep>
+  iput(ip);
+80101edf:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80101ee2:	83 c4 10             	add    $0x10,%esp
+}
+80101ee5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101ee8:	5b                   	pop    %ebx
+80101ee9:	5e                   	pop    %esi
+80101eea:	5d                   	pop    %ebp
+  iput(ip);
+80101eeb:	e9 60 fe ff ff       	jmp    80101d50 <iput>
+    panic("iunlock");
+80101ef0:	83 ec 0c             	sub    $0xc,%esp
+80101ef3:	68 73 bb 10 80       	push   $0x8010bb73
+80101ef8:	e8 83 e4 ff ff       	call   80100380 <panic>
+80101efd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101f00 <stati>:
+
+// Copy stat information from inode.
+// Caller must hold ip->lock.
+void
+stati(struct inode *ip, struct stat *st)
+{
+80101f00:	55                   	push   %ebp
+80101f01:	89 e5                	mov    %esp,%ebp
+80101f03:	8b 55 08             	mov    0x8(%ebp),%edx
+80101f06:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+80101f09:	8b 0a                	mov    (%edx),%ecx
+80101f0b:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+80101f0e:	8b 4a 04             	mov    0x4(%edx),%ecx
+80101f11:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80101f14:	0f b7 4a 50          	movzwl 0x50(%edx),%ecx
+80101f18:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+80101f1b:	0f b7 4a 56          	movzwl 0x56(%edx),%ecx
+80101f1f:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+80101f23:	8b 52 58             	mov    0x58(%edx),%edx
+80101f26:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80101f29:	5d                   	pop    %ebp
+80101f2a:	c3                   	ret
+80101f2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101f2f:	90                   	nop
+
+80101f30 <readi>:
+//PAGEBREAK!
+// Read data from inode.
+// Caller must hold ip->lock.
+int
+readi(struct inode *ip, char *dst, uint off, uint n)
+{
+80101f30:	55                   	push   %ebp
+80101f31:	89 e5                	mov    %esp,%ebp
+80101f33:	57                   	push   %edi
+80101f34:	56                   	push   %esi
+80101f35:	53                   	push   %ebx
+80101f36:	83 ec 1c             	sub    $0x1c,%esp
+80101f39:	8b 75 08             	mov    0x8(%ebp),%esi
+80101f3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101f3f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  uint tot, m;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+80101f42:	66 83 7e 50 03       	cmpw   $0x3,0x50(%esi)
+{
+80101f47:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101f4a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+80101f4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  if(ip->type == T_DEV){
+80101f50:	0f 84 aa 00 00 00    	je     80102000 <readi+0xd0>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+      return -1;
+    return devsw[ip->major].read(ip, dst, n);
+  }
+
+  if(off > ip->size || off + n < off)
+80101f56:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80101f59:	8b 56 58             	mov    0x58(%esi),%edx
+80101f5c:	39 fa                	cmp    %edi,%edx
+80101f5e:	0f 82 bd 00 00 00    	jb     80102021 <readi+0xf1>
+80101f64:	89 f9                	mov    %edi,%ecx
+80101f66:	31 db                	xor    %ebx,%ebx
+80101f68:	01 c1                	add    %eax,%ecx
+80101f6a:	0f 92 c3             	setb   %bl
+80101f6d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80101f70:	0f 82 ab 00 00 00    	jb     80102021 <readi+0xf1>
+    return -1;
+  if(off + n > ip->size)
+    n = ip->size - off;
+80101f76:	89 d3                	mov    %edx,%ebx
+80101f78:	29 fb                	sub    %edi,%ebx
+80101f7a:	39 ca                	cmp    %ecx,%edx
+80101f7c:	0f 42 c3             	cmovb  %ebx,%eax
+
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80101f7f:	85 c0                	test   %eax,%eax
+80101f81:	74 73                	je     80101ff6 <readi+0xc6>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101f83:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80101f86:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101f89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80101f90:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+80101f93:	89 fa                	mov    %edi,%edx
+80101f95:	c1 ea 09             	shr    $0x9,%edx
+80101f98:	89 d8                	mov    %ebx,%eax
+80101f9a:	e8 51 f9 ff ff       	call   801018f0 <bmap>
+80101f9f:	83 ec 08             	sub    $0x8,%esp
+80101fa2:	50                   	push   %eax
+80101fa3:	ff 33                	push   (%ebx)
+80101fa5:	e8 26 e1 ff ff       	call   801000d0 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101faa:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101fad:	b9 00 02 00 00       	mov    $0x200,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80101fb2:	89 c2                	mov    %eax,%edx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101fb4:	89 f8                	mov    %edi,%eax
+80101fb6:	25 ff 01 00 00       	and    $0x1ff,%eax
+80101fbb:	29 f3                	sub    %esi,%ebx
+80101fbd:	29 c1                	sub    %eax,%ecx
+    memmove(dst, bp->data + off%BSIZE, m);
+80101fbf:	8d 44 02 5c          	lea    0x5c(%edx,%eax,1),%eax
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101fc3:	39 d9                	cmp    %ebx,%ecx
+80101fc5:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(dst, bp->data + off%BSIZE, m);
+80101fc8:	83 c4 0c             	add    $0xc,%esp
+80101fcb:	53                   	push   %ebx
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80101fcc:	01 de                	add    %ebx,%esi
+80101fce:	01 df                	add    %ebx,%edi
+    memmove(dst, bp->data + off%BSIZE, m);
+80101fd0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80101fd3:	50                   	push   %eax
+80101fd4:	ff 75 e0             	push   -0x20(%ebp)
+80101fd7:	e8 64 60 00 00       	call   80108040 <memmove>
+    brelse(bp);
+80101fdc:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80101fdf:	89 14 24             	mov    %edx,(%esp)
+80101fe2:	e8 09 e2 ff ff       	call   801001f0 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80101fe7:	01 5d e0             	add    %ebx,-0x20(%ebp)
+80101fea:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101fed:	83 c4 10             	add    $0x10,%esp
+80101ff0:	39 de                	cmp    %ebx,%esi
+80101ff2:	72 9c                	jb     80101f90 <readi+0x60>
+80101ff4:	89 d8                	mov    %ebx,%eax
+  }
+  return n;
+}
+80101ff6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101ff9:	5b                   	pop    %ebx
+80101ffa:	5e                   	pop    %esi
+80101ffb:	5f                   	pop    %edi
+80101ffc:	5d                   	pop    %ebp
+80101ffd:	c3                   	ret
+80101ffe:	66 90                	xchg   %ax,%ax
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+80102000:	0f bf 56 52          	movswl 0x52(%esi),%edx
+80102004:	66 83 fa 09          	cmp    $0x9,%dx
+80102008:	77 17                	ja     80102021 <readi+0xf1>
+8010200a:	8b 14 d5 00 49 11 80 	mov    -0x7feeb700(,%edx,8),%edx
+80102011:	85 d2                	test   %edx,%edx
+80102013:	74 0c                	je     80102021 <readi+0xf1>
+    return devsw[ip->major].read(ip, dst, n);
+80102015:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+80102018:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010201b:	5b                   	pop    %ebx
+8010201c:	5e                   	pop    %esi
+8010201d:	5f                   	pop    %edi
+8010201e:	5d                   	pop    %ebp
+    return devsw[ip->major].read(ip, dst, n);
+8010201f:	ff e2                	jmp    *%edx
+      return -1;
+80102021:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102026:	eb ce                	jmp    80101ff6 <readi+0xc6>
+80102028:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010202f:	90                   	nop
+
+80102030 <writei>:
+// PAGEBREAK!
+// Write data to inode.
+// Caller must hold ip->lock.
+int
+writei(struct inode *ip, char *src, uint off, uint n)
+{
+80102030:	55                   	push   %ebp
+80102031:	89 e5                	mov    %esp,%ebp
+80102033:	57                   	push   %edi
+80102034:	56                   	push   %esi
+80102035:	53                   	push   %ebx
+80102036:	83 ec 1c             	sub    $0x1c,%esp
+80102039:	8b 45 08             	mov    0x8(%ebp),%eax
+8010203c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010203f:	8b 75 14             	mov    0x14(%ebp),%esi
+  uint tot, m;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+80102042:	66 83 78 50 03       	cmpw   $0x3,0x50(%eax)
+{
+80102047:	89 7d dc             	mov    %edi,-0x24(%ebp)
+8010204a:	89 75 e0             	mov    %esi,-0x20(%ebp)
+8010204d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+80102050:	0f 84 ca 00 00 00    	je     80102120 <writei+0xf0>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+      return -1;
+    return devsw[ip->major].write(ip, src, n);
+  }
+
+  if(off > ip->size || off + n < off)
+80102056:	39 78 58             	cmp    %edi,0x58(%eax)
+80102059:	0f 82 fa 00 00 00    	jb     80102159 <writei+0x129>
+8010205f:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80102062:	31 c9                	xor    %ecx,%ecx
+80102064:	89 f2                	mov    %esi,%edx
+80102066:	01 fa                	add    %edi,%edx
+80102068:	0f 92 c1             	setb   %cl
+    return -1;
+  if(off + n > MAXFILE*BSIZE)
+8010206b:	81 fa 00 18 01 00    	cmp    $0x11800,%edx
+80102071:	0f 87 e2 00 00 00    	ja     80102159 <writei+0x129>
+80102077:	85 c9                	test   %ecx,%ecx
+80102079:	0f 85 da 00 00 00    	jne    80102159 <writei+0x129>
+    return -1;
+
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+8010207f:	85 f6                	test   %esi,%esi
+80102081:	0f 84 86 00 00 00    	je     8010210d <writei+0xdd>
+80102087:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+8010208e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80102091:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80102098:	8b 75 d8             	mov    -0x28(%ebp),%esi
+8010209b:	89 fa                	mov    %edi,%edx
+8010209d:	c1 ea 09             	shr    $0x9,%edx
+801020a0:	89 f0                	mov    %esi,%eax
+801020a2:	e8 49 f8 ff ff       	call   801018f0 <bmap>
+801020a7:	83 ec 08             	sub    $0x8,%esp
+801020aa:	50                   	push   %eax
+801020ab:	ff 36                	push   (%esi)
+801020ad:	e8 1e e0 ff ff       	call   801000d0 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+801020b2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801020b5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+801020b8:	b9 00 02 00 00       	mov    $0x200,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+801020bd:	89 c6                	mov    %eax,%esi
+    m = min(n - tot, BSIZE - off%BSIZE);
+801020bf:	89 f8                	mov    %edi,%eax
+801020c1:	25 ff 01 00 00       	and    $0x1ff,%eax
+801020c6:	29 d3                	sub    %edx,%ebx
+801020c8:	29 c1                	sub    %eax,%ecx
+    memmove(bp->data + off%BSIZE, src, m);
+801020ca:	8d 44 06 5c          	lea    0x5c(%esi,%eax,1),%eax
+    m = min(n - tot, BSIZE - off%BSIZE);
+801020ce:	39 d9                	cmp    %ebx,%ecx
+801020d0:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+801020d3:	83 c4 0c             	add    $0xc,%esp
+801020d6:	53                   	push   %ebx
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+801020d7:	01 df                	add    %ebx,%edi
+    memmove(bp->data + off%BSIZE, src, m);
+801020d9:	ff 75 dc             	push   -0x24(%ebp)
+801020dc:	50                   	push   %eax
+801020dd:	e8 5e 5f 00 00       	call   80108040 <memmove>
+    log_write(bp);
+801020e2:	89 34 24             	mov    %esi,(%esp)
+801020e5:	e8 76 13 00 00       	call   80103460 <log_write>
+    brelse(bp);
+801020ea:	89 34 24             	mov    %esi,(%esp)
+801020ed:	e8 fe e0 ff ff       	call   801001f0 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+801020f2:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+801020f5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801020f8:	83 c4 10             	add    $0x10,%esp
+801020fb:	01 5d dc             	add    %ebx,-0x24(%ebp)
+801020fe:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80102101:	39 d8                	cmp    %ebx,%eax
+80102103:	72 93                	jb     80102098 <writei+0x68>
+  }
+
+  if(n > 0 && off > ip->size){
+80102105:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80102108:	39 78 58             	cmp    %edi,0x58(%eax)
+8010210b:	72 3b                	jb     80102148 <writei+0x118>
+    ip->size = off;
+    iupdate(ip);
+  }
+  return n;
+8010210d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+80102110:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102113:	5b                   	pop    %ebx
+80102114:	5e                   	pop    %esi
+80102115:	5f                   	pop    %edi
+80102116:	5d                   	pop    %ebp
+80102117:	c3                   	ret
+80102118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010211f:	90                   	nop
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+80102120:	0f bf 40 52          	movswl 0x52(%eax),%eax
+80102124:	66 83 f8 09          	cmp    $0x9,%ax
+80102128:	77 2f                	ja     80102159 <writei+0x129>
+8010212a:	8b 04 c5 04 49 11 80 	mov    -0x7feeb6fc(,%eax,8),%eax
+80102131:	85 c0                	test   %eax,%eax
+80102133:	74 24                	je     80102159 <writei+0x129>
+    return devsw[ip->major].write(ip, src, n);
+80102135:	89 75 10             	mov    %esi,0x10(%ebp)
+}
+80102138:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010213b:	5b                   	pop    %ebx
+8010213c:	5e                   	pop    %esi
+8010213d:	5f                   	pop    %edi
+8010213e:	5d                   	pop    %ebp
+    return devsw[ip->major].write(ip, src, n);
+8010213f:	ff e0                	jmp    *%eax
+80102141:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    iupdate(ip);
+80102148:	83 ec 0c             	sub    $0xc,%esp
+    ip->size = off;
+8010214b:	89 78 58             	mov    %edi,0x58(%eax)
+    iupdate(ip);
+8010214e:	50                   	push   %eax
+8010214f:	e8 1c fa ff ff       	call   80101b70 <iupdate>
+80102154:	83 c4 10             	add    $0x10,%esp
+80102157:	eb b4                	jmp    8010210d <writei+0xdd>
+      return -1;
+80102159:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010215e:	eb b0                	jmp    80102110 <writei+0xe0>
+
+80102160 <namecmp>:
+//PAGEBREAK!
+// Directories
+
+int
+namecmp(const char *s, const char *t)
+{
+80102160:	55                   	push   %ebp
+80102161:	89 e5                	mov    %esp,%ebp
+80102163:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+80102166:	6a 0e                	push   $0xe
+80102168:	ff 75 0c             	push   0xc(%ebp)
+8010216b:	ff 75 08             	push   0x8(%ebp)
+8010216e:	e8 3d 5f 00 00       	call   801080b0 <strncmp>
+}
+80102173:	c9                   	leave
+80102174:	c3                   	ret
+80102175:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010217c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102180 <dirlookup>:
+
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+80102180:	55                   	push   %ebp
+80102181:	89 e5                	mov    %esp,%ebp
+80102183:	57                   	push   %edi
+80102184:	56                   	push   %esi
+80102185:	53                   	push   %ebx
+80102186:	83 ec 1c             	sub    $0x1c,%esp
+80102189:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint off, inum;
+  struct dirent de;
+
+  if(dp->type != T_DIR)
+8010218c:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80102191:	0f 85 85 00 00 00    	jne    8010221c <dirlookup+0x9c>
+    panic("dirlookup not DIR");
+
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80102197:	8b 53 58             	mov    0x58(%ebx),%edx
+8010219a:	31 ff                	xor    %edi,%edi
+8010219c:	8d 75 d8             	lea    -0x28(%ebp),%esi
+8010219f:	85 d2                	test   %edx,%edx
+801021a1:	74 3e                	je     801021e1 <dirlookup+0x61>
+801021a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801021a7:	90                   	nop
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801021a8:	6a 10                	push   $0x10
+801021aa:	57                   	push   %edi
+801021ab:	56                   	push   %esi
+801021ac:	53                   	push   %ebx
+801021ad:	e8 7e fd ff ff       	call   80101f30 <readi>
+801021b2:	83 c4 10             	add    $0x10,%esp
+801021b5:	83 f8 10             	cmp    $0x10,%eax
+801021b8:	75 55                	jne    8010220f <dirlookup+0x8f>
+      panic("dirlookup read");
+    if(de.inum == 0)
+801021ba:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+801021bf:	74 18                	je     801021d9 <dirlookup+0x59>
+  return strncmp(s, t, DIRSIZ);
+801021c1:	83 ec 04             	sub    $0x4,%esp
+801021c4:	8d 45 da             	lea    -0x26(%ebp),%eax
+801021c7:	6a 0e                	push   $0xe
+801021c9:	50                   	push   %eax
+801021ca:	ff 75 0c             	push   0xc(%ebp)
+801021cd:	e8 de 5e 00 00       	call   801080b0 <strncmp>
+      continue;
+    if(namecmp(name, de.name) == 0){
+801021d2:	83 c4 10             	add    $0x10,%esp
+801021d5:	85 c0                	test   %eax,%eax
+801021d7:	74 17                	je     801021f0 <dirlookup+0x70>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801021d9:	83 c7 10             	add    $0x10,%edi
+801021dc:	3b 7b 58             	cmp    0x58(%ebx),%edi
+801021df:	72 c7                	jb     801021a8 <dirlookup+0x28>
+      return iget(dp->dev, inum);
+    }
+  }
+
+  return 0;
+}
+801021e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+801021e4:	31 c0                	xor    %eax,%eax
+}
+801021e6:	5b                   	pop    %ebx
+801021e7:	5e                   	pop    %esi
+801021e8:	5f                   	pop    %edi
+801021e9:	5d                   	pop    %ebp
+801021ea:	c3                   	ret
+801021eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801021ef:	90                   	nop
+      if(poff)
+801021f0:	8b 45 10             	mov    0x10(%ebp),%eax
+801021f3:	85 c0                	test   %eax,%eax
+801021f5:	74 05                	je     801021fc <dirlookup+0x7c>
+        *poff = off;
+801021f7:	8b 45 10             	mov    0x10(%ebp),%eax
+801021fa:	89 38                	mov    %edi,(%eax)
+      inum = de.inum;
+801021fc:	0f b7 55 d8          	movzwl -0x28(%ebp),%edx
+      return iget(dp->dev, inum);
+80102200:	8b 03                	mov    (%ebx),%eax
+80102202:	e8 69 f5 ff ff       	call   80101770 <iget>
+}
+80102207:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010220a:	5b                   	pop    %ebx
+8010220b:	5e                   	pop    %esi
+8010220c:	5f                   	pop    %edi
+8010220d:	5d                   	pop    %ebp
+8010220e:	c3                   	ret
+      panic("dirlookup read");
+8010220f:	83 ec 0c             	sub    $0xc,%esp
+80102212:	68 8d bb 10 80       	push   $0x8010bb8d
+80102217:	e8 64 e1 ff ff       	call   80100380 <panic>
+    panic("dirlookup not DIR");
+8010221c:	83 ec 0c             	sub    $0xc,%esp
+8010221f:	68 7b bb 10 80       	push   $0x8010bb7b
+80102224:	e8 57 e1 ff ff       	call   80100380 <panic>
+80102229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102230 <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80102230:	55                   	push   %ebp
+80102231:	89 e5                	mov    %esp,%ebp
+80102233:	57                   	push   %edi
+80102234:	56                   	push   %esi
+80102235:	53                   	push   %ebx
+80102236:	89 c3                	mov    %eax,%ebx
+80102238:	83 ec 1c             	sub    $0x1c,%esp
+  struct inode *ip, *next;
+
+  if(*path == '/')
+8010223b:	80 38 2f             	cmpb   $0x2f,(%eax)
+{
+8010223e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80102241:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  if(*path == '/')
+80102244:	0f 84 54 01 00 00    	je     8010239e <namex+0x16e>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = cwdget(myproc()->cwd);
+8010224a:	e8 b1 37 00 00       	call   80105a00 <myproc>
+8010224f:	83 ec 0c             	sub    $0xc,%esp
+80102252:	ff 70 44             	push   0x44(%eax)
+80102255:	e8 a6 f3 ff ff       	call   80101600 <cwdget>
+8010225a:	83 c4 10             	add    $0x10,%esp
+8010225d:	89 c6                	mov    %eax,%esi
+8010225f:	eb 0a                	jmp    8010226b <namex+0x3b>
+80102261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+80102268:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+8010226b:	0f b6 03             	movzbl (%ebx),%eax
+8010226e:	3c 2f                	cmp    $0x2f,%al
+80102270:	74 f6                	je     80102268 <namex+0x38>
+  if(*path == 0)
+80102272:	84 c0                	test   %al,%al
+80102274:	0f 84 06 01 00 00    	je     80102380 <namex+0x150>
+  while(*path != '/' && *path != 0)
+8010227a:	0f b6 03             	movzbl (%ebx),%eax
+8010227d:	84 c0                	test   %al,%al
+8010227f:	0f 84 10 01 00 00    	je     80102395 <namex+0x165>
+80102285:	89 df                	mov    %ebx,%edi
+80102287:	3c 2f                	cmp    $0x2f,%al
+80102289:	0f 84 06 01 00 00    	je     80102395 <namex+0x165>
+8010228f:	90                   	nop
+80102290:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+    path++;
+80102294:	83 c7 01             	add    $0x1,%edi
+  while(*path != '/' && *path != 0)
+80102297:	3c 2f                	cmp    $0x2f,%al
+80102299:	74 04                	je     8010229f <namex+0x6f>
+8010229b:	84 c0                	test   %al,%al
+8010229d:	75 f1                	jne    80102290 <namex+0x60>
+  len = path - s;
+8010229f:	89 f8                	mov    %edi,%eax
+801022a1:	29 d8                	sub    %ebx,%eax
+  if(len >= DIRSIZ)
+801022a3:	83 f8 0d             	cmp    $0xd,%eax
+801022a6:	0f 8e ac 00 00 00    	jle    80102358 <namex+0x128>
+    memmove(name, s, DIRSIZ);
+801022ac:	83 ec 04             	sub    $0x4,%esp
+801022af:	6a 0e                	push   $0xe
+801022b1:	53                   	push   %ebx
+    path++;
+801022b2:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, DIRSIZ);
+801022b4:	ff 75 e4             	push   -0x1c(%ebp)
+801022b7:	e8 84 5d 00 00       	call   80108040 <memmove>
+801022bc:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+801022bf:	80 3f 2f             	cmpb   $0x2f,(%edi)
+801022c2:	75 0c                	jne    801022d0 <namex+0xa0>
+801022c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+801022c8:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+801022cb:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+801022ce:	74 f8                	je     801022c8 <namex+0x98>
+
+  while((path = skipelem(path, name)) != 0){
+    ilock(ip);
+801022d0:	83 ec 0c             	sub    $0xc,%esp
+801022d3:	56                   	push   %esi
+801022d4:	e8 47 f9 ff ff       	call   80101c20 <ilock>
+    if(ip->type != T_DIR){
+801022d9:	83 c4 10             	add    $0x10,%esp
+801022dc:	66 83 7e 50 01       	cmpw   $0x1,0x50(%esi)
+801022e1:	0f 85 cd 00 00 00    	jne    801023b4 <namex+0x184>
+      iunlockput(ip);
+      return 0;
+    }
+    if(nameiparent && *path == '\0'){
+801022e7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801022ea:	85 c0                	test   %eax,%eax
+801022ec:	74 09                	je     801022f7 <namex+0xc7>
+801022ee:	80 3b 00             	cmpb   $0x0,(%ebx)
+801022f1:	0f 84 34 01 00 00    	je     8010242b <namex+0x1fb>
+      // Stop one level early.
+      iunlock(ip);
+      return ip;
+    }
+    if((next = dirlookup(ip, name, 0)) == 0){
+801022f7:	83 ec 04             	sub    $0x4,%esp
+801022fa:	6a 00                	push   $0x0
+801022fc:	ff 75 e4             	push   -0x1c(%ebp)
+801022ff:	56                   	push   %esi
+80102300:	e8 7b fe ff ff       	call   80102180 <dirlookup>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102305:	8d 56 0c             	lea    0xc(%esi),%edx
+    if((next = dirlookup(ip, name, 0)) == 0){
+80102308:	83 c4 10             	add    $0x10,%esp
+8010230b:	89 c7                	mov    %eax,%edi
+8010230d:	85 c0                	test   %eax,%eax
+8010230f:	0f 84 e1 00 00 00    	je     801023f6 <namex+0x1c6>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102315:	83 ec 0c             	sub    $0xc,%esp
+80102318:	52                   	push   %edx
+80102319:	89 55 e0             	mov    %edx,-0x20(%ebp)
+8010231c:	e8 7f 59 00 00       	call   80107ca0 <holdingsleep>
+80102321:	83 c4 10             	add    $0x10,%esp
+80102324:	85 c0                	test   %eax,%eax
+80102326:	0f 84 3f 01 00 00    	je     8010246b <namex+0x23b>
+8010232c:	8b 56 08             	mov    0x8(%esi),%edx
+8010232f:	85 d2                	test   %edx,%edx
+80102331:	0f 8e 34 01 00 00    	jle    8010246b <namex+0x23b>
+  releasesleep(&ip->lock);
+80102337:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010233a:	83 ec 0c             	sub    $0xc,%esp
+8010233d:	52                   	push   %edx
+8010233e:	e8 1d 59 00 00       	call   80107c60 <releasesleep>
+  iput(ip);
+80102343:	89 34 24             	mov    %esi,(%esp)
+80102346:	89 fe                	mov    %edi,%esi
+80102348:	e8 03 fa ff ff       	call   80101d50 <iput>
+8010234d:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+80102350:	e9 16 ff ff ff       	jmp    8010226b <namex+0x3b>
+80102355:	8d 76 00             	lea    0x0(%esi),%esi
+    name[len] = 0;
+80102358:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010235b:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+    memmove(name, s, len);
+8010235e:	83 ec 04             	sub    $0x4,%esp
+80102361:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80102364:	50                   	push   %eax
+80102365:	53                   	push   %ebx
+    name[len] = 0;
+80102366:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, len);
+80102368:	ff 75 e4             	push   -0x1c(%ebp)
+8010236b:	e8 d0 5c 00 00       	call   80108040 <memmove>
+    name[len] = 0;
+80102370:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80102373:	83 c4 10             	add    $0x10,%esp
+80102376:	c6 02 00             	movb   $0x0,(%edx)
+80102379:	e9 41 ff ff ff       	jmp    801022bf <namex+0x8f>
+8010237e:	66 90                	xchg   %ax,%ax
+      return 0;
+    }
+    iunlockput(ip);
+    ip = next;
+  }
+  if(nameiparent){
+80102380:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102383:	85 c0                	test   %eax,%eax
+80102385:	0f 85 d0 00 00 00    	jne    8010245b <namex+0x22b>
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+8010238b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010238e:	89 f0                	mov    %esi,%eax
+80102390:	5b                   	pop    %ebx
+80102391:	5e                   	pop    %esi
+80102392:	5f                   	pop    %edi
+80102393:	5d                   	pop    %ebp
+80102394:	c3                   	ret
+  while(*path != '/' && *path != 0)
+80102395:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102398:	89 df                	mov    %ebx,%edi
+8010239a:	31 c0                	xor    %eax,%eax
+8010239c:	eb c0                	jmp    8010235e <namex+0x12e>
+    ip = iget(ROOTDEV, ROOTINO);
+8010239e:	ba 01 00 00 00       	mov    $0x1,%edx
+801023a3:	b8 01 00 00 00       	mov    $0x1,%eax
+801023a8:	e8 c3 f3 ff ff       	call   80101770 <iget>
+801023ad:	89 c6                	mov    %eax,%esi
+801023af:	e9 b7 fe ff ff       	jmp    8010226b <namex+0x3b>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+801023b4:	83 ec 0c             	sub    $0xc,%esp
+801023b7:	8d 5e 0c             	lea    0xc(%esi),%ebx
+801023ba:	53                   	push   %ebx
+801023bb:	e8 e0 58 00 00       	call   80107ca0 <holdingsleep>
+801023c0:	83 c4 10             	add    $0x10,%esp
+801023c3:	85 c0                	test   %eax,%eax
+801023c5:	0f 84 a0 00 00 00    	je     8010246b <namex+0x23b>
+801023cb:	8b 46 08             	mov    0x8(%esi),%eax
+801023ce:	85 c0                	test   %eax,%eax
+801023d0:	0f 8e 95 00 00 00    	jle    8010246b <namex+0x23b>
+  releasesleep(&ip->lock);
+801023d6:	83 ec 0c             	sub    $0xc,%esp
+801023d9:	53                   	push   %ebx
+801023da:	e8 81 58 00 00       	call   80107c60 <releasesleep>
+  iput(ip);
+801023df:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+801023e2:	31 f6                	xor    %esi,%esi
+  iput(ip);
+801023e4:	e8 67 f9 ff ff       	call   80101d50 <iput>
+      return 0;
+801023e9:	83 c4 10             	add    $0x10,%esp
+}
+801023ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801023ef:	89 f0                	mov    %esi,%eax
+801023f1:	5b                   	pop    %ebx
+801023f2:	5e                   	pop    %esi
+801023f3:	5f                   	pop    %edi
+801023f4:	5d                   	pop    %ebp
+801023f5:	c3                   	ret
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+801023f6:	83 ec 0c             	sub    $0xc,%esp
+801023f9:	52                   	push   %edx
+801023fa:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801023fd:	e8 9e 58 00 00       	call   80107ca0 <holdingsleep>
+80102402:	83 c4 10             	add    $0x10,%esp
+80102405:	85 c0                	test   %eax,%eax
+80102407:	74 62                	je     8010246b <namex+0x23b>
+80102409:	8b 4e 08             	mov    0x8(%esi),%ecx
+8010240c:	85 c9                	test   %ecx,%ecx
+8010240e:	7e 5b                	jle    8010246b <namex+0x23b>
+  releasesleep(&ip->lock);
+80102410:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102413:	83 ec 0c             	sub    $0xc,%esp
+80102416:	52                   	push   %edx
+80102417:	e8 44 58 00 00       	call   80107c60 <releasesleep>
+  iput(ip);
+8010241c:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+8010241f:	31 f6                	xor    %esi,%esi
+  iput(ip);
+80102421:	e8 2a f9 ff ff       	call   80101d50 <iput>
+      return 0;
+80102426:	83 c4 10             	add    $0x10,%esp
+80102429:	eb c1                	jmp    801023ec <namex+0x1bc>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+8010242b:	83 ec 0c             	sub    $0xc,%esp
+8010242e:	8d 5e 0c             	lea    0xc(%esi),%ebx
+80102431:	53                   	push   %ebx
+80102432:	e8 69 58 00 00       	call   80107ca0 <holdingsleep>
+80102437:	83 c4 10             	add    $0x10,%esp
+8010243a:	85 c0                	test   %eax,%eax
+8010243c:	74 2d                	je     8010246b <namex+0x23b>
+8010243e:	8b 7e 08             	mov    0x8(%esi),%edi
+80102441:	85 ff                	test   %edi,%edi
+80102443:	7e 26                	jle    8010246b <namex+0x23b>
+  releasesleep(&ip->lock);
+80102445:	83 ec 0c             	sub    $0xc,%esp
+80102448:	53                   	push   %ebx
+80102449:	e8 12 58 00 00       	call   80107c60 <releasesleep>
+}
+8010244e:	83 c4 10             	add    $0x10,%esp
+}
+80102451:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102454:	89 f0                	mov    %esi,%eax
+80102456:	5b                   	pop    %ebx
+80102457:	5e                   	pop    %esi
+80102458:	5f                   	pop    %edi
+80102459:	5d                   	pop    %ebp
+8010245a:	c3                   	ret
+    iput(ip);
+8010245b:	83 ec 0c             	sub    $0xc,%esp
+8010245e:	56                   	push   %esi
+      return 0;
+8010245f:	31 f6                	xor    %esi,%esi
+    iput(ip);
+80102461:	e8 ea f8 ff ff       	call   80101d50 <iput>
+    return 0;
+80102466:	83 c4 10             	add    $0x10,%esp
+80102469:	eb 81                	jmp    801023ec <namex+0x1bc>
+    panic("iunlock");
+8010246b:	83 ec 0c             	sub    $0xc,%esp
+8010246e:	68 73 bb 10 80       	push   $0x8010bb73
+80102473:	e8 08 df ff ff       	call   80100380 <panic>
+80102478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010247f:	90                   	nop
+
+80102480 <dirlink>:
+{
+80102480:	55                   	push   %ebp
+80102481:	89 e5                	mov    %esp,%ebp
+80102483:	57                   	push   %edi
+80102484:	56                   	push   %esi
+80102485:	53                   	push   %ebx
+80102486:	83 ec 20             	sub    $0x20,%esp
+80102489:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((ip = dirlookup(dp, name, 0)) != 0){
+8010248c:	6a 00                	push   $0x0
+8010248e:	ff 75 0c             	push   0xc(%ebp)
+80102491:	53                   	push   %ebx
+80102492:	e8 e9 fc ff ff       	call   80102180 <dirlookup>
+80102497:	83 c4 10             	add    $0x10,%esp
+8010249a:	85 c0                	test   %eax,%eax
+8010249c:	75 67                	jne    80102505 <dirlink+0x85>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+8010249e:	8b 7b 58             	mov    0x58(%ebx),%edi
+801024a1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+801024a4:	85 ff                	test   %edi,%edi
+801024a6:	74 29                	je     801024d1 <dirlink+0x51>
+801024a8:	31 ff                	xor    %edi,%edi
+801024aa:	8d 75 d8             	lea    -0x28(%ebp),%esi
+801024ad:	eb 09                	jmp    801024b8 <dirlink+0x38>
+801024af:	90                   	nop
+801024b0:	83 c7 10             	add    $0x10,%edi
+801024b3:	3b 7b 58             	cmp    0x58(%ebx),%edi
+801024b6:	73 19                	jae    801024d1 <dirlink+0x51>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801024b8:	6a 10                	push   $0x10
+801024ba:	57                   	push   %edi
+801024bb:	56                   	push   %esi
+801024bc:	53                   	push   %ebx
+801024bd:	e8 6e fa ff ff       	call   80101f30 <readi>
+801024c2:	83 c4 10             	add    $0x10,%esp
+801024c5:	83 f8 10             	cmp    $0x10,%eax
+801024c8:	75 4e                	jne    80102518 <dirlink+0x98>
+    if(de.inum == 0)
+801024ca:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+801024cf:	75 df                	jne    801024b0 <dirlink+0x30>
+  strncpy(de.name, name, DIRSIZ);
+801024d1:	83 ec 04             	sub    $0x4,%esp
+801024d4:	8d 45 da             	lea    -0x26(%ebp),%eax
+801024d7:	6a 0e                	push   $0xe
+801024d9:	ff 75 0c             	push   0xc(%ebp)
+801024dc:	50                   	push   %eax
+801024dd:	e8 1e 5c 00 00       	call   80108100 <strncpy>
+  de.inum = inum;
+801024e2:	8b 45 10             	mov    0x10(%ebp),%eax
+801024e5:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801024e9:	6a 10                	push   $0x10
+801024eb:	57                   	push   %edi
+801024ec:	56                   	push   %esi
+801024ed:	53                   	push   %ebx
+801024ee:	e8 3d fb ff ff       	call   80102030 <writei>
+801024f3:	83 c4 20             	add    $0x20,%esp
+801024f6:	83 f8 10             	cmp    $0x10,%eax
+801024f9:	75 2a                	jne    80102525 <dirlink+0xa5>
+  return 0;
+801024fb:	31 c0                	xor    %eax,%eax
+}
+801024fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102500:	5b                   	pop    %ebx
+80102501:	5e                   	pop    %esi
+80102502:	5f                   	pop    %edi
+80102503:	5d                   	pop    %ebp
+80102504:	c3                   	ret
+    iput(ip);
+80102505:	83 ec 0c             	sub    $0xc,%esp
+80102508:	50                   	push   %eax
+80102509:	e8 42 f8 ff ff       	call   80101d50 <iput>
+    return -1;
+8010250e:	83 c4 10             	add    $0x10,%esp
+80102511:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102516:	eb e5                	jmp    801024fd <dirlink+0x7d>
+      panic("dirlink read");
+80102518:	83 ec 0c             	sub    $0xc,%esp
+8010251b:	68 9c bb 10 80       	push   $0x8010bb9c
+80102520:	e8 5b de ff ff       	call   80100380 <panic>
+    panic("dirlink");
+80102525:	83 ec 0c             	sub    $0xc,%esp
+80102528:	68 f2 c1 10 80       	push   $0x8010c1f2
+8010252d:	e8 4e de ff ff       	call   80100380 <panic>
+80102532:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102540 <namei>:
+
+struct inode*
+namei(char *path)
+{
+80102540:	55                   	push   %ebp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+80102541:	31 d2                	xor    %edx,%edx
+{
+80102543:	89 e5                	mov    %esp,%ebp
+80102545:	83 ec 18             	sub    $0x18,%esp
+  return namex(path, 0, name);
+80102548:	8b 45 08             	mov    0x8(%ebp),%eax
+8010254b:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+8010254e:	e8 dd fc ff ff       	call   80102230 <namex>
+}
+80102553:	c9                   	leave
+80102554:	c3                   	ret
+80102555:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010255c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102560 <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+80102560:	55                   	push   %ebp
+  return namex(path, 1, name);
+80102561:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+80102566:	89 e5                	mov    %esp,%ebp
+  return namex(path, 1, name);
+80102568:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010256b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+8010256e:	5d                   	pop    %ebp
+  return namex(path, 1, name);
+8010256f:	e9 bc fc ff ff       	jmp    80102230 <namex>
+80102574:	66 90                	xchg   %ax,%ax
+80102576:	66 90                	xchg   %ax,%ax
+80102578:	66 90                	xchg   %ax,%ax
+8010257a:	66 90                	xchg   %ax,%ax
+8010257c:	66 90                	xchg   %ax,%ax
+8010257e:	66 90                	xchg   %ax,%ax
+
+80102580 <idestart>:
+}
+
+// Start the request for b.  Caller must hold idelock.
+static void
+idestart(struct buf *b)
+{
+80102580:	55                   	push   %ebp
+80102581:	89 e5                	mov    %esp,%ebp
+80102583:	57                   	push   %edi
+80102584:	56                   	push   %esi
+80102585:	53                   	push   %ebx
+80102586:	83 ec 0c             	sub    $0xc,%esp
+  if(b == 0)
+80102589:	85 c0                	test   %eax,%eax
+8010258b:	0f 84 b4 00 00 00    	je     80102645 <idestart+0xc5>
+    panic("idestart");
+  if(b->blockno >= FSSIZE)
+80102591:	8b 70 08             	mov    0x8(%eax),%esi
+80102594:	89 c3                	mov    %eax,%ebx
+80102596:	81 fe cf 07 00 00    	cmp    $0x7cf,%esi
+8010259c:	0f 87 96 00 00 00    	ja     80102638 <idestart+0xb8>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801025a2:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+801025a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801025ae:	66 90                	xchg   %ax,%ax
+801025b0:	89 ca                	mov    %ecx,%edx
+801025b2:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+801025b3:	83 e0 c0             	and    $0xffffffc0,%eax
+801025b6:	3c 40                	cmp    $0x40,%al
+801025b8:	75 f6                	jne    801025b0 <idestart+0x30>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801025ba:	31 ff                	xor    %edi,%edi
+801025bc:	ba f6 03 00 00       	mov    $0x3f6,%edx
+801025c1:	89 f8                	mov    %edi,%eax
+801025c3:	ee                   	out    %al,(%dx)
+801025c4:	b8 01 00 00 00       	mov    $0x1,%eax
+801025c9:	ba f2 01 00 00       	mov    $0x1f2,%edx
+801025ce:	ee                   	out    %al,(%dx)
+801025cf:	ba f3 01 00 00       	mov    $0x1f3,%edx
+801025d4:	89 f0                	mov    %esi,%eax
+801025d6:	ee                   	out    %al,(%dx)
+
+  idewait(0);
+  outb(0x3f6, 0);  // generate interrupt
+  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f3, sector & 0xff);
+  outb(0x1f4, (sector >> 8) & 0xff);
+801025d7:	89 f0                	mov    %esi,%eax
+801025d9:	ba f4 01 00 00       	mov    $0x1f4,%edx
+801025de:	c1 f8 08             	sar    $0x8,%eax
+801025e1:	ee                   	out    %al,(%dx)
+801025e2:	ba f5 01 00 00       	mov    $0x1f5,%edx
+801025e7:	89 f8                	mov    %edi,%eax
+801025e9:	ee                   	out    %al,(%dx)
+  outb(0x1f5, (sector >> 16) & 0xff);
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+801025ea:	0f b6 43 04          	movzbl 0x4(%ebx),%eax
+801025ee:	ba f6 01 00 00       	mov    $0x1f6,%edx
+801025f3:	c1 e0 04             	shl    $0x4,%eax
+801025f6:	83 e0 10             	and    $0x10,%eax
+801025f9:	83 c8 e0             	or     $0xffffffe0,%eax
+801025fc:	ee                   	out    %al,(%dx)
+  if(b->flags & B_DIRTY){
+801025fd:	f6 03 04             	testb  $0x4,(%ebx)
+80102600:	75 16                	jne    80102618 <idestart+0x98>
+80102602:	b8 20 00 00 00       	mov    $0x20,%eax
+80102607:	89 ca                	mov    %ecx,%edx
+80102609:	ee                   	out    %al,(%dx)
+    outb(0x1f7, write_cmd);
+    outsl(0x1f0, b->data, BSIZE/4);
+  } else {
+    outb(0x1f7, read_cmd);
+  }
+}
+8010260a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010260d:	5b                   	pop    %ebx
+8010260e:	5e                   	pop    %esi
+8010260f:	5f                   	pop    %edi
+80102610:	5d                   	pop    %ebp
+80102611:	c3                   	ret
+80102612:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80102618:	b8 30 00 00 00       	mov    $0x30,%eax
+8010261d:	89 ca                	mov    %ecx,%edx
+8010261f:	ee                   	out    %al,(%dx)
+  asm volatile("cld; rep outsl" :
+80102620:	b9 80 00 00 00       	mov    $0x80,%ecx
+    outsl(0x1f0, b->data, BSIZE/4);
+80102625:	8d 73 5c             	lea    0x5c(%ebx),%esi
+80102628:	ba f0 01 00 00       	mov    $0x1f0,%edx
+8010262d:	fc                   	cld
+8010262e:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+}
+80102630:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102633:	5b                   	pop    %ebx
+80102634:	5e                   	pop    %esi
+80102635:	5f                   	pop    %edi
+80102636:	5d                   	pop    %ebp
+80102637:	c3                   	ret
+    panic("incorrect blockno");
+80102638:	83 ec 0c             	sub    $0xc,%esp
+8010263b:	68 08 bc 10 80       	push   $0x8010bc08
+80102640:	e8 3b dd ff ff       	call   80100380 <panic>
+    panic("idestart");
+80102645:	83 ec 0c             	sub    $0xc,%esp
+80102648:	68 ff bb 10 80       	push   $0x8010bbff
+8010264d:	e8 2e dd ff ff       	call   80100380 <panic>
+80102652:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102660 <ideinit>:
+{
+80102660:	55                   	push   %ebp
+80102661:	89 e5                	mov    %esp,%ebp
+80102663:	83 ec 10             	sub    $0x10,%esp
+  initlock(&idelock, "ide");
+80102666:	68 1a bc 10 80       	push   $0x8010bc1a
+8010266b:	68 40 66 11 80       	push   $0x80116640
+80102670:	e8 7b 56 00 00       	call   80107cf0 <initlock>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+80102675:	58                   	pop    %eax
+80102676:	a1 c4 67 11 80       	mov    0x801167c4,%eax
+8010267b:	5a                   	pop    %edx
+8010267c:	83 e8 01             	sub    $0x1,%eax
+8010267f:	50                   	push   %eax
+80102680:	6a 0e                	push   $0xe
+80102682:	e8 99 02 00 00       	call   80102920 <ioapicenable>
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80102687:	83 c4 10             	add    $0x10,%esp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010268a:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+8010268f:	90                   	nop
+80102690:	89 ca                	mov    %ecx,%edx
+80102692:	ec                   	in     (%dx),%al
+80102693:	83 e0 c0             	and    $0xffffffc0,%eax
+80102696:	3c 40                	cmp    $0x40,%al
+80102698:	75 f6                	jne    80102690 <ideinit+0x30>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010269a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+8010269f:	ba f6 01 00 00       	mov    $0x1f6,%edx
+801026a4:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801026a5:	89 ca                	mov    %ecx,%edx
+801026a7:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+801026a8:	84 c0                	test   %al,%al
+801026aa:	75 1e                	jne    801026ca <ideinit+0x6a>
+801026ac:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+801026b1:	ba f7 01 00 00       	mov    $0x1f7,%edx
+801026b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801026bd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i=0; i<1000; i++){
+801026c0:	83 e9 01             	sub    $0x1,%ecx
+801026c3:	74 0f                	je     801026d4 <ideinit+0x74>
+801026c5:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+801026c6:	84 c0                	test   %al,%al
+801026c8:	74 f6                	je     801026c0 <ideinit+0x60>
+      havedisk1 = 1;
+801026ca:	c7 05 20 66 11 80 01 	movl   $0x1,0x80116620
+801026d1:	00 00 00 
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801026d4:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+801026d9:	ba f6 01 00 00       	mov    $0x1f6,%edx
+801026de:	ee                   	out    %al,(%dx)
+}
+801026df:	c9                   	leave
+801026e0:	c3                   	ret
+801026e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801026e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801026ef:	90                   	nop
+
+801026f0 <ideintr>:
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+801026f0:	55                   	push   %ebp
+801026f1:	89 e5                	mov    %esp,%ebp
+801026f3:	57                   	push   %edi
+801026f4:	56                   	push   %esi
+801026f5:	53                   	push   %ebx
+801026f6:	83 ec 18             	sub    $0x18,%esp
+  struct buf *b;
+
+  // First queued buffer is the active request.
+  acquire(&idelock);
+801026f9:	68 40 66 11 80       	push   $0x80116640
+801026fe:	e8 cd 57 00 00       	call   80107ed0 <acquire>
+
+  if((b = idequeue) == 0){
+80102703:	8b 1d 24 66 11 80    	mov    0x80116624,%ebx
+80102709:	83 c4 10             	add    $0x10,%esp
+8010270c:	85 db                	test   %ebx,%ebx
+8010270e:	74 63                	je     80102773 <ideintr+0x83>
+    release(&idelock);
+    return;
+  }
+  idequeue = b->qnext;
+80102710:	8b 43 58             	mov    0x58(%ebx),%eax
+80102713:	a3 24 66 11 80       	mov    %eax,0x80116624
+
+  // Read data if needed.
+  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+80102718:	8b 33                	mov    (%ebx),%esi
+8010271a:	f7 c6 04 00 00 00    	test   $0x4,%esi
+80102720:	75 2f                	jne    80102751 <ideintr+0x61>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102722:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010272e:	66 90                	xchg   %ax,%ax
+80102730:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80102731:	89 c1                	mov    %eax,%ecx
+80102733:	83 e1 c0             	and    $0xffffffc0,%ecx
+80102736:	80 f9 40             	cmp    $0x40,%cl
+80102739:	75 f5                	jne    80102730 <ideintr+0x40>
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+8010273b:	a8 21                	test   $0x21,%al
+8010273d:	75 12                	jne    80102751 <ideintr+0x61>
+    insl(0x1f0, b->data, BSIZE/4);
+8010273f:	8d 7b 5c             	lea    0x5c(%ebx),%edi
+  asm volatile("cld; rep insl" :
+80102742:	b9 80 00 00 00       	mov    $0x80,%ecx
+80102747:	ba f0 01 00 00       	mov    $0x1f0,%edx
+8010274c:	fc                   	cld
+8010274d:	f3 6d                	rep insl (%dx),%es:(%edi)
+
+  // Wake process waiting for this buf.
+  b->flags |= B_VALID;
+8010274f:	8b 33                	mov    (%ebx),%esi
+  b->flags &= ~B_DIRTY;
+80102751:	83 e6 fb             	and    $0xfffffffb,%esi
+  wakeup(b);
+80102754:	83 ec 0c             	sub    $0xc,%esp
+  b->flags &= ~B_DIRTY;
+80102757:	83 ce 02             	or     $0x2,%esi
+8010275a:	89 33                	mov    %esi,(%ebx)
+  wakeup(b);
+8010275c:	53                   	push   %ebx
+8010275d:	e8 ae 40 00 00       	call   80106810 <wakeup>
+
+  // Start disk on next buf in queue.
+  if(idequeue != 0)
+80102762:	a1 24 66 11 80       	mov    0x80116624,%eax
+80102767:	83 c4 10             	add    $0x10,%esp
+8010276a:	85 c0                	test   %eax,%eax
+8010276c:	74 05                	je     80102773 <ideintr+0x83>
+    idestart(idequeue);
+8010276e:	e8 0d fe ff ff       	call   80102580 <idestart>
+    release(&idelock);
+80102773:	83 ec 0c             	sub    $0xc,%esp
+80102776:	68 40 66 11 80       	push   $0x80116640
+8010277b:	e8 f0 56 00 00       	call   80107e70 <release>
+
+  release(&idelock);
+}
+80102780:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102783:	5b                   	pop    %ebx
+80102784:	5e                   	pop    %esi
+80102785:	5f                   	pop    %edi
+80102786:	5d                   	pop    %ebp
+80102787:	c3                   	ret
+80102788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010278f:	90                   	nop
+
+80102790 <iderw>:
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+80102790:	55                   	push   %ebp
+80102791:	89 e5                	mov    %esp,%ebp
+80102793:	53                   	push   %ebx
+80102794:	83 ec 10             	sub    $0x10,%esp
+80102797:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct buf **pp;
+
+  if(!holdingsleep(&b->lock))
+8010279a:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010279d:	50                   	push   %eax
+8010279e:	e8 fd 54 00 00       	call   80107ca0 <holdingsleep>
+801027a3:	83 c4 10             	add    $0x10,%esp
+801027a6:	85 c0                	test   %eax,%eax
+801027a8:	0f 84 c3 00 00 00    	je     80102871 <iderw+0xe1>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+801027ae:	8b 03                	mov    (%ebx),%eax
+801027b0:	83 e0 06             	and    $0x6,%eax
+801027b3:	83 f8 02             	cmp    $0x2,%eax
+801027b6:	0f 84 a8 00 00 00    	je     80102864 <iderw+0xd4>
+    panic("iderw: nothing to do");
+  if(b->dev != 0 && !havedisk1)
+801027bc:	8b 53 04             	mov    0x4(%ebx),%edx
+801027bf:	85 d2                	test   %edx,%edx
+801027c1:	74 0d                	je     801027d0 <iderw+0x40>
+801027c3:	a1 20 66 11 80       	mov    0x80116620,%eax
+801027c8:	85 c0                	test   %eax,%eax
+801027ca:	0f 84 87 00 00 00    	je     80102857 <iderw+0xc7>
+    panic("iderw: ide disk 1 not present");
+
+  acquire(&idelock);  //DOC:acquire-lock
+801027d0:	83 ec 0c             	sub    $0xc,%esp
+801027d3:	68 40 66 11 80       	push   $0x80116640
+801027d8:	e8 f3 56 00 00       	call   80107ed0 <acquire>
+
+  // Append b to idequeue.
+  b->qnext = 0;
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+801027dd:	a1 24 66 11 80       	mov    0x80116624,%eax
+  b->qnext = 0;
+801027e2:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+801027e9:	83 c4 10             	add    $0x10,%esp
+801027ec:	85 c0                	test   %eax,%eax
+801027ee:	74 60                	je     80102850 <iderw+0xc0>
+801027f0:	89 c2                	mov    %eax,%edx
+801027f2:	8b 40 58             	mov    0x58(%eax),%eax
+801027f5:	85 c0                	test   %eax,%eax
+801027f7:	75 f7                	jne    801027f0 <iderw+0x60>
+801027f9:	83 c2 58             	add    $0x58,%edx
+    ;
+  *pp = b;
+801027fc:	89 1a                	mov    %ebx,(%edx)
+
+  // Start disk if necessary.
+  if(idequeue == b)
+801027fe:	39 1d 24 66 11 80    	cmp    %ebx,0x80116624
+80102804:	74 3a                	je     80102840 <iderw+0xb0>
+    idestart(b);
+
+  // Wait for request to finish.
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+80102806:	8b 03                	mov    (%ebx),%eax
+80102808:	83 e0 06             	and    $0x6,%eax
+8010280b:	83 f8 02             	cmp    $0x2,%eax
+8010280e:	74 1b                	je     8010282b <iderw+0x9b>
+    sleep(b, &idelock);
+80102810:	83 ec 08             	sub    $0x8,%esp
+80102813:	68 40 66 11 80       	push   $0x80116640
+80102818:	53                   	push   %ebx
+80102819:	e8 22 3f 00 00       	call   80106740 <sleep>
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+8010281e:	8b 03                	mov    (%ebx),%eax
+80102820:	83 c4 10             	add    $0x10,%esp
+80102823:	83 e0 06             	and    $0x6,%eax
+80102826:	83 f8 02             	cmp    $0x2,%eax
+80102829:	75 e5                	jne    80102810 <iderw+0x80>
+  }
+
+
+  release(&idelock);
+8010282b:	c7 45 08 40 66 11 80 	movl   $0x80116640,0x8(%ebp)
+}
+80102832:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102835:	c9                   	leave
+  release(&idelock);
+80102836:	e9 35 56 00 00       	jmp    80107e70 <release>
+8010283b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010283f:	90                   	nop
+    idestart(b);
+80102840:	89 d8                	mov    %ebx,%eax
+80102842:	e8 39 fd ff ff       	call   80102580 <idestart>
+80102847:	eb bd                	jmp    80102806 <iderw+0x76>
+80102849:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+80102850:	ba 24 66 11 80       	mov    $0x80116624,%edx
+80102855:	eb a5                	jmp    801027fc <iderw+0x6c>
+    panic("iderw: ide disk 1 not present");
+80102857:	83 ec 0c             	sub    $0xc,%esp
+8010285a:	68 49 bc 10 80       	push   $0x8010bc49
+8010285f:	e8 1c db ff ff       	call   80100380 <panic>
+    panic("iderw: nothing to do");
+80102864:	83 ec 0c             	sub    $0xc,%esp
+80102867:	68 34 bc 10 80       	push   $0x8010bc34
+8010286c:	e8 0f db ff ff       	call   80100380 <panic>
+    panic("iderw: buf not locked");
+80102871:	83 ec 0c             	sub    $0xc,%esp
+80102874:	68 1e bc 10 80       	push   $0x8010bc1e
+80102879:	e8 02 db ff ff       	call   80100380 <panic>
+8010287e:	66 90                	xchg   %ax,%ax
+
+80102880 <ioapicinit>:
+  ioapic->data = data;
+}
+
+void
+ioapicinit(void)
+{
+80102880:	55                   	push   %ebp
+80102881:	89 e5                	mov    %esp,%ebp
+80102883:	56                   	push   %esi
+80102884:	53                   	push   %ebx
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+80102885:	c7 05 74 66 11 80 00 	movl   $0xfec00000,0x80116674
+8010288c:	00 c0 fe 
+  ioapic->reg = reg;
+8010288f:	c7 05 00 00 c0 fe 01 	movl   $0x1,0xfec00000
+80102896:	00 00 00 
+  return ioapic->data;
+80102899:	8b 15 74 66 11 80    	mov    0x80116674,%edx
+8010289f:	8b 72 10             	mov    0x10(%edx),%esi
+  ioapic->reg = reg;
+801028a2:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  return ioapic->data;
+801028a8:	8b 1d 74 66 11 80    	mov    0x80116674,%ebx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+  id = ioapicread(REG_ID) >> 24;
+  if(id != ioapicid)
+801028ae:	0f b6 15 c0 67 11 80 	movzbl 0x801167c0,%edx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+801028b5:	c1 ee 10             	shr    $0x10,%esi
+801028b8:	89 f0                	mov    %esi,%eax
+801028ba:	0f b6 f0             	movzbl %al,%esi
+  return ioapic->data;
+801028bd:	8b 43 10             	mov    0x10(%ebx),%eax
+  id = ioapicread(REG_ID) >> 24;
+801028c0:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+801028c3:	39 c2                	cmp    %eax,%edx
+801028c5:	74 16                	je     801028dd <ioapicinit+0x5d>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+801028c7:	83 ec 0c             	sub    $0xc,%esp
+801028ca:	68 68 bc 10 80       	push   $0x8010bc68
+801028cf:	e8 dc dd ff ff       	call   801006b0 <cprintf>
+  ioapic->reg = reg;
+801028d4:	8b 1d 74 66 11 80    	mov    0x80116674,%ebx
+801028da:	83 c4 10             	add    $0x10,%esp
+{
+801028dd:	ba 10 00 00 00       	mov    $0x10,%edx
+801028e2:	31 c0                	xor    %eax,%eax
+801028e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ioapic->reg = reg;
+801028e8:	89 13                	mov    %edx,(%ebx)
+801028ea:	8d 48 20             	lea    0x20(%eax),%ecx
+  ioapic->data = data;
+801028ed:	8b 1d 74 66 11 80    	mov    0x80116674,%ebx
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+801028f3:	83 c0 01             	add    $0x1,%eax
+801028f6:	81 c9 00 00 01 00    	or     $0x10000,%ecx
+  ioapic->data = data;
+801028fc:	89 4b 10             	mov    %ecx,0x10(%ebx)
+  ioapic->reg = reg;
+801028ff:	8d 4a 01             	lea    0x1(%edx),%ecx
+  for(i = 0; i <= maxintr; i++){
+80102902:	83 c2 02             	add    $0x2,%edx
+  ioapic->reg = reg;
+80102905:	89 0b                	mov    %ecx,(%ebx)
+  ioapic->data = data;
+80102907:	8b 1d 74 66 11 80    	mov    0x80116674,%ebx
+8010290d:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  for(i = 0; i <= maxintr; i++){
+80102914:	39 c6                	cmp    %eax,%esi
+80102916:	7d d0                	jge    801028e8 <ioapicinit+0x68>
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+  }
+}
+80102918:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010291b:	5b                   	pop    %ebx
+8010291c:	5e                   	pop    %esi
+8010291d:	5d                   	pop    %ebp
+8010291e:	c3                   	ret
+8010291f:	90                   	nop
+
+80102920 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+80102920:	55                   	push   %ebp
+  ioapic->reg = reg;
+80102921:	8b 0d 74 66 11 80    	mov    0x80116674,%ecx
+{
+80102927:	89 e5                	mov    %esp,%ebp
+80102929:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+8010292c:	8d 50 20             	lea    0x20(%eax),%edx
+8010292f:	8d 44 00 10          	lea    0x10(%eax,%eax,1),%eax
+  ioapic->reg = reg;
+80102933:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80102935:	8b 0d 74 66 11 80    	mov    0x80116674,%ecx
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010293b:	83 c0 01             	add    $0x1,%eax
+  ioapic->data = data;
+8010293e:	89 51 10             	mov    %edx,0x10(%ecx)
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80102941:	8b 55 0c             	mov    0xc(%ebp),%edx
+  ioapic->reg = reg;
+80102944:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80102946:	a1 74 66 11 80       	mov    0x80116674,%eax
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010294b:	c1 e2 18             	shl    $0x18,%edx
+  ioapic->data = data;
+8010294e:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80102951:	5d                   	pop    %ebp
+80102952:	c3                   	ret
+80102953:	66 90                	xchg   %ax,%ax
+80102955:	66 90                	xchg   %ax,%ax
+80102957:	66 90                	xchg   %ax,%ax
+80102959:	66 90                	xchg   %ax,%ax
+8010295b:	66 90                	xchg   %ax,%ax
+8010295d:	66 90                	xchg   %ax,%ax
+8010295f:	90                   	nop
+
+80102960 <kfree>:
+// which normally should have been returned by a
+// call to kalloc().  (The exception is when
+// initializing the allocator; see kinit above.)
+void
+kfree(char *v)
+{
+80102960:	55                   	push   %ebp
+80102961:	89 e5                	mov    %esp,%ebp
+80102963:	53                   	push   %ebx
+80102964:	83 ec 04             	sub    $0x4,%esp
+80102967:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct run *r;
+
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+8010296a:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+80102970:	75 76                	jne    801029e8 <kfree+0x88>
+80102972:	81 fb a0 b4 13 80    	cmp    $0x8013b4a0,%ebx
+80102978:	72 6e                	jb     801029e8 <kfree+0x88>
+8010297a:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80102980:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80102985:	77 61                	ja     801029e8 <kfree+0x88>
+    panic("kfree");
+
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, PGSIZE);
+80102987:	83 ec 04             	sub    $0x4,%esp
+8010298a:	68 00 10 00 00       	push   $0x1000
+8010298f:	6a 01                	push   $0x1
+80102991:	53                   	push   %ebx
+80102992:	e8 19 56 00 00       	call   80107fb0 <memset>
+
+  if(kmem.use_lock)
+80102997:	8b 15 b4 66 11 80    	mov    0x801166b4,%edx
+8010299d:	83 c4 10             	add    $0x10,%esp
+801029a0:	85 d2                	test   %edx,%edx
+801029a2:	75 1c                	jne    801029c0 <kfree+0x60>
+    acquire(&kmem.lock);
+  r = (struct run*)v;
+  r->next = kmem.freelist;
+801029a4:	a1 b8 66 11 80       	mov    0x801166b8,%eax
+801029a9:	89 03                	mov    %eax,(%ebx)
+  kmem.freelist = r;
+  if(kmem.use_lock)
+801029ab:	a1 b4 66 11 80       	mov    0x801166b4,%eax
+  kmem.freelist = r;
+801029b0:	89 1d b8 66 11 80    	mov    %ebx,0x801166b8
+  if(kmem.use_lock)
+801029b6:	85 c0                	test   %eax,%eax
+801029b8:	75 1e                	jne    801029d8 <kfree+0x78>
+    release(&kmem.lock);
+}
+801029ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801029bd:	c9                   	leave
+801029be:	c3                   	ret
+801029bf:	90                   	nop
+    acquire(&kmem.lock);
+801029c0:	83 ec 0c             	sub    $0xc,%esp
+801029c3:	68 80 66 11 80       	push   $0x80116680
+801029c8:	e8 03 55 00 00       	call   80107ed0 <acquire>
+801029cd:	83 c4 10             	add    $0x10,%esp
+801029d0:	eb d2                	jmp    801029a4 <kfree+0x44>
+801029d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    release(&kmem.lock);
+801029d8:	c7 45 08 80 66 11 80 	movl   $0x80116680,0x8(%ebp)
+}
+801029df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801029e2:	c9                   	leave
+    release(&kmem.lock);
+801029e3:	e9 88 54 00 00       	jmp    80107e70 <release>
+    panic("kfree");
+801029e8:	83 ec 0c             	sub    $0xc,%esp
+801029eb:	68 9a bc 10 80       	push   $0x8010bc9a
+801029f0:	e8 8b d9 ff ff       	call   80100380 <panic>
+801029f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801029fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102a00 <freerange>:
+{
+80102a00:	55                   	push   %ebp
+80102a01:	89 e5                	mov    %esp,%ebp
+80102a03:	56                   	push   %esi
+80102a04:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+80102a05:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80102a08:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+80102a0b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80102a11:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102a17:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80102a1d:	39 de                	cmp    %ebx,%esi
+80102a1f:	72 23                	jb     80102a44 <freerange+0x44>
+80102a21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kfree(p);
+80102a28:	83 ec 0c             	sub    $0xc,%esp
+80102a2b:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102a31:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80102a37:	50                   	push   %eax
+80102a38:	e8 23 ff ff ff       	call   80102960 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102a3d:	83 c4 10             	add    $0x10,%esp
+80102a40:	39 de                	cmp    %ebx,%esi
+80102a42:	73 e4                	jae    80102a28 <freerange+0x28>
+}
+80102a44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102a47:	5b                   	pop    %ebx
+80102a48:	5e                   	pop    %esi
+80102a49:	5d                   	pop    %ebp
+80102a4a:	c3                   	ret
+80102a4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102a4f:	90                   	nop
+
+80102a50 <kinit2>:
+{
+80102a50:	55                   	push   %ebp
+80102a51:	89 e5                	mov    %esp,%ebp
+80102a53:	56                   	push   %esi
+80102a54:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+80102a55:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80102a58:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+80102a5b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80102a61:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102a67:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80102a6d:	39 de                	cmp    %ebx,%esi
+80102a6f:	72 23                	jb     80102a94 <kinit2+0x44>
+80102a71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kfree(p);
+80102a78:	83 ec 0c             	sub    $0xc,%esp
+80102a7b:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102a81:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80102a87:	50                   	push   %eax
+80102a88:	e8 d3 fe ff ff       	call   80102960 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102a8d:	83 c4 10             	add    $0x10,%esp
+80102a90:	39 de                	cmp    %ebx,%esi
+80102a92:	73 e4                	jae    80102a78 <kinit2+0x28>
+  kmem.use_lock = 1;
+80102a94:	c7 05 b4 66 11 80 01 	movl   $0x1,0x801166b4
+80102a9b:	00 00 00 
+}
+80102a9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102aa1:	5b                   	pop    %ebx
+80102aa2:	5e                   	pop    %esi
+80102aa3:	5d                   	pop    %ebp
+80102aa4:	c3                   	ret
+80102aa5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102aac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102ab0 <kinit1>:
+{
+80102ab0:	55                   	push   %ebp
+80102ab1:	89 e5                	mov    %esp,%ebp
+80102ab3:	56                   	push   %esi
+80102ab4:	53                   	push   %ebx
+80102ab5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  initlock(&kmem.lock, "kmem");
+80102ab8:	83 ec 08             	sub    $0x8,%esp
+80102abb:	68 a0 bc 10 80       	push   $0x8010bca0
+80102ac0:	68 80 66 11 80       	push   $0x80116680
+80102ac5:	e8 26 52 00 00       	call   80107cf0 <initlock>
+  p = (char*)PGROUNDUP((uint)vstart);
+80102aca:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102acd:	83 c4 10             	add    $0x10,%esp
+  kmem.use_lock = 0;
+80102ad0:	c7 05 b4 66 11 80 00 	movl   $0x0,0x801166b4
+80102ad7:	00 00 00 
+  p = (char*)PGROUNDUP((uint)vstart);
+80102ada:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80102ae0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102ae6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80102aec:	39 de                	cmp    %ebx,%esi
+80102aee:	72 1c                	jb     80102b0c <kinit1+0x5c>
+    kfree(p);
+80102af0:	83 ec 0c             	sub    $0xc,%esp
+80102af3:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102af9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80102aff:	50                   	push   %eax
+80102b00:	e8 5b fe ff ff       	call   80102960 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102b05:	83 c4 10             	add    $0x10,%esp
+80102b08:	39 de                	cmp    %ebx,%esi
+80102b0a:	73 e4                	jae    80102af0 <kinit1+0x40>
+}
+80102b0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102b0f:	5b                   	pop    %ebx
+80102b10:	5e                   	pop    %esi
+80102b11:	5d                   	pop    %ebp
+80102b12:	c3                   	ret
+80102b13:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102b20 <kalloc>:
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+80102b20:	55                   	push   %ebp
+80102b21:	89 e5                	mov    %esp,%ebp
+80102b23:	53                   	push   %ebx
+80102b24:	83 ec 04             	sub    $0x4,%esp
+  struct run *r;
+
+  if(kmem.use_lock)
+80102b27:	a1 b4 66 11 80       	mov    0x801166b4,%eax
+80102b2c:	85 c0                	test   %eax,%eax
+80102b2e:	75 20                	jne    80102b50 <kalloc+0x30>
+    acquire(&kmem.lock);
+  r = kmem.freelist;
+80102b30:	8b 1d b8 66 11 80    	mov    0x801166b8,%ebx
+  if(r)
+80102b36:	85 db                	test   %ebx,%ebx
+80102b38:	74 07                	je     80102b41 <kalloc+0x21>
+    kmem.freelist = r->next;
+80102b3a:	8b 03                	mov    (%ebx),%eax
+80102b3c:	a3 b8 66 11 80       	mov    %eax,0x801166b8
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return (char*)r;
+}
+80102b41:	89 d8                	mov    %ebx,%eax
+80102b43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102b46:	c9                   	leave
+80102b47:	c3                   	ret
+80102b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102b4f:	90                   	nop
+    acquire(&kmem.lock);
+80102b50:	83 ec 0c             	sub    $0xc,%esp
+80102b53:	68 80 66 11 80       	push   $0x80116680
+80102b58:	e8 73 53 00 00       	call   80107ed0 <acquire>
+  r = kmem.freelist;
+80102b5d:	8b 1d b8 66 11 80    	mov    0x801166b8,%ebx
+  if(kmem.use_lock)
+80102b63:	a1 b4 66 11 80       	mov    0x801166b4,%eax
+  if(r)
+80102b68:	83 c4 10             	add    $0x10,%esp
+80102b6b:	85 db                	test   %ebx,%ebx
+80102b6d:	74 08                	je     80102b77 <kalloc+0x57>
+    kmem.freelist = r->next;
+80102b6f:	8b 13                	mov    (%ebx),%edx
+80102b71:	89 15 b8 66 11 80    	mov    %edx,0x801166b8
+  if(kmem.use_lock)
+80102b77:	85 c0                	test   %eax,%eax
+80102b79:	74 c6                	je     80102b41 <kalloc+0x21>
+    release(&kmem.lock);
+80102b7b:	83 ec 0c             	sub    $0xc,%esp
+80102b7e:	68 80 66 11 80       	push   $0x80116680
+80102b83:	e8 e8 52 00 00       	call   80107e70 <release>
+}
+80102b88:	89 d8                	mov    %ebx,%eax
+    release(&kmem.lock);
+80102b8a:	83 c4 10             	add    $0x10,%esp
+}
+80102b8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102b90:	c9                   	leave
+80102b91:	c3                   	ret
+80102b92:	66 90                	xchg   %ax,%ax
+80102b94:	66 90                	xchg   %ax,%ax
+80102b96:	66 90                	xchg   %ax,%ax
+80102b98:	66 90                	xchg   %ax,%ax
+80102b9a:	66 90                	xchg   %ax,%ax
+80102b9c:	66 90                	xchg   %ax,%ax
+80102b9e:	66 90                	xchg   %ax,%ax
+
+80102ba0 <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102ba0:	ba 64 00 00 00       	mov    $0x64,%edx
+80102ba5:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+80102ba6:	a8 01                	test   $0x1,%al
+80102ba8:	0f 84 c2 00 00 00    	je     80102c70 <kbdgetc+0xd0>
+{
+80102bae:	55                   	push   %ebp
+80102baf:	ba 60 00 00 00       	mov    $0x60,%edx
+80102bb4:	89 e5                	mov    %esp,%ebp
+80102bb6:	53                   	push   %ebx
+80102bb7:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+
+  if(data == 0xE0){
+    shift |= E0ESC;
+80102bb8:	8b 1d bc 66 11 80    	mov    0x801166bc,%ebx
+  data = inb(KBDATAP);
+80102bbe:	0f b6 c8             	movzbl %al,%ecx
+  if(data == 0xE0){
+80102bc1:	3c e0                	cmp    $0xe0,%al
+80102bc3:	74 5b                	je     80102c20 <kbdgetc+0x80>
+    return 0;
+  } else if(data & 0x80){
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+80102bc5:	89 da                	mov    %ebx,%edx
+80102bc7:	83 e2 40             	and    $0x40,%edx
+  } else if(data & 0x80){
+80102bca:	84 c0                	test   %al,%al
+80102bcc:	78 6a                	js     80102c38 <kbdgetc+0x98>
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+80102bce:	85 d2                	test   %edx,%edx
+80102bd0:	74 09                	je     80102bdb <kbdgetc+0x3b>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+80102bd2:	83 c8 80             	or     $0xffffff80,%eax
+    shift &= ~E0ESC;
+80102bd5:	83 e3 bf             	and    $0xffffffbf,%ebx
+    data |= 0x80;
+80102bd8:	0f b6 c8             	movzbl %al,%ecx
+  }
+
+  shift |= shiftcode[data];
+80102bdb:	0f b6 91 e0 bd 10 80 	movzbl -0x7fef4220(%ecx),%edx
+  shift ^= togglecode[data];
+80102be2:	0f b6 81 e0 bc 10 80 	movzbl -0x7fef4320(%ecx),%eax
+  shift |= shiftcode[data];
+80102be9:	09 da                	or     %ebx,%edx
+  shift ^= togglecode[data];
+80102beb:	31 c2                	xor    %eax,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+80102bed:	89 d0                	mov    %edx,%eax
+  shift ^= togglecode[data];
+80102bef:	89 15 bc 66 11 80    	mov    %edx,0x801166bc
+  c = charcode[shift & (CTL | SHIFT)][data];
+80102bf5:	83 e0 03             	and    $0x3,%eax
+  if(shift & CAPSLOCK){
+80102bf8:	83 e2 08             	and    $0x8,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+80102bfb:	8b 04 85 c0 bc 10 80 	mov    -0x7fef4340(,%eax,4),%eax
+80102c02:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+80102c06:	74 0b                	je     80102c13 <kbdgetc+0x73>
+    if('a' <= c && c <= 'z')
+80102c08:	8d 50 9f             	lea    -0x61(%eax),%edx
+80102c0b:	83 fa 19             	cmp    $0x19,%edx
+80102c0e:	77 48                	ja     80102c58 <kbdgetc+0xb8>
+      c += 'A' - 'a';
+80102c10:	83 e8 20             	sub    $0x20,%eax
+    else if('A' <= c && c <= 'Z')
+      c += 'a' - 'A';
+  }
+  return c;
+}
+80102c13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102c16:	c9                   	leave
+80102c17:	c3                   	ret
+80102c18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102c1f:	90                   	nop
+    shift |= E0ESC;
+80102c20:	89 d8                	mov    %ebx,%eax
+80102c22:	83 c8 40             	or     $0x40,%eax
+    shift &= ~(shiftcode[data] | E0ESC);
+80102c25:	a3 bc 66 11 80       	mov    %eax,0x801166bc
+    return 0;
+80102c2a:	31 c0                	xor    %eax,%eax
+}
+80102c2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102c2f:	c9                   	leave
+80102c30:	c3                   	ret
+80102c31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    data = (shift & E0ESC ? data : data & 0x7F);
+80102c38:	83 e0 7f             	and    $0x7f,%eax
+80102c3b:	85 d2                	test   %edx,%edx
+80102c3d:	0f 44 c8             	cmove  %eax,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80102c40:	0f b6 81 e0 bd 10 80 	movzbl -0x7fef4220(%ecx),%eax
+80102c47:	83 c8 40             	or     $0x40,%eax
+80102c4a:	0f b6 c0             	movzbl %al,%eax
+80102c4d:	f7 d0                	not    %eax
+80102c4f:	21 d8                	and    %ebx,%eax
+    return 0;
+80102c51:	eb d2                	jmp    80102c25 <kbdgetc+0x85>
+80102c53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102c57:	90                   	nop
+    else if('A' <= c && c <= 'Z')
+80102c58:	8d 48 bf             	lea    -0x41(%eax),%ecx
+      c += 'a' - 'A';
+80102c5b:	8d 50 20             	lea    0x20(%eax),%edx
+}
+80102c5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102c61:	c9                   	leave
+      c += 'a' - 'A';
+80102c62:	83 f9 1a             	cmp    $0x1a,%ecx
+80102c65:	0f 42 c2             	cmovb  %edx,%eax
+}
+80102c68:	c3                   	ret
+80102c69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80102c70:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80102c75:	c3                   	ret
+80102c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102c7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102c80 <kbdintr>:
+
+void
+kbdintr(void)
+{
+80102c80:	55                   	push   %ebp
+80102c81:	89 e5                	mov    %esp,%ebp
+80102c83:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+80102c86:	68 a0 2b 10 80       	push   $0x80102ba0
+80102c8b:	e8 30 dc ff ff       	call   801008c0 <consoleintr>
+}
+80102c90:	83 c4 10             	add    $0x10,%esp
+80102c93:	c9                   	leave
+80102c94:	c3                   	ret
+80102c95:	66 90                	xchg   %ax,%ax
+80102c97:	66 90                	xchg   %ax,%ax
+80102c99:	66 90                	xchg   %ax,%ax
+80102c9b:	66 90                	xchg   %ax,%ax
+80102c9d:	66 90                	xchg   %ax,%ax
+80102c9f:	90                   	nop
+
+80102ca0 <lapicinit>:
+}
+
+void
+lapicinit(void)
+{
+  if(!lapic)
+80102ca0:	a1 c0 66 11 80       	mov    0x801166c0,%eax
+80102ca5:	85 c0                	test   %eax,%eax
+80102ca7:	0f 84 cb 00 00 00    	je     80102d78 <lapicinit+0xd8>
+  lapic[index] = value;
+80102cad:	c7 80 f0 00 00 00 3f 	movl   $0x13f,0xf0(%eax)
+80102cb4:	01 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102cb7:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102cba:	c7 80 e0 03 00 00 0b 	movl   $0xb,0x3e0(%eax)
+80102cc1:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102cc4:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102cc7:	c7 80 20 03 00 00 20 	movl   $0x20020,0x320(%eax)
+80102cce:	00 02 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102cd1:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102cd4:	c7 80 80 03 00 00 80 	movl   $0x989680,0x380(%eax)
+80102cdb:	96 98 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102cde:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102ce1:	c7 80 50 03 00 00 00 	movl   $0x10000,0x350(%eax)
+80102ce8:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102ceb:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102cee:	c7 80 60 03 00 00 00 	movl   $0x10000,0x360(%eax)
+80102cf5:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102cf8:	8b 50 20             	mov    0x20(%eax),%edx
+  lapicw(LINT0, MASKED);
+  lapicw(LINT1, MASKED);
+
+  // Disable performance counter overflow interrupts
+  // on machines that provide that interrupt entry.
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+80102cfb:	8b 50 30             	mov    0x30(%eax),%edx
+80102cfe:	c1 ea 10             	shr    $0x10,%edx
+80102d01:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+80102d07:	75 77                	jne    80102d80 <lapicinit+0xe0>
+  lapic[index] = value;
+80102d09:	c7 80 70 03 00 00 33 	movl   $0x33,0x370(%eax)
+80102d10:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102d13:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102d16:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+80102d1d:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102d20:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102d23:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+80102d2a:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102d2d:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102d30:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80102d37:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102d3a:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102d3d:	c7 80 10 03 00 00 00 	movl   $0x0,0x310(%eax)
+80102d44:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102d47:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102d4a:	c7 80 00 03 00 00 00 	movl   $0x88500,0x300(%eax)
+80102d51:	85 08 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102d54:	8b 50 20             	mov    0x20(%eax),%edx
+80102d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102d5e:	66 90                	xchg   %ax,%ax
+  lapicw(EOI, 0);
+
+  // Send an Init Level De-Assert to synchronise arbitration ID's.
+  lapicw(ICRHI, 0);
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+  while(lapic[ICRLO] & DELIVS)
+80102d60:	8b 90 00 03 00 00    	mov    0x300(%eax),%edx
+80102d66:	80 e6 10             	and    $0x10,%dh
+80102d69:	75 f5                	jne    80102d60 <lapicinit+0xc0>
+  lapic[index] = value;
+80102d6b:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%eax)
+80102d72:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102d75:	8b 40 20             	mov    0x20(%eax),%eax
+    ;
+
+  // Enable interrupts on the APIC (but not on the processor).
+  lapicw(TPR, 0);
+}
+80102d78:	c3                   	ret
+80102d79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  lapic[index] = value;
+80102d80:	c7 80 40 03 00 00 00 	movl   $0x10000,0x340(%eax)
+80102d87:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102d8a:	8b 50 20             	mov    0x20(%eax),%edx
+}
+80102d8d:	e9 77 ff ff ff       	jmp    80102d09 <lapicinit+0x69>
+80102d92:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102d99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102da0 <lapicid>:
+
+int
+lapicid(void)
+{
+  if (!lapic)
+80102da0:	a1 c0 66 11 80       	mov    0x801166c0,%eax
+80102da5:	85 c0                	test   %eax,%eax
+80102da7:	74 07                	je     80102db0 <lapicid+0x10>
+    return 0;
+  return lapic[ID] >> 24;
+80102da9:	8b 40 20             	mov    0x20(%eax),%eax
+80102dac:	c1 e8 18             	shr    $0x18,%eax
+80102daf:	c3                   	ret
+    return 0;
+80102db0:	31 c0                	xor    %eax,%eax
+}
+80102db2:	c3                   	ret
+80102db3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102dba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102dc0 <lapiceoi>:
+
+// Acknowledge interrupt.
+void
+lapiceoi(void)
+{
+  if(lapic)
+80102dc0:	a1 c0 66 11 80       	mov    0x801166c0,%eax
+80102dc5:	85 c0                	test   %eax,%eax
+80102dc7:	74 0d                	je     80102dd6 <lapiceoi+0x16>
+  lapic[index] = value;
+80102dc9:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80102dd0:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102dd3:	8b 40 20             	mov    0x20(%eax),%eax
+    lapicw(EOI, 0);
+}
+80102dd6:	c3                   	ret
+80102dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102dde:	66 90                	xchg   %ax,%ax
+
+80102de0 <lapicipi>:
+
+// Send interrupt vector to the CPU with the given APIC ID.
+void
+lapicipi(int apicid, int vector)
+{
+  if(!lapic)
+80102de0:	8b 15 c0 66 11 80    	mov    0x801166c0,%edx
+80102de6:	85 d2                	test   %edx,%edx
+80102de8:	74 36                	je     80102e20 <lapicipi+0x40>
+{
+80102dea:	55                   	push   %ebp
+80102deb:	89 e5                	mov    %esp,%ebp
+    return;
+  lapicw(ICRHI, apicid<<24);
+80102ded:	8b 45 08             	mov    0x8(%ebp),%eax
+80102df0:	c1 e0 18             	shl    $0x18,%eax
+  lapic[index] = value;
+80102df3:	89 82 10 03 00 00    	mov    %eax,0x310(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+80102df9:	8b 42 20             	mov    0x20(%edx),%eax
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+80102dfc:	8b 45 0c             	mov    0xc(%ebp),%eax
+80102dff:	80 cc 40             	or     $0x40,%ah
+  lapic[index] = value;
+80102e02:	89 82 00 03 00 00    	mov    %eax,0x300(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+80102e08:	8b 42 20             	mov    0x20(%edx),%eax
+80102e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102e0f:	90                   	nop
+  while(lapic[ICRLO] & DELIVS)
+80102e10:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+80102e16:	f6 c4 10             	test   $0x10,%ah
+80102e19:	75 f5                	jne    80102e10 <lapicipi+0x30>
+    ;
+}
+80102e1b:	5d                   	pop    %ebp
+80102e1c:	c3                   	ret
+80102e1d:	8d 76 00             	lea    0x0(%esi),%esi
+80102e20:	c3                   	ret
+80102e21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e2f:	90                   	nop
+
+80102e30 <lapictimer>:
+
+// Timer counts left before this CPU's next clock tick.
+uint
+lapictimer(void)
+{
+  if(!lapic)
+80102e30:	a1 c0 66 11 80       	mov    0x801166c0,%eax
+80102e35:	85 c0                	test   %eax,%eax
+80102e37:	74 07                	je     80102e40 <lapictimer+0x10>
+    return 0;
+  return lapic[TCCR];
+80102e39:	8b 80 90 03 00 00    	mov    0x390(%eax),%eax
+80102e3f:	c3                   	ret
+    return 0;
+80102e40:	31 c0                	xor    %eax,%eax
+}
+80102e42:	c3                   	ret
+80102e43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102e50 <microdelay>:
+// Spin for a given number of microseconds.
+// On real hardware would want to tune this dynamically.
+void
+microdelay(int us)
+{
+}
+80102e50:	c3                   	ret
+80102e51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e5f:	90                   	nop
+
+80102e60 <lapicstartap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapicstartap(uchar apicid, uint addr)
+{
+80102e60:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102e61:	b8 0f 00 00 00       	mov    $0xf,%eax
+80102e66:	ba 70 00 00 00       	mov    $0x70,%edx
+80102e6b:	89 e5                	mov    %esp,%ebp
+80102e6d:	53                   	push   %ebx
+80102e6e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80102e71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80102e74:	ee                   	out    %al,(%dx)
+80102e75:	b8 0a 00 00 00       	mov    $0xa,%eax
+80102e7a:	ba 71 00 00 00       	mov    $0x71,%edx
+80102e7f:	ee                   	out    %al,(%dx)
+  // and the warm reset vector (DWORD based at 40:67) to point at
+  // the AP startup code prior to the [universal startup algorithm]."
+  outb(CMOS_PORT, 0xF);  // offset 0xF is shutdown code
+  outb(CMOS_PORT+1, 0x0A);
+  wrv = (ushort*)P2V((0x40<<4 | 0x67));  // Warm reset vector
+  wrv[0] = 0;
+80102e80:	31 c0                	xor    %eax,%eax
+  lapic[index] = value;
+80102e82:	c1 e3 18             	shl    $0x18,%ebx
+  wrv[0] = 0;
+80102e85:	66 a3 67 04 00 80    	mov    %ax,0x80000467
+  wrv[1] = addr >> 4;
+80102e8b:	89 c8                	mov    %ecx,%eax
+  // when it is in the halted state due to an INIT.  So the second
+  // should be ignored, but it is part of the official Intel algorithm.
+  // Bochs complains about the second one.  Too bad for Bochs.
+  for(i = 0; i < 2; i++){
+    lapicw(ICRHI, apicid<<24);
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80102e8d:	c1 e9 0c             	shr    $0xc,%ecx
+  lapic[index] = value;
+80102e90:	89 da                	mov    %ebx,%edx
+  wrv[1] = addr >> 4;
+80102e92:	c1 e8 04             	shr    $0x4,%eax
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80102e95:	80 cd 06             	or     $0x6,%ch
+  wrv[1] = addr >> 4;
+80102e98:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapic[index] = value;
+80102e9e:	a1 c0 66 11 80       	mov    0x801166c0,%eax
+80102ea3:	89 98 10 03 00 00    	mov    %ebx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102ea9:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102eac:	c7 80 00 03 00 00 00 	movl   $0xc500,0x300(%eax)
+80102eb3:	c5 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102eb6:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102eb9:	c7 80 00 03 00 00 00 	movl   $0x8500,0x300(%eax)
+80102ec0:	85 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102ec3:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102ec6:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102ecc:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102ecf:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102ed5:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102ed8:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102ede:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102ee1:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102ee7:	8b 40 20             	mov    0x20(%eax),%eax
+    microdelay(200);
+  }
+}
+80102eea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102eed:	c9                   	leave
+80102eee:	c3                   	ret
+80102eef:	90                   	nop
+
+80102ef0 <cmostime>:
+}
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void
+cmostime(struct rtcdate *r)
+{
+80102ef0:	55                   	push   %ebp
+80102ef1:	b8 0b 00 00 00       	mov    $0xb,%eax
+80102ef6:	ba 70 00 00 00       	mov    $0x70,%edx
+80102efb:	89 e5                	mov    %esp,%ebp
+80102efd:	57                   	push   %edi
+80102efe:	56                   	push   %esi
+80102eff:	53                   	push   %ebx
+80102f00:	83 ec 4c             	sub    $0x4c,%esp
+80102f03:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102f04:	ba 71 00 00 00       	mov    $0x71,%edx
+80102f09:	ec                   	in     (%dx),%al
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+
+  bcd = (sb & (1 << 2)) == 0;
+80102f0a:	83 e0 04             	and    $0x4,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102f0d:	bf 70 00 00 00       	mov    $0x70,%edi
+80102f12:	88 45 b3             	mov    %al,-0x4d(%ebp)
+80102f15:	8d 76 00             	lea    0x0(%esi),%esi
+80102f18:	31 c0                	xor    %eax,%eax
+80102f1a:	89 fa                	mov    %edi,%edx
+80102f1c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102f1d:	b9 71 00 00 00       	mov    $0x71,%ecx
+80102f22:	89 ca                	mov    %ecx,%edx
+80102f24:	ec                   	in     (%dx),%al
+80102f25:	88 45 b7             	mov    %al,-0x49(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102f28:	89 fa                	mov    %edi,%edx
+80102f2a:	b8 02 00 00 00       	mov    $0x2,%eax
+80102f2f:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102f30:	89 ca                	mov    %ecx,%edx
+80102f32:	ec                   	in     (%dx),%al
+80102f33:	88 45 b6             	mov    %al,-0x4a(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102f36:	89 fa                	mov    %edi,%edx
+80102f38:	b8 04 00 00 00       	mov    $0x4,%eax
+80102f3d:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102f3e:	89 ca                	mov    %ecx,%edx
+80102f40:	ec                   	in     (%dx),%al
+80102f41:	88 45 b5             	mov    %al,-0x4b(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102f44:	89 fa                	mov    %edi,%edx
+80102f46:	b8 07 00 00 00       	mov    $0x7,%eax
+80102f4b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102f4c:	89 ca                	mov    %ecx,%edx
+80102f4e:	ec                   	in     (%dx),%al
+80102f4f:	88 45 b4             	mov    %al,-0x4c(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102f52:	89 fa                	mov    %edi,%edx
+80102f54:	b8 08 00 00 00       	mov    $0x8,%eax
+80102f59:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102f5a:	89 ca                	mov    %ecx,%edx
+80102f5c:	ec                   	in     (%dx),%al
+80102f5d:	89 c6                	mov    %eax,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102f5f:	89 fa                	mov    %edi,%edx
+80102f61:	b8 09 00 00 00       	mov    $0x9,%eax
+80102f66:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102f67:	89 ca                	mov    %ecx,%edx
+80102f69:	ec                   	in     (%dx),%al
+80102f6a:	0f b6 d8             	movzbl %al,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102f6d:	89 fa                	mov    %edi,%edx
+80102f6f:	b8 0a 00 00 00       	mov    $0xa,%eax
+80102f74:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102f75:	89 ca                	mov    %ecx,%edx
+80102f77:	ec                   	in     (%dx),%al
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+80102f78:	84 c0                	test   %al,%al
+80102f7a:	78 9c                	js     80102f18 <cmostime+0x28>
+  return inb(CMOS_RETURN);
+80102f7c:	0f b6 45 b7          	movzbl -0x49(%ebp),%eax
+80102f80:	89 f2                	mov    %esi,%edx
+80102f82:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+80102f85:	0f b6 f2             	movzbl %dl,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102f88:	89 fa                	mov    %edi,%edx
+80102f8a:	89 45 b8             	mov    %eax,-0x48(%ebp)
+80102f8d:	0f b6 45 b6          	movzbl -0x4a(%ebp),%eax
+80102f91:	89 75 c8             	mov    %esi,-0x38(%ebp)
+80102f94:	89 45 bc             	mov    %eax,-0x44(%ebp)
+80102f97:	0f b6 45 b5          	movzbl -0x4b(%ebp),%eax
+80102f9b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+80102f9e:	0f b6 45 b4          	movzbl -0x4c(%ebp),%eax
+80102fa2:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+80102fa5:	31 c0                	xor    %eax,%eax
+80102fa7:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102fa8:	89 ca                	mov    %ecx,%edx
+80102faa:	ec                   	in     (%dx),%al
+80102fab:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102fae:	89 fa                	mov    %edi,%edx
+80102fb0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80102fb3:	b8 02 00 00 00       	mov    $0x2,%eax
+80102fb8:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102fb9:	89 ca                	mov    %ecx,%edx
+80102fbb:	ec                   	in     (%dx),%al
+80102fbc:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102fbf:	89 fa                	mov    %edi,%edx
+80102fc1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80102fc4:	b8 04 00 00 00       	mov    $0x4,%eax
+80102fc9:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102fca:	89 ca                	mov    %ecx,%edx
+80102fcc:	ec                   	in     (%dx),%al
+80102fcd:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102fd0:	89 fa                	mov    %edi,%edx
+80102fd2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80102fd5:	b8 07 00 00 00       	mov    $0x7,%eax
+80102fda:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102fdb:	89 ca                	mov    %ecx,%edx
+80102fdd:	ec                   	in     (%dx),%al
+80102fde:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102fe1:	89 fa                	mov    %edi,%edx
+80102fe3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80102fe6:	b8 08 00 00 00       	mov    $0x8,%eax
+80102feb:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102fec:	89 ca                	mov    %ecx,%edx
+80102fee:	ec                   	in     (%dx),%al
+80102fef:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102ff2:	89 fa                	mov    %edi,%edx
+80102ff4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102ff7:	b8 09 00 00 00       	mov    $0x9,%eax
+80102ffc:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102ffd:	89 ca                	mov    %ecx,%edx
+80102fff:	ec                   	in     (%dx),%al
+80103000:	0f b6 c0             	movzbl %al,%eax
+        continue;
+    fill_rtcdate(&t2);
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80103003:	83 ec 04             	sub    $0x4,%esp
+  return inb(CMOS_RETURN);
+80103006:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80103009:	8d 45 d0             	lea    -0x30(%ebp),%eax
+8010300c:	6a 18                	push   $0x18
+8010300e:	50                   	push   %eax
+8010300f:	8d 45 b8             	lea    -0x48(%ebp),%eax
+80103012:	50                   	push   %eax
+80103013:	e8 d8 4f 00 00       	call   80107ff0 <memcmp>
+80103018:	83 c4 10             	add    $0x10,%esp
+8010301b:	85 c0                	test   %eax,%eax
+8010301d:	0f 85 f5 fe ff ff    	jne    80102f18 <cmostime+0x28>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+80103023:	0f b6 75 b3          	movzbl -0x4d(%ebp),%esi
+80103027:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010302a:	89 f0                	mov    %esi,%eax
+8010302c:	84 c0                	test   %al,%al
+8010302e:	75 78                	jne    801030a8 <cmostime+0x1b8>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+80103030:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80103033:	89 c2                	mov    %eax,%edx
+80103035:	83 e0 0f             	and    $0xf,%eax
+80103038:	c1 ea 04             	shr    $0x4,%edx
+8010303b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010303e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103041:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    CONV(minute);
+80103044:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80103047:	89 c2                	mov    %eax,%edx
+80103049:	83 e0 0f             	and    $0xf,%eax
+8010304c:	c1 ea 04             	shr    $0x4,%edx
+8010304f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103052:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103055:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    CONV(hour  );
+80103058:	8b 45 c0             	mov    -0x40(%ebp),%eax
+8010305b:	89 c2                	mov    %eax,%edx
+8010305d:	83 e0 0f             	and    $0xf,%eax
+80103060:	c1 ea 04             	shr    $0x4,%edx
+80103063:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103066:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103069:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    CONV(day   );
+8010306c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+8010306f:	89 c2                	mov    %eax,%edx
+80103071:	83 e0 0f             	and    $0xf,%eax
+80103074:	c1 ea 04             	shr    $0x4,%edx
+80103077:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010307a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+8010307d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    CONV(month );
+80103080:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80103083:	89 c2                	mov    %eax,%edx
+80103085:	83 e0 0f             	and    $0xf,%eax
+80103088:	c1 ea 04             	shr    $0x4,%edx
+8010308b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010308e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103091:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    CONV(year  );
+80103094:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80103097:	89 c2                	mov    %eax,%edx
+80103099:	83 e0 0f             	and    $0xf,%eax
+8010309c:	c1 ea 04             	shr    $0x4,%edx
+8010309f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801030a2:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801030a5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+801030a8:	8b 45 b8             	mov    -0x48(%ebp),%eax
+801030ab:	89 03                	mov    %eax,(%ebx)
+801030ad:	8b 45 bc             	mov    -0x44(%ebp),%eax
+801030b0:	89 43 04             	mov    %eax,0x4(%ebx)
+801030b3:	8b 45 c0             	mov    -0x40(%ebp),%eax
+801030b6:	89 43 08             	mov    %eax,0x8(%ebx)
+801030b9:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+801030bc:	89 43 0c             	mov    %eax,0xc(%ebx)
+801030bf:	8b 45 c8             	mov    -0x38(%ebp),%eax
+801030c2:	89 43 10             	mov    %eax,0x10(%ebx)
+801030c5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+801030c8:	89 43 14             	mov    %eax,0x14(%ebx)
+  r->year += 2000;
+801030cb:	81 43 14 d0 07 00 00 	addl   $0x7d0,0x14(%ebx)
+}
+801030d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801030d5:	5b                   	pop    %ebx
+801030d6:	5e                   	pop    %esi
+801030d7:	5f                   	pop    %edi
+801030d8:	5d                   	pop    %ebp
+801030d9:	c3                   	ret
+801030da:	66 90                	xchg   %ax,%ax
+801030dc:	66 90                	xchg   %ax,%ax
+801030de:	66 90                	xchg   %ax,%ax
+
+801030e0 <install_trans>:
+static void
+install_trans(void)
+{
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+801030e0:	8b 0d 28 67 11 80    	mov    0x80116728,%ecx
+801030e6:	85 c9                	test   %ecx,%ecx
+801030e8:	0f 8e 8a 00 00 00    	jle    80103178 <install_trans+0x98>
+{
+801030ee:	55                   	push   %ebp
+801030ef:	89 e5                	mov    %esp,%ebp
+801030f1:	57                   	push   %edi
+  for (tail = 0; tail < log.lh.n; tail++) {
+801030f2:	31 ff                	xor    %edi,%edi
+{
+801030f4:	56                   	push   %esi
+801030f5:	53                   	push   %ebx
+801030f6:	83 ec 0c             	sub    $0xc,%esp
+801030f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+80103100:	a1 14 67 11 80       	mov    0x80116714,%eax
+80103105:	83 ec 08             	sub    $0x8,%esp
+80103108:	01 f8                	add    %edi,%eax
+8010310a:	83 c0 01             	add    $0x1,%eax
+8010310d:	50                   	push   %eax
+8010310e:	ff 35 24 67 11 80    	push   0x80116724
+80103114:	e8 b7 cf ff ff       	call   801000d0 <bread>
+80103119:	89 c6                	mov    %eax,%esi
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+8010311b:	58                   	pop    %eax
+8010311c:	5a                   	pop    %edx
+8010311d:	ff 34 bd 2c 67 11 80 	push   -0x7fee98d4(,%edi,4)
+80103124:	ff 35 24 67 11 80    	push   0x80116724
+  for (tail = 0; tail < log.lh.n; tail++) {
+8010312a:	83 c7 01             	add    $0x1,%edi
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+8010312d:	e8 9e cf ff ff       	call   801000d0 <bread>
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+80103132:	83 c4 0c             	add    $0xc,%esp
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+80103135:	89 c3                	mov    %eax,%ebx
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+80103137:	8d 46 5c             	lea    0x5c(%esi),%eax
+8010313a:	68 00 02 00 00       	push   $0x200
+8010313f:	50                   	push   %eax
+80103140:	8d 43 5c             	lea    0x5c(%ebx),%eax
+80103143:	50                   	push   %eax
+80103144:	e8 f7 4e 00 00       	call   80108040 <memmove>
+    bwrite(dbuf);  // write dst to disk
+80103149:	89 1c 24             	mov    %ebx,(%esp)
+8010314c:	e8 5f d0 ff ff       	call   801001b0 <bwrite>
+    brelse(lbuf);
+80103151:	89 34 24             	mov    %esi,(%esp)
+80103154:	e8 97 d0 ff ff       	call   801001f0 <brelse>
+    brelse(dbuf);
+80103159:	89 1c 24             	mov    %ebx,(%esp)
+8010315c:	e8 8f d0 ff ff       	call   801001f0 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+80103161:	83 c4 10             	add    $0x10,%esp
+80103164:	39 3d 28 67 11 80    	cmp    %edi,0x80116728
+8010316a:	7f 94                	jg     80103100 <install_trans+0x20>
+  }
+}
+8010316c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010316f:	5b                   	pop    %ebx
+80103170:	5e                   	pop    %esi
+80103171:	5f                   	pop    %edi
+80103172:	5d                   	pop    %ebp
+80103173:	c3                   	ret
+80103174:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103178:	c3                   	ret
+80103179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80103180 <write_head>:
+// Write in-memory log header to disk.
+// This is the true point at which the
+// current transaction commits.
+static void
+write_head(void)
+{
+80103180:	55                   	push   %ebp
+80103181:	89 e5                	mov    %esp,%ebp
+80103183:	53                   	push   %ebx
+80103184:	83 ec 0c             	sub    $0xc,%esp
+  struct buf *buf = bread(log.dev, log.start);
+80103187:	ff 35 14 67 11 80    	push   0x80116714
+8010318d:	ff 35 24 67 11 80    	push   0x80116724
+80103193:	e8 38 cf ff ff       	call   801000d0 <bread>
+  struct logheader *hb = (struct logheader *) (buf->data);
+  int i;
+  hb->n = log.lh.n;
+  for (i = 0; i < log.lh.n; i++) {
+80103198:	83 c4 10             	add    $0x10,%esp
+  struct buf *buf = bread(log.dev, log.start);
+8010319b:	89 c3                	mov    %eax,%ebx
+  hb->n = log.lh.n;
+8010319d:	a1 28 67 11 80       	mov    0x80116728,%eax
+801031a2:	89 43 5c             	mov    %eax,0x5c(%ebx)
+  for (i = 0; i < log.lh.n; i++) {
+801031a5:	85 c0                	test   %eax,%eax
+801031a7:	7e 19                	jle    801031c2 <write_head+0x42>
+801031a9:	31 d2                	xor    %edx,%edx
+801031ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801031af:	90                   	nop
+    hb->block[i] = log.lh.block[i];
+801031b0:	8b 0c 95 2c 67 11 80 	mov    -0x7fee98d4(,%edx,4),%ecx
+801031b7:	89 4c 93 60          	mov    %ecx,0x60(%ebx,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+801031bb:	83 c2 01             	add    $0x1,%edx
+801031be:	39 d0                	cmp    %edx,%eax
+801031c0:	75 ee                	jne    801031b0 <write_head+0x30>
+  }
+  bwrite(buf);
+801031c2:	83 ec 0c             	sub    $0xc,%esp
+801031c5:	53                   	push   %ebx
+801031c6:	e8 e5 cf ff ff       	call   801001b0 <bwrite>
+  brelse(buf);
+801031cb:	89 1c 24             	mov    %ebx,(%esp)
+801031ce:	e8 1d d0 ff ff       	call   801001f0 <brelse>
+}
+801031d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801031d6:	83 c4 10             	add    $0x10,%esp
+801031d9:	c9                   	leave
+801031da:	c3                   	ret
+801031db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801031df:	90                   	nop
+
+801031e0 <initlog>:
+{
+801031e0:	55                   	push   %ebp
+801031e1:	89 e5                	mov    %esp,%ebp
+801031e3:	53                   	push   %ebx
+801031e4:	83 ec 2c             	sub    $0x2c,%esp
+801031e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+801031ea:	68 e0 be 10 80       	push   $0x8010bee0
+801031ef:	68 e0 66 11 80       	push   $0x801166e0
+801031f4:	e8 f7 4a 00 00       	call   80107cf0 <initlock>
+  readsb(dev, &sb);
+801031f9:	58                   	pop    %eax
+801031fa:	8d 45 dc             	lea    -0x24(%ebp),%eax
+801031fd:	5a                   	pop    %edx
+801031fe:	50                   	push   %eax
+801031ff:	53                   	push   %ebx
+80103200:	e8 bb e7 ff ff       	call   801019c0 <readsb>
+  log.size = sb.nlog;
+80103205:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  log.start = sb.logstart;
+80103208:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  log.dev = dev;
+8010320b:	89 1d 24 67 11 80    	mov    %ebx,0x80116724
+  log.start = sb.logstart;
+80103211:	a3 14 67 11 80       	mov    %eax,0x80116714
+  log.size = sb.nlog;
+80103216:	89 15 18 67 11 80    	mov    %edx,0x80116718
+  struct buf *buf = bread(log.dev, log.start);
+8010321c:	59                   	pop    %ecx
+8010321d:	5a                   	pop    %edx
+8010321e:	50                   	push   %eax
+8010321f:	53                   	push   %ebx
+80103220:	e8 ab ce ff ff       	call   801000d0 <bread>
+  for (i = 0; i < log.lh.n; i++) {
+80103225:	83 c4 10             	add    $0x10,%esp
+  log.lh.n = lh->n;
+80103228:	8b 58 5c             	mov    0x5c(%eax),%ebx
+8010322b:	89 1d 28 67 11 80    	mov    %ebx,0x80116728
+  for (i = 0; i < log.lh.n; i++) {
+80103231:	85 db                	test   %ebx,%ebx
+80103233:	7e 1d                	jle    80103252 <initlog+0x72>
+80103235:	31 d2                	xor    %edx,%edx
+80103237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010323e:	66 90                	xchg   %ax,%ax
+    log.lh.block[i] = lh->block[i];
+80103240:	8b 4c 90 60          	mov    0x60(%eax,%edx,4),%ecx
+80103244:	89 0c 95 2c 67 11 80 	mov    %ecx,-0x7fee98d4(,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+8010324b:	83 c2 01             	add    $0x1,%edx
+8010324e:	39 d3                	cmp    %edx,%ebx
+80103250:	75 ee                	jne    80103240 <initlog+0x60>
+  brelse(buf);
+80103252:	83 ec 0c             	sub    $0xc,%esp
+80103255:	50                   	push   %eax
+80103256:	e8 95 cf ff ff       	call   801001f0 <brelse>
+
+static void
+recover_from_log(void)
+{
+  read_head();
+  install_trans(); // if committed, copy from log to disk
+8010325b:	e8 80 fe ff ff       	call   801030e0 <install_trans>
+  log.lh.n = 0;
+80103260:	c7 05 28 67 11 80 00 	movl   $0x0,0x80116728
+80103267:	00 00 00 
+  write_head(); // clear the log
+8010326a:	e8 11 ff ff ff       	call   80103180 <write_head>
+}
+8010326f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103272:	83 c4 10             	add    $0x10,%esp
+80103275:	c9                   	leave
+80103276:	c3                   	ret
+80103277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010327e:	66 90                	xchg   %ax,%ax
+
+80103280 <begin_op>:
+}
+
+// called at the start of each FS system call.
+void
+begin_op(void)
+{
+80103280:	55                   	push   %ebp
+80103281:	89 e5                	mov    %esp,%ebp
+80103283:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80103286:	68 e0 66 11 80       	push   $0x801166e0
+8010328b:	e8 40 4c 00 00       	call   80107ed0 <acquire>
+80103290:	83 c4 10             	add    $0x10,%esp
+80103293:	eb 18                	jmp    801032ad <begin_op+0x2d>
+80103295:	8d 76 00             	lea    0x0(%esi),%esi
+  while(1){
+    if(log.committing){
+      sleep(&log, &log.lock);
+80103298:	83 ec 08             	sub    $0x8,%esp
+8010329b:	68 e0 66 11 80       	push   $0x801166e0
+801032a0:	68 e0 66 11 80       	push   $0x801166e0
+801032a5:	e8 96 34 00 00       	call   80106740 <sleep>
+801032aa:	83 c4 10             	add    $0x10,%esp
+    if(log.committing){
+801032ad:	a1 20 67 11 80       	mov    0x80116720,%eax
+801032b2:	85 c0                	test   %eax,%eax
+801032b4:	75 e2                	jne    80103298 <begin_op+0x18>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+801032b6:	a1 1c 67 11 80       	mov    0x8011671c,%eax
+801032bb:	8b 15 28 67 11 80    	mov    0x80116728,%edx
+801032c1:	83 c0 01             	add    $0x1,%eax
+801032c4:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+801032c7:	8d 14 4a             	lea    (%edx,%ecx,2),%edx
+801032ca:	83 fa 1e             	cmp    $0x1e,%edx
+801032cd:	7f c9                	jg     80103298 <begin_op+0x18>
+      // this op might exhaust log space; wait for commit.
+      sleep(&log, &log.lock);
+    } else {
+      log.outstanding += 1;
+      release(&log.lock);
+801032cf:	83 ec 0c             	sub    $0xc,%esp
+      log.outstanding += 1;
+801032d2:	a3 1c 67 11 80       	mov    %eax,0x8011671c
+      release(&log.lock);
+801032d7:	68 e0 66 11 80       	push   $0x801166e0
+801032dc:	e8 8f 4b 00 00       	call   80107e70 <release>
+      break;
+    }
+  }
+}
+801032e1:	83 c4 10             	add    $0x10,%esp
+801032e4:	c9                   	leave
+801032e5:	c3                   	ret
+801032e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801032ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801032f0 <end_op>:
+
+// called at the end of each FS system call.
+// commits if this was the last outstanding operation.
+void
+end_op(void)
+{
+801032f0:	55                   	push   %ebp
+801032f1:	89 e5                	mov    %esp,%ebp
+801032f3:	57                   	push   %edi
+801032f4:	56                   	push   %esi
+801032f5:	53                   	push   %ebx
+801032f6:	83 ec 18             	sub    $0x18,%esp
+  int do_commit = 0;
+
+  acquire(&log.lock);
+801032f9:	68 e0 66 11 80       	push   $0x801166e0
+801032fe:	e8 cd 4b 00 00       	call   80107ed0 <acquire>
+  log.outstanding -= 1;
+80103303:	a1 1c 67 11 80       	mov    0x8011671c,%eax
+  if(log.committing)
+80103308:	8b 35 20 67 11 80    	mov    0x80116720,%esi
+8010330e:	83 c4 10             	add    $0x10,%esp
+  log.outstanding -= 1;
+80103311:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80103314:	89 1d 1c 67 11 80    	mov    %ebx,0x8011671c
+  if(log.committing)
+8010331a:	85 f6                	test   %esi,%esi
+8010331c:	0f 85 22 01 00 00    	jne    80103444 <end_op+0x154>
+    panic("log.committing");
+  if(log.outstanding == 0){
+80103322:	85 db                	test   %ebx,%ebx
+80103324:	0f 85 f6 00 00 00    	jne    80103420 <end_op+0x130>
+    do_commit = 1;
+    log.committing = 1;
+8010332a:	c7 05 20 67 11 80 01 	movl   $0x1,0x80116720
+80103331:	00 00 00 
+    // begin_op() may be waiting for log space,
+    // and decrementing log.outstanding has decreased
+    // the amount of reserved space.
+    wakeup(&log);
+  }
+  release(&log.lock);
+80103334:	83 ec 0c             	sub    $0xc,%esp
+80103337:	68 e0 66 11 80       	push   $0x801166e0
+8010333c:	e8 2f 4b 00 00       	call   80107e70 <release>
+}
+
+static void
+commit()
+{
+  if (log.lh.n > 0) {
+80103341:	8b 0d 28 67 11 80    	mov    0x80116728,%ecx
+80103347:	83 c4 10             	add    $0x10,%esp
+8010334a:	85 c9                	test   %ecx,%ecx
+8010334c:	7f 42                	jg     80103390 <end_op+0xa0>
+    acquire(&log.lock);
+8010334e:	83 ec 0c             	sub    $0xc,%esp
+80103351:	68 e0 66 11 80       	push   $0x801166e0
+80103356:	e8 75 4b 00 00       	call   80107ed0 <acquire>
+    log.committing = 0;
+8010335b:	c7 05 20 67 11 80 00 	movl   $0x0,0x80116720
+80103362:	00 00 00 
+    wakeup(&log);
+80103365:	c7 04 24 e0 66 11 80 	movl   $0x801166e0,(%esp)
+8010336c:	e8 9f 34 00 00       	call   80106810 <wakeup>
+    release(&log.lock);
+80103371:	c7 04 24 e0 66 11 80 	movl   $0x801166e0,(%esp)
+80103378:	e8 f3 4a 00 00       	call   80107e70 <release>
+8010337d:	83 c4 10             	add    $0x10,%esp
+}
+80103380:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103383:	5b                   	pop    %ebx
+80103384:	5e                   	pop    %esi
+80103385:	5f                   	pop    %edi
+80103386:	5d                   	pop    %ebp
+80103387:	c3                   	ret
+80103388:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010338f:	90                   	nop
+    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+80103390:	a1 14 67 11 80       	mov    0x80116714,%eax
+80103395:	83 ec 08             	sub    $0x8,%esp
+80103398:	01 d8                	add    %ebx,%eax
+8010339a:	83 c0 01             	add    $0x1,%eax
+8010339d:	50                   	push   %eax
+8010339e:	ff 35 24 67 11 80    	push   0x80116724
+801033a4:	e8 27 cd ff ff       	call   801000d0 <bread>
+801033a9:	89 c6                	mov    %eax,%esi
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+801033ab:	58                   	pop    %eax
+801033ac:	5a                   	pop    %edx
+801033ad:	ff 34 9d 2c 67 11 80 	push   -0x7fee98d4(,%ebx,4)
+801033b4:	ff 35 24 67 11 80    	push   0x80116724
+  for (tail = 0; tail < log.lh.n; tail++) {
+801033ba:	83 c3 01             	add    $0x1,%ebx
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+801033bd:	e8 0e cd ff ff       	call   801000d0 <bread>
+    memmove(to->data, from->data, BSIZE);
+801033c2:	83 c4 0c             	add    $0xc,%esp
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+801033c5:	89 c7                	mov    %eax,%edi
+    memmove(to->data, from->data, BSIZE);
+801033c7:	8d 40 5c             	lea    0x5c(%eax),%eax
+801033ca:	68 00 02 00 00       	push   $0x200
+801033cf:	50                   	push   %eax
+801033d0:	8d 46 5c             	lea    0x5c(%esi),%eax
+801033d3:	50                   	push   %eax
+801033d4:	e8 67 4c 00 00       	call   80108040 <memmove>
+    bwrite(to);  // write the log
+801033d9:	89 34 24             	mov    %esi,(%esp)
+801033dc:	e8 cf cd ff ff       	call   801001b0 <bwrite>
+    brelse(from);
+801033e1:	89 3c 24             	mov    %edi,(%esp)
+801033e4:	e8 07 ce ff ff       	call   801001f0 <brelse>
+    brelse(to);
+801033e9:	89 34 24             	mov    %esi,(%esp)
+801033ec:	e8 ff cd ff ff       	call   801001f0 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+801033f1:	83 c4 10             	add    $0x10,%esp
+801033f4:	3b 1d 28 67 11 80    	cmp    0x80116728,%ebx
+801033fa:	7c 94                	jl     80103390 <end_op+0xa0>
+    write_log();     // Write modified blocks from cache to log
+    write_head();    // Write header to disk -- the real commit
+801033fc:	e8 7f fd ff ff       	call   80103180 <write_head>
+    install_trans(); // Now install writes to home locations
+80103401:	e8 da fc ff ff       	call   801030e0 <install_trans>
+    log.lh.n = 0;
+80103406:	c7 05 28 67 11 80 00 	movl   $0x0,0x80116728
+8010340d:	00 00 00 
+    write_head();    // Erase the transaction from the log
+80103410:	e8 6b fd ff ff       	call   80103180 <write_head>
+80103415:	e9 34 ff ff ff       	jmp    8010334e <end_op+0x5e>
+8010341a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wakeup(&log);
+80103420:	83 ec 0c             	sub    $0xc,%esp
+80103423:	68 e0 66 11 80       	push   $0x801166e0
+80103428:	e8 e3 33 00 00       	call   80106810 <wakeup>
+  release(&log.lock);
+8010342d:	c7 04 24 e0 66 11 80 	movl   $0x801166e0,(%esp)
+80103434:	e8 37 4a 00 00       	call   80107e70 <release>
+80103439:	83 c4 10             	add    $0x10,%esp
+}
+8010343c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010343f:	5b                   	pop    %ebx
+80103440:	5e                   	pop    %esi
+80103441:	5f                   	pop    %edi
+80103442:	5d                   	pop    %ebp
+80103443:	c3                   	ret
+    panic("log.committing");
+80103444:	83 ec 0c             	sub    $0xc,%esp
+80103447:	68 e4 be 10 80       	push   $0x8010bee4
+8010344c:	e8 2f cf ff ff       	call   80100380 <panic>
+80103451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010345f:	90                   	nop
+
+80103460 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80103460:	55                   	push   %ebp
+80103461:	89 e5                	mov    %esp,%ebp
+80103463:	53                   	push   %ebx
+80103464:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80103467:	8b 15 28 67 11 80    	mov    0x80116728,%edx
+{
+8010346d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80103470:	83 fa 1d             	cmp    $0x1d,%edx
+80103473:	7f 7d                	jg     801034f2 <log_write+0x92>
+80103475:	a1 18 67 11 80       	mov    0x80116718,%eax
+8010347a:	83 e8 01             	sub    $0x1,%eax
+8010347d:	39 c2                	cmp    %eax,%edx
+8010347f:	7d 71                	jge    801034f2 <log_write+0x92>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80103481:	a1 1c 67 11 80       	mov    0x8011671c,%eax
+80103486:	85 c0                	test   %eax,%eax
+80103488:	7e 75                	jle    801034ff <log_write+0x9f>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+8010348a:	83 ec 0c             	sub    $0xc,%esp
+8010348d:	68 e0 66 11 80       	push   $0x801166e0
+80103492:	e8 39 4a 00 00       	call   80107ed0 <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80103497:	8b 4b 08             	mov    0x8(%ebx),%ecx
+  for (i = 0; i < log.lh.n; i++) {
+8010349a:	83 c4 10             	add    $0x10,%esp
+8010349d:	31 c0                	xor    %eax,%eax
+8010349f:	8b 15 28 67 11 80    	mov    0x80116728,%edx
+801034a5:	85 d2                	test   %edx,%edx
+801034a7:	7f 0e                	jg     801034b7 <log_write+0x57>
+801034a9:	eb 15                	jmp    801034c0 <log_write+0x60>
+801034ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801034af:	90                   	nop
+801034b0:	83 c0 01             	add    $0x1,%eax
+801034b3:	39 c2                	cmp    %eax,%edx
+801034b5:	74 29                	je     801034e0 <log_write+0x80>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+801034b7:	39 0c 85 2c 67 11 80 	cmp    %ecx,-0x7fee98d4(,%eax,4)
+801034be:	75 f0                	jne    801034b0 <log_write+0x50>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+801034c0:	89 0c 85 2c 67 11 80 	mov    %ecx,-0x7fee98d4(,%eax,4)
+  if (i == log.lh.n)
+801034c7:	39 c2                	cmp    %eax,%edx
+801034c9:	74 1c                	je     801034e7 <log_write+0x87>
+    log.lh.n++;
+  b->flags |= B_DIRTY; // prevent eviction
+801034cb:	83 0b 04             	orl    $0x4,(%ebx)
+  release(&log.lock);
+}
+801034ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&log.lock);
+801034d1:	c7 45 08 e0 66 11 80 	movl   $0x801166e0,0x8(%ebp)
+}
+801034d8:	c9                   	leave
+  release(&log.lock);
+801034d9:	e9 92 49 00 00       	jmp    80107e70 <release>
+801034de:	66 90                	xchg   %ax,%ax
+  log.lh.block[i] = b->blockno;
+801034e0:	89 0c 95 2c 67 11 80 	mov    %ecx,-0x7fee98d4(,%edx,4)
+    log.lh.n++;
+801034e7:	83 c2 01             	add    $0x1,%edx
+801034ea:	89 15 28 67 11 80    	mov    %edx,0x80116728
+801034f0:	eb d9                	jmp    801034cb <log_write+0x6b>
+    panic("too big a transaction");
+801034f2:	83 ec 0c             	sub    $0xc,%esp
+801034f5:	68 f3 be 10 80       	push   $0x8010bef3
+801034fa:	e8 81 ce ff ff       	call   80100380 <panic>
+    panic("log_write outside of trans");
+801034ff:	83 ec 0c             	sub    $0xc,%esp
+80103502:	68 09 bf 10 80       	push   $0x8010bf09
+80103507:	e8 74 ce ff ff       	call   80100380 <panic>
+8010350c:	66 90                	xchg   %ax,%ax
+8010350e:	66 90                	xchg   %ax,%ax
+
+80103510 <mpmain>:
+}
+
+// Common CPU setup code.
+static void
+mpmain(void)
+{
+80103510:	55                   	push   %ebp
+80103511:	89 e5                	mov    %esp,%ebp
+80103513:	53                   	push   %ebx
+80103514:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+80103517:	e8 94 19 00 00       	call   80104eb0 <cpuid>
+8010351c:	89 c3                	mov    %eax,%ebx
+8010351e:	e8 8d 19 00 00       	call   80104eb0 <cpuid>
+80103523:	83 ec 04             	sub    $0x4,%esp
+80103526:	53                   	push   %ebx
+80103527:	50                   	push   %eax
+80103528:	68 24 bf 10 80       	push   $0x8010bf24
+8010352d:	e8 7e d1 ff ff       	call   801006b0 <cprintf>
+  idtinit();       // load idt register
+80103532:	e8 29 64 00 00       	call   80109960 <idtinit>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+80103537:	0f 31                	rdtsc
+80103539:	89 c3                	mov    %eax,%ebx
+  srandcpu(rdtsc() ^ cpuid()); // seed this processor's lottery draws
+8010353b:	e8 70 19 00 00       	call   80104eb0 <cpuid>
+80103540:	31 d8                	xor    %ebx,%eax
+80103542:	89 04 24             	mov    %eax,(%esp)
+80103545:	e8 16 84 00 00       	call   8010b960 <srandcpu>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+8010354a:	e8 01 19 00 00       	call   80104e50 <mycpu>
+8010354f:	89 c2                	mov    %eax,%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+80103551:	b8 01 00 00 00       	mov    $0x1,%eax
+80103556:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+  scheduler();     // start running processes
+8010355d:	e8 7e 28 00 00       	call   80105de0 <scheduler>
+80103562:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80103570 <mpenter>:
+{
+80103570:	55                   	push   %ebp
+80103571:	89 e5                	mov    %esp,%ebp
+80103573:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+80103576:	e8 f5 75 00 00       	call   8010ab70 <switchkvm>
+  seginit();
+8010357b:	e8 60 75 00 00       	call   8010aae0 <seginit>
+  lapicinit();
+80103580:	e8 1b f7 ff ff       	call   80102ca0 <lapicinit>
+  mpmain();
+80103585:	e8 86 ff ff ff       	call   80103510 <mpmain>
+8010358a:	66 90                	xchg   %ax,%ax
+8010358c:	66 90                	xchg   %ax,%ax
+8010358e:	66 90                	xchg   %ax,%ax
+
+80103590 <main>:
+{
+80103590:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+80103594:	83 e4 f0             	and    $0xfffffff0,%esp
+80103597:	ff 71 fc             	push   -0x4(%ecx)
+8010359a:	55                   	push   %ebp
+8010359b:	89 e5                	mov    %esp,%ebp
+8010359d:	53                   	push   %ebx
+8010359e:	51                   	push   %ecx
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+8010359f:	83 ec 08             	sub    $0x8,%esp
+801035a2:	68 00 00 40 80       	push   $0x80400000
+801035a7:	68 a0 b4 13 80       	push   $0x8013b4a0
+801035ac:	e8 ff f4 ff ff       	call   80102ab0 <kinit1>
+  kvmalloc();      // kernel page table
+801035b1:	e8 ba 7c 00 00       	call   8010b270 <kvmalloc>
+  mpinit();        // detect other processors
+801035b6:	e8 85 01 00 00       	call   80103740 <mpinit>
+  lapicinit();     // interrupt controller
+801035bb:	e8 e0 f6 ff ff       	call   80102ca0 <lapicinit>
+  seginit();       // segment descriptors
+801035c0:	e8 1b 75 00 00       	call   8010aae0 <seginit>
+  picinit();       // disable pic
+801035c5:	e8 86 03 00 00       	call   80103950 <picinit>
+  ioapicinit();    // another interrupt controller
+801035ca:	e8 b1 f2 ff ff       	call   80102880 <ioapicinit>
+  consoleinit();   // console hardware
+801035cf:	e8 bc d4 ff ff       	call   80100a90 <consoleinit>
+  uartinit();      // serial port
+801035d4:	e8 77 67 00 00       	call   80109d50 <uartinit>
+  pinit();         // process table
+801035d9:	e8 02 18 00 00       	call   80104de0 <pinit>
+  mminit();        // address spaces
+801035de:	e8 ad 7c 00 00       	call   8010b290 <mminit>
+  tvinit();        // trap vectors
+801035e3:	e8 f8 62 00 00       	call   801098e0 <tvinit>
+  binit();         // buffer cache
+801035e8:	e8 53 ca ff ff       	call   80100040 <binit>
+  fileinit();      // file table
+801035ed:	e8 7e d8 ff ff       	call   80100e70 <fileinit>
+  ideinit();       // disk 
+801035f2:	e8 69 f0 ff ff       	call   80102660 <ideinit>
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+801035f7:	83 c4 0c             	add    $0xc,%esp
+801035fa:	68 8a 00 00 00       	push   $0x8a
+801035ff:	68 8c f4 10 80       	push   $0x8010f48c
+80103604:	68 00 70 00 80       	push   $0x80007000
+80103609:	e8 32 4a 00 00       	call   80108040 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+8010360e:	83 c4 10             	add    $0x10,%esp
+80103611:	69 05 c4 67 11 80 d0 	imul   $0xd0,0x801167c4,%eax
+80103618:	00 00 00 
+8010361b:	05 e0 67 11 80       	add    $0x801167e0,%eax
+80103620:	3d e0 67 11 80       	cmp    $0x801167e0,%eax
+80103625:	76 79                	jbe    801036a0 <main+0x110>
+80103627:	bb e0 67 11 80       	mov    $0x801167e0,%ebx
+8010362c:	eb 1b                	jmp    80103649 <main+0xb9>
+8010362e:	66 90                	xchg   %ax,%ax
+80103630:	69 05 c4 67 11 80 d0 	imul   $0xd0,0x801167c4,%eax
+80103637:	00 00 00 
+8010363a:	81 c3 d0 00 00 00    	add    $0xd0,%ebx
+80103640:	05 e0 67 11 80       	add    $0x801167e0,%eax
+80103645:	39 c3                	cmp    %eax,%ebx
+80103647:	73 57                	jae    801036a0 <main+0x110>
+    if(c == mycpu())  // We've started already.
+80103649:	e8 02 18 00 00       	call   80104e50 <mycpu>
+8010364e:	39 c3                	cmp    %eax,%ebx
+80103650:	74 de                	je     80103630 <main+0xa0>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+80103652:	e8 c9 f4 ff ff       	call   80102b20 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+    *(void(**)(void))(code-8) = mpenter;
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+
+    lapicstartap(c->apicid, V2P(code));
+80103657:	83 ec 08             	sub    $0x8,%esp
+    *(void(**)(void))(code-8) = mpenter;
+8010365a:	c7 05 f8 6f 00 80 70 	movl   $0x80103570,0x80006ff8
+80103661:	35 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+80103664:	c7 05 f4 6f 00 80 00 	movl   $0x10e000,0x80006ff4
+8010366b:	e0 10 00 
+    *(void**)(code-4) = stack + KSTACKSIZE;
+8010366e:	05 00 10 00 00       	add    $0x1000,%eax
+80103673:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    lapicstartap(c->apicid, V2P(code));
+80103678:	0f b6 03             	movzbl (%ebx),%eax
+8010367b:	68 00 70 00 00       	push   $0x7000
+80103680:	50                   	push   %eax
+80103681:	e8 da f7 ff ff       	call   80102e60 <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+80103686:	83 c4 10             	add    $0x10,%esp
+80103689:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103690:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80103696:	85 c0                	test   %eax,%eax
+80103698:	74 f6                	je     80103690 <main+0x100>
+8010369a:	eb 94                	jmp    80103630 <main+0xa0>
+8010369c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+801036a0:	83 ec 08             	sub    $0x8,%esp
+801036a3:	68 00 00 00 8e       	push   $0x8e000000
+801036a8:	68 00 00 40 80       	push   $0x80400000
+801036ad:	e8 9e f3 ff ff       	call   80102a50 <kinit2>
+  userinit();      // first user process
+801036b2:	e8 79 23 00 00       	call   80105a30 <userinit>
+  mpmain();        // finish this processor's setup
+801036b7:	e8 54 fe ff ff       	call   80103510 <mpmain>
+801036bc:	66 90                	xchg   %ax,%ax
+801036be:	66 90                	xchg   %ax,%ax
+
+801036c0 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+801036c0:	55                   	push   %ebp
+801036c1:	89 e5                	mov    %esp,%ebp
+801036c3:	57                   	push   %edi
+801036c4:	56                   	push   %esi
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+801036c5:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+{
+801036cb:	53                   	push   %ebx
+  e = addr+len;
+801036cc:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+{
+801036cf:	83 ec 0c             	sub    $0xc,%esp
+  for(p = addr; p < e; p += sizeof(struct mp))
+801036d2:	39 de                	cmp    %ebx,%esi
+801036d4:	72 10                	jb     801036e6 <mpsearch1+0x26>
+801036d6:	eb 50                	jmp    80103728 <mpsearch1+0x68>
+801036d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801036df:	90                   	nop
+801036e0:	89 fe                	mov    %edi,%esi
+801036e2:	39 df                	cmp    %ebx,%edi
+801036e4:	73 42                	jae    80103728 <mpsearch1+0x68>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801036e6:	83 ec 04             	sub    $0x4,%esp
+801036e9:	8d 7e 10             	lea    0x10(%esi),%edi
+801036ec:	6a 04                	push   $0x4
+801036ee:	68 38 bf 10 80       	push   $0x8010bf38
+801036f3:	56                   	push   %esi
+801036f4:	e8 f7 48 00 00       	call   80107ff0 <memcmp>
+801036f9:	83 c4 10             	add    $0x10,%esp
+801036fc:	85 c0                	test   %eax,%eax
+801036fe:	75 e0                	jne    801036e0 <mpsearch1+0x20>
+80103700:	89 f2                	mov    %esi,%edx
+80103702:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sum += addr[i];
+80103708:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+8010370b:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+8010370e:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80103710:	39 fa                	cmp    %edi,%edx
+80103712:	75 f4                	jne    80103708 <mpsearch1+0x48>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80103714:	84 c0                	test   %al,%al
+80103716:	75 c8                	jne    801036e0 <mpsearch1+0x20>
+      return (struct mp*)p;
+  return 0;
+}
+80103718:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010371b:	89 f0                	mov    %esi,%eax
+8010371d:	5b                   	pop    %ebx
+8010371e:	5e                   	pop    %esi
+8010371f:	5f                   	pop    %edi
+80103720:	5d                   	pop    %ebp
+80103721:	c3                   	ret
+80103722:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80103728:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010372b:	31 f6                	xor    %esi,%esi
+}
+8010372d:	5b                   	pop    %ebx
+8010372e:	89 f0                	mov    %esi,%eax
+80103730:	5e                   	pop    %esi
+80103731:	5f                   	pop    %edi
+80103732:	5d                   	pop    %ebp
+80103733:	c3                   	ret
+80103734:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010373b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010373f:	90                   	nop
+
+80103740 <mpinit>:
+  return conf;
+}
+
+void
+mpinit(void)
+{
+80103740:	55                   	push   %ebp
+80103741:	89 e5                	mov    %esp,%ebp
+80103743:	57                   	push   %edi
+80103744:	56                   	push   %esi
+80103745:	53                   	push   %ebx
+80103746:	83 ec 1c             	sub    $0x1c,%esp
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+80103749:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80103750:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80103757:	c1 e0 08             	shl    $0x8,%eax
+8010375a:	09 d0                	or     %edx,%eax
+8010375c:	c1 e0 04             	shl    $0x4,%eax
+8010375f:	75 1b                	jne    8010377c <mpinit+0x3c>
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80103761:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80103768:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+8010376f:	c1 e0 08             	shl    $0x8,%eax
+80103772:	09 d0                	or     %edx,%eax
+80103774:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+80103777:	2d 00 04 00 00       	sub    $0x400,%eax
+    if((mp = mpsearch1(p, 1024)))
+8010377c:	ba 00 04 00 00       	mov    $0x400,%edx
+80103781:	e8 3a ff ff ff       	call   801036c0 <mpsearch1>
+80103786:	89 c3                	mov    %eax,%ebx
+80103788:	85 c0                	test   %eax,%eax
+8010378a:	0f 84 50 01 00 00    	je     801038e0 <mpinit+0x1a0>
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+80103790:	8b 73 04             	mov    0x4(%ebx),%esi
+80103793:	85 f6                	test   %esi,%esi
+80103795:	0f 84 35 01 00 00    	je     801038d0 <mpinit+0x190>
+  if(memcmp(conf, "PCMP", 4) != 0)
+8010379b:	83 ec 04             	sub    $0x4,%esp
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+8010379e:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+801037a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(memcmp(conf, "PCMP", 4) != 0)
+801037a7:	6a 04                	push   $0x4
+801037a9:	68 3d bf 10 80       	push   $0x8010bf3d
+801037ae:	50                   	push   %eax
+801037af:	e8 3c 48 00 00       	call   80107ff0 <memcmp>
+801037b4:	83 c4 10             	add    $0x10,%esp
+801037b7:	85 c0                	test   %eax,%eax
+801037b9:	0f 85 11 01 00 00    	jne    801038d0 <mpinit+0x190>
+  if(conf->version != 1 && conf->version != 4)
+801037bf:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+801037c6:	3c 01                	cmp    $0x1,%al
+801037c8:	74 08                	je     801037d2 <mpinit+0x92>
+801037ca:	3c 04                	cmp    $0x4,%al
+801037cc:	0f 85 fe 00 00 00    	jne    801038d0 <mpinit+0x190>
+  if(sum((uchar*)conf, conf->length) != 0)
+801037d2:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+  for(i=0; i<len; i++)
+801037d9:	66 85 d2             	test   %dx,%dx
+801037dc:	74 22                	je     80103800 <mpinit+0xc0>
+801037de:	8d 3c 32             	lea    (%edx,%esi,1),%edi
+801037e1:	89 f0                	mov    %esi,%eax
+  sum = 0;
+801037e3:	31 d2                	xor    %edx,%edx
+801037e5:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+801037e8:	0f b6 88 00 00 00 80 	movzbl -0x80000000(%eax),%ecx
+  for(i=0; i<len; i++)
+801037ef:	83 c0 01             	add    $0x1,%eax
+    sum += addr[i];
+801037f2:	01 ca                	add    %ecx,%edx
+  for(i=0; i<len; i++)
+801037f4:	39 c7                	cmp    %eax,%edi
+801037f6:	75 f0                	jne    801037e8 <mpinit+0xa8>
+  if(sum((uchar*)conf, conf->length) != 0)
+801037f8:	84 d2                	test   %dl,%dl
+801037fa:	0f 85 d0 00 00 00    	jne    801038d0 <mpinit+0x190>
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+80103800:	8b 86 24 00 00 80    	mov    -0x7fffffdc(%esi),%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80103806:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80103809:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  lapic = (uint*)conf->lapicaddr;
+8010380c:	a3 c0 66 11 80       	mov    %eax,0x801166c0
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80103811:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+80103818:	8d 86 2c 00 00 80    	lea    -0x7fffffd4(%esi),%eax
+  ismp = 1;
+8010381e:	be 01 00 00 00       	mov    $0x1,%esi
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80103823:	01 d7                	add    %edx,%edi
+80103825:	89 fa                	mov    %edi,%edx
+80103827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010382e:	66 90                	xchg   %ax,%ax
+80103830:	39 d0                	cmp    %edx,%eax
+80103832:	73 15                	jae    80103849 <mpinit+0x109>
+    switch(*p){
+80103834:	0f b6 08             	movzbl (%eax),%ecx
+80103837:	80 f9 02             	cmp    $0x2,%cl
+8010383a:	74 54                	je     80103890 <mpinit+0x150>
+8010383c:	77 42                	ja     80103880 <mpinit+0x140>
+8010383e:	84 c9                	test   %cl,%cl
+80103840:	74 5e                	je     801038a0 <mpinit+0x160>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+80103842:	83 c0 08             	add    $0x8,%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80103845:	39 d0                	cmp    %edx,%eax
+80103847:	72 eb                	jb     80103834 <mpinit+0xf4>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+80103849:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010384c:	85 f6                	test   %esi,%esi
+8010384e:	0f 84 e1 00 00 00    	je     80103935 <mpinit+0x1f5>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+80103854:	80 7b 0c 00          	cmpb   $0x0,0xc(%ebx)
+80103858:	74 15                	je     8010386f <mpinit+0x12f>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010385a:	b8 70 00 00 00       	mov    $0x70,%eax
+8010385f:	ba 22 00 00 00       	mov    $0x22,%edx
+80103864:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103865:	ba 23 00 00 00       	mov    $0x23,%edx
+8010386a:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+8010386b:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010386e:	ee                   	out    %al,(%dx)
+  }
+}
+8010386f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103872:	5b                   	pop    %ebx
+80103873:	5e                   	pop    %esi
+80103874:	5f                   	pop    %edi
+80103875:	5d                   	pop    %ebp
+80103876:	c3                   	ret
+80103877:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010387e:	66 90                	xchg   %ax,%ax
+    switch(*p){
+80103880:	83 e9 03             	sub    $0x3,%ecx
+80103883:	80 f9 01             	cmp    $0x1,%cl
+80103886:	76 ba                	jbe    80103842 <mpinit+0x102>
+80103888:	31 f6                	xor    %esi,%esi
+8010388a:	eb a4                	jmp    80103830 <mpinit+0xf0>
+8010388c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ioapicid = ioapic->apicno;
+80103890:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+      p += sizeof(struct mpioapic);
+80103894:	83 c0 08             	add    $0x8,%eax
+      ioapicid = ioapic->apicno;
+80103897:	88 0d c0 67 11 80    	mov    %cl,0x801167c0
+      continue;
+8010389d:	eb 91                	jmp    80103830 <mpinit+0xf0>
+8010389f:	90                   	nop
+      if(ncpu < NCPU) {
+801038a0:	8b 0d c4 67 11 80    	mov    0x801167c4,%ecx
+801038a6:	83 f9 07             	cmp    $0x7,%ecx
+801038a9:	7f 19                	jg     801038c4 <mpinit+0x184>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+801038ab:	69 f9 d0 00 00 00    	imul   $0xd0,%ecx,%edi
+801038b1:	0f b6 58 01          	movzbl 0x1(%eax),%ebx
+        ncpu++;
+801038b5:	83 c1 01             	add    $0x1,%ecx
+801038b8:	89 0d c4 67 11 80    	mov    %ecx,0x801167c4
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+801038be:	88 9f e0 67 11 80    	mov    %bl,-0x7fee9820(%edi)
+      p += sizeof(struct mpproc);
+801038c4:	83 c0 14             	add    $0x14,%eax
+      continue;
+801038c7:	e9 64 ff ff ff       	jmp    80103830 <mpinit+0xf0>
+801038cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    panic("Expect to run on an SMP");
+801038d0:	83 ec 0c             	sub    $0xc,%esp
+801038d3:	68 42 bf 10 80       	push   $0x8010bf42
+801038d8:	e8 a3 ca ff ff       	call   80100380 <panic>
+801038dd:	8d 76 00             	lea    0x0(%esi),%esi
+{
+801038e0:	bb 00 00 0f 80       	mov    $0x800f0000,%ebx
+801038e5:	eb 13                	jmp    801038fa <mpinit+0x1ba>
+801038e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801038ee:	66 90                	xchg   %ax,%ax
+  for(p = addr; p < e; p += sizeof(struct mp))
+801038f0:	89 f3                	mov    %esi,%ebx
+801038f2:	81 fe 00 00 10 80    	cmp    $0x80100000,%esi
+801038f8:	74 d6                	je     801038d0 <mpinit+0x190>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801038fa:	83 ec 04             	sub    $0x4,%esp
+801038fd:	8d 73 10             	lea    0x10(%ebx),%esi
+80103900:	6a 04                	push   $0x4
+80103902:	68 38 bf 10 80       	push   $0x8010bf38
+80103907:	53                   	push   %ebx
+80103908:	e8 e3 46 00 00       	call   80107ff0 <memcmp>
+8010390d:	83 c4 10             	add    $0x10,%esp
+80103910:	85 c0                	test   %eax,%eax
+80103912:	75 dc                	jne    801038f0 <mpinit+0x1b0>
+80103914:	89 da                	mov    %ebx,%edx
+80103916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010391d:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+80103920:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+80103923:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+80103926:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80103928:	39 f2                	cmp    %esi,%edx
+8010392a:	75 f4                	jne    80103920 <mpinit+0x1e0>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+8010392c:	84 c0                	test   %al,%al
+8010392e:	75 c0                	jne    801038f0 <mpinit+0x1b0>
+80103930:	e9 5b fe ff ff       	jmp    80103790 <mpinit+0x50>
+    panic("Didn't find a suitable machine");
+80103935:	83 ec 0c             	sub    $0xc,%esp
+80103938:	68 5c bf 10 80       	push   $0x8010bf5c
+8010393d:	e8 3e ca ff ff       	call   80100380 <panic>
+80103942:	66 90                	xchg   %ax,%ax
+80103944:	66 90                	xchg   %ax,%ax
+80103946:	66 90                	xchg   %ax,%ax
+80103948:	66 90                	xchg   %ax,%ax
+8010394a:	66 90                	xchg   %ax,%ax
+8010394c:	66 90                	xchg   %ax,%ax
+8010394e:	66 90                	xchg   %ax,%ax
+
+80103950 <picinit>:
+80103950:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103955:	ba 21 00 00 00       	mov    $0x21,%edx
+8010395a:	ee                   	out    %al,(%dx)
+8010395b:	ba a1 00 00 00       	mov    $0xa1,%edx
+80103960:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+80103961:	c3                   	ret
+80103962:	66 90                	xchg   %ax,%ax
+80103964:	66 90                	xchg   %ax,%ax
+80103966:	66 90                	xchg   %ax,%ax
+80103968:	66 90                	xchg   %ax,%ax
+8010396a:	66 90                	xchg   %ax,%ax
+8010396c:	66 90                	xchg   %ax,%ax
+8010396e:	66 90                	xchg   %ax,%ax
+
+80103970 <pipealloc>:
+  int writeopen;  // write fd is still open
+};
+
+int
+pipealloc(struct file **f0, struct file **f1)
+{
+80103970:	55                   	push   %ebp
+80103971:	89 e5                	mov    %esp,%ebp
+80103973:	57                   	push   %edi
+80103974:	56                   	push   %esi
+80103975:	53                   	push   %ebx
+80103976:	83 ec 0c             	sub    $0xc,%esp
+80103979:	8b 75 08             	mov    0x8(%ebp),%esi
+8010397c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  struct pipe *p;
+
+  p = 0;
+  *f0 = *f1 = 0;
+8010397f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+80103985:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+8010398b:	e8 10 d5 ff ff       	call   80100ea0 <filealloc>
+80103990:	89 06                	mov    %eax,(%esi)
+80103992:	85 c0                	test   %eax,%eax
+80103994:	0f 84 a5 00 00 00    	je     80103a3f <pipealloc+0xcf>
+8010399a:	e8 01 d5 ff ff       	call   80100ea0 <filealloc>
+8010399f:	89 07                	mov    %eax,(%edi)
+801039a1:	85 c0                	test   %eax,%eax
+801039a3:	0f 84 84 00 00 00    	je     80103a2d <pipealloc+0xbd>
+    goto bad;
+  if((p = (struct pipe*)kalloc()) == 0)
+801039a9:	e8 72 f1 ff ff       	call   80102b20 <kalloc>
+801039ae:	89 c3                	mov    %eax,%ebx
+801039b0:	85 c0                	test   %eax,%eax
+801039b2:	0f 84 a0 00 00 00    	je     80103a58 <pipealloc+0xe8>
+    goto bad;
+  p->readopen = 1;
+801039b8:	c7 80 3c 02 00 00 01 	movl   $0x1,0x23c(%eax)
+801039bf:	00 00 00 
+  p->writeopen = 1;
+  p->nwrite = 0;
+  p->nread = 0;
+  initlock(&p->lock, "pipe");
+801039c2:	83 ec 08             	sub    $0x8,%esp
+  p->writeopen = 1;
+801039c5:	c7 80 40 02 00 00 01 	movl   $0x1,0x240(%eax)
+801039cc:	00 00 00 
+  p->nwrite = 0;
+801039cf:	c7 80 38 02 00 00 00 	movl   $0x0,0x238(%eax)
+801039d6:	00 00 00 
+  p->nread = 0;
+801039d9:	c7 80 34 02 00 00 00 	movl   $0x0,0x234(%eax)
+801039e0:	00 00 00 
+  initlock(&p->lock, "pipe");
+801039e3:	68 7b bf 10 80       	push   $0x8010bf7b
+801039e8:	50                   	push   %eax
+801039e9:	e8 02 43 00 00       	call   80107cf0 <initlock>
+  (*f0)->type = FD_PIPE;
+801039ee:	8b 06                	mov    (%esi),%eax
+  (*f0)->pipe = p;
+  (*f1)->type = FD_PIPE;
+  (*f1)->readable = 0;
+  (*f1)->writable = 1;
+  (*f1)->pipe = p;
+  return 0;
+801039f0:	83 c4 10             	add    $0x10,%esp
+  (*f0)->type = FD_PIPE;
+801039f3:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+801039f9:	8b 06                	mov    (%esi),%eax
+801039fb:	c6 40 08 01          	movb   $0x1,0x8(%eax)
+  (*f0)->writable = 0;
+801039ff:	8b 06                	mov    (%esi),%eax
+80103a01:	c6 40 09 00          	movb   $0x0,0x9(%eax)
+  (*f0)->pipe = p;
+80103a05:	8b 06                	mov    (%esi),%eax
+80103a07:	89 58 0c             	mov    %ebx,0xc(%eax)
+  (*f1)->type = FD_PIPE;
+80103a0a:	8b 07                	mov    (%edi),%eax
+80103a0c:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+80103a12:	8b 07                	mov    (%edi),%eax
+80103a14:	c6 40 08 00          	movb   $0x0,0x8(%eax)
+  (*f1)->writable = 1;
+80103a18:	8b 07                	mov    (%edi),%eax
+80103a1a:	c6 40 09 01          	movb   $0x1,0x9(%eax)
+  (*f1)->pipe = p;
+80103a1e:	8b 07                	mov    (%edi),%eax
+80103a20:	89 58 0c             	mov    %ebx,0xc(%eax)
+  return 0;
+80103a23:	31 c0                	xor    %eax,%eax
+  if(*f0)
+    fileclose(*f0);
+  if(*f1)
+    fileclose(*f1);
+  return -1;
+}
+80103a25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103a28:	5b                   	pop    %ebx
+80103a29:	5e                   	pop    %esi
+80103a2a:	5f                   	pop    %edi
+80103a2b:	5d                   	pop    %ebp
+80103a2c:	c3                   	ret
+  if(*f0)
+80103a2d:	8b 06                	mov    (%esi),%eax
+80103a2f:	85 c0                	test   %eax,%eax
+80103a31:	74 1e                	je     80103a51 <pipealloc+0xe1>
+    fileclose(*f0);
+80103a33:	83 ec 0c             	sub    $0xc,%esp
+80103a36:	50                   	push   %eax
+80103a37:	e8 24 d5 ff ff       	call   80100f60 <fileclose>
+80103a3c:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+80103a3f:	8b 07                	mov    (%edi),%eax
+80103a41:	85 c0                	test   %eax,%eax
+80103a43:	74 0c                	je     80103a51 <pipealloc+0xe1>
+    fileclose(*f1);
+80103a45:	83 ec 0c             	sub    $0xc,%esp
+80103a48:	50                   	push   %eax
+80103a49:	e8 12 d5 ff ff       	call   80100f60 <fileclose>
+80103a4e:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80103a51:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103a56:	eb cd                	jmp    80103a25 <pipealloc+0xb5>
+  if(*f0)
+80103a58:	8b 06                	mov    (%esi),%eax
+80103a5a:	85 c0                	test   %eax,%eax
+80103a5c:	75 d5                	jne    80103a33 <pipealloc+0xc3>
+80103a5e:	eb df                	jmp    80103a3f <pipealloc+0xcf>
+
+80103a60 <pipeclose>:
+
+void
+pipeclose(struct pipe *p, int writable)
+{
+80103a60:	55                   	push   %ebp
+80103a61:	89 e5                	mov    %esp,%ebp
+80103a63:	56                   	push   %esi
+80103a64:	53                   	push   %ebx
+80103a65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103a68:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&p->lock);
+80103a6b:	83 ec 0c             	sub    $0xc,%esp
+80103a6e:	53                   	push   %ebx
+80103a6f:	e8 5c 44 00 00       	call   80107ed0 <acquire>
+  if(writable){
+80103a74:	83 c4 10             	add    $0x10,%esp
+80103a77:	85 f6                	test   %esi,%esi
+80103a79:	74 65                	je     80103ae0 <pipeclose+0x80>
+    p->writeopen = 0;
+    wakeup(&p->nread);
+80103a7b:	83 ec 0c             	sub    $0xc,%esp
+80103a7e:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+    p->writeopen = 0;
+80103a84:	c7 83 40 02 00 00 00 	movl   $0x0,0x240(%ebx)
+80103a8b:	00 00 00 
+    wakeup(&p->nread);
+80103a8e:	50                   	push   %eax
+80103a8f:	e8 7c 2d 00 00       	call   80106810 <wakeup>
+80103a94:	83 c4 10             	add    $0x10,%esp
+  } else {
+    p->readopen = 0;
+    wakeup(&p->nwrite);
+  }
+  if(p->readopen == 0 && p->writeopen == 0){
+80103a97:	8b 93 3c 02 00 00    	mov    0x23c(%ebx),%edx
+80103a9d:	85 d2                	test   %edx,%edx
+80103a9f:	75 0a                	jne    80103aab <pipeclose+0x4b>
+80103aa1:	8b 83 40 02 00 00    	mov    0x240(%ebx),%eax
+80103aa7:	85 c0                	test   %eax,%eax
+80103aa9:	74 15                	je     80103ac0 <pipeclose+0x60>
+    release(&p->lock);
+    kfree((char*)p);
+  } else
+    release(&p->lock);
+80103aab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80103aae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103ab1:	5b                   	pop    %ebx
+80103ab2:	5e                   	pop    %esi
+80103ab3:	5d                   	pop    %ebp
+    release(&p->lock);
+80103ab4:	e9 b7 43 00 00       	jmp    80107e70 <release>
+80103ab9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&p->lock);
+80103ac0:	83 ec 0c             	sub    $0xc,%esp
+80103ac3:	53                   	push   %ebx
+80103ac4:	e8 a7 43 00 00       	call   80107e70 <release>
+    kfree((char*)p);
+80103ac9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80103acc:	83 c4 10             	add    $0x10,%esp
+}
+80103acf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103ad2:	5b                   	pop    %ebx
+80103ad3:	5e                   	pop    %esi
+80103ad4:	5d                   	pop    %ebp
+    kfree((char*)p);
+80103ad5:	e9 86 ee ff ff       	jmp    80102960 <kfree>
+80103ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wakeup(&p->nwrite);
+80103ae0:	83 ec 0c             	sub    $0xc,%esp
+80103ae3:	8d 83 38 02 00 00    	lea    0x238(%ebx),%eax
+    p->readopen = 0;
+80103ae9:	c7 83 3c 02 00 00 00 	movl   $0x0,0x23c(%ebx)
+80103af0:	00 00 00 
+    wakeup(&p->nwrite);
+80103af3:	50                   	push   %eax
+80103af4:	e8 17 2d 00 00       	call   80106810 <wakeup>
+80103af9:	83 c4 10             	add    $0x10,%esp
+80103afc:	eb 99                	jmp    80103a97 <pipeclose+0x37>
+80103afe:	66 90                	xchg   %ax,%ax
+
+80103b00 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+80103b00:	55                   	push   %ebp
+80103b01:	89 e5                	mov    %esp,%ebp
+80103b03:	57                   	push   %edi
+80103b04:	56                   	push   %esi
+80103b05:	53                   	push   %ebx
+80103b06:	83 ec 28             	sub    $0x28,%esp
+80103b09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103b0c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+80103b0f:	53                   	push   %ebx
+80103b10:	e8 bb 43 00 00       	call   80107ed0 <acquire>
+  for(i = 0; i < n; i++){
+80103b15:	83 c4 10             	add    $0x10,%esp
+80103b18:	85 ff                	test   %edi,%edi
+80103b1a:	0f 8e ce 00 00 00    	jle    80103bee <pipewrite+0xee>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80103b20:	8b 83 38 02 00 00    	mov    0x238(%ebx),%eax
+80103b26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80103b29:	89 7d 10             	mov    %edi,0x10(%ebp)
+80103b2c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103b2f:	8d 34 39             	lea    (%ecx,%edi,1),%esi
+80103b32:	89 75 e0             	mov    %esi,-0x20(%ebp)
+      if(p->readopen == 0 || myproc()->killed){
+        release(&p->lock);
+        return -1;
+      }
+      wakeup(&p->nread);
+80103b35:	8d b3 34 02 00 00    	lea    0x234(%ebx),%esi
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80103b3b:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80103b41:	8d bb 38 02 00 00    	lea    0x238(%ebx),%edi
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80103b47:	8d 90 00 02 00 00    	lea    0x200(%eax),%edx
+80103b4d:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+80103b50:	0f 85 b6 00 00 00    	jne    80103c0c <pipewrite+0x10c>
+80103b56:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80103b59:	eb 3b                	jmp    80103b96 <pipewrite+0x96>
+80103b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103b5f:	90                   	nop
+      if(p->readopen == 0 || myproc()->killed){
+80103b60:	e8 9b 1e 00 00       	call   80105a00 <myproc>
+80103b65:	8b 48 3c             	mov    0x3c(%eax),%ecx
+80103b68:	85 c9                	test   %ecx,%ecx
+80103b6a:	75 34                	jne    80103ba0 <pipewrite+0xa0>
+      wakeup(&p->nread);
+80103b6c:	83 ec 0c             	sub    $0xc,%esp
+80103b6f:	56                   	push   %esi
+80103b70:	e8 9b 2c 00 00       	call   80106810 <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80103b75:	58                   	pop    %eax
+80103b76:	5a                   	pop    %edx
+80103b77:	53                   	push   %ebx
+80103b78:	57                   	push   %edi
+80103b79:	e8 c2 2b 00 00       	call   80106740 <sleep>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80103b7e:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+80103b84:	8b 93 38 02 00 00    	mov    0x238(%ebx),%edx
+80103b8a:	83 c4 10             	add    $0x10,%esp
+80103b8d:	05 00 02 00 00       	add    $0x200,%eax
+80103b92:	39 c2                	cmp    %eax,%edx
+80103b94:	75 2a                	jne    80103bc0 <pipewrite+0xc0>
+      if(p->readopen == 0 || myproc()->killed){
+80103b96:	8b 83 3c 02 00 00    	mov    0x23c(%ebx),%eax
+80103b9c:	85 c0                	test   %eax,%eax
+80103b9e:	75 c0                	jne    80103b60 <pipewrite+0x60>
+        release(&p->lock);
+80103ba0:	83 ec 0c             	sub    $0xc,%esp
+80103ba3:	53                   	push   %ebx
+80103ba4:	e8 c7 42 00 00       	call   80107e70 <release>
+        return -1;
+80103ba9:	83 c4 10             	add    $0x10,%esp
+80103bac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+  }
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  release(&p->lock);
+  return n;
+}
+80103bb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103bb4:	5b                   	pop    %ebx
+80103bb5:	5e                   	pop    %esi
+80103bb6:	5f                   	pop    %edi
+80103bb7:	5d                   	pop    %ebp
+80103bb8:	c3                   	ret
+80103bb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103bc0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+80103bc3:	8d 42 01             	lea    0x1(%edx),%eax
+80103bc6:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+  for(i = 0; i < n; i++){
+80103bcc:	83 c1 01             	add    $0x1,%ecx
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+80103bcf:	89 83 38 02 00 00    	mov    %eax,0x238(%ebx)
+80103bd5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103bd8:	0f b6 41 ff          	movzbl -0x1(%ecx),%eax
+80103bdc:	88 44 13 34          	mov    %al,0x34(%ebx,%edx,1)
+  for(i = 0; i < n; i++){
+80103be0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103be3:	39 c1                	cmp    %eax,%ecx
+80103be5:	0f 85 50 ff ff ff    	jne    80103b3b <pipewrite+0x3b>
+80103beb:	8b 7d 10             	mov    0x10(%ebp),%edi
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+80103bee:	83 ec 0c             	sub    $0xc,%esp
+80103bf1:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+80103bf7:	50                   	push   %eax
+80103bf8:	e8 13 2c 00 00       	call   80106810 <wakeup>
+  release(&p->lock);
+80103bfd:	89 1c 24             	mov    %ebx,(%esp)
+80103c00:	e8 6b 42 00 00       	call   80107e70 <release>
+  return n;
+80103c05:	83 c4 10             	add    $0x10,%esp
+80103c08:	89 f8                	mov    %edi,%eax
+80103c0a:	eb a5                	jmp    80103bb1 <pipewrite+0xb1>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80103c0c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103c0f:	eb b2                	jmp    80103bc3 <pipewrite+0xc3>
+80103c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103c18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103c1f:	90                   	nop
+
+80103c20 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+80103c20:	55                   	push   %ebp
+80103c21:	89 e5                	mov    %esp,%ebp
+80103c23:	57                   	push   %edi
+80103c24:	56                   	push   %esi
+80103c25:	53                   	push   %ebx
+80103c26:	83 ec 18             	sub    $0x18,%esp
+80103c29:	8b 75 08             	mov    0x8(%ebp),%esi
+80103c2c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+80103c2f:	56                   	push   %esi
+80103c30:	8d 9e 34 02 00 00    	lea    0x234(%esi),%ebx
+80103c36:	e8 95 42 00 00       	call   80107ed0 <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80103c3b:	8b 86 34 02 00 00    	mov    0x234(%esi),%eax
+80103c41:	83 c4 10             	add    $0x10,%esp
+80103c44:	39 86 38 02 00 00    	cmp    %eax,0x238(%esi)
+80103c4a:	74 2f                	je     80103c7b <piperead+0x5b>
+80103c4c:	eb 37                	jmp    80103c85 <piperead+0x65>
+80103c4e:	66 90                	xchg   %ax,%ax
+    if(myproc()->killed){
+80103c50:	e8 ab 1d 00 00       	call   80105a00 <myproc>
+80103c55:	8b 48 3c             	mov    0x3c(%eax),%ecx
+80103c58:	85 c9                	test   %ecx,%ecx
+80103c5a:	0f 85 80 00 00 00    	jne    80103ce0 <piperead+0xc0>
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80103c60:	83 ec 08             	sub    $0x8,%esp
+80103c63:	56                   	push   %esi
+80103c64:	53                   	push   %ebx
+80103c65:	e8 d6 2a 00 00       	call   80106740 <sleep>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80103c6a:	8b 86 38 02 00 00    	mov    0x238(%esi),%eax
+80103c70:	83 c4 10             	add    $0x10,%esp
+80103c73:	39 86 34 02 00 00    	cmp    %eax,0x234(%esi)
+80103c79:	75 0a                	jne    80103c85 <piperead+0x65>
+80103c7b:	8b 86 40 02 00 00    	mov    0x240(%esi),%eax
+80103c81:	85 c0                	test   %eax,%eax
+80103c83:	75 cb                	jne    80103c50 <piperead+0x30>
+  }
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+80103c85:	8b 55 10             	mov    0x10(%ebp),%edx
+80103c88:	31 db                	xor    %ebx,%ebx
+80103c8a:	85 d2                	test   %edx,%edx
+80103c8c:	7f 20                	jg     80103cae <piperead+0x8e>
+80103c8e:	eb 2c                	jmp    80103cbc <piperead+0x9c>
+    if(p->nread == p->nwrite)
+      break;
+    addr[i] = p->data[p->nread++ % PIPESIZE];
+80103c90:	8d 48 01             	lea    0x1(%eax),%ecx
+80103c93:	25 ff 01 00 00       	and    $0x1ff,%eax
+80103c98:	89 8e 34 02 00 00    	mov    %ecx,0x234(%esi)
+80103c9e:	0f b6 44 06 34       	movzbl 0x34(%esi,%eax,1),%eax
+80103ca3:	88 04 1f             	mov    %al,(%edi,%ebx,1)
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+80103ca6:	83 c3 01             	add    $0x1,%ebx
+80103ca9:	39 5d 10             	cmp    %ebx,0x10(%ebp)
+80103cac:	74 0e                	je     80103cbc <piperead+0x9c>
+    if(p->nread == p->nwrite)
+80103cae:	8b 86 34 02 00 00    	mov    0x234(%esi),%eax
+80103cb4:	3b 86 38 02 00 00    	cmp    0x238(%esi),%eax
+80103cba:	75 d4                	jne    80103c90 <piperead+0x70>
+  }
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+80103cbc:	83 ec 0c             	sub    $0xc,%esp
+80103cbf:	8d 86 38 02 00 00    	lea    0x238(%esi),%eax
+80103cc5:	50                   	push   %eax
+80103cc6:	e8 45 2b 00 00       	call   80106810 <wakeup>
+  release(&p->lock);
+80103ccb:	89 34 24             	mov    %esi,(%esp)
+80103cce:	e8 9d 41 00 00       	call   80107e70 <release>
+  return i;
+80103cd3:	83 c4 10             	add    $0x10,%esp
+}
+80103cd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103cd9:	89 d8                	mov    %ebx,%eax
+80103cdb:	5b                   	pop    %ebx
+80103cdc:	5e                   	pop    %esi
+80103cdd:	5f                   	pop    %edi
+80103cde:	5d                   	pop    %ebp
+80103cdf:	c3                   	ret
+      release(&p->lock);
+80103ce0:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+80103ce3:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+      release(&p->lock);
+80103ce8:	56                   	push   %esi
+80103ce9:	e8 82 41 00 00       	call   80107e70 <release>
+      return -1;
+80103cee:	83 c4 10             	add    $0x10,%esp
+}
+80103cf1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103cf4:	89 d8                	mov    %ebx,%eax
+80103cf6:	5b                   	pop    %ebx
+80103cf7:	5e                   	pop    %esi
+80103cf8:	5f                   	pop    %edi
+80103cf9:	5d                   	pop    %ebp
+80103cfa:	c3                   	ret
+80103cfb:	66 90                	xchg   %ax,%ax
+80103cfd:	66 90                	xchg   %ax,%ax
+80103cff:	90                   	nop
+
+80103d00 <heapfix>:
+
+// Move the process at index i of rq's heap up or down
+// until the heap is ordered by pass again.
+static void
+heapfix(struct runq *rq, int i)
+{
+80103d00:	55                   	push   %ebp
+80103d01:	89 c1                	mov    %eax,%ecx
+80103d03:	89 e5                	mov    %esp,%ebp
+80103d05:	57                   	push   %edi
+80103d06:	56                   	push   %esi
+80103d07:	53                   	push   %ebx
+80103d08:	83 ec 08             	sub    $0x8,%esp
+  struct proc *p;
+  int j;
+
+  p = rq->heap[i];
+80103d0b:	8b 84 90 74 30 00 00 	mov    0x3074(%eax,%edx,4),%eax
+80103d12:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  while(i > 0 && passbefore(p->pass, rq->heap[(i-1)/2]->pass)){
+80103d15:	89 d0                	mov    %edx,%eax
+80103d17:	85 d2                	test   %edx,%edx
+80103d19:	7e 2d                	jle    80103d48 <heapfix+0x48>
+80103d1b:	8b 75 ec             	mov    -0x14(%ebp),%esi
+80103d1e:	eb 12                	jmp    80103d32 <heapfix+0x32>
+    rq->heap[i] = rq->heap[(i-1)/2];
+80103d20:	89 9c 81 74 30 00 00 	mov    %ebx,0x3074(%ecx,%eax,4)
+    rq->heap[i]->heapi = i;
+80103d27:	89 43 74             	mov    %eax,0x74(%ebx)
+  while(i > 0 && passbefore(p->pass, rq->heap[(i-1)/2]->pass)){
+80103d2a:	85 d2                	test   %edx,%edx
+80103d2c:	0f 84 9e 00 00 00    	je     80103dd0 <heapfix+0xd0>
+80103d32:	89 d0                	mov    %edx,%eax
+80103d34:	8d 52 ff             	lea    -0x1(%edx),%edx
+80103d37:	d1 fa                	sar    %edx
+80103d39:	8b 9c 91 74 30 00 00 	mov    0x3074(%ecx,%edx,4),%ebx
+80103d40:	8b 7b 6c             	mov    0x6c(%ebx),%edi
+80103d43:	39 7e 6c             	cmp    %edi,0x6c(%esi)
+80103d46:	78 d8                	js     80103d20 <heapfix+0x20>
+    i = (i-1)/2;
+  }
+  for(;;){
+    j = 2*i + 1;
+    if(j >= rq->nrun)
+80103d48:	8b 71 38             	mov    0x38(%ecx),%esi
+    j = 2*i + 1;
+80103d4b:	8d 5c 00 01          	lea    0x1(%eax,%eax,1),%ebx
+    if(j >= rq->nrun)
+80103d4f:	39 de                	cmp    %ebx,%esi
+80103d51:	7e 68                	jle    80103dbb <heapfix+0xbb>
+80103d53:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+80103d56:	eb 41                	jmp    80103d99 <heapfix+0x99>
+80103d58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103d5f:	90                   	nop
+      break;
+    if(j+1 < rq->nrun && passbefore(rq->heap[j+1]->pass, rq->heap[j]->pass))
+80103d60:	8b 75 f0             	mov    -0x10(%ebp),%esi
+80103d63:	8b b4 be 74 30 00 00 	mov    0x3074(%esi,%edi,4),%esi
+80103d6a:	39 4e 6c             	cmp    %ecx,0x6c(%esi)
+80103d6d:	0f 48 4e 6c          	cmovs  0x6c(%esi),%ecx
+80103d71:	0f 48 d6             	cmovs  %esi,%edx
+      j++;
+    if(!passbefore(rq->heap[j]->pass, p->pass))
+80103d74:	8b 75 ec             	mov    -0x14(%ebp),%esi
+    if(j+1 < rq->nrun && passbefore(rq->heap[j+1]->pass, rq->heap[j]->pass))
+80103d77:	0f 49 fb             	cmovns %ebx,%edi
+    if(!passbefore(rq->heap[j]->pass, p->pass))
+80103d7a:	3b 4e 6c             	cmp    0x6c(%esi),%ecx
+80103d7d:	79 39                	jns    80103db8 <heapfix+0xb8>
+      break;
+    rq->heap[i] = rq->heap[j];
+80103d7f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+    j = 2*i + 1;
+80103d82:	8d 5c 3f 01          	lea    0x1(%edi,%edi,1),%ebx
+    rq->heap[i] = rq->heap[j];
+80103d86:	89 94 86 74 30 00 00 	mov    %edx,0x3074(%esi,%eax,4)
+    rq->heap[i]->heapi = i;
+80103d8d:	89 42 74             	mov    %eax,0x74(%edx)
+    if(j >= rq->nrun)
+80103d90:	8b 76 38             	mov    0x38(%esi),%esi
+80103d93:	39 de                	cmp    %ebx,%esi
+80103d95:	7e 49                	jle    80103de0 <heapfix+0xe0>
+80103d97:	89 f8                	mov    %edi,%eax
+    if(j+1 < rq->nrun && passbefore(rq->heap[j+1]->pass, rq->heap[j]->pass))
+80103d99:	8b 55 f0             	mov    -0x10(%ebp),%edx
+80103d9c:	8d 7c 00 02          	lea    0x2(%eax,%eax,1),%edi
+80103da0:	8b 94 9a 74 30 00 00 	mov    0x3074(%edx,%ebx,4),%edx
+80103da7:	8b 4a 6c             	mov    0x6c(%edx),%ecx
+80103daa:	39 f7                	cmp    %esi,%edi
+80103dac:	7c b2                	jl     80103d60 <heapfix+0x60>
+    if(!passbefore(rq->heap[j]->pass, p->pass))
+80103dae:	8b 75 ec             	mov    -0x14(%ebp),%esi
+80103db1:	89 df                	mov    %ebx,%edi
+80103db3:	3b 4e 6c             	cmp    0x6c(%esi),%ecx
+80103db6:	78 c7                	js     80103d7f <heapfix+0x7f>
+80103db8:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    i = j;
+  }
+  rq->heap[i] = p;
+80103dbb:	8b 7d ec             	mov    -0x14(%ebp),%edi
+80103dbe:	89 bc 81 74 30 00 00 	mov    %edi,0x3074(%ecx,%eax,4)
+  p->heapi = i;
+80103dc5:	89 47 74             	mov    %eax,0x74(%edi)
+}
+80103dc8:	83 c4 08             	add    $0x8,%esp
+80103dcb:	5b                   	pop    %ebx
+80103dcc:	5e                   	pop    %esi
+80103dcd:	5f                   	pop    %edi
+80103dce:	5d                   	pop    %ebp
+80103dcf:	c3                   	ret
+  while(i > 0 && passbefore(p->pass, rq->heap[(i-1)/2]->pass)){
+80103dd0:	31 c0                	xor    %eax,%eax
+80103dd2:	e9 71 ff ff ff       	jmp    80103d48 <heapfix+0x48>
+80103dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103dde:	66 90                	xchg   %ax,%ax
+80103de0:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+80103de3:	89 f8                	mov    %edi,%eax
+80103de5:	eb d4                	jmp    80103dbb <heapfix+0xbb>
+80103de7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103dee:	66 90                	xchg   %ax,%ax
+
+80103df0 <edfpick>:
+edfpick(int id)
+{
+  struct proc *p, *best;
+
+  best = 0;
+  for(p = ptable.rt; p; p = p->rtnext)
+80103df0:	8b 15 1c 9b 13 80    	mov    0x80139b1c,%edx
+80103df6:	85 d2                	test   %edx,%edx
+80103df8:	74 66                	je     80103e60 <edfpick+0x70>
+{
+80103dfa:	55                   	push   %ebp
+80103dfb:	89 c1                	mov    %eax,%ecx
+  best = 0;
+80103dfd:	31 c0                	xor    %eax,%eax
+{
+80103dff:	89 e5                	mov    %esp,%ebp
+80103e01:	53                   	push   %ebx
+80103e02:	bb 01 00 00 00       	mov    $0x1,%ebx
+80103e07:	d3 e3                	shl    %cl,%ebx
+80103e09:	89 d9                	mov    %ebx,%ecx
+80103e0b:	eb 0d                	jmp    80103e1a <edfpick+0x2a>
+80103e0d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = ptable.rt; p; p = p->rtnext)
+80103e10:	8b 92 b8 00 00 00    	mov    0xb8(%edx),%edx
+80103e16:	85 d2                	test   %edx,%edx
+80103e18:	74 34                	je     80103e4e <edfpick+0x5e>
+    if(p->state == RUNNABLE && p->rtbudget > 0 && cpuok(p, id))
+80103e1a:	83 7a 08 03          	cmpl   $0x3,0x8(%edx)
+80103e1e:	75 f0                	jne    80103e10 <edfpick+0x20>
+80103e20:	8b 9a b0 00 00 00    	mov    0xb0(%edx),%ebx
+80103e26:	85 db                	test   %ebx,%ebx
+80103e28:	7e e6                	jle    80103e10 <edfpick+0x20>
+80103e2a:	89 cb                	mov    %ecx,%ebx
+80103e2c:	23 5a 78             	and    0x78(%edx),%ebx
+80103e2f:	74 df                	je     80103e10 <edfpick+0x20>
+      if(best == 0 || (int)(p->rtdeadline - best->rtdeadline) < 0)
+80103e31:	85 c0                	test   %eax,%eax
+80103e33:	74 23                	je     80103e58 <edfpick+0x68>
+80103e35:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+80103e3b:	39 9a ac 00 00 00    	cmp    %ebx,0xac(%edx)
+80103e41:	0f 48 c2             	cmovs  %edx,%eax
+  for(p = ptable.rt; p; p = p->rtnext)
+80103e44:	8b 92 b8 00 00 00    	mov    0xb8(%edx),%edx
+80103e4a:	85 d2                	test   %edx,%edx
+80103e4c:	75 cc                	jne    80103e1a <edfpick+0x2a>
+        best = p;
+  return best;
+}
+80103e4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103e51:	c9                   	leave
+80103e52:	c3                   	ret
+80103e53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103e57:	90                   	nop
+80103e58:	89 d0                	mov    %edx,%eax
+80103e5a:	eb b4                	jmp    80103e10 <edfpick+0x20>
+80103e5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  best = 0;
+80103e60:	31 c0                	xor    %eax,%eax
+}
+80103e62:	c3                   	ret
+80103e63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103e6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103e70 <setrt>:
+
+// Make p real-time with the given period and runtime,
+// or an ordinary process again if period is 0.
+static int
+setrt(struct proc *p, int period, int runtime)
+{
+80103e70:	55                   	push   %ebp
+80103e71:	89 e5                	mov    %esp,%ebp
+80103e73:	57                   	push   %edi
+80103e74:	56                   	push   %esi
+80103e75:	89 d6                	mov    %edx,%esi
+80103e77:	53                   	push   %ebx
+80103e78:	89 c3                	mov    %eax,%ebx
+80103e7a:	83 ec 08             	sub    $0x8,%esp
+  struct proc **pp;
+  int util;
+
+  util = period ? runtime * 1000 / period : 0;
+80103e7d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+80103e84:	85 d2                	test   %edx,%edx
+80103e86:	74 0c                	je     80103e94 <setrt+0x24>
+80103e88:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+80103e8e:	99                   	cltd
+80103e8f:	f7 fe                	idiv   %esi
+80103e91:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(p->rtperiod)
+    ptable.rtutil -= p->rtruntime * 1000 / p->rtperiod;
+80103e94:	a1 20 9b 13 80       	mov    0x80139b20,%eax
+  if(p->rtperiod)
+80103e99:	8b bb a4 00 00 00    	mov    0xa4(%ebx),%edi
+    ptable.rtutil -= p->rtruntime * 1000 / p->rtperiod;
+80103e9f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(p->rtperiod)
+80103ea2:	85 ff                	test   %edi,%edi
+80103ea4:	0f 84 96 00 00 00    	je     80103f40 <setrt+0xd0>
+    ptable.rtutil -= p->rtruntime * 1000 / p->rtperiod;
+80103eaa:	69 83 a8 00 00 00 e8 	imul   $0x3e8,0xa8(%ebx),%eax
+80103eb1:	03 00 00 
+80103eb4:	99                   	cltd
+80103eb5:	f7 ff                	idiv   %edi
+80103eb7:	8b 7d ec             	mov    -0x14(%ebp),%edi
+80103eba:	29 c7                	sub    %eax,%edi
+  if(ptable.rtutil + util > RTUTIL){
+80103ebc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    ptable.rtutil -= p->rtruntime * 1000 / p->rtperiod;
+80103ebf:	89 3d 20 9b 13 80    	mov    %edi,0x80139b20
+  if(ptable.rtutil + util > RTUTIL){
+80103ec5:	01 f8                	add    %edi,%eax
+80103ec7:	3d 84 03 00 00       	cmp    $0x384,%eax
+80103ecc:	0f 8f a5 00 00 00    	jg     80103f77 <setrt+0x107>
+    if(p->rtperiod)
+      ptable.rtutil += p->rtruntime * 1000 / p->rtperiod;
+    return -1;
+  }
+  ptable.rtutil += util;
+80103ed2:	a3 20 9b 13 80       	mov    %eax,0x80139b20
+  if(p->rtperiod && period == 0){
+80103ed7:	8b 83 a4 00 00 00    	mov    0xa4(%ebx),%eax
+80103edd:	85 c0                	test   %eax,%eax
+80103edf:	74 7f                	je     80103f60 <setrt+0xf0>
+80103ee1:	85 f6                	test   %esi,%esi
+80103ee3:	75 2d                	jne    80103f12 <setrt+0xa2>
+    for(pp = &ptable.rt; *pp != p; pp = &(*pp)->rtnext)
+80103ee5:	a1 1c 9b 13 80       	mov    0x80139b1c,%eax
+80103eea:	39 c3                	cmp    %eax,%ebx
+80103eec:	0f 84 ae 00 00 00    	je     80103fa0 <setrt+0x130>
+80103ef2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80103ef8:	89 c2                	mov    %eax,%edx
+80103efa:	8b 80 b8 00 00 00    	mov    0xb8(%eax),%eax
+80103f00:	39 c3                	cmp    %eax,%ebx
+80103f02:	75 f4                	jne    80103ef8 <setrt+0x88>
+80103f04:	81 c2 b8 00 00 00    	add    $0xb8,%edx
+      ;
+    *pp = p->rtnext;
+80103f0a:	8b 83 b8 00 00 00    	mov    0xb8(%ebx),%eax
+80103f10:	89 02                	mov    %eax,(%edx)
+  } else if(p->rtperiod == 0 && period){
+    p->rtnext = ptable.rt;
+    ptable.rt = p;
+  }
+  p->rtperiod = period;
+80103f12:	89 b3 a4 00 00 00    	mov    %esi,0xa4(%ebx)
+  p->rtruntime = runtime;
+  p->rtdeadline = ticks + period;
+80103f18:	03 35 c0 9b 13 80    	add    0x80139bc0,%esi
+  p->rtbudget = runtime;
+  return 0;
+80103f1e:	31 c0                	xor    %eax,%eax
+  p->rtruntime = runtime;
+80103f20:	89 8b a8 00 00 00    	mov    %ecx,0xa8(%ebx)
+  p->rtdeadline = ticks + period;
+80103f26:	89 b3 ac 00 00 00    	mov    %esi,0xac(%ebx)
+  p->rtbudget = runtime;
+80103f2c:	89 8b b0 00 00 00    	mov    %ecx,0xb0(%ebx)
+}
+80103f32:	83 c4 08             	add    $0x8,%esp
+80103f35:	5b                   	pop    %ebx
+80103f36:	5e                   	pop    %esi
+80103f37:	5f                   	pop    %edi
+80103f38:	5d                   	pop    %ebp
+80103f39:	c3                   	ret
+80103f3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(ptable.rtutil + util > RTUTIL){
+80103f40:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80103f43:	8b 7d ec             	mov    -0x14(%ebp),%edi
+80103f46:	01 f8                	add    %edi,%eax
+80103f48:	3d 84 03 00 00       	cmp    $0x384,%eax
+80103f4d:	7e 83                	jle    80103ed2 <setrt+0x62>
+    return -1;
+80103f4f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103f54:	eb dc                	jmp    80103f32 <setrt+0xc2>
+80103f56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103f5d:	8d 76 00             	lea    0x0(%esi),%esi
+  } else if(p->rtperiod == 0 && period){
+80103f60:	85 f6                	test   %esi,%esi
+80103f62:	74 ae                	je     80103f12 <setrt+0xa2>
+    p->rtnext = ptable.rt;
+80103f64:	a1 1c 9b 13 80       	mov    0x80139b1c,%eax
+80103f69:	89 83 b8 00 00 00    	mov    %eax,0xb8(%ebx)
+    ptable.rt = p;
+80103f6f:	89 1d 1c 9b 13 80    	mov    %ebx,0x80139b1c
+80103f75:	eb 9b                	jmp    80103f12 <setrt+0xa2>
+    if(p->rtperiod)
+80103f77:	8b 8b a4 00 00 00    	mov    0xa4(%ebx),%ecx
+80103f7d:	85 c9                	test   %ecx,%ecx
+80103f7f:	74 ce                	je     80103f4f <setrt+0xdf>
+      ptable.rtutil += p->rtruntime * 1000 / p->rtperiod;
+80103f81:	69 83 a8 00 00 00 e8 	imul   $0x3e8,0xa8(%ebx),%eax
+80103f88:	03 00 00 
+80103f8b:	99                   	cltd
+80103f8c:	f7 f9                	idiv   %ecx
+80103f8e:	01 f8                	add    %edi,%eax
+80103f90:	a3 20 9b 13 80       	mov    %eax,0x80139b20
+80103f95:	eb b8                	jmp    80103f4f <setrt+0xdf>
+80103f97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103f9e:	66 90                	xchg   %ax,%ax
+    for(pp = &ptable.rt; *pp != p; pp = &(*pp)->rtnext)
+80103fa0:	ba 1c 9b 13 80       	mov    $0x80139b1c,%edx
+80103fa5:	e9 60 ff ff ff       	jmp    80103f0a <setrt+0x9a>
+80103faa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103fb0 <freeproc>:
+
+// Return p, which has exited or never ran, to the free list,
+// freeing its kernel stack and dropping its address space.  Caller must hold ptable.lock.
+static void
+freeproc(struct proc *p)
+{
+80103fb0:	55                   	push   %ebp
+80103fb1:	89 e5                	mov    %esp,%ebp
+80103fb3:	53                   	push   %ebx
+80103fb4:	89 c3                	mov    %eax,%ebx
+80103fb6:	83 ec 04             	sub    $0x4,%esp
+  struct proc **pp;
+
+  for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp != p; pp = &(*pp)->hnext)
+80103fb9:	8b 40 0c             	mov    0xc(%eax),%eax
+80103fbc:	89 c1                	mov    %eax,%ecx
+80103fbe:	c1 f9 1f             	sar    $0x1f,%ecx
+80103fc1:	c1 e9 16             	shr    $0x16,%ecx
+80103fc4:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+80103fc7:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+80103fcd:	29 ca                	sub    %ecx,%edx
+80103fcf:	8b 04 95 9c 7e 11 80 	mov    -0x7fee8164(,%edx,4),%eax
+80103fd6:	39 c3                	cmp    %eax,%ebx
+80103fd8:	0f 84 a2 00 00 00    	je     80104080 <freeproc+0xd0>
+80103fde:	66 90                	xchg   %ax,%ax
+80103fe0:	89 c2                	mov    %eax,%edx
+80103fe2:	8b 40 1c             	mov    0x1c(%eax),%eax
+80103fe5:	39 c3                	cmp    %eax,%ebx
+80103fe7:	75 f7                	jne    80103fe0 <freeproc+0x30>
+80103fe9:	83 c2 1c             	add    $0x1c,%edx
+    ;
+  *pp = p->hnext;
+80103fec:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80103fef:	89 02                	mov    %eax,(%edx)
+  if(p->parent){
+80103ff1:	8b 53 10             	mov    0x10(%ebx),%edx
+80103ff4:	85 d2                	test   %edx,%edx
+80103ff6:	74 21                	je     80104019 <freeproc+0x69>
+    for(pp = &p->parent->children; *pp != p; pp = &(*pp)->sibling)
+80103ff8:	8b 42 14             	mov    0x14(%edx),%eax
+80103ffb:	39 c3                	cmp    %eax,%ebx
+80103ffd:	0f 84 89 00 00 00    	je     8010408c <freeproc+0xdc>
+80104003:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104007:	90                   	nop
+80104008:	89 c2                	mov    %eax,%edx
+8010400a:	8b 40 18             	mov    0x18(%eax),%eax
+8010400d:	39 c3                	cmp    %eax,%ebx
+8010400f:	75 f7                	jne    80104008 <freeproc+0x58>
+80104011:	83 c2 18             	add    $0x18,%edx
+      ;
+    *pp = p->sibling;
+80104014:	8b 43 18             	mov    0x18(%ebx),%eax
+80104017:	89 02                	mov    %eax,(%edx)
+  }
+  if(p->kstack)
+80104019:	8b 43 04             	mov    0x4(%ebx),%eax
+8010401c:	85 c0                	test   %eax,%eax
+8010401e:	74 0c                	je     8010402c <freeproc+0x7c>
+    kfree(p->kstack);
+80104020:	83 ec 0c             	sub    $0xc,%esp
+80104023:	50                   	push   %eax
+80104024:	e8 37 e9 ff ff       	call   80102960 <kfree>
+80104029:	83 c4 10             	add    $0x10,%esp
+  p->kstack = 0;
+  if(p->mm)
+8010402c:	8b 03                	mov    (%ebx),%eax
+  p->kstack = 0;
+8010402e:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  if(p->mm)
+80104035:	85 c0                	test   %eax,%eax
+80104037:	74 0c                	je     80104045 <freeproc+0x95>
+    mmput(p->mm);
+80104039:	83 ec 0c             	sub    $0xc,%esp
+8010403c:	50                   	push   %eax
+8010403d:	e8 7e 73 00 00       	call   8010b3c0 <mmput>
+80104042:	83 c4 10             	add    $0x10,%esp
+  p->mm = 0;
+80104045:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  p->pid = 0;
+8010404b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  p->parent = 0;
+80104052:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  p->name[0] = 0;
+80104059:	c6 43 48 00          	movb   $0x0,0x48(%ebx)
+  p->killed = 0;
+8010405d:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  p->state = UNUSED;
+80104064:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  p->hnext = ptable.free;
+8010406b:	a1 98 7e 11 80       	mov    0x80117e98,%eax
+80104070:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  ptable.free = p;
+80104073:	89 1d 98 7e 11 80    	mov    %ebx,0x80117e98
+}
+80104079:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010407c:	c9                   	leave
+8010407d:	c3                   	ret
+8010407e:	66 90                	xchg   %ax,%ax
+  for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp != p; pp = &(*pp)->hnext)
+80104080:	8d 14 95 9c 7e 11 80 	lea    -0x7fee8164(,%edx,4),%edx
+80104087:	e9 60 ff ff ff       	jmp    80103fec <freeproc+0x3c>
+    for(pp = &p->parent->children; *pp != p; pp = &(*pp)->sibling)
+8010408c:	83 c2 14             	add    $0x14,%edx
+8010408f:	e9 80 ff ff ff       	jmp    80104014 <freeproc+0x64>
+80104094:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010409b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010409f:	90                   	nop
+
+801040a0 <runqdraw>:
+{
+801040a0:	55                   	push   %ebp
+801040a1:	89 e5                	mov    %esp,%ebp
+801040a3:	57                   	push   %edi
+801040a4:	56                   	push   %esi
+801040a5:	89 c6                	mov    %eax,%esi
+801040a7:	53                   	push   %ebx
+801040a8:	83 ec 1c             	sub    $0x1c,%esp
+  if(rq->total <= 0)
+801040ab:	8b 40 34             	mov    0x34(%eax),%eax
+801040ae:	85 c0                	test   %eax,%eax
+801040b0:	0f 8e ca 00 00 00    	jle    80104180 <runqdraw+0xe0>
+  if(policy == SCHED_MLFQ){
+801040b6:	83 3d ac 9b 13 80 02 	cmpl   $0x2,0x80139bac
+801040bd:	75 79                	jne    80104138 <runqdraw+0x98>
+    for(l = 0; l < NMLFQ - 1 && rq->ltotal[l] <= 0; l++)
+801040bf:	8b 46 5c             	mov    0x5c(%esi),%eax
+801040c2:	85 c0                	test   %eax,%eax
+801040c4:	0f 8f c4 00 00 00    	jg     8010418e <runqdraw+0xee>
+801040ca:	8b 46 60             	mov    0x60(%esi),%eax
+801040cd:	85 c0                	test   %eax,%eax
+801040cf:	0f 8f c5 00 00 00    	jg     8010419a <runqdraw+0xfa>
+801040d5:	c7 45 e4 70 20 00 00 	movl   $0x2070,-0x1c(%ebp)
+    winner = random_at_most(rq->ltotal[l] - 1);
+801040dc:	8b 46 64             	mov    0x64(%esi),%eax
+801040df:	83 ec 0c             	sub    $0xc,%esp
+801040e2:	83 e8 01             	sub    $0x1,%eax
+801040e5:	50                   	push   %eax
+801040e6:	e8 b5 78 00 00       	call   8010b9a0 <random_at_most>
+801040eb:	83 c4 10             	add    $0x10,%esp
+801040ee:	89 c1                	mov    %eax,%ecx
+  for(bit = treebit; bit > 0; bit >>= 1){
+801040f0:	a1 b0 9b 13 80       	mov    0x80139bb0,%eax
+  i = 0;
+801040f5:	31 db                	xor    %ebx,%ebx
+  for(bit = treebit; bit > 0; bit >>= 1){
+801040f7:	85 c0                	test   %eax,%eax
+801040f9:	7e 28                	jle    80104123 <runqdraw+0x83>
+  i = 0;
+801040fb:	89 75 e0             	mov    %esi,-0x20(%ebp)
+801040fe:	66 90                	xchg   %ax,%ax
+    if(i + bit <= NPROC && tree[i + bit] <= winner){
+80104100:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+80104103:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+80104109:	7f 14                	jg     8010411f <runqdraw+0x7f>
+8010410b:	8b 75 e0             	mov    -0x20(%ebp),%esi
+8010410e:	8d 3c 96             	lea    (%esi,%edx,4),%edi
+80104111:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80104114:	8b 3c 37             	mov    (%edi,%esi,1),%edi
+80104117:	39 cf                	cmp    %ecx,%edi
+80104119:	7f 04                	jg     8010411f <runqdraw+0x7f>
+      winner -= tree[i];
+8010411b:	29 f9                	sub    %edi,%ecx
+8010411d:	89 d3                	mov    %edx,%ebx
+  for(bit = treebit; bit > 0; bit >>= 1){
+8010411f:	d1 f8                	sar    %eax
+80104121:	75 dd                	jne    80104100 <runqdraw+0x60>
+  return ptable.slot[treefind(rq, l, winner)];
+80104123:	8b 04 9d 94 6e 11 80 	mov    -0x7fee916c(,%ebx,4),%eax
+}
+8010412a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010412d:	5b                   	pop    %ebx
+8010412e:	5e                   	pop    %esi
+8010412f:	5f                   	pop    %edi
+80104130:	5d                   	pop    %ebp
+80104131:	c3                   	ret
+80104132:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    winner = random_at_most(rq->total - 1);
+80104138:	83 ec 0c             	sub    $0xc,%esp
+8010413b:	83 e8 01             	sub    $0x1,%eax
+8010413e:	50                   	push   %eax
+8010413f:	e8 5c 78 00 00       	call   8010b9a0 <random_at_most>
+    for(l = 0; winner >= rq->ltotal[l]; l++)
+80104144:	c7 45 e4 68 00 00 00 	movl   $0x68,-0x1c(%ebp)
+8010414b:	83 c4 10             	add    $0x10,%esp
+    winner = random_at_most(rq->total - 1);
+8010414e:	89 c1                	mov    %eax,%ecx
+    for(l = 0; winner >= rq->ltotal[l]; l++)
+80104150:	8b 46 5c             	mov    0x5c(%esi),%eax
+80104153:	39 c1                	cmp    %eax,%ecx
+80104155:	7c 99                	jl     801040f0 <runqdraw+0x50>
+80104157:	8b 56 60             	mov    0x60(%esi),%edx
+      winner -= rq->ltotal[l];
+8010415a:	29 c1                	sub    %eax,%ecx
+    for(l = 0; winner >= rq->ltotal[l]; l++)
+8010415c:	b8 01 00 00 00       	mov    $0x1,%eax
+80104161:	39 d1                	cmp    %edx,%ecx
+80104163:	7c 07                	jl     8010416c <runqdraw+0xcc>
+      winner -= rq->ltotal[l];
+80104165:	29 d1                	sub    %edx,%ecx
+    for(l = 0; winner >= rq->ltotal[l]; l++)
+80104167:	b8 02 00 00 00       	mov    $0x2,%eax
+8010416c:	69 c0 04 10 00 00    	imul   $0x1004,%eax,%eax
+80104172:	83 c0 68             	add    $0x68,%eax
+80104175:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80104178:	e9 73 ff ff ff       	jmp    801040f0 <runqdraw+0x50>
+8010417d:	8d 76 00             	lea    0x0(%esi),%esi
+    return rq->heap[0];
+80104180:	8b 86 74 30 00 00    	mov    0x3074(%esi),%eax
+}
+80104186:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104189:	5b                   	pop    %ebx
+8010418a:	5e                   	pop    %esi
+8010418b:	5f                   	pop    %edi
+8010418c:	5d                   	pop    %ebp
+8010418d:	c3                   	ret
+    for(l = 0; l < NMLFQ - 1 && rq->ltotal[l] <= 0; l++)
+8010418e:	c7 45 e4 68 00 00 00 	movl   $0x68,-0x1c(%ebp)
+80104195:	e9 45 ff ff ff       	jmp    801040df <runqdraw+0x3f>
+8010419a:	c7 45 e4 6c 10 00 00 	movl   $0x106c,-0x1c(%ebp)
+801041a1:	e9 39 ff ff ff       	jmp    801040df <runqdraw+0x3f>
+801041a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801041ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801041b0 <forkret>:
+
+// A fork child's very first scheduling by scheduler()
+// will swtch here.  "Return" to user space.
+void
+forkret(void)
+{
+801041b0:	55                   	push   %ebp
+801041b1:	89 e5                	mov    %esp,%ebp
+801041b3:	83 ec 14             	sub    $0x14,%esp
+  static int first = 1;
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+801041b6:	68 60 6e 11 80       	push   $0x80116e60
+801041bb:	e8 b0 3c 00 00       	call   80107e70 <release>
+
+  if (first) {
+801041c0:	a1 00 f0 10 80       	mov    0x8010f000,%eax
+801041c5:	83 c4 10             	add    $0x10,%esp
+801041c8:	85 c0                	test   %eax,%eax
+801041ca:	75 04                	jne    801041d0 <forkret+0x20>
+    iinit(ROOTDEV);
+    initlog(ROOTDEV);
+  }
+
+  // Return to "caller", actually trapret (see allocproc).
+}
+801041cc:	c9                   	leave
+801041cd:	c3                   	ret
+801041ce:	66 90                	xchg   %ax,%ax
+    first = 0;
+801041d0:	c7 05 00 f0 10 80 00 	movl   $0x0,0x8010f000
+801041d7:	00 00 00 
+    iinit(ROOTDEV);
+801041da:	83 ec 0c             	sub    $0xc,%esp
+801041dd:	6a 01                	push   $0x1
+801041df:	e8 1c d8 ff ff       	call   80101a00 <iinit>
+    initlog(ROOTDEV);
+801041e4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+801041eb:	e8 f0 ef ff ff       	call   801031e0 <initlog>
+}
+801041f0:	83 c4 10             	add    $0x10,%esp
+801041f3:	c9                   	leave
+801041f4:	c3                   	ret
+801041f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801041fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80104200 <pbase.isra.0>:
+  if(p->group == 0)
+80104200:	85 d2                	test   %edx,%edx
+80104202:	74 4c                	je     80104250 <pbase.isra.0+0x50>
+pbase(struct proc *p)
+80104204:	55                   	push   %ebp
+  if(g->active <= p->tickets)
+80104205:	8d 54 52 fd          	lea    -0x3(%edx,%edx,2),%edx
+80104209:	8d 14 95 60 6e 11 80 	lea    -0x7fee91a0(,%edx,4),%edx
+pbase(struct proc *p)
+80104210:	89 e5                	mov    %esp,%ebp
+80104212:	53                   	push   %ebx
+  if(g->active <= p->tickets)
+80104213:	8b 9a 00 2c 02 00    	mov    0x22c00(%edx),%ebx
+    return g->tickets;
+80104219:	8b 8a fc 2b 02 00    	mov    0x22bfc(%edx),%ecx
+  if(g->active <= p->tickets)
+8010421f:	39 c3                	cmp    %eax,%ebx
+80104221:	7e 21                	jle    80104244 <pbase.isra.0+0x44>
+  share = p->tickets * 1024 / g->active;   // avoid overflow
+80104223:	c1 e0 0a             	shl    $0xa,%eax
+80104226:	99                   	cltd
+80104227:	f7 fb                	idiv   %ebx
+  base = g->tickets * share / 1024;
+80104229:	0f af c1             	imul   %ecx,%eax
+8010422c:	85 c0                	test   %eax,%eax
+8010422e:	8d 88 ff 03 00 00    	lea    0x3ff(%eax),%ecx
+80104234:	0f 49 c8             	cmovns %eax,%ecx
+  return base > 0 ? base : 1;
+80104237:	b8 01 00 00 00       	mov    $0x1,%eax
+  base = g->tickets * share / 1024;
+8010423c:	c1 f9 0a             	sar    $0xa,%ecx
+  return base > 0 ? base : 1;
+8010423f:	85 c9                	test   %ecx,%ecx
+80104241:	0f 4e c8             	cmovle %eax,%ecx
+}
+80104244:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104247:	89 c8                	mov    %ecx,%eax
+80104249:	c9                   	leave
+8010424a:	c3                   	ret
+8010424b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010424f:	90                   	nop
+80104250:	c3                   	ret
+80104251:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104258:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010425f:	90                   	nop
+
+80104260 <ptickets>:
+{
+80104260:	55                   	push   %ebp
+80104261:	89 e5                	mov    %esp,%ebp
+80104263:	57                   	push   %edi
+80104264:	56                   	push   %esi
+80104265:	53                   	push   %ebx
+  if(p->borrowed >= MAXWEIGHT)
+80104266:	8b 98 94 00 00 00    	mov    0x94(%eax),%ebx
+8010426c:	81 fb fe ff 1f 00    	cmp    $0x1ffffe,%ebx
+80104272:	0f 8f 88 00 00 00    	jg     80104300 <ptickets+0xa0>
+80104278:	89 c1                	mov    %eax,%ecx
+  base = pbase(p) + p->borrowed;
+8010427a:	8b 40 58             	mov    0x58(%eax),%eax
+8010427d:	8b 91 8c 00 00 00    	mov    0x8c(%ecx),%edx
+  if(p->group == 0)
+80104283:	85 d2                	test   %edx,%edx
+80104285:	74 3c                	je     801042c3 <ptickets+0x63>
+  if(g->active <= p->tickets)
+80104287:	8d 54 52 fd          	lea    -0x3(%edx,%edx,2),%edx
+8010428b:	8d 14 95 60 6e 11 80 	lea    -0x7fee91a0(,%edx,4),%edx
+80104292:	8b ba 00 2c 02 00    	mov    0x22c00(%edx),%edi
+    return g->tickets;
+80104298:	8b b2 fc 2b 02 00    	mov    0x22bfc(%edx),%esi
+  if(g->active <= p->tickets)
+8010429e:	39 f8                	cmp    %edi,%eax
+801042a0:	7d 7e                	jge    80104320 <ptickets+0xc0>
+  share = p->tickets * 1024 / g->active;   // avoid overflow
+801042a2:	c1 e0 0a             	shl    $0xa,%eax
+801042a5:	99                   	cltd
+801042a6:	f7 ff                	idiv   %edi
+  base = g->tickets * share / 1024;
+801042a8:	0f af c6             	imul   %esi,%eax
+801042ab:	85 c0                	test   %eax,%eax
+801042ad:	8d 90 ff 03 00 00    	lea    0x3ff(%eax),%edx
+801042b3:	0f 49 d0             	cmovns %eax,%edx
+  return base > 0 ? base : 1;
+801042b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  base = g->tickets * share / 1024;
+801042bb:	c1 fa 0a             	sar    $0xa,%edx
+  return base > 0 ? base : 1;
+801042be:	85 d2                	test   %edx,%edx
+801042c0:	0f 4f c2             	cmovg  %edx,%eax
+  base = pbase(p) + p->borrowed;
+801042c3:	01 d8                	add    %ebx,%eax
+  if(base > MAXWEIGHT)
+801042c5:	ba ff ff 1f 00       	mov    $0x1fffff,%edx
+  if(p->quantum >= 1000)
+801042ca:	8b 89 80 00 00 00    	mov    0x80(%ecx),%ecx
+  if(base > MAXWEIGHT)
+801042d0:	39 d0                	cmp    %edx,%eax
+801042d2:	0f 4f c2             	cmovg  %edx,%eax
+  if(p->quantum >= 1000)
+801042d5:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+801042db:	7e 13                	jle    801042f0 <ptickets+0x90>
+  return w < MAXWEIGHT ? w : MAXWEIGHT;
+801042dd:	ba ff ff 1f 00       	mov    $0x1fffff,%edx
+}
+801042e2:	5b                   	pop    %ebx
+801042e3:	5e                   	pop    %esi
+  return w < MAXWEIGHT ? w : MAXWEIGHT;
+801042e4:	39 d0                	cmp    %edx,%eax
+}
+801042e6:	5f                   	pop    %edi
+801042e7:	5d                   	pop    %ebp
+  return w < MAXWEIGHT ? w : MAXWEIGHT;
+801042e8:	0f 4f c2             	cmovg  %edx,%eax
+}
+801042eb:	c3                   	ret
+801042ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  else if(p->quantum < MINQUANTUM)
+801042f0:	83 f9 09             	cmp    $0x9,%ecx
+801042f3:	7f 1b                	jg     80104310 <ptickets+0xb0>
+    w = base * (1000 / MINQUANTUM);
+801042f5:	6b c0 64             	imul   $0x64,%eax,%eax
+801042f8:	eb e3                	jmp    801042dd <ptickets+0x7d>
+801042fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+}
+80104300:	5b                   	pop    %ebx
+    return MAXWEIGHT;
+80104301:	b8 ff ff 1f 00       	mov    $0x1fffff,%eax
+}
+80104306:	5e                   	pop    %esi
+80104307:	5f                   	pop    %edi
+80104308:	5d                   	pop    %ebp
+80104309:	c3                   	ret
+8010430a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    w = base * 1000 / p->quantum;
+80104310:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+80104316:	99                   	cltd
+80104317:	f7 f9                	idiv   %ecx
+80104319:	eb c2                	jmp    801042dd <ptickets+0x7d>
+8010431b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010431f:	90                   	nop
+    return g->tickets;
+80104320:	89 f0                	mov    %esi,%eax
+80104322:	eb 9f                	jmp    801042c3 <ptickets+0x63>
+80104324:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010432b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010432f:	90                   	nop
+
+80104330 <gangoffer.part.0>:
+gangoffer(struct proc *p, struct proc *s, int id)
+80104330:	55                   	push   %ebp
+80104331:	89 e5                	mov    %esp,%ebp
+80104333:	57                   	push   %edi
+80104334:	56                   	push   %esi
+80104335:	53                   	push   %ebx
+80104336:	89 d3                	mov    %edx,%ebx
+80104338:	83 ec 1c             	sub    $0x1c,%esp
+  for(i = 0; i < ncpu; i++)
+8010433b:	8b 15 c4 67 11 80    	mov    0x801167c4,%edx
+gangoffer(struct proc *p, struct proc *s, int id)
+80104341:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 0; i < ncpu; i++)
+80104344:	85 d2                	test   %edx,%edx
+80104346:	7e 1d                	jle    80104365 <gangoffer.part.0+0x35>
+80104348:	31 c0                	xor    %eax,%eax
+8010434a:	eb 0b                	jmp    80104357 <gangoffer.part.0+0x27>
+8010434c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104350:	83 c0 01             	add    $0x1,%eax
+80104353:	39 d0                	cmp    %edx,%eax
+80104355:	74 19                	je     80104370 <gangoffer.part.0+0x40>
+    if(cpus[i].gang == s)
+80104357:	69 f0 d0 00 00 00    	imul   $0xd0,%eax,%esi
+8010435d:	39 9e 94 68 11 80    	cmp    %ebx,-0x7fee976c(%esi)
+80104363:	75 eb                	jne    80104350 <gangoffer.part.0+0x20>
+}
+80104365:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104368:	5b                   	pop    %ebx
+80104369:	5e                   	pop    %esi
+8010436a:	5f                   	pop    %edi
+8010436b:	5d                   	pop    %ebp
+8010436c:	c3                   	ret
+8010436d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < ncpu; i++){
+80104370:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80104373:	bf 8c 68 11 80       	mov    $0x8011688c,%edi
+80104378:	31 f6                	xor    %esi,%esi
+8010437a:	eb 11                	jmp    8010438d <gangoffer.part.0+0x5d>
+8010437c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104380:	83 c6 01             	add    $0x1,%esi
+80104383:	81 c7 d0 00 00 00    	add    $0xd0,%edi
+80104389:	39 d6                	cmp    %edx,%esi
+8010438b:	74 d8                	je     80104365 <gangoffer.part.0+0x35>
+    if(i == id || cpus[i].gang || !cpuok(s, i) || !gangok(&cpus[i], p))
+8010438d:	39 f1                	cmp    %esi,%ecx
+8010438f:	74 ef                	je     80104380 <gangoffer.part.0+0x50>
+80104391:	8b 47 08             	mov    0x8(%edi),%eax
+80104394:	85 c0                	test   %eax,%eax
+80104396:	75 e8                	jne    80104380 <gangoffer.part.0+0x50>
+  return (p->affinity >> i) & 1;
+80104398:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010439b:	8b 40 78             	mov    0x78(%eax),%eax
+    if(i == id || cpus[i].gang || !cpuok(s, i) || !gangok(&cpus[i], p))
+8010439e:	0f a3 f0             	bt     %esi,%eax
+801043a1:	73 dd                	jae    80104380 <gangoffer.part.0+0x50>
+  q = c->proc;
+801043a3:	8b 07                	mov    (%edi),%eax
+  return q == 0 || (q->mm != p->mm && q->rtperiod == 0 &&
+801043a5:	85 c0                	test   %eax,%eax
+801043a7:	74 3b                	je     801043e4 <gangoffer.part.0+0xb4>
+801043a9:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+801043ac:	8b 1b                	mov    (%ebx),%ebx
+801043ae:	39 18                	cmp    %ebx,(%eax)
+801043b0:	74 ce                	je     80104380 <gangoffer.part.0+0x50>
+801043b2:	8b 98 a4 00 00 00    	mov    0xa4(%eax),%ebx
+801043b8:	85 db                	test   %ebx,%ebx
+801043ba:	75 c4                	jne    80104380 <gangoffer.part.0+0x50>
+801043bc:	83 3d ac 9b 13 80 02 	cmpl   $0x2,0x80139bac
+801043c3:	74 4b                	je     80104410 <gangoffer.part.0+0xe0>
+801043c5:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+801043c8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    (policy == SCHED_MLFQ ? q->level > p->level : ptickets(q) < ptickets(p)));
+801043cb:	e8 90 fe ff ff       	call   80104260 <ptickets>
+801043d0:	89 c3                	mov    %eax,%ebx
+801043d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801043d5:	e8 86 fe ff ff       	call   80104260 <ptickets>
+  return q == 0 || (q->mm != p->mm && q->rtperiod == 0 &&
+801043da:	8b 55 dc             	mov    -0x24(%ebp),%edx
+801043dd:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+801043e0:	39 c3                	cmp    %eax,%ebx
+801043e2:	7d 9c                	jge    80104380 <gangoffer.part.0+0x50>
+    cpus[i].gang = s;
+801043e4:	69 f6 d0 00 00 00    	imul   $0xd0,%esi,%esi
+801043ea:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_RESCHED);
+801043ed:	83 ec 08             	sub    $0x8,%esp
+    cpus[i].gang = s;
+801043f0:	89 9e 94 68 11 80    	mov    %ebx,-0x7fee976c(%esi)
+    lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_RESCHED);
+801043f6:	6a 34                	push   $0x34
+801043f8:	0f b6 86 e0 67 11 80 	movzbl -0x7fee9820(%esi),%eax
+801043ff:	50                   	push   %eax
+80104400:	e8 db e9 ff ff       	call   80102de0 <lapicipi>
+    return;
+80104405:	83 c4 10             	add    $0x10,%esp
+}
+80104408:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010440b:	5b                   	pop    %ebx
+8010440c:	5e                   	pop    %esi
+8010440d:	5f                   	pop    %edi
+8010440e:	5d                   	pop    %ebp
+8010440f:	c3                   	ret
+  return q == 0 || (q->mm != p->mm && q->rtperiod == 0 &&
+80104410:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80104413:	8b 9b 84 00 00 00    	mov    0x84(%ebx),%ebx
+80104419:	39 98 84 00 00 00    	cmp    %ebx,0x84(%eax)
+8010441f:	7f c3                	jg     801043e4 <gangoffer.part.0+0xb4>
+80104421:	e9 5a ff ff ff       	jmp    80104380 <gangoffer.part.0+0x50>
+80104426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010442d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104430 <rqremove>:
+{
+80104430:	55                   	push   %ebp
+  for(i = 0; i < ncpu; i++)
+80104431:	8b 0d c4 67 11 80    	mov    0x801167c4,%ecx
+{
+80104437:	89 e5                	mov    %esp,%ebp
+80104439:	57                   	push   %edi
+8010443a:	56                   	push   %esi
+8010443b:	89 d6                	mov    %edx,%esi
+8010443d:	53                   	push   %ebx
+8010443e:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < ncpu; i++)
+80104440:	85 c9                	test   %ecx,%ecx
+80104442:	7e 20                	jle    80104464 <rqremove+0x34>
+80104444:	31 c0                	xor    %eax,%eax
+80104446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010444d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (p->affinity >> i) & 1;
+80104450:	8b 56 78             	mov    0x78(%esi),%edx
+    if(cpuok(p, i))
+80104453:	0f a3 c2             	bt     %eax,%edx
+80104456:	73 05                	jae    8010445d <rqremove+0x2d>
+      rq->nok[i]--;
+80104458:	83 6c 83 3c 01       	subl   $0x1,0x3c(%ebx,%eax,4)
+  for(i = 0; i < ncpu; i++)
+8010445d:	83 c0 01             	add    $0x1,%eax
+80104460:	39 c8                	cmp    %ecx,%eax
+80104462:	75 ec                	jne    80104450 <rqremove+0x20>
+  treeadd(rq, p->level, p->slot, -p->weight);
+80104464:	8b 8e 84 00 00 00    	mov    0x84(%esi),%ecx
+8010446a:	8b 46 20             	mov    0x20(%esi),%eax
+8010446d:	8b 7e 60             	mov    0x60(%esi),%edi
+  rq->total += delta;
+80104470:	29 7b 34             	sub    %edi,0x34(%ebx)
+  rq->ltotal[l] += delta;
+80104473:	29 7c 8b 5c          	sub    %edi,0x5c(%ebx,%ecx,4)
+  tree = rq->tree[l];
+80104477:	69 c9 04 10 00 00    	imul   $0x1004,%ecx,%ecx
+  for(i++; i <= NPROC; i += i & -i)
+8010447d:	83 c0 01             	add    $0x1,%eax
+80104480:	83 c1 68             	add    $0x68,%ecx
+80104483:	3d 00 04 00 00       	cmp    $0x400,%eax
+80104488:	7f 1b                	jg     801044a5 <rqremove+0x75>
+8010448a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    tree[i] += delta;
+80104490:	8d 14 81             	lea    (%ecx,%eax,4),%edx
+80104493:	29 3c 13             	sub    %edi,(%ebx,%edx,1)
+  for(i++; i <= NPROC; i += i & -i)
+80104496:	89 c2                	mov    %eax,%edx
+80104498:	f7 da                	neg    %edx
+8010449a:	21 c2                	and    %eax,%edx
+8010449c:	01 d0                	add    %edx,%eax
+8010449e:	3d 00 04 00 00       	cmp    $0x400,%eax
+801044a3:	7e eb                	jle    80104490 <rqremove+0x60>
+  if(p->heapi < --rq->nrun){
+801044a5:	8b 53 38             	mov    0x38(%ebx),%edx
+801044a8:	8b 4e 74             	mov    0x74(%esi),%ecx
+801044ab:	8d 42 ff             	lea    -0x1(%edx),%eax
+801044ae:	89 43 38             	mov    %eax,0x38(%ebx)
+801044b1:	39 c1                	cmp    %eax,%ecx
+801044b3:	7c 23                	jl     801044d8 <rqremove+0xa8>
+  p->weight = 0;
+801044b5:	c7 46 60 00 00 00 00 	movl   $0x0,0x60(%esi)
+  p->rq = -1;
+801044bc:	c7 46 64 ff ff ff ff 	movl   $0xffffffff,0x64(%esi)
+  p->passbase = rq->pass;
+801044c3:	8b 83 74 40 00 00    	mov    0x4074(%ebx),%eax
+801044c9:	89 46 70             	mov    %eax,0x70(%esi)
+}
+801044cc:	5b                   	pop    %ebx
+801044cd:	5e                   	pop    %esi
+801044ce:	5f                   	pop    %edi
+801044cf:	5d                   	pop    %ebp
+801044d0:	c3                   	ret
+801044d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    rq->heap[p->heapi] = rq->heap[rq->nrun];
+801044d8:	8b 46 74             	mov    0x74(%esi),%eax
+801044db:	8b 94 93 70 30 00 00 	mov    0x3070(%ebx,%edx,4),%edx
+801044e2:	89 94 83 74 30 00 00 	mov    %edx,0x3074(%ebx,%eax,4)
+    rq->heap[p->heapi]->heapi = p->heapi;
+801044e9:	8b 56 74             	mov    0x74(%esi),%edx
+801044ec:	8b 84 93 74 30 00 00 	mov    0x3074(%ebx,%edx,4),%eax
+801044f3:	89 50 74             	mov    %edx,0x74(%eax)
+    heapfix(rq, p->heapi);
+801044f6:	89 d8                	mov    %ebx,%eax
+801044f8:	e8 03 f8 ff ff       	call   80103d00 <heapfix>
+801044fd:	eb b6                	jmp    801044b5 <rqremove+0x85>
+801044ff:	90                   	nop
+
+80104500 <claim>:
+{
+80104500:	55                   	push   %ebp
+80104501:	89 e5                	mov    %esp,%ebp
+80104503:	57                   	push   %edi
+80104504:	56                   	push   %esi
+80104505:	89 c6                	mov    %eax,%esi
+80104507:	53                   	push   %ebx
+  rq = &ptable.runq[id];
+80104508:	69 d8 78 40 00 00    	imul   $0x4078,%eax,%ebx
+{
+8010450e:	83 ec 28             	sub    $0x28,%esp
+  rq = &ptable.runq[id];
+80104511:	8d bb 9c 96 11 80    	lea    -0x7fee6964(%ebx),%edi
+  acquire(&rq->lock);
+80104517:	57                   	push   %edi
+80104518:	e8 b3 39 00 00       	call   80107ed0 <acquire>
+  if(rq->nrun == 0){
+8010451d:	8d 83 60 6e 11 80    	lea    -0x7fee91a0(%ebx),%eax
+80104523:	83 c4 10             	add    $0x10,%esp
+80104526:	8b 98 74 28 00 00    	mov    0x2874(%eax),%ebx
+8010452c:	85 db                	test   %ebx,%ebx
+8010452e:	74 78                	je     801045a8 <claim+0xa8>
+  if(policy == SCHED_STRIDE)
+80104530:	83 3d ac 9b 13 80 01 	cmpl   $0x1,0x80139bac
+80104537:	75 5f                	jne    80104598 <claim+0x98>
+    p = rq->heap[0];
+80104539:	8b 98 b0 58 00 00    	mov    0x58b0(%eax),%ebx
+  rq->pass = p->pass;
+8010453f:	69 f6 78 40 00 00    	imul   $0x4078,%esi,%esi
+80104545:	8b 4b 6c             	mov    0x6c(%ebx),%ecx
+80104548:	89 8e 10 d7 11 80    	mov    %ecx,-0x7fee28f0(%esi)
+  p->pass += stride(p->weight);
+8010454e:	8b 73 60             	mov    0x60(%ebx),%esi
+  if(t <= 0)
+80104551:	85 f6                	test   %esi,%esi
+80104553:	0f 8e 77 02 00 00    	jle    801047d0 <claim+0x2d0>
+    return 1;
+80104559:	b8 01 00 00 00       	mov    $0x1,%eax
+  if(t >= STRIDE1)
+8010455e:	81 fe ff ff 3f 00    	cmp    $0x3fffff,%esi
+80104564:	7f 09                	jg     8010456f <claim+0x6f>
+  return STRIDE1 / t;
+80104566:	b8 00 00 40 00       	mov    $0x400000,%eax
+8010456b:	31 d2                	xor    %edx,%edx
+8010456d:	f7 fe                	idiv   %esi
+  p->pass += stride(p->weight);
+8010456f:	01 c1                	add    %eax,%ecx
+  rqremove(rq, p);
+80104571:	89 da                	mov    %ebx,%edx
+80104573:	89 f8                	mov    %edi,%eax
+  p->pass += stride(p->weight);
+80104575:	89 4b 6c             	mov    %ecx,0x6c(%ebx)
+  rqremove(rq, p);
+80104578:	e8 b3 fe ff ff       	call   80104430 <rqremove>
+  release(&rq->lock);
+8010457d:	83 ec 0c             	sub    $0xc,%esp
+80104580:	57                   	push   %edi
+80104581:	e8 ea 38 00 00       	call   80107e70 <release>
+  return p;
+80104586:	83 c4 10             	add    $0x10,%esp
+}
+80104589:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010458c:	89 d8                	mov    %ebx,%eax
+8010458e:	5b                   	pop    %ebx
+8010458f:	5e                   	pop    %esi
+80104590:	5f                   	pop    %edi
+80104591:	5d                   	pop    %ebp
+80104592:	c3                   	ret
+80104593:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104597:	90                   	nop
+    p = runqdraw(rq);
+80104598:	89 f8                	mov    %edi,%eax
+8010459a:	e8 01 fb ff ff       	call   801040a0 <runqdraw>
+8010459f:	89 c3                	mov    %eax,%ebx
+801045a1:	eb 9c                	jmp    8010453f <claim+0x3f>
+801045a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801045a7:	90                   	nop
+    release(&rq->lock);
+801045a8:	83 ec 0c             	sub    $0xc,%esp
+801045ab:	57                   	push   %edi
+801045ac:	e8 bf 38 00 00       	call   80107e70 <release>
+  for(i = 0; i < ncpu; i++)
+801045b1:	8b 0d c4 67 11 80    	mov    0x801167c4,%ecx
+801045b7:	83 c4 10             	add    $0x10,%esp
+801045ba:	85 c9                	test   %ecx,%ecx
+801045bc:	0f 8e 7e 02 00 00    	jle    80104840 <claim+0x340>
+  busy = -1;
+801045c2:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+801045c7:	89 7d e0             	mov    %edi,-0x20(%ebp)
+801045ca:	8d 04 b5 60 6e 11 80 	lea    -0x7fee91a0(,%esi,4),%eax
+801045d1:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801045d4:	89 d7                	mov    %edx,%edi
+801045d6:	eb 2e                	jmp    80104606 <claim+0x106>
+801045d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801045df:	90                   	nop
+       (busy < 0 || ptable.runq[i].nok[id] > ptable.runq[busy].nok[id]))
+801045e0:	69 cf 1e 10 00 00    	imul   $0x101e,%edi,%ecx
+801045e6:	8d 8c 0e 18 0a 00 00 	lea    0xa18(%esi,%ecx,1),%ecx
+801045ed:	3b 14 8d 78 6e 11 80 	cmp    -0x7fee9188(,%ecx,4),%edx
+801045f4:	0f 4f fb             	cmovg  %ebx,%edi
+  for(i = 0; i < ncpu; i++)
+801045f7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801045fa:	83 c3 01             	add    $0x1,%ebx
+801045fd:	05 78 40 00 00       	add    $0x4078,%eax
+80104602:	39 d3                	cmp    %edx,%ebx
+80104604:	74 2a                	je     80104630 <claim+0x130>
+    if(i != id && ptable.runq[i].nok[id] > 0 &&
+80104606:	39 de                	cmp    %ebx,%esi
+80104608:	74 ed                	je     801045f7 <claim+0xf7>
+8010460a:	8b 90 78 28 00 00    	mov    0x2878(%eax),%edx
+80104610:	85 d2                	test   %edx,%edx
+80104612:	7e e3                	jle    801045f7 <claim+0xf7>
+80104614:	85 ff                	test   %edi,%edi
+80104616:	79 c8                	jns    801045e0 <claim+0xe0>
+  for(i = 0; i < ncpu; i++)
+80104618:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010461b:	89 df                	mov    %ebx,%edi
+8010461d:	83 c3 01             	add    $0x1,%ebx
+80104620:	05 78 40 00 00       	add    $0x4078,%eax
+80104625:	39 d3                	cmp    %edx,%ebx
+80104627:	75 dd                	jne    80104606 <claim+0x106>
+80104629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(busy < 0)
+80104630:	89 f8                	mov    %edi,%eax
+80104632:	89 7d dc             	mov    %edi,-0x24(%ebp)
+80104635:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80104638:	85 c0                	test   %eax,%eax
+8010463a:	0f 88 00 02 00 00    	js     80104840 <claim+0x340>
+  vq = &ptable.runq[busy];
+80104640:	69 d0 78 40 00 00    	imul   $0x4078,%eax,%edx
+80104646:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80104649:	81 c2 9c 96 11 80    	add    $0x8011969c,%edx
+8010464f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  acquire(busy < id ? &vq->lock : &rq->lock);
+80104652:	39 c6                	cmp    %eax,%esi
+80104654:	0f 8f e6 00 00 00    	jg     80104740 <claim+0x240>
+8010465a:	83 ec 0c             	sub    $0xc,%esp
+8010465d:	57                   	push   %edi
+8010465e:	e8 6d 38 00 00       	call   80107ed0 <acquire>
+  acquire(busy < id ? &rq->lock : &vq->lock);
+80104663:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  acquire(busy < id ? &vq->lock : &rq->lock);
+80104666:	83 c4 10             	add    $0x10,%esp
+  acquire(busy < id ? &rq->lock : &vq->lock);
+80104669:	83 ec 0c             	sub    $0xc,%esp
+8010466c:	50                   	push   %eax
+8010466d:	e8 5e 38 00 00       	call   80107ed0 <acquire>
+  if(rq->nrun > 0){
+80104672:	69 c6 78 40 00 00    	imul   $0x4078,%esi,%eax
+80104678:	83 c4 10             	add    $0x10,%esp
+8010467b:	8b 90 d4 96 11 80    	mov    -0x7fee692c(%eax),%edx
+80104681:	85 d2                	test   %edx,%edx
+80104683:	0f 8f cf 00 00 00    	jg     80104758 <claim+0x258>
+  } else if(vq->nok[id] > 0){
+80104689:	8b 55 dc             	mov    -0x24(%ebp),%edx
+8010468c:	69 c2 1e 10 00 00    	imul   $0x101e,%edx,%eax
+80104692:	8d 84 06 18 0a 00 00 	lea    0xa18(%esi,%eax,1),%eax
+80104699:	8b 04 85 78 6e 11 80 	mov    -0x7fee9188(,%eax,4),%eax
+801046a0:	85 c0                	test   %eax,%eax
+801046a2:	0f 8e 68 01 00 00    	jle    80104810 <claim+0x310>
+    p = policy == SCHED_STRIDE ? vq->heap[0] : runqdraw(vq);
+801046a8:	83 3d ac 9b 13 80 01 	cmpl   $0x1,0x80139bac
+801046af:	0f 85 7b 01 00 00    	jne    80104830 <claim+0x330>
+801046b5:	69 c2 78 40 00 00    	imul   $0x4078,%edx,%eax
+801046bb:	8b 98 10 c7 11 80    	mov    -0x7fee38f0(%eax),%ebx
+  return (p->affinity >> i) & 1;
+801046c1:	8b 43 78             	mov    0x78(%ebx),%eax
+    if(!cpuok(p, id)){
+801046c4:	0f a3 f0             	bt     %esi,%eax
+801046c7:	0f 82 16 01 00 00    	jb     801047e3 <claim+0x2e3>
+      for(i = 0; i < vq->nrun; i++)
+801046cd:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+801046d0:	69 c3 78 40 00 00    	imul   $0x4078,%ebx,%eax
+801046d6:	8b 80 d4 96 11 80    	mov    -0x7fee692c(%eax),%eax
+801046dc:	85 c0                	test   %eax,%eax
+801046de:	0f 8e c9 34 00 00    	jle    80107bad <claim.cold>
+801046e4:	89 f1                	mov    %esi,%ecx
+801046e6:	ba 01 00 00 00       	mov    $0x1,%edx
+801046eb:	d3 e2                	shl    %cl,%edx
+801046ed:	69 cb 1e 10 00 00    	imul   $0x101e,%ebx,%ecx
+      p = 0;
+801046f3:	31 db                	xor    %ebx,%ebx
+801046f5:	89 d6                	mov    %edx,%esi
+801046f7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801046fa:	89 7d e0             	mov    %edi,-0x20(%ebp)
+801046fd:	01 c8                	add    %ecx,%eax
+801046ff:	81 c2 60 6e 11 80    	add    $0x80116e60,%edx
+80104705:	8d 04 85 60 6e 11 80 	lea    -0x7fee91a0(,%eax,4),%eax
+8010470c:	89 c7                	mov    %eax,%edi
+8010470e:	eb 14                	jmp    80104724 <claim+0x224>
+        if(cpuok(vq->heap[i], id) && (p == 0 || passbefore(vq->heap[i]->pass, p->pass)))
+80104710:	8b 4b 6c             	mov    0x6c(%ebx),%ecx
+80104713:	39 48 6c             	cmp    %ecx,0x6c(%eax)
+80104716:	0f 48 d8             	cmovs  %eax,%ebx
+      for(i = 0; i < vq->nrun; i++)
+80104719:	83 c2 04             	add    $0x4,%edx
+8010471c:	39 d7                	cmp    %edx,%edi
+8010471e:	0f 84 bc 00 00 00    	je     801047e0 <claim+0x2e0>
+        if(cpuok(vq->heap[i], id) && (p == 0 || passbefore(vq->heap[i]->pass, p->pass)))
+80104724:	8b 82 b0 58 00 00    	mov    0x58b0(%edx),%eax
+8010472a:	89 f1                	mov    %esi,%ecx
+8010472c:	23 48 78             	and    0x78(%eax),%ecx
+8010472f:	74 e8                	je     80104719 <claim+0x219>
+80104731:	85 db                	test   %ebx,%ebx
+80104733:	75 db                	jne    80104710 <claim+0x210>
+80104735:	89 c3                	mov    %eax,%ebx
+80104737:	eb e0                	jmp    80104719 <claim+0x219>
+80104739:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  acquire(busy < id ? &vq->lock : &rq->lock);
+80104740:	83 ec 0c             	sub    $0xc,%esp
+80104743:	52                   	push   %edx
+80104744:	e8 87 37 00 00       	call   80107ed0 <acquire>
+80104749:	83 c4 10             	add    $0x10,%esp
+  acquire(busy < id ? &rq->lock : &vq->lock);
+8010474c:	89 f8                	mov    %edi,%eax
+8010474e:	e9 16 ff ff ff       	jmp    80104669 <claim+0x169>
+80104753:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104757:	90                   	nop
+  if(policy == SCHED_STRIDE)
+80104758:	83 3d ac 9b 13 80 01 	cmpl   $0x1,0x80139bac
+8010475f:	0f 85 b3 00 00 00    	jne    80104818 <claim+0x318>
+    p = rq->heap[0];
+80104765:	8b 98 10 c7 11 80    	mov    -0x7fee38f0(%eax),%ebx
+  rq->pass = p->pass;
+8010476b:	69 f6 78 40 00 00    	imul   $0x4078,%esi,%esi
+80104771:	8b 4b 6c             	mov    0x6c(%ebx),%ecx
+80104774:	89 8e 10 d7 11 80    	mov    %ecx,-0x7fee28f0(%esi)
+  p->pass += stride(p->weight);
+8010477a:	8b 73 60             	mov    0x60(%ebx),%esi
+  if(t <= 0)
+8010477d:	85 f6                	test   %esi,%esi
+8010477f:	0f 8e c2 00 00 00    	jle    80104847 <claim+0x347>
+    return 1;
+80104785:	b8 01 00 00 00       	mov    $0x1,%eax
+  if(t >= STRIDE1)
+8010478a:	81 fe ff ff 3f 00    	cmp    $0x3fffff,%esi
+80104790:	7f 09                	jg     8010479b <claim+0x29b>
+  return STRIDE1 / t;
+80104792:	b8 00 00 40 00       	mov    $0x400000,%eax
+80104797:	31 d2                	xor    %edx,%edx
+80104799:	f7 fe                	idiv   %esi
+  p->pass += stride(p->weight);
+8010479b:	01 c1                	add    %eax,%ecx
+    rqremove(rq, p);
+8010479d:	89 da                	mov    %ebx,%edx
+8010479f:	89 f8                	mov    %edi,%eax
+  p->pass += stride(p->weight);
+801047a1:	89 4b 6c             	mov    %ecx,0x6c(%ebx)
+    rqremove(rq, p);
+801047a4:	e8 87 fc ff ff       	call   80104430 <rqremove>
+  release(&vq->lock);
+801047a9:	83 ec 0c             	sub    $0xc,%esp
+801047ac:	ff 75 e4             	push   -0x1c(%ebp)
+801047af:	e8 bc 36 00 00       	call   80107e70 <release>
+  release(&rq->lock);
+801047b4:	89 3c 24             	mov    %edi,(%esp)
+801047b7:	e8 b4 36 00 00       	call   80107e70 <release>
+  return p;
+801047bc:	83 c4 10             	add    $0x10,%esp
+}
+801047bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801047c2:	89 d8                	mov    %ebx,%eax
+801047c4:	5b                   	pop    %ebx
+801047c5:	5e                   	pop    %esi
+801047c6:	5f                   	pop    %edi
+801047c7:	5d                   	pop    %ebp
+801047c8:	c3                   	ret
+801047c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return STRIDE1;
+801047d0:	b8 00 00 40 00       	mov    $0x400000,%eax
+801047d5:	e9 95 fd ff ff       	jmp    8010456f <claim+0x6f>
+801047da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801047e0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    p->pass += stride(p->weight);
+801047e3:	8b 4b 60             	mov    0x60(%ebx),%ecx
+  if(t <= 0)
+801047e6:	85 c9                	test   %ecx,%ecx
+801047e8:	7e 67                	jle    80104851 <claim+0x351>
+    return 1;
+801047ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  if(t >= STRIDE1)
+801047ef:	81 f9 ff ff 3f 00    	cmp    $0x3fffff,%ecx
+801047f5:	7f 09                	jg     80104800 <claim+0x300>
+  return STRIDE1 / t;
+801047f7:	b8 00 00 40 00       	mov    $0x400000,%eax
+801047fc:	31 d2                	xor    %edx,%edx
+801047fe:	f7 f9                	idiv   %ecx
+    p->pass += stride(p->weight);
+80104800:	01 43 6c             	add    %eax,0x6c(%ebx)
+    rqremove(vq, p);
+80104803:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104806:	89 da                	mov    %ebx,%edx
+80104808:	e8 23 fc ff ff       	call   80104430 <rqremove>
+8010480d:	eb 9a                	jmp    801047a9 <claim+0x2a9>
+8010480f:	90                   	nop
+  p = 0;
+80104810:	31 db                	xor    %ebx,%ebx
+80104812:	eb 95                	jmp    801047a9 <claim+0x2a9>
+80104814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    p = runqdraw(rq);
+80104818:	89 f8                	mov    %edi,%eax
+8010481a:	e8 81 f8 ff ff       	call   801040a0 <runqdraw>
+8010481f:	89 c3                	mov    %eax,%ebx
+80104821:	e9 45 ff ff ff       	jmp    8010476b <claim+0x26b>
+80104826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010482d:	8d 76 00             	lea    0x0(%esi),%esi
+    p = policy == SCHED_STRIDE ? vq->heap[0] : runqdraw(vq);
+80104830:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104833:	e8 68 f8 ff ff       	call   801040a0 <runqdraw>
+80104838:	89 c3                	mov    %eax,%ebx
+8010483a:	e9 82 fe ff ff       	jmp    801046c1 <claim+0x1c1>
+8010483f:	90                   	nop
+    return 0;
+80104840:	31 db                	xor    %ebx,%ebx
+80104842:	e9 42 fd ff ff       	jmp    80104589 <claim+0x89>
+    return STRIDE1;
+80104847:	b8 00 00 40 00       	mov    $0x400000,%eax
+8010484c:	e9 4a ff ff ff       	jmp    8010479b <claim+0x29b>
+80104851:	b8 00 00 40 00       	mov    $0x400000,%eax
+80104856:	eb a8                	jmp    80104800 <claim+0x300>
+80104858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010485f:	90                   	nop
+
+80104860 <handoff>:
+{
+80104860:	55                   	push   %ebp
+80104861:	89 e5                	mov    %esp,%ebp
+80104863:	57                   	push   %edi
+80104864:	56                   	push   %esi
+80104865:	53                   	push   %ebx
+80104866:	83 ec 1c             	sub    $0x1c,%esp
+  p = *pp;
+80104869:	8b 1a                	mov    (%edx),%ebx
+  *pp = 0;
+8010486b:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  if(p == 0 || p->state != RUNNABLE || !cpuok(p, c - cpus) || !dequeue(p))
+80104871:	85 db                	test   %ebx,%ebx
+80104873:	0f 84 a3 00 00 00    	je     8010491c <handoff+0xbc>
+80104879:	83 7b 08 03          	cmpl   $0x3,0x8(%ebx)
+8010487d:	0f 85 99 00 00 00    	jne    8010491c <handoff+0xbc>
+80104883:	2d e0 67 11 80       	sub    $0x801167e0,%eax
+80104888:	c1 f8 04             	sar    $0x4,%eax
+8010488b:	69 c8 c5 4e ec c4    	imul   $0xc4ec4ec5,%eax,%ecx
+  return (p->affinity >> i) & 1;
+80104891:	8b 43 78             	mov    0x78(%ebx),%eax
+80104894:	d3 e8                	shr    %cl,%eax
+  if(p == 0 || p->state != RUNNABLE || !cpuok(p, c - cpus) || !dequeue(p))
+80104896:	83 e0 01             	and    $0x1,%eax
+80104899:	89 c6                	mov    %eax,%esi
+8010489b:	74 7f                	je     8010491c <handoff+0xbc>
+  q = *(volatile int*)&p->rq;
+8010489d:	8b 43 64             	mov    0x64(%ebx),%eax
+  if(q < 0)
+801048a0:	85 c0                	test   %eax,%eax
+801048a2:	78 78                	js     8010491c <handoff+0xbc>
+  rq = &ptable.runq[q];
+801048a4:	69 f8 78 40 00 00    	imul   $0x4078,%eax,%edi
+  acquire(&rq->lock);
+801048aa:	83 ec 0c             	sub    $0xc,%esp
+  rq = &ptable.runq[q];
+801048ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801048b0:	81 c7 9c 96 11 80    	add    $0x8011969c,%edi
+  acquire(&rq->lock);
+801048b6:	57                   	push   %edi
+801048b7:	e8 14 36 00 00       	call   80107ed0 <acquire>
+  if(p->rq == q)
+801048bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801048bf:	83 c4 10             	add    $0x10,%esp
+801048c2:	3b 43 64             	cmp    0x64(%ebx),%eax
+801048c5:	75 49                	jne    80104910 <handoff+0xb0>
+  rqremove(rq, p);
+801048c7:	89 da                	mov    %ebx,%edx
+801048c9:	89 f8                	mov    %edi,%eax
+801048cb:	e8 60 fb ff ff       	call   80104430 <rqremove>
+  release(&rq->lock);
+801048d0:	83 ec 0c             	sub    $0xc,%esp
+801048d3:	57                   	push   %edi
+801048d4:	e8 97 35 00 00       	call   80107e70 <release>
+  p->pass += stride(ptickets(p));
+801048d9:	89 d8                	mov    %ebx,%eax
+801048db:	e8 80 f9 ff ff       	call   80104260 <ptickets>
+  if(t <= 0)
+801048e0:	83 c4 10             	add    $0x10,%esp
+  p->pass += stride(ptickets(p));
+801048e3:	89 c1                	mov    %eax,%ecx
+  if(t <= 0)
+801048e5:	85 c0                	test   %eax,%eax
+801048e7:	7e 47                	jle    80104930 <handoff+0xd0>
+  if(t >= STRIDE1)
+801048e9:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+801048ee:	7f 0b                	jg     801048fb <handoff+0x9b>
+  return STRIDE1 / t;
+801048f0:	b8 00 00 40 00       	mov    $0x400000,%eax
+801048f5:	31 d2                	xor    %edx,%edx
+801048f7:	f7 f9                	idiv   %ecx
+801048f9:	89 c6                	mov    %eax,%esi
+  p->pass += stride(ptickets(p));
+801048fb:	01 73 6c             	add    %esi,0x6c(%ebx)
+}
+801048fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104901:	89 d8                	mov    %ebx,%eax
+80104903:	5b                   	pop    %ebx
+80104904:	5e                   	pop    %esi
+80104905:	5f                   	pop    %edi
+80104906:	5d                   	pop    %ebp
+80104907:	c3                   	ret
+80104908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010490f:	90                   	nop
+  release(&rq->lock);
+80104910:	83 ec 0c             	sub    $0xc,%esp
+80104913:	57                   	push   %edi
+80104914:	e8 57 35 00 00       	call   80107e70 <release>
+  return 0;
+80104919:	83 c4 10             	add    $0x10,%esp
+}
+8010491c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+8010491f:	31 db                	xor    %ebx,%ebx
+}
+80104921:	89 d8                	mov    %ebx,%eax
+80104923:	5b                   	pop    %ebx
+80104924:	5e                   	pop    %esi
+80104925:	5f                   	pop    %edi
+80104926:	5d                   	pop    %ebp
+80104927:	c3                   	ret
+80104928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010492f:	90                   	nop
+    return STRIDE1;
+80104930:	be 00 00 40 00       	mov    $0x400000,%esi
+80104935:	eb c4                	jmp    801048fb <handoff+0x9b>
+80104937:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010493e:	66 90                	xchg   %ax,%ax
+
+80104940 <pickrunq>:
+{
+80104940:	55                   	push   %ebp
+80104941:	89 e5                	mov    %esp,%ebp
+80104943:	57                   	push   %edi
+80104944:	56                   	push   %esi
+80104945:	53                   	push   %ebx
+80104946:	83 ec 2c             	sub    $0x2c,%esp
+  for(i = 0; i < ncpu; i++)
+80104949:	8b 0d c4 67 11 80    	mov    0x801167c4,%ecx
+{
+8010494f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 0; i < ncpu; i++)
+80104952:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80104955:	85 c9                	test   %ecx,%ecx
+80104957:	0f 8e 73 01 00 00    	jle    80104ad0 <pickrunq+0x190>
+  return (p->affinity >> i) & 1;
+8010495d:	8b 48 78             	mov    0x78(%eax),%ecx
+  light = -1;
+80104960:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  for(i = 0; i < ncpu; i++)
+80104965:	31 db                	xor    %ebx,%ebx
+80104967:	e9 97 00 00 00       	jmp    80104a03 <pickrunq+0xc3>
+8010496c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  n = ptable.runq[i].total;
+80104970:	69 c3 78 40 00 00    	imul   $0x4078,%ebx,%eax
+80104976:	8b 80 d0 96 11 80    	mov    -0x7fee6930(%eax),%eax
+8010497c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  if(cpus[i].proc && cpus[i].proc != p)
+8010497f:	69 c3 d0 00 00 00    	imul   $0xd0,%ebx,%eax
+80104985:	8b b0 8c 68 11 80    	mov    -0x7fee9774(%eax),%esi
+8010498b:	39 75 e0             	cmp    %esi,-0x20(%ebp)
+8010498e:	74 21                	je     801049b1 <pickrunq+0x71>
+80104990:	85 f6                	test   %esi,%esi
+80104992:	74 1d                	je     801049b1 <pickrunq+0x71>
+    n += pbase(cpus[i].proc) + cpus[i].proc->borrowed;
+80104994:	8b 96 8c 00 00 00    	mov    0x8c(%esi),%edx
+8010499a:	8b 46 58             	mov    0x58(%esi),%eax
+8010499d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+801049a0:	e8 5b f8 ff ff       	call   80104200 <pbase.isra.0>
+801049a5:	03 86 94 00 00 00    	add    0x94(%esi),%eax
+801049ab:	01 45 d8             	add    %eax,-0x28(%ebp)
+801049ae:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  n = ptable.runq[i].total;
+801049b1:	69 c7 78 40 00 00    	imul   $0x4078,%edi,%eax
+801049b7:	8b 80 d0 96 11 80    	mov    -0x7fee6930(%eax),%eax
+801049bd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if(cpus[i].proc && cpus[i].proc != p)
+801049c0:	69 c7 d0 00 00 00    	imul   $0xd0,%edi,%eax
+801049c6:	8b b0 8c 68 11 80    	mov    -0x7fee9774(%eax),%esi
+801049cc:	39 75 e0             	cmp    %esi,-0x20(%ebp)
+801049cf:	74 21                	je     801049f2 <pickrunq+0xb2>
+801049d1:	85 f6                	test   %esi,%esi
+801049d3:	74 1d                	je     801049f2 <pickrunq+0xb2>
+    n += pbase(cpus[i].proc) + cpus[i].proc->borrowed;
+801049d5:	8b 96 8c 00 00 00    	mov    0x8c(%esi),%edx
+801049db:	8b 46 58             	mov    0x58(%esi),%eax
+801049de:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+801049e1:	e8 1a f8 ff ff       	call   80104200 <pbase.isra.0>
+801049e6:	03 86 94 00 00 00    	add    0x94(%esi),%eax
+801049ec:	01 45 dc             	add    %eax,-0x24(%ebp)
+801049ef:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    if(cpuok(p, i) && (light < 0 || cpuload(i, p) < cpuload(light, p)))
+801049f2:	8b 75 d8             	mov    -0x28(%ebp),%esi
+801049f5:	39 75 dc             	cmp    %esi,-0x24(%ebp)
+801049f8:	0f 4f fb             	cmovg  %ebx,%edi
+  for(i = 0; i < ncpu; i++)
+801049fb:	83 c3 01             	add    $0x1,%ebx
+801049fe:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+80104a01:	74 1d                	je     80104a20 <pickrunq+0xe0>
+    if(cpuok(p, i) && (light < 0 || cpuload(i, p) < cpuload(light, p)))
+80104a03:	0f a3 d9             	bt     %ebx,%ecx
+80104a06:	73 f3                	jae    801049fb <pickrunq+0xbb>
+80104a08:	85 ff                	test   %edi,%edi
+80104a0a:	0f 89 60 ff ff ff    	jns    80104970 <pickrunq+0x30>
+80104a10:	89 df                	mov    %ebx,%edi
+  for(i = 0; i < ncpu; i++)
+80104a12:	83 c3 01             	add    $0x1,%ebx
+80104a15:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+80104a18:	75 e9                	jne    80104a03 <pickrunq+0xc3>
+80104a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  q = p->cpu;
+80104a20:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80104a23:	8b 71 68             	mov    0x68(%ecx),%esi
+  if(q < 0 || !cpuok(p, q) || cpuload(q, p) - cpuload(light, p) > ptickets(p))
+80104a26:	85 f6                	test   %esi,%esi
+80104a28:	0f 88 95 00 00 00    	js     80104ac3 <pickrunq+0x183>
+  return (p->affinity >> i) & 1;
+80104a2e:	8b 41 78             	mov    0x78(%ecx),%eax
+  if(q < 0 || !cpuok(p, q) || cpuload(q, p) - cpuload(light, p) > ptickets(p))
+80104a31:	0f a3 f0             	bt     %esi,%eax
+80104a34:	0f 83 89 00 00 00    	jae    80104ac3 <pickrunq+0x183>
+  n = ptable.runq[i].total;
+80104a3a:	69 c6 78 40 00 00    	imul   $0x4078,%esi,%eax
+80104a40:	8b 80 d0 96 11 80    	mov    -0x7fee6930(%eax),%eax
+80104a46:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(cpus[i].proc && cpus[i].proc != p)
+80104a49:	69 c6 d0 00 00 00    	imul   $0xd0,%esi,%eax
+80104a4f:	8b 98 8c 68 11 80    	mov    -0x7fee9774(%eax),%ebx
+80104a55:	39 d9                	cmp    %ebx,%ecx
+80104a57:	74 1b                	je     80104a74 <pickrunq+0x134>
+80104a59:	85 db                	test   %ebx,%ebx
+80104a5b:	74 17                	je     80104a74 <pickrunq+0x134>
+    n += pbase(cpus[i].proc) + cpus[i].proc->borrowed;
+80104a5d:	8b 93 8c 00 00 00    	mov    0x8c(%ebx),%edx
+80104a63:	8b 43 58             	mov    0x58(%ebx),%eax
+80104a66:	e8 95 f7 ff ff       	call   80104200 <pbase.isra.0>
+80104a6b:	03 83 94 00 00 00    	add    0x94(%ebx),%eax
+80104a71:	01 45 e4             	add    %eax,-0x1c(%ebp)
+  n = ptable.runq[i].total;
+80104a74:	69 c7 78 40 00 00    	imul   $0x4078,%edi,%eax
+80104a7a:	8b 88 d0 96 11 80    	mov    -0x7fee6930(%eax),%ecx
+  if(cpus[i].proc && cpus[i].proc != p)
+80104a80:	69 c7 d0 00 00 00    	imul   $0xd0,%edi,%eax
+80104a86:	8b 98 8c 68 11 80    	mov    -0x7fee9774(%eax),%ebx
+80104a8c:	39 5d e0             	cmp    %ebx,-0x20(%ebp)
+80104a8f:	74 20                	je     80104ab1 <pickrunq+0x171>
+80104a91:	85 db                	test   %ebx,%ebx
+80104a93:	74 1c                	je     80104ab1 <pickrunq+0x171>
+    n += pbase(cpus[i].proc) + cpus[i].proc->borrowed;
+80104a95:	8b 93 8c 00 00 00    	mov    0x8c(%ebx),%edx
+80104a9b:	8b 43 58             	mov    0x58(%ebx),%eax
+80104a9e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+80104aa1:	e8 5a f7 ff ff       	call   80104200 <pbase.isra.0>
+80104aa6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+80104aa9:	03 83 94 00 00 00    	add    0x94(%ebx),%eax
+80104aaf:	01 c1                	add    %eax,%ecx
+  if(q < 0 || !cpuok(p, q) || cpuload(q, p) - cpuload(light, p) > ptickets(p))
+80104ab1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80104ab4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80104ab7:	29 cb                	sub    %ecx,%ebx
+80104ab9:	e8 a2 f7 ff ff       	call   80104260 <ptickets>
+80104abe:	39 c3                	cmp    %eax,%ebx
+80104ac0:	0f 4e fe             	cmovle %esi,%edi
+}
+80104ac3:	83 c4 2c             	add    $0x2c,%esp
+80104ac6:	89 f8                	mov    %edi,%eax
+80104ac8:	5b                   	pop    %ebx
+80104ac9:	5e                   	pop    %esi
+80104aca:	5f                   	pop    %edi
+80104acb:	5d                   	pop    %ebp
+80104acc:	c3                   	ret
+80104acd:	8d 76 00             	lea    0x0(%esi),%esi
+  light = -1;
+80104ad0:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80104ad5:	e9 46 ff ff ff       	jmp    80104a20 <pickrunq+0xe0>
+80104ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104ae0 <reweigh>:
+{
+80104ae0:	55                   	push   %ebp
+80104ae1:	89 e5                	mov    %esp,%ebp
+80104ae3:	57                   	push   %edi
+80104ae4:	56                   	push   %esi
+80104ae5:	53                   	push   %ebx
+80104ae6:	83 ec 1c             	sub    $0x1c,%esp
+  q = *(volatile int*)&p->rq;
+80104ae9:	8b 78 64             	mov    0x64(%eax),%edi
+  if(q < 0)
+80104aec:	85 ff                	test   %edi,%edi
+80104aee:	78 4c                	js     80104b3c <reweigh+0x5c>
+80104af0:	89 c3                	mov    %eax,%ebx
+  w = ptickets(p);
+80104af2:	e8 69 f7 ff ff       	call   80104260 <ptickets>
+  acquire(&rq->lock);
+80104af7:	83 ec 0c             	sub    $0xc,%esp
+  w = ptickets(p);
+80104afa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  rq = &ptable.runq[q];
+80104afd:	69 c7 78 40 00 00    	imul   $0x4078,%edi,%eax
+80104b03:	8d b0 9c 96 11 80    	lea    -0x7fee6964(%eax),%esi
+80104b09:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80104b0c:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  acquire(&rq->lock);
+80104b0f:	56                   	push   %esi
+80104b10:	e8 bb 33 00 00       	call   80107ed0 <acquire>
+  if(p->rq == q)
+80104b15:	83 c4 10             	add    $0x10,%esp
+80104b18:	3b 7b 64             	cmp    0x64(%ebx),%edi
+80104b1b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80104b1e:	0f 85 8c 00 00 00    	jne    80104bb0 <reweigh+0xd0>
+  if(w != p->weight){
+80104b24:	8b 4b 60             	mov    0x60(%ebx),%ecx
+80104b27:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80104b2a:	39 f1                	cmp    %esi,%ecx
+80104b2c:	75 1a                	jne    80104b48 <reweigh+0x68>
+  release(&rq->lock);
+80104b2e:	83 ec 0c             	sub    $0xc,%esp
+80104b31:	ff 75 e0             	push   -0x20(%ebp)
+80104b34:	e8 37 33 00 00       	call   80107e70 <release>
+80104b39:	83 c4 10             	add    $0x10,%esp
+}
+80104b3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104b3f:	5b                   	pop    %ebx
+80104b40:	5e                   	pop    %esi
+80104b41:	5f                   	pop    %edi
+80104b42:	5d                   	pop    %ebp
+80104b43:	c3                   	ret
+80104b44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    treeadd(rq, p->level, p->slot, w - p->weight);
+80104b48:	29 ce                	sub    %ecx,%esi
+80104b4a:	8b 4b 20             	mov    0x20(%ebx),%ecx
+  rq->ltotal[l] += delta;
+80104b4d:	69 d7 1e 10 00 00    	imul   $0x101e,%edi,%edx
+    treeadd(rq, p->level, p->slot, w - p->weight);
+80104b53:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+80104b56:	8b 8b 84 00 00 00    	mov    0x84(%ebx),%ecx
+  rq->total += delta;
+80104b5c:	01 b0 d0 96 11 80    	add    %esi,-0x7fee6930(%eax)
+  rq->ltotal[l] += delta;
+80104b62:	8d 94 11 20 0a 00 00 	lea    0xa20(%ecx,%edx,1),%edx
+80104b69:	69 c9 04 10 00 00    	imul   $0x1004,%ecx,%ecx
+80104b6f:	01 34 95 78 6e 11 80 	add    %esi,-0x7fee9188(,%edx,4)
+  tree = rq->tree[l];
+80104b76:	8d 8c 08 a4 28 00 00 	lea    0x28a4(%eax,%ecx,1),%ecx
+  for(i++; i <= NPROC; i += i & -i)
+80104b7d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80104b80:	83 c0 01             	add    $0x1,%eax
+80104b83:	3d 00 04 00 00       	cmp    $0x400,%eax
+80104b88:	7f 1c                	jg     80104ba6 <reweigh+0xc6>
+80104b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80104b90:	89 c2                	mov    %eax,%edx
+    tree[i] += delta;
+80104b92:	01 b4 81 60 6e 11 80 	add    %esi,-0x7fee91a0(%ecx,%eax,4)
+  for(i++; i <= NPROC; i += i & -i)
+80104b99:	f7 da                	neg    %edx
+80104b9b:	21 c2                	and    %eax,%edx
+80104b9d:	01 d0                	add    %edx,%eax
+80104b9f:	3d 00 04 00 00       	cmp    $0x400,%eax
+80104ba4:	7e ea                	jle    80104b90 <reweigh+0xb0>
+    p->weight = w;
+80104ba6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104ba9:	89 43 60             	mov    %eax,0x60(%ebx)
+80104bac:	eb 80                	jmp    80104b2e <reweigh+0x4e>
+80104bae:	66 90                	xchg   %ax,%ax
+  release(&rq->lock);
+80104bb0:	83 ec 0c             	sub    $0xc,%esp
+80104bb3:	56                   	push   %esi
+80104bb4:	e8 b7 32 00 00       	call   80107e70 <release>
+80104bb9:	83 c4 10             	add    $0x10,%esp
+}
+80104bbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104bbf:	5b                   	pop    %ebx
+80104bc0:	5e                   	pop    %esi
+80104bc1:	5f                   	pop    %edi
+80104bc2:	5d                   	pop    %ebp
+80104bc3:	c3                   	ret
+80104bc4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104bcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104bcf:	90                   	nop
+
+80104bd0 <lend>:
+{
+80104bd0:	55                   	push   %ebp
+80104bd1:	89 e5                	mov    %esp,%ebp
+80104bd3:	57                   	push   %edi
+80104bd4:	56                   	push   %esi
+80104bd5:	89 d6                	mov    %edx,%esi
+80104bd7:	53                   	push   %ebx
+80104bd8:	89 c3                	mov    %eax,%ebx
+80104bda:	83 ec 0c             	sub    $0xc,%esp
+  q = p->lendto;
+80104bdd:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  if(q == 0)
+80104be3:	85 c0                	test   %eax,%eax
+80104be5:	74 15                	je     80104bfc <lend+0x2c>
+  if(q->pid == p->lendpid){
+80104be7:	8b bb 9c 00 00 00    	mov    0x9c(%ebx),%edi
+80104bed:	39 78 0c             	cmp    %edi,0xc(%eax)
+80104bf0:	74 5e                	je     80104c50 <lend+0x80>
+  p->lendto = 0;
+80104bf2:	c7 83 98 00 00 00 00 	movl   $0x0,0x98(%ebx)
+80104bf9:	00 00 00 
+  p->lent = p->borrowed < MAXWEIGHT - pbase(p) ? pbase(p) + p->borrowed : MAXWEIGHT;
+80104bfc:	8b 93 8c 00 00 00    	mov    0x8c(%ebx),%edx
+80104c02:	8b 43 58             	mov    0x58(%ebx),%eax
+80104c05:	8b bb 94 00 00 00    	mov    0x94(%ebx),%edi
+80104c0b:	e8 f0 f5 ff ff       	call   80104200 <pbase.isra.0>
+80104c10:	ba ff ff 1f 00       	mov    $0x1fffff,%edx
+  p->lendto = q;
+80104c15:	89 b3 98 00 00 00    	mov    %esi,0x98(%ebx)
+  p->lent = p->borrowed < MAXWEIGHT - pbase(p) ? pbase(p) + p->borrowed : MAXWEIGHT;
+80104c1b:	89 d1                	mov    %edx,%ecx
+80104c1d:	29 c1                	sub    %eax,%ecx
+80104c1f:	01 f8                	add    %edi,%eax
+80104c21:	39 cf                	cmp    %ecx,%edi
+80104c23:	0f 4d c2             	cmovge %edx,%eax
+80104c26:	89 83 a0 00 00 00    	mov    %eax,0xa0(%ebx)
+  p->lendpid = q->pid;
+80104c2c:	8b 56 0c             	mov    0xc(%esi),%edx
+80104c2f:	89 93 9c 00 00 00    	mov    %edx,0x9c(%ebx)
+  q->borrowed += p->lent;
+80104c35:	01 86 94 00 00 00    	add    %eax,0x94(%esi)
+}
+80104c3b:	83 c4 0c             	add    $0xc,%esp
+  reweigh(q);
+80104c3e:	89 f0                	mov    %esi,%eax
+}
+80104c40:	5b                   	pop    %ebx
+80104c41:	5e                   	pop    %esi
+80104c42:	5f                   	pop    %edi
+80104c43:	5d                   	pop    %ebp
+  reweigh(q);
+80104c44:	e9 97 fe ff ff       	jmp    80104ae0 <reweigh>
+80104c49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    q->borrowed -= p->lent;
+80104c50:	8b 93 a0 00 00 00    	mov    0xa0(%ebx),%edx
+80104c56:	29 90 94 00 00 00    	sub    %edx,0x94(%eax)
+    reweigh(q);
+80104c5c:	e8 7f fe ff ff       	call   80104ae0 <reweigh>
+80104c61:	eb 8f                	jmp    80104bf2 <lend+0x22>
+80104c63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104c70 <setgroup>:
+{
+80104c70:	55                   	push   %ebp
+80104c71:	89 e5                	mov    %esp,%ebp
+80104c73:	57                   	push   %edi
+80104c74:	89 c7                	mov    %eax,%edi
+80104c76:	56                   	push   %esi
+80104c77:	53                   	push   %ebx
+80104c78:	83 ec 1c             	sub    $0x1c,%esp
+  if(p->group){
+80104c7b:	8b 98 8c 00 00 00    	mov    0x8c(%eax),%ebx
+80104c81:	85 db                	test   %ebx,%ebx
+80104c83:	74 62                	je     80104ce7 <setgroup+0x77>
+    g = &ptable.group[p->group - 1];
+80104c85:	83 eb 01             	sub    $0x1,%ebx
+    for(pp = &g->members; *pp != p; pp = &(*pp)->gnext)
+80104c88:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+80104c8b:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+80104c8e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80104c91:	c1 e1 02             	shl    $0x2,%ecx
+80104c94:	8b 81 64 9a 13 80    	mov    -0x7fec659c(%ecx),%eax
+80104c9a:	39 c7                	cmp    %eax,%edi
+80104c9c:	0f 84 de 00 00 00    	je     80104d80 <setgroup+0x110>
+80104ca2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80104ca8:	89 c1                	mov    %eax,%ecx
+80104caa:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+80104cb0:	39 c7                	cmp    %eax,%edi
+80104cb2:	75 f4                	jne    80104ca8 <setgroup+0x38>
+80104cb4:	81 c1 90 00 00 00    	add    $0x90,%ecx
+    *pp = p->gnext;
+80104cba:	8b 87 90 00 00 00    	mov    0x90(%edi),%eax
+80104cc0:	89 01                	mov    %eax,(%ecx)
+  return p->state == RUNNABLE || p->state == RUNNING;
+80104cc2:	8b 47 08             	mov    0x8(%edi),%eax
+80104cc5:	83 e8 03             	sub    $0x3,%eax
+    if(isactive(p))
+80104cc8:	83 f8 01             	cmp    $0x1,%eax
+80104ccb:	0f 86 bf 00 00 00    	jbe    80104d90 <setgroup+0x120>
+    if(g->members == 0)
+80104cd1:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80104cd4:	01 de                	add    %ebx,%esi
+80104cd6:	8d 04 b5 60 6e 11 80 	lea    -0x7fee91a0(,%esi,4),%eax
+80104cdd:	8b 88 04 2c 02 00    	mov    0x22c04(%eax),%ecx
+80104ce3:	85 c9                	test   %ecx,%ecx
+80104ce5:	74 51                	je     80104d38 <setgroup+0xc8>
+  p->group = gid;
+80104ce7:	89 97 8c 00 00 00    	mov    %edx,0x8c(%edi)
+  p->gnext = 0;
+80104ced:	c7 87 90 00 00 00 00 	movl   $0x0,0x90(%edi)
+80104cf4:	00 00 00 
+  if(gid){
+80104cf7:	85 d2                	test   %edx,%edx
+80104cf9:	74 28                	je     80104d23 <setgroup+0xb3>
+    p->gnext = g->members;
+80104cfb:	8d 44 52 fd          	lea    -0x3(%edx,%edx,2),%eax
+80104cff:	8d 14 85 60 6e 11 80 	lea    -0x7fee91a0(,%eax,4),%edx
+80104d06:	8b 82 04 2c 02 00    	mov    0x22c04(%edx),%eax
+80104d0c:	89 87 90 00 00 00    	mov    %eax,0x90(%edi)
+    g->members = p;
+80104d12:	89 ba 04 2c 02 00    	mov    %edi,0x22c04(%edx)
+  return p->state == RUNNABLE || p->state == RUNNING;
+80104d18:	8b 47 08             	mov    0x8(%edi),%eax
+80104d1b:	83 e8 03             	sub    $0x3,%eax
+    if(isactive(p))
+80104d1e:	83 f8 01             	cmp    $0x1,%eax
+80104d21:	76 25                	jbe    80104d48 <setgroup+0xd8>
+}
+80104d23:	83 c4 1c             	add    $0x1c,%esp
+  reweigh(p);
+80104d26:	89 f8                	mov    %edi,%eax
+}
+80104d28:	5b                   	pop    %ebx
+80104d29:	5e                   	pop    %esi
+80104d2a:	5f                   	pop    %edi
+80104d2b:	5d                   	pop    %ebp
+  reweigh(p);
+80104d2c:	e9 af fd ff ff       	jmp    80104ae0 <reweigh>
+80104d31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      g->tickets = 0;
+80104d38:	c7 80 fc 2b 02 00 00 	movl   $0x0,0x22bfc(%eax)
+80104d3f:	00 00 00 
+80104d42:	eb a3                	jmp    80104ce7 <setgroup+0x77>
+80104d44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ptable.group[gid - 1].active += delta;
+80104d48:	8b 47 58             	mov    0x58(%edi),%eax
+80104d4b:	01 82 00 2c 02 00    	add    %eax,0x22c00(%edx)
+80104d51:	89 fb                	mov    %edi,%ebx
+80104d53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104d57:	90                   	nop
+    reweigh(p);
+80104d58:	89 d8                	mov    %ebx,%eax
+80104d5a:	e8 81 fd ff ff       	call   80104ae0 <reweigh>
+  for(p = ptable.group[gid - 1].members; p; p = p->gnext)
+80104d5f:	8b 9b 90 00 00 00    	mov    0x90(%ebx),%ebx
+80104d65:	85 db                	test   %ebx,%ebx
+80104d67:	75 ef                	jne    80104d58 <setgroup+0xe8>
+}
+80104d69:	83 c4 1c             	add    $0x1c,%esp
+  reweigh(p);
+80104d6c:	89 f8                	mov    %edi,%eax
+}
+80104d6e:	5b                   	pop    %ebx
+80104d6f:	5e                   	pop    %esi
+80104d70:	5f                   	pop    %edi
+80104d71:	5d                   	pop    %ebp
+  reweigh(p);
+80104d72:	e9 69 fd ff ff       	jmp    80104ae0 <reweigh>
+80104d77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104d7e:	66 90                	xchg   %ax,%ax
+    for(pp = &g->members; *pp != p; pp = &(*pp)->gnext)
+80104d80:	81 c1 64 9a 13 80    	add    $0x80139a64,%ecx
+80104d86:	e9 2f ff ff ff       	jmp    80104cba <setgroup+0x4a>
+80104d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104d8f:	90                   	nop
+  ptable.group[gid - 1].active += delta;
+80104d90:	8b 87 8c 00 00 00    	mov    0x8c(%edi),%eax
+80104d96:	8d 44 40 fd          	lea    -0x3(%eax,%eax,2),%eax
+80104d9a:	8d 04 85 60 6e 11 80 	lea    -0x7fee91a0(,%eax,4),%eax
+  for(p = ptable.group[gid - 1].members; p; p = p->gnext)
+80104da1:	8b b0 04 2c 02 00    	mov    0x22c04(%eax),%esi
+  ptable.group[gid - 1].active += delta;
+80104da7:	8b 88 00 2c 02 00    	mov    0x22c00(%eax),%ecx
+80104dad:	2b 4f 58             	sub    0x58(%edi),%ecx
+80104db0:	89 88 00 2c 02 00    	mov    %ecx,0x22c00(%eax)
+  for(p = ptable.group[gid - 1].members; p; p = p->gnext)
+80104db6:	85 f6                	test   %esi,%esi
+80104db8:	0f 84 13 ff ff ff    	je     80104cd1 <setgroup+0x61>
+80104dbe:	66 90                	xchg   %ax,%ax
+    reweigh(p);
+80104dc0:	89 f0                	mov    %esi,%eax
+80104dc2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80104dc5:	e8 16 fd ff ff       	call   80104ae0 <reweigh>
+  for(p = ptable.group[gid - 1].members; p; p = p->gnext)
+80104dca:	8b b6 90 00 00 00    	mov    0x90(%esi),%esi
+80104dd0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80104dd3:	85 f6                	test   %esi,%esi
+80104dd5:	75 e9                	jne    80104dc0 <setgroup+0x150>
+80104dd7:	e9 f5 fe ff ff       	jmp    80104cd1 <setgroup+0x61>
+80104ddc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80104de0 <pinit>:
+{
+80104de0:	55                   	push   %ebp
+80104de1:	89 e5                	mov    %esp,%ebp
+80104de3:	53                   	push   %ebx
+80104de4:	bb 9c 96 11 80       	mov    $0x8011969c,%ebx
+80104de9:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&ptable.lock, "ptable");
+80104dec:	68 80 bf 10 80       	push   $0x8010bf80
+80104df1:	68 60 6e 11 80       	push   $0x80116e60
+80104df6:	e8 f5 2e 00 00       	call   80107cf0 <initlock>
+  for(i = 0; i < NCPU; i++)
+80104dfb:	83 c4 10             	add    $0x10,%esp
+80104dfe:	66 90                	xchg   %ax,%ax
+    initlock(&ptable.runq[i].lock, "runq");
+80104e00:	83 ec 08             	sub    $0x8,%esp
+80104e03:	68 87 bf 10 80       	push   $0x8010bf87
+80104e08:	53                   	push   %ebx
+  for(i = 0; i < NCPU; i++)
+80104e09:	81 c3 78 40 00 00    	add    $0x4078,%ebx
+    initlock(&ptable.runq[i].lock, "runq");
+80104e0f:	e8 dc 2e 00 00       	call   80107cf0 <initlock>
+  for(i = 0; i < NCPU; i++)
+80104e14:	83 c4 10             	add    $0x10,%esp
+80104e17:	81 fb 5c 9a 13 80    	cmp    $0x80139a5c,%ebx
+80104e1d:	75 e1                	jne    80104e00 <pinit+0x20>
+80104e1f:	ba 0a 00 00 00       	mov    $0xa,%edx
+  for(treebit = 1; treebit*2 <= NPROC; treebit *= 2)
+80104e24:	b8 02 00 00 00       	mov    $0x2,%eax
+80104e29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104e30:	89 c1                	mov    %eax,%ecx
+80104e32:	01 c0                	add    %eax,%eax
+80104e34:	83 ea 01             	sub    $0x1,%edx
+80104e37:	75 f7                	jne    80104e30 <pinit+0x50>
+80104e39:	89 0d b0 9b 13 80    	mov    %ecx,0x80139bb0
+}
+80104e3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104e42:	c9                   	leave
+80104e43:	c3                   	ret
+80104e44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104e4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104e4f:	90                   	nop
+
+80104e50 <mycpu>:
+{
+80104e50:	55                   	push   %ebp
+80104e51:	89 e5                	mov    %esp,%ebp
+80104e53:	56                   	push   %esi
+80104e54:	53                   	push   %ebx
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80104e55:	9c                   	pushf
+80104e56:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80104e57:	f6 c4 02             	test   $0x2,%ah
+80104e5a:	75 46                	jne    80104ea2 <mycpu+0x52>
+  apicid = lapicid();
+80104e5c:	e8 3f df ff ff       	call   80102da0 <lapicid>
+  for (i = 0; i < ncpu; ++i) {
+80104e61:	8b 35 c4 67 11 80    	mov    0x801167c4,%esi
+80104e67:	85 f6                	test   %esi,%esi
+80104e69:	7e 2a                	jle    80104e95 <mycpu+0x45>
+80104e6b:	31 d2                	xor    %edx,%edx
+80104e6d:	eb 08                	jmp    80104e77 <mycpu+0x27>
+80104e6f:	90                   	nop
+80104e70:	83 c2 01             	add    $0x1,%edx
+80104e73:	39 f2                	cmp    %esi,%edx
+80104e75:	74 1e                	je     80104e95 <mycpu+0x45>
+    if (cpus[i].apicid == apicid)
+80104e77:	69 ca d0 00 00 00    	imul   $0xd0,%edx,%ecx
+80104e7d:	0f b6 99 e0 67 11 80 	movzbl -0x7fee9820(%ecx),%ebx
+80104e84:	39 c3                	cmp    %eax,%ebx
+80104e86:	75 e8                	jne    80104e70 <mycpu+0x20>
+}
+80104e88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return &cpus[i];
+80104e8b:	8d 81 e0 67 11 80    	lea    -0x7fee9820(%ecx),%eax
+}
+80104e91:	5b                   	pop    %ebx
+80104e92:	5e                   	pop    %esi
+80104e93:	5d                   	pop    %ebp
+80104e94:	c3                   	ret
+  panic("unknown apicid\n");
+80104e95:	83 ec 0c             	sub    $0xc,%esp
+80104e98:	68 8c bf 10 80       	push   $0x8010bf8c
+80104e9d:	e8 de b4 ff ff       	call   80100380 <panic>
+    panic("mycpu called with interrupts enabled\n");
+80104ea2:	83 ec 0c             	sub    $0xc,%esp
+80104ea5:	68 84 c0 10 80       	push   $0x8010c084
+80104eaa:	e8 d1 b4 ff ff       	call   80100380 <panic>
+80104eaf:	90                   	nop
+
+80104eb0 <cpuid>:
+cpuid() {
+80104eb0:	55                   	push   %ebp
+80104eb1:	89 e5                	mov    %esp,%ebp
+80104eb3:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+80104eb6:	e8 95 ff ff ff       	call   80104e50 <mycpu>
+}
+80104ebb:	c9                   	leave
+  return mycpu()-cpus;
+80104ebc:	2d e0 67 11 80       	sub    $0x801167e0,%eax
+80104ec1:	c1 f8 04             	sar    $0x4,%eax
+80104ec4:	69 c0 c5 4e ec c4    	imul   $0xc4ec4ec5,%eax,%eax
+}
+80104eca:	c3                   	ret
+80104ecb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104ecf:	90                   	nop
+
+80104ed0 <allocproc>:
+{
+80104ed0:	55                   	push   %ebp
+80104ed1:	89 e5                	mov    %esp,%ebp
+80104ed3:	56                   	push   %esi
+80104ed4:	53                   	push   %ebx
+  acquire(&ptable.lock);
+80104ed5:	83 ec 0c             	sub    $0xc,%esp
+80104ed8:	68 60 6e 11 80       	push   $0x80116e60
+80104edd:	e8 ee 2f 00 00       	call   80107ed0 <acquire>
+  if(ptable.free == 0){
+80104ee2:	8b 1d 98 7e 11 80    	mov    0x80117e98,%ebx
+80104ee8:	83 c4 10             	add    $0x10,%esp
+80104eeb:	85 db                	test   %ebx,%ebx
+80104eed:	0f 84 7d 01 00 00    	je     80105070 <allocproc+0x1a0>
+  ptable.free = p->hnext;
+80104ef3:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  memset(p->lathist, 0, sizeof(p->lathist));
+80104ef6:	83 ec 04             	sub    $0x4,%esp
+  ptable.free = p->hnext;
+80104ef9:	a3 98 7e 11 80       	mov    %eax,0x80117e98
+  p->pid = nextpid++;
+80104efe:	a1 04 f0 10 80       	mov    0x8010f004,%eax
+  p->state = EMBRYO;
+80104f03:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+  p->pid = nextpid++;
+80104f0a:	8d 50 01             	lea    0x1(%eax),%edx
+80104f0d:	89 43 0c             	mov    %eax,0xc(%ebx)
+80104f10:	89 15 04 f0 10 80    	mov    %edx,0x8010f004
+  p->hnext = ptable.pidhash[p->pid % NPIDHASH];
+80104f16:	99                   	cltd
+80104f17:	c1 ea 16             	shr    $0x16,%edx
+80104f1a:	01 d0                	add    %edx,%eax
+80104f1c:	25 ff 03 00 00       	and    $0x3ff,%eax
+80104f21:	29 d0                	sub    %edx,%eax
+80104f23:	05 0c 04 00 00       	add    $0x40c,%eax
+80104f28:	8b 14 85 6c 6e 11 80 	mov    -0x7fee9194(,%eax,4),%edx
+80104f2f:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  ptable.pidhash[p->pid % NPIDHASH] = p;
+80104f32:	89 1c 85 6c 6e 11 80 	mov    %ebx,-0x7fee9194(,%eax,4)
+  memset(p->lathist, 0, sizeof(p->lathist));
+80104f39:	8d 83 c4 00 00 00    	lea    0xc4(%ebx),%eax
+  p->tickets=1;
+80104f3f:	c7 43 58 01 00 00 00 	movl   $0x1,0x58(%ebx)
+  p->ticks=0;
+80104f46:	c7 43 5c 00 00 00 00 	movl   $0x0,0x5c(%ebx)
+  p->quantum = 1000;
+80104f4d:	c7 83 80 00 00 00 e8 	movl   $0x3e8,0x80(%ebx)
+80104f54:	03 00 00 
+  p->borrowed = 0;
+80104f57:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+80104f5e:	00 00 00 
+  p->lendto = 0;
+80104f61:	c7 83 98 00 00 00 00 	movl   $0x0,0x98(%ebx)
+80104f68:	00 00 00 
+  p->rtperiod = 0;
+80104f6b:	c7 83 a4 00 00 00 00 	movl   $0x0,0xa4(%ebx)
+80104f72:	00 00 00 
+  p->rtmisses = 0;
+80104f75:	c7 83 b4 00 00 00 00 	movl   $0x0,0xb4(%ebx)
+80104f7c:	00 00 00 
+  p->rq = -1;
+80104f7f:	c7 43 64 ff ff ff ff 	movl   $0xffffffff,0x64(%ebx)
+  p->cpu = -1;
+80104f86:	c7 43 68 ff ff ff ff 	movl   $0xffffffff,0x68(%ebx)
+  p->affinity = ~0;
+80104f8d:	c7 43 78 ff ff ff ff 	movl   $0xffffffff,0x78(%ebx)
+  p->migrations = 0;
+80104f94:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+  p->level = 0;
+80104f9b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80104fa2:	00 00 00 
+  p->slice = 0;
+80104fa5:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+80104fac:	00 00 00 
+  memset(p->lathist, 0, sizeof(p->lathist));
+80104faf:	68 80 00 00 00       	push   $0x80
+80104fb4:	6a 00                	push   $0x0
+80104fb6:	50                   	push   %eax
+80104fb7:	e8 f4 2f 00 00       	call   80107fb0 <memset>
+  p->utime = 0;
+80104fbc:	c7 83 44 01 00 00 00 	movl   $0x0,0x144(%ebx)
+80104fc3:	00 00 00 
+80104fc6:	c7 83 48 01 00 00 00 	movl   $0x0,0x148(%ebx)
+80104fcd:	00 00 00 
+  p->stime = 0;
+80104fd0:	c7 83 4c 01 00 00 00 	movl   $0x0,0x14c(%ebx)
+80104fd7:	00 00 00 
+80104fda:	c7 83 50 01 00 00 00 	movl   $0x0,0x150(%ebx)
+80104fe1:	00 00 00 
+  p->detached = 0;
+80104fe4:	c7 83 60 01 00 00 00 	movl   $0x0,0x160(%ebx)
+80104feb:	00 00 00 
+  return mycpu()-cpus;
+80104fee:	e8 5d fe ff ff       	call   80104e50 <mycpu>
+80104ff3:	2d e0 67 11 80       	sub    $0x801167e0,%eax
+80104ff8:	c1 f8 04             	sar    $0x4,%eax
+  p->pass = p->passbase = ptable.runq[cpuid()].pass;
+80104ffb:	69 c0 58 2c 76 62    	imul   $0x62762c58,%eax,%eax
+80105001:	8b 80 10 d7 11 80    	mov    -0x7fee28f0(%eax),%eax
+80105007:	89 43 70             	mov    %eax,0x70(%ebx)
+8010500a:	89 43 6c             	mov    %eax,0x6c(%ebx)
+  release(&ptable.lock);
+8010500d:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+80105014:	e8 57 2e 00 00       	call   80107e70 <release>
+  if((p->kstack = kalloc()) == 0){
+80105019:	e8 02 db ff ff       	call   80102b20 <kalloc>
+8010501e:	83 c4 10             	add    $0x10,%esp
+80105021:	89 43 04             	mov    %eax,0x4(%ebx)
+80105024:	85 c0                	test   %eax,%eax
+80105026:	0f 84 e4 00 00 00    	je     80105110 <allocproc+0x240>
+  sp -= sizeof *p->tf;
+8010502c:	8d 90 b4 0f 00 00    	lea    0xfb4(%eax),%edx
+  memset(p->context, 0, sizeof *p->context);
+80105032:	83 ec 04             	sub    $0x4,%esp
+  sp -= sizeof *p->context;
+80105035:	05 9c 0f 00 00       	add    $0xf9c,%eax
+  sp -= sizeof *p->tf;
+8010503a:	89 53 24             	mov    %edx,0x24(%ebx)
+  *(uint*)sp = (uint)trapret;
+8010503d:	c7 40 14 c7 98 10 80 	movl   $0x801098c7,0x14(%eax)
+  p->context = (struct context*)sp;
+80105044:	89 43 28             	mov    %eax,0x28(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+80105047:	6a 14                	push   $0x14
+80105049:	6a 00                	push   $0x0
+8010504b:	50                   	push   %eax
+8010504c:	e8 5f 2f 00 00       	call   80107fb0 <memset>
+  p->context->eip = (uint)forkret;
+80105051:	8b 43 28             	mov    0x28(%ebx),%eax
+  return p;
+80105054:	83 c4 10             	add    $0x10,%esp
+  p->context->eip = (uint)forkret;
+80105057:	c7 40 10 b0 41 10 80 	movl   $0x801041b0,0x10(%eax)
+}
+8010505e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105061:	89 d8                	mov    %ebx,%eax
+80105063:	5b                   	pop    %ebx
+80105064:	5e                   	pop    %esi
+80105065:	5d                   	pop    %ebp
+80105066:	c3                   	ret
+80105067:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010506e:	66 90                	xchg   %ax,%ax
+    if(ptable.nslot == NPROC || (page = kalloc()) == 0)
+80105070:	81 3d 94 7e 11 80 00 	cmpl   $0x400,0x80117e94
+80105077:	04 00 00 
+8010507a:	74 7c                	je     801050f8 <allocproc+0x228>
+8010507c:	e8 9f da ff ff       	call   80102b20 <kalloc>
+80105081:	89 c3                	mov    %eax,%ebx
+80105083:	85 c0                	test   %eax,%eax
+80105085:	74 71                	je     801050f8 <allocproc+0x228>
+    memset(page, 0, PGSIZE);
+80105087:	83 ec 04             	sub    $0x4,%esp
+8010508a:	8d b3 4c 0f 00 00    	lea    0xf4c(%ebx),%esi
+80105090:	68 00 10 00 00       	push   $0x1000
+80105095:	6a 00                	push   $0x0
+80105097:	50                   	push   %eax
+80105098:	e8 13 2f 00 00       	call   80107fb0 <memset>
+    for(i = 0; i < PGSIZE/sizeof(*p) && ptable.nslot < NPROC; i++){
+8010509d:	89 d8                	mov    %ebx,%eax
+8010509f:	83 c4 10             	add    $0x10,%esp
+801050a2:	eb 34                	jmp    801050d8 <allocproc+0x208>
+801050a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      p->slot = ptable.nslot++;
+801050a8:	8d 4a 01             	lea    0x1(%edx),%ecx
+      p = (struct proc*)page + i;
+801050ab:	89 c3                	mov    %eax,%ebx
+      p->slot = ptable.nslot++;
+801050ad:	89 0d 94 7e 11 80    	mov    %ecx,0x80117e94
+801050b3:	89 50 20             	mov    %edx,0x20(%eax)
+      ptable.slot[p->slot] = p;
+801050b6:	89 04 95 94 6e 11 80 	mov    %eax,-0x7fee916c(,%edx,4)
+      p->hnext = ptable.free;
+801050bd:	8b 15 98 7e 11 80    	mov    0x80117e98,%edx
+801050c3:	89 50 1c             	mov    %edx,0x1c(%eax)
+      ptable.free = p;
+801050c6:	a3 98 7e 11 80       	mov    %eax,0x80117e98
+    for(i = 0; i < PGSIZE/sizeof(*p) && ptable.nslot < NPROC; i++){
+801050cb:	05 64 01 00 00       	add    $0x164,%eax
+801050d0:	39 c6                	cmp    %eax,%esi
+801050d2:	0f 84 1b fe ff ff    	je     80104ef3 <allocproc+0x23>
+801050d8:	8b 15 94 7e 11 80    	mov    0x80117e94,%edx
+801050de:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+801050e4:	7e c2                	jle    801050a8 <allocproc+0x1d8>
+  p = ptable.free;
+801050e6:	8b 1d 98 7e 11 80    	mov    0x80117e98,%ebx
+801050ec:	e9 02 fe ff ff       	jmp    80104ef3 <allocproc+0x23>
+801050f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&ptable.lock);
+801050f8:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+801050fb:	31 db                	xor    %ebx,%ebx
+    release(&ptable.lock);
+801050fd:	68 60 6e 11 80       	push   $0x80116e60
+80105102:	e8 69 2d 00 00       	call   80107e70 <release>
+    return 0;
+80105107:	83 c4 10             	add    $0x10,%esp
+8010510a:	e9 4f ff ff ff       	jmp    8010505e <allocproc+0x18e>
+8010510f:	90                   	nop
+    acquire(&ptable.lock);
+80105110:	83 ec 0c             	sub    $0xc,%esp
+80105113:	68 60 6e 11 80       	push   $0x80116e60
+80105118:	e8 b3 2d 00 00       	call   80107ed0 <acquire>
+    freeproc(p);
+8010511d:	89 d8                	mov    %ebx,%eax
+    return 0;
+8010511f:	31 db                	xor    %ebx,%ebx
+    freeproc(p);
+80105121:	e8 8a ee ff ff       	call   80103fb0 <freeproc>
+    release(&ptable.lock);
+80105126:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+8010512d:	e8 3e 2d 00 00       	call   80107e70 <release>
+    return 0;
+80105132:	83 c4 10             	add    $0x10,%esp
+80105135:	e9 24 ff ff ff       	jmp    8010505e <allocproc+0x18e>
+8010513a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105140 <schedtick>:
+{
+80105140:	55                   	push   %ebp
+80105141:	89 e5                	mov    %esp,%ebp
+80105143:	57                   	push   %edi
+80105144:	56                   	push   %esi
+80105145:	53                   	push   %ebx
+80105146:	83 ec 1c             	sub    $0x1c,%esp
+  return mycpu()-cpus;
+80105149:	e8 02 fd ff ff       	call   80104e50 <mycpu>
+  acquire(&rq->lock);
+8010514e:	83 ec 0c             	sub    $0xc,%esp
+  return mycpu()-cpus;
+80105151:	2d e0 67 11 80       	sub    $0x801167e0,%eax
+80105156:	89 c3                	mov    %eax,%ebx
+80105158:	c1 fb 04             	sar    $0x4,%ebx
+  acquire(&rq->lock);
+8010515b:	69 db 58 2c 76 62    	imul   $0x62762c58,%ebx,%ebx
+80105161:	81 c3 9c 96 11 80    	add    $0x8011969c,%ebx
+80105167:	53                   	push   %ebx
+80105168:	e8 63 2d 00 00       	call   80107ed0 <acquire>
+  p = mycpu()->proc;
+8010516d:	e8 de fc ff ff       	call   80104e50 <mycpu>
+  if(p && p->rtperiod && p->rtbudget > 0)
+80105172:	83 c4 10             	add    $0x10,%esp
+  p = mycpu()->proc;
+80105175:	8b 80 ac 00 00 00    	mov    0xac(%eax),%eax
+  if(p && p->rtperiod && p->rtbudget > 0)
+8010517b:	85 c0                	test   %eax,%eax
+8010517d:	74 26                	je     801051a5 <schedtick+0x65>
+8010517f:	8b b0 a4 00 00 00    	mov    0xa4(%eax),%esi
+80105185:	85 f6                	test   %esi,%esi
+80105187:	74 13                	je     8010519c <schedtick+0x5c>
+80105189:	8b 90 b0 00 00 00    	mov    0xb0(%eax),%edx
+8010518f:	85 d2                	test   %edx,%edx
+80105191:	7e 09                	jle    8010519c <schedtick+0x5c>
+    p->rtbudget--;
+80105193:	83 ea 01             	sub    $0x1,%edx
+80105196:	89 90 b0 00 00 00    	mov    %edx,0xb0(%eax)
+  if(p && policy == SCHED_MLFQ && ++p->slice >= MLFQSLICE(p->level)
+8010519c:	83 3d ac 9b 13 80 02 	cmpl   $0x2,0x80139bac
+801051a3:	74 23                	je     801051c8 <schedtick+0x88>
+  release(&rq->lock);
+801051a5:	83 ec 0c             	sub    $0xc,%esp
+801051a8:	53                   	push   %ebx
+801051a9:	e8 c2 2c 00 00       	call   80107e70 <release>
+  return mycpu()-cpus;
+801051ae:	e8 9d fc ff ff       	call   80104e50 <mycpu>
+  if(cpuid() != 0)
+801051b3:	83 c4 10             	add    $0x10,%esp
+801051b6:	3d e0 67 11 80       	cmp    $0x801167e0,%eax
+801051bb:	74 4b                	je     80105208 <schedtick+0xc8>
+}
+801051bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801051c0:	5b                   	pop    %ebx
+801051c1:	5e                   	pop    %esi
+801051c2:	5f                   	pop    %edi
+801051c3:	5d                   	pop    %ebp
+801051c4:	c3                   	ret
+801051c5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(p && policy == SCHED_MLFQ && ++p->slice >= MLFQSLICE(p->level)
+801051c8:	8b b8 88 00 00 00    	mov    0x88(%eax),%edi
+801051ce:	8b 88 84 00 00 00    	mov    0x84(%eax),%ecx
+801051d4:	be 01 00 00 00       	mov    $0x1,%esi
+801051d9:	8d 57 01             	lea    0x1(%edi),%edx
+801051dc:	d3 e6                	shl    %cl,%esi
+801051de:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+     && p->level < NMLFQ - 1){
+801051e4:	39 f2                	cmp    %esi,%edx
+801051e6:	7c bd                	jl     801051a5 <schedtick+0x65>
+801051e8:	83 f9 01             	cmp    $0x1,%ecx
+801051eb:	7f b8                	jg     801051a5 <schedtick+0x65>
+    p->slice = 0;
+801051ed:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+801051f4:	00 00 00 
+    p->level++;
+801051f7:	83 c1 01             	add    $0x1,%ecx
+801051fa:	89 88 84 00 00 00    	mov    %ecx,0x84(%eax)
+    p->slice = 0;
+80105200:	eb a3                	jmp    801051a5 <schedtick+0x65>
+80105202:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  boost = policy == SCHED_MLFQ && ticks % MLFQBOOST == 0;
+80105208:	83 3d ac 9b 13 80 02 	cmpl   $0x2,0x80139bac
+  for(p = ptable.rt; p && !due; p = p->rtnext)
+8010520f:	8b 0d 1c 9b 13 80    	mov    0x80139b1c,%ecx
+  boost = policy == SCHED_MLFQ && ticks % MLFQBOOST == 0;
+80105215:	0f 84 65 02 00 00    	je     80105480 <schedtick+0x340>
+  for(p = ptable.rt; p && !due; p = p->rtnext)
+8010521b:	85 c9                	test   %ecx,%ecx
+8010521d:	74 9e                	je     801051bd <schedtick+0x7d>
+  boost = policy == SCHED_MLFQ && ticks % MLFQBOOST == 0;
+8010521f:	8b 1d c0 9b 13 80    	mov    0x80139bc0,%ebx
+80105225:	31 f6                	xor    %esi,%esi
+80105227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010522e:	66 90                	xchg   %ax,%ax
+    due = (int)(ticks - p->rtdeadline) >= 0;
+80105230:	89 d8                	mov    %ebx,%eax
+80105232:	2b 81 ac 00 00 00    	sub    0xac(%ecx),%eax
+  for(p = ptable.rt; p && !due; p = p->rtnext)
+80105238:	8b 89 b8 00 00 00    	mov    0xb8(%ecx),%ecx
+8010523e:	85 c9                	test   %ecx,%ecx
+80105240:	0f 84 2a 02 00 00    	je     80105470 <schedtick+0x330>
+80105246:	85 c0                	test   %eax,%eax
+80105248:	78 e6                	js     80105230 <schedtick+0xf0>
+  acquire(&ptable.lock);
+8010524a:	83 ec 0c             	sub    $0xc,%esp
+8010524d:	68 60 6e 11 80       	push   $0x80116e60
+80105252:	e8 79 2c 00 00       	call   80107ed0 <acquire>
+  if(boost)
+80105257:	83 c4 10             	add    $0x10,%esp
+8010525a:	85 f6                	test   %esi,%esi
+8010525c:	0f 84 46 01 00 00    	je     801053a8 <schedtick+0x268>
+    for(i = 0; i < ptable.nslot; i++)
+80105262:	8b 1d 94 7e 11 80    	mov    0x80117e94,%ebx
+80105268:	85 db                	test   %ebx,%ebx
+8010526a:	0f 8e 38 01 00 00    	jle    801053a8 <schedtick+0x268>
+80105270:	31 ff                	xor    %edi,%edi
+80105272:	eb 13                	jmp    80105287 <schedtick+0x147>
+80105274:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105278:	83 c7 01             	add    $0x1,%edi
+8010527b:	39 3d 94 7e 11 80    	cmp    %edi,0x80117e94
+80105281:	0f 8e 21 01 00 00    	jle    801053a8 <schedtick+0x268>
+      if(ptable.slot[i]->state != UNUSED)
+80105287:	8b 1c bd 94 6e 11 80 	mov    -0x7fee916c(,%edi,4),%ebx
+8010528e:	8b 43 08             	mov    0x8(%ebx),%eax
+80105291:	85 c0                	test   %eax,%eax
+80105293:	74 e3                	je     80105278 <schedtick+0x138>
+  q = *(volatile int*)&p->rq;
+80105295:	8b 53 64             	mov    0x64(%ebx),%edx
+  if(q < 0)
+80105298:	85 d2                	test   %edx,%edx
+8010529a:	0f 88 2f 02 00 00    	js     801054cf <schedtick+0x38f>
+  rq = &ptable.runq[q];
+801052a0:	69 c2 78 40 00 00    	imul   $0x4078,%edx,%eax
+  acquire(&rq->lock);
+801052a6:	83 ec 0c             	sub    $0xc,%esp
+801052a9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  rq = &ptable.runq[q];
+801052ac:	8d b0 9c 96 11 80    	lea    -0x7fee6964(%eax),%esi
+801052b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801052b5:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  acquire(&rq->lock);
+801052b8:	56                   	push   %esi
+801052b9:	e8 12 2c 00 00       	call   80107ed0 <acquire>
+  if(p->rq == q)
+801052be:	8b 55 dc             	mov    -0x24(%ebp),%edx
+801052c1:	83 c4 10             	add    $0x10,%esp
+801052c4:	3b 53 64             	cmp    0x64(%ebx),%edx
+801052c7:	0f 85 f3 01 00 00    	jne    801054c0 <schedtick+0x380>
+    treeadd(rq, p->level, p->slot, -p->weight);
+801052cd:	8b 43 20             	mov    0x20(%ebx),%eax
+  rq->total += delta;
+801052d0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    treeadd(rq, p->level, p->slot, -p->weight);
+801052d3:	8b 73 60             	mov    0x60(%ebx),%esi
+801052d6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801052d9:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  rq->total += delta;
+801052df:	29 b1 d0 96 11 80    	sub    %esi,-0x7fee6930(%ecx)
+  rq->ltotal[l] += delta;
+801052e5:	69 ca 1e 10 00 00    	imul   $0x101e,%edx,%ecx
+801052eb:	8d 8c 08 20 0a 00 00 	lea    0xa20(%eax,%ecx,1),%ecx
+801052f2:	69 c0 04 10 00 00    	imul   $0x1004,%eax,%eax
+801052f8:	29 34 8d 78 6e 11 80 	sub    %esi,-0x7fee9188(,%ecx,4)
+  tree = rq->tree[l];
+801052ff:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80105302:	8d 8c 01 a4 28 00 00 	lea    0x28a4(%ecx,%eax,1),%ecx
+  for(i++; i <= NPROC; i += i & -i)
+80105309:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010530c:	83 c0 01             	add    $0x1,%eax
+8010530f:	3d 00 04 00 00       	cmp    $0x400,%eax
+80105314:	7f 23                	jg     80105339 <schedtick+0x1f9>
+80105316:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+80105319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105320:	89 c3                	mov    %eax,%ebx
+    tree[i] += delta;
+80105322:	29 b4 81 60 6e 11 80 	sub    %esi,-0x7fee91a0(%ecx,%eax,4)
+  for(i++; i <= NPROC; i += i & -i)
+80105329:	f7 db                	neg    %ebx
+8010532b:	21 c3                	and    %eax,%ebx
+8010532d:	01 d8                	add    %ebx,%eax
+8010532f:	3d 00 04 00 00       	cmp    $0x400,%eax
+80105334:	7e ea                	jle    80105320 <schedtick+0x1e0>
+80105336:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  rq->total += delta;
+80105339:	69 d2 78 40 00 00    	imul   $0x4078,%edx,%edx
+    treeadd(rq, l, p->slot, p->weight);
+8010533f:	8b 43 20             	mov    0x20(%ebx),%eax
+80105342:	8b 4b 60             	mov    0x60(%ebx),%ecx
+  for(i++; i <= NPROC; i += i & -i)
+80105345:	83 c0 01             	add    $0x1,%eax
+  rq->total += delta;
+80105348:	01 8a d0 96 11 80    	add    %ecx,-0x7fee6930(%edx)
+  rq->ltotal[l] += delta;
+8010534e:	01 8a f8 96 11 80    	add    %ecx,-0x7fee6908(%edx)
+  tree = rq->tree[l];
+80105354:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80105357:	81 c2 a4 28 00 00    	add    $0x28a4,%edx
+  for(i++; i <= NPROC; i += i & -i)
+8010535d:	3d 00 04 00 00       	cmp    $0x400,%eax
+80105362:	7f 1a                	jg     8010537e <schedtick+0x23e>
+80105364:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105368:	89 c6                	mov    %eax,%esi
+    tree[i] += delta;
+8010536a:	01 8c 82 60 6e 11 80 	add    %ecx,-0x7fee91a0(%edx,%eax,4)
+  for(i++; i <= NPROC; i += i & -i)
+80105371:	f7 de                	neg    %esi
+80105373:	21 c6                	and    %eax,%esi
+80105375:	01 f0                	add    %esi,%eax
+80105377:	3d 00 04 00 00       	cmp    $0x400,%eax
+8010537c:	7e ea                	jle    80105368 <schedtick+0x228>
+  p->level = l;
+8010537e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80105385:	00 00 00 
+    release(&rq->lock);
+80105388:	83 ec 0c             	sub    $0xc,%esp
+  p->slice = 0;
+8010538b:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+80105392:	00 00 00 
+    release(&rq->lock);
+80105395:	ff 75 e0             	push   -0x20(%ebp)
+80105398:	e8 d3 2a 00 00       	call   80107e70 <release>
+8010539d:	83 c4 10             	add    $0x10,%esp
+801053a0:	e9 d3 fe ff ff       	jmp    80105278 <schedtick+0x138>
+801053a5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = ptable.rt; p; p = p->rtnext){
+801053a8:	8b 1d 1c 9b 13 80    	mov    0x80139b1c,%ebx
+801053ae:	85 db                	test   %ebx,%ebx
+801053b0:	0f 84 a2 00 00 00    	je     80105458 <schedtick+0x318>
+801053b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801053bd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((int)(ticks - p->rtdeadline) < 0)
+801053c0:	8b 15 c0 9b 13 80    	mov    0x80139bc0,%edx
+801053c6:	8b 83 ac 00 00 00    	mov    0xac(%ebx),%eax
+801053cc:	39 c2                	cmp    %eax,%edx
+801053ce:	78 7a                	js     8010544a <schedtick+0x30a>
+    return 0;
+801053d0:	31 f6                	xor    %esi,%esi
+  if(p->state != RUNNING)
+801053d2:	83 7b 08 04          	cmpl   $0x4,0x8(%ebx)
+801053d6:	75 25                	jne    801053fd <schedtick+0x2bd>
+  rq = &ptable.runq[p->cpu];
+801053d8:	69 73 68 78 40 00 00 	imul   $0x4078,0x68(%ebx),%esi
+  acquire(&rq->lock);
+801053df:	83 ec 0c             	sub    $0xc,%esp
+  rq = &ptable.runq[p->cpu];
+801053e2:	81 c6 9c 96 11 80    	add    $0x8011969c,%esi
+  acquire(&rq->lock);
+801053e8:	56                   	push   %esi
+801053e9:	e8 e2 2a 00 00       	call   80107ed0 <acquire>
+    p->rtdeadline += p->rtperiod;
+801053ee:	8b 83 ac 00 00 00    	mov    0xac(%ebx),%eax
+    if((int)(ticks - p->rtdeadline) >= 0)
+801053f4:	8b 15 c0 9b 13 80    	mov    0x80139bc0,%edx
+  return rq;
+801053fa:	83 c4 10             	add    $0x10,%esp
+    if(p->rtbudget > 0 && isactive(p))
+801053fd:	8b 8b b0 00 00 00    	mov    0xb0(%ebx),%ecx
+80105403:	85 c9                	test   %ecx,%ecx
+80105405:	7e 12                	jle    80105419 <schedtick+0x2d9>
+  return p->state == RUNNABLE || p->state == RUNNING;
+80105407:	8b 7b 08             	mov    0x8(%ebx),%edi
+8010540a:	8d 4f fd             	lea    -0x3(%edi),%ecx
+    if(p->rtbudget > 0 && isactive(p))
+8010540d:	83 f9 01             	cmp    $0x1,%ecx
+80105410:	77 07                	ja     80105419 <schedtick+0x2d9>
+      p->rtmisses++;
+80105412:	83 83 b4 00 00 00 01 	addl   $0x1,0xb4(%ebx)
+    p->rtdeadline += p->rtperiod;
+80105419:	8b 8b a4 00 00 00    	mov    0xa4(%ebx),%ecx
+8010541f:	01 c8                	add    %ecx,%eax
+      p->rtdeadline = ticks + p->rtperiod;
+80105421:	01 d1                	add    %edx,%ecx
+80105423:	39 c2                	cmp    %eax,%edx
+80105425:	0f 49 c1             	cmovns %ecx,%eax
+    p->rtdeadline += p->rtperiod;
+80105428:	89 83 ac 00 00 00    	mov    %eax,0xac(%ebx)
+    p->rtbudget = p->rtruntime;
+8010542e:	8b 83 a8 00 00 00    	mov    0xa8(%ebx),%eax
+80105434:	89 83 b0 00 00 00    	mov    %eax,0xb0(%ebx)
+    if(rq)
+8010543a:	85 f6                	test   %esi,%esi
+8010543c:	74 0c                	je     8010544a <schedtick+0x30a>
+      release(&rq->lock);
+8010543e:	83 ec 0c             	sub    $0xc,%esp
+80105441:	56                   	push   %esi
+80105442:	e8 29 2a 00 00       	call   80107e70 <release>
+80105447:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.rt; p; p = p->rtnext){
+8010544a:	8b 9b b8 00 00 00    	mov    0xb8(%ebx),%ebx
+80105450:	85 db                	test   %ebx,%ebx
+80105452:	0f 85 68 ff ff ff    	jne    801053c0 <schedtick+0x280>
+  release(&ptable.lock);
+80105458:	83 ec 0c             	sub    $0xc,%esp
+8010545b:	68 60 6e 11 80       	push   $0x80116e60
+80105460:	e8 0b 2a 00 00       	call   80107e70 <release>
+80105465:	83 c4 10             	add    $0x10,%esp
+}
+80105468:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010546b:	5b                   	pop    %ebx
+8010546c:	5e                   	pop    %esi
+8010546d:	5f                   	pop    %edi
+8010546e:	5d                   	pop    %ebp
+8010546f:	c3                   	ret
+  if(!due)
+80105470:	85 c0                	test   %eax,%eax
+80105472:	0f 89 d2 fd ff ff    	jns    8010524a <schedtick+0x10a>
+}
+80105478:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010547b:	5b                   	pop    %ebx
+8010547c:	5e                   	pop    %esi
+8010547d:	5f                   	pop    %edi
+8010547e:	5d                   	pop    %ebp
+8010547f:	c3                   	ret
+  boost = policy == SCHED_MLFQ && ticks % MLFQBOOST == 0;
+80105480:	8b 1d c0 9b 13 80    	mov    0x80139bc0,%ebx
+80105486:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+8010548b:	f7 e3                	mul    %ebx
+8010548d:	c1 ea 05             	shr    $0x5,%edx
+80105490:	6b c2 64             	imul   $0x64,%edx,%eax
+80105493:	89 da                	mov    %ebx,%edx
+80105495:	29 c2                	sub    %eax,%edx
+80105497:	0f 94 c0             	sete   %al
+8010549a:	0f b6 c0             	movzbl %al,%eax
+8010549d:	89 c6                	mov    %eax,%esi
+  for(p = ptable.rt; p && !due; p = p->rtnext)
+8010549f:	0f 84 a5 fd ff ff    	je     8010524a <schedtick+0x10a>
+801054a5:	85 c9                	test   %ecx,%ecx
+801054a7:	0f 85 83 fd ff ff    	jne    80105230 <schedtick+0xf0>
+  if(!due)
+801054ad:	85 d2                	test   %edx,%edx
+801054af:	0f 85 08 fd ff ff    	jne    801051bd <schedtick+0x7d>
+801054b5:	e9 90 fd ff ff       	jmp    8010524a <schedtick+0x10a>
+801054ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  release(&rq->lock);
+801054c0:	83 ec 0c             	sub    $0xc,%esp
+801054c3:	56                   	push   %esi
+801054c4:	e8 a7 29 00 00       	call   80107e70 <release>
+  if(p->state != RUNNING)
+801054c9:	8b 43 08             	mov    0x8(%ebx),%eax
+801054cc:	83 c4 10             	add    $0x10,%esp
+801054cf:	83 f8 04             	cmp    $0x4,%eax
+801054d2:	75 24                	jne    801054f8 <schedtick+0x3b8>
+  rq = &ptable.runq[p->cpu];
+801054d4:	69 43 68 78 40 00 00 	imul   $0x4078,0x68(%ebx),%eax
+  acquire(&rq->lock);
+801054db:	83 ec 0c             	sub    $0xc,%esp
+  rq = &ptable.runq[p->cpu];
+801054de:	05 9c 96 11 80       	add    $0x8011969c,%eax
+801054e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  acquire(&rq->lock);
+801054e6:	50                   	push   %eax
+801054e7:	e8 e4 29 00 00       	call   80107ed0 <acquire>
+801054ec:	83 c4 10             	add    $0x10,%esp
+801054ef:	e9 8a fe ff ff       	jmp    8010537e <schedtick+0x23e>
+801054f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  p->level = l;
+801054f8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+801054ff:	00 00 00 
+  p->slice = 0;
+80105502:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+80105509:	00 00 00 
+  if(rq)
+8010550c:	e9 67 fd ff ff       	jmp    80105278 <schedtick+0x138>
+80105511:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010551f:	90                   	nop
+
+80105520 <enqueue>:
+{
+80105520:	55                   	push   %ebp
+80105521:	69 ca 78 40 00 00    	imul   $0x4078,%edx,%ecx
+80105527:	89 e5                	mov    %esp,%ebp
+80105529:	57                   	push   %edi
+8010552a:	56                   	push   %esi
+8010552b:	89 c6                	mov    %eax,%esi
+  rq = &ptable.runq[q];
+8010552d:	8d 81 9c 96 11 80    	lea    -0x7fee6964(%ecx),%eax
+{
+80105533:	53                   	push   %ebx
+80105534:	89 d3                	mov    %edx,%ebx
+80105536:	83 ec 28             	sub    $0x28,%esp
+  rq = &ptable.runq[q];
+80105539:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  acquire(&rq->lock);
+8010553c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010553f:	50                   	push   %eax
+80105540:	e8 8b 29 00 00       	call   80107ed0 <acquire>
+  p->pass = rq->pass + (lead > 0 ? lead : 0);
+80105545:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  lead = p->pass - p->passbase;
+80105548:	8b 46 6c             	mov    0x6c(%esi),%eax
+  p->pass = rq->pass + (lead > 0 ? lead : 0);
+8010554b:	ba 00 00 00 00       	mov    $0x0,%edx
+  lead = p->pass - p->passbase;
+80105550:	2b 46 70             	sub    0x70(%esi),%eax
+  p->pass = rq->pass + (lead > 0 ? lead : 0);
+80105553:	0f 48 c2             	cmovs  %edx,%eax
+  rq->heap[p->heapi] = p;
+80105556:	69 d3 1e 10 00 00    	imul   $0x101e,%ebx,%edx
+  p->pass = rq->pass + (lead > 0 ? lead : 0);
+8010555c:	03 81 10 d7 11 80    	add    -0x7fee28f0(%ecx),%eax
+  p->rq = q;
+80105562:	89 5e 64             	mov    %ebx,0x64(%esi)
+  p->pass = rq->pass + (lead > 0 ? lead : 0);
+80105565:	89 46 6c             	mov    %eax,0x6c(%esi)
+  p->heapi = rq->nrun++;
+80105568:	8b 81 d4 96 11 80    	mov    -0x7fee692c(%ecx),%eax
+8010556e:	8d 78 01             	lea    0x1(%eax),%edi
+80105571:	89 b9 d4 96 11 80    	mov    %edi,-0x7fee692c(%ecx)
+80105577:	89 46 74             	mov    %eax,0x74(%esi)
+  rq->heap[p->heapi] = p;
+8010557a:	8d 84 10 28 16 00 00 	lea    0x1628(%eax,%edx,1),%eax
+80105581:	89 34 85 70 6e 11 80 	mov    %esi,-0x7fee9190(,%eax,4)
+  heapfix(rq, p->heapi);
+80105588:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010558b:	8b 56 74             	mov    0x74(%esi),%edx
+8010558e:	e8 6d e7 ff ff       	call   80103d00 <heapfix>
+  for(i = 0; i < ncpu; i++)
+80105593:	83 c4 10             	add    $0x10,%esp
+80105596:	31 c0                	xor    %eax,%eax
+80105598:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010559b:	8b 15 c4 67 11 80    	mov    0x801167c4,%edx
+801055a1:	85 d2                	test   %edx,%edx
+801055a3:	7e 1a                	jle    801055bf <enqueue+0x9f>
+801055a5:	8d 76 00             	lea    0x0(%esi),%esi
+  return (p->affinity >> i) & 1;
+801055a8:	8b 7e 78             	mov    0x78(%esi),%edi
+    if(cpuok(p, i))
+801055ab:	0f a3 c7             	bt     %eax,%edi
+801055ae:	73 08                	jae    801055b8 <enqueue+0x98>
+      rq->nok[i]++;
+801055b0:	83 84 81 d8 96 11 80 	addl   $0x1,-0x7fee6928(%ecx,%eax,4)
+801055b7:	01 
+  for(i = 0; i < ncpu; i++)
+801055b8:	83 c0 01             	add    $0x1,%eax
+801055bb:	39 d0                	cmp    %edx,%eax
+801055bd:	75 e9                	jne    801055a8 <enqueue+0x88>
+  p->weight = ptickets(p);
+801055bf:	89 f0                	mov    %esi,%eax
+801055c1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+801055c4:	e8 97 ec ff ff       	call   80104260 <ptickets>
+  rq->total += delta;
+801055c9:	69 d3 78 40 00 00    	imul   $0x4078,%ebx,%edx
+801055cf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  p->weight = ptickets(p);
+801055d2:	89 46 60             	mov    %eax,0x60(%esi)
+801055d5:	89 c7                	mov    %eax,%edi
+  treeadd(rq, p->level, p->slot, p->weight);
+801055d7:	8b 46 20             	mov    0x20(%esi),%eax
+801055da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801055dd:	8b 86 84 00 00 00    	mov    0x84(%esi),%eax
+  rq->total += delta;
+801055e3:	01 ba d0 96 11 80    	add    %edi,-0x7fee6930(%edx)
+  rq->ltotal[l] += delta;
+801055e9:	69 d3 1e 10 00 00    	imul   $0x101e,%ebx,%edx
+801055ef:	8d 94 10 20 0a 00 00 	lea    0xa20(%eax,%edx,1),%edx
+801055f6:	69 c0 04 10 00 00    	imul   $0x1004,%eax,%eax
+801055fc:	01 3c 95 78 6e 11 80 	add    %edi,-0x7fee9188(,%edx,4)
+  tree = rq->tree[l];
+80105603:	8d 8c 01 a4 28 00 00 	lea    0x28a4(%ecx,%eax,1),%ecx
+  for(i++; i <= NPROC; i += i & -i)
+8010560a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010560d:	83 c0 01             	add    $0x1,%eax
+80105610:	3d 00 04 00 00       	cmp    $0x400,%eax
+80105615:	7f 1f                	jg     80105636 <enqueue+0x116>
+80105617:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010561e:	66 90                	xchg   %ax,%ax
+80105620:	89 c2                	mov    %eax,%edx
+    tree[i] += delta;
+80105622:	01 bc 81 60 6e 11 80 	add    %edi,-0x7fee91a0(%ecx,%eax,4)
+  for(i++; i <= NPROC; i += i & -i)
+80105629:	f7 da                	neg    %edx
+8010562b:	21 c2                	and    %eax,%edx
+8010562d:	01 d0                	add    %edx,%eax
+8010562f:	3d 00 04 00 00       	cmp    $0x400,%eax
+80105634:	7e ea                	jle    80105620 <enqueue+0x100>
+  release(&rq->lock);
+80105636:	83 ec 0c             	sub    $0xc,%esp
+80105639:	ff 75 e4             	push   -0x1c(%ebp)
+8010563c:	e8 2f 28 00 00       	call   80107e70 <release>
+  if(!cpus[q].idle)
+80105641:	69 c3 d0 00 00 00    	imul   $0xd0,%ebx,%eax
+80105647:	83 c4 10             	add    $0x10,%esp
+  __sync_synchronize();
+8010564a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(!cpus[q].idle)
+8010564f:	05 e0 67 11 80       	add    $0x801167e0,%eax
+80105654:	8b 80 bc 00 00 00    	mov    0xbc(%eax),%eax
+8010565a:	85 c0                	test   %eax,%eax
+8010565c:	75 64                	jne    801056c2 <enqueue+0x1a2>
+    for(i = 0; i < ncpu; i++)
+8010565e:	a1 c4 67 11 80       	mov    0x801167c4,%eax
+80105663:	85 c0                	test   %eax,%eax
+80105665:	7e 5b                	jle    801056c2 <enqueue+0x1a2>
+80105667:	ba e0 67 11 80       	mov    $0x801167e0,%edx
+8010566c:	89 d8                	mov    %ebx,%eax
+8010566e:	31 ff                	xor    %edi,%edi
+80105670:	89 f3                	mov    %esi,%ebx
+80105672:	89 d6                	mov    %edx,%esi
+80105674:	89 c2                	mov    %eax,%edx
+80105676:	eb 19                	jmp    80105691 <enqueue+0x171>
+80105678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010567f:	90                   	nop
+80105680:	83 c7 01             	add    $0x1,%edi
+80105683:	81 c6 d0 00 00 00    	add    $0xd0,%esi
+80105689:	3b 3d c4 67 11 80    	cmp    0x801167c4,%edi
+8010568f:	7d 2f                	jge    801056c0 <enqueue+0x1a0>
+      if(cpus[i].idle && cpuok(p, i) && &cpus[i] != mycpu())
+80105691:	69 c7 d0 00 00 00    	imul   $0xd0,%edi,%eax
+80105697:	05 e0 67 11 80       	add    $0x801167e0,%eax
+8010569c:	8b 80 bc 00 00 00    	mov    0xbc(%eax),%eax
+801056a2:	85 c0                	test   %eax,%eax
+801056a4:	74 da                	je     80105680 <enqueue+0x160>
+  return (p->affinity >> i) & 1;
+801056a6:	8b 43 78             	mov    0x78(%ebx),%eax
+      if(cpus[i].idle && cpuok(p, i) && &cpus[i] != mycpu())
+801056a9:	0f a3 f8             	bt     %edi,%eax
+801056ac:	73 d2                	jae    80105680 <enqueue+0x160>
+801056ae:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801056b1:	e8 9a f7 ff ff       	call   80104e50 <mycpu>
+801056b6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801056b9:	39 f0                	cmp    %esi,%eax
+801056bb:	0f 45 d7             	cmovne %edi,%edx
+801056be:	eb c0                	jmp    80105680 <enqueue+0x160>
+801056c0:	89 d3                	mov    %edx,%ebx
+  if(cpus[q].idle && &cpus[q] != mycpu())
+801056c2:	69 db d0 00 00 00    	imul   $0xd0,%ebx,%ebx
+801056c8:	8b 83 9c 68 11 80    	mov    -0x7fee9764(%ebx),%eax
+801056ce:	8d b3 e0 67 11 80    	lea    -0x7fee9820(%ebx),%esi
+801056d4:	85 c0                	test   %eax,%eax
+801056d6:	75 08                	jne    801056e0 <enqueue+0x1c0>
+}
+801056d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801056db:	5b                   	pop    %ebx
+801056dc:	5e                   	pop    %esi
+801056dd:	5f                   	pop    %edi
+801056de:	5d                   	pop    %ebp
+801056df:	c3                   	ret
+  if(cpus[q].idle && &cpus[q] != mycpu())
+801056e0:	e8 6b f7 ff ff       	call   80104e50 <mycpu>
+801056e5:	39 c6                	cmp    %eax,%esi
+801056e7:	74 ef                	je     801056d8 <enqueue+0x1b8>
+    lapicipi(cpus[q].apicid, T_IRQ0 + IRQ_RESCHED);
+801056e9:	83 ec 08             	sub    $0x8,%esp
+801056ec:	6a 34                	push   $0x34
+801056ee:	0f b6 83 e0 67 11 80 	movzbl -0x7fee9820(%ebx),%eax
+801056f5:	50                   	push   %eax
+801056f6:	e8 e5 d6 ff ff       	call   80102de0 <lapicipi>
+801056fb:	83 c4 10             	add    $0x10,%esp
+}
+801056fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105701:	5b                   	pop    %ebx
+80105702:	5e                   	pop    %esi
+80105703:	5f                   	pop    %edi
+80105704:	5d                   	pop    %ebp
+80105705:	c3                   	ret
+80105706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010570d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105710 <setstate>:
+{
+80105710:	55                   	push   %ebp
+80105711:	89 e5                	mov    %esp,%ebp
+80105713:	57                   	push   %edi
+80105714:	56                   	push   %esi
+80105715:	89 d6                	mov    %edx,%esi
+80105717:	53                   	push   %ebx
+80105718:	89 c3                	mov    %eax,%ebx
+8010571a:	83 ec 1c             	sub    $0x1c,%esp
+  old = p->state;
+8010571d:	8b 40 08             	mov    0x8(%eax),%eax
+80105720:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(p->state == SLEEPING)
+80105723:	83 f8 02             	cmp    $0x2,%eax
+80105726:	0f 84 64 01 00 00    	je     80105890 <setstate+0x180>
+  else if(state == SLEEPING)
+8010572c:	83 fa 02             	cmp    $0x2,%edx
+8010572f:	0f 84 9b 01 00 00    	je     801058d0 <setstate+0x1c0>
+  if(state == RUNNABLE || state == ZOMBIE)
+80105735:	8d 46 fd             	lea    -0x3(%esi),%eax
+80105738:	83 e0 fd             	and    $0xfffffffd,%eax
+8010573b:	0f 84 97 00 00 00    	je     801057d8 <setstate+0xc8>
+80105741:	8b 7b 08             	mov    0x8(%ebx),%edi
+80105744:	8b 8b 8c 00 00 00    	mov    0x8c(%ebx),%ecx
+  p->state = state;
+8010574a:	89 73 08             	mov    %esi,0x8(%ebx)
+  if(p->group && was != isactive(p))
+8010574d:	85 c9                	test   %ecx,%ecx
+8010574f:	0f 84 eb 00 00 00    	je     80105840 <setstate+0x130>
+  return p->state == RUNNABLE || p->state == RUNNING;
+80105755:	83 ef 03             	sub    $0x3,%edi
+  if(state == RUNNABLE || state == ZOMBIE)
+80105758:	8d 46 fd             	lea    -0x3(%esi),%eax
+  return p->state == RUNNABLE || p->state == RUNNING;
+8010575b:	83 ff 01             	cmp    $0x1,%edi
+8010575e:	0f 96 c2             	setbe  %dl
+80105761:	83 f8 01             	cmp    $0x1,%eax
+80105764:	0f 96 c0             	setbe  %al
+  if(p->group && was != isactive(p))
+80105767:	38 c2                	cmp    %al,%dl
+80105769:	0f 84 d1 00 00 00    	je     80105840 <setstate+0x130>
+    groupadd(p->group, was ? -p->tickets : p->tickets);
+8010576f:	8b 43 58             	mov    0x58(%ebx),%eax
+80105772:	c6 45 e3 00          	movb   $0x0,-0x1d(%ebp)
+80105776:	89 c2                	mov    %eax,%edx
+80105778:	f7 d8                	neg    %eax
+8010577a:	83 ff 02             	cmp    $0x2,%edi
+8010577d:	0f 43 c2             	cmovae %edx,%eax
+  ptable.group[gid - 1].active += delta;
+80105780:	8d 54 49 fd          	lea    -0x3(%ecx,%ecx,2),%edx
+80105784:	8d 14 95 60 6e 11 80 	lea    -0x7fee91a0(,%edx,4),%edx
+  for(p = ptable.group[gid - 1].members; p; p = p->gnext)
+8010578b:	8b ba 04 2c 02 00    	mov    0x22c04(%edx),%edi
+  ptable.group[gid - 1].active += delta;
+80105791:	01 82 00 2c 02 00    	add    %eax,0x22c00(%edx)
+  for(p = ptable.group[gid - 1].members; p; p = p->gnext)
+80105797:	85 ff                	test   %edi,%edi
+80105799:	74 16                	je     801057b1 <setstate+0xa1>
+8010579b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010579f:	90                   	nop
+    reweigh(p);
+801057a0:	89 f8                	mov    %edi,%eax
+801057a2:	e8 39 f3 ff ff       	call   80104ae0 <reweigh>
+  for(p = ptable.group[gid - 1].members; p; p = p->gnext)
+801057a7:	8b bf 90 00 00 00    	mov    0x90(%edi),%edi
+801057ad:	85 ff                	test   %edi,%edi
+801057af:	75 ef                	jne    801057a0 <setstate+0x90>
+  if(state == RUNNABLE && old != RUNNABLE)
+801057b1:	80 7d e3 00          	cmpb   $0x0,-0x1d(%ebp)
+801057b5:	0f 84 85 00 00 00    	je     80105840 <setstate+0x130>
+    enqueue(p, pickrunq(p));
+801057bb:	89 d8                	mov    %ebx,%eax
+801057bd:	e8 7e f1 ff ff       	call   80104940 <pickrunq>
+}
+801057c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    enqueue(p, pickrunq(p));
+801057c5:	89 c2                	mov    %eax,%edx
+801057c7:	89 d8                	mov    %ebx,%eax
+}
+801057c9:	5b                   	pop    %ebx
+801057ca:	5e                   	pop    %esi
+801057cb:	5f                   	pop    %edi
+801057cc:	5d                   	pop    %ebp
+    enqueue(p, pickrunq(p));
+801057cd:	e9 4e fd ff ff       	jmp    80105520 <enqueue>
+801057d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  q = p->lendto;
+801057d8:	8b 83 98 00 00 00    	mov    0x98(%ebx),%eax
+  if(q == 0)
+801057de:	85 c0                	test   %eax,%eax
+801057e0:	74 19                	je     801057fb <setstate+0xeb>
+  if(q->pid == p->lendpid){
+801057e2:	8b 8b 9c 00 00 00    	mov    0x9c(%ebx),%ecx
+801057e8:	39 48 0c             	cmp    %ecx,0xc(%eax)
+801057eb:	0f 84 4f 01 00 00    	je     80105940 <setstate+0x230>
+  p->lendto = 0;
+801057f1:	c7 83 98 00 00 00 00 	movl   $0x0,0x98(%ebx)
+801057f8:	00 00 00 
+  if(state == RUNNABLE && p->state != RUNNABLE)
+801057fb:	8b 7b 08             	mov    0x8(%ebx),%edi
+  if(p->group && was != isactive(p))
+801057fe:	8b 8b 8c 00 00 00    	mov    0x8c(%ebx),%ecx
+  if(state == RUNNABLE && p->state != RUNNABLE)
+80105804:	83 fe 03             	cmp    $0x3,%esi
+80105807:	0f 85 3d ff ff ff    	jne    8010574a <setstate+0x3a>
+8010580d:	83 ff 03             	cmp    $0x3,%edi
+80105810:	74 1d                	je     8010582f <setstate+0x11f>
+  asm volatile("rdtsc" : "=A" (t));
+80105812:	0f 31                	rdtsc
+    p->readyat = rdtsc();
+80105814:	89 83 bc 00 00 00    	mov    %eax,0xbc(%ebx)
+8010581a:	89 93 c0 00 00 00    	mov    %edx,0xc0(%ebx)
+  p->state = state;
+80105820:	c7 43 08 03 00 00 00 	movl   $0x3,0x8(%ebx)
+  if(p->group && was != isactive(p))
+80105827:	85 c9                	test   %ecx,%ecx
+80105829:	0f 85 3a 01 00 00    	jne    80105969 <setstate+0x259>
+  if(state == RUNNABLE && old != RUNNABLE)
+8010582f:	83 7d e4 03          	cmpl   $0x3,-0x1c(%ebp)
+80105833:	75 86                	jne    801057bb <setstate+0xab>
+}
+80105835:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105838:	5b                   	pop    %ebx
+80105839:	5e                   	pop    %esi
+8010583a:	5f                   	pop    %edi
+8010583b:	5d                   	pop    %ebp
+8010583c:	c3                   	ret
+8010583d:	8d 76 00             	lea    0x0(%esi),%esi
+  else if(state != RUNNABLE && old == RUNNABLE)
+80105840:	83 fe 03             	cmp    $0x3,%esi
+80105843:	74 f0                	je     80105835 <setstate+0x125>
+80105845:	83 7d e4 03          	cmpl   $0x3,-0x1c(%ebp)
+80105849:	75 ea                	jne    80105835 <setstate+0x125>
+  q = *(volatile int*)&p->rq;
+8010584b:	8b 7b 64             	mov    0x64(%ebx),%edi
+  if(q < 0)
+8010584e:	85 ff                	test   %edi,%edi
+80105850:	78 e3                	js     80105835 <setstate+0x125>
+  rq = &ptable.runq[q];
+80105852:	69 f7 78 40 00 00    	imul   $0x4078,%edi,%esi
+  acquire(&rq->lock);
+80105858:	83 ec 0c             	sub    $0xc,%esp
+  rq = &ptable.runq[q];
+8010585b:	81 c6 9c 96 11 80    	add    $0x8011969c,%esi
+  acquire(&rq->lock);
+80105861:	56                   	push   %esi
+80105862:	e8 69 26 00 00       	call   80107ed0 <acquire>
+  if(p->rq == q)
+80105867:	83 c4 10             	add    $0x10,%esp
+8010586a:	3b 7b 64             	cmp    0x64(%ebx),%edi
+8010586d:	0f 85 a5 00 00 00    	jne    80105918 <setstate+0x208>
+  rqremove(rq, p);
+80105873:	89 da                	mov    %ebx,%edx
+80105875:	89 f0                	mov    %esi,%eax
+80105877:	e8 b4 eb ff ff       	call   80104430 <rqremove>
+  release(&rq->lock);
+8010587c:	83 ec 0c             	sub    $0xc,%esp
+8010587f:	56                   	push   %esi
+80105880:	e8 eb 25 00 00       	call   80107e70 <release>
+  return 1;
+80105885:	83 c4 10             	add    $0x10,%esp
+}
+80105888:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010588b:	5b                   	pop    %ebx
+8010588c:	5e                   	pop    %esi
+8010588d:	5f                   	pop    %edi
+8010588e:	5d                   	pop    %ebp
+8010588f:	c3                   	ret
+  h = (uint)chan;
+80105890:	8b 53 2c             	mov    0x2c(%ebx),%edx
+    p->cprev->cnext = p->cnext;
+80105893:	8b 4b 34             	mov    0x34(%ebx),%ecx
+  return &ptable.sleepq[(h ^ (h >> 12)) / sizeof(int) % NSLEEPQ];
+80105896:	89 d0                	mov    %edx,%eax
+80105898:	c1 e8 0c             	shr    $0xc,%eax
+8010589b:	31 d0                	xor    %edx,%eax
+  if(p->cprev)
+8010589d:	8b 53 38             	mov    0x38(%ebx),%edx
+  return &ptable.sleepq[(h ^ (h >> 12)) / sizeof(int) % NSLEEPQ];
+801058a0:	c1 e8 02             	shr    $0x2,%eax
+801058a3:	0f b6 c0             	movzbl %al,%eax
+  if(p->cprev)
+801058a6:	85 d2                	test   %edx,%edx
+801058a8:	74 16                	je     801058c0 <setstate+0x1b0>
+    p->cprev->cnext = p->cnext;
+801058aa:	89 4a 34             	mov    %ecx,0x34(%edx)
+  if(p->cnext)
+801058ad:	8b 53 34             	mov    0x34(%ebx),%edx
+    p->cnext->cprev = p->cprev;
+801058b0:	8b 4b 38             	mov    0x38(%ebx),%ecx
+  if(p->cnext)
+801058b3:	85 d2                	test   %edx,%edx
+801058b5:	74 79                	je     80105930 <setstate+0x220>
+    p->cnext->cprev = p->cprev;
+801058b7:	89 4a 38             	mov    %ecx,0x38(%edx)
+801058ba:	e9 76 fe ff ff       	jmp    80105735 <setstate+0x25>
+801058bf:	90                   	nop
+    q->head = p->cnext;
+801058c0:	89 0c c5 9c 8e 11 80 	mov    %ecx,-0x7fee7164(,%eax,8)
+801058c7:	eb e4                	jmp    801058ad <setstate+0x19d>
+801058c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  h = (uint)chan;
+801058d0:	8b 53 2c             	mov    0x2c(%ebx),%edx
+  p->cnext = 0;
+801058d3:	c7 43 34 00 00 00 00 	movl   $0x0,0x34(%ebx)
+  return &ptable.sleepq[(h ^ (h >> 12)) / sizeof(int) % NSLEEPQ];
+801058da:	89 d0                	mov    %edx,%eax
+801058dc:	c1 e8 0c             	shr    $0xc,%eax
+801058df:	31 d0                	xor    %edx,%eax
+801058e1:	c1 e8 02             	shr    $0x2,%eax
+801058e4:	0f b6 c0             	movzbl %al,%eax
+  p->cprev = q->tail;
+801058e7:	05 06 04 00 00       	add    $0x406,%eax
+801058ec:	8b 14 c5 70 6e 11 80 	mov    -0x7fee9190(,%eax,8),%edx
+801058f3:	89 53 38             	mov    %edx,0x38(%ebx)
+  if(q->tail)
+801058f6:	85 d2                	test   %edx,%edx
+801058f8:	74 66                	je     80105960 <setstate+0x250>
+    q->tail->cnext = p;
+801058fa:	89 5a 34             	mov    %ebx,0x34(%edx)
+  q->tail = p;
+801058fd:	89 1c c5 70 6e 11 80 	mov    %ebx,-0x7fee9190(,%eax,8)
+  if(state == RUNNABLE || state == ZOMBIE)
+80105904:	8b 7b 08             	mov    0x8(%ebx),%edi
+80105907:	8b 8b 8c 00 00 00    	mov    0x8c(%ebx),%ecx
+8010590d:	e9 38 fe ff ff       	jmp    8010574a <setstate+0x3a>
+80105912:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  release(&rq->lock);
+80105918:	83 ec 0c             	sub    $0xc,%esp
+8010591b:	56                   	push   %esi
+8010591c:	e8 4f 25 00 00       	call   80107e70 <release>
+80105921:	83 c4 10             	add    $0x10,%esp
+}
+80105924:	e9 0c ff ff ff       	jmp    80105835 <setstate+0x125>
+80105929:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    q->tail = p->cprev;
+80105930:	89 0c c5 a0 8e 11 80 	mov    %ecx,-0x7fee7160(,%eax,8)
+80105937:	e9 f9 fd ff ff       	jmp    80105735 <setstate+0x25>
+8010593c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    q->borrowed -= p->lent;
+80105940:	8b 93 a0 00 00 00    	mov    0xa0(%ebx),%edx
+80105946:	29 90 94 00 00 00    	sub    %edx,0x94(%eax)
+    reweigh(q);
+8010594c:	e8 8f f1 ff ff       	call   80104ae0 <reweigh>
+80105951:	e9 9b fe ff ff       	jmp    801057f1 <setstate+0xe1>
+80105956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010595d:	8d 76 00             	lea    0x0(%esi),%esi
+    q->head = p;
+80105960:	89 1c c5 6c 6e 11 80 	mov    %ebx,-0x7fee9194(,%eax,8)
+80105967:	eb 94                	jmp    801058fd <setstate+0x1ed>
+  return p->state == RUNNABLE || p->state == RUNNING;
+80105969:	83 ef 03             	sub    $0x3,%edi
+  if(p->group && was != isactive(p))
+8010596c:	83 ff 01             	cmp    $0x1,%edi
+8010596f:	0f 86 ba fe ff ff    	jbe    8010582f <setstate+0x11f>
+  if(state == RUNNABLE && old != RUNNABLE)
+80105975:	83 7d e4 03          	cmpl   $0x3,-0x1c(%ebp)
+    groupadd(p->group, was ? -p->tickets : p->tickets);
+80105979:	8b 43 58             	mov    0x58(%ebx),%eax
+  if(state == RUNNABLE && old != RUNNABLE)
+8010597c:	0f 95 45 e3          	setne  -0x1d(%ebp)
+80105980:	e9 fb fd ff ff       	jmp    80105780 <setstate+0x70>
+80105985:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010598c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105990 <wakeupn>:
+// have slept longest first, and return how many woke.
+// Only chan's sleep queue is searched.
+// The ptable lock must be held.
+static int
+wakeupn(void *chan, int n)
+{
+80105990:	55                   	push   %ebp
+80105991:	89 e5                	mov    %esp,%ebp
+80105993:	57                   	push   %edi
+  struct proc *p, *next;
+  int woken;
+
+  woken = 0;
+80105994:	31 ff                	xor    %edi,%edi
+{
+80105996:	56                   	push   %esi
+80105997:	89 c6                	mov    %eax,%esi
+  return &ptable.sleepq[(h ^ (h >> 12)) / sizeof(int) % NSLEEPQ];
+80105999:	c1 e8 0c             	shr    $0xc,%eax
+{
+8010599c:	53                   	push   %ebx
+  return &ptable.sleepq[(h ^ (h >> 12)) / sizeof(int) % NSLEEPQ];
+8010599d:	31 f0                	xor    %esi,%eax
+8010599f:	c1 e8 02             	shr    $0x2,%eax
+801059a2:	0f b6 c0             	movzbl %al,%eax
+{
+801059a5:	83 ec 1c             	sub    $0x1c,%esp
+  for(p = sleepq(chan)->head; p && woken < n; p = next){
+801059a8:	8b 1c c5 9c 8e 11 80 	mov    -0x7fee7164(,%eax,8),%ebx
+801059af:	85 db                	test   %ebx,%ebx
+801059b1:	74 36                	je     801059e9 <wakeupn+0x59>
+801059b3:	89 d1                	mov    %edx,%ecx
+801059b5:	85 d2                	test   %edx,%edx
+801059b7:	7f 0f                	jg     801059c8 <wakeupn+0x38>
+801059b9:	eb 2e                	jmp    801059e9 <wakeupn+0x59>
+801059bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801059bf:	90                   	nop
+801059c0:	85 db                	test   %ebx,%ebx
+801059c2:	74 25                	je     801059e9 <wakeupn+0x59>
+801059c4:	39 cf                	cmp    %ecx,%edi
+801059c6:	7d 21                	jge    801059e9 <wakeupn+0x59>
+    next = p->cnext;
+801059c8:	89 d8                	mov    %ebx,%eax
+801059ca:	8b 5b 34             	mov    0x34(%ebx),%ebx
+    if(p->chan == chan){
+801059cd:	39 70 2c             	cmp    %esi,0x2c(%eax)
+801059d0:	75 ee                	jne    801059c0 <wakeupn+0x30>
+      setstate(p, RUNNABLE);
+801059d2:	ba 03 00 00 00       	mov    $0x3,%edx
+801059d7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+      woken++;
+801059da:	83 c7 01             	add    $0x1,%edi
+      setstate(p, RUNNABLE);
+801059dd:	e8 2e fd ff ff       	call   80105710 <setstate>
+      woken++;
+801059e2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(p = sleepq(chan)->head; p && woken < n; p = next){
+801059e5:	85 db                	test   %ebx,%ebx
+801059e7:	75 db                	jne    801059c4 <wakeupn+0x34>
+    }
+  }
+  return woken;
+}
+801059e9:	83 c4 1c             	add    $0x1c,%esp
+801059ec:	89 f8                	mov    %edi,%eax
+801059ee:	5b                   	pop    %ebx
+801059ef:	5e                   	pop    %esi
+801059f0:	5f                   	pop    %edi
+801059f1:	5d                   	pop    %ebp
+801059f2:	c3                   	ret
+801059f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801059fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105a00 <myproc>:
+myproc(void) {
+80105a00:	55                   	push   %ebp
+80105a01:	89 e5                	mov    %esp,%ebp
+80105a03:	53                   	push   %ebx
+80105a04:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+80105a07:	e8 74 23 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80105a0c:	e8 3f f4 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80105a11:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80105a17:	e8 b4 23 00 00       	call   80107dd0 <popcli>
+}
+80105a1c:	89 d8                	mov    %ebx,%eax
+80105a1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105a21:	c9                   	leave
+80105a22:	c3                   	ret
+80105a23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105a30 <userinit>:
+{
+80105a30:	55                   	push   %ebp
+80105a31:	89 e5                	mov    %esp,%ebp
+80105a33:	56                   	push   %esi
+80105a34:	53                   	push   %ebx
+  p = allocproc();
+80105a35:	e8 96 f4 ff ff       	call   80104ed0 <allocproc>
+  initproc = p;
+80105a3a:	a3 a4 9b 13 80       	mov    %eax,0x80139ba4
+  p = allocproc();
+80105a3f:	89 c3                	mov    %eax,%ebx
+  if((pgdir = setupkvm()) == 0 || (p->mm = mmalloc(pgdir, PGSIZE)) == 0)
+80105a41:	e8 aa 57 00 00       	call   8010b1f0 <setupkvm>
+80105a46:	85 c0                	test   %eax,%eax
+80105a48:	0f 84 fb 00 00 00    	je     80105b49 <userinit+0x119>
+80105a4e:	83 ec 08             	sub    $0x8,%esp
+80105a51:	89 c6                	mov    %eax,%esi
+80105a53:	68 00 10 00 00       	push   $0x1000
+80105a58:	50                   	push   %eax
+80105a59:	e8 52 58 00 00       	call   8010b2b0 <mmalloc>
+80105a5e:	83 c4 10             	add    $0x10,%esp
+80105a61:	89 03                	mov    %eax,(%ebx)
+80105a63:	85 c0                	test   %eax,%eax
+80105a65:	0f 84 de 00 00 00    	je     80105b49 <userinit+0x119>
+  inituvm(pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80105a6b:	83 ec 04             	sub    $0x4,%esp
+80105a6e:	68 2c 00 00 00       	push   $0x2c
+80105a73:	68 60 f4 10 80       	push   $0x8010f460
+80105a78:	56                   	push   %esi
+80105a79:	e8 22 52 00 00       	call   8010aca0 <inituvm>
+  memset(p->tf, 0, sizeof(*p->tf));
+80105a7e:	83 c4 0c             	add    $0xc,%esp
+80105a81:	6a 4c                	push   $0x4c
+80105a83:	6a 00                	push   $0x0
+80105a85:	ff 73 24             	push   0x24(%ebx)
+80105a88:	e8 23 25 00 00       	call   80107fb0 <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80105a8d:	8b 43 24             	mov    0x24(%ebx),%eax
+80105a90:	ba 1b 00 00 00       	mov    $0x1b,%edx
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80105a95:	83 c4 0c             	add    $0xc,%esp
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80105a98:	b9 23 00 00 00       	mov    $0x23,%ecx
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80105a9d:	66 89 50 3c          	mov    %dx,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80105aa1:	8b 43 24             	mov    0x24(%ebx),%eax
+80105aa4:	66 89 48 2c          	mov    %cx,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+80105aa8:	8b 43 24             	mov    0x24(%ebx),%eax
+80105aab:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105aaf:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+80105ab3:	8b 43 24             	mov    0x24(%ebx),%eax
+80105ab6:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105aba:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+80105abe:	8b 43 24             	mov    0x24(%ebx),%eax
+80105ac1:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+80105ac8:	8b 43 24             	mov    0x24(%ebx),%eax
+80105acb:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80105ad2:	8b 43 24             	mov    0x24(%ebx),%eax
+80105ad5:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80105adc:	8d 43 48             	lea    0x48(%ebx),%eax
+80105adf:	6a 10                	push   $0x10
+80105ae1:	68 b5 bf 10 80       	push   $0x8010bfb5
+80105ae6:	50                   	push   %eax
+80105ae7:	e8 74 26 00 00       	call   80108160 <safestrcpy>
+  if((p->files = fdtalloc()) == 0 || (p->cwd = cwdalloc(namei("/"))) == 0)
+80105aec:	e8 3f b7 ff ff       	call   80101230 <fdtalloc>
+80105af1:	83 c4 10             	add    $0x10,%esp
+80105af4:	89 43 40             	mov    %eax,0x40(%ebx)
+80105af7:	85 c0                	test   %eax,%eax
+80105af9:	74 4e                	je     80105b49 <userinit+0x119>
+80105afb:	83 ec 0c             	sub    $0xc,%esp
+80105afe:	68 be bf 10 80       	push   $0x8010bfbe
+80105b03:	e8 38 ca ff ff       	call   80102540 <namei>
+80105b08:	89 04 24             	mov    %eax,(%esp)
+80105b0b:	e8 40 b9 ff ff       	call   80101450 <cwdalloc>
+80105b10:	83 c4 10             	add    $0x10,%esp
+80105b13:	89 43 44             	mov    %eax,0x44(%ebx)
+80105b16:	85 c0                	test   %eax,%eax
+80105b18:	74 2f                	je     80105b49 <userinit+0x119>
+  acquire(&ptable.lock);
+80105b1a:	83 ec 0c             	sub    $0xc,%esp
+80105b1d:	68 60 6e 11 80       	push   $0x80116e60
+80105b22:	e8 a9 23 00 00       	call   80107ed0 <acquire>
+  setstate(p, RUNNABLE);
+80105b27:	89 d8                	mov    %ebx,%eax
+80105b29:	ba 03 00 00 00       	mov    $0x3,%edx
+80105b2e:	e8 dd fb ff ff       	call   80105710 <setstate>
+  release(&ptable.lock);
+80105b33:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+80105b3a:	e8 31 23 00 00       	call   80107e70 <release>
+}
+80105b3f:	83 c4 10             	add    $0x10,%esp
+80105b42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105b45:	5b                   	pop    %ebx
+80105b46:	5e                   	pop    %esi
+80105b47:	5d                   	pop    %ebp
+80105b48:	c3                   	ret
+    panic("userinit: out of memory?");
+80105b49:	83 ec 0c             	sub    $0xc,%esp
+80105b4c:	68 9c bf 10 80       	push   $0x8010bf9c
+80105b51:	e8 2a a8 ff ff       	call   80100380 <panic>
+80105b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105b5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105b60 <growproc>:
+{
+80105b60:	55                   	push   %ebp
+80105b61:	89 e5                	mov    %esp,%ebp
+80105b63:	57                   	push   %edi
+80105b64:	56                   	push   %esi
+80105b65:	53                   	push   %ebx
+80105b66:	83 ec 1c             	sub    $0x1c,%esp
+  pushcli();
+80105b69:	e8 12 22 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80105b6e:	e8 dd f2 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80105b73:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80105b79:	e8 52 22 00 00       	call   80107dd0 <popcli>
+  acquiresleep(&mm->vmlock);
+80105b7e:	83 ec 0c             	sub    $0xc,%esp
+  struct mm *mm = curproc->mm;
+80105b81:	8b 33                	mov    (%ebx),%esi
+  acquiresleep(&mm->vmlock);
+80105b83:	8d 7e 34             	lea    0x34(%esi),%edi
+80105b86:	57                   	push   %edi
+80105b87:	e8 74 20 00 00       	call   80107c00 <acquiresleep>
+  if(n > 0){
+80105b8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  sz = oldsz = mm->sz;
+80105b8f:	8b 5e 78             	mov    0x78(%esi),%ebx
+  if(n > 0){
+80105b92:	83 c4 10             	add    $0x10,%esp
+80105b95:	85 c0                	test   %eax,%eax
+80105b97:	7f 1f                	jg     80105bb8 <growproc+0x58>
+  } else if(n < 0)
+80105b99:	75 55                	jne    80105bf0 <growproc+0x90>
+  releasesleep(&mm->vmlock);
+80105b9b:	83 ec 0c             	sub    $0xc,%esp
+80105b9e:	57                   	push   %edi
+80105b9f:	e8 bc 20 00 00       	call   80107c60 <releasesleep>
+  return oldsz;
+80105ba4:	89 d8                	mov    %ebx,%eax
+80105ba6:	83 c4 10             	add    $0x10,%esp
+}
+80105ba9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105bac:	5b                   	pop    %ebx
+80105bad:	5e                   	pop    %esi
+80105bae:	5f                   	pop    %edi
+80105baf:	5d                   	pop    %ebp
+80105bb0:	c3                   	ret
+80105bb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if((sz = allocuvm(mm->pgdir, sz, sz + n)) == 0){
+80105bb8:	8b 45 08             	mov    0x8(%ebp),%eax
+80105bbb:	83 ec 04             	sub    $0x4,%esp
+80105bbe:	01 d8                	add    %ebx,%eax
+80105bc0:	50                   	push   %eax
+80105bc1:	53                   	push   %ebx
+80105bc2:	ff 76 74             	push   0x74(%esi)
+80105bc5:	e8 26 52 00 00       	call   8010adf0 <allocuvm>
+80105bca:	83 c4 10             	add    $0x10,%esp
+80105bcd:	85 c0                	test   %eax,%eax
+80105bcf:	74 34                	je     80105c05 <growproc+0xa5>
+    acquire(&mm->lock);
+80105bd1:	83 ec 0c             	sub    $0xc,%esp
+80105bd4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105bd7:	56                   	push   %esi
+80105bd8:	e8 f3 22 00 00       	call   80107ed0 <acquire>
+    mm->sz = sz;
+80105bdd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105be0:	89 46 78             	mov    %eax,0x78(%esi)
+    release(&mm->lock);
+80105be3:	89 34 24             	mov    %esi,(%esp)
+80105be6:	e8 85 22 00 00       	call   80107e70 <release>
+80105beb:	83 c4 10             	add    $0x10,%esp
+80105bee:	eb ab                	jmp    80105b9b <growproc+0x3b>
+    shrinkuvm(mm, sz, sz + n);
+80105bf0:	8b 45 08             	mov    0x8(%ebp),%eax
+80105bf3:	83 ec 04             	sub    $0x4,%esp
+80105bf6:	01 d8                	add    %ebx,%eax
+80105bf8:	50                   	push   %eax
+80105bf9:	53                   	push   %ebx
+80105bfa:	56                   	push   %esi
+80105bfb:	e8 40 54 00 00       	call   8010b040 <shrinkuvm>
+80105c00:	83 c4 10             	add    $0x10,%esp
+80105c03:	eb 96                	jmp    80105b9b <growproc+0x3b>
+      releasesleep(&mm->vmlock);
+80105c05:	83 ec 0c             	sub    $0xc,%esp
+80105c08:	57                   	push   %edi
+80105c09:	e8 52 20 00 00       	call   80107c60 <releasesleep>
+      return -1;
+80105c0e:	83 c4 10             	add    $0x10,%esp
+80105c11:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105c16:	eb 91                	jmp    80105ba9 <growproc+0x49>
+80105c18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105c1f:	90                   	nop
+
+80105c20 <fork>:
+{
+80105c20:	55                   	push   %ebp
+80105c21:	89 e5                	mov    %esp,%ebp
+80105c23:	57                   	push   %edi
+80105c24:	56                   	push   %esi
+80105c25:	53                   	push   %ebx
+80105c26:	83 ec 1c             	sub    $0x1c,%esp
+  pushcli();
+80105c29:	e8 52 21 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80105c2e:	e8 1d f2 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80105c33:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80105c39:	e8 92 21 00 00       	call   80107dd0 <popcli>
+  if((np = allocproc()) == 0){
+80105c3e:	e8 8d f2 ff ff       	call   80104ed0 <allocproc>
+80105c43:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105c46:	85 c0                	test   %eax,%eax
+80105c48:	0f 84 51 01 00 00    	je     80105d9f <fork+0x17f>
+  acquiresleep(&curproc->mm->vmlock);
+80105c4e:	8b 33                	mov    (%ebx),%esi
+80105c50:	83 ec 0c             	sub    $0xc,%esp
+80105c53:	8d 46 34             	lea    0x34(%esi),%eax
+80105c56:	50                   	push   %eax
+80105c57:	e8 a4 1f 00 00       	call   80107c00 <acquiresleep>
+  sz = curproc->mm->sz;
+80105c5c:	8b 03                	mov    (%ebx),%eax
+  pgdir = copyuvm(curproc->mm->pgdir, sz);
+80105c5e:	5a                   	pop    %edx
+80105c5f:	59                   	pop    %ecx
+  sz = curproc->mm->sz;
+80105c60:	8b 78 78             	mov    0x78(%eax),%edi
+  pgdir = copyuvm(curproc->mm->pgdir, sz);
+80105c63:	57                   	push   %edi
+80105c64:	ff 70 74             	push   0x74(%eax)
+80105c67:	e8 14 58 00 00       	call   8010b480 <copyuvm>
+  releasesleep(&curproc->mm->vmlock);
+80105c6c:	8b 0b                	mov    (%ebx),%ecx
+  pgdir = copyuvm(curproc->mm->pgdir, sz);
+80105c6e:	89 c6                	mov    %eax,%esi
+  releasesleep(&curproc->mm->vmlock);
+80105c70:	8d 41 34             	lea    0x34(%ecx),%eax
+80105c73:	89 04 24             	mov    %eax,(%esp)
+80105c76:	e8 e5 1f 00 00       	call   80107c60 <releasesleep>
+  if(pgdir == 0 || (np->mm = mmalloc(pgdir, sz)) == 0){
+80105c7b:	83 c4 10             	add    $0x10,%esp
+80105c7e:	85 f6                	test   %esi,%esi
+80105c80:	0f 84 2c 01 00 00    	je     80105db2 <fork+0x192>
+80105c86:	83 ec 08             	sub    $0x8,%esp
+80105c89:	57                   	push   %edi
+80105c8a:	56                   	push   %esi
+80105c8b:	e8 20 56 00 00       	call   8010b2b0 <mmalloc>
+80105c90:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80105c93:	83 c4 10             	add    $0x10,%esp
+80105c96:	89 02                	mov    %eax,(%edx)
+80105c98:	85 c0                	test   %eax,%eax
+80105c9a:	0f 84 06 01 00 00    	je     80105da6 <fork+0x186>
+  if((np->files = fdtcopy(curproc->files)) == 0 ||
+80105ca0:	83 ec 0c             	sub    $0xc,%esp
+80105ca3:	ff 73 40             	push   0x40(%ebx)
+80105ca6:	e8 35 b6 ff ff       	call   801012e0 <fdtcopy>
+80105cab:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80105cae:	83 c4 10             	add    $0x10,%esp
+80105cb1:	89 46 40             	mov    %eax,0x40(%esi)
+80105cb4:	85 c0                	test   %eax,%eax
+80105cb6:	0f 84 b6 00 00 00    	je     80105d72 <fork+0x152>
+     (np->cwd = cwdcopy(curproc->cwd)) == 0){
+80105cbc:	83 ec 0c             	sub    $0xc,%esp
+80105cbf:	ff 73 44             	push   0x44(%ebx)
+80105cc2:	e8 39 b8 ff ff       	call   80101500 <cwdcopy>
+  if((np->files = fdtcopy(curproc->files)) == 0 ||
+80105cc7:	83 c4 10             	add    $0x10,%esp
+     (np->cwd = cwdcopy(curproc->cwd)) == 0){
+80105cca:	89 46 44             	mov    %eax,0x44(%esi)
+  if((np->files = fdtcopy(curproc->files)) == 0 ||
+80105ccd:	85 c0                	test   %eax,%eax
+80105ccf:	0f 84 87 00 00 00    	je     80105d5c <fork+0x13c>
+  np->tickets = curproc->tickets;
+80105cd5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80105cd8:	8b 43 58             	mov    0x58(%ebx),%eax
+  *np->tf = *curproc->tf;
+80105cdb:	b9 13 00 00 00       	mov    $0x13,%ecx
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80105ce0:	83 ec 04             	sub    $0x4,%esp
+  np->tickets = curproc->tickets;
+80105ce3:	89 42 58             	mov    %eax,0x58(%edx)
+  np->affinity = curproc->affinity;
+80105ce6:	8b 43 78             	mov    0x78(%ebx),%eax
+  *np->tf = *curproc->tf;
+80105ce9:	8b 7a 24             	mov    0x24(%edx),%edi
+  np->affinity = curproc->affinity;
+80105cec:	89 42 78             	mov    %eax,0x78(%edx)
+  *np->tf = *curproc->tf;
+80105cef:	8b 73 24             	mov    0x24(%ebx),%esi
+80105cf2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  np->tf->eax = 0;
+80105cf4:	89 d7                	mov    %edx,%edi
+80105cf6:	8b 42 24             	mov    0x24(%edx),%eax
+80105cf9:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80105d00:	8d 43 48             	lea    0x48(%ebx),%eax
+80105d03:	6a 10                	push   $0x10
+80105d05:	50                   	push   %eax
+80105d06:	8d 42 48             	lea    0x48(%edx),%eax
+80105d09:	50                   	push   %eax
+80105d0a:	e8 51 24 00 00       	call   80108160 <safestrcpy>
+  pid = np->pid;
+80105d0f:	8b 77 0c             	mov    0xc(%edi),%esi
+  acquire(&ptable.lock);
+80105d12:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+80105d19:	e8 b2 21 00 00       	call   80107ed0 <acquire>
+  child->parent = parent;
+80105d1e:	89 5f 10             	mov    %ebx,0x10(%edi)
+  child->sibling = parent->children;
+80105d21:	8b 43 14             	mov    0x14(%ebx),%eax
+80105d24:	89 47 18             	mov    %eax,0x18(%edi)
+  setgroup(np, curproc->group);
+80105d27:	8b 93 8c 00 00 00    	mov    0x8c(%ebx),%edx
+80105d2d:	89 f8                	mov    %edi,%eax
+  parent->children = child;
+80105d2f:	89 7b 14             	mov    %edi,0x14(%ebx)
+  setgroup(np, curproc->group);
+80105d32:	e8 39 ef ff ff       	call   80104c70 <setgroup>
+  setstate(np, RUNNABLE);
+80105d37:	ba 03 00 00 00       	mov    $0x3,%edx
+80105d3c:	89 f8                	mov    %edi,%eax
+80105d3e:	e8 cd f9 ff ff       	call   80105710 <setstate>
+  release(&ptable.lock);
+80105d43:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+80105d4a:	e8 21 21 00 00       	call   80107e70 <release>
+  return pid;
+80105d4f:	83 c4 10             	add    $0x10,%esp
+}
+80105d52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105d55:	89 f0                	mov    %esi,%eax
+80105d57:	5b                   	pop    %ebx
+80105d58:	5e                   	pop    %esi
+80105d59:	5f                   	pop    %edi
+80105d5a:	5d                   	pop    %ebp
+80105d5b:	c3                   	ret
+    if(np->files)
+80105d5c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105d5f:	8b 40 40             	mov    0x40(%eax),%eax
+80105d62:	85 c0                	test   %eax,%eax
+80105d64:	74 0c                	je     80105d72 <fork+0x152>
+      fdtput(np->files);
+80105d66:	83 ec 0c             	sub    $0xc,%esp
+80105d69:	50                   	push   %eax
+80105d6a:	e8 41 b6 ff ff       	call   801013b0 <fdtput>
+80105d6f:	83 c4 10             	add    $0x10,%esp
+    np->files = 0;
+80105d72:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    acquire(&ptable.lock);
+80105d75:	83 ec 0c             	sub    $0xc,%esp
+    np->files = 0;
+80105d78:	c7 43 40 00 00 00 00 	movl   $0x0,0x40(%ebx)
+    acquire(&ptable.lock);
+80105d7f:	68 60 6e 11 80       	push   $0x80116e60
+80105d84:	e8 47 21 00 00       	call   80107ed0 <acquire>
+    freeproc(np);
+80105d89:	89 d8                	mov    %ebx,%eax
+80105d8b:	e8 20 e2 ff ff       	call   80103fb0 <freeproc>
+    release(&ptable.lock);
+80105d90:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+80105d97:	e8 d4 20 00 00       	call   80107e70 <release>
+    return -1;
+80105d9c:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80105d9f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105da4:	eb ac                	jmp    80105d52 <fork+0x132>
+      freevm(pgdir);
+80105da6:	83 ec 0c             	sub    $0xc,%esp
+80105da9:	56                   	push   %esi
+80105daa:	e8 c1 53 00 00       	call   8010b170 <freevm>
+80105daf:	83 c4 10             	add    $0x10,%esp
+    acquire(&ptable.lock);
+80105db2:	83 ec 0c             	sub    $0xc,%esp
+80105db5:	68 60 6e 11 80       	push   $0x80116e60
+80105dba:	e8 11 21 00 00       	call   80107ed0 <acquire>
+    freeproc(np);
+80105dbf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105dc2:	e8 e9 e1 ff ff       	call   80103fb0 <freeproc>
+    release(&ptable.lock);
+80105dc7:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+80105dce:	e8 9d 20 00 00       	call   80107e70 <release>
+    return -1;
+80105dd3:	83 c4 10             	add    $0x10,%esp
+80105dd6:	eb c7                	jmp    80105d9f <fork+0x17f>
+80105dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105ddf:	90                   	nop
+
+80105de0 <scheduler>:
+{
+80105de0:	55                   	push   %ebp
+80105de1:	89 e5                	mov    %esp,%ebp
+80105de3:	57                   	push   %edi
+80105de4:	56                   	push   %esi
+80105de5:	53                   	push   %ebx
+80105de6:	83 ec 2c             	sub    $0x2c,%esp
+  struct cpu *c = mycpu();
+80105de9:	e8 62 f0 ff ff       	call   80104e50 <mycpu>
+    if(!runqready(c - cpus)){
+80105dee:	89 c3                	mov    %eax,%ebx
+  struct cpu *c = mycpu();
+80105df0:	89 c6                	mov    %eax,%esi
+80105df2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  c->proc = 0;
+80105df5:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+80105dfc:	00 00 00 
+    if(!runqready(c - cpus)){
+80105dff:	81 eb e0 67 11 80    	sub    $0x801167e0,%ebx
+80105e05:	b8 01 00 00 00       	mov    $0x1,%eax
+80105e0a:	c1 fb 04             	sar    $0x4,%ebx
+80105e0d:	69 db c5 4e ec c4    	imul   $0xc4ec4ec5,%ebx,%ebx
+80105e13:	89 d9                	mov    %ebx,%ecx
+80105e15:	d3 e0                	shl    %cl,%eax
+80105e17:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  xchg(&c->idle, 1);
+80105e1a:	8d 86 bc 00 00 00    	lea    0xbc(%esi),%eax
+80105e20:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80105e23:	8d 86 b0 00 00 00    	lea    0xb0(%esi),%eax
+80105e29:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80105e2c:	8d 86 b4 00 00 00    	lea    0xb4(%esi),%eax
+80105e32:	89 45 cc             	mov    %eax,-0x34(%ebp)
+80105e35:	8d 46 04             	lea    0x4(%esi),%eax
+80105e38:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80105e3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105e3f:	90                   	nop
+  asm volatile("sti");
+80105e40:	fb                   	sti
+  for(i = 0; i < ncpu; i++)
+80105e41:	8b 0d c4 67 11 80    	mov    0x801167c4,%ecx
+80105e47:	85 c9                	test   %ecx,%ecx
+80105e49:	0f 8e a1 01 00 00    	jle    80105ff0 <scheduler+0x210>
+80105e4f:	31 c0                	xor    %eax,%eax
+80105e51:	eb 10                	jmp    80105e63 <scheduler+0x83>
+80105e53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105e57:	90                   	nop
+80105e58:	83 c0 01             	add    $0x1,%eax
+80105e5b:	39 c1                	cmp    %eax,%ecx
+80105e5d:	0f 84 8d 01 00 00    	je     80105ff0 <scheduler+0x210>
+    if(*(volatile int*)&ptable.runq[i].nok[id] > 0)
+80105e63:	69 d0 1e 10 00 00    	imul   $0x101e,%eax,%edx
+80105e69:	8d 94 13 18 0a 00 00 	lea    0xa18(%ebx,%edx,1),%edx
+80105e70:	8b 14 95 78 6e 11 80 	mov    -0x7fee9188(,%edx,4),%edx
+80105e77:	85 d2                	test   %edx,%edx
+80105e79:	7e dd                	jle    80105e58 <scheduler+0x78>
+    if(c->next == 0 && c->gang == 0 && edfpick(c - cpus) == 0){
+80105e7b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105e7e:	8b 80 b0 00 00 00    	mov    0xb0(%eax),%eax
+80105e84:	85 c0                	test   %eax,%eax
+80105e86:	0f 84 c4 01 00 00    	je     80106050 <scheduler+0x270>
+    acquire(&ptable.lock);
+80105e8c:	83 ec 0c             	sub    $0xc,%esp
+80105e8f:	68 60 6e 11 80       	push   $0x80116e60
+80105e94:	e8 37 20 00 00       	call   80107ed0 <acquire>
+    } else if(p == 0 && (p = handoff(c, &c->next)) == 0){
+80105e99:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80105e9c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105e9f:	e8 bc e9 ff ff       	call   80104860 <handoff>
+80105ea4:	83 c4 10             	add    $0x10,%esp
+80105ea7:	89 c6                	mov    %eax,%esi
+80105ea9:	85 c0                	test   %eax,%eax
+80105eab:	0f 84 39 03 00 00    	je     801061ea <scheduler+0x40a>
+    if(p && gangsched)
+80105eb1:	a1 a8 9b 13 80       	mov    0x80139ba8,%eax
+80105eb6:	85 c0                	test   %eax,%eax
+80105eb8:	0f 85 2a 02 00 00    	jne    801060e8 <scheduler+0x308>
+      c->proc = p;
+80105ebe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105ec1:	89 b0 ac 00 00 00    	mov    %esi,0xac(%eax)
+      if(p->cpu >= 0 && p->cpu != c - cpus)
+80105ec7:	8b 46 68             	mov    0x68(%esi),%eax
+80105eca:	85 c0                	test   %eax,%eax
+80105ecc:	78 08                	js     80105ed6 <scheduler+0xf6>
+80105ece:	39 c3                	cmp    %eax,%ebx
+80105ed0:	74 04                	je     80105ed6 <scheduler+0xf6>
+        p->migrations++;
+80105ed2:	83 46 7c 01          	addl   $0x1,0x7c(%esi)
+      p->cpu = c - cpus;
+80105ed6:	89 5e 68             	mov    %ebx,0x68(%esi)
+  asm volatile("rdtsc" : "=A" (t));
+80105ed9:	0f 31                	rdtsc
+  for(b = 0; wait > 1 && b < NLATBUCKET - 1; b++)
+80105edb:	bf 01 00 00 00       	mov    $0x1,%edi
+  wait = rdtsc() - p->readyat;
+80105ee0:	2b 86 bc 00 00 00    	sub    0xbc(%esi),%eax
+  for(b = 0; wait > 1 && b < NLATBUCKET - 1; b++)
+80105ee6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  wait = rdtsc() - p->readyat;
+80105eeb:	1b 96 c0 00 00 00    	sbb    0xc0(%esi),%edx
+  for(b = 0; wait > 1 && b < NLATBUCKET - 1; b++)
+80105ef1:	39 c7                	cmp    %eax,%edi
+80105ef3:	bf 00 00 00 00       	mov    $0x0,%edi
+80105ef8:	19 d7                	sbb    %edx,%edi
+80105efa:	73 21                	jae    80105f1d <scheduler+0x13d>
+80105efc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    wait >>= 1;
+80105f00:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+  for(b = 0; wait > 1 && b < NLATBUCKET - 1; b++)
+80105f04:	bf 01 00 00 00       	mov    $0x1,%edi
+    wait >>= 1;
+80105f09:	d1 ea                	shr    %edx
+  for(b = 0; wait > 1 && b < NLATBUCKET - 1; b++)
+80105f0b:	83 c1 01             	add    $0x1,%ecx
+80105f0e:	39 c7                	cmp    %eax,%edi
+80105f10:	bf 00 00 00 00       	mov    $0x0,%edi
+80105f15:	19 d7                	sbb    %edx,%edi
+80105f17:	0f 82 bb 00 00 00    	jb     80105fd8 <scheduler+0x1f8>
+  p->lathist[b]++;
+80105f1d:	83 84 8e c4 00 00 00 	addl   $0x1,0xc4(%esi,%ecx,4)
+80105f24:	01 
+      switchuvm(p);
+80105f25:	83 ec 0c             	sub    $0xc,%esp
+80105f28:	56                   	push   %esi
+  ptable.lathist[b]++;
+80105f29:	83 04 8d 24 9b 13 80 	addl   $0x1,-0x7fec64dc(,%ecx,4)
+80105f30:	01 
+      switchuvm(p);
+80105f31:	e8 4a 4c 00 00       	call   8010ab80 <switchuvm>
+      setstate(p, RUNNING);
+80105f36:	ba 04 00 00 00       	mov    $0x4,%edx
+80105f3b:	89 f0                	mov    %esi,%eax
+80105f3d:	e8 ce f7 ff ff       	call   80105710 <setstate>
+80105f42:	0f 31                	rdtsc
+      p->tsc = rdtsc();
+80105f44:	89 86 54 01 00 00    	mov    %eax,0x154(%esi)
+80105f4a:	89 96 58 01 00 00    	mov    %edx,0x158(%esi)
+      swtch(&(c->scheduler), p->context);
+80105f50:	59                   	pop    %ecx
+80105f51:	5f                   	pop    %edi
+80105f52:	ff 76 28             	push   0x28(%esi)
+80105f55:	ff 75 d4             	push   -0x2c(%ebp)
+80105f58:	e8 5e 22 00 00       	call   801081bb <swtch>
+      switchkvm();
+80105f5d:	e8 0e 4c 00 00       	call   8010ab70 <switchkvm>
+80105f62:	0f 31                	rdtsc
+      p->stime += rdtsc() - p->tsc;
+80105f64:	03 86 4c 01 00 00    	add    0x14c(%esi),%eax
+80105f6a:	13 96 50 01 00 00    	adc    0x150(%esi),%edx
+80105f70:	2b 86 54 01 00 00    	sub    0x154(%esi),%eax
+80105f76:	1b 96 58 01 00 00    	sbb    0x158(%esi),%edx
+      if(c->next == 0)
+80105f7c:	83 c4 10             	add    $0x10,%esp
+      p->stime += rdtsc() - p->tsc;
+80105f7f:	89 86 4c 01 00 00    	mov    %eax,0x14c(%esi)
+      if(c->next == 0)
+80105f85:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      p->ticks += 1;
+80105f88:	83 46 5c 01          	addl   $0x1,0x5c(%esi)
+      p->stime += rdtsc() - p->tsc;
+80105f8c:	89 96 50 01 00 00    	mov    %edx,0x150(%esi)
+      if(c->next == 0)
+80105f92:	8b 80 b0 00 00 00    	mov    0xb0(%eax),%eax
+80105f98:	85 c0                	test   %eax,%eax
+80105f9a:	0f 84 d8 01 00 00    	je     80106178 <scheduler+0x398>
+      reweigh(p);
+80105fa0:	89 f0                	mov    %esi,%eax
+80105fa2:	e8 39 eb ff ff       	call   80104ae0 <reweigh>
+      if(p->state == ZOMBIE && p->detached)
+80105fa7:	83 7e 08 05          	cmpl   $0x5,0x8(%esi)
+80105fab:	0f 84 17 01 00 00    	je     801060c8 <scheduler+0x2e8>
+      c->proc = 0;
+80105fb1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105fb4:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+80105fbb:	00 00 00 
+    release(&ptable.lock);
+80105fbe:	83 ec 0c             	sub    $0xc,%esp
+80105fc1:	68 60 6e 11 80       	push   $0x80116e60
+80105fc6:	e8 a5 1e 00 00       	call   80107e70 <release>
+80105fcb:	83 c4 10             	add    $0x10,%esp
+80105fce:	e9 6d fe ff ff       	jmp    80105e40 <scheduler+0x60>
+80105fd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105fd7:	90                   	nop
+  for(b = 0; wait > 1 && b < NLATBUCKET - 1; b++)
+80105fd8:	83 f9 1e             	cmp    $0x1e,%ecx
+80105fdb:	0f 8e 1f ff ff ff    	jle    80105f00 <scheduler+0x120>
+80105fe1:	e9 37 ff ff ff       	jmp    80105f1d <scheduler+0x13d>
+80105fe6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105fed:	8d 76 00             	lea    0x0(%esi),%esi
+  asm volatile("cli");
+80105ff0:	fa                   	cli
+  asm volatile("lock; xchgl %0, %1" :
+80105ff1:	b8 01 00 00 00       	mov    $0x1,%eax
+80105ff6:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80105ff9:	f0 87 06             	lock xchg %eax,(%esi)
+  for(i = 0; i < ncpu; i++)
+80105ffc:	8b 0d c4 67 11 80    	mov    0x801167c4,%ecx
+80106002:	85 c9                	test   %ecx,%ecx
+80106004:	7e 42                	jle    80106048 <scheduler+0x268>
+80106006:	31 c0                	xor    %eax,%eax
+80106008:	eb 0d                	jmp    80106017 <scheduler+0x237>
+8010600a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80106010:	83 c0 01             	add    $0x1,%eax
+80106013:	39 c8                	cmp    %ecx,%eax
+80106015:	74 31                	je     80106048 <scheduler+0x268>
+    if(*(volatile int*)&ptable.runq[i].nok[id] > 0)
+80106017:	69 d0 1e 10 00 00    	imul   $0x101e,%eax,%edx
+8010601d:	8d 94 13 18 0a 00 00 	lea    0xa18(%ebx,%edx,1),%edx
+80106024:	8b 14 95 78 6e 11 80 	mov    -0x7fee9188(,%edx,4),%edx
+8010602b:	85 d2                	test   %edx,%edx
+8010602d:	7e e1                	jle    80106010 <scheduler+0x230>
+  c->idle = 0;
+8010602f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106032:	c7 80 bc 00 00 00 00 	movl   $0x0,0xbc(%eax)
+80106039:	00 00 00 
+  asm volatile("sti");
+8010603c:	fb                   	sti
+      continue;
+8010603d:	e9 fe fd ff ff       	jmp    80105e40 <scheduler+0x60>
+80106042:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  asm volatile("sti; hlt");
+80106048:	fb                   	sti
+80106049:	f4                   	hlt
+}
+8010604a:	eb e3                	jmp    8010602f <scheduler+0x24f>
+8010604c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(c->next == 0 && c->gang == 0 && edfpick(c - cpus) == 0){
+80106050:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106053:	8b 80 b4 00 00 00    	mov    0xb4(%eax),%eax
+80106059:	85 c0                	test   %eax,%eax
+8010605b:	0f 85 2b fe ff ff    	jne    80105e8c <scheduler+0xac>
+80106061:	89 d8                	mov    %ebx,%eax
+80106063:	e8 88 dd ff ff       	call   80103df0 <edfpick>
+80106068:	85 c0                	test   %eax,%eax
+8010606a:	0f 85 1c fe ff ff    	jne    80105e8c <scheduler+0xac>
+      if((p = claim(c - cpus)) == 0)
+80106070:	89 d8                	mov    %ebx,%eax
+80106072:	e8 89 e4 ff ff       	call   80104500 <claim>
+80106077:	89 c6                	mov    %eax,%esi
+80106079:	85 c0                	test   %eax,%eax
+8010607b:	0f 84 bf fd ff ff    	je     80105e40 <scheduler+0x60>
+      c->qstart = lapictimer();
+80106081:	e8 aa cd ff ff       	call   80102e30 <lapictimer>
+80106086:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    acquire(&ptable.lock);
+80106089:	83 ec 0c             	sub    $0xc,%esp
+      c->qstart = lapictimer();
+8010608c:	89 87 b8 00 00 00    	mov    %eax,0xb8(%edi)
+    acquire(&ptable.lock);
+80106092:	68 60 6e 11 80       	push   $0x80116e60
+80106097:	e8 34 1e 00 00       	call   80107ed0 <acquire>
+    if(p && !cpuok(p, c - cpus)){
+8010609c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+8010609f:	23 46 78             	and    0x78(%esi),%eax
+801060a2:	83 c4 10             	add    $0x10,%esp
+801060a5:	85 c0                	test   %eax,%eax
+801060a7:	0f 85 04 fe ff ff    	jne    80105eb1 <scheduler+0xd1>
+      enqueue(p, pickrunq(p));
+801060ad:	89 f0                	mov    %esi,%eax
+801060af:	e8 8c e8 ff ff       	call   80104940 <pickrunq>
+801060b4:	89 c2                	mov    %eax,%edx
+801060b6:	89 f0                	mov    %esi,%eax
+801060b8:	e8 63 f4 ff ff       	call   80105520 <enqueue>
+    if(p && gangsched)
+801060bd:	e9 fc fe ff ff       	jmp    80105fbe <scheduler+0x1de>
+801060c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->state == ZOMBIE && p->detached)
+801060c8:	8b 96 60 01 00 00    	mov    0x160(%esi),%edx
+801060ce:	85 d2                	test   %edx,%edx
+801060d0:	0f 84 db fe ff ff    	je     80105fb1 <scheduler+0x1d1>
+        freeproc(p);
+801060d6:	89 f0                	mov    %esi,%eax
+801060d8:	e8 d3 de ff ff       	call   80103fb0 <freeproc>
+801060dd:	e9 cf fe ff ff       	jmp    80105fb1 <scheduler+0x1d1>
+801060e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(p->parent){
+801060e8:	8b 56 10             	mov    0x10(%esi),%edx
+801060eb:	85 d2                	test   %edx,%edx
+801060ed:	74 51                	je     80106140 <scheduler+0x360>
+  if(s == p || s->mm != p->mm || s->state != RUNNABLE)
+801060ef:	39 d6                	cmp    %edx,%esi
+801060f1:	74 0a                	je     801060fd <scheduler+0x31d>
+801060f3:	8b 06                	mov    (%esi),%eax
+801060f5:	39 02                	cmp    %eax,(%edx)
+801060f7:	0f 84 d2 00 00 00    	je     801061cf <scheduler+0x3ef>
+    for(s = p->parent->children; s; s = s->sibling)
+801060fd:	8b 7a 14             	mov    0x14(%edx),%edi
+80106100:	85 ff                	test   %edi,%edi
+80106102:	75 13                	jne    80106117 <scheduler+0x337>
+80106104:	eb 3a                	jmp    80106140 <scheduler+0x360>
+80106106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010610d:	8d 76 00             	lea    0x0(%esi),%esi
+80106110:	8b 7f 18             	mov    0x18(%edi),%edi
+80106113:	85 ff                	test   %edi,%edi
+80106115:	74 29                	je     80106140 <scheduler+0x360>
+  if(s == p || s->mm != p->mm || s->state != RUNNABLE)
+80106117:	39 fe                	cmp    %edi,%esi
+80106119:	74 f5                	je     80106110 <scheduler+0x330>
+8010611b:	8b 06                	mov    (%esi),%eax
+8010611d:	39 07                	cmp    %eax,(%edi)
+8010611f:	75 ef                	jne    80106110 <scheduler+0x330>
+80106121:	83 7f 08 03          	cmpl   $0x3,0x8(%edi)
+80106125:	75 e9                	jne    80106110 <scheduler+0x330>
+80106127:	89 fa                	mov    %edi,%edx
+80106129:	89 d9                	mov    %ebx,%ecx
+8010612b:	89 f0                	mov    %esi,%eax
+8010612d:	e8 fe e1 ff ff       	call   80104330 <gangoffer.part.0>
+    for(s = p->parent->children; s; s = s->sibling)
+80106132:	8b 7f 18             	mov    0x18(%edi),%edi
+80106135:	85 ff                	test   %edi,%edi
+80106137:	75 de                	jne    80106117 <scheduler+0x337>
+80106139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(s = p->children; s; s = s->sibling)
+80106140:	8b 7e 14             	mov    0x14(%esi),%edi
+80106143:	85 ff                	test   %edi,%edi
+80106145:	75 14                	jne    8010615b <scheduler+0x37b>
+80106147:	e9 72 fd ff ff       	jmp    80105ebe <scheduler+0xde>
+8010614c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106150:	8b 7f 18             	mov    0x18(%edi),%edi
+80106153:	85 ff                	test   %edi,%edi
+80106155:	0f 84 63 fd ff ff    	je     80105ebe <scheduler+0xde>
+  if(s == p || s->mm != p->mm || s->state != RUNNABLE)
+8010615b:	39 fe                	cmp    %edi,%esi
+8010615d:	74 f1                	je     80106150 <scheduler+0x370>
+8010615f:	8b 06                	mov    (%esi),%eax
+80106161:	39 07                	cmp    %eax,(%edi)
+80106163:	75 eb                	jne    80106150 <scheduler+0x370>
+80106165:	83 7f 08 03          	cmpl   $0x3,0x8(%edi)
+80106169:	75 e5                	jne    80106150 <scheduler+0x370>
+8010616b:	89 d9                	mov    %ebx,%ecx
+8010616d:	89 fa                	mov    %edi,%edx
+8010616f:	89 f0                	mov    %esi,%eax
+80106171:	e8 ba e1 ff ff       	call   80104330 <gangoffer.part.0>
+80106176:	eb d8                	jmp    80106150 <scheduler+0x370>
+  now = lapictimer();
+80106178:	e8 b3 cc ff ff       	call   80102e30 <lapictimer>
+  if(p->state == RUNNABLE || scale == 0 || now > c->qstart)
+8010617d:	83 7e 08 03          	cmpl   $0x3,0x8(%esi)
+  now = lapictimer();
+80106181:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  scale = c->qstart / 1000;
+80106184:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  if(p->state == RUNNABLE || scale == 0 || now > c->qstart)
+80106187:	0f 94 c1             	sete   %cl
+8010618a:	89 cf                	mov    %ecx,%edi
+  scale = c->qstart / 1000;
+8010618c:	8b 80 b8 00 00 00    	mov    0xb8(%eax),%eax
+  if(p->state == RUNNABLE || scale == 0 || now > c->qstart)
+80106192:	89 fa                	mov    %edi,%edx
+80106194:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+80106199:	0f 96 c1             	setbe  %cl
+8010619c:	08 d1                	or     %dl,%cl
+8010619e:	75 28                	jne    801061c8 <scheduler+0x3e8>
+801061a0:	8b 7d d0             	mov    -0x30(%ebp),%edi
+801061a3:	39 f8                	cmp    %edi,%eax
+801061a5:	72 21                	jb     801061c8 <scheduler+0x3e8>
+  scale = c->qstart / 1000;
+801061a7:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+  return (c->qstart - now) / scale;
+801061ac:	89 c1                	mov    %eax,%ecx
+  scale = c->qstart / 1000;
+801061ae:	f7 e2                	mul    %edx
+  return (c->qstart - now) / scale;
+801061b0:	29 f9                	sub    %edi,%ecx
+801061b2:	89 c8                	mov    %ecx,%eax
+  scale = c->qstart / 1000;
+801061b4:	89 d7                	mov    %edx,%edi
+  return (c->qstart - now) / scale;
+801061b6:	31 d2                	xor    %edx,%edx
+  scale = c->qstart / 1000;
+801061b8:	c1 ef 06             	shr    $0x6,%edi
+  return (c->qstart - now) / scale;
+801061bb:	f7 f7                	div    %edi
+        p->quantum = quantumused(c, p);
+801061bd:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+801061c3:	e9 d8 fd ff ff       	jmp    80105fa0 <scheduler+0x1c0>
+    return 1000;
+801061c8:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+801061cd:	eb ee                	jmp    801061bd <scheduler+0x3dd>
+  if(s == p || s->mm != p->mm || s->state != RUNNABLE)
+801061cf:	83 7a 08 03          	cmpl   $0x3,0x8(%edx)
+801061d3:	0f 85 24 ff ff ff    	jne    801060fd <scheduler+0x31d>
+801061d9:	89 d9                	mov    %ebx,%ecx
+801061db:	89 f0                	mov    %esi,%eax
+801061dd:	e8 4e e1 ff ff       	call   80104330 <gangoffer.part.0>
+    for(s = p->parent->children; s; s = s->sibling)
+801061e2:	8b 56 10             	mov    0x10(%esi),%edx
+801061e5:	e9 13 ff ff ff       	jmp    801060fd <scheduler+0x31d>
+      if((p = edfpick(c - cpus)) != 0 && !dequeue(p))
+801061ea:	89 d8                	mov    %ebx,%eax
+801061ec:	e8 ff db ff ff       	call   80103df0 <edfpick>
+801061f1:	89 c6                	mov    %eax,%esi
+801061f3:	85 c0                	test   %eax,%eax
+801061f5:	74 5e                	je     80106255 <scheduler+0x475>
+  q = *(volatile int*)&p->rq;
+801061f7:	8b 40 64             	mov    0x64(%eax),%eax
+  if(q < 0)
+801061fa:	85 c0                	test   %eax,%eax
+801061fc:	78 57                	js     80106255 <scheduler+0x475>
+  rq = &ptable.runq[q];
+801061fe:	69 f8 78 40 00 00    	imul   $0x4078,%eax,%edi
+  acquire(&rq->lock);
+80106204:	83 ec 0c             	sub    $0xc,%esp
+  rq = &ptable.runq[q];
+80106207:	89 45 d0             	mov    %eax,-0x30(%ebp)
+8010620a:	81 c7 9c 96 11 80    	add    $0x8011969c,%edi
+  acquire(&rq->lock);
+80106210:	57                   	push   %edi
+80106211:	e8 ba 1c 00 00       	call   80107ed0 <acquire>
+  if(p->rq == q)
+80106216:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80106219:	83 c4 10             	add    $0x10,%esp
+8010621c:	3b 46 64             	cmp    0x64(%esi),%eax
+8010621f:	75 28                	jne    80106249 <scheduler+0x469>
+  rqremove(rq, p);
+80106221:	89 f8                	mov    %edi,%eax
+80106223:	89 f2                	mov    %esi,%edx
+80106225:	e8 06 e2 ff ff       	call   80104430 <rqremove>
+  release(&rq->lock);
+8010622a:	83 ec 0c             	sub    $0xc,%esp
+8010622d:	57                   	push   %edi
+8010622e:	e8 3d 1c 00 00       	call   80107e70 <release>
+      c->qstart = lapictimer();
+80106233:	e8 f8 cb ff ff       	call   80102e30 <lapictimer>
+80106238:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+8010623b:	83 c4 10             	add    $0x10,%esp
+8010623e:	89 87 b8 00 00 00    	mov    %eax,0xb8(%edi)
+    if(p && gangsched)
+80106244:	e9 68 fc ff ff       	jmp    80105eb1 <scheduler+0xd1>
+  release(&rq->lock);
+80106249:	83 ec 0c             	sub    $0xc,%esp
+8010624c:	57                   	push   %edi
+8010624d:	e8 1e 1c 00 00       	call   80107e70 <release>
+80106252:	83 c4 10             	add    $0x10,%esp
+      if(p == 0 && (p = handoff(c, &c->gang)) == 0)
+80106255:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106258:	8b 55 cc             	mov    -0x34(%ebp),%edx
+8010625b:	89 f8                	mov    %edi,%eax
+8010625d:	e8 fe e5 ff ff       	call   80104860 <handoff>
+80106262:	89 c6                	mov    %eax,%esi
+80106264:	85 c0                	test   %eax,%eax
+80106266:	74 10                	je     80106278 <scheduler+0x498>
+      c->qstart = lapictimer();
+80106268:	e8 c3 cb ff ff       	call   80102e30 <lapictimer>
+8010626d:	89 87 b8 00 00 00    	mov    %eax,0xb8(%edi)
+    if(p && gangsched)
+80106273:	e9 39 fc ff ff       	jmp    80105eb1 <scheduler+0xd1>
+        p = claim(c - cpus);
+80106278:	89 d8                	mov    %ebx,%eax
+8010627a:	e8 81 e2 ff ff       	call   80104500 <claim>
+8010627f:	89 c6                	mov    %eax,%esi
+      c->qstart = lapictimer();
+80106281:	e8 aa cb ff ff       	call   80102e30 <lapictimer>
+80106286:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106289:	89 87 b8 00 00 00    	mov    %eax,0xb8(%edi)
+    if(p && gangsched)
+8010628f:	85 f6                	test   %esi,%esi
+80106291:	0f 84 27 fd ff ff    	je     80105fbe <scheduler+0x1de>
+80106297:	e9 15 fc ff ff       	jmp    80105eb1 <scheduler+0xd1>
+8010629c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801062a0 <sched>:
+{
+801062a0:	55                   	push   %ebp
+801062a1:	89 e5                	mov    %esp,%ebp
+801062a3:	56                   	push   %esi
+801062a4:	53                   	push   %ebx
+  pushcli();
+801062a5:	e8 d6 1a 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+801062aa:	e8 a1 eb ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+801062af:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801062b5:	e8 16 1b 00 00       	call   80107dd0 <popcli>
+  if(!holding(&ptable.lock))
+801062ba:	83 ec 0c             	sub    $0xc,%esp
+801062bd:	68 60 6e 11 80       	push   $0x80116e60
+801062c2:	e8 69 1b 00 00       	call   80107e30 <holding>
+801062c7:	83 c4 10             	add    $0x10,%esp
+801062ca:	85 c0                	test   %eax,%eax
+801062cc:	74 4f                	je     8010631d <sched+0x7d>
+  if(mycpu()->ncli != 1)
+801062ce:	e8 7d eb ff ff       	call   80104e50 <mycpu>
+801062d3:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+801062da:	75 68                	jne    80106344 <sched+0xa4>
+  if(p->state == RUNNING)
+801062dc:	83 7b 08 04          	cmpl   $0x4,0x8(%ebx)
+801062e0:	74 55                	je     80106337 <sched+0x97>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+801062e2:	9c                   	pushf
+801062e3:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+801062e4:	f6 c4 02             	test   $0x2,%ah
+801062e7:	75 41                	jne    8010632a <sched+0x8a>
+  intena = mycpu()->intena;
+801062e9:	e8 62 eb ff ff       	call   80104e50 <mycpu>
+  swtch(&p->context, mycpu()->scheduler);
+801062ee:	83 c3 28             	add    $0x28,%ebx
+  intena = mycpu()->intena;
+801062f1:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+  swtch(&p->context, mycpu()->scheduler);
+801062f7:	e8 54 eb ff ff       	call   80104e50 <mycpu>
+801062fc:	83 ec 08             	sub    $0x8,%esp
+801062ff:	ff 70 04             	push   0x4(%eax)
+80106302:	53                   	push   %ebx
+80106303:	e8 b3 1e 00 00       	call   801081bb <swtch>
+  mycpu()->intena = intena;
+80106308:	e8 43 eb ff ff       	call   80104e50 <mycpu>
+}
+8010630d:	83 c4 10             	add    $0x10,%esp
+  mycpu()->intena = intena;
+80106310:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+80106316:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106319:	5b                   	pop    %ebx
+8010631a:	5e                   	pop    %esi
+8010631b:	5d                   	pop    %ebp
+8010631c:	c3                   	ret
+    panic("sched ptable.lock");
+8010631d:	83 ec 0c             	sub    $0xc,%esp
+80106320:	68 c0 bf 10 80       	push   $0x8010bfc0
+80106325:	e8 56 a0 ff ff       	call   80100380 <panic>
+    panic("sched interruptible");
+8010632a:	83 ec 0c             	sub    $0xc,%esp
+8010632d:	68 ec bf 10 80       	push   $0x8010bfec
+80106332:	e8 49 a0 ff ff       	call   80100380 <panic>
+    panic("sched running");
+80106337:	83 ec 0c             	sub    $0xc,%esp
+8010633a:	68 de bf 10 80       	push   $0x8010bfde
+8010633f:	e8 3c a0 ff ff       	call   80100380 <panic>
+    panic("sched locks");
+80106344:	83 ec 0c             	sub    $0xc,%esp
+80106347:	68 d2 bf 10 80       	push   $0x8010bfd2
+8010634c:	e8 2f a0 ff ff       	call   80100380 <panic>
+80106351:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106358:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010635f:	90                   	nop
+
+80106360 <exit>:
+{
+80106360:	55                   	push   %ebp
+80106361:	89 e5                	mov    %esp,%ebp
+80106363:	57                   	push   %edi
+80106364:	56                   	push   %esi
+80106365:	53                   	push   %ebx
+80106366:	83 ec 1c             	sub    $0x1c,%esp
+  struct proc *curproc = myproc();
+80106369:	e8 92 f6 ff ff       	call   80105a00 <myproc>
+  if(curproc == initproc)
+8010636e:	39 05 a4 9b 13 80    	cmp    %eax,0x80139ba4
+80106374:	0f 84 17 01 00 00    	je     80106491 <exit+0x131>
+  fdtput(curproc->files);
+8010637a:	83 ec 0c             	sub    $0xc,%esp
+8010637d:	ff 70 40             	push   0x40(%eax)
+80106380:	89 c3                	mov    %eax,%ebx
+80106382:	e8 29 b0 ff ff       	call   801013b0 <fdtput>
+  curproc->files = 0;
+80106387:	c7 43 40 00 00 00 00 	movl   $0x0,0x40(%ebx)
+  cwdput(curproc->cwd);
+8010638e:	5a                   	pop    %edx
+8010638f:	ff 73 44             	push   0x44(%ebx)
+80106392:	e8 e9 b1 ff ff       	call   80101580 <cwdput>
+  if(curproc->detached)
+80106397:	8b 8b 60 01 00 00    	mov    0x160(%ebx),%ecx
+  curproc->cwd = 0;
+8010639d:	c7 43 44 00 00 00 00 	movl   $0x0,0x44(%ebx)
+  if(curproc->detached)
+801063a4:	83 c4 10             	add    $0x10,%esp
+801063a7:	85 c9                	test   %ecx,%ecx
+801063a9:	0f 85 88 00 00 00    	jne    80106437 <exit+0xd7>
+  acquire(&ptable.lock);
+801063af:	83 ec 0c             	sub    $0xc,%esp
+801063b2:	68 60 6e 11 80       	push   $0x80116e60
+801063b7:	e8 14 1b 00 00       	call   80107ed0 <acquire>
+// Wake up all processes sleeping on chan.
+// The ptable lock must be held.
+static void
+wakeup1(void *chan)
+{
+  wakeupn(chan, NPROC);
+801063bc:	8b 43 10             	mov    0x10(%ebx),%eax
+801063bf:	ba 00 04 00 00       	mov    $0x400,%edx
+801063c4:	e8 c7 f5 ff ff       	call   80105990 <wakeupn>
+}
+801063c9:	83 c4 10             	add    $0x10,%esp
+    adopt(initproc, p);
+801063cc:	8b 0d a4 9b 13 80    	mov    0x80139ba4,%ecx
+801063d2:	eb 1c                	jmp    801063f0 <exit+0x90>
+801063d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    curproc->children = p->sibling;
+801063d8:	8b 50 18             	mov    0x18(%eax),%edx
+801063db:	89 53 14             	mov    %edx,0x14(%ebx)
+  child->parent = parent;
+801063de:	89 48 10             	mov    %ecx,0x10(%eax)
+  child->sibling = parent->children;
+801063e1:	8b 51 14             	mov    0x14(%ecx),%edx
+801063e4:	89 50 18             	mov    %edx,0x18(%eax)
+  parent->children = child;
+801063e7:	89 41 14             	mov    %eax,0x14(%ecx)
+    if(p->state == ZOMBIE)
+801063ea:	83 78 08 05          	cmpl   $0x5,0x8(%eax)
+801063ee:	74 39                	je     80106429 <exit+0xc9>
+  while((p = curproc->children) != 0){
+801063f0:	8b 43 14             	mov    0x14(%ebx),%eax
+801063f3:	85 c0                	test   %eax,%eax
+801063f5:	75 e1                	jne    801063d8 <exit+0x78>
+  setstate(curproc, ZOMBIE);
+801063f7:	ba 05 00 00 00       	mov    $0x5,%edx
+801063fc:	89 d8                	mov    %ebx,%eax
+801063fe:	e8 0d f3 ff ff       	call   80105710 <setstate>
+  setgroup(curproc, 0);
+80106403:	31 d2                	xor    %edx,%edx
+80106405:	89 d8                	mov    %ebx,%eax
+80106407:	e8 64 e8 ff ff       	call   80104c70 <setgroup>
+  setrt(curproc, 0, 0);
+8010640c:	31 c9                	xor    %ecx,%ecx
+8010640e:	31 d2                	xor    %edx,%edx
+80106410:	89 d8                	mov    %ebx,%eax
+80106412:	e8 59 da ff ff       	call   80103e70 <setrt>
+  sched();
+80106417:	e8 84 fe ff ff       	call   801062a0 <sched>
+  panic("zombie exit");
+8010641c:	83 ec 0c             	sub    $0xc,%esp
+8010641f:	68 0d c0 10 80       	push   $0x8010c00d
+80106424:	e8 57 9f ff ff       	call   80100380 <panic>
+  wakeupn(chan, NPROC);
+80106429:	ba 00 04 00 00       	mov    $0x400,%edx
+8010642e:	89 c8                	mov    %ecx,%eax
+80106430:	e8 5b f5 ff ff       	call   80105990 <wakeupn>
+}
+80106435:	eb 95                	jmp    801063cc <exit+0x6c>
+    pushdead(curproc->mm, (uint)curproc->threadstack);
+80106437:	8b 33                	mov    (%ebx),%esi
+  acquiresleep(&mm->vmlock);
+80106439:	83 ec 0c             	sub    $0xc,%esp
+    pushdead(curproc->mm, (uint)curproc->threadstack);
+8010643c:	8b bb 5c 01 00 00    	mov    0x15c(%ebx),%edi
+  acquiresleep(&mm->vmlock);
+80106442:	8d 46 34             	lea    0x34(%esi),%eax
+80106445:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80106448:	50                   	push   %eax
+80106449:	e8 b2 17 00 00       	call   80107c00 <acquiresleep>
+  if(va % PGSIZE != 0 || va >= mm->sz)
+8010644e:	83 c4 10             	add    $0x10,%esp
+80106451:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+80106457:	75 25                	jne    8010647e <exit+0x11e>
+80106459:	3b 7e 78             	cmp    0x78(%esi),%edi
+8010645c:	73 20                	jae    8010647e <exit+0x11e>
+  return (uint*)uva2ka(mm->pgdir, (char*)va);
+8010645e:	50                   	push   %eax
+8010645f:	50                   	push   %eax
+80106460:	57                   	push   %edi
+80106461:	ff 76 74             	push   0x74(%esi)
+80106464:	e8 47 51 00 00       	call   8010b5b0 <uva2ka>
+  if((link = deadlink(mm, stack)) != 0){
+80106469:	83 c4 10             	add    $0x10,%esp
+8010646c:	85 c0                	test   %eax,%eax
+8010646e:	74 0e                	je     8010647e <exit+0x11e>
+    *link = mm->deadstacks;
+80106470:	8b 8e 80 00 00 00    	mov    0x80(%esi),%ecx
+80106476:	89 08                	mov    %ecx,(%eax)
+    mm->deadstacks = stack;
+80106478:	89 be 80 00 00 00    	mov    %edi,0x80(%esi)
+  releasesleep(&mm->vmlock);
+8010647e:	83 ec 0c             	sub    $0xc,%esp
+80106481:	ff 75 e4             	push   -0x1c(%ebp)
+80106484:	e8 d7 17 00 00       	call   80107c60 <releasesleep>
+}
+80106489:	83 c4 10             	add    $0x10,%esp
+8010648c:	e9 1e ff ff ff       	jmp    801063af <exit+0x4f>
+    panic("init exiting");
+80106491:	83 ec 0c             	sub    $0xc,%esp
+80106494:	68 00 c0 10 80       	push   $0x8010c000
+80106499:	e8 e2 9e ff ff       	call   80100380 <panic>
+8010649e:	66 90                	xchg   %ax,%ax
+
+801064a0 <wait>:
+{
+801064a0:	55                   	push   %ebp
+801064a1:	89 e5                	mov    %esp,%ebp
+801064a3:	56                   	push   %esi
+801064a4:	53                   	push   %ebx
+  pushcli();
+801064a5:	e8 d6 18 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+801064aa:	e8 a1 e9 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+801064af:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801064b5:	e8 16 19 00 00       	call   80107dd0 <popcli>
+  acquire(&ptable.lock);
+801064ba:	83 ec 0c             	sub    $0xc,%esp
+801064bd:	68 60 6e 11 80       	push   $0x80116e60
+801064c2:	e8 09 1a 00 00       	call   80107ed0 <acquire>
+    for(p = curproc->children; p; p = p->sibling){
+801064c7:	8b 43 14             	mov    0x14(%ebx),%eax
+  acquire(&ptable.lock);
+801064ca:	83 c4 10             	add    $0x10,%esp
+    for(p = curproc->children; p; p = p->sibling){
+801064cd:	85 c0                	test   %eax,%eax
+801064cf:	75 0e                	jne    801064df <wait+0x3f>
+801064d1:	eb 7f                	jmp    80106552 <wait+0xb2>
+801064d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801064d7:	90                   	nop
+801064d8:	8b 40 18             	mov    0x18(%eax),%eax
+801064db:	85 c0                	test   %eax,%eax
+801064dd:	74 31                	je     80106510 <wait+0x70>
+      if(p->state == ZOMBIE){
+801064df:	83 78 08 05          	cmpl   $0x5,0x8(%eax)
+801064e3:	75 f3                	jne    801064d8 <wait+0x38>
+        pid = p->pid;
+801064e5:	8b 58 0c             	mov    0xc(%eax),%ebx
+        freeproc(p);
+801064e8:	e8 c3 da ff ff       	call   80103fb0 <freeproc>
+        release(&ptable.lock);
+801064ed:	83 ec 0c             	sub    $0xc,%esp
+801064f0:	68 60 6e 11 80       	push   $0x80116e60
+801064f5:	e8 76 19 00 00       	call   80107e70 <release>
+        return pid;
+801064fa:	83 c4 10             	add    $0x10,%esp
+}
+801064fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106500:	89 d8                	mov    %ebx,%eax
+80106502:	5b                   	pop    %ebx
+80106503:	5e                   	pop    %esi
+80106504:	5d                   	pop    %ebp
+80106505:	c3                   	ret
+80106506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010650d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(!havekids || curproc->killed){
+80106510:	8b 43 3c             	mov    0x3c(%ebx),%eax
+80106513:	85 c0                	test   %eax,%eax
+80106515:	75 3b                	jne    80106552 <wait+0xb2>
+  pushcli();
+80106517:	e8 64 18 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+8010651c:	e8 2f e9 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80106521:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+80106527:	e8 a4 18 00 00       	call   80107dd0 <popcli>
+  if(p == 0)
+8010652c:	85 f6                	test   %esi,%esi
+8010652e:	74 39                	je     80106569 <wait+0xc9>
+  p->chan = chan;
+80106530:	89 5e 2c             	mov    %ebx,0x2c(%esi)
+  setstate(p, SLEEPING);
+80106533:	89 f0                	mov    %esi,%eax
+80106535:	ba 02 00 00 00       	mov    $0x2,%edx
+8010653a:	e8 d1 f1 ff ff       	call   80105710 <setstate>
+  sched();
+8010653f:	e8 5c fd ff ff       	call   801062a0 <sched>
+  p->chan = 0;
+80106544:	c7 46 2c 00 00 00 00 	movl   $0x0,0x2c(%esi)
+    for(p = curproc->children; p; p = p->sibling){
+8010654b:	8b 43 14             	mov    0x14(%ebx),%eax
+8010654e:	85 c0                	test   %eax,%eax
+80106550:	75 8d                	jne    801064df <wait+0x3f>
+      release(&ptable.lock);
+80106552:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+80106555:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+      release(&ptable.lock);
+8010655a:	68 60 6e 11 80       	push   $0x80116e60
+8010655f:	e8 0c 19 00 00       	call   80107e70 <release>
+      return -1;
+80106564:	83 c4 10             	add    $0x10,%esp
+80106567:	eb 94                	jmp    801064fd <wait+0x5d>
+    panic("sleep");
+80106569:	83 ec 0c             	sub    $0xc,%esp
+8010656c:	68 19 c0 10 80       	push   $0x8010c019
+80106571:	e8 0a 9e ff ff       	call   80100380 <panic>
+80106576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010657d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106580 <yield>:
+{
+80106580:	55                   	push   %ebp
+80106581:	89 e5                	mov    %esp,%ebp
+80106583:	53                   	push   %ebx
+80106584:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);  //DOC: yieldlock
+80106587:	68 60 6e 11 80       	push   $0x80116e60
+8010658c:	e8 3f 19 00 00       	call   80107ed0 <acquire>
+  pushcli();
+80106591:	e8 ea 17 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80106596:	e8 b5 e8 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+8010659b:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801065a1:	e8 2a 18 00 00       	call   80107dd0 <popcli>
+  setstate(myproc(), RUNNABLE);
+801065a6:	ba 03 00 00 00       	mov    $0x3,%edx
+801065ab:	89 d8                	mov    %ebx,%eax
+801065ad:	e8 5e f1 ff ff       	call   80105710 <setstate>
+  sched();
+801065b2:	e8 e9 fc ff ff       	call   801062a0 <sched>
+  release(&ptable.lock);
+801065b7:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+801065be:	e8 ad 18 00 00       	call   80107e70 <release>
+}
+801065c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801065c6:	83 c4 10             	add    $0x10,%esp
+801065c9:	c9                   	leave
+801065ca:	c3                   	ret
+801065cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801065cf:	90                   	nop
+
+801065d0 <cputime>:
+{
+801065d0:	55                   	push   %ebp
+801065d1:	89 e5                	mov    %esp,%ebp
+801065d3:	57                   	push   %edi
+801065d4:	56                   	push   %esi
+801065d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  pushcli();
+801065d8:	e8 a3 17 00 00       	call   80107d80 <pushcli>
+  p = mycpu()->proc;
+801065dd:	e8 6e e8 ff ff       	call   80104e50 <mycpu>
+801065e2:	8b 88 ac 00 00 00    	mov    0xac(%eax),%ecx
+  asm volatile("rdtsc" : "=A" (t));
+801065e8:	0f 31                	rdtsc
+  if(user)
+801065ea:	85 f6                	test   %esi,%esi
+    p->utime += now - p->tsc;
+801065ec:	89 d7                	mov    %edx,%edi
+801065ee:	89 c6                	mov    %eax,%esi
+  if(user)
+801065f0:	74 3e                	je     80106630 <cputime+0x60>
+    p->utime += now - p->tsc;
+801065f2:	03 b1 44 01 00 00    	add    0x144(%ecx),%esi
+801065f8:	13 b9 48 01 00 00    	adc    0x148(%ecx),%edi
+801065fe:	2b b1 54 01 00 00    	sub    0x154(%ecx),%esi
+80106604:	1b b9 58 01 00 00    	sbb    0x158(%ecx),%edi
+8010660a:	89 b1 44 01 00 00    	mov    %esi,0x144(%ecx)
+80106610:	89 b9 48 01 00 00    	mov    %edi,0x148(%ecx)
+  p->tsc = now;
+80106616:	89 81 54 01 00 00    	mov    %eax,0x154(%ecx)
+8010661c:	89 91 58 01 00 00    	mov    %edx,0x158(%ecx)
+}
+80106622:	5e                   	pop    %esi
+80106623:	5f                   	pop    %edi
+80106624:	5d                   	pop    %ebp
+  popcli();
+80106625:	e9 a6 17 00 00       	jmp    80107dd0 <popcli>
+8010662a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    p->stime += now - p->tsc;
+80106630:	03 b1 4c 01 00 00    	add    0x14c(%ecx),%esi
+80106636:	13 b9 50 01 00 00    	adc    0x150(%ecx),%edi
+8010663c:	2b b1 54 01 00 00    	sub    0x154(%ecx),%esi
+80106642:	1b b9 58 01 00 00    	sbb    0x158(%ecx),%edi
+80106648:	89 b1 4c 01 00 00    	mov    %esi,0x14c(%ecx)
+8010664e:	89 b9 50 01 00 00    	mov    %edi,0x150(%ecx)
+80106654:	eb c0                	jmp    80106616 <cputime+0x46>
+80106656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010665d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106660 <yield_to>:
+{
+80106660:	55                   	push   %ebp
+80106661:	89 e5                	mov    %esp,%ebp
+80106663:	56                   	push   %esi
+80106664:	53                   	push   %ebx
+80106665:	8b 75 08             	mov    0x8(%ebp),%esi
+  acquire(&ptable.lock);
+80106668:	83 ec 0c             	sub    $0xc,%esp
+8010666b:	68 60 6e 11 80       	push   $0x80116e60
+80106670:	e8 5b 18 00 00       	call   80107ed0 <acquire>
+  for(p = ptable.pidhash[pid % NPIDHASH]; p; p = p->hnext)
+80106675:	89 f2                	mov    %esi,%edx
+80106677:	83 c4 10             	add    $0x10,%esp
+8010667a:	c1 fa 1f             	sar    $0x1f,%edx
+8010667d:	c1 ea 16             	shr    $0x16,%edx
+80106680:	8d 04 16             	lea    (%esi,%edx,1),%eax
+80106683:	25 ff 03 00 00       	and    $0x3ff,%eax
+80106688:	29 d0                	sub    %edx,%eax
+8010668a:	8b 1c 85 9c 7e 11 80 	mov    -0x7fee8164(,%eax,4),%ebx
+80106691:	85 db                	test   %ebx,%ebx
+80106693:	75 12                	jne    801066a7 <yield_to+0x47>
+80106695:	e9 86 00 00 00       	jmp    80106720 <yield_to+0xc0>
+8010669a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801066a0:	8b 5b 1c             	mov    0x1c(%ebx),%ebx
+801066a3:	85 db                	test   %ebx,%ebx
+801066a5:	74 79                	je     80106720 <yield_to+0xc0>
+    if(p->pid == pid)
+801066a7:	3b 73 0c             	cmp    0xc(%ebx),%esi
+801066aa:	75 f4                	jne    801066a0 <yield_to+0x40>
+  if(p == 0 || p->state != RUNNABLE || !cpuok(p, cpuid())){
+801066ac:	83 7b 08 03          	cmpl   $0x3,0x8(%ebx)
+801066b0:	75 6e                	jne    80106720 <yield_to+0xc0>
+  return mycpu()-cpus;
+801066b2:	e8 99 e7 ff ff       	call   80104e50 <mycpu>
+  return (p->affinity >> i) & 1;
+801066b7:	8b 53 78             	mov    0x78(%ebx),%edx
+  return mycpu()-cpus;
+801066ba:	2d e0 67 11 80       	sub    $0x801167e0,%eax
+801066bf:	c1 f8 04             	sar    $0x4,%eax
+801066c2:	69 c0 c5 4e ec c4    	imul   $0xc4ec4ec5,%eax,%eax
+  if(p == 0 || p->state != RUNNABLE || !cpuok(p, cpuid())){
+801066c8:	0f a3 c2             	bt     %eax,%edx
+801066cb:	73 53                	jae    80106720 <yield_to+0xc0>
+  mycpu()->next = p;
+801066cd:	e8 7e e7 ff ff       	call   80104e50 <mycpu>
+801066d2:	89 98 b0 00 00 00    	mov    %ebx,0xb0(%eax)
+  pushcli();
+801066d8:	e8 a3 16 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+801066dd:	e8 6e e7 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+801066e2:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801066e8:	e8 e3 16 00 00       	call   80107dd0 <popcli>
+  setstate(myproc(), RUNNABLE);
+801066ed:	ba 03 00 00 00       	mov    $0x3,%edx
+801066f2:	89 d8                	mov    %ebx,%eax
+801066f4:	e8 17 f0 ff ff       	call   80105710 <setstate>
+  sched();
+801066f9:	e8 a2 fb ff ff       	call   801062a0 <sched>
+  release(&ptable.lock);
+801066fe:	83 ec 0c             	sub    $0xc,%esp
+80106701:	68 60 6e 11 80       	push   $0x80116e60
+80106706:	e8 65 17 00 00       	call   80107e70 <release>
+  return 0;
+8010670b:	83 c4 10             	add    $0x10,%esp
+}
+8010670e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  return 0;
+80106711:	31 c0                	xor    %eax,%eax
+}
+80106713:	5b                   	pop    %ebx
+80106714:	5e                   	pop    %esi
+80106715:	5d                   	pop    %ebp
+80106716:	c3                   	ret
+80106717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010671e:	66 90                	xchg   %ax,%ax
+    release(&ptable.lock);
+80106720:	83 ec 0c             	sub    $0xc,%esp
+80106723:	68 60 6e 11 80       	push   $0x80116e60
+80106728:	e8 43 17 00 00       	call   80107e70 <release>
+    return -1;
+8010672d:	83 c4 10             	add    $0x10,%esp
+}
+80106730:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+80106733:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106738:	5b                   	pop    %ebx
+80106739:	5e                   	pop    %esi
+8010673a:	5d                   	pop    %ebp
+8010673b:	c3                   	ret
+8010673c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106740 <sleep>:
+{
+80106740:	55                   	push   %ebp
+80106741:	89 e5                	mov    %esp,%ebp
+80106743:	57                   	push   %edi
+80106744:	56                   	push   %esi
+80106745:	53                   	push   %ebx
+80106746:	83 ec 0c             	sub    $0xc,%esp
+80106749:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010674c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  pushcli();
+8010674f:	e8 2c 16 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80106754:	e8 f7 e6 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80106759:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+8010675f:	e8 6c 16 00 00       	call   80107dd0 <popcli>
+  if(p == 0)
+80106764:	85 db                	test   %ebx,%ebx
+80106766:	0f 84 94 00 00 00    	je     80106800 <sleep+0xc0>
+  if(lk == 0)
+8010676c:	85 f6                	test   %esi,%esi
+8010676e:	0f 84 7f 00 00 00    	je     801067f3 <sleep+0xb3>
+  if(lk != &ptable.lock){  //DOC: sleeplock0
+80106774:	81 fe 60 6e 11 80    	cmp    $0x80116e60,%esi
+8010677a:	74 54                	je     801067d0 <sleep+0x90>
+    acquire(&ptable.lock);  //DOC: sleeplock1
+8010677c:	83 ec 0c             	sub    $0xc,%esp
+8010677f:	68 60 6e 11 80       	push   $0x80116e60
+80106784:	e8 47 17 00 00       	call   80107ed0 <acquire>
+    release(lk);
+80106789:	89 34 24             	mov    %esi,(%esp)
+8010678c:	e8 df 16 00 00       	call   80107e70 <release>
+  p->chan = chan;
+80106791:	89 7b 2c             	mov    %edi,0x2c(%ebx)
+  setstate(p, SLEEPING);
+80106794:	89 d8                	mov    %ebx,%eax
+80106796:	ba 02 00 00 00       	mov    $0x2,%edx
+8010679b:	e8 70 ef ff ff       	call   80105710 <setstate>
+  sched();
+801067a0:	e8 fb fa ff ff       	call   801062a0 <sched>
+  p->chan = 0;
+801067a5:	c7 43 2c 00 00 00 00 	movl   $0x0,0x2c(%ebx)
+    release(&ptable.lock);
+801067ac:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+801067b3:	e8 b8 16 00 00       	call   80107e70 <release>
+    acquire(lk);
+801067b8:	89 75 08             	mov    %esi,0x8(%ebp)
+801067bb:	83 c4 10             	add    $0x10,%esp
+}
+801067be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801067c1:	5b                   	pop    %ebx
+801067c2:	5e                   	pop    %esi
+801067c3:	5f                   	pop    %edi
+801067c4:	5d                   	pop    %ebp
+    acquire(lk);
+801067c5:	e9 06 17 00 00       	jmp    80107ed0 <acquire>
+801067ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->chan = chan;
+801067d0:	89 7b 2c             	mov    %edi,0x2c(%ebx)
+  setstate(p, SLEEPING);
+801067d3:	89 d8                	mov    %ebx,%eax
+801067d5:	ba 02 00 00 00       	mov    $0x2,%edx
+801067da:	e8 31 ef ff ff       	call   80105710 <setstate>
+  sched();
+801067df:	e8 bc fa ff ff       	call   801062a0 <sched>
+  p->chan = 0;
+801067e4:	c7 43 2c 00 00 00 00 	movl   $0x0,0x2c(%ebx)
+}
+801067eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801067ee:	5b                   	pop    %ebx
+801067ef:	5e                   	pop    %esi
+801067f0:	5f                   	pop    %edi
+801067f1:	5d                   	pop    %ebp
+801067f2:	c3                   	ret
+    panic("sleep without lk");
+801067f3:	83 ec 0c             	sub    $0xc,%esp
+801067f6:	68 1f c0 10 80       	push   $0x8010c01f
+801067fb:	e8 80 9b ff ff       	call   80100380 <panic>
+    panic("sleep");
+80106800:	83 ec 0c             	sub    $0xc,%esp
+80106803:	68 19 c0 10 80       	push   $0x8010c019
+80106808:	e8 73 9b ff ff       	call   80100380 <panic>
+8010680d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106810 <wakeup>:
+
+// Wake up all processes sleeping on chan.
+void
+wakeup(void *chan)
+{
+80106810:	55                   	push   %ebp
+80106811:	89 e5                	mov    %esp,%ebp
+80106813:	53                   	push   %ebx
+80106814:	83 ec 10             	sub    $0x10,%esp
+80106817:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ptable.lock);
+8010681a:	68 60 6e 11 80       	push   $0x80116e60
+8010681f:	e8 ac 16 00 00       	call   80107ed0 <acquire>
+  wakeupn(chan, NPROC);
+80106824:	89 d8                	mov    %ebx,%eax
+80106826:	ba 00 04 00 00       	mov    $0x400,%edx
+8010682b:	e8 60 f1 ff ff       	call   80105990 <wakeupn>
+  wakeup1(chan);
+  release(&ptable.lock);
+80106830:	c7 45 08 60 6e 11 80 	movl   $0x80116e60,0x8(%ebp)
+}
+80106837:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&ptable.lock);
+8010683a:	83 c4 10             	add    $0x10,%esp
+}
+8010683d:	c9                   	leave
+  release(&ptable.lock);
+8010683e:	e9 2d 16 00 00       	jmp    80107e70 <release>
+80106843:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010684a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106850 <wakeone>:
+
+// Wake up the process that has slept longest on chan,
+// for when only one of them could make progress anyway.
+void
+wakeone(void *chan)
+{
+80106850:	55                   	push   %ebp
+80106851:	89 e5                	mov    %esp,%ebp
+80106853:	53                   	push   %ebx
+80106854:	83 ec 10             	sub    $0x10,%esp
+80106857:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ptable.lock);
+8010685a:	68 60 6e 11 80       	push   $0x80116e60
+8010685f:	e8 6c 16 00 00       	call   80107ed0 <acquire>
+  wakeupn(chan, 1);
+80106864:	89 d8                	mov    %ebx,%eax
+80106866:	ba 01 00 00 00       	mov    $0x1,%edx
+8010686b:	e8 20 f1 ff ff       	call   80105990 <wakeupn>
+  release(&ptable.lock);
+80106870:	c7 45 08 60 6e 11 80 	movl   $0x80116e60,0x8(%ebp)
+}
+80106877:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&ptable.lock);
+8010687a:	83 c4 10             	add    $0x10,%esp
+}
+8010687d:	c9                   	leave
+  release(&ptable.lock);
+8010687e:	e9 ed 15 00 00       	jmp    80107e70 <release>
+80106883:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010688a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106890 <kill>:
+// Kill the process with the given pid.
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+int
+kill(int pid)
+{
+80106890:	55                   	push   %ebp
+80106891:	89 e5                	mov    %esp,%ebp
+80106893:	53                   	push   %ebx
+80106894:	83 ec 10             	sub    $0x10,%esp
+80106897:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p;
+
+  acquire(&ptable.lock);
+8010689a:	68 60 6e 11 80       	push   $0x80116e60
+8010689f:	e8 2c 16 00 00       	call   80107ed0 <acquire>
+  for(p = ptable.pidhash[pid % NPIDHASH]; p; p = p->hnext)
+801068a4:	89 da                	mov    %ebx,%edx
+801068a6:	83 c4 10             	add    $0x10,%esp
+801068a9:	c1 fa 1f             	sar    $0x1f,%edx
+801068ac:	c1 ea 16             	shr    $0x16,%edx
+801068af:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+801068b2:	25 ff 03 00 00       	and    $0x3ff,%eax
+801068b7:	29 d0                	sub    %edx,%eax
+801068b9:	8b 04 85 9c 7e 11 80 	mov    -0x7fee8164(,%eax,4),%eax
+801068c0:	85 c0                	test   %eax,%eax
+801068c2:	75 13                	jne    801068d7 <kill+0x47>
+801068c4:	eb 4a                	jmp    80106910 <kill+0x80>
+801068c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801068cd:	8d 76 00             	lea    0x0(%esi),%esi
+801068d0:	8b 40 1c             	mov    0x1c(%eax),%eax
+801068d3:	85 c0                	test   %eax,%eax
+801068d5:	74 39                	je     80106910 <kill+0x80>
+    if(p->pid == pid)
+801068d7:	3b 58 0c             	cmp    0xc(%eax),%ebx
+801068da:	75 f4                	jne    801068d0 <kill+0x40>
+  if((p = findproc(pid)) != 0){
+    p->killed = 1;
+    // Wake process from sleep if necessary.
+    if(p->state == SLEEPING)
+801068dc:	83 78 08 02          	cmpl   $0x2,0x8(%eax)
+    p->killed = 1;
+801068e0:	c7 40 3c 01 00 00 00 	movl   $0x1,0x3c(%eax)
+    if(p->state == SLEEPING)
+801068e7:	74 17                	je     80106900 <kill+0x70>
+      setstate(p, RUNNABLE);
+    release(&ptable.lock);
+801068e9:	83 ec 0c             	sub    $0xc,%esp
+801068ec:	68 60 6e 11 80       	push   $0x80116e60
+801068f1:	e8 7a 15 00 00       	call   80107e70 <release>
+    return 0;
+801068f6:	83 c4 10             	add    $0x10,%esp
+801068f9:	31 c0                	xor    %eax,%eax
+  }
+  release(&ptable.lock);
+  return -1;
+}
+801068fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801068fe:	c9                   	leave
+801068ff:	c3                   	ret
+      setstate(p, RUNNABLE);
+80106900:	ba 03 00 00 00       	mov    $0x3,%edx
+80106905:	e8 06 ee ff ff       	call   80105710 <setstate>
+8010690a:	eb dd                	jmp    801068e9 <kill+0x59>
+8010690c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  release(&ptable.lock);
+80106910:	83 ec 0c             	sub    $0xc,%esp
+80106913:	68 60 6e 11 80       	push   $0x80116e60
+80106918:	e8 53 15 00 00       	call   80107e70 <release>
+  return -1;
+8010691d:	83 c4 10             	add    $0x10,%esp
+80106920:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106925:	eb d4                	jmp    801068fb <kill+0x6b>
+80106927:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010692e:	66 90                	xchg   %ax,%ax
+
+80106930 <procdump>:
+// Print a process listing to console.  For debugging.
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+void
+procdump(void)
+{
+80106930:	55                   	push   %ebp
+80106931:	89 e5                	mov    %esp,%ebp
+80106933:	57                   	push   %edi
+80106934:	56                   	push   %esi
+80106935:	53                   	push   %ebx
+80106936:	83 ec 3c             	sub    $0x3c,%esp
+  int i, j;
+  struct proc *p;
+  char *state;
+  uint pc[10];
+
+  for(j = 0; j < ptable.nslot; j++){
+80106939:	8b 15 94 7e 11 80    	mov    0x80117e94,%edx
+8010693f:	85 d2                	test   %edx,%edx
+80106941:	7e 67                	jle    801069aa <procdump+0x7a>
+80106943:	31 db                	xor    %ebx,%ebx
+    if(p->state == UNUSED)
+      continue;
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+      state = states[p->state];
+    else
+      state = "???";
+80106945:	bf 30 c0 10 80       	mov    $0x8010c030,%edi
+8010694a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    p = ptable.slot[j];
+80106950:	8b 34 9d 94 6e 11 80 	mov    -0x7fee916c(,%ebx,4),%esi
+    if(p->state == UNUSED)
+80106957:	8b 46 08             	mov    0x8(%esi),%eax
+8010695a:	85 c0                	test   %eax,%eax
+8010695c:	74 41                	je     8010699f <procdump+0x6f>
+      state = "???";
+8010695e:	ba 30 c0 10 80       	mov    $0x8010c030,%edx
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+80106963:	83 f8 05             	cmp    $0x5,%eax
+80106966:	77 0c                	ja     80106974 <procdump+0x44>
+80106968:	8b 14 85 ac c0 10 80 	mov    -0x7fef3f54(,%eax,4),%edx
+      state = "???";
+8010696f:	85 d2                	test   %edx,%edx
+80106971:	0f 44 d7             	cmove  %edi,%edx
+    cprintf("%d %s %s", p->pid, state, p->name);
+80106974:	8d 46 48             	lea    0x48(%esi),%eax
+80106977:	50                   	push   %eax
+80106978:	52                   	push   %edx
+80106979:	ff 76 0c             	push   0xc(%esi)
+8010697c:	68 34 c0 10 80       	push   $0x8010c034
+80106981:	e8 2a 9d ff ff       	call   801006b0 <cprintf>
+    if(p->state == SLEEPING){
+80106986:	83 c4 10             	add    $0x10,%esp
+80106989:	83 7e 08 02          	cmpl   $0x2,0x8(%esi)
+8010698d:	74 61                	je     801069f0 <procdump+0xc0>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+8010698f:	83 ec 0c             	sub    $0xc,%esp
+80106992:	68 b3 c4 10 80       	push   $0x8010c4b3
+80106997:	e8 14 9d ff ff       	call   801006b0 <cprintf>
+8010699c:	83 c4 10             	add    $0x10,%esp
+  for(j = 0; j < ptable.nslot; j++){
+8010699f:	83 c3 01             	add    $0x1,%ebx
+801069a2:	39 1d 94 7e 11 80    	cmp    %ebx,0x80117e94
+801069a8:	7f a6                	jg     80106950 <procdump+0x20>
+  }
+  for(i = 0; i < ncpu; i++)
+801069aa:	a1 c4 67 11 80       	mov    0x801167c4,%eax
+801069af:	85 c0                	test   %eax,%eax
+801069b1:	7e 35                	jle    801069e8 <procdump+0xb8>
+801069b3:	be a0 68 11 80       	mov    $0x801168a0,%esi
+801069b8:	31 db                	xor    %ebx,%ebx
+801069ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    cprintf("cpu%d: idle %d of %d ticks\n", i, cpus[i].idleticks, cpus[i].nticks);
+801069c0:	ff 76 04             	push   0x4(%esi)
+  for(i = 0; i < ncpu; i++)
+801069c3:	81 c6 d0 00 00 00    	add    $0xd0,%esi
+    cprintf("cpu%d: idle %d of %d ticks\n", i, cpus[i].idleticks, cpus[i].nticks);
+801069c9:	ff b6 30 ff ff ff    	push   -0xd0(%esi)
+801069cf:	53                   	push   %ebx
+  for(i = 0; i < ncpu; i++)
+801069d0:	83 c3 01             	add    $0x1,%ebx
+    cprintf("cpu%d: idle %d of %d ticks\n", i, cpus[i].idleticks, cpus[i].nticks);
+801069d3:	68 3d c0 10 80       	push   $0x8010c03d
+801069d8:	e8 d3 9c ff ff       	call   801006b0 <cprintf>
+  for(i = 0; i < ncpu; i++)
+801069dd:	83 c4 10             	add    $0x10,%esp
+801069e0:	39 1d c4 67 11 80    	cmp    %ebx,0x801167c4
+801069e6:	7f d8                	jg     801069c0 <procdump+0x90>
+}
+801069e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801069eb:	5b                   	pop    %ebx
+801069ec:	5e                   	pop    %esi
+801069ed:	5f                   	pop    %edi
+801069ee:	5d                   	pop    %ebp
+801069ef:	c3                   	ret
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+801069f0:	83 ec 08             	sub    $0x8,%esp
+801069f3:	8d 45 c0             	lea    -0x40(%ebp),%eax
+801069f6:	50                   	push   %eax
+801069f7:	8b 56 28             	mov    0x28(%esi),%edx
+801069fa:	8b 52 0c             	mov    0xc(%edx),%edx
+801069fd:	83 c2 08             	add    $0x8,%edx
+80106a00:	52                   	push   %edx
+80106a01:	e8 0a 13 00 00       	call   80107d10 <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80106a06:	8d 45 c0             	lea    -0x40(%ebp),%eax
+80106a09:	83 c4 10             	add    $0x10,%esp
+80106a0c:	89 c6                	mov    %eax,%esi
+80106a0e:	66 90                	xchg   %ax,%ax
+80106a10:	8b 16                	mov    (%esi),%edx
+80106a12:	85 d2                	test   %edx,%edx
+80106a14:	0f 84 75 ff ff ff    	je     8010698f <procdump+0x5f>
+        cprintf(" %p", pc[i]);
+80106a1a:	83 ec 08             	sub    $0x8,%esp
+      for(i=0; i<10 && pc[i] != 0; i++)
+80106a1d:	83 c6 04             	add    $0x4,%esi
+        cprintf(" %p", pc[i]);
+80106a20:	52                   	push   %edx
+80106a21:	68 61 ba 10 80       	push   $0x8010ba61
+80106a26:	e8 85 9c ff ff       	call   801006b0 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80106a2b:	8d 45 e8             	lea    -0x18(%ebp),%eax
+80106a2e:	83 c4 10             	add    $0x10,%esp
+80106a31:	39 c6                	cmp    %eax,%esi
+80106a33:	75 db                	jne    80106a10 <procdump+0xe0>
+80106a35:	e9 55 ff ff ff       	jmp    8010698f <procdump+0x5f>
+80106a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106a40 <settickets>:
+
+int 
+settickets(int tickets)
+{
+80106a40:	55                   	push   %ebp
+80106a41:	89 e5                	mov    %esp,%ebp
+80106a43:	57                   	push   %edi
+80106a44:	56                   	push   %esi
+80106a45:	53                   	push   %ebx
+80106a46:	83 ec 0c             	sub    $0xc,%esp
+80106a49:	8b 7d 08             	mov    0x8(%ebp),%edi
+
+  if(tickets < 1 || tickets > MAXTICKETS)
+80106a4c:	8d 47 ff             	lea    -0x1(%edi),%eax
+80106a4f:	3d 9f 86 01 00       	cmp    $0x1869f,%eax
+80106a54:	0f 87 89 00 00 00    	ja     80106ae3 <settickets+0xa3>
+  pushcli();
+80106a5a:	e8 21 13 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80106a5f:	e8 ec e3 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80106a64:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+80106a6a:	e8 61 13 00 00       	call   80107dd0 <popcli>
+    return -1;
+    
+  struct proc *proc = myproc();
+  
+  acquire(&ptable.lock);
+80106a6f:	83 ec 0c             	sub    $0xc,%esp
+80106a72:	68 60 6e 11 80       	push   $0x80116e60
+80106a77:	e8 54 14 00 00       	call   80107ed0 <acquire>
+  if(proc->group)
+80106a7c:	8b 86 8c 00 00 00    	mov    0x8c(%esi),%eax
+80106a82:	83 c4 10             	add    $0x10,%esp
+80106a85:	85 c0                	test   %eax,%eax
+80106a87:	75 27                	jne    80106ab0 <settickets+0x70>
+    groupadd(proc->group, tickets - proc->tickets);
+  proc->tickets = tickets;
+80106a89:	89 7e 58             	mov    %edi,0x58(%esi)
+  reweigh(proc);
+80106a8c:	89 f0                	mov    %esi,%eax
+80106a8e:	e8 4d e0 ff ff       	call   80104ae0 <reweigh>
+  release(&ptable.lock);
+80106a93:	83 ec 0c             	sub    $0xc,%esp
+80106a96:	68 60 6e 11 80       	push   $0x80116e60
+80106a9b:	e8 d0 13 00 00       	call   80107e70 <release>
+  
+  return 0;
+80106aa0:	83 c4 10             	add    $0x10,%esp
+80106aa3:	31 c0                	xor    %eax,%eax
+}
+80106aa5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106aa8:	5b                   	pop    %ebx
+80106aa9:	5e                   	pop    %esi
+80106aaa:	5f                   	pop    %edi
+80106aab:	5d                   	pop    %ebp
+80106aac:	c3                   	ret
+80106aad:	8d 76 00             	lea    0x0(%esi),%esi
+  ptable.group[gid - 1].active += delta;
+80106ab0:	8d 44 40 fd          	lea    -0x3(%eax,%eax,2),%eax
+    groupadd(proc->group, tickets - proc->tickets);
+80106ab4:	89 fa                	mov    %edi,%edx
+80106ab6:	2b 56 58             	sub    0x58(%esi),%edx
+  ptable.group[gid - 1].active += delta;
+80106ab9:	8d 04 85 60 6e 11 80 	lea    -0x7fee91a0(,%eax,4),%eax
+  for(p = ptable.group[gid - 1].members; p; p = p->gnext)
+80106ac0:	8b 98 04 2c 02 00    	mov    0x22c04(%eax),%ebx
+  ptable.group[gid - 1].active += delta;
+80106ac6:	01 90 00 2c 02 00    	add    %edx,0x22c00(%eax)
+  for(p = ptable.group[gid - 1].members; p; p = p->gnext)
+80106acc:	85 db                	test   %ebx,%ebx
+80106ace:	74 b9                	je     80106a89 <settickets+0x49>
+    reweigh(p);
+80106ad0:	89 d8                	mov    %ebx,%eax
+80106ad2:	e8 09 e0 ff ff       	call   80104ae0 <reweigh>
+  for(p = ptable.group[gid - 1].members; p; p = p->gnext)
+80106ad7:	8b 9b 90 00 00 00    	mov    0x90(%ebx),%ebx
+80106add:	85 db                	test   %ebx,%ebx
+80106adf:	75 ef                	jne    80106ad0 <settickets+0x90>
+80106ae1:	eb a6                	jmp    80106a89 <settickets+0x49>
+    return -1;
+80106ae3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106ae8:	eb bb                	jmp    80106aa5 <settickets+0x65>
+80106aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106af0 <setdeadline>:
+// caller, ahead of the lottery, or give up the reservation if
+// period is 0.  Fails if the reservation would push the total
+// reserved by all real-time processes past RTUTIL.
+int
+setdeadline(int period, int runtime)
+{
+80106af0:	55                   	push   %ebp
+80106af1:	89 e5                	mov    %esp,%ebp
+80106af3:	57                   	push   %edi
+80106af4:	56                   	push   %esi
+80106af5:	53                   	push   %ebx
+80106af6:	83 ec 0c             	sub    $0xc,%esp
+80106af9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80106afc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int r;
+
+  if(period < 0 || (period && (runtime < 1 || runtime > period)))
+80106aff:	85 db                	test   %ebx,%ebx
+80106b01:	78 55                	js     80106b58 <setdeadline+0x68>
+80106b03:	74 08                	je     80106b0d <setdeadline+0x1d>
+80106b05:	85 f6                	test   %esi,%esi
+80106b07:	7e 4f                	jle    80106b58 <setdeadline+0x68>
+80106b09:	39 f3                	cmp    %esi,%ebx
+80106b0b:	7c 4b                	jl     80106b58 <setdeadline+0x68>
+    return -1;
+  acquire(&ptable.lock);
+80106b0d:	83 ec 0c             	sub    $0xc,%esp
+80106b10:	68 60 6e 11 80       	push   $0x80116e60
+80106b15:	e8 b6 13 00 00       	call   80107ed0 <acquire>
+  pushcli();
+80106b1a:	e8 61 12 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80106b1f:	e8 2c e3 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80106b24:	8b b8 ac 00 00 00    	mov    0xac(%eax),%edi
+  popcli();
+80106b2a:	e8 a1 12 00 00       	call   80107dd0 <popcli>
+  r = setrt(myproc(), period, runtime);
+80106b2f:	89 da                	mov    %ebx,%edx
+80106b31:	89 f1                	mov    %esi,%ecx
+80106b33:	89 f8                	mov    %edi,%eax
+80106b35:	e8 36 d3 ff ff       	call   80103e70 <setrt>
+  release(&ptable.lock);
+80106b3a:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+  r = setrt(myproc(), period, runtime);
+80106b41:	89 c3                	mov    %eax,%ebx
+  release(&ptable.lock);
+80106b43:	e8 28 13 00 00       	call   80107e70 <release>
+  return r;
+80106b48:	83 c4 10             	add    $0x10,%esp
+}
+80106b4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106b4e:	89 d8                	mov    %ebx,%eax
+80106b50:	5b                   	pop    %ebx
+80106b51:	5e                   	pop    %esi
+80106b52:	5f                   	pop    %edi
+80106b53:	5d                   	pop    %ebp
+80106b54:	c3                   	ret
+80106b55:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80106b58:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80106b5d:	eb ec                	jmp    80106b4b <setdeadline+0x5b>
+80106b5f:	90                   	nop
+
+80106b60 <setaffinity>:
+// Restrict process pid to the CPUs whose bits are set in mask.
+// A queued process moves to an allowed CPU at once, a running
+// one the next time it is queued.
+int
+setaffinity(int pid, int mask)
+{
+80106b60:	55                   	push   %ebp
+  struct proc *p;
+
+  if((mask & ((1 << ncpu) - 1)) == 0)
+80106b61:	b8 01 00 00 00       	mov    $0x1,%eax
+{
+80106b66:	89 e5                	mov    %esp,%ebp
+80106b68:	57                   	push   %edi
+80106b69:	56                   	push   %esi
+80106b6a:	53                   	push   %ebx
+80106b6b:	83 ec 0c             	sub    $0xc,%esp
+  if((mask & ((1 << ncpu) - 1)) == 0)
+80106b6e:	8b 0d c4 67 11 80    	mov    0x801167c4,%ecx
+{
+80106b74:	8b 75 08             	mov    0x8(%ebp),%esi
+  if((mask & ((1 << ncpu) - 1)) == 0)
+80106b77:	d3 e0                	shl    %cl,%eax
+80106b79:	83 e8 01             	sub    $0x1,%eax
+80106b7c:	85 45 0c             	test   %eax,0xc(%ebp)
+80106b7f:	0f 84 e3 00 00 00    	je     80106c68 <setaffinity+0x108>
+    return -1;
+  acquire(&ptable.lock);
+80106b85:	83 ec 0c             	sub    $0xc,%esp
+80106b88:	68 60 6e 11 80       	push   $0x80116e60
+80106b8d:	e8 3e 13 00 00       	call   80107ed0 <acquire>
+  for(p = ptable.pidhash[pid % NPIDHASH]; p; p = p->hnext)
+80106b92:	89 f2                	mov    %esi,%edx
+80106b94:	83 c4 10             	add    $0x10,%esp
+80106b97:	c1 fa 1f             	sar    $0x1f,%edx
+80106b9a:	c1 ea 16             	shr    $0x16,%edx
+80106b9d:	8d 04 16             	lea    (%esi,%edx,1),%eax
+80106ba0:	25 ff 03 00 00       	and    $0x3ff,%eax
+80106ba5:	29 d0                	sub    %edx,%eax
+80106ba7:	8b 1c 85 9c 7e 11 80 	mov    -0x7fee8164(,%eax,4),%ebx
+80106bae:	85 db                	test   %ebx,%ebx
+80106bb0:	75 19                	jne    80106bcb <setaffinity+0x6b>
+80106bb2:	e9 a1 00 00 00       	jmp    80106c58 <setaffinity+0xf8>
+80106bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106bbe:	66 90                	xchg   %ax,%ax
+80106bc0:	8b 5b 1c             	mov    0x1c(%ebx),%ebx
+80106bc3:	85 db                	test   %ebx,%ebx
+80106bc5:	0f 84 8d 00 00 00    	je     80106c58 <setaffinity+0xf8>
+    if(p->pid == pid)
+80106bcb:	3b 73 0c             	cmp    0xc(%ebx),%esi
+80106bce:	75 f0                	jne    80106bc0 <setaffinity+0x60>
+  q = *(volatile int*)&p->rq;
+80106bd0:	8b 7b 64             	mov    0x64(%ebx),%edi
+  if(q < 0)
+80106bd3:	85 ff                	test   %edi,%edi
+80106bd5:	78 75                	js     80106c4c <setaffinity+0xec>
+  rq = &ptable.runq[q];
+80106bd7:	69 f7 78 40 00 00    	imul   $0x4078,%edi,%esi
+  acquire(&rq->lock);
+80106bdd:	83 ec 0c             	sub    $0xc,%esp
+  rq = &ptable.runq[q];
+80106be0:	81 c6 9c 96 11 80    	add    $0x8011969c,%esi
+  acquire(&rq->lock);
+80106be6:	56                   	push   %esi
+80106be7:	e8 e4 12 00 00       	call   80107ed0 <acquire>
+  if(p->rq == q)
+80106bec:	83 c4 10             	add    $0x10,%esp
+80106bef:	3b 7b 64             	cmp    0x64(%ebx),%edi
+80106bf2:	75 4c                	jne    80106c40 <setaffinity+0xe0>
+  rqremove(rq, p);
+80106bf4:	89 da                	mov    %ebx,%edx
+80106bf6:	89 f0                	mov    %esi,%eax
+80106bf8:	e8 33 d8 ff ff       	call   80104430 <rqremove>
+  release(&rq->lock);
+80106bfd:	83 ec 0c             	sub    $0xc,%esp
+80106c00:	56                   	push   %esi
+80106c01:	e8 6a 12 00 00       	call   80107e70 <release>
+    return -1;
+  }
+  // Requeue p even if it may stay where it is, so that
+  // the queue counts which CPUs may run it afresh.
+  if(dequeue(p)){
+    p->affinity = mask;
+80106c06:	8b 45 0c             	mov    0xc(%ebp),%eax
+80106c09:	89 43 78             	mov    %eax,0x78(%ebx)
+    enqueue(p, pickrunq(p));
+80106c0c:	89 d8                	mov    %ebx,%eax
+80106c0e:	e8 2d dd ff ff       	call   80104940 <pickrunq>
+80106c13:	89 c2                	mov    %eax,%edx
+80106c15:	89 d8                	mov    %ebx,%eax
+80106c17:	e8 04 e9 ff ff       	call   80105520 <enqueue>
+80106c1c:	83 c4 10             	add    $0x10,%esp
+  } else
+    p->affinity = mask;
+  release(&ptable.lock);
+80106c1f:	83 ec 0c             	sub    $0xc,%esp
+80106c22:	68 60 6e 11 80       	push   $0x80116e60
+80106c27:	e8 44 12 00 00       	call   80107e70 <release>
+  return 0;
+80106c2c:	83 c4 10             	add    $0x10,%esp
+80106c2f:	31 c0                	xor    %eax,%eax
+}
+80106c31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106c34:	5b                   	pop    %ebx
+80106c35:	5e                   	pop    %esi
+80106c36:	5f                   	pop    %edi
+80106c37:	5d                   	pop    %ebp
+80106c38:	c3                   	ret
+80106c39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  release(&rq->lock);
+80106c40:	83 ec 0c             	sub    $0xc,%esp
+80106c43:	56                   	push   %esi
+80106c44:	e8 27 12 00 00       	call   80107e70 <release>
+  return 0;
+80106c49:	83 c4 10             	add    $0x10,%esp
+    p->affinity = mask;
+80106c4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+80106c4f:	89 43 78             	mov    %eax,0x78(%ebx)
+80106c52:	eb cb                	jmp    80106c1f <setaffinity+0xbf>
+80106c54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    release(&ptable.lock);
+80106c58:	83 ec 0c             	sub    $0xc,%esp
+80106c5b:	68 60 6e 11 80       	push   $0x80116e60
+80106c60:	e8 0b 12 00 00       	call   80107e70 <release>
+    return -1;
+80106c65:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80106c68:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106c6d:	eb c2                	jmp    80106c31 <setaffinity+0xd1>
+80106c6f:	90                   	nop
+
+80106c70 <transfer_tickets>:
+
+// Lend the caller's tickets to process pid until the caller
+// next becomes RUNNABLE, typically after blocking on pid.
+int
+transfer_tickets(int pid)
+{
+80106c70:	55                   	push   %ebp
+80106c71:	89 e5                	mov    %esp,%ebp
+80106c73:	56                   	push   %esi
+80106c74:	53                   	push   %ebx
+80106c75:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *p;
+
+  acquire(&ptable.lock);
+80106c78:	83 ec 0c             	sub    $0xc,%esp
+80106c7b:	68 60 6e 11 80       	push   $0x80116e60
+80106c80:	e8 4b 12 00 00       	call   80107ed0 <acquire>
+  for(p = ptable.pidhash[pid % NPIDHASH]; p; p = p->hnext)
+80106c85:	89 f2                	mov    %esi,%edx
+80106c87:	83 c4 10             	add    $0x10,%esp
+80106c8a:	c1 fa 1f             	sar    $0x1f,%edx
+80106c8d:	c1 ea 16             	shr    $0x16,%edx
+80106c90:	8d 04 16             	lea    (%esi,%edx,1),%eax
+80106c93:	25 ff 03 00 00       	and    $0x3ff,%eax
+80106c98:	29 d0                	sub    %edx,%eax
+80106c9a:	8b 1c 85 9c 7e 11 80 	mov    -0x7fee8164(,%eax,4),%ebx
+80106ca1:	85 db                	test   %ebx,%ebx
+80106ca3:	75 12                	jne    80106cb7 <transfer_tickets+0x47>
+80106ca5:	eb 71                	jmp    80106d18 <transfer_tickets+0xa8>
+80106ca7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106cae:	66 90                	xchg   %ax,%ax
+80106cb0:	8b 5b 1c             	mov    0x1c(%ebx),%ebx
+80106cb3:	85 db                	test   %ebx,%ebx
+80106cb5:	74 61                	je     80106d18 <transfer_tickets+0xa8>
+    if(p->pid == pid)
+80106cb7:	3b 73 0c             	cmp    0xc(%ebx),%esi
+80106cba:	75 f4                	jne    80106cb0 <transfer_tickets+0x40>
+  pushcli();
+80106cbc:	e8 bf 10 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80106cc1:	e8 8a e1 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80106cc6:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+80106ccc:	e8 ff 10 00 00       	call   80107dd0 <popcli>
+  p = findproc(pid);
+  if(p == 0 || p == myproc() || p->state == ZOMBIE){
+80106cd1:	39 de                	cmp    %ebx,%esi
+80106cd3:	74 43                	je     80106d18 <transfer_tickets+0xa8>
+80106cd5:	83 7b 08 05          	cmpl   $0x5,0x8(%ebx)
+80106cd9:	74 3d                	je     80106d18 <transfer_tickets+0xa8>
+  pushcli();
+80106cdb:	e8 a0 10 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80106ce0:	e8 6b e1 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80106ce5:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+80106ceb:	e8 e0 10 00 00       	call   80107dd0 <popcli>
+    release(&ptable.lock);
+    return -1;
+  }
+  lend(myproc(), p);
+80106cf0:	89 da                	mov    %ebx,%edx
+80106cf2:	89 f0                	mov    %esi,%eax
+80106cf4:	e8 d7 de ff ff       	call   80104bd0 <lend>
+  release(&ptable.lock);
+80106cf9:	83 ec 0c             	sub    $0xc,%esp
+80106cfc:	68 60 6e 11 80       	push   $0x80116e60
+80106d01:	e8 6a 11 00 00       	call   80107e70 <release>
+  return 0;
+80106d06:	83 c4 10             	add    $0x10,%esp
+80106d09:	31 c0                	xor    %eax,%eax
+}
+80106d0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106d0e:	5b                   	pop    %ebx
+80106d0f:	5e                   	pop    %esi
+80106d10:	5d                   	pop    %ebp
+80106d11:	c3                   	ret
+80106d12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    release(&ptable.lock);
+80106d18:	83 ec 0c             	sub    $0xc,%esp
+80106d1b:	68 60 6e 11 80       	push   $0x80116e60
+80106d20:	e8 4b 11 00 00       	call   80107e70 <release>
+    return -1;
+80106d25:	83 c4 10             	add    $0x10,%esp
+80106d28:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106d2d:	eb dc                	jmp    80106d0b <transfer_tickets+0x9b>
+80106d2f:	90                   	nop
+
+80106d30 <mkgroup>:
+// Create a ticket group funded with tickets base tickets
+// and move the caller into it; children it forks from now
+// on join it too.  Returns the new group's id, or -1.
+int
+mkgroup(int tickets)
+{
+80106d30:	55                   	push   %ebp
+80106d31:	89 e5                	mov    %esp,%ebp
+80106d33:	56                   	push   %esi
+80106d34:	53                   	push   %ebx
+80106d35:	8b 75 08             	mov    0x8(%ebp),%esi
+  int gid;
+
+  if(tickets < 1 || tickets > MAXTICKETS)
+80106d38:	8d 46 ff             	lea    -0x1(%esi),%eax
+80106d3b:	3d 9f 86 01 00       	cmp    $0x1869f,%eax
+80106d40:	77 3f                	ja     80106d81 <mkgroup+0x51>
+    return -1;
+  acquire(&ptable.lock);
+80106d42:	83 ec 0c             	sub    $0xc,%esp
+  for(gid = 1; gid <= NGROUP; gid++)
+80106d45:	bb 01 00 00 00       	mov    $0x1,%ebx
+  acquire(&ptable.lock);
+80106d4a:	68 60 6e 11 80       	push   $0x80116e60
+80106d4f:	e8 7c 11 00 00       	call   80107ed0 <acquire>
+  for(gid = 1; gid <= NGROUP; gid++)
+80106d54:	b8 5c 9a 13 80       	mov    $0x80139a5c,%eax
+80106d59:	83 c4 10             	add    $0x10,%esp
+80106d5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(ptable.group[gid - 1].tickets == 0)
+80106d60:	8b 10                	mov    (%eax),%edx
+80106d62:	85 d2                	test   %edx,%edx
+80106d64:	74 2a                	je     80106d90 <mkgroup+0x60>
+  for(gid = 1; gid <= NGROUP; gid++)
+80106d66:	83 c3 01             	add    $0x1,%ebx
+80106d69:	83 c0 0c             	add    $0xc,%eax
+80106d6c:	83 fb 11             	cmp    $0x11,%ebx
+80106d6f:	75 ef                	jne    80106d60 <mkgroup+0x30>
+      break;
+  if(gid > NGROUP){
+    release(&ptable.lock);
+80106d71:	83 ec 0c             	sub    $0xc,%esp
+80106d74:	68 60 6e 11 80       	push   $0x80116e60
+80106d79:	e8 f2 10 00 00       	call   80107e70 <release>
+    return -1;
+80106d7e:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80106d81:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80106d86:	eb 41                	jmp    80106dc9 <mkgroup+0x99>
+80106d88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106d8f:	90                   	nop
+  }
+  ptable.group[gid - 1].tickets = tickets;
+80106d90:	8d 44 5b fd          	lea    -0x3(%ebx,%ebx,2),%eax
+80106d94:	89 34 85 5c 9a 13 80 	mov    %esi,-0x7fec65a4(,%eax,4)
+  pushcli();
+80106d9b:	e8 e0 0f 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80106da0:	e8 ab e0 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80106da5:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+80106dab:	e8 20 10 00 00       	call   80107dd0 <popcli>
+  setgroup(myproc(), gid);
+80106db0:	89 da                	mov    %ebx,%edx
+80106db2:	89 f0                	mov    %esi,%eax
+80106db4:	e8 b7 de ff ff       	call   80104c70 <setgroup>
+  release(&ptable.lock);
+80106db9:	83 ec 0c             	sub    $0xc,%esp
+80106dbc:	68 60 6e 11 80       	push   $0x80116e60
+80106dc1:	e8 aa 10 00 00       	call   80107e70 <release>
+  return gid;
+80106dc6:	83 c4 10             	add    $0x10,%esp
+}
+80106dc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106dcc:	89 d8                	mov    %ebx,%eax
+80106dce:	5b                   	pop    %ebx
+80106dcf:	5e                   	pop    %esi
+80106dd0:	5d                   	pop    %ebp
+80106dd1:	c3                   	ret
+80106dd2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106dd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106de0 <joingroup>:
+
+// Move the caller into existing group gid, or out of
+// its group if gid is 0.
+int
+joingroup(int gid)
+{
+80106de0:	55                   	push   %ebp
+80106de1:	89 e5                	mov    %esp,%ebp
+80106de3:	56                   	push   %esi
+80106de4:	53                   	push   %ebx
+80106de5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(gid < 0 || gid > NGROUP)
+80106de8:	83 fb 10             	cmp    $0x10,%ebx
+80106deb:	77 73                	ja     80106e60 <joingroup+0x80>
+    return -1;
+  acquire(&ptable.lock);
+80106ded:	83 ec 0c             	sub    $0xc,%esp
+80106df0:	68 60 6e 11 80       	push   $0x80116e60
+80106df5:	e8 d6 10 00 00       	call   80107ed0 <acquire>
+  if(gid && ptable.group[gid - 1].tickets == 0){
+80106dfa:	83 c4 10             	add    $0x10,%esp
+80106dfd:	85 db                	test   %ebx,%ebx
+80106dff:	74 0f                	je     80106e10 <joingroup+0x30>
+80106e01:	8d 44 5b fd          	lea    -0x3(%ebx,%ebx,2),%eax
+80106e05:	8b 04 85 5c 9a 13 80 	mov    -0x7fec65a4(,%eax,4),%eax
+80106e0c:	85 c0                	test   %eax,%eax
+80106e0e:	74 37                	je     80106e47 <joingroup+0x67>
+  pushcli();
+80106e10:	e8 6b 0f 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80106e15:	e8 36 e0 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80106e1a:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+80106e20:	e8 ab 0f 00 00       	call   80107dd0 <popcli>
+    release(&ptable.lock);
+    return -1;
+  }
+  setgroup(myproc(), gid);
+80106e25:	89 da                	mov    %ebx,%edx
+80106e27:	89 f0                	mov    %esi,%eax
+80106e29:	e8 42 de ff ff       	call   80104c70 <setgroup>
+  release(&ptable.lock);
+80106e2e:	83 ec 0c             	sub    $0xc,%esp
+80106e31:	68 60 6e 11 80       	push   $0x80116e60
+80106e36:	e8 35 10 00 00       	call   80107e70 <release>
+  return 0;
+80106e3b:	83 c4 10             	add    $0x10,%esp
+80106e3e:	31 c0                	xor    %eax,%eax
+}
+80106e40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106e43:	5b                   	pop    %ebx
+80106e44:	5e                   	pop    %esi
+80106e45:	5d                   	pop    %ebp
+80106e46:	c3                   	ret
+    release(&ptable.lock);
+80106e47:	83 ec 0c             	sub    $0xc,%esp
+80106e4a:	68 60 6e 11 80       	push   $0x80116e60
+80106e4f:	e8 1c 10 00 00       	call   80107e70 <release>
+    return -1;
+80106e54:	83 c4 10             	add    $0x10,%esp
+80106e57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106e5e:	66 90                	xchg   %ax,%ax
+    return -1;
+80106e60:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106e65:	eb d9                	jmp    80106e40 <joingroup+0x60>
+80106e67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106e6e:	66 90                	xchg   %ax,%ax
+
+80106e70 <setsched>:
+// Switch every CPU to scheduling policy pol, with threads
+// co-scheduled if pol includes SCHED_GANG.
+// Returns the previous policy, or -1 if pol is unknown.
+int
+setsched(int pol)
+{
+80106e70:	55                   	push   %ebp
+80106e71:	89 e5                	mov    %esp,%ebp
+80106e73:	57                   	push   %edi
+80106e74:	56                   	push   %esi
+80106e75:	53                   	push   %ebx
+80106e76:	83 ec 0c             	sub    $0xc,%esp
+80106e79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int old, base;
+
+  base = pol & ~SCHED_GANG;
+80106e7c:	89 df                	mov    %ebx,%edi
+80106e7e:	81 e7 ff fe ff ff    	and    $0xfffffeff,%edi
+  if(base != SCHED_LOTTERY && base != SCHED_STRIDE && base != SCHED_MLFQ)
+80106e84:	83 ff 02             	cmp    $0x2,%edi
+80106e87:	77 57                	ja     80106ee0 <setsched+0x70>
+    return -1;
+  acquire(&ptable.lock);
+80106e89:	83 ec 0c             	sub    $0xc,%esp
+80106e8c:	68 60 6e 11 80       	push   $0x80116e60
+80106e91:	e8 3a 10 00 00       	call   80107ed0 <acquire>
+  old = policy | (gangsched ? SCHED_GANG : 0);
+80106e96:	8b 15 a8 9b 13 80    	mov    0x80139ba8,%edx
+80106e9c:	31 c0                	xor    %eax,%eax
+80106e9e:	85 d2                	test   %edx,%edx
+80106ea0:	0f 95 c0             	setne  %al
+  policy = base;
+  gangsched = (pol & SCHED_GANG) != 0;
+80106ea3:	c1 eb 08             	shr    $0x8,%ebx
+  old = policy | (gangsched ? SCHED_GANG : 0);
+80106ea6:	89 c6                	mov    %eax,%esi
+  gangsched = (pol & SCHED_GANG) != 0;
+80106ea8:	83 e3 01             	and    $0x1,%ebx
+80106eab:	89 1d a8 9b 13 80    	mov    %ebx,0x80139ba8
+  old = policy | (gangsched ? SCHED_GANG : 0);
+80106eb1:	c1 e6 08             	shl    $0x8,%esi
+80106eb4:	0b 35 ac 9b 13 80    	or     0x80139bac,%esi
+  policy = base;
+80106eba:	89 3d ac 9b 13 80    	mov    %edi,0x80139bac
+  release(&ptable.lock);
+80106ec0:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+80106ec7:	e8 a4 0f 00 00       	call   80107e70 <release>
+  return old;
+80106ecc:	83 c4 10             	add    $0x10,%esp
+}
+80106ecf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106ed2:	89 f0                	mov    %esi,%eax
+80106ed4:	5b                   	pop    %ebx
+80106ed5:	5e                   	pop    %esi
+80106ed6:	5f                   	pop    %edi
+80106ed7:	5d                   	pop    %ebp
+80106ed8:	c3                   	ret
+80106ed9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80106ee0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80106ee5:	eb e8                	jmp    80106ecf <setsched+0x5f>
+80106ee7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106eee:	66 90                	xchg   %ax,%ax
+
+80106ef0 <getpinfo>:
+// Fill ps with up to NPSTAT live processes, starting at ptable
+// slot ps->next, and set ps->next to the slot to go on from,
+// or 0 once every process has been reported; callers page
+// through the whole table by calling until it is 0 again.
+int
+getpinfo(struct pstat* ps) {
+80106ef0:	55                   	push   %ebp
+80106ef1:	89 e5                	mov    %esp,%ebp
+80106ef3:	57                   	push   %edi
+80106ef4:	56                   	push   %esi
+80106ef5:	53                   	push   %ebx
+80106ef6:	83 ec 18             	sub    $0x18,%esp
+  int i = 0, j;
+  struct proc *p;
+  acquire(&ptable.lock);
+80106ef9:	68 60 6e 11 80       	push   $0x80116e60
+80106efe:	e8 cd 0f 00 00       	call   80107ed0 <acquire>
+  
+  j = ps->next;
+  if(j < 0)
+80106f03:	8b 45 08             	mov    0x8(%ebp),%eax
+80106f06:	31 d2                	xor    %edx,%edx
+80106f08:	89 d6                	mov    %edx,%esi
+80106f0a:	8b 80 00 0b 00 00    	mov    0xb00(%eax),%eax
+80106f10:	85 c0                	test   %eax,%eax
+80106f12:	0f 49 f0             	cmovns %eax,%esi
+    j = 0;
+  memset(ps, 0, sizeof(*ps));
+80106f15:	83 c4 0c             	add    $0xc,%esp
+80106f18:	68 04 0b 00 00       	push   $0xb04
+80106f1d:	6a 00                	push   $0x0
+80106f1f:	ff 75 08             	push   0x8(%ebp)
+80106f22:	e8 89 10 00 00       	call   80107fb0 <memset>
+  for (; j < ptable.nslot && i < NPSTAT; j++) 
+80106f27:	83 c4 10             	add    $0x10,%esp
+80106f2a:	3b 35 94 7e 11 80    	cmp    0x80117e94,%esi
+80106f30:	0f 8d c4 00 00 00    	jge    80106ffa <getpinfo+0x10a>
+  int i = 0, j;
+80106f36:	31 ff                	xor    %edi,%edi
+80106f38:	eb 0f                	jmp    80106f49 <getpinfo+0x59>
+80106f3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for (; j < ptable.nslot && i < NPSTAT; j++) 
+80106f40:	83 ff 40             	cmp    $0x40,%edi
+80106f43:	0f 84 d7 00 00 00    	je     80107020 <getpinfo+0x130>
+  {
+    p = ptable.slot[j];
+80106f49:	8b 0c b5 94 6e 11 80 	mov    -0x7fee916c(,%esi,4),%ecx
+    if(p->state == UNUSED)
+80106f50:	8b 59 08             	mov    0x8(%ecx),%ebx
+80106f53:	85 db                	test   %ebx,%ebx
+80106f55:	0f 84 8f 00 00 00    	je     80106fea <getpinfo+0xfa>
+      continue;
+    ps->pid[i] = p->pid;
+80106f5b:	8b 55 08             	mov    0x8(%ebp),%edx
+80106f5e:	8b 41 0c             	mov    0xc(%ecx),%eax
+80106f61:	8d 1c ba             	lea    (%edx,%edi,4),%ebx
+    ps->misses[i] = p->rtmisses;
+    ps->migrations[i] = p->migrations;
+    ps->level[i] = p->level;
+    ps->utime[i] = p->utime >> 10;
+    ps->stime[i] = p->stime >> 10;
+    i++;
+80106f64:	83 c7 01             	add    $0x1,%edi
+    ps->pid[i] = p->pid;
+80106f67:	89 83 00 02 00 00    	mov    %eax,0x200(%ebx)
+    ps->inuse[i] = 1;
+80106f6d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+    ps->tickets[i] = p->tickets;
+80106f73:	8b 41 58             	mov    0x58(%ecx),%eax
+80106f76:	89 83 00 01 00 00    	mov    %eax,0x100(%ebx)
+    ps->ticks[i] = p->ticks;
+80106f7c:	8b 41 5c             	mov    0x5c(%ecx),%eax
+80106f7f:	89 83 00 03 00 00    	mov    %eax,0x300(%ebx)
+    ps->quantum[i] = p->quantum;
+80106f85:	8b 81 80 00 00 00    	mov    0x80(%ecx),%eax
+80106f8b:	89 83 00 04 00 00    	mov    %eax,0x400(%ebx)
+    ps->group[i] = p->group;
+80106f91:	8b 81 8c 00 00 00    	mov    0x8c(%ecx),%eax
+80106f97:	89 83 00 05 00 00    	mov    %eax,0x500(%ebx)
+    ps->misses[i] = p->rtmisses;
+80106f9d:	8b 81 b4 00 00 00    	mov    0xb4(%ecx),%eax
+80106fa3:	89 83 00 06 00 00    	mov    %eax,0x600(%ebx)
+    ps->migrations[i] = p->migrations;
+80106fa9:	8b 41 7c             	mov    0x7c(%ecx),%eax
+80106fac:	89 83 00 07 00 00    	mov    %eax,0x700(%ebx)
+    ps->level[i] = p->level;
+80106fb2:	8b 81 84 00 00 00    	mov    0x84(%ecx),%eax
+80106fb8:	89 83 00 08 00 00    	mov    %eax,0x800(%ebx)
+    ps->utime[i] = p->utime >> 10;
+80106fbe:	8b 91 48 01 00 00    	mov    0x148(%ecx),%edx
+80106fc4:	8b 81 44 01 00 00    	mov    0x144(%ecx),%eax
+80106fca:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+80106fce:	89 83 00 09 00 00    	mov    %eax,0x900(%ebx)
+    ps->stime[i] = p->stime >> 10;
+80106fd4:	8b 81 4c 01 00 00    	mov    0x14c(%ecx),%eax
+80106fda:	8b 91 50 01 00 00    	mov    0x150(%ecx),%edx
+80106fe0:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+80106fe4:	89 83 00 0a 00 00    	mov    %eax,0xa00(%ebx)
+  for (; j < ptable.nslot && i < NPSTAT; j++) 
+80106fea:	a1 94 7e 11 80       	mov    0x80117e94,%eax
+80106fef:	83 c6 01             	add    $0x1,%esi
+80106ff2:	39 f0                	cmp    %esi,%eax
+80106ff4:	0f 8f 46 ff ff ff    	jg     80106f40 <getpinfo+0x50>
+  }
+  ps->next = j < ptable.nslot ? j : 0;
+80106ffa:	31 f6                	xor    %esi,%esi
+80106ffc:	8b 45 08             	mov    0x8(%ebp),%eax
+  
+  release(&ptable.lock);
+80106fff:	83 ec 0c             	sub    $0xc,%esp
+  ps->next = j < ptable.nslot ? j : 0;
+80107002:	89 b0 00 0b 00 00    	mov    %esi,0xb00(%eax)
+  release(&ptable.lock);
+80107008:	68 60 6e 11 80       	push   $0x80116e60
+8010700d:	e8 5e 0e 00 00       	call   80107e70 <release>
+  
+  return 0;
+}
+80107012:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107015:	31 c0                	xor    %eax,%eax
+80107017:	5b                   	pop    %ebx
+80107018:	5e                   	pop    %esi
+80107019:	5f                   	pop    %edi
+8010701a:	5d                   	pop    %ebp
+8010701b:	c3                   	ret
+8010701c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ps->next = j < ptable.nslot ? j : 0;
+80107020:	39 f0                	cmp    %esi,%eax
+80107022:	7f d8                	jg     80106ffc <getpinfo+0x10c>
+80107024:	eb d4                	jmp    80106ffa <getpinfo+0x10a>
+80107026:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010702d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107030 <getlatency>:
+
+// Copy the scheduling latency histogram of process pid,
+// or of the whole system if pid is 0, to hist.
+int
+getlatency(int pid, uint *hist)
+{
+80107030:	55                   	push   %ebp
+80107031:	89 e5                	mov    %esp,%ebp
+80107033:	53                   	push   %ebx
+80107034:	83 ec 10             	sub    $0x10,%esp
+80107037:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p;
+
+  acquire(&ptable.lock);
+8010703a:	68 60 6e 11 80       	push   $0x80116e60
+8010703f:	e8 8c 0e 00 00       	call   80107ed0 <acquire>
+  if(pid == 0)
+80107044:	83 c4 10             	add    $0x10,%esp
+80107047:	85 db                	test   %ebx,%ebx
+80107049:	74 65                	je     801070b0 <getlatency+0x80>
+  for(p = ptable.pidhash[pid % NPIDHASH]; p; p = p->hnext)
+8010704b:	89 da                	mov    %ebx,%edx
+8010704d:	c1 fa 1f             	sar    $0x1f,%edx
+80107050:	c1 ea 16             	shr    $0x16,%edx
+80107053:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+80107056:	25 ff 03 00 00       	and    $0x3ff,%eax
+8010705b:	29 d0                	sub    %edx,%eax
+8010705d:	8b 04 85 9c 7e 11 80 	mov    -0x7fee8164(,%eax,4),%eax
+80107064:	85 c0                	test   %eax,%eax
+80107066:	75 0f                	jne    80107077 <getlatency+0x47>
+80107068:	eb 66                	jmp    801070d0 <getlatency+0xa0>
+8010706a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80107070:	8b 40 1c             	mov    0x1c(%eax),%eax
+80107073:	85 c0                	test   %eax,%eax
+80107075:	74 59                	je     801070d0 <getlatency+0xa0>
+    if(p->pid == pid)
+80107077:	3b 58 0c             	cmp    0xc(%eax),%ebx
+8010707a:	75 f4                	jne    80107070 <getlatency+0x40>
+    memmove(hist, ptable.lathist, sizeof(ptable.lathist));
+  else if((p = findproc(pid)) != 0)
+    memmove(hist, p->lathist, sizeof(p->lathist));
+8010707c:	83 ec 04             	sub    $0x4,%esp
+8010707f:	05 c4 00 00 00       	add    $0xc4,%eax
+80107084:	68 80 00 00 00       	push   $0x80
+80107089:	50                   	push   %eax
+8010708a:	ff 75 0c             	push   0xc(%ebp)
+8010708d:	e8 ae 0f 00 00       	call   80108040 <memmove>
+80107092:	83 c4 10             	add    $0x10,%esp
+  else {
+    release(&ptable.lock);
+    return -1;
+  }
+  release(&ptable.lock);
+80107095:	83 ec 0c             	sub    $0xc,%esp
+80107098:	68 60 6e 11 80       	push   $0x80116e60
+8010709d:	e8 ce 0d 00 00       	call   80107e70 <release>
+  return 0;
+801070a2:	83 c4 10             	add    $0x10,%esp
+801070a5:	31 c0                	xor    %eax,%eax
+}
+801070a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801070aa:	c9                   	leave
+801070ab:	c3                   	ret
+801070ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    memmove(hist, ptable.lathist, sizeof(ptable.lathist));
+801070b0:	83 ec 04             	sub    $0x4,%esp
+801070b3:	68 80 00 00 00       	push   $0x80
+801070b8:	68 24 9b 13 80       	push   $0x80139b24
+801070bd:	ff 75 0c             	push   0xc(%ebp)
+801070c0:	e8 7b 0f 00 00       	call   80108040 <memmove>
+801070c5:	83 c4 10             	add    $0x10,%esp
+801070c8:	eb cb                	jmp    80107095 <getlatency+0x65>
+801070ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    release(&ptable.lock);
+801070d0:	83 ec 0c             	sub    $0xc,%esp
+801070d3:	68 60 6e 11 80       	push   $0x80116e60
+801070d8:	e8 93 0d 00 00       	call   80107e70 <release>
+    return -1;
+801070dd:	83 c4 10             	add    $0x10,%esp
+801070e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801070e5:	eb c0                	jmp    801070a7 <getlatency+0x77>
+801070e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801070ee:	66 90                	xchg   %ax,%ax
+
+801070f0 <clone>:
+
+int
+clone(void(*fcn)(void*, void*), void *arg1, void *arg2, void *stack, int flags)
+{
+801070f0:	55                   	push   %ebp
+801070f1:	89 e5                	mov    %esp,%ebp
+801070f3:	57                   	push   %edi
+801070f4:	56                   	push   %esi
+801070f5:	53                   	push   %ebx
+801070f6:	83 ec 2c             	sub    $0x2c,%esp
+  pushcli();
+801070f9:	e8 82 0c 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+801070fe:	e8 4d dd ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80107103:	8b 90 ac 00 00 00    	mov    0xac(%eax),%edx
+80107109:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  popcli();
+8010710c:	e8 bf 0c 00 00       	call   80107dd0 <popcli>
+  struct proc *np;
+  struct proc *curproc = myproc();
+  
+   //check if the stack address is page-aligned and have at least one page of memory
+  if(((uint) stack % PGSIZE) != 0) return -1; 
+80107111:	f7 45 14 ff 0f 00 00 	testl  $0xfff,0x14(%ebp)
+80107118:	0f 85 1c 02 00 00    	jne    8010733a <clone+0x24a>
+  if((curproc->mm->sz < PGSIZE + (uint) stack)) return -1;
+8010711e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80107121:	8b 45 14             	mov    0x14(%ebp),%eax
+80107124:	8b 0a                	mov    (%edx),%ecx
+80107126:	05 00 10 00 00       	add    $0x1000,%eax
+8010712b:	39 41 78             	cmp    %eax,0x78(%ecx)
+8010712e:	0f 82 06 02 00 00    	jb     8010733a <clone+0x24a>
+  if(flags & ~(CLONE_DETACHED | CLONE_FILES | CLONE_FS)) return -1;
+80107134:	83 7d 18 07          	cmpl   $0x7,0x18(%ebp)
+80107138:	0f 87 fc 01 00 00    	ja     8010733a <clone+0x24a>
+
+  // Allocate process.
+  if((np = allocproc()) == 0){
+8010713e:	e8 8d dd ff ff       	call   80104ed0 <allocproc>
+80107143:	89 c3                	mov    %eax,%ebx
+80107145:	85 c0                	test   %eax,%eax
+80107147:	0f 84 ed 01 00 00    	je     8010733a <clone+0x24a>
+    return -1;
+  }
+	
+  // Copy process data to the new thread
+  np->mm = curproc->mm; //make the thread share the parent's address space, and its size
+8010714d:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  mmdup(np->mm);
+80107150:	83 ec 0c             	sub    $0xc,%esp
+  np->mm = curproc->mm; //make the thread share the parent's address space, and its size
+80107153:	8b 02                	mov    (%edx),%eax
+80107155:	89 03                	mov    %eax,(%ebx)
+  mmdup(np->mm);
+80107157:	50                   	push   %eax
+80107158:	e8 33 42 00 00       	call   8010b390 <mmdup>
+  
+  np->affinity = curproc->affinity;
+8010715d:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  np->detached = (flags & CLONE_DETACHED) != 0;
+  
+  *np->tf = *curproc->tf;  //parent process and thread have the same trap frame
+80107160:	8b 7b 24             	mov    0x24(%ebx),%edi
+80107163:	b9 13 00 00 00       	mov    $0x13,%ecx
+
+
+  uint user_stack[3];
+  
+  // This sets the first value in the stack, which the base pointer will be set to. It's a "fake" value because there is no previous base pointer.
+  user_stack[0] = 0xffffffff;
+80107168:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%ebp)
+  np->affinity = curproc->affinity;
+8010716f:	8b 42 78             	mov    0x78(%edx),%eax
+80107172:	89 43 78             	mov    %eax,0x78(%ebx)
+  np->detached = (flags & CLONE_DETACHED) != 0;
+80107175:	8b 45 18             	mov    0x18(%ebp),%eax
+80107178:	83 e0 01             	and    $0x1,%eax
+8010717b:	89 83 60 01 00 00    	mov    %eax,0x160(%ebx)
+  
+  //This sets the first value after the base pointer to the first function argument. 
+  user_stack[1] = (uint) arg1;
+80107181:	8b 45 0c             	mov    0xc(%ebp),%eax
+  *np->tf = *curproc->tf;  //parent process and thread have the same trap frame
+80107184:	8b 72 24             	mov    0x24(%edx),%esi
+80107187:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  user_stack[1] = (uint) arg1;
+80107189:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  
+  //This sets the second value after the base pointer to the second function argument.
+  user_stack[2] = (uint) arg2;
+8010718c:	8b 45 10             	mov    0x10(%ebp),%eax
+8010718f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  
+  // set top of the stack to the allocated page (stack is actually the bottom of the page)
+  uint stack_top = (uint) stack + PGSIZE;
+  
+  // subtract 12 bytes from the stack top to make space for the three values being saved
+  stack_top -= 12;
+80107192:	8b 45 14             	mov    0x14(%ebp),%eax
+  // copy user stack values to np's memory
+  if (copyout(np->mm->pgdir, stack_top, user_stack, 12) < 0) {
+80107195:	6a 0c                	push   $0xc
+  stack_top -= 12;
+80107197:	8d b0 f4 0f 00 00    	lea    0xff4(%eax),%esi
+  if (copyout(np->mm->pgdir, stack_top, user_stack, 12) < 0) {
+8010719d:	8d 45 dc             	lea    -0x24(%ebp),%eax
+801071a0:	50                   	push   %eax
+801071a1:	56                   	push   %esi
+801071a2:	8b 03                	mov    (%ebx),%eax
+801071a4:	ff 70 74             	push   0x74(%eax)
+801071a7:	e8 54 44 00 00       	call   8010b600 <copyout>
+801071ac:	83 c4 20             	add    $0x20,%esp
+801071af:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+801071b2:	85 c0                	test   %eax,%eax
+801071b4:	0f 88 5d 01 00 00    	js     80107317 <clone+0x227>
+    release(&ptable.lock);
+    return -1;
+  }
+
+
+  np->tf->esp = (uint) stack;	 //putting the address of stack in the stack pointer
+801071ba:	8b 43 24             	mov    0x24(%ebx),%eax
+801071bd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  // they will be the same value because we are returning into a function
+  np->tf->ebp = (uint) stack_top; 	//The base pointer is set to the top of the newly-allocated memory.
+  np->tf->esp = (uint) stack_top; 	// The stack pointer is also set to the of the page because that is where our function will enter. 
+  
+
+  np->tf->eip = (uint) fcn; 	// This sets the instruction pointer register. This ensures the cloned process will run fcn on start.
+801071c0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  np->tf->esp = (uint) stack;	 //putting the address of stack in the stack pointer
+801071c3:	89 78 44             	mov    %edi,0x44(%eax)
+  np->tf->eax = 0;  
+801071c6:	8b 43 24             	mov    0x24(%ebx),%eax
+801071c9:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  np->tf->ebp = (uint) stack_top; 	//The base pointer is set to the top of the newly-allocated memory.
+801071d0:	8b 43 24             	mov    0x24(%ebx),%eax
+  np->threadstack = stack;   //saving the address of the stack
+801071d3:	89 bb 5c 01 00 00    	mov    %edi,0x15c(%ebx)
+  np->tf->ebp = (uint) stack_top; 	//The base pointer is set to the top of the newly-allocated memory.
+801071d9:	89 70 08             	mov    %esi,0x8(%eax)
+  np->tf->esp = (uint) stack_top; 	// The stack pointer is also set to the of the page because that is where our function will enter. 
+801071dc:	8b 43 24             	mov    0x24(%ebx),%eax
+801071df:	89 70 44             	mov    %esi,0x44(%eax)
+  np->tf->eip = (uint) fcn; 	// This sets the instruction pointer register. This ensures the cloned process will run fcn on start.
+801071e2:	8b 43 24             	mov    0x24(%ebx),%eax
+801071e5:	89 48 38             	mov    %ecx,0x38(%eax)
+  
+  
+  // Clear %eax so that fork returns 0 in the child.
+  np->tf->eax = 0;	//This is the return register. The child process returning from clone should get 0 as a return value.
+801071e8:	8b 43 24             	mov    0x24(%ebx),%eax
+801071eb:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  
+  // Share the files and current directory of the current process(thread)
+  // with the new thread if asked to, else give it copies of them
+  np->files = (flags & CLONE_FILES) ? fdtdup(curproc->files) : fdtcopy(curproc->files);
+801071f2:	f6 45 18 02          	testb  $0x2,0x18(%ebp)
+801071f6:	0f 85 b4 00 00 00    	jne    801072b0 <clone+0x1c0>
+801071fc:	83 ec 0c             	sub    $0xc,%esp
+801071ff:	ff 72 40             	push   0x40(%edx)
+80107202:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80107205:	e8 d6 a0 ff ff       	call   801012e0 <fdtcopy>
+8010720a:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+8010720d:	83 c4 10             	add    $0x10,%esp
+80107210:	89 43 40             	mov    %eax,0x40(%ebx)
+  np->cwd = (flags & CLONE_FS) ? cwddup(curproc->cwd) : cwdcopy(curproc->cwd);
+80107213:	f6 45 18 04          	testb  $0x4,0x18(%ebp)
+80107217:	0f 84 b4 00 00 00    	je     801072d1 <clone+0x1e1>
+8010721d:	83 ec 0c             	sub    $0xc,%esp
+80107220:	ff 72 44             	push   0x44(%edx)
+80107223:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80107226:	e8 25 a3 ff ff       	call   80101550 <cwddup>
+8010722b:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+8010722e:	83 c4 10             	add    $0x10,%esp
+  if(np->files == 0 || np->cwd == 0){
+80107231:	8b 4b 40             	mov    0x40(%ebx),%ecx
+  np->cwd = (flags & CLONE_FS) ? cwddup(curproc->cwd) : cwdcopy(curproc->cwd);
+80107234:	89 43 44             	mov    %eax,0x44(%ebx)
+  if(np->files == 0 || np->cwd == 0){
+80107237:	85 c9                	test   %ecx,%ecx
+80107239:	0f 84 ba 00 00 00    	je     801072f9 <clone+0x209>
+8010723f:	85 c0                	test   %eax,%eax
+80107241:	0f 84 a3 00 00 00    	je     801072ea <clone+0x1fa>
+    freeproc(np);
+    release(&ptable.lock);
+    return -1;
+  }
+  // Make the two threads belong to the current process
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80107247:	83 ec 04             	sub    $0x4,%esp
+8010724a:	8d 42 48             	lea    0x48(%edx),%eax
+8010724d:	6a 10                	push   $0x10
+8010724f:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80107252:	50                   	push   %eax
+80107253:	8d 43 48             	lea    0x48(%ebx),%eax
+80107256:	50                   	push   %eax
+80107257:	e8 04 0f 00 00       	call   80108160 <safestrcpy>
+
+  acquire(&ptable.lock);
+8010725c:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+80107263:	e8 68 0c 00 00       	call   80107ed0 <acquire>
+  child->parent = parent;
+80107268:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+8010726b:	89 53 10             	mov    %edx,0x10(%ebx)
+  child->sibling = parent->children;
+8010726e:	8b 42 14             	mov    0x14(%edx),%eax
+80107271:	89 43 18             	mov    %eax,0x18(%ebx)
+  
+  // Make the calling process the new thread's parent,
+  // and the state of the new thread to be runnable 
+  adopt(curproc, np);
+  setgroup(np, curproc->group);
+80107274:	89 d8                	mov    %ebx,%eax
+  parent->children = child;
+80107276:	89 5a 14             	mov    %ebx,0x14(%edx)
+  setgroup(np, curproc->group);
+80107279:	8b 92 8c 00 00 00    	mov    0x8c(%edx),%edx
+8010727f:	e8 ec d9 ff ff       	call   80104c70 <setgroup>
+  setstate(np, RUNNABLE);
+80107284:	89 d8                	mov    %ebx,%eax
+80107286:	ba 03 00 00 00       	mov    $0x3,%edx
+8010728b:	e8 80 e4 ff ff       	call   80105710 <setstate>
+
+  release(&ptable.lock);
+80107290:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+80107297:	e8 d4 0b 00 00       	call   80107e70 <release>
+
+  return np->pid;
+8010729c:	8b 43 0c             	mov    0xc(%ebx),%eax
+8010729f:	83 c4 10             	add    $0x10,%esp
+}
+801072a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801072a5:	5b                   	pop    %ebx
+801072a6:	5e                   	pop    %esi
+801072a7:	5f                   	pop    %edi
+801072a8:	5d                   	pop    %ebp
+801072a9:	c3                   	ret
+801072aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  np->files = (flags & CLONE_FILES) ? fdtdup(curproc->files) : fdtcopy(curproc->files);
+801072b0:	83 ec 0c             	sub    $0xc,%esp
+801072b3:	ff 72 40             	push   0x40(%edx)
+801072b6:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+801072b9:	e8 c2 a0 ff ff       	call   80101380 <fdtdup>
+801072be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+801072c1:	83 c4 10             	add    $0x10,%esp
+801072c4:	89 43 40             	mov    %eax,0x40(%ebx)
+  np->cwd = (flags & CLONE_FS) ? cwddup(curproc->cwd) : cwdcopy(curproc->cwd);
+801072c7:	f6 45 18 04          	testb  $0x4,0x18(%ebp)
+801072cb:	0f 85 4c ff ff ff    	jne    8010721d <clone+0x12d>
+801072d1:	83 ec 0c             	sub    $0xc,%esp
+801072d4:	ff 72 44             	push   0x44(%edx)
+801072d7:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+801072da:	e8 21 a2 ff ff       	call   80101500 <cwdcopy>
+801072df:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+801072e2:	83 c4 10             	add    $0x10,%esp
+801072e5:	e9 47 ff ff ff       	jmp    80107231 <clone+0x141>
+      fdtput(np->files);
+801072ea:	83 ec 0c             	sub    $0xc,%esp
+801072ed:	51                   	push   %ecx
+801072ee:	e8 bd a0 ff ff       	call   801013b0 <fdtput>
+    if(np->cwd)
+801072f3:	8b 43 44             	mov    0x44(%ebx),%eax
+801072f6:	83 c4 10             	add    $0x10,%esp
+801072f9:	85 c0                	test   %eax,%eax
+801072fb:	74 0c                	je     80107309 <clone+0x219>
+      cwdput(np->cwd);
+801072fd:	83 ec 0c             	sub    $0xc,%esp
+80107300:	50                   	push   %eax
+80107301:	e8 7a a2 ff ff       	call   80101580 <cwdput>
+80107306:	83 c4 10             	add    $0x10,%esp
+    np->files = 0;
+80107309:	c7 43 40 00 00 00 00 	movl   $0x0,0x40(%ebx)
+    np->cwd = 0;
+80107310:	c7 43 44 00 00 00 00 	movl   $0x0,0x44(%ebx)
+    acquire(&ptable.lock);
+80107317:	83 ec 0c             	sub    $0xc,%esp
+8010731a:	68 60 6e 11 80       	push   $0x80116e60
+8010731f:	e8 ac 0b 00 00       	call   80107ed0 <acquire>
+    freeproc(np);
+80107324:	89 d8                	mov    %ebx,%eax
+80107326:	e8 85 cc ff ff       	call   80103fb0 <freeproc>
+    release(&ptable.lock);
+8010732b:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+80107332:	e8 39 0b 00 00       	call   80107e70 <release>
+    return -1;
+80107337:	83 c4 10             	add    $0x10,%esp
+  if(((uint) stack % PGSIZE) != 0) return -1; 
+8010733a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010733f:	e9 5e ff ff ff       	jmp    801072a2 <clone+0x1b2>
+80107344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010734b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010734f:	90                   	nop
+
+80107350 <join>:
+
+int 
+join(void** stack) 
+{
+80107350:	55                   	push   %ebp
+80107351:	89 e5                	mov    %esp,%ebp
+80107353:	56                   	push   %esi
+80107354:	53                   	push   %ebx
+  pushcli();
+80107355:	e8 26 0a 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+8010735a:	e8 f1 da ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+8010735f:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80107365:	e8 66 0a 00 00       	call   80107dd0 <popcli>
+  struct proc *p;
+  int havethreads, pid;
+  struct proc *curproc = myproc();
+  
+  acquire(&ptable.lock);
+8010736a:	83 ec 0c             	sub    $0xc,%esp
+8010736d:	68 60 6e 11 80       	push   $0x80116e60
+80107372:	e8 59 0b 00 00       	call   80107ed0 <acquire>
+    // Scan through table looking for exited children (zombie children).
+    havethreads = 0;
+    
+    //loop over our children and check if a child has the same address space as the current process 
+    //If they share the same page directory it means that the p must be a "child" thread of the parent process (curproc).
+    for(p = curproc->children; p; p = p->sibling){
+80107377:	8b 43 14             	mov    0x14(%ebx),%eax
+  acquire(&ptable.lock);
+8010737a:	83 c4 10             	add    $0x10,%esp
+    for(p = curproc->children; p; p = p->sibling){
+8010737d:	85 c0                	test   %eax,%eax
+8010737f:	74 7c                	je     801073fd <join+0xad>
+          // If the child does not share the same address space...  
+      if(p->mm != curproc->mm || p->detached)
+80107381:	8b 13                	mov    (%ebx),%edx
+    havethreads = 0;
+80107383:	31 c9                	xor    %ecx,%ecx
+80107385:	eb 10                	jmp    80107397 <join+0x47>
+80107387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010738e:	66 90                	xchg   %ax,%ax
+    for(p = curproc->children; p; p = p->sibling){
+80107390:	8b 40 18             	mov    0x18(%eax),%eax
+80107393:	85 c0                	test   %eax,%eax
+80107395:	74 20                	je     801073b7 <join+0x67>
+      if(p->mm != curproc->mm || p->detached)
+80107397:	39 10                	cmp    %edx,(%eax)
+80107399:	75 f5                	jne    80107390 <join+0x40>
+8010739b:	8b b0 60 01 00 00    	mov    0x160(%eax),%esi
+801073a1:	85 f6                	test   %esi,%esi
+801073a3:	75 eb                	jne    80107390 <join+0x40>
+      havethreads = 1; 
+      
+      // free the thread resources
+      // the difference between join() and wait() is that join does not free the child thread's address space 
+      // Because the child is a thread, this is also the parent's address space! Freeing it would break the parent process.
+      if(p->state == ZOMBIE){
+801073a5:	83 78 08 05          	cmpl   $0x5,0x8(%eax)
+801073a9:	74 75                	je     80107420 <join+0xd0>
+    for(p = curproc->children; p; p = p->sibling){
+801073ab:	8b 40 18             	mov    0x18(%eax),%eax
+      havethreads = 1; 
+801073ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+    for(p = curproc->children; p; p = p->sibling){
+801073b3:	85 c0                	test   %eax,%eax
+801073b5:	75 e0                	jne    80107397 <join+0x47>
+        return pid;
+      }
+    }
+
+    // No point waiting if we don't have any children.
+    if(!havethreads || curproc->killed){
+801073b7:	85 c9                	test   %ecx,%ecx
+801073b9:	74 42                	je     801073fd <join+0xad>
+801073bb:	8b 43 3c             	mov    0x3c(%ebx),%eax
+801073be:	85 c0                	test   %eax,%eax
+801073c0:	75 3b                	jne    801073fd <join+0xad>
+  pushcli();
+801073c2:	e8 b9 09 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+801073c7:	e8 84 da ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+801073cc:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+801073d2:	e8 f9 09 00 00       	call   80107dd0 <popcli>
+  if(p == 0)
+801073d7:	85 f6                	test   %esi,%esi
+801073d9:	74 7b                	je     80107456 <join+0x106>
+  p->chan = chan;
+801073db:	89 5e 2c             	mov    %ebx,0x2c(%esi)
+  setstate(p, SLEEPING);
+801073de:	89 f0                	mov    %esi,%eax
+801073e0:	ba 02 00 00 00       	mov    $0x2,%edx
+801073e5:	e8 26 e3 ff ff       	call   80105710 <setstate>
+  sched();
+801073ea:	e8 b1 ee ff ff       	call   801062a0 <sched>
+  p->chan = 0;
+801073ef:	c7 46 2c 00 00 00 00 	movl   $0x0,0x2c(%esi)
+    for(p = curproc->children; p; p = p->sibling){
+801073f6:	8b 43 14             	mov    0x14(%ebx),%eax
+801073f9:	85 c0                	test   %eax,%eax
+801073fb:	75 84                	jne    80107381 <join+0x31>
+      release(&ptable.lock);
+801073fd:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+80107400:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+      release(&ptable.lock);
+80107405:	68 60 6e 11 80       	push   $0x80116e60
+8010740a:	e8 61 0a 00 00       	call   80107e70 <release>
+      return -1;
+8010740f:	83 c4 10             	add    $0x10,%esp
+    }
+
+    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+  }
+}
+80107412:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107415:	89 d8                	mov    %ebx,%eax
+80107417:	5b                   	pop    %ebx
+80107418:	5e                   	pop    %esi
+80107419:	5d                   	pop    %ebp
+8010741a:	c3                   	ret
+8010741b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010741f:	90                   	nop
+        *stack = p->threadstack;
+80107420:	8b 88 5c 01 00 00    	mov    0x15c(%eax),%ecx
+80107426:	8b 55 08             	mov    0x8(%ebp),%edx
+        pid = p->pid;
+80107429:	8b 58 0c             	mov    0xc(%eax),%ebx
+        *stack = p->threadstack;
+8010742c:	89 0a                	mov    %ecx,(%edx)
+        p->threadstack = 0;
+8010742e:	c7 80 5c 01 00 00 00 	movl   $0x0,0x15c(%eax)
+80107435:	00 00 00 
+        freeproc(p);
+80107438:	e8 73 cb ff ff       	call   80103fb0 <freeproc>
+        release(&ptable.lock);
+8010743d:	83 ec 0c             	sub    $0xc,%esp
+80107440:	68 60 6e 11 80       	push   $0x80116e60
+80107445:	e8 26 0a 00 00       	call   80107e70 <release>
+        return pid;
+8010744a:	83 c4 10             	add    $0x10,%esp
+}
+8010744d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107450:	89 d8                	mov    %ebx,%eax
+80107452:	5b                   	pop    %ebx
+80107453:	5e                   	pop    %esi
+80107454:	5d                   	pop    %ebp
+80107455:	c3                   	ret
+    panic("sleep");
+80107456:	83 ec 0c             	sub    $0xc,%esp
+80107459:	68 19 c0 10 80       	push   $0x8010c019
+8010745e:	e8 1d 8f ff ff       	call   80100380 <panic>
+80107463:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010746a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107470 <join_any>:
+// flags has JOIN_NOHANG; with JOIN_DETACHED only collects
+// detached stacks.  Returns the number of entries filled,
+// or -1 if there is nothing to wait for.
+int
+join_any(int *pids, void **stacks, int n, int flags)
+{
+80107470:	55                   	push   %ebp
+80107471:	89 e5                	mov    %esp,%ebp
+80107473:	57                   	push   %edi
+80107474:	56                   	push   %esi
+80107475:	53                   	push   %ebx
+80107476:	83 ec 2c             	sub    $0x2c,%esp
+  pushcli();
+80107479:	e8 02 09 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+8010747e:	e8 cd d9 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80107483:	8b b8 ac 00 00 00    	mov    0xac(%eax),%edi
+  popcli();
+80107489:	e8 42 09 00 00       	call   80107dd0 <popcli>
+  struct proc *p, *next;
+  int havethreads, k;
+  struct proc *curproc = myproc();
+
+  acquire(&ptable.lock);
+8010748e:	83 ec 0c             	sub    $0xc,%esp
+80107491:	68 60 6e 11 80       	push   $0x80116e60
+80107496:	e8 35 0a 00 00       	call   80107ed0 <acquire>
+  for(;;){
+    havethreads = 0;
+    k = 0;
+    for(p = curproc->children; p && k < n; p = next){
+8010749b:	8b 75 10             	mov    0x10(%ebp),%esi
+      next = p->sibling;
+      if(p->mm != curproc->mm || p->detached || (flags & JOIN_DETACHED))
+8010749e:	8b 45 14             	mov    0x14(%ebp),%eax
+    for(p = curproc->children; p && k < n; p = next){
+801074a1:	83 c4 10             	add    $0x10,%esp
+801074a4:	85 f6                	test   %esi,%esi
+801074a6:	0f 9f 45 d7          	setg   -0x29(%ebp)
+      if(p->mm != curproc->mm || p->detached || (flags & JOIN_DETACHED))
+801074aa:	83 e0 02             	and    $0x2,%eax
+801074ad:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(p = curproc->children; p && k < n; p = next){
+801074b0:	8b 5f 14             	mov    0x14(%edi),%ebx
+801074b3:	85 db                	test   %ebx,%ebx
+801074b5:	0f 84 a5 01 00 00    	je     80107660 <join_any+0x1f0>
+801074bb:	80 7d d7 00          	cmpb   $0x0,-0x29(%ebp)
+801074bf:	0f 84 9b 01 00 00    	je     80107660 <join_any+0x1f0>
+    havethreads = 0;
+801074c5:	31 c9                	xor    %ecx,%ecx
+801074c7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    k = 0;
+801074ca:	31 f6                	xor    %esi,%esi
+    havethreads = 0;
+801074cc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+801074cf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+801074d2:	eb 10                	jmp    801074e4 <join_any+0x74>
+801074d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    for(p = curproc->children; p && k < n; p = next){
+801074d8:	85 db                	test   %ebx,%ebx
+801074da:	74 64                	je     80107540 <join_any+0xd0>
+801074dc:	39 ce                	cmp    %ecx,%esi
+801074de:	0f 8d bc 01 00 00    	jge    801076a0 <join_any+0x230>
+      if(p->mm != curproc->mm || p->detached || (flags & JOIN_DETACHED))
+801074e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801074e7:	89 d8                	mov    %ebx,%eax
+      next = p->sibling;
+801074e9:	8b 5b 18             	mov    0x18(%ebx),%ebx
+      if(p->mm != curproc->mm || p->detached || (flags & JOIN_DETACHED))
+801074ec:	8b 17                	mov    (%edi),%edx
+801074ee:	39 10                	cmp    %edx,(%eax)
+801074f0:	75 e6                	jne    801074d8 <join_any+0x68>
+801074f2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801074f5:	0b 90 60 01 00 00    	or     0x160(%eax),%edx
+801074fb:	75 db                	jne    801074d8 <join_any+0x68>
+        continue;
+      havethreads = 1;
+      if(p->state == ZOMBIE){
+801074fd:	83 78 08 05          	cmpl   $0x5,0x8(%eax)
+      havethreads = 1;
+80107501:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+      if(p->state == ZOMBIE){
+80107508:	75 ce                	jne    801074d8 <join_any+0x68>
+        pids[k] = p->pid;
+8010750a:	8b 50 0c             	mov    0xc(%eax),%edx
+8010750d:	89 4d 10             	mov    %ecx,0x10(%ebp)
+80107510:	8d 3c b5 00 00 00 00 	lea    0x0(,%esi,4),%edi
+80107517:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010751a:	89 14 b1             	mov    %edx,(%ecx,%esi,4)
+        stacks[k++] = p->threadstack;
+8010751d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107520:	83 c6 01             	add    $0x1,%esi
+80107523:	8b 90 5c 01 00 00    	mov    0x15c(%eax),%edx
+80107529:	89 14 39             	mov    %edx,(%ecx,%edi,1)
+        freeproc(p);
+8010752c:	e8 7f ca ff ff       	call   80103fb0 <freeproc>
+80107531:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    for(p = curproc->children; p && k < n; p = next){
+80107534:	85 db                	test   %ebx,%ebx
+80107536:	75 a4                	jne    801074dc <join_any+0x6c>
+80107538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010753f:	90                   	nop
+      }
+    }
+    // Popping dead stacks takes the address space's sleeplock.
+    // Rescan if that found none, since a thread may have exited
+    // while ptable.lock was let go.
+    if(k < n && curproc->mm->deadstacks){
+80107540:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+80107543:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80107546:	3b 75 10             	cmp    0x10(%ebp),%esi
+80107549:	0f 8d 57 01 00 00    	jge    801076a6 <join_any+0x236>
+8010754f:	8b 07                	mov    (%edi),%eax
+80107551:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+80107557:	85 d2                	test   %edx,%edx
+80107559:	0f 84 47 01 00 00    	je     801076a6 <join_any+0x236>
+      release(&ptable.lock);
+8010755f:	83 ec 0c             	sub    $0xc,%esp
+80107562:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80107565:	68 60 6e 11 80       	push   $0x80116e60
+8010756a:	e8 01 09 00 00       	call   80107e70 <release>
+8010756f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80107572:	83 c4 10             	add    $0x10,%esp
+80107575:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107578:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+8010757b:	89 7d d8             	mov    %edi,-0x28(%ebp)
+8010757e:	8d 04 b0             	lea    (%eax,%esi,4),%eax
+80107581:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80107584:	eb 5b                	jmp    801075e1 <join_any+0x171>
+80107586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010758d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uint*)uva2ka(mm->pgdir, (char*)va);
+80107590:	83 ec 08             	sub    $0x8,%esp
+80107593:	53                   	push   %ebx
+80107594:	ff 77 74             	push   0x74(%edi)
+80107597:	e8 14 40 00 00       	call   8010b5b0 <uva2ka>
+  if((link = deadlink(mm, stack)) != 0)
+8010759c:	83 c4 10             	add    $0x10,%esp
+8010759f:	85 c0                	test   %eax,%eax
+801075a1:	74 68                	je     8010760b <join_any+0x19b>
+    mm->deadstacks = *link;
+801075a3:	8b 00                	mov    (%eax),%eax
+  releasesleep(&mm->vmlock);
+801075a5:	83 ec 0c             	sub    $0xc,%esp
+    mm->deadstacks = *link;
+801075a8:	89 87 80 00 00 00    	mov    %eax,0x80(%edi)
+  releasesleep(&mm->vmlock);
+801075ae:	ff 75 e4             	push   -0x1c(%ebp)
+801075b1:	e8 aa 06 00 00       	call   80107c60 <releasesleep>
+      while(k < n && (stacks[k] = popdead(curproc->mm)) != 0)
+801075b6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801075b9:	83 c4 10             	add    $0x10,%esp
+801075bc:	89 18                	mov    %ebx,(%eax)
+801075be:	85 db                	test   %ebx,%ebx
+801075c0:	0f 84 4d 01 00 00    	je     80107713 <join_any+0x2a3>
+        pids[k++] = 0;
+801075c6:	8b 45 08             	mov    0x8(%ebp),%eax
+801075c9:	83 c6 01             	add    $0x1,%esi
+      while(k < n && (stacks[k] = popdead(curproc->mm)) != 0)
+801075cc:	83 45 dc 04          	addl   $0x4,-0x24(%ebp)
+        pids[k++] = 0;
+801075d0:	c7 44 b0 fc 00 00 00 	movl   $0x0,-0x4(%eax,%esi,4)
+801075d7:	00 
+      while(k < n && (stacks[k] = popdead(curproc->mm)) != 0)
+801075d8:	39 75 10             	cmp    %esi,0x10(%ebp)
+801075db:	0f 84 32 01 00 00    	je     80107713 <join_any+0x2a3>
+801075e1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  acquiresleep(&mm->vmlock);
+801075e4:	83 ec 0c             	sub    $0xc,%esp
+      while(k < n && (stacks[k] = popdead(curproc->mm)) != 0)
+801075e7:	8b 38                	mov    (%eax),%edi
+  acquiresleep(&mm->vmlock);
+801075e9:	8d 47 34             	lea    0x34(%edi),%eax
+801075ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801075ef:	50                   	push   %eax
+801075f0:	e8 0b 06 00 00       	call   80107c00 <acquiresleep>
+  stack = mm->deadstacks;
+801075f5:	8b 9f 80 00 00 00    	mov    0x80(%edi),%ebx
+  if(va % PGSIZE != 0 || va >= mm->sz)
+801075fb:	83 c4 10             	add    $0x10,%esp
+801075fe:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+80107604:	75 05                	jne    8010760b <join_any+0x19b>
+80107606:	3b 5f 78             	cmp    0x78(%edi),%ebx
+80107609:	72 85                	jb     80107590 <join_any+0x120>
+    stack = mm->deadstacks = 0;
+8010760b:	89 fb                	mov    %edi,%ebx
+  releasesleep(&mm->vmlock);
+8010760d:	83 ec 0c             	sub    $0xc,%esp
+    stack = mm->deadstacks = 0;
+80107610:	8b 7d d8             	mov    -0x28(%ebp),%edi
+80107613:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+8010761a:	00 00 00 
+  releasesleep(&mm->vmlock);
+8010761d:	ff 75 e4             	push   -0x1c(%ebp)
+80107620:	e8 3b 06 00 00       	call   80107c60 <releasesleep>
+      while(k < n && (stacks[k] = popdead(curproc->mm)) != 0)
+80107625:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80107628:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+8010762b:	83 c4 10             	add    $0x10,%esp
+8010762e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+      acquire(&ptable.lock);
+80107634:	83 ec 0c             	sub    $0xc,%esp
+80107637:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010763a:	68 60 6e 11 80       	push   $0x80116e60
+8010763f:	e8 8c 08 00 00       	call   80107ed0 <acquire>
+      if(k == 0)
+80107644:	83 c4 10             	add    $0x10,%esp
+80107647:	85 f6                	test   %esi,%esi
+80107649:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010764c:	75 58                	jne    801076a6 <join_any+0x236>
+    for(p = curproc->children; p && k < n; p = next){
+8010764e:	8b 5f 14             	mov    0x14(%edi),%ebx
+80107651:	85 db                	test   %ebx,%ebx
+80107653:	0f 85 62 fe ff ff    	jne    801074bb <join_any+0x4b>
+80107659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(k < n && curproc->mm->deadstacks){
+80107660:	8b 5d 10             	mov    0x10(%ebp),%ebx
+80107663:	85 db                	test   %ebx,%ebx
+80107665:	7e 10                	jle    80107677 <join_any+0x207>
+80107667:	8b 07                	mov    (%edi),%eax
+80107669:	8b 88 80 00 00 00    	mov    0x80(%eax),%ecx
+8010766f:	85 c9                	test   %ecx,%ecx
+80107671:	0f 85 a7 00 00 00    	jne    8010771e <join_any+0x2ae>
+        continue;
+    }
+
+    if(k > 0 || (flags & JOIN_NOHANG)){
+80107677:	31 f6                	xor    %esi,%esi
+80107679:	f6 45 14 01          	testb  $0x1,0x14(%ebp)
+8010767d:	74 75                	je     801076f4 <join_any+0x284>
+      release(&ptable.lock);
+8010767f:	83 ec 0c             	sub    $0xc,%esp
+80107682:	68 60 6e 11 80       	push   $0x80116e60
+80107687:	e8 e4 07 00 00       	call   80107e70 <release>
+      return k;
+8010768c:	83 c4 10             	add    $0x10,%esp
+      release(&ptable.lock);
+      return -1;
+    }
+    sleep(curproc, &ptable.lock);
+  }
+}
+8010768f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107692:	89 f0                	mov    %esi,%eax
+80107694:	5b                   	pop    %ebx
+80107695:	5e                   	pop    %esi
+80107696:	5f                   	pop    %edi
+80107697:	5d                   	pop    %ebp
+80107698:	c3                   	ret
+80107699:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801076a0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+801076a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    if(k > 0 || (flags & JOIN_NOHANG)){
+801076a6:	85 f6                	test   %esi,%esi
+801076a8:	7f d5                	jg     8010767f <join_any+0x20f>
+801076aa:	f6 45 14 01          	testb  $0x1,0x14(%ebp)
+801076ae:	75 cf                	jne    8010767f <join_any+0x20f>
+    if(!havethreads || curproc->killed){
+801076b0:	85 c9                	test   %ecx,%ecx
+801076b2:	74 40                	je     801076f4 <join_any+0x284>
+801076b4:	8b 47 3c             	mov    0x3c(%edi),%eax
+801076b7:	85 c0                	test   %eax,%eax
+801076b9:	75 39                	jne    801076f4 <join_any+0x284>
+  pushcli();
+801076bb:	e8 c0 06 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+801076c0:	e8 8b d7 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+801076c5:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801076cb:	e8 00 07 00 00       	call   80107dd0 <popcli>
+  if(p == 0)
+801076d0:	85 db                	test   %ebx,%ebx
+801076d2:	74 63                	je     80107737 <join_any+0x2c7>
+  p->chan = chan;
+801076d4:	89 7b 2c             	mov    %edi,0x2c(%ebx)
+  setstate(p, SLEEPING);
+801076d7:	ba 02 00 00 00       	mov    $0x2,%edx
+801076dc:	89 d8                	mov    %ebx,%eax
+801076de:	e8 2d e0 ff ff       	call   80105710 <setstate>
+  sched();
+801076e3:	e8 b8 eb ff ff       	call   801062a0 <sched>
+  p->chan = 0;
+801076e8:	c7 43 2c 00 00 00 00 	movl   $0x0,0x2c(%ebx)
+}
+801076ef:	e9 bc fd ff ff       	jmp    801074b0 <join_any+0x40>
+      release(&ptable.lock);
+801076f4:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+801076f7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+      release(&ptable.lock);
+801076fc:	68 60 6e 11 80       	push   $0x80116e60
+80107701:	e8 6a 07 00 00       	call   80107e70 <release>
+      return -1;
+80107706:	83 c4 10             	add    $0x10,%esp
+}
+80107709:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010770c:	89 f0                	mov    %esi,%eax
+8010770e:	5b                   	pop    %ebx
+8010770f:	5e                   	pop    %esi
+80107710:	5f                   	pop    %edi
+80107711:	5d                   	pop    %ebp
+80107712:	c3                   	ret
+80107713:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+80107716:	8b 7d d8             	mov    -0x28(%ebp),%edi
+80107719:	e9 16 ff ff ff       	jmp    80107634 <join_any+0x1c4>
+      release(&ptable.lock);
+8010771e:	83 ec 0c             	sub    $0xc,%esp
+    k = 0;
+80107721:	31 f6                	xor    %esi,%esi
+      release(&ptable.lock);
+80107723:	68 60 6e 11 80       	push   $0x80116e60
+80107728:	e8 43 07 00 00       	call   80107e70 <release>
+8010772d:	83 c4 10             	add    $0x10,%esp
+    havethreads = 0;
+80107730:	31 c9                	xor    %ecx,%ecx
+80107732:	e9 3e fe ff ff       	jmp    80107575 <join_any+0x105>
+    panic("sleep");
+80107737:	83 ec 0c             	sub    $0xc,%esp
+8010773a:	68 19 c0 10 80       	push   $0x8010c019
+8010773f:	e8 3c 8c ff ff       	call   80100380 <panic>
+80107744:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010774b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010774f:	90                   	nop
+
+80107750 <futex_wait>:
+// holds val; otherwise return -1 at once.  Checking and going
+// to sleep under ptable.lock means a waker that changes the
+// int and then calls futex_wake() cannot be missed.
+int
+futex_wait(uint uaddr, int val)
+{
+80107750:	55                   	push   %ebp
+80107751:	89 e5                	mov    %esp,%ebp
+80107753:	56                   	push   %esi
+80107754:	53                   	push   %ebx
+80107755:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(uaddr % sizeof(int) != 0)
+80107758:	f7 c6 03 00 00 00    	test   $0x3,%esi
+8010775e:	0f 85 bc 00 00 00    	jne    80107820 <futex_wait+0xd0>
+  pushcli();
+80107764:	e8 17 06 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80107769:	e8 e2 d6 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+8010776e:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80107774:	e8 57 06 00 00       	call   80107dd0 <popcli>
+  if((page = uva2ka(myproc()->mm->pgdir, (char*)PGROUNDDOWN(uaddr))) == 0)
+80107779:	89 f0                	mov    %esi,%eax
+8010777b:	83 ec 08             	sub    $0x8,%esp
+8010777e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80107783:	50                   	push   %eax
+80107784:	8b 03                	mov    (%ebx),%eax
+80107786:	ff 70 74             	push   0x74(%eax)
+80107789:	e8 22 3e 00 00       	call   8010b5b0 <uva2ka>
+8010778e:	83 c4 10             	add    $0x10,%esp
+80107791:	85 c0                	test   %eax,%eax
+80107793:	0f 84 87 00 00 00    	je     80107820 <futex_wait+0xd0>
+  int *key;
+
+  if((key = futexkey(uaddr)) == 0)
+    return -1;
+  acquire(&ptable.lock);
+80107799:	83 ec 0c             	sub    $0xc,%esp
+  return (int*)(page + uaddr % PGSIZE);
+8010779c:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  acquire(&ptable.lock);
+801077a2:	68 60 6e 11 80       	push   $0x80116e60
+  return (int*)(page + uaddr % PGSIZE);
+801077a7:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+  acquire(&ptable.lock);
+801077aa:	e8 21 07 00 00       	call   80107ed0 <acquire>
+  if(*(volatile int*)key != val){
+801077af:	8b 03                	mov    (%ebx),%eax
+801077b1:	83 c4 10             	add    $0x10,%esp
+801077b4:	3b 45 0c             	cmp    0xc(%ebp),%eax
+801077b7:	75 57                	jne    80107810 <futex_wait+0xc0>
+  pushcli();
+801077b9:	e8 c2 05 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+801077be:	e8 8d d6 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+801077c3:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+801077c9:	e8 02 06 00 00       	call   80107dd0 <popcli>
+  if(p == 0)
+801077ce:	85 f6                	test   %esi,%esi
+801077d0:	74 55                	je     80107827 <futex_wait+0xd7>
+  p->chan = chan;
+801077d2:	89 5e 2c             	mov    %ebx,0x2c(%esi)
+  setstate(p, SLEEPING);
+801077d5:	89 f0                	mov    %esi,%eax
+801077d7:	ba 02 00 00 00       	mov    $0x2,%edx
+801077dc:	e8 2f df ff ff       	call   80105710 <setstate>
+  sched();
+801077e1:	e8 ba ea ff ff       	call   801062a0 <sched>
+    release(&ptable.lock);
+    return -1;
+  }
+  sleep(key, &ptable.lock);
+  release(&ptable.lock);
+801077e6:	83 ec 0c             	sub    $0xc,%esp
+  p->chan = 0;
+801077e9:	c7 46 2c 00 00 00 00 	movl   $0x0,0x2c(%esi)
+  release(&ptable.lock);
+801077f0:	68 60 6e 11 80       	push   $0x80116e60
+801077f5:	e8 76 06 00 00       	call   80107e70 <release>
+  return 0;
+801077fa:	83 c4 10             	add    $0x10,%esp
+801077fd:	31 c0                	xor    %eax,%eax
+}
+801077ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107802:	5b                   	pop    %ebx
+80107803:	5e                   	pop    %esi
+80107804:	5d                   	pop    %ebp
+80107805:	c3                   	ret
+80107806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010780d:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&ptable.lock);
+80107810:	83 ec 0c             	sub    $0xc,%esp
+80107813:	68 60 6e 11 80       	push   $0x80116e60
+80107818:	e8 53 06 00 00       	call   80107e70 <release>
+    return -1;
+8010781d:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80107820:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107825:	eb d8                	jmp    801077ff <futex_wait+0xaf>
+    panic("sleep");
+80107827:	83 ec 0c             	sub    $0xc,%esp
+8010782a:	68 19 c0 10 80       	push   $0x8010c019
+8010782f:	e8 4c 8b ff ff       	call   80100380 <panic>
+80107834:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010783b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010783f:	90                   	nop
+
+80107840 <futex_wake>:
+
+// Wake up to n processes waiting in futex_wait(uaddr),
+// and return how many woke.
+int
+futex_wake(uint uaddr, int n)
+{
+80107840:	55                   	push   %ebp
+80107841:	89 e5                	mov    %esp,%ebp
+80107843:	56                   	push   %esi
+80107844:	53                   	push   %ebx
+80107845:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(uaddr % sizeof(int) != 0)
+80107848:	f6 c3 03             	test   $0x3,%bl
+8010784b:	75 73                	jne    801078c0 <futex_wake+0x80>
+  pushcli();
+8010784d:	e8 2e 05 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80107852:	e8 f9 d5 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80107857:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+8010785d:	e8 6e 05 00 00       	call   80107dd0 <popcli>
+  if((page = uva2ka(myproc()->mm->pgdir, (char*)PGROUNDDOWN(uaddr))) == 0)
+80107862:	89 d8                	mov    %ebx,%eax
+80107864:	83 ec 08             	sub    $0x8,%esp
+80107867:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010786c:	50                   	push   %eax
+8010786d:	8b 06                	mov    (%esi),%eax
+8010786f:	ff 70 74             	push   0x74(%eax)
+80107872:	e8 39 3d 00 00       	call   8010b5b0 <uva2ka>
+80107877:	83 c4 10             	add    $0x10,%esp
+8010787a:	85 c0                	test   %eax,%eax
+8010787c:	74 42                	je     801078c0 <futex_wake+0x80>
+  int *key;
+
+  if((key = futexkey(uaddr)) == 0)
+    return -1;
+  acquire(&ptable.lock);
+8010787e:	83 ec 0c             	sub    $0xc,%esp
+  return (int*)(page + uaddr % PGSIZE);
+80107881:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  acquire(&ptable.lock);
+80107887:	68 60 6e 11 80       	push   $0x80116e60
+  return (int*)(page + uaddr % PGSIZE);
+8010788c:	01 c3                	add    %eax,%ebx
+  acquire(&ptable.lock);
+8010788e:	e8 3d 06 00 00       	call   80107ed0 <acquire>
+  n = wakeupn(key, n);
+80107893:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107896:	89 d8                	mov    %ebx,%eax
+80107898:	e8 f3 e0 ff ff       	call   80105990 <wakeupn>
+  release(&ptable.lock);
+8010789d:	c7 04 24 60 6e 11 80 	movl   $0x80116e60,(%esp)
+  n = wakeupn(key, n);
+801078a4:	89 c3                	mov    %eax,%ebx
+  release(&ptable.lock);
+801078a6:	e8 c5 05 00 00       	call   80107e70 <release>
+  return n;
+801078ab:	83 c4 10             	add    $0x10,%esp
+}
+801078ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801078b1:	89 d8                	mov    %ebx,%eax
+801078b3:	5b                   	pop    %ebx
+801078b4:	5e                   	pop    %esi
+801078b5:	5d                   	pop    %ebp
+801078b6:	c3                   	ret
+801078b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801078be:	66 90                	xchg   %ax,%ax
+801078c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+801078c3:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+801078c8:	89 d8                	mov    %ebx,%eax
+801078ca:	5b                   	pop    %ebx
+801078cb:	5e                   	pop    %esi
+801078cc:	5d                   	pop    %ebp
+801078cd:	c3                   	ret
+801078ce:	66 90                	xchg   %ax,%ax
+
+801078d0 <ticket_sleep>:
+// Sleep until it is ticket's turn for lk, lending our tickets
+// to its holder in the meantime.  The turn is checked again
+// under ptable.lock, which release_t() holds to wake us, so
+// a release just before we sleep is not missed.
+void ticket_sleep(struct ticketlock *lk, int ticket)
+{
+801078d0:	55                   	push   %ebp
+801078d1:	89 e5                	mov    %esp,%ebp
+801078d3:	57                   	push   %edi
+801078d4:	56                   	push   %esi
+801078d5:	53                   	push   %ebx
+801078d6:	83 ec 0c             	sub    $0xc,%esp
+801078d9:	8b 75 08             	mov    0x8(%ebp),%esi
+801078dc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  pushcli();
+801078df:	e8 9c 04 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+801078e4:	e8 67 d5 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+801078e9:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801078ef:	e8 dc 04 00 00       	call   80107dd0 <popcli>
+	struct proc *p = myproc();
+	struct proc *holder;
+
+	if (p == 0)
+801078f4:	85 db                	test   %ebx,%ebx
+801078f6:	0f 84 84 00 00 00    	je     80107980 <ticket_sleep+0xb0>
+		panic("sleep");
+
+	acquire(&ptable.lock);
+801078fc:	83 ec 0c             	sub    $0xc,%esp
+801078ff:	68 60 6e 11 80       	push   $0x80116e60
+80107904:	e8 c7 05 00 00       	call   80107ed0 <acquire>
+	
+	if(lk->current_turn == ticket){
+80107909:	83 c4 10             	add    $0x10,%esp
+8010790c:	39 7e 04             	cmp    %edi,0x4(%esi)
+8010790f:	74 5c                	je     8010796d <ticket_sleep+0x9d>
+		release(&ptable.lock);
+		return;
+	}
+	if((holder = findproc(lk->pid)) != 0 && holder != p)
+80107911:	8b 46 08             	mov    0x8(%esi),%eax
+  for(p = ptable.pidhash[pid % NPIDHASH]; p; p = p->hnext)
+80107914:	89 c1                	mov    %eax,%ecx
+80107916:	c1 f9 1f             	sar    $0x1f,%ecx
+80107919:	c1 e9 16             	shr    $0x16,%ecx
+8010791c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+8010791f:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+80107925:	29 ca                	sub    %ecx,%edx
+80107927:	8b 14 95 9c 7e 11 80 	mov    -0x7fee8164(,%edx,4),%edx
+8010792e:	85 d2                	test   %edx,%edx
+80107930:	75 0d                	jne    8010793f <ticket_sleep+0x6f>
+80107932:	eb 1b                	jmp    8010794f <ticket_sleep+0x7f>
+80107934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107938:	8b 52 1c             	mov    0x1c(%edx),%edx
+8010793b:	85 d2                	test   %edx,%edx
+8010793d:	74 10                	je     8010794f <ticket_sleep+0x7f>
+    if(p->pid == pid)
+8010793f:	3b 42 0c             	cmp    0xc(%edx),%eax
+80107942:	75 f4                	jne    80107938 <ticket_sleep+0x68>
+	if((holder = findproc(lk->pid)) != 0 && holder != p)
+80107944:	39 d3                	cmp    %edx,%ebx
+80107946:	74 07                	je     8010794f <ticket_sleep+0x7f>
+		lend(p, holder);
+80107948:	89 d8                	mov    %ebx,%eax
+8010794a:	e8 81 d2 ff ff       	call   80104bd0 <lend>
+	p->chan = lk;
+8010794f:	89 73 2c             	mov    %esi,0x2c(%ebx)
+	p->lockticket = ticket;
+	setstate(p, SLEEPING);
+80107952:	ba 02 00 00 00       	mov    $0x2,%edx
+80107957:	89 d8                	mov    %ebx,%eax
+	p->lockticket = ticket;
+80107959:	89 7b 30             	mov    %edi,0x30(%ebx)
+	setstate(p, SLEEPING);
+8010795c:	e8 af dd ff ff       	call   80105710 <setstate>
+	sched();
+80107961:	e8 3a e9 ff ff       	call   801062a0 <sched>
+	p->chan = 0;
+80107966:	c7 43 2c 00 00 00 00 	movl   $0x0,0x2c(%ebx)
+	
+	release(&ptable.lock);
+8010796d:	c7 45 08 60 6e 11 80 	movl   $0x80116e60,0x8(%ebp)
+}
+80107974:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107977:	5b                   	pop    %ebx
+80107978:	5e                   	pop    %esi
+80107979:	5f                   	pop    %edi
+8010797a:	5d                   	pop    %ebp
+	release(&ptable.lock);
+8010797b:	e9 f0 04 00 00       	jmp    80107e70 <release>
+		panic("sleep");
+80107980:	83 ec 0c             	sub    $0xc,%esp
+80107983:	68 19 c0 10 80       	push   $0x8010c019
+80107988:	e8 f3 89 ff ff       	call   80100380 <panic>
+8010798d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107990 <initlock_t>:
+	}
+	return 0;
+}
+
+void initlock_t(struct ticketlock *lk)
+{
+80107990:	55                   	push   %ebp
+80107991:	89 e5                	mov    %esp,%ebp
+80107993:	8b 45 08             	mov    0x8(%ebp),%eax
+    lk->next_ticket = 0;
+80107996:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    lk->current_turn = 0;
+8010799c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+    lk->pid = 0;
+801079a3:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+801079aa:	5d                   	pop    %ebp
+801079ab:	c3                   	ret
+801079ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801079b0 <acquire_t>:
+// The next in line spins for up to LOCKSPIN reads while the
+// holder is running on another CPU, since it is likely to let
+// go sooner than a sleep and wakeup would take; everyone else
+// sleeps until their turn.
+void acquire_t(struct ticketlock *lk)
+{
+801079b0:	55                   	push   %ebp
+801079b1:	89 e5                	mov    %esp,%ebp
+801079b3:	57                   	push   %edi
+801079b4:	56                   	push   %esi
+801079b5:	53                   	push   %ebx
+801079b6:	83 ec 2c             	sub    $0x2c,%esp
+801079b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  asm volatile("cli");
+801079bc:	fa                   	cli
+  asm volatile("lock; xaddl %0, %1"
+801079bd:	b8 01 00 00 00       	mov    $0x1,%eax
+801079c2:	f0 0f c1 07          	lock xadd %eax,(%edi)
+    cli(); //clear inturrupt flag (IF) Disable inturrupts
+    int myTicket = fetch_and_add(&lk->next_ticket, 1);
+    int spins = 0;
+    
+    while (lk->current_turn != myTicket){
+801079c6:	8b 4f 04             	mov    0x4(%edi),%ecx
+801079c9:	39 c8                	cmp    %ecx,%eax
+801079cb:	0f 84 c1 00 00 00    	je     80107a92 <acquire_t+0xe2>
+801079d1:	31 d2                	xor    %edx,%edx
+801079d3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+801079d6:	89 c2                	mov    %eax,%edx
+801079d8:	89 f8                	mov    %edi,%eax
+801079da:	89 d7                	mov    %edx,%edi
+801079dc:	eb 20                	jmp    801079fe <acquire_t+0x4e>
+801079de:	66 90                	xchg   %ax,%ax
+        if(spins == 0 && myTicket - lk->current_turn == 1 && holderrunning(lk)){
+            while(spins++ < LOCKSPIN && *(volatile int*)&lk->current_turn != myTicket)
+                ;
+        } else
+            ticket_sleep(lk, myTicket); // to prevent busy waiting.
+801079e0:	83 ec 08             	sub    $0x8,%esp
+801079e3:	57                   	push   %edi
+801079e4:	50                   	push   %eax
+801079e5:	89 45 08             	mov    %eax,0x8(%ebp)
+801079e8:	e8 e3 fe ff ff       	call   801078d0 <ticket_sleep>
+801079ed:	8b 45 08             	mov    0x8(%ebp),%eax
+801079f0:	83 c4 10             	add    $0x10,%esp
+    while (lk->current_turn != myTicket){
+801079f3:	8b 48 04             	mov    0x4(%eax),%ecx
+801079f6:	39 f9                	cmp    %edi,%ecx
+801079f8:	0f 84 92 00 00 00    	je     80107a90 <acquire_t+0xe0>
+        if(spins == 0 && myTicket - lk->current_turn == 1 && holderrunning(lk)){
+801079fe:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+80107a01:	85 db                	test   %ebx,%ebx
+80107a03:	75 db                	jne    801079e0 <acquire_t+0x30>
+80107a05:	89 fb                	mov    %edi,%ebx
+80107a07:	29 cb                	sub    %ecx,%ebx
+80107a09:	83 fb 01             	cmp    $0x1,%ebx
+80107a0c:	75 d2                	jne    801079e0 <acquire_t+0x30>
+	for(i = 0; i < ncpu; i++){
+80107a0e:	8b 15 c4 67 11 80    	mov    0x801167c4,%edx
+80107a14:	8b 48 08             	mov    0x8(%eax),%ecx
+80107a17:	85 d2                	test   %edx,%edx
+80107a19:	7e c5                	jle    801079e0 <acquire_t+0x30>
+80107a1b:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+		if(pid && q && q != myproc() && q->pid == pid)
+80107a1e:	85 c9                	test   %ecx,%ecx
+80107a20:	bb 8c 68 11 80       	mov    $0x8011688c,%ebx
+	for(i = 0; i < ncpu; i++){
+80107a25:	89 45 08             	mov    %eax,0x8(%ebp)
+80107a28:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+		if(pid && q && q != myproc() && q->pid == pid)
+80107a2b:	0f 95 45 e7          	setne  -0x19(%ebp)
+	for(i = 0; i < ncpu; i++){
+80107a2f:	31 f6                	xor    %esi,%esi
+80107a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+		q = cpus[i].proc;
+80107a38:	8b 3b                	mov    (%ebx),%edi
+		if(pid && q && q != myproc() && q->pid == pid)
+80107a3a:	85 ff                	test   %edi,%edi
+80107a3c:	74 2d                	je     80107a6b <acquire_t+0xbb>
+80107a3e:	80 7d e7 00          	cmpb   $0x0,-0x19(%ebp)
+80107a42:	74 27                	je     80107a6b <acquire_t+0xbb>
+  pushcli();
+80107a44:	e8 37 03 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80107a49:	e8 02 d4 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80107a4e:	8b 80 ac 00 00 00    	mov    0xac(%eax),%eax
+80107a54:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  popcli();
+80107a57:	e8 74 03 00 00       	call   80107dd0 <popcli>
+		if(pid && q && q != myproc() && q->pid == pid)
+80107a5c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80107a5f:	39 c7                	cmp    %eax,%edi
+80107a61:	74 08                	je     80107a6b <acquire_t+0xbb>
+80107a63:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80107a66:	3b 47 0c             	cmp    0xc(%edi),%eax
+80107a69:	74 4d                	je     80107ab8 <acquire_t+0x108>
+	for(i = 0; i < ncpu; i++){
+80107a6b:	83 c6 01             	add    $0x1,%esi
+80107a6e:	81 c3 d0 00 00 00    	add    $0xd0,%ebx
+80107a74:	3b 35 c4 67 11 80    	cmp    0x801167c4,%esi
+80107a7a:	7c bc                	jl     80107a38 <acquire_t+0x88>
+80107a7c:	8b 45 08             	mov    0x8(%ebp),%eax
+80107a7f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+80107a82:	e9 59 ff ff ff       	jmp    801079e0 <acquire_t+0x30>
+80107a87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107a8e:	66 90                	xchg   %ax,%ax
+80107a90:	89 c7                	mov    %eax,%edi
+  pushcli();
+80107a92:	e8 e9 02 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80107a97:	e8 b4 d3 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80107a9c:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80107aa2:	e8 29 03 00 00       	call   80107dd0 <popcli>
+    }
+    lk->pid = myproc()->pid;
+80107aa7:	8b 43 0c             	mov    0xc(%ebx),%eax
+80107aaa:	89 47 08             	mov    %eax,0x8(%edi)
+}
+80107aad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107ab0:	5b                   	pop    %ebx
+80107ab1:	5e                   	pop    %esi
+80107ab2:	5f                   	pop    %edi
+80107ab3:	5d                   	pop    %ebp
+80107ab4:	c3                   	ret
+80107ab5:	8d 76 00             	lea    0x0(%esi),%esi
+80107ab8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80107abb:	8b 45 08             	mov    0x8(%ebp),%eax
+80107abe:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+80107ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+            while(spins++ < LOCKSPIN && *(volatile int*)&lk->current_turn != myTicket)
+80107ac8:	83 c2 01             	add    $0x1,%edx
+80107acb:	81 fa 11 27 00 00    	cmp    $0x2711,%edx
+80107ad1:	74 07                	je     80107ada <acquire_t+0x12a>
+80107ad3:	8b 48 04             	mov    0x4(%eax),%ecx
+80107ad6:	39 f9                	cmp    %edi,%ecx
+80107ad8:	75 ee                	jne    80107ac8 <acquire_t+0x118>
+80107ada:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80107add:	e9 11 ff ff ff       	jmp    801079f3 <acquire_t+0x43>
+80107ae2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107ae9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107af0 <release_t>:
+// Only the process holding the next ticket can go on,
+// so wake just that one, if it is asleep.  lk is a user
+// address, so another address space may have a lock of
+// its own there; only sleepers sharing ours are ours.
+void release_t(struct ticketlock *lk)
+{
+80107af0:	55                   	push   %ebp
+80107af1:	b8 01 00 00 00       	mov    $0x1,%eax
+80107af6:	89 e5                	mov    %esp,%ebp
+80107af8:	57                   	push   %edi
+80107af9:	56                   	push   %esi
+80107afa:	53                   	push   %ebx
+80107afb:	83 ec 1c             	sub    $0x1c,%esp
+80107afe:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *p;
+  int turn;
+
+  lk->pid = 0;
+80107b01:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+80107b08:	f0 0f c1 46 04       	lock xadd %eax,0x4(%esi)
+  turn = fetch_and_add(&lk->current_turn, 1) + 1;
+80107b0d:	8d 78 01             	lea    0x1(%eax),%edi
+  if(lk->next_ticket != turn){
+80107b10:	39 3e                	cmp    %edi,(%esi)
+80107b12:	75 0c                	jne    80107b20 <release_t+0x30>
+  asm volatile("sti");
+80107b14:	fb                   	sti
+        break;
+      }
+    release(&ptable.lock);
+  }
+  sti(); //set inturrupt flag (IF) Enable inturrupts
+}
+80107b15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107b18:	5b                   	pop    %ebx
+80107b19:	5e                   	pop    %esi
+80107b1a:	5f                   	pop    %edi
+80107b1b:	5d                   	pop    %ebp
+80107b1c:	c3                   	ret
+80107b1d:	8d 76 00             	lea    0x0(%esi),%esi
+    acquire(&ptable.lock);
+80107b20:	83 ec 0c             	sub    $0xc,%esp
+80107b23:	68 60 6e 11 80       	push   $0x80116e60
+80107b28:	e8 a3 03 00 00       	call   80107ed0 <acquire>
+  return &ptable.sleepq[(h ^ (h >> 12)) / sizeof(int) % NSLEEPQ];
+80107b2d:	89 f0                	mov    %esi,%eax
+    for(p = sleepq(lk)->head; p; p = p->cnext)
+80107b2f:	83 c4 10             	add    $0x10,%esp
+  return &ptable.sleepq[(h ^ (h >> 12)) / sizeof(int) % NSLEEPQ];
+80107b32:	c1 e8 0c             	shr    $0xc,%eax
+80107b35:	31 f0                	xor    %esi,%eax
+80107b37:	c1 e8 02             	shr    $0x2,%eax
+80107b3a:	0f b6 c0             	movzbl %al,%eax
+    for(p = sleepq(lk)->head; p; p = p->cnext)
+80107b3d:	8b 1c c5 9c 8e 11 80 	mov    -0x7fee7164(,%eax,8),%ebx
+80107b44:	85 db                	test   %ebx,%ebx
+80107b46:	75 0f                	jne    80107b57 <release_t+0x67>
+80107b48:	eb 4e                	jmp    80107b98 <release_t+0xa8>
+80107b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80107b50:	8b 5b 34             	mov    0x34(%ebx),%ebx
+80107b53:	85 db                	test   %ebx,%ebx
+80107b55:	74 41                	je     80107b98 <release_t+0xa8>
+      if(p->chan == lk && p->lockticket == turn && p->mm == myproc()->mm){
+80107b57:	39 73 2c             	cmp    %esi,0x2c(%ebx)
+80107b5a:	75 f4                	jne    80107b50 <release_t+0x60>
+80107b5c:	39 7b 30             	cmp    %edi,0x30(%ebx)
+80107b5f:	75 ef                	jne    80107b50 <release_t+0x60>
+80107b61:	8b 13                	mov    (%ebx),%edx
+80107b63:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  pushcli();
+80107b66:	e8 15 02 00 00       	call   80107d80 <pushcli>
+  c = mycpu();
+80107b6b:	e8 e0 d2 ff ff       	call   80104e50 <mycpu>
+  p = c->proc;
+80107b70:	8b 80 ac 00 00 00    	mov    0xac(%eax),%eax
+80107b76:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  popcli();
+80107b79:	e8 52 02 00 00       	call   80107dd0 <popcli>
+      if(p->chan == lk && p->lockticket == turn && p->mm == myproc()->mm){
+80107b7e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107b81:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80107b84:	3b 10                	cmp    (%eax),%edx
+80107b86:	75 c8                	jne    80107b50 <release_t+0x60>
+        setstate(p, RUNNABLE);
+80107b88:	ba 03 00 00 00       	mov    $0x3,%edx
+80107b8d:	89 d8                	mov    %ebx,%eax
+80107b8f:	e8 7c db ff ff       	call   80105710 <setstate>
+        break;
+80107b94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    release(&ptable.lock);
+80107b98:	83 ec 0c             	sub    $0xc,%esp
+80107b9b:	68 60 6e 11 80       	push   $0x80116e60
+80107ba0:	e8 cb 02 00 00       	call   80107e70 <release>
+80107ba5:	83 c4 10             	add    $0x10,%esp
+80107ba8:	e9 67 ff ff ff       	jmp    80107b14 <release_t+0x24>
+
+80107bad <claim.cold>:
+    p->pass += stride(p->weight);
+80107bad:	a1 60 00 00 00       	mov    0x60,%eax
+80107bb2:	0f 0b                	ud2
+80107bb4:	66 90                	xchg   %ax,%ax
+80107bb6:	66 90                	xchg   %ax,%ax
+80107bb8:	66 90                	xchg   %ax,%ax
+80107bba:	66 90                	xchg   %ax,%ax
+80107bbc:	66 90                	xchg   %ax,%ax
+80107bbe:	66 90                	xchg   %ax,%ax
+
+80107bc0 <initsleeplock>:
+#include "spinlock.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+80107bc0:	55                   	push   %ebp
+80107bc1:	89 e5                	mov    %esp,%ebp
+80107bc3:	53                   	push   %ebx
+80107bc4:	83 ec 0c             	sub    $0xc,%esp
+80107bc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+80107bca:	68 c4 c0 10 80       	push   $0x8010c0c4
+80107bcf:	8d 43 04             	lea    0x4(%ebx),%eax
+80107bd2:	50                   	push   %eax
+80107bd3:	e8 18 01 00 00       	call   80107cf0 <initlock>
+  lk->name = name;
+80107bd8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  lk->locked = 0;
+80107bdb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+}
+80107be1:	83 c4 10             	add    $0x10,%esp
+  lk->pid = 0;
+80107be4:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  lk->name = name;
+80107beb:	89 43 38             	mov    %eax,0x38(%ebx)
+}
+80107bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107bf1:	c9                   	leave
+80107bf2:	c3                   	ret
+80107bf3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107c00 <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+80107c00:	55                   	push   %ebp
+80107c01:	89 e5                	mov    %esp,%ebp
+80107c03:	56                   	push   %esi
+80107c04:	53                   	push   %ebx
+80107c05:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80107c08:	8d 73 04             	lea    0x4(%ebx),%esi
+80107c0b:	83 ec 0c             	sub    $0xc,%esp
+80107c0e:	56                   	push   %esi
+80107c0f:	e8 bc 02 00 00       	call   80107ed0 <acquire>
+  while (lk->locked) {
+80107c14:	8b 13                	mov    (%ebx),%edx
+80107c16:	83 c4 10             	add    $0x10,%esp
+80107c19:	85 d2                	test   %edx,%edx
+80107c1b:	74 16                	je     80107c33 <acquiresleep+0x33>
+80107c1d:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(lk, &lk->lk);
+80107c20:	83 ec 08             	sub    $0x8,%esp
+80107c23:	56                   	push   %esi
+80107c24:	53                   	push   %ebx
+80107c25:	e8 16 eb ff ff       	call   80106740 <sleep>
+  while (lk->locked) {
+80107c2a:	8b 03                	mov    (%ebx),%eax
+80107c2c:	83 c4 10             	add    $0x10,%esp
+80107c2f:	85 c0                	test   %eax,%eax
+80107c31:	75 ed                	jne    80107c20 <acquiresleep+0x20>
+  }
+  lk->locked = 1;
+80107c33:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = myproc()->pid;
+80107c39:	e8 c2 dd ff ff       	call   80105a00 <myproc>
+80107c3e:	8b 40 0c             	mov    0xc(%eax),%eax
+80107c41:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  release(&lk->lk);
+80107c44:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80107c47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107c4a:	5b                   	pop    %ebx
+80107c4b:	5e                   	pop    %esi
+80107c4c:	5d                   	pop    %ebp
+  release(&lk->lk);
+80107c4d:	e9 1e 02 00 00       	jmp    80107e70 <release>
+80107c52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107c59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107c60 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+80107c60:	55                   	push   %ebp
+80107c61:	89 e5                	mov    %esp,%ebp
+80107c63:	56                   	push   %esi
+80107c64:	53                   	push   %ebx
+80107c65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80107c68:	8d 73 04             	lea    0x4(%ebx),%esi
+80107c6b:	83 ec 0c             	sub    $0xc,%esp
+80107c6e:	56                   	push   %esi
+80107c6f:	e8 5c 02 00 00       	call   80107ed0 <acquire>
+  lk->locked = 0;
+80107c74:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+80107c7a:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  wakeone(lk);  // only one waiter can take the lock
+80107c81:	89 1c 24             	mov    %ebx,(%esp)
+80107c84:	e8 c7 eb ff ff       	call   80106850 <wakeone>
+  release(&lk->lk);
+80107c89:	89 75 08             	mov    %esi,0x8(%ebp)
+80107c8c:	83 c4 10             	add    $0x10,%esp
+}
+80107c8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107c92:	5b                   	pop    %ebx
+80107c93:	5e                   	pop    %esi
+80107c94:	5d                   	pop    %ebp
+  release(&lk->lk);
+80107c95:	e9 d6 01 00 00       	jmp    80107e70 <release>
+80107c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107ca0 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+80107ca0:	55                   	push   %ebp
+80107ca1:	89 e5                	mov    %esp,%ebp
+80107ca3:	57                   	push   %edi
+80107ca4:	31 ff                	xor    %edi,%edi
+80107ca6:	56                   	push   %esi
+80107ca7:	53                   	push   %ebx
+80107ca8:	83 ec 18             	sub    $0x18,%esp
+80107cab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  
+  acquire(&lk->lk);
+80107cae:	8d 73 04             	lea    0x4(%ebx),%esi
+80107cb1:	56                   	push   %esi
+80107cb2:	e8 19 02 00 00       	call   80107ed0 <acquire>
+  r = lk->locked && (lk->pid == myproc()->pid);
+80107cb7:	8b 03                	mov    (%ebx),%eax
+80107cb9:	83 c4 10             	add    $0x10,%esp
+80107cbc:	85 c0                	test   %eax,%eax
+80107cbe:	75 18                	jne    80107cd8 <holdingsleep+0x38>
+  release(&lk->lk);
+80107cc0:	83 ec 0c             	sub    $0xc,%esp
+80107cc3:	56                   	push   %esi
+80107cc4:	e8 a7 01 00 00       	call   80107e70 <release>
+  return r;
+}
+80107cc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107ccc:	89 f8                	mov    %edi,%eax
+80107cce:	5b                   	pop    %ebx
+80107ccf:	5e                   	pop    %esi
+80107cd0:	5f                   	pop    %edi
+80107cd1:	5d                   	pop    %ebp
+80107cd2:	c3                   	ret
+80107cd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107cd7:	90                   	nop
+  r = lk->locked && (lk->pid == myproc()->pid);
+80107cd8:	8b 5b 3c             	mov    0x3c(%ebx),%ebx
+80107cdb:	e8 20 dd ff ff       	call   80105a00 <myproc>
+80107ce0:	39 58 0c             	cmp    %ebx,0xc(%eax)
+80107ce3:	0f 94 c0             	sete   %al
+80107ce6:	0f b6 c0             	movzbl %al,%eax
+80107ce9:	89 c7                	mov    %eax,%edi
+80107ceb:	eb d3                	jmp    80107cc0 <holdingsleep+0x20>
+80107ced:	66 90                	xchg   %ax,%ax
+80107cef:	90                   	nop
+
+80107cf0 <initlock>:
+#include "proc.h"
+#include "spinlock.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+80107cf0:	55                   	push   %ebp
+80107cf1:	89 e5                	mov    %esp,%ebp
+80107cf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+80107cf6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  lk->locked = 0;
+80107cf9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->name = name;
+80107cff:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->cpu = 0;
+80107d02:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+80107d09:	5d                   	pop    %ebp
+80107d0a:	c3                   	ret
+80107d0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107d0f:	90                   	nop
+
+80107d10 <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+80107d10:	55                   	push   %ebp
+80107d11:	89 e5                	mov    %esp,%ebp
+80107d13:	53                   	push   %ebx
+80107d14:	8b 45 08             	mov    0x8(%ebp),%eax
+80107d17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+80107d1a:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107d1d:	05 f8 ff ff 7f       	add    $0x7ffffff8,%eax
+80107d22:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+  for(i = 0; i < 10; i++){
+80107d27:	b8 00 00 00 00       	mov    $0x0,%eax
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107d2c:	76 10                	jbe    80107d3e <getcallerpcs+0x2e>
+80107d2e:	eb 28                	jmp    80107d58 <getcallerpcs+0x48>
+80107d30:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+80107d36:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80107d3c:	77 1a                	ja     80107d58 <getcallerpcs+0x48>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+80107d3e:	8b 5a 04             	mov    0x4(%edx),%ebx
+80107d41:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+  for(i = 0; i < 10; i++){
+80107d44:	83 c0 01             	add    $0x1,%eax
+    ebp = (uint*)ebp[0]; // saved %ebp
+80107d47:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+80107d49:	83 f8 0a             	cmp    $0xa,%eax
+80107d4c:	75 e2                	jne    80107d30 <getcallerpcs+0x20>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+}
+80107d4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107d51:	c9                   	leave
+80107d52:	c3                   	ret
+80107d53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107d57:	90                   	nop
+80107d58:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+80107d5b:	8d 51 28             	lea    0x28(%ecx),%edx
+80107d5e:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80107d60:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80107d66:	83 c0 04             	add    $0x4,%eax
+80107d69:	39 d0                	cmp    %edx,%eax
+80107d6b:	75 f3                	jne    80107d60 <getcallerpcs+0x50>
+}
+80107d6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107d70:	c9                   	leave
+80107d71:	c3                   	ret
+80107d72:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107d79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107d80 <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+80107d80:	55                   	push   %ebp
+80107d81:	89 e5                	mov    %esp,%ebp
+80107d83:	53                   	push   %ebx
+80107d84:	83 ec 04             	sub    $0x4,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80107d87:	9c                   	pushf
+80107d88:	5b                   	pop    %ebx
+  asm volatile("cli");
+80107d89:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+80107d8a:	e8 c1 d0 ff ff       	call   80104e50 <mycpu>
+80107d8f:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+80107d95:	85 c0                	test   %eax,%eax
+80107d97:	74 17                	je     80107db0 <pushcli+0x30>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+80107d99:	e8 b2 d0 ff ff       	call   80104e50 <mycpu>
+80107d9e:	83 80 a4 00 00 00 01 	addl   $0x1,0xa4(%eax)
+}
+80107da5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107da8:	c9                   	leave
+80107da9:	c3                   	ret
+80107daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mycpu()->intena = eflags & FL_IF;
+80107db0:	e8 9b d0 ff ff       	call   80104e50 <mycpu>
+80107db5:	81 e3 00 02 00 00    	and    $0x200,%ebx
+80107dbb:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+80107dc1:	eb d6                	jmp    80107d99 <pushcli+0x19>
+80107dc3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107dca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107dd0 <popcli>:
+
+void
+popcli(void)
+{
+80107dd0:	55                   	push   %ebp
+80107dd1:	89 e5                	mov    %esp,%ebp
+80107dd3:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80107dd6:	9c                   	pushf
+80107dd7:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80107dd8:	f6 c4 02             	test   $0x2,%ah
+80107ddb:	75 35                	jne    80107e12 <popcli+0x42>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+80107ddd:	e8 6e d0 ff ff       	call   80104e50 <mycpu>
+80107de2:	83 a8 a4 00 00 00 01 	subl   $0x1,0xa4(%eax)
+80107de9:	78 34                	js     80107e1f <popcli+0x4f>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80107deb:	e8 60 d0 ff ff       	call   80104e50 <mycpu>
+80107df0:	8b 90 a4 00 00 00    	mov    0xa4(%eax),%edx
+80107df6:	85 d2                	test   %edx,%edx
+80107df8:	74 06                	je     80107e00 <popcli+0x30>
+    sti();
+}
+80107dfa:	c9                   	leave
+80107dfb:	c3                   	ret
+80107dfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80107e00:	e8 4b d0 ff ff       	call   80104e50 <mycpu>
+80107e05:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+80107e0b:	85 c0                	test   %eax,%eax
+80107e0d:	74 eb                	je     80107dfa <popcli+0x2a>
+  asm volatile("sti");
+80107e0f:	fb                   	sti
+}
+80107e10:	c9                   	leave
+80107e11:	c3                   	ret
+    panic("popcli - interruptible");
+80107e12:	83 ec 0c             	sub    $0xc,%esp
+80107e15:	68 cf c0 10 80       	push   $0x8010c0cf
+80107e1a:	e8 61 85 ff ff       	call   80100380 <panic>
+    panic("popcli");
+80107e1f:	83 ec 0c             	sub    $0xc,%esp
+80107e22:	68 e6 c0 10 80       	push   $0x8010c0e6
+80107e27:	e8 54 85 ff ff       	call   80100380 <panic>
+80107e2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107e30 <holding>:
+{
+80107e30:	55                   	push   %ebp
+80107e31:	89 e5                	mov    %esp,%ebp
+80107e33:	56                   	push   %esi
+80107e34:	53                   	push   %ebx
+80107e35:	8b 75 08             	mov    0x8(%ebp),%esi
+80107e38:	31 db                	xor    %ebx,%ebx
+  pushcli();
+80107e3a:	e8 41 ff ff ff       	call   80107d80 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107e3f:	8b 06                	mov    (%esi),%eax
+80107e41:	85 c0                	test   %eax,%eax
+80107e43:	75 0b                	jne    80107e50 <holding+0x20>
+  popcli();
+80107e45:	e8 86 ff ff ff       	call   80107dd0 <popcli>
+}
+80107e4a:	89 d8                	mov    %ebx,%eax
+80107e4c:	5b                   	pop    %ebx
+80107e4d:	5e                   	pop    %esi
+80107e4e:	5d                   	pop    %ebp
+80107e4f:	c3                   	ret
+  r = lock->locked && lock->cpu == mycpu();
+80107e50:	8b 5e 08             	mov    0x8(%esi),%ebx
+80107e53:	e8 f8 cf ff ff       	call   80104e50 <mycpu>
+80107e58:	39 c3                	cmp    %eax,%ebx
+80107e5a:	0f 94 c3             	sete   %bl
+  popcli();
+80107e5d:	e8 6e ff ff ff       	call   80107dd0 <popcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107e62:	0f b6 db             	movzbl %bl,%ebx
+}
+80107e65:	89 d8                	mov    %ebx,%eax
+80107e67:	5b                   	pop    %ebx
+80107e68:	5e                   	pop    %esi
+80107e69:	5d                   	pop    %ebp
+80107e6a:	c3                   	ret
+80107e6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107e6f:	90                   	nop
+
+80107e70 <release>:
+{
+80107e70:	55                   	push   %ebp
+80107e71:	89 e5                	mov    %esp,%ebp
+80107e73:	56                   	push   %esi
+80107e74:	53                   	push   %ebx
+80107e75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80107e78:	e8 03 ff ff ff       	call   80107d80 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107e7d:	8b 03                	mov    (%ebx),%eax
+80107e7f:	85 c0                	test   %eax,%eax
+80107e81:	75 15                	jne    80107e98 <release+0x28>
+  popcli();
+80107e83:	e8 48 ff ff ff       	call   80107dd0 <popcli>
+    panic("release");
+80107e88:	83 ec 0c             	sub    $0xc,%esp
+80107e8b:	68 ed c0 10 80       	push   $0x8010c0ed
+80107e90:	e8 eb 84 ff ff       	call   80100380 <panic>
+80107e95:	8d 76 00             	lea    0x0(%esi),%esi
+  r = lock->locked && lock->cpu == mycpu();
+80107e98:	8b 73 08             	mov    0x8(%ebx),%esi
+80107e9b:	e8 b0 cf ff ff       	call   80104e50 <mycpu>
+80107ea0:	39 c6                	cmp    %eax,%esi
+80107ea2:	75 df                	jne    80107e83 <release+0x13>
+  popcli();
+80107ea4:	e8 27 ff ff ff       	call   80107dd0 <popcli>
+  lk->pcs[0] = 0;
+80107ea9:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->cpu = 0;
+80107eb0:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  __sync_synchronize();
+80107eb7:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+80107ebc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+}
+80107ec2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107ec5:	5b                   	pop    %ebx
+80107ec6:	5e                   	pop    %esi
+80107ec7:	5d                   	pop    %ebp
+  popcli();
+80107ec8:	e9 03 ff ff ff       	jmp    80107dd0 <popcli>
+80107ecd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107ed0 <acquire>:
+{
+80107ed0:	55                   	push   %ebp
+80107ed1:	89 e5                	mov    %esp,%ebp
+80107ed3:	53                   	push   %ebx
+80107ed4:	83 ec 04             	sub    $0x4,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+80107ed7:	e8 a4 fe ff ff       	call   80107d80 <pushcli>
+  if(holding(lk))
+80107edc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80107edf:	e8 9c fe ff ff       	call   80107d80 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107ee4:	8b 03                	mov    (%ebx),%eax
+80107ee6:	85 c0                	test   %eax,%eax
+80107ee8:	0f 85 9a 00 00 00    	jne    80107f88 <acquire+0xb8>
+  popcli();
+80107eee:	e8 dd fe ff ff       	call   80107dd0 <popcli>
+  asm volatile("lock; xchgl %0, %1" :
+80107ef3:	b9 01 00 00 00       	mov    $0x1,%ecx
+80107ef8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107eff:	90                   	nop
+  while(xchg(&lk->locked, 1) != 0)
+80107f00:	8b 55 08             	mov    0x8(%ebp),%edx
+80107f03:	89 c8                	mov    %ecx,%eax
+80107f05:	f0 87 02             	lock xchg %eax,(%edx)
+80107f08:	85 c0                	test   %eax,%eax
+80107f0a:	75 f4                	jne    80107f00 <acquire+0x30>
+  __sync_synchronize();
+80107f0c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+80107f11:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80107f14:	e8 37 cf ff ff       	call   80104e50 <mycpu>
+  getcallerpcs(&lk, lk->pcs);
+80107f19:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  for(i = 0; i < 10; i++){
+80107f1c:	31 d2                	xor    %edx,%edx
+  lk->cpu = mycpu();
+80107f1e:	89 43 08             	mov    %eax,0x8(%ebx)
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107f21:	8d 85 00 00 00 80    	lea    -0x80000000(%ebp),%eax
+80107f27:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+80107f2c:	77 32                	ja     80107f60 <acquire+0x90>
+  ebp = (uint*)v - 2;
+80107f2e:	89 e8                	mov    %ebp,%eax
+80107f30:	eb 14                	jmp    80107f46 <acquire+0x76>
+80107f32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107f38:	8d 98 00 00 00 80    	lea    -0x80000000(%eax),%ebx
+80107f3e:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80107f44:	77 1a                	ja     80107f60 <acquire+0x90>
+    pcs[i] = ebp[1];     // saved %eip
+80107f46:	8b 58 04             	mov    0x4(%eax),%ebx
+80107f49:	89 5c 91 0c          	mov    %ebx,0xc(%ecx,%edx,4)
+  for(i = 0; i < 10; i++){
+80107f4d:	83 c2 01             	add    $0x1,%edx
+    ebp = (uint*)ebp[0]; // saved %ebp
+80107f50:	8b 00                	mov    (%eax),%eax
+  for(i = 0; i < 10; i++){
+80107f52:	83 fa 0a             	cmp    $0xa,%edx
+80107f55:	75 e1                	jne    80107f38 <acquire+0x68>
+}
+80107f57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107f5a:	c9                   	leave
+80107f5b:	c3                   	ret
+80107f5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107f60:	8d 44 91 0c          	lea    0xc(%ecx,%edx,4),%eax
+80107f64:	8d 51 34             	lea    0x34(%ecx),%edx
+80107f67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107f6e:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80107f70:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80107f76:	83 c0 04             	add    $0x4,%eax
+80107f79:	39 c2                	cmp    %eax,%edx
+80107f7b:	75 f3                	jne    80107f70 <acquire+0xa0>
+}
+80107f7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107f80:	c9                   	leave
+80107f81:	c3                   	ret
+80107f82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  r = lock->locked && lock->cpu == mycpu();
+80107f88:	8b 5b 08             	mov    0x8(%ebx),%ebx
+80107f8b:	e8 c0 ce ff ff       	call   80104e50 <mycpu>
+80107f90:	39 c3                	cmp    %eax,%ebx
+80107f92:	0f 85 56 ff ff ff    	jne    80107eee <acquire+0x1e>
+  popcli();
+80107f98:	e8 33 fe ff ff       	call   80107dd0 <popcli>
+    panic("acquire");
+80107f9d:	83 ec 0c             	sub    $0xc,%esp
+80107fa0:	68 f5 c0 10 80       	push   $0x8010c0f5
+80107fa5:	e8 d6 83 ff ff       	call   80100380 <panic>
+80107faa:	66 90                	xchg   %ax,%ax
+80107fac:	66 90                	xchg   %ax,%ax
+80107fae:	66 90                	xchg   %ax,%ax
+
+80107fb0 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+80107fb0:	55                   	push   %ebp
+80107fb1:	89 e5                	mov    %esp,%ebp
+80107fb3:	57                   	push   %edi
+80107fb4:	8b 55 08             	mov    0x8(%ebp),%edx
+80107fb7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+80107fba:	89 d0                	mov    %edx,%eax
+80107fbc:	09 c8                	or     %ecx,%eax
+80107fbe:	a8 03                	test   $0x3,%al
+80107fc0:	75 1e                	jne    80107fe0 <memset+0x30>
+    c &= 0xFF;
+80107fc2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+80107fc6:	c1 e9 02             	shr    $0x2,%ecx
+  asm volatile("cld; rep stosl" :
+80107fc9:	89 d7                	mov    %edx,%edi
+80107fcb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+80107fd1:	fc                   	cld
+80107fd2:	f3 ab                	rep stos %eax,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+80107fd4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+80107fd7:	89 d0                	mov    %edx,%eax
+80107fd9:	c9                   	leave
+80107fda:	c3                   	ret
+80107fdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107fdf:	90                   	nop
+  asm volatile("cld; rep stosb" :
+80107fe0:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107fe3:	89 d7                	mov    %edx,%edi
+80107fe5:	fc                   	cld
+80107fe6:	f3 aa                	rep stos %al,%es:(%edi)
+80107fe8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+80107feb:	89 d0                	mov    %edx,%eax
+80107fed:	c9                   	leave
+80107fee:	c3                   	ret
+80107fef:	90                   	nop
+
+80107ff0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+80107ff0:	55                   	push   %ebp
+80107ff1:	89 e5                	mov    %esp,%ebp
+80107ff3:	56                   	push   %esi
+80107ff4:	53                   	push   %ebx
+80107ff5:	8b 75 10             	mov    0x10(%ebp),%esi
+80107ff8:	8b 55 08             	mov    0x8(%ebp),%edx
+80107ffb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+80107ffe:	85 f6                	test   %esi,%esi
+80108000:	74 2e                	je     80108030 <memcmp+0x40>
+80108002:	01 c6                	add    %eax,%esi
+80108004:	eb 14                	jmp    8010801a <memcmp+0x2a>
+80108006:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010800d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+80108010:	83 c0 01             	add    $0x1,%eax
+80108013:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+80108016:	39 f0                	cmp    %esi,%eax
+80108018:	74 16                	je     80108030 <memcmp+0x40>
+    if(*s1 != *s2)
+8010801a:	0f b6 0a             	movzbl (%edx),%ecx
+8010801d:	0f b6 18             	movzbl (%eax),%ebx
+80108020:	38 d9                	cmp    %bl,%cl
+80108022:	74 ec                	je     80108010 <memcmp+0x20>
+      return *s1 - *s2;
+80108024:	0f b6 c1             	movzbl %cl,%eax
+80108027:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+80108029:	5b                   	pop    %ebx
+8010802a:	5e                   	pop    %esi
+8010802b:	5d                   	pop    %ebp
+8010802c:	c3                   	ret
+8010802d:	8d 76 00             	lea    0x0(%esi),%esi
+80108030:	5b                   	pop    %ebx
+  return 0;
+80108031:	31 c0                	xor    %eax,%eax
+}
+80108033:	5e                   	pop    %esi
+80108034:	5d                   	pop    %ebp
+80108035:	c3                   	ret
+80108036:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010803d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80108040 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+80108040:	55                   	push   %ebp
+80108041:	89 e5                	mov    %esp,%ebp
+80108043:	57                   	push   %edi
+80108044:	56                   	push   %esi
+80108045:	8b 55 08             	mov    0x8(%ebp),%edx
+80108048:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010804b:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+8010804e:	39 d6                	cmp    %edx,%esi
+80108050:	73 26                	jae    80108078 <memmove+0x38>
+80108052:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+80108055:	39 ca                	cmp    %ecx,%edx
+80108057:	73 1f                	jae    80108078 <memmove+0x38>
+    s += n;
+    d += n;
+    while(n-- > 0)
+80108059:	85 c0                	test   %eax,%eax
+8010805b:	74 0f                	je     8010806c <memmove+0x2c>
+8010805d:	83 e8 01             	sub    $0x1,%eax
+      *--d = *--s;
+80108060:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+80108064:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+    while(n-- > 0)
+80108067:	83 e8 01             	sub    $0x1,%eax
+8010806a:	73 f4                	jae    80108060 <memmove+0x20>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+
+  return dst;
+}
+8010806c:	5e                   	pop    %esi
+8010806d:	89 d0                	mov    %edx,%eax
+8010806f:	5f                   	pop    %edi
+80108070:	5d                   	pop    %ebp
+80108071:	c3                   	ret
+80108072:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    while(n-- > 0)
+80108078:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+8010807b:	89 d7                	mov    %edx,%edi
+8010807d:	85 c0                	test   %eax,%eax
+8010807f:	74 eb                	je     8010806c <memmove+0x2c>
+80108081:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      *d++ = *s++;
+80108088:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+    while(n-- > 0)
+80108089:	39 ce                	cmp    %ecx,%esi
+8010808b:	75 fb                	jne    80108088 <memmove+0x48>
+}
+8010808d:	5e                   	pop    %esi
+8010808e:	89 d0                	mov    %edx,%eax
+80108090:	5f                   	pop    %edi
+80108091:	5d                   	pop    %ebp
+80108092:	c3                   	ret
+80108093:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010809a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801080a0 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+  return memmove(dst, src, n);
+801080a0:	eb 9e                	jmp    80108040 <memmove>
+801080a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801080a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801080b0 <strncmp>:
+}
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+801080b0:	55                   	push   %ebp
+801080b1:	89 e5                	mov    %esp,%ebp
+801080b3:	53                   	push   %ebx
+801080b4:	8b 55 10             	mov    0x10(%ebp),%edx
+801080b7:	8b 45 08             	mov    0x8(%ebp),%eax
+801080ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+801080bd:	85 d2                	test   %edx,%edx
+801080bf:	75 16                	jne    801080d7 <strncmp+0x27>
+801080c1:	eb 2d                	jmp    801080f0 <strncmp+0x40>
+801080c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801080c7:	90                   	nop
+801080c8:	3a 19                	cmp    (%ecx),%bl
+801080ca:	75 12                	jne    801080de <strncmp+0x2e>
+    n--, p++, q++;
+801080cc:	83 c0 01             	add    $0x1,%eax
+801080cf:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+801080d2:	83 ea 01             	sub    $0x1,%edx
+801080d5:	74 19                	je     801080f0 <strncmp+0x40>
+801080d7:	0f b6 18             	movzbl (%eax),%ebx
+801080da:	84 db                	test   %bl,%bl
+801080dc:	75 ea                	jne    801080c8 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+801080de:	0f b6 00             	movzbl (%eax),%eax
+801080e1:	0f b6 11             	movzbl (%ecx),%edx
+}
+801080e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801080e7:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+801080e8:	29 d0                	sub    %edx,%eax
+}
+801080ea:	c3                   	ret
+801080eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801080ef:	90                   	nop
+801080f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+801080f3:	31 c0                	xor    %eax,%eax
+}
+801080f5:	c9                   	leave
+801080f6:	c3                   	ret
+801080f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801080fe:	66 90                	xchg   %ax,%ax
+
+80108100 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80108100:	55                   	push   %ebp
+80108101:	89 e5                	mov    %esp,%ebp
+80108103:	57                   	push   %edi
+80108104:	56                   	push   %esi
+80108105:	53                   	push   %ebx
+80108106:	8b 75 08             	mov    0x8(%ebp),%esi
+80108109:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+8010810c:	89 f0                	mov    %esi,%eax
+8010810e:	eb 15                	jmp    80108125 <strncpy+0x25>
+80108110:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+80108114:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80108117:	83 c0 01             	add    $0x1,%eax
+8010811a:	0f b6 4f ff          	movzbl -0x1(%edi),%ecx
+8010811e:	88 48 ff             	mov    %cl,-0x1(%eax)
+80108121:	84 c9                	test   %cl,%cl
+80108123:	74 13                	je     80108138 <strncpy+0x38>
+80108125:	89 d3                	mov    %edx,%ebx
+80108127:	83 ea 01             	sub    $0x1,%edx
+8010812a:	85 db                	test   %ebx,%ebx
+8010812c:	7f e2                	jg     80108110 <strncpy+0x10>
+    ;
+  while(n-- > 0)
+    *s++ = 0;
+  return os;
+}
+8010812e:	5b                   	pop    %ebx
+8010812f:	89 f0                	mov    %esi,%eax
+80108131:	5e                   	pop    %esi
+80108132:	5f                   	pop    %edi
+80108133:	5d                   	pop    %ebp
+80108134:	c3                   	ret
+80108135:	8d 76 00             	lea    0x0(%esi),%esi
+  while(n-- > 0)
+80108138:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+8010813b:	83 e9 01             	sub    $0x1,%ecx
+8010813e:	85 d2                	test   %edx,%edx
+80108140:	74 ec                	je     8010812e <strncpy+0x2e>
+80108142:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *s++ = 0;
+80108148:	83 c0 01             	add    $0x1,%eax
+8010814b:	89 ca                	mov    %ecx,%edx
+8010814d:	c6 40 ff 00          	movb   $0x0,-0x1(%eax)
+  while(n-- > 0)
+80108151:	29 c2                	sub    %eax,%edx
+80108153:	85 d2                	test   %edx,%edx
+80108155:	7f f1                	jg     80108148 <strncpy+0x48>
+}
+80108157:	5b                   	pop    %ebx
+80108158:	89 f0                	mov    %esi,%eax
+8010815a:	5e                   	pop    %esi
+8010815b:	5f                   	pop    %edi
+8010815c:	5d                   	pop    %ebp
+8010815d:	c3                   	ret
+8010815e:	66 90                	xchg   %ax,%ax
+
+80108160 <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+80108160:	55                   	push   %ebp
+80108161:	89 e5                	mov    %esp,%ebp
+80108163:	56                   	push   %esi
+80108164:	53                   	push   %ebx
+80108165:	8b 55 10             	mov    0x10(%ebp),%edx
+80108168:	8b 75 08             	mov    0x8(%ebp),%esi
+8010816b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+8010816e:	85 d2                	test   %edx,%edx
+80108170:	7e 25                	jle    80108197 <safestrcpy+0x37>
+80108172:	8d 5c 10 ff          	lea    -0x1(%eax,%edx,1),%ebx
+80108176:	89 f2                	mov    %esi,%edx
+80108178:	eb 16                	jmp    80108190 <safestrcpy+0x30>
+8010817a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80108180:	0f b6 08             	movzbl (%eax),%ecx
+80108183:	83 c0 01             	add    $0x1,%eax
+80108186:	83 c2 01             	add    $0x1,%edx
+80108189:	88 4a ff             	mov    %cl,-0x1(%edx)
+8010818c:	84 c9                	test   %cl,%cl
+8010818e:	74 04                	je     80108194 <safestrcpy+0x34>
+80108190:	39 d8                	cmp    %ebx,%eax
+80108192:	75 ec                	jne    80108180 <safestrcpy+0x20>
+    ;
+  *s = 0;
+80108194:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80108197:	89 f0                	mov    %esi,%eax
+80108199:	5b                   	pop    %ebx
+8010819a:	5e                   	pop    %esi
+8010819b:	5d                   	pop    %ebp
+8010819c:	c3                   	ret
+8010819d:	8d 76 00             	lea    0x0(%esi),%esi
+
+801081a0 <strlen>:
+
+int
+strlen(const char *s)
+{
+801081a0:	55                   	push   %ebp
+  int n;
+
+  for(n = 0; s[n]; n++)
+801081a1:	31 c0                	xor    %eax,%eax
+{
+801081a3:	89 e5                	mov    %esp,%ebp
+801081a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+801081a8:	80 3a 00             	cmpb   $0x0,(%edx)
+801081ab:	74 0c                	je     801081b9 <strlen+0x19>
+801081ad:	8d 76 00             	lea    0x0(%esi),%esi
+801081b0:	83 c0 01             	add    $0x1,%eax
+801081b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+801081b7:	75 f7                	jne    801081b0 <strlen+0x10>
+    ;
+  return n;
+}
+801081b9:	5d                   	pop    %ebp
+801081ba:	c3                   	ret
+
+801081bb <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+801081bb:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+801081bf:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-saved registers
+  pushl %ebp
+801081c3:	55                   	push   %ebp
+  pushl %ebx
+801081c4:	53                   	push   %ebx
+  pushl %esi
+801081c5:	56                   	push   %esi
+  pushl %edi
+801081c6:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+801081c7:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+801081c9:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-saved registers
+  popl %edi
+801081cb:	5f                   	pop    %edi
+  popl %esi
+801081cc:	5e                   	pop    %esi
+  popl %ebx
+801081cd:	5b                   	pop    %ebx
+  popl %ebp
+801081ce:	5d                   	pop    %ebp
+  ret
+801081cf:	c3                   	ret
+
+801081d0 <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+801081d0:	55                   	push   %ebp
+801081d1:	89 e5                	mov    %esp,%ebp
+801081d3:	53                   	push   %ebx
+801081d4:	83 ec 04             	sub    $0x4,%esp
+801081d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+801081da:	e8 21 d8 ff ff       	call   80105a00 <myproc>
+
+  if(addr >= curproc->mm->sz || addr+4 > curproc->mm->sz)
+801081df:	8b 00                	mov    (%eax),%eax
+801081e1:	8b 40 78             	mov    0x78(%eax),%eax
+801081e4:	39 c3                	cmp    %eax,%ebx
+801081e6:	73 18                	jae    80108200 <fetchint+0x30>
+801081e8:	8d 53 04             	lea    0x4(%ebx),%edx
+801081eb:	39 d0                	cmp    %edx,%eax
+801081ed:	72 11                	jb     80108200 <fetchint+0x30>
+    return -1;
+  *ip = *(int*)(addr);
+801081ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+801081f2:	8b 13                	mov    (%ebx),%edx
+801081f4:	89 10                	mov    %edx,(%eax)
+  return 0;
+801081f6:	31 c0                	xor    %eax,%eax
+}
+801081f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801081fb:	c9                   	leave
+801081fc:	c3                   	ret
+801081fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80108200:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108205:	eb f1                	jmp    801081f8 <fetchint+0x28>
+80108207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010820e:	66 90                	xchg   %ax,%ax
+
+80108210 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uint addr, char **pp)
+{
+80108210:	55                   	push   %ebp
+80108211:	89 e5                	mov    %esp,%ebp
+80108213:	53                   	push   %ebx
+80108214:	83 ec 04             	sub    $0x4,%esp
+80108217:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char *s, *ep;
+  struct proc *curproc = myproc();
+8010821a:	e8 e1 d7 ff ff       	call   80105a00 <myproc>
+
+  if(addr >= curproc->mm->sz)
+8010821f:	8b 10                	mov    (%eax),%edx
+80108221:	3b 5a 78             	cmp    0x78(%edx),%ebx
+80108224:	73 32                	jae    80108258 <fetchstr+0x48>
+    return -1;
+  *pp = (char*)addr;
+80108226:	8b 55 0c             	mov    0xc(%ebp),%edx
+80108229:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*)curproc->mm->sz;
+8010822b:	8b 00                	mov    (%eax),%eax
+8010822d:	8b 50 78             	mov    0x78(%eax),%edx
+  for(s = *pp; s < ep; s++){
+80108230:	39 d3                	cmp    %edx,%ebx
+80108232:	73 24                	jae    80108258 <fetchstr+0x48>
+80108234:	89 d8                	mov    %ebx,%eax
+80108236:	eb 0f                	jmp    80108247 <fetchstr+0x37>
+80108238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010823f:	90                   	nop
+80108240:	83 c0 01             	add    $0x1,%eax
+80108243:	39 d0                	cmp    %edx,%eax
+80108245:	73 11                	jae    80108258 <fetchstr+0x48>
+    if(*s == 0)
+80108247:	80 38 00             	cmpb   $0x0,(%eax)
+8010824a:	75 f4                	jne    80108240 <fetchstr+0x30>
+      return s - *pp;
+8010824c:	29 d8                	sub    %ebx,%eax
+  }
+  return -1;
+}
+8010824e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108251:	c9                   	leave
+80108252:	c3                   	ret
+80108253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108257:	90                   	nop
+80108258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+8010825b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108260:	c9                   	leave
+80108261:	c3                   	ret
+80108262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108270 <argint>:
+
+// Fetch the nth 32-bit system call argument.
+int
+argint(int n, int *ip)
+{
+80108270:	55                   	push   %ebp
+80108271:	89 e5                	mov    %esp,%ebp
+80108273:	56                   	push   %esi
+80108274:	53                   	push   %ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80108275:	e8 86 d7 ff ff       	call   80105a00 <myproc>
+8010827a:	8b 55 08             	mov    0x8(%ebp),%edx
+8010827d:	8b 40 24             	mov    0x24(%eax),%eax
+80108280:	8b 40 44             	mov    0x44(%eax),%eax
+80108283:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+80108286:	e8 75 d7 ff ff       	call   80105a00 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+8010828b:	8d 73 04             	lea    0x4(%ebx),%esi
+  if(addr >= curproc->mm->sz || addr+4 > curproc->mm->sz)
+8010828e:	8b 00                	mov    (%eax),%eax
+80108290:	8b 40 78             	mov    0x78(%eax),%eax
+80108293:	39 c6                	cmp    %eax,%esi
+80108295:	73 19                	jae    801082b0 <argint+0x40>
+80108297:	8d 53 08             	lea    0x8(%ebx),%edx
+8010829a:	39 d0                	cmp    %edx,%eax
+8010829c:	72 12                	jb     801082b0 <argint+0x40>
+  *ip = *(int*)(addr);
+8010829e:	8b 45 0c             	mov    0xc(%ebp),%eax
+801082a1:	8b 53 04             	mov    0x4(%ebx),%edx
+801082a4:	89 10                	mov    %edx,(%eax)
+  return 0;
+801082a6:	31 c0                	xor    %eax,%eax
+}
+801082a8:	5b                   	pop    %ebx
+801082a9:	5e                   	pop    %esi
+801082aa:	5d                   	pop    %ebp
+801082ab:	c3                   	ret
+801082ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+801082b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801082b5:	eb f1                	jmp    801082a8 <argint+0x38>
+801082b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801082be:	66 90                	xchg   %ax,%ax
+
+801082c0 <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+801082c0:	55                   	push   %ebp
+801082c1:	89 e5                	mov    %esp,%ebp
+801082c3:	57                   	push   %edi
+801082c4:	56                   	push   %esi
+801082c5:	53                   	push   %ebx
+801082c6:	83 ec 0c             	sub    $0xc,%esp
+  int i;
+  struct proc *curproc = myproc();
+801082c9:	e8 32 d7 ff ff       	call   80105a00 <myproc>
+801082ce:	89 c6                	mov    %eax,%esi
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801082d0:	e8 2b d7 ff ff       	call   80105a00 <myproc>
+801082d5:	8b 55 08             	mov    0x8(%ebp),%edx
+801082d8:	8b 40 24             	mov    0x24(%eax),%eax
+801082db:	8b 40 44             	mov    0x44(%eax),%eax
+801082de:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+801082e1:	e8 1a d7 ff ff       	call   80105a00 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801082e6:	8d 7b 04             	lea    0x4(%ebx),%edi
+  if(addr >= curproc->mm->sz || addr+4 > curproc->mm->sz)
+801082e9:	8b 00                	mov    (%eax),%eax
+801082eb:	8b 40 78             	mov    0x78(%eax),%eax
+801082ee:	39 c7                	cmp    %eax,%edi
+801082f0:	73 36                	jae    80108328 <argptr+0x68>
+801082f2:	8d 4b 08             	lea    0x8(%ebx),%ecx
+801082f5:	39 c8                	cmp    %ecx,%eax
+801082f7:	72 2f                	jb     80108328 <argptr+0x68>
+ 
+  if(argint(n, &i) < 0)
+    return -1;
+  if(size < 0 || (uint)i >= curproc->mm->sz || (uint)i+size > curproc->mm->sz)
+801082f9:	8b 55 10             	mov    0x10(%ebp),%edx
+  *ip = *(int*)(addr);
+801082fc:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(size < 0 || (uint)i >= curproc->mm->sz || (uint)i+size > curproc->mm->sz)
+801082ff:	85 d2                	test   %edx,%edx
+80108301:	78 25                	js     80108328 <argptr+0x68>
+80108303:	8b 16                	mov    (%esi),%edx
+80108305:	8b 52 78             	mov    0x78(%edx),%edx
+80108308:	39 d0                	cmp    %edx,%eax
+8010830a:	73 1c                	jae    80108328 <argptr+0x68>
+8010830c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+8010830f:	01 c3                	add    %eax,%ebx
+80108311:	39 da                	cmp    %ebx,%edx
+80108313:	72 13                	jb     80108328 <argptr+0x68>
+    return -1;
+  *pp = (char*)i;
+80108315:	8b 55 0c             	mov    0xc(%ebp),%edx
+80108318:	89 02                	mov    %eax,(%edx)
+  return 0;
+8010831a:	31 c0                	xor    %eax,%eax
+}
+8010831c:	83 c4 0c             	add    $0xc,%esp
+8010831f:	5b                   	pop    %ebx
+80108320:	5e                   	pop    %esi
+80108321:	5f                   	pop    %edi
+80108322:	5d                   	pop    %ebp
+80108323:	c3                   	ret
+80108324:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80108328:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010832d:	eb ed                	jmp    8010831c <argptr+0x5c>
+8010832f:	90                   	nop
+
+80108330 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+80108330:	55                   	push   %ebp
+80108331:	89 e5                	mov    %esp,%ebp
+80108333:	56                   	push   %esi
+80108334:	53                   	push   %ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80108335:	e8 c6 d6 ff ff       	call   80105a00 <myproc>
+8010833a:	8b 55 08             	mov    0x8(%ebp),%edx
+8010833d:	8b 40 24             	mov    0x24(%eax),%eax
+80108340:	8b 40 44             	mov    0x44(%eax),%eax
+80108343:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+80108346:	e8 b5 d6 ff ff       	call   80105a00 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+8010834b:	8d 73 04             	lea    0x4(%ebx),%esi
+  if(addr >= curproc->mm->sz || addr+4 > curproc->mm->sz)
+8010834e:	8b 00                	mov    (%eax),%eax
+80108350:	8b 40 78             	mov    0x78(%eax),%eax
+80108353:	39 c6                	cmp    %eax,%esi
+80108355:	73 41                	jae    80108398 <argstr+0x68>
+80108357:	8d 53 08             	lea    0x8(%ebx),%edx
+8010835a:	39 d0                	cmp    %edx,%eax
+8010835c:	72 3a                	jb     80108398 <argstr+0x68>
+  *ip = *(int*)(addr);
+8010835e:	8b 5b 04             	mov    0x4(%ebx),%ebx
+  struct proc *curproc = myproc();
+80108361:	e8 9a d6 ff ff       	call   80105a00 <myproc>
+  if(addr >= curproc->mm->sz)
+80108366:	8b 10                	mov    (%eax),%edx
+80108368:	3b 5a 78             	cmp    0x78(%edx),%ebx
+8010836b:	73 2b                	jae    80108398 <argstr+0x68>
+  *pp = (char*)addr;
+8010836d:	8b 55 0c             	mov    0xc(%ebp),%edx
+80108370:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*)curproc->mm->sz;
+80108372:	8b 00                	mov    (%eax),%eax
+80108374:	8b 50 78             	mov    0x78(%eax),%edx
+  for(s = *pp; s < ep; s++){
+80108377:	39 d3                	cmp    %edx,%ebx
+80108379:	73 1d                	jae    80108398 <argstr+0x68>
+8010837b:	89 d8                	mov    %ebx,%eax
+8010837d:	eb 08                	jmp    80108387 <argstr+0x57>
+8010837f:	90                   	nop
+80108380:	83 c0 01             	add    $0x1,%eax
+80108383:	39 d0                	cmp    %edx,%eax
+80108385:	73 11                	jae    80108398 <argstr+0x68>
+    if(*s == 0)
+80108387:	80 38 00             	cmpb   $0x0,(%eax)
+8010838a:	75 f4                	jne    80108380 <argstr+0x50>
+      return s - *pp;
+8010838c:	29 d8                	sub    %ebx,%eax
+  int addr;
+  if(argint(n, &addr) < 0)
+    return -1;
+  return fetchstr(addr, pp);
+}
+8010838e:	5b                   	pop    %ebx
+8010838f:	5e                   	pop    %esi
+80108390:	5d                   	pop    %ebp
+80108391:	c3                   	ret
+80108392:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80108398:	5b                   	pop    %ebx
+    return -1;
+80108399:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010839e:	5e                   	pop    %esi
+8010839f:	5d                   	pop    %ebp
+801083a0:	c3                   	ret
+801083a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801083a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801083af:	90                   	nop
+
+801083b0 <syscall>:
+[SYS_join_any]  sys_join_any,
+};
+
+void
+syscall(void)
+{
+801083b0:	55                   	push   %ebp
+801083b1:	89 e5                	mov    %esp,%ebp
+801083b3:	53                   	push   %ebx
+801083b4:	83 ec 04             	sub    $0x4,%esp
+  int num;
+  struct proc *curproc = myproc();
+801083b7:	e8 44 d6 ff ff       	call   80105a00 <myproc>
+801083bc:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+801083be:	8b 40 24             	mov    0x24(%eax),%eax
+801083c1:	8b 40 1c             	mov    0x1c(%eax),%eax
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+801083c4:	8d 50 ff             	lea    -0x1(%eax),%edx
+801083c7:	83 fa 29             	cmp    $0x29,%edx
+801083ca:	77 24                	ja     801083f0 <syscall+0x40>
+801083cc:	8b 14 85 20 c1 10 80 	mov    -0x7fef3ee0(,%eax,4),%edx
+801083d3:	85 d2                	test   %edx,%edx
+801083d5:	74 19                	je     801083f0 <syscall+0x40>
+    curproc->tf->eax = syscalls[num]();
+801083d7:	ff d2                	call   *%edx
+801083d9:	89 c2                	mov    %eax,%edx
+801083db:	8b 43 24             	mov    0x24(%ebx),%eax
+801083de:	89 50 1c             	mov    %edx,0x1c(%eax)
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            curproc->pid, curproc->name, num);
+    curproc->tf->eax = -1;
+  }
+}
+801083e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801083e4:	c9                   	leave
+801083e5:	c3                   	ret
+801083e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801083ed:	8d 76 00             	lea    0x0(%esi),%esi
+    cprintf("%d %s: unknown sys call %d\n",
+801083f0:	50                   	push   %eax
+            curproc->pid, curproc->name, num);
+801083f1:	8d 43 48             	lea    0x48(%ebx),%eax
+    cprintf("%d %s: unknown sys call %d\n",
+801083f4:	50                   	push   %eax
+801083f5:	ff 73 0c             	push   0xc(%ebx)
+801083f8:	68 fd c0 10 80       	push   $0x8010c0fd
+801083fd:	e8 ae 82 ff ff       	call   801006b0 <cprintf>
+    curproc->tf->eax = -1;
+80108402:	8b 43 24             	mov    0x24(%ebx),%eax
+80108405:	83 c4 10             	add    $0x10,%esp
+80108408:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+}
+8010840f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108412:	c9                   	leave
+80108413:	c3                   	ret
+80108414:	66 90                	xchg   %ax,%ax
+80108416:	66 90                	xchg   %ax,%ax
+80108418:	66 90                	xchg   %ax,%ax
+8010841a:	66 90                	xchg   %ax,%ax
+8010841c:	66 90                	xchg   %ax,%ax
+8010841e:	66 90                	xchg   %ax,%ax
+
+80108420 <fdalloc>:
+
+// Allocate a file descriptor for the given file.
+// Takes over file reference from caller on success.
+static int
+fdalloc(struct file *f)
+{
+80108420:	55                   	push   %ebp
+80108421:	89 e5                	mov    %esp,%ebp
+80108423:	57                   	push   %edi
+80108424:	56                   	push   %esi
+80108425:	53                   	push   %ebx
+  int fd;
+  struct fdtable *fdt = myproc()->files;
+
+  acquire(&fdt->lock);
+  for(fd = 0; fd < NOFILE; fd++){
+80108426:	31 db                	xor    %ebx,%ebx
+{
+80108428:	83 ec 1c             	sub    $0x1c,%esp
+8010842b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct fdtable *fdt = myproc()->files;
+8010842e:	e8 cd d5 ff ff       	call   80105a00 <myproc>
+  acquire(&fdt->lock);
+80108433:	83 ec 0c             	sub    $0xc,%esp
+  struct fdtable *fdt = myproc()->files;
+80108436:	8b 70 40             	mov    0x40(%eax),%esi
+  acquire(&fdt->lock);
+80108439:	8d 7e 04             	lea    0x4(%esi),%edi
+8010843c:	57                   	push   %edi
+8010843d:	e8 8e fa ff ff       	call   80107ed0 <acquire>
+80108442:	83 c4 10             	add    $0x10,%esp
+80108445:	8d 76 00             	lea    0x0(%esi),%esi
+    if(fdt->ofile[fd] == 0){
+80108448:	8b 44 9e 3c          	mov    0x3c(%esi,%ebx,4),%eax
+8010844c:	85 c0                	test   %eax,%eax
+8010844e:	74 28                	je     80108478 <fdalloc+0x58>
+  for(fd = 0; fd < NOFILE; fd++){
+80108450:	83 c3 01             	add    $0x1,%ebx
+80108453:	83 fb 10             	cmp    $0x10,%ebx
+80108456:	75 f0                	jne    80108448 <fdalloc+0x28>
+      fdt->ofile[fd] = f;
+      release(&fdt->lock);
+      return fd;
+    }
+  }
+  release(&fdt->lock);
+80108458:	83 ec 0c             	sub    $0xc,%esp
+  return -1;
+8010845b:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  release(&fdt->lock);
+80108460:	57                   	push   %edi
+80108461:	e8 0a fa ff ff       	call   80107e70 <release>
+  return -1;
+80108466:	83 c4 10             	add    $0x10,%esp
+}
+80108469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010846c:	89 d8                	mov    %ebx,%eax
+8010846e:	5b                   	pop    %ebx
+8010846f:	5e                   	pop    %esi
+80108470:	5f                   	pop    %edi
+80108471:	5d                   	pop    %ebp
+80108472:	c3                   	ret
+80108473:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108477:	90                   	nop
+      fdt->ofile[fd] = f;
+80108478:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      release(&fdt->lock);
+8010847b:	83 ec 0c             	sub    $0xc,%esp
+      fdt->ofile[fd] = f;
+8010847e:	89 44 9e 3c          	mov    %eax,0x3c(%esi,%ebx,4)
+      release(&fdt->lock);
+80108482:	57                   	push   %edi
+80108483:	e8 e8 f9 ff ff       	call   80107e70 <release>
+      return fd;
+80108488:	83 c4 10             	add    $0x10,%esp
+}
+8010848b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010848e:	89 d8                	mov    %ebx,%eax
+80108490:	5b                   	pop    %ebx
+80108491:	5e                   	pop    %esi
+80108492:	5f                   	pop    %edi
+80108493:	5d                   	pop    %ebp
+80108494:	c3                   	ret
+80108495:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010849c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801084a0 <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+801084a0:	55                   	push   %ebp
+801084a1:	89 e5                	mov    %esp,%ebp
+801084a3:	57                   	push   %edi
+801084a4:	56                   	push   %esi
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+801084a5:	8d 7d da             	lea    -0x26(%ebp),%edi
+{
+801084a8:	53                   	push   %ebx
+801084a9:	83 ec 34             	sub    $0x34,%esp
+801084ac:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+801084af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801084b2:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+801084b5:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if((dp = nameiparent(path, name)) == 0)
+801084b8:	57                   	push   %edi
+801084b9:	50                   	push   %eax
+801084ba:	e8 a1 a0 ff ff       	call   80102560 <nameiparent>
+801084bf:	83 c4 10             	add    $0x10,%esp
+801084c2:	85 c0                	test   %eax,%eax
+801084c4:	74 5e                	je     80108524 <create+0x84>
+    return 0;
+  ilock(dp);
+801084c6:	83 ec 0c             	sub    $0xc,%esp
+801084c9:	89 c3                	mov    %eax,%ebx
+801084cb:	50                   	push   %eax
+801084cc:	e8 4f 97 ff ff       	call   80101c20 <ilock>
+
+  if((ip = dirlookup(dp, name, 0)) != 0){
+801084d1:	83 c4 0c             	add    $0xc,%esp
+801084d4:	6a 00                	push   $0x0
+801084d6:	57                   	push   %edi
+801084d7:	53                   	push   %ebx
+801084d8:	e8 a3 9c ff ff       	call   80102180 <dirlookup>
+801084dd:	83 c4 10             	add    $0x10,%esp
+801084e0:	89 c6                	mov    %eax,%esi
+801084e2:	85 c0                	test   %eax,%eax
+801084e4:	74 4a                	je     80108530 <create+0x90>
+    iunlockput(dp);
+801084e6:	83 ec 0c             	sub    $0xc,%esp
+801084e9:	53                   	push   %ebx
+801084ea:	e8 c1 99 ff ff       	call   80101eb0 <iunlockput>
+    ilock(ip);
+801084ef:	89 34 24             	mov    %esi,(%esp)
+801084f2:	e8 29 97 ff ff       	call   80101c20 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+801084f7:	83 c4 10             	add    $0x10,%esp
+801084fa:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+801084ff:	75 17                	jne    80108518 <create+0x78>
+80108501:	66 83 7e 50 02       	cmpw   $0x2,0x50(%esi)
+80108506:	75 10                	jne    80108518 <create+0x78>
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+80108508:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010850b:	89 f0                	mov    %esi,%eax
+8010850d:	5b                   	pop    %ebx
+8010850e:	5e                   	pop    %esi
+8010850f:	5f                   	pop    %edi
+80108510:	5d                   	pop    %ebp
+80108511:	c3                   	ret
+80108512:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(ip);
+80108518:	83 ec 0c             	sub    $0xc,%esp
+8010851b:	56                   	push   %esi
+8010851c:	e8 8f 99 ff ff       	call   80101eb0 <iunlockput>
+    return 0;
+80108521:	83 c4 10             	add    $0x10,%esp
+}
+80108524:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+80108527:	31 f6                	xor    %esi,%esi
+}
+80108529:	5b                   	pop    %ebx
+8010852a:	89 f0                	mov    %esi,%eax
+8010852c:	5e                   	pop    %esi
+8010852d:	5f                   	pop    %edi
+8010852e:	5d                   	pop    %ebp
+8010852f:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+80108530:	0f bf 45 d4          	movswl -0x2c(%ebp),%eax
+80108534:	83 ec 08             	sub    $0x8,%esp
+80108537:	50                   	push   %eax
+80108538:	ff 33                	push   (%ebx)
+8010853a:	e8 71 95 ff ff       	call   80101ab0 <ialloc>
+8010853f:	83 c4 10             	add    $0x10,%esp
+80108542:	89 c6                	mov    %eax,%esi
+80108544:	85 c0                	test   %eax,%eax
+80108546:	0f 84 bc 00 00 00    	je     80108608 <create+0x168>
+  ilock(ip);
+8010854c:	83 ec 0c             	sub    $0xc,%esp
+8010854f:	50                   	push   %eax
+80108550:	e8 cb 96 ff ff       	call   80101c20 <ilock>
+  ip->major = major;
+80108555:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+80108559:	66 89 46 52          	mov    %ax,0x52(%esi)
+  ip->minor = minor;
+8010855d:	0f b7 45 cc          	movzwl -0x34(%ebp),%eax
+80108561:	66 89 46 54          	mov    %ax,0x54(%esi)
+  ip->nlink = 1;
+80108565:	b8 01 00 00 00       	mov    $0x1,%eax
+8010856a:	66 89 46 56          	mov    %ax,0x56(%esi)
+  iupdate(ip);
+8010856e:	89 34 24             	mov    %esi,(%esp)
+80108571:	e8 fa 95 ff ff       	call   80101b70 <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80108576:	83 c4 10             	add    $0x10,%esp
+80108579:	66 83 7d d4 01       	cmpw   $0x1,-0x2c(%ebp)
+8010857e:	74 30                	je     801085b0 <create+0x110>
+  if(dirlink(dp, name, ip->inum) < 0)
+80108580:	83 ec 04             	sub    $0x4,%esp
+80108583:	ff 76 04             	push   0x4(%esi)
+80108586:	57                   	push   %edi
+80108587:	53                   	push   %ebx
+80108588:	e8 f3 9e ff ff       	call   80102480 <dirlink>
+8010858d:	83 c4 10             	add    $0x10,%esp
+80108590:	85 c0                	test   %eax,%eax
+80108592:	78 67                	js     801085fb <create+0x15b>
+  iunlockput(dp);
+80108594:	83 ec 0c             	sub    $0xc,%esp
+80108597:	53                   	push   %ebx
+80108598:	e8 13 99 ff ff       	call   80101eb0 <iunlockput>
+  return ip;
+8010859d:	83 c4 10             	add    $0x10,%esp
+}
+801085a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801085a3:	89 f0                	mov    %esi,%eax
+801085a5:	5b                   	pop    %ebx
+801085a6:	5e                   	pop    %esi
+801085a7:	5f                   	pop    %edi
+801085a8:	5d                   	pop    %ebp
+801085a9:	c3                   	ret
+801085aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iupdate(dp);
+801085b0:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink++;  // for ".."
+801085b3:	66 83 43 56 01       	addw   $0x1,0x56(%ebx)
+    iupdate(dp);
+801085b8:	53                   	push   %ebx
+801085b9:	e8 b2 95 ff ff       	call   80101b70 <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+801085be:	83 c4 0c             	add    $0xc,%esp
+801085c1:	ff 76 04             	push   0x4(%esi)
+801085c4:	68 e8 c1 10 80       	push   $0x8010c1e8
+801085c9:	56                   	push   %esi
+801085ca:	e8 b1 9e ff ff       	call   80102480 <dirlink>
+801085cf:	83 c4 10             	add    $0x10,%esp
+801085d2:	85 c0                	test   %eax,%eax
+801085d4:	78 18                	js     801085ee <create+0x14e>
+801085d6:	83 ec 04             	sub    $0x4,%esp
+801085d9:	ff 73 04             	push   0x4(%ebx)
+801085dc:	68 e7 c1 10 80       	push   $0x8010c1e7
+801085e1:	56                   	push   %esi
+801085e2:	e8 99 9e ff ff       	call   80102480 <dirlink>
+801085e7:	83 c4 10             	add    $0x10,%esp
+801085ea:	85 c0                	test   %eax,%eax
+801085ec:	79 92                	jns    80108580 <create+0xe0>
+      panic("create dots");
+801085ee:	83 ec 0c             	sub    $0xc,%esp
+801085f1:	68 db c1 10 80       	push   $0x8010c1db
+801085f6:	e8 85 7d ff ff       	call   80100380 <panic>
+    panic("create: dirlink");
+801085fb:	83 ec 0c             	sub    $0xc,%esp
+801085fe:	68 ea c1 10 80       	push   $0x8010c1ea
+80108603:	e8 78 7d ff ff       	call   80100380 <panic>
+    panic("create: ialloc");
+80108608:	83 ec 0c             	sub    $0xc,%esp
+8010860b:	68 cc c1 10 80       	push   $0x8010c1cc
+80108610:	e8 6b 7d ff ff       	call   80100380 <panic>
+80108615:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010861c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108620 <argfd.constprop.0>:
+argfd(int n, int *pfd, struct file **pf)
+80108620:	55                   	push   %ebp
+80108621:	89 e5                	mov    %esp,%ebp
+80108623:	57                   	push   %edi
+80108624:	56                   	push   %esi
+80108625:	53                   	push   %ebx
+80108626:	89 c3                	mov    %eax,%ebx
+80108628:	83 ec 1c             	sub    $0x1c,%esp
+  struct fdtable *fdt = myproc()->files;
+8010862b:	e8 d0 d3 ff ff       	call   80105a00 <myproc>
+  if(argint(n, &fd) < 0 || fd < 0 || fd >= NOFILE)
+80108630:	83 ec 08             	sub    $0x8,%esp
+  struct fdtable *fdt = myproc()->files;
+80108633:	8b 70 40             	mov    0x40(%eax),%esi
+  if(argint(n, &fd) < 0 || fd < 0 || fd >= NOFILE)
+80108636:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108639:	50                   	push   %eax
+8010863a:	6a 00                	push   $0x0
+8010863c:	e8 2f fc ff ff       	call   80108270 <argint>
+80108641:	83 c4 10             	add    $0x10,%esp
+80108644:	85 c0                	test   %eax,%eax
+80108646:	78 54                	js     8010869c <argfd.constprop.0+0x7c>
+80108648:	83 7d e4 0f          	cmpl   $0xf,-0x1c(%ebp)
+8010864c:	77 4e                	ja     8010869c <argfd.constprop.0+0x7c>
+  acquire(&fdt->lock);
+8010864e:	83 ec 0c             	sub    $0xc,%esp
+80108651:	8d 7e 04             	lea    0x4(%esi),%edi
+80108654:	57                   	push   %edi
+80108655:	e8 76 f8 ff ff       	call   80107ed0 <acquire>
+  if((f = fdt->ofile[fd]) != 0)
+8010865a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010865d:	83 c4 10             	add    $0x10,%esp
+80108660:	8b 74 86 3c          	mov    0x3c(%esi,%eax,4),%esi
+80108664:	85 f6                	test   %esi,%esi
+80108666:	74 28                	je     80108690 <argfd.constprop.0+0x70>
+    filedup(f);
+80108668:	83 ec 0c             	sub    $0xc,%esp
+8010866b:	56                   	push   %esi
+8010866c:	e8 9f 88 ff ff       	call   80100f10 <filedup>
+  release(&fdt->lock);
+80108671:	89 3c 24             	mov    %edi,(%esp)
+80108674:	e8 f7 f7 ff ff       	call   80107e70 <release>
+    *pf = f;
+80108679:	89 33                	mov    %esi,(%ebx)
+8010867b:	83 c4 10             	add    $0x10,%esp
+}
+8010867e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108681:	5b                   	pop    %ebx
+  return 0;
+80108682:	31 c0                	xor    %eax,%eax
+}
+80108684:	5e                   	pop    %esi
+80108685:	5f                   	pop    %edi
+80108686:	5d                   	pop    %ebp
+80108687:	c3                   	ret
+80108688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010868f:	90                   	nop
+  release(&fdt->lock);
+80108690:	83 ec 0c             	sub    $0xc,%esp
+80108693:	57                   	push   %edi
+80108694:	e8 d7 f7 ff ff       	call   80107e70 <release>
+80108699:	83 c4 10             	add    $0x10,%esp
+}
+8010869c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+8010869f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801086a4:	5b                   	pop    %ebx
+801086a5:	5e                   	pop    %esi
+801086a6:	5f                   	pop    %edi
+801086a7:	5d                   	pop    %ebp
+801086a8:	c3                   	ret
+801086a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801086b0 <sys_dup>:
+{
+801086b0:	55                   	push   %ebp
+801086b1:	89 e5                	mov    %esp,%ebp
+801086b3:	53                   	push   %ebx
+  if(argfd(0, 0, &f) < 0)
+801086b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+801086b7:	83 ec 14             	sub    $0x14,%esp
+  if(argfd(0, 0, &f) < 0)
+801086ba:	e8 61 ff ff ff       	call   80108620 <argfd.constprop.0>
+801086bf:	85 c0                	test   %eax,%eax
+801086c1:	78 25                	js     801086e8 <sys_dup+0x38>
+  if((fd=fdalloc(f)) < 0){
+801086c3:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+801086c6:	89 d8                	mov    %ebx,%eax
+801086c8:	e8 53 fd ff ff       	call   80108420 <fdalloc>
+801086cd:	85 c0                	test   %eax,%eax
+801086cf:	78 05                	js     801086d6 <sys_dup+0x26>
+}
+801086d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801086d4:	c9                   	leave
+801086d5:	c3                   	ret
+    fileclose(f);
+801086d6:	83 ec 0c             	sub    $0xc,%esp
+801086d9:	53                   	push   %ebx
+801086da:	e8 81 88 ff ff       	call   80100f60 <fileclose>
+    return -1;
+801086df:	83 c4 10             	add    $0x10,%esp
+801086e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+801086e8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801086ed:	eb e2                	jmp    801086d1 <sys_dup+0x21>
+801086ef:	90                   	nop
+
+801086f0 <sys_read>:
+{
+801086f0:	55                   	push   %ebp
+801086f1:	89 e5                	mov    %esp,%ebp
+801086f3:	53                   	push   %ebx
+  if(argint(2, &n) < 0 || argptr(1, &p, n) < 0 || argfd(0, 0, &f) < 0)
+801086f4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+{
+801086f7:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(2, &n) < 0 || argptr(1, &p, n) < 0 || argfd(0, 0, &f) < 0)
+801086fa:	50                   	push   %eax
+801086fb:	6a 02                	push   $0x2
+801086fd:	e8 6e fb ff ff       	call   80108270 <argint>
+80108702:	83 c4 10             	add    $0x10,%esp
+80108705:	85 c0                	test   %eax,%eax
+80108707:	78 4f                	js     80108758 <sys_read+0x68>
+80108709:	83 ec 04             	sub    $0x4,%esp
+8010870c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010870f:	ff 75 f0             	push   -0x10(%ebp)
+80108712:	50                   	push   %eax
+80108713:	6a 01                	push   $0x1
+80108715:	e8 a6 fb ff ff       	call   801082c0 <argptr>
+8010871a:	83 c4 10             	add    $0x10,%esp
+8010871d:	85 c0                	test   %eax,%eax
+8010871f:	78 37                	js     80108758 <sys_read+0x68>
+80108721:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108724:	e8 f7 fe ff ff       	call   80108620 <argfd.constprop.0>
+80108729:	85 c0                	test   %eax,%eax
+8010872b:	78 2b                	js     80108758 <sys_read+0x68>
+  n = fileread(f, p, n);
+8010872d:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+80108730:	83 ec 04             	sub    $0x4,%esp
+80108733:	ff 75 f0             	push   -0x10(%ebp)
+80108736:	ff 75 f4             	push   -0xc(%ebp)
+80108739:	53                   	push   %ebx
+8010873a:	e8 51 89 ff ff       	call   80101090 <fileread>
+8010873f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  fileclose(f);
+80108742:	89 1c 24             	mov    %ebx,(%esp)
+80108745:	e8 16 88 ff ff       	call   80100f60 <fileclose>
+  return n;
+8010874a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+8010874d:	83 c4 10             	add    $0x10,%esp
+}
+80108750:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108753:	c9                   	leave
+80108754:	c3                   	ret
+80108755:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80108758:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010875d:	eb f1                	jmp    80108750 <sys_read+0x60>
+8010875f:	90                   	nop
+
+80108760 <sys_write>:
+{
+80108760:	55                   	push   %ebp
+80108761:	89 e5                	mov    %esp,%ebp
+80108763:	53                   	push   %ebx
+  if(argint(2, &n) < 0 || argptr(1, &p, n) < 0 || argfd(0, 0, &f) < 0)
+80108764:	8d 45 f0             	lea    -0x10(%ebp),%eax
+{
+80108767:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(2, &n) < 0 || argptr(1, &p, n) < 0 || argfd(0, 0, &f) < 0)
+8010876a:	50                   	push   %eax
+8010876b:	6a 02                	push   $0x2
+8010876d:	e8 fe fa ff ff       	call   80108270 <argint>
+80108772:	83 c4 10             	add    $0x10,%esp
+80108775:	85 c0                	test   %eax,%eax
+80108777:	78 4f                	js     801087c8 <sys_write+0x68>
+80108779:	83 ec 04             	sub    $0x4,%esp
+8010877c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010877f:	ff 75 f0             	push   -0x10(%ebp)
+80108782:	50                   	push   %eax
+80108783:	6a 01                	push   $0x1
+80108785:	e8 36 fb ff ff       	call   801082c0 <argptr>
+8010878a:	83 c4 10             	add    $0x10,%esp
+8010878d:	85 c0                	test   %eax,%eax
+8010878f:	78 37                	js     801087c8 <sys_write+0x68>
+80108791:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108794:	e8 87 fe ff ff       	call   80108620 <argfd.constprop.0>
+80108799:	85 c0                	test   %eax,%eax
+8010879b:	78 2b                	js     801087c8 <sys_write+0x68>
+  n = filewrite(f, p, n);
+8010879d:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+801087a0:	83 ec 04             	sub    $0x4,%esp
+801087a3:	ff 75 f0             	push   -0x10(%ebp)
+801087a6:	ff 75 f4             	push   -0xc(%ebp)
+801087a9:	53                   	push   %ebx
+801087aa:	e8 71 89 ff ff       	call   80101120 <filewrite>
+801087af:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  fileclose(f);
+801087b2:	89 1c 24             	mov    %ebx,(%esp)
+801087b5:	e8 a6 87 ff ff       	call   80100f60 <fileclose>
+  return n;
+801087ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+801087bd:	83 c4 10             	add    $0x10,%esp
+}
+801087c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801087c3:	c9                   	leave
+801087c4:	c3                   	ret
+801087c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+801087c8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801087cd:	eb f1                	jmp    801087c0 <sys_write+0x60>
+801087cf:	90                   	nop
+
+801087d0 <sys_close>:
+{
+801087d0:	55                   	push   %ebp
+801087d1:	89 e5                	mov    %esp,%ebp
+801087d3:	57                   	push   %edi
+801087d4:	56                   	push   %esi
+801087d5:	53                   	push   %ebx
+801087d6:	83 ec 1c             	sub    $0x1c,%esp
+  struct fdtable *fdt = myproc()->files;
+801087d9:	e8 22 d2 ff ff       	call   80105a00 <myproc>
+  if(argint(0, &fd) < 0 || fd < 0 || fd >= NOFILE)
+801087de:	83 ec 08             	sub    $0x8,%esp
+  struct fdtable *fdt = myproc()->files;
+801087e1:	8b 58 40             	mov    0x40(%eax),%ebx
+  if(argint(0, &fd) < 0 || fd < 0 || fd >= NOFILE)
+801087e4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801087e7:	50                   	push   %eax
+801087e8:	6a 00                	push   $0x0
+801087ea:	e8 81 fa ff ff       	call   80108270 <argint>
+801087ef:	83 c4 10             	add    $0x10,%esp
+801087f2:	85 c0                	test   %eax,%eax
+801087f4:	78 4a                	js     80108840 <sys_close+0x70>
+801087f6:	83 7d e4 0f          	cmpl   $0xf,-0x1c(%ebp)
+801087fa:	77 44                	ja     80108840 <sys_close+0x70>
+  acquire(&fdt->lock);
+801087fc:	83 ec 0c             	sub    $0xc,%esp
+801087ff:	8d 73 04             	lea    0x4(%ebx),%esi
+80108802:	56                   	push   %esi
+80108803:	e8 c8 f6 ff ff       	call   80107ed0 <acquire>
+  f = fdt->ofile[fd];
+80108808:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010880b:	83 c0 0c             	add    $0xc,%eax
+8010880e:	8b 7c 83 0c          	mov    0xc(%ebx,%eax,4),%edi
+  fdt->ofile[fd] = 0;
+80108812:	c7 44 83 0c 00 00 00 	movl   $0x0,0xc(%ebx,%eax,4)
+80108819:	00 
+  release(&fdt->lock);
+8010881a:	89 34 24             	mov    %esi,(%esp)
+8010881d:	e8 4e f6 ff ff       	call   80107e70 <release>
+  if(f == 0)
+80108822:	83 c4 10             	add    $0x10,%esp
+80108825:	85 ff                	test   %edi,%edi
+80108827:	74 17                	je     80108840 <sys_close+0x70>
+  fileclose(f);
+80108829:	83 ec 0c             	sub    $0xc,%esp
+8010882c:	57                   	push   %edi
+8010882d:	e8 2e 87 ff ff       	call   80100f60 <fileclose>
+  return 0;
+80108832:	83 c4 10             	add    $0x10,%esp
+80108835:	31 c0                	xor    %eax,%eax
+}
+80108837:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010883a:	5b                   	pop    %ebx
+8010883b:	5e                   	pop    %esi
+8010883c:	5f                   	pop    %edi
+8010883d:	5d                   	pop    %ebp
+8010883e:	c3                   	ret
+8010883f:	90                   	nop
+    return -1;
+80108840:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108845:	eb f0                	jmp    80108837 <sys_close+0x67>
+80108847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010884e:	66 90                	xchg   %ax,%ax
+
+80108850 <sys_fstat>:
+{
+80108850:	55                   	push   %ebp
+80108851:	89 e5                	mov    %esp,%ebp
+80108853:	56                   	push   %esi
+80108854:	53                   	push   %ebx
+  if(argptr(1, (void*)&st, sizeof(*st)) < 0 || argfd(0, 0, &f) < 0)
+80108855:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108858:	83 ec 14             	sub    $0x14,%esp
+  if(argptr(1, (void*)&st, sizeof(*st)) < 0 || argfd(0, 0, &f) < 0)
+8010885b:	6a 14                	push   $0x14
+8010885d:	50                   	push   %eax
+8010885e:	6a 01                	push   $0x1
+80108860:	e8 5b fa ff ff       	call   801082c0 <argptr>
+80108865:	83 c4 10             	add    $0x10,%esp
+80108868:	85 c0                	test   %eax,%eax
+8010886a:	78 34                	js     801088a0 <sys_fstat+0x50>
+8010886c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+8010886f:	e8 ac fd ff ff       	call   80108620 <argfd.constprop.0>
+80108874:	85 c0                	test   %eax,%eax
+80108876:	78 28                	js     801088a0 <sys_fstat+0x50>
+  r = filestat(f, st);
+80108878:	8b 75 f0             	mov    -0x10(%ebp),%esi
+8010887b:	83 ec 08             	sub    $0x8,%esp
+8010887e:	ff 75 f4             	push   -0xc(%ebp)
+80108881:	56                   	push   %esi
+80108882:	e8 b9 87 ff ff       	call   80101040 <filestat>
+  fileclose(f);
+80108887:	89 34 24             	mov    %esi,(%esp)
+  r = filestat(f, st);
+8010888a:	89 c3                	mov    %eax,%ebx
+  fileclose(f);
+8010888c:	e8 cf 86 ff ff       	call   80100f60 <fileclose>
+  return r;
+80108891:	83 c4 10             	add    $0x10,%esp
+}
+80108894:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108897:	89 d8                	mov    %ebx,%eax
+80108899:	5b                   	pop    %ebx
+8010889a:	5e                   	pop    %esi
+8010889b:	5d                   	pop    %ebp
+8010889c:	c3                   	ret
+8010889d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+801088a0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801088a5:	eb ed                	jmp    80108894 <sys_fstat+0x44>
+801088a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801088ae:	66 90                	xchg   %ax,%ax
+
+801088b0 <sys_link>:
+{
+801088b0:	55                   	push   %ebp
+801088b1:	89 e5                	mov    %esp,%ebp
+801088b3:	57                   	push   %edi
+801088b4:	56                   	push   %esi
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+801088b5:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+801088b8:	53                   	push   %ebx
+801088b9:	83 ec 34             	sub    $0x34,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+801088bc:	50                   	push   %eax
+801088bd:	6a 00                	push   $0x0
+801088bf:	e8 6c fa ff ff       	call   80108330 <argstr>
+801088c4:	83 c4 10             	add    $0x10,%esp
+801088c7:	85 c0                	test   %eax,%eax
+801088c9:	0f 88 fb 00 00 00    	js     801089ca <sys_link+0x11a>
+801088cf:	83 ec 08             	sub    $0x8,%esp
+801088d2:	8d 45 d0             	lea    -0x30(%ebp),%eax
+801088d5:	50                   	push   %eax
+801088d6:	6a 01                	push   $0x1
+801088d8:	e8 53 fa ff ff       	call   80108330 <argstr>
+801088dd:	83 c4 10             	add    $0x10,%esp
+801088e0:	85 c0                	test   %eax,%eax
+801088e2:	0f 88 e2 00 00 00    	js     801089ca <sys_link+0x11a>
+  begin_op();
+801088e8:	e8 93 a9 ff ff       	call   80103280 <begin_op>
+  if((ip = namei(old)) == 0){
+801088ed:	83 ec 0c             	sub    $0xc,%esp
+801088f0:	ff 75 d4             	push   -0x2c(%ebp)
+801088f3:	e8 48 9c ff ff       	call   80102540 <namei>
+801088f8:	83 c4 10             	add    $0x10,%esp
+801088fb:	89 c3                	mov    %eax,%ebx
+801088fd:	85 c0                	test   %eax,%eax
+801088ff:	0f 84 df 00 00 00    	je     801089e4 <sys_link+0x134>
+  ilock(ip);
+80108905:	83 ec 0c             	sub    $0xc,%esp
+80108908:	50                   	push   %eax
+80108909:	e8 12 93 ff ff       	call   80101c20 <ilock>
+  if(ip->type == T_DIR){
+8010890e:	83 c4 10             	add    $0x10,%esp
+80108911:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80108916:	0f 84 b5 00 00 00    	je     801089d1 <sys_link+0x121>
+  iupdate(ip);
+8010891c:	83 ec 0c             	sub    $0xc,%esp
+  ip->nlink++;
+8010891f:	66 83 43 56 01       	addw   $0x1,0x56(%ebx)
+  if((dp = nameiparent(new, name)) == 0)
+80108924:	8d 7d da             	lea    -0x26(%ebp),%edi
+  iupdate(ip);
+80108927:	53                   	push   %ebx
+80108928:	e8 43 92 ff ff       	call   80101b70 <iupdate>
+  iunlock(ip);
+8010892d:	89 1c 24             	mov    %ebx,(%esp)
+80108930:	e8 cb 93 ff ff       	call   80101d00 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+80108935:	58                   	pop    %eax
+80108936:	5a                   	pop    %edx
+80108937:	57                   	push   %edi
+80108938:	ff 75 d0             	push   -0x30(%ebp)
+8010893b:	e8 20 9c ff ff       	call   80102560 <nameiparent>
+80108940:	83 c4 10             	add    $0x10,%esp
+80108943:	89 c6                	mov    %eax,%esi
+80108945:	85 c0                	test   %eax,%eax
+80108947:	74 5b                	je     801089a4 <sys_link+0xf4>
+  ilock(dp);
+80108949:	83 ec 0c             	sub    $0xc,%esp
+8010894c:	50                   	push   %eax
+8010894d:	e8 ce 92 ff ff       	call   80101c20 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+80108952:	8b 03                	mov    (%ebx),%eax
+80108954:	83 c4 10             	add    $0x10,%esp
+80108957:	39 06                	cmp    %eax,(%esi)
+80108959:	75 3d                	jne    80108998 <sys_link+0xe8>
+8010895b:	83 ec 04             	sub    $0x4,%esp
+8010895e:	ff 73 04             	push   0x4(%ebx)
+80108961:	57                   	push   %edi
+80108962:	56                   	push   %esi
+80108963:	e8 18 9b ff ff       	call   80102480 <dirlink>
+80108968:	83 c4 10             	add    $0x10,%esp
+8010896b:	85 c0                	test   %eax,%eax
+8010896d:	78 29                	js     80108998 <sys_link+0xe8>
+  iunlockput(dp);
+8010896f:	83 ec 0c             	sub    $0xc,%esp
+80108972:	56                   	push   %esi
+80108973:	e8 38 95 ff ff       	call   80101eb0 <iunlockput>
+  iput(ip);
+80108978:	89 1c 24             	mov    %ebx,(%esp)
+8010897b:	e8 d0 93 ff ff       	call   80101d50 <iput>
+  end_op();
+80108980:	e8 6b a9 ff ff       	call   801032f0 <end_op>
+  return 0;
+80108985:	83 c4 10             	add    $0x10,%esp
+80108988:	31 c0                	xor    %eax,%eax
+}
+8010898a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010898d:	5b                   	pop    %ebx
+8010898e:	5e                   	pop    %esi
+8010898f:	5f                   	pop    %edi
+80108990:	5d                   	pop    %ebp
+80108991:	c3                   	ret
+80108992:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(dp);
+80108998:	83 ec 0c             	sub    $0xc,%esp
+8010899b:	56                   	push   %esi
+8010899c:	e8 0f 95 ff ff       	call   80101eb0 <iunlockput>
+    goto bad;
+801089a1:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+801089a4:	83 ec 0c             	sub    $0xc,%esp
+801089a7:	53                   	push   %ebx
+801089a8:	e8 73 92 ff ff       	call   80101c20 <ilock>
+  ip->nlink--;
+801089ad:	66 83 6b 56 01       	subw   $0x1,0x56(%ebx)
+  iupdate(ip);
+801089b2:	89 1c 24             	mov    %ebx,(%esp)
+801089b5:	e8 b6 91 ff ff       	call   80101b70 <iupdate>
+  iunlockput(ip);
+801089ba:	89 1c 24             	mov    %ebx,(%esp)
+801089bd:	e8 ee 94 ff ff       	call   80101eb0 <iunlockput>
+  end_op();
+801089c2:	e8 29 a9 ff ff       	call   801032f0 <end_op>
+  return -1;
+801089c7:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801089ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089cf:	eb b9                	jmp    8010898a <sys_link+0xda>
+    iunlockput(ip);
+801089d1:	83 ec 0c             	sub    $0xc,%esp
+801089d4:	53                   	push   %ebx
+801089d5:	e8 d6 94 ff ff       	call   80101eb0 <iunlockput>
+    end_op();
+801089da:	e8 11 a9 ff ff       	call   801032f0 <end_op>
+    return -1;
+801089df:	83 c4 10             	add    $0x10,%esp
+801089e2:	eb e6                	jmp    801089ca <sys_link+0x11a>
+    end_op();
+801089e4:	e8 07 a9 ff ff       	call   801032f0 <end_op>
+    return -1;
+801089e9:	eb df                	jmp    801089ca <sys_link+0x11a>
+801089eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801089ef:	90                   	nop
+
+801089f0 <sys_unlink>:
+{
+801089f0:	55                   	push   %ebp
+801089f1:	89 e5                	mov    %esp,%ebp
+801089f3:	57                   	push   %edi
+801089f4:	56                   	push   %esi
+  if(argstr(0, &path) < 0)
+801089f5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+{
+801089f8:	53                   	push   %ebx
+801089f9:	83 ec 54             	sub    $0x54,%esp
+  if(argstr(0, &path) < 0)
+801089fc:	50                   	push   %eax
+801089fd:	6a 00                	push   $0x0
+801089ff:	e8 2c f9 ff ff       	call   80108330 <argstr>
+80108a04:	83 c4 10             	add    $0x10,%esp
+80108a07:	85 c0                	test   %eax,%eax
+80108a09:	0f 88 54 01 00 00    	js     80108b63 <sys_unlink+0x173>
+  begin_op();
+80108a0f:	e8 6c a8 ff ff       	call   80103280 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+80108a14:	8d 5d ca             	lea    -0x36(%ebp),%ebx
+80108a17:	83 ec 08             	sub    $0x8,%esp
+80108a1a:	53                   	push   %ebx
+80108a1b:	ff 75 c0             	push   -0x40(%ebp)
+80108a1e:	e8 3d 9b ff ff       	call   80102560 <nameiparent>
+80108a23:	83 c4 10             	add    $0x10,%esp
+80108a26:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+80108a29:	85 c0                	test   %eax,%eax
+80108a2b:	0f 84 58 01 00 00    	je     80108b89 <sys_unlink+0x199>
+  ilock(dp);
+80108a31:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+80108a34:	83 ec 0c             	sub    $0xc,%esp
+80108a37:	57                   	push   %edi
+80108a38:	e8 e3 91 ff ff       	call   80101c20 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+80108a3d:	58                   	pop    %eax
+80108a3e:	5a                   	pop    %edx
+80108a3f:	68 e8 c1 10 80       	push   $0x8010c1e8
+80108a44:	53                   	push   %ebx
+80108a45:	e8 16 97 ff ff       	call   80102160 <namecmp>
+80108a4a:	83 c4 10             	add    $0x10,%esp
+80108a4d:	85 c0                	test   %eax,%eax
+80108a4f:	0f 84 fb 00 00 00    	je     80108b50 <sys_unlink+0x160>
+80108a55:	83 ec 08             	sub    $0x8,%esp
+80108a58:	68 e7 c1 10 80       	push   $0x8010c1e7
+80108a5d:	53                   	push   %ebx
+80108a5e:	e8 fd 96 ff ff       	call   80102160 <namecmp>
+80108a63:	83 c4 10             	add    $0x10,%esp
+80108a66:	85 c0                	test   %eax,%eax
+80108a68:	0f 84 e2 00 00 00    	je     80108b50 <sys_unlink+0x160>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+80108a6e:	83 ec 04             	sub    $0x4,%esp
+80108a71:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+80108a74:	50                   	push   %eax
+80108a75:	53                   	push   %ebx
+80108a76:	57                   	push   %edi
+80108a77:	e8 04 97 ff ff       	call   80102180 <dirlookup>
+80108a7c:	83 c4 10             	add    $0x10,%esp
+80108a7f:	89 c3                	mov    %eax,%ebx
+80108a81:	85 c0                	test   %eax,%eax
+80108a83:	0f 84 c7 00 00 00    	je     80108b50 <sys_unlink+0x160>
+  ilock(ip);
+80108a89:	83 ec 0c             	sub    $0xc,%esp
+80108a8c:	50                   	push   %eax
+80108a8d:	e8 8e 91 ff ff       	call   80101c20 <ilock>
+  if(ip->nlink < 1)
+80108a92:	83 c4 10             	add    $0x10,%esp
+80108a95:	66 83 7b 56 00       	cmpw   $0x0,0x56(%ebx)
+80108a9a:	0f 8e 0a 01 00 00    	jle    80108baa <sys_unlink+0x1ba>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+80108aa0:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80108aa5:	8d 7d d8             	lea    -0x28(%ebp),%edi
+80108aa8:	74 66                	je     80108b10 <sys_unlink+0x120>
+  memset(&de, 0, sizeof(de));
+80108aaa:	83 ec 04             	sub    $0x4,%esp
+80108aad:	6a 10                	push   $0x10
+80108aaf:	6a 00                	push   $0x0
+80108ab1:	57                   	push   %edi
+80108ab2:	e8 f9 f4 ff ff       	call   80107fb0 <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80108ab7:	6a 10                	push   $0x10
+80108ab9:	ff 75 c4             	push   -0x3c(%ebp)
+80108abc:	57                   	push   %edi
+80108abd:	ff 75 b4             	push   -0x4c(%ebp)
+80108ac0:	e8 6b 95 ff ff       	call   80102030 <writei>
+80108ac5:	83 c4 20             	add    $0x20,%esp
+80108ac8:	83 f8 10             	cmp    $0x10,%eax
+80108acb:	0f 85 cc 00 00 00    	jne    80108b9d <sys_unlink+0x1ad>
+  if(ip->type == T_DIR){
+80108ad1:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80108ad6:	0f 84 94 00 00 00    	je     80108b70 <sys_unlink+0x180>
+  iunlockput(dp);
+80108adc:	83 ec 0c             	sub    $0xc,%esp
+80108adf:	ff 75 b4             	push   -0x4c(%ebp)
+80108ae2:	e8 c9 93 ff ff       	call   80101eb0 <iunlockput>
+  ip->nlink--;
+80108ae7:	66 83 6b 56 01       	subw   $0x1,0x56(%ebx)
+  iupdate(ip);
+80108aec:	89 1c 24             	mov    %ebx,(%esp)
+80108aef:	e8 7c 90 ff ff       	call   80101b70 <iupdate>
+  iunlockput(ip);
+80108af4:	89 1c 24             	mov    %ebx,(%esp)
+80108af7:	e8 b4 93 ff ff       	call   80101eb0 <iunlockput>
+  end_op();
+80108afc:	e8 ef a7 ff ff       	call   801032f0 <end_op>
+  return 0;
+80108b01:	83 c4 10             	add    $0x10,%esp
+80108b04:	31 c0                	xor    %eax,%eax
+}
+80108b06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108b09:	5b                   	pop    %ebx
+80108b0a:	5e                   	pop    %esi
+80108b0b:	5f                   	pop    %edi
+80108b0c:	5d                   	pop    %ebp
+80108b0d:	c3                   	ret
+80108b0e:	66 90                	xchg   %ax,%ax
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80108b10:	83 7b 58 20          	cmpl   $0x20,0x58(%ebx)
+80108b14:	76 94                	jbe    80108aaa <sys_unlink+0xba>
+80108b16:	be 20 00 00 00       	mov    $0x20,%esi
+80108b1b:	eb 0b                	jmp    80108b28 <sys_unlink+0x138>
+80108b1d:	8d 76 00             	lea    0x0(%esi),%esi
+80108b20:	83 c6 10             	add    $0x10,%esi
+80108b23:	3b 73 58             	cmp    0x58(%ebx),%esi
+80108b26:	73 82                	jae    80108aaa <sys_unlink+0xba>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80108b28:	6a 10                	push   $0x10
+80108b2a:	56                   	push   %esi
+80108b2b:	57                   	push   %edi
+80108b2c:	53                   	push   %ebx
+80108b2d:	e8 fe 93 ff ff       	call   80101f30 <readi>
+80108b32:	83 c4 10             	add    $0x10,%esp
+80108b35:	83 f8 10             	cmp    $0x10,%eax
+80108b38:	75 56                	jne    80108b90 <sys_unlink+0x1a0>
+    if(de.inum != 0)
+80108b3a:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80108b3f:	74 df                	je     80108b20 <sys_unlink+0x130>
+    iunlockput(ip);
+80108b41:	83 ec 0c             	sub    $0xc,%esp
+80108b44:	53                   	push   %ebx
+80108b45:	e8 66 93 ff ff       	call   80101eb0 <iunlockput>
+    goto bad;
+80108b4a:	83 c4 10             	add    $0x10,%esp
+80108b4d:	8d 76 00             	lea    0x0(%esi),%esi
+  iunlockput(dp);
+80108b50:	83 ec 0c             	sub    $0xc,%esp
+80108b53:	ff 75 b4             	push   -0x4c(%ebp)
+80108b56:	e8 55 93 ff ff       	call   80101eb0 <iunlockput>
+  end_op();
+80108b5b:	e8 90 a7 ff ff       	call   801032f0 <end_op>
+  return -1;
+80108b60:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108b63:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108b68:	eb 9c                	jmp    80108b06 <sys_unlink+0x116>
+80108b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    dp->nlink--;
+80108b70:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    iupdate(dp);
+80108b73:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink--;
+80108b76:	66 83 68 56 01       	subw   $0x1,0x56(%eax)
+    iupdate(dp);
+80108b7b:	50                   	push   %eax
+80108b7c:	e8 ef 8f ff ff       	call   80101b70 <iupdate>
+80108b81:	83 c4 10             	add    $0x10,%esp
+80108b84:	e9 53 ff ff ff       	jmp    80108adc <sys_unlink+0xec>
+    end_op();
+80108b89:	e8 62 a7 ff ff       	call   801032f0 <end_op>
+    return -1;
+80108b8e:	eb d3                	jmp    80108b63 <sys_unlink+0x173>
+      panic("isdirempty: readi");
+80108b90:	83 ec 0c             	sub    $0xc,%esp
+80108b93:	68 0c c2 10 80       	push   $0x8010c20c
+80108b98:	e8 e3 77 ff ff       	call   80100380 <panic>
+    panic("unlink: writei");
+80108b9d:	83 ec 0c             	sub    $0xc,%esp
+80108ba0:	68 1e c2 10 80       	push   $0x8010c21e
+80108ba5:	e8 d6 77 ff ff       	call   80100380 <panic>
+    panic("unlink: nlink < 1");
+80108baa:	83 ec 0c             	sub    $0xc,%esp
+80108bad:	68 fa c1 10 80       	push   $0x8010c1fa
+80108bb2:	e8 c9 77 ff ff       	call   80100380 <panic>
+80108bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108bbe:	66 90                	xchg   %ax,%ax
+
+80108bc0 <sys_open>:
+
+int
+sys_open(void)
+{
+80108bc0:	55                   	push   %ebp
+80108bc1:	89 e5                	mov    %esp,%ebp
+80108bc3:	57                   	push   %edi
+80108bc4:	56                   	push   %esi
+  char *path;
+  int fd, omode;
+  struct file *f;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+80108bc5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+80108bc8:	53                   	push   %ebx
+80108bc9:	83 ec 24             	sub    $0x24,%esp
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+80108bcc:	50                   	push   %eax
+80108bcd:	6a 00                	push   $0x0
+80108bcf:	e8 5c f7 ff ff       	call   80108330 <argstr>
+80108bd4:	83 c4 10             	add    $0x10,%esp
+80108bd7:	85 c0                	test   %eax,%eax
+80108bd9:	0f 88 e1 00 00 00    	js     80108cc0 <sys_open+0x100>
+80108bdf:	83 ec 08             	sub    $0x8,%esp
+80108be2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108be5:	50                   	push   %eax
+80108be6:	6a 01                	push   $0x1
+80108be8:	e8 83 f6 ff ff       	call   80108270 <argint>
+80108bed:	83 c4 10             	add    $0x10,%esp
+80108bf0:	85 c0                	test   %eax,%eax
+80108bf2:	0f 88 c8 00 00 00    	js     80108cc0 <sys_open+0x100>
+    return -1;
+
+  begin_op();
+80108bf8:	e8 83 a6 ff ff       	call   80103280 <begin_op>
+
+  if(omode & O_CREATE){
+80108bfd:	f6 45 e5 02          	testb  $0x2,-0x1b(%ebp)
+80108c01:	0f 85 91 00 00 00    	jne    80108c98 <sys_open+0xd8>
+    if(ip == 0){
+      end_op();
+      return -1;
+    }
+  } else {
+    if((ip = namei(path)) == 0){
+80108c07:	83 ec 0c             	sub    $0xc,%esp
+80108c0a:	ff 75 e0             	push   -0x20(%ebp)
+80108c0d:	e8 2e 99 ff ff       	call   80102540 <namei>
+80108c12:	83 c4 10             	add    $0x10,%esp
+80108c15:	89 c6                	mov    %eax,%esi
+80108c17:	85 c0                	test   %eax,%eax
+80108c19:	0f 84 96 00 00 00    	je     80108cb5 <sys_open+0xf5>
+      end_op();
+      return -1;
+    }
+    ilock(ip);
+80108c1f:	83 ec 0c             	sub    $0xc,%esp
+80108c22:	50                   	push   %eax
+80108c23:	e8 f8 8f ff ff       	call   80101c20 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80108c28:	83 c4 10             	add    $0x10,%esp
+80108c2b:	66 83 7e 50 01       	cmpw   $0x1,0x50(%esi)
+80108c30:	0f 84 9a 00 00 00    	je     80108cd0 <sys_open+0x110>
+      end_op();
+      return -1;
+    }
+  }
+
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+80108c36:	e8 65 82 ff ff       	call   80100ea0 <filealloc>
+80108c3b:	89 c3                	mov    %eax,%ebx
+80108c3d:	85 c0                	test   %eax,%eax
+80108c3f:	0f 84 9b 00 00 00    	je     80108ce0 <sys_open+0x120>
+80108c45:	e8 d6 f7 ff ff       	call   80108420 <fdalloc>
+80108c4a:	89 c7                	mov    %eax,%edi
+80108c4c:	85 c0                	test   %eax,%eax
+80108c4e:	0f 88 9f 00 00 00    	js     80108cf3 <sys_open+0x133>
+      fileclose(f);
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+80108c54:	83 ec 0c             	sub    $0xc,%esp
+80108c57:	56                   	push   %esi
+80108c58:	e8 a3 90 ff ff       	call   80101d00 <iunlock>
+  end_op();
+80108c5d:	e8 8e a6 ff ff       	call   801032f0 <end_op>
+
+  f->type = FD_INODE;
+80108c62:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  f->ip = ip;
+  f->off = 0;
+  f->readable = !(omode & O_WRONLY);
+80108c68:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80108c6b:	83 c4 10             	add    $0x10,%esp
+  f->ip = ip;
+80108c6e:	89 73 10             	mov    %esi,0x10(%ebx)
+  f->readable = !(omode & O_WRONLY);
+80108c71:	89 d0                	mov    %edx,%eax
+  f->off = 0;
+80108c73:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+  f->readable = !(omode & O_WRONLY);
+80108c7a:	f7 d0                	not    %eax
+80108c7c:	83 e0 01             	and    $0x1,%eax
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80108c7f:	83 e2 03             	and    $0x3,%edx
+  f->readable = !(omode & O_WRONLY);
+80108c82:	88 43 08             	mov    %al,0x8(%ebx)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80108c85:	0f 95 43 09          	setne  0x9(%ebx)
+  return fd;
+}
+80108c89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108c8c:	89 f8                	mov    %edi,%eax
+80108c8e:	5b                   	pop    %ebx
+80108c8f:	5e                   	pop    %esi
+80108c90:	5f                   	pop    %edi
+80108c91:	5d                   	pop    %ebp
+80108c92:	c3                   	ret
+80108c93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108c97:	90                   	nop
+    ip = create(path, T_FILE, 0, 0);
+80108c98:	83 ec 0c             	sub    $0xc,%esp
+80108c9b:	31 c9                	xor    %ecx,%ecx
+80108c9d:	ba 02 00 00 00       	mov    $0x2,%edx
+80108ca2:	6a 00                	push   $0x0
+80108ca4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80108ca7:	e8 f4 f7 ff ff       	call   801084a0 <create>
+    if(ip == 0){
+80108cac:	83 c4 10             	add    $0x10,%esp
+    ip = create(path, T_FILE, 0, 0);
+80108caf:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+80108cb1:	85 c0                	test   %eax,%eax
+80108cb3:	75 81                	jne    80108c36 <sys_open+0x76>
+      end_op();
+80108cb5:	e8 36 a6 ff ff       	call   801032f0 <end_op>
+      return -1;
+80108cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80108cc0:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80108cc5:	eb c2                	jmp    80108c89 <sys_open+0xc9>
+80108cc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108cce:	66 90                	xchg   %ax,%ax
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80108cd0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80108cd3:	85 c0                	test   %eax,%eax
+80108cd5:	0f 84 5b ff ff ff    	je     80108c36 <sys_open+0x76>
+80108cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108cdf:	90                   	nop
+    iunlockput(ip);
+80108ce0:	83 ec 0c             	sub    $0xc,%esp
+80108ce3:	56                   	push   %esi
+80108ce4:	e8 c7 91 ff ff       	call   80101eb0 <iunlockput>
+    end_op();
+80108ce9:	e8 02 a6 ff ff       	call   801032f0 <end_op>
+    return -1;
+80108cee:	83 c4 10             	add    $0x10,%esp
+80108cf1:	eb cd                	jmp    80108cc0 <sys_open+0x100>
+      fileclose(f);
+80108cf3:	83 ec 0c             	sub    $0xc,%esp
+80108cf6:	53                   	push   %ebx
+80108cf7:	e8 64 82 ff ff       	call   80100f60 <fileclose>
+80108cfc:	83 c4 10             	add    $0x10,%esp
+80108cff:	eb df                	jmp    80108ce0 <sys_open+0x120>
+80108d01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d0f:	90                   	nop
+
+80108d10 <sys_mkdir>:
+
+int
+sys_mkdir(void)
+{
+80108d10:	55                   	push   %ebp
+80108d11:	89 e5                	mov    %esp,%ebp
+80108d13:	83 ec 18             	sub    $0x18,%esp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+80108d16:	e8 65 a5 ff ff       	call   80103280 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+80108d1b:	83 ec 08             	sub    $0x8,%esp
+80108d1e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108d21:	50                   	push   %eax
+80108d22:	6a 00                	push   $0x0
+80108d24:	e8 07 f6 ff ff       	call   80108330 <argstr>
+80108d29:	83 c4 10             	add    $0x10,%esp
+80108d2c:	85 c0                	test   %eax,%eax
+80108d2e:	78 30                	js     80108d60 <sys_mkdir+0x50>
+80108d30:	83 ec 0c             	sub    $0xc,%esp
+80108d33:	31 c9                	xor    %ecx,%ecx
+80108d35:	ba 01 00 00 00       	mov    $0x1,%edx
+80108d3a:	6a 00                	push   $0x0
+80108d3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108d3f:	e8 5c f7 ff ff       	call   801084a0 <create>
+80108d44:	83 c4 10             	add    $0x10,%esp
+80108d47:	85 c0                	test   %eax,%eax
+80108d49:	74 15                	je     80108d60 <sys_mkdir+0x50>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+80108d4b:	83 ec 0c             	sub    $0xc,%esp
+80108d4e:	50                   	push   %eax
+80108d4f:	e8 5c 91 ff ff       	call   80101eb0 <iunlockput>
+  end_op();
+80108d54:	e8 97 a5 ff ff       	call   801032f0 <end_op>
+  return 0;
+80108d59:	83 c4 10             	add    $0x10,%esp
+80108d5c:	31 c0                	xor    %eax,%eax
+}
+80108d5e:	c9                   	leave
+80108d5f:	c3                   	ret
+    end_op();
+80108d60:	e8 8b a5 ff ff       	call   801032f0 <end_op>
+    return -1;
+80108d65:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108d6a:	c9                   	leave
+80108d6b:	c3                   	ret
+80108d6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108d70 <sys_mknod>:
+
+int
+sys_mknod(void)
+{
+80108d70:	55                   	push   %ebp
+80108d71:	89 e5                	mov    %esp,%ebp
+80108d73:	83 ec 18             	sub    $0x18,%esp
+  struct inode *ip;
+  char *path;
+  int major, minor;
+
+  begin_op();
+80108d76:	e8 05 a5 ff ff       	call   80103280 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+80108d7b:	83 ec 08             	sub    $0x8,%esp
+80108d7e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108d81:	50                   	push   %eax
+80108d82:	6a 00                	push   $0x0
+80108d84:	e8 a7 f5 ff ff       	call   80108330 <argstr>
+80108d89:	83 c4 10             	add    $0x10,%esp
+80108d8c:	85 c0                	test   %eax,%eax
+80108d8e:	78 60                	js     80108df0 <sys_mknod+0x80>
+     argint(1, &major) < 0 ||
+80108d90:	83 ec 08             	sub    $0x8,%esp
+80108d93:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108d96:	50                   	push   %eax
+80108d97:	6a 01                	push   $0x1
+80108d99:	e8 d2 f4 ff ff       	call   80108270 <argint>
+  if((argstr(0, &path)) < 0 ||
+80108d9e:	83 c4 10             	add    $0x10,%esp
+80108da1:	85 c0                	test   %eax,%eax
+80108da3:	78 4b                	js     80108df0 <sys_mknod+0x80>
+     argint(2, &minor) < 0 ||
+80108da5:	83 ec 08             	sub    $0x8,%esp
+80108da8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108dab:	50                   	push   %eax
+80108dac:	6a 02                	push   $0x2
+80108dae:	e8 bd f4 ff ff       	call   80108270 <argint>
+     argint(1, &major) < 0 ||
+80108db3:	83 c4 10             	add    $0x10,%esp
+80108db6:	85 c0                	test   %eax,%eax
+80108db8:	78 36                	js     80108df0 <sys_mknod+0x80>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+80108dba:	0f bf 45 f4          	movswl -0xc(%ebp),%eax
+80108dbe:	83 ec 0c             	sub    $0xc,%esp
+80108dc1:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+80108dc5:	ba 03 00 00 00       	mov    $0x3,%edx
+80108dca:	50                   	push   %eax
+80108dcb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+80108dce:	e8 cd f6 ff ff       	call   801084a0 <create>
+     argint(2, &minor) < 0 ||
+80108dd3:	83 c4 10             	add    $0x10,%esp
+80108dd6:	85 c0                	test   %eax,%eax
+80108dd8:	74 16                	je     80108df0 <sys_mknod+0x80>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+80108dda:	83 ec 0c             	sub    $0xc,%esp
+80108ddd:	50                   	push   %eax
+80108dde:	e8 cd 90 ff ff       	call   80101eb0 <iunlockput>
+  end_op();
+80108de3:	e8 08 a5 ff ff       	call   801032f0 <end_op>
+  return 0;
+80108de8:	83 c4 10             	add    $0x10,%esp
+80108deb:	31 c0                	xor    %eax,%eax
+}
+80108ded:	c9                   	leave
+80108dee:	c3                   	ret
+80108def:	90                   	nop
+    end_op();
+80108df0:	e8 fb a4 ff ff       	call   801032f0 <end_op>
+    return -1;
+80108df5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108dfa:	c9                   	leave
+80108dfb:	c3                   	ret
+80108dfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108e00 <sys_chdir>:
+
+int
+sys_chdir(void)
+{
+80108e00:	55                   	push   %ebp
+80108e01:	89 e5                	mov    %esp,%ebp
+80108e03:	56                   	push   %esi
+80108e04:	53                   	push   %ebx
+80108e05:	83 ec 10             	sub    $0x10,%esp
+  char *path;
+  struct inode *ip;
+  struct proc *curproc = myproc();
+80108e08:	e8 f3 cb ff ff       	call   80105a00 <myproc>
+80108e0d:	89 c6                	mov    %eax,%esi
+  
+  begin_op();
+80108e0f:	e8 6c a4 ff ff       	call   80103280 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+80108e14:	83 ec 08             	sub    $0x8,%esp
+80108e17:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108e1a:	50                   	push   %eax
+80108e1b:	6a 00                	push   $0x0
+80108e1d:	e8 0e f5 ff ff       	call   80108330 <argstr>
+80108e22:	83 c4 10             	add    $0x10,%esp
+80108e25:	85 c0                	test   %eax,%eax
+80108e27:	78 77                	js     80108ea0 <sys_chdir+0xa0>
+80108e29:	83 ec 0c             	sub    $0xc,%esp
+80108e2c:	ff 75 f4             	push   -0xc(%ebp)
+80108e2f:	e8 0c 97 ff ff       	call   80102540 <namei>
+80108e34:	83 c4 10             	add    $0x10,%esp
+80108e37:	89 c3                	mov    %eax,%ebx
+80108e39:	85 c0                	test   %eax,%eax
+80108e3b:	74 63                	je     80108ea0 <sys_chdir+0xa0>
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+80108e3d:	83 ec 0c             	sub    $0xc,%esp
+80108e40:	50                   	push   %eax
+80108e41:	e8 da 8d ff ff       	call   80101c20 <ilock>
+  if(ip->type != T_DIR){
+80108e46:	83 c4 10             	add    $0x10,%esp
+80108e49:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80108e4e:	75 30                	jne    80108e80 <sys_chdir+0x80>
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+80108e50:	83 ec 0c             	sub    $0xc,%esp
+80108e53:	53                   	push   %ebx
+80108e54:	e8 a7 8e ff ff       	call   80101d00 <iunlock>
+  iput(cwdset(curproc->cwd, ip));
+80108e59:	58                   	pop    %eax
+80108e5a:	5a                   	pop    %edx
+80108e5b:	53                   	push   %ebx
+80108e5c:	ff 76 44             	push   0x44(%esi)
+80108e5f:	e8 cc 87 ff ff       	call   80101630 <cwdset>
+80108e64:	89 04 24             	mov    %eax,(%esp)
+80108e67:	e8 e4 8e ff ff       	call   80101d50 <iput>
+  end_op();
+80108e6c:	e8 7f a4 ff ff       	call   801032f0 <end_op>
+  return 0;
+80108e71:	83 c4 10             	add    $0x10,%esp
+80108e74:	31 c0                	xor    %eax,%eax
+}
+80108e76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108e79:	5b                   	pop    %ebx
+80108e7a:	5e                   	pop    %esi
+80108e7b:	5d                   	pop    %ebp
+80108e7c:	c3                   	ret
+80108e7d:	8d 76 00             	lea    0x0(%esi),%esi
+    iunlockput(ip);
+80108e80:	83 ec 0c             	sub    $0xc,%esp
+80108e83:	53                   	push   %ebx
+80108e84:	e8 27 90 ff ff       	call   80101eb0 <iunlockput>
+    end_op();
+80108e89:	e8 62 a4 ff ff       	call   801032f0 <end_op>
+    return -1;
+80108e8e:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108e91:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108e96:	eb de                	jmp    80108e76 <sys_chdir+0x76>
+80108e98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108e9f:	90                   	nop
+    end_op();
+80108ea0:	e8 4b a4 ff ff       	call   801032f0 <end_op>
+    return -1;
+80108ea5:	eb ea                	jmp    80108e91 <sys_chdir+0x91>
+80108ea7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108eae:	66 90                	xchg   %ax,%ax
+
+80108eb0 <sys_exec>:
+
+int
+sys_exec(void)
+{
+80108eb0:	55                   	push   %ebp
+80108eb1:	89 e5                	mov    %esp,%ebp
+80108eb3:	57                   	push   %edi
+80108eb4:	56                   	push   %esi
+  char *path, *argv[MAXARG];
+  int i;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80108eb5:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+{
+80108ebb:	53                   	push   %ebx
+80108ebc:	81 ec a4 00 00 00    	sub    $0xa4,%esp
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80108ec2:	50                   	push   %eax
+80108ec3:	6a 00                	push   $0x0
+80108ec5:	e8 66 f4 ff ff       	call   80108330 <argstr>
+80108eca:	83 c4 10             	add    $0x10,%esp
+80108ecd:	85 c0                	test   %eax,%eax
+80108ecf:	0f 88 87 00 00 00    	js     80108f5c <sys_exec+0xac>
+80108ed5:	83 ec 08             	sub    $0x8,%esp
+80108ed8:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+80108ede:	50                   	push   %eax
+80108edf:	6a 01                	push   $0x1
+80108ee1:	e8 8a f3 ff ff       	call   80108270 <argint>
+80108ee6:	83 c4 10             	add    $0x10,%esp
+80108ee9:	85 c0                	test   %eax,%eax
+80108eeb:	78 6f                	js     80108f5c <sys_exec+0xac>
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+80108eed:	83 ec 04             	sub    $0x4,%esp
+80108ef0:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+  for(i=0;; i++){
+80108ef6:	31 db                	xor    %ebx,%ebx
+  memset(argv, 0, sizeof(argv));
+80108ef8:	68 80 00 00 00       	push   $0x80
+80108efd:	6a 00                	push   $0x0
+80108eff:	56                   	push   %esi
+80108f00:	e8 ab f0 ff ff       	call   80107fb0 <memset>
+80108f05:	83 c4 10             	add    $0x10,%esp
+80108f08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108f0f:	90                   	nop
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+80108f10:	83 ec 08             	sub    $0x8,%esp
+80108f13:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+80108f19:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+80108f20:	50                   	push   %eax
+80108f21:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+80108f27:	01 f8                	add    %edi,%eax
+80108f29:	50                   	push   %eax
+80108f2a:	e8 a1 f2 ff ff       	call   801081d0 <fetchint>
+80108f2f:	83 c4 10             	add    $0x10,%esp
+80108f32:	85 c0                	test   %eax,%eax
+80108f34:	78 26                	js     80108f5c <sys_exec+0xac>
+      return -1;
+    if(uarg == 0){
+80108f36:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+80108f3c:	85 c0                	test   %eax,%eax
+80108f3e:	74 30                	je     80108f70 <sys_exec+0xc0>
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+80108f40:	83 ec 08             	sub    $0x8,%esp
+80108f43:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+80108f46:	52                   	push   %edx
+80108f47:	50                   	push   %eax
+80108f48:	e8 c3 f2 ff ff       	call   80108210 <fetchstr>
+80108f4d:	83 c4 10             	add    $0x10,%esp
+80108f50:	85 c0                	test   %eax,%eax
+80108f52:	78 08                	js     80108f5c <sys_exec+0xac>
+  for(i=0;; i++){
+80108f54:	83 c3 01             	add    $0x1,%ebx
+    if(i >= NELEM(argv))
+80108f57:	83 fb 20             	cmp    $0x20,%ebx
+80108f5a:	75 b4                	jne    80108f10 <sys_exec+0x60>
+      return -1;
+  }
+  return exec(path, argv);
+}
+80108f5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+80108f5f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108f64:	5b                   	pop    %ebx
+80108f65:	5e                   	pop    %esi
+80108f66:	5f                   	pop    %edi
+80108f67:	5d                   	pop    %ebp
+80108f68:	c3                   	ret
+80108f69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      argv[i] = 0;
+80108f70:	c7 84 9d 68 ff ff ff 	movl   $0x0,-0x98(%ebp,%ebx,4)
+80108f77:	00 00 00 00 
+  return exec(path, argv);
+80108f7b:	83 ec 08             	sub    $0x8,%esp
+80108f7e:	56                   	push   %esi
+80108f7f:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+80108f85:	e8 56 7b ff ff       	call   80100ae0 <exec>
+80108f8a:	83 c4 10             	add    $0x10,%esp
+}
+80108f8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108f90:	5b                   	pop    %ebx
+80108f91:	5e                   	pop    %esi
+80108f92:	5f                   	pop    %edi
+80108f93:	5d                   	pop    %ebp
+80108f94:	c3                   	ret
+80108f95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108f9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108fa0 <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+80108fa0:	55                   	push   %ebp
+80108fa1:	89 e5                	mov    %esp,%ebp
+80108fa3:	53                   	push   %ebx
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+80108fa4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+{
+80108fa7:	83 ec 18             	sub    $0x18,%esp
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+80108faa:	6a 08                	push   $0x8
+80108fac:	50                   	push   %eax
+80108fad:	6a 00                	push   $0x0
+80108faf:	e8 0c f3 ff ff       	call   801082c0 <argptr>
+80108fb4:	83 c4 10             	add    $0x10,%esp
+80108fb7:	85 c0                	test   %eax,%eax
+80108fb9:	0f 88 94 00 00 00    	js     80109053 <sys_pipe+0xb3>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+80108fbf:	83 ec 08             	sub    $0x8,%esp
+80108fc2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108fc5:	50                   	push   %eax
+80108fc6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108fc9:	50                   	push   %eax
+80108fca:	e8 a1 a9 ff ff       	call   80103970 <pipealloc>
+80108fcf:	83 c4 10             	add    $0x10,%esp
+80108fd2:	85 c0                	test   %eax,%eax
+80108fd4:	78 7d                	js     80109053 <sys_pipe+0xb3>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80108fd6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80108fd9:	e8 42 f4 ff ff       	call   80108420 <fdalloc>
+80108fde:	89 c3                	mov    %eax,%ebx
+80108fe0:	85 c0                	test   %eax,%eax
+80108fe2:	78 58                	js     8010903c <sys_pipe+0x9c>
+80108fe4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108fe7:	e8 34 f4 ff ff       	call   80108420 <fdalloc>
+80108fec:	85 c0                	test   %eax,%eax
+80108fee:	78 12                	js     80109002 <sys_pipe+0x62>
+    }
+    fileclose(rf);
+    fileclose(wf);
+    return -1;
+  }
+  fd[0] = fd0;
+80108ff0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+80108ff3:	89 1a                	mov    %ebx,(%edx)
+  fd[1] = fd1;
+80108ff5:	8b 55 ec             	mov    -0x14(%ebp),%edx
+80108ff8:	89 42 04             	mov    %eax,0x4(%edx)
+  return 0;
+80108ffb:	31 c0                	xor    %eax,%eax
+}
+80108ffd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109000:	c9                   	leave
+80109001:	c3                   	ret
+      acquire(&myproc()->files->lock);
+80109002:	e8 f9 c9 ff ff       	call   80105a00 <myproc>
+80109007:	83 ec 0c             	sub    $0xc,%esp
+8010900a:	8b 40 40             	mov    0x40(%eax),%eax
+8010900d:	83 c0 04             	add    $0x4,%eax
+80109010:	50                   	push   %eax
+80109011:	e8 ba ee ff ff       	call   80107ed0 <acquire>
+      myproc()->files->ofile[fd0] = 0;
+80109016:	e8 e5 c9 ff ff       	call   80105a00 <myproc>
+8010901b:	8b 40 40             	mov    0x40(%eax),%eax
+8010901e:	c7 44 98 3c 00 00 00 	movl   $0x0,0x3c(%eax,%ebx,4)
+80109025:	00 
+      release(&myproc()->files->lock);
+80109026:	e8 d5 c9 ff ff       	call   80105a00 <myproc>
+8010902b:	8b 40 40             	mov    0x40(%eax),%eax
+8010902e:	83 c0 04             	add    $0x4,%eax
+80109031:	89 04 24             	mov    %eax,(%esp)
+80109034:	e8 37 ee ff ff       	call   80107e70 <release>
+80109039:	83 c4 10             	add    $0x10,%esp
+    fileclose(rf);
+8010903c:	83 ec 0c             	sub    $0xc,%esp
+8010903f:	ff 75 f0             	push   -0x10(%ebp)
+80109042:	e8 19 7f ff ff       	call   80100f60 <fileclose>
+    fileclose(wf);
+80109047:	58                   	pop    %eax
+80109048:	ff 75 f4             	push   -0xc(%ebp)
+8010904b:	e8 10 7f ff ff       	call   80100f60 <fileclose>
+    return -1;
+80109050:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80109053:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109058:	eb a3                	jmp    80108ffd <sys_pipe+0x5d>
+8010905a:	66 90                	xchg   %ax,%ax
+8010905c:	66 90                	xchg   %ax,%ax
+8010905e:	66 90                	xchg   %ax,%ax
+
+80109060 <sys_fork>:
+
+
+int
+sys_fork(void)
+{
+  return fork();
+80109060:	e9 bb cb ff ff       	jmp    80105c20 <fork>
+80109065:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010906c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80109070 <sys_exit>:
+}
+
+int
+sys_exit(void)
+{
+80109070:	55                   	push   %ebp
+80109071:	89 e5                	mov    %esp,%ebp
+80109073:	83 ec 08             	sub    $0x8,%esp
+  exit();
+80109076:	e8 e5 d2 ff ff       	call   80106360 <exit>
+  return 0;  // not reached
+}
+8010907b:	31 c0                	xor    %eax,%eax
+8010907d:	c9                   	leave
+8010907e:	c3                   	ret
+8010907f:	90                   	nop
+
+80109080 <sys_wait>:
+
+int
+sys_wait(void)
+{
+  return wait();
+80109080:	e9 1b d4 ff ff       	jmp    801064a0 <wait>
+80109085:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010908c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80109090 <sys_kill>:
+}
+
+int
+sys_kill(void)
+{
+80109090:	55                   	push   %ebp
+80109091:	89 e5                	mov    %esp,%ebp
+80109093:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80109096:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109099:	50                   	push   %eax
+8010909a:	6a 00                	push   $0x0
+8010909c:	e8 cf f1 ff ff       	call   80108270 <argint>
+801090a1:	83 c4 10             	add    $0x10,%esp
+801090a4:	85 c0                	test   %eax,%eax
+801090a6:	78 18                	js     801090c0 <sys_kill+0x30>
+    return -1;
+  return kill(pid);
+801090a8:	83 ec 0c             	sub    $0xc,%esp
+801090ab:	ff 75 f4             	push   -0xc(%ebp)
+801090ae:	e8 dd d7 ff ff       	call   80106890 <kill>
+801090b3:	83 c4 10             	add    $0x10,%esp
+}
+801090b6:	c9                   	leave
+801090b7:	c3                   	ret
+801090b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801090bf:	90                   	nop
+801090c0:	c9                   	leave
+    return -1;
+801090c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801090c6:	c3                   	ret
+801090c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801090ce:	66 90                	xchg   %ax,%ax
+
+801090d0 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+801090d0:	55                   	push   %ebp
+801090d1:	89 e5                	mov    %esp,%ebp
+801090d3:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+801090d6:	e8 25 c9 ff ff       	call   80105a00 <myproc>
+801090db:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+801090de:	c9                   	leave
+801090df:	c3                   	ret
+
+801090e0 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+801090e0:	55                   	push   %ebp
+801090e1:	89 e5                	mov    %esp,%ebp
+801090e3:	83 ec 20             	sub    $0x20,%esp
+  int n;
+
+  if(argint(0, &n) < 0)
+801090e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801090e9:	50                   	push   %eax
+801090ea:	6a 00                	push   $0x0
+801090ec:	e8 7f f1 ff ff       	call   80108270 <argint>
+801090f1:	83 c4 10             	add    $0x10,%esp
+801090f4:	85 c0                	test   %eax,%eax
+801090f6:	78 18                	js     80109110 <sys_sbrk+0x30>
+    return -1;
+  return growproc(n);
+801090f8:	83 ec 0c             	sub    $0xc,%esp
+801090fb:	ff 75 f4             	push   -0xc(%ebp)
+801090fe:	e8 5d ca ff ff       	call   80105b60 <growproc>
+80109103:	83 c4 10             	add    $0x10,%esp
+}
+80109106:	c9                   	leave
+80109107:	c3                   	ret
+80109108:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010910f:	90                   	nop
+80109110:	c9                   	leave
+    return -1;
+80109111:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109116:	c3                   	ret
+80109117:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010911e:	66 90                	xchg   %ax,%ax
+
+80109120 <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+80109120:	55                   	push   %ebp
+80109121:	89 e5                	mov    %esp,%ebp
+80109123:	53                   	push   %ebx
+  int n;
+  uint ticks0;
+
+  if(argint(0, &n) < 0)
+80109124:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80109127:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+8010912a:	50                   	push   %eax
+8010912b:	6a 00                	push   $0x0
+8010912d:	e8 3e f1 ff ff       	call   80108270 <argint>
+80109132:	83 c4 10             	add    $0x10,%esp
+80109135:	85 c0                	test   %eax,%eax
+80109137:	78 64                	js     8010919d <sys_sleep+0x7d>
+    return -1;
+  acquire(&tickslock);
+80109139:	83 ec 0c             	sub    $0xc,%esp
+8010913c:	68 e0 9b 13 80       	push   $0x80139be0
+80109141:	e8 8a ed ff ff       	call   80107ed0 <acquire>
+  ticks0 = ticks;
+  while(ticks - ticks0 < n){
+80109146:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  ticks0 = ticks;
+80109149:	8b 1d c0 9b 13 80    	mov    0x80139bc0,%ebx
+  while(ticks - ticks0 < n){
+8010914f:	83 c4 10             	add    $0x10,%esp
+80109152:	85 d2                	test   %edx,%edx
+80109154:	75 2b                	jne    80109181 <sys_sleep+0x61>
+80109156:	eb 58                	jmp    801091b0 <sys_sleep+0x90>
+80109158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010915f:	90                   	nop
+    if(myproc()->killed){
+      release(&tickslock);
+      return -1;
+    }
+    sleep(&ticks, &tickslock);
+80109160:	83 ec 08             	sub    $0x8,%esp
+80109163:	68 e0 9b 13 80       	push   $0x80139be0
+80109168:	68 c0 9b 13 80       	push   $0x80139bc0
+8010916d:	e8 ce d5 ff ff       	call   80106740 <sleep>
+  while(ticks - ticks0 < n){
+80109172:	a1 c0 9b 13 80       	mov    0x80139bc0,%eax
+80109177:	83 c4 10             	add    $0x10,%esp
+8010917a:	29 d8                	sub    %ebx,%eax
+8010917c:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+8010917f:	73 2f                	jae    801091b0 <sys_sleep+0x90>
+    if(myproc()->killed){
+80109181:	e8 7a c8 ff ff       	call   80105a00 <myproc>
+80109186:	8b 40 3c             	mov    0x3c(%eax),%eax
+80109189:	85 c0                	test   %eax,%eax
+8010918b:	74 d3                	je     80109160 <sys_sleep+0x40>
+      release(&tickslock);
+8010918d:	83 ec 0c             	sub    $0xc,%esp
+80109190:	68 e0 9b 13 80       	push   $0x80139be0
+80109195:	e8 d6 ec ff ff       	call   80107e70 <release>
+      return -1;
+8010919a:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&tickslock);
+  return 0;
+}
+8010919d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+801091a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801091a5:	c9                   	leave
+801091a6:	c3                   	ret
+801091a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801091ae:	66 90                	xchg   %ax,%ax
+  release(&tickslock);
+801091b0:	83 ec 0c             	sub    $0xc,%esp
+801091b3:	68 e0 9b 13 80       	push   $0x80139be0
+801091b8:	e8 b3 ec ff ff       	call   80107e70 <release>
+}
+801091bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return 0;
+801091c0:	83 c4 10             	add    $0x10,%esp
+801091c3:	31 c0                	xor    %eax,%eax
+}
+801091c5:	c9                   	leave
+801091c6:	c3                   	ret
+801091c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801091ce:	66 90                	xchg   %ax,%ax
+
+801091d0 <sys_uptime>:
+
+// return how many clock tick interrupts have occurred
+// since start.
+int
+sys_uptime(void)
+{
+801091d0:	55                   	push   %ebp
+801091d1:	89 e5                	mov    %esp,%ebp
+801091d3:	53                   	push   %ebx
+801091d4:	83 ec 10             	sub    $0x10,%esp
+  uint xticks;
+
+  acquire(&tickslock);
+801091d7:	68 e0 9b 13 80       	push   $0x80139be0
+801091dc:	e8 ef ec ff ff       	call   80107ed0 <acquire>
+  xticks = ticks;
+801091e1:	8b 1d c0 9b 13 80    	mov    0x80139bc0,%ebx
+  release(&tickslock);
+801091e7:	c7 04 24 e0 9b 13 80 	movl   $0x80139be0,(%esp)
+801091ee:	e8 7d ec ff ff       	call   80107e70 <release>
+  return xticks;
+}
+801091f3:	89 d8                	mov    %ebx,%eax
+801091f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801091f8:	c9                   	leave
+801091f9:	c3                   	ret
+801091fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80109200 <sys_settickets>:
+
+
+int
+sys_settickets(void) {
+80109200:	55                   	push   %ebp
+80109201:	89 e5                	mov    %esp,%ebp
+80109203:	83 ec 20             	sub    $0x20,%esp
+  int n;
+  if(argint(0, &n) < 0)
+80109206:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109209:	50                   	push   %eax
+8010920a:	6a 00                	push   $0x0
+8010920c:	e8 5f f0 ff ff       	call   80108270 <argint>
+80109211:	83 c4 10             	add    $0x10,%esp
+80109214:	85 c0                	test   %eax,%eax
+80109216:	78 18                	js     80109230 <sys_settickets+0x30>
+      return -1;
+ 
+  return settickets(n);
+80109218:	83 ec 0c             	sub    $0xc,%esp
+8010921b:	ff 75 f4             	push   -0xc(%ebp)
+8010921e:	e8 1d d8 ff ff       	call   80106a40 <settickets>
+80109223:	83 c4 10             	add    $0x10,%esp
+}
+80109226:	c9                   	leave
+80109227:	c3                   	ret
+80109228:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010922f:	90                   	nop
+80109230:	c9                   	leave
+      return -1;
+80109231:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109236:	c3                   	ret
+80109237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010923e:	66 90                	xchg   %ax,%ax
+
+80109240 <sys_getpinfo>:
+
+int
+sys_getpinfo(void)
+{
+80109240:	55                   	push   %ebp
+80109241:	89 e5                	mov    %esp,%ebp
+80109243:	83 ec 1c             	sub    $0x1c,%esp
+    struct pstat *d;
+	if (argptr(0, (char **)&d, sizeof(struct pstat)) < 0)
+80109246:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109249:	68 04 0b 00 00       	push   $0xb04
+8010924e:	50                   	push   %eax
+8010924f:	6a 00                	push   $0x0
+80109251:	e8 6a f0 ff ff       	call   801082c0 <argptr>
+80109256:	83 c4 10             	add    $0x10,%esp
+80109259:	85 c0                	test   %eax,%eax
+8010925b:	78 13                	js     80109270 <sys_getpinfo+0x30>
+	return -1;
+
+	return getpinfo(d);
+8010925d:	83 ec 0c             	sub    $0xc,%esp
+80109260:	ff 75 f4             	push   -0xc(%ebp)
+80109263:	e8 88 dc ff ff       	call   80106ef0 <getpinfo>
+80109268:	83 c4 10             	add    $0x10,%esp
+}
+8010926b:	c9                   	leave
+8010926c:	c3                   	ret
+8010926d:	8d 76 00             	lea    0x0(%esi),%esi
+80109270:	c9                   	leave
+	return -1;
+80109271:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109276:	c3                   	ret
+80109277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010927e:	66 90                	xchg   %ax,%ax
+
+80109280 <sys_mprotect>:
+
+int
+sys_mprotect(void){
+80109280:	55                   	push   %ebp
+80109281:	89 e5                	mov    %esp,%ebp
+80109283:	83 ec 20             	sub    $0x20,%esp
+  int d;
+  int n = 0;
+  if(argint(0, &d)<0 || argint(1, &n)<0)
+80109286:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  int n = 0;
+80109289:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(argint(0, &d)<0 || argint(1, &n)<0)
+80109290:	50                   	push   %eax
+80109291:	6a 00                	push   $0x0
+80109293:	e8 d8 ef ff ff       	call   80108270 <argint>
+80109298:	83 c4 10             	add    $0x10,%esp
+8010929b:	85 c0                	test   %eax,%eax
+8010929d:	78 36                	js     801092d5 <sys_mprotect+0x55>
+8010929f:	83 ec 08             	sub    $0x8,%esp
+801092a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801092a5:	50                   	push   %eax
+801092a6:	6a 01                	push   $0x1
+801092a8:	e8 c3 ef ff ff       	call   80108270 <argint>
+801092ad:	83 c4 10             	add    $0x10,%esp
+801092b0:	85 c0                	test   %eax,%eax
+801092b2:	78 21                	js     801092d5 <sys_mprotect+0x55>
+    return -1;
+  int rt=mprotect((void *)d,n);
+801092b4:	83 ec 08             	sub    $0x8,%esp
+801092b7:	ff 75 f4             	push   -0xc(%ebp)
+801092ba:	ff 75 f0             	push   -0x10(%ebp)
+801092bd:	e8 0e 24 00 00       	call   8010b6d0 <mprotect>
+  if(rt==-1)
+801092c2:	83 c4 10             	add    $0x10,%esp
+801092c5:	83 f8 ff             	cmp    $0xffffffff,%eax
+801092c8:	74 06                	je     801092d0 <sys_mprotect+0x50>
+  	exit();
+  	
+  return rt;
+
+}
+801092ca:	c9                   	leave
+801092cb:	c3                   	ret
+801092cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  	exit();
+801092d0:	e8 8b d0 ff ff       	call   80106360 <exit>
+}
+801092d5:	c9                   	leave
+    return -1;
+801092d6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801092db:	c3                   	ret
+801092dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801092e0 <sys_munprotect>:
+
+int
+sys_munprotect(void){
+801092e0:	55                   	push   %ebp
+801092e1:	89 e5                	mov    %esp,%ebp
+801092e3:	83 ec 20             	sub    $0x20,%esp
+  int d;
+  int n = 0;
+  if(argint(0, &d)<0 || argint(1, &n)<0)
+801092e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  int n = 0;
+801092e9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(argint(0, &d)<0 || argint(1, &n)<0)
+801092f0:	50                   	push   %eax
+801092f1:	6a 00                	push   $0x0
+801092f3:	e8 78 ef ff ff       	call   80108270 <argint>
+801092f8:	83 c4 10             	add    $0x10,%esp
+801092fb:	85 c0                	test   %eax,%eax
+801092fd:	78 36                	js     80109335 <sys_munprotect+0x55>
+801092ff:	83 ec 08             	sub    $0x8,%esp
+80109302:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109305:	50                   	push   %eax
+80109306:	6a 01                	push   $0x1
+80109308:	e8 63 ef ff ff       	call   80108270 <argint>
+8010930d:	83 c4 10             	add    $0x10,%esp
+80109310:	85 c0                	test   %eax,%eax
+80109312:	78 21                	js     80109335 <sys_munprotect+0x55>
+    return -1;
+  
+  int rt=munprotect((void *)d,n);
+80109314:	83 ec 08             	sub    $0x8,%esp
+80109317:	ff 75 f4             	push   -0xc(%ebp)
+8010931a:	ff 75 f0             	push   -0x10(%ebp)
+8010931d:	e8 3e 25 00 00       	call   8010b860 <munprotect>
+  if(rt==-1)
+80109322:	83 c4 10             	add    $0x10,%esp
+80109325:	83 f8 ff             	cmp    $0xffffffff,%eax
+80109328:	74 06                	je     80109330 <sys_munprotect+0x50>
+  	exit();
+  	
+  return rt;
+
+}
+8010932a:	c9                   	leave
+8010932b:	c3                   	ret
+8010932c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  	exit();
+80109330:	e8 2b d0 ff ff       	call   80106360 <exit>
+}
+80109335:	c9                   	leave
+    return -1;
+80109336:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010933b:	c3                   	ret
+8010933c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80109340 <sys_clone>:
+
+int
+sys_clone(void) {
+80109340:	55                   	push   %ebp
+80109341:	89 e5                	mov    %esp,%ebp
+80109343:	83 ec 2c             	sub    $0x2c,%esp
+  void *fcn, *arg1, *arg2, *stack;
+  int flags;
+  //check if arguments is valid before calling clone syscall
+  if (argptr(0, (void *)&fcn, sizeof(void *)) < 0)	return -1;
+80109346:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80109349:	6a 04                	push   $0x4
+8010934b:	50                   	push   %eax
+8010934c:	6a 00                	push   $0x0
+8010934e:	e8 6d ef ff ff       	call   801082c0 <argptr>
+80109353:	83 c4 10             	add    $0x10,%esp
+80109356:	85 c0                	test   %eax,%eax
+80109358:	78 76                	js     801093d0 <sys_clone+0x90>
+  if (argptr(1, (void *)&arg1, sizeof(void *)) < 0)	return -1;
+8010935a:	83 ec 04             	sub    $0x4,%esp
+8010935d:	8d 45 e8             	lea    -0x18(%ebp),%eax
+80109360:	6a 04                	push   $0x4
+80109362:	50                   	push   %eax
+80109363:	6a 01                	push   $0x1
+80109365:	e8 56 ef ff ff       	call   801082c0 <argptr>
+8010936a:	83 c4 10             	add    $0x10,%esp
+8010936d:	85 c0                	test   %eax,%eax
+8010936f:	78 5f                	js     801093d0 <sys_clone+0x90>
+  if (argptr(2, (void *)&arg2, sizeof(void *)) < 0)	return -1;
+80109371:	83 ec 04             	sub    $0x4,%esp
+80109374:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80109377:	6a 04                	push   $0x4
+80109379:	50                   	push   %eax
+8010937a:	6a 02                	push   $0x2
+8010937c:	e8 3f ef ff ff       	call   801082c0 <argptr>
+80109381:	83 c4 10             	add    $0x10,%esp
+80109384:	85 c0                	test   %eax,%eax
+80109386:	78 48                	js     801093d0 <sys_clone+0x90>
+  if (argptr(3, (void *)&stack, sizeof(void *)) < 0)	return -1;
+80109388:	83 ec 04             	sub    $0x4,%esp
+8010938b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+8010938e:	6a 04                	push   $0x4
+80109390:	50                   	push   %eax
+80109391:	6a 03                	push   $0x3
+80109393:	e8 28 ef ff ff       	call   801082c0 <argptr>
+80109398:	83 c4 10             	add    $0x10,%esp
+8010939b:	85 c0                	test   %eax,%eax
+8010939d:	78 31                	js     801093d0 <sys_clone+0x90>
+  if (argint(4, &flags) < 0)	return -1;
+8010939f:	83 ec 08             	sub    $0x8,%esp
+801093a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801093a5:	50                   	push   %eax
+801093a6:	6a 04                	push   $0x4
+801093a8:	e8 c3 ee ff ff       	call   80108270 <argint>
+801093ad:	83 c4 10             	add    $0x10,%esp
+801093b0:	85 c0                	test   %eax,%eax
+801093b2:	78 1c                	js     801093d0 <sys_clone+0x90>
+	
+  return clone(fcn, arg1, arg2, stack, flags);
+801093b4:	83 ec 0c             	sub    $0xc,%esp
+801093b7:	ff 75 f4             	push   -0xc(%ebp)
+801093ba:	ff 75 f0             	push   -0x10(%ebp)
+801093bd:	ff 75 ec             	push   -0x14(%ebp)
+801093c0:	ff 75 e8             	push   -0x18(%ebp)
+801093c3:	ff 75 e4             	push   -0x1c(%ebp)
+801093c6:	e8 25 dd ff ff       	call   801070f0 <clone>
+801093cb:	83 c4 20             	add    $0x20,%esp
+}
+801093ce:	c9                   	leave
+801093cf:	c3                   	ret
+801093d0:	c9                   	leave
+  if (argptr(0, (void *)&fcn, sizeof(void *)) < 0)	return -1;
+801093d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801093d6:	c3                   	ret
+801093d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801093de:	66 90                	xchg   %ax,%ax
+
+801093e0 <sys_join>:
+
+int
+sys_join(void)
+{
+801093e0:	55                   	push   %ebp
+801093e1:	89 e5                	mov    %esp,%ebp
+801093e3:	83 ec 1c             	sub    $0x1c,%esp
+  void **stack;
+  if (argptr(0, (void *)&stack, sizeof(void *)) < 0)	return -1;
+801093e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801093e9:	6a 04                	push   $0x4
+801093eb:	50                   	push   %eax
+801093ec:	6a 00                	push   $0x0
+801093ee:	e8 cd ee ff ff       	call   801082c0 <argptr>
+801093f3:	83 c4 10             	add    $0x10,%esp
+801093f6:	85 c0                	test   %eax,%eax
+801093f8:	78 16                	js     80109410 <sys_join+0x30>
+  return join(stack);
+801093fa:	83 ec 0c             	sub    $0xc,%esp
+801093fd:	ff 75 f4             	push   -0xc(%ebp)
+80109400:	e8 4b df ff ff       	call   80107350 <join>
+80109405:	83 c4 10             	add    $0x10,%esp
+}
+80109408:	c9                   	leave
+80109409:	c3                   	ret
+8010940a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80109410:	c9                   	leave
+  if (argptr(0, (void *)&stack, sizeof(void *)) < 0)	return -1;
+80109411:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109416:	c3                   	ret
+80109417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010941e:	66 90                	xchg   %ax,%ax
+
+80109420 <sys_join_any>:
+
+int
+sys_join_any(void)
+{
+80109420:	55                   	push   %ebp
+80109421:	89 e5                	mov    %esp,%ebp
+80109423:	83 ec 20             	sub    $0x20,%esp
+  int *pids, n, flags;
+  void **stacks;
+
+  if(argint(2, &n) < 0 || n <= 0 || n > NPROC || argint(3, &flags) < 0)
+80109426:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80109429:	50                   	push   %eax
+8010942a:	6a 02                	push   $0x2
+8010942c:	e8 3f ee ff ff       	call   80108270 <argint>
+80109431:	83 c4 10             	add    $0x10,%esp
+80109434:	85 c0                	test   %eax,%eax
+80109436:	78 78                	js     801094b0 <sys_join_any+0x90>
+80109438:	8b 45 ec             	mov    -0x14(%ebp),%eax
+8010943b:	83 e8 01             	sub    $0x1,%eax
+8010943e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+80109443:	77 6b                	ja     801094b0 <sys_join_any+0x90>
+80109445:	83 ec 08             	sub    $0x8,%esp
+80109448:	8d 45 f0             	lea    -0x10(%ebp),%eax
+8010944b:	50                   	push   %eax
+8010944c:	6a 03                	push   $0x3
+8010944e:	e8 1d ee ff ff       	call   80108270 <argint>
+80109453:	83 c4 10             	add    $0x10,%esp
+80109456:	85 c0                	test   %eax,%eax
+80109458:	78 56                	js     801094b0 <sys_join_any+0x90>
+    return -1;
+  if(argptr(0, (void*)&pids, n*sizeof(int)) < 0 ||
+8010945a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+8010945d:	83 ec 04             	sub    $0x4,%esp
+80109460:	c1 e0 02             	shl    $0x2,%eax
+80109463:	50                   	push   %eax
+80109464:	8d 45 e8             	lea    -0x18(%ebp),%eax
+80109467:	50                   	push   %eax
+80109468:	6a 00                	push   $0x0
+8010946a:	e8 51 ee ff ff       	call   801082c0 <argptr>
+8010946f:	83 c4 10             	add    $0x10,%esp
+80109472:	85 c0                	test   %eax,%eax
+80109474:	78 3a                	js     801094b0 <sys_join_any+0x90>
+     argptr(1, (void*)&stacks, n*sizeof(void*)) < 0)
+80109476:	8b 45 ec             	mov    -0x14(%ebp),%eax
+80109479:	83 ec 04             	sub    $0x4,%esp
+8010947c:	c1 e0 02             	shl    $0x2,%eax
+8010947f:	50                   	push   %eax
+80109480:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109483:	50                   	push   %eax
+80109484:	6a 01                	push   $0x1
+80109486:	e8 35 ee ff ff       	call   801082c0 <argptr>
+  if(argptr(0, (void*)&pids, n*sizeof(int)) < 0 ||
+8010948b:	83 c4 10             	add    $0x10,%esp
+8010948e:	85 c0                	test   %eax,%eax
+80109490:	78 1e                	js     801094b0 <sys_join_any+0x90>
+    return -1;
+  return join_any(pids, stacks, n, flags);
+80109492:	ff 75 f0             	push   -0x10(%ebp)
+80109495:	ff 75 ec             	push   -0x14(%ebp)
+80109498:	ff 75 f4             	push   -0xc(%ebp)
+8010949b:	ff 75 e8             	push   -0x18(%ebp)
+8010949e:	e8 cd df ff ff       	call   80107470 <join_any>
+801094a3:	83 c4 10             	add    $0x10,%esp
+}
+801094a6:	c9                   	leave
+801094a7:	c3                   	ret
+801094a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801094af:	90                   	nop
+801094b0:	c9                   	leave
+    return -1;
+801094b1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801094b6:	c3                   	ret
+801094b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801094be:	66 90                	xchg   %ax,%ax
+
+801094c0 <sys_mguard>:
+
+int
+sys_mguard(void)
+{
+801094c0:	55                   	push   %ebp
+801094c1:	89 e5                	mov    %esp,%ebp
+801094c3:	83 ec 20             	sub    $0x20,%esp
+  int d;
+  int n = 0;
+  if(argint(0, &d)<0 || argint(1, &n)<0)
+801094c6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  int n = 0;
+801094c9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(argint(0, &d)<0 || argint(1, &n)<0)
+801094d0:	50                   	push   %eax
+801094d1:	6a 00                	push   $0x0
+801094d3:	e8 98 ed ff ff       	call   80108270 <argint>
+801094d8:	83 c4 10             	add    $0x10,%esp
+801094db:	85 c0                	test   %eax,%eax
+801094dd:	78 31                	js     80109510 <sys_mguard+0x50>
+801094df:	83 ec 08             	sub    $0x8,%esp
+801094e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801094e5:	50                   	push   %eax
+801094e6:	6a 01                	push   $0x1
+801094e8:	e8 83 ed ff ff       	call   80108270 <argint>
+801094ed:	83 c4 10             	add    $0x10,%esp
+801094f0:	85 c0                	test   %eax,%eax
+801094f2:	78 1c                	js     80109510 <sys_mguard+0x50>
+    return -1;
+  return mguard((void *)d, n);
+801094f4:	83 ec 08             	sub    $0x8,%esp
+801094f7:	ff 75 f4             	push   -0xc(%ebp)
+801094fa:	ff 75 f0             	push   -0x10(%ebp)
+801094fd:	e8 be 22 00 00       	call   8010b7c0 <mguard>
+80109502:	83 c4 10             	add    $0x10,%esp
+}
+80109505:	c9                   	leave
+80109506:	c3                   	ret
+80109507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010950e:	66 90                	xchg   %ax,%ax
+80109510:	c9                   	leave
+    return -1;
+80109511:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109516:	c3                   	ret
+80109517:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010951e:	66 90                	xchg   %ax,%ax
+
+80109520 <sys_initlock_t>:
+
+int sys_initlock_t(void)
+{
+80109520:	55                   	push   %ebp
+80109521:	89 e5                	mov    %esp,%ebp
+80109523:	83 ec 1c             	sub    $0x1c,%esp
+  struct ticketlock *tl;
+  if (argptr(0, (char**)&tl, sizeof(struct ticketlock)) < 0) return -1;
+80109526:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109529:	6a 0c                	push   $0xc
+8010952b:	50                   	push   %eax
+8010952c:	6a 00                	push   $0x0
+8010952e:	e8 8d ed ff ff       	call   801082c0 <argptr>
+80109533:	83 c4 10             	add    $0x10,%esp
+80109536:	85 c0                	test   %eax,%eax
+80109538:	78 16                	js     80109550 <sys_initlock_t+0x30>
+  
+  initlock_t(tl);
+8010953a:	83 ec 0c             	sub    $0xc,%esp
+8010953d:	ff 75 f4             	push   -0xc(%ebp)
+80109540:	e8 4b e4 ff ff       	call   80107990 <initlock_t>
+  return 0;
+80109545:	83 c4 10             	add    $0x10,%esp
+80109548:	31 c0                	xor    %eax,%eax
+}
+8010954a:	c9                   	leave
+8010954b:	c3                   	ret
+8010954c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109550:	c9                   	leave
+  if (argptr(0, (char**)&tl, sizeof(struct ticketlock)) < 0) return -1;
+80109551:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109556:	c3                   	ret
+80109557:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010955e:	66 90                	xchg   %ax,%ax
+
+80109560 <sys_acquire_t>:
+
+int sys_acquire_t(void)
+{
+80109560:	55                   	push   %ebp
+80109561:	89 e5                	mov    %esp,%ebp
+80109563:	83 ec 1c             	sub    $0x1c,%esp
+  struct ticketlock *tl;
+  if (argptr(0, (char**)&tl, sizeof(struct ticketlock)) < 0) return -1;
+80109566:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109569:	6a 0c                	push   $0xc
+8010956b:	50                   	push   %eax
+8010956c:	6a 00                	push   $0x0
+8010956e:	e8 4d ed ff ff       	call   801082c0 <argptr>
+80109573:	83 c4 10             	add    $0x10,%esp
+80109576:	85 c0                	test   %eax,%eax
+80109578:	78 16                	js     80109590 <sys_acquire_t+0x30>
+  
+  acquire_t(tl);
+8010957a:	83 ec 0c             	sub    $0xc,%esp
+8010957d:	ff 75 f4             	push   -0xc(%ebp)
+80109580:	e8 2b e4 ff ff       	call   801079b0 <acquire_t>
+  return 0;
+80109585:	83 c4 10             	add    $0x10,%esp
+80109588:	31 c0                	xor    %eax,%eax
+}
+8010958a:	c9                   	leave
+8010958b:	c3                   	ret
+8010958c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109590:	c9                   	leave
+  if (argptr(0, (char**)&tl, sizeof(struct ticketlock)) < 0) return -1;
+80109591:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109596:	c3                   	ret
+80109597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010959e:	66 90                	xchg   %ax,%ax
+
+801095a0 <sys_release_t>:
+
+int sys_release_t(void)
+{
+801095a0:	55                   	push   %ebp
+801095a1:	89 e5                	mov    %esp,%ebp
+801095a3:	83 ec 1c             	sub    $0x1c,%esp
+  struct ticketlock *tl;
+  if (argptr(0, (char**)&tl, sizeof(struct ticketlock)) < 0) return -1;
+801095a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801095a9:	6a 0c                	push   $0xc
+801095ab:	50                   	push   %eax
+801095ac:	6a 00                	push   $0x0
+801095ae:	e8 0d ed ff ff       	call   801082c0 <argptr>
+801095b3:	83 c4 10             	add    $0x10,%esp
+801095b6:	85 c0                	test   %eax,%eax
+801095b8:	78 16                	js     801095d0 <sys_release_t+0x30>
+  
+  release_t(tl);
+801095ba:	83 ec 0c             	sub    $0xc,%esp
+801095bd:	ff 75 f4             	push   -0xc(%ebp)
+801095c0:	e8 2b e5 ff ff       	call   80107af0 <release_t>
+  return 0;
+801095c5:	83 c4 10             	add    $0x10,%esp
+801095c8:	31 c0                	xor    %eax,%eax
+}
+801095ca:	c9                   	leave
+801095cb:	c3                   	ret
+801095cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801095d0:	c9                   	leave
+  if (argptr(0, (char**)&tl, sizeof(struct ticketlock)) < 0) return -1;
+801095d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801095d6:	c3                   	ret
+801095d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801095de:	66 90                	xchg   %ax,%ax
+
+801095e0 <sys_setsched>:
+
+int
+sys_setsched(void)
+{
+801095e0:	55                   	push   %ebp
+801095e1:	89 e5                	mov    %esp,%ebp
+801095e3:	83 ec 20             	sub    $0x20,%esp
+  int policy;
+
+  if(argint(0, &policy) < 0)
+801095e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801095e9:	50                   	push   %eax
+801095ea:	6a 00                	push   $0x0
+801095ec:	e8 7f ec ff ff       	call   80108270 <argint>
+801095f1:	83 c4 10             	add    $0x10,%esp
+801095f4:	85 c0                	test   %eax,%eax
+801095f6:	78 18                	js     80109610 <sys_setsched+0x30>
+    return -1;
+  return setsched(policy);
+801095f8:	83 ec 0c             	sub    $0xc,%esp
+801095fb:	ff 75 f4             	push   -0xc(%ebp)
+801095fe:	e8 6d d8 ff ff       	call   80106e70 <setsched>
+80109603:	83 c4 10             	add    $0x10,%esp
+}
+80109606:	c9                   	leave
+80109607:	c3                   	ret
+80109608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010960f:	90                   	nop
+80109610:	c9                   	leave
+    return -1;
+80109611:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109616:	c3                   	ret
+80109617:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010961e:	66 90                	xchg   %ax,%ax
+
+80109620 <sys_mkgroup>:
+
+int
+sys_mkgroup(void)
+{
+80109620:	55                   	push   %ebp
+80109621:	89 e5                	mov    %esp,%ebp
+80109623:	83 ec 20             	sub    $0x20,%esp
+  int tickets;
+
+  if(argint(0, &tickets) < 0)
+80109626:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109629:	50                   	push   %eax
+8010962a:	6a 00                	push   $0x0
+8010962c:	e8 3f ec ff ff       	call   80108270 <argint>
+80109631:	83 c4 10             	add    $0x10,%esp
+80109634:	85 c0                	test   %eax,%eax
+80109636:	78 18                	js     80109650 <sys_mkgroup+0x30>
+    return -1;
+  return mkgroup(tickets);
+80109638:	83 ec 0c             	sub    $0xc,%esp
+8010963b:	ff 75 f4             	push   -0xc(%ebp)
+8010963e:	e8 ed d6 ff ff       	call   80106d30 <mkgroup>
+80109643:	83 c4 10             	add    $0x10,%esp
+}
+80109646:	c9                   	leave
+80109647:	c3                   	ret
+80109648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010964f:	90                   	nop
+80109650:	c9                   	leave
+    return -1;
+80109651:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109656:	c3                   	ret
+80109657:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010965e:	66 90                	xchg   %ax,%ax
+
+80109660 <sys_joingroup>:
+
+int
+sys_joingroup(void)
+{
+80109660:	55                   	push   %ebp
+80109661:	89 e5                	mov    %esp,%ebp
+80109663:	83 ec 20             	sub    $0x20,%esp
+  int gid;
+
+  if(argint(0, &gid) < 0)
+80109666:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109669:	50                   	push   %eax
+8010966a:	6a 00                	push   $0x0
+8010966c:	e8 ff eb ff ff       	call   80108270 <argint>
+80109671:	83 c4 10             	add    $0x10,%esp
+80109674:	85 c0                	test   %eax,%eax
+80109676:	78 18                	js     80109690 <sys_joingroup+0x30>
+    return -1;
+  return joingroup(gid);
+80109678:	83 ec 0c             	sub    $0xc,%esp
+8010967b:	ff 75 f4             	push   -0xc(%ebp)
+8010967e:	e8 5d d7 ff ff       	call   80106de0 <joingroup>
+80109683:	83 c4 10             	add    $0x10,%esp
+}
+80109686:	c9                   	leave
+80109687:	c3                   	ret
+80109688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010968f:	90                   	nop
+80109690:	c9                   	leave
+    return -1;
+80109691:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109696:	c3                   	ret
+80109697:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010969e:	66 90                	xchg   %ax,%ax
+
+801096a0 <sys_transfer_tickets>:
+
+int
+sys_transfer_tickets(void)
+{
+801096a0:	55                   	push   %ebp
+801096a1:	89 e5                	mov    %esp,%ebp
+801096a3:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+801096a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801096a9:	50                   	push   %eax
+801096aa:	6a 00                	push   $0x0
+801096ac:	e8 bf eb ff ff       	call   80108270 <argint>
+801096b1:	83 c4 10             	add    $0x10,%esp
+801096b4:	85 c0                	test   %eax,%eax
+801096b6:	78 18                	js     801096d0 <sys_transfer_tickets+0x30>
+    return -1;
+  return transfer_tickets(pid);
+801096b8:	83 ec 0c             	sub    $0xc,%esp
+801096bb:	ff 75 f4             	push   -0xc(%ebp)
+801096be:	e8 ad d5 ff ff       	call   80106c70 <transfer_tickets>
+801096c3:	83 c4 10             	add    $0x10,%esp
+}
+801096c6:	c9                   	leave
+801096c7:	c3                   	ret
+801096c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801096cf:	90                   	nop
+801096d0:	c9                   	leave
+    return -1;
+801096d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801096d6:	c3                   	ret
+801096d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801096de:	66 90                	xchg   %ax,%ax
+
+801096e0 <sys_setdeadline>:
+
+int
+sys_setdeadline(void)
+{
+801096e0:	55                   	push   %ebp
+801096e1:	89 e5                	mov    %esp,%ebp
+801096e3:	83 ec 20             	sub    $0x20,%esp
+  int period, runtime;
+
+  if(argint(0, &period) < 0 || argint(1, &runtime) < 0)
+801096e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801096e9:	50                   	push   %eax
+801096ea:	6a 00                	push   $0x0
+801096ec:	e8 7f eb ff ff       	call   80108270 <argint>
+801096f1:	83 c4 10             	add    $0x10,%esp
+801096f4:	85 c0                	test   %eax,%eax
+801096f6:	78 28                	js     80109720 <sys_setdeadline+0x40>
+801096f8:	83 ec 08             	sub    $0x8,%esp
+801096fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801096fe:	50                   	push   %eax
+801096ff:	6a 01                	push   $0x1
+80109701:	e8 6a eb ff ff       	call   80108270 <argint>
+80109706:	83 c4 10             	add    $0x10,%esp
+80109709:	85 c0                	test   %eax,%eax
+8010970b:	78 13                	js     80109720 <sys_setdeadline+0x40>
+    return -1;
+  return setdeadline(period, runtime);
+8010970d:	83 ec 08             	sub    $0x8,%esp
+80109710:	ff 75 f4             	push   -0xc(%ebp)
+80109713:	ff 75 f0             	push   -0x10(%ebp)
+80109716:	e8 d5 d3 ff ff       	call   80106af0 <setdeadline>
+8010971b:	83 c4 10             	add    $0x10,%esp
+}
+8010971e:	c9                   	leave
+8010971f:	c3                   	ret
+80109720:	c9                   	leave
+    return -1;
+80109721:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109726:	c3                   	ret
+80109727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010972e:	66 90                	xchg   %ax,%ax
+
+80109730 <sys_setaffinity>:
+
+int
+sys_setaffinity(void)
+{
+80109730:	55                   	push   %ebp
+80109731:	89 e5                	mov    %esp,%ebp
+80109733:	83 ec 20             	sub    $0x20,%esp
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+80109736:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80109739:	50                   	push   %eax
+8010973a:	6a 00                	push   $0x0
+8010973c:	e8 2f eb ff ff       	call   80108270 <argint>
+80109741:	83 c4 10             	add    $0x10,%esp
+80109744:	85 c0                	test   %eax,%eax
+80109746:	78 28                	js     80109770 <sys_setaffinity+0x40>
+80109748:	83 ec 08             	sub    $0x8,%esp
+8010974b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010974e:	50                   	push   %eax
+8010974f:	6a 01                	push   $0x1
+80109751:	e8 1a eb ff ff       	call   80108270 <argint>
+80109756:	83 c4 10             	add    $0x10,%esp
+80109759:	85 c0                	test   %eax,%eax
+8010975b:	78 13                	js     80109770 <sys_setaffinity+0x40>
+    return -1;
+  return setaffinity(pid, mask);
+8010975d:	83 ec 08             	sub    $0x8,%esp
+80109760:	ff 75 f4             	push   -0xc(%ebp)
+80109763:	ff 75 f0             	push   -0x10(%ebp)
+80109766:	e8 f5 d3 ff ff       	call   80106b60 <setaffinity>
+8010976b:	83 c4 10             	add    $0x10,%esp
+}
+8010976e:	c9                   	leave
+8010976f:	c3                   	ret
+80109770:	c9                   	leave
+    return -1;
+80109771:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109776:	c3                   	ret
+80109777:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010977e:	66 90                	xchg   %ax,%ax
+
+80109780 <sys_yield_to>:
+
+int
+sys_yield_to(void)
+{
+80109780:	55                   	push   %ebp
+80109781:	89 e5                	mov    %esp,%ebp
+80109783:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80109786:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109789:	50                   	push   %eax
+8010978a:	6a 00                	push   $0x0
+8010978c:	e8 df ea ff ff       	call   80108270 <argint>
+80109791:	83 c4 10             	add    $0x10,%esp
+80109794:	85 c0                	test   %eax,%eax
+80109796:	78 18                	js     801097b0 <sys_yield_to+0x30>
+    return -1;
+  return yield_to(pid);
+80109798:	83 ec 0c             	sub    $0xc,%esp
+8010979b:	ff 75 f4             	push   -0xc(%ebp)
+8010979e:	e8 bd ce ff ff       	call   80106660 <yield_to>
+801097a3:	83 c4 10             	add    $0x10,%esp
+}
+801097a6:	c9                   	leave
+801097a7:	c3                   	ret
+801097a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801097af:	90                   	nop
+801097b0:	c9                   	leave
+    return -1;
+801097b1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801097b6:	c3                   	ret
+801097b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801097be:	66 90                	xchg   %ax,%ax
+
+801097c0 <sys_getlatency>:
+
+int
+sys_getlatency(void)
+{
+801097c0:	55                   	push   %ebp
+801097c1:	89 e5                	mov    %esp,%ebp
+801097c3:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+  uint *hist;
+
+  if(argint(0, &pid) < 0 || argptr(1, (char**)&hist, NLATBUCKET*sizeof(uint)) < 0)
+801097c6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801097c9:	50                   	push   %eax
+801097ca:	6a 00                	push   $0x0
+801097cc:	e8 9f ea ff ff       	call   80108270 <argint>
+801097d1:	83 c4 10             	add    $0x10,%esp
+801097d4:	85 c0                	test   %eax,%eax
+801097d6:	78 30                	js     80109808 <sys_getlatency+0x48>
+801097d8:	83 ec 04             	sub    $0x4,%esp
+801097db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801097de:	68 80 00 00 00       	push   $0x80
+801097e3:	50                   	push   %eax
+801097e4:	6a 01                	push   $0x1
+801097e6:	e8 d5 ea ff ff       	call   801082c0 <argptr>
+801097eb:	83 c4 10             	add    $0x10,%esp
+801097ee:	85 c0                	test   %eax,%eax
+801097f0:	78 16                	js     80109808 <sys_getlatency+0x48>
+    return -1;
+  return getlatency(pid, hist);
+801097f2:	83 ec 08             	sub    $0x8,%esp
+801097f5:	ff 75 f4             	push   -0xc(%ebp)
+801097f8:	ff 75 f0             	push   -0x10(%ebp)
+801097fb:	e8 30 d8 ff ff       	call   80107030 <getlatency>
+80109800:	83 c4 10             	add    $0x10,%esp
+}
+80109803:	c9                   	leave
+80109804:	c3                   	ret
+80109805:	8d 76 00             	lea    0x0(%esi),%esi
+80109808:	c9                   	leave
+    return -1;
+80109809:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010980e:	c3                   	ret
+8010980f:	90                   	nop
+
+80109810 <sys_futex_wait>:
+
+int
+sys_futex_wait(void)
+{
+80109810:	55                   	push   %ebp
+80109811:	89 e5                	mov    %esp,%ebp
+80109813:	83 ec 1c             	sub    $0x1c,%esp
+  int *addr;
+  int val;
+
+  if(argptr(0, (char**)&addr, sizeof(int)) < 0 || argint(1, &val) < 0)
+80109816:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80109819:	6a 04                	push   $0x4
+8010981b:	50                   	push   %eax
+8010981c:	6a 00                	push   $0x0
+8010981e:	e8 9d ea ff ff       	call   801082c0 <argptr>
+80109823:	83 c4 10             	add    $0x10,%esp
+80109826:	85 c0                	test   %eax,%eax
+80109828:	78 2e                	js     80109858 <sys_futex_wait+0x48>
+8010982a:	83 ec 08             	sub    $0x8,%esp
+8010982d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109830:	50                   	push   %eax
+80109831:	6a 01                	push   $0x1
+80109833:	e8 38 ea ff ff       	call   80108270 <argint>
+80109838:	83 c4 10             	add    $0x10,%esp
+8010983b:	85 c0                	test   %eax,%eax
+8010983d:	78 19                	js     80109858 <sys_futex_wait+0x48>
+    return -1;
+  return futex_wait((uint)addr, val);
+8010983f:	83 ec 08             	sub    $0x8,%esp
+80109842:	ff 75 f4             	push   -0xc(%ebp)
+80109845:	ff 75 f0             	push   -0x10(%ebp)
+80109848:	e8 03 df ff ff       	call   80107750 <futex_wait>
+8010984d:	83 c4 10             	add    $0x10,%esp
+}
+80109850:	c9                   	leave
+80109851:	c3                   	ret
+80109852:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80109858:	c9                   	leave
+    return -1;
+80109859:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010985e:	c3                   	ret
+8010985f:	90                   	nop
+
+80109860 <sys_futex_wake>:
+
+int
+sys_futex_wake(void)
+{
+80109860:	55                   	push   %ebp
+80109861:	89 e5                	mov    %esp,%ebp
+80109863:	83 ec 1c             	sub    $0x1c,%esp
+  int *addr;
+  int n;
+
+  if(argptr(0, (char**)&addr, sizeof(int)) < 0 || argint(1, &n) < 0)
+80109866:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80109869:	6a 04                	push   $0x4
+8010986b:	50                   	push   %eax
+8010986c:	6a 00                	push   $0x0
+8010986e:	e8 4d ea ff ff       	call   801082c0 <argptr>
+80109873:	83 c4 10             	add    $0x10,%esp
+80109876:	85 c0                	test   %eax,%eax
+80109878:	78 2e                	js     801098a8 <sys_futex_wake+0x48>
+8010987a:	83 ec 08             	sub    $0x8,%esp
+8010987d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109880:	50                   	push   %eax
+80109881:	6a 01                	push   $0x1
+80109883:	e8 e8 e9 ff ff       	call   80108270 <argint>
+80109888:	83 c4 10             	add    $0x10,%esp
+8010988b:	85 c0                	test   %eax,%eax
+8010988d:	78 19                	js     801098a8 <sys_futex_wake+0x48>
+    return -1;
+  return futex_wake((uint)addr, n);
+8010988f:	83 ec 08             	sub    $0x8,%esp
+80109892:	ff 75 f4             	push   -0xc(%ebp)
+80109895:	ff 75 f0             	push   -0x10(%ebp)
+80109898:	e8 a3 df ff ff       	call   80107840 <futex_wake>
+8010989d:	83 c4 10             	add    $0x10,%esp
+}
+801098a0:	c9                   	leave
+801098a1:	c3                   	ret
+801098a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801098a8:	c9                   	leave
+    return -1;
+801098a9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801098ae:	c3                   	ret
+
+801098af <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+801098af:	1e                   	push   %ds
+  pushl %es
+801098b0:	06                   	push   %es
+  pushl %fs
+801098b1:	0f a0                	push   %fs
+  pushl %gs
+801098b3:	0f a8                	push   %gs
+  pushal
+801098b5:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+801098b6:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+801098ba:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+801098bc:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+801098be:	54                   	push   %esp
+  call trap
+801098bf:	e8 cc 00 00 00       	call   80109990 <trap>
+  addl $4, %esp
+801098c4:	83 c4 04             	add    $0x4,%esp
+
+801098c7 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+801098c7:	61                   	popa
+  popl %gs
+801098c8:	0f a9                	pop    %gs
+  popl %fs
+801098ca:	0f a1                	pop    %fs
+  popl %es
+801098cc:	07                   	pop    %es
+  popl %ds
+801098cd:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+801098ce:	83 c4 08             	add    $0x8,%esp
+  iret
+801098d1:	cf                   	iret
+801098d2:	66 90                	xchg   %ax,%ax
+801098d4:	66 90                	xchg   %ax,%ax
+801098d6:	66 90                	xchg   %ax,%ax
+801098d8:	66 90                	xchg   %ax,%ax
+801098da:	66 90                	xchg   %ax,%ax
+801098dc:	66 90                	xchg   %ax,%ax
+801098de:	66 90                	xchg   %ax,%ax
+
+801098e0 <tvinit>:
+struct spinlock tickslock;
+uint ticks;
+
+void
+tvinit(void)
+{
+801098e0:	55                   	push   %ebp
+  int i;
+
+  for(i = 0; i < 256; i++)
+801098e1:	31 c0                	xor    %eax,%eax
+{
+801098e3:	89 e5                	mov    %esp,%ebp
+801098e5:	83 ec 08             	sub    $0x8,%esp
+801098e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801098ef:	90                   	nop
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+801098f0:	8b 14 85 08 f0 10 80 	mov    -0x7fef0ff8(,%eax,4),%edx
+801098f7:	c7 04 c5 22 9c 13 80 	movl   $0x8e000008,-0x7fec63de(,%eax,8)
+801098fe:	08 00 00 8e 
+80109902:	66 89 14 c5 20 9c 13 	mov    %dx,-0x7fec63e0(,%eax,8)
+80109909:	80 
+8010990a:	c1 ea 10             	shr    $0x10,%edx
+8010990d:	66 89 14 c5 26 9c 13 	mov    %dx,-0x7fec63da(,%eax,8)
+80109914:	80 
+  for(i = 0; i < 256; i++)
+80109915:	83 c0 01             	add    $0x1,%eax
+80109918:	3d 00 01 00 00       	cmp    $0x100,%eax
+8010991d:	75 d1                	jne    801098f0 <tvinit+0x10>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+8010991f:	a1 08 f1 10 80       	mov    0x8010f108,%eax
+
+  initlock(&tickslock, "time");
+80109924:	83 ec 08             	sub    $0x8,%esp
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+80109927:	c7 05 22 9e 13 80 08 	movl   $0xef000008,0x80139e22
+8010992e:	00 00 ef 
+80109931:	66 a3 20 9e 13 80    	mov    %ax,0x80139e20
+80109937:	c1 e8 10             	shr    $0x10,%eax
+8010993a:	66 a3 26 9e 13 80    	mov    %ax,0x80139e26
+  initlock(&tickslock, "time");
+80109940:	68 2d c2 10 80       	push   $0x8010c22d
+80109945:	68 e0 9b 13 80       	push   $0x80139be0
+8010994a:	e8 a1 e3 ff ff       	call   80107cf0 <initlock>
+}
+8010994f:	83 c4 10             	add    $0x10,%esp
+80109952:	c9                   	leave
+80109953:	c3                   	ret
+80109954:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010995b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010995f:	90                   	nop
+
+80109960 <idtinit>:
+
+void
+idtinit(void)
+{
+80109960:	55                   	push   %ebp
+  pd[0] = size-1;
+80109961:	b8 ff 07 00 00       	mov    $0x7ff,%eax
+80109966:	89 e5                	mov    %esp,%ebp
+80109968:	83 ec 10             	sub    $0x10,%esp
+8010996b:	66 89 45 fa          	mov    %ax,-0x6(%ebp)
+  pd[1] = (uint)p;
+8010996f:	b8 20 9c 13 80       	mov    $0x80139c20,%eax
+80109974:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80109978:	c1 e8 10             	shr    $0x10,%eax
+8010997b:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+8010997f:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80109982:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80109985:	c9                   	leave
+80109986:	c3                   	ret
+80109987:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010998e:	66 90                	xchg   %ax,%ax
+
+80109990 <trap>:
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+80109990:	55                   	push   %ebp
+80109991:	89 e5                	mov    %esp,%ebp
+80109993:	57                   	push   %edi
+80109994:	56                   	push   %esi
+80109995:	53                   	push   %ebx
+80109996:	83 ec 1c             	sub    $0x1c,%esp
+80109999:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  // Time up to a trap from user mode was user time,
+  // time from here until we return to it is system time.
+  if((tf->cs&3) == DPL_USER)
+8010999c:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+801099a0:	83 e0 03             	and    $0x3,%eax
+801099a3:	66 83 f8 03          	cmp    $0x3,%ax
+801099a7:	0f 84 03 01 00 00    	je     80109ab0 <trap+0x120>
+    cputime(1);
+
+  if(tf->trapno == T_SYSCALL){
+801099ad:	8b 43 30             	mov    0x30(%ebx),%eax
+801099b0:	83 f8 40             	cmp    $0x40,%eax
+801099b3:	0f 84 b7 00 00 00    	je     80109a70 <trap+0xe0>
+      exit();
+    cputime(0);
+    return;
+  }
+
+  switch(tf->trapno){
+801099b9:	83 e8 0e             	sub    $0xe,%eax
+801099bc:	83 f8 31             	cmp    $0x31,%eax
+801099bf:	0f 87 03 01 00 00    	ja     80109ac8 <trap+0x138>
+801099c5:	ff 24 85 34 c3 10 80 	jmp    *-0x7fef3ccc(,%eax,4)
+801099cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+static inline uint
+rcr3(void)
+{
+  uint val;
+  asm volatile("movl %%cr3,%0" : "=r" (val));
+801099d0:	0f 20 d8             	mov    %cr3,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+801099d3:	0f 22 d8             	mov    %eax,%cr3
+    // Only wakes an idle CPU out of hlt; see kick().
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_TLB:
+    lcr3(rcr3());
+    mycpu()->tlbflushes++;
+801099d6:	e8 75 b4 ff ff       	call   80104e50 <mycpu>
+801099db:	8b 90 cc 00 00 00    	mov    0xcc(%eax),%edx
+801099e1:	83 c2 01             	add    $0x1,%edx
+801099e4:	89 90 cc 00 00 00    	mov    %edx,0xcc(%eax)
+    lapiceoi();
+801099ea:	e8 d1 93 ff ff       	call   80102dc0 <lapiceoi>
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+801099ef:	e8 0c c0 ff ff       	call   80105a00 <myproc>
+801099f4:	85 c0                	test   %eax,%eax
+801099f6:	74 1d                	je     80109a15 <trap+0x85>
+801099f8:	e8 03 c0 ff ff       	call   80105a00 <myproc>
+801099fd:	8b 50 3c             	mov    0x3c(%eax),%edx
+80109a00:	85 d2                	test   %edx,%edx
+80109a02:	74 11                	je     80109a15 <trap+0x85>
+80109a04:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109a08:	83 e0 03             	and    $0x3,%eax
+80109a0b:	66 83 f8 03          	cmp    $0x3,%ax
+80109a0f:	0f 84 5b 02 00 00    	je     80109c70 <trap+0x2e0>
+    exit();
+
+  // Force process to give up CPU on clock tick, or when
+  // another CPU asked us to reschedule.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING &&
+80109a15:	e8 e6 bf ff ff       	call   80105a00 <myproc>
+80109a1a:	85 c0                	test   %eax,%eax
+80109a1c:	74 0f                	je     80109a2d <trap+0x9d>
+80109a1e:	e8 dd bf ff ff       	call   80105a00 <myproc>
+80109a23:	83 78 08 04          	cmpl   $0x4,0x8(%eax)
+80109a27:	0f 84 13 01 00 00    	je     80109b40 <trap+0x1b0>
+     (tf->trapno == T_IRQ0+IRQ_TIMER || tf->trapno == T_IRQ0+IRQ_RESCHED))
+    yield();
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109a2d:	e8 ce bf ff ff       	call   80105a00 <myproc>
+80109a32:	85 c0                	test   %eax,%eax
+80109a34:	74 22                	je     80109a58 <trap+0xc8>
+80109a36:	e8 c5 bf ff ff       	call   80105a00 <myproc>
+80109a3b:	8b 40 3c             	mov    0x3c(%eax),%eax
+80109a3e:	85 c0                	test   %eax,%eax
+80109a40:	74 16                	je     80109a58 <trap+0xc8>
+80109a42:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109a46:	83 e0 03             	and    $0x3,%eax
+80109a49:	66 83 f8 03          	cmp    $0x3,%ax
+80109a4d:	75 16                	jne    80109a65 <trap+0xd5>
+    exit();
+80109a4f:	e8 0c c9 ff ff       	call   80106360 <exit>
+80109a54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  if((tf->cs&3) == DPL_USER)
+80109a58:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109a5c:	83 e0 03             	and    $0x3,%eax
+80109a5f:	66 83 f8 03          	cmp    $0x3,%ax
+80109a63:	74 38                	je     80109a9d <trap+0x10d>
+    cputime(0);
+}
+80109a65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109a68:	5b                   	pop    %ebx
+80109a69:	5e                   	pop    %esi
+80109a6a:	5f                   	pop    %edi
+80109a6b:	5d                   	pop    %ebp
+80109a6c:	c3                   	ret
+80109a6d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(myproc()->killed)
+80109a70:	e8 8b bf ff ff       	call   80105a00 <myproc>
+80109a75:	8b 70 3c             	mov    0x3c(%eax),%esi
+80109a78:	85 f6                	test   %esi,%esi
+80109a7a:	0f 85 10 02 00 00    	jne    80109c90 <trap+0x300>
+    myproc()->tf = tf;
+80109a80:	e8 7b bf ff ff       	call   80105a00 <myproc>
+80109a85:	89 58 24             	mov    %ebx,0x24(%eax)
+    syscall();
+80109a88:	e8 23 e9 ff ff       	call   801083b0 <syscall>
+    if(myproc()->killed)
+80109a8d:	e8 6e bf ff ff       	call   80105a00 <myproc>
+80109a92:	8b 48 3c             	mov    0x3c(%eax),%ecx
+80109a95:	85 c9                	test   %ecx,%ecx
+80109a97:	0f 85 e3 01 00 00    	jne    80109c80 <trap+0x2f0>
+    cputime(0);
+80109a9d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+80109aa4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109aa7:	5b                   	pop    %ebx
+80109aa8:	5e                   	pop    %esi
+80109aa9:	5f                   	pop    %edi
+80109aaa:	5d                   	pop    %ebp
+    cputime(0);
+80109aab:	e9 20 cb ff ff       	jmp    801065d0 <cputime>
+    cputime(1);
+80109ab0:	83 ec 0c             	sub    $0xc,%esp
+80109ab3:	6a 01                	push   $0x1
+80109ab5:	e8 16 cb ff ff       	call   801065d0 <cputime>
+80109aba:	83 c4 10             	add    $0x10,%esp
+80109abd:	e9 eb fe ff ff       	jmp    801099ad <trap+0x1d>
+80109ac2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(myproc() == 0 || (tf->cs&3) == 0){
+80109ac8:	e8 33 bf ff ff       	call   80105a00 <myproc>
+80109acd:	8b 7b 38             	mov    0x38(%ebx),%edi
+80109ad0:	85 c0                	test   %eax,%eax
+80109ad2:	0f 84 11 02 00 00    	je     80109ce9 <trap+0x359>
+80109ad8:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+80109adc:	0f 84 07 02 00 00    	je     80109ce9 <trap+0x359>
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+80109ae2:	0f 20 d1             	mov    %cr2,%ecx
+80109ae5:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109ae8:	e8 c3 b3 ff ff       	call   80104eb0 <cpuid>
+80109aed:	8b 73 30             	mov    0x30(%ebx),%esi
+80109af0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80109af3:	8b 43 34             	mov    0x34(%ebx),%eax
+80109af6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            myproc()->pid, myproc()->name, tf->trapno,
+80109af9:	e8 02 bf ff ff       	call   80105a00 <myproc>
+80109afe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80109b01:	e8 fa be ff ff       	call   80105a00 <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109b06:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80109b09:	51                   	push   %ecx
+80109b0a:	57                   	push   %edi
+80109b0b:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80109b0e:	52                   	push   %edx
+80109b0f:	ff 75 e4             	push   -0x1c(%ebp)
+80109b12:	56                   	push   %esi
+            myproc()->pid, myproc()->name, tf->trapno,
+80109b13:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80109b16:	83 c6 48             	add    $0x48,%esi
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109b19:	56                   	push   %esi
+80109b1a:	ff 70 0c             	push   0xc(%eax)
+80109b1d:	68 f0 c2 10 80       	push   $0x8010c2f0
+80109b22:	e8 89 6b ff ff       	call   801006b0 <cprintf>
+    myproc()->killed = 1;
+80109b27:	83 c4 20             	add    $0x20,%esp
+80109b2a:	e8 d1 be ff ff       	call   80105a00 <myproc>
+80109b2f:	c7 40 3c 01 00 00 00 	movl   $0x1,0x3c(%eax)
+80109b36:	e9 b4 fe ff ff       	jmp    801099ef <trap+0x5f>
+80109b3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109b3f:	90                   	nop
+     (tf->trapno == T_IRQ0+IRQ_TIMER || tf->trapno == T_IRQ0+IRQ_RESCHED))
+80109b40:	8b 43 30             	mov    0x30(%ebx),%eax
+  if(myproc() && myproc()->state == RUNNING &&
+80109b43:	83 f8 20             	cmp    $0x20,%eax
+80109b46:	74 09                	je     80109b51 <trap+0x1c1>
+80109b48:	83 f8 34             	cmp    $0x34,%eax
+80109b4b:	0f 85 dc fe ff ff    	jne    80109a2d <trap+0x9d>
+    yield();
+80109b51:	e8 2a ca ff ff       	call   80106580 <yield>
+80109b56:	e9 d2 fe ff ff       	jmp    80109a2d <trap+0x9d>
+80109b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109b5f:	90                   	nop
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80109b60:	8b 7b 38             	mov    0x38(%ebx),%edi
+80109b63:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+80109b67:	e8 44 b3 ff ff       	call   80104eb0 <cpuid>
+80109b6c:	57                   	push   %edi
+80109b6d:	56                   	push   %esi
+80109b6e:	50                   	push   %eax
+80109b6f:	68 54 c2 10 80       	push   $0x8010c254
+80109b74:	e8 37 6b ff ff       	call   801006b0 <cprintf>
+    lapiceoi();
+80109b79:	e8 42 92 ff ff       	call   80102dc0 <lapiceoi>
+    break;
+80109b7e:	83 c4 10             	add    $0x10,%esp
+80109b81:	e9 69 fe ff ff       	jmp    801099ef <trap+0x5f>
+80109b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109b8d:	8d 76 00             	lea    0x0(%esi),%esi
+    ideintr();
+80109b90:	e8 5b 8b ff ff       	call   801026f0 <ideintr>
+    lapiceoi();
+80109b95:	e8 26 92 ff ff       	call   80102dc0 <lapiceoi>
+    break;
+80109b9a:	e9 50 fe ff ff       	jmp    801099ef <trap+0x5f>
+80109b9f:	90                   	nop
+80109ba0:	0f 20 d1             	mov    %cr2,%ecx
+  	cprintf("\npid %d %s: trap %d err %d on cpu %d "
+80109ba3:	8b 53 38             	mov    0x38(%ebx),%edx
+80109ba6:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+80109ba9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80109bac:	e8 ff b2 ff ff       	call   80104eb0 <cpuid>
+80109bb1:	8b 73 30             	mov    0x30(%ebx),%esi
+80109bb4:	89 c7                	mov    %eax,%edi
+80109bb6:	8b 43 34             	mov    0x34(%ebx),%eax
+80109bb9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            myproc()->pid, myproc()->name, tf->trapno,
+80109bbc:	e8 3f be ff ff       	call   80105a00 <myproc>
+80109bc1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80109bc4:	e8 37 be ff ff       	call   80105a00 <myproc>
+  	cprintf("\npid %d %s: trap %d err %d on cpu %d "
+80109bc9:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80109bcc:	51                   	push   %ecx
+80109bcd:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80109bd0:	52                   	push   %edx
+80109bd1:	57                   	push   %edi
+80109bd2:	ff 75 e4             	push   -0x1c(%ebp)
+80109bd5:	56                   	push   %esi
+            myproc()->pid, myproc()->name, tf->trapno,
+80109bd6:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80109bd9:	83 c6 48             	add    $0x48,%esi
+  	cprintf("\npid %d %s: trap %d err %d on cpu %d "
+80109bdc:	56                   	push   %esi
+80109bdd:	ff 70 0c             	push   0xc(%eax)
+80109be0:	68 78 c2 10 80       	push   $0x8010c278
+80109be5:	e8 c6 6a ff ff       	call   801006b0 <cprintf>
+    cprintf("\nTrap 14 means Page fault\n");
+80109bea:	83 c4 14             	add    $0x14,%esp
+80109bed:	68 32 c2 10 80       	push   $0x8010c232
+80109bf2:	e8 b9 6a ff ff       	call   801006b0 <cprintf>
+  	myproc()->killed = 1;
+80109bf7:	e8 04 be ff ff       	call   80105a00 <myproc>
+  	break;
+80109bfc:	83 c4 10             	add    $0x10,%esp
+  	myproc()->killed = 1;
+80109bff:	c7 40 3c 01 00 00 00 	movl   $0x1,0x3c(%eax)
+  	break;
+80109c06:	e9 e4 fd ff ff       	jmp    801099ef <trap+0x5f>
+80109c0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109c0f:	90                   	nop
+    mycpu()->nticks++;
+80109c10:	e8 3b b2 ff ff       	call   80104e50 <mycpu>
+80109c15:	83 80 c4 00 00 00 01 	addl   $0x1,0xc4(%eax)
+    if(mycpu()->idle)
+80109c1c:	e8 2f b2 ff ff       	call   80104e50 <mycpu>
+80109c21:	8b 80 bc 00 00 00    	mov    0xbc(%eax),%eax
+80109c27:	85 c0                	test   %eax,%eax
+80109c29:	0f 85 a9 00 00 00    	jne    80109cd8 <trap+0x348>
+    if(cpuid() == 0){
+80109c2f:	e8 7c b2 ff ff       	call   80104eb0 <cpuid>
+80109c34:	85 c0                	test   %eax,%eax
+80109c36:	74 68                	je     80109ca0 <trap+0x310>
+    schedtick();
+80109c38:	e8 03 b5 ff ff       	call   80105140 <schedtick>
+    lapiceoi();
+80109c3d:	e8 7e 91 ff ff       	call   80102dc0 <lapiceoi>
+    break;
+80109c42:	e9 a8 fd ff ff       	jmp    801099ef <trap+0x5f>
+80109c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109c4e:	66 90                	xchg   %ax,%ax
+    kbdintr();
+80109c50:	e8 2b 90 ff ff       	call   80102c80 <kbdintr>
+    lapiceoi();
+80109c55:	e8 66 91 ff ff       	call   80102dc0 <lapiceoi>
+    break;
+80109c5a:	e9 90 fd ff ff       	jmp    801099ef <trap+0x5f>
+80109c5f:	90                   	nop
+    uartintr();
+80109c60:	e8 3b 02 00 00       	call   80109ea0 <uartintr>
+    lapiceoi();
+80109c65:	e8 56 91 ff ff       	call   80102dc0 <lapiceoi>
+    break;
+80109c6a:	e9 80 fd ff ff       	jmp    801099ef <trap+0x5f>
+80109c6f:	90                   	nop
+    exit();
+80109c70:	e8 eb c6 ff ff       	call   80106360 <exit>
+80109c75:	e9 9b fd ff ff       	jmp    80109a15 <trap+0x85>
+80109c7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      exit();
+80109c80:	e8 db c6 ff ff       	call   80106360 <exit>
+80109c85:	e9 13 fe ff ff       	jmp    80109a9d <trap+0x10d>
+80109c8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      exit();
+80109c90:	e8 cb c6 ff ff       	call   80106360 <exit>
+80109c95:	e9 e6 fd ff ff       	jmp    80109a80 <trap+0xf0>
+80109c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      acquire(&tickslock);
+80109ca0:	83 ec 0c             	sub    $0xc,%esp
+80109ca3:	68 e0 9b 13 80       	push   $0x80139be0
+80109ca8:	e8 23 e2 ff ff       	call   80107ed0 <acquire>
+      ticks++;
+80109cad:	83 05 c0 9b 13 80 01 	addl   $0x1,0x80139bc0
+      wakeup(&ticks);
+80109cb4:	c7 04 24 c0 9b 13 80 	movl   $0x80139bc0,(%esp)
+80109cbb:	e8 50 cb ff ff       	call   80106810 <wakeup>
+      release(&tickslock);
+80109cc0:	c7 04 24 e0 9b 13 80 	movl   $0x80139be0,(%esp)
+80109cc7:	e8 a4 e1 ff ff       	call   80107e70 <release>
+80109ccc:	83 c4 10             	add    $0x10,%esp
+80109ccf:	e9 64 ff ff ff       	jmp    80109c38 <trap+0x2a8>
+80109cd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      mycpu()->idleticks++;
+80109cd8:	e8 73 b1 ff ff       	call   80104e50 <mycpu>
+80109cdd:	83 80 c0 00 00 00 01 	addl   $0x1,0xc0(%eax)
+80109ce4:	e9 46 ff ff ff       	jmp    80109c2f <trap+0x29f>
+80109ce9:	0f 20 d6             	mov    %cr2,%esi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+80109cec:	e8 bf b1 ff ff       	call   80104eb0 <cpuid>
+80109cf1:	83 ec 0c             	sub    $0xc,%esp
+80109cf4:	56                   	push   %esi
+80109cf5:	57                   	push   %edi
+80109cf6:	50                   	push   %eax
+80109cf7:	ff 73 30             	push   0x30(%ebx)
+80109cfa:	68 bc c2 10 80       	push   $0x8010c2bc
+80109cff:	e8 ac 69 ff ff       	call   801006b0 <cprintf>
+      panic("trap");
+80109d04:	83 c4 14             	add    $0x14,%esp
+80109d07:	68 4d c2 10 80       	push   $0x8010c24d
+80109d0c:	e8 6f 66 ff ff       	call   80100380 <panic>
+80109d11:	66 90                	xchg   %ax,%ax
+80109d13:	66 90                	xchg   %ax,%ax
+80109d15:	66 90                	xchg   %ax,%ax
+80109d17:	66 90                	xchg   %ax,%ax
+80109d19:	66 90                	xchg   %ax,%ax
+80109d1b:	66 90                	xchg   %ax,%ax
+80109d1d:	66 90                	xchg   %ax,%ax
+80109d1f:	90                   	nop
+
+80109d20 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+80109d20:	a1 20 a4 13 80       	mov    0x8013a420,%eax
+80109d25:	85 c0                	test   %eax,%eax
+80109d27:	74 17                	je     80109d40 <uartgetc+0x20>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109d29:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109d2e:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+80109d2f:	a8 01                	test   $0x1,%al
+80109d31:	74 0d                	je     80109d40 <uartgetc+0x20>
+80109d33:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109d38:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+80109d39:	0f b6 c0             	movzbl %al,%eax
+80109d3c:	c3                   	ret
+80109d3d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80109d40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109d45:	c3                   	ret
+80109d46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109d4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80109d50 <uartinit>:
+{
+80109d50:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109d51:	31 c9                	xor    %ecx,%ecx
+80109d53:	89 c8                	mov    %ecx,%eax
+80109d55:	89 e5                	mov    %esp,%ebp
+80109d57:	57                   	push   %edi
+80109d58:	bf fa 03 00 00       	mov    $0x3fa,%edi
+80109d5d:	56                   	push   %esi
+80109d5e:	89 fa                	mov    %edi,%edx
+80109d60:	53                   	push   %ebx
+80109d61:	83 ec 1c             	sub    $0x1c,%esp
+80109d64:	ee                   	out    %al,(%dx)
+80109d65:	be fb 03 00 00       	mov    $0x3fb,%esi
+80109d6a:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+80109d6f:	89 f2                	mov    %esi,%edx
+80109d71:	ee                   	out    %al,(%dx)
+80109d72:	b8 0c 00 00 00       	mov    $0xc,%eax
+80109d77:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109d7c:	ee                   	out    %al,(%dx)
+80109d7d:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+80109d82:	89 c8                	mov    %ecx,%eax
+80109d84:	89 da                	mov    %ebx,%edx
+80109d86:	ee                   	out    %al,(%dx)
+80109d87:	b8 03 00 00 00       	mov    $0x3,%eax
+80109d8c:	89 f2                	mov    %esi,%edx
+80109d8e:	ee                   	out    %al,(%dx)
+80109d8f:	ba fc 03 00 00       	mov    $0x3fc,%edx
+80109d94:	89 c8                	mov    %ecx,%eax
+80109d96:	ee                   	out    %al,(%dx)
+80109d97:	b8 01 00 00 00       	mov    $0x1,%eax
+80109d9c:	89 da                	mov    %ebx,%edx
+80109d9e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109d9f:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109da4:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+80109da5:	3c ff                	cmp    $0xff,%al
+80109da7:	0f 84 7c 00 00 00    	je     80109e29 <uartinit+0xd9>
+  uart = 1;
+80109dad:	c7 05 20 a4 13 80 01 	movl   $0x1,0x8013a420
+80109db4:	00 00 00 
+80109db7:	89 fa                	mov    %edi,%edx
+80109db9:	ec                   	in     (%dx),%al
+80109dba:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109dbf:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+80109dc0:	83 ec 08             	sub    $0x8,%esp
+  for(p="xv6...\n"; *p; p++)
+80109dc3:	bf fc c3 10 80       	mov    $0x8010c3fc,%edi
+80109dc8:	be fd 03 00 00       	mov    $0x3fd,%esi
+  ioapicenable(IRQ_COM1, 0);
+80109dcd:	6a 00                	push   $0x0
+80109dcf:	6a 04                	push   $0x4
+80109dd1:	e8 4a 8b ff ff       	call   80102920 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+80109dd6:	c6 45 e7 78          	movb   $0x78,-0x19(%ebp)
+  ioapicenable(IRQ_COM1, 0);
+80109dda:	83 c4 10             	add    $0x10,%esp
+80109ddd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(!uart)
+80109de0:	a1 20 a4 13 80       	mov    0x8013a420,%eax
+80109de5:	85 c0                	test   %eax,%eax
+80109de7:	74 32                	je     80109e1b <uartinit+0xcb>
+80109de9:	89 f2                	mov    %esi,%edx
+80109deb:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109dec:	a8 20                	test   $0x20,%al
+80109dee:	75 21                	jne    80109e11 <uartinit+0xc1>
+80109df0:	bb 80 00 00 00       	mov    $0x80,%ebx
+80109df5:	8d 76 00             	lea    0x0(%esi),%esi
+    microdelay(10);
+80109df8:	83 ec 0c             	sub    $0xc,%esp
+80109dfb:	6a 0a                	push   $0xa
+80109dfd:	e8 4e 90 ff ff       	call   80102e50 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109e02:	83 c4 10             	add    $0x10,%esp
+80109e05:	83 eb 01             	sub    $0x1,%ebx
+80109e08:	74 07                	je     80109e11 <uartinit+0xc1>
+80109e0a:	89 f2                	mov    %esi,%edx
+80109e0c:	ec                   	in     (%dx),%al
+80109e0d:	a8 20                	test   $0x20,%al
+80109e0f:	74 e7                	je     80109df8 <uartinit+0xa8>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109e11:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109e16:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+80109e1a:	ee                   	out    %al,(%dx)
+  for(p="xv6...\n"; *p; p++)
+80109e1b:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+80109e1f:	83 c7 01             	add    $0x1,%edi
+80109e22:	88 45 e7             	mov    %al,-0x19(%ebp)
+80109e25:	84 c0                	test   %al,%al
+80109e27:	75 b7                	jne    80109de0 <uartinit+0x90>
+}
+80109e29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109e2c:	5b                   	pop    %ebx
+80109e2d:	5e                   	pop    %esi
+80109e2e:	5f                   	pop    %edi
+80109e2f:	5d                   	pop    %ebp
+80109e30:	c3                   	ret
+80109e31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109e38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109e3f:	90                   	nop
+
+80109e40 <uartputc>:
+  if(!uart)
+80109e40:	a1 20 a4 13 80       	mov    0x8013a420,%eax
+80109e45:	85 c0                	test   %eax,%eax
+80109e47:	74 4f                	je     80109e98 <uartputc+0x58>
+{
+80109e49:	55                   	push   %ebp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109e4a:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109e4f:	89 e5                	mov    %esp,%ebp
+80109e51:	56                   	push   %esi
+80109e52:	53                   	push   %ebx
+80109e53:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109e54:	a8 20                	test   $0x20,%al
+80109e56:	75 29                	jne    80109e81 <uartputc+0x41>
+80109e58:	bb 80 00 00 00       	mov    $0x80,%ebx
+80109e5d:	be fd 03 00 00       	mov    $0x3fd,%esi
+80109e62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    microdelay(10);
+80109e68:	83 ec 0c             	sub    $0xc,%esp
+80109e6b:	6a 0a                	push   $0xa
+80109e6d:	e8 de 8f ff ff       	call   80102e50 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109e72:	83 c4 10             	add    $0x10,%esp
+80109e75:	83 eb 01             	sub    $0x1,%ebx
+80109e78:	74 07                	je     80109e81 <uartputc+0x41>
+80109e7a:	89 f2                	mov    %esi,%edx
+80109e7c:	ec                   	in     (%dx),%al
+80109e7d:	a8 20                	test   $0x20,%al
+80109e7f:	74 e7                	je     80109e68 <uartputc+0x28>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109e81:	8b 45 08             	mov    0x8(%ebp),%eax
+80109e84:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109e89:	ee                   	out    %al,(%dx)
+}
+80109e8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109e8d:	5b                   	pop    %ebx
+80109e8e:	5e                   	pop    %esi
+80109e8f:	5d                   	pop    %ebp
+80109e90:	c3                   	ret
+80109e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109e98:	c3                   	ret
+80109e99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80109ea0 <uartintr>:
+
+void
+uartintr(void)
+{
+80109ea0:	55                   	push   %ebp
+80109ea1:	89 e5                	mov    %esp,%ebp
+80109ea3:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+80109ea6:	68 20 9d 10 80       	push   $0x80109d20
+80109eab:	e8 10 6a ff ff       	call   801008c0 <consoleintr>
+}
+80109eb0:	83 c4 10             	add    $0x10,%esp
+80109eb3:	c9                   	leave
+80109eb4:	c3                   	ret
+
+80109eb5 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+80109eb5:	6a 00                	push   $0x0
+  pushl $0
+80109eb7:	6a 00                	push   $0x0
+  jmp alltraps
+80109eb9:	e9 f1 f9 ff ff       	jmp    801098af <alltraps>
+
+80109ebe <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+80109ebe:	6a 00                	push   $0x0
+  pushl $1
+80109ec0:	6a 01                	push   $0x1
+  jmp alltraps
+80109ec2:	e9 e8 f9 ff ff       	jmp    801098af <alltraps>
+
+80109ec7 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+80109ec7:	6a 00                	push   $0x0
+  pushl $2
+80109ec9:	6a 02                	push   $0x2
+  jmp alltraps
+80109ecb:	e9 df f9 ff ff       	jmp    801098af <alltraps>
+
+80109ed0 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+80109ed0:	6a 00                	push   $0x0
+  pushl $3
+80109ed2:	6a 03                	push   $0x3
+  jmp alltraps
+80109ed4:	e9 d6 f9 ff ff       	jmp    801098af <alltraps>
+
+80109ed9 <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+80109ed9:	6a 00                	push   $0x0
+  pushl $4
+80109edb:	6a 04                	push   $0x4
+  jmp alltraps
+80109edd:	e9 cd f9 ff ff       	jmp    801098af <alltraps>
+
+80109ee2 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+80109ee2:	6a 00                	push   $0x0
+  pushl $5
+80109ee4:	6a 05                	push   $0x5
+  jmp alltraps
+80109ee6:	e9 c4 f9 ff ff       	jmp    801098af <alltraps>
+
+80109eeb <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+80109eeb:	6a 00                	push   $0x0
+  pushl $6
+80109eed:	6a 06                	push   $0x6
+  jmp alltraps
+80109eef:	e9 bb f9 ff ff       	jmp    801098af <alltraps>
+
+80109ef4 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+80109ef4:	6a 00                	push   $0x0
+  pushl $7
+80109ef6:	6a 07                	push   $0x7
+  jmp alltraps
+80109ef8:	e9 b2 f9 ff ff       	jmp    801098af <alltraps>
+
+80109efd <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+80109efd:	6a 08                	push   $0x8
+  jmp alltraps
+80109eff:	e9 ab f9 ff ff       	jmp    801098af <alltraps>
+
+80109f04 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+80109f04:	6a 00                	push   $0x0
+  pushl $9
+80109f06:	6a 09                	push   $0x9
+  jmp alltraps
+80109f08:	e9 a2 f9 ff ff       	jmp    801098af <alltraps>
+
+80109f0d <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+80109f0d:	6a 0a                	push   $0xa
+  jmp alltraps
+80109f0f:	e9 9b f9 ff ff       	jmp    801098af <alltraps>
+
+80109f14 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+80109f14:	6a 0b                	push   $0xb
+  jmp alltraps
+80109f16:	e9 94 f9 ff ff       	jmp    801098af <alltraps>
+
+80109f1b <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+80109f1b:	6a 0c                	push   $0xc
+  jmp alltraps
+80109f1d:	e9 8d f9 ff ff       	jmp    801098af <alltraps>
+
+80109f22 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+80109f22:	6a 0d                	push   $0xd
+  jmp alltraps
+80109f24:	e9 86 f9 ff ff       	jmp    801098af <alltraps>
+
+80109f29 <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+80109f29:	6a 0e                	push   $0xe
+  jmp alltraps
+80109f2b:	e9 7f f9 ff ff       	jmp    801098af <alltraps>
+
+80109f30 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+80109f30:	6a 00                	push   $0x0
+  pushl $15
+80109f32:	6a 0f                	push   $0xf
+  jmp alltraps
+80109f34:	e9 76 f9 ff ff       	jmp    801098af <alltraps>
+
+80109f39 <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+80109f39:	6a 00                	push   $0x0
+  pushl $16
+80109f3b:	6a 10                	push   $0x10
+  jmp alltraps
+80109f3d:	e9 6d f9 ff ff       	jmp    801098af <alltraps>
+
+80109f42 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+80109f42:	6a 11                	push   $0x11
+  jmp alltraps
+80109f44:	e9 66 f9 ff ff       	jmp    801098af <alltraps>
+
+80109f49 <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+80109f49:	6a 00                	push   $0x0
+  pushl $18
+80109f4b:	6a 12                	push   $0x12
+  jmp alltraps
+80109f4d:	e9 5d f9 ff ff       	jmp    801098af <alltraps>
+
+80109f52 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+80109f52:	6a 00                	push   $0x0
+  pushl $19
+80109f54:	6a 13                	push   $0x13
+  jmp alltraps
+80109f56:	e9 54 f9 ff ff       	jmp    801098af <alltraps>
+
+80109f5b <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+80109f5b:	6a 00                	push   $0x0
+  pushl $20
+80109f5d:	6a 14                	push   $0x14
+  jmp alltraps
+80109f5f:	e9 4b f9 ff ff       	jmp    801098af <alltraps>
+
+80109f64 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+80109f64:	6a 00                	push   $0x0
+  pushl $21
+80109f66:	6a 15                	push   $0x15
+  jmp alltraps
+80109f68:	e9 42 f9 ff ff       	jmp    801098af <alltraps>
+
+80109f6d <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+80109f6d:	6a 00                	push   $0x0
+  pushl $22
+80109f6f:	6a 16                	push   $0x16
+  jmp alltraps
+80109f71:	e9 39 f9 ff ff       	jmp    801098af <alltraps>
+
+80109f76 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+80109f76:	6a 00                	push   $0x0
+  pushl $23
+80109f78:	6a 17                	push   $0x17
+  jmp alltraps
+80109f7a:	e9 30 f9 ff ff       	jmp    801098af <alltraps>
+
+80109f7f <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+80109f7f:	6a 00                	push   $0x0
+  pushl $24
+80109f81:	6a 18                	push   $0x18
+  jmp alltraps
+80109f83:	e9 27 f9 ff ff       	jmp    801098af <alltraps>
+
+80109f88 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+80109f88:	6a 00                	push   $0x0
+  pushl $25
+80109f8a:	6a 19                	push   $0x19
+  jmp alltraps
+80109f8c:	e9 1e f9 ff ff       	jmp    801098af <alltraps>
+
+80109f91 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+80109f91:	6a 00                	push   $0x0
+  pushl $26
+80109f93:	6a 1a                	push   $0x1a
+  jmp alltraps
+80109f95:	e9 15 f9 ff ff       	jmp    801098af <alltraps>
+
+80109f9a <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+80109f9a:	6a 00                	push   $0x0
+  pushl $27
+80109f9c:	6a 1b                	push   $0x1b
+  jmp alltraps
+80109f9e:	e9 0c f9 ff ff       	jmp    801098af <alltraps>
+
+80109fa3 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+80109fa3:	6a 00                	push   $0x0
+  pushl $28
+80109fa5:	6a 1c                	push   $0x1c
+  jmp alltraps
+80109fa7:	e9 03 f9 ff ff       	jmp    801098af <alltraps>
+
+80109fac <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+80109fac:	6a 00                	push   $0x0
+  pushl $29
+80109fae:	6a 1d                	push   $0x1d
+  jmp alltraps
+80109fb0:	e9 fa f8 ff ff       	jmp    801098af <alltraps>
+
+80109fb5 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+80109fb5:	6a 00                	push   $0x0
+  pushl $30
+80109fb7:	6a 1e                	push   $0x1e
+  jmp alltraps
+80109fb9:	e9 f1 f8 ff ff       	jmp    801098af <alltraps>
+
+80109fbe <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+80109fbe:	6a 00                	push   $0x0
+  pushl $31
+80109fc0:	6a 1f                	push   $0x1f
+  jmp alltraps
+80109fc2:	e9 e8 f8 ff ff       	jmp    801098af <alltraps>
+
+80109fc7 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+80109fc7:	6a 00                	push   $0x0
+  pushl $32
+80109fc9:	6a 20                	push   $0x20
+  jmp alltraps
+80109fcb:	e9 df f8 ff ff       	jmp    801098af <alltraps>
+
+80109fd0 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+80109fd0:	6a 00                	push   $0x0
+  pushl $33
+80109fd2:	6a 21                	push   $0x21
+  jmp alltraps
+80109fd4:	e9 d6 f8 ff ff       	jmp    801098af <alltraps>
+
+80109fd9 <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+80109fd9:	6a 00                	push   $0x0
+  pushl $34
+80109fdb:	6a 22                	push   $0x22
+  jmp alltraps
+80109fdd:	e9 cd f8 ff ff       	jmp    801098af <alltraps>
+
+80109fe2 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+80109fe2:	6a 00                	push   $0x0
+  pushl $35
+80109fe4:	6a 23                	push   $0x23
+  jmp alltraps
+80109fe6:	e9 c4 f8 ff ff       	jmp    801098af <alltraps>
+
+80109feb <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+80109feb:	6a 00                	push   $0x0
+  pushl $36
+80109fed:	6a 24                	push   $0x24
+  jmp alltraps
+80109fef:	e9 bb f8 ff ff       	jmp    801098af <alltraps>
+
+80109ff4 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+80109ff4:	6a 00                	push   $0x0
+  pushl $37
+80109ff6:	6a 25                	push   $0x25
+  jmp alltraps
+80109ff8:	e9 b2 f8 ff ff       	jmp    801098af <alltraps>
+
+80109ffd <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+80109ffd:	6a 00                	push   $0x0
+  pushl $38
+80109fff:	6a 26                	push   $0x26
+  jmp alltraps
+8010a001:	e9 a9 f8 ff ff       	jmp    801098af <alltraps>
+
+8010a006 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+8010a006:	6a 00                	push   $0x0
+  pushl $39
+8010a008:	6a 27                	push   $0x27
+  jmp alltraps
+8010a00a:	e9 a0 f8 ff ff       	jmp    801098af <alltraps>
+
+8010a00f <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+8010a00f:	6a 00                	push   $0x0
+  pushl $40
+8010a011:	6a 28                	push   $0x28
+  jmp alltraps
+8010a013:	e9 97 f8 ff ff       	jmp    801098af <alltraps>
+
+8010a018 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+8010a018:	6a 00                	push   $0x0
+  pushl $41
+8010a01a:	6a 29                	push   $0x29
+  jmp alltraps
+8010a01c:	e9 8e f8 ff ff       	jmp    801098af <alltraps>
+
+8010a021 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+8010a021:	6a 00                	push   $0x0
+  pushl $42
+8010a023:	6a 2a                	push   $0x2a
+  jmp alltraps
+8010a025:	e9 85 f8 ff ff       	jmp    801098af <alltraps>
+
+8010a02a <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+8010a02a:	6a 00                	push   $0x0
+  pushl $43
+8010a02c:	6a 2b                	push   $0x2b
+  jmp alltraps
+8010a02e:	e9 7c f8 ff ff       	jmp    801098af <alltraps>
+
+8010a033 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+8010a033:	6a 00                	push   $0x0
+  pushl $44
+8010a035:	6a 2c                	push   $0x2c
+  jmp alltraps
+8010a037:	e9 73 f8 ff ff       	jmp    801098af <alltraps>
+
+8010a03c <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+8010a03c:	6a 00                	push   $0x0
+  pushl $45
+8010a03e:	6a 2d                	push   $0x2d
+  jmp alltraps
+8010a040:	e9 6a f8 ff ff       	jmp    801098af <alltraps>
+
+8010a045 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+8010a045:	6a 00                	push   $0x0
+  pushl $46
+8010a047:	6a 2e                	push   $0x2e
+  jmp alltraps
+8010a049:	e9 61 f8 ff ff       	jmp    801098af <alltraps>
+
+8010a04e <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+8010a04e:	6a 00                	push   $0x0
+  pushl $47
+8010a050:	6a 2f                	push   $0x2f
+  jmp alltraps
+8010a052:	e9 58 f8 ff ff       	jmp    801098af <alltraps>
+
+8010a057 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+8010a057:	6a 00                	push   $0x0
+  pushl $48
+8010a059:	6a 30                	push   $0x30
+  jmp alltraps
+8010a05b:	e9 4f f8 ff ff       	jmp    801098af <alltraps>
+
+8010a060 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+8010a060:	6a 00                	push   $0x0
+  pushl $49
+8010a062:	6a 31                	push   $0x31
+  jmp alltraps
+8010a064:	e9 46 f8 ff ff       	jmp    801098af <alltraps>
+
+8010a069 <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+8010a069:	6a 00                	push   $0x0
+  pushl $50
+8010a06b:	6a 32                	push   $0x32
+  jmp alltraps
+8010a06d:	e9 3d f8 ff ff       	jmp    801098af <alltraps>
+
+8010a072 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+8010a072:	6a 00                	push   $0x0
+  pushl $51
+8010a074:	6a 33                	push   $0x33
+  jmp alltraps
+8010a076:	e9 34 f8 ff ff       	jmp    801098af <alltraps>
+
+8010a07b <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+8010a07b:	6a 00                	push   $0x0
+  pushl $52
+8010a07d:	6a 34                	push   $0x34
+  jmp alltraps
+8010a07f:	e9 2b f8 ff ff       	jmp    801098af <alltraps>
+
+8010a084 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+8010a084:	6a 00                	push   $0x0
+  pushl $53
+8010a086:	6a 35                	push   $0x35
+  jmp alltraps
+8010a088:	e9 22 f8 ff ff       	jmp    801098af <alltraps>
+
+8010a08d <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+8010a08d:	6a 00                	push   $0x0
+  pushl $54
+8010a08f:	6a 36                	push   $0x36
+  jmp alltraps
+8010a091:	e9 19 f8 ff ff       	jmp    801098af <alltraps>
+
+8010a096 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+8010a096:	6a 00                	push   $0x0
+  pushl $55
+8010a098:	6a 37                	push   $0x37
+  jmp alltraps
+8010a09a:	e9 10 f8 ff ff       	jmp    801098af <alltraps>
+
+8010a09f <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+8010a09f:	6a 00                	push   $0x0
+  pushl $56
+8010a0a1:	6a 38                	push   $0x38
+  jmp alltraps
+8010a0a3:	e9 07 f8 ff ff       	jmp    801098af <alltraps>
+
+8010a0a8 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+8010a0a8:	6a 00                	push   $0x0
+  pushl $57
+8010a0aa:	6a 39                	push   $0x39
+  jmp alltraps
+8010a0ac:	e9 fe f7 ff ff       	jmp    801098af <alltraps>
+
+8010a0b1 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+8010a0b1:	6a 00                	push   $0x0
+  pushl $58
+8010a0b3:	6a 3a                	push   $0x3a
+  jmp alltraps
+8010a0b5:	e9 f5 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a0ba <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+8010a0ba:	6a 00                	push   $0x0
+  pushl $59
+8010a0bc:	6a 3b                	push   $0x3b
+  jmp alltraps
+8010a0be:	e9 ec f7 ff ff       	jmp    801098af <alltraps>
+
+8010a0c3 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+8010a0c3:	6a 00                	push   $0x0
+  pushl $60
+8010a0c5:	6a 3c                	push   $0x3c
+  jmp alltraps
+8010a0c7:	e9 e3 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a0cc <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+8010a0cc:	6a 00                	push   $0x0
+  pushl $61
+8010a0ce:	6a 3d                	push   $0x3d
+  jmp alltraps
+8010a0d0:	e9 da f7 ff ff       	jmp    801098af <alltraps>
+
+8010a0d5 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+8010a0d5:	6a 00                	push   $0x0
+  pushl $62
+8010a0d7:	6a 3e                	push   $0x3e
+  jmp alltraps
+8010a0d9:	e9 d1 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a0de <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+8010a0de:	6a 00                	push   $0x0
+  pushl $63
+8010a0e0:	6a 3f                	push   $0x3f
+  jmp alltraps
+8010a0e2:	e9 c8 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a0e7 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+8010a0e7:	6a 00                	push   $0x0
+  pushl $64
+8010a0e9:	6a 40                	push   $0x40
+  jmp alltraps
+8010a0eb:	e9 bf f7 ff ff       	jmp    801098af <alltraps>
+
+8010a0f0 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+8010a0f0:	6a 00                	push   $0x0
+  pushl $65
+8010a0f2:	6a 41                	push   $0x41
+  jmp alltraps
+8010a0f4:	e9 b6 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a0f9 <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+8010a0f9:	6a 00                	push   $0x0
+  pushl $66
+8010a0fb:	6a 42                	push   $0x42
+  jmp alltraps
+8010a0fd:	e9 ad f7 ff ff       	jmp    801098af <alltraps>
+
+8010a102 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+8010a102:	6a 00                	push   $0x0
+  pushl $67
+8010a104:	6a 43                	push   $0x43
+  jmp alltraps
+8010a106:	e9 a4 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a10b <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+8010a10b:	6a 00                	push   $0x0
+  pushl $68
+8010a10d:	6a 44                	push   $0x44
+  jmp alltraps
+8010a10f:	e9 9b f7 ff ff       	jmp    801098af <alltraps>
+
+8010a114 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+8010a114:	6a 00                	push   $0x0
+  pushl $69
+8010a116:	6a 45                	push   $0x45
+  jmp alltraps
+8010a118:	e9 92 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a11d <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+8010a11d:	6a 00                	push   $0x0
+  pushl $70
+8010a11f:	6a 46                	push   $0x46
+  jmp alltraps
+8010a121:	e9 89 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a126 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+8010a126:	6a 00                	push   $0x0
+  pushl $71
+8010a128:	6a 47                	push   $0x47
+  jmp alltraps
+8010a12a:	e9 80 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a12f <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+8010a12f:	6a 00                	push   $0x0
+  pushl $72
+8010a131:	6a 48                	push   $0x48
+  jmp alltraps
+8010a133:	e9 77 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a138 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+8010a138:	6a 00                	push   $0x0
+  pushl $73
+8010a13a:	6a 49                	push   $0x49
+  jmp alltraps
+8010a13c:	e9 6e f7 ff ff       	jmp    801098af <alltraps>
+
+8010a141 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+8010a141:	6a 00                	push   $0x0
+  pushl $74
+8010a143:	6a 4a                	push   $0x4a
+  jmp alltraps
+8010a145:	e9 65 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a14a <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+8010a14a:	6a 00                	push   $0x0
+  pushl $75
+8010a14c:	6a 4b                	push   $0x4b
+  jmp alltraps
+8010a14e:	e9 5c f7 ff ff       	jmp    801098af <alltraps>
+
+8010a153 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+8010a153:	6a 00                	push   $0x0
+  pushl $76
+8010a155:	6a 4c                	push   $0x4c
+  jmp alltraps
+8010a157:	e9 53 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a15c <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+8010a15c:	6a 00                	push   $0x0
+  pushl $77
+8010a15e:	6a 4d                	push   $0x4d
+  jmp alltraps
+8010a160:	e9 4a f7 ff ff       	jmp    801098af <alltraps>
+
+8010a165 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+8010a165:	6a 00                	push   $0x0
+  pushl $78
+8010a167:	6a 4e                	push   $0x4e
+  jmp alltraps
+8010a169:	e9 41 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a16e <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+8010a16e:	6a 00                	push   $0x0
+  pushl $79
+8010a170:	6a 4f                	push   $0x4f
+  jmp alltraps
+8010a172:	e9 38 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a177 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+8010a177:	6a 00                	push   $0x0
+  pushl $80
+8010a179:	6a 50                	push   $0x50
+  jmp alltraps
+8010a17b:	e9 2f f7 ff ff       	jmp    801098af <alltraps>
+
+8010a180 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+8010a180:	6a 00                	push   $0x0
+  pushl $81
+8010a182:	6a 51                	push   $0x51
+  jmp alltraps
+8010a184:	e9 26 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a189 <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+8010a189:	6a 00                	push   $0x0
+  pushl $82
+8010a18b:	6a 52                	push   $0x52
+  jmp alltraps
+8010a18d:	e9 1d f7 ff ff       	jmp    801098af <alltraps>
+
+8010a192 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+8010a192:	6a 00                	push   $0x0
+  pushl $83
+8010a194:	6a 53                	push   $0x53
+  jmp alltraps
+8010a196:	e9 14 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a19b <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+8010a19b:	6a 00                	push   $0x0
+  pushl $84
+8010a19d:	6a 54                	push   $0x54
+  jmp alltraps
+8010a19f:	e9 0b f7 ff ff       	jmp    801098af <alltraps>
+
+8010a1a4 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+8010a1a4:	6a 00                	push   $0x0
+  pushl $85
+8010a1a6:	6a 55                	push   $0x55
+  jmp alltraps
+8010a1a8:	e9 02 f7 ff ff       	jmp    801098af <alltraps>
+
+8010a1ad <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+8010a1ad:	6a 00                	push   $0x0
+  pushl $86
+8010a1af:	6a 56                	push   $0x56
+  jmp alltraps
+8010a1b1:	e9 f9 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a1b6 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+8010a1b6:	6a 00                	push   $0x0
+  pushl $87
+8010a1b8:	6a 57                	push   $0x57
+  jmp alltraps
+8010a1ba:	e9 f0 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a1bf <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+8010a1bf:	6a 00                	push   $0x0
+  pushl $88
+8010a1c1:	6a 58                	push   $0x58
+  jmp alltraps
+8010a1c3:	e9 e7 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a1c8 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+8010a1c8:	6a 00                	push   $0x0
+  pushl $89
+8010a1ca:	6a 59                	push   $0x59
+  jmp alltraps
+8010a1cc:	e9 de f6 ff ff       	jmp    801098af <alltraps>
+
+8010a1d1 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+8010a1d1:	6a 00                	push   $0x0
+  pushl $90
+8010a1d3:	6a 5a                	push   $0x5a
+  jmp alltraps
+8010a1d5:	e9 d5 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a1da <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+8010a1da:	6a 00                	push   $0x0
+  pushl $91
+8010a1dc:	6a 5b                	push   $0x5b
+  jmp alltraps
+8010a1de:	e9 cc f6 ff ff       	jmp    801098af <alltraps>
+
+8010a1e3 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+8010a1e3:	6a 00                	push   $0x0
+  pushl $92
+8010a1e5:	6a 5c                	push   $0x5c
+  jmp alltraps
+8010a1e7:	e9 c3 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a1ec <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+8010a1ec:	6a 00                	push   $0x0
+  pushl $93
+8010a1ee:	6a 5d                	push   $0x5d
+  jmp alltraps
+8010a1f0:	e9 ba f6 ff ff       	jmp    801098af <alltraps>
+
+8010a1f5 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+8010a1f5:	6a 00                	push   $0x0
+  pushl $94
+8010a1f7:	6a 5e                	push   $0x5e
+  jmp alltraps
+8010a1f9:	e9 b1 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a1fe <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+8010a1fe:	6a 00                	push   $0x0
+  pushl $95
+8010a200:	6a 5f                	push   $0x5f
+  jmp alltraps
+8010a202:	e9 a8 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a207 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+8010a207:	6a 00                	push   $0x0
+  pushl $96
+8010a209:	6a 60                	push   $0x60
+  jmp alltraps
+8010a20b:	e9 9f f6 ff ff       	jmp    801098af <alltraps>
+
+8010a210 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+8010a210:	6a 00                	push   $0x0
+  pushl $97
+8010a212:	6a 61                	push   $0x61
+  jmp alltraps
+8010a214:	e9 96 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a219 <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+8010a219:	6a 00                	push   $0x0
+  pushl $98
+8010a21b:	6a 62                	push   $0x62
+  jmp alltraps
+8010a21d:	e9 8d f6 ff ff       	jmp    801098af <alltraps>
+
+8010a222 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+8010a222:	6a 00                	push   $0x0
+  pushl $99
+8010a224:	6a 63                	push   $0x63
+  jmp alltraps
+8010a226:	e9 84 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a22b <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+8010a22b:	6a 00                	push   $0x0
+  pushl $100
+8010a22d:	6a 64                	push   $0x64
+  jmp alltraps
+8010a22f:	e9 7b f6 ff ff       	jmp    801098af <alltraps>
+
+8010a234 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+8010a234:	6a 00                	push   $0x0
+  pushl $101
+8010a236:	6a 65                	push   $0x65
+  jmp alltraps
+8010a238:	e9 72 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a23d <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+8010a23d:	6a 00                	push   $0x0
+  pushl $102
+8010a23f:	6a 66                	push   $0x66
+  jmp alltraps
+8010a241:	e9 69 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a246 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+8010a246:	6a 00                	push   $0x0
+  pushl $103
+8010a248:	6a 67                	push   $0x67
+  jmp alltraps
+8010a24a:	e9 60 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a24f <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+8010a24f:	6a 00                	push   $0x0
+  pushl $104
+8010a251:	6a 68                	push   $0x68
+  jmp alltraps
+8010a253:	e9 57 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a258 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+8010a258:	6a 00                	push   $0x0
+  pushl $105
+8010a25a:	6a 69                	push   $0x69
+  jmp alltraps
+8010a25c:	e9 4e f6 ff ff       	jmp    801098af <alltraps>
+
+8010a261 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+8010a261:	6a 00                	push   $0x0
+  pushl $106
+8010a263:	6a 6a                	push   $0x6a
+  jmp alltraps
+8010a265:	e9 45 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a26a <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+8010a26a:	6a 00                	push   $0x0
+  pushl $107
+8010a26c:	6a 6b                	push   $0x6b
+  jmp alltraps
+8010a26e:	e9 3c f6 ff ff       	jmp    801098af <alltraps>
+
+8010a273 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+8010a273:	6a 00                	push   $0x0
+  pushl $108
+8010a275:	6a 6c                	push   $0x6c
+  jmp alltraps
+8010a277:	e9 33 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a27c <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+8010a27c:	6a 00                	push   $0x0
+  pushl $109
+8010a27e:	6a 6d                	push   $0x6d
+  jmp alltraps
+8010a280:	e9 2a f6 ff ff       	jmp    801098af <alltraps>
+
+8010a285 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+8010a285:	6a 00                	push   $0x0
+  pushl $110
+8010a287:	6a 6e                	push   $0x6e
+  jmp alltraps
+8010a289:	e9 21 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a28e <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+8010a28e:	6a 00                	push   $0x0
+  pushl $111
+8010a290:	6a 6f                	push   $0x6f
+  jmp alltraps
+8010a292:	e9 18 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a297 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+8010a297:	6a 00                	push   $0x0
+  pushl $112
+8010a299:	6a 70                	push   $0x70
+  jmp alltraps
+8010a29b:	e9 0f f6 ff ff       	jmp    801098af <alltraps>
+
+8010a2a0 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+8010a2a0:	6a 00                	push   $0x0
+  pushl $113
+8010a2a2:	6a 71                	push   $0x71
+  jmp alltraps
+8010a2a4:	e9 06 f6 ff ff       	jmp    801098af <alltraps>
+
+8010a2a9 <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+8010a2a9:	6a 00                	push   $0x0
+  pushl $114
+8010a2ab:	6a 72                	push   $0x72
+  jmp alltraps
+8010a2ad:	e9 fd f5 ff ff       	jmp    801098af <alltraps>
+
+8010a2b2 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+8010a2b2:	6a 00                	push   $0x0
+  pushl $115
+8010a2b4:	6a 73                	push   $0x73
+  jmp alltraps
+8010a2b6:	e9 f4 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a2bb <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+8010a2bb:	6a 00                	push   $0x0
+  pushl $116
+8010a2bd:	6a 74                	push   $0x74
+  jmp alltraps
+8010a2bf:	e9 eb f5 ff ff       	jmp    801098af <alltraps>
+
+8010a2c4 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+8010a2c4:	6a 00                	push   $0x0
+  pushl $117
+8010a2c6:	6a 75                	push   $0x75
+  jmp alltraps
+8010a2c8:	e9 e2 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a2cd <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+8010a2cd:	6a 00                	push   $0x0
+  pushl $118
+8010a2cf:	6a 76                	push   $0x76
+  jmp alltraps
+8010a2d1:	e9 d9 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a2d6 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+8010a2d6:	6a 00                	push   $0x0
+  pushl $119
+8010a2d8:	6a 77                	push   $0x77
+  jmp alltraps
+8010a2da:	e9 d0 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a2df <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+8010a2df:	6a 00                	push   $0x0
+  pushl $120
+8010a2e1:	6a 78                	push   $0x78
+  jmp alltraps
+8010a2e3:	e9 c7 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a2e8 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+8010a2e8:	6a 00                	push   $0x0
+  pushl $121
+8010a2ea:	6a 79                	push   $0x79
+  jmp alltraps
+8010a2ec:	e9 be f5 ff ff       	jmp    801098af <alltraps>
+
+8010a2f1 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+8010a2f1:	6a 00                	push   $0x0
+  pushl $122
+8010a2f3:	6a 7a                	push   $0x7a
+  jmp alltraps
+8010a2f5:	e9 b5 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a2fa <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+8010a2fa:	6a 00                	push   $0x0
+  pushl $123
+8010a2fc:	6a 7b                	push   $0x7b
+  jmp alltraps
+8010a2fe:	e9 ac f5 ff ff       	jmp    801098af <alltraps>
+
+8010a303 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+8010a303:	6a 00                	push   $0x0
+  pushl $124
+8010a305:	6a 7c                	push   $0x7c
+  jmp alltraps
+8010a307:	e9 a3 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a30c <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+8010a30c:	6a 00                	push   $0x0
+  pushl $125
+8010a30e:	6a 7d                	push   $0x7d
+  jmp alltraps
+8010a310:	e9 9a f5 ff ff       	jmp    801098af <alltraps>
+
+8010a315 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+8010a315:	6a 00                	push   $0x0
+  pushl $126
+8010a317:	6a 7e                	push   $0x7e
+  jmp alltraps
+8010a319:	e9 91 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a31e <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+8010a31e:	6a 00                	push   $0x0
+  pushl $127
+8010a320:	6a 7f                	push   $0x7f
+  jmp alltraps
+8010a322:	e9 88 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a327 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+8010a327:	6a 00                	push   $0x0
+  pushl $128
+8010a329:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+8010a32e:	e9 7c f5 ff ff       	jmp    801098af <alltraps>
+
+8010a333 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+8010a333:	6a 00                	push   $0x0
+  pushl $129
+8010a335:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+8010a33a:	e9 70 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a33f <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+8010a33f:	6a 00                	push   $0x0
+  pushl $130
+8010a341:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+8010a346:	e9 64 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a34b <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+8010a34b:	6a 00                	push   $0x0
+  pushl $131
+8010a34d:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+8010a352:	e9 58 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a357 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+8010a357:	6a 00                	push   $0x0
+  pushl $132
+8010a359:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+8010a35e:	e9 4c f5 ff ff       	jmp    801098af <alltraps>
+
+8010a363 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+8010a363:	6a 00                	push   $0x0
+  pushl $133
+8010a365:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+8010a36a:	e9 40 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a36f <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+8010a36f:	6a 00                	push   $0x0
+  pushl $134
+8010a371:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+8010a376:	e9 34 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a37b <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+8010a37b:	6a 00                	push   $0x0
+  pushl $135
+8010a37d:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+8010a382:	e9 28 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a387 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+8010a387:	6a 00                	push   $0x0
+  pushl $136
+8010a389:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+8010a38e:	e9 1c f5 ff ff       	jmp    801098af <alltraps>
+
+8010a393 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+8010a393:	6a 00                	push   $0x0
+  pushl $137
+8010a395:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+8010a39a:	e9 10 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a39f <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+8010a39f:	6a 00                	push   $0x0
+  pushl $138
+8010a3a1:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+8010a3a6:	e9 04 f5 ff ff       	jmp    801098af <alltraps>
+
+8010a3ab <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+8010a3ab:	6a 00                	push   $0x0
+  pushl $139
+8010a3ad:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+8010a3b2:	e9 f8 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a3b7 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+8010a3b7:	6a 00                	push   $0x0
+  pushl $140
+8010a3b9:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+8010a3be:	e9 ec f4 ff ff       	jmp    801098af <alltraps>
+
+8010a3c3 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+8010a3c3:	6a 00                	push   $0x0
+  pushl $141
+8010a3c5:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+8010a3ca:	e9 e0 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a3cf <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+8010a3cf:	6a 00                	push   $0x0
+  pushl $142
+8010a3d1:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+8010a3d6:	e9 d4 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a3db <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+8010a3db:	6a 00                	push   $0x0
+  pushl $143
+8010a3dd:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+8010a3e2:	e9 c8 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a3e7 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+8010a3e7:	6a 00                	push   $0x0
+  pushl $144
+8010a3e9:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+8010a3ee:	e9 bc f4 ff ff       	jmp    801098af <alltraps>
+
+8010a3f3 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+8010a3f3:	6a 00                	push   $0x0
+  pushl $145
+8010a3f5:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+8010a3fa:	e9 b0 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a3ff <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+8010a3ff:	6a 00                	push   $0x0
+  pushl $146
+8010a401:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+8010a406:	e9 a4 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a40b <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+8010a40b:	6a 00                	push   $0x0
+  pushl $147
+8010a40d:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+8010a412:	e9 98 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a417 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+8010a417:	6a 00                	push   $0x0
+  pushl $148
+8010a419:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+8010a41e:	e9 8c f4 ff ff       	jmp    801098af <alltraps>
+
+8010a423 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+8010a423:	6a 00                	push   $0x0
+  pushl $149
+8010a425:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+8010a42a:	e9 80 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a42f <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+8010a42f:	6a 00                	push   $0x0
+  pushl $150
+8010a431:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+8010a436:	e9 74 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a43b <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+8010a43b:	6a 00                	push   $0x0
+  pushl $151
+8010a43d:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+8010a442:	e9 68 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a447 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+8010a447:	6a 00                	push   $0x0
+  pushl $152
+8010a449:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+8010a44e:	e9 5c f4 ff ff       	jmp    801098af <alltraps>
+
+8010a453 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+8010a453:	6a 00                	push   $0x0
+  pushl $153
+8010a455:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+8010a45a:	e9 50 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a45f <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+8010a45f:	6a 00                	push   $0x0
+  pushl $154
+8010a461:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+8010a466:	e9 44 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a46b <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+8010a46b:	6a 00                	push   $0x0
+  pushl $155
+8010a46d:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+8010a472:	e9 38 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a477 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+8010a477:	6a 00                	push   $0x0
+  pushl $156
+8010a479:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+8010a47e:	e9 2c f4 ff ff       	jmp    801098af <alltraps>
+
+8010a483 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+8010a483:	6a 00                	push   $0x0
+  pushl $157
+8010a485:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+8010a48a:	e9 20 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a48f <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+8010a48f:	6a 00                	push   $0x0
+  pushl $158
+8010a491:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+8010a496:	e9 14 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a49b <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+8010a49b:	6a 00                	push   $0x0
+  pushl $159
+8010a49d:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+8010a4a2:	e9 08 f4 ff ff       	jmp    801098af <alltraps>
+
+8010a4a7 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+8010a4a7:	6a 00                	push   $0x0
+  pushl $160
+8010a4a9:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+8010a4ae:	e9 fc f3 ff ff       	jmp    801098af <alltraps>
+
+8010a4b3 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+8010a4b3:	6a 00                	push   $0x0
+  pushl $161
+8010a4b5:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+8010a4ba:	e9 f0 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a4bf <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+8010a4bf:	6a 00                	push   $0x0
+  pushl $162
+8010a4c1:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+8010a4c6:	e9 e4 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a4cb <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+8010a4cb:	6a 00                	push   $0x0
+  pushl $163
+8010a4cd:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+8010a4d2:	e9 d8 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a4d7 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+8010a4d7:	6a 00                	push   $0x0
+  pushl $164
+8010a4d9:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+8010a4de:	e9 cc f3 ff ff       	jmp    801098af <alltraps>
+
+8010a4e3 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+8010a4e3:	6a 00                	push   $0x0
+  pushl $165
+8010a4e5:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+8010a4ea:	e9 c0 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a4ef <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+8010a4ef:	6a 00                	push   $0x0
+  pushl $166
+8010a4f1:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+8010a4f6:	e9 b4 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a4fb <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+8010a4fb:	6a 00                	push   $0x0
+  pushl $167
+8010a4fd:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+8010a502:	e9 a8 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a507 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+8010a507:	6a 00                	push   $0x0
+  pushl $168
+8010a509:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+8010a50e:	e9 9c f3 ff ff       	jmp    801098af <alltraps>
+
+8010a513 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+8010a513:	6a 00                	push   $0x0
+  pushl $169
+8010a515:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+8010a51a:	e9 90 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a51f <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+8010a51f:	6a 00                	push   $0x0
+  pushl $170
+8010a521:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+8010a526:	e9 84 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a52b <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+8010a52b:	6a 00                	push   $0x0
+  pushl $171
+8010a52d:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+8010a532:	e9 78 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a537 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+8010a537:	6a 00                	push   $0x0
+  pushl $172
+8010a539:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+8010a53e:	e9 6c f3 ff ff       	jmp    801098af <alltraps>
+
+8010a543 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+8010a543:	6a 00                	push   $0x0
+  pushl $173
+8010a545:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+8010a54a:	e9 60 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a54f <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+8010a54f:	6a 00                	push   $0x0
+  pushl $174
+8010a551:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+8010a556:	e9 54 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a55b <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+8010a55b:	6a 00                	push   $0x0
+  pushl $175
+8010a55d:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+8010a562:	e9 48 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a567 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+8010a567:	6a 00                	push   $0x0
+  pushl $176
+8010a569:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+8010a56e:	e9 3c f3 ff ff       	jmp    801098af <alltraps>
+
+8010a573 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+8010a573:	6a 00                	push   $0x0
+  pushl $177
+8010a575:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+8010a57a:	e9 30 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a57f <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+8010a57f:	6a 00                	push   $0x0
+  pushl $178
+8010a581:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+8010a586:	e9 24 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a58b <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+8010a58b:	6a 00                	push   $0x0
+  pushl $179
+8010a58d:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+8010a592:	e9 18 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a597 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+8010a597:	6a 00                	push   $0x0
+  pushl $180
+8010a599:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+8010a59e:	e9 0c f3 ff ff       	jmp    801098af <alltraps>
+
+8010a5a3 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+8010a5a3:	6a 00                	push   $0x0
+  pushl $181
+8010a5a5:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+8010a5aa:	e9 00 f3 ff ff       	jmp    801098af <alltraps>
+
+8010a5af <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+8010a5af:	6a 00                	push   $0x0
+  pushl $182
+8010a5b1:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+8010a5b6:	e9 f4 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a5bb <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+8010a5bb:	6a 00                	push   $0x0
+  pushl $183
+8010a5bd:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+8010a5c2:	e9 e8 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a5c7 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+8010a5c7:	6a 00                	push   $0x0
+  pushl $184
+8010a5c9:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+8010a5ce:	e9 dc f2 ff ff       	jmp    801098af <alltraps>
+
+8010a5d3 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+8010a5d3:	6a 00                	push   $0x0
+  pushl $185
+8010a5d5:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+8010a5da:	e9 d0 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a5df <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+8010a5df:	6a 00                	push   $0x0
+  pushl $186
+8010a5e1:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+8010a5e6:	e9 c4 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a5eb <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+8010a5eb:	6a 00                	push   $0x0
+  pushl $187
+8010a5ed:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+8010a5f2:	e9 b8 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a5f7 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+8010a5f7:	6a 00                	push   $0x0
+  pushl $188
+8010a5f9:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+8010a5fe:	e9 ac f2 ff ff       	jmp    801098af <alltraps>
+
+8010a603 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+8010a603:	6a 00                	push   $0x0
+  pushl $189
+8010a605:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+8010a60a:	e9 a0 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a60f <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+8010a60f:	6a 00                	push   $0x0
+  pushl $190
+8010a611:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+8010a616:	e9 94 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a61b <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+8010a61b:	6a 00                	push   $0x0
+  pushl $191
+8010a61d:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+8010a622:	e9 88 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a627 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+8010a627:	6a 00                	push   $0x0
+  pushl $192
+8010a629:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+8010a62e:	e9 7c f2 ff ff       	jmp    801098af <alltraps>
+
+8010a633 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+8010a633:	6a 00                	push   $0x0
+  pushl $193
+8010a635:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+8010a63a:	e9 70 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a63f <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+8010a63f:	6a 00                	push   $0x0
+  pushl $194
+8010a641:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+8010a646:	e9 64 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a64b <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+8010a64b:	6a 00                	push   $0x0
+  pushl $195
+8010a64d:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+8010a652:	e9 58 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a657 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+8010a657:	6a 00                	push   $0x0
+  pushl $196
+8010a659:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+8010a65e:	e9 4c f2 ff ff       	jmp    801098af <alltraps>
+
+8010a663 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+8010a663:	6a 00                	push   $0x0
+  pushl $197
+8010a665:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+8010a66a:	e9 40 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a66f <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+8010a66f:	6a 00                	push   $0x0
+  pushl $198
+8010a671:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+8010a676:	e9 34 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a67b <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+8010a67b:	6a 00                	push   $0x0
+  pushl $199
+8010a67d:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+8010a682:	e9 28 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a687 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+8010a687:	6a 00                	push   $0x0
+  pushl $200
+8010a689:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+8010a68e:	e9 1c f2 ff ff       	jmp    801098af <alltraps>
+
+8010a693 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+8010a693:	6a 00                	push   $0x0
+  pushl $201
+8010a695:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+8010a69a:	e9 10 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a69f <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+8010a69f:	6a 00                	push   $0x0
+  pushl $202
+8010a6a1:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+8010a6a6:	e9 04 f2 ff ff       	jmp    801098af <alltraps>
+
+8010a6ab <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+8010a6ab:	6a 00                	push   $0x0
+  pushl $203
+8010a6ad:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+8010a6b2:	e9 f8 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a6b7 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+8010a6b7:	6a 00                	push   $0x0
+  pushl $204
+8010a6b9:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+8010a6be:	e9 ec f1 ff ff       	jmp    801098af <alltraps>
+
+8010a6c3 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+8010a6c3:	6a 00                	push   $0x0
+  pushl $205
+8010a6c5:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+8010a6ca:	e9 e0 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a6cf <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+8010a6cf:	6a 00                	push   $0x0
+  pushl $206
+8010a6d1:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+8010a6d6:	e9 d4 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a6db <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+8010a6db:	6a 00                	push   $0x0
+  pushl $207
+8010a6dd:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+8010a6e2:	e9 c8 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a6e7 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+8010a6e7:	6a 00                	push   $0x0
+  pushl $208
+8010a6e9:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+8010a6ee:	e9 bc f1 ff ff       	jmp    801098af <alltraps>
+
+8010a6f3 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+8010a6f3:	6a 00                	push   $0x0
+  pushl $209
+8010a6f5:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+8010a6fa:	e9 b0 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a6ff <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+8010a6ff:	6a 00                	push   $0x0
+  pushl $210
+8010a701:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+8010a706:	e9 a4 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a70b <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+8010a70b:	6a 00                	push   $0x0
+  pushl $211
+8010a70d:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+8010a712:	e9 98 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a717 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+8010a717:	6a 00                	push   $0x0
+  pushl $212
+8010a719:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+8010a71e:	e9 8c f1 ff ff       	jmp    801098af <alltraps>
+
+8010a723 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+8010a723:	6a 00                	push   $0x0
+  pushl $213
+8010a725:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+8010a72a:	e9 80 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a72f <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+8010a72f:	6a 00                	push   $0x0
+  pushl $214
+8010a731:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+8010a736:	e9 74 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a73b <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+8010a73b:	6a 00                	push   $0x0
+  pushl $215
+8010a73d:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+8010a742:	e9 68 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a747 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+8010a747:	6a 00                	push   $0x0
+  pushl $216
+8010a749:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+8010a74e:	e9 5c f1 ff ff       	jmp    801098af <alltraps>
+
+8010a753 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+8010a753:	6a 00                	push   $0x0
+  pushl $217
+8010a755:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+8010a75a:	e9 50 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a75f <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+8010a75f:	6a 00                	push   $0x0
+  pushl $218
+8010a761:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+8010a766:	e9 44 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a76b <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+8010a76b:	6a 00                	push   $0x0
+  pushl $219
+8010a76d:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+8010a772:	e9 38 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a777 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+8010a777:	6a 00                	push   $0x0
+  pushl $220
+8010a779:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+8010a77e:	e9 2c f1 ff ff       	jmp    801098af <alltraps>
+
+8010a783 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+8010a783:	6a 00                	push   $0x0
+  pushl $221
+8010a785:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+8010a78a:	e9 20 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a78f <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+8010a78f:	6a 00                	push   $0x0
+  pushl $222
+8010a791:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+8010a796:	e9 14 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a79b <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+8010a79b:	6a 00                	push   $0x0
+  pushl $223
+8010a79d:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+8010a7a2:	e9 08 f1 ff ff       	jmp    801098af <alltraps>
+
+8010a7a7 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+8010a7a7:	6a 00                	push   $0x0
+  pushl $224
+8010a7a9:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+8010a7ae:	e9 fc f0 ff ff       	jmp    801098af <alltraps>
+
+8010a7b3 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+8010a7b3:	6a 00                	push   $0x0
+  pushl $225
+8010a7b5:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+8010a7ba:	e9 f0 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a7bf <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+8010a7bf:	6a 00                	push   $0x0
+  pushl $226
+8010a7c1:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+8010a7c6:	e9 e4 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a7cb <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+8010a7cb:	6a 00                	push   $0x0
+  pushl $227
+8010a7cd:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+8010a7d2:	e9 d8 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a7d7 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+8010a7d7:	6a 00                	push   $0x0
+  pushl $228
+8010a7d9:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+8010a7de:	e9 cc f0 ff ff       	jmp    801098af <alltraps>
+
+8010a7e3 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+8010a7e3:	6a 00                	push   $0x0
+  pushl $229
+8010a7e5:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+8010a7ea:	e9 c0 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a7ef <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+8010a7ef:	6a 00                	push   $0x0
+  pushl $230
+8010a7f1:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+8010a7f6:	e9 b4 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a7fb <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+8010a7fb:	6a 00                	push   $0x0
+  pushl $231
+8010a7fd:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+8010a802:	e9 a8 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a807 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+8010a807:	6a 00                	push   $0x0
+  pushl $232
+8010a809:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+8010a80e:	e9 9c f0 ff ff       	jmp    801098af <alltraps>
+
+8010a813 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+8010a813:	6a 00                	push   $0x0
+  pushl $233
+8010a815:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+8010a81a:	e9 90 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a81f <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+8010a81f:	6a 00                	push   $0x0
+  pushl $234
+8010a821:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+8010a826:	e9 84 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a82b <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+8010a82b:	6a 00                	push   $0x0
+  pushl $235
+8010a82d:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+8010a832:	e9 78 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a837 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+8010a837:	6a 00                	push   $0x0
+  pushl $236
+8010a839:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+8010a83e:	e9 6c f0 ff ff       	jmp    801098af <alltraps>
+
+8010a843 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+8010a843:	6a 00                	push   $0x0
+  pushl $237
+8010a845:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+8010a84a:	e9 60 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a84f <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+8010a84f:	6a 00                	push   $0x0
+  pushl $238
+8010a851:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+8010a856:	e9 54 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a85b <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+8010a85b:	6a 00                	push   $0x0
+  pushl $239
+8010a85d:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+8010a862:	e9 48 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a867 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+8010a867:	6a 00                	push   $0x0
+  pushl $240
+8010a869:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+8010a86e:	e9 3c f0 ff ff       	jmp    801098af <alltraps>
+
+8010a873 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+8010a873:	6a 00                	push   $0x0
+  pushl $241
+8010a875:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+8010a87a:	e9 30 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a87f <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+8010a87f:	6a 00                	push   $0x0
+  pushl $242
+8010a881:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+8010a886:	e9 24 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a88b <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+8010a88b:	6a 00                	push   $0x0
+  pushl $243
+8010a88d:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+8010a892:	e9 18 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a897 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+8010a897:	6a 00                	push   $0x0
+  pushl $244
+8010a899:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+8010a89e:	e9 0c f0 ff ff       	jmp    801098af <alltraps>
+
+8010a8a3 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+8010a8a3:	6a 00                	push   $0x0
+  pushl $245
+8010a8a5:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+8010a8aa:	e9 00 f0 ff ff       	jmp    801098af <alltraps>
+
+8010a8af <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+8010a8af:	6a 00                	push   $0x0
+  pushl $246
+8010a8b1:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+8010a8b6:	e9 f4 ef ff ff       	jmp    801098af <alltraps>
+
+8010a8bb <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+8010a8bb:	6a 00                	push   $0x0
+  pushl $247
+8010a8bd:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+8010a8c2:	e9 e8 ef ff ff       	jmp    801098af <alltraps>
+
+8010a8c7 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+8010a8c7:	6a 00                	push   $0x0
+  pushl $248
+8010a8c9:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+8010a8ce:	e9 dc ef ff ff       	jmp    801098af <alltraps>
+
+8010a8d3 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+8010a8d3:	6a 00                	push   $0x0
+  pushl $249
+8010a8d5:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+8010a8da:	e9 d0 ef ff ff       	jmp    801098af <alltraps>
+
+8010a8df <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+8010a8df:	6a 00                	push   $0x0
+  pushl $250
+8010a8e1:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+8010a8e6:	e9 c4 ef ff ff       	jmp    801098af <alltraps>
+
+8010a8eb <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+8010a8eb:	6a 00                	push   $0x0
+  pushl $251
+8010a8ed:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+8010a8f2:	e9 b8 ef ff ff       	jmp    801098af <alltraps>
+
+8010a8f7 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+8010a8f7:	6a 00                	push   $0x0
+  pushl $252
+8010a8f9:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+8010a8fe:	e9 ac ef ff ff       	jmp    801098af <alltraps>
+
+8010a903 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+8010a903:	6a 00                	push   $0x0
+  pushl $253
+8010a905:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+8010a90a:	e9 a0 ef ff ff       	jmp    801098af <alltraps>
+
+8010a90f <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+8010a90f:	6a 00                	push   $0x0
+  pushl $254
+8010a911:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+8010a916:	e9 94 ef ff ff       	jmp    801098af <alltraps>
+
+8010a91b <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+8010a91b:	6a 00                	push   $0x0
+  pushl $255
+8010a91d:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+8010a922:	e9 88 ef ff ff       	jmp    801098af <alltraps>
+8010a927:	66 90                	xchg   %ax,%ax
+8010a929:	66 90                	xchg   %ax,%ax
+8010a92b:	66 90                	xchg   %ax,%ax
+8010a92d:	66 90                	xchg   %ax,%ax
+8010a92f:	90                   	nop
+
+8010a930 <deallocuvm.part.0>:
+// Deallocate user pages to bring the process size from oldsz to
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010a930:	55                   	push   %ebp
+8010a931:	89 e5                	mov    %esp,%ebp
+8010a933:	57                   	push   %edi
+8010a934:	56                   	push   %esi
+8010a935:	53                   	push   %ebx
+  uint a, pa;
+
+  if(newsz >= oldsz)
+    return oldsz;
+
+  a = PGROUNDUP(newsz);
+8010a936:	8d 99 ff 0f 00 00    	lea    0xfff(%ecx),%ebx
+8010a93c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010a942:	83 ec 1c             	sub    $0x1c,%esp
+  for(; a  < oldsz; a += PGSIZE){
+8010a945:	39 d3                	cmp    %edx,%ebx
+8010a947:	73 56                	jae    8010a99f <deallocuvm.part.0+0x6f>
+8010a949:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010a94c:	89 c6                	mov    %eax,%esi
+8010a94e:	89 d7                	mov    %edx,%edi
+8010a950:	eb 12                	jmp    8010a964 <deallocuvm.part.0+0x34>
+8010a952:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+8010a958:	83 c2 01             	add    $0x1,%edx
+8010a95b:	89 d3                	mov    %edx,%ebx
+8010a95d:	c1 e3 16             	shl    $0x16,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010a960:	39 fb                	cmp    %edi,%ebx
+8010a962:	73 38                	jae    8010a99c <deallocuvm.part.0+0x6c>
+  pde = &pgdir[PDX(va)];
+8010a964:	89 da                	mov    %ebx,%edx
+8010a966:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+8010a969:	8b 04 96             	mov    (%esi,%edx,4),%eax
+8010a96c:	a8 01                	test   $0x1,%al
+8010a96e:	74 e8                	je     8010a958 <deallocuvm.part.0+0x28>
+  return &pgtab[PTX(va)];
+8010a970:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a972:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a977:	c1 e9 0a             	shr    $0xa,%ecx
+8010a97a:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010a980:	8d 84 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%eax
+    if(!pte)
+8010a987:	85 c0                	test   %eax,%eax
+8010a989:	74 cd                	je     8010a958 <deallocuvm.part.0+0x28>
+    else if((*pte & PTE_P) != 0){
+8010a98b:	8b 10                	mov    (%eax),%edx
+8010a98d:	f6 c2 01             	test   $0x1,%dl
+8010a990:	75 1e                	jne    8010a9b0 <deallocuvm.part.0+0x80>
+  for(; a  < oldsz; a += PGSIZE){
+8010a992:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a998:	39 fb                	cmp    %edi,%ebx
+8010a99a:	72 c8                	jb     8010a964 <deallocuvm.part.0+0x34>
+8010a99c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      kfree(v);
+      *pte = 0;
+    }
+  }
+  return newsz;
+}
+8010a99f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a9a2:	89 c8                	mov    %ecx,%eax
+8010a9a4:	5b                   	pop    %ebx
+8010a9a5:	5e                   	pop    %esi
+8010a9a6:	5f                   	pop    %edi
+8010a9a7:	5d                   	pop    %ebp
+8010a9a8:	c3                   	ret
+8010a9a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(pa == 0)
+8010a9b0:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+8010a9b6:	74 26                	je     8010a9de <deallocuvm.part.0+0xae>
+      kfree(v);
+8010a9b8:	83 ec 0c             	sub    $0xc,%esp
+      char *v = P2V(pa);
+8010a9bb:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+8010a9c1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(; a  < oldsz; a += PGSIZE){
+8010a9c4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+      kfree(v);
+8010a9ca:	52                   	push   %edx
+8010a9cb:	e8 90 7f ff ff       	call   80102960 <kfree>
+      *pte = 0;
+8010a9d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(; a  < oldsz; a += PGSIZE){
+8010a9d3:	83 c4 10             	add    $0x10,%esp
+      *pte = 0;
+8010a9d6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+8010a9dc:	eb 82                	jmp    8010a960 <deallocuvm.part.0+0x30>
+        panic("kfree");
+8010a9de:	83 ec 0c             	sub    $0xc,%esp
+8010a9e1:	68 9a bc 10 80       	push   $0x8010bc9a
+8010a9e6:	e8 95 59 ff ff       	call   80100380 <panic>
+8010a9eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a9ef:	90                   	nop
+
+8010a9f0 <mappages>:
+{
+8010a9f0:	55                   	push   %ebp
+8010a9f1:	89 e5                	mov    %esp,%ebp
+8010a9f3:	57                   	push   %edi
+8010a9f4:	56                   	push   %esi
+8010a9f5:	53                   	push   %ebx
+  a = (char*)PGROUNDDOWN((uint)va);
+8010a9f6:	89 d3                	mov    %edx,%ebx
+8010a9f8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+8010a9fe:	83 ec 1c             	sub    $0x1c,%esp
+8010aa01:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010aa04:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+8010aa08:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010aa0d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010aa10:	8b 45 08             	mov    0x8(%ebp),%eax
+8010aa13:	29 d8                	sub    %ebx,%eax
+8010aa15:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010aa18:	eb 3f                	jmp    8010aa59 <mappages+0x69>
+8010aa1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010aa20:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010aa22:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010aa27:	c1 ea 0a             	shr    $0xa,%edx
+8010aa2a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010aa30:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010aa37:	85 c0                	test   %eax,%eax
+8010aa39:	74 75                	je     8010aab0 <mappages+0xc0>
+    if(*pte & PTE_P)
+8010aa3b:	f6 00 01             	testb  $0x1,(%eax)
+8010aa3e:	0f 85 86 00 00 00    	jne    8010aaca <mappages+0xda>
+    *pte = pa | perm | PTE_P;
+8010aa44:	0b 75 0c             	or     0xc(%ebp),%esi
+8010aa47:	83 ce 01             	or     $0x1,%esi
+8010aa4a:	89 30                	mov    %esi,(%eax)
+    if(a == last)
+8010aa4c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010aa4f:	39 c3                	cmp    %eax,%ebx
+8010aa51:	74 6d                	je     8010aac0 <mappages+0xd0>
+    a += PGSIZE;
+8010aa53:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  for(;;){
+8010aa59:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010aa5c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010aa5f:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+8010aa62:	89 d8                	mov    %ebx,%eax
+8010aa64:	c1 e8 16             	shr    $0x16,%eax
+8010aa67:	8d 3c 81             	lea    (%ecx,%eax,4),%edi
+  if(*pde & PTE_P){
+8010aa6a:	8b 07                	mov    (%edi),%eax
+8010aa6c:	a8 01                	test   $0x1,%al
+8010aa6e:	75 b0                	jne    8010aa20 <mappages+0x30>
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+8010aa70:	e8 ab 80 ff ff       	call   80102b20 <kalloc>
+8010aa75:	85 c0                	test   %eax,%eax
+8010aa77:	74 37                	je     8010aab0 <mappages+0xc0>
+    memset(pgtab, 0, PGSIZE);
+8010aa79:	83 ec 04             	sub    $0x4,%esp
+8010aa7c:	68 00 10 00 00       	push   $0x1000
+8010aa81:	6a 00                	push   $0x0
+8010aa83:	50                   	push   %eax
+8010aa84:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010aa87:	e8 24 d5 ff ff       	call   80107fb0 <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010aa8c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  return &pgtab[PTX(va)];
+8010aa8f:	83 c4 10             	add    $0x10,%esp
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010aa92:	8d 82 00 00 00 80    	lea    -0x80000000(%edx),%eax
+8010aa98:	83 c8 07             	or     $0x7,%eax
+8010aa9b:	89 07                	mov    %eax,(%edi)
+  return &pgtab[PTX(va)];
+8010aa9d:	89 d8                	mov    %ebx,%eax
+8010aa9f:	c1 e8 0a             	shr    $0xa,%eax
+8010aaa2:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010aaa7:	01 d0                	add    %edx,%eax
+8010aaa9:	eb 90                	jmp    8010aa3b <mappages+0x4b>
+8010aaab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010aaaf:	90                   	nop
+}
+8010aab0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010aab3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010aab8:	5b                   	pop    %ebx
+8010aab9:	5e                   	pop    %esi
+8010aaba:	5f                   	pop    %edi
+8010aabb:	5d                   	pop    %ebp
+8010aabc:	c3                   	ret
+8010aabd:	8d 76 00             	lea    0x0(%esi),%esi
+8010aac0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010aac3:	31 c0                	xor    %eax,%eax
+}
+8010aac5:	5b                   	pop    %ebx
+8010aac6:	5e                   	pop    %esi
+8010aac7:	5f                   	pop    %edi
+8010aac8:	5d                   	pop    %ebp
+8010aac9:	c3                   	ret
+      panic("remap");
+8010aaca:	83 ec 0c             	sub    $0xc,%esp
+8010aacd:	68 04 c4 10 80       	push   $0x8010c404
+8010aad2:	e8 a9 58 ff ff       	call   80100380 <panic>
+8010aad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aade:	66 90                	xchg   %ax,%ax
+
+8010aae0 <seginit>:
+{
+8010aae0:	55                   	push   %ebp
+8010aae1:	89 e5                	mov    %esp,%ebp
+8010aae3:	83 ec 18             	sub    $0x18,%esp
+  c = &cpus[cpuid()];
+8010aae6:	e8 c5 a3 ff ff       	call   80104eb0 <cpuid>
+  pd[0] = size-1;
+8010aaeb:	ba 2f 00 00 00       	mov    $0x2f,%edx
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010aaf0:	69 c0 d0 00 00 00    	imul   $0xd0,%eax,%eax
+8010aaf6:	c7 80 58 68 11 80 ff 	movl   $0xffff,-0x7fee97a8(%eax)
+8010aafd:	ff 00 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010ab00:	c7 80 60 68 11 80 ff 	movl   $0xffff,-0x7fee97a0(%eax)
+8010ab07:	ff 00 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010ab0a:	c7 80 68 68 11 80 ff 	movl   $0xffff,-0x7fee9798(%eax)
+8010ab11:	ff 00 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010ab14:	c7 80 70 68 11 80 ff 	movl   $0xffff,-0x7fee9790(%eax)
+8010ab1b:	ff 00 00 
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010ab1e:	c7 80 5c 68 11 80 00 	movl   $0xcf9a00,-0x7fee97a4(%eax)
+8010ab25:	9a cf 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010ab28:	c7 80 64 68 11 80 00 	movl   $0xcf9200,-0x7fee979c(%eax)
+8010ab2f:	92 cf 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010ab32:	c7 80 6c 68 11 80 00 	movl   $0xcffa00,-0x7fee9794(%eax)
+8010ab39:	fa cf 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010ab3c:	c7 80 74 68 11 80 00 	movl   $0xcff200,-0x7fee978c(%eax)
+8010ab43:	f2 cf 00 
+  lgdt(c->gdt, sizeof(c->gdt));
+8010ab46:	05 50 68 11 80       	add    $0x80116850,%eax
+8010ab4b:	66 89 55 f2          	mov    %dx,-0xe(%ebp)
+  pd[1] = (uint)p;
+8010ab4f:	66 89 45 f4          	mov    %ax,-0xc(%ebp)
+  pd[2] = (uint)p >> 16;
+8010ab53:	c1 e8 10             	shr    $0x10,%eax
+8010ab56:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+8010ab5a:	8d 45 f2             	lea    -0xe(%ebp),%eax
+8010ab5d:	0f 01 10             	lgdtl  (%eax)
+}
+8010ab60:	c9                   	leave
+8010ab61:	c3                   	ret
+8010ab62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ab69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+8010ab70 <switchkvm>:
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010ab70:	a1 40 a4 13 80       	mov    0x8013a440,%eax
+8010ab75:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010ab7a:	0f 22 d8             	mov    %eax,%cr3
+}
+8010ab7d:	c3                   	ret
+8010ab7e:	66 90                	xchg   %ax,%ax
+
+8010ab80 <switchuvm>:
+{
+8010ab80:	55                   	push   %ebp
+8010ab81:	89 e5                	mov    %esp,%ebp
+8010ab83:	57                   	push   %edi
+8010ab84:	56                   	push   %esi
+8010ab85:	53                   	push   %ebx
+8010ab86:	83 ec 1c             	sub    $0x1c,%esp
+8010ab89:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+8010ab8c:	85 f6                	test   %esi,%esi
+8010ab8e:	0f 84 f1 00 00 00    	je     8010ac85 <switchuvm+0x105>
+  if(p->kstack == 0)
+8010ab94:	8b 46 04             	mov    0x4(%esi),%eax
+8010ab97:	85 c0                	test   %eax,%eax
+8010ab99:	0f 84 d9 00 00 00    	je     8010ac78 <switchuvm+0xf8>
+  if(p->mm == 0 || p->mm->pgdir == 0)
+8010ab9f:	8b 06                	mov    (%esi),%eax
+8010aba1:	85 c0                	test   %eax,%eax
+8010aba3:	0f 84 c2 00 00 00    	je     8010ac6b <switchuvm+0xeb>
+8010aba9:	8b 40 74             	mov    0x74(%eax),%eax
+8010abac:	85 c0                	test   %eax,%eax
+8010abae:	0f 84 b7 00 00 00    	je     8010ac6b <switchuvm+0xeb>
+  pushcli();
+8010abb4:	e8 c7 d1 ff ff       	call   80107d80 <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010abb9:	e8 92 a2 ff ff       	call   80104e50 <mycpu>
+8010abbe:	89 c3                	mov    %eax,%ebx
+8010abc0:	e8 8b a2 ff ff       	call   80104e50 <mycpu>
+8010abc5:	89 c7                	mov    %eax,%edi
+8010abc7:	e8 84 a2 ff ff       	call   80104e50 <mycpu>
+8010abcc:	83 c7 08             	add    $0x8,%edi
+8010abcf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010abd2:	e8 79 a2 ff ff       	call   80104e50 <mycpu>
+8010abd7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010abda:	ba 67 00 00 00       	mov    $0x67,%edx
+8010abdf:	66 89 bb 9a 00 00 00 	mov    %di,0x9a(%ebx)
+8010abe6:	83 c0 08             	add    $0x8,%eax
+8010abe9:	66 89 93 98 00 00 00 	mov    %dx,0x98(%ebx)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010abf0:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010abf5:	83 c1 08             	add    $0x8,%ecx
+8010abf8:	c1 e8 18             	shr    $0x18,%eax
+8010abfb:	c1 e9 10             	shr    $0x10,%ecx
+8010abfe:	88 83 9f 00 00 00    	mov    %al,0x9f(%ebx)
+8010ac04:	88 8b 9c 00 00 00    	mov    %cl,0x9c(%ebx)
+8010ac0a:	b9 99 40 00 00       	mov    $0x4099,%ecx
+8010ac0f:	66 89 8b 9d 00 00 00 	mov    %cx,0x9d(%ebx)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010ac16:	bb 10 00 00 00       	mov    $0x10,%ebx
+  mycpu()->gdt[SEG_TSS].s = 0;
+8010ac1b:	e8 30 a2 ff ff       	call   80104e50 <mycpu>
+8010ac20:	80 a0 9d 00 00 00 ef 	andb   $0xef,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010ac27:	e8 24 a2 ff ff       	call   80104e50 <mycpu>
+8010ac2c:	66 89 58 10          	mov    %bx,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+8010ac30:	8b 5e 04             	mov    0x4(%esi),%ebx
+8010ac33:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010ac39:	e8 12 a2 ff ff       	call   80104e50 <mycpu>
+8010ac3e:	89 58 0c             	mov    %ebx,0xc(%eax)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010ac41:	e8 0a a2 ff ff       	call   80104e50 <mycpu>
+8010ac46:	66 89 78 6e          	mov    %di,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+8010ac4a:	b8 28 00 00 00       	mov    $0x28,%eax
+8010ac4f:	0f 00 d8             	ltr    %ax
+  lcr3(V2P(p->mm->pgdir));  // switch to process's address space
+8010ac52:	8b 06                	mov    (%esi),%eax
+8010ac54:	8b 40 74             	mov    0x74(%eax),%eax
+8010ac57:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010ac5c:	0f 22 d8             	mov    %eax,%cr3
+}
+8010ac5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ac62:	5b                   	pop    %ebx
+8010ac63:	5e                   	pop    %esi
+8010ac64:	5f                   	pop    %edi
+8010ac65:	5d                   	pop    %ebp
+  popcli();
+8010ac66:	e9 65 d1 ff ff       	jmp    80107dd0 <popcli>
+    panic("switchuvm: no pgdir");
+8010ac6b:	83 ec 0c             	sub    $0xc,%esp
+8010ac6e:	68 35 c4 10 80       	push   $0x8010c435
+8010ac73:	e8 08 57 ff ff       	call   80100380 <panic>
+    panic("switchuvm: no kstack");
+8010ac78:	83 ec 0c             	sub    $0xc,%esp
+8010ac7b:	68 20 c4 10 80       	push   $0x8010c420
+8010ac80:	e8 fb 56 ff ff       	call   80100380 <panic>
+    panic("switchuvm: no process");
+8010ac85:	83 ec 0c             	sub    $0xc,%esp
+8010ac88:	68 0a c4 10 80       	push   $0x8010c40a
+8010ac8d:	e8 ee 56 ff ff       	call   80100380 <panic>
+8010ac92:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ac99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+8010aca0 <inituvm>:
+{
+8010aca0:	55                   	push   %ebp
+8010aca1:	89 e5                	mov    %esp,%ebp
+8010aca3:	57                   	push   %edi
+8010aca4:	56                   	push   %esi
+8010aca5:	53                   	push   %ebx
+8010aca6:	83 ec 1c             	sub    $0x1c,%esp
+8010aca9:	8b 45 08             	mov    0x8(%ebp),%eax
+8010acac:	8b 75 10             	mov    0x10(%ebp),%esi
+8010acaf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010acb2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(sz >= PGSIZE)
+8010acb5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010acbb:	77 49                	ja     8010ad06 <inituvm+0x66>
+  mem = kalloc();
+8010acbd:	e8 5e 7e ff ff       	call   80102b20 <kalloc>
+  memset(mem, 0, PGSIZE);
+8010acc2:	83 ec 04             	sub    $0x4,%esp
+8010acc5:	68 00 10 00 00       	push   $0x1000
+  mem = kalloc();
+8010acca:	89 c3                	mov    %eax,%ebx
+  memset(mem, 0, PGSIZE);
+8010accc:	6a 00                	push   $0x0
+8010acce:	50                   	push   %eax
+8010accf:	e8 dc d2 ff ff       	call   80107fb0 <memset>
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010acd4:	58                   	pop    %eax
+8010acd5:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010acdb:	5a                   	pop    %edx
+8010acdc:	6a 06                	push   $0x6
+8010acde:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010ace3:	31 d2                	xor    %edx,%edx
+8010ace5:	50                   	push   %eax
+8010ace6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010ace9:	e8 02 fd ff ff       	call   8010a9f0 <mappages>
+  memmove(mem, init, sz);
+8010acee:	89 75 10             	mov    %esi,0x10(%ebp)
+8010acf1:	83 c4 10             	add    $0x10,%esp
+8010acf4:	89 7d 0c             	mov    %edi,0xc(%ebp)
+8010acf7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010acfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010acfd:	5b                   	pop    %ebx
+8010acfe:	5e                   	pop    %esi
+8010acff:	5f                   	pop    %edi
+8010ad00:	5d                   	pop    %ebp
+  memmove(mem, init, sz);
+8010ad01:	e9 3a d3 ff ff       	jmp    80108040 <memmove>
+    panic("inituvm: more than a page");
+8010ad06:	83 ec 0c             	sub    $0xc,%esp
+8010ad09:	68 49 c4 10 80       	push   $0x8010c449
+8010ad0e:	e8 6d 56 ff ff       	call   80100380 <panic>
+8010ad13:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ad1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010ad20 <loaduvm>:
+{
+8010ad20:	55                   	push   %ebp
+8010ad21:	89 e5                	mov    %esp,%ebp
+8010ad23:	57                   	push   %edi
+8010ad24:	56                   	push   %esi
+8010ad25:	53                   	push   %ebx
+8010ad26:	83 ec 0c             	sub    $0xc,%esp
+  if((uint) addr % PGSIZE != 0)
+8010ad29:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+8010ad2c:	8b 7d 18             	mov    0x18(%ebp),%edi
+  if((uint) addr % PGSIZE != 0)
+8010ad2f:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+8010ad35:	0f 85 a2 00 00 00    	jne    8010addd <loaduvm+0xbd>
+  for(i = 0; i < sz; i += PGSIZE){
+8010ad3b:	85 ff                	test   %edi,%edi
+8010ad3d:	74 7d                	je     8010adbc <loaduvm+0x9c>
+8010ad3f:	90                   	nop
+  pde = &pgdir[PDX(va)];
+8010ad40:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010ad43:	8b 55 08             	mov    0x8(%ebp),%edx
+8010ad46:	01 f0                	add    %esi,%eax
+  pde = &pgdir[PDX(va)];
+8010ad48:	89 c1                	mov    %eax,%ecx
+8010ad4a:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010ad4d:	8b 0c 8a             	mov    (%edx,%ecx,4),%ecx
+8010ad50:	f6 c1 01             	test   $0x1,%cl
+8010ad53:	75 13                	jne    8010ad68 <loaduvm+0x48>
+      panic("loaduvm: address should exist");
+8010ad55:	83 ec 0c             	sub    $0xc,%esp
+8010ad58:	68 63 c4 10 80       	push   $0x8010c463
+8010ad5d:	e8 1e 56 ff ff       	call   80100380 <panic>
+8010ad62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010ad68:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ad6b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010ad71:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010ad76:	8d 8c 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%ecx
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+8010ad7d:	85 c9                	test   %ecx,%ecx
+8010ad7f:	74 d4                	je     8010ad55 <loaduvm+0x35>
+    if(sz - i < PGSIZE)
+8010ad81:	89 fb                	mov    %edi,%ebx
+8010ad83:	b8 00 10 00 00       	mov    $0x1000,%eax
+8010ad88:	29 f3                	sub    %esi,%ebx
+8010ad8a:	39 c3                	cmp    %eax,%ebx
+8010ad8c:	0f 47 d8             	cmova  %eax,%ebx
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010ad8f:	53                   	push   %ebx
+8010ad90:	8b 45 14             	mov    0x14(%ebp),%eax
+8010ad93:	01 f0                	add    %esi,%eax
+8010ad95:	50                   	push   %eax
+    pa = PTE_ADDR(*pte);
+8010ad96:	8b 01                	mov    (%ecx),%eax
+8010ad98:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010ad9d:	05 00 00 00 80       	add    $0x80000000,%eax
+8010ada2:	50                   	push   %eax
+8010ada3:	ff 75 10             	push   0x10(%ebp)
+8010ada6:	e8 85 71 ff ff       	call   80101f30 <readi>
+8010adab:	83 c4 10             	add    $0x10,%esp
+8010adae:	39 d8                	cmp    %ebx,%eax
+8010adb0:	75 1e                	jne    8010add0 <loaduvm+0xb0>
+  for(i = 0; i < sz; i += PGSIZE){
+8010adb2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010adb8:	39 fe                	cmp    %edi,%esi
+8010adba:	72 84                	jb     8010ad40 <loaduvm+0x20>
+}
+8010adbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010adbf:	31 c0                	xor    %eax,%eax
+}
+8010adc1:	5b                   	pop    %ebx
+8010adc2:	5e                   	pop    %esi
+8010adc3:	5f                   	pop    %edi
+8010adc4:	5d                   	pop    %ebp
+8010adc5:	c3                   	ret
+8010adc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010adcd:	8d 76 00             	lea    0x0(%esi),%esi
+8010add0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010add3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010add8:	5b                   	pop    %ebx
+8010add9:	5e                   	pop    %esi
+8010adda:	5f                   	pop    %edi
+8010addb:	5d                   	pop    %ebp
+8010addc:	c3                   	ret
+    panic("loaduvm: addr must be page aligned");
+8010addd:	83 ec 0c             	sub    $0xc,%esp
+8010ade0:	68 3c c5 10 80       	push   $0x8010c53c
+8010ade5:	e8 96 55 ff ff       	call   80100380 <panic>
+8010adea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010adf0 <allocuvm>:
+{
+8010adf0:	55                   	push   %ebp
+8010adf1:	89 e5                	mov    %esp,%ebp
+8010adf3:	57                   	push   %edi
+8010adf4:	56                   	push   %esi
+8010adf5:	53                   	push   %ebx
+8010adf6:	83 ec 1c             	sub    $0x1c,%esp
+8010adf9:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(newsz >= KERNBASE)
+8010adfc:	85 f6                	test   %esi,%esi
+8010adfe:	0f 88 98 00 00 00    	js     8010ae9c <allocuvm+0xac>
+8010ae04:	89 f2                	mov    %esi,%edx
+  if(newsz < oldsz)
+8010ae06:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010ae09:	0f 82 a1 00 00 00    	jb     8010aeb0 <allocuvm+0xc0>
+  a = PGROUNDUP(oldsz);
+8010ae0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010ae12:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010ae17:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010ae1c:	89 c7                	mov    %eax,%edi
+  for(; a < newsz; a += PGSIZE){
+8010ae1e:	39 f0                	cmp    %esi,%eax
+8010ae20:	0f 83 8d 00 00 00    	jae    8010aeb3 <allocuvm+0xc3>
+8010ae26:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+8010ae29:	eb 44                	jmp    8010ae6f <allocuvm+0x7f>
+8010ae2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010ae2f:	90                   	nop
+    memset(mem, 0, PGSIZE);
+8010ae30:	83 ec 04             	sub    $0x4,%esp
+8010ae33:	68 00 10 00 00       	push   $0x1000
+8010ae38:	6a 00                	push   $0x0
+8010ae3a:	50                   	push   %eax
+8010ae3b:	e8 70 d1 ff ff       	call   80107fb0 <memset>
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010ae40:	58                   	pop    %eax
+8010ae41:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010ae47:	5a                   	pop    %edx
+8010ae48:	6a 06                	push   $0x6
+8010ae4a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010ae4f:	89 fa                	mov    %edi,%edx
+8010ae51:	50                   	push   %eax
+8010ae52:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ae55:	e8 96 fb ff ff       	call   8010a9f0 <mappages>
+8010ae5a:	83 c4 10             	add    $0x10,%esp
+8010ae5d:	85 c0                	test   %eax,%eax
+8010ae5f:	78 5f                	js     8010aec0 <allocuvm+0xd0>
+  for(; a < newsz; a += PGSIZE){
+8010ae61:	81 c7 00 10 00 00    	add    $0x1000,%edi
+8010ae67:	39 f7                	cmp    %esi,%edi
+8010ae69:	0f 83 89 00 00 00    	jae    8010aef8 <allocuvm+0x108>
+    mem = kalloc();
+8010ae6f:	e8 ac 7c ff ff       	call   80102b20 <kalloc>
+8010ae74:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+8010ae76:	85 c0                	test   %eax,%eax
+8010ae78:	75 b6                	jne    8010ae30 <allocuvm+0x40>
+      cprintf("allocuvm out of memory\n");
+8010ae7a:	83 ec 0c             	sub    $0xc,%esp
+8010ae7d:	68 81 c4 10 80       	push   $0x8010c481
+8010ae82:	e8 29 58 ff ff       	call   801006b0 <cprintf>
+  if(newsz >= oldsz)
+8010ae87:	83 c4 10             	add    $0x10,%esp
+8010ae8a:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010ae8d:	74 0d                	je     8010ae9c <allocuvm+0xac>
+8010ae8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010ae92:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ae95:	89 f2                	mov    %esi,%edx
+8010ae97:	e8 94 fa ff ff       	call   8010a930 <deallocuvm.part.0>
+    return 0;
+8010ae9c:	31 d2                	xor    %edx,%edx
+}
+8010ae9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aea1:	89 d0                	mov    %edx,%eax
+8010aea3:	5b                   	pop    %ebx
+8010aea4:	5e                   	pop    %esi
+8010aea5:	5f                   	pop    %edi
+8010aea6:	5d                   	pop    %ebp
+8010aea7:	c3                   	ret
+8010aea8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aeaf:	90                   	nop
+    return oldsz;
+8010aeb0:	8b 55 0c             	mov    0xc(%ebp),%edx
+}
+8010aeb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aeb6:	89 d0                	mov    %edx,%eax
+8010aeb8:	5b                   	pop    %ebx
+8010aeb9:	5e                   	pop    %esi
+8010aeba:	5f                   	pop    %edi
+8010aebb:	5d                   	pop    %ebp
+8010aebc:	c3                   	ret
+8010aebd:	8d 76 00             	lea    0x0(%esi),%esi
+      cprintf("allocuvm out of memory (2)\n");
+8010aec0:	83 ec 0c             	sub    $0xc,%esp
+8010aec3:	68 99 c4 10 80       	push   $0x8010c499
+8010aec8:	e8 e3 57 ff ff       	call   801006b0 <cprintf>
+  if(newsz >= oldsz)
+8010aecd:	83 c4 10             	add    $0x10,%esp
+8010aed0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010aed3:	74 0d                	je     8010aee2 <allocuvm+0xf2>
+8010aed5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010aed8:	8b 45 08             	mov    0x8(%ebp),%eax
+8010aedb:	89 f2                	mov    %esi,%edx
+8010aedd:	e8 4e fa ff ff       	call   8010a930 <deallocuvm.part.0>
+      kfree(mem);
+8010aee2:	83 ec 0c             	sub    $0xc,%esp
+8010aee5:	53                   	push   %ebx
+8010aee6:	e8 75 7a ff ff       	call   80102960 <kfree>
+      return 0;
+8010aeeb:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010aeee:	31 d2                	xor    %edx,%edx
+8010aef0:	eb ac                	jmp    8010ae9e <allocuvm+0xae>
+8010aef2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+8010aef8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+}
+8010aefb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aefe:	5b                   	pop    %ebx
+8010aeff:	5e                   	pop    %esi
+8010af00:	89 d0                	mov    %edx,%eax
+8010af02:	5f                   	pop    %edi
+8010af03:	5d                   	pop    %ebp
+8010af04:	c3                   	ret
+8010af05:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010af0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010af10 <deallocuvm>:
+{
+8010af10:	55                   	push   %ebp
+8010af11:	89 e5                	mov    %esp,%ebp
+8010af13:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010af16:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010af19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(newsz >= oldsz)
+8010af1c:	39 d1                	cmp    %edx,%ecx
+8010af1e:	73 10                	jae    8010af30 <deallocuvm+0x20>
+}
+8010af20:	5d                   	pop    %ebp
+8010af21:	e9 0a fa ff ff       	jmp    8010a930 <deallocuvm.part.0>
+8010af26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010af2d:	8d 76 00             	lea    0x0(%esi),%esi
+8010af30:	89 d0                	mov    %edx,%eax
+8010af32:	5d                   	pop    %ebp
+8010af33:	c3                   	ret
+8010af34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010af3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010af3f:	90                   	nop
+
+8010af40 <tlbshootdown>:
+// Make every CPU that may have mm's translations cached
+// flush its TLB, and wait until all of them have.  Other
+// CPUs only need it while running one of mm's threads.
+void
+tlbshootdown(struct mm *mm)
+{
+8010af40:	55                   	push   %ebp
+8010af41:	89 e5                	mov    %esp,%ebp
+8010af43:	57                   	push   %edi
+8010af44:	56                   	push   %esi
+8010af45:	53                   	push   %ebx
+8010af46:	83 ec 5c             	sub    $0x5c,%esp
+  uint seen[NCPU];
+  int i, me, sent[NCPU];
+  struct proc *p;
+
+  pushcli();
+8010af49:	e8 32 ce ff ff       	call   80107d80 <pushcli>
+  me = cpuid();
+8010af4e:	e8 5d 9f ff ff       	call   80104eb0 <cpuid>
+8010af53:	89 c1                	mov    %eax,%ecx
+  asm volatile("movl %%cr3,%0" : "=r" (val));
+8010af55:	0f 20 d8             	mov    %cr3,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010af58:	0f 22 d8             	mov    %eax,%cr3
+  lcr3(rcr3());
+  for(i = 0; i < ncpu; i++){
+8010af5b:	8b 15 c4 67 11 80    	mov    0x801167c4,%edx
+8010af61:	85 d2                	test   %edx,%edx
+8010af63:	7e 7b                	jle    8010afe0 <tlbshootdown+0xa0>
+8010af65:	bf e0 67 11 80       	mov    $0x801167e0,%edi
+8010af6a:	31 db                	xor    %ebx,%ebx
+8010af6c:	8d 75 c8             	lea    -0x38(%ebp),%esi
+8010af6f:	eb 1f                	jmp    8010af90 <tlbshootdown+0x50>
+8010af71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    seen[i] = cpus[i].tlbflushes;
+    p = cpus[i].proc;
+    sent[i] = i != me && p && p->mm == mm;
+8010af78:	c7 04 9e 00 00 00 00 	movl   $0x0,(%esi,%ebx,4)
+  for(i = 0; i < ncpu; i++){
+8010af7f:	83 c3 01             	add    $0x1,%ebx
+8010af82:	81 c7 d0 00 00 00    	add    $0xd0,%edi
+8010af88:	39 1d c4 67 11 80    	cmp    %ebx,0x801167c4
+8010af8e:	7e 50                	jle    8010afe0 <tlbshootdown+0xa0>
+    seen[i] = cpus[i].tlbflushes;
+8010af90:	69 c3 d0 00 00 00    	imul   $0xd0,%ebx,%eax
+8010af96:	05 e0 67 11 80       	add    $0x801167e0,%eax
+8010af9b:	8b 80 cc 00 00 00    	mov    0xcc(%eax),%eax
+8010afa1:	89 44 9d a8          	mov    %eax,-0x58(%ebp,%ebx,4)
+    p = cpus[i].proc;
+8010afa5:	8b 87 ac 00 00 00    	mov    0xac(%edi),%eax
+    sent[i] = i != me && p && p->mm == mm;
+8010afab:	39 d9                	cmp    %ebx,%ecx
+8010afad:	74 c9                	je     8010af78 <tlbshootdown+0x38>
+8010afaf:	85 c0                	test   %eax,%eax
+8010afb1:	74 c5                	je     8010af78 <tlbshootdown+0x38>
+8010afb3:	8b 55 08             	mov    0x8(%ebp),%edx
+8010afb6:	39 10                	cmp    %edx,(%eax)
+8010afb8:	75 be                	jne    8010af78 <tlbshootdown+0x38>
+    if(sent[i])
+      lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_TLB);
+8010afba:	83 ec 08             	sub    $0x8,%esp
+8010afbd:	89 4d a4             	mov    %ecx,-0x5c(%ebp)
+    sent[i] = i != me && p && p->mm == mm;
+8010afc0:	c7 04 9e 01 00 00 00 	movl   $0x1,(%esi,%ebx,4)
+      lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_TLB);
+8010afc7:	6a 35                	push   $0x35
+8010afc9:	0f b6 07             	movzbl (%edi),%eax
+8010afcc:	50                   	push   %eax
+8010afcd:	e8 0e 7e ff ff       	call   80102de0 <lapicipi>
+8010afd2:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+8010afd5:	83 c4 10             	add    $0x10,%esp
+8010afd8:	eb a5                	jmp    8010af7f <tlbshootdown+0x3f>
+8010afda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }
+  popcli();
+8010afe0:	e8 eb cd ff ff       	call   80107dd0 <popcli>
+  // Wait with interrupts on, in case a target is shooting at us.
+  for(i = 0; i < ncpu; i++)
+8010afe5:	8b 3d c4 67 11 80    	mov    0x801167c4,%edi
+8010afeb:	85 ff                	test   %edi,%edi
+8010afed:	7e 3d                	jle    8010b02c <tlbshootdown+0xec>
+8010afef:	8d 4d a8             	lea    -0x58(%ebp),%ecx
+8010aff2:	31 db                	xor    %ebx,%ebx
+8010aff4:	8d 75 c8             	lea    -0x38(%ebp),%esi
+8010aff7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010affe:	66 90                	xchg   %ax,%ax
+    while(sent[i] && cpus[i].tlbflushes == seen[i])
+8010b000:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+8010b003:	85 c0                	test   %eax,%eax
+8010b005:	74 1b                	je     8010b022 <tlbshootdown+0xe2>
+8010b007:	69 d3 d0 00 00 00    	imul   $0xd0,%ebx,%edx
+8010b00d:	81 c2 e0 67 11 80    	add    $0x801167e0,%edx
+8010b013:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b017:	90                   	nop
+8010b018:	8b 82 cc 00 00 00    	mov    0xcc(%edx),%eax
+8010b01e:	3b 01                	cmp    (%ecx),%eax
+8010b020:	74 f6                	je     8010b018 <tlbshootdown+0xd8>
+  for(i = 0; i < ncpu; i++)
+8010b022:	83 c3 01             	add    $0x1,%ebx
+8010b025:	83 c1 04             	add    $0x4,%ecx
+8010b028:	39 fb                	cmp    %edi,%ebx
+8010b02a:	75 d4                	jne    8010b000 <tlbshootdown+0xc0>
+      ;
+}
+8010b02c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b02f:	5b                   	pop    %ebx
+8010b030:	5e                   	pop    %esi
+8010b031:	5f                   	pop    %edi
+8010b032:	5d                   	pop    %ebp
+8010b033:	c3                   	ret
+8010b034:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b03b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b03f:	90                   	nop
+
+8010b040 <shrinkuvm>:
+// running: lower mm->sz, unmap the pages, shoot down every TLB
+// that may still map them, and only then free them.  The caller
+// holds mm->vmlock.
+void
+shrinkuvm(struct mm *mm, uint oldsz, uint newsz)
+{
+8010b040:	55                   	push   %ebp
+8010b041:	89 e5                	mov    %esp,%ebp
+8010b043:	57                   	push   %edi
+8010b044:	56                   	push   %esi
+8010b045:	53                   	push   %ebx
+8010b046:	83 ec 1c             	sub    $0x1c,%esp
+8010b049:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010b04c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+8010b04f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  pte_t *pte;
+  uint a;
+  char *v, *freed;
+
+  if(newsz >= oldsz)
+8010b052:	39 f3                	cmp    %esi,%ebx
+8010b054:	72 0a                	jb     8010b060 <shrinkuvm+0x20>
+  tlbshootdown(mm);
+  while((v = freed) != 0){
+    freed = *(char**)v;
+    kfree(v);
+  }
+}
+8010b056:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b059:	5b                   	pop    %ebx
+8010b05a:	5e                   	pop    %esi
+8010b05b:	5f                   	pop    %edi
+8010b05c:	5d                   	pop    %ebp
+8010b05d:	c3                   	ret
+8010b05e:	66 90                	xchg   %ax,%ax
+  acquire(&mm->lock);
+8010b060:	83 ec 0c             	sub    $0xc,%esp
+8010b063:	57                   	push   %edi
+8010b064:	e8 67 ce ff ff       	call   80107ed0 <acquire>
+  mm->sz = newsz;
+8010b069:	89 5f 78             	mov    %ebx,0x78(%edi)
+  release(&mm->lock);
+8010b06c:	89 3c 24             	mov    %edi,(%esp)
+8010b06f:	e8 fc cd ff ff       	call   80107e70 <release>
+  a = PGROUNDUP(newsz);
+8010b074:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  for(; a < oldsz; a += PGSIZE){
+8010b07a:	83 c4 10             	add    $0x10,%esp
+  a = PGROUNDUP(newsz);
+8010b07d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  for(; a < oldsz; a += PGSIZE){
+8010b082:	39 f0                	cmp    %esi,%eax
+8010b084:	0f 83 c6 00 00 00    	jae    8010b150 <shrinkuvm+0x110>
+  freed = 0;
+8010b08a:	31 db                	xor    %ebx,%ebx
+8010b08c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+8010b08f:	89 f3                	mov    %esi,%ebx
+8010b091:	eb 11                	jmp    8010b0a4 <shrinkuvm+0x64>
+8010b093:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b097:	90                   	nop
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+8010b098:	83 c1 01             	add    $0x1,%ecx
+8010b09b:	89 c8                	mov    %ecx,%eax
+8010b09d:	c1 e0 16             	shl    $0x16,%eax
+  for(; a < oldsz; a += PGSIZE){
+8010b0a0:	39 d8                	cmp    %ebx,%eax
+8010b0a2:	73 3c                	jae    8010b0e0 <shrinkuvm+0xa0>
+  if(*pde & PTE_P){
+8010b0a4:	8b 57 74             	mov    0x74(%edi),%edx
+  pde = &pgdir[PDX(va)];
+8010b0a7:	89 c1                	mov    %eax,%ecx
+8010b0a9:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010b0ac:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+8010b0af:	f6 c2 01             	test   $0x1,%dl
+8010b0b2:	74 e4                	je     8010b098 <shrinkuvm+0x58>
+  return &pgtab[PTX(va)];
+8010b0b4:	89 c6                	mov    %eax,%esi
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b0b6:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  return &pgtab[PTX(va)];
+8010b0bc:	c1 ee 0a             	shr    $0xa,%esi
+8010b0bf:	81 e6 fc 0f 00 00    	and    $0xffc,%esi
+8010b0c5:	8d 94 32 00 00 00 80 	lea    -0x80000000(%edx,%esi,1),%edx
+    if(!pte)
+8010b0cc:	85 d2                	test   %edx,%edx
+8010b0ce:	74 c8                	je     8010b098 <shrinkuvm+0x58>
+    else if((*pte & PTE_P) != 0){
+8010b0d0:	8b 0a                	mov    (%edx),%ecx
+8010b0d2:	f6 c1 01             	test   $0x1,%cl
+8010b0d5:	75 49                	jne    8010b120 <shrinkuvm+0xe0>
+  for(; a < oldsz; a += PGSIZE){
+8010b0d7:	05 00 10 00 00       	add    $0x1000,%eax
+8010b0dc:	39 d8                	cmp    %ebx,%eax
+8010b0de:	72 c4                	jb     8010b0a4 <shrinkuvm+0x64>
+  tlbshootdown(mm);
+8010b0e0:	83 ec 0c             	sub    $0xc,%esp
+8010b0e3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010b0e6:	57                   	push   %edi
+8010b0e7:	e8 54 fe ff ff       	call   8010af40 <tlbshootdown>
+  while((v = freed) != 0){
+8010b0ec:	83 c4 10             	add    $0x10,%esp
+8010b0ef:	85 db                	test   %ebx,%ebx
+8010b0f1:	0f 84 5f ff ff ff    	je     8010b056 <shrinkuvm+0x16>
+8010b0f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b0fe:	66 90                	xchg   %ax,%ax
+    freed = *(char**)v;
+8010b100:	89 d8                	mov    %ebx,%eax
+    kfree(v);
+8010b102:	83 ec 0c             	sub    $0xc,%esp
+    freed = *(char**)v;
+8010b105:	8b 1b                	mov    (%ebx),%ebx
+    kfree(v);
+8010b107:	50                   	push   %eax
+8010b108:	e8 53 78 ff ff       	call   80102960 <kfree>
+  while((v = freed) != 0){
+8010b10d:	83 c4 10             	add    $0x10,%esp
+8010b110:	85 db                	test   %ebx,%ebx
+8010b112:	75 ec                	jne    8010b100 <shrinkuvm+0xc0>
+}
+8010b114:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b117:	5b                   	pop    %ebx
+8010b118:	5e                   	pop    %esi
+8010b119:	5f                   	pop    %edi
+8010b11a:	5d                   	pop    %ebp
+8010b11b:	c3                   	ret
+8010b11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(PTE_ADDR(*pte) == 0)
+8010b120:	81 f9 ff 0f 00 00    	cmp    $0xfff,%ecx
+8010b126:	76 37                	jbe    8010b15f <shrinkuvm+0x11f>
+      *(char**)v = freed;
+8010b128:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+      v = P2V(PTE_ADDR(*pte));
+8010b12b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+      *pte = 0;
+8010b131:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  for(; a < oldsz; a += PGSIZE){
+8010b137:	05 00 10 00 00       	add    $0x1000,%eax
+      *(char**)v = freed;
+8010b13c:	89 b1 00 00 00 80    	mov    %esi,-0x80000000(%ecx)
+  for(; a < oldsz; a += PGSIZE){
+8010b142:	8d b1 00 00 00 80    	lea    -0x80000000(%ecx),%esi
+8010b148:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+8010b14b:	e9 50 ff ff ff       	jmp    8010b0a0 <shrinkuvm+0x60>
+  tlbshootdown(mm);
+8010b150:	89 7d 08             	mov    %edi,0x8(%ebp)
+}
+8010b153:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b156:	5b                   	pop    %ebx
+8010b157:	5e                   	pop    %esi
+8010b158:	5f                   	pop    %edi
+8010b159:	5d                   	pop    %ebp
+  tlbshootdown(mm);
+8010b15a:	e9 e1 fd ff ff       	jmp    8010af40 <tlbshootdown>
+        panic("kfree");
+8010b15f:	83 ec 0c             	sub    $0xc,%esp
+8010b162:	68 9a bc 10 80       	push   $0x8010bc9a
+8010b167:	e8 14 52 ff ff       	call   80100380 <panic>
+8010b16c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010b170 <freevm>:
+
+// Free a page table and all the physical memory pages
+// in the user part.
+void
+freevm(pde_t *pgdir)
+{
+8010b170:	55                   	push   %ebp
+8010b171:	89 e5                	mov    %esp,%ebp
+8010b173:	57                   	push   %edi
+8010b174:	56                   	push   %esi
+8010b175:	53                   	push   %ebx
+8010b176:	83 ec 0c             	sub    $0xc,%esp
+8010b179:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint i;
+
+  if(pgdir == 0)
+8010b17c:	85 f6                	test   %esi,%esi
+8010b17e:	74 59                	je     8010b1d9 <freevm+0x69>
+  if(newsz >= oldsz)
+8010b180:	31 c9                	xor    %ecx,%ecx
+8010b182:	ba 00 00 00 80       	mov    $0x80000000,%edx
+8010b187:	89 f0                	mov    %esi,%eax
+8010b189:	89 f3                	mov    %esi,%ebx
+8010b18b:	e8 a0 f7 ff ff       	call   8010a930 <deallocuvm.part.0>
+    panic("freevm: no pgdir");
+  deallocuvm(pgdir, KERNBASE, 0);
+  for(i = 0; i < NPDENTRIES; i++){
+8010b190:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+8010b196:	eb 0f                	jmp    8010b1a7 <freevm+0x37>
+8010b198:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b19f:	90                   	nop
+8010b1a0:	83 c3 04             	add    $0x4,%ebx
+8010b1a3:	39 fb                	cmp    %edi,%ebx
+8010b1a5:	74 23                	je     8010b1ca <freevm+0x5a>
+    if(pgdir[i] & PTE_P){
+8010b1a7:	8b 03                	mov    (%ebx),%eax
+8010b1a9:	a8 01                	test   $0x1,%al
+8010b1ab:	74 f3                	je     8010b1a0 <freevm+0x30>
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010b1ad:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+      kfree(v);
+8010b1b2:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+8010b1b5:	83 c3 04             	add    $0x4,%ebx
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010b1b8:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010b1bd:	50                   	push   %eax
+8010b1be:	e8 9d 77 ff ff       	call   80102960 <kfree>
+8010b1c3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+8010b1c6:	39 fb                	cmp    %edi,%ebx
+8010b1c8:	75 dd                	jne    8010b1a7 <freevm+0x37>
+    }
+  }
+  kfree((char*)pgdir);
+8010b1ca:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+8010b1cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b1d0:	5b                   	pop    %ebx
+8010b1d1:	5e                   	pop    %esi
+8010b1d2:	5f                   	pop    %edi
+8010b1d3:	5d                   	pop    %ebp
+  kfree((char*)pgdir);
+8010b1d4:	e9 87 77 ff ff       	jmp    80102960 <kfree>
+    panic("freevm: no pgdir");
+8010b1d9:	83 ec 0c             	sub    $0xc,%esp
+8010b1dc:	68 b5 c4 10 80       	push   $0x8010c4b5
+8010b1e1:	e8 9a 51 ff ff       	call   80100380 <panic>
+8010b1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b1ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010b1f0 <setupkvm>:
+{
+8010b1f0:	55                   	push   %ebp
+8010b1f1:	89 e5                	mov    %esp,%ebp
+8010b1f3:	56                   	push   %esi
+8010b1f4:	53                   	push   %ebx
+  if((pgdir = (pde_t*)kalloc()) == 0)
+8010b1f5:	e8 26 79 ff ff       	call   80102b20 <kalloc>
+8010b1fa:	85 c0                	test   %eax,%eax
+8010b1fc:	74 5e                	je     8010b25c <setupkvm+0x6c>
+  memset(pgdir, 0, PGSIZE);
+8010b1fe:	83 ec 04             	sub    $0x4,%esp
+8010b201:	89 c6                	mov    %eax,%esi
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010b203:	bb 20 f4 10 80       	mov    $0x8010f420,%ebx
+  memset(pgdir, 0, PGSIZE);
+8010b208:	68 00 10 00 00       	push   $0x1000
+8010b20d:	6a 00                	push   $0x0
+8010b20f:	50                   	push   %eax
+8010b210:	e8 9b cd ff ff       	call   80107fb0 <memset>
+8010b215:	83 c4 10             	add    $0x10,%esp
+                (uint)k->phys_start, k->perm) < 0) {
+8010b218:	8b 43 04             	mov    0x4(%ebx),%eax
+    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
+8010b21b:	83 ec 08             	sub    $0x8,%esp
+8010b21e:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010b221:	8b 13                	mov    (%ebx),%edx
+8010b223:	ff 73 0c             	push   0xc(%ebx)
+8010b226:	50                   	push   %eax
+8010b227:	29 c1                	sub    %eax,%ecx
+8010b229:	89 f0                	mov    %esi,%eax
+8010b22b:	e8 c0 f7 ff ff       	call   8010a9f0 <mappages>
+8010b230:	83 c4 10             	add    $0x10,%esp
+8010b233:	85 c0                	test   %eax,%eax
+8010b235:	78 19                	js     8010b250 <setupkvm+0x60>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010b237:	83 c3 10             	add    $0x10,%ebx
+8010b23a:	81 fb 60 f4 10 80    	cmp    $0x8010f460,%ebx
+8010b240:	75 d6                	jne    8010b218 <setupkvm+0x28>
+}
+8010b242:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b245:	89 f0                	mov    %esi,%eax
+8010b247:	5b                   	pop    %ebx
+8010b248:	5e                   	pop    %esi
+8010b249:	5d                   	pop    %ebp
+8010b24a:	c3                   	ret
+8010b24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b24f:	90                   	nop
+      freevm(pgdir);
+8010b250:	83 ec 0c             	sub    $0xc,%esp
+8010b253:	56                   	push   %esi
+8010b254:	e8 17 ff ff ff       	call   8010b170 <freevm>
+      return 0;
+8010b259:	83 c4 10             	add    $0x10,%esp
+}
+8010b25c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+8010b25f:	31 f6                	xor    %esi,%esi
+}
+8010b261:	89 f0                	mov    %esi,%eax
+8010b263:	5b                   	pop    %ebx
+8010b264:	5e                   	pop    %esi
+8010b265:	5d                   	pop    %ebp
+8010b266:	c3                   	ret
+8010b267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b26e:	66 90                	xchg   %ax,%ax
+
+8010b270 <kvmalloc>:
+{
+8010b270:	55                   	push   %ebp
+8010b271:	89 e5                	mov    %esp,%ebp
+8010b273:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+8010b276:	e8 75 ff ff ff       	call   8010b1f0 <setupkvm>
+8010b27b:	a3 40 a4 13 80       	mov    %eax,0x8013a440
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010b280:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b285:	0f 22 d8             	mov    %eax,%cr3
+}
+8010b288:	c9                   	leave
+8010b289:	c3                   	ret
+8010b28a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010b290 <mminit>:
+  struct mm *free;
+} mmcache;
+
+void
+mminit(void)
+{
+8010b290:	55                   	push   %ebp
+8010b291:	89 e5                	mov    %esp,%ebp
+8010b293:	83 ec 10             	sub    $0x10,%esp
+  initlock(&mmcache.lock, "mmcache");
+8010b296:	68 c6 c4 10 80       	push   $0x8010c4c6
+8010b29b:	68 60 a4 13 80       	push   $0x8013a460
+8010b2a0:	e8 4b ca ff ff       	call   80107cf0 <initlock>
+}
+8010b2a5:	83 c4 10             	add    $0x10,%esp
+8010b2a8:	c9                   	leave
+8010b2a9:	c3                   	ret
+8010b2aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010b2b0 <mmalloc>:
+
+// Make an address space of sz bytes mapped by pgdir,
+// with one reference.  Returns 0 if out of memory.
+struct mm*
+mmalloc(pde_t *pgdir, uint sz)
+{
+8010b2b0:	55                   	push   %ebp
+8010b2b1:	89 e5                	mov    %esp,%ebp
+8010b2b3:	56                   	push   %esi
+8010b2b4:	53                   	push   %ebx
+  struct mm *mm;
+  char *page;
+  int i;
+
+  acquire(&mmcache.lock);
+8010b2b5:	83 ec 0c             	sub    $0xc,%esp
+8010b2b8:	68 60 a4 13 80       	push   $0x8013a460
+8010b2bd:	e8 0e cc ff ff       	call   80107ed0 <acquire>
+  if(mmcache.free == 0){
+8010b2c2:	8b 35 94 a4 13 80    	mov    0x8013a494,%esi
+8010b2c8:	83 c4 10             	add    $0x10,%esp
+8010b2cb:	85 f6                	test   %esi,%esi
+8010b2cd:	74 61                	je     8010b330 <mmalloc+0x80>
+      mm->next = mmcache.free;
+      mmcache.free = mm;
+    }
+  }
+  mm = mmcache.free;
+  mmcache.free = mm->next;
+8010b2cf:	8b 96 84 00 00 00    	mov    0x84(%esi),%edx
+  release(&mmcache.lock);
+8010b2d5:	83 ec 0c             	sub    $0xc,%esp
+  mmcache.free = mm->next;
+8010b2d8:	89 15 94 a4 13 80    	mov    %edx,0x8013a494
+  release(&mmcache.lock);
+8010b2de:	68 60 a4 13 80       	push   $0x8013a460
+8010b2e3:	e8 88 cb ff ff       	call   80107e70 <release>
+
+  initlock(&mm->lock, "mm");
+8010b2e8:	58                   	pop    %eax
+8010b2e9:	5a                   	pop    %edx
+8010b2ea:	68 ce c4 10 80       	push   $0x8010c4ce
+8010b2ef:	56                   	push   %esi
+8010b2f0:	e8 fb c9 ff ff       	call   80107cf0 <initlock>
+  initsleeplock(&mm->vmlock, "mmvm");
+8010b2f5:	8d 46 34             	lea    0x34(%esi),%eax
+8010b2f8:	59                   	pop    %ecx
+8010b2f9:	5b                   	pop    %ebx
+8010b2fa:	68 d1 c4 10 80       	push   $0x8010c4d1
+8010b2ff:	50                   	push   %eax
+8010b300:	e8 bb c8 ff ff       	call   80107bc0 <initsleeplock>
+  mm->pgdir = pgdir;
+8010b305:	8b 45 08             	mov    0x8(%ebp),%eax
+  mm->sz = sz;
+  mm->ref = 1;
+8010b308:	c7 46 7c 01 00 00 00 	movl   $0x1,0x7c(%esi)
+  mm->deadstacks = 0;
+  return mm;
+8010b30f:	83 c4 10             	add    $0x10,%esp
+  mm->deadstacks = 0;
+8010b312:	c7 86 80 00 00 00 00 	movl   $0x0,0x80(%esi)
+8010b319:	00 00 00 
+  mm->pgdir = pgdir;
+8010b31c:	89 46 74             	mov    %eax,0x74(%esi)
+  mm->sz = sz;
+8010b31f:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010b322:	89 46 78             	mov    %eax,0x78(%esi)
+}
+8010b325:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b328:	89 f0                	mov    %esi,%eax
+8010b32a:	5b                   	pop    %ebx
+8010b32b:	5e                   	pop    %esi
+8010b32c:	5d                   	pop    %ebp
+8010b32d:	c3                   	ret
+8010b32e:	66 90                	xchg   %ax,%ax
+    if((page = kalloc()) == 0){
+8010b330:	e8 eb 77 ff ff       	call   80102b20 <kalloc>
+8010b335:	89 c3                	mov    %eax,%ebx
+8010b337:	85 c0                	test   %eax,%eax
+8010b339:	74 3a                	je     8010b375 <mmalloc+0xc5>
+    memset(page, 0, PGSIZE);
+8010b33b:	83 ec 04             	sub    $0x4,%esp
+8010b33e:	68 00 10 00 00       	push   $0x1000
+8010b343:	6a 00                	push   $0x0
+8010b345:	50                   	push   %eax
+8010b346:	e8 65 cc ff ff       	call   80107fb0 <memset>
+    for(i = 0; i < PGSIZE/sizeof(*mm); i++){
+8010b34b:	89 d8                	mov    %ebx,%eax
+8010b34d:	8d 8b f0 0f 00 00    	lea    0xff0(%ebx),%ecx
+8010b353:	83 c4 10             	add    $0x10,%esp
+8010b356:	8b 35 94 a4 13 80    	mov    0x8013a494,%esi
+8010b35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      mm = (struct mm*)page + i;
+8010b360:	89 f2                	mov    %esi,%edx
+8010b362:	89 c6                	mov    %eax,%esi
+    for(i = 0; i < PGSIZE/sizeof(*mm); i++){
+8010b364:	05 88 00 00 00       	add    $0x88,%eax
+      mm->next = mmcache.free;
+8010b369:	89 50 fc             	mov    %edx,-0x4(%eax)
+    for(i = 0; i < PGSIZE/sizeof(*mm); i++){
+8010b36c:	39 c8                	cmp    %ecx,%eax
+8010b36e:	75 f0                	jne    8010b360 <mmalloc+0xb0>
+8010b370:	e9 60 ff ff ff       	jmp    8010b2d5 <mmalloc+0x25>
+      release(&mmcache.lock);
+8010b375:	83 ec 0c             	sub    $0xc,%esp
+8010b378:	68 60 a4 13 80       	push   $0x8013a460
+8010b37d:	e8 ee ca ff ff       	call   80107e70 <release>
+      return 0;
+8010b382:	83 c4 10             	add    $0x10,%esp
+8010b385:	eb 9e                	jmp    8010b325 <mmalloc+0x75>
+8010b387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b38e:	66 90                	xchg   %ax,%ax
+
+8010b390 <mmdup>:
+
+// Add a reference to mm, for a new thread.
+void
+mmdup(struct mm *mm)
+{
+8010b390:	55                   	push   %ebp
+8010b391:	89 e5                	mov    %esp,%ebp
+8010b393:	53                   	push   %ebx
+8010b394:	83 ec 10             	sub    $0x10,%esp
+8010b397:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&mm->lock);
+8010b39a:	53                   	push   %ebx
+8010b39b:	e8 30 cb ff ff       	call   80107ed0 <acquire>
+  mm->ref++;
+8010b3a0:	83 43 7c 01          	addl   $0x1,0x7c(%ebx)
+  release(&mm->lock);
+8010b3a4:	83 c4 10             	add    $0x10,%esp
+8010b3a7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010b3aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010b3ad:	c9                   	leave
+  release(&mm->lock);
+8010b3ae:	e9 bd ca ff ff       	jmp    80107e70 <release>
+8010b3b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010b3c0 <mmput>:
+
+// Drop a reference to mm, freeing it and its memory
+// with the last.  The caller must not be running on it.
+void
+mmput(struct mm *mm)
+{
+8010b3c0:	55                   	push   %ebp
+8010b3c1:	89 e5                	mov    %esp,%ebp
+8010b3c3:	56                   	push   %esi
+8010b3c4:	53                   	push   %ebx
+8010b3c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int ref;
+
+  acquire(&mm->lock);
+8010b3c8:	83 ec 0c             	sub    $0xc,%esp
+8010b3cb:	53                   	push   %ebx
+8010b3cc:	e8 ff ca ff ff       	call   80107ed0 <acquire>
+  ref = --mm->ref;
+8010b3d1:	8b 43 7c             	mov    0x7c(%ebx),%eax
+8010b3d4:	8d 70 ff             	lea    -0x1(%eax),%esi
+8010b3d7:	89 73 7c             	mov    %esi,0x7c(%ebx)
+  release(&mm->lock);
+8010b3da:	89 1c 24             	mov    %ebx,(%esp)
+8010b3dd:	e8 8e ca ff ff       	call   80107e70 <release>
+  if(ref > 0)
+8010b3e2:	83 c4 10             	add    $0x10,%esp
+8010b3e5:	85 f6                	test   %esi,%esi
+8010b3e7:	7e 07                	jle    8010b3f0 <mmput+0x30>
+  freevm(mm->pgdir);
+  acquire(&mmcache.lock);
+  mm->next = mmcache.free;
+  mmcache.free = mm;
+  release(&mmcache.lock);
+}
+8010b3e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b3ec:	5b                   	pop    %ebx
+8010b3ed:	5e                   	pop    %esi
+8010b3ee:	5d                   	pop    %ebp
+8010b3ef:	c3                   	ret
+  freevm(mm->pgdir);
+8010b3f0:	83 ec 0c             	sub    $0xc,%esp
+8010b3f3:	ff 73 74             	push   0x74(%ebx)
+8010b3f6:	e8 75 fd ff ff       	call   8010b170 <freevm>
+  acquire(&mmcache.lock);
+8010b3fb:	c7 04 24 60 a4 13 80 	movl   $0x8013a460,(%esp)
+8010b402:	e8 c9 ca ff ff       	call   80107ed0 <acquire>
+  mm->next = mmcache.free;
+8010b407:	a1 94 a4 13 80       	mov    0x8013a494,%eax
+  release(&mmcache.lock);
+8010b40c:	83 c4 10             	add    $0x10,%esp
+  mmcache.free = mm;
+8010b40f:	89 1d 94 a4 13 80    	mov    %ebx,0x8013a494
+  mm->next = mmcache.free;
+8010b415:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  release(&mmcache.lock);
+8010b41b:	c7 45 08 60 a4 13 80 	movl   $0x8013a460,0x8(%ebp)
+}
+8010b422:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b425:	5b                   	pop    %ebx
+8010b426:	5e                   	pop    %esi
+8010b427:	5d                   	pop    %ebp
+  release(&mmcache.lock);
+8010b428:	e9 43 ca ff ff       	jmp    80107e70 <release>
+8010b42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010b430 <clearpteu>:
+
+// Clear PTE_U on a page. Used to create an inaccessible
+// page beneath the user stack.
+void
+clearpteu(pde_t *pgdir, char *uva)
+{
+8010b430:	55                   	push   %ebp
+8010b431:	89 e5                	mov    %esp,%ebp
+8010b433:	83 ec 08             	sub    $0x8,%esp
+8010b436:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010b439:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &pgdir[PDX(va)];
+8010b43c:	89 c1                	mov    %eax,%ecx
+8010b43e:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010b441:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+8010b444:	f6 c2 01             	test   $0x1,%dl
+8010b447:	75 17                	jne    8010b460 <clearpteu+0x30>
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0)
+    panic("clearpteu");
+8010b449:	83 ec 0c             	sub    $0xc,%esp
+8010b44c:	68 d6 c4 10 80       	push   $0x8010c4d6
+8010b451:	e8 2a 4f ff ff       	call   80100380 <panic>
+8010b456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b45d:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010b460:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b463:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  return &pgtab[PTX(va)];
+8010b469:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010b46e:	8d 84 02 00 00 00 80 	lea    -0x80000000(%edx,%eax,1),%eax
+  if(pte == 0)
+8010b475:	85 c0                	test   %eax,%eax
+8010b477:	74 d0                	je     8010b449 <clearpteu+0x19>
+  *pte &= ~PTE_U;
+8010b479:	83 20 fb             	andl   $0xfffffffb,(%eax)
+}
+8010b47c:	c9                   	leave
+8010b47d:	c3                   	ret
+8010b47e:	66 90                	xchg   %ax,%ax
+
+8010b480 <copyuvm>:
+
+// Given a parent process's page table, create a copy
+// of it for a child.
+pde_t*
+copyuvm(pde_t *pgdir, uint sz)
+{
+8010b480:	55                   	push   %ebp
+8010b481:	89 e5                	mov    %esp,%ebp
+8010b483:	57                   	push   %edi
+8010b484:	56                   	push   %esi
+8010b485:	53                   	push   %ebx
+8010b486:	83 ec 1c             	sub    $0x1c,%esp
+  pde_t *d;
+  pte_t *pte;
+  uint pa, i, flags;
+  char *mem;
+
+  if((d = setupkvm()) == 0)
+8010b489:	e8 62 fd ff ff       	call   8010b1f0 <setupkvm>
+8010b48e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010b491:	85 c0                	test   %eax,%eax
+8010b493:	0f 84 e9 00 00 00    	je     8010b582 <copyuvm+0x102>
+    return 0;
+  for(i = PGSIZE; i < sz; i += PGSIZE){
+8010b499:	81 7d 0c 00 10 00 00 	cmpl   $0x1000,0xc(%ebp)
+8010b4a0:	0f 86 b0 00 00 00    	jbe    8010b556 <copyuvm+0xd6>
+8010b4a6:	be 00 10 00 00       	mov    $0x1000,%esi
+8010b4ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b4af:	90                   	nop
+  if(*pde & PTE_P){
+8010b4b0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  pde = &pgdir[PDX(va)];
+8010b4b3:	89 f0                	mov    %esi,%eax
+8010b4b5:	c1 e8 16             	shr    $0x16,%eax
+  if(*pde & PTE_P){
+8010b4b8:	8b 04 81             	mov    (%ecx,%eax,4),%eax
+8010b4bb:	a8 01                	test   $0x1,%al
+8010b4bd:	75 11                	jne    8010b4d0 <copyuvm+0x50>
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+      panic("copyuvm: pte should exist");
+8010b4bf:	83 ec 0c             	sub    $0xc,%esp
+8010b4c2:	68 e0 c4 10 80       	push   $0x8010c4e0
+8010b4c7:	e8 b4 4e ff ff       	call   80100380 <panic>
+8010b4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return &pgtab[PTX(va)];
+8010b4d0:	89 f2                	mov    %esi,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b4d2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b4d7:	c1 ea 0a             	shr    $0xa,%edx
+8010b4da:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010b4e0:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+8010b4e7:	85 c0                	test   %eax,%eax
+8010b4e9:	74 d4                	je     8010b4bf <copyuvm+0x3f>
+    if(!(*pte & PTE_P))
+8010b4eb:	8b 00                	mov    (%eax),%eax
+8010b4ed:	a8 01                	test   $0x1,%al
+8010b4ef:	0f 84 9f 00 00 00    	je     8010b594 <copyuvm+0x114>
+      panic("copyuvm: page not present");
+    pa = PTE_ADDR(*pte);
+8010b4f5:	89 c7                	mov    %eax,%edi
+    flags = PTE_FLAGS(*pte);
+8010b4f7:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010b4fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    pa = PTE_ADDR(*pte);
+8010b4ff:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+    if((mem = kalloc()) == 0)
+8010b505:	e8 16 76 ff ff       	call   80102b20 <kalloc>
+8010b50a:	89 c3                	mov    %eax,%ebx
+8010b50c:	85 c0                	test   %eax,%eax
+8010b50e:	74 64                	je     8010b574 <copyuvm+0xf4>
+      goto bad;
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+8010b510:	83 ec 04             	sub    $0x4,%esp
+8010b513:	81 c7 00 00 00 80    	add    $0x80000000,%edi
+8010b519:	68 00 10 00 00       	push   $0x1000
+8010b51e:	57                   	push   %edi
+8010b51f:	50                   	push   %eax
+8010b520:	e8 1b cb ff ff       	call   80108040 <memmove>
+    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
+8010b525:	58                   	pop    %eax
+8010b526:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010b52c:	5a                   	pop    %edx
+8010b52d:	ff 75 e4             	push   -0x1c(%ebp)
+8010b530:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010b535:	89 f2                	mov    %esi,%edx
+8010b537:	50                   	push   %eax
+8010b538:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010b53b:	e8 b0 f4 ff ff       	call   8010a9f0 <mappages>
+8010b540:	83 c4 10             	add    $0x10,%esp
+8010b543:	85 c0                	test   %eax,%eax
+8010b545:	78 21                	js     8010b568 <copyuvm+0xe8>
+  for(i = PGSIZE; i < sz; i += PGSIZE){
+8010b547:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010b54d:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010b550:	0f 82 5a ff ff ff    	jb     8010b4b0 <copyuvm+0x30>
+  return d;
+
+bad:
+  freevm(d);
+  return 0;
+}
+8010b556:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010b559:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b55c:	5b                   	pop    %ebx
+8010b55d:	5e                   	pop    %esi
+8010b55e:	5f                   	pop    %edi
+8010b55f:	5d                   	pop    %ebp
+8010b560:	c3                   	ret
+8010b561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      kfree(mem);
+8010b568:	83 ec 0c             	sub    $0xc,%esp
+8010b56b:	53                   	push   %ebx
+8010b56c:	e8 ef 73 ff ff       	call   80102960 <kfree>
+      goto bad;
+8010b571:	83 c4 10             	add    $0x10,%esp
+  freevm(d);
+8010b574:	83 ec 0c             	sub    $0xc,%esp
+8010b577:	ff 75 e0             	push   -0x20(%ebp)
+8010b57a:	e8 f1 fb ff ff       	call   8010b170 <freevm>
+  return 0;
+8010b57f:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010b582:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+}
+8010b589:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010b58c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b58f:	5b                   	pop    %ebx
+8010b590:	5e                   	pop    %esi
+8010b591:	5f                   	pop    %edi
+8010b592:	5d                   	pop    %ebp
+8010b593:	c3                   	ret
+      panic("copyuvm: page not present");
+8010b594:	83 ec 0c             	sub    $0xc,%esp
+8010b597:	68 fa c4 10 80       	push   $0x8010c4fa
+8010b59c:	e8 df 4d ff ff       	call   80100380 <panic>
+8010b5a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b5a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b5af:	90                   	nop
+
+8010b5b0 <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+8010b5b0:	55                   	push   %ebp
+8010b5b1:	89 e5                	mov    %esp,%ebp
+8010b5b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010b5b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &pgdir[PDX(va)];
+8010b5b9:	89 c1                	mov    %eax,%ecx
+8010b5bb:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010b5be:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+8010b5c1:	f6 c2 01             	test   $0x1,%dl
+8010b5c4:	0f 84 82 03 00 00    	je     8010b94c <uva2ka.cold>
+  return &pgtab[PTX(va)];
+8010b5ca:	c1 e8 0c             	shr    $0xc,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b5cd:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if((*pte & PTE_P) == 0)
+    return 0;
+  if((*pte & PTE_U) == 0)
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+}
+8010b5d3:	5d                   	pop    %ebp
+  return &pgtab[PTX(va)];
+8010b5d4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  if((*pte & PTE_P) == 0)
+8010b5d9:	8b 84 82 00 00 00 80 	mov    -0x80000000(%edx,%eax,4),%eax
+  if((*pte & PTE_U) == 0)
+8010b5e0:	89 c2                	mov    %eax,%edx
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b5e2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((*pte & PTE_U) == 0)
+8010b5e7:	83 e2 05             	and    $0x5,%edx
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b5ea:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b5ef:	83 fa 05             	cmp    $0x5,%edx
+8010b5f2:	ba 00 00 00 00       	mov    $0x0,%edx
+8010b5f7:	0f 45 c2             	cmovne %edx,%eax
+}
+8010b5fa:	c3                   	ret
+8010b5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b5ff:	90                   	nop
+
+8010b600 <copyout>:
+// Copy len bytes from p to user address va in page table pgdir.
+// Most useful when pgdir is not the current page table.
+// uva2ka ensures this only works for PTE_U pages.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+8010b600:	55                   	push   %ebp
+8010b601:	89 e5                	mov    %esp,%ebp
+8010b603:	57                   	push   %edi
+8010b604:	56                   	push   %esi
+8010b605:	53                   	push   %ebx
+8010b606:	83 ec 0c             	sub    $0xc,%esp
+8010b609:	8b 75 14             	mov    0x14(%ebp),%esi
+8010b60c:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010b60f:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *buf, *pa0;
+  uint n, va0;
+
+  buf = (char*)p;
+  while(len > 0){
+8010b612:	85 f6                	test   %esi,%esi
+8010b614:	75 51                	jne    8010b667 <copyout+0x67>
+8010b616:	e9 a5 00 00 00       	jmp    8010b6c0 <copyout+0xc0>
+8010b61b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b61f:	90                   	nop
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b620:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010b626:	8d 8b 00 00 00 80    	lea    -0x80000000(%ebx),%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+    pa0 = uva2ka(pgdir, (char*)va0);
+    if(pa0 == 0)
+8010b62c:	81 fb 00 00 00 80    	cmp    $0x80000000,%ebx
+8010b632:	74 75                	je     8010b6a9 <copyout+0xa9>
+      return -1;
+    n = PGSIZE - (va - va0);
+8010b634:	89 fb                	mov    %edi,%ebx
+8010b636:	29 c3                	sub    %eax,%ebx
+8010b638:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b63e:	39 f3                	cmp    %esi,%ebx
+8010b640:	0f 47 de             	cmova  %esi,%ebx
+    if(n > len)
+      n = len;
+    memmove(pa0 + (va - va0), buf, n);
+8010b643:	29 f8                	sub    %edi,%eax
+8010b645:	83 ec 04             	sub    $0x4,%esp
+8010b648:	01 c1                	add    %eax,%ecx
+8010b64a:	53                   	push   %ebx
+8010b64b:	52                   	push   %edx
+8010b64c:	89 55 10             	mov    %edx,0x10(%ebp)
+8010b64f:	51                   	push   %ecx
+8010b650:	e8 eb c9 ff ff       	call   80108040 <memmove>
+    len -= n;
+    buf += n;
+8010b655:	8b 55 10             	mov    0x10(%ebp),%edx
+    va = va0 + PGSIZE;
+8010b658:	8d 87 00 10 00 00    	lea    0x1000(%edi),%eax
+  while(len > 0){
+8010b65e:	83 c4 10             	add    $0x10,%esp
+    buf += n;
+8010b661:	01 da                	add    %ebx,%edx
+  while(len > 0){
+8010b663:	29 de                	sub    %ebx,%esi
+8010b665:	74 59                	je     8010b6c0 <copyout+0xc0>
+  if(*pde & PTE_P){
+8010b667:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pde = &pgdir[PDX(va)];
+8010b66a:	89 c1                	mov    %eax,%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+8010b66c:	89 c7                	mov    %eax,%edi
+  pde = &pgdir[PDX(va)];
+8010b66e:	c1 e9 16             	shr    $0x16,%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+8010b671:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  if(*pde & PTE_P){
+8010b677:	8b 0c 8b             	mov    (%ebx,%ecx,4),%ecx
+8010b67a:	f6 c1 01             	test   $0x1,%cl
+8010b67d:	0f 84 d0 02 00 00    	je     8010b953 <copyout.cold>
+  return &pgtab[PTX(va)];
+8010b683:	89 fb                	mov    %edi,%ebx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b685:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010b68b:	c1 eb 0c             	shr    $0xc,%ebx
+8010b68e:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  if((*pte & PTE_P) == 0)
+8010b694:	8b 9c 99 00 00 00 80 	mov    -0x80000000(%ecx,%ebx,4),%ebx
+  if((*pte & PTE_U) == 0)
+8010b69b:	89 d9                	mov    %ebx,%ecx
+8010b69d:	83 e1 05             	and    $0x5,%ecx
+8010b6a0:	83 f9 05             	cmp    $0x5,%ecx
+8010b6a3:	0f 84 77 ff ff ff    	je     8010b620 <copyout+0x20>
+  }
+  return 0;
+}
+8010b6a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010b6ac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b6b1:	5b                   	pop    %ebx
+8010b6b2:	5e                   	pop    %esi
+8010b6b3:	5f                   	pop    %edi
+8010b6b4:	5d                   	pop    %ebp
+8010b6b5:	c3                   	ret
+8010b6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b6bd:	8d 76 00             	lea    0x0(%esi),%esi
+8010b6c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b6c3:	31 c0                	xor    %eax,%eax
+}
+8010b6c5:	5b                   	pop    %ebx
+8010b6c6:	5e                   	pop    %esi
+8010b6c7:	5f                   	pop    %edi
+8010b6c8:	5d                   	pop    %ebp
+8010b6c9:	c3                   	ret
+8010b6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010b6d0 <mprotect>:
+
+//mprotect system call makes page table entries only readable, non-writable
+int
+mprotect(void *addr, int len){
+8010b6d0:	55                   	push   %ebp
+8010b6d1:	89 e5                	mov    %esp,%ebp
+8010b6d3:	57                   	push   %edi
+8010b6d4:	56                   	push   %esi
+8010b6d5:	53                   	push   %ebx
+8010b6d6:	83 ec 1c             	sub    $0x1c,%esp
+8010b6d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010b6dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct proc *curproc = myproc();
+8010b6df:	e8 1c a3 ff ff       	call   80105a00 <myproc>
+8010b6e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  
+  //Check if addr points to a region that is not currently a part of the address space
+  if(len <= 0 || (int)addr+len*PGSIZE > curproc->mm->sz){ 
+8010b6e7:	85 db                	test   %ebx,%ebx
+8010b6e9:	0f 8e a2 00 00 00    	jle    8010b791 <mprotect+0xc1>
+8010b6ef:	8b 00                	mov    (%eax),%eax
+8010b6f1:	c1 e3 0c             	shl    $0xc,%ebx
+8010b6f4:	89 fe                	mov    %edi,%esi
+8010b6f6:	01 fb                	add    %edi,%ebx
+8010b6f8:	39 58 78             	cmp    %ebx,0x78(%eax)
+8010b6fb:	0f 82 90 00 00 00    	jb     8010b791 <mprotect+0xc1>
+    cprintf("\nwrong len\n");
+    return -1;
+  }
+
+  //Check if addr is not page aligned 
+  if((int)(((int) addr) % PGSIZE )  != 0){ 
+8010b701:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+8010b707:	0f 85 99 00 00 00    	jne    8010b7a6 <mprotect+0xd6>
+8010b70d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(*pde & PTE_P){
+8010b710:	8b 40 74             	mov    0x74(%eax),%eax
+  pde = &pgdir[PDX(va)];
+8010b713:	89 f1                	mov    %esi,%ecx
+8010b715:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010b718:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+8010b71b:	a8 01                	test   $0x1,%al
+8010b71d:	75 11                	jne    8010b730 <mprotect+0x60>
+  }
+  //Reloading the Control register 3 with the address of page directory 
+  //to flush TLB
+  lcr3(V2P(curproc->mm->pgdir));  
+return 0;
+}
+8010b71f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+8010b722:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b727:	5b                   	pop    %ebx
+8010b728:	5e                   	pop    %esi
+8010b729:	5f                   	pop    %edi
+8010b72a:	5d                   	pop    %ebp
+8010b72b:	c3                   	ret
+8010b72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return &pgtab[PTX(va)];
+8010b730:	89 f1                	mov    %esi,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b732:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b737:	c1 e9 0a             	shr    $0xa,%ecx
+8010b73a:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010b740:	8d 8c 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%ecx
+    if(pte && ((*pte & PTE_U) != 0) && ((*pte & PTE_P) != 0) ){//make sure user && present 
+8010b747:	85 c9                	test   %ecx,%ecx
+8010b749:	74 d4                	je     8010b71f <mprotect+0x4f>
+8010b74b:	8b 01                	mov    (%ecx),%eax
+8010b74d:	89 c7                	mov    %eax,%edi
+8010b74f:	83 e7 05             	and    $0x5,%edi
+8010b752:	83 ff 05             	cmp    $0x5,%edi
+8010b755:	75 c8                	jne    8010b71f <mprotect+0x4f>
+      cprintf("PTE : 0x%p\n", pte);
+8010b757:	83 ec 08             	sub    $0x8,%esp
+      *pte = (*pte) & (~PTE_W) ; //Clearing the write bit 
+8010b75a:	83 e0 fd             	and    $0xfffffffd,%eax
+  for (i = (int) addr; i < ((int) addr + (len) *PGSIZE); i+= PGSIZE){
+8010b75d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+      *pte = (*pte) & (~PTE_W) ; //Clearing the write bit 
+8010b763:	89 01                	mov    %eax,(%ecx)
+      cprintf("PTE : 0x%p\n", pte);
+8010b765:	51                   	push   %ecx
+8010b766:	68 30 c5 10 80       	push   $0x8010c530
+8010b76b:	e8 40 4f ff ff       	call   801006b0 <cprintf>
+  lcr3(V2P(curproc->mm->pgdir));  
+8010b770:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for (i = (int) addr; i < ((int) addr + (len) *PGSIZE); i+= PGSIZE){
+8010b773:	83 c4 10             	add    $0x10,%esp
+  lcr3(V2P(curproc->mm->pgdir));  
+8010b776:	8b 00                	mov    (%eax),%eax
+  for (i = (int) addr; i < ((int) addr + (len) *PGSIZE); i+= PGSIZE){
+8010b778:	39 f3                	cmp    %esi,%ebx
+8010b77a:	7f 94                	jg     8010b710 <mprotect+0x40>
+  lcr3(V2P(curproc->mm->pgdir));  
+8010b77c:	8b 40 74             	mov    0x74(%eax),%eax
+8010b77f:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b784:	0f 22 d8             	mov    %eax,%cr3
+}
+8010b787:	8d 65 f4             	lea    -0xc(%ebp),%esp
+return 0;
+8010b78a:	31 c0                	xor    %eax,%eax
+}
+8010b78c:	5b                   	pop    %ebx
+8010b78d:	5e                   	pop    %esi
+8010b78e:	5f                   	pop    %edi
+8010b78f:	5d                   	pop    %ebp
+8010b790:	c3                   	ret
+    cprintf("\nwrong len\n");
+8010b791:	83 ec 0c             	sub    $0xc,%esp
+8010b794:	68 14 c5 10 80       	push   $0x8010c514
+8010b799:	e8 12 4f ff ff       	call   801006b0 <cprintf>
+    return -1;
+8010b79e:	83 c4 10             	add    $0x10,%esp
+8010b7a1:	e9 79 ff ff ff       	jmp    8010b71f <mprotect+0x4f>
+    cprintf("\nwrong addr %p\n", addr);
+8010b7a6:	83 ec 08             	sub    $0x8,%esp
+8010b7a9:	57                   	push   %edi
+8010b7aa:	68 20 c5 10 80       	push   $0x8010c520
+8010b7af:	e8 fc 4e ff ff       	call   801006b0 <cprintf>
+    return -1;
+8010b7b4:	83 c4 10             	add    $0x10,%esp
+8010b7b7:	e9 63 ff ff ff       	jmp    8010b71f <mprotect+0x4f>
+8010b7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010b7c0 <mguard>:
+
+//mguard system call makes pages inaccessible from user mode, e.g. as a guard
+//page below a thread stack, so that overflowing the stack faults instead of
+//silently corrupting the memory below it
+int
+mguard(void *addr, int len){
+8010b7c0:	55                   	push   %ebp
+8010b7c1:	89 e5                	mov    %esp,%ebp
+8010b7c3:	56                   	push   %esi
+8010b7c4:	53                   	push   %ebx
+8010b7c5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct proc *curproc = myproc();
+8010b7c8:	e8 33 a2 ff ff       	call   80105a00 <myproc>
+  pte_t *pte;
+  int i;
+
+  if(len <= 0 || (int)addr+len*PGSIZE > curproc->mm->sz || (int)addr % PGSIZE != 0)
+8010b7cd:	85 f6                	test   %esi,%esi
+8010b7cf:	7e 60                	jle    8010b831 <mguard+0x71>
+8010b7d1:	8b 55 08             	mov    0x8(%ebp),%edx
+8010b7d4:	89 c3                	mov    %eax,%ebx
+8010b7d6:	8b 00                	mov    (%eax),%eax
+8010b7d8:	c1 e6 0c             	shl    $0xc,%esi
+8010b7db:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+8010b7de:	39 48 78             	cmp    %ecx,0x78(%eax)
+8010b7e1:	72 4e                	jb     8010b831 <mguard+0x71>
+8010b7e3:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+8010b7e9:	74 37                	je     8010b822 <mguard+0x62>
+8010b7eb:	eb 44                	jmp    8010b831 <mguard+0x71>
+8010b7ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010b7f0:	89 d6                	mov    %edx,%esi
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b7f2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b7f7:	c1 ee 0a             	shr    $0xa,%esi
+8010b7fa:	81 e6 fc 0f 00 00    	and    $0xffc,%esi
+8010b800:	8d b4 30 00 00 00 80 	lea    -0x80000000(%eax,%esi,1),%esi
+    return -1;
+  for (i = (int) addr; i < ((int) addr + len*PGSIZE); i += PGSIZE){
+    pte = walkpgdir(curproc->mm->pgdir, (void*) i, 0);
+    if(pte == 0 || (*pte & PTE_P) == 0)
+8010b807:	85 f6                	test   %esi,%esi
+8010b809:	74 26                	je     8010b831 <mguard+0x71>
+8010b80b:	8b 06                	mov    (%esi),%eax
+8010b80d:	a8 01                	test   $0x1,%al
+8010b80f:	74 20                	je     8010b831 <mguard+0x71>
+      return -1;
+    *pte &= ~PTE_U;
+8010b811:	83 e0 fb             	and    $0xfffffffb,%eax
+  for (i = (int) addr; i < ((int) addr + len*PGSIZE); i += PGSIZE){
+8010b814:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    *pte &= ~PTE_U;
+8010b81a:	89 06                	mov    %eax,(%esi)
+  for (i = (int) addr; i < ((int) addr + len*PGSIZE); i += PGSIZE){
+8010b81c:	39 d1                	cmp    %edx,%ecx
+8010b81e:	7e 20                	jle    8010b840 <mguard+0x80>
+  }
+  tlbshootdown(curproc->mm);
+8010b820:	8b 03                	mov    (%ebx),%eax
+  if(*pde & PTE_P){
+8010b822:	8b 40 74             	mov    0x74(%eax),%eax
+  pde = &pgdir[PDX(va)];
+8010b825:	89 d6                	mov    %edx,%esi
+8010b827:	c1 ee 16             	shr    $0x16,%esi
+  if(*pde & PTE_P){
+8010b82a:	8b 04 b0             	mov    (%eax,%esi,4),%eax
+8010b82d:	a8 01                	test   $0x1,%al
+8010b82f:	75 bf                	jne    8010b7f0 <mguard+0x30>
+  return 0;
+}
+8010b831:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+8010b834:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b839:	5b                   	pop    %ebx
+8010b83a:	5e                   	pop    %esi
+8010b83b:	5d                   	pop    %ebp
+8010b83c:	c3                   	ret
+8010b83d:	8d 76 00             	lea    0x0(%esi),%esi
+  tlbshootdown(curproc->mm);
+8010b840:	83 ec 0c             	sub    $0xc,%esp
+8010b843:	ff 33                	push   (%ebx)
+8010b845:	e8 f6 f6 ff ff       	call   8010af40 <tlbshootdown>
+  return 0;
+8010b84a:	83 c4 10             	add    $0x10,%esp
+}
+8010b84d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  return 0;
+8010b850:	31 c0                	xor    %eax,%eax
+}
+8010b852:	5b                   	pop    %ebx
+8010b853:	5e                   	pop    %esi
+8010b854:	5d                   	pop    %ebp
+8010b855:	c3                   	ret
+8010b856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b85d:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010b860 <munprotect>:
+
+//mprotect system call makes page table entries both readable and writable
+int
+munprotect(void *addr, int len){
+8010b860:	55                   	push   %ebp
+8010b861:	89 e5                	mov    %esp,%ebp
+8010b863:	57                   	push   %edi
+8010b864:	56                   	push   %esi
+8010b865:	53                   	push   %ebx
+8010b866:	83 ec 1c             	sub    $0x1c,%esp
+8010b869:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010b86c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct proc *curproc = myproc();
+8010b86f:	e8 8c a1 ff ff       	call   80105a00 <myproc>
+8010b874:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  
+  //Check if addr points to a region that is not currently a part of the address space
+  if(len <= 0 || (int)addr+len*PGSIZE>curproc->mm->sz){
+8010b877:	85 db                	test   %ebx,%ebx
+8010b879:	0f 8e a2 00 00 00    	jle    8010b921 <munprotect+0xc1>
+8010b87f:	8b 00                	mov    (%eax),%eax
+8010b881:	c1 e3 0c             	shl    $0xc,%ebx
+8010b884:	89 fe                	mov    %edi,%esi
+8010b886:	01 fb                	add    %edi,%ebx
+8010b888:	39 58 78             	cmp    %ebx,0x78(%eax)
+8010b88b:	0f 82 90 00 00 00    	jb     8010b921 <munprotect+0xc1>
+    cprintf("\nwrong len\n");
+    return -1;
+  }
+
+  //Check if addr is not page aligned
+  if((int)(((int) addr) % PGSIZE )  != 0){
+8010b891:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+8010b897:	0f 85 99 00 00 00    	jne    8010b936 <munprotect+0xd6>
+8010b89d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(*pde & PTE_P){
+8010b8a0:	8b 40 74             	mov    0x74(%eax),%eax
+  pde = &pgdir[PDX(va)];
+8010b8a3:	89 f1                	mov    %esi,%ecx
+8010b8a5:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010b8a8:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+8010b8ab:	a8 01                	test   $0x1,%al
+8010b8ad:	75 11                	jne    8010b8c0 <munprotect+0x60>
+    On 32-bit x86, this is readily accomplished by updating the CR3 register (what we generically call the page-table 
+    base register in class). When the hardware sees that you overwrote CR3 (even with the same value), 
+    it guarantees that your PTE updates will be used upon subsequent accesses.
+ */
+  return 0;
+}
+8010b8af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+8010b8b2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b8b7:	5b                   	pop    %ebx
+8010b8b8:	5e                   	pop    %esi
+8010b8b9:	5f                   	pop    %edi
+8010b8ba:	5d                   	pop    %ebp
+8010b8bb:	c3                   	ret
+8010b8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return &pgtab[PTX(va)];
+8010b8c0:	89 f1                	mov    %esi,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b8c2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b8c7:	c1 e9 0a             	shr    $0xa,%ecx
+8010b8ca:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010b8d0:	8d 8c 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%ecx
+    if(pte && ((*pte & PTE_U) != 0) && ((*pte & PTE_P) != 0) ){
+8010b8d7:	85 c9                	test   %ecx,%ecx
+8010b8d9:	74 d4                	je     8010b8af <munprotect+0x4f>
+8010b8db:	8b 01                	mov    (%ecx),%eax
+8010b8dd:	89 c7                	mov    %eax,%edi
+8010b8df:	83 e7 05             	and    $0x5,%edi
+8010b8e2:	83 ff 05             	cmp    $0x5,%edi
+8010b8e5:	75 c8                	jne    8010b8af <munprotect+0x4f>
+      cprintf("PTE : 0x%p\n", pte);
+8010b8e7:	83 ec 08             	sub    $0x8,%esp
+      *pte = (*pte) | (PTE_W) ; //Setting the write bit 
+8010b8ea:	83 c8 02             	or     $0x2,%eax
+  for (i = (int) addr; i < ((int) addr + (len) *PGSIZE); i+= PGSIZE){
+8010b8ed:	81 c6 00 10 00 00    	add    $0x1000,%esi
+      *pte = (*pte) | (PTE_W) ; //Setting the write bit 
+8010b8f3:	89 01                	mov    %eax,(%ecx)
+      cprintf("PTE : 0x%p\n", pte);
+8010b8f5:	51                   	push   %ecx
+8010b8f6:	68 30 c5 10 80       	push   $0x8010c530
+8010b8fb:	e8 b0 4d ff ff       	call   801006b0 <cprintf>
+  lcr3(V2P(curproc->mm->pgdir));
+8010b900:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for (i = (int) addr; i < ((int) addr + (len) *PGSIZE); i+= PGSIZE){
+8010b903:	83 c4 10             	add    $0x10,%esp
+  lcr3(V2P(curproc->mm->pgdir));
+8010b906:	8b 00                	mov    (%eax),%eax
+  for (i = (int) addr; i < ((int) addr + (len) *PGSIZE); i+= PGSIZE){
+8010b908:	39 f3                	cmp    %esi,%ebx
+8010b90a:	7f 94                	jg     8010b8a0 <munprotect+0x40>
+  lcr3(V2P(curproc->mm->pgdir));
+8010b90c:	8b 40 74             	mov    0x74(%eax),%eax
+8010b90f:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b914:	0f 22 d8             	mov    %eax,%cr3
+}
+8010b917:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b91a:	31 c0                	xor    %eax,%eax
+}
+8010b91c:	5b                   	pop    %ebx
+8010b91d:	5e                   	pop    %esi
+8010b91e:	5f                   	pop    %edi
+8010b91f:	5d                   	pop    %ebp
+8010b920:	c3                   	ret
+    cprintf("\nwrong len\n");
+8010b921:	83 ec 0c             	sub    $0xc,%esp
+8010b924:	68 14 c5 10 80       	push   $0x8010c514
+8010b929:	e8 82 4d ff ff       	call   801006b0 <cprintf>
+    return -1;
+8010b92e:	83 c4 10             	add    $0x10,%esp
+8010b931:	e9 79 ff ff ff       	jmp    8010b8af <munprotect+0x4f>
+    cprintf("\nwrong addr %p\n", addr);
+8010b936:	83 ec 08             	sub    $0x8,%esp
+8010b939:	57                   	push   %edi
+8010b93a:	68 20 c5 10 80       	push   $0x8010c520
+8010b93f:	e8 6c 4d ff ff       	call   801006b0 <cprintf>
+    return -1;
+8010b944:	83 c4 10             	add    $0x10,%esp
+8010b947:	e9 63 ff ff ff       	jmp    8010b8af <munprotect+0x4f>
+
+8010b94c <uva2ka.cold>:
+  if((*pte & PTE_P) == 0)
+8010b94c:	a1 00 00 00 00       	mov    0x0,%eax
+8010b951:	0f 0b                	ud2
+
+8010b953 <copyout.cold>:
+8010b953:	a1 00 00 00 00       	mov    0x0,%eax
+8010b958:	0f 0b                	ud2
+8010b95a:	66 90                	xchg   %ax,%ax
+8010b95c:	66 90                	xchg   %ax,%ax
+8010b95e:	66 90                	xchg   %ax,%ax
+
+8010b960 <srandcpu>:
+// Seed this CPU's generator.  The state must never be zero,
+// and CPUs seeded alike should not draw alike, so the seed
+// is scrambled with the CPU number first.
+void
+srandcpu(uint seed)
+{
+8010b960:	55                   	push   %ebp
+8010b961:	89 e5                	mov    %esp,%ebp
+8010b963:	53                   	push   %ebx
+8010b964:	83 ec 04             	sub    $0x4,%esp
+8010b967:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  seed ^= (cpuid() + 1) * 0x9e3779b9;
+8010b96a:	e8 41 95 ff ff       	call   80104eb0 <cpuid>
+8010b96f:	83 c0 01             	add    $0x1,%eax
+8010b972:	69 c0 b9 79 37 9e    	imul   $0x9e3779b9,%eax,%eax
+8010b978:	89 c2                	mov    %eax,%edx
+8010b97a:	31 da                	xor    %ebx,%edx
+8010b97c:	39 d8                	cmp    %ebx,%eax
+8010b97e:	b8 01 00 00 00       	mov    $0x1,%eax
+8010b983:	0f 45 c2             	cmovne %edx,%eax
+8010b986:	89 c3                	mov    %eax,%ebx
+  mycpu()->rand = seed ? seed : 1;
+8010b988:	e8 c3 94 ff ff       	call   80104e50 <mycpu>
+8010b98d:	89 98 c8 00 00 00    	mov    %ebx,0xc8(%eax)
+}
+8010b993:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010b996:	c9                   	leave
+8010b997:	c3                   	ret
+8010b998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b99f:	90                   	nop
+
+8010b9a0 <random_at_most>:
+  return x & RAND_MAX;
+}
+
+// Assumes 0 <= max <= RAND_MAX
+// Returns in the half-open interval [0, max]
+long random_at_most(long max) {
+8010b9a0:	55                   	push   %ebp
+  unsigned long
+    // max <= RAND_MAX < ULONG_MAX, so this is okay.
+    num_bins = (unsigned long) max + 1,
+    num_rand = (unsigned long) RAND_MAX + 1,
+    bin_size = num_rand / num_bins,
+8010b9a1:	31 d2                	xor    %edx,%edx
+long random_at_most(long max) {
+8010b9a3:	89 e5                	mov    %esp,%ebp
+8010b9a5:	57                   	push   %edi
+8010b9a6:	56                   	push   %esi
+    bin_size = num_rand / num_bins,
+8010b9a7:	be 00 00 00 80       	mov    $0x80000000,%esi
+long random_at_most(long max) {
+8010b9ac:	53                   	push   %ebx
+8010b9ad:	83 ec 0c             	sub    $0xc,%esp
+    num_bins = (unsigned long) max + 1,
+8010b9b0:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b9b3:	8d 48 01             	lea    0x1(%eax),%ecx
+    bin_size = num_rand / num_bins,
+8010b9b6:	89 f0                	mov    %esi,%eax
+8010b9b8:	f7 f1                	div    %ecx
+8010b9ba:	89 c7                	mov    %eax,%edi
+  long x;
+  do {
+   x = genrand();
+  }
+  // This is carefully written not to overflow
+  while (num_rand - defect <= (unsigned long)x);
+8010b9bc:	29 d6                	sub    %edx,%esi
+8010b9be:	66 90                	xchg   %ax,%ax
+  x = mycpu()->rand;
+8010b9c0:	e8 8b 94 ff ff       	call   80104e50 <mycpu>
+8010b9c5:	8b 98 c8 00 00 00    	mov    0xc8(%eax),%ebx
+  x ^= x << 13;
+8010b9cb:	89 d8                	mov    %ebx,%eax
+8010b9cd:	c1 e0 0d             	shl    $0xd,%eax
+8010b9d0:	31 c3                	xor    %eax,%ebx
+  x ^= x >> 17;
+8010b9d2:	89 d8                	mov    %ebx,%eax
+8010b9d4:	c1 e8 11             	shr    $0x11,%eax
+8010b9d7:	31 c3                	xor    %eax,%ebx
+  x ^= x << 5;
+8010b9d9:	89 d8                	mov    %ebx,%eax
+8010b9db:	c1 e0 05             	shl    $0x5,%eax
+8010b9de:	31 c3                	xor    %eax,%ebx
+  mycpu()->rand = x;
+8010b9e0:	e8 6b 94 ff ff       	call   80104e50 <mycpu>
+8010b9e5:	89 98 c8 00 00 00    	mov    %ebx,0xc8(%eax)
+  return x & RAND_MAX;
+8010b9eb:	81 e3 ff ff ff 7f    	and    $0x7fffffff,%ebx
+  while (num_rand - defect <= (unsigned long)x);
+8010b9f1:	39 f3                	cmp    %esi,%ebx
+8010b9f3:	73 cb                	jae    8010b9c0 <random_at_most+0x20>
+
+  // Truncated division is intentional
+  return x/bin_size;
+}
+8010b9f5:	83 c4 0c             	add    $0xc,%esp
+  return x/bin_size;
+8010b9f8:	89 d8                	mov    %ebx,%eax
+8010b9fa:	31 d2                	xor    %edx,%edx
+}
+8010b9fc:	5b                   	pop    %ebx
+8010b9fd:	5e                   	pop    %esi
+  return x/bin_size;
+8010b9fe:	f7 f7                	div    %edi
+}
+8010ba00:	5f                   	pop    %edi
+8010ba01:	5d                   	pop    %ebp
+8010ba02:	c3                   	ret
@@ -0,0 +1,1254 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1015:	51                   	push   %ecx
+    1016:	83 ec 08             	sub    $0x8,%esp
+    1019:	8b 31                	mov    (%ecx),%esi
+    101b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+    101e:	83 fe 01             	cmp    $0x1,%esi
+    1021:	7e 27                	jle    104a <main+0x4a>
+    1023:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1027:	90                   	nop
+    printf(2, "usage: kill pid...\n");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    kill(atoi(argv[i]));
+    1028:	83 ec 0c             	sub    $0xc,%esp
+    102b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+    102e:	83 c3 01             	add    $0x1,%ebx
+    kill(atoi(argv[i]));
+    1031:	e8 fa 01 00 00       	call   1230 <atoi>
+    1036:	89 04 24             	mov    %eax,(%esp)
+    1039:	e8 95 02 00 00       	call   12d3 <kill>
+  for(i=1; i<argc; i++)
+    103e:	83 c4 10             	add    $0x10,%esp
+    1041:	39 de                	cmp    %ebx,%esi
+    1043:	75 e3                	jne    1028 <main+0x28>
+  exit();
+    1045:	e8 59 02 00 00       	call   12a3 <exit>
+    printf(2, "usage: kill pid...\n");
+    104a:	50                   	push   %eax
+    104b:	50                   	push   %eax
+    104c:	68 b8 17 00 00       	push   $0x17b8
+    1051:	6a 02                	push   $0x2
+    1053:	e8 38 04 00 00       	call   1490 <printf>
+    exit();
+    1058:	e8 46 02 00 00       	call   12a3 <exit>
+    105d:	66 90                	xchg   %ax,%ax
+    105f:	90                   	nop
+
+00001060 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1060:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1061:	31 c0                	xor    %eax,%eax
+{
+    1063:	89 e5                	mov    %esp,%ebp
+    1065:	53                   	push   %ebx
+    1066:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1069:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    106c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1070:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1074:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1077:	83 c0 01             	add    $0x1,%eax
+    107a:	84 d2                	test   %dl,%dl
+    107c:	75 f2                	jne    1070 <strcpy+0x10>
+    ;
+  return os;
+}
+    107e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1081:	89 c8                	mov    %ecx,%eax
+    1083:	c9                   	leave
+    1084:	c3                   	ret
+    1085:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	53                   	push   %ebx
+    1094:	8b 55 08             	mov    0x8(%ebp),%edx
+    1097:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    109a:	0f b6 02             	movzbl (%edx),%eax
+    109d:	84 c0                	test   %al,%al
+    109f:	75 17                	jne    10b8 <strcmp+0x28>
+    10a1:	eb 3a                	jmp    10dd <strcmp+0x4d>
+    10a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10a7:	90                   	nop
+    10a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    10ac:	83 c2 01             	add    $0x1,%edx
+    10af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    10b2:	84 c0                	test   %al,%al
+    10b4:	74 1a                	je     10d0 <strcmp+0x40>
+    p++, q++;
+    10b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    10b8:	0f b6 19             	movzbl (%ecx),%ebx
+    10bb:	38 c3                	cmp    %al,%bl
+    10bd:	74 e9                	je     10a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    10bf:	29 d8                	sub    %ebx,%eax
+}
+    10c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10c4:	c9                   	leave
+    10c5:	c3                   	ret
+    10c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    10d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    10d4:	31 c0                	xor    %eax,%eax
+    10d6:	29 d8                	sub    %ebx,%eax
+}
+    10d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10db:	c9                   	leave
+    10dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    10dd:	0f b6 19             	movzbl (%ecx),%ebx
+    10e0:	31 c0                	xor    %eax,%eax
+    10e2:	eb db                	jmp    10bf <strcmp+0x2f>
+    10e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10ef:	90                   	nop
+
+000010f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    10f6:	80 3a 00             	cmpb   $0x0,(%edx)
+    10f9:	74 15                	je     1110 <strlen+0x20>
+    10fb:	31 c0                	xor    %eax,%eax
+    10fd:	8d 76 00             	lea    0x0(%esi),%esi
+    1100:	83 c0 01             	add    $0x1,%eax
+    1103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1107:	89 c1                	mov    %eax,%ecx
+    1109:	75 f5                	jne    1100 <strlen+0x10>
+    ;
+  return n;
+}
+    110b:	89 c8                	mov    %ecx,%eax
+    110d:	5d                   	pop    %ebp
+    110e:	c3                   	ret
+    110f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1110:	31 c9                	xor    %ecx,%ecx
+}
+    1112:	5d                   	pop    %ebp
+    1113:	89 c8                	mov    %ecx,%eax
+    1115:	c3                   	ret
+    1116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	57                   	push   %edi
+    1124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    112a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    112d:	89 d7                	mov    %edx,%edi
+    112f:	fc                   	cld
+    1130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1135:	89 d0                	mov    %edx,%eax
+    1137:	c9                   	leave
+    1138:	c3                   	ret
+    1139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	8b 45 08             	mov    0x8(%ebp),%eax
+    1146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    114a:	0f b6 10             	movzbl (%eax),%edx
+    114d:	84 d2                	test   %dl,%dl
+    114f:	75 12                	jne    1163 <strchr+0x23>
+    1151:	eb 1d                	jmp    1170 <strchr+0x30>
+    1153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1157:	90                   	nop
+    1158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    115c:	83 c0 01             	add    $0x1,%eax
+    115f:	84 d2                	test   %dl,%dl
+    1161:	74 0d                	je     1170 <strchr+0x30>
+    if(*s == c)
+    1163:	38 d1                	cmp    %dl,%cl
+    1165:	75 f1                	jne    1158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1167:	5d                   	pop    %ebp
+    1168:	c3                   	ret
+    1169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1170:	31 c0                	xor    %eax,%eax
+}
+    1172:	5d                   	pop    %ebp
+    1173:	c3                   	ret
+    1174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    117f:	90                   	nop
+
+00001180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	57                   	push   %edi
+    1184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1185:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1188:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1189:	31 db                	xor    %ebx,%ebx
+{
+    118b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    118e:	eb 27                	jmp    11b7 <gets+0x37>
+    cc = read(0, &c, 1);
+    1190:	83 ec 04             	sub    $0x4,%esp
+    1193:	6a 01                	push   $0x1
+    1195:	56                   	push   %esi
+    1196:	6a 00                	push   $0x0
+    1198:	e8 1e 01 00 00       	call   12bb <read>
+    if(cc < 1)
+    119d:	83 c4 10             	add    $0x10,%esp
+    11a0:	85 c0                	test   %eax,%eax
+    11a2:	7e 1d                	jle    11c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    11a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    11a8:	8b 55 08             	mov    0x8(%ebp),%edx
+    11ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    11af:	3c 0a                	cmp    $0xa,%al
+    11b1:	74 10                	je     11c3 <gets+0x43>
+    11b3:	3c 0d                	cmp    $0xd,%al
+    11b5:	74 0c                	je     11c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    11b7:	89 df                	mov    %ebx,%edi
+    11b9:	83 c3 01             	add    $0x1,%ebx
+    11bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    11bf:	7c cf                	jl     1190 <gets+0x10>
+    11c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    11c3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    11ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11cd:	5b                   	pop    %ebx
+    11ce:	5e                   	pop    %esi
+    11cf:	5f                   	pop    %edi
+    11d0:	5d                   	pop    %ebp
+    11d1:	c3                   	ret
+    11d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	56                   	push   %esi
+    11e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    11e5:	83 ec 08             	sub    $0x8,%esp
+    11e8:	6a 00                	push   $0x0
+    11ea:	ff 75 08             	push   0x8(%ebp)
+    11ed:	e8 f1 00 00 00       	call   12e3 <open>
+  if(fd < 0)
+    11f2:	83 c4 10             	add    $0x10,%esp
+    11f5:	85 c0                	test   %eax,%eax
+    11f7:	78 27                	js     1220 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    11f9:	83 ec 08             	sub    $0x8,%esp
+    11fc:	ff 75 0c             	push   0xc(%ebp)
+    11ff:	89 c3                	mov    %eax,%ebx
+    1201:	50                   	push   %eax
+    1202:	e8 f4 00 00 00       	call   12fb <fstat>
+  close(fd);
+    1207:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    120a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    120c:	e8 ba 00 00 00       	call   12cb <close>
+  return r;
+    1211:	83 c4 10             	add    $0x10,%esp
+}
+    1214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1217:	89 f0                	mov    %esi,%eax
+    1219:	5b                   	pop    %ebx
+    121a:	5e                   	pop    %esi
+    121b:	5d                   	pop    %ebp
+    121c:	c3                   	ret
+    121d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1220:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1225:	eb ed                	jmp    1214 <stat+0x34>
+    1227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122e:	66 90                	xchg   %ax,%ax
+
+00001230 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	53                   	push   %ebx
+    1234:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1237:	0f be 02             	movsbl (%edx),%eax
+    123a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    123d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1245:	77 1e                	ja     1265 <atoi+0x35>
+    1247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    124e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1250:	83 c2 01             	add    $0x1,%edx
+    1253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1256:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    125a:	0f be 02             	movsbl (%edx),%eax
+    125d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1260:	80 fb 09             	cmp    $0x9,%bl
+    1263:	76 eb                	jbe    1250 <atoi+0x20>
+  return n;
+}
+    1265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1268:	89 c8                	mov    %ecx,%eax
+    126a:	c9                   	leave
+    126b:	c3                   	ret
+    126c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001270 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	57                   	push   %edi
+    1274:	56                   	push   %esi
+    1275:	8b 45 10             	mov    0x10(%ebp),%eax
+    1278:	8b 55 08             	mov    0x8(%ebp),%edx
+    127b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    127e:	85 c0                	test   %eax,%eax
+    1280:	7e 13                	jle    1295 <memmove+0x25>
+    1282:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1284:	89 d7                	mov    %edx,%edi
+    1286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1290:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1291:	39 f8                	cmp    %edi,%eax
+    1293:	75 fb                	jne    1290 <memmove+0x20>
+  return vdst;
+}
+    1295:	5e                   	pop    %esi
+    1296:	89 d0                	mov    %edx,%eax
+    1298:	5f                   	pop    %edi
+    1299:	5d                   	pop    %ebp
+    129a:	c3                   	ret
+
+0000129b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    129b:	b8 01 00 00 00       	mov    $0x1,%eax
+    12a0:	cd 40                	int    $0x40
+    12a2:	c3                   	ret
+
+000012a3 <exit>:
+SYSCALL(exit)
+    12a3:	b8 02 00 00 00       	mov    $0x2,%eax
+    12a8:	cd 40                	int    $0x40
+    12aa:	c3                   	ret
+
+000012ab <wait>:
+SYSCALL(wait)
+    12ab:	b8 03 00 00 00       	mov    $0x3,%eax
+    12b0:	cd 40                	int    $0x40
+    12b2:	c3                   	ret
+
+000012b3 <pipe>:
+SYSCALL(pipe)
+    12b3:	b8 04 00 00 00       	mov    $0x4,%eax
+    12b8:	cd 40                	int    $0x40
+    12ba:	c3                   	ret
+
+000012bb <read>:
+SYSCALL(read)
+    12bb:	b8 05 00 00 00       	mov    $0x5,%eax
+    12c0:	cd 40                	int    $0x40
+    12c2:	c3                   	ret
+
+000012c3 <write>:
+SYSCALL(write)
+    12c3:	b8 10 00 00 00       	mov    $0x10,%eax
+    12c8:	cd 40                	int    $0x40
+    12ca:	c3                   	ret
+
+000012cb <close>:
+SYSCALL(close)
+    12cb:	b8 15 00 00 00       	mov    $0x15,%eax
+    12d0:	cd 40                	int    $0x40
+    12d2:	c3                   	ret
+
+000012d3 <kill>:
+SYSCALL(kill)
+    12d3:	b8 06 00 00 00       	mov    $0x6,%eax
+    12d8:	cd 40                	int    $0x40
+    12da:	c3                   	ret
+
+000012db <exec>:
+SYSCALL(exec)
+    12db:	b8 07 00 00 00       	mov    $0x7,%eax
+    12e0:	cd 40                	int    $0x40
+    12e2:	c3                   	ret
+
+000012e3 <open>:
+SYSCALL(open)
+    12e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    12e8:	cd 40                	int    $0x40
+    12ea:	c3                   	ret
+
+000012eb <mknod>:
+SYSCALL(mknod)
+    12eb:	b8 11 00 00 00       	mov    $0x11,%eax
+    12f0:	cd 40                	int    $0x40
+    12f2:	c3                   	ret
+
+000012f3 <unlink>:
+SYSCALL(unlink)
+    12f3:	b8 12 00 00 00       	mov    $0x12,%eax
+    12f8:	cd 40                	int    $0x40
+    12fa:	c3                   	ret
+
+000012fb <fstat>:
+SYSCALL(fstat)
+    12fb:	b8 08 00 00 00       	mov    $0x8,%eax
+    1300:	cd 40                	int    $0x40
+    1302:	c3                   	ret
+
+00001303 <link>:
+SYSCALL(link)
+    1303:	b8 13 00 00 00       	mov    $0x13,%eax
+    1308:	cd 40                	int    $0x40
+    130a:	c3                   	ret
+
+0000130b <mkdir>:
+SYSCALL(mkdir)
+    130b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1310:	cd 40                	int    $0x40
+    1312:	c3                   	ret
+
+00001313 <chdir>:
+SYSCALL(chdir)
+    1313:	b8 09 00 00 00       	mov    $0x9,%eax
+    1318:	cd 40                	int    $0x40
+    131a:	c3                   	ret
+
+0000131b <dup>:
+SYSCALL(dup)
+    131b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1320:	cd 40                	int    $0x40
+    1322:	c3                   	ret
+
+00001323 <getpid>:
+SYSCALL(getpid)
+    1323:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1328:	cd 40                	int    $0x40
+    132a:	c3                   	ret
+
+0000132b <sbrk>:
+SYSCALL(sbrk)
+    132b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1330:	cd 40                	int    $0x40
+    1332:	c3                   	ret
+
+00001333 <sleep>:
+SYSCALL(sleep)
+    1333:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1338:	cd 40                	int    $0x40
+    133a:	c3                   	ret
+
+0000133b <uptime>:
+SYSCALL(uptime)
+    133b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1340:	cd 40                	int    $0x40
+    1342:	c3                   	ret
+
+00001343 <settickets>:
+SYSCALL(settickets)
+    1343:	b8 16 00 00 00       	mov    $0x16,%eax
+    1348:	cd 40                	int    $0x40
+    134a:	c3                   	ret
+
+0000134b <getpinfo>:
+SYSCALL(getpinfo)
+    134b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1350:	cd 40                	int    $0x40
+    1352:	c3                   	ret
+
+00001353 <mprotect>:
+SYSCALL(mprotect)
+    1353:	b8 18 00 00 00       	mov    $0x18,%eax
+    1358:	cd 40                	int    $0x40
+    135a:	c3                   	ret
+
+0000135b <munprotect>:
+SYSCALL(munprotect)
+    135b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1360:	cd 40                	int    $0x40
+    1362:	c3                   	ret
+
+00001363 <clone>:
+SYSCALL(clone)
+    1363:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1368:	cd 40                	int    $0x40
+    136a:	c3                   	ret
+
+0000136b <join>:
+SYSCALL(join)
+    136b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1370:	cd 40                	int    $0x40
+    1372:	c3                   	ret
+
+00001373 <initlock_t>:
+SYSCALL(initlock_t)
+    1373:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1378:	cd 40                	int    $0x40
+    137a:	c3                   	ret
+
+0000137b <acquire_t>:
+SYSCALL(acquire_t)
+    137b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1380:	cd 40                	int    $0x40
+    1382:	c3                   	ret
+
+00001383 <release_t>:
+SYSCALL(release_t)
+    1383:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1388:	cd 40                	int    $0x40
+    138a:	c3                   	ret
+
+0000138b <setsched>:
+SYSCALL(setsched)
+    138b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1390:	cd 40                	int    $0x40
+    1392:	c3                   	ret
+
+00001393 <mkgroup>:
+SYSCALL(mkgroup)
+    1393:	b8 20 00 00 00       	mov    $0x20,%eax
+    1398:	cd 40                	int    $0x40
+    139a:	c3                   	ret
+
+0000139b <joingroup>:
+SYSCALL(joingroup)
+    139b:	b8 21 00 00 00       	mov    $0x21,%eax
+    13a0:	cd 40                	int    $0x40
+    13a2:	c3                   	ret
+
+000013a3 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    13a3:	b8 22 00 00 00       	mov    $0x22,%eax
+    13a8:	cd 40                	int    $0x40
+    13aa:	c3                   	ret
+
+000013ab <setdeadline>:
+SYSCALL(setdeadline)
+    13ab:	b8 23 00 00 00       	mov    $0x23,%eax
+    13b0:	cd 40                	int    $0x40
+    13b2:	c3                   	ret
+
+000013b3 <setaffinity>:
+SYSCALL(setaffinity)
+    13b3:	b8 24 00 00 00       	mov    $0x24,%eax
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+
+000013bb <yield_to>:
+SYSCALL(yield_to)
+    13bb:	b8 25 00 00 00       	mov    $0x25,%eax
+    13c0:	cd 40                	int    $0x40
+    13c2:	c3                   	ret
+
+000013c3 <getlatency>:
+SYSCALL(getlatency)
+    13c3:	b8 26 00 00 00       	mov    $0x26,%eax
+    13c8:	cd 40                	int    $0x40
+    13ca:	c3                   	ret
+
+000013cb <futex_wait>:
+SYSCALL(futex_wait)
+    13cb:	b8 27 00 00 00       	mov    $0x27,%eax
+    13d0:	cd 40                	int    $0x40
+    13d2:	c3                   	ret
+
+000013d3 <futex_wake>:
+SYSCALL(futex_wake)
+    13d3:	b8 28 00 00 00       	mov    $0x28,%eax
+    13d8:	cd 40                	int    $0x40
+    13da:	c3                   	ret
+
+000013db <mguard>:
+SYSCALL(mguard)
+    13db:	b8 29 00 00 00       	mov    $0x29,%eax
+    13e0:	cd 40                	int    $0x40
+    13e2:	c3                   	ret
+
+000013e3 <join_any>:
+SYSCALL(join_any)
+    13e3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+    13eb:	66 90                	xchg   %ax,%ax
+    13ed:	66 90                	xchg   %ax,%ax
+    13ef:	90                   	nop
+
+000013f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    13f0:	55                   	push   %ebp
+    13f1:	89 e5                	mov    %esp,%ebp
+    13f3:	57                   	push   %edi
+    13f4:	56                   	push   %esi
+    13f5:	53                   	push   %ebx
+    13f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    13f8:	89 d1                	mov    %edx,%ecx
+{
+    13fa:	83 ec 3c             	sub    $0x3c,%esp
+    13fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1400:	85 d2                	test   %edx,%edx
+    1402:	0f 89 80 00 00 00    	jns    1488 <printint+0x98>
+    1408:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    140c:	74 7a                	je     1488 <printint+0x98>
+    x = -xx;
+    140e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1410:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1415:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1418:	31 f6                	xor    %esi,%esi
+    141a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1420:	89 c8                	mov    %ecx,%eax
+    1422:	31 d2                	xor    %edx,%edx
+    1424:	89 f7                	mov    %esi,%edi
+    1426:	f7 f3                	div    %ebx
+    1428:	8d 76 01             	lea    0x1(%esi),%esi
+    142b:	0f b6 92 2c 18 00 00 	movzbl 0x182c(%edx),%edx
+    1432:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1436:	89 ca                	mov    %ecx,%edx
+    1438:	89 c1                	mov    %eax,%ecx
+    143a:	39 da                	cmp    %ebx,%edx
+    143c:	73 e2                	jae    1420 <printint+0x30>
+  if(neg)
+    143e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1441:	85 c0                	test   %eax,%eax
+    1443:	74 07                	je     144c <printint+0x5c>
+    buf[i++] = '-';
+    1445:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    144a:	89 f7                	mov    %esi,%edi
+    144c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    144f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1452:	01 df                	add    %ebx,%edi
+    1454:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1458:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    145b:	83 ec 04             	sub    $0x4,%esp
+    145e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1461:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1464:	6a 01                	push   $0x1
+    1466:	50                   	push   %eax
+    1467:	56                   	push   %esi
+    1468:	e8 56 fe ff ff       	call   12c3 <write>
+  while(--i >= 0)
+    146d:	89 f8                	mov    %edi,%eax
+    146f:	83 c4 10             	add    $0x10,%esp
+    1472:	83 ef 01             	sub    $0x1,%edi
+    1475:	39 d8                	cmp    %ebx,%eax
+    1477:	75 df                	jne    1458 <printint+0x68>
+}
+    1479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    147c:	5b                   	pop    %ebx
+    147d:	5e                   	pop    %esi
+    147e:	5f                   	pop    %edi
+    147f:	5d                   	pop    %ebp
+    1480:	c3                   	ret
+    1481:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1488:	31 c0                	xor    %eax,%eax
+    148a:	eb 89                	jmp    1415 <printint+0x25>
+    148c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001490 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1490:	55                   	push   %ebp
+    1491:	89 e5                	mov    %esp,%ebp
+    1493:	57                   	push   %edi
+    1494:	56                   	push   %esi
+    1495:	53                   	push   %ebx
+    1496:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1499:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    149c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    149f:	0f b6 1e             	movzbl (%esi),%ebx
+    14a2:	83 c6 01             	add    $0x1,%esi
+    14a5:	84 db                	test   %bl,%bl
+    14a7:	74 67                	je     1510 <printf+0x80>
+    14a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    14ac:	31 d2                	xor    %edx,%edx
+    14ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    14b1:	eb 34                	jmp    14e7 <printf+0x57>
+    14b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14b7:	90                   	nop
+    14b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    14bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    14c0:	83 f8 25             	cmp    $0x25,%eax
+    14c3:	74 18                	je     14dd <printf+0x4d>
+  write(fd, &c, 1);
+    14c5:	83 ec 04             	sub    $0x4,%esp
+    14c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    14cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    14ce:	6a 01                	push   $0x1
+    14d0:	50                   	push   %eax
+    14d1:	57                   	push   %edi
+    14d2:	e8 ec fd ff ff       	call   12c3 <write>
+    14d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    14da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    14dd:	0f b6 1e             	movzbl (%esi),%ebx
+    14e0:	83 c6 01             	add    $0x1,%esi
+    14e3:	84 db                	test   %bl,%bl
+    14e5:	74 29                	je     1510 <printf+0x80>
+    c = fmt[i] & 0xff;
+    14e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    14ea:	85 d2                	test   %edx,%edx
+    14ec:	74 ca                	je     14b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    14ee:	83 fa 25             	cmp    $0x25,%edx
+    14f1:	75 ea                	jne    14dd <printf+0x4d>
+      if(c == 'd'){
+    14f3:	83 f8 25             	cmp    $0x25,%eax
+    14f6:	0f 84 24 01 00 00    	je     1620 <printf+0x190>
+    14fc:	83 e8 63             	sub    $0x63,%eax
+    14ff:	83 f8 15             	cmp    $0x15,%eax
+    1502:	77 1c                	ja     1520 <printf+0x90>
+    1504:	ff 24 85 d4 17 00 00 	jmp    *0x17d4(,%eax,4)
+    150b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    150f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1510:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1513:	5b                   	pop    %ebx
+    1514:	5e                   	pop    %esi
+    1515:	5f                   	pop    %edi
+    1516:	5d                   	pop    %ebp
+    1517:	c3                   	ret
+    1518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    151f:	90                   	nop
+  write(fd, &c, 1);
+    1520:	83 ec 04             	sub    $0x4,%esp
+    1523:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1526:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    152a:	6a 01                	push   $0x1
+    152c:	52                   	push   %edx
+    152d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1530:	57                   	push   %edi
+    1531:	e8 8d fd ff ff       	call   12c3 <write>
+    1536:	83 c4 0c             	add    $0xc,%esp
+    1539:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    153c:	6a 01                	push   $0x1
+    153e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1541:	52                   	push   %edx
+    1542:	57                   	push   %edi
+    1543:	e8 7b fd ff ff       	call   12c3 <write>
+        putc(fd, c);
+    1548:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    154b:	31 d2                	xor    %edx,%edx
+    154d:	eb 8e                	jmp    14dd <printf+0x4d>
+    154f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1550:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1553:	83 ec 0c             	sub    $0xc,%esp
+    1556:	b9 10 00 00 00       	mov    $0x10,%ecx
+    155b:	8b 13                	mov    (%ebx),%edx
+    155d:	6a 00                	push   $0x0
+    155f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1561:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1564:	e8 87 fe ff ff       	call   13f0 <printint>
+        ap++;
+    1569:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    156c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    156f:	31 d2                	xor    %edx,%edx
+    1571:	e9 67 ff ff ff       	jmp    14dd <printf+0x4d>
+    1576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    157d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1580:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1583:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1585:	83 c0 04             	add    $0x4,%eax
+    1588:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    158b:	85 db                	test   %ebx,%ebx
+    158d:	0f 84 9d 00 00 00    	je     1630 <printf+0x1a0>
+        while(*s != 0){
+    1593:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1596:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1598:	84 c0                	test   %al,%al
+    159a:	0f 84 3d ff ff ff    	je     14dd <printf+0x4d>
+    15a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    15a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    15a6:	89 de                	mov    %ebx,%esi
+    15a8:	89 d3                	mov    %edx,%ebx
+    15aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    15b0:	83 ec 04             	sub    $0x4,%esp
+    15b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    15b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    15b9:	6a 01                	push   $0x1
+    15bb:	53                   	push   %ebx
+    15bc:	57                   	push   %edi
+    15bd:	e8 01 fd ff ff       	call   12c3 <write>
+        while(*s != 0){
+    15c2:	0f b6 06             	movzbl (%esi),%eax
+    15c5:	83 c4 10             	add    $0x10,%esp
+    15c8:	84 c0                	test   %al,%al
+    15ca:	75 e4                	jne    15b0 <printf+0x120>
+      state = 0;
+    15cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    15cf:	31 d2                	xor    %edx,%edx
+    15d1:	e9 07 ff ff ff       	jmp    14dd <printf+0x4d>
+    15d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    15e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    15e3:	83 ec 0c             	sub    $0xc,%esp
+    15e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    15eb:	8b 13                	mov    (%ebx),%edx
+    15ed:	6a 01                	push   $0x1
+    15ef:	e9 6b ff ff ff       	jmp    155f <printf+0xcf>
+    15f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    15f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    15fb:	83 ec 04             	sub    $0x4,%esp
+    15fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1601:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1603:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1606:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1609:	6a 01                	push   $0x1
+    160b:	52                   	push   %edx
+    160c:	57                   	push   %edi
+    160d:	e8 b1 fc ff ff       	call   12c3 <write>
+        ap++;
+    1612:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1615:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1618:	31 d2                	xor    %edx,%edx
+    161a:	e9 be fe ff ff       	jmp    14dd <printf+0x4d>
+    161f:	90                   	nop
+  write(fd, &c, 1);
+    1620:	83 ec 04             	sub    $0x4,%esp
+    1623:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1626:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1629:	6a 01                	push   $0x1
+    162b:	e9 11 ff ff ff       	jmp    1541 <printf+0xb1>
+    1630:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1635:	bb cc 17 00 00       	mov    $0x17cc,%ebx
+    163a:	e9 61 ff ff ff       	jmp    15a0 <printf+0x110>
+    163f:	90                   	nop
+
+00001640 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1640:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1641:	a1 d8 1a 00 00       	mov    0x1ad8,%eax
+{
+    1646:	89 e5                	mov    %esp,%ebp
+    1648:	57                   	push   %edi
+    1649:	56                   	push   %esi
+    164a:	53                   	push   %ebx
+    164b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    164e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1658:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    165a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    165c:	39 ca                	cmp    %ecx,%edx
+    165e:	73 30                	jae    1690 <free+0x50>
+    1660:	39 c1                	cmp    %eax,%ecx
+    1662:	72 04                	jb     1668 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1664:	39 c2                	cmp    %eax,%edx
+    1666:	72 f0                	jb     1658 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1668:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    166b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    166e:	39 f8                	cmp    %edi,%eax
+    1670:	74 2e                	je     16a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1672:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1675:	8b 42 04             	mov    0x4(%edx),%eax
+    1678:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    167b:	39 f1                	cmp    %esi,%ecx
+    167d:	74 38                	je     16b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    167f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1681:	5b                   	pop    %ebx
+  freep = p;
+    1682:	89 15 d8 1a 00 00    	mov    %edx,0x1ad8
+}
+    1688:	5e                   	pop    %esi
+    1689:	5f                   	pop    %edi
+    168a:	5d                   	pop    %ebp
+    168b:	c3                   	ret
+    168c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1690:	39 c1                	cmp    %eax,%ecx
+    1692:	72 d0                	jb     1664 <free+0x24>
+    1694:	eb c2                	jmp    1658 <free+0x18>
+    1696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    169d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    16a0:	03 70 04             	add    0x4(%eax),%esi
+    16a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    16a6:	8b 02                	mov    (%edx),%eax
+    16a8:	8b 00                	mov    (%eax),%eax
+    16aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    16ad:	8b 42 04             	mov    0x4(%edx),%eax
+    16b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    16b3:	39 f1                	cmp    %esi,%ecx
+    16b5:	75 c8                	jne    167f <free+0x3f>
+    p->s.size += bp->s.size;
+    16b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    16ba:	89 15 d8 1a 00 00    	mov    %edx,0x1ad8
+    p->s.size += bp->s.size;
+    16c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    16c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    16c6:	89 0a                	mov    %ecx,(%edx)
+}
+    16c8:	5b                   	pop    %ebx
+    16c9:	5e                   	pop    %esi
+    16ca:	5f                   	pop    %edi
+    16cb:	5d                   	pop    %ebp
+    16cc:	c3                   	ret
+    16cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000016d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    16d0:	55                   	push   %ebp
+    16d1:	89 e5                	mov    %esp,%ebp
+    16d3:	57                   	push   %edi
+    16d4:	56                   	push   %esi
+    16d5:	53                   	push   %ebx
+    16d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    16d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    16dc:	8b 15 d8 1a 00 00    	mov    0x1ad8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    16e2:	8d 78 07             	lea    0x7(%eax),%edi
+    16e5:	c1 ef 03             	shr    $0x3,%edi
+    16e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    16eb:	85 d2                	test   %edx,%edx
+    16ed:	0f 84 8d 00 00 00    	je     1780 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    16f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    16f5:	8b 48 04             	mov    0x4(%eax),%ecx
+    16f8:	39 f9                	cmp    %edi,%ecx
+    16fa:	73 64                	jae    1760 <malloc+0x90>
+  if(nu < 4096)
+    16fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1701:	39 df                	cmp    %ebx,%edi
+    1703:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1706:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    170d:	eb 0a                	jmp    1719 <malloc+0x49>
+    170f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1710:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1712:	8b 48 04             	mov    0x4(%eax),%ecx
+    1715:	39 f9                	cmp    %edi,%ecx
+    1717:	73 47                	jae    1760 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1719:	89 c2                	mov    %eax,%edx
+    171b:	39 05 d8 1a 00 00    	cmp    %eax,0x1ad8
+    1721:	75 ed                	jne    1710 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1723:	83 ec 0c             	sub    $0xc,%esp
+    1726:	56                   	push   %esi
+    1727:	e8 ff fb ff ff       	call   132b <sbrk>
+  if(p == (char*)-1)
+    172c:	83 c4 10             	add    $0x10,%esp
+    172f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1732:	74 1c                	je     1750 <malloc+0x80>
+  hp->s.size = nu;
+    1734:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1737:	83 ec 0c             	sub    $0xc,%esp
+    173a:	83 c0 08             	add    $0x8,%eax
+    173d:	50                   	push   %eax
+    173e:	e8 fd fe ff ff       	call   1640 <free>
+  return freep;
+    1743:	8b 15 d8 1a 00 00    	mov    0x1ad8,%edx
+      if((p = morecore(nunits)) == 0)
+    1749:	83 c4 10             	add    $0x10,%esp
+    174c:	85 d2                	test   %edx,%edx
+    174e:	75 c0                	jne    1710 <malloc+0x40>
+        return 0;
+  }
+}
+    1750:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1753:	31 c0                	xor    %eax,%eax
+}
+    1755:	5b                   	pop    %ebx
+    1756:	5e                   	pop    %esi
+    1757:	5f                   	pop    %edi
+    1758:	5d                   	pop    %ebp
+    1759:	c3                   	ret
+    175a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1760:	39 cf                	cmp    %ecx,%edi
+    1762:	74 4c                	je     17b0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1764:	29 f9                	sub    %edi,%ecx
+    1766:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1769:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    176c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    176f:	89 15 d8 1a 00 00    	mov    %edx,0x1ad8
+}
+    1775:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1778:	83 c0 08             	add    $0x8,%eax
+}
+    177b:	5b                   	pop    %ebx
+    177c:	5e                   	pop    %esi
+    177d:	5f                   	pop    %edi
+    177e:	5d                   	pop    %ebp
+    177f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1780:	c7 05 d8 1a 00 00 dc 	movl   $0x1adc,0x1ad8
+    1787:	1a 00 00 
+    base.s.size = 0;
+    178a:	b8 dc 1a 00 00       	mov    $0x1adc,%eax
+    base.s.ptr = freep = prevp = &base;
+    178f:	c7 05 dc 1a 00 00 dc 	movl   $0x1adc,0x1adc
+    1796:	1a 00 00 
+    base.s.size = 0;
+    1799:	c7 05 e0 1a 00 00 00 	movl   $0x0,0x1ae0
+    17a0:	00 00 00 
+    if(p->s.size >= nunits){
+    17a3:	e9 54 ff ff ff       	jmp    16fc <malloc+0x2c>
+    17a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    17b0:	8b 08                	mov    (%eax),%ecx
+    17b2:	89 0a                	mov    %ecx,(%edx)
+    17b4:	eb b9                	jmp    176f <malloc+0x9f>
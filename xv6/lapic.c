@@ -113,6 +113,27 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Send interrupt vector to the CPU with the given APIC ID.
+void
+lapicipi(int apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
+// Timer counts left before this CPU's next clock tick.
+uint
+lapictimer(void)
+{
+  if(!lapic)
+    return 0;
+  return lapic[TCCR];
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
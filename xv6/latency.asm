@@ -0,0 +1,1304 @@
+
+_latency:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+// has waited to run after becoming RUNNABLE: the number of waits
+// of 2^b to 2^(b+1) TSC cycles for each bucket b.
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	56                   	push   %esi
+    100e:	53                   	push   %ebx
+    100f:	31 db                	xor    %ebx,%ebx
+    1011:	51                   	push   %ecx
+    1012:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	uint hist[NLATBUCKET];
+	int pid, b, n;
+
+	pid = argc > 1 ? atoi(argv[1]) : 0;
+    1018:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+    101b:	8b 41 04             	mov    0x4(%ecx),%eax
+	pid = argc > 1 ? atoi(argv[1]) : 0;
+    101e:	7e 10                	jle    1030 <main+0x30>
+    1020:	83 ec 0c             	sub    $0xc,%esp
+    1023:	ff 70 04             	push   0x4(%eax)
+    1026:	e8 65 02 00 00       	call   1290 <atoi>
+    102b:	83 c4 10             	add    $0x10,%esp
+    102e:	89 c3                	mov    %eax,%ebx
+	if(getlatency(pid, hist) < 0){
+    1030:	83 ec 08             	sub    $0x8,%esp
+    1033:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+    1039:	56                   	push   %esi
+    103a:	53                   	push   %ebx
+    103b:	e8 e3 03 00 00       	call   1423 <getlatency>
+    1040:	83 c4 10             	add    $0x10,%esp
+    1043:	85 c0                	test   %eax,%eax
+    1045:	78 66                	js     10ad <main+0xad>
+    1047:	89 f0                	mov    %esi,%eax
+    1049:	8d 4d e8             	lea    -0x18(%ebp),%ecx
+		printf(2, "latency: no process %d\n", pid);
+		exit();
+	}
+
+	n = 0;
+    104c:	31 d2                	xor    %edx,%edx
+    104e:	66 90                	xchg   %ax,%ax
+	for(b = 0; b < NLATBUCKET; b++)
+		n += hist[b];
+    1050:	03 10                	add    (%eax),%edx
+	for(b = 0; b < NLATBUCKET; b++)
+    1052:	83 c0 04             	add    $0x4,%eax
+    1055:	39 c8                	cmp    %ecx,%eax
+    1057:	75 f7                	jne    1050 <main+0x50>
+	printf(1, "%d waits to run\n", n);
+    1059:	83 ec 04             	sub    $0x4,%esp
+	printf(1, "cycles\t\twaits\n");
+	for(b = 0; b < NLATBUCKET; b++)
+    105c:	31 db                	xor    %ebx,%ebx
+	printf(1, "%d waits to run\n", n);
+    105e:	52                   	push   %edx
+    105f:	68 30 18 00 00       	push   $0x1830
+    1064:	6a 01                	push   $0x1
+    1066:	e8 85 04 00 00       	call   14f0 <printf>
+	printf(1, "cycles\t\twaits\n");
+    106b:	58                   	pop    %eax
+    106c:	5a                   	pop    %edx
+    106d:	68 41 18 00 00       	push   $0x1841
+    1072:	6a 01                	push   $0x1
+    1074:	e8 77 04 00 00       	call   14f0 <printf>
+    1079:	83 c4 10             	add    $0x10,%esp
+    107c:	eb 0a                	jmp    1088 <main+0x88>
+    107e:	66 90                	xchg   %ax,%ax
+	for(b = 0; b < NLATBUCKET; b++)
+    1080:	83 c3 01             	add    $0x1,%ebx
+    1083:	83 fb 20             	cmp    $0x20,%ebx
+    1086:	74 20                	je     10a8 <main+0xa8>
+		if(hist[b])
+    1088:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+    108b:	85 c0                	test   %eax,%eax
+    108d:	74 f1                	je     1080 <main+0x80>
+			printf(1, "2^%d\t\t%d\n", b, hist[b]);
+    108f:	50                   	push   %eax
+    1090:	53                   	push   %ebx
+	for(b = 0; b < NLATBUCKET; b++)
+    1091:	83 c3 01             	add    $0x1,%ebx
+			printf(1, "2^%d\t\t%d\n", b, hist[b]);
+    1094:	68 50 18 00 00       	push   $0x1850
+    1099:	6a 01                	push   $0x1
+    109b:	e8 50 04 00 00       	call   14f0 <printf>
+    10a0:	83 c4 10             	add    $0x10,%esp
+	for(b = 0; b < NLATBUCKET; b++)
+    10a3:	83 fb 20             	cmp    $0x20,%ebx
+    10a6:	75 e0                	jne    1088 <main+0x88>
+	exit();
+    10a8:	e8 56 02 00 00       	call   1303 <exit>
+		printf(2, "latency: no process %d\n", pid);
+    10ad:	51                   	push   %ecx
+    10ae:	53                   	push   %ebx
+    10af:	68 18 18 00 00       	push   $0x1818
+    10b4:	6a 02                	push   $0x2
+    10b6:	e8 35 04 00 00       	call   14f0 <printf>
+		exit();
+    10bb:	e8 43 02 00 00       	call   1303 <exit>
+
+000010c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    10c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    10c1:	31 c0                	xor    %eax,%eax
+{
+    10c3:	89 e5                	mov    %esp,%ebp
+    10c5:	53                   	push   %ebx
+    10c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    10c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    10cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    10d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    10d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    10d7:	83 c0 01             	add    $0x1,%eax
+    10da:	84 d2                	test   %dl,%dl
+    10dc:	75 f2                	jne    10d0 <strcpy+0x10>
+    ;
+  return os;
+}
+    10de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10e1:	89 c8                	mov    %ecx,%eax
+    10e3:	c9                   	leave
+    10e4:	c3                   	ret
+    10e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000010f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	53                   	push   %ebx
+    10f4:	8b 55 08             	mov    0x8(%ebp),%edx
+    10f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    10fa:	0f b6 02             	movzbl (%edx),%eax
+    10fd:	84 c0                	test   %al,%al
+    10ff:	75 17                	jne    1118 <strcmp+0x28>
+    1101:	eb 3a                	jmp    113d <strcmp+0x4d>
+    1103:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1107:	90                   	nop
+    1108:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    110c:	83 c2 01             	add    $0x1,%edx
+    110f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1112:	84 c0                	test   %al,%al
+    1114:	74 1a                	je     1130 <strcmp+0x40>
+    p++, q++;
+    1116:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1118:	0f b6 19             	movzbl (%ecx),%ebx
+    111b:	38 c3                	cmp    %al,%bl
+    111d:	74 e9                	je     1108 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    111f:	29 d8                	sub    %ebx,%eax
+}
+    1121:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1124:	c9                   	leave
+    1125:	c3                   	ret
+    1126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1130:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1134:	31 c0                	xor    %eax,%eax
+    1136:	29 d8                	sub    %ebx,%eax
+}
+    1138:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    113b:	c9                   	leave
+    113c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    113d:	0f b6 19             	movzbl (%ecx),%ebx
+    1140:	31 c0                	xor    %eax,%eax
+    1142:	eb db                	jmp    111f <strcmp+0x2f>
+    1144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    114f:	90                   	nop
+
+00001150 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1156:	80 3a 00             	cmpb   $0x0,(%edx)
+    1159:	74 15                	je     1170 <strlen+0x20>
+    115b:	31 c0                	xor    %eax,%eax
+    115d:	8d 76 00             	lea    0x0(%esi),%esi
+    1160:	83 c0 01             	add    $0x1,%eax
+    1163:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1167:	89 c1                	mov    %eax,%ecx
+    1169:	75 f5                	jne    1160 <strlen+0x10>
+    ;
+  return n;
+}
+    116b:	89 c8                	mov    %ecx,%eax
+    116d:	5d                   	pop    %ebp
+    116e:	c3                   	ret
+    116f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1170:	31 c9                	xor    %ecx,%ecx
+}
+    1172:	5d                   	pop    %ebp
+    1173:	89 c8                	mov    %ecx,%eax
+    1175:	c3                   	ret
+    1176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001180 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	57                   	push   %edi
+    1184:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1187:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    118a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    118d:	89 d7                	mov    %edx,%edi
+    118f:	fc                   	cld
+    1190:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1192:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1195:	89 d0                	mov    %edx,%eax
+    1197:	c9                   	leave
+    1198:	c3                   	ret
+    1199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    11a0:	55                   	push   %ebp
+    11a1:	89 e5                	mov    %esp,%ebp
+    11a3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    11aa:	0f b6 10             	movzbl (%eax),%edx
+    11ad:	84 d2                	test   %dl,%dl
+    11af:	75 12                	jne    11c3 <strchr+0x23>
+    11b1:	eb 1d                	jmp    11d0 <strchr+0x30>
+    11b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11b7:	90                   	nop
+    11b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    11bc:	83 c0 01             	add    $0x1,%eax
+    11bf:	84 d2                	test   %dl,%dl
+    11c1:	74 0d                	je     11d0 <strchr+0x30>
+    if(*s == c)
+    11c3:	38 d1                	cmp    %dl,%cl
+    11c5:	75 f1                	jne    11b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    11c7:	5d                   	pop    %ebp
+    11c8:	c3                   	ret
+    11c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    11d0:	31 c0                	xor    %eax,%eax
+}
+    11d2:	5d                   	pop    %ebp
+    11d3:	c3                   	ret
+    11d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11df:	90                   	nop
+
+000011e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	57                   	push   %edi
+    11e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    11e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    11e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    11e9:	31 db                	xor    %ebx,%ebx
+{
+    11eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    11ee:	eb 27                	jmp    1217 <gets+0x37>
+    cc = read(0, &c, 1);
+    11f0:	83 ec 04             	sub    $0x4,%esp
+    11f3:	6a 01                	push   $0x1
+    11f5:	56                   	push   %esi
+    11f6:	6a 00                	push   $0x0
+    11f8:	e8 1e 01 00 00       	call   131b <read>
+    if(cc < 1)
+    11fd:	83 c4 10             	add    $0x10,%esp
+    1200:	85 c0                	test   %eax,%eax
+    1202:	7e 1d                	jle    1221 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1204:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1208:	8b 55 08             	mov    0x8(%ebp),%edx
+    120b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    120f:	3c 0a                	cmp    $0xa,%al
+    1211:	74 10                	je     1223 <gets+0x43>
+    1213:	3c 0d                	cmp    $0xd,%al
+    1215:	74 0c                	je     1223 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1217:	89 df                	mov    %ebx,%edi
+    1219:	83 c3 01             	add    $0x1,%ebx
+    121c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    121f:	7c cf                	jl     11f0 <gets+0x10>
+    1221:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1223:	8b 45 08             	mov    0x8(%ebp),%eax
+    1226:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    122a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    122d:	5b                   	pop    %ebx
+    122e:	5e                   	pop    %esi
+    122f:	5f                   	pop    %edi
+    1230:	5d                   	pop    %ebp
+    1231:	c3                   	ret
+    1232:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001240 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	56                   	push   %esi
+    1244:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1245:	83 ec 08             	sub    $0x8,%esp
+    1248:	6a 00                	push   $0x0
+    124a:	ff 75 08             	push   0x8(%ebp)
+    124d:	e8 f1 00 00 00       	call   1343 <open>
+  if(fd < 0)
+    1252:	83 c4 10             	add    $0x10,%esp
+    1255:	85 c0                	test   %eax,%eax
+    1257:	78 27                	js     1280 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1259:	83 ec 08             	sub    $0x8,%esp
+    125c:	ff 75 0c             	push   0xc(%ebp)
+    125f:	89 c3                	mov    %eax,%ebx
+    1261:	50                   	push   %eax
+    1262:	e8 f4 00 00 00       	call   135b <fstat>
+  close(fd);
+    1267:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    126a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    126c:	e8 ba 00 00 00       	call   132b <close>
+  return r;
+    1271:	83 c4 10             	add    $0x10,%esp
+}
+    1274:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1277:	89 f0                	mov    %esi,%eax
+    1279:	5b                   	pop    %ebx
+    127a:	5e                   	pop    %esi
+    127b:	5d                   	pop    %ebp
+    127c:	c3                   	ret
+    127d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1280:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1285:	eb ed                	jmp    1274 <stat+0x34>
+    1287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128e:	66 90                	xchg   %ax,%ax
+
+00001290 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	53                   	push   %ebx
+    1294:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1297:	0f be 02             	movsbl (%edx),%eax
+    129a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    129d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    12a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    12a5:	77 1e                	ja     12c5 <atoi+0x35>
+    12a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    12b0:	83 c2 01             	add    $0x1,%edx
+    12b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    12b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    12ba:	0f be 02             	movsbl (%edx),%eax
+    12bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    12c0:	80 fb 09             	cmp    $0x9,%bl
+    12c3:	76 eb                	jbe    12b0 <atoi+0x20>
+  return n;
+}
+    12c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12c8:	89 c8                	mov    %ecx,%eax
+    12ca:	c9                   	leave
+    12cb:	c3                   	ret
+    12cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000012d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	57                   	push   %edi
+    12d4:	56                   	push   %esi
+    12d5:	8b 45 10             	mov    0x10(%ebp),%eax
+    12d8:	8b 55 08             	mov    0x8(%ebp),%edx
+    12db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    12de:	85 c0                	test   %eax,%eax
+    12e0:	7e 13                	jle    12f5 <memmove+0x25>
+    12e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    12e4:	89 d7                	mov    %edx,%edi
+    12e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    12f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    12f1:	39 f8                	cmp    %edi,%eax
+    12f3:	75 fb                	jne    12f0 <memmove+0x20>
+  return vdst;
+}
+    12f5:	5e                   	pop    %esi
+    12f6:	89 d0                	mov    %edx,%eax
+    12f8:	5f                   	pop    %edi
+    12f9:	5d                   	pop    %ebp
+    12fa:	c3                   	ret
+
+000012fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    12fb:	b8 01 00 00 00       	mov    $0x1,%eax
+    1300:	cd 40                	int    $0x40
+    1302:	c3                   	ret
+
+00001303 <exit>:
+SYSCALL(exit)
+    1303:	b8 02 00 00 00       	mov    $0x2,%eax
+    1308:	cd 40                	int    $0x40
+    130a:	c3                   	ret
+
+0000130b <wait>:
+SYSCALL(wait)
+    130b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1310:	cd 40                	int    $0x40
+    1312:	c3                   	ret
+
+00001313 <pipe>:
+SYSCALL(pipe)
+    1313:	b8 04 00 00 00       	mov    $0x4,%eax
+    1318:	cd 40                	int    $0x40
+    131a:	c3                   	ret
+
+0000131b <read>:
+SYSCALL(read)
+    131b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1320:	cd 40                	int    $0x40
+    1322:	c3                   	ret
+
+00001323 <write>:
+SYSCALL(write)
+    1323:	b8 10 00 00 00       	mov    $0x10,%eax
+    1328:	cd 40                	int    $0x40
+    132a:	c3                   	ret
+
+0000132b <close>:
+SYSCALL(close)
+    132b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1330:	cd 40                	int    $0x40
+    1332:	c3                   	ret
+
+00001333 <kill>:
+SYSCALL(kill)
+    1333:	b8 06 00 00 00       	mov    $0x6,%eax
+    1338:	cd 40                	int    $0x40
+    133a:	c3                   	ret
+
+0000133b <exec>:
+SYSCALL(exec)
+    133b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1340:	cd 40                	int    $0x40
+    1342:	c3                   	ret
+
+00001343 <open>:
+SYSCALL(open)
+    1343:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1348:	cd 40                	int    $0x40
+    134a:	c3                   	ret
+
+0000134b <mknod>:
+SYSCALL(mknod)
+    134b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1350:	cd 40                	int    $0x40
+    1352:	c3                   	ret
+
+00001353 <unlink>:
+SYSCALL(unlink)
+    1353:	b8 12 00 00 00       	mov    $0x12,%eax
+    1358:	cd 40                	int    $0x40
+    135a:	c3                   	ret
+
+0000135b <fstat>:
+SYSCALL(fstat)
+    135b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1360:	cd 40                	int    $0x40
+    1362:	c3                   	ret
+
+00001363 <link>:
+SYSCALL(link)
+    1363:	b8 13 00 00 00       	mov    $0x13,%eax
+    1368:	cd 40                	int    $0x40
+    136a:	c3                   	ret
+
+0000136b <mkdir>:
+SYSCALL(mkdir)
+    136b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1370:	cd 40                	int    $0x40
+    1372:	c3                   	ret
+
+00001373 <chdir>:
+SYSCALL(chdir)
+    1373:	b8 09 00 00 00       	mov    $0x9,%eax
+    1378:	cd 40                	int    $0x40
+    137a:	c3                   	ret
+
+0000137b <dup>:
+SYSCALL(dup)
+    137b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1380:	cd 40                	int    $0x40
+    1382:	c3                   	ret
+
+00001383 <getpid>:
+SYSCALL(getpid)
+    1383:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1388:	cd 40                	int    $0x40
+    138a:	c3                   	ret
+
+0000138b <sbrk>:
+SYSCALL(sbrk)
+    138b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1390:	cd 40                	int    $0x40
+    1392:	c3                   	ret
+
+00001393 <sleep>:
+SYSCALL(sleep)
+    1393:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1398:	cd 40                	int    $0x40
+    139a:	c3                   	ret
+
+0000139b <uptime>:
+SYSCALL(uptime)
+    139b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    13a0:	cd 40                	int    $0x40
+    13a2:	c3                   	ret
+
+000013a3 <settickets>:
+SYSCALL(settickets)
+    13a3:	b8 16 00 00 00       	mov    $0x16,%eax
+    13a8:	cd 40                	int    $0x40
+    13aa:	c3                   	ret
+
+000013ab <getpinfo>:
+SYSCALL(getpinfo)
+    13ab:	b8 17 00 00 00       	mov    $0x17,%eax
+    13b0:	cd 40                	int    $0x40
+    13b2:	c3                   	ret
+
+000013b3 <mprotect>:
+SYSCALL(mprotect)
+    13b3:	b8 18 00 00 00       	mov    $0x18,%eax
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+
+000013bb <munprotect>:
+SYSCALL(munprotect)
+    13bb:	b8 19 00 00 00       	mov    $0x19,%eax
+    13c0:	cd 40                	int    $0x40
+    13c2:	c3                   	ret
+
+000013c3 <clone>:
+SYSCALL(clone)
+    13c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    13c8:	cd 40                	int    $0x40
+    13ca:	c3                   	ret
+
+000013cb <join>:
+SYSCALL(join)
+    13cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    13d0:	cd 40                	int    $0x40
+    13d2:	c3                   	ret
+
+000013d3 <initlock_t>:
+SYSCALL(initlock_t)
+    13d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    13d8:	cd 40                	int    $0x40
+    13da:	c3                   	ret
+
+000013db <acquire_t>:
+SYSCALL(acquire_t)
+    13db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    13e0:	cd 40                	int    $0x40
+    13e2:	c3                   	ret
+
+000013e3 <release_t>:
+SYSCALL(release_t)
+    13e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+
+000013eb <setsched>:
+SYSCALL(setsched)
+    13eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    13f0:	cd 40                	int    $0x40
+    13f2:	c3                   	ret
+
+000013f3 <mkgroup>:
+SYSCALL(mkgroup)
+    13f3:	b8 20 00 00 00       	mov    $0x20,%eax
+    13f8:	cd 40                	int    $0x40
+    13fa:	c3                   	ret
+
+000013fb <joingroup>:
+SYSCALL(joingroup)
+    13fb:	b8 21 00 00 00       	mov    $0x21,%eax
+    1400:	cd 40                	int    $0x40
+    1402:	c3                   	ret
+
+00001403 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1403:	b8 22 00 00 00       	mov    $0x22,%eax
+    1408:	cd 40                	int    $0x40
+    140a:	c3                   	ret
+
+0000140b <setdeadline>:
+SYSCALL(setdeadline)
+    140b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1410:	cd 40                	int    $0x40
+    1412:	c3                   	ret
+
+00001413 <setaffinity>:
+SYSCALL(setaffinity)
+    1413:	b8 24 00 00 00       	mov    $0x24,%eax
+    1418:	cd 40                	int    $0x40
+    141a:	c3                   	ret
+
+0000141b <yield_to>:
+SYSCALL(yield_to)
+    141b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1420:	cd 40                	int    $0x40
+    1422:	c3                   	ret
+
+00001423 <getlatency>:
+SYSCALL(getlatency)
+    1423:	b8 26 00 00 00       	mov    $0x26,%eax
+    1428:	cd 40                	int    $0x40
+    142a:	c3                   	ret
+
+0000142b <futex_wait>:
+SYSCALL(futex_wait)
+    142b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1430:	cd 40                	int    $0x40
+    1432:	c3                   	ret
+
+00001433 <futex_wake>:
+SYSCALL(futex_wake)
+    1433:	b8 28 00 00 00       	mov    $0x28,%eax
+    1438:	cd 40                	int    $0x40
+    143a:	c3                   	ret
+
+0000143b <mguard>:
+SYSCALL(mguard)
+    143b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1440:	cd 40                	int    $0x40
+    1442:	c3                   	ret
+
+00001443 <join_any>:
+SYSCALL(join_any)
+    1443:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1448:	cd 40                	int    $0x40
+    144a:	c3                   	ret
+    144b:	66 90                	xchg   %ax,%ax
+    144d:	66 90                	xchg   %ax,%ax
+    144f:	90                   	nop
+
+00001450 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1450:	55                   	push   %ebp
+    1451:	89 e5                	mov    %esp,%ebp
+    1453:	57                   	push   %edi
+    1454:	56                   	push   %esi
+    1455:	53                   	push   %ebx
+    1456:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1458:	89 d1                	mov    %edx,%ecx
+{
+    145a:	83 ec 3c             	sub    $0x3c,%esp
+    145d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1460:	85 d2                	test   %edx,%edx
+    1462:	0f 89 80 00 00 00    	jns    14e8 <printint+0x98>
+    1468:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    146c:	74 7a                	je     14e8 <printint+0x98>
+    x = -xx;
+    146e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1470:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1475:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1478:	31 f6                	xor    %esi,%esi
+    147a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1480:	89 c8                	mov    %ecx,%eax
+    1482:	31 d2                	xor    %edx,%edx
+    1484:	89 f7                	mov    %esi,%edi
+    1486:	f7 f3                	div    %ebx
+    1488:	8d 76 01             	lea    0x1(%esi),%esi
+    148b:	0f b6 92 bc 18 00 00 	movzbl 0x18bc(%edx),%edx
+    1492:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1496:	89 ca                	mov    %ecx,%edx
+    1498:	89 c1                	mov    %eax,%ecx
+    149a:	39 da                	cmp    %ebx,%edx
+    149c:	73 e2                	jae    1480 <printint+0x30>
+  if(neg)
+    149e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    14a1:	85 c0                	test   %eax,%eax
+    14a3:	74 07                	je     14ac <printint+0x5c>
+    buf[i++] = '-';
+    14a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    14aa:	89 f7                	mov    %esi,%edi
+    14ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    14af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    14b2:	01 df                	add    %ebx,%edi
+    14b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    14b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    14bb:	83 ec 04             	sub    $0x4,%esp
+    14be:	88 45 d7             	mov    %al,-0x29(%ebp)
+    14c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    14c4:	6a 01                	push   $0x1
+    14c6:	50                   	push   %eax
+    14c7:	56                   	push   %esi
+    14c8:	e8 56 fe ff ff       	call   1323 <write>
+  while(--i >= 0)
+    14cd:	89 f8                	mov    %edi,%eax
+    14cf:	83 c4 10             	add    $0x10,%esp
+    14d2:	83 ef 01             	sub    $0x1,%edi
+    14d5:	39 d8                	cmp    %ebx,%eax
+    14d7:	75 df                	jne    14b8 <printint+0x68>
+}
+    14d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14dc:	5b                   	pop    %ebx
+    14dd:	5e                   	pop    %esi
+    14de:	5f                   	pop    %edi
+    14df:	5d                   	pop    %ebp
+    14e0:	c3                   	ret
+    14e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    14e8:	31 c0                	xor    %eax,%eax
+    14ea:	eb 89                	jmp    1475 <printint+0x25>
+    14ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000014f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    14f0:	55                   	push   %ebp
+    14f1:	89 e5                	mov    %esp,%ebp
+    14f3:	57                   	push   %edi
+    14f4:	56                   	push   %esi
+    14f5:	53                   	push   %ebx
+    14f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    14f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    14fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    14ff:	0f b6 1e             	movzbl (%esi),%ebx
+    1502:	83 c6 01             	add    $0x1,%esi
+    1505:	84 db                	test   %bl,%bl
+    1507:	74 67                	je     1570 <printf+0x80>
+    1509:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    150c:	31 d2                	xor    %edx,%edx
+    150e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1511:	eb 34                	jmp    1547 <printf+0x57>
+    1513:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1517:	90                   	nop
+    1518:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    151b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1520:	83 f8 25             	cmp    $0x25,%eax
+    1523:	74 18                	je     153d <printf+0x4d>
+  write(fd, &c, 1);
+    1525:	83 ec 04             	sub    $0x4,%esp
+    1528:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    152b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    152e:	6a 01                	push   $0x1
+    1530:	50                   	push   %eax
+    1531:	57                   	push   %edi
+    1532:	e8 ec fd ff ff       	call   1323 <write>
+    1537:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    153a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    153d:	0f b6 1e             	movzbl (%esi),%ebx
+    1540:	83 c6 01             	add    $0x1,%esi
+    1543:	84 db                	test   %bl,%bl
+    1545:	74 29                	je     1570 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1547:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    154a:	85 d2                	test   %edx,%edx
+    154c:	74 ca                	je     1518 <printf+0x28>
+      }
+    } else if(state == '%'){
+    154e:	83 fa 25             	cmp    $0x25,%edx
+    1551:	75 ea                	jne    153d <printf+0x4d>
+      if(c == 'd'){
+    1553:	83 f8 25             	cmp    $0x25,%eax
+    1556:	0f 84 24 01 00 00    	je     1680 <printf+0x190>
+    155c:	83 e8 63             	sub    $0x63,%eax
+    155f:	83 f8 15             	cmp    $0x15,%eax
+    1562:	77 1c                	ja     1580 <printf+0x90>
+    1564:	ff 24 85 64 18 00 00 	jmp    *0x1864(,%eax,4)
+    156b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    156f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1570:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1573:	5b                   	pop    %ebx
+    1574:	5e                   	pop    %esi
+    1575:	5f                   	pop    %edi
+    1576:	5d                   	pop    %ebp
+    1577:	c3                   	ret
+    1578:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    157f:	90                   	nop
+  write(fd, &c, 1);
+    1580:	83 ec 04             	sub    $0x4,%esp
+    1583:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1586:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    158a:	6a 01                	push   $0x1
+    158c:	52                   	push   %edx
+    158d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1590:	57                   	push   %edi
+    1591:	e8 8d fd ff ff       	call   1323 <write>
+    1596:	83 c4 0c             	add    $0xc,%esp
+    1599:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    159c:	6a 01                	push   $0x1
+    159e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    15a1:	52                   	push   %edx
+    15a2:	57                   	push   %edi
+    15a3:	e8 7b fd ff ff       	call   1323 <write>
+        putc(fd, c);
+    15a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    15ab:	31 d2                	xor    %edx,%edx
+    15ad:	eb 8e                	jmp    153d <printf+0x4d>
+    15af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    15b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    15b3:	83 ec 0c             	sub    $0xc,%esp
+    15b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    15bb:	8b 13                	mov    (%ebx),%edx
+    15bd:	6a 00                	push   $0x0
+    15bf:	89 f8                	mov    %edi,%eax
+        ap++;
+    15c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    15c4:	e8 87 fe ff ff       	call   1450 <printint>
+        ap++;
+    15c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    15cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    15cf:	31 d2                	xor    %edx,%edx
+    15d1:	e9 67 ff ff ff       	jmp    153d <printf+0x4d>
+    15d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    15e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    15e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    15e5:	83 c0 04             	add    $0x4,%eax
+    15e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    15eb:	85 db                	test   %ebx,%ebx
+    15ed:	0f 84 9d 00 00 00    	je     1690 <printf+0x1a0>
+        while(*s != 0){
+    15f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    15f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    15f8:	84 c0                	test   %al,%al
+    15fa:	0f 84 3d ff ff ff    	je     153d <printf+0x4d>
+    1600:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1603:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1606:	89 de                	mov    %ebx,%esi
+    1608:	89 d3                	mov    %edx,%ebx
+    160a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1610:	83 ec 04             	sub    $0x4,%esp
+    1613:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1616:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1619:	6a 01                	push   $0x1
+    161b:	53                   	push   %ebx
+    161c:	57                   	push   %edi
+    161d:	e8 01 fd ff ff       	call   1323 <write>
+        while(*s != 0){
+    1622:	0f b6 06             	movzbl (%esi),%eax
+    1625:	83 c4 10             	add    $0x10,%esp
+    1628:	84 c0                	test   %al,%al
+    162a:	75 e4                	jne    1610 <printf+0x120>
+      state = 0;
+    162c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    162f:	31 d2                	xor    %edx,%edx
+    1631:	e9 07 ff ff ff       	jmp    153d <printf+0x4d>
+    1636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    163d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1640:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1643:	83 ec 0c             	sub    $0xc,%esp
+    1646:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    164b:	8b 13                	mov    (%ebx),%edx
+    164d:	6a 01                	push   $0x1
+    164f:	e9 6b ff ff ff       	jmp    15bf <printf+0xcf>
+    1654:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1658:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    165b:	83 ec 04             	sub    $0x4,%esp
+    165e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1661:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1663:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1666:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1669:	6a 01                	push   $0x1
+    166b:	52                   	push   %edx
+    166c:	57                   	push   %edi
+    166d:	e8 b1 fc ff ff       	call   1323 <write>
+        ap++;
+    1672:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1675:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1678:	31 d2                	xor    %edx,%edx
+    167a:	e9 be fe ff ff       	jmp    153d <printf+0x4d>
+    167f:	90                   	nop
+  write(fd, &c, 1);
+    1680:	83 ec 04             	sub    $0x4,%esp
+    1683:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1686:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1689:	6a 01                	push   $0x1
+    168b:	e9 11 ff ff ff       	jmp    15a1 <printf+0xb1>
+    1690:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1695:	bb 5a 18 00 00       	mov    $0x185a,%ebx
+    169a:	e9 61 ff ff ff       	jmp    1600 <printf+0x110>
+    169f:	90                   	nop
+
+000016a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    16a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16a1:	a1 60 1b 00 00       	mov    0x1b60,%eax
+{
+    16a6:	89 e5                	mov    %esp,%ebp
+    16a8:	57                   	push   %edi
+    16a9:	56                   	push   %esi
+    16aa:	53                   	push   %ebx
+    16ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    16ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16bc:	39 ca                	cmp    %ecx,%edx
+    16be:	73 30                	jae    16f0 <free+0x50>
+    16c0:	39 c1                	cmp    %eax,%ecx
+    16c2:	72 04                	jb     16c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16c4:	39 c2                	cmp    %eax,%edx
+    16c6:	72 f0                	jb     16b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    16c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    16cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    16ce:	39 f8                	cmp    %edi,%eax
+    16d0:	74 2e                	je     1700 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    16d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    16d5:	8b 42 04             	mov    0x4(%edx),%eax
+    16d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    16db:	39 f1                	cmp    %esi,%ecx
+    16dd:	74 38                	je     1717 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    16df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    16e1:	5b                   	pop    %ebx
+  freep = p;
+    16e2:	89 15 60 1b 00 00    	mov    %edx,0x1b60
+}
+    16e8:	5e                   	pop    %esi
+    16e9:	5f                   	pop    %edi
+    16ea:	5d                   	pop    %ebp
+    16eb:	c3                   	ret
+    16ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16f0:	39 c1                	cmp    %eax,%ecx
+    16f2:	72 d0                	jb     16c4 <free+0x24>
+    16f4:	eb c2                	jmp    16b8 <free+0x18>
+    16f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1700:	03 70 04             	add    0x4(%eax),%esi
+    1703:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1706:	8b 02                	mov    (%edx),%eax
+    1708:	8b 00                	mov    (%eax),%eax
+    170a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    170d:	8b 42 04             	mov    0x4(%edx),%eax
+    1710:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1713:	39 f1                	cmp    %esi,%ecx
+    1715:	75 c8                	jne    16df <free+0x3f>
+    p->s.size += bp->s.size;
+    1717:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    171a:	89 15 60 1b 00 00    	mov    %edx,0x1b60
+    p->s.size += bp->s.size;
+    1720:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1723:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1726:	89 0a                	mov    %ecx,(%edx)
+}
+    1728:	5b                   	pop    %ebx
+    1729:	5e                   	pop    %esi
+    172a:	5f                   	pop    %edi
+    172b:	5d                   	pop    %ebp
+    172c:	c3                   	ret
+    172d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001730 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1730:	55                   	push   %ebp
+    1731:	89 e5                	mov    %esp,%ebp
+    1733:	57                   	push   %edi
+    1734:	56                   	push   %esi
+    1735:	53                   	push   %ebx
+    1736:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1739:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    173c:	8b 15 60 1b 00 00    	mov    0x1b60,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1742:	8d 78 07             	lea    0x7(%eax),%edi
+    1745:	c1 ef 03             	shr    $0x3,%edi
+    1748:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    174b:	85 d2                	test   %edx,%edx
+    174d:	0f 84 8d 00 00 00    	je     17e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1753:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1755:	8b 48 04             	mov    0x4(%eax),%ecx
+    1758:	39 f9                	cmp    %edi,%ecx
+    175a:	73 64                	jae    17c0 <malloc+0x90>
+  if(nu < 4096)
+    175c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1761:	39 df                	cmp    %ebx,%edi
+    1763:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1766:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    176d:	eb 0a                	jmp    1779 <malloc+0x49>
+    176f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1770:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1772:	8b 48 04             	mov    0x4(%eax),%ecx
+    1775:	39 f9                	cmp    %edi,%ecx
+    1777:	73 47                	jae    17c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1779:	89 c2                	mov    %eax,%edx
+    177b:	39 05 60 1b 00 00    	cmp    %eax,0x1b60
+    1781:	75 ed                	jne    1770 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1783:	83 ec 0c             	sub    $0xc,%esp
+    1786:	56                   	push   %esi
+    1787:	e8 ff fb ff ff       	call   138b <sbrk>
+  if(p == (char*)-1)
+    178c:	83 c4 10             	add    $0x10,%esp
+    178f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1792:	74 1c                	je     17b0 <malloc+0x80>
+  hp->s.size = nu;
+    1794:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1797:	83 ec 0c             	sub    $0xc,%esp
+    179a:	83 c0 08             	add    $0x8,%eax
+    179d:	50                   	push   %eax
+    179e:	e8 fd fe ff ff       	call   16a0 <free>
+  return freep;
+    17a3:	8b 15 60 1b 00 00    	mov    0x1b60,%edx
+      if((p = morecore(nunits)) == 0)
+    17a9:	83 c4 10             	add    $0x10,%esp
+    17ac:	85 d2                	test   %edx,%edx
+    17ae:	75 c0                	jne    1770 <malloc+0x40>
+        return 0;
+  }
+}
+    17b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    17b3:	31 c0                	xor    %eax,%eax
+}
+    17b5:	5b                   	pop    %ebx
+    17b6:	5e                   	pop    %esi
+    17b7:	5f                   	pop    %edi
+    17b8:	5d                   	pop    %ebp
+    17b9:	c3                   	ret
+    17ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    17c0:	39 cf                	cmp    %ecx,%edi
+    17c2:	74 4c                	je     1810 <malloc+0xe0>
+        p->s.size -= nunits;
+    17c4:	29 f9                	sub    %edi,%ecx
+    17c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    17c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    17cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    17cf:	89 15 60 1b 00 00    	mov    %edx,0x1b60
+}
+    17d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    17d8:	83 c0 08             	add    $0x8,%eax
+}
+    17db:	5b                   	pop    %ebx
+    17dc:	5e                   	pop    %esi
+    17dd:	5f                   	pop    %edi
+    17de:	5d                   	pop    %ebp
+    17df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    17e0:	c7 05 60 1b 00 00 64 	movl   $0x1b64,0x1b60
+    17e7:	1b 00 00 
+    base.s.size = 0;
+    17ea:	b8 64 1b 00 00       	mov    $0x1b64,%eax
+    base.s.ptr = freep = prevp = &base;
+    17ef:	c7 05 64 1b 00 00 64 	movl   $0x1b64,0x1b64
+    17f6:	1b 00 00 
+    base.s.size = 0;
+    17f9:	c7 05 68 1b 00 00 00 	movl   $0x0,0x1b68
+    1800:	00 00 00 
+    if(p->s.size >= nunits){
+    1803:	e9 54 ff ff ff       	jmp    175c <malloc+0x2c>
+    1808:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    180f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1810:	8b 08                	mov    (%eax),%ecx
+    1812:	89 0a                	mov    %ecx,(%edx)
+    1814:	eb b9                	jmp    17cf <malloc+0x9f>
@@ -0,0 +1,31 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+
+// Print how long a process, or with no argument every process,
+// has waited to run after becoming RUNNABLE: the number of waits
+// of 2^b to 2^(b+1) TSC cycles for each bucket b.
+
+int
+main(int argc, char *argv[])
+{
+	uint hist[NLATBUCKET];
+	int pid, b, n;
+
+	pid = argc > 1 ? atoi(argv[1]) : 0;
+	if(getlatency(pid, hist) < 0){
+		printf(2, "latency: no process %d\n", pid);
+		exit();
+	}
+
+	n = 0;
+	for(b = 0; b < NLATBUCKET; b++)
+		n += hist[b];
+	printf(1, "%d waits to run\n", n);
+	printf(1, "cycles\t\twaits\n");
+	for(b = 0; b < NLATBUCKET; b++)
+		if(hist[b])
+			printf(1, "2^%d\t\t%d\n", b, hist[b]);
+	exit();
+}
@@ -0,0 +1,2655 @@
+
+_lockbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+	       name, handoffs, handoffs ? (uint)(total >> 6) / handoffs * 64 : 0, worst);
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	51                   	push   %ecx
+    100e:	83 ec 0c             	sub    $0xc,%esp
+	bench("acquire_t", 1);
+    1011:	6a 01                	push   $0x1
+    1013:	68 ed 23 00 00       	push   $0x23ed
+    1018:	e8 23 01 00 00       	call   1140 <bench>
+	bench("lock_acquire", 0);
+    101d:	58                   	pop    %eax
+    101e:	5a                   	pop    %edx
+    101f:	6a 00                	push   $0x0
+    1021:	68 f7 23 00 00       	push   $0x23f7
+    1026:	e8 15 01 00 00       	call   1140 <bench>
+	exit();
+    102b:	e8 53 04 00 00       	call   1483 <exit>
+
+00001030 <worker>:
+{
+    1030:	55                   	push   %ebp
+    1031:	89 e5                	mov    %esp,%ebp
+    1033:	56                   	push   %esi
+    1034:	53                   	push   %ebx
+	int me = (int) self;
+    1035:	bb f4 01 00 00       	mov    $0x1f4,%ebx
+{
+    103a:	83 ec 10             	sub    $0x10,%esp
+    103d:	8b 75 08             	mov    0x8(%ebp),%esi
+		if(usekernel)
+    1040:	8b 15 a0 2a 00 00    	mov    0x2aa0,%edx
+    1046:	85 d2                	test   %edx,%edx
+    1048:	0f 84 da 00 00 00    	je     1128 <worker+0xf8>
+			acquire_t(&lock);
+    104e:	83 ec 0c             	sub    $0xc,%esp
+    1051:	68 a4 2a 00 00       	push   $0x2aa4
+    1056:	e8 00 05 00 00       	call   155b <acquire_t>
+    105b:	83 c4 10             	add    $0x10,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+    105e:	0f 31                	rdtsc
+    1060:	89 c1                	mov    %eax,%ecx
+		if(released && holder != me)
+    1062:	a1 98 2a 00 00       	mov    0x2a98,%eax
+    1067:	8b 15 9c 2a 00 00    	mov    0x2a9c,%edx
+    106d:	09 d0                	or     %edx,%eax
+    106f:	74 3f                	je     10b0 <worker+0x80>
+    1071:	a1 90 2a 00 00       	mov    0x2a90,%eax
+    1076:	39 f0                	cmp    %esi,%eax
+    1078:	74 36                	je     10b0 <worker+0x80>
+			d = now - released;
+    107a:	a1 98 2a 00 00       	mov    0x2a98,%eax
+    107f:	8b 15 9c 2a 00 00    	mov    0x2a9c,%edx
+			total += d;
+    1085:	31 d2                	xor    %edx,%edx
+			d = now - released;
+    1087:	29 c1                	sub    %eax,%ecx
+			total += d;
+    1089:	01 0d 88 2a 00 00    	add    %ecx,0x2a88
+    108f:	11 15 8c 2a 00 00    	adc    %edx,0x2a8c
+			handoffs++;
+    1095:	83 05 84 2a 00 00 01 	addl   $0x1,0x2a84
+			if(d > worst)
+    109c:	39 0d 80 2a 00 00    	cmp    %ecx,0x2a80
+    10a2:	73 0c                	jae    10b0 <worker+0x80>
+				worst = d;
+    10a4:	89 0d 80 2a 00 00    	mov    %ecx,0x2a80
+    10aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+		for(volatile int j = 0 ; j < 100 ; j++)
+    10b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    10b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10ba:	83 f8 63             	cmp    $0x63,%eax
+    10bd:	7f 12                	jg     10d1 <worker+0xa1>
+    10bf:	90                   	nop
+    10c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10c3:	83 c0 01             	add    $0x1,%eax
+    10c6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    10c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10cc:	83 f8 63             	cmp    $0x63,%eax
+    10cf:	7e ef                	jle    10c0 <worker+0x90>
+		holder = me;
+    10d1:	89 35 90 2a 00 00    	mov    %esi,0x2a90
+    10d7:	0f 31                	rdtsc
+		released = rdtsc();
+    10d9:	a3 98 2a 00 00       	mov    %eax,0x2a98
+		if(usekernel)
+    10de:	a1 a0 2a 00 00       	mov    0x2aa0,%eax
+		released = rdtsc();
+    10e3:	89 15 9c 2a 00 00    	mov    %edx,0x2a9c
+		if(usekernel)
+    10e9:	85 c0                	test   %eax,%eax
+    10eb:	74 23                	je     1110 <worker+0xe0>
+			release_t(&lock);
+    10ed:	83 ec 0c             	sub    $0xc,%esp
+    10f0:	68 a4 2a 00 00       	push   $0x2aa4
+    10f5:	e8 69 04 00 00       	call   1563 <release_t>
+    10fa:	83 c4 10             	add    $0x10,%esp
+	for(int i = 0 ; i < ROUNDS ; i++)
+    10fd:	83 eb 01             	sub    $0x1,%ebx
+    1100:	0f 85 3a ff ff ff    	jne    1040 <worker+0x10>
+	exit();
+    1106:	e8 78 03 00 00       	call   1483 <exit>
+    110b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    110f:	90                   	nop
+			lock_release(&lock);
+    1110:	83 ec 0c             	sub    $0xc,%esp
+    1113:	68 a4 2a 00 00       	push   $0x2aa4
+    1118:	e8 63 0f 00 00       	call   2080 <lock_release>
+    111d:	83 c4 10             	add    $0x10,%esp
+    1120:	eb db                	jmp    10fd <worker+0xcd>
+    1122:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+			lock_acquire(&lock);
+    1128:	83 ec 0c             	sub    $0xc,%esp
+    112b:	68 a4 2a 00 00       	push   $0x2aa4
+    1130:	e8 db 0e 00 00       	call   2010 <lock_acquire>
+    1135:	83 c4 10             	add    $0x10,%esp
+    1138:	e9 21 ff ff ff       	jmp    105e <worker+0x2e>
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001140 <bench>:
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	57                   	push   %edi
+    1144:	56                   	push   %esi
+    1145:	53                   	push   %ebx
+    1146:	83 ec 0c             	sub    $0xc,%esp
+    1149:	8b 45 0c             	mov    0xc(%ebp),%eax
+	usekernel = kernel;
+    114c:	a3 a0 2a 00 00       	mov    %eax,0x2aa0
+	if(kernel)
+    1151:	85 c0                	test   %eax,%eax
+    1153:	0f 84 c7 00 00 00    	je     1220 <bench+0xe0>
+		initlock_t(&lock);
+    1159:	83 ec 0c             	sub    $0xc,%esp
+    115c:	68 a4 2a 00 00       	push   $0x2aa4
+    1161:	e8 ed 03 00 00       	call   1553 <initlock_t>
+    1166:	83 c4 10             	add    $0x10,%esp
+	released = 0;
+    1169:	c7 05 98 2a 00 00 00 	movl   $0x0,0x2a98
+    1170:	00 00 00 
+	for(int i = 0 ; i < NTHREADS ; i++)
+    1173:	31 db                	xor    %ebx,%ebx
+	released = 0;
+    1175:	c7 05 9c 2a 00 00 00 	movl   $0x0,0x2a9c
+    117c:	00 00 00 
+	total = 0;
+    117f:	c7 05 88 2a 00 00 00 	movl   $0x0,0x2a88
+    1186:	00 00 00 
+    1189:	c7 05 8c 2a 00 00 00 	movl   $0x0,0x2a8c
+    1190:	00 00 00 
+	handoffs = worst = 0;
+    1193:	c7 05 80 2a 00 00 00 	movl   $0x0,0x2a80
+    119a:	00 00 00 
+    119d:	c7 05 84 2a 00 00 00 	movl   $0x0,0x2a84
+    11a4:	00 00 00 
+		thread_create(&worker, (void*) i, NULL);
+    11a7:	83 ec 04             	sub    $0x4,%esp
+    11aa:	6a 00                	push   $0x0
+    11ac:	53                   	push   %ebx
+	for(int i = 0 ; i < NTHREADS ; i++)
+    11ad:	83 c3 01             	add    $0x1,%ebx
+		thread_create(&worker, (void*) i, NULL);
+    11b0:	68 30 10 00 00       	push   $0x1030
+    11b5:	e8 86 09 00 00       	call   1b40 <thread_create>
+	for(int i = 0 ; i < NTHREADS ; i++)
+    11ba:	83 c4 10             	add    $0x10,%esp
+    11bd:	83 fb 04             	cmp    $0x4,%ebx
+    11c0:	75 e5                	jne    11a7 <bench+0x67>
+		thread_join();
+    11c2:	e8 b9 0b 00 00       	call   1d80 <thread_join>
+    11c7:	e8 b4 0b 00 00       	call   1d80 <thread_join>
+    11cc:	e8 af 0b 00 00       	call   1d80 <thread_join>
+    11d1:	e8 aa 0b 00 00       	call   1d80 <thread_join>
+	       name, handoffs, handoffs ? (uint)(total >> 6) / handoffs * 64 : 0, worst);
+    11d6:	8b 0d 84 2a 00 00    	mov    0x2a84,%ecx
+	printf(1, "%s: %d handoffs, average %d cycles, worst %d cycles\n",
+    11dc:	8b 1d 80 2a 00 00    	mov    0x2a80,%ebx
+    11e2:	31 c0                	xor    %eax,%eax
+    11e4:	85 c9                	test   %ecx,%ecx
+    11e6:	74 16                	je     11fe <bench+0xbe>
+	       name, handoffs, handoffs ? (uint)(total >> 6) / handoffs * 64 : 0, worst);
+    11e8:	8b 15 8c 2a 00 00    	mov    0x2a8c,%edx
+    11ee:	a1 88 2a 00 00       	mov    0x2a88,%eax
+    11f3:	0f ac d0 06          	shrd   $0x6,%edx,%eax
+    11f7:	31 d2                	xor    %edx,%edx
+    11f9:	f7 f1                	div    %ecx
+	printf(1, "%s: %d handoffs, average %d cycles, worst %d cycles\n",
+    11fb:	c1 e0 06             	shl    $0x6,%eax
+    11fe:	83 ec 08             	sub    $0x8,%esp
+    1201:	53                   	push   %ebx
+    1202:	50                   	push   %eax
+    1203:	51                   	push   %ecx
+    1204:	ff 75 08             	push   0x8(%ebp)
+    1207:	68 b8 23 00 00       	push   $0x23b8
+    120c:	6a 01                	push   $0x1
+    120e:	e8 5d 04 00 00       	call   1670 <printf>
+}
+    1213:	83 c4 20             	add    $0x20,%esp
+    1216:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1219:	5b                   	pop    %ebx
+    121a:	5e                   	pop    %esi
+    121b:	5f                   	pop    %edi
+    121c:	5d                   	pop    %ebp
+    121d:	c3                   	ret
+    121e:	66 90                	xchg   %ax,%ax
+		lock_init(&lock);
+    1220:	83 ec 0c             	sub    $0xc,%esp
+    1223:	68 a4 2a 00 00       	push   $0x2aa4
+    1228:	e8 c3 0d 00 00       	call   1ff0 <lock_init>
+    122d:	83 c4 10             	add    $0x10,%esp
+    1230:	e9 34 ff ff ff       	jmp    1169 <bench+0x29>
+    1235:	66 90                	xchg   %ax,%ax
+    1237:	66 90                	xchg   %ax,%ax
+    1239:	66 90                	xchg   %ax,%ax
+    123b:	66 90                	xchg   %ax,%ax
+    123d:	66 90                	xchg   %ax,%ax
+    123f:	90                   	nop
+
+00001240 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1240:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1241:	31 c0                	xor    %eax,%eax
+{
+    1243:	89 e5                	mov    %esp,%ebp
+    1245:	53                   	push   %ebx
+    1246:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1249:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    124c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1250:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1254:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1257:	83 c0 01             	add    $0x1,%eax
+    125a:	84 d2                	test   %dl,%dl
+    125c:	75 f2                	jne    1250 <strcpy+0x10>
+    ;
+  return os;
+}
+    125e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1261:	89 c8                	mov    %ecx,%eax
+    1263:	c9                   	leave
+    1264:	c3                   	ret
+    1265:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    126c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001270 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	53                   	push   %ebx
+    1274:	8b 55 08             	mov    0x8(%ebp),%edx
+    1277:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    127a:	0f b6 02             	movzbl (%edx),%eax
+    127d:	84 c0                	test   %al,%al
+    127f:	75 17                	jne    1298 <strcmp+0x28>
+    1281:	eb 3a                	jmp    12bd <strcmp+0x4d>
+    1283:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1287:	90                   	nop
+    1288:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    128c:	83 c2 01             	add    $0x1,%edx
+    128f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1292:	84 c0                	test   %al,%al
+    1294:	74 1a                	je     12b0 <strcmp+0x40>
+    p++, q++;
+    1296:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1298:	0f b6 19             	movzbl (%ecx),%ebx
+    129b:	38 c3                	cmp    %al,%bl
+    129d:	74 e9                	je     1288 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    129f:	29 d8                	sub    %ebx,%eax
+}
+    12a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12a4:	c9                   	leave
+    12a5:	c3                   	ret
+    12a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    12b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    12b4:	31 c0                	xor    %eax,%eax
+    12b6:	29 d8                	sub    %ebx,%eax
+}
+    12b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12bb:	c9                   	leave
+    12bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    12bd:	0f b6 19             	movzbl (%ecx),%ebx
+    12c0:	31 c0                	xor    %eax,%eax
+    12c2:	eb db                	jmp    129f <strcmp+0x2f>
+    12c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12cf:	90                   	nop
+
+000012d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    12d6:	80 3a 00             	cmpb   $0x0,(%edx)
+    12d9:	74 15                	je     12f0 <strlen+0x20>
+    12db:	31 c0                	xor    %eax,%eax
+    12dd:	8d 76 00             	lea    0x0(%esi),%esi
+    12e0:	83 c0 01             	add    $0x1,%eax
+    12e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    12e7:	89 c1                	mov    %eax,%ecx
+    12e9:	75 f5                	jne    12e0 <strlen+0x10>
+    ;
+  return n;
+}
+    12eb:	89 c8                	mov    %ecx,%eax
+    12ed:	5d                   	pop    %ebp
+    12ee:	c3                   	ret
+    12ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+    12f0:	31 c9                	xor    %ecx,%ecx
+}
+    12f2:	5d                   	pop    %ebp
+    12f3:	89 c8                	mov    %ecx,%eax
+    12f5:	c3                   	ret
+    12f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001300 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	57                   	push   %edi
+    1304:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+    1307:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    130a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    130d:	89 d7                	mov    %edx,%edi
+    130f:	fc                   	cld
+    1310:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1312:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1315:	89 d0                	mov    %edx,%eax
+    1317:	c9                   	leave
+    1318:	c3                   	ret
+    1319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001320 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	8b 45 08             	mov    0x8(%ebp),%eax
+    1326:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    132a:	0f b6 10             	movzbl (%eax),%edx
+    132d:	84 d2                	test   %dl,%dl
+    132f:	75 12                	jne    1343 <strchr+0x23>
+    1331:	eb 1d                	jmp    1350 <strchr+0x30>
+    1333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1337:	90                   	nop
+    1338:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    133c:	83 c0 01             	add    $0x1,%eax
+    133f:	84 d2                	test   %dl,%dl
+    1341:	74 0d                	je     1350 <strchr+0x30>
+    if(*s == c)
+    1343:	38 d1                	cmp    %dl,%cl
+    1345:	75 f1                	jne    1338 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1347:	5d                   	pop    %ebp
+    1348:	c3                   	ret
+    1349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1350:	31 c0                	xor    %eax,%eax
+}
+    1352:	5d                   	pop    %ebp
+    1353:	c3                   	ret
+    1354:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    135b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    135f:	90                   	nop
+
+00001360 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1360:	55                   	push   %ebp
+    1361:	89 e5                	mov    %esp,%ebp
+    1363:	57                   	push   %edi
+    1364:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1365:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1368:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1369:	31 db                	xor    %ebx,%ebx
+{
+    136b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    136e:	eb 27                	jmp    1397 <gets+0x37>
+    cc = read(0, &c, 1);
+    1370:	83 ec 04             	sub    $0x4,%esp
+    1373:	6a 01                	push   $0x1
+    1375:	56                   	push   %esi
+    1376:	6a 00                	push   $0x0
+    1378:	e8 1e 01 00 00       	call   149b <read>
+    if(cc < 1)
+    137d:	83 c4 10             	add    $0x10,%esp
+    1380:	85 c0                	test   %eax,%eax
+    1382:	7e 1d                	jle    13a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1384:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1388:	8b 55 08             	mov    0x8(%ebp),%edx
+    138b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    138f:	3c 0a                	cmp    $0xa,%al
+    1391:	74 10                	je     13a3 <gets+0x43>
+    1393:	3c 0d                	cmp    $0xd,%al
+    1395:	74 0c                	je     13a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1397:	89 df                	mov    %ebx,%edi
+    1399:	83 c3 01             	add    $0x1,%ebx
+    139c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    139f:	7c cf                	jl     1370 <gets+0x10>
+    13a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    13a3:	8b 45 08             	mov    0x8(%ebp),%eax
+    13a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    13aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13ad:	5b                   	pop    %ebx
+    13ae:	5e                   	pop    %esi
+    13af:	5f                   	pop    %edi
+    13b0:	5d                   	pop    %ebp
+    13b1:	c3                   	ret
+    13b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000013c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	56                   	push   %esi
+    13c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    13c5:	83 ec 08             	sub    $0x8,%esp
+    13c8:	6a 00                	push   $0x0
+    13ca:	ff 75 08             	push   0x8(%ebp)
+    13cd:	e8 f1 00 00 00       	call   14c3 <open>
+  if(fd < 0)
+    13d2:	83 c4 10             	add    $0x10,%esp
+    13d5:	85 c0                	test   %eax,%eax
+    13d7:	78 27                	js     1400 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    13d9:	83 ec 08             	sub    $0x8,%esp
+    13dc:	ff 75 0c             	push   0xc(%ebp)
+    13df:	89 c3                	mov    %eax,%ebx
+    13e1:	50                   	push   %eax
+    13e2:	e8 f4 00 00 00       	call   14db <fstat>
+  close(fd);
+    13e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    13ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+    13ec:	e8 ba 00 00 00       	call   14ab <close>
+  return r;
+    13f1:	83 c4 10             	add    $0x10,%esp
+}
+    13f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13f7:	89 f0                	mov    %esi,%eax
+    13f9:	5b                   	pop    %ebx
+    13fa:	5e                   	pop    %esi
+    13fb:	5d                   	pop    %ebp
+    13fc:	c3                   	ret
+    13fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1400:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1405:	eb ed                	jmp    13f4 <stat+0x34>
+    1407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    140e:	66 90                	xchg   %ax,%ax
+
+00001410 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1410:	55                   	push   %ebp
+    1411:	89 e5                	mov    %esp,%ebp
+    1413:	53                   	push   %ebx
+    1414:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1417:	0f be 02             	movsbl (%edx),%eax
+    141a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    141d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1420:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1425:	77 1e                	ja     1445 <atoi+0x35>
+    1427:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    142e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1430:	83 c2 01             	add    $0x1,%edx
+    1433:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1436:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    143a:	0f be 02             	movsbl (%edx),%eax
+    143d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1440:	80 fb 09             	cmp    $0x9,%bl
+    1443:	76 eb                	jbe    1430 <atoi+0x20>
+  return n;
+}
+    1445:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1448:	89 c8                	mov    %ecx,%eax
+    144a:	c9                   	leave
+    144b:	c3                   	ret
+    144c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001450 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1450:	55                   	push   %ebp
+    1451:	89 e5                	mov    %esp,%ebp
+    1453:	57                   	push   %edi
+    1454:	56                   	push   %esi
+    1455:	8b 45 10             	mov    0x10(%ebp),%eax
+    1458:	8b 55 08             	mov    0x8(%ebp),%edx
+    145b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    145e:	85 c0                	test   %eax,%eax
+    1460:	7e 13                	jle    1475 <memmove+0x25>
+    1462:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1464:	89 d7                	mov    %edx,%edi
+    1466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    146d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1470:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1471:	39 f8                	cmp    %edi,%eax
+    1473:	75 fb                	jne    1470 <memmove+0x20>
+  return vdst;
+}
+    1475:	5e                   	pop    %esi
+    1476:	89 d0                	mov    %edx,%eax
+    1478:	5f                   	pop    %edi
+    1479:	5d                   	pop    %ebp
+    147a:	c3                   	ret
+
+0000147b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    147b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1480:	cd 40                	int    $0x40
+    1482:	c3                   	ret
+
+00001483 <exit>:
+SYSCALL(exit)
+    1483:	b8 02 00 00 00       	mov    $0x2,%eax
+    1488:	cd 40                	int    $0x40
+    148a:	c3                   	ret
+
+0000148b <wait>:
+SYSCALL(wait)
+    148b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1490:	cd 40                	int    $0x40
+    1492:	c3                   	ret
+
+00001493 <pipe>:
+SYSCALL(pipe)
+    1493:	b8 04 00 00 00       	mov    $0x4,%eax
+    1498:	cd 40                	int    $0x40
+    149a:	c3                   	ret
+
+0000149b <read>:
+SYSCALL(read)
+    149b:	b8 05 00 00 00       	mov    $0x5,%eax
+    14a0:	cd 40                	int    $0x40
+    14a2:	c3                   	ret
+
+000014a3 <write>:
+SYSCALL(write)
+    14a3:	b8 10 00 00 00       	mov    $0x10,%eax
+    14a8:	cd 40                	int    $0x40
+    14aa:	c3                   	ret
+
+000014ab <close>:
+SYSCALL(close)
+    14ab:	b8 15 00 00 00       	mov    $0x15,%eax
+    14b0:	cd 40                	int    $0x40
+    14b2:	c3                   	ret
+
+000014b3 <kill>:
+SYSCALL(kill)
+    14b3:	b8 06 00 00 00       	mov    $0x6,%eax
+    14b8:	cd 40                	int    $0x40
+    14ba:	c3                   	ret
+
+000014bb <exec>:
+SYSCALL(exec)
+    14bb:	b8 07 00 00 00       	mov    $0x7,%eax
+    14c0:	cd 40                	int    $0x40
+    14c2:	c3                   	ret
+
+000014c3 <open>:
+SYSCALL(open)
+    14c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    14c8:	cd 40                	int    $0x40
+    14ca:	c3                   	ret
+
+000014cb <mknod>:
+SYSCALL(mknod)
+    14cb:	b8 11 00 00 00       	mov    $0x11,%eax
+    14d0:	cd 40                	int    $0x40
+    14d2:	c3                   	ret
+
+000014d3 <unlink>:
+SYSCALL(unlink)
+    14d3:	b8 12 00 00 00       	mov    $0x12,%eax
+    14d8:	cd 40                	int    $0x40
+    14da:	c3                   	ret
+
+000014db <fstat>:
+SYSCALL(fstat)
+    14db:	b8 08 00 00 00       	mov    $0x8,%eax
+    14e0:	cd 40                	int    $0x40
+    14e2:	c3                   	ret
+
+000014e3 <link>:
+SYSCALL(link)
+    14e3:	b8 13 00 00 00       	mov    $0x13,%eax
+    14e8:	cd 40                	int    $0x40
+    14ea:	c3                   	ret
+
+000014eb <mkdir>:
+SYSCALL(mkdir)
+    14eb:	b8 14 00 00 00       	mov    $0x14,%eax
+    14f0:	cd 40                	int    $0x40
+    14f2:	c3                   	ret
+
+000014f3 <chdir>:
+SYSCALL(chdir)
+    14f3:	b8 09 00 00 00       	mov    $0x9,%eax
+    14f8:	cd 40                	int    $0x40
+    14fa:	c3                   	ret
+
+000014fb <dup>:
+SYSCALL(dup)
+    14fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1500:	cd 40                	int    $0x40
+    1502:	c3                   	ret
+
+00001503 <getpid>:
+SYSCALL(getpid)
+    1503:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1508:	cd 40                	int    $0x40
+    150a:	c3                   	ret
+
+0000150b <sbrk>:
+SYSCALL(sbrk)
+    150b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1510:	cd 40                	int    $0x40
+    1512:	c3                   	ret
+
+00001513 <sleep>:
+SYSCALL(sleep)
+    1513:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1518:	cd 40                	int    $0x40
+    151a:	c3                   	ret
+
+0000151b <uptime>:
+SYSCALL(uptime)
+    151b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1520:	cd 40                	int    $0x40
+    1522:	c3                   	ret
+
+00001523 <settickets>:
+SYSCALL(settickets)
+    1523:	b8 16 00 00 00       	mov    $0x16,%eax
+    1528:	cd 40                	int    $0x40
+    152a:	c3                   	ret
+
+0000152b <getpinfo>:
+SYSCALL(getpinfo)
+    152b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1530:	cd 40                	int    $0x40
+    1532:	c3                   	ret
+
+00001533 <mprotect>:
+SYSCALL(mprotect)
+    1533:	b8 18 00 00 00       	mov    $0x18,%eax
+    1538:	cd 40                	int    $0x40
+    153a:	c3                   	ret
+
+0000153b <munprotect>:
+SYSCALL(munprotect)
+    153b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1540:	cd 40                	int    $0x40
+    1542:	c3                   	ret
+
+00001543 <clone>:
+SYSCALL(clone)
+    1543:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1548:	cd 40                	int    $0x40
+    154a:	c3                   	ret
+
+0000154b <join>:
+SYSCALL(join)
+    154b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1550:	cd 40                	int    $0x40
+    1552:	c3                   	ret
+
+00001553 <initlock_t>:
+SYSCALL(initlock_t)
+    1553:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1558:	cd 40                	int    $0x40
+    155a:	c3                   	ret
+
+0000155b <acquire_t>:
+SYSCALL(acquire_t)
+    155b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1560:	cd 40                	int    $0x40
+    1562:	c3                   	ret
+
+00001563 <release_t>:
+SYSCALL(release_t)
+    1563:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1568:	cd 40                	int    $0x40
+    156a:	c3                   	ret
+
+0000156b <setsched>:
+SYSCALL(setsched)
+    156b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1570:	cd 40                	int    $0x40
+    1572:	c3                   	ret
+
+00001573 <mkgroup>:
+SYSCALL(mkgroup)
+    1573:	b8 20 00 00 00       	mov    $0x20,%eax
+    1578:	cd 40                	int    $0x40
+    157a:	c3                   	ret
+
+0000157b <joingroup>:
+SYSCALL(joingroup)
+    157b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1580:	cd 40                	int    $0x40
+    1582:	c3                   	ret
+
+00001583 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1583:	b8 22 00 00 00       	mov    $0x22,%eax
+    1588:	cd 40                	int    $0x40
+    158a:	c3                   	ret
+
+0000158b <setdeadline>:
+SYSCALL(setdeadline)
+    158b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1590:	cd 40                	int    $0x40
+    1592:	c3                   	ret
+
+00001593 <setaffinity>:
+SYSCALL(setaffinity)
+    1593:	b8 24 00 00 00       	mov    $0x24,%eax
+    1598:	cd 40                	int    $0x40
+    159a:	c3                   	ret
+
+0000159b <yield_to>:
+SYSCALL(yield_to)
+    159b:	b8 25 00 00 00       	mov    $0x25,%eax
+    15a0:	cd 40                	int    $0x40
+    15a2:	c3                   	ret
+
+000015a3 <getlatency>:
+SYSCALL(getlatency)
+    15a3:	b8 26 00 00 00       	mov    $0x26,%eax
+    15a8:	cd 40                	int    $0x40
+    15aa:	c3                   	ret
+
+000015ab <futex_wait>:
+SYSCALL(futex_wait)
+    15ab:	b8 27 00 00 00       	mov    $0x27,%eax
+    15b0:	cd 40                	int    $0x40
+    15b2:	c3                   	ret
+
+000015b3 <futex_wake>:
+SYSCALL(futex_wake)
+    15b3:	b8 28 00 00 00       	mov    $0x28,%eax
+    15b8:	cd 40                	int    $0x40
+    15ba:	c3                   	ret
+
+000015bb <mguard>:
+SYSCALL(mguard)
+    15bb:	b8 29 00 00 00       	mov    $0x29,%eax
+    15c0:	cd 40                	int    $0x40
+    15c2:	c3                   	ret
+
+000015c3 <join_any>:
+SYSCALL(join_any)
+    15c3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    15c8:	cd 40                	int    $0x40
+    15ca:	c3                   	ret
+    15cb:	66 90                	xchg   %ax,%ax
+    15cd:	66 90                	xchg   %ax,%ax
+    15cf:	90                   	nop
+
+000015d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    15d0:	55                   	push   %ebp
+    15d1:	89 e5                	mov    %esp,%ebp
+    15d3:	57                   	push   %edi
+    15d4:	56                   	push   %esi
+    15d5:	53                   	push   %ebx
+    15d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    15d8:	89 d1                	mov    %edx,%ecx
+{
+    15da:	83 ec 3c             	sub    $0x3c,%esp
+    15dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    15e0:	85 d2                	test   %edx,%edx
+    15e2:	0f 89 80 00 00 00    	jns    1668 <printint+0x98>
+    15e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    15ec:	74 7a                	je     1668 <printint+0x98>
+    x = -xx;
+    15ee:	f7 d9                	neg    %ecx
+    neg = 1;
+    15f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    15f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    15f8:	31 f6                	xor    %esi,%esi
+    15fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1600:	89 c8                	mov    %ecx,%eax
+    1602:	31 d2                	xor    %edx,%edx
+    1604:	89 f7                	mov    %esi,%edi
+    1606:	f7 f3                	div    %ebx
+    1608:	8d 76 01             	lea    0x1(%esi),%esi
+    160b:	0f b6 92 64 24 00 00 	movzbl 0x2464(%edx),%edx
+    1612:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1616:	89 ca                	mov    %ecx,%edx
+    1618:	89 c1                	mov    %eax,%ecx
+    161a:	39 da                	cmp    %ebx,%edx
+    161c:	73 e2                	jae    1600 <printint+0x30>
+  if(neg)
+    161e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1621:	85 c0                	test   %eax,%eax
+    1623:	74 07                	je     162c <printint+0x5c>
+    buf[i++] = '-';
+    1625:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    162a:	89 f7                	mov    %esi,%edi
+    162c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    162f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1632:	01 df                	add    %ebx,%edi
+    1634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1638:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    163b:	83 ec 04             	sub    $0x4,%esp
+    163e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1641:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1644:	6a 01                	push   $0x1
+    1646:	50                   	push   %eax
+    1647:	56                   	push   %esi
+    1648:	e8 56 fe ff ff       	call   14a3 <write>
+  while(--i >= 0)
+    164d:	89 f8                	mov    %edi,%eax
+    164f:	83 c4 10             	add    $0x10,%esp
+    1652:	83 ef 01             	sub    $0x1,%edi
+    1655:	39 d8                	cmp    %ebx,%eax
+    1657:	75 df                	jne    1638 <printint+0x68>
+}
+    1659:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    165c:	5b                   	pop    %ebx
+    165d:	5e                   	pop    %esi
+    165e:	5f                   	pop    %edi
+    165f:	5d                   	pop    %ebp
+    1660:	c3                   	ret
+    1661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1668:	31 c0                	xor    %eax,%eax
+    166a:	eb 89                	jmp    15f5 <printint+0x25>
+    166c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001670 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1670:	55                   	push   %ebp
+    1671:	89 e5                	mov    %esp,%ebp
+    1673:	57                   	push   %edi
+    1674:	56                   	push   %esi
+    1675:	53                   	push   %ebx
+    1676:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1679:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    167c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    167f:	0f b6 1e             	movzbl (%esi),%ebx
+    1682:	83 c6 01             	add    $0x1,%esi
+    1685:	84 db                	test   %bl,%bl
+    1687:	74 67                	je     16f0 <printf+0x80>
+    1689:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    168c:	31 d2                	xor    %edx,%edx
+    168e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1691:	eb 34                	jmp    16c7 <printf+0x57>
+    1693:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1697:	90                   	nop
+    1698:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    169b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    16a0:	83 f8 25             	cmp    $0x25,%eax
+    16a3:	74 18                	je     16bd <printf+0x4d>
+  write(fd, &c, 1);
+    16a5:	83 ec 04             	sub    $0x4,%esp
+    16a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    16ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    16ae:	6a 01                	push   $0x1
+    16b0:	50                   	push   %eax
+    16b1:	57                   	push   %edi
+    16b2:	e8 ec fd ff ff       	call   14a3 <write>
+    16b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    16ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    16bd:	0f b6 1e             	movzbl (%esi),%ebx
+    16c0:	83 c6 01             	add    $0x1,%esi
+    16c3:	84 db                	test   %bl,%bl
+    16c5:	74 29                	je     16f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    16c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    16ca:	85 d2                	test   %edx,%edx
+    16cc:	74 ca                	je     1698 <printf+0x28>
+      }
+    } else if(state == '%'){
+    16ce:	83 fa 25             	cmp    $0x25,%edx
+    16d1:	75 ea                	jne    16bd <printf+0x4d>
+      if(c == 'd'){
+    16d3:	83 f8 25             	cmp    $0x25,%eax
+    16d6:	0f 84 24 01 00 00    	je     1800 <printf+0x190>
+    16dc:	83 e8 63             	sub    $0x63,%eax
+    16df:	83 f8 15             	cmp    $0x15,%eax
+    16e2:	77 1c                	ja     1700 <printf+0x90>
+    16e4:	ff 24 85 0c 24 00 00 	jmp    *0x240c(,%eax,4)
+    16eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    16ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    16f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16f3:	5b                   	pop    %ebx
+    16f4:	5e                   	pop    %esi
+    16f5:	5f                   	pop    %edi
+    16f6:	5d                   	pop    %ebp
+    16f7:	c3                   	ret
+    16f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16ff:	90                   	nop
+  write(fd, &c, 1);
+    1700:	83 ec 04             	sub    $0x4,%esp
+    1703:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1706:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    170a:	6a 01                	push   $0x1
+    170c:	52                   	push   %edx
+    170d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1710:	57                   	push   %edi
+    1711:	e8 8d fd ff ff       	call   14a3 <write>
+    1716:	83 c4 0c             	add    $0xc,%esp
+    1719:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    171c:	6a 01                	push   $0x1
+    171e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1721:	52                   	push   %edx
+    1722:	57                   	push   %edi
+    1723:	e8 7b fd ff ff       	call   14a3 <write>
+        putc(fd, c);
+    1728:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    172b:	31 d2                	xor    %edx,%edx
+    172d:	eb 8e                	jmp    16bd <printf+0x4d>
+    172f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1730:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1733:	83 ec 0c             	sub    $0xc,%esp
+    1736:	b9 10 00 00 00       	mov    $0x10,%ecx
+    173b:	8b 13                	mov    (%ebx),%edx
+    173d:	6a 00                	push   $0x0
+    173f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1741:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1744:	e8 87 fe ff ff       	call   15d0 <printint>
+        ap++;
+    1749:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    174c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    174f:	31 d2                	xor    %edx,%edx
+    1751:	e9 67 ff ff ff       	jmp    16bd <printf+0x4d>
+    1756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    175d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1760:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1763:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1765:	83 c0 04             	add    $0x4,%eax
+    1768:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    176b:	85 db                	test   %ebx,%ebx
+    176d:	0f 84 9d 00 00 00    	je     1810 <printf+0x1a0>
+        while(*s != 0){
+    1773:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1776:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1778:	84 c0                	test   %al,%al
+    177a:	0f 84 3d ff ff ff    	je     16bd <printf+0x4d>
+    1780:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1783:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1786:	89 de                	mov    %ebx,%esi
+    1788:	89 d3                	mov    %edx,%ebx
+    178a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1790:	83 ec 04             	sub    $0x4,%esp
+    1793:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1796:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1799:	6a 01                	push   $0x1
+    179b:	53                   	push   %ebx
+    179c:	57                   	push   %edi
+    179d:	e8 01 fd ff ff       	call   14a3 <write>
+        while(*s != 0){
+    17a2:	0f b6 06             	movzbl (%esi),%eax
+    17a5:	83 c4 10             	add    $0x10,%esp
+    17a8:	84 c0                	test   %al,%al
+    17aa:	75 e4                	jne    1790 <printf+0x120>
+      state = 0;
+    17ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    17af:	31 d2                	xor    %edx,%edx
+    17b1:	e9 07 ff ff ff       	jmp    16bd <printf+0x4d>
+    17b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    17c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    17c3:	83 ec 0c             	sub    $0xc,%esp
+    17c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    17cb:	8b 13                	mov    (%ebx),%edx
+    17cd:	6a 01                	push   $0x1
+    17cf:	e9 6b ff ff ff       	jmp    173f <printf+0xcf>
+    17d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    17d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    17db:	83 ec 04             	sub    $0x4,%esp
+    17de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    17e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    17e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    17e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    17e9:	6a 01                	push   $0x1
+    17eb:	52                   	push   %edx
+    17ec:	57                   	push   %edi
+    17ed:	e8 b1 fc ff ff       	call   14a3 <write>
+        ap++;
+    17f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    17f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    17f8:	31 d2                	xor    %edx,%edx
+    17fa:	e9 be fe ff ff       	jmp    16bd <printf+0x4d>
+    17ff:	90                   	nop
+  write(fd, &c, 1);
+    1800:	83 ec 04             	sub    $0x4,%esp
+    1803:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1806:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1809:	6a 01                	push   $0x1
+    180b:	e9 11 ff ff ff       	jmp    1721 <printf+0xb1>
+    1810:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1815:	bb 04 24 00 00       	mov    $0x2404,%ebx
+    181a:	e9 61 ff ff ff       	jmp    1780 <printf+0x110>
+    181f:	90                   	nop
+
+00001820 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1820:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1821:	a1 b0 2a 00 00       	mov    0x2ab0,%eax
+{
+    1826:	89 e5                	mov    %esp,%ebp
+    1828:	57                   	push   %edi
+    1829:	56                   	push   %esi
+    182a:	53                   	push   %ebx
+    182b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    182e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1838:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    183a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    183c:	39 ca                	cmp    %ecx,%edx
+    183e:	73 30                	jae    1870 <free+0x50>
+    1840:	39 c1                	cmp    %eax,%ecx
+    1842:	72 04                	jb     1848 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1844:	39 c2                	cmp    %eax,%edx
+    1846:	72 f0                	jb     1838 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1848:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    184b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    184e:	39 f8                	cmp    %edi,%eax
+    1850:	74 2e                	je     1880 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1852:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1855:	8b 42 04             	mov    0x4(%edx),%eax
+    1858:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    185b:	39 f1                	cmp    %esi,%ecx
+    185d:	74 38                	je     1897 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    185f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1861:	5b                   	pop    %ebx
+  freep = p;
+    1862:	89 15 b0 2a 00 00    	mov    %edx,0x2ab0
+}
+    1868:	5e                   	pop    %esi
+    1869:	5f                   	pop    %edi
+    186a:	5d                   	pop    %ebp
+    186b:	c3                   	ret
+    186c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1870:	39 c1                	cmp    %eax,%ecx
+    1872:	72 d0                	jb     1844 <free+0x24>
+    1874:	eb c2                	jmp    1838 <free+0x18>
+    1876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    187d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1880:	03 70 04             	add    0x4(%eax),%esi
+    1883:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1886:	8b 02                	mov    (%edx),%eax
+    1888:	8b 00                	mov    (%eax),%eax
+    188a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    188d:	8b 42 04             	mov    0x4(%edx),%eax
+    1890:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1893:	39 f1                	cmp    %esi,%ecx
+    1895:	75 c8                	jne    185f <free+0x3f>
+    p->s.size += bp->s.size;
+    1897:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    189a:	89 15 b0 2a 00 00    	mov    %edx,0x2ab0
+    p->s.size += bp->s.size;
+    18a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    18a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    18a6:	89 0a                	mov    %ecx,(%edx)
+}
+    18a8:	5b                   	pop    %ebx
+    18a9:	5e                   	pop    %esi
+    18aa:	5f                   	pop    %edi
+    18ab:	5d                   	pop    %ebp
+    18ac:	c3                   	ret
+    18ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000018b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    18b0:	55                   	push   %ebp
+    18b1:	89 e5                	mov    %esp,%ebp
+    18b3:	57                   	push   %edi
+    18b4:	56                   	push   %esi
+    18b5:	53                   	push   %ebx
+    18b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    18b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    18bc:	8b 15 b0 2a 00 00    	mov    0x2ab0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    18c2:	8d 78 07             	lea    0x7(%eax),%edi
+    18c5:	c1 ef 03             	shr    $0x3,%edi
+    18c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    18cb:	85 d2                	test   %edx,%edx
+    18cd:	0f 84 8d 00 00 00    	je     1960 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    18d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    18d5:	8b 48 04             	mov    0x4(%eax),%ecx
+    18d8:	39 f9                	cmp    %edi,%ecx
+    18da:	73 64                	jae    1940 <malloc+0x90>
+  if(nu < 4096)
+    18dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    18e1:	39 df                	cmp    %ebx,%edi
+    18e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    18e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    18ed:	eb 0a                	jmp    18f9 <malloc+0x49>
+    18ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    18f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    18f2:	8b 48 04             	mov    0x4(%eax),%ecx
+    18f5:	39 f9                	cmp    %edi,%ecx
+    18f7:	73 47                	jae    1940 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    18f9:	89 c2                	mov    %eax,%edx
+    18fb:	39 05 b0 2a 00 00    	cmp    %eax,0x2ab0
+    1901:	75 ed                	jne    18f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1903:	83 ec 0c             	sub    $0xc,%esp
+    1906:	56                   	push   %esi
+    1907:	e8 ff fb ff ff       	call   150b <sbrk>
+  if(p == (char*)-1)
+    190c:	83 c4 10             	add    $0x10,%esp
+    190f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1912:	74 1c                	je     1930 <malloc+0x80>
+  hp->s.size = nu;
+    1914:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1917:	83 ec 0c             	sub    $0xc,%esp
+    191a:	83 c0 08             	add    $0x8,%eax
+    191d:	50                   	push   %eax
+    191e:	e8 fd fe ff ff       	call   1820 <free>
+  return freep;
+    1923:	8b 15 b0 2a 00 00    	mov    0x2ab0,%edx
+      if((p = morecore(nunits)) == 0)
+    1929:	83 c4 10             	add    $0x10,%esp
+    192c:	85 d2                	test   %edx,%edx
+    192e:	75 c0                	jne    18f0 <malloc+0x40>
+        return 0;
+  }
+}
+    1930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1933:	31 c0                	xor    %eax,%eax
+}
+    1935:	5b                   	pop    %ebx
+    1936:	5e                   	pop    %esi
+    1937:	5f                   	pop    %edi
+    1938:	5d                   	pop    %ebp
+    1939:	c3                   	ret
+    193a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1940:	39 cf                	cmp    %ecx,%edi
+    1942:	74 4c                	je     1990 <malloc+0xe0>
+        p->s.size -= nunits;
+    1944:	29 f9                	sub    %edi,%ecx
+    1946:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1949:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    194c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    194f:	89 15 b0 2a 00 00    	mov    %edx,0x2ab0
+}
+    1955:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1958:	83 c0 08             	add    $0x8,%eax
+}
+    195b:	5b                   	pop    %ebx
+    195c:	5e                   	pop    %esi
+    195d:	5f                   	pop    %edi
+    195e:	5d                   	pop    %ebp
+    195f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1960:	c7 05 b0 2a 00 00 b4 	movl   $0x2ab4,0x2ab0
+    1967:	2a 00 00 
+    base.s.size = 0;
+    196a:	b8 b4 2a 00 00       	mov    $0x2ab4,%eax
+    base.s.ptr = freep = prevp = &base;
+    196f:	c7 05 b4 2a 00 00 b4 	movl   $0x2ab4,0x2ab4
+    1976:	2a 00 00 
+    base.s.size = 0;
+    1979:	c7 05 b8 2a 00 00 00 	movl   $0x0,0x2ab8
+    1980:	00 00 00 
+    if(p->s.size >= nunits){
+    1983:	e9 54 ff ff ff       	jmp    18dc <malloc+0x2c>
+    1988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    198f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1990:	8b 08                	mov    (%eax),%ecx
+    1992:	89 0a                	mov    %ecx,(%edx)
+    1994:	eb b9                	jmp    194f <malloc+0x9f>
+    1996:	66 90                	xchg   %ax,%ax
+    1998:	66 90                	xchg   %ax,%ax
+    199a:	66 90                	xchg   %ax,%ax
+    199c:	66 90                	xchg   %ax,%ax
+    199e:	66 90                	xchg   %ax,%ax
+
+000019a0 <stack_alloc>:
+
+static struct ticketlock stacklock;
+static void *stackpool;
+
+static void *stack_alloc(void)
+{
+    19a0:	55                   	push   %ebp
+    19a1:	89 e5                	mov    %esp,%ebp
+    19a3:	57                   	push   %edi
+    19a4:	56                   	push   %esi
+    19a5:	53                   	push   %ebx
+  asm volatile("lock; xaddl %0, %1"
+    19a6:	bb 01 00 00 00       	mov    $0x1,%ebx
+    19ab:	83 ec 5c             	sub    $0x5c,%esp
+    19ae:	f0 0f c1 1d c4 2b 00 	lock xadd %ebx,0x2bc4
+    19b5:	00 
+#define NTURNWAIT 64
+static int turnwait[NTURNWAIT];
+
+static int *turnslot(struct ticketlock *lock, int ticket)
+{
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    19b6:	b8 c4 2b 00 00       	mov    $0x2bc4,%eax
+    19bb:	c1 e8 02             	shr    $0x2,%eax
+    19be:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    19c1:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+    19c4:	83 e6 3f             	and    $0x3f,%esi
+    int myTicket = fetch_and_add(&lock->next_ticket, 1);
+    int *w = turnslot(lock, myTicket);
+    int seq;
+
+    for(;;){
+        seq = *(volatile int*)w;
+    19c7:	8b 04 b5 c0 2a 00 00 	mov    0x2ac0(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    19ce:	8b 15 c8 2b 00 00    	mov    0x2bc8,%edx
+    19d4:	8d 3c b5 c0 2a 00 00 	lea    0x2ac0(,%esi,4),%edi
+    19db:	39 d3                	cmp    %edx,%ebx
+    19dd:	74 1f                	je     19fe <stack_alloc+0x5e>
+    19df:	90                   	nop
+            break;
+        futex_wait(w, seq);
+    19e0:	83 ec 08             	sub    $0x8,%esp
+    19e3:	50                   	push   %eax
+    19e4:	57                   	push   %edi
+    19e5:	e8 c1 fb ff ff       	call   15ab <futex_wait>
+        seq = *(volatile int*)w;
+    19ea:	8b 04 b5 c0 2a 00 00 	mov    0x2ac0(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    19f1:	83 c4 10             	add    $0x10,%esp
+    19f4:	8b 15 c8 2b 00 00    	mov    0x2bc8,%edx
+    19fa:	39 d3                	cmp    %edx,%ebx
+    19fc:	75 e2                	jne    19e0 <stack_alloc+0x40>
+	if(stackpool == 0){
+    19fe:	8b 35 c0 2b 00 00    	mov    0x2bc0,%esi
+    1a04:	85 f6                	test   %esi,%esi
+    1a06:	74 68                	je     1a70 <stack_alloc+0xd0>
+		stackpool = *(void**)p;
+    1a08:	8b 06                	mov    (%esi),%eax
+    1a0a:	a3 c0 2b 00 00       	mov    %eax,0x2bc0
+    1a0f:	ba 01 00 00 00       	mov    $0x1,%edx
+    1a14:	89 d0                	mov    %edx,%eax
+    1a16:	f0 0f c1 05 c8 2b 00 	lock xadd %eax,0x2bc8
+    1a1d:	00 
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    int *w;
+
+    // Only bump and wake the next ticket's word if someone
+    // holds that ticket; it may or may not be asleep yet.
+    if (turn != *(volatile int*)&lock->next_ticket){
+    1a1e:	8b 0d c4 2b 00 00    	mov    0x2bc4,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    1a24:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    1a27:	39 c8                	cmp    %ecx,%eax
+    1a29:	75 0d                	jne    1a38 <stack_alloc+0x98>
+}
+    1a2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a2e:	89 f0                	mov    %esi,%eax
+    1a30:	5b                   	pop    %ebx
+    1a31:	5e                   	pop    %esi
+    1a32:	5f                   	pop    %edi
+    1a33:	5d                   	pop    %ebp
+    1a34:	c3                   	ret
+    1a35:	8d 76 00             	lea    0x0(%esi),%esi
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1a38:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+    1a3b:	01 c8                	add    %ecx,%eax
+    1a3d:	83 e0 3f             	and    $0x3f,%eax
+    1a40:	8d 0c 85 c0 2a 00 00 	lea    0x2ac0(,%eax,4),%ecx
+    1a47:	f0 0f c1 14 85 c0 2a 	lock xadd %edx,0x2ac0(,%eax,4)
+    1a4e:	00 00 
+        w = turnslot(lock, turn);
+        fetch_and_add(w, 1);
+        futex_wake(w, NPROC);
+    1a50:	83 ec 08             	sub    $0x8,%esp
+    1a53:	68 00 04 00 00       	push   $0x400
+    1a58:	51                   	push   %ecx
+    1a59:	e8 55 fb ff ff       	call   15b3 <futex_wake>
+    1a5e:	83 c4 10             	add    $0x10,%esp
+}
+    1a61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a64:	89 f0                	mov    %esi,%eax
+    1a66:	5b                   	pop    %ebx
+    1a67:	5e                   	pop    %esi
+    1a68:	5f                   	pop    %edi
+    1a69:	5d                   	pop    %ebp
+    1a6a:	c3                   	ret
+    1a6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a6f:	90                   	nop
+		n = join_any(pids, stacks, NREAP, JOIN_NOHANG | JOIN_DETACHED);
+    1a70:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+    1a73:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    1a76:	6a 03                	push   $0x3
+    1a78:	6a 08                	push   $0x8
+    1a7a:	53                   	push   %ebx
+    1a7b:	50                   	push   %eax
+    1a7c:	e8 42 fb ff ff       	call   15c3 <join_any>
+		for(i = 0; i < n; i++){
+    1a81:	8b 35 c0 2b 00 00    	mov    0x2bc0,%esi
+    1a87:	83 c4 10             	add    $0x10,%esp
+    1a8a:	89 da                	mov    %ebx,%edx
+    1a8c:	8d 0c 83             	lea    (%ebx,%eax,4),%ecx
+    1a8f:	85 c0                	test   %eax,%eax
+    1a91:	7e 19                	jle    1aac <stack_alloc+0x10c>
+    1a93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a97:	90                   	nop
+			*(void**)stacks[i] = stackpool;
+    1a98:	8b 02                	mov    (%edx),%eax
+		for(i = 0; i < n; i++){
+    1a9a:	83 c2 04             	add    $0x4,%edx
+			*(void**)stacks[i] = stackpool;
+    1a9d:	89 30                	mov    %esi,(%eax)
+			stackpool = stacks[i];
+    1a9f:	8b 72 fc             	mov    -0x4(%edx),%esi
+		for(i = 0; i < n; i++){
+    1aa2:	39 ca                	cmp    %ecx,%edx
+    1aa4:	75 f2                	jne    1a98 <stack_alloc+0xf8>
+    1aa6:	89 35 c0 2b 00 00    	mov    %esi,0x2bc0
+	if((p = stackpool) != 0){
+    1aac:	85 f6                	test   %esi,%esi
+    1aae:	0f 85 54 ff ff ff    	jne    1a08 <stack_alloc+0x68>
+	if((p = sbrk((TSTACKPAGES + 2) * PGSIZE)) == (char*)-1){
+    1ab4:	83 ec 0c             	sub    $0xc,%esp
+    1ab7:	68 00 60 00 00       	push   $0x6000
+    1abc:	e8 4a fa ff ff       	call   150b <sbrk>
+    1ac1:	83 c4 10             	add    $0x10,%esp
+    1ac4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1ac7:	0f 84 42 ff ff ff    	je     1a0f <stack_alloc+0x6f>
+	p += (PGSIZE - (uint)p % PGSIZE) % PGSIZE;
+    1acd:	89 c2                	mov    %eax,%edx
+	mguard(p, 1);
+    1acf:	83 ec 08             	sub    $0x8,%esp
+	p += (PGSIZE - (uint)p % PGSIZE) % PGSIZE;
+    1ad2:	f7 da                	neg    %edx
+	mguard(p, 1);
+    1ad4:	6a 01                	push   $0x1
+	p += (PGSIZE - (uint)p % PGSIZE) % PGSIZE;
+    1ad6:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+    1adc:	8d 34 10             	lea    (%eax,%edx,1),%esi
+	mguard(p, 1);
+    1adf:	56                   	push   %esi
+    1ae0:	e8 d6 fa ff ff       	call   15bb <mguard>
+    1ae5:	ba 01 00 00 00       	mov    $0x1,%edx
+    1aea:	89 d0                	mov    %edx,%eax
+    1aec:	f0 0f c1 05 c8 2b 00 	lock xadd %eax,0x2bc8
+    1af3:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    1af4:	8b 0d c4 2b 00 00    	mov    0x2bc4,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    1afa:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    1afd:	83 c4 10             	add    $0x10,%esp
+    1b00:	39 c8                	cmp    %ecx,%eax
+    1b02:	74 29                	je     1b2d <stack_alloc+0x18d>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1b04:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+    1b07:	01 c8                	add    %ecx,%eax
+    1b09:	83 e0 3f             	and    $0x3f,%eax
+    1b0c:	8d 0c 85 c0 2a 00 00 	lea    0x2ac0(,%eax,4),%ecx
+    1b13:	f0 0f c1 14 85 c0 2a 	lock xadd %edx,0x2ac0(,%eax,4)
+    1b1a:	00 00 
+        futex_wake(w, NPROC);
+    1b1c:	83 ec 08             	sub    $0x8,%esp
+    1b1f:	68 00 04 00 00       	push   $0x400
+    1b24:	51                   	push   %ecx
+    1b25:	e8 89 fa ff ff       	call   15b3 <futex_wake>
+    1b2a:	83 c4 10             	add    $0x10,%esp
+}
+    1b2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+	return p + TSTACKPAGES * PGSIZE;
+    1b30:	81 c6 00 40 00 00    	add    $0x4000,%esi
+}
+    1b36:	5b                   	pop    %ebx
+    1b37:	89 f0                	mov    %esi,%eax
+    1b39:	5e                   	pop    %esi
+    1b3a:	5f                   	pop    %edi
+    1b3b:	5d                   	pop    %ebp
+    1b3c:	c3                   	ret
+    1b3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001b40 <thread_create>:
+{
+    1b40:	55                   	push   %ebp
+    1b41:	89 e5                	mov    %esp,%ebp
+    1b43:	57                   	push   %edi
+    1b44:	56                   	push   %esi
+    1b45:	53                   	push   %ebx
+    1b46:	83 ec 1c             	sub    $0x1c,%esp
+	void *stack = stack_alloc();
+    1b49:	e8 52 fe ff ff       	call   19a0 <stack_alloc>
+	if(stack == 0)
+    1b4e:	85 c0                	test   %eax,%eax
+    1b50:	0f 84 f6 00 00 00    	je     1c4c <thread_create+0x10c>
+	if((pid = clone(start_routine, arg1, arg2, stack, flags | CLONE_FILES | CLONE_FS)) < 0)
+    1b56:	83 ec 0c             	sub    $0xc,%esp
+    1b59:	89 c3                	mov    %eax,%ebx
+    1b5b:	6a 06                	push   $0x6
+    1b5d:	50                   	push   %eax
+    1b5e:	ff 75 10             	push   0x10(%ebp)
+    1b61:	ff 75 0c             	push   0xc(%ebp)
+    1b64:	ff 75 08             	push   0x8(%ebp)
+    1b67:	e8 d7 f9 ff ff       	call   1543 <clone>
+    1b6c:	83 c4 20             	add    $0x20,%esp
+    1b6f:	89 c6                	mov    %eax,%esi
+    1b71:	85 c0                	test   %eax,%eax
+    1b73:	78 0b                	js     1b80 <thread_create+0x40>
+}
+    1b75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b78:	89 f0                	mov    %esi,%eax
+    1b7a:	5b                   	pop    %ebx
+    1b7b:	5e                   	pop    %esi
+    1b7c:	5f                   	pop    %edi
+    1b7d:	5d                   	pop    %ebp
+    1b7e:	c3                   	ret
+    1b7f:	90                   	nop
+    1b80:	bf 01 00 00 00       	mov    $0x1,%edi
+    1b85:	f0 0f c1 3d c4 2b 00 	lock xadd %edi,0x2bc4
+    1b8c:	00 
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1b8d:	b8 c4 2b 00 00       	mov    $0x2bc4,%eax
+    1b92:	c1 e8 02             	shr    $0x2,%eax
+    1b95:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+    1b98:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    1b9b:	83 e1 3f             	and    $0x3f,%ecx
+    1b9e:	8d 04 8d c0 2a 00 00 	lea    0x2ac0(,%ecx,4),%eax
+    1ba5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        seq = *(volatile int*)w;
+    1ba8:	8b 04 8d c0 2a 00 00 	mov    0x2ac0(,%ecx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    1baf:	8b 15 c8 2b 00 00    	mov    0x2bc8,%edx
+    1bb5:	39 fa                	cmp    %edi,%edx
+    1bb7:	74 33                	je     1bec <thread_create+0xac>
+    1bb9:	89 75 dc             	mov    %esi,-0x24(%ebp)
+    1bbc:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1bbf:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+    1bc2:	89 cb                	mov    %ecx,%ebx
+    1bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(w, seq);
+    1bc8:	83 ec 08             	sub    $0x8,%esp
+    1bcb:	50                   	push   %eax
+    1bcc:	56                   	push   %esi
+    1bcd:	e8 d9 f9 ff ff       	call   15ab <futex_wait>
+        seq = *(volatile int*)w;
+    1bd2:	8b 04 9d c0 2a 00 00 	mov    0x2ac0(,%ebx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    1bd9:	83 c4 10             	add    $0x10,%esp
+    1bdc:	8b 15 c8 2b 00 00    	mov    0x2bc8,%edx
+    1be2:	39 d7                	cmp    %edx,%edi
+    1be4:	75 e2                	jne    1bc8 <thread_create+0x88>
+    1be6:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1be9:	8b 75 dc             	mov    -0x24(%ebp),%esi
+	*(void**)stack = stackpool;
+    1bec:	a1 c0 2b 00 00       	mov    0x2bc0,%eax
+    1bf1:	ba 01 00 00 00       	mov    $0x1,%edx
+	stackpool = stack;
+    1bf6:	89 1d c0 2b 00 00    	mov    %ebx,0x2bc0
+	*(void**)stack = stackpool;
+    1bfc:	89 03                	mov    %eax,(%ebx)
+    1bfe:	89 d0                	mov    %edx,%eax
+    1c00:	f0 0f c1 05 c8 2b 00 	lock xadd %eax,0x2bc8
+    1c07:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    1c08:	8b 0d c4 2b 00 00    	mov    0x2bc4,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    1c0e:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    1c11:	39 c8                	cmp    %ecx,%eax
+    1c13:	0f 84 5c ff ff ff    	je     1b75 <thread_create+0x35>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1c19:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+    1c1c:	01 c8                	add    %ecx,%eax
+    1c1e:	83 e0 3f             	and    $0x3f,%eax
+    1c21:	8d 0c 85 c0 2a 00 00 	lea    0x2ac0(,%eax,4),%ecx
+    1c28:	f0 0f c1 14 85 c0 2a 	lock xadd %edx,0x2ac0(,%eax,4)
+    1c2f:	00 00 
+        futex_wake(w, NPROC);
+    1c31:	83 ec 08             	sub    $0x8,%esp
+    1c34:	68 00 04 00 00       	push   $0x400
+    1c39:	51                   	push   %ecx
+    1c3a:	e8 74 f9 ff ff       	call   15b3 <futex_wake>
+    1c3f:	83 c4 10             	add    $0x10,%esp
+}
+    1c42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c45:	89 f0                	mov    %esi,%eax
+    1c47:	5b                   	pop    %ebx
+    1c48:	5e                   	pop    %esi
+    1c49:	5f                   	pop    %edi
+    1c4a:	5d                   	pop    %ebp
+    1c4b:	c3                   	ret
+		return -1;
+    1c4c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+	return thread_clone(start_routine, arg1, arg2, 0);
+    1c51:	e9 1f ff ff ff       	jmp    1b75 <thread_create+0x35>
+    1c56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001c60 <thread_create_detached>:
+{
+    1c60:	55                   	push   %ebp
+    1c61:	89 e5                	mov    %esp,%ebp
+    1c63:	57                   	push   %edi
+    1c64:	56                   	push   %esi
+    1c65:	53                   	push   %ebx
+    1c66:	83 ec 1c             	sub    $0x1c,%esp
+	void *stack = stack_alloc();
+    1c69:	e8 32 fd ff ff       	call   19a0 <stack_alloc>
+	if(stack == 0)
+    1c6e:	85 c0                	test   %eax,%eax
+    1c70:	0f 84 f6 00 00 00    	je     1d6c <thread_create_detached+0x10c>
+	if((pid = clone(start_routine, arg1, arg2, stack, flags | CLONE_FILES | CLONE_FS)) < 0)
+    1c76:	83 ec 0c             	sub    $0xc,%esp
+    1c79:	89 c3                	mov    %eax,%ebx
+    1c7b:	6a 07                	push   $0x7
+    1c7d:	50                   	push   %eax
+    1c7e:	ff 75 10             	push   0x10(%ebp)
+    1c81:	ff 75 0c             	push   0xc(%ebp)
+    1c84:	ff 75 08             	push   0x8(%ebp)
+    1c87:	e8 b7 f8 ff ff       	call   1543 <clone>
+    1c8c:	83 c4 20             	add    $0x20,%esp
+    1c8f:	89 c6                	mov    %eax,%esi
+    1c91:	85 c0                	test   %eax,%eax
+    1c93:	78 0b                	js     1ca0 <thread_create_detached+0x40>
+}
+    1c95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c98:	89 f0                	mov    %esi,%eax
+    1c9a:	5b                   	pop    %ebx
+    1c9b:	5e                   	pop    %esi
+    1c9c:	5f                   	pop    %edi
+    1c9d:	5d                   	pop    %ebp
+    1c9e:	c3                   	ret
+    1c9f:	90                   	nop
+    1ca0:	bf 01 00 00 00       	mov    $0x1,%edi
+    1ca5:	f0 0f c1 3d c4 2b 00 	lock xadd %edi,0x2bc4
+    1cac:	00 
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1cad:	b8 c4 2b 00 00       	mov    $0x2bc4,%eax
+    1cb2:	c1 e8 02             	shr    $0x2,%eax
+    1cb5:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+    1cb8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    1cbb:	83 e1 3f             	and    $0x3f,%ecx
+    1cbe:	8d 04 8d c0 2a 00 00 	lea    0x2ac0(,%ecx,4),%eax
+    1cc5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        seq = *(volatile int*)w;
+    1cc8:	8b 04 8d c0 2a 00 00 	mov    0x2ac0(,%ecx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    1ccf:	8b 15 c8 2b 00 00    	mov    0x2bc8,%edx
+    1cd5:	39 fa                	cmp    %edi,%edx
+    1cd7:	74 33                	je     1d0c <thread_create_detached+0xac>
+    1cd9:	89 75 dc             	mov    %esi,-0x24(%ebp)
+    1cdc:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1cdf:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+    1ce2:	89 cb                	mov    %ecx,%ebx
+    1ce4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(w, seq);
+    1ce8:	83 ec 08             	sub    $0x8,%esp
+    1ceb:	50                   	push   %eax
+    1cec:	56                   	push   %esi
+    1ced:	e8 b9 f8 ff ff       	call   15ab <futex_wait>
+        seq = *(volatile int*)w;
+    1cf2:	8b 04 9d c0 2a 00 00 	mov    0x2ac0(,%ebx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    1cf9:	83 c4 10             	add    $0x10,%esp
+    1cfc:	8b 15 c8 2b 00 00    	mov    0x2bc8,%edx
+    1d02:	39 d7                	cmp    %edx,%edi
+    1d04:	75 e2                	jne    1ce8 <thread_create_detached+0x88>
+    1d06:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1d09:	8b 75 dc             	mov    -0x24(%ebp),%esi
+	*(void**)stack = stackpool;
+    1d0c:	a1 c0 2b 00 00       	mov    0x2bc0,%eax
+    1d11:	ba 01 00 00 00       	mov    $0x1,%edx
+	stackpool = stack;
+    1d16:	89 1d c0 2b 00 00    	mov    %ebx,0x2bc0
+	*(void**)stack = stackpool;
+    1d1c:	89 03                	mov    %eax,(%ebx)
+    1d1e:	89 d0                	mov    %edx,%eax
+    1d20:	f0 0f c1 05 c8 2b 00 	lock xadd %eax,0x2bc8
+    1d27:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    1d28:	8b 0d c4 2b 00 00    	mov    0x2bc4,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    1d2e:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    1d31:	39 c8                	cmp    %ecx,%eax
+    1d33:	0f 84 5c ff ff ff    	je     1c95 <thread_create_detached+0x35>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1d39:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+    1d3c:	01 c8                	add    %ecx,%eax
+    1d3e:	83 e0 3f             	and    $0x3f,%eax
+    1d41:	8d 0c 85 c0 2a 00 00 	lea    0x2ac0(,%eax,4),%ecx
+    1d48:	f0 0f c1 14 85 c0 2a 	lock xadd %edx,0x2ac0(,%eax,4)
+    1d4f:	00 00 
+        futex_wake(w, NPROC);
+    1d51:	83 ec 08             	sub    $0x8,%esp
+    1d54:	68 00 04 00 00       	push   $0x400
+    1d59:	51                   	push   %ecx
+    1d5a:	e8 54 f8 ff ff       	call   15b3 <futex_wake>
+    1d5f:	83 c4 10             	add    $0x10,%esp
+}
+    1d62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d65:	89 f0                	mov    %esi,%eax
+    1d67:	5b                   	pop    %ebx
+    1d68:	5e                   	pop    %esi
+    1d69:	5f                   	pop    %edi
+    1d6a:	5d                   	pop    %ebp
+    1d6b:	c3                   	ret
+		return -1;
+    1d6c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+	return thread_clone(start_routine, arg1, arg2, CLONE_DETACHED);
+    1d71:	e9 1f ff ff ff       	jmp    1c95 <thread_create_detached+0x35>
+    1d76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001d80 <thread_join>:
+{
+    1d80:	55                   	push   %ebp
+    1d81:	89 e5                	mov    %esp,%ebp
+    1d83:	57                   	push   %edi
+    1d84:	56                   	push   %esi
+  	int result = join(&stack);	
+    1d85:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+{
+    1d88:	53                   	push   %ebx
+    1d89:	83 ec 38             	sub    $0x38,%esp
+  	int result = join(&stack);	
+    1d8c:	50                   	push   %eax
+    1d8d:	e8 b9 f7 ff ff       	call   154b <join>
+  	if(result > 0 && stack)
+    1d92:	83 c4 10             	add    $0x10,%esp
+  	int result = join(&stack);	
+    1d95:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  	if(result > 0 && stack)
+    1d98:	85 c0                	test   %eax,%eax
+    1d9a:	0f 8e 92 00 00 00    	jle    1e32 <thread_join+0xb2>
+    1da0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1da3:	85 c9                	test   %ecx,%ecx
+    1da5:	0f 84 87 00 00 00    	je     1e32 <thread_join+0xb2>
+    1dab:	be 01 00 00 00       	mov    $0x1,%esi
+    1db0:	f0 0f c1 35 c4 2b 00 	lock xadd %esi,0x2bc4
+    1db7:	00 
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1db8:	b8 c4 2b 00 00       	mov    $0x2bc4,%eax
+    1dbd:	c1 e8 02             	shr    $0x2,%eax
+    1dc0:	8d 3c 06             	lea    (%esi,%eax,1),%edi
+    1dc3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    1dc6:	83 e7 3f             	and    $0x3f,%edi
+        seq = *(volatile int*)w;
+    1dc9:	8b 04 bd c0 2a 00 00 	mov    0x2ac0(,%edi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    1dd0:	8b 15 c8 2b 00 00    	mov    0x2bc8,%edx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1dd6:	8d 1c bd c0 2a 00 00 	lea    0x2ac0(,%edi,4),%ebx
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    1ddd:	39 f2                	cmp    %esi,%edx
+    1ddf:	74 28                	je     1e09 <thread_join+0x89>
+    1de1:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1de4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(w, seq);
+    1de8:	83 ec 08             	sub    $0x8,%esp
+    1deb:	50                   	push   %eax
+    1dec:	53                   	push   %ebx
+    1ded:	e8 b9 f7 ff ff       	call   15ab <futex_wait>
+        seq = *(volatile int*)w;
+    1df2:	8b 04 bd c0 2a 00 00 	mov    0x2ac0(,%edi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    1df9:	83 c4 10             	add    $0x10,%esp
+    1dfc:	8b 15 c8 2b 00 00    	mov    0x2bc8,%edx
+    1e02:	39 d6                	cmp    %edx,%esi
+    1e04:	75 e2                	jne    1de8 <thread_join+0x68>
+    1e06:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+	*(void**)stack = stackpool;
+    1e09:	a1 c0 2b 00 00       	mov    0x2bc0,%eax
+    1e0e:	ba 01 00 00 00       	mov    $0x1,%edx
+	stackpool = stack;
+    1e13:	89 0d c0 2b 00 00    	mov    %ecx,0x2bc0
+	*(void**)stack = stackpool;
+    1e19:	89 01                	mov    %eax,(%ecx)
+    1e1b:	89 d0                	mov    %edx,%eax
+    1e1d:	f0 0f c1 05 c8 2b 00 	lock xadd %eax,0x2bc8
+    1e24:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    1e25:	8b 0d c4 2b 00 00    	mov    0x2bc4,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    1e2b:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    1e2e:	39 c8                	cmp    %ecx,%eax
+    1e30:	75 0e                	jne    1e40 <thread_join+0xc0>
+}
+    1e32:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1e35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e38:	5b                   	pop    %ebx
+    1e39:	5e                   	pop    %esi
+    1e3a:	5f                   	pop    %edi
+    1e3b:	5d                   	pop    %ebp
+    1e3c:	c3                   	ret
+    1e3d:	8d 76 00             	lea    0x0(%esi),%esi
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1e40:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+    1e43:	01 c8                	add    %ecx,%eax
+    1e45:	83 e0 3f             	and    $0x3f,%eax
+    1e48:	8d 0c 85 c0 2a 00 00 	lea    0x2ac0(,%eax,4),%ecx
+    1e4f:	f0 0f c1 14 85 c0 2a 	lock xadd %edx,0x2ac0(,%eax,4)
+    1e56:	00 00 
+        futex_wake(w, NPROC);
+    1e58:	83 ec 08             	sub    $0x8,%esp
+    1e5b:	68 00 04 00 00       	push   $0x400
+    1e60:	51                   	push   %ecx
+    1e61:	e8 4d f7 ff ff       	call   15b3 <futex_wake>
+}
+    1e66:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+        futex_wake(w, NPROC);
+    1e69:	83 c4 10             	add    $0x10,%esp
+}
+    1e6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e6f:	5b                   	pop    %ebx
+    1e70:	5e                   	pop    %esi
+    1e71:	5f                   	pop    %edi
+    1e72:	5d                   	pop    %ebp
+    1e73:	c3                   	ret
+    1e74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e7f:	90                   	nop
+
+00001e80 <thread_join_many>:
+{
+    1e80:	55                   	push   %ebp
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1e81:	b8 c4 2b 00 00       	mov    $0x2bc4,%eax
+    1e86:	c1 e8 02             	shr    $0x2,%eax
+{
+    1e89:	89 e5                	mov    %esp,%ebp
+    1e8b:	57                   	push   %edi
+    1e8c:	56                   	push   %esi
+    1e8d:	53                   	push   %ebx
+    1e8e:	83 ec 6c             	sub    $0x6c,%esp
+    1e91:	8b 55 0c             	mov    0xc(%ebp),%edx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1e94:	89 45 9c             	mov    %eax,-0x64(%ebp)
+		if((r = join_any(got, stacks, n < NREAP ? n : NREAP, 0)) < 0)
+    1e97:	b8 08 00 00 00       	mov    $0x8,%eax
+    1e9c:	39 c2                	cmp    %eax,%edx
+    1e9e:	0f 4e c2             	cmovle %edx,%eax
+    1ea1:	89 c3                	mov    %eax,%ebx
+    1ea3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1ea7:	90                   	nop
+    1ea8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    1eab:	6a 00                	push   $0x0
+    1ead:	53                   	push   %ebx
+    1eae:	50                   	push   %eax
+    1eaf:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1eb2:	50                   	push   %eax
+    1eb3:	e8 0b f7 ff ff       	call   15c3 <join_any>
+    1eb8:	83 c4 10             	add    $0x10,%esp
+    1ebb:	89 45 94             	mov    %eax,-0x6c(%ebp)
+    1ebe:	85 c0                	test   %eax,%eax
+    1ec0:	0f 88 11 01 00 00    	js     1fd7 <thread_join_many+0x157>
+		for(i = 0; i < r; i++){
+    1ec6:	74 e0                	je     1ea8 <thread_join_many+0x28>
+    1ec8:	c7 45 98 00 00 00 00 	movl   $0x0,-0x68(%ebp)
+    1ecf:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+    1ed6:	89 5d 90             	mov    %ebx,-0x70(%ebp)
+    1ed9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+			if(got[i] != 0)
+    1ee0:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    1ee3:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    1ee7:	85 c0                	test   %eax,%eax
+    1ee9:	74 0f                	je     1efa <thread_join_many+0x7a>
+				pids[k++] = got[i];
+    1eeb:	8b 4d 98             	mov    -0x68(%ebp),%ecx
+    1eee:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1ef1:	89 04 8f             	mov    %eax,(%edi,%ecx,4)
+    1ef4:	8d 41 01             	lea    0x1(%ecx),%eax
+    1ef7:	89 45 98             	mov    %eax,-0x68(%ebp)
+			stack_free(stacks[i]);
+    1efa:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    1efd:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1f02:	8b 4c 85 a8          	mov    -0x58(%ebp,%eax,4),%ecx
+    1f06:	f0 0f c1 1d c4 2b 00 	lock xadd %ebx,0x2bc4
+    1f0d:	00 
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1f0e:	8b 45 9c             	mov    -0x64(%ebp),%eax
+    1f11:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    1f14:	83 e6 3f             	and    $0x3f,%esi
+        seq = *(volatile int*)w;
+    1f17:	8b 04 b5 c0 2a 00 00 	mov    0x2ac0(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    1f1e:	8b 15 c8 2b 00 00    	mov    0x2bc8,%edx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1f24:	8d 3c b5 c0 2a 00 00 	lea    0x2ac0(,%esi,4),%edi
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    1f2b:	39 da                	cmp    %ebx,%edx
+    1f2d:	74 2a                	je     1f59 <thread_join_many+0xd9>
+    1f2f:	89 4d a0             	mov    %ecx,-0x60(%ebp)
+    1f32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        futex_wait(w, seq);
+    1f38:	83 ec 08             	sub    $0x8,%esp
+    1f3b:	50                   	push   %eax
+    1f3c:	57                   	push   %edi
+    1f3d:	e8 69 f6 ff ff       	call   15ab <futex_wait>
+        seq = *(volatile int*)w;
+    1f42:	8b 04 b5 c0 2a 00 00 	mov    0x2ac0(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    1f49:	83 c4 10             	add    $0x10,%esp
+    1f4c:	8b 15 c8 2b 00 00    	mov    0x2bc8,%edx
+    1f52:	39 d3                	cmp    %edx,%ebx
+    1f54:	75 e2                	jne    1f38 <thread_join_many+0xb8>
+    1f56:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+	*(void**)stack = stackpool;
+    1f59:	a1 c0 2b 00 00       	mov    0x2bc0,%eax
+	stackpool = stack;
+    1f5e:	89 0d c0 2b 00 00    	mov    %ecx,0x2bc0
+	*(void**)stack = stackpool;
+    1f64:	89 01                	mov    %eax,(%ecx)
+    1f66:	b8 01 00 00 00       	mov    $0x1,%eax
+    1f6b:	f0 0f c1 05 c8 2b 00 	lock xadd %eax,0x2bc8
+    1f72:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    1f73:	8b 15 c4 2b 00 00    	mov    0x2bc4,%edx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    1f79:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    1f7c:	39 d0                	cmp    %edx,%eax
+    1f7e:	74 2e                	je     1fae <thread_join_many+0x12e>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    1f80:	8b 4d 9c             	mov    -0x64(%ebp),%ecx
+    1f83:	ba 01 00 00 00       	mov    $0x1,%edx
+    1f88:	01 c8                	add    %ecx,%eax
+    1f8a:	83 e0 3f             	and    $0x3f,%eax
+    1f8d:	8d 0c 85 c0 2a 00 00 	lea    0x2ac0(,%eax,4),%ecx
+    1f94:	f0 0f c1 14 85 c0 2a 	lock xadd %edx,0x2ac0(,%eax,4)
+    1f9b:	00 00 
+        futex_wake(w, NPROC);
+    1f9d:	83 ec 08             	sub    $0x8,%esp
+    1fa0:	68 00 04 00 00       	push   $0x400
+    1fa5:	51                   	push   %ecx
+    1fa6:	e8 08 f6 ff ff       	call   15b3 <futex_wake>
+    1fab:	83 c4 10             	add    $0x10,%esp
+		for(i = 0; i < r; i++){
+    1fae:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+    1fb2:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    1fb5:	39 45 94             	cmp    %eax,-0x6c(%ebp)
+    1fb8:	0f 85 22 ff ff ff    	jne    1ee0 <thread_join_many+0x60>
+	for(k = 0; k == 0; ){
+    1fbe:	8b 45 98             	mov    -0x68(%ebp),%eax
+    1fc1:	8b 5d 90             	mov    -0x70(%ebp),%ebx
+    1fc4:	85 c0                	test   %eax,%eax
+    1fc6:	0f 84 dc fe ff ff    	je     1ea8 <thread_join_many+0x28>
+}
+    1fcc:	8b 45 98             	mov    -0x68(%ebp),%eax
+    1fcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1fd2:	5b                   	pop    %ebx
+    1fd3:	5e                   	pop    %esi
+    1fd4:	5f                   	pop    %edi
+    1fd5:	5d                   	pop    %ebp
+    1fd6:	c3                   	ret
+			return -1;
+    1fd7:	c7 45 98 ff ff ff ff 	movl   $0xffffffff,-0x68(%ebp)
+}
+    1fde:	8b 45 98             	mov    -0x68(%ebp),%eax
+    1fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1fe4:	5b                   	pop    %ebx
+    1fe5:	5e                   	pop    %esi
+    1fe6:	5f                   	pop    %edi
+    1fe7:	5d                   	pop    %ebp
+    1fe8:	c3                   	ret
+    1fe9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001ff0 <lock_init>:
+{
+    1ff0:	55                   	push   %ebp
+    1ff1:	89 e5                	mov    %esp,%ebp
+    1ff3:	8b 45 08             	mov    0x8(%ebp),%eax
+    lock->next_ticket = 0;
+    1ff6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    lock->current_turn = 0;
+    1ffc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+    lock->pid = 0;
+    2003:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+    200a:	5d                   	pop    %ebp
+    200b:	c3                   	ret
+    200c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002010 <lock_acquire>:
+{
+    2010:	55                   	push   %ebp
+    2011:	89 e5                	mov    %esp,%ebp
+    2013:	57                   	push   %edi
+    2014:	56                   	push   %esi
+    2015:	be 01 00 00 00       	mov    $0x1,%esi
+    201a:	53                   	push   %ebx
+    201b:	83 ec 1c             	sub    $0x1c,%esp
+    201e:	8b 7d 08             	mov    0x8(%ebp),%edi
+    2021:	f0 0f c1 37          	lock xadd %esi,(%edi)
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2025:	89 fb                	mov    %edi,%ebx
+    2027:	c1 eb 02             	shr    $0x2,%ebx
+    202a:	01 f3                	add    %esi,%ebx
+    202c:	83 e3 3f             	and    $0x3f,%ebx
+    202f:	8d 04 9d c0 2a 00 00 	lea    0x2ac0(,%ebx,4),%eax
+    2036:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        seq = *(volatile int*)w;
+    2039:	8b 04 9d c0 2a 00 00 	mov    0x2ac0(,%ebx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2040:	8b 57 04             	mov    0x4(%edi),%edx
+    2043:	39 d6                	cmp    %edx,%esi
+    2045:	74 26                	je     206d <lock_acquire+0x5d>
+    2047:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    204e:	66 90                	xchg   %ax,%ax
+        futex_wait(w, seq);
+    2050:	83 ec 08             	sub    $0x8,%esp
+    2053:	50                   	push   %eax
+    2054:	ff 75 e4             	push   -0x1c(%ebp)
+    2057:	e8 4f f5 ff ff       	call   15ab <futex_wait>
+        seq = *(volatile int*)w;
+    205c:	8b 04 9d c0 2a 00 00 	mov    0x2ac0(,%ebx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2063:	8b 57 04             	mov    0x4(%edi),%edx
+    2066:	83 c4 10             	add    $0x10,%esp
+    2069:	39 f2                	cmp    %esi,%edx
+    206b:	75 e3                	jne    2050 <lock_acquire+0x40>
+}
+    206d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2070:	5b                   	pop    %ebx
+    2071:	5e                   	pop    %esi
+    2072:	5f                   	pop    %edi
+    2073:	5d                   	pop    %ebp
+    2074:	c3                   	ret
+    2075:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    207c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002080 <lock_release>:
+{
+    2080:	55                   	push   %ebp
+    2081:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2086:	89 ca                	mov    %ecx,%edx
+    2088:	89 e5                	mov    %esp,%ebp
+    208a:	53                   	push   %ebx
+    208b:	83 ec 04             	sub    $0x4,%esp
+    208e:	8b 45 08             	mov    0x8(%ebp),%eax
+    2091:	f0 0f c1 50 04       	lock xadd %edx,0x4(%eax)
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2096:	8b 18                	mov    (%eax),%ebx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    2098:	83 c2 01             	add    $0x1,%edx
+    if (turn != *(volatile int*)&lock->next_ticket){
+    209b:	39 d3                	cmp    %edx,%ebx
+    209d:	74 29                	je     20c8 <lock_release+0x48>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    209f:	c1 e8 02             	shr    $0x2,%eax
+    20a2:	01 d0                	add    %edx,%eax
+    20a4:	83 e0 3f             	and    $0x3f,%eax
+    20a7:	8d 14 85 c0 2a 00 00 	lea    0x2ac0(,%eax,4),%edx
+    20ae:	f0 0f c1 0c 85 c0 2a 	lock xadd %ecx,0x2ac0(,%eax,4)
+    20b5:	00 00 
+        futex_wake(w, NPROC);
+    20b7:	83 ec 08             	sub    $0x8,%esp
+    20ba:	68 00 04 00 00       	push   $0x400
+    20bf:	52                   	push   %edx
+    20c0:	e8 ee f4 ff ff       	call   15b3 <futex_wake>
+    20c5:	83 c4 10             	add    $0x10,%esp
+    }
+}
+    20c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    20cb:	c9                   	leave
+    20cc:	c3                   	ret
+    20cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000020d0 <rw_rdlock>:
+    fetch_and_add(nwait, -1);
+}
+
+// reader-writer lock
+void rw_rdlock(struct rwlock *rw)
+{
+    20d0:	55                   	push   %ebp
+    20d1:	89 e5                	mov    %esp,%ebp
+    20d3:	57                   	push   %edi
+    20d4:	bf 01 00 00 00       	mov    $0x1,%edi
+    20d9:	56                   	push   %esi
+    20da:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    20df:	53                   	push   %ebx
+    20e0:	83 ec 0c             	sub    $0xc,%esp
+    20e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    20e6:	eb 23                	jmp    210b <rw_rdlock+0x3b>
+    20e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20ef:	90                   	nop
+    20f0:	89 f8                	mov    %edi,%eax
+    20f2:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+    futex_wait(addr, val);
+    20f7:	83 ec 08             	sub    $0x8,%esp
+    20fa:	52                   	push   %edx
+    20fb:	53                   	push   %ebx
+    20fc:	e8 aa f4 ff ff       	call   15ab <futex_wait>
+    2101:	89 f0                	mov    %esi,%eax
+    2103:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+    2108:	83 c4 10             	add    $0x10,%esp
+    int s;
+
+    for(;;){
+        s = *(volatile int*)&rw->state;
+    210b:	8b 13                	mov    (%ebx),%edx
+        if(s >= 0 && *(volatile int*)&rw->wwait == 0 && cas(&rw->state, s, s + 1))
+    210d:	85 d2                	test   %edx,%edx
+    210f:	78 df                	js     20f0 <rw_rdlock+0x20>
+    2111:	8b 43 04             	mov    0x4(%ebx),%eax
+    2114:	85 c0                	test   %eax,%eax
+    2116:	75 d8                	jne    20f0 <rw_rdlock+0x20>
+    2118:	8d 4a 01             	lea    0x1(%edx),%ecx
+static inline int
+cas(volatile int *addr, int old, int newval)
+{
+  uchar ok;
+
+  asm volatile("lock; cmpxchgl %3, %1; sete %0" :
+    211b:	89 d0                	mov    %edx,%eax
+    211d:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    2121:	0f 94 c1             	sete   %cl
+    2124:	84 c9                	test   %cl,%cl
+    2126:	74 c8                	je     20f0 <rw_rdlock+0x20>
+            return;
+        futex_sleep(&rw->state, s, &rw->nwait);
+    }
+}
+    2128:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    212b:	5b                   	pop    %ebx
+    212c:	5e                   	pop    %esi
+    212d:	5f                   	pop    %edi
+    212e:	5d                   	pop    %ebp
+    212f:	c3                   	ret
+
+00002130 <rw_wrlock>:
+
+void rw_wrlock(struct rwlock *rw)
+{
+    2130:	55                   	push   %ebp
+  asm volatile("lock; xaddl %0, %1"
+    2131:	b8 01 00 00 00       	mov    $0x1,%eax
+    2136:	89 e5                	mov    %esp,%ebp
+    2138:	57                   	push   %edi
+    2139:	56                   	push   %esi
+    213a:	53                   	push   %ebx
+    213b:	83 ec 0c             	sub    $0xc,%esp
+    213e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    2141:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+  asm volatile("lock; cmpxchgl %3, %1; sete %0" :
+    2146:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    214b:	31 ff                	xor    %edi,%edi
+  return value;
+    214d:	eb 07                	jmp    2156 <rw_wrlock+0x26>
+    214f:	90                   	nop
+    int s;
+
+    fetch_and_add(&rw->wwait, 1);
+    while(!cas(&rw->state, 0, -1)){
+        if((s = *(volatile int*)&rw->state) != 0)
+    2150:	8b 03                	mov    (%ebx),%eax
+    2152:	85 c0                	test   %eax,%eax
+    2154:	75 1a                	jne    2170 <rw_wrlock+0x40>
+  asm volatile("lock; cmpxchgl %3, %1; sete %0" :
+    2156:	89 f8                	mov    %edi,%eax
+    2158:	f0 0f b1 33          	lock cmpxchg %esi,(%ebx)
+    215c:	0f 94 c2             	sete   %dl
+    while(!cas(&rw->state, 0, -1)){
+    215f:	84 d2                	test   %dl,%dl
+    2161:	74 ed                	je     2150 <rw_wrlock+0x20>
+  asm volatile("lock; xaddl %0, %1"
+    2163:	f0 0f c1 73 04       	lock xadd %esi,0x4(%ebx)
+            futex_sleep(&rw->state, s, &rw->nwait);
+    }
+    fetch_and_add(&rw->wwait, -1);
+}
+    2168:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    216b:	5b                   	pop    %ebx
+    216c:	5e                   	pop    %esi
+    216d:	5f                   	pop    %edi
+    216e:	5d                   	pop    %ebp
+    216f:	c3                   	ret
+    2170:	ba 01 00 00 00       	mov    $0x1,%edx
+    2175:	f0 0f c1 53 08       	lock xadd %edx,0x8(%ebx)
+    futex_wait(addr, val);
+    217a:	83 ec 08             	sub    $0x8,%esp
+    217d:	50                   	push   %eax
+    217e:	53                   	push   %ebx
+    217f:	e8 27 f4 ff ff       	call   15ab <futex_wait>
+    2184:	89 f0                	mov    %esi,%eax
+    2186:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+    218b:	83 c4 10             	add    $0x10,%esp
+    218e:	eb c6                	jmp    2156 <rw_wrlock+0x26>
+
+00002190 <rw_unlock>:
+
+void rw_unlock(struct rwlock *rw)
+{
+    2190:	55                   	push   %ebp
+    2191:	89 e5                	mov    %esp,%ebp
+    2193:	83 ec 08             	sub    $0x8,%esp
+    2196:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(rw->state < 0)
+    2199:	8b 02                	mov    (%edx),%eax
+    219b:	85 c0                	test   %eax,%eax
+    219d:	78 31                	js     21d0 <rw_unlock+0x40>
+    219f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    21a4:	f0 0f c1 02          	lock xadd %eax,(%edx)
+        xchg((uint*)&rw->state, 0);
+    else
+        fetch_and_add(&rw->state, -1);
+    if(*(volatile int*)&rw->nwait)
+    21a8:	8b 42 08             	mov    0x8(%edx),%eax
+    21ab:	85 c0                	test   %eax,%eax
+    21ad:	75 09                	jne    21b8 <rw_unlock+0x28>
+        futex_wake(&rw->state, NPROC);
+}
+    21af:	c9                   	leave
+    21b0:	c3                   	ret
+    21b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        futex_wake(&rw->state, NPROC);
+    21b8:	83 ec 08             	sub    $0x8,%esp
+    21bb:	68 00 04 00 00       	push   $0x400
+    21c0:	52                   	push   %edx
+    21c1:	e8 ed f3 ff ff       	call   15b3 <futex_wake>
+    21c6:	83 c4 10             	add    $0x10,%esp
+}
+    21c9:	c9                   	leave
+    21ca:	c3                   	ret
+    21cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    21cf:	90                   	nop
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    21d0:	31 c0                	xor    %eax,%eax
+    21d2:	f0 87 02             	lock xchg %eax,(%edx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    21d5:	eb d1                	jmp    21a8 <rw_unlock+0x18>
+    21d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21de:	66 90                	xchg   %ax,%ax
+
+000021e0 <cond_wait>:
+
+// condition variable
+void cond_wait(struct cond *cv, struct ticketlock *lock)
+{
+    21e0:	55                   	push   %ebp
+  asm volatile("lock; xaddl %0, %1"
+    21e1:	ba 01 00 00 00       	mov    $0x1,%edx
+    21e6:	89 e5                	mov    %esp,%ebp
+    21e8:	57                   	push   %edi
+    21e9:	56                   	push   %esi
+    21ea:	53                   	push   %ebx
+    21eb:	83 ec 1c             	sub    $0x1c,%esp
+    21ee:	8b 7d 08             	mov    0x8(%ebp),%edi
+    21f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    int s = *(volatile int*)&cv->seq;
+    21f4:	8b 07                	mov    (%edi),%eax
+    21f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    21f9:	89 d0                	mov    %edx,%eax
+    21fb:	f0 0f c1 47 04       	lock xadd %eax,0x4(%edi)
+    2200:	89 d0                	mov    %edx,%eax
+    2202:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2207:	8b 0b                	mov    (%ebx),%ecx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2209:	89 de                	mov    %ebx,%esi
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    220b:	83 c0 01             	add    $0x1,%eax
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    220e:	c1 ee 02             	shr    $0x2,%esi
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2211:	39 c8                	cmp    %ecx,%eax
+    2213:	74 26                	je     223b <cond_wait+0x5b>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2215:	01 f0                	add    %esi,%eax
+    2217:	83 e0 3f             	and    $0x3f,%eax
+    221a:	8d 0c 85 c0 2a 00 00 	lea    0x2ac0(,%eax,4),%ecx
+    2221:	f0 0f c1 14 85 c0 2a 	lock xadd %edx,0x2ac0(,%eax,4)
+    2228:	00 00 
+        futex_wake(w, NPROC);
+    222a:	83 ec 08             	sub    $0x8,%esp
+    222d:	68 00 04 00 00       	push   $0x400
+    2232:	51                   	push   %ecx
+    2233:	e8 7b f3 ff ff       	call   15b3 <futex_wake>
+    2238:	83 c4 10             	add    $0x10,%esp
+
+    fetch_and_add(&cv->nwait, 1);
+    lock_release(lock);
+    futex_wait(&cv->seq, s);
+    223b:	83 ec 08             	sub    $0x8,%esp
+    223e:	ff 75 e4             	push   -0x1c(%ebp)
+    2241:	57                   	push   %edi
+    2242:	e8 64 f3 ff ff       	call   15ab <futex_wait>
+    2247:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    224c:	f0 0f c1 47 04       	lock xadd %eax,0x4(%edi)
+    2251:	bf 01 00 00 00       	mov    $0x1,%edi
+    2256:	f0 0f c1 3b          	lock xadd %edi,(%ebx)
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    225a:	01 fe                	add    %edi,%esi
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    225c:	83 c4 10             	add    $0x10,%esp
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    225f:	83 e6 3f             	and    $0x3f,%esi
+        seq = *(volatile int*)w;
+    2262:	8b 04 b5 c0 2a 00 00 	mov    0x2ac0(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2269:	8b 53 04             	mov    0x4(%ebx),%edx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    226c:	8d 0c b5 c0 2a 00 00 	lea    0x2ac0(,%esi,4),%ecx
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2273:	39 fa                	cmp    %edi,%edx
+    2275:	74 25                	je     229c <cond_wait+0xbc>
+    2277:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    227a:	89 cf                	mov    %ecx,%edi
+    227c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(w, seq);
+    2280:	83 ec 08             	sub    $0x8,%esp
+    2283:	50                   	push   %eax
+    2284:	57                   	push   %edi
+    2285:	e8 21 f3 ff ff       	call   15ab <futex_wait>
+        seq = *(volatile int*)w;
+    228a:	8b 04 b5 c0 2a 00 00 	mov    0x2ac0(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2291:	83 c4 10             	add    $0x10,%esp
+    2294:	8b 53 04             	mov    0x4(%ebx),%edx
+    2297:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+    229a:	75 e4                	jne    2280 <cond_wait+0xa0>
+    fetch_and_add(&cv->nwait, -1);
+    lock_acquire(lock);
+}
+    229c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    229f:	5b                   	pop    %ebx
+    22a0:	5e                   	pop    %esi
+    22a1:	5f                   	pop    %edi
+    22a2:	5d                   	pop    %ebp
+    22a3:	c3                   	ret
+    22a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    22af:	90                   	nop
+
+000022b0 <cond_signal>:
+
+void cond_signal(struct cond *cv)
+{
+    22b0:	55                   	push   %ebp
+    22b1:	ba 01 00 00 00       	mov    $0x1,%edx
+    22b6:	89 e5                	mov    %esp,%ebp
+    22b8:	83 ec 08             	sub    $0x8,%esp
+    22bb:	8b 45 08             	mov    0x8(%ebp),%eax
+    22be:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    fetch_and_add(&cv->seq, 1);
+    if(*(volatile int*)&cv->nwait)
+    22c2:	8b 50 04             	mov    0x4(%eax),%edx
+    22c5:	85 d2                	test   %edx,%edx
+    22c7:	75 07                	jne    22d0 <cond_signal+0x20>
+        futex_wake(&cv->seq, 1);
+}
+    22c9:	c9                   	leave
+    22ca:	c3                   	ret
+    22cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    22cf:	90                   	nop
+        futex_wake(&cv->seq, 1);
+    22d0:	83 ec 08             	sub    $0x8,%esp
+    22d3:	6a 01                	push   $0x1
+    22d5:	50                   	push   %eax
+    22d6:	e8 d8 f2 ff ff       	call   15b3 <futex_wake>
+    22db:	83 c4 10             	add    $0x10,%esp
+}
+    22de:	c9                   	leave
+    22df:	c3                   	ret
+
+000022e0 <cond_broadcast>:
+
+void cond_broadcast(struct cond *cv)
+{
+    22e0:	55                   	push   %ebp
+    22e1:	ba 01 00 00 00       	mov    $0x1,%edx
+    22e6:	89 e5                	mov    %esp,%ebp
+    22e8:	83 ec 08             	sub    $0x8,%esp
+    22eb:	8b 45 08             	mov    0x8(%ebp),%eax
+    22ee:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    fetch_and_add(&cv->seq, 1);
+    if(*(volatile int*)&cv->nwait)
+    22f2:	8b 50 04             	mov    0x4(%eax),%edx
+    22f5:	85 d2                	test   %edx,%edx
+    22f7:	75 07                	jne    2300 <cond_broadcast+0x20>
+        futex_wake(&cv->seq, NPROC);
+}
+    22f9:	c9                   	leave
+    22fa:	c3                   	ret
+    22fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    22ff:	90                   	nop
+        futex_wake(&cv->seq, NPROC);
+    2300:	83 ec 08             	sub    $0x8,%esp
+    2303:	68 00 04 00 00       	push   $0x400
+    2308:	50                   	push   %eax
+    2309:	e8 a5 f2 ff ff       	call   15b3 <futex_wake>
+    230e:	83 c4 10             	add    $0x10,%esp
+}
+    2311:	c9                   	leave
+    2312:	c3                   	ret
+    2313:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    231a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002320 <barrier_init>:
+
+// barrier
+void barrier_init(struct barrier *b, int n)
+{
+    2320:	55                   	push   %ebp
+    2321:	89 e5                	mov    %esp,%ebp
+    2323:	8b 45 08             	mov    0x8(%ebp),%eax
+    b->n = n;
+    2326:	8b 55 0c             	mov    0xc(%ebp),%edx
+    b->count = 0;
+    2329:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+    b->n = n;
+    2330:	89 10                	mov    %edx,(%eax)
+    b->gen = 0;
+    2332:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+    2339:	5d                   	pop    %ebp
+    233a:	c3                   	ret
+    233b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    233f:	90                   	nop
+
+00002340 <barrier_wait>:
+
+// The last thread to arrive starts the next round and
+// wakes the others, who sleep until the round changes.
+void barrier_wait(struct barrier *b)
+{
+    2340:	55                   	push   %ebp
+    2341:	ba 01 00 00 00       	mov    $0x1,%edx
+    2346:	89 d0                	mov    %edx,%eax
+    2348:	89 e5                	mov    %esp,%ebp
+    234a:	57                   	push   %edi
+    234b:	56                   	push   %esi
+    234c:	53                   	push   %ebx
+    234d:	83 ec 0c             	sub    $0xc,%esp
+    2350:	8b 75 08             	mov    0x8(%ebp),%esi
+    int gen = *(volatile int*)&b->gen;
+    2353:	8b 5e 08             	mov    0x8(%esi),%ebx
+    2356:	f0 0f c1 46 04       	lock xadd %eax,0x4(%esi)
+
+    if(fetch_and_add(&b->count, 1) + 1 == b->n){
+    235b:	83 c0 01             	add    $0x1,%eax
+    235e:	3b 06                	cmp    (%esi),%eax
+    2360:	74 2e                	je     2390 <barrier_wait+0x50>
+        b->count = 0;
+        fetch_and_add(&b->gen, 1);
+        futex_wake(&b->gen, NPROC);
+        return;
+    }
+    while(*(volatile int*)&b->gen == gen)
+    2362:	8b 46 08             	mov    0x8(%esi),%eax
+        futex_wait(&b->gen, gen);
+    2365:	8d 7e 08             	lea    0x8(%esi),%edi
+    while(*(volatile int*)&b->gen == gen)
+    2368:	39 c3                	cmp    %eax,%ebx
+    236a:	75 18                	jne    2384 <barrier_wait+0x44>
+    236c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(&b->gen, gen);
+    2370:	83 ec 08             	sub    $0x8,%esp
+    2373:	53                   	push   %ebx
+    2374:	57                   	push   %edi
+    2375:	e8 31 f2 ff ff       	call   15ab <futex_wait>
+    while(*(volatile int*)&b->gen == gen)
+    237a:	8b 46 08             	mov    0x8(%esi),%eax
+    237d:	83 c4 10             	add    $0x10,%esp
+    2380:	39 d8                	cmp    %ebx,%eax
+    2382:	74 ec                	je     2370 <barrier_wait+0x30>
+}
+    2384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2387:	5b                   	pop    %ebx
+    2388:	5e                   	pop    %esi
+    2389:	5f                   	pop    %edi
+    238a:	5d                   	pop    %ebp
+    238b:	c3                   	ret
+    238c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        b->count = 0;
+    2390:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+        fetch_and_add(&b->gen, 1);
+    2397:	8d 46 08             	lea    0x8(%esi),%eax
+    239a:	f0 0f c1 56 08       	lock xadd %edx,0x8(%esi)
+        futex_wake(&b->gen, NPROC);
+    239f:	83 ec 08             	sub    $0x8,%esp
+    23a2:	68 00 04 00 00       	push   $0x400
+    23a7:	50                   	push   %eax
+    23a8:	e8 06 f2 ff ff       	call   15b3 <futex_wake>
+        return;
+    23ad:	83 c4 10             	add    $0x10,%esp
+}
+    23b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    23b3:	5b                   	pop    %ebx
+    23b4:	5e                   	pop    %esi
+    23b5:	5f                   	pop    %edi
+    23b6:	5d                   	pop    %ebp
+    23b7:	c3                   	ret
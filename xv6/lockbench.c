@@ -0,0 +1,81 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+#include "ticketlock.h"
+
+// Measure lock handoff latency: the TSC cycles between one
+// thread releasing a contended lock and another thread
+// getting it, for the kernel ticket lock (acquire_t) and for
+// the futex-based lock_acquire in the thread library.
+
+#define NTHREADS 4
+#define ROUNDS 500
+#define NULL (void *)(0)
+
+struct ticketlock lock;
+int usekernel;
+volatile uint64 released;   // TSC at the last release
+volatile int holder;        // who released it
+uint64 total;
+uint handoffs, worst;
+
+void worker(void *self, void *unused)
+{
+	int me = (int) self;
+	uint64 now;
+	uint d;
+
+	for(int i = 0 ; i < ROUNDS ; i++)
+	{
+		if(usekernel)
+			acquire_t(&lock);
+		else
+			lock_acquire(&lock);
+		now = rdtsc();
+		if(released && holder != me)
+		{
+			d = now - released;
+			total += d;
+			handoffs++;
+			if(d > worst)
+				worst = d;
+		}
+		for(volatile int j = 0 ; j < 100 ; j++)
+			;
+		holder = me;
+		released = rdtsc();
+		if(usekernel)
+			release_t(&lock);
+		else
+			lock_release(&lock);
+	}
+	exit();
+}
+
+void bench(char *name, int kernel)
+{
+	usekernel = kernel;
+	if(kernel)
+		initlock_t(&lock);
+	else
+		lock_init(&lock);
+	released = 0;
+	total = 0;
+	handoffs = worst = 0;
+	for(int i = 0 ; i < NTHREADS ; i++)
+		thread_create(&worker, (void*) i, NULL);
+	for(int i = 0 ; i < NTHREADS ; i++)
+		thread_join();
+	// (total >> 6) fits an int, and user code has no 64-bit divide
+	printf(1, "%s: %d handoffs, average %d cycles, worst %d cycles\n",
+	       name, handoffs, handoffs ? (uint)(total >> 6) / handoffs * 64 : 0, worst);
+}
+
+int
+main(int argc, char *argv[])
+{
+	bench("acquire_t", 1);
+	bench("lock_acquire", 0);
+	exit();
+}
@@ -36,17 +36,20 @@ main(int argc, char *argv[]){
 	while(1)
 	{
 	
-		getpinfo(&st);
 		printf(1, "\nPID\t|\tUSED?\t|\tTickets\t|\tTicks\n");
 
-		for(int i=0;i<size;i++)
-		{
-			for (int j = 0; j < sizeof(st.pid)/sizeof(st.pid[0]); j++)
+		st.next = 0;
+		do {
+			getpinfo(&st);
+			for(int i=0;i<size;i++)
 			{
-				if(st.pid[j] ==child_pid[i])
-					printf(1, "%d\t|\t%d\t|\t%d\t|\t%d\n", st.pid[j], st.inuse[j], st.tickets[j], st.ticks[j]);
+				for (int j = 0; j < sizeof(st.pid)/sizeof(st.pid[0]); j++)
+				{
+					if(st.inuse[j] && st.pid[j] ==child_pid[i])
+						printf(1, "%d\t|\t%d\t|\t%d\t|\t%d\n", st.pid[j], st.inuse[j], st.tickets[j], st.ticks[j]);
+				}
 			}
-		}
+		} while(st.next);
 		
 		sleep(200);
     	}
@@ -0,0 +1,1535 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1015:	51                   	push   %ecx
+    1016:	83 ec 08             	sub    $0x8,%esp
+    1019:	8b 31                	mov    (%ecx),%esi
+    101b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+    101e:	83 fe 01             	cmp    $0x1,%esi
+    1021:	7e 1f                	jle    1042 <main+0x42>
+    1023:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1027:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+    1028:	83 ec 0c             	sub    $0xc,%esp
+    102b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+    102e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+    1031:	e8 ca 00 00 00       	call   1100 <ls>
+  for(i=1; i<argc; i++)
+    1036:	83 c4 10             	add    $0x10,%esp
+    1039:	39 de                	cmp    %ebx,%esi
+    103b:	75 eb                	jne    1028 <main+0x28>
+  exit();
+    103d:	e8 41 05 00 00       	call   1583 <exit>
+    ls(".");
+    1042:	83 ec 0c             	sub    $0xc,%esp
+    1045:	68 e0 1a 00 00       	push   $0x1ae0
+    104a:	e8 b1 00 00 00       	call   1100 <ls>
+    exit();
+    104f:	e8 2f 05 00 00       	call   1583 <exit>
+    1054:	66 90                	xchg   %ax,%ax
+    1056:	66 90                	xchg   %ax,%ax
+    1058:	66 90                	xchg   %ax,%ax
+    105a:	66 90                	xchg   %ax,%ax
+    105c:	66 90                	xchg   %ax,%ax
+    105e:	66 90                	xchg   %ax,%ax
+
+00001060 <fmtname>:
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	56                   	push   %esi
+    1064:	53                   	push   %ebx
+    1065:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+    1068:	83 ec 0c             	sub    $0xc,%esp
+    106b:	56                   	push   %esi
+    106c:	e8 5f 03 00 00       	call   13d0 <strlen>
+    1071:	83 c4 10             	add    $0x10,%esp
+    1074:	01 f0                	add    %esi,%eax
+    1076:	89 c3                	mov    %eax,%ebx
+    1078:	73 0f                	jae    1089 <fmtname+0x29>
+    107a:	eb 12                	jmp    108e <fmtname+0x2e>
+    107c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1080:	8d 43 ff             	lea    -0x1(%ebx),%eax
+    1083:	39 f0                	cmp    %esi,%eax
+    1085:	72 0a                	jb     1091 <fmtname+0x31>
+    1087:	89 c3                	mov    %eax,%ebx
+    1089:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+    108c:	75 f2                	jne    1080 <fmtname+0x20>
+  p++;
+    108e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+    1091:	83 ec 0c             	sub    $0xc,%esp
+    1094:	53                   	push   %ebx
+    1095:	e8 36 03 00 00       	call   13d0 <strlen>
+    109a:	83 c4 10             	add    $0x10,%esp
+    109d:	83 f8 0d             	cmp    $0xd,%eax
+    10a0:	77 4a                	ja     10ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+    10a2:	83 ec 0c             	sub    $0xc,%esp
+    10a5:	53                   	push   %ebx
+    10a6:	e8 25 03 00 00       	call   13d0 <strlen>
+    10ab:	83 c4 0c             	add    $0xc,%esp
+    10ae:	50                   	push   %eax
+    10af:	53                   	push   %ebx
+    10b0:	68 68 1e 00 00       	push   $0x1e68
+    10b5:	e8 96 04 00 00       	call   1550 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+    10ba:	89 1c 24             	mov    %ebx,(%esp)
+    10bd:	e8 0e 03 00 00       	call   13d0 <strlen>
+    10c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+    10c5:	bb 68 1e 00 00       	mov    $0x1e68,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+    10ca:	89 c6                	mov    %eax,%esi
+    10cc:	e8 ff 02 00 00       	call   13d0 <strlen>
+    10d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+    10d6:	83 c4 0c             	add    $0xc,%esp
+    10d9:	29 f2                	sub    %esi,%edx
+    10db:	05 68 1e 00 00       	add    $0x1e68,%eax
+    10e0:	52                   	push   %edx
+    10e1:	6a 20                	push   $0x20
+    10e3:	50                   	push   %eax
+    10e4:	e8 17 03 00 00       	call   1400 <memset>
+  return buf;
+    10e9:	83 c4 10             	add    $0x10,%esp
+}
+    10ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10ef:	89 d8                	mov    %ebx,%eax
+    10f1:	5b                   	pop    %ebx
+    10f2:	5e                   	pop    %esi
+    10f3:	5d                   	pop    %ebp
+    10f4:	c3                   	ret
+    10f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001100 <ls>:
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	57                   	push   %edi
+    1104:	56                   	push   %esi
+    1105:	53                   	push   %ebx
+    1106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+    110c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+    110f:	6a 00                	push   $0x0
+    1111:	57                   	push   %edi
+    1112:	e8 ac 04 00 00       	call   15c3 <open>
+    1117:	83 c4 10             	add    $0x10,%esp
+    111a:	85 c0                	test   %eax,%eax
+    111c:	0f 88 9e 01 00 00    	js     12c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+    1122:	83 ec 08             	sub    $0x8,%esp
+    1125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+    112b:	89 c3                	mov    %eax,%ebx
+    112d:	56                   	push   %esi
+    112e:	50                   	push   %eax
+    112f:	e8 a7 04 00 00       	call   15db <fstat>
+    1134:	83 c4 10             	add    $0x10,%esp
+    1137:	85 c0                	test   %eax,%eax
+    1139:	0f 88 c1 01 00 00    	js     1300 <ls+0x200>
+  switch(st.type){
+    113f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+    1146:	66 83 f8 01          	cmp    $0x1,%ax
+    114a:	74 64                	je     11b0 <ls+0xb0>
+    114c:	66 83 f8 02          	cmp    $0x2,%ax
+    1150:	74 1e                	je     1170 <ls+0x70>
+  close(fd);
+    1152:	83 ec 0c             	sub    $0xc,%esp
+    1155:	53                   	push   %ebx
+    1156:	e8 50 04 00 00       	call   15ab <close>
+    115b:	83 c4 10             	add    $0x10,%esp
+}
+    115e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1161:	5b                   	pop    %ebx
+    1162:	5e                   	pop    %esi
+    1163:	5f                   	pop    %edi
+    1164:	5d                   	pop    %ebp
+    1165:	c3                   	ret
+    1166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    116d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+    1170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+    1176:	83 ec 0c             	sub    $0xc,%esp
+    1179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+    117f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+    1185:	57                   	push   %edi
+    1186:	e8 d5 fe ff ff       	call   1060 <fmtname>
+    118b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+    1191:	59                   	pop    %ecx
+    1192:	5f                   	pop    %edi
+    1193:	52                   	push   %edx
+    1194:	56                   	push   %esi
+    1195:	6a 02                	push   $0x2
+    1197:	50                   	push   %eax
+    1198:	68 c0 1a 00 00       	push   $0x1ac0
+    119d:	6a 01                	push   $0x1
+    119f:	e8 cc 05 00 00       	call   1770 <printf>
+    break;
+    11a4:	83 c4 20             	add    $0x20,%esp
+    11a7:	eb a9                	jmp    1152 <ls+0x52>
+    11a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+    11b0:	83 ec 0c             	sub    $0xc,%esp
+    11b3:	57                   	push   %edi
+    11b4:	e8 17 02 00 00       	call   13d0 <strlen>
+    11b9:	83 c4 10             	add    $0x10,%esp
+    11bc:	83 c0 10             	add    $0x10,%eax
+    11bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+    11c4:	0f 87 16 01 00 00    	ja     12e0 <ls+0x1e0>
+    strcpy(buf, path);
+    11ca:	83 ec 08             	sub    $0x8,%esp
+    11cd:	57                   	push   %edi
+    11ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+    11d4:	57                   	push   %edi
+    11d5:	e8 66 01 00 00       	call   1340 <strcpy>
+    p = buf+strlen(buf);
+    11da:	89 3c 24             	mov    %edi,(%esp)
+    11dd:	e8 ee 01 00 00       	call   13d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+    11e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+    11e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+    11e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+    11ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+    11f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+    11f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+    11f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1200:	83 ec 04             	sub    $0x4,%esp
+    1203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+    1209:	6a 10                	push   $0x10
+    120b:	50                   	push   %eax
+    120c:	53                   	push   %ebx
+    120d:	e8 89 03 00 00       	call   159b <read>
+    1212:	83 c4 10             	add    $0x10,%esp
+    1215:	83 f8 10             	cmp    $0x10,%eax
+    1218:	0f 85 34 ff ff ff    	jne    1152 <ls+0x52>
+      if(de.inum == 0)
+    121e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+    1225:	00 
+    1226:	74 d8                	je     1200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+    1228:	83 ec 04             	sub    $0x4,%esp
+    122b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+    1231:	6a 0e                	push   $0xe
+    1233:	50                   	push   %eax
+    1234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+    123a:	e8 11 03 00 00       	call   1550 <memmove>
+      p[DIRSIZ] = 0;
+    123f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+    1245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+    1249:	58                   	pop    %eax
+    124a:	5a                   	pop    %edx
+    124b:	56                   	push   %esi
+    124c:	57                   	push   %edi
+    124d:	e8 6e 02 00 00       	call   14c0 <stat>
+    1252:	83 c4 10             	add    $0x10,%esp
+    1255:	85 c0                	test   %eax,%eax
+    1257:	0f 88 cb 00 00 00    	js     1328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+    125d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+    1263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+    1269:	83 ec 0c             	sub    $0xc,%esp
+    126c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+    1273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+    1279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+    127f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+    1285:	57                   	push   %edi
+    1286:	e8 d5 fd ff ff       	call   1060 <fmtname>
+    128b:	5a                   	pop    %edx
+    128c:	59                   	pop    %ecx
+    128d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+    1293:	51                   	push   %ecx
+    1294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+    129a:	52                   	push   %edx
+    129b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+    12a1:	50                   	push   %eax
+    12a2:	68 c0 1a 00 00       	push   $0x1ac0
+    12a7:	6a 01                	push   $0x1
+    12a9:	e8 c2 04 00 00       	call   1770 <printf>
+    12ae:	83 c4 20             	add    $0x20,%esp
+    12b1:	e9 4a ff ff ff       	jmp    1200 <ls+0x100>
+    12b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+    12c0:	83 ec 04             	sub    $0x4,%esp
+    12c3:	57                   	push   %edi
+    12c4:	68 98 1a 00 00       	push   $0x1a98
+    12c9:	6a 02                	push   $0x2
+    12cb:	e8 a0 04 00 00       	call   1770 <printf>
+    return;
+    12d0:	83 c4 10             	add    $0x10,%esp
+}
+    12d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12d6:	5b                   	pop    %ebx
+    12d7:	5e                   	pop    %esi
+    12d8:	5f                   	pop    %edi
+    12d9:	5d                   	pop    %ebp
+    12da:	c3                   	ret
+    12db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12df:	90                   	nop
+      printf(1, "ls: path too long\n");
+    12e0:	83 ec 08             	sub    $0x8,%esp
+    12e3:	68 cd 1a 00 00       	push   $0x1acd
+    12e8:	6a 01                	push   $0x1
+    12ea:	e8 81 04 00 00       	call   1770 <printf>
+      break;
+    12ef:	83 c4 10             	add    $0x10,%esp
+    12f2:	e9 5b fe ff ff       	jmp    1152 <ls+0x52>
+    12f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+    1300:	83 ec 04             	sub    $0x4,%esp
+    1303:	57                   	push   %edi
+    1304:	68 ac 1a 00 00       	push   $0x1aac
+    1309:	6a 02                	push   $0x2
+    130b:	e8 60 04 00 00       	call   1770 <printf>
+    close(fd);
+    1310:	89 1c 24             	mov    %ebx,(%esp)
+    1313:	e8 93 02 00 00       	call   15ab <close>
+    return;
+    1318:	83 c4 10             	add    $0x10,%esp
+}
+    131b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    131e:	5b                   	pop    %ebx
+    131f:	5e                   	pop    %esi
+    1320:	5f                   	pop    %edi
+    1321:	5d                   	pop    %ebp
+    1322:	c3                   	ret
+    1323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+    1328:	83 ec 04             	sub    $0x4,%esp
+    132b:	57                   	push   %edi
+    132c:	68 ac 1a 00 00       	push   $0x1aac
+    1331:	6a 01                	push   $0x1
+    1333:	e8 38 04 00 00       	call   1770 <printf>
+        continue;
+    1338:	83 c4 10             	add    $0x10,%esp
+    133b:	e9 c0 fe ff ff       	jmp    1200 <ls+0x100>
+
+00001340 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1341:	31 c0                	xor    %eax,%eax
+{
+    1343:	89 e5                	mov    %esp,%ebp
+    1345:	53                   	push   %ebx
+    1346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    134c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1357:	83 c0 01             	add    $0x1,%eax
+    135a:	84 d2                	test   %dl,%dl
+    135c:	75 f2                	jne    1350 <strcpy+0x10>
+    ;
+  return os;
+}
+    135e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1361:	89 c8                	mov    %ecx,%eax
+    1363:	c9                   	leave
+    1364:	c3                   	ret
+    1365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	53                   	push   %ebx
+    1374:	8b 55 08             	mov    0x8(%ebp),%edx
+    1377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    137a:	0f b6 02             	movzbl (%edx),%eax
+    137d:	84 c0                	test   %al,%al
+    137f:	75 17                	jne    1398 <strcmp+0x28>
+    1381:	eb 3a                	jmp    13bd <strcmp+0x4d>
+    1383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1387:	90                   	nop
+    1388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    138c:	83 c2 01             	add    $0x1,%edx
+    138f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1392:	84 c0                	test   %al,%al
+    1394:	74 1a                	je     13b0 <strcmp+0x40>
+    p++, q++;
+    1396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1398:	0f b6 19             	movzbl (%ecx),%ebx
+    139b:	38 c3                	cmp    %al,%bl
+    139d:	74 e9                	je     1388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    139f:	29 d8                	sub    %ebx,%eax
+}
+    13a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13a4:	c9                   	leave
+    13a5:	c3                   	ret
+    13a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    13b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    13b4:	31 c0                	xor    %eax,%eax
+    13b6:	29 d8                	sub    %ebx,%eax
+}
+    13b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13bb:	c9                   	leave
+    13bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    13bd:	0f b6 19             	movzbl (%ecx),%ebx
+    13c0:	31 c0                	xor    %eax,%eax
+    13c2:	eb db                	jmp    139f <strcmp+0x2f>
+    13c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13cf:	90                   	nop
+
+000013d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    13d6:	80 3a 00             	cmpb   $0x0,(%edx)
+    13d9:	74 15                	je     13f0 <strlen+0x20>
+    13db:	31 c0                	xor    %eax,%eax
+    13dd:	8d 76 00             	lea    0x0(%esi),%esi
+    13e0:	83 c0 01             	add    $0x1,%eax
+    13e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    13e7:	89 c1                	mov    %eax,%ecx
+    13e9:	75 f5                	jne    13e0 <strlen+0x10>
+    ;
+  return n;
+}
+    13eb:	89 c8                	mov    %ecx,%eax
+    13ed:	5d                   	pop    %ebp
+    13ee:	c3                   	ret
+    13ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+    13f0:	31 c9                	xor    %ecx,%ecx
+}
+    13f2:	5d                   	pop    %ebp
+    13f3:	89 c8                	mov    %ecx,%eax
+    13f5:	c3                   	ret
+    13f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	57                   	push   %edi
+    1404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    140a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    140d:	89 d7                	mov    %edx,%edi
+    140f:	fc                   	cld
+    1410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1415:	89 d0                	mov    %edx,%eax
+    1417:	c9                   	leave
+    1418:	c3                   	ret
+    1419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	8b 45 08             	mov    0x8(%ebp),%eax
+    1426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    142a:	0f b6 10             	movzbl (%eax),%edx
+    142d:	84 d2                	test   %dl,%dl
+    142f:	75 12                	jne    1443 <strchr+0x23>
+    1431:	eb 1d                	jmp    1450 <strchr+0x30>
+    1433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1437:	90                   	nop
+    1438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    143c:	83 c0 01             	add    $0x1,%eax
+    143f:	84 d2                	test   %dl,%dl
+    1441:	74 0d                	je     1450 <strchr+0x30>
+    if(*s == c)
+    1443:	38 d1                	cmp    %dl,%cl
+    1445:	75 f1                	jne    1438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1447:	5d                   	pop    %ebp
+    1448:	c3                   	ret
+    1449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1450:	31 c0                	xor    %eax,%eax
+}
+    1452:	5d                   	pop    %ebp
+    1453:	c3                   	ret
+    1454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    145b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    145f:	90                   	nop
+
+00001460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	57                   	push   %edi
+    1464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1469:	31 db                	xor    %ebx,%ebx
+{
+    146b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    146e:	eb 27                	jmp    1497 <gets+0x37>
+    cc = read(0, &c, 1);
+    1470:	83 ec 04             	sub    $0x4,%esp
+    1473:	6a 01                	push   $0x1
+    1475:	56                   	push   %esi
+    1476:	6a 00                	push   $0x0
+    1478:	e8 1e 01 00 00       	call   159b <read>
+    if(cc < 1)
+    147d:	83 c4 10             	add    $0x10,%esp
+    1480:	85 c0                	test   %eax,%eax
+    1482:	7e 1d                	jle    14a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1488:	8b 55 08             	mov    0x8(%ebp),%edx
+    148b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    148f:	3c 0a                	cmp    $0xa,%al
+    1491:	74 10                	je     14a3 <gets+0x43>
+    1493:	3c 0d                	cmp    $0xd,%al
+    1495:	74 0c                	je     14a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1497:	89 df                	mov    %ebx,%edi
+    1499:	83 c3 01             	add    $0x1,%ebx
+    149c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    149f:	7c cf                	jl     1470 <gets+0x10>
+    14a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    14a3:	8b 45 08             	mov    0x8(%ebp),%eax
+    14a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    14aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14ad:	5b                   	pop    %ebx
+    14ae:	5e                   	pop    %esi
+    14af:	5f                   	pop    %edi
+    14b0:	5d                   	pop    %ebp
+    14b1:	c3                   	ret
+    14b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000014c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    14c0:	55                   	push   %ebp
+    14c1:	89 e5                	mov    %esp,%ebp
+    14c3:	56                   	push   %esi
+    14c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    14c5:	83 ec 08             	sub    $0x8,%esp
+    14c8:	6a 00                	push   $0x0
+    14ca:	ff 75 08             	push   0x8(%ebp)
+    14cd:	e8 f1 00 00 00       	call   15c3 <open>
+  if(fd < 0)
+    14d2:	83 c4 10             	add    $0x10,%esp
+    14d5:	85 c0                	test   %eax,%eax
+    14d7:	78 27                	js     1500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    14d9:	83 ec 08             	sub    $0x8,%esp
+    14dc:	ff 75 0c             	push   0xc(%ebp)
+    14df:	89 c3                	mov    %eax,%ebx
+    14e1:	50                   	push   %eax
+    14e2:	e8 f4 00 00 00       	call   15db <fstat>
+  close(fd);
+    14e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    14ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+    14ec:	e8 ba 00 00 00       	call   15ab <close>
+  return r;
+    14f1:	83 c4 10             	add    $0x10,%esp
+}
+    14f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    14f7:	89 f0                	mov    %esi,%eax
+    14f9:	5b                   	pop    %ebx
+    14fa:	5e                   	pop    %esi
+    14fb:	5d                   	pop    %ebp
+    14fc:	c3                   	ret
+    14fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1505:	eb ed                	jmp    14f4 <stat+0x34>
+    1507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    150e:	66 90                	xchg   %ax,%ax
+
+00001510 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1510:	55                   	push   %ebp
+    1511:	89 e5                	mov    %esp,%ebp
+    1513:	53                   	push   %ebx
+    1514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1517:	0f be 02             	movsbl (%edx),%eax
+    151a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    151d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1525:	77 1e                	ja     1545 <atoi+0x35>
+    1527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    152e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1530:	83 c2 01             	add    $0x1,%edx
+    1533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    153a:	0f be 02             	movsbl (%edx),%eax
+    153d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1540:	80 fb 09             	cmp    $0x9,%bl
+    1543:	76 eb                	jbe    1530 <atoi+0x20>
+  return n;
+}
+    1545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1548:	89 c8                	mov    %ecx,%eax
+    154a:	c9                   	leave
+    154b:	c3                   	ret
+    154c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001550 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1550:	55                   	push   %ebp
+    1551:	89 e5                	mov    %esp,%ebp
+    1553:	57                   	push   %edi
+    1554:	56                   	push   %esi
+    1555:	8b 45 10             	mov    0x10(%ebp),%eax
+    1558:	8b 55 08             	mov    0x8(%ebp),%edx
+    155b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    155e:	85 c0                	test   %eax,%eax
+    1560:	7e 13                	jle    1575 <memmove+0x25>
+    1562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1564:	89 d7                	mov    %edx,%edi
+    1566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    156d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1571:	39 f8                	cmp    %edi,%eax
+    1573:	75 fb                	jne    1570 <memmove+0x20>
+  return vdst;
+}
+    1575:	5e                   	pop    %esi
+    1576:	89 d0                	mov    %edx,%eax
+    1578:	5f                   	pop    %edi
+    1579:	5d                   	pop    %ebp
+    157a:	c3                   	ret
+
+0000157b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    157b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1580:	cd 40                	int    $0x40
+    1582:	c3                   	ret
+
+00001583 <exit>:
+SYSCALL(exit)
+    1583:	b8 02 00 00 00       	mov    $0x2,%eax
+    1588:	cd 40                	int    $0x40
+    158a:	c3                   	ret
+
+0000158b <wait>:
+SYSCALL(wait)
+    158b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1590:	cd 40                	int    $0x40
+    1592:	c3                   	ret
+
+00001593 <pipe>:
+SYSCALL(pipe)
+    1593:	b8 04 00 00 00       	mov    $0x4,%eax
+    1598:	cd 40                	int    $0x40
+    159a:	c3                   	ret
+
+0000159b <read>:
+SYSCALL(read)
+    159b:	b8 05 00 00 00       	mov    $0x5,%eax
+    15a0:	cd 40                	int    $0x40
+    15a2:	c3                   	ret
+
+000015a3 <write>:
+SYSCALL(write)
+    15a3:	b8 10 00 00 00       	mov    $0x10,%eax
+    15a8:	cd 40                	int    $0x40
+    15aa:	c3                   	ret
+
+000015ab <close>:
+SYSCALL(close)
+    15ab:	b8 15 00 00 00       	mov    $0x15,%eax
+    15b0:	cd 40                	int    $0x40
+    15b2:	c3                   	ret
+
+000015b3 <kill>:
+SYSCALL(kill)
+    15b3:	b8 06 00 00 00       	mov    $0x6,%eax
+    15b8:	cd 40                	int    $0x40
+    15ba:	c3                   	ret
+
+000015bb <exec>:
+SYSCALL(exec)
+    15bb:	b8 07 00 00 00       	mov    $0x7,%eax
+    15c0:	cd 40                	int    $0x40
+    15c2:	c3                   	ret
+
+000015c3 <open>:
+SYSCALL(open)
+    15c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    15c8:	cd 40                	int    $0x40
+    15ca:	c3                   	ret
+
+000015cb <mknod>:
+SYSCALL(mknod)
+    15cb:	b8 11 00 00 00       	mov    $0x11,%eax
+    15d0:	cd 40                	int    $0x40
+    15d2:	c3                   	ret
+
+000015d3 <unlink>:
+SYSCALL(unlink)
+    15d3:	b8 12 00 00 00       	mov    $0x12,%eax
+    15d8:	cd 40                	int    $0x40
+    15da:	c3                   	ret
+
+000015db <fstat>:
+SYSCALL(fstat)
+    15db:	b8 08 00 00 00       	mov    $0x8,%eax
+    15e0:	cd 40                	int    $0x40
+    15e2:	c3                   	ret
+
+000015e3 <link>:
+SYSCALL(link)
+    15e3:	b8 13 00 00 00       	mov    $0x13,%eax
+    15e8:	cd 40                	int    $0x40
+    15ea:	c3                   	ret
+
+000015eb <mkdir>:
+SYSCALL(mkdir)
+    15eb:	b8 14 00 00 00       	mov    $0x14,%eax
+    15f0:	cd 40                	int    $0x40
+    15f2:	c3                   	ret
+
+000015f3 <chdir>:
+SYSCALL(chdir)
+    15f3:	b8 09 00 00 00       	mov    $0x9,%eax
+    15f8:	cd 40                	int    $0x40
+    15fa:	c3                   	ret
+
+000015fb <dup>:
+SYSCALL(dup)
+    15fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1600:	cd 40                	int    $0x40
+    1602:	c3                   	ret
+
+00001603 <getpid>:
+SYSCALL(getpid)
+    1603:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1608:	cd 40                	int    $0x40
+    160a:	c3                   	ret
+
+0000160b <sbrk>:
+SYSCALL(sbrk)
+    160b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1610:	cd 40                	int    $0x40
+    1612:	c3                   	ret
+
+00001613 <sleep>:
+SYSCALL(sleep)
+    1613:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1618:	cd 40                	int    $0x40
+    161a:	c3                   	ret
+
+0000161b <uptime>:
+SYSCALL(uptime)
+    161b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1620:	cd 40                	int    $0x40
+    1622:	c3                   	ret
+
+00001623 <settickets>:
+SYSCALL(settickets)
+    1623:	b8 16 00 00 00       	mov    $0x16,%eax
+    1628:	cd 40                	int    $0x40
+    162a:	c3                   	ret
+
+0000162b <getpinfo>:
+SYSCALL(getpinfo)
+    162b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1630:	cd 40                	int    $0x40
+    1632:	c3                   	ret
+
+00001633 <mprotect>:
+SYSCALL(mprotect)
+    1633:	b8 18 00 00 00       	mov    $0x18,%eax
+    1638:	cd 40                	int    $0x40
+    163a:	c3                   	ret
+
+0000163b <munprotect>:
+SYSCALL(munprotect)
+    163b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1640:	cd 40                	int    $0x40
+    1642:	c3                   	ret
+
+00001643 <clone>:
+SYSCALL(clone)
+    1643:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1648:	cd 40                	int    $0x40
+    164a:	c3                   	ret
+
+0000164b <join>:
+SYSCALL(join)
+    164b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1650:	cd 40                	int    $0x40
+    1652:	c3                   	ret
+
+00001653 <initlock_t>:
+SYSCALL(initlock_t)
+    1653:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1658:	cd 40                	int    $0x40
+    165a:	c3                   	ret
+
+0000165b <acquire_t>:
+SYSCALL(acquire_t)
+    165b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1660:	cd 40                	int    $0x40
+    1662:	c3                   	ret
+
+00001663 <release_t>:
+SYSCALL(release_t)
+    1663:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1668:	cd 40                	int    $0x40
+    166a:	c3                   	ret
+
+0000166b <setsched>:
+SYSCALL(setsched)
+    166b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1670:	cd 40                	int    $0x40
+    1672:	c3                   	ret
+
+00001673 <mkgroup>:
+SYSCALL(mkgroup)
+    1673:	b8 20 00 00 00       	mov    $0x20,%eax
+    1678:	cd 40                	int    $0x40
+    167a:	c3                   	ret
+
+0000167b <joingroup>:
+SYSCALL(joingroup)
+    167b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1680:	cd 40                	int    $0x40
+    1682:	c3                   	ret
+
+00001683 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1683:	b8 22 00 00 00       	mov    $0x22,%eax
+    1688:	cd 40                	int    $0x40
+    168a:	c3                   	ret
+
+0000168b <setdeadline>:
+SYSCALL(setdeadline)
+    168b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1690:	cd 40                	int    $0x40
+    1692:	c3                   	ret
+
+00001693 <setaffinity>:
+SYSCALL(setaffinity)
+    1693:	b8 24 00 00 00       	mov    $0x24,%eax
+    1698:	cd 40                	int    $0x40
+    169a:	c3                   	ret
+
+0000169b <yield_to>:
+SYSCALL(yield_to)
+    169b:	b8 25 00 00 00       	mov    $0x25,%eax
+    16a0:	cd 40                	int    $0x40
+    16a2:	c3                   	ret
+
+000016a3 <getlatency>:
+SYSCALL(getlatency)
+    16a3:	b8 26 00 00 00       	mov    $0x26,%eax
+    16a8:	cd 40                	int    $0x40
+    16aa:	c3                   	ret
+
+000016ab <futex_wait>:
+SYSCALL(futex_wait)
+    16ab:	b8 27 00 00 00       	mov    $0x27,%eax
+    16b0:	cd 40                	int    $0x40
+    16b2:	c3                   	ret
+
+000016b3 <futex_wake>:
+SYSCALL(futex_wake)
+    16b3:	b8 28 00 00 00       	mov    $0x28,%eax
+    16b8:	cd 40                	int    $0x40
+    16ba:	c3                   	ret
+
+000016bb <mguard>:
+SYSCALL(mguard)
+    16bb:	b8 29 00 00 00       	mov    $0x29,%eax
+    16c0:	cd 40                	int    $0x40
+    16c2:	c3                   	ret
+
+000016c3 <join_any>:
+SYSCALL(join_any)
+    16c3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    16c8:	cd 40                	int    $0x40
+    16ca:	c3                   	ret
+    16cb:	66 90                	xchg   %ax,%ax
+    16cd:	66 90                	xchg   %ax,%ax
+    16cf:	90                   	nop
+
+000016d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    16d0:	55                   	push   %ebp
+    16d1:	89 e5                	mov    %esp,%ebp
+    16d3:	57                   	push   %edi
+    16d4:	56                   	push   %esi
+    16d5:	53                   	push   %ebx
+    16d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    16d8:	89 d1                	mov    %edx,%ecx
+{
+    16da:	83 ec 3c             	sub    $0x3c,%esp
+    16dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    16e0:	85 d2                	test   %edx,%edx
+    16e2:	0f 89 80 00 00 00    	jns    1768 <printint+0x98>
+    16e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    16ec:	74 7a                	je     1768 <printint+0x98>
+    x = -xx;
+    16ee:	f7 d9                	neg    %ecx
+    neg = 1;
+    16f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    16f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    16f8:	31 f6                	xor    %esi,%esi
+    16fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1700:	89 c8                	mov    %ecx,%eax
+    1702:	31 d2                	xor    %edx,%edx
+    1704:	89 f7                	mov    %esi,%edi
+    1706:	f7 f3                	div    %ebx
+    1708:	8d 76 01             	lea    0x1(%esi),%esi
+    170b:	0f b6 92 44 1b 00 00 	movzbl 0x1b44(%edx),%edx
+    1712:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1716:	89 ca                	mov    %ecx,%edx
+    1718:	89 c1                	mov    %eax,%ecx
+    171a:	39 da                	cmp    %ebx,%edx
+    171c:	73 e2                	jae    1700 <printint+0x30>
+  if(neg)
+    171e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1721:	85 c0                	test   %eax,%eax
+    1723:	74 07                	je     172c <printint+0x5c>
+    buf[i++] = '-';
+    1725:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    172a:	89 f7                	mov    %esi,%edi
+    172c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    172f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1732:	01 df                	add    %ebx,%edi
+    1734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1738:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    173b:	83 ec 04             	sub    $0x4,%esp
+    173e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1741:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1744:	6a 01                	push   $0x1
+    1746:	50                   	push   %eax
+    1747:	56                   	push   %esi
+    1748:	e8 56 fe ff ff       	call   15a3 <write>
+  while(--i >= 0)
+    174d:	89 f8                	mov    %edi,%eax
+    174f:	83 c4 10             	add    $0x10,%esp
+    1752:	83 ef 01             	sub    $0x1,%edi
+    1755:	39 d8                	cmp    %ebx,%eax
+    1757:	75 df                	jne    1738 <printint+0x68>
+}
+    1759:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    175c:	5b                   	pop    %ebx
+    175d:	5e                   	pop    %esi
+    175e:	5f                   	pop    %edi
+    175f:	5d                   	pop    %ebp
+    1760:	c3                   	ret
+    1761:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1768:	31 c0                	xor    %eax,%eax
+    176a:	eb 89                	jmp    16f5 <printint+0x25>
+    176c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001770 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1770:	55                   	push   %ebp
+    1771:	89 e5                	mov    %esp,%ebp
+    1773:	57                   	push   %edi
+    1774:	56                   	push   %esi
+    1775:	53                   	push   %ebx
+    1776:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1779:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    177c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    177f:	0f b6 1e             	movzbl (%esi),%ebx
+    1782:	83 c6 01             	add    $0x1,%esi
+    1785:	84 db                	test   %bl,%bl
+    1787:	74 67                	je     17f0 <printf+0x80>
+    1789:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    178c:	31 d2                	xor    %edx,%edx
+    178e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1791:	eb 34                	jmp    17c7 <printf+0x57>
+    1793:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1797:	90                   	nop
+    1798:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    179b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    17a0:	83 f8 25             	cmp    $0x25,%eax
+    17a3:	74 18                	je     17bd <printf+0x4d>
+  write(fd, &c, 1);
+    17a5:	83 ec 04             	sub    $0x4,%esp
+    17a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    17ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    17ae:	6a 01                	push   $0x1
+    17b0:	50                   	push   %eax
+    17b1:	57                   	push   %edi
+    17b2:	e8 ec fd ff ff       	call   15a3 <write>
+    17b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    17ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    17bd:	0f b6 1e             	movzbl (%esi),%ebx
+    17c0:	83 c6 01             	add    $0x1,%esi
+    17c3:	84 db                	test   %bl,%bl
+    17c5:	74 29                	je     17f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    17c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    17ca:	85 d2                	test   %edx,%edx
+    17cc:	74 ca                	je     1798 <printf+0x28>
+      }
+    } else if(state == '%'){
+    17ce:	83 fa 25             	cmp    $0x25,%edx
+    17d1:	75 ea                	jne    17bd <printf+0x4d>
+      if(c == 'd'){
+    17d3:	83 f8 25             	cmp    $0x25,%eax
+    17d6:	0f 84 24 01 00 00    	je     1900 <printf+0x190>
+    17dc:	83 e8 63             	sub    $0x63,%eax
+    17df:	83 f8 15             	cmp    $0x15,%eax
+    17e2:	77 1c                	ja     1800 <printf+0x90>
+    17e4:	ff 24 85 ec 1a 00 00 	jmp    *0x1aec(,%eax,4)
+    17eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    17f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17f3:	5b                   	pop    %ebx
+    17f4:	5e                   	pop    %esi
+    17f5:	5f                   	pop    %edi
+    17f6:	5d                   	pop    %ebp
+    17f7:	c3                   	ret
+    17f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ff:	90                   	nop
+  write(fd, &c, 1);
+    1800:	83 ec 04             	sub    $0x4,%esp
+    1803:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1806:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    180a:	6a 01                	push   $0x1
+    180c:	52                   	push   %edx
+    180d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1810:	57                   	push   %edi
+    1811:	e8 8d fd ff ff       	call   15a3 <write>
+    1816:	83 c4 0c             	add    $0xc,%esp
+    1819:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    181c:	6a 01                	push   $0x1
+    181e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1821:	52                   	push   %edx
+    1822:	57                   	push   %edi
+    1823:	e8 7b fd ff ff       	call   15a3 <write>
+        putc(fd, c);
+    1828:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    182b:	31 d2                	xor    %edx,%edx
+    182d:	eb 8e                	jmp    17bd <printf+0x4d>
+    182f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1833:	83 ec 0c             	sub    $0xc,%esp
+    1836:	b9 10 00 00 00       	mov    $0x10,%ecx
+    183b:	8b 13                	mov    (%ebx),%edx
+    183d:	6a 00                	push   $0x0
+    183f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1841:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1844:	e8 87 fe ff ff       	call   16d0 <printint>
+        ap++;
+    1849:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    184c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    184f:	31 d2                	xor    %edx,%edx
+    1851:	e9 67 ff ff ff       	jmp    17bd <printf+0x4d>
+    1856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    185d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1860:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1863:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1865:	83 c0 04             	add    $0x4,%eax
+    1868:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    186b:	85 db                	test   %ebx,%ebx
+    186d:	0f 84 9d 00 00 00    	je     1910 <printf+0x1a0>
+        while(*s != 0){
+    1873:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1876:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1878:	84 c0                	test   %al,%al
+    187a:	0f 84 3d ff ff ff    	je     17bd <printf+0x4d>
+    1880:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1883:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1886:	89 de                	mov    %ebx,%esi
+    1888:	89 d3                	mov    %edx,%ebx
+    188a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1890:	83 ec 04             	sub    $0x4,%esp
+    1893:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1896:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1899:	6a 01                	push   $0x1
+    189b:	53                   	push   %ebx
+    189c:	57                   	push   %edi
+    189d:	e8 01 fd ff ff       	call   15a3 <write>
+        while(*s != 0){
+    18a2:	0f b6 06             	movzbl (%esi),%eax
+    18a5:	83 c4 10             	add    $0x10,%esp
+    18a8:	84 c0                	test   %al,%al
+    18aa:	75 e4                	jne    1890 <printf+0x120>
+      state = 0;
+    18ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    18af:	31 d2                	xor    %edx,%edx
+    18b1:	e9 07 ff ff ff       	jmp    17bd <printf+0x4d>
+    18b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    18c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    18c3:	83 ec 0c             	sub    $0xc,%esp
+    18c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    18cb:	8b 13                	mov    (%ebx),%edx
+    18cd:	6a 01                	push   $0x1
+    18cf:	e9 6b ff ff ff       	jmp    183f <printf+0xcf>
+    18d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    18d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    18db:	83 ec 04             	sub    $0x4,%esp
+    18de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    18e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    18e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    18e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    18e9:	6a 01                	push   $0x1
+    18eb:	52                   	push   %edx
+    18ec:	57                   	push   %edi
+    18ed:	e8 b1 fc ff ff       	call   15a3 <write>
+        ap++;
+    18f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    18f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    18f8:	31 d2                	xor    %edx,%edx
+    18fa:	e9 be fe ff ff       	jmp    17bd <printf+0x4d>
+    18ff:	90                   	nop
+  write(fd, &c, 1);
+    1900:	83 ec 04             	sub    $0x4,%esp
+    1903:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1906:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1909:	6a 01                	push   $0x1
+    190b:	e9 11 ff ff ff       	jmp    1821 <printf+0xb1>
+    1910:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1915:	bb e2 1a 00 00       	mov    $0x1ae2,%ebx
+    191a:	e9 61 ff ff ff       	jmp    1880 <printf+0x110>
+    191f:	90                   	nop
+
+00001920 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1920:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1921:	a1 78 1e 00 00       	mov    0x1e78,%eax
+{
+    1926:	89 e5                	mov    %esp,%ebp
+    1928:	57                   	push   %edi
+    1929:	56                   	push   %esi
+    192a:	53                   	push   %ebx
+    192b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    192e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1931:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1938:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    193a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    193c:	39 ca                	cmp    %ecx,%edx
+    193e:	73 30                	jae    1970 <free+0x50>
+    1940:	39 c1                	cmp    %eax,%ecx
+    1942:	72 04                	jb     1948 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1944:	39 c2                	cmp    %eax,%edx
+    1946:	72 f0                	jb     1938 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1948:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    194b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    194e:	39 f8                	cmp    %edi,%eax
+    1950:	74 2e                	je     1980 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1952:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1955:	8b 42 04             	mov    0x4(%edx),%eax
+    1958:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    195b:	39 f1                	cmp    %esi,%ecx
+    195d:	74 38                	je     1997 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    195f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1961:	5b                   	pop    %ebx
+  freep = p;
+    1962:	89 15 78 1e 00 00    	mov    %edx,0x1e78
+}
+    1968:	5e                   	pop    %esi
+    1969:	5f                   	pop    %edi
+    196a:	5d                   	pop    %ebp
+    196b:	c3                   	ret
+    196c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1970:	39 c1                	cmp    %eax,%ecx
+    1972:	72 d0                	jb     1944 <free+0x24>
+    1974:	eb c2                	jmp    1938 <free+0x18>
+    1976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    197d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1980:	03 70 04             	add    0x4(%eax),%esi
+    1983:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1986:	8b 02                	mov    (%edx),%eax
+    1988:	8b 00                	mov    (%eax),%eax
+    198a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    198d:	8b 42 04             	mov    0x4(%edx),%eax
+    1990:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1993:	39 f1                	cmp    %esi,%ecx
+    1995:	75 c8                	jne    195f <free+0x3f>
+    p->s.size += bp->s.size;
+    1997:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    199a:	89 15 78 1e 00 00    	mov    %edx,0x1e78
+    p->s.size += bp->s.size;
+    19a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    19a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    19a6:	89 0a                	mov    %ecx,(%edx)
+}
+    19a8:	5b                   	pop    %ebx
+    19a9:	5e                   	pop    %esi
+    19aa:	5f                   	pop    %edi
+    19ab:	5d                   	pop    %ebp
+    19ac:	c3                   	ret
+    19ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000019b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    19b0:	55                   	push   %ebp
+    19b1:	89 e5                	mov    %esp,%ebp
+    19b3:	57                   	push   %edi
+    19b4:	56                   	push   %esi
+    19b5:	53                   	push   %ebx
+    19b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    19b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    19bc:	8b 15 78 1e 00 00    	mov    0x1e78,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    19c2:	8d 78 07             	lea    0x7(%eax),%edi
+    19c5:	c1 ef 03             	shr    $0x3,%edi
+    19c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    19cb:	85 d2                	test   %edx,%edx
+    19cd:	0f 84 8d 00 00 00    	je     1a60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    19d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    19d5:	8b 48 04             	mov    0x4(%eax),%ecx
+    19d8:	39 f9                	cmp    %edi,%ecx
+    19da:	73 64                	jae    1a40 <malloc+0x90>
+  if(nu < 4096)
+    19dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    19e1:	39 df                	cmp    %ebx,%edi
+    19e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    19e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    19ed:	eb 0a                	jmp    19f9 <malloc+0x49>
+    19ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    19f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    19f2:	8b 48 04             	mov    0x4(%eax),%ecx
+    19f5:	39 f9                	cmp    %edi,%ecx
+    19f7:	73 47                	jae    1a40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    19f9:	89 c2                	mov    %eax,%edx
+    19fb:	39 05 78 1e 00 00    	cmp    %eax,0x1e78
+    1a01:	75 ed                	jne    19f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1a03:	83 ec 0c             	sub    $0xc,%esp
+    1a06:	56                   	push   %esi
+    1a07:	e8 ff fb ff ff       	call   160b <sbrk>
+  if(p == (char*)-1)
+    1a0c:	83 c4 10             	add    $0x10,%esp
+    1a0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a12:	74 1c                	je     1a30 <malloc+0x80>
+  hp->s.size = nu;
+    1a14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1a17:	83 ec 0c             	sub    $0xc,%esp
+    1a1a:	83 c0 08             	add    $0x8,%eax
+    1a1d:	50                   	push   %eax
+    1a1e:	e8 fd fe ff ff       	call   1920 <free>
+  return freep;
+    1a23:	8b 15 78 1e 00 00    	mov    0x1e78,%edx
+      if((p = morecore(nunits)) == 0)
+    1a29:	83 c4 10             	add    $0x10,%esp
+    1a2c:	85 d2                	test   %edx,%edx
+    1a2e:	75 c0                	jne    19f0 <malloc+0x40>
+        return 0;
+  }
+}
+    1a30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1a33:	31 c0                	xor    %eax,%eax
+}
+    1a35:	5b                   	pop    %ebx
+    1a36:	5e                   	pop    %esi
+    1a37:	5f                   	pop    %edi
+    1a38:	5d                   	pop    %ebp
+    1a39:	c3                   	ret
+    1a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1a40:	39 cf                	cmp    %ecx,%edi
+    1a42:	74 4c                	je     1a90 <malloc+0xe0>
+        p->s.size -= nunits;
+    1a44:	29 f9                	sub    %edi,%ecx
+    1a46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1a49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    1a4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    1a4f:	89 15 78 1e 00 00    	mov    %edx,0x1e78
+}
+    1a55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1a58:	83 c0 08             	add    $0x8,%eax
+}
+    1a5b:	5b                   	pop    %ebx
+    1a5c:	5e                   	pop    %esi
+    1a5d:	5f                   	pop    %edi
+    1a5e:	5d                   	pop    %ebp
+    1a5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1a60:	c7 05 78 1e 00 00 7c 	movl   $0x1e7c,0x1e78
+    1a67:	1e 00 00 
+    base.s.size = 0;
+    1a6a:	b8 7c 1e 00 00       	mov    $0x1e7c,%eax
+    base.s.ptr = freep = prevp = &base;
+    1a6f:	c7 05 7c 1e 00 00 7c 	movl   $0x1e7c,0x1e7c
+    1a76:	1e 00 00 
+    base.s.size = 0;
+    1a79:	c7 05 80 1e 00 00 00 	movl   $0x0,0x1e80
+    1a80:	00 00 00 
+    if(p->s.size >= nunits){
+    1a83:	e9 54 ff ff ff       	jmp    19dc <malloc+0x2c>
+    1a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1a90:	8b 08                	mov    (%eax),%ecx
+    1a92:	89 0a                	mov    %ecx,(%edx)
+    1a94:	eb b9                	jmp    1a4f <malloc+0x9f>
@@ -5,6 +5,7 @@
 #include "mmu.h"
 #include "proc.h"
 #include "x86.h"
+#include "rand.h"
 
 static void startothers(void);
 static void mpmain(void)  __attribute__((noreturn));
@@ -27,6 +28,7 @@ main(void)
   consoleinit();   // console hardware
   uartinit();      // serial port
   pinit();         // process table
+  mminit();        // address spaces
   tvinit();        // trap vectors
   binit();         // buffer cache
   fileinit();      // file table
@@ -53,6 +55,7 @@ mpmain(void)
 {
   cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
   idtinit();       // load idt register
+  srandcpu(rdtsc() ^ cpuid()); // seed this processor's lottery draws
   xchg(&(mycpu()->started), 1); // tell startothers() we're up
   scheduler();     // start running processes
 }
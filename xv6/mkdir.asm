@@ -0,0 +1,1270 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	bf 01 00 00 00       	mov    $0x1,%edi
+    1013:	56                   	push   %esi
+    1014:	53                   	push   %ebx
+    1015:	51                   	push   %ecx
+    1016:	83 ec 08             	sub    $0x8,%esp
+    1019:	8b 59 04             	mov    0x4(%ecx),%ebx
+    101c:	8b 31                	mov    (%ecx),%esi
+    101e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+    1021:	83 fe 01             	cmp    $0x1,%esi
+    1024:	7f 14                	jg     103a <main+0x3a>
+    1026:	eb 3a                	jmp    1062 <main+0x62>
+    1028:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    102f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+    1030:	83 c7 01             	add    $0x1,%edi
+    1033:	83 c3 04             	add    $0x4,%ebx
+    1036:	39 fe                	cmp    %edi,%esi
+    1038:	74 23                	je     105d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+    103a:	83 ec 0c             	sub    $0xc,%esp
+    103d:	ff 33                	push   (%ebx)
+    103f:	e8 e7 02 00 00       	call   132b <mkdir>
+    1044:	83 c4 10             	add    $0x10,%esp
+    1047:	85 c0                	test   %eax,%eax
+    1049:	79 e5                	jns    1030 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+    104b:	50                   	push   %eax
+    104c:	ff 33                	push   (%ebx)
+    104e:	68 ef 17 00 00       	push   $0x17ef
+    1053:	6a 02                	push   $0x2
+    1055:	e8 56 04 00 00       	call   14b0 <printf>
+      break;
+    105a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+    105d:	e8 61 02 00 00       	call   12c3 <exit>
+    printf(2, "Usage: mkdir files...\n");
+    1062:	52                   	push   %edx
+    1063:	52                   	push   %edx
+    1064:	68 d8 17 00 00       	push   $0x17d8
+    1069:	6a 02                	push   $0x2
+    106b:	e8 40 04 00 00       	call   14b0 <printf>
+    exit();
+    1070:	e8 4e 02 00 00       	call   12c3 <exit>
+    1075:	66 90                	xchg   %ax,%ax
+    1077:	66 90                	xchg   %ax,%ax
+    1079:	66 90                	xchg   %ax,%ax
+    107b:	66 90                	xchg   %ax,%ax
+    107d:	66 90                	xchg   %ax,%ax
+    107f:	90                   	nop
+
+00001080 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1080:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1081:	31 c0                	xor    %eax,%eax
+{
+    1083:	89 e5                	mov    %esp,%ebp
+    1085:	53                   	push   %ebx
+    1086:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1089:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    108c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1090:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1094:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1097:	83 c0 01             	add    $0x1,%eax
+    109a:	84 d2                	test   %dl,%dl
+    109c:	75 f2                	jne    1090 <strcpy+0x10>
+    ;
+  return os;
+}
+    109e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10a1:	89 c8                	mov    %ecx,%eax
+    10a3:	c9                   	leave
+    10a4:	c3                   	ret
+    10a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000010b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	53                   	push   %ebx
+    10b4:	8b 55 08             	mov    0x8(%ebp),%edx
+    10b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    10ba:	0f b6 02             	movzbl (%edx),%eax
+    10bd:	84 c0                	test   %al,%al
+    10bf:	75 17                	jne    10d8 <strcmp+0x28>
+    10c1:	eb 3a                	jmp    10fd <strcmp+0x4d>
+    10c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10c7:	90                   	nop
+    10c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    10cc:	83 c2 01             	add    $0x1,%edx
+    10cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    10d2:	84 c0                	test   %al,%al
+    10d4:	74 1a                	je     10f0 <strcmp+0x40>
+    p++, q++;
+    10d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    10d8:	0f b6 19             	movzbl (%ecx),%ebx
+    10db:	38 c3                	cmp    %al,%bl
+    10dd:	74 e9                	je     10c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    10df:	29 d8                	sub    %ebx,%eax
+}
+    10e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10e4:	c9                   	leave
+    10e5:	c3                   	ret
+    10e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    10f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    10f4:	31 c0                	xor    %eax,%eax
+    10f6:	29 d8                	sub    %ebx,%eax
+}
+    10f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10fb:	c9                   	leave
+    10fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    10fd:	0f b6 19             	movzbl (%ecx),%ebx
+    1100:	31 c0                	xor    %eax,%eax
+    1102:	eb db                	jmp    10df <strcmp+0x2f>
+    1104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    110b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    110f:	90                   	nop
+
+00001110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1116:	80 3a 00             	cmpb   $0x0,(%edx)
+    1119:	74 15                	je     1130 <strlen+0x20>
+    111b:	31 c0                	xor    %eax,%eax
+    111d:	8d 76 00             	lea    0x0(%esi),%esi
+    1120:	83 c0 01             	add    $0x1,%eax
+    1123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1127:	89 c1                	mov    %eax,%ecx
+    1129:	75 f5                	jne    1120 <strlen+0x10>
+    ;
+  return n;
+}
+    112b:	89 c8                	mov    %ecx,%eax
+    112d:	5d                   	pop    %ebp
+    112e:	c3                   	ret
+    112f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1130:	31 c9                	xor    %ecx,%ecx
+}
+    1132:	5d                   	pop    %ebp
+    1133:	89 c8                	mov    %ecx,%eax
+    1135:	c3                   	ret
+    1136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	57                   	push   %edi
+    1144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    114a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    114d:	89 d7                	mov    %edx,%edi
+    114f:	fc                   	cld
+    1150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1155:	89 d0                	mov    %edx,%eax
+    1157:	c9                   	leave
+    1158:	c3                   	ret
+    1159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	8b 45 08             	mov    0x8(%ebp),%eax
+    1166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    116a:	0f b6 10             	movzbl (%eax),%edx
+    116d:	84 d2                	test   %dl,%dl
+    116f:	75 12                	jne    1183 <strchr+0x23>
+    1171:	eb 1d                	jmp    1190 <strchr+0x30>
+    1173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1177:	90                   	nop
+    1178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    117c:	83 c0 01             	add    $0x1,%eax
+    117f:	84 d2                	test   %dl,%dl
+    1181:	74 0d                	je     1190 <strchr+0x30>
+    if(*s == c)
+    1183:	38 d1                	cmp    %dl,%cl
+    1185:	75 f1                	jne    1178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1187:	5d                   	pop    %ebp
+    1188:	c3                   	ret
+    1189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1190:	31 c0                	xor    %eax,%eax
+}
+    1192:	5d                   	pop    %ebp
+    1193:	c3                   	ret
+    1194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    119b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    119f:	90                   	nop
+
+000011a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    11a0:	55                   	push   %ebp
+    11a1:	89 e5                	mov    %esp,%ebp
+    11a3:	57                   	push   %edi
+    11a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    11a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    11a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    11a9:	31 db                	xor    %ebx,%ebx
+{
+    11ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    11ae:	eb 27                	jmp    11d7 <gets+0x37>
+    cc = read(0, &c, 1);
+    11b0:	83 ec 04             	sub    $0x4,%esp
+    11b3:	6a 01                	push   $0x1
+    11b5:	56                   	push   %esi
+    11b6:	6a 00                	push   $0x0
+    11b8:	e8 1e 01 00 00       	call   12db <read>
+    if(cc < 1)
+    11bd:	83 c4 10             	add    $0x10,%esp
+    11c0:	85 c0                	test   %eax,%eax
+    11c2:	7e 1d                	jle    11e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    11c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    11c8:	8b 55 08             	mov    0x8(%ebp),%edx
+    11cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    11cf:	3c 0a                	cmp    $0xa,%al
+    11d1:	74 10                	je     11e3 <gets+0x43>
+    11d3:	3c 0d                	cmp    $0xd,%al
+    11d5:	74 0c                	je     11e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    11d7:	89 df                	mov    %ebx,%edi
+    11d9:	83 c3 01             	add    $0x1,%ebx
+    11dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    11df:	7c cf                	jl     11b0 <gets+0x10>
+    11e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    11e3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    11ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11ed:	5b                   	pop    %ebx
+    11ee:	5e                   	pop    %esi
+    11ef:	5f                   	pop    %edi
+    11f0:	5d                   	pop    %ebp
+    11f1:	c3                   	ret
+    11f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	56                   	push   %esi
+    1204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1205:	83 ec 08             	sub    $0x8,%esp
+    1208:	6a 00                	push   $0x0
+    120a:	ff 75 08             	push   0x8(%ebp)
+    120d:	e8 f1 00 00 00       	call   1303 <open>
+  if(fd < 0)
+    1212:	83 c4 10             	add    $0x10,%esp
+    1215:	85 c0                	test   %eax,%eax
+    1217:	78 27                	js     1240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1219:	83 ec 08             	sub    $0x8,%esp
+    121c:	ff 75 0c             	push   0xc(%ebp)
+    121f:	89 c3                	mov    %eax,%ebx
+    1221:	50                   	push   %eax
+    1222:	e8 f4 00 00 00       	call   131b <fstat>
+  close(fd);
+    1227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    122a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    122c:	e8 ba 00 00 00       	call   12eb <close>
+  return r;
+    1231:	83 c4 10             	add    $0x10,%esp
+}
+    1234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1237:	89 f0                	mov    %esi,%eax
+    1239:	5b                   	pop    %ebx
+    123a:	5e                   	pop    %esi
+    123b:	5d                   	pop    %ebp
+    123c:	c3                   	ret
+    123d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1245:	eb ed                	jmp    1234 <stat+0x34>
+    1247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    124e:	66 90                	xchg   %ax,%ax
+
+00001250 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1250:	55                   	push   %ebp
+    1251:	89 e5                	mov    %esp,%ebp
+    1253:	53                   	push   %ebx
+    1254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1257:	0f be 02             	movsbl (%edx),%eax
+    125a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    125d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1265:	77 1e                	ja     1285 <atoi+0x35>
+    1267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    126e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1270:	83 c2 01             	add    $0x1,%edx
+    1273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    127a:	0f be 02             	movsbl (%edx),%eax
+    127d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1280:	80 fb 09             	cmp    $0x9,%bl
+    1283:	76 eb                	jbe    1270 <atoi+0x20>
+  return n;
+}
+    1285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1288:	89 c8                	mov    %ecx,%eax
+    128a:	c9                   	leave
+    128b:	c3                   	ret
+    128c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	57                   	push   %edi
+    1294:	56                   	push   %esi
+    1295:	8b 45 10             	mov    0x10(%ebp),%eax
+    1298:	8b 55 08             	mov    0x8(%ebp),%edx
+    129b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    129e:	85 c0                	test   %eax,%eax
+    12a0:	7e 13                	jle    12b5 <memmove+0x25>
+    12a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    12a4:	89 d7                	mov    %edx,%edi
+    12a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    12b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    12b1:	39 f8                	cmp    %edi,%eax
+    12b3:	75 fb                	jne    12b0 <memmove+0x20>
+  return vdst;
+}
+    12b5:	5e                   	pop    %esi
+    12b6:	89 d0                	mov    %edx,%eax
+    12b8:	5f                   	pop    %edi
+    12b9:	5d                   	pop    %ebp
+    12ba:	c3                   	ret
+
+000012bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    12bb:	b8 01 00 00 00       	mov    $0x1,%eax
+    12c0:	cd 40                	int    $0x40
+    12c2:	c3                   	ret
+
+000012c3 <exit>:
+SYSCALL(exit)
+    12c3:	b8 02 00 00 00       	mov    $0x2,%eax
+    12c8:	cd 40                	int    $0x40
+    12ca:	c3                   	ret
+
+000012cb <wait>:
+SYSCALL(wait)
+    12cb:	b8 03 00 00 00       	mov    $0x3,%eax
+    12d0:	cd 40                	int    $0x40
+    12d2:	c3                   	ret
+
+000012d3 <pipe>:
+SYSCALL(pipe)
+    12d3:	b8 04 00 00 00       	mov    $0x4,%eax
+    12d8:	cd 40                	int    $0x40
+    12da:	c3                   	ret
+
+000012db <read>:
+SYSCALL(read)
+    12db:	b8 05 00 00 00       	mov    $0x5,%eax
+    12e0:	cd 40                	int    $0x40
+    12e2:	c3                   	ret
+
+000012e3 <write>:
+SYSCALL(write)
+    12e3:	b8 10 00 00 00       	mov    $0x10,%eax
+    12e8:	cd 40                	int    $0x40
+    12ea:	c3                   	ret
+
+000012eb <close>:
+SYSCALL(close)
+    12eb:	b8 15 00 00 00       	mov    $0x15,%eax
+    12f0:	cd 40                	int    $0x40
+    12f2:	c3                   	ret
+
+000012f3 <kill>:
+SYSCALL(kill)
+    12f3:	b8 06 00 00 00       	mov    $0x6,%eax
+    12f8:	cd 40                	int    $0x40
+    12fa:	c3                   	ret
+
+000012fb <exec>:
+SYSCALL(exec)
+    12fb:	b8 07 00 00 00       	mov    $0x7,%eax
+    1300:	cd 40                	int    $0x40
+    1302:	c3                   	ret
+
+00001303 <open>:
+SYSCALL(open)
+    1303:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1308:	cd 40                	int    $0x40
+    130a:	c3                   	ret
+
+0000130b <mknod>:
+SYSCALL(mknod)
+    130b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1310:	cd 40                	int    $0x40
+    1312:	c3                   	ret
+
+00001313 <unlink>:
+SYSCALL(unlink)
+    1313:	b8 12 00 00 00       	mov    $0x12,%eax
+    1318:	cd 40                	int    $0x40
+    131a:	c3                   	ret
+
+0000131b <fstat>:
+SYSCALL(fstat)
+    131b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1320:	cd 40                	int    $0x40
+    1322:	c3                   	ret
+
+00001323 <link>:
+SYSCALL(link)
+    1323:	b8 13 00 00 00       	mov    $0x13,%eax
+    1328:	cd 40                	int    $0x40
+    132a:	c3                   	ret
+
+0000132b <mkdir>:
+SYSCALL(mkdir)
+    132b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1330:	cd 40                	int    $0x40
+    1332:	c3                   	ret
+
+00001333 <chdir>:
+SYSCALL(chdir)
+    1333:	b8 09 00 00 00       	mov    $0x9,%eax
+    1338:	cd 40                	int    $0x40
+    133a:	c3                   	ret
+
+0000133b <dup>:
+SYSCALL(dup)
+    133b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1340:	cd 40                	int    $0x40
+    1342:	c3                   	ret
+
+00001343 <getpid>:
+SYSCALL(getpid)
+    1343:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1348:	cd 40                	int    $0x40
+    134a:	c3                   	ret
+
+0000134b <sbrk>:
+SYSCALL(sbrk)
+    134b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1350:	cd 40                	int    $0x40
+    1352:	c3                   	ret
+
+00001353 <sleep>:
+SYSCALL(sleep)
+    1353:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1358:	cd 40                	int    $0x40
+    135a:	c3                   	ret
+
+0000135b <uptime>:
+SYSCALL(uptime)
+    135b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1360:	cd 40                	int    $0x40
+    1362:	c3                   	ret
+
+00001363 <settickets>:
+SYSCALL(settickets)
+    1363:	b8 16 00 00 00       	mov    $0x16,%eax
+    1368:	cd 40                	int    $0x40
+    136a:	c3                   	ret
+
+0000136b <getpinfo>:
+SYSCALL(getpinfo)
+    136b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1370:	cd 40                	int    $0x40
+    1372:	c3                   	ret
+
+00001373 <mprotect>:
+SYSCALL(mprotect)
+    1373:	b8 18 00 00 00       	mov    $0x18,%eax
+    1378:	cd 40                	int    $0x40
+    137a:	c3                   	ret
+
+0000137b <munprotect>:
+SYSCALL(munprotect)
+    137b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1380:	cd 40                	int    $0x40
+    1382:	c3                   	ret
+
+00001383 <clone>:
+SYSCALL(clone)
+    1383:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1388:	cd 40                	int    $0x40
+    138a:	c3                   	ret
+
+0000138b <join>:
+SYSCALL(join)
+    138b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1390:	cd 40                	int    $0x40
+    1392:	c3                   	ret
+
+00001393 <initlock_t>:
+SYSCALL(initlock_t)
+    1393:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1398:	cd 40                	int    $0x40
+    139a:	c3                   	ret
+
+0000139b <acquire_t>:
+SYSCALL(acquire_t)
+    139b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    13a0:	cd 40                	int    $0x40
+    13a2:	c3                   	ret
+
+000013a3 <release_t>:
+SYSCALL(release_t)
+    13a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    13a8:	cd 40                	int    $0x40
+    13aa:	c3                   	ret
+
+000013ab <setsched>:
+SYSCALL(setsched)
+    13ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    13b0:	cd 40                	int    $0x40
+    13b2:	c3                   	ret
+
+000013b3 <mkgroup>:
+SYSCALL(mkgroup)
+    13b3:	b8 20 00 00 00       	mov    $0x20,%eax
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+
+000013bb <joingroup>:
+SYSCALL(joingroup)
+    13bb:	b8 21 00 00 00       	mov    $0x21,%eax
+    13c0:	cd 40                	int    $0x40
+    13c2:	c3                   	ret
+
+000013c3 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    13c3:	b8 22 00 00 00       	mov    $0x22,%eax
+    13c8:	cd 40                	int    $0x40
+    13ca:	c3                   	ret
+
+000013cb <setdeadline>:
+SYSCALL(setdeadline)
+    13cb:	b8 23 00 00 00       	mov    $0x23,%eax
+    13d0:	cd 40                	int    $0x40
+    13d2:	c3                   	ret
+
+000013d3 <setaffinity>:
+SYSCALL(setaffinity)
+    13d3:	b8 24 00 00 00       	mov    $0x24,%eax
+    13d8:	cd 40                	int    $0x40
+    13da:	c3                   	ret
+
+000013db <yield_to>:
+SYSCALL(yield_to)
+    13db:	b8 25 00 00 00       	mov    $0x25,%eax
+    13e0:	cd 40                	int    $0x40
+    13e2:	c3                   	ret
+
+000013e3 <getlatency>:
+SYSCALL(getlatency)
+    13e3:	b8 26 00 00 00       	mov    $0x26,%eax
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+
+000013eb <futex_wait>:
+SYSCALL(futex_wait)
+    13eb:	b8 27 00 00 00       	mov    $0x27,%eax
+    13f0:	cd 40                	int    $0x40
+    13f2:	c3                   	ret
+
+000013f3 <futex_wake>:
+SYSCALL(futex_wake)
+    13f3:	b8 28 00 00 00       	mov    $0x28,%eax
+    13f8:	cd 40                	int    $0x40
+    13fa:	c3                   	ret
+
+000013fb <mguard>:
+SYSCALL(mguard)
+    13fb:	b8 29 00 00 00       	mov    $0x29,%eax
+    1400:	cd 40                	int    $0x40
+    1402:	c3                   	ret
+
+00001403 <join_any>:
+SYSCALL(join_any)
+    1403:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1408:	cd 40                	int    $0x40
+    140a:	c3                   	ret
+    140b:	66 90                	xchg   %ax,%ax
+    140d:	66 90                	xchg   %ax,%ax
+    140f:	90                   	nop
+
+00001410 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1410:	55                   	push   %ebp
+    1411:	89 e5                	mov    %esp,%ebp
+    1413:	57                   	push   %edi
+    1414:	56                   	push   %esi
+    1415:	53                   	push   %ebx
+    1416:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1418:	89 d1                	mov    %edx,%ecx
+{
+    141a:	83 ec 3c             	sub    $0x3c,%esp
+    141d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1420:	85 d2                	test   %edx,%edx
+    1422:	0f 89 80 00 00 00    	jns    14a8 <printint+0x98>
+    1428:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    142c:	74 7a                	je     14a8 <printint+0x98>
+    x = -xx;
+    142e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1430:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1435:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1438:	31 f6                	xor    %esi,%esi
+    143a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1440:	89 c8                	mov    %ecx,%eax
+    1442:	31 d2                	xor    %edx,%edx
+    1444:	89 f7                	mov    %esi,%edi
+    1446:	f7 f3                	div    %ebx
+    1448:	8d 76 01             	lea    0x1(%esi),%esi
+    144b:	0f b6 92 6c 18 00 00 	movzbl 0x186c(%edx),%edx
+    1452:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1456:	89 ca                	mov    %ecx,%edx
+    1458:	89 c1                	mov    %eax,%ecx
+    145a:	39 da                	cmp    %ebx,%edx
+    145c:	73 e2                	jae    1440 <printint+0x30>
+  if(neg)
+    145e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1461:	85 c0                	test   %eax,%eax
+    1463:	74 07                	je     146c <printint+0x5c>
+    buf[i++] = '-';
+    1465:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    146a:	89 f7                	mov    %esi,%edi
+    146c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    146f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1472:	01 df                	add    %ebx,%edi
+    1474:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1478:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    147b:	83 ec 04             	sub    $0x4,%esp
+    147e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1481:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1484:	6a 01                	push   $0x1
+    1486:	50                   	push   %eax
+    1487:	56                   	push   %esi
+    1488:	e8 56 fe ff ff       	call   12e3 <write>
+  while(--i >= 0)
+    148d:	89 f8                	mov    %edi,%eax
+    148f:	83 c4 10             	add    $0x10,%esp
+    1492:	83 ef 01             	sub    $0x1,%edi
+    1495:	39 d8                	cmp    %ebx,%eax
+    1497:	75 df                	jne    1478 <printint+0x68>
+}
+    1499:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    149c:	5b                   	pop    %ebx
+    149d:	5e                   	pop    %esi
+    149e:	5f                   	pop    %edi
+    149f:	5d                   	pop    %ebp
+    14a0:	c3                   	ret
+    14a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    14a8:	31 c0                	xor    %eax,%eax
+    14aa:	eb 89                	jmp    1435 <printint+0x25>
+    14ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000014b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    14b0:	55                   	push   %ebp
+    14b1:	89 e5                	mov    %esp,%ebp
+    14b3:	57                   	push   %edi
+    14b4:	56                   	push   %esi
+    14b5:	53                   	push   %ebx
+    14b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    14b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    14bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    14bf:	0f b6 1e             	movzbl (%esi),%ebx
+    14c2:	83 c6 01             	add    $0x1,%esi
+    14c5:	84 db                	test   %bl,%bl
+    14c7:	74 67                	je     1530 <printf+0x80>
+    14c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    14cc:	31 d2                	xor    %edx,%edx
+    14ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    14d1:	eb 34                	jmp    1507 <printf+0x57>
+    14d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14d7:	90                   	nop
+    14d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    14db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    14e0:	83 f8 25             	cmp    $0x25,%eax
+    14e3:	74 18                	je     14fd <printf+0x4d>
+  write(fd, &c, 1);
+    14e5:	83 ec 04             	sub    $0x4,%esp
+    14e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    14eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    14ee:	6a 01                	push   $0x1
+    14f0:	50                   	push   %eax
+    14f1:	57                   	push   %edi
+    14f2:	e8 ec fd ff ff       	call   12e3 <write>
+    14f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    14fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    14fd:	0f b6 1e             	movzbl (%esi),%ebx
+    1500:	83 c6 01             	add    $0x1,%esi
+    1503:	84 db                	test   %bl,%bl
+    1505:	74 29                	je     1530 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1507:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    150a:	85 d2                	test   %edx,%edx
+    150c:	74 ca                	je     14d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    150e:	83 fa 25             	cmp    $0x25,%edx
+    1511:	75 ea                	jne    14fd <printf+0x4d>
+      if(c == 'd'){
+    1513:	83 f8 25             	cmp    $0x25,%eax
+    1516:	0f 84 24 01 00 00    	je     1640 <printf+0x190>
+    151c:	83 e8 63             	sub    $0x63,%eax
+    151f:	83 f8 15             	cmp    $0x15,%eax
+    1522:	77 1c                	ja     1540 <printf+0x90>
+    1524:	ff 24 85 14 18 00 00 	jmp    *0x1814(,%eax,4)
+    152b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    152f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1530:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1533:	5b                   	pop    %ebx
+    1534:	5e                   	pop    %esi
+    1535:	5f                   	pop    %edi
+    1536:	5d                   	pop    %ebp
+    1537:	c3                   	ret
+    1538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    153f:	90                   	nop
+  write(fd, &c, 1);
+    1540:	83 ec 04             	sub    $0x4,%esp
+    1543:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1546:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    154a:	6a 01                	push   $0x1
+    154c:	52                   	push   %edx
+    154d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1550:	57                   	push   %edi
+    1551:	e8 8d fd ff ff       	call   12e3 <write>
+    1556:	83 c4 0c             	add    $0xc,%esp
+    1559:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    155c:	6a 01                	push   $0x1
+    155e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1561:	52                   	push   %edx
+    1562:	57                   	push   %edi
+    1563:	e8 7b fd ff ff       	call   12e3 <write>
+        putc(fd, c);
+    1568:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    156b:	31 d2                	xor    %edx,%edx
+    156d:	eb 8e                	jmp    14fd <printf+0x4d>
+    156f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1570:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1573:	83 ec 0c             	sub    $0xc,%esp
+    1576:	b9 10 00 00 00       	mov    $0x10,%ecx
+    157b:	8b 13                	mov    (%ebx),%edx
+    157d:	6a 00                	push   $0x0
+    157f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1581:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1584:	e8 87 fe ff ff       	call   1410 <printint>
+        ap++;
+    1589:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    158c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    158f:	31 d2                	xor    %edx,%edx
+    1591:	e9 67 ff ff ff       	jmp    14fd <printf+0x4d>
+    1596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    159d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    15a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    15a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    15a5:	83 c0 04             	add    $0x4,%eax
+    15a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    15ab:	85 db                	test   %ebx,%ebx
+    15ad:	0f 84 9d 00 00 00    	je     1650 <printf+0x1a0>
+        while(*s != 0){
+    15b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    15b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    15b8:	84 c0                	test   %al,%al
+    15ba:	0f 84 3d ff ff ff    	je     14fd <printf+0x4d>
+    15c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    15c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    15c6:	89 de                	mov    %ebx,%esi
+    15c8:	89 d3                	mov    %edx,%ebx
+    15ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    15d0:	83 ec 04             	sub    $0x4,%esp
+    15d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    15d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    15d9:	6a 01                	push   $0x1
+    15db:	53                   	push   %ebx
+    15dc:	57                   	push   %edi
+    15dd:	e8 01 fd ff ff       	call   12e3 <write>
+        while(*s != 0){
+    15e2:	0f b6 06             	movzbl (%esi),%eax
+    15e5:	83 c4 10             	add    $0x10,%esp
+    15e8:	84 c0                	test   %al,%al
+    15ea:	75 e4                	jne    15d0 <printf+0x120>
+      state = 0;
+    15ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    15ef:	31 d2                	xor    %edx,%edx
+    15f1:	e9 07 ff ff ff       	jmp    14fd <printf+0x4d>
+    15f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1600:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1603:	83 ec 0c             	sub    $0xc,%esp
+    1606:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    160b:	8b 13                	mov    (%ebx),%edx
+    160d:	6a 01                	push   $0x1
+    160f:	e9 6b ff ff ff       	jmp    157f <printf+0xcf>
+    1614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1618:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    161b:	83 ec 04             	sub    $0x4,%esp
+    161e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1621:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1623:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1626:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1629:	6a 01                	push   $0x1
+    162b:	52                   	push   %edx
+    162c:	57                   	push   %edi
+    162d:	e8 b1 fc ff ff       	call   12e3 <write>
+        ap++;
+    1632:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1635:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1638:	31 d2                	xor    %edx,%edx
+    163a:	e9 be fe ff ff       	jmp    14fd <printf+0x4d>
+    163f:	90                   	nop
+  write(fd, &c, 1);
+    1640:	83 ec 04             	sub    $0x4,%esp
+    1643:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1646:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1649:	6a 01                	push   $0x1
+    164b:	e9 11 ff ff ff       	jmp    1561 <printf+0xb1>
+    1650:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1655:	bb 0b 18 00 00       	mov    $0x180b,%ebx
+    165a:	e9 61 ff ff ff       	jmp    15c0 <printf+0x110>
+    165f:	90                   	nop
+
+00001660 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1660:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1661:	a1 18 1b 00 00       	mov    0x1b18,%eax
+{
+    1666:	89 e5                	mov    %esp,%ebp
+    1668:	57                   	push   %edi
+    1669:	56                   	push   %esi
+    166a:	53                   	push   %ebx
+    166b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    166e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1678:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    167a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    167c:	39 ca                	cmp    %ecx,%edx
+    167e:	73 30                	jae    16b0 <free+0x50>
+    1680:	39 c1                	cmp    %eax,%ecx
+    1682:	72 04                	jb     1688 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1684:	39 c2                	cmp    %eax,%edx
+    1686:	72 f0                	jb     1678 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1688:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    168b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    168e:	39 f8                	cmp    %edi,%eax
+    1690:	74 2e                	je     16c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1692:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1695:	8b 42 04             	mov    0x4(%edx),%eax
+    1698:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    169b:	39 f1                	cmp    %esi,%ecx
+    169d:	74 38                	je     16d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    169f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    16a1:	5b                   	pop    %ebx
+  freep = p;
+    16a2:	89 15 18 1b 00 00    	mov    %edx,0x1b18
+}
+    16a8:	5e                   	pop    %esi
+    16a9:	5f                   	pop    %edi
+    16aa:	5d                   	pop    %ebp
+    16ab:	c3                   	ret
+    16ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16b0:	39 c1                	cmp    %eax,%ecx
+    16b2:	72 d0                	jb     1684 <free+0x24>
+    16b4:	eb c2                	jmp    1678 <free+0x18>
+    16b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    16c0:	03 70 04             	add    0x4(%eax),%esi
+    16c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    16c6:	8b 02                	mov    (%edx),%eax
+    16c8:	8b 00                	mov    (%eax),%eax
+    16ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    16cd:	8b 42 04             	mov    0x4(%edx),%eax
+    16d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    16d3:	39 f1                	cmp    %esi,%ecx
+    16d5:	75 c8                	jne    169f <free+0x3f>
+    p->s.size += bp->s.size;
+    16d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    16da:	89 15 18 1b 00 00    	mov    %edx,0x1b18
+    p->s.size += bp->s.size;
+    16e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    16e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    16e6:	89 0a                	mov    %ecx,(%edx)
+}
+    16e8:	5b                   	pop    %ebx
+    16e9:	5e                   	pop    %esi
+    16ea:	5f                   	pop    %edi
+    16eb:	5d                   	pop    %ebp
+    16ec:	c3                   	ret
+    16ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000016f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    16f0:	55                   	push   %ebp
+    16f1:	89 e5                	mov    %esp,%ebp
+    16f3:	57                   	push   %edi
+    16f4:	56                   	push   %esi
+    16f5:	53                   	push   %ebx
+    16f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    16f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    16fc:	8b 15 18 1b 00 00    	mov    0x1b18,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1702:	8d 78 07             	lea    0x7(%eax),%edi
+    1705:	c1 ef 03             	shr    $0x3,%edi
+    1708:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    170b:	85 d2                	test   %edx,%edx
+    170d:	0f 84 8d 00 00 00    	je     17a0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1713:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1715:	8b 48 04             	mov    0x4(%eax),%ecx
+    1718:	39 f9                	cmp    %edi,%ecx
+    171a:	73 64                	jae    1780 <malloc+0x90>
+  if(nu < 4096)
+    171c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1721:	39 df                	cmp    %ebx,%edi
+    1723:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1726:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    172d:	eb 0a                	jmp    1739 <malloc+0x49>
+    172f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1730:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1732:	8b 48 04             	mov    0x4(%eax),%ecx
+    1735:	39 f9                	cmp    %edi,%ecx
+    1737:	73 47                	jae    1780 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1739:	89 c2                	mov    %eax,%edx
+    173b:	39 05 18 1b 00 00    	cmp    %eax,0x1b18
+    1741:	75 ed                	jne    1730 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1743:	83 ec 0c             	sub    $0xc,%esp
+    1746:	56                   	push   %esi
+    1747:	e8 ff fb ff ff       	call   134b <sbrk>
+  if(p == (char*)-1)
+    174c:	83 c4 10             	add    $0x10,%esp
+    174f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1752:	74 1c                	je     1770 <malloc+0x80>
+  hp->s.size = nu;
+    1754:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1757:	83 ec 0c             	sub    $0xc,%esp
+    175a:	83 c0 08             	add    $0x8,%eax
+    175d:	50                   	push   %eax
+    175e:	e8 fd fe ff ff       	call   1660 <free>
+  return freep;
+    1763:	8b 15 18 1b 00 00    	mov    0x1b18,%edx
+      if((p = morecore(nunits)) == 0)
+    1769:	83 c4 10             	add    $0x10,%esp
+    176c:	85 d2                	test   %edx,%edx
+    176e:	75 c0                	jne    1730 <malloc+0x40>
+        return 0;
+  }
+}
+    1770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1773:	31 c0                	xor    %eax,%eax
+}
+    1775:	5b                   	pop    %ebx
+    1776:	5e                   	pop    %esi
+    1777:	5f                   	pop    %edi
+    1778:	5d                   	pop    %ebp
+    1779:	c3                   	ret
+    177a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1780:	39 cf                	cmp    %ecx,%edi
+    1782:	74 4c                	je     17d0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1784:	29 f9                	sub    %edi,%ecx
+    1786:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1789:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    178c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    178f:	89 15 18 1b 00 00    	mov    %edx,0x1b18
+}
+    1795:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1798:	83 c0 08             	add    $0x8,%eax
+}
+    179b:	5b                   	pop    %ebx
+    179c:	5e                   	pop    %esi
+    179d:	5f                   	pop    %edi
+    179e:	5d                   	pop    %ebp
+    179f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    17a0:	c7 05 18 1b 00 00 1c 	movl   $0x1b1c,0x1b18
+    17a7:	1b 00 00 
+    base.s.size = 0;
+    17aa:	b8 1c 1b 00 00       	mov    $0x1b1c,%eax
+    base.s.ptr = freep = prevp = &base;
+    17af:	c7 05 1c 1b 00 00 1c 	movl   $0x1b1c,0x1b1c
+    17b6:	1b 00 00 
+    base.s.size = 0;
+    17b9:	c7 05 20 1b 00 00 00 	movl   $0x0,0x1b20
+    17c0:	00 00 00 
+    if(p->s.size >= nunits){
+    17c3:	e9 54 ff ff ff       	jmp    171c <malloc+0x2c>
+    17c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    17d0:	8b 08                	mov    (%eax),%ecx
+    17d2:	89 0a                	mov    %ecx,(%edx)
+    17d4:	eb b9                	jmp    178f <malloc+0x9f>
@@ -0,0 +1,11 @@
+// Address space, shared by a process and its threads.
+struct mm {
+  struct spinlock lock;        // Protects sz and ref
+  struct sleeplock vmlock;     // Held while growing, shrinking or copying
+  pde_t* pgdir;                // Page table
+  uint sz;                     // Size of process memory (bytes)
+  int ref;                     // Processes using it
+  uint deadstacks;             // Stacks of exited detached threads, linked
+                               // through their first words, under vmlock
+  struct mm *next;             // Next on the free list
+};
@@ -1,4 +1,10 @@
-#define NPROC        64  // maximum number of processes
+#define NPROC      1024  // maximum number of processes; memory runs out first,
+                         // at about 800, as each needs some 70 pages of kernel
+                         // page tables and stacks with PHYSTOP at 224MB
+#define NPIDHASH   1024  // buckets in the pid hash table
+#define NSLEEPQ     256  // sleep queues wakeup() chooses from by channel
+#define LOCKSPIN  10000  // reads acquire_t() spins for before sleeping
+#define NPSTAT       64  // processes reported by getpinfo()
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
@@ -10,5 +16,12 @@
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define FSSIZE       2000  // size of file system in blocks
+#define MAXTICKETS 100000  // most tickets one process or group may hold
+#define NGROUP       16  // maximum number of ticket groups
+#define RTUTIL      900  // permille of a CPU real-time processes may reserve
+#define NLATBUCKET   32  // scheduling latency histogram buckets, see getlatency()
+#define NMLFQ         3  // MLFQ priority levels
+#define MLFQSLICE(l) (1 << (l))  // ticks a process may run on level l
+#define MLFQBOOST   100  // ticks between moving everyone back to level 0
 
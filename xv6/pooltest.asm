@@ -0,0 +1,3520 @@
+
+_pooltest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+	square[i] += i * i;
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	56                   	push   %esi
+    100e:	53                   	push   %ebx
+    100f:	bb c8 00 00 00       	mov    $0xc8,%ebx
+    1014:	51                   	push   %ecx
+    1015:	83 ec 18             	sub    $0x18,%esp
+	struct tpool *pool;
+	int i, bad;
+
+	if((pool = tpool_create(NWORKERS)) == 0){
+    1018:	6a 04                	push   $0x4
+    101a:	e8 61 0f 00 00       	call   1f80 <tpool_create>
+    101f:	83 c4 10             	add    $0x10,%esp
+    1022:	89 c6                	mov    %eax,%esi
+    1024:	85 c0                	test   %eax,%eax
+    1026:	0f 84 9e 00 00 00    	je     10ca <main+0xca>
+    102c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+		printf(1, "tpool_create failed\n");
+		exit();
+	}
+
+	for(i = 0; i < NTASKS; i++)
+		tpool_submit(pool, task, (void*)1);
+    1030:	83 ec 04             	sub    $0x4,%esp
+    1033:	6a 01                	push   $0x1
+    1035:	68 e0 10 00 00       	push   $0x10e0
+    103a:	56                   	push   %esi
+    103b:	e8 e0 0d 00 00       	call   1e20 <tpool_submit>
+	for(i = 0; i < NTASKS; i++)
+    1040:	83 c4 10             	add    $0x10,%esp
+    1043:	83 eb 01             	sub    $0x1,%ebx
+    1046:	75 e8                	jne    1030 <main+0x30>
+	tpool_wait(pool);
+    1048:	83 ec 0c             	sub    $0xc,%esp
+    104b:	56                   	push   %esi
+    104c:	e8 ff 0d 00 00       	call   1e50 <tpool_wait>
+	printf(1, "%d of %d tasks ran\n", count, NTASKS);
+    1051:	68 c8 00 00 00       	push   $0xc8
+    1056:	ff 35 a0 42 00 00    	push   0x42a0
+    105c:	68 1d 2b 00 00       	push   $0x2b1d
+    1061:	6a 01                	push   $0x1
+    1063:	e8 d8 04 00 00       	call   1540 <printf>
+
+	parallel_for(pool, 0, N, body, 0);
+    1068:	83 c4 14             	add    $0x14,%esp
+    106b:	6a 00                	push   $0x0
+    106d:	68 f0 10 00 00       	push   $0x10f0
+    1072:	68 e8 03 00 00       	push   $0x3e8
+    1077:	6a 00                	push   $0x0
+    1079:	56                   	push   %esi
+    107a:	e8 a1 0f 00 00       	call   2020 <parallel_for>
+    107f:	83 c4 20             	add    $0x20,%esp
+	bad = 0;
+    1082:	31 c9                	xor    %ecx,%ecx
+	for(i = 0; i < N; i++)
+    1084:	31 c0                	xor    %eax,%eax
+    1086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108d:	8d 76 00             	lea    0x0(%esi),%esi
+		if(square[i] != i * i)
+    1090:	89 c2                	mov    %eax,%edx
+    1092:	0f af d0             	imul   %eax,%edx
+    1095:	39 14 85 00 33 00 00 	cmp    %edx,0x3300(,%eax,4)
+    109c:	74 03                	je     10a1 <main+0xa1>
+			bad++;
+    109e:	83 c1 01             	add    $0x1,%ecx
+	for(i = 0; i < N; i++)
+    10a1:	83 c0 01             	add    $0x1,%eax
+    10a4:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+    10a9:	75 e5                	jne    1090 <main+0x90>
+	printf(1, "parallel_for: %d of %d iterations wrong\n", bad, N);
+    10ab:	68 e8 03 00 00       	push   $0x3e8
+    10b0:	51                   	push   %ecx
+    10b1:	68 34 2b 00 00       	push   $0x2b34
+    10b6:	6a 01                	push   $0x1
+    10b8:	e8 83 04 00 00       	call   1540 <printf>
+
+	tpool_destroy(pool);
+    10bd:	89 34 24             	mov    %esi,(%esp)
+    10c0:	e8 eb 0d 00 00       	call   1eb0 <tpool_destroy>
+	exit();
+    10c5:	e8 89 02 00 00       	call   1353 <exit>
+		printf(1, "tpool_create failed\n");
+    10ca:	50                   	push   %eax
+    10cb:	50                   	push   %eax
+    10cc:	68 08 2b 00 00       	push   $0x2b08
+    10d1:	6a 01                	push   $0x1
+    10d3:	e8 68 04 00 00       	call   1540 <printf>
+		exit();
+    10d8:	e8 76 02 00 00       	call   1353 <exit>
+    10dd:	66 90                	xchg   %ax,%ax
+    10df:	90                   	nop
+
+000010e0 <task>:
+{
+    10e0:	55                   	push   %ebp
+    10e1:	89 e5                	mov    %esp,%ebp
+// Routines to let C code use special x86 instructions.
+
+// atomic fetch-and-add operation
+static inline int fetch_and_add (int *var, int value)
+{
+  asm volatile("lock; xaddl %0, %1"
+    10e3:	8b 45 08             	mov    0x8(%ebp),%eax
+    10e6:	f0 0f c1 05 a0 42 00 	lock xadd %eax,0x42a0
+    10ed:	00 
+}
+    10ee:	5d                   	pop    %ebp
+    10ef:	c3                   	ret
+
+000010f0 <body>:
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    10f6:	5d                   	pop    %ebp
+	square[i] += i * i;
+    10f7:	89 c2                	mov    %eax,%edx
+    10f9:	0f af d0             	imul   %eax,%edx
+    10fc:	01 14 85 00 33 00 00 	add    %edx,0x3300(,%eax,4)
+}
+    1103:	c3                   	ret
+    1104:	66 90                	xchg   %ax,%ax
+    1106:	66 90                	xchg   %ax,%ax
+    1108:	66 90                	xchg   %ax,%ax
+    110a:	66 90                	xchg   %ax,%ax
+    110c:	66 90                	xchg   %ax,%ax
+    110e:	66 90                	xchg   %ax,%ax
+
+00001110 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1111:	31 c0                	xor    %eax,%eax
+{
+    1113:	89 e5                	mov    %esp,%ebp
+    1115:	53                   	push   %ebx
+    1116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    111c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1127:	83 c0 01             	add    $0x1,%eax
+    112a:	84 d2                	test   %dl,%dl
+    112c:	75 f2                	jne    1120 <strcpy+0x10>
+    ;
+  return os;
+}
+    112e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1131:	89 c8                	mov    %ecx,%eax
+    1133:	c9                   	leave
+    1134:	c3                   	ret
+    1135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	53                   	push   %ebx
+    1144:	8b 55 08             	mov    0x8(%ebp),%edx
+    1147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    114a:	0f b6 02             	movzbl (%edx),%eax
+    114d:	84 c0                	test   %al,%al
+    114f:	75 17                	jne    1168 <strcmp+0x28>
+    1151:	eb 3a                	jmp    118d <strcmp+0x4d>
+    1153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1157:	90                   	nop
+    1158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    115c:	83 c2 01             	add    $0x1,%edx
+    115f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1162:	84 c0                	test   %al,%al
+    1164:	74 1a                	je     1180 <strcmp+0x40>
+    p++, q++;
+    1166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1168:	0f b6 19             	movzbl (%ecx),%ebx
+    116b:	38 c3                	cmp    %al,%bl
+    116d:	74 e9                	je     1158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    116f:	29 d8                	sub    %ebx,%eax
+}
+    1171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1174:	c9                   	leave
+    1175:	c3                   	ret
+    1176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1184:	31 c0                	xor    %eax,%eax
+    1186:	29 d8                	sub    %ebx,%eax
+}
+    1188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    118b:	c9                   	leave
+    118c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    118d:	0f b6 19             	movzbl (%ecx),%ebx
+    1190:	31 c0                	xor    %eax,%eax
+    1192:	eb db                	jmp    116f <strcmp+0x2f>
+    1194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    119b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    119f:	90                   	nop
+
+000011a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    11a0:	55                   	push   %ebp
+    11a1:	89 e5                	mov    %esp,%ebp
+    11a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    11a6:	80 3a 00             	cmpb   $0x0,(%edx)
+    11a9:	74 15                	je     11c0 <strlen+0x20>
+    11ab:	31 c0                	xor    %eax,%eax
+    11ad:	8d 76 00             	lea    0x0(%esi),%esi
+    11b0:	83 c0 01             	add    $0x1,%eax
+    11b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    11b7:	89 c1                	mov    %eax,%ecx
+    11b9:	75 f5                	jne    11b0 <strlen+0x10>
+    ;
+  return n;
+}
+    11bb:	89 c8                	mov    %ecx,%eax
+    11bd:	5d                   	pop    %ebp
+    11be:	c3                   	ret
+    11bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    11c0:	31 c9                	xor    %ecx,%ecx
+}
+    11c2:	5d                   	pop    %ebp
+    11c3:	89 c8                	mov    %ecx,%eax
+    11c5:	c3                   	ret
+    11c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000011d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    11d0:	55                   	push   %ebp
+    11d1:	89 e5                	mov    %esp,%ebp
+    11d3:	57                   	push   %edi
+    11d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    11d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    11da:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11dd:	89 d7                	mov    %edx,%edi
+    11df:	fc                   	cld
+    11e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    11e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    11e5:	89 d0                	mov    %edx,%eax
+    11e7:	c9                   	leave
+    11e8:	c3                   	ret
+    11e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    11f0:	55                   	push   %ebp
+    11f1:	89 e5                	mov    %esp,%ebp
+    11f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    11fa:	0f b6 10             	movzbl (%eax),%edx
+    11fd:	84 d2                	test   %dl,%dl
+    11ff:	75 12                	jne    1213 <strchr+0x23>
+    1201:	eb 1d                	jmp    1220 <strchr+0x30>
+    1203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1207:	90                   	nop
+    1208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    120c:	83 c0 01             	add    $0x1,%eax
+    120f:	84 d2                	test   %dl,%dl
+    1211:	74 0d                	je     1220 <strchr+0x30>
+    if(*s == c)
+    1213:	38 d1                	cmp    %dl,%cl
+    1215:	75 f1                	jne    1208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1217:	5d                   	pop    %ebp
+    1218:	c3                   	ret
+    1219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1220:	31 c0                	xor    %eax,%eax
+}
+    1222:	5d                   	pop    %ebp
+    1223:	c3                   	ret
+    1224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    122f:	90                   	nop
+
+00001230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	57                   	push   %edi
+    1234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1239:	31 db                	xor    %ebx,%ebx
+{
+    123b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    123e:	eb 27                	jmp    1267 <gets+0x37>
+    cc = read(0, &c, 1);
+    1240:	83 ec 04             	sub    $0x4,%esp
+    1243:	6a 01                	push   $0x1
+    1245:	56                   	push   %esi
+    1246:	6a 00                	push   $0x0
+    1248:	e8 1e 01 00 00       	call   136b <read>
+    if(cc < 1)
+    124d:	83 c4 10             	add    $0x10,%esp
+    1250:	85 c0                	test   %eax,%eax
+    1252:	7e 1d                	jle    1271 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1258:	8b 55 08             	mov    0x8(%ebp),%edx
+    125b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    125f:	3c 0a                	cmp    $0xa,%al
+    1261:	74 10                	je     1273 <gets+0x43>
+    1263:	3c 0d                	cmp    $0xd,%al
+    1265:	74 0c                	je     1273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1267:	89 df                	mov    %ebx,%edi
+    1269:	83 c3 01             	add    $0x1,%ebx
+    126c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    126f:	7c cf                	jl     1240 <gets+0x10>
+    1271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1273:	8b 45 08             	mov    0x8(%ebp),%eax
+    1276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    127a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    127d:	5b                   	pop    %ebx
+    127e:	5e                   	pop    %esi
+    127f:	5f                   	pop    %edi
+    1280:	5d                   	pop    %ebp
+    1281:	c3                   	ret
+    1282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	56                   	push   %esi
+    1294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1295:	83 ec 08             	sub    $0x8,%esp
+    1298:	6a 00                	push   $0x0
+    129a:	ff 75 08             	push   0x8(%ebp)
+    129d:	e8 f1 00 00 00       	call   1393 <open>
+  if(fd < 0)
+    12a2:	83 c4 10             	add    $0x10,%esp
+    12a5:	85 c0                	test   %eax,%eax
+    12a7:	78 27                	js     12d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    12a9:	83 ec 08             	sub    $0x8,%esp
+    12ac:	ff 75 0c             	push   0xc(%ebp)
+    12af:	89 c3                	mov    %eax,%ebx
+    12b1:	50                   	push   %eax
+    12b2:	e8 f4 00 00 00       	call   13ab <fstat>
+  close(fd);
+    12b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    12ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+    12bc:	e8 ba 00 00 00       	call   137b <close>
+  return r;
+    12c1:	83 c4 10             	add    $0x10,%esp
+}
+    12c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12c7:	89 f0                	mov    %esi,%eax
+    12c9:	5b                   	pop    %ebx
+    12ca:	5e                   	pop    %esi
+    12cb:	5d                   	pop    %ebp
+    12cc:	c3                   	ret
+    12cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    12d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    12d5:	eb ed                	jmp    12c4 <stat+0x34>
+    12d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12de:	66 90                	xchg   %ax,%ax
+
+000012e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    12e0:	55                   	push   %ebp
+    12e1:	89 e5                	mov    %esp,%ebp
+    12e3:	53                   	push   %ebx
+    12e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    12e7:	0f be 02             	movsbl (%edx),%eax
+    12ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    12ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    12f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    12f5:	77 1e                	ja     1315 <atoi+0x35>
+    12f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1300:	83 c2 01             	add    $0x1,%edx
+    1303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    130a:	0f be 02             	movsbl (%edx),%eax
+    130d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1310:	80 fb 09             	cmp    $0x9,%bl
+    1313:	76 eb                	jbe    1300 <atoi+0x20>
+  return n;
+}
+    1315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1318:	89 c8                	mov    %ecx,%eax
+    131a:	c9                   	leave
+    131b:	c3                   	ret
+    131c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	57                   	push   %edi
+    1324:	56                   	push   %esi
+    1325:	8b 45 10             	mov    0x10(%ebp),%eax
+    1328:	8b 55 08             	mov    0x8(%ebp),%edx
+    132b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    132e:	85 c0                	test   %eax,%eax
+    1330:	7e 13                	jle    1345 <memmove+0x25>
+    1332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1334:	89 d7                	mov    %edx,%edi
+    1336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1341:	39 f8                	cmp    %edi,%eax
+    1343:	75 fb                	jne    1340 <memmove+0x20>
+  return vdst;
+}
+    1345:	5e                   	pop    %esi
+    1346:	89 d0                	mov    %edx,%eax
+    1348:	5f                   	pop    %edi
+    1349:	5d                   	pop    %ebp
+    134a:	c3                   	ret
+
+0000134b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    134b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1350:	cd 40                	int    $0x40
+    1352:	c3                   	ret
+
+00001353 <exit>:
+SYSCALL(exit)
+    1353:	b8 02 00 00 00       	mov    $0x2,%eax
+    1358:	cd 40                	int    $0x40
+    135a:	c3                   	ret
+
+0000135b <wait>:
+SYSCALL(wait)
+    135b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1360:	cd 40                	int    $0x40
+    1362:	c3                   	ret
+
+00001363 <pipe>:
+SYSCALL(pipe)
+    1363:	b8 04 00 00 00       	mov    $0x4,%eax
+    1368:	cd 40                	int    $0x40
+    136a:	c3                   	ret
+
+0000136b <read>:
+SYSCALL(read)
+    136b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1370:	cd 40                	int    $0x40
+    1372:	c3                   	ret
+
+00001373 <write>:
+SYSCALL(write)
+    1373:	b8 10 00 00 00       	mov    $0x10,%eax
+    1378:	cd 40                	int    $0x40
+    137a:	c3                   	ret
+
+0000137b <close>:
+SYSCALL(close)
+    137b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1380:	cd 40                	int    $0x40
+    1382:	c3                   	ret
+
+00001383 <kill>:
+SYSCALL(kill)
+    1383:	b8 06 00 00 00       	mov    $0x6,%eax
+    1388:	cd 40                	int    $0x40
+    138a:	c3                   	ret
+
+0000138b <exec>:
+SYSCALL(exec)
+    138b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1390:	cd 40                	int    $0x40
+    1392:	c3                   	ret
+
+00001393 <open>:
+SYSCALL(open)
+    1393:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1398:	cd 40                	int    $0x40
+    139a:	c3                   	ret
+
+0000139b <mknod>:
+SYSCALL(mknod)
+    139b:	b8 11 00 00 00       	mov    $0x11,%eax
+    13a0:	cd 40                	int    $0x40
+    13a2:	c3                   	ret
+
+000013a3 <unlink>:
+SYSCALL(unlink)
+    13a3:	b8 12 00 00 00       	mov    $0x12,%eax
+    13a8:	cd 40                	int    $0x40
+    13aa:	c3                   	ret
+
+000013ab <fstat>:
+SYSCALL(fstat)
+    13ab:	b8 08 00 00 00       	mov    $0x8,%eax
+    13b0:	cd 40                	int    $0x40
+    13b2:	c3                   	ret
+
+000013b3 <link>:
+SYSCALL(link)
+    13b3:	b8 13 00 00 00       	mov    $0x13,%eax
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+
+000013bb <mkdir>:
+SYSCALL(mkdir)
+    13bb:	b8 14 00 00 00       	mov    $0x14,%eax
+    13c0:	cd 40                	int    $0x40
+    13c2:	c3                   	ret
+
+000013c3 <chdir>:
+SYSCALL(chdir)
+    13c3:	b8 09 00 00 00       	mov    $0x9,%eax
+    13c8:	cd 40                	int    $0x40
+    13ca:	c3                   	ret
+
+000013cb <dup>:
+SYSCALL(dup)
+    13cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    13d0:	cd 40                	int    $0x40
+    13d2:	c3                   	ret
+
+000013d3 <getpid>:
+SYSCALL(getpid)
+    13d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    13d8:	cd 40                	int    $0x40
+    13da:	c3                   	ret
+
+000013db <sbrk>:
+SYSCALL(sbrk)
+    13db:	b8 0c 00 00 00       	mov    $0xc,%eax
+    13e0:	cd 40                	int    $0x40
+    13e2:	c3                   	ret
+
+000013e3 <sleep>:
+SYSCALL(sleep)
+    13e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+
+000013eb <uptime>:
+SYSCALL(uptime)
+    13eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    13f0:	cd 40                	int    $0x40
+    13f2:	c3                   	ret
+
+000013f3 <settickets>:
+SYSCALL(settickets)
+    13f3:	b8 16 00 00 00       	mov    $0x16,%eax
+    13f8:	cd 40                	int    $0x40
+    13fa:	c3                   	ret
+
+000013fb <getpinfo>:
+SYSCALL(getpinfo)
+    13fb:	b8 17 00 00 00       	mov    $0x17,%eax
+    1400:	cd 40                	int    $0x40
+    1402:	c3                   	ret
+
+00001403 <mprotect>:
+SYSCALL(mprotect)
+    1403:	b8 18 00 00 00       	mov    $0x18,%eax
+    1408:	cd 40                	int    $0x40
+    140a:	c3                   	ret
+
+0000140b <munprotect>:
+SYSCALL(munprotect)
+    140b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1410:	cd 40                	int    $0x40
+    1412:	c3                   	ret
+
+00001413 <clone>:
+SYSCALL(clone)
+    1413:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1418:	cd 40                	int    $0x40
+    141a:	c3                   	ret
+
+0000141b <join>:
+SYSCALL(join)
+    141b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1420:	cd 40                	int    $0x40
+    1422:	c3                   	ret
+
+00001423 <initlock_t>:
+SYSCALL(initlock_t)
+    1423:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1428:	cd 40                	int    $0x40
+    142a:	c3                   	ret
+
+0000142b <acquire_t>:
+SYSCALL(acquire_t)
+    142b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1430:	cd 40                	int    $0x40
+    1432:	c3                   	ret
+
+00001433 <release_t>:
+SYSCALL(release_t)
+    1433:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1438:	cd 40                	int    $0x40
+    143a:	c3                   	ret
+
+0000143b <setsched>:
+SYSCALL(setsched)
+    143b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1440:	cd 40                	int    $0x40
+    1442:	c3                   	ret
+
+00001443 <mkgroup>:
+SYSCALL(mkgroup)
+    1443:	b8 20 00 00 00       	mov    $0x20,%eax
+    1448:	cd 40                	int    $0x40
+    144a:	c3                   	ret
+
+0000144b <joingroup>:
+SYSCALL(joingroup)
+    144b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1450:	cd 40                	int    $0x40
+    1452:	c3                   	ret
+
+00001453 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1453:	b8 22 00 00 00       	mov    $0x22,%eax
+    1458:	cd 40                	int    $0x40
+    145a:	c3                   	ret
+
+0000145b <setdeadline>:
+SYSCALL(setdeadline)
+    145b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1460:	cd 40                	int    $0x40
+    1462:	c3                   	ret
+
+00001463 <setaffinity>:
+SYSCALL(setaffinity)
+    1463:	b8 24 00 00 00       	mov    $0x24,%eax
+    1468:	cd 40                	int    $0x40
+    146a:	c3                   	ret
+
+0000146b <yield_to>:
+SYSCALL(yield_to)
+    146b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1470:	cd 40                	int    $0x40
+    1472:	c3                   	ret
+
+00001473 <getlatency>:
+SYSCALL(getlatency)
+    1473:	b8 26 00 00 00       	mov    $0x26,%eax
+    1478:	cd 40                	int    $0x40
+    147a:	c3                   	ret
+
+0000147b <futex_wait>:
+SYSCALL(futex_wait)
+    147b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1480:	cd 40                	int    $0x40
+    1482:	c3                   	ret
+
+00001483 <futex_wake>:
+SYSCALL(futex_wake)
+    1483:	b8 28 00 00 00       	mov    $0x28,%eax
+    1488:	cd 40                	int    $0x40
+    148a:	c3                   	ret
+
+0000148b <mguard>:
+SYSCALL(mguard)
+    148b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1490:	cd 40                	int    $0x40
+    1492:	c3                   	ret
+
+00001493 <join_any>:
+SYSCALL(join_any)
+    1493:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1498:	cd 40                	int    $0x40
+    149a:	c3                   	ret
+    149b:	66 90                	xchg   %ax,%ax
+    149d:	66 90                	xchg   %ax,%ax
+    149f:	90                   	nop
+
+000014a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    14a0:	55                   	push   %ebp
+    14a1:	89 e5                	mov    %esp,%ebp
+    14a3:	57                   	push   %edi
+    14a4:	56                   	push   %esi
+    14a5:	53                   	push   %ebx
+    14a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    14a8:	89 d1                	mov    %edx,%ecx
+{
+    14aa:	83 ec 3c             	sub    $0x3c,%esp
+    14ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    14b0:	85 d2                	test   %edx,%edx
+    14b2:	0f 89 80 00 00 00    	jns    1538 <printint+0x98>
+    14b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    14bc:	74 7a                	je     1538 <printint+0x98>
+    x = -xx;
+    14be:	f7 d9                	neg    %ecx
+    neg = 1;
+    14c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    14c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    14c8:	31 f6                	xor    %esi,%esi
+    14ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    14d0:	89 c8                	mov    %ecx,%eax
+    14d2:	31 d2                	xor    %edx,%edx
+    14d4:	89 f7                	mov    %esi,%edi
+    14d6:	f7 f3                	div    %ebx
+    14d8:	8d 76 01             	lea    0x1(%esi),%esi
+    14db:	0f b6 92 bc 2b 00 00 	movzbl 0x2bbc(%edx),%edx
+    14e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    14e6:	89 ca                	mov    %ecx,%edx
+    14e8:	89 c1                	mov    %eax,%ecx
+    14ea:	39 da                	cmp    %ebx,%edx
+    14ec:	73 e2                	jae    14d0 <printint+0x30>
+  if(neg)
+    14ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    14f1:	85 c0                	test   %eax,%eax
+    14f3:	74 07                	je     14fc <printint+0x5c>
+    buf[i++] = '-';
+    14f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    14fa:	89 f7                	mov    %esi,%edi
+    14fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    14ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1502:	01 df                	add    %ebx,%edi
+    1504:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1508:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    150b:	83 ec 04             	sub    $0x4,%esp
+    150e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1511:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1514:	6a 01                	push   $0x1
+    1516:	50                   	push   %eax
+    1517:	56                   	push   %esi
+    1518:	e8 56 fe ff ff       	call   1373 <write>
+  while(--i >= 0)
+    151d:	89 f8                	mov    %edi,%eax
+    151f:	83 c4 10             	add    $0x10,%esp
+    1522:	83 ef 01             	sub    $0x1,%edi
+    1525:	39 d8                	cmp    %ebx,%eax
+    1527:	75 df                	jne    1508 <printint+0x68>
+}
+    1529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    152c:	5b                   	pop    %ebx
+    152d:	5e                   	pop    %esi
+    152e:	5f                   	pop    %edi
+    152f:	5d                   	pop    %ebp
+    1530:	c3                   	ret
+    1531:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1538:	31 c0                	xor    %eax,%eax
+    153a:	eb 89                	jmp    14c5 <printint+0x25>
+    153c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001540 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1540:	55                   	push   %ebp
+    1541:	89 e5                	mov    %esp,%ebp
+    1543:	57                   	push   %edi
+    1544:	56                   	push   %esi
+    1545:	53                   	push   %ebx
+    1546:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1549:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    154c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    154f:	0f b6 1e             	movzbl (%esi),%ebx
+    1552:	83 c6 01             	add    $0x1,%esi
+    1555:	84 db                	test   %bl,%bl
+    1557:	74 67                	je     15c0 <printf+0x80>
+    1559:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    155c:	31 d2                	xor    %edx,%edx
+    155e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1561:	eb 34                	jmp    1597 <printf+0x57>
+    1563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1567:	90                   	nop
+    1568:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    156b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1570:	83 f8 25             	cmp    $0x25,%eax
+    1573:	74 18                	je     158d <printf+0x4d>
+  write(fd, &c, 1);
+    1575:	83 ec 04             	sub    $0x4,%esp
+    1578:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    157b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    157e:	6a 01                	push   $0x1
+    1580:	50                   	push   %eax
+    1581:	57                   	push   %edi
+    1582:	e8 ec fd ff ff       	call   1373 <write>
+    1587:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    158a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    158d:	0f b6 1e             	movzbl (%esi),%ebx
+    1590:	83 c6 01             	add    $0x1,%esi
+    1593:	84 db                	test   %bl,%bl
+    1595:	74 29                	je     15c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1597:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    159a:	85 d2                	test   %edx,%edx
+    159c:	74 ca                	je     1568 <printf+0x28>
+      }
+    } else if(state == '%'){
+    159e:	83 fa 25             	cmp    $0x25,%edx
+    15a1:	75 ea                	jne    158d <printf+0x4d>
+      if(c == 'd'){
+    15a3:	83 f8 25             	cmp    $0x25,%eax
+    15a6:	0f 84 24 01 00 00    	je     16d0 <printf+0x190>
+    15ac:	83 e8 63             	sub    $0x63,%eax
+    15af:	83 f8 15             	cmp    $0x15,%eax
+    15b2:	77 1c                	ja     15d0 <printf+0x90>
+    15b4:	ff 24 85 64 2b 00 00 	jmp    *0x2b64(,%eax,4)
+    15bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    15c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15c3:	5b                   	pop    %ebx
+    15c4:	5e                   	pop    %esi
+    15c5:	5f                   	pop    %edi
+    15c6:	5d                   	pop    %ebp
+    15c7:	c3                   	ret
+    15c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15cf:	90                   	nop
+  write(fd, &c, 1);
+    15d0:	83 ec 04             	sub    $0x4,%esp
+    15d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    15d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    15da:	6a 01                	push   $0x1
+    15dc:	52                   	push   %edx
+    15dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    15e0:	57                   	push   %edi
+    15e1:	e8 8d fd ff ff       	call   1373 <write>
+    15e6:	83 c4 0c             	add    $0xc,%esp
+    15e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    15ec:	6a 01                	push   $0x1
+    15ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    15f1:	52                   	push   %edx
+    15f2:	57                   	push   %edi
+    15f3:	e8 7b fd ff ff       	call   1373 <write>
+        putc(fd, c);
+    15f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    15fb:	31 d2                	xor    %edx,%edx
+    15fd:	eb 8e                	jmp    158d <printf+0x4d>
+    15ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1600:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1603:	83 ec 0c             	sub    $0xc,%esp
+    1606:	b9 10 00 00 00       	mov    $0x10,%ecx
+    160b:	8b 13                	mov    (%ebx),%edx
+    160d:	6a 00                	push   $0x0
+    160f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1611:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1614:	e8 87 fe ff ff       	call   14a0 <printint>
+        ap++;
+    1619:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    161c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    161f:	31 d2                	xor    %edx,%edx
+    1621:	e9 67 ff ff ff       	jmp    158d <printf+0x4d>
+    1626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    162d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1630:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1633:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1635:	83 c0 04             	add    $0x4,%eax
+    1638:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    163b:	85 db                	test   %ebx,%ebx
+    163d:	0f 84 9d 00 00 00    	je     16e0 <printf+0x1a0>
+        while(*s != 0){
+    1643:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1646:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1648:	84 c0                	test   %al,%al
+    164a:	0f 84 3d ff ff ff    	je     158d <printf+0x4d>
+    1650:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1653:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1656:	89 de                	mov    %ebx,%esi
+    1658:	89 d3                	mov    %edx,%ebx
+    165a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1660:	83 ec 04             	sub    $0x4,%esp
+    1663:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1666:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1669:	6a 01                	push   $0x1
+    166b:	53                   	push   %ebx
+    166c:	57                   	push   %edi
+    166d:	e8 01 fd ff ff       	call   1373 <write>
+        while(*s != 0){
+    1672:	0f b6 06             	movzbl (%esi),%eax
+    1675:	83 c4 10             	add    $0x10,%esp
+    1678:	84 c0                	test   %al,%al
+    167a:	75 e4                	jne    1660 <printf+0x120>
+      state = 0;
+    167c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    167f:	31 d2                	xor    %edx,%edx
+    1681:	e9 07 ff ff ff       	jmp    158d <printf+0x4d>
+    1686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    168d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1693:	83 ec 0c             	sub    $0xc,%esp
+    1696:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    169b:	8b 13                	mov    (%ebx),%edx
+    169d:	6a 01                	push   $0x1
+    169f:	e9 6b ff ff ff       	jmp    160f <printf+0xcf>
+    16a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    16a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    16ab:	83 ec 04             	sub    $0x4,%esp
+    16ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    16b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    16b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    16b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    16b9:	6a 01                	push   $0x1
+    16bb:	52                   	push   %edx
+    16bc:	57                   	push   %edi
+    16bd:	e8 b1 fc ff ff       	call   1373 <write>
+        ap++;
+    16c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    16c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    16c8:	31 d2                	xor    %edx,%edx
+    16ca:	e9 be fe ff ff       	jmp    158d <printf+0x4d>
+    16cf:	90                   	nop
+  write(fd, &c, 1);
+    16d0:	83 ec 04             	sub    $0x4,%esp
+    16d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    16d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    16d9:	6a 01                	push   $0x1
+    16db:	e9 11 ff ff ff       	jmp    15f1 <printf+0xb1>
+    16e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    16e5:	bb 5d 2b 00 00       	mov    $0x2b5d,%ebx
+    16ea:	e9 61 ff ff ff       	jmp    1650 <printf+0x110>
+    16ef:	90                   	nop
+
+000016f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    16f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16f1:	a1 a4 42 00 00       	mov    0x42a4,%eax
+{
+    16f6:	89 e5                	mov    %esp,%ebp
+    16f8:	57                   	push   %edi
+    16f9:	56                   	push   %esi
+    16fa:	53                   	push   %ebx
+    16fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    16fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1708:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    170a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    170c:	39 ca                	cmp    %ecx,%edx
+    170e:	73 30                	jae    1740 <free+0x50>
+    1710:	39 c1                	cmp    %eax,%ecx
+    1712:	72 04                	jb     1718 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1714:	39 c2                	cmp    %eax,%edx
+    1716:	72 f0                	jb     1708 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1718:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    171b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    171e:	39 f8                	cmp    %edi,%eax
+    1720:	74 2e                	je     1750 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1722:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1725:	8b 42 04             	mov    0x4(%edx),%eax
+    1728:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    172b:	39 f1                	cmp    %esi,%ecx
+    172d:	74 38                	je     1767 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    172f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1731:	5b                   	pop    %ebx
+  freep = p;
+    1732:	89 15 a4 42 00 00    	mov    %edx,0x42a4
+}
+    1738:	5e                   	pop    %esi
+    1739:	5f                   	pop    %edi
+    173a:	5d                   	pop    %ebp
+    173b:	c3                   	ret
+    173c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1740:	39 c1                	cmp    %eax,%ecx
+    1742:	72 d0                	jb     1714 <free+0x24>
+    1744:	eb c2                	jmp    1708 <free+0x18>
+    1746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    174d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1750:	03 70 04             	add    0x4(%eax),%esi
+    1753:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1756:	8b 02                	mov    (%edx),%eax
+    1758:	8b 00                	mov    (%eax),%eax
+    175a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    175d:	8b 42 04             	mov    0x4(%edx),%eax
+    1760:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1763:	39 f1                	cmp    %esi,%ecx
+    1765:	75 c8                	jne    172f <free+0x3f>
+    p->s.size += bp->s.size;
+    1767:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    176a:	89 15 a4 42 00 00    	mov    %edx,0x42a4
+    p->s.size += bp->s.size;
+    1770:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1773:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1776:	89 0a                	mov    %ecx,(%edx)
+}
+    1778:	5b                   	pop    %ebx
+    1779:	5e                   	pop    %esi
+    177a:	5f                   	pop    %edi
+    177b:	5d                   	pop    %ebp
+    177c:	c3                   	ret
+    177d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001780 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1780:	55                   	push   %ebp
+    1781:	89 e5                	mov    %esp,%ebp
+    1783:	57                   	push   %edi
+    1784:	56                   	push   %esi
+    1785:	53                   	push   %ebx
+    1786:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1789:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    178c:	8b 15 a4 42 00 00    	mov    0x42a4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1792:	8d 78 07             	lea    0x7(%eax),%edi
+    1795:	c1 ef 03             	shr    $0x3,%edi
+    1798:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    179b:	85 d2                	test   %edx,%edx
+    179d:	0f 84 8d 00 00 00    	je     1830 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    17a5:	8b 48 04             	mov    0x4(%eax),%ecx
+    17a8:	39 f9                	cmp    %edi,%ecx
+    17aa:	73 64                	jae    1810 <malloc+0x90>
+  if(nu < 4096)
+    17ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    17b1:	39 df                	cmp    %ebx,%edi
+    17b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    17b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    17bd:	eb 0a                	jmp    17c9 <malloc+0x49>
+    17bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    17c2:	8b 48 04             	mov    0x4(%eax),%ecx
+    17c5:	39 f9                	cmp    %edi,%ecx
+    17c7:	73 47                	jae    1810 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    17c9:	89 c2                	mov    %eax,%edx
+    17cb:	39 05 a4 42 00 00    	cmp    %eax,0x42a4
+    17d1:	75 ed                	jne    17c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    17d3:	83 ec 0c             	sub    $0xc,%esp
+    17d6:	56                   	push   %esi
+    17d7:	e8 ff fb ff ff       	call   13db <sbrk>
+  if(p == (char*)-1)
+    17dc:	83 c4 10             	add    $0x10,%esp
+    17df:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17e2:	74 1c                	je     1800 <malloc+0x80>
+  hp->s.size = nu;
+    17e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    17e7:	83 ec 0c             	sub    $0xc,%esp
+    17ea:	83 c0 08             	add    $0x8,%eax
+    17ed:	50                   	push   %eax
+    17ee:	e8 fd fe ff ff       	call   16f0 <free>
+  return freep;
+    17f3:	8b 15 a4 42 00 00    	mov    0x42a4,%edx
+      if((p = morecore(nunits)) == 0)
+    17f9:	83 c4 10             	add    $0x10,%esp
+    17fc:	85 d2                	test   %edx,%edx
+    17fe:	75 c0                	jne    17c0 <malloc+0x40>
+        return 0;
+  }
+}
+    1800:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1803:	31 c0                	xor    %eax,%eax
+}
+    1805:	5b                   	pop    %ebx
+    1806:	5e                   	pop    %esi
+    1807:	5f                   	pop    %edi
+    1808:	5d                   	pop    %ebp
+    1809:	c3                   	ret
+    180a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1810:	39 cf                	cmp    %ecx,%edi
+    1812:	74 4c                	je     1860 <malloc+0xe0>
+        p->s.size -= nunits;
+    1814:	29 f9                	sub    %edi,%ecx
+    1816:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1819:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    181c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    181f:	89 15 a4 42 00 00    	mov    %edx,0x42a4
+}
+    1825:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1828:	83 c0 08             	add    $0x8,%eax
+}
+    182b:	5b                   	pop    %ebx
+    182c:	5e                   	pop    %esi
+    182d:	5f                   	pop    %edi
+    182e:	5d                   	pop    %ebp
+    182f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1830:	c7 05 a4 42 00 00 a8 	movl   $0x42a8,0x42a4
+    1837:	42 00 00 
+    base.s.size = 0;
+    183a:	b8 a8 42 00 00       	mov    $0x42a8,%eax
+    base.s.ptr = freep = prevp = &base;
+    183f:	c7 05 a8 42 00 00 a8 	movl   $0x42a8,0x42a8
+    1846:	42 00 00 
+    base.s.size = 0;
+    1849:	c7 05 ac 42 00 00 00 	movl   $0x0,0x42ac
+    1850:	00 00 00 
+    if(p->s.size >= nunits){
+    1853:	e9 54 ff ff ff       	jmp    17ac <malloc+0x2c>
+    1858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    185f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1860:	8b 08                	mov    (%eax),%ecx
+    1862:	89 0a                	mov    %ecx,(%edx)
+    1864:	eb b9                	jmp    181f <malloc+0x9f>
+    1866:	66 90                	xchg   %ax,%ax
+    1868:	66 90                	xchg   %ax,%ax
+    186a:	66 90                	xchg   %ax,%ax
+    186c:	66 90                	xchg   %ax,%ax
+    186e:	66 90                	xchg   %ax,%ax
+
+00001870 <tp_enqueue>:
+}
+
+// Put t on the shared queue, waiting for room if it is full.
+static void
+tp_enqueue(struct tpool *pool, struct tptask *t)
+{
+    1870:	55                   	push   %ebp
+    1871:	89 e5                	mov    %esp,%ebp
+    1873:	57                   	push   %edi
+    1874:	56                   	push   %esi
+    1875:	53                   	push   %ebx
+    1876:	89 c3                	mov    %eax,%ebx
+    1878:	89 d0                	mov    %edx,%eax
+  asm volatile("lock; xaddl %0, %1"
+    187a:	ba 01 00 00 00       	mov    $0x1,%edx
+    187f:	83 ec 1c             	sub    $0x1c,%esp
+    1882:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+    s = *(volatile int*)&pool->doneseq;
+    lock_acquire(&pool->qlock);
+    if(pool->qcount < TPQSIZE)
+      break;
+    lock_release(&pool->qlock);
+    tp_sleep(&pool->doneseq, s, &pool->ndonewait);
+    1887:	8d 93 2c 05 00 00    	lea    0x52c(%ebx),%edx
+    188d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    lock_acquire(&pool->qlock);
+    1890:	8d 7b 10             	lea    0x10(%ebx),%edi
+    tp_sleep(&pool->doneseq, s, &pool->ndonewait);
+    1893:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return value;
+    1896:	eb 39                	jmp    18d1 <tp_enqueue+0x61>
+    1898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    189f:	90                   	nop
+    lock_release(&pool->qlock);
+    18a0:	83 ec 0c             	sub    $0xc,%esp
+    18a3:	57                   	push   %edi
+    18a4:	e8 27 0f 00 00       	call   27d0 <lock_release>
+  asm volatile("lock; xaddl %0, %1"
+    18a9:	b8 01 00 00 00       	mov    $0x1,%eax
+    18ae:	f0 0f c1 83 30 05 00 	lock xadd %eax,0x530(%ebx)
+    18b5:	00 
+  futex_wait(seq, s);
+    18b6:	58                   	pop    %eax
+    18b7:	5a                   	pop    %edx
+    18b8:	56                   	push   %esi
+    18b9:	ff 75 e4             	push   -0x1c(%ebp)
+    18bc:	e8 ba fb ff ff       	call   147b <futex_wait>
+    18c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    18c6:	f0 0f c1 83 30 05 00 	lock xadd %eax,0x530(%ebx)
+    18cd:	00 
+}
+    18ce:	83 c4 10             	add    $0x10,%esp
+    lock_acquire(&pool->qlock);
+    18d1:	83 ec 0c             	sub    $0xc,%esp
+    s = *(volatile int*)&pool->doneseq;
+    18d4:	8b b3 2c 05 00 00    	mov    0x52c(%ebx),%esi
+    lock_acquire(&pool->qlock);
+    18da:	57                   	push   %edi
+    18db:	e8 80 0e 00 00       	call   2760 <lock_acquire>
+    if(pool->qcount < TPQSIZE)
+    18e0:	8b 4b 20             	mov    0x20(%ebx),%ecx
+    18e3:	83 c4 10             	add    $0x10,%esp
+    18e6:	83 f9 3f             	cmp    $0x3f,%ecx
+    18e9:	7f b5                	jg     18a0 <tp_enqueue+0x30>
+  }
+  pool->queue[(pool->qhead + pool->qcount) % TPQSIZE] = *t;
+    18eb:	8b 73 1c             	mov    0x1c(%ebx),%esi
+    18ee:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  pool->qcount++;
+  lock_release(&pool->qlock);
+    18f1:	83 ec 0c             	sub    $0xc,%esp
+  pool->queue[(pool->qhead + pool->qcount) % TPQSIZE] = *t;
+    18f4:	01 ce                	add    %ecx,%esi
+  pool->qcount++;
+    18f6:	83 c1 01             	add    $0x1,%ecx
+  pool->queue[(pool->qhead + pool->qcount) % TPQSIZE] = *t;
+    18f9:	89 f2                	mov    %esi,%edx
+    18fb:	c1 fa 1f             	sar    $0x1f,%edx
+    18fe:	c1 ea 1a             	shr    $0x1a,%edx
+    1901:	01 d6                	add    %edx,%esi
+    1903:	83 e6 3f             	and    $0x3f,%esi
+    1906:	29 d6                	sub    %edx,%esi
+    1908:	8b 10                	mov    (%eax),%edx
+    190a:	8d 34 b6             	lea    (%esi,%esi,4),%esi
+    190d:	8d 74 b3 20          	lea    0x20(%ebx,%esi,4),%esi
+    1911:	89 56 04             	mov    %edx,0x4(%esi)
+    1914:	8b 50 04             	mov    0x4(%eax),%edx
+    1917:	89 56 08             	mov    %edx,0x8(%esi)
+    191a:	8b 50 08             	mov    0x8(%eax),%edx
+    191d:	89 56 0c             	mov    %edx,0xc(%esi)
+    1920:	8b 50 0c             	mov    0xc(%eax),%edx
+    1923:	89 56 10             	mov    %edx,0x10(%esi)
+    1926:	8b 40 10             	mov    0x10(%eax),%eax
+    1929:	89 46 14             	mov    %eax,0x14(%esi)
+  pool->qcount++;
+    192c:	89 4b 20             	mov    %ecx,0x20(%ebx)
+  lock_release(&pool->qlock);
+    192f:	57                   	push   %edi
+    1930:	e8 9b 0e 00 00       	call   27d0 <lock_release>
+  tp_signal(&pool->workseq, &pool->nworkwait);
+    1935:	8d 93 24 05 00 00    	lea    0x524(%ebx),%edx
+    193b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1940:	f0 0f c1 83 24 05 00 	lock xadd %eax,0x524(%ebx)
+    1947:	00 
+  if(*(volatile int*)nwait)
+    1948:	8b 83 28 05 00 00    	mov    0x528(%ebx),%eax
+    194e:	83 c4 10             	add    $0x10,%esp
+    1951:	85 c0                	test   %eax,%eax
+    1953:	75 0b                	jne    1960 <tp_enqueue+0xf0>
+}
+    1955:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1958:	5b                   	pop    %ebx
+    1959:	5e                   	pop    %esi
+    195a:	5f                   	pop    %edi
+    195b:	5d                   	pop    %ebp
+    195c:	c3                   	ret
+    195d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(seq, NPROC);
+    1960:	83 ec 08             	sub    $0x8,%esp
+    1963:	68 00 04 00 00       	push   $0x400
+    1968:	52                   	push   %edx
+    1969:	e8 15 fb ff ff       	call   1483 <futex_wake>
+}
+    196e:	83 c4 10             	add    $0x10,%esp
+}
+    1971:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1974:	5b                   	pop    %ebx
+    1975:	5e                   	pop    %esi
+    1976:	5f                   	pop    %edi
+    1977:	5d                   	pop    %ebp
+    1978:	c3                   	ret
+    1979:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001980 <tp_worker>:
+{
+    1980:	55                   	push   %ebp
+    1981:	89 e5                	mov    %esp,%ebp
+    1983:	57                   	push   %edi
+    1984:	56                   	push   %esi
+    1985:	53                   	push   %ebx
+    1986:	83 ec 4c             	sub    $0x4c,%esp
+    1989:	69 45 0c 94 02 00 00 	imul   $0x294,0xc(%ebp),%eax
+    1990:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(tp_pop(&pool->deque[w], t, 0))
+    1993:	8d bc 06 34 05 00 00 	lea    0x534(%esi,%eax,1),%edi
+    199a:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if((ok = d->bottom > d->top)){
+    199d:	01 f0                	add    %esi,%eax
+  if(tp_pop(&pool->deque[w], t, 0))
+    199f:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  lock_acquire(&pool->qlock);
+    19a2:	8d 7e 10             	lea    0x10(%esi),%edi
+    19a5:	89 7d b8             	mov    %edi,-0x48(%ebp)
+  if((ok = d->bottom > d->top)){
+    19a8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    19ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19af:	90                   	nop
+    s = *(volatile int*)&pool->workseq;
+    19b0:	8b 86 24 05 00 00    	mov    0x524(%esi),%eax
+  lock_acquire(&d->lock);
+    19b6:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    19b9:	83 ec 0c             	sub    $0xc,%esp
+    s = *(volatile int*)&pool->workseq;
+    19bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  lock_acquire(&d->lock);
+    19bf:	57                   	push   %edi
+    19c0:	e8 9b 0d 00 00       	call   2760 <lock_acquire>
+  if((ok = d->bottom > d->top)){
+    19c5:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+    19c8:	83 c4 10             	add    $0x10,%esp
+    19cb:	8b 83 44 05 00 00    	mov    0x544(%ebx),%eax
+    19d1:	3b 83 40 05 00 00    	cmp    0x540(%ebx),%eax
+    19d7:	0f 8f 4b 02 00 00    	jg     1c28 <tp_worker+0x2a8>
+  lock_release(&d->lock);
+    19dd:	83 ec 0c             	sub    $0xc,%esp
+    19e0:	57                   	push   %edi
+    19e1:	e8 ea 0d 00 00       	call   27d0 <lock_release>
+  lock_acquire(&pool->qlock);
+    19e6:	5a                   	pop    %edx
+    19e7:	ff 75 b8             	push   -0x48(%ebp)
+    19ea:	e8 71 0d 00 00       	call   2760 <lock_acquire>
+  if((ok = pool->qcount > 0)){
+    19ef:	8b 56 20             	mov    0x20(%esi),%edx
+    19f2:	83 c4 10             	add    $0x10,%esp
+    19f5:	85 d2                	test   %edx,%edx
+    19f7:	0f 8e d3 02 00 00    	jle    1cd0 <tp_worker+0x350>
+    *t = pool->queue[pool->qhead];
+    19fd:	8b 46 1c             	mov    0x1c(%esi),%eax
+    pool->qcount--;
+    1a00:	83 ea 01             	sub    $0x1,%edx
+  lock_release(&pool->qlock);
+    1a03:	83 ec 0c             	sub    $0xc,%esp
+    *t = pool->queue[pool->qhead];
+    1a06:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+    pool->qhead = (pool->qhead + 1) % TPQSIZE;
+    1a09:	83 c0 01             	add    $0x1,%eax
+    *t = pool->queue[pool->qhead];
+    1a0c:	8d 0c 8e             	lea    (%esi,%ecx,4),%ecx
+    1a0f:	8b 79 24             	mov    0x24(%ecx),%edi
+    1a12:	8b 59 30             	mov    0x30(%ecx),%ebx
+    1a15:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    1a18:	8b 79 28             	mov    0x28(%ecx),%edi
+    1a1b:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+    1a1e:	8b 59 34             	mov    0x34(%ecx),%ebx
+    1a21:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1a24:	8b 79 2c             	mov    0x2c(%ecx),%edi
+    pool->qhead = (pool->qhead + 1) % TPQSIZE;
+    1a27:	89 c1                	mov    %eax,%ecx
+    1a29:	c1 f9 1f             	sar    $0x1f,%ecx
+    *t = pool->queue[pool->qhead];
+    1a2c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+    tp_signal(&pool->doneseq, &pool->ndonewait);  // a slot is free
+    1a2f:	8d 9e 2c 05 00 00    	lea    0x52c(%esi),%ebx
+    pool->qhead = (pool->qhead + 1) % TPQSIZE;
+    1a35:	c1 e9 1a             	shr    $0x1a,%ecx
+    pool->qcount--;
+    1a38:	89 56 20             	mov    %edx,0x20(%esi)
+    pool->qhead = (pool->qhead + 1) % TPQSIZE;
+    1a3b:	01 c8                	add    %ecx,%eax
+    1a3d:	83 e0 3f             	and    $0x3f,%eax
+    1a40:	29 c8                	sub    %ecx,%eax
+    1a42:	89 46 1c             	mov    %eax,0x1c(%esi)
+  lock_release(&pool->qlock);
+    1a45:	ff 75 b8             	push   -0x48(%ebp)
+    1a48:	e8 83 0d 00 00       	call   27d0 <lock_release>
+    1a4d:	b8 01 00 00 00       	mov    $0x1,%eax
+    1a52:	f0 0f c1 86 2c 05 00 	lock xadd %eax,0x52c(%esi)
+    1a59:	00 
+  if(*(volatile int*)nwait)
+    1a5a:	8b 86 30 05 00 00    	mov    0x530(%esi),%eax
+    1a60:	83 c4 10             	add    $0x10,%esp
+    1a63:	85 c0                	test   %eax,%eax
+    1a65:	0f 85 9a 03 00 00    	jne    1e05 <tp_worker+0x485>
+      fetch_and_add(&pool->pending, 1);
+    1a6b:	8d 46 0c             	lea    0xc(%esi),%eax
+    1a6e:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if((pf = t->pf) == 0){
+    1a71:	85 ff                	test   %edi,%edi
+    1a73:	0f 84 1d 02 00 00    	je     1c96 <tp_worker+0x316>
+    1a79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    while(t->hi - t->lo > pf->grain){
+    1a80:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1a83:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1a86:	29 c2                	sub    %eax,%edx
+    1a88:	39 57 08             	cmp    %edx,0x8(%edi)
+    1a8b:	0f 8d 85 01 00 00    	jge    1c16 <tp_worker+0x296>
+    1a91:	89 5d b4             	mov    %ebx,-0x4c(%ebp)
+    1a94:	89 7d cc             	mov    %edi,-0x34(%ebp)
+    1a97:	89 f7                	mov    %esi,%edi
+    1a99:	89 d6                	mov    %edx,%esi
+    1a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a9f:	90                   	nop
+      half.lo = t->lo + (t->hi - t->lo) / 2;
+    1aa0:	89 f3                	mov    %esi,%ebx
+    1aa2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1aa5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  lock_acquire(&d->lock);
+    1aa8:	83 ec 0c             	sub    $0xc,%esp
+      half.lo = t->lo + (t->hi - t->lo) / 2;
+    1aab:	c1 eb 1f             	shr    $0x1f,%ebx
+    1aae:	01 f3                	add    %esi,%ebx
+    1ab0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    1ab3:	d1 fb                	sar    %ebx
+    1ab5:	8d 04 19             	lea    (%ecx,%ebx,1),%eax
+    1ab8:	89 de                	mov    %ebx,%esi
+    1aba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  lock_acquire(&d->lock);
+    1abd:	ff 75 dc             	push   -0x24(%ebp)
+    1ac0:	e8 9b 0c 00 00       	call   2760 <lock_acquire>
+  if((ok = d->bottom - d->top < TPDEQSIZE))
+    1ac5:	8b 55 c8             	mov    -0x38(%ebp),%edx
+    1ac8:	83 c4 10             	add    $0x10,%esp
+    1acb:	8b 82 44 05 00 00    	mov    0x544(%edx),%eax
+    1ad1:	89 c1                	mov    %eax,%ecx
+    1ad3:	2b 8a 40 05 00 00    	sub    0x540(%edx),%ecx
+    1ad9:	83 f9 1f             	cmp    $0x1f,%ecx
+    1adc:	0f 8e 96 00 00 00    	jle    1b78 <tp_worker+0x1f8>
+  lock_release(&d->lock);
+    1ae2:	83 ec 0c             	sub    $0xc,%esp
+    1ae5:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+    1ae8:	89 fe                	mov    %edi,%esi
+    1aea:	8b 7d cc             	mov    -0x34(%ebp),%edi
+    1aed:	ff 75 dc             	push   -0x24(%ebp)
+    1af0:	e8 db 0c 00 00       	call   27d0 <lock_release>
+    1af5:	83 c4 10             	add    $0x10,%esp
+    for(i = t->lo; i < t->hi; i++)
+    1af8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    1afb:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+    1afe:	39 ca                	cmp    %ecx,%edx
+    1b00:	7d 2e                	jge    1b30 <tp_worker+0x1b0>
+    1b02:	89 75 08             	mov    %esi,0x8(%ebp)
+    1b05:	89 fe                	mov    %edi,%esi
+    1b07:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1b0a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+    1b0d:	89 d3                	mov    %edx,%ebx
+      pf->body(i, pf->arg);
+    1b0f:	83 ec 08             	sub    $0x8,%esp
+    1b12:	ff 76 04             	push   0x4(%esi)
+    1b15:	53                   	push   %ebx
+    for(i = t->lo; i < t->hi; i++)
+    1b16:	83 c3 01             	add    $0x1,%ebx
+      pf->body(i, pf->arg);
+    1b19:	ff 16                	call   *(%esi)
+    for(i = t->lo; i < t->hi; i++)
+    1b1b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    1b1e:	83 c4 10             	add    $0x10,%esp
+    1b21:	39 c3                	cmp    %eax,%ebx
+    1b23:	75 ea                	jne    1b0f <tp_worker+0x18f>
+    1b25:	89 7d 08             	mov    %edi,0x8(%ebp)
+    1b28:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1b2b:	89 f7                	mov    %esi,%edi
+    1b2d:	8b 75 08             	mov    0x8(%ebp),%esi
+    fetch_and_add(&pf->left, -(t->hi - t->lo));
+    1b30:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1b33:	8b 55 d8             	mov    -0x28(%ebp),%edx
+    1b36:	29 d0                	sub    %edx,%eax
+    1b38:	f0 0f c1 47 0c       	lock xadd %eax,0xc(%edi)
+    1b3d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b42:	f0 0f c1 46 0c       	lock xadd %eax,0xc(%esi)
+    1b47:	b8 01 00 00 00       	mov    $0x1,%eax
+    1b4c:	f0 0f c1 03          	lock xadd %eax,(%ebx)
+  if(*(volatile int*)nwait)
+    1b50:	8b 86 30 05 00 00    	mov    0x530(%esi),%eax
+    1b56:	85 c0                	test   %eax,%eax
+    1b58:	0f 84 52 fe ff ff    	je     19b0 <tp_worker+0x30>
+    futex_wake(seq, NPROC);
+    1b5e:	83 ec 08             	sub    $0x8,%esp
+    1b61:	68 00 04 00 00       	push   $0x400
+    1b66:	53                   	push   %ebx
+    1b67:	e8 17 f9 ff ff       	call   1483 <futex_wake>
+}
+    1b6c:	83 c4 10             	add    $0x10,%esp
+      continue;
+    1b6f:	e9 3c fe ff ff       	jmp    19b0 <tp_worker+0x30>
+    1b74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    d->task[d->bottom++ % TPDEQSIZE] = *t;
+    1b78:	8d 48 01             	lea    0x1(%eax),%ecx
+  lock_release(&d->lock);
+    1b7b:	83 ec 0c             	sub    $0xc,%esp
+    d->task[d->bottom++ % TPDEQSIZE] = *t;
+    1b7e:	89 8a 44 05 00 00    	mov    %ecx,0x544(%edx)
+    1b84:	89 c1                	mov    %eax,%ecx
+    1b86:	8b 55 c0             	mov    -0x40(%ebp),%edx
+    1b89:	c1 f9 1f             	sar    $0x1f,%ecx
+    1b8c:	c1 e9 1b             	shr    $0x1b,%ecx
+    1b8f:	01 c8                	add    %ecx,%eax
+    1b91:	83 e0 1f             	and    $0x1f,%eax
+    1b94:	29 c8                	sub    %ecx,%eax
+    1b96:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+    1b99:	c1 e1 02             	shl    $0x2,%ecx
+    1b9c:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+    1b9f:	8d 84 0a 48 05 00 00 	lea    0x548(%edx,%ecx,1),%eax
+    1ba6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    1ba9:	01 f8                	add    %edi,%eax
+    1bab:	89 08                	mov    %ecx,(%eax)
+    1bad:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1bb0:	89 48 04             	mov    %ecx,0x4(%eax)
+    1bb3:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+    1bb6:	89 48 08             	mov    %ecx,0x8(%eax)
+    1bb9:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+    1bbc:	01 d1                	add    %edx,%ecx
+    1bbe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1bc1:	89 94 0f 54 05 00 00 	mov    %edx,0x554(%edi,%ecx,1)
+    1bc8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+    1bcb:	89 50 10             	mov    %edx,0x10(%eax)
+  lock_release(&d->lock);
+    1bce:	ff 75 dc             	push   -0x24(%ebp)
+    1bd1:	e8 fa 0b 00 00       	call   27d0 <lock_release>
+    1bd6:	b8 01 00 00 00       	mov    $0x1,%eax
+    1bdb:	8b 55 bc             	mov    -0x44(%ebp),%edx
+    1bde:	89 c1                	mov    %eax,%ecx
+    1be0:	f0 0f c1 0a          	lock xadd %ecx,(%edx)
+      tp_signal(&pool->workseq, &pool->nworkwait);
+    1be4:	8d 8f 24 05 00 00    	lea    0x524(%edi),%ecx
+    1bea:	f0 0f c1 87 24 05 00 	lock xadd %eax,0x524(%edi)
+    1bf1:	00 
+  if(*(volatile int*)nwait)
+    1bf2:	8b 87 28 05 00 00    	mov    0x528(%edi),%eax
+    1bf8:	83 c4 10             	add    $0x10,%esp
+    1bfb:	85 c0                	test   %eax,%eax
+    1bfd:	0f 85 ad 00 00 00    	jne    1cb0 <tp_worker+0x330>
+    while(t->hi - t->lo > pf->grain){
+    1c03:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    1c06:	3b 58 08             	cmp    0x8(%eax),%ebx
+    1c09:	0f 8f 91 fe ff ff    	jg     1aa0 <tp_worker+0x120>
+      half.lo = t->lo + (t->hi - t->lo) / 2;
+    1c0f:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+    1c12:	89 fe                	mov    %edi,%esi
+    1c14:	89 c7                	mov    %eax,%edi
+    1c16:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1c19:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    1c1c:	e9 d7 fe ff ff       	jmp    1af8 <tp_worker+0x178>
+    1c21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      *t = d->task[--d->bottom % TPDEQSIZE];
+    1c28:	83 e8 01             	sub    $0x1,%eax
+    1c2b:	8b 7d c8             	mov    -0x38(%ebp),%edi
+  lock_release(&d->lock);
+    1c2e:	83 ec 0c             	sub    $0xc,%esp
+      *t = d->task[--d->bottom % TPDEQSIZE];
+    1c31:	99                   	cltd
+    1c32:	c1 ea 1b             	shr    $0x1b,%edx
+    1c35:	89 87 44 05 00 00    	mov    %eax,0x544(%edi)
+    1c3b:	8b 7d c0             	mov    -0x40(%ebp),%edi
+    1c3e:	01 d0                	add    %edx,%eax
+    1c40:	83 e0 1f             	and    $0x1f,%eax
+    1c43:	29 d0                	sub    %edx,%eax
+    1c45:	8d 04 80             	lea    (%eax,%eax,4),%eax
+    1c48:	8d 04 87             	lea    (%edi,%eax,4),%eax
+    1c4b:	01 f0                	add    %esi,%eax
+    1c4d:	8b b8 48 05 00 00    	mov    0x548(%eax),%edi
+    1c53:	8b 98 4c 05 00 00    	mov    0x54c(%eax),%ebx
+    1c59:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    1c5c:	8b b8 50 05 00 00    	mov    0x550(%eax),%edi
+    1c62:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+    1c65:	8b 98 54 05 00 00    	mov    0x554(%eax),%ebx
+    1c6b:	8b 80 58 05 00 00    	mov    0x558(%eax),%eax
+    1c71:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+    tp_signal(&pool->doneseq, &pool->ndonewait);  // a slot is free
+    1c74:	8d 9e 2c 05 00 00    	lea    0x52c(%esi),%ebx
+      *t = d->task[--d->bottom % TPDEQSIZE];
+    1c7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  lock_release(&d->lock);
+    1c7d:	ff 75 dc             	push   -0x24(%ebp)
+    1c80:	e8 4b 0b 00 00       	call   27d0 <lock_release>
+      fetch_and_add(&pool->pending, 1);
+    1c85:	8d 46 0c             	lea    0xc(%esi),%eax
+    tp_signal(&pool->doneseq, &pool->ndonewait);  // a slot is free
+    1c88:	83 c4 10             	add    $0x10,%esp
+      fetch_and_add(&pool->pending, 1);
+    1c8b:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if((pf = t->pf) == 0){
+    1c8e:	85 ff                	test   %edi,%edi
+    1c90:	0f 85 ea fd ff ff    	jne    1a80 <tp_worker+0x100>
+    t->fn(t->arg);
+    1c96:	83 ec 0c             	sub    $0xc,%esp
+    1c99:	ff 75 d4             	push   -0x2c(%ebp)
+    1c9c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1c9f:	ff d0                	call   *%eax
+    1ca1:	83 c4 10             	add    $0x10,%esp
+    1ca4:	e9 94 fe ff ff       	jmp    1b3d <tp_worker+0x1bd>
+    1ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(seq, NPROC);
+    1cb0:	83 ec 08             	sub    $0x8,%esp
+    1cb3:	68 00 04 00 00       	push   $0x400
+    1cb8:	51                   	push   %ecx
+    1cb9:	e8 c5 f7 ff ff       	call   1483 <futex_wake>
+}
+    1cbe:	83 c4 10             	add    $0x10,%esp
+    1cc1:	e9 3d ff ff ff       	jmp    1c03 <tp_worker+0x283>
+    1cc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ccd:	8d 76 00             	lea    0x0(%esi),%esi
+  lock_release(&pool->qlock);
+    1cd0:	83 ec 0c             	sub    $0xc,%esp
+    1cd3:	ff 75 b8             	push   -0x48(%ebp)
+  for(i = 1; i < pool->nworkers; i++)
+    1cd6:	bf 01 00 00 00       	mov    $0x1,%edi
+  lock_release(&pool->qlock);
+    1cdb:	e8 f0 0a 00 00       	call   27d0 <lock_release>
+  for(i = 1; i < pool->nworkers; i++)
+    1ce0:	8b 1e                	mov    (%esi),%ebx
+    1ce2:	83 c4 10             	add    $0x10,%esp
+    1ce5:	83 fb 01             	cmp    $0x1,%ebx
+    1ce8:	0f 8e bb 00 00 00    	jle    1da9 <tp_worker+0x429>
+    1cee:	89 d9                	mov    %ebx,%ecx
+    1cf0:	89 fb                	mov    %edi,%ebx
+    1cf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(tp_pop(&pool->deque[(w + i) % pool->nworkers], t, 1))
+    1cf8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  lock_acquire(&d->lock);
+    1cfb:	83 ec 0c             	sub    $0xc,%esp
+    if(tp_pop(&pool->deque[(w + i) % pool->nworkers], t, 1))
+    1cfe:	01 d8                	add    %ebx,%eax
+    1d00:	99                   	cltd
+    1d01:	f7 f9                	idiv   %ecx
+    1d03:	69 fa 94 02 00 00    	imul   $0x294,%edx,%edi
+    1d09:	8d 8c 3e 34 05 00 00 	lea    0x534(%esi,%edi,1),%ecx
+  lock_acquire(&d->lock);
+    1d10:	51                   	push   %ecx
+    1d11:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1d14:	e8 47 0a 00 00       	call   2760 <lock_acquire>
+  if((ok = d->bottom > d->top)){
+    1d19:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+    1d1c:	83 c4 10             	add    $0x10,%esp
+    1d1f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1d22:	8b 82 40 05 00 00    	mov    0x540(%edx),%eax
+    1d28:	39 82 44 05 00 00    	cmp    %eax,0x544(%edx)
+    1d2e:	7e 60                	jle    1d90 <tp_worker+0x410>
+      *t = d->task[d->top++ % TPDEQSIZE];
+    1d30:	89 cb                	mov    %ecx,%ebx
+    1d32:	8d 48 01             	lea    0x1(%eax),%ecx
+  lock_release(&d->lock);
+    1d35:	83 ec 0c             	sub    $0xc,%esp
+      *t = d->task[d->top++ % TPDEQSIZE];
+    1d38:	89 8a 40 05 00 00    	mov    %ecx,0x540(%edx)
+    1d3e:	99                   	cltd
+    1d3f:	c1 ea 1b             	shr    $0x1b,%edx
+    1d42:	01 d0                	add    %edx,%eax
+    1d44:	83 e0 1f             	and    $0x1f,%eax
+    1d47:	29 d0                	sub    %edx,%eax
+    1d49:	8d 04 80             	lea    (%eax,%eax,4),%eax
+    1d4c:	8d 04 87             	lea    (%edi,%eax,4),%eax
+    1d4f:	01 f0                	add    %esi,%eax
+    1d51:	8b b8 48 05 00 00    	mov    0x548(%eax),%edi
+    1d57:	8b 90 54 05 00 00    	mov    0x554(%eax),%edx
+    1d5d:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    1d60:	8b b8 4c 05 00 00    	mov    0x54c(%eax),%edi
+    1d66:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    1d69:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1d6c:	8b b8 50 05 00 00    	mov    0x550(%eax),%edi
+    1d72:	8b 80 58 05 00 00    	mov    0x558(%eax),%eax
+    1d78:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  lock_release(&d->lock);
+    1d7b:	53                   	push   %ebx
+    tp_signal(&pool->doneseq, &pool->ndonewait);  // a slot is free
+    1d7c:	8d 9e 2c 05 00 00    	lea    0x52c(%esi),%ebx
+  lock_release(&d->lock);
+    1d82:	e8 49 0a 00 00       	call   27d0 <lock_release>
+    tp_signal(&pool->doneseq, &pool->ndonewait);  // a slot is free
+    1d87:	83 c4 10             	add    $0x10,%esp
+    1d8a:	e9 dc fc ff ff       	jmp    1a6b <tp_worker+0xeb>
+    1d8f:	90                   	nop
+  lock_release(&d->lock);
+    1d90:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < pool->nworkers; i++)
+    1d93:	83 c3 01             	add    $0x1,%ebx
+  lock_release(&d->lock);
+    1d96:	51                   	push   %ecx
+    1d97:	e8 34 0a 00 00       	call   27d0 <lock_release>
+  for(i = 1; i < pool->nworkers; i++)
+    1d9c:	8b 0e                	mov    (%esi),%ecx
+    1d9e:	83 c4 10             	add    $0x10,%esp
+    1da1:	39 d9                	cmp    %ebx,%ecx
+    1da3:	0f 8f 4f ff ff ff    	jg     1cf8 <tp_worker+0x378>
+    if(*(volatile int*)&pool->stop){
+    1da9:	8b 46 04             	mov    0x4(%esi),%eax
+    1dac:	85 c0                	test   %eax,%eax
+    1dae:	75 38                	jne    1de8 <tp_worker+0x468>
+    1db0:	b8 01 00 00 00       	mov    $0x1,%eax
+    1db5:	f0 0f c1 86 28 05 00 	lock xadd %eax,0x528(%esi)
+    1dbc:	00 
+  futex_wait(seq, s);
+    1dbd:	83 ec 08             	sub    $0x8,%esp
+    tp_sleep(&pool->workseq, s, &pool->nworkwait);
+    1dc0:	8d 86 24 05 00 00    	lea    0x524(%esi),%eax
+  futex_wait(seq, s);
+    1dc6:	ff 75 e0             	push   -0x20(%ebp)
+    1dc9:	50                   	push   %eax
+    1dca:	e8 ac f6 ff ff       	call   147b <futex_wait>
+    1dcf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1dd4:	f0 0f c1 86 28 05 00 	lock xadd %eax,0x528(%esi)
+    1ddb:	00 
+}
+    1ddc:	83 c4 10             	add    $0x10,%esp
+    1ddf:	e9 cc fb ff ff       	jmp    19b0 <tp_worker+0x30>
+    1de4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      fetch_and_add(&pool->nlive, -1);
+    1de8:	8d 56 08             	lea    0x8(%esi),%edx
+    1deb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1df0:	f0 0f c1 46 08       	lock xadd %eax,0x8(%esi)
+      futex_wake(&pool->nlive, 1);
+    1df5:	83 ec 08             	sub    $0x8,%esp
+    1df8:	6a 01                	push   $0x1
+    1dfa:	52                   	push   %edx
+    1dfb:	e8 83 f6 ff ff       	call   1483 <futex_wake>
+      exit();
+    1e00:	e8 4e f5 ff ff       	call   1353 <exit>
+    futex_wake(seq, NPROC);
+    1e05:	50                   	push   %eax
+    1e06:	50                   	push   %eax
+    1e07:	68 00 04 00 00       	push   $0x400
+    1e0c:	53                   	push   %ebx
+    1e0d:	e8 71 f6 ff ff       	call   1483 <futex_wake>
+    1e12:	83 c4 10             	add    $0x10,%esp
+    1e15:	e9 51 fc ff ff       	jmp    1a6b <tp_worker+0xeb>
+    1e1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001e20 <tpool_submit>:
+
+// Queue fn(arg) to run on some worker.
+void
+tpool_submit(struct tpool *pool, void (*fn)(void*), void *arg)
+{
+    1e20:	55                   	push   %ebp
+    1e21:	89 e5                	mov    %esp,%ebp
+    1e23:	83 ec 28             	sub    $0x28,%esp
+  struct tptask t;
+
+  t.fn = fn;
+    1e26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  t.arg = arg;
+  t.pf = 0;
+  tp_enqueue(pool, &t);
+    1e29:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  t.pf = 0;
+    1e2c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  t.fn = fn;
+    1e33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  t.arg = arg;
+    1e36:	8b 45 10             	mov    0x10(%ebp),%eax
+    1e39:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  tp_enqueue(pool, &t);
+    1e3c:	8b 45 08             	mov    0x8(%ebp),%eax
+    1e3f:	e8 2c fa ff ff       	call   1870 <tp_enqueue>
+}
+    1e44:	c9                   	leave
+    1e45:	c3                   	ret
+    1e46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001e50 <tpool_wait>:
+
+// Wait until every task submitted so far has finished.
+void
+tpool_wait(struct tpool *pool)
+{
+    1e50:	55                   	push   %ebp
+    1e51:	89 e5                	mov    %esp,%ebp
+    1e53:	57                   	push   %edi
+    1e54:	56                   	push   %esi
+    1e55:	53                   	push   %ebx
+    1e56:	83 ec 0c             	sub    $0xc,%esp
+    1e59:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int s;
+
+  for(;;){
+    s = *(volatile int*)&pool->doneseq;
+    1e5c:	8b 97 2c 05 00 00    	mov    0x52c(%edi),%edx
+    if(*(volatile int*)&pool->pending == 0)
+    1e62:	8b 47 0c             	mov    0xc(%edi),%eax
+    1e65:	85 c0                	test   %eax,%eax
+    1e67:	74 3b                	je     1ea4 <tpool_wait+0x54>
+    1e69:	8d 9f 30 05 00 00    	lea    0x530(%edi),%ebx
+    1e6f:	8d b7 2c 05 00 00    	lea    0x52c(%edi),%esi
+    1e75:	8d 76 00             	lea    0x0(%esi),%esi
+    1e78:	b8 01 00 00 00       	mov    $0x1,%eax
+    1e7d:	f0 0f c1 03          	lock xadd %eax,(%ebx)
+  futex_wait(seq, s);
+    1e81:	83 ec 08             	sub    $0x8,%esp
+    1e84:	52                   	push   %edx
+    1e85:	56                   	push   %esi
+    1e86:	e8 f0 f5 ff ff       	call   147b <futex_wait>
+    1e8b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e90:	f0 0f c1 03          	lock xadd %eax,(%ebx)
+    s = *(volatile int*)&pool->doneseq;
+    1e94:	8b 97 2c 05 00 00    	mov    0x52c(%edi),%edx
+    if(*(volatile int*)&pool->pending == 0)
+    1e9a:	8b 47 0c             	mov    0xc(%edi),%eax
+    1e9d:	83 c4 10             	add    $0x10,%esp
+    1ea0:	85 c0                	test   %eax,%eax
+    1ea2:	75 d4                	jne    1e78 <tpool_wait+0x28>
+      return;
+    tp_sleep(&pool->doneseq, s, &pool->ndonewait);
+  }
+}
+    1ea4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ea7:	5b                   	pop    %ebx
+    1ea8:	5e                   	pop    %esi
+    1ea9:	5f                   	pop    %edi
+    1eaa:	5d                   	pop    %ebp
+    1eab:	c3                   	ret
+    1eac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001eb0 <tpool_destroy>:
+
+// Finish all tasks, then stop the workers and wait until
+// none of them can touch the pool any more.
+void
+tpool_destroy(struct tpool *pool)
+{
+    1eb0:	55                   	push   %ebp
+    1eb1:	89 e5                	mov    %esp,%ebp
+    1eb3:	57                   	push   %edi
+    1eb4:	56                   	push   %esi
+    1eb5:	53                   	push   %ebx
+    1eb6:	83 ec 0c             	sub    $0xc,%esp
+    1eb9:	8b 75 08             	mov    0x8(%ebp),%esi
+    s = *(volatile int*)&pool->doneseq;
+    1ebc:	8b 96 2c 05 00 00    	mov    0x52c(%esi),%edx
+    if(*(volatile int*)&pool->pending == 0)
+    1ec2:	8b 46 0c             	mov    0xc(%esi),%eax
+    1ec5:	8d 9e 30 05 00 00    	lea    0x530(%esi),%ebx
+    1ecb:	8d be 2c 05 00 00    	lea    0x52c(%esi),%edi
+    1ed1:	85 c0                	test   %eax,%eax
+    1ed3:	74 2f                	je     1f04 <tpool_destroy+0x54>
+    1ed5:	8d 76 00             	lea    0x0(%esi),%esi
+    1ed8:	b8 01 00 00 00       	mov    $0x1,%eax
+    1edd:	f0 0f c1 03          	lock xadd %eax,(%ebx)
+  futex_wait(seq, s);
+    1ee1:	83 ec 08             	sub    $0x8,%esp
+    1ee4:	52                   	push   %edx
+    1ee5:	57                   	push   %edi
+    1ee6:	e8 90 f5 ff ff       	call   147b <futex_wait>
+    1eeb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ef0:	f0 0f c1 03          	lock xadd %eax,(%ebx)
+    s = *(volatile int*)&pool->doneseq;
+    1ef4:	8b 96 2c 05 00 00    	mov    0x52c(%esi),%edx
+    if(*(volatile int*)&pool->pending == 0)
+    1efa:	8b 46 0c             	mov    0xc(%esi),%eax
+    1efd:	83 c4 10             	add    $0x10,%esp
+    1f00:	85 c0                	test   %eax,%eax
+    1f02:	75 d4                	jne    1ed8 <tpool_destroy+0x28>
+  int n;
+
+  tpool_wait(pool);
+  pool->stop = 1;
+    1f04:	c7 46 04 01 00 00 00 	movl   $0x1,0x4(%esi)
+  tp_signal(&pool->workseq, &pool->nworkwait);
+    1f0b:	8d 96 24 05 00 00    	lea    0x524(%esi),%edx
+    1f11:	b8 01 00 00 00       	mov    $0x1,%eax
+    1f16:	f0 0f c1 86 24 05 00 	lock xadd %eax,0x524(%esi)
+    1f1d:	00 
+  if(*(volatile int*)nwait)
+    1f1e:	8b 86 28 05 00 00    	mov    0x528(%esi),%eax
+    1f24:	85 c0                	test   %eax,%eax
+    1f26:	75 38                	jne    1f60 <tpool_destroy+0xb0>
+  while((n = *(volatile int*)&pool->nlive) != 0)
+    1f28:	8b 46 08             	mov    0x8(%esi),%eax
+    futex_wait(&pool->nlive, n);
+    1f2b:	8d 5e 08             	lea    0x8(%esi),%ebx
+  while((n = *(volatile int*)&pool->nlive) != 0)
+    1f2e:	85 c0                	test   %eax,%eax
+    1f30:	74 1a                	je     1f4c <tpool_destroy+0x9c>
+    1f32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    futex_wait(&pool->nlive, n);
+    1f38:	83 ec 08             	sub    $0x8,%esp
+    1f3b:	50                   	push   %eax
+    1f3c:	53                   	push   %ebx
+    1f3d:	e8 39 f5 ff ff       	call   147b <futex_wait>
+  while((n = *(volatile int*)&pool->nlive) != 0)
+    1f42:	8b 46 08             	mov    0x8(%esi),%eax
+    1f45:	83 c4 10             	add    $0x10,%esp
+    1f48:	85 c0                	test   %eax,%eax
+    1f4a:	75 ec                	jne    1f38 <tpool_destroy+0x88>
+  free(pool);
+    1f4c:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+    1f4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f52:	5b                   	pop    %ebx
+    1f53:	5e                   	pop    %esi
+    1f54:	5f                   	pop    %edi
+    1f55:	5d                   	pop    %ebp
+  free(pool);
+    1f56:	e9 95 f7 ff ff       	jmp    16f0 <free>
+    1f5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1f5f:	90                   	nop
+    futex_wake(seq, NPROC);
+    1f60:	83 ec 08             	sub    $0x8,%esp
+    1f63:	68 00 04 00 00       	push   $0x400
+    1f68:	52                   	push   %edx
+    1f69:	e8 15 f5 ff ff       	call   1483 <futex_wake>
+}
+    1f6e:	83 c4 10             	add    $0x10,%esp
+    1f71:	eb b5                	jmp    1f28 <tpool_destroy+0x78>
+    1f73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001f80 <tpool_create>:
+{
+    1f80:	55                   	push   %ebp
+    1f81:	89 e5                	mov    %esp,%ebp
+    1f83:	57                   	push   %edi
+    1f84:	56                   	push   %esi
+    1f85:	53                   	push   %ebx
+    1f86:	83 ec 0c             	sub    $0xc,%esp
+  if(nworkers < 1 || nworkers > TPOOLMAX)
+    1f89:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f8c:	83 e8 01             	sub    $0x1,%eax
+    1f8f:	83 f8 07             	cmp    $0x7,%eax
+    1f92:	77 7a                	ja     200e <tpool_create+0x8e>
+  if((pool = malloc(sizeof(*pool))) == 0)
+    1f94:	83 ec 0c             	sub    $0xc,%esp
+    1f97:	68 d4 19 00 00       	push   $0x19d4
+    1f9c:	e8 df f7 ff ff       	call   1780 <malloc>
+    1fa1:	83 c4 10             	add    $0x10,%esp
+    1fa4:	89 c3                	mov    %eax,%ebx
+    1fa6:	85 c0                	test   %eax,%eax
+    1fa8:	74 64                	je     200e <tpool_create+0x8e>
+  memset(pool, 0, sizeof(*pool));
+    1faa:	83 ec 04             	sub    $0x4,%esp
+    fetch_and_add(&pool->nlive, 1);
+    1fad:	8d 7b 08             	lea    0x8(%ebx),%edi
+  for(i = 0; i < nworkers; i++){
+    1fb0:	31 f6                	xor    %esi,%esi
+  memset(pool, 0, sizeof(*pool));
+    1fb2:	68 d4 19 00 00       	push   $0x19d4
+    1fb7:	6a 00                	push   $0x0
+    1fb9:	50                   	push   %eax
+    1fba:	e8 11 f2 ff ff       	call   11d0 <memset>
+  pool->nworkers = nworkers;
+    1fbf:	8b 45 08             	mov    0x8(%ebp),%eax
+    fetch_and_add(&pool->nlive, 1);
+    1fc2:	83 c4 10             	add    $0x10,%esp
+  pool->nworkers = nworkers;
+    1fc5:	89 03                	mov    %eax,(%ebx)
+  for(i = 0; i < nworkers; i++){
+    1fc7:	eb 0f                	jmp    1fd8 <tpool_create+0x58>
+    1fc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fd0:	83 c6 01             	add    $0x1,%esi
+    1fd3:	39 75 08             	cmp    %esi,0x8(%ebp)
+    1fd6:	74 38                	je     2010 <tpool_create+0x90>
+    1fd8:	b8 01 00 00 00       	mov    $0x1,%eax
+    1fdd:	f0 0f c1 07          	lock xadd %eax,(%edi)
+    if(thread_create_detached(tp_worker, pool, (void*)i) < 0){
+    1fe1:	83 ec 04             	sub    $0x4,%esp
+    1fe4:	56                   	push   %esi
+    1fe5:	53                   	push   %ebx
+    1fe6:	68 80 19 00 00       	push   $0x1980
+    1feb:	e8 c0 03 00 00       	call   23b0 <thread_create_detached>
+    1ff0:	83 c4 10             	add    $0x10,%esp
+    1ff3:	85 c0                	test   %eax,%eax
+    1ff5:	79 d9                	jns    1fd0 <tpool_create+0x50>
+    1ff7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ffc:	f0 0f c1 07          	lock xadd %eax,(%edi)
+      tpool_destroy(pool);
+    2000:	83 ec 0c             	sub    $0xc,%esp
+      pool->nworkers = i;
+    2003:	89 33                	mov    %esi,(%ebx)
+      tpool_destroy(pool);
+    2005:	53                   	push   %ebx
+    2006:	e8 a5 fe ff ff       	call   1eb0 <tpool_destroy>
+      return 0;
+    200b:	83 c4 10             	add    $0x10,%esp
+    return 0;
+    200e:	31 db                	xor    %ebx,%ebx
+}
+    2010:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2013:	89 d8                	mov    %ebx,%eax
+    2015:	5b                   	pop    %ebx
+    2016:	5e                   	pop    %esi
+    2017:	5f                   	pop    %edi
+    2018:	5d                   	pop    %ebp
+    2019:	c3                   	ret
+    201a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002020 <parallel_for>:
+// and return when all have run.  Must not be called from
+// a task, since it sleeps until the workers are done.
+void
+parallel_for(struct tpool *pool, int lo, int hi,
+             void (*body)(int, void*), void *arg)
+{
+    2020:	55                   	push   %ebp
+    2021:	89 e5                	mov    %esp,%ebp
+    2023:	57                   	push   %edi
+    2024:	56                   	push   %esi
+    2025:	53                   	push   %ebx
+    2026:	83 ec 3c             	sub    $0x3c,%esp
+    2029:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    202c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  struct tpfor pf;
+  struct tptask t;
+  int s;
+
+  if(hi <= lo)
+    202f:	39 4d 10             	cmp    %ecx,0x10(%ebp)
+    2032:	0f 8e a4 00 00 00    	jle    20dc <parallel_for+0xbc>
+    return;
+  pf.body = body;
+    2038:	8b 45 14             	mov    0x14(%ebp),%eax
+  pf.arg = arg;
+  pf.grain = (hi - lo) / (4 * pool->nworkers);
+    203b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  pf.left = hi - lo;
+
+  t.fn = 0;
+  t.arg = 0;
+  t.pf = &pf;
+  t.lo = lo;
+    203e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  t.fn = 0;
+    2041:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  pf.body = body;
+    2048:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  pf.arg = arg;
+    204b:	8b 45 18             	mov    0x18(%ebp),%eax
+  pf.grain = (hi - lo) / (4 * pool->nworkers);
+    204e:	29 cf                	sub    %ecx,%edi
+  pf.left = hi - lo;
+    2050:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  pf.arg = arg;
+    2053:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  pf.grain = (hi - lo) / (4 * pool->nworkers);
+    2056:	8b 03                	mov    (%ebx),%eax
+  t.arg = 0;
+    2058:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  pf.grain = (hi - lo) / (4 * pool->nworkers);
+    205f:	8d 34 85 00 00 00 00 	lea    0x0(,%eax,4),%esi
+    2066:	89 f8                	mov    %edi,%eax
+    2068:	99                   	cltd
+    2069:	f7 fe                	idiv   %esi
+  if(pf.grain < 1)
+    206b:	ba 01 00 00 00       	mov    $0x1,%edx
+    2070:	85 c0                	test   %eax,%eax
+    2072:	0f 4e c2             	cmovle %edx,%eax
+  t.hi = hi;
+  tp_enqueue(pool, &t);
+    2075:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+    2078:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  t.pf = &pf;
+    207b:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    207e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  t.hi = hi;
+    2081:	8b 45 10             	mov    0x10(%ebp),%eax
+    2084:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  tp_enqueue(pool, &t);
+    2087:	89 d8                	mov    %ebx,%eax
+    2089:	e8 e2 f7 ff ff       	call   1870 <tp_enqueue>
+
+  for(;;){
+    s = *(volatile int*)&pool->doneseq;
+    208e:	8b 93 2c 05 00 00    	mov    0x52c(%ebx),%edx
+    if(*(volatile int*)&pf.left == 0)
+    2094:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    2097:	85 c0                	test   %eax,%eax
+    2099:	74 41                	je     20dc <parallel_for+0xbc>
+      return;
+    tp_sleep(&pool->doneseq, s, &pool->ndonewait);
+    209b:	8d bb 30 05 00 00    	lea    0x530(%ebx),%edi
+    20a1:	8d b3 2c 05 00 00    	lea    0x52c(%ebx),%esi
+    20a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20ae:	66 90                	xchg   %ax,%ax
+    20b0:	b8 01 00 00 00       	mov    $0x1,%eax
+    20b5:	f0 0f c1 07          	lock xadd %eax,(%edi)
+  futex_wait(seq, s);
+    20b9:	83 ec 08             	sub    $0x8,%esp
+    20bc:	52                   	push   %edx
+    20bd:	56                   	push   %esi
+    20be:	e8 b8 f3 ff ff       	call   147b <futex_wait>
+    20c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    20c8:	f0 0f c1 07          	lock xadd %eax,(%edi)
+    s = *(volatile int*)&pool->doneseq;
+    20cc:	8b 93 2c 05 00 00    	mov    0x52c(%ebx),%edx
+    if(*(volatile int*)&pf.left == 0)
+    20d2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    20d5:	83 c4 10             	add    $0x10,%esp
+    20d8:	85 c0                	test   %eax,%eax
+    20da:	75 d4                	jne    20b0 <parallel_for+0x90>
+  }
+}
+    20dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    20df:	5b                   	pop    %ebx
+    20e0:	5e                   	pop    %esi
+    20e1:	5f                   	pop    %edi
+    20e2:	5d                   	pop    %ebp
+    20e3:	c3                   	ret
+    20e4:	66 90                	xchg   %ax,%ax
+    20e6:	66 90                	xchg   %ax,%ax
+    20e8:	66 90                	xchg   %ax,%ax
+    20ea:	66 90                	xchg   %ax,%ax
+    20ec:	66 90                	xchg   %ax,%ax
+    20ee:	66 90                	xchg   %ax,%ax
+
+000020f0 <stack_alloc>:
+
+static struct ticketlock stacklock;
+static void *stackpool;
+
+static void *stack_alloc(void)
+{
+    20f0:	55                   	push   %ebp
+    20f1:	89 e5                	mov    %esp,%ebp
+    20f3:	57                   	push   %edi
+    20f4:	56                   	push   %esi
+    20f5:	53                   	push   %ebx
+    20f6:	bb 01 00 00 00       	mov    $0x1,%ebx
+    20fb:	83 ec 5c             	sub    $0x5c,%esp
+    20fe:	f0 0f c1 1d c4 43 00 	lock xadd %ebx,0x43c4
+    2105:	00 
+#define NTURNWAIT 64
+static int turnwait[NTURNWAIT];
+
+static int *turnslot(struct ticketlock *lock, int ticket)
+{
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2106:	b8 c4 43 00 00       	mov    $0x43c4,%eax
+    210b:	c1 e8 02             	shr    $0x2,%eax
+    210e:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    2111:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+    2114:	83 e6 3f             	and    $0x3f,%esi
+    int myTicket = fetch_and_add(&lock->next_ticket, 1);
+    int *w = turnslot(lock, myTicket);
+    int seq;
+
+    for(;;){
+        seq = *(volatile int*)w;
+    2117:	8b 04 b5 c0 42 00 00 	mov    0x42c0(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    211e:	8b 15 c8 43 00 00    	mov    0x43c8,%edx
+    2124:	8d 3c b5 c0 42 00 00 	lea    0x42c0(,%esi,4),%edi
+    212b:	39 d3                	cmp    %edx,%ebx
+    212d:	74 1f                	je     214e <stack_alloc+0x5e>
+    212f:	90                   	nop
+            break;
+        futex_wait(w, seq);
+    2130:	83 ec 08             	sub    $0x8,%esp
+    2133:	50                   	push   %eax
+    2134:	57                   	push   %edi
+    2135:	e8 41 f3 ff ff       	call   147b <futex_wait>
+        seq = *(volatile int*)w;
+    213a:	8b 04 b5 c0 42 00 00 	mov    0x42c0(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2141:	83 c4 10             	add    $0x10,%esp
+    2144:	8b 15 c8 43 00 00    	mov    0x43c8,%edx
+    214a:	39 d3                	cmp    %edx,%ebx
+    214c:	75 e2                	jne    2130 <stack_alloc+0x40>
+	if(stackpool == 0){
+    214e:	8b 35 c0 43 00 00    	mov    0x43c0,%esi
+    2154:	85 f6                	test   %esi,%esi
+    2156:	74 68                	je     21c0 <stack_alloc+0xd0>
+		stackpool = *(void**)p;
+    2158:	8b 06                	mov    (%esi),%eax
+    215a:	a3 c0 43 00 00       	mov    %eax,0x43c0
+    215f:	ba 01 00 00 00       	mov    $0x1,%edx
+    2164:	89 d0                	mov    %edx,%eax
+    2166:	f0 0f c1 05 c8 43 00 	lock xadd %eax,0x43c8
+    216d:	00 
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    int *w;
+
+    // Only bump and wake the next ticket's word if someone
+    // holds that ticket; it may or may not be asleep yet.
+    if (turn != *(volatile int*)&lock->next_ticket){
+    216e:	8b 0d c4 43 00 00    	mov    0x43c4,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    2174:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2177:	39 c8                	cmp    %ecx,%eax
+    2179:	75 0d                	jne    2188 <stack_alloc+0x98>
+}
+    217b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    217e:	89 f0                	mov    %esi,%eax
+    2180:	5b                   	pop    %ebx
+    2181:	5e                   	pop    %esi
+    2182:	5f                   	pop    %edi
+    2183:	5d                   	pop    %ebp
+    2184:	c3                   	ret
+    2185:	8d 76 00             	lea    0x0(%esi),%esi
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2188:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+    218b:	01 c8                	add    %ecx,%eax
+    218d:	83 e0 3f             	and    $0x3f,%eax
+    2190:	8d 0c 85 c0 42 00 00 	lea    0x42c0(,%eax,4),%ecx
+    2197:	f0 0f c1 14 85 c0 42 	lock xadd %edx,0x42c0(,%eax,4)
+    219e:	00 00 
+        w = turnslot(lock, turn);
+        fetch_and_add(w, 1);
+        futex_wake(w, NPROC);
+    21a0:	83 ec 08             	sub    $0x8,%esp
+    21a3:	68 00 04 00 00       	push   $0x400
+    21a8:	51                   	push   %ecx
+    21a9:	e8 d5 f2 ff ff       	call   1483 <futex_wake>
+    21ae:	83 c4 10             	add    $0x10,%esp
+}
+    21b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    21b4:	89 f0                	mov    %esi,%eax
+    21b6:	5b                   	pop    %ebx
+    21b7:	5e                   	pop    %esi
+    21b8:	5f                   	pop    %edi
+    21b9:	5d                   	pop    %ebp
+    21ba:	c3                   	ret
+    21bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    21bf:	90                   	nop
+		n = join_any(pids, stacks, NREAP, JOIN_NOHANG | JOIN_DETACHED);
+    21c0:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+    21c3:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    21c6:	6a 03                	push   $0x3
+    21c8:	6a 08                	push   $0x8
+    21ca:	53                   	push   %ebx
+    21cb:	50                   	push   %eax
+    21cc:	e8 c2 f2 ff ff       	call   1493 <join_any>
+		for(i = 0; i < n; i++){
+    21d1:	8b 35 c0 43 00 00    	mov    0x43c0,%esi
+    21d7:	83 c4 10             	add    $0x10,%esp
+    21da:	89 da                	mov    %ebx,%edx
+    21dc:	8d 0c 83             	lea    (%ebx,%eax,4),%ecx
+    21df:	85 c0                	test   %eax,%eax
+    21e1:	7e 19                	jle    21fc <stack_alloc+0x10c>
+    21e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    21e7:	90                   	nop
+			*(void**)stacks[i] = stackpool;
+    21e8:	8b 02                	mov    (%edx),%eax
+		for(i = 0; i < n; i++){
+    21ea:	83 c2 04             	add    $0x4,%edx
+			*(void**)stacks[i] = stackpool;
+    21ed:	89 30                	mov    %esi,(%eax)
+			stackpool = stacks[i];
+    21ef:	8b 72 fc             	mov    -0x4(%edx),%esi
+		for(i = 0; i < n; i++){
+    21f2:	39 ca                	cmp    %ecx,%edx
+    21f4:	75 f2                	jne    21e8 <stack_alloc+0xf8>
+    21f6:	89 35 c0 43 00 00    	mov    %esi,0x43c0
+	if((p = stackpool) != 0){
+    21fc:	85 f6                	test   %esi,%esi
+    21fe:	0f 85 54 ff ff ff    	jne    2158 <stack_alloc+0x68>
+	if((p = sbrk((TSTACKPAGES + 2) * PGSIZE)) == (char*)-1){
+    2204:	83 ec 0c             	sub    $0xc,%esp
+    2207:	68 00 60 00 00       	push   $0x6000
+    220c:	e8 ca f1 ff ff       	call   13db <sbrk>
+    2211:	83 c4 10             	add    $0x10,%esp
+    2214:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2217:	0f 84 42 ff ff ff    	je     215f <stack_alloc+0x6f>
+	p += (PGSIZE - (uint)p % PGSIZE) % PGSIZE;
+    221d:	89 c2                	mov    %eax,%edx
+	mguard(p, 1);
+    221f:	83 ec 08             	sub    $0x8,%esp
+	p += (PGSIZE - (uint)p % PGSIZE) % PGSIZE;
+    2222:	f7 da                	neg    %edx
+	mguard(p, 1);
+    2224:	6a 01                	push   $0x1
+	p += (PGSIZE - (uint)p % PGSIZE) % PGSIZE;
+    2226:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+    222c:	8d 34 10             	lea    (%eax,%edx,1),%esi
+	mguard(p, 1);
+    222f:	56                   	push   %esi
+    2230:	e8 56 f2 ff ff       	call   148b <mguard>
+    2235:	ba 01 00 00 00       	mov    $0x1,%edx
+    223a:	89 d0                	mov    %edx,%eax
+    223c:	f0 0f c1 05 c8 43 00 	lock xadd %eax,0x43c8
+    2243:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2244:	8b 0d c4 43 00 00    	mov    0x43c4,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    224a:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    224d:	83 c4 10             	add    $0x10,%esp
+    2250:	39 c8                	cmp    %ecx,%eax
+    2252:	74 29                	je     227d <stack_alloc+0x18d>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2254:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+    2257:	01 c8                	add    %ecx,%eax
+    2259:	83 e0 3f             	and    $0x3f,%eax
+    225c:	8d 0c 85 c0 42 00 00 	lea    0x42c0(,%eax,4),%ecx
+    2263:	f0 0f c1 14 85 c0 42 	lock xadd %edx,0x42c0(,%eax,4)
+    226a:	00 00 
+        futex_wake(w, NPROC);
+    226c:	83 ec 08             	sub    $0x8,%esp
+    226f:	68 00 04 00 00       	push   $0x400
+    2274:	51                   	push   %ecx
+    2275:	e8 09 f2 ff ff       	call   1483 <futex_wake>
+    227a:	83 c4 10             	add    $0x10,%esp
+}
+    227d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+	return p + TSTACKPAGES * PGSIZE;
+    2280:	81 c6 00 40 00 00    	add    $0x4000,%esi
+}
+    2286:	5b                   	pop    %ebx
+    2287:	89 f0                	mov    %esi,%eax
+    2289:	5e                   	pop    %esi
+    228a:	5f                   	pop    %edi
+    228b:	5d                   	pop    %ebp
+    228c:	c3                   	ret
+    228d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002290 <thread_create>:
+{
+    2290:	55                   	push   %ebp
+    2291:	89 e5                	mov    %esp,%ebp
+    2293:	57                   	push   %edi
+    2294:	56                   	push   %esi
+    2295:	53                   	push   %ebx
+    2296:	83 ec 1c             	sub    $0x1c,%esp
+	void *stack = stack_alloc();
+    2299:	e8 52 fe ff ff       	call   20f0 <stack_alloc>
+	if(stack == 0)
+    229e:	85 c0                	test   %eax,%eax
+    22a0:	0f 84 f6 00 00 00    	je     239c <thread_create+0x10c>
+	if((pid = clone(start_routine, arg1, arg2, stack, flags | CLONE_FILES | CLONE_FS)) < 0)
+    22a6:	83 ec 0c             	sub    $0xc,%esp
+    22a9:	89 c3                	mov    %eax,%ebx
+    22ab:	6a 06                	push   $0x6
+    22ad:	50                   	push   %eax
+    22ae:	ff 75 10             	push   0x10(%ebp)
+    22b1:	ff 75 0c             	push   0xc(%ebp)
+    22b4:	ff 75 08             	push   0x8(%ebp)
+    22b7:	e8 57 f1 ff ff       	call   1413 <clone>
+    22bc:	83 c4 20             	add    $0x20,%esp
+    22bf:	89 c6                	mov    %eax,%esi
+    22c1:	85 c0                	test   %eax,%eax
+    22c3:	78 0b                	js     22d0 <thread_create+0x40>
+}
+    22c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    22c8:	89 f0                	mov    %esi,%eax
+    22ca:	5b                   	pop    %ebx
+    22cb:	5e                   	pop    %esi
+    22cc:	5f                   	pop    %edi
+    22cd:	5d                   	pop    %ebp
+    22ce:	c3                   	ret
+    22cf:	90                   	nop
+    22d0:	bf 01 00 00 00       	mov    $0x1,%edi
+    22d5:	f0 0f c1 3d c4 43 00 	lock xadd %edi,0x43c4
+    22dc:	00 
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    22dd:	b8 c4 43 00 00       	mov    $0x43c4,%eax
+    22e2:	c1 e8 02             	shr    $0x2,%eax
+    22e5:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+    22e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    22eb:	83 e1 3f             	and    $0x3f,%ecx
+    22ee:	8d 04 8d c0 42 00 00 	lea    0x42c0(,%ecx,4),%eax
+    22f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        seq = *(volatile int*)w;
+    22f8:	8b 04 8d c0 42 00 00 	mov    0x42c0(,%ecx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    22ff:	8b 15 c8 43 00 00    	mov    0x43c8,%edx
+    2305:	39 fa                	cmp    %edi,%edx
+    2307:	74 33                	je     233c <thread_create+0xac>
+    2309:	89 75 dc             	mov    %esi,-0x24(%ebp)
+    230c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    230f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+    2312:	89 cb                	mov    %ecx,%ebx
+    2314:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(w, seq);
+    2318:	83 ec 08             	sub    $0x8,%esp
+    231b:	50                   	push   %eax
+    231c:	56                   	push   %esi
+    231d:	e8 59 f1 ff ff       	call   147b <futex_wait>
+        seq = *(volatile int*)w;
+    2322:	8b 04 9d c0 42 00 00 	mov    0x42c0(,%ebx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2329:	83 c4 10             	add    $0x10,%esp
+    232c:	8b 15 c8 43 00 00    	mov    0x43c8,%edx
+    2332:	39 d7                	cmp    %edx,%edi
+    2334:	75 e2                	jne    2318 <thread_create+0x88>
+    2336:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    2339:	8b 75 dc             	mov    -0x24(%ebp),%esi
+	*(void**)stack = stackpool;
+    233c:	a1 c0 43 00 00       	mov    0x43c0,%eax
+    2341:	ba 01 00 00 00       	mov    $0x1,%edx
+	stackpool = stack;
+    2346:	89 1d c0 43 00 00    	mov    %ebx,0x43c0
+	*(void**)stack = stackpool;
+    234c:	89 03                	mov    %eax,(%ebx)
+    234e:	89 d0                	mov    %edx,%eax
+    2350:	f0 0f c1 05 c8 43 00 	lock xadd %eax,0x43c8
+    2357:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2358:	8b 0d c4 43 00 00    	mov    0x43c4,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    235e:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2361:	39 c8                	cmp    %ecx,%eax
+    2363:	0f 84 5c ff ff ff    	je     22c5 <thread_create+0x35>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2369:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+    236c:	01 c8                	add    %ecx,%eax
+    236e:	83 e0 3f             	and    $0x3f,%eax
+    2371:	8d 0c 85 c0 42 00 00 	lea    0x42c0(,%eax,4),%ecx
+    2378:	f0 0f c1 14 85 c0 42 	lock xadd %edx,0x42c0(,%eax,4)
+    237f:	00 00 
+        futex_wake(w, NPROC);
+    2381:	83 ec 08             	sub    $0x8,%esp
+    2384:	68 00 04 00 00       	push   $0x400
+    2389:	51                   	push   %ecx
+    238a:	e8 f4 f0 ff ff       	call   1483 <futex_wake>
+    238f:	83 c4 10             	add    $0x10,%esp
+}
+    2392:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2395:	89 f0                	mov    %esi,%eax
+    2397:	5b                   	pop    %ebx
+    2398:	5e                   	pop    %esi
+    2399:	5f                   	pop    %edi
+    239a:	5d                   	pop    %ebp
+    239b:	c3                   	ret
+		return -1;
+    239c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+	return thread_clone(start_routine, arg1, arg2, 0);
+    23a1:	e9 1f ff ff ff       	jmp    22c5 <thread_create+0x35>
+    23a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    23ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000023b0 <thread_create_detached>:
+{
+    23b0:	55                   	push   %ebp
+    23b1:	89 e5                	mov    %esp,%ebp
+    23b3:	57                   	push   %edi
+    23b4:	56                   	push   %esi
+    23b5:	53                   	push   %ebx
+    23b6:	83 ec 1c             	sub    $0x1c,%esp
+	void *stack = stack_alloc();
+    23b9:	e8 32 fd ff ff       	call   20f0 <stack_alloc>
+	if(stack == 0)
+    23be:	85 c0                	test   %eax,%eax
+    23c0:	0f 84 f6 00 00 00    	je     24bc <thread_create_detached+0x10c>
+	if((pid = clone(start_routine, arg1, arg2, stack, flags | CLONE_FILES | CLONE_FS)) < 0)
+    23c6:	83 ec 0c             	sub    $0xc,%esp
+    23c9:	89 c3                	mov    %eax,%ebx
+    23cb:	6a 07                	push   $0x7
+    23cd:	50                   	push   %eax
+    23ce:	ff 75 10             	push   0x10(%ebp)
+    23d1:	ff 75 0c             	push   0xc(%ebp)
+    23d4:	ff 75 08             	push   0x8(%ebp)
+    23d7:	e8 37 f0 ff ff       	call   1413 <clone>
+    23dc:	83 c4 20             	add    $0x20,%esp
+    23df:	89 c6                	mov    %eax,%esi
+    23e1:	85 c0                	test   %eax,%eax
+    23e3:	78 0b                	js     23f0 <thread_create_detached+0x40>
+}
+    23e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    23e8:	89 f0                	mov    %esi,%eax
+    23ea:	5b                   	pop    %ebx
+    23eb:	5e                   	pop    %esi
+    23ec:	5f                   	pop    %edi
+    23ed:	5d                   	pop    %ebp
+    23ee:	c3                   	ret
+    23ef:	90                   	nop
+    23f0:	bf 01 00 00 00       	mov    $0x1,%edi
+    23f5:	f0 0f c1 3d c4 43 00 	lock xadd %edi,0x43c4
+    23fc:	00 
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    23fd:	b8 c4 43 00 00       	mov    $0x43c4,%eax
+    2402:	c1 e8 02             	shr    $0x2,%eax
+    2405:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+    2408:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    240b:	83 e1 3f             	and    $0x3f,%ecx
+    240e:	8d 04 8d c0 42 00 00 	lea    0x42c0(,%ecx,4),%eax
+    2415:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        seq = *(volatile int*)w;
+    2418:	8b 04 8d c0 42 00 00 	mov    0x42c0(,%ecx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    241f:	8b 15 c8 43 00 00    	mov    0x43c8,%edx
+    2425:	39 fa                	cmp    %edi,%edx
+    2427:	74 33                	je     245c <thread_create_detached+0xac>
+    2429:	89 75 dc             	mov    %esi,-0x24(%ebp)
+    242c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    242f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+    2432:	89 cb                	mov    %ecx,%ebx
+    2434:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(w, seq);
+    2438:	83 ec 08             	sub    $0x8,%esp
+    243b:	50                   	push   %eax
+    243c:	56                   	push   %esi
+    243d:	e8 39 f0 ff ff       	call   147b <futex_wait>
+        seq = *(volatile int*)w;
+    2442:	8b 04 9d c0 42 00 00 	mov    0x42c0(,%ebx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2449:	83 c4 10             	add    $0x10,%esp
+    244c:	8b 15 c8 43 00 00    	mov    0x43c8,%edx
+    2452:	39 d7                	cmp    %edx,%edi
+    2454:	75 e2                	jne    2438 <thread_create_detached+0x88>
+    2456:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    2459:	8b 75 dc             	mov    -0x24(%ebp),%esi
+	*(void**)stack = stackpool;
+    245c:	a1 c0 43 00 00       	mov    0x43c0,%eax
+    2461:	ba 01 00 00 00       	mov    $0x1,%edx
+	stackpool = stack;
+    2466:	89 1d c0 43 00 00    	mov    %ebx,0x43c0
+	*(void**)stack = stackpool;
+    246c:	89 03                	mov    %eax,(%ebx)
+    246e:	89 d0                	mov    %edx,%eax
+    2470:	f0 0f c1 05 c8 43 00 	lock xadd %eax,0x43c8
+    2477:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2478:	8b 0d c4 43 00 00    	mov    0x43c4,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    247e:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2481:	39 c8                	cmp    %ecx,%eax
+    2483:	0f 84 5c ff ff ff    	je     23e5 <thread_create_detached+0x35>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2489:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+    248c:	01 c8                	add    %ecx,%eax
+    248e:	83 e0 3f             	and    $0x3f,%eax
+    2491:	8d 0c 85 c0 42 00 00 	lea    0x42c0(,%eax,4),%ecx
+    2498:	f0 0f c1 14 85 c0 42 	lock xadd %edx,0x42c0(,%eax,4)
+    249f:	00 00 
+        futex_wake(w, NPROC);
+    24a1:	83 ec 08             	sub    $0x8,%esp
+    24a4:	68 00 04 00 00       	push   $0x400
+    24a9:	51                   	push   %ecx
+    24aa:	e8 d4 ef ff ff       	call   1483 <futex_wake>
+    24af:	83 c4 10             	add    $0x10,%esp
+}
+    24b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    24b5:	89 f0                	mov    %esi,%eax
+    24b7:	5b                   	pop    %ebx
+    24b8:	5e                   	pop    %esi
+    24b9:	5f                   	pop    %edi
+    24ba:	5d                   	pop    %ebp
+    24bb:	c3                   	ret
+		return -1;
+    24bc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+	return thread_clone(start_routine, arg1, arg2, CLONE_DETACHED);
+    24c1:	e9 1f ff ff ff       	jmp    23e5 <thread_create_detached+0x35>
+    24c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    24cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000024d0 <thread_join>:
+{
+    24d0:	55                   	push   %ebp
+    24d1:	89 e5                	mov    %esp,%ebp
+    24d3:	57                   	push   %edi
+    24d4:	56                   	push   %esi
+  	int result = join(&stack);	
+    24d5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+{
+    24d8:	53                   	push   %ebx
+    24d9:	83 ec 38             	sub    $0x38,%esp
+  	int result = join(&stack);	
+    24dc:	50                   	push   %eax
+    24dd:	e8 39 ef ff ff       	call   141b <join>
+  	if(result > 0 && stack)
+    24e2:	83 c4 10             	add    $0x10,%esp
+  	int result = join(&stack);	
+    24e5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  	if(result > 0 && stack)
+    24e8:	85 c0                	test   %eax,%eax
+    24ea:	0f 8e 92 00 00 00    	jle    2582 <thread_join+0xb2>
+    24f0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    24f3:	85 c9                	test   %ecx,%ecx
+    24f5:	0f 84 87 00 00 00    	je     2582 <thread_join+0xb2>
+    24fb:	be 01 00 00 00       	mov    $0x1,%esi
+    2500:	f0 0f c1 35 c4 43 00 	lock xadd %esi,0x43c4
+    2507:	00 
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2508:	b8 c4 43 00 00       	mov    $0x43c4,%eax
+    250d:	c1 e8 02             	shr    $0x2,%eax
+    2510:	8d 3c 06             	lea    (%esi,%eax,1),%edi
+    2513:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    2516:	83 e7 3f             	and    $0x3f,%edi
+        seq = *(volatile int*)w;
+    2519:	8b 04 bd c0 42 00 00 	mov    0x42c0(,%edi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2520:	8b 15 c8 43 00 00    	mov    0x43c8,%edx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2526:	8d 1c bd c0 42 00 00 	lea    0x42c0(,%edi,4),%ebx
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    252d:	39 f2                	cmp    %esi,%edx
+    252f:	74 28                	je     2559 <thread_join+0x89>
+    2531:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    2534:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(w, seq);
+    2538:	83 ec 08             	sub    $0x8,%esp
+    253b:	50                   	push   %eax
+    253c:	53                   	push   %ebx
+    253d:	e8 39 ef ff ff       	call   147b <futex_wait>
+        seq = *(volatile int*)w;
+    2542:	8b 04 bd c0 42 00 00 	mov    0x42c0(,%edi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2549:	83 c4 10             	add    $0x10,%esp
+    254c:	8b 15 c8 43 00 00    	mov    0x43c8,%edx
+    2552:	39 d6                	cmp    %edx,%esi
+    2554:	75 e2                	jne    2538 <thread_join+0x68>
+    2556:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+	*(void**)stack = stackpool;
+    2559:	a1 c0 43 00 00       	mov    0x43c0,%eax
+    255e:	ba 01 00 00 00       	mov    $0x1,%edx
+	stackpool = stack;
+    2563:	89 0d c0 43 00 00    	mov    %ecx,0x43c0
+	*(void**)stack = stackpool;
+    2569:	89 01                	mov    %eax,(%ecx)
+    256b:	89 d0                	mov    %edx,%eax
+    256d:	f0 0f c1 05 c8 43 00 	lock xadd %eax,0x43c8
+    2574:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2575:	8b 0d c4 43 00 00    	mov    0x43c4,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    257b:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    257e:	39 c8                	cmp    %ecx,%eax
+    2580:	75 0e                	jne    2590 <thread_join+0xc0>
+}
+    2582:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    2585:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2588:	5b                   	pop    %ebx
+    2589:	5e                   	pop    %esi
+    258a:	5f                   	pop    %edi
+    258b:	5d                   	pop    %ebp
+    258c:	c3                   	ret
+    258d:	8d 76 00             	lea    0x0(%esi),%esi
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2590:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+    2593:	01 c8                	add    %ecx,%eax
+    2595:	83 e0 3f             	and    $0x3f,%eax
+    2598:	8d 0c 85 c0 42 00 00 	lea    0x42c0(,%eax,4),%ecx
+    259f:	f0 0f c1 14 85 c0 42 	lock xadd %edx,0x42c0(,%eax,4)
+    25a6:	00 00 
+        futex_wake(w, NPROC);
+    25a8:	83 ec 08             	sub    $0x8,%esp
+    25ab:	68 00 04 00 00       	push   $0x400
+    25b0:	51                   	push   %ecx
+    25b1:	e8 cd ee ff ff       	call   1483 <futex_wake>
+}
+    25b6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+        futex_wake(w, NPROC);
+    25b9:	83 c4 10             	add    $0x10,%esp
+}
+    25bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    25bf:	5b                   	pop    %ebx
+    25c0:	5e                   	pop    %esi
+    25c1:	5f                   	pop    %edi
+    25c2:	5d                   	pop    %ebp
+    25c3:	c3                   	ret
+    25c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    25cf:	90                   	nop
+
+000025d0 <thread_join_many>:
+{
+    25d0:	55                   	push   %ebp
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    25d1:	b8 c4 43 00 00       	mov    $0x43c4,%eax
+    25d6:	c1 e8 02             	shr    $0x2,%eax
+{
+    25d9:	89 e5                	mov    %esp,%ebp
+    25db:	57                   	push   %edi
+    25dc:	56                   	push   %esi
+    25dd:	53                   	push   %ebx
+    25de:	83 ec 6c             	sub    $0x6c,%esp
+    25e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    25e4:	89 45 9c             	mov    %eax,-0x64(%ebp)
+		if((r = join_any(got, stacks, n < NREAP ? n : NREAP, 0)) < 0)
+    25e7:	b8 08 00 00 00       	mov    $0x8,%eax
+    25ec:	39 c2                	cmp    %eax,%edx
+    25ee:	0f 4e c2             	cmovle %edx,%eax
+    25f1:	89 c3                	mov    %eax,%ebx
+    25f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    25f7:	90                   	nop
+    25f8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    25fb:	6a 00                	push   $0x0
+    25fd:	53                   	push   %ebx
+    25fe:	50                   	push   %eax
+    25ff:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    2602:	50                   	push   %eax
+    2603:	e8 8b ee ff ff       	call   1493 <join_any>
+    2608:	83 c4 10             	add    $0x10,%esp
+    260b:	89 45 94             	mov    %eax,-0x6c(%ebp)
+    260e:	85 c0                	test   %eax,%eax
+    2610:	0f 88 11 01 00 00    	js     2727 <thread_join_many+0x157>
+		for(i = 0; i < r; i++){
+    2616:	74 e0                	je     25f8 <thread_join_many+0x28>
+    2618:	c7 45 98 00 00 00 00 	movl   $0x0,-0x68(%ebp)
+    261f:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+    2626:	89 5d 90             	mov    %ebx,-0x70(%ebp)
+    2629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+			if(got[i] != 0)
+    2630:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    2633:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    2637:	85 c0                	test   %eax,%eax
+    2639:	74 0f                	je     264a <thread_join_many+0x7a>
+				pids[k++] = got[i];
+    263b:	8b 4d 98             	mov    -0x68(%ebp),%ecx
+    263e:	8b 7d 08             	mov    0x8(%ebp),%edi
+    2641:	89 04 8f             	mov    %eax,(%edi,%ecx,4)
+    2644:	8d 41 01             	lea    0x1(%ecx),%eax
+    2647:	89 45 98             	mov    %eax,-0x68(%ebp)
+			stack_free(stacks[i]);
+    264a:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    264d:	bb 01 00 00 00       	mov    $0x1,%ebx
+    2652:	8b 4c 85 a8          	mov    -0x58(%ebp,%eax,4),%ecx
+    2656:	f0 0f c1 1d c4 43 00 	lock xadd %ebx,0x43c4
+    265d:	00 
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    265e:	8b 45 9c             	mov    -0x64(%ebp),%eax
+    2661:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    2664:	83 e6 3f             	and    $0x3f,%esi
+        seq = *(volatile int*)w;
+    2667:	8b 04 b5 c0 42 00 00 	mov    0x42c0(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    266e:	8b 15 c8 43 00 00    	mov    0x43c8,%edx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2674:	8d 3c b5 c0 42 00 00 	lea    0x42c0(,%esi,4),%edi
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    267b:	39 da                	cmp    %ebx,%edx
+    267d:	74 2a                	je     26a9 <thread_join_many+0xd9>
+    267f:	89 4d a0             	mov    %ecx,-0x60(%ebp)
+    2682:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        futex_wait(w, seq);
+    2688:	83 ec 08             	sub    $0x8,%esp
+    268b:	50                   	push   %eax
+    268c:	57                   	push   %edi
+    268d:	e8 e9 ed ff ff       	call   147b <futex_wait>
+        seq = *(volatile int*)w;
+    2692:	8b 04 b5 c0 42 00 00 	mov    0x42c0(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2699:	83 c4 10             	add    $0x10,%esp
+    269c:	8b 15 c8 43 00 00    	mov    0x43c8,%edx
+    26a2:	39 d3                	cmp    %edx,%ebx
+    26a4:	75 e2                	jne    2688 <thread_join_many+0xb8>
+    26a6:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+	*(void**)stack = stackpool;
+    26a9:	a1 c0 43 00 00       	mov    0x43c0,%eax
+	stackpool = stack;
+    26ae:	89 0d c0 43 00 00    	mov    %ecx,0x43c0
+	*(void**)stack = stackpool;
+    26b4:	89 01                	mov    %eax,(%ecx)
+    26b6:	b8 01 00 00 00       	mov    $0x1,%eax
+    26bb:	f0 0f c1 05 c8 43 00 	lock xadd %eax,0x43c8
+    26c2:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    26c3:	8b 15 c4 43 00 00    	mov    0x43c4,%edx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    26c9:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    26cc:	39 d0                	cmp    %edx,%eax
+    26ce:	74 2e                	je     26fe <thread_join_many+0x12e>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    26d0:	8b 4d 9c             	mov    -0x64(%ebp),%ecx
+    26d3:	ba 01 00 00 00       	mov    $0x1,%edx
+    26d8:	01 c8                	add    %ecx,%eax
+    26da:	83 e0 3f             	and    $0x3f,%eax
+    26dd:	8d 0c 85 c0 42 00 00 	lea    0x42c0(,%eax,4),%ecx
+    26e4:	f0 0f c1 14 85 c0 42 	lock xadd %edx,0x42c0(,%eax,4)
+    26eb:	00 00 
+        futex_wake(w, NPROC);
+    26ed:	83 ec 08             	sub    $0x8,%esp
+    26f0:	68 00 04 00 00       	push   $0x400
+    26f5:	51                   	push   %ecx
+    26f6:	e8 88 ed ff ff       	call   1483 <futex_wake>
+    26fb:	83 c4 10             	add    $0x10,%esp
+		for(i = 0; i < r; i++){
+    26fe:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+    2702:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    2705:	39 45 94             	cmp    %eax,-0x6c(%ebp)
+    2708:	0f 85 22 ff ff ff    	jne    2630 <thread_join_many+0x60>
+	for(k = 0; k == 0; ){
+    270e:	8b 45 98             	mov    -0x68(%ebp),%eax
+    2711:	8b 5d 90             	mov    -0x70(%ebp),%ebx
+    2714:	85 c0                	test   %eax,%eax
+    2716:	0f 84 dc fe ff ff    	je     25f8 <thread_join_many+0x28>
+}
+    271c:	8b 45 98             	mov    -0x68(%ebp),%eax
+    271f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2722:	5b                   	pop    %ebx
+    2723:	5e                   	pop    %esi
+    2724:	5f                   	pop    %edi
+    2725:	5d                   	pop    %ebp
+    2726:	c3                   	ret
+			return -1;
+    2727:	c7 45 98 ff ff ff ff 	movl   $0xffffffff,-0x68(%ebp)
+}
+    272e:	8b 45 98             	mov    -0x68(%ebp),%eax
+    2731:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2734:	5b                   	pop    %ebx
+    2735:	5e                   	pop    %esi
+    2736:	5f                   	pop    %edi
+    2737:	5d                   	pop    %ebp
+    2738:	c3                   	ret
+    2739:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002740 <lock_init>:
+{
+    2740:	55                   	push   %ebp
+    2741:	89 e5                	mov    %esp,%ebp
+    2743:	8b 45 08             	mov    0x8(%ebp),%eax
+    lock->next_ticket = 0;
+    2746:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    lock->current_turn = 0;
+    274c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+    lock->pid = 0;
+    2753:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+    275a:	5d                   	pop    %ebp
+    275b:	c3                   	ret
+    275c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002760 <lock_acquire>:
+{
+    2760:	55                   	push   %ebp
+    2761:	89 e5                	mov    %esp,%ebp
+    2763:	57                   	push   %edi
+    2764:	56                   	push   %esi
+    2765:	be 01 00 00 00       	mov    $0x1,%esi
+    276a:	53                   	push   %ebx
+    276b:	83 ec 1c             	sub    $0x1c,%esp
+    276e:	8b 7d 08             	mov    0x8(%ebp),%edi
+    2771:	f0 0f c1 37          	lock xadd %esi,(%edi)
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2775:	89 fb                	mov    %edi,%ebx
+    2777:	c1 eb 02             	shr    $0x2,%ebx
+    277a:	01 f3                	add    %esi,%ebx
+    277c:	83 e3 3f             	and    $0x3f,%ebx
+    277f:	8d 04 9d c0 42 00 00 	lea    0x42c0(,%ebx,4),%eax
+    2786:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        seq = *(volatile int*)w;
+    2789:	8b 04 9d c0 42 00 00 	mov    0x42c0(,%ebx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2790:	8b 57 04             	mov    0x4(%edi),%edx
+    2793:	39 d6                	cmp    %edx,%esi
+    2795:	74 26                	je     27bd <lock_acquire+0x5d>
+    2797:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    279e:	66 90                	xchg   %ax,%ax
+        futex_wait(w, seq);
+    27a0:	83 ec 08             	sub    $0x8,%esp
+    27a3:	50                   	push   %eax
+    27a4:	ff 75 e4             	push   -0x1c(%ebp)
+    27a7:	e8 cf ec ff ff       	call   147b <futex_wait>
+        seq = *(volatile int*)w;
+    27ac:	8b 04 9d c0 42 00 00 	mov    0x42c0(,%ebx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    27b3:	8b 57 04             	mov    0x4(%edi),%edx
+    27b6:	83 c4 10             	add    $0x10,%esp
+    27b9:	39 f2                	cmp    %esi,%edx
+    27bb:	75 e3                	jne    27a0 <lock_acquire+0x40>
+}
+    27bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    27c0:	5b                   	pop    %ebx
+    27c1:	5e                   	pop    %esi
+    27c2:	5f                   	pop    %edi
+    27c3:	5d                   	pop    %ebp
+    27c4:	c3                   	ret
+    27c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000027d0 <lock_release>:
+{
+    27d0:	55                   	push   %ebp
+    27d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+    27d6:	89 ca                	mov    %ecx,%edx
+    27d8:	89 e5                	mov    %esp,%ebp
+    27da:	53                   	push   %ebx
+    27db:	83 ec 04             	sub    $0x4,%esp
+    27de:	8b 45 08             	mov    0x8(%ebp),%eax
+    27e1:	f0 0f c1 50 04       	lock xadd %edx,0x4(%eax)
+    if (turn != *(volatile int*)&lock->next_ticket){
+    27e6:	8b 18                	mov    (%eax),%ebx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    27e8:	83 c2 01             	add    $0x1,%edx
+    if (turn != *(volatile int*)&lock->next_ticket){
+    27eb:	39 d3                	cmp    %edx,%ebx
+    27ed:	74 29                	je     2818 <lock_release+0x48>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    27ef:	c1 e8 02             	shr    $0x2,%eax
+    27f2:	01 d0                	add    %edx,%eax
+    27f4:	83 e0 3f             	and    $0x3f,%eax
+    27f7:	8d 14 85 c0 42 00 00 	lea    0x42c0(,%eax,4),%edx
+    27fe:	f0 0f c1 0c 85 c0 42 	lock xadd %ecx,0x42c0(,%eax,4)
+    2805:	00 00 
+        futex_wake(w, NPROC);
+    2807:	83 ec 08             	sub    $0x8,%esp
+    280a:	68 00 04 00 00       	push   $0x400
+    280f:	52                   	push   %edx
+    2810:	e8 6e ec ff ff       	call   1483 <futex_wake>
+    2815:	83 c4 10             	add    $0x10,%esp
+    }
+}
+    2818:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    281b:	c9                   	leave
+    281c:	c3                   	ret
+    281d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002820 <rw_rdlock>:
+    fetch_and_add(nwait, -1);
+}
+
+// reader-writer lock
+void rw_rdlock(struct rwlock *rw)
+{
+    2820:	55                   	push   %ebp
+    2821:	89 e5                	mov    %esp,%ebp
+    2823:	57                   	push   %edi
+    2824:	bf 01 00 00 00       	mov    $0x1,%edi
+    2829:	56                   	push   %esi
+    282a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    282f:	53                   	push   %ebx
+    2830:	83 ec 0c             	sub    $0xc,%esp
+    2833:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    2836:	eb 23                	jmp    285b <rw_rdlock+0x3b>
+    2838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    283f:	90                   	nop
+    2840:	89 f8                	mov    %edi,%eax
+    2842:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+    futex_wait(addr, val);
+    2847:	83 ec 08             	sub    $0x8,%esp
+    284a:	52                   	push   %edx
+    284b:	53                   	push   %ebx
+    284c:	e8 2a ec ff ff       	call   147b <futex_wait>
+    2851:	89 f0                	mov    %esi,%eax
+    2853:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+    2858:	83 c4 10             	add    $0x10,%esp
+    int s;
+
+    for(;;){
+        s = *(volatile int*)&rw->state;
+    285b:	8b 13                	mov    (%ebx),%edx
+        if(s >= 0 && *(volatile int*)&rw->wwait == 0 && cas(&rw->state, s, s + 1))
+    285d:	85 d2                	test   %edx,%edx
+    285f:	78 df                	js     2840 <rw_rdlock+0x20>
+    2861:	8b 43 04             	mov    0x4(%ebx),%eax
+    2864:	85 c0                	test   %eax,%eax
+    2866:	75 d8                	jne    2840 <rw_rdlock+0x20>
+    2868:	8d 4a 01             	lea    0x1(%edx),%ecx
+static inline int
+cas(volatile int *addr, int old, int newval)
+{
+  uchar ok;
+
+  asm volatile("lock; cmpxchgl %3, %1; sete %0" :
+    286b:	89 d0                	mov    %edx,%eax
+    286d:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    2871:	0f 94 c1             	sete   %cl
+    2874:	84 c9                	test   %cl,%cl
+    2876:	74 c8                	je     2840 <rw_rdlock+0x20>
+            return;
+        futex_sleep(&rw->state, s, &rw->nwait);
+    }
+}
+    2878:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    287b:	5b                   	pop    %ebx
+    287c:	5e                   	pop    %esi
+    287d:	5f                   	pop    %edi
+    287e:	5d                   	pop    %ebp
+    287f:	c3                   	ret
+
+00002880 <rw_wrlock>:
+
+void rw_wrlock(struct rwlock *rw)
+{
+    2880:	55                   	push   %ebp
+  asm volatile("lock; xaddl %0, %1"
+    2881:	b8 01 00 00 00       	mov    $0x1,%eax
+    2886:	89 e5                	mov    %esp,%ebp
+    2888:	57                   	push   %edi
+    2889:	56                   	push   %esi
+    288a:	53                   	push   %ebx
+    288b:	83 ec 0c             	sub    $0xc,%esp
+    288e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    2891:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+  asm volatile("lock; cmpxchgl %3, %1; sete %0" :
+    2896:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    289b:	31 ff                	xor    %edi,%edi
+  return value;
+    289d:	eb 07                	jmp    28a6 <rw_wrlock+0x26>
+    289f:	90                   	nop
+    int s;
+
+    fetch_and_add(&rw->wwait, 1);
+    while(!cas(&rw->state, 0, -1)){
+        if((s = *(volatile int*)&rw->state) != 0)
+    28a0:	8b 03                	mov    (%ebx),%eax
+    28a2:	85 c0                	test   %eax,%eax
+    28a4:	75 1a                	jne    28c0 <rw_wrlock+0x40>
+  asm volatile("lock; cmpxchgl %3, %1; sete %0" :
+    28a6:	89 f8                	mov    %edi,%eax
+    28a8:	f0 0f b1 33          	lock cmpxchg %esi,(%ebx)
+    28ac:	0f 94 c2             	sete   %dl
+    while(!cas(&rw->state, 0, -1)){
+    28af:	84 d2                	test   %dl,%dl
+    28b1:	74 ed                	je     28a0 <rw_wrlock+0x20>
+  asm volatile("lock; xaddl %0, %1"
+    28b3:	f0 0f c1 73 04       	lock xadd %esi,0x4(%ebx)
+            futex_sleep(&rw->state, s, &rw->nwait);
+    }
+    fetch_and_add(&rw->wwait, -1);
+}
+    28b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    28bb:	5b                   	pop    %ebx
+    28bc:	5e                   	pop    %esi
+    28bd:	5f                   	pop    %edi
+    28be:	5d                   	pop    %ebp
+    28bf:	c3                   	ret
+    28c0:	ba 01 00 00 00       	mov    $0x1,%edx
+    28c5:	f0 0f c1 53 08       	lock xadd %edx,0x8(%ebx)
+    futex_wait(addr, val);
+    28ca:	83 ec 08             	sub    $0x8,%esp
+    28cd:	50                   	push   %eax
+    28ce:	53                   	push   %ebx
+    28cf:	e8 a7 eb ff ff       	call   147b <futex_wait>
+    28d4:	89 f0                	mov    %esi,%eax
+    28d6:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+    28db:	83 c4 10             	add    $0x10,%esp
+    28de:	eb c6                	jmp    28a6 <rw_wrlock+0x26>
+
+000028e0 <rw_unlock>:
+
+void rw_unlock(struct rwlock *rw)
+{
+    28e0:	55                   	push   %ebp
+    28e1:	89 e5                	mov    %esp,%ebp
+    28e3:	83 ec 08             	sub    $0x8,%esp
+    28e6:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(rw->state < 0)
+    28e9:	8b 02                	mov    (%edx),%eax
+    28eb:	85 c0                	test   %eax,%eax
+    28ed:	78 31                	js     2920 <rw_unlock+0x40>
+    28ef:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    28f4:	f0 0f c1 02          	lock xadd %eax,(%edx)
+        xchg((uint*)&rw->state, 0);
+    else
+        fetch_and_add(&rw->state, -1);
+    if(*(volatile int*)&rw->nwait)
+    28f8:	8b 42 08             	mov    0x8(%edx),%eax
+    28fb:	85 c0                	test   %eax,%eax
+    28fd:	75 09                	jne    2908 <rw_unlock+0x28>
+        futex_wake(&rw->state, NPROC);
+}
+    28ff:	c9                   	leave
+    2900:	c3                   	ret
+    2901:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        futex_wake(&rw->state, NPROC);
+    2908:	83 ec 08             	sub    $0x8,%esp
+    290b:	68 00 04 00 00       	push   $0x400
+    2910:	52                   	push   %edx
+    2911:	e8 6d eb ff ff       	call   1483 <futex_wake>
+    2916:	83 c4 10             	add    $0x10,%esp
+}
+    2919:	c9                   	leave
+    291a:	c3                   	ret
+    291b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    291f:	90                   	nop
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    2920:	31 c0                	xor    %eax,%eax
+    2922:	f0 87 02             	lock xchg %eax,(%edx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    2925:	eb d1                	jmp    28f8 <rw_unlock+0x18>
+    2927:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    292e:	66 90                	xchg   %ax,%ax
+
+00002930 <cond_wait>:
+
+// condition variable
+void cond_wait(struct cond *cv, struct ticketlock *lock)
+{
+    2930:	55                   	push   %ebp
+  asm volatile("lock; xaddl %0, %1"
+    2931:	ba 01 00 00 00       	mov    $0x1,%edx
+    2936:	89 e5                	mov    %esp,%ebp
+    2938:	57                   	push   %edi
+    2939:	56                   	push   %esi
+    293a:	53                   	push   %ebx
+    293b:	83 ec 1c             	sub    $0x1c,%esp
+    293e:	8b 7d 08             	mov    0x8(%ebp),%edi
+    2941:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    int s = *(volatile int*)&cv->seq;
+    2944:	8b 07                	mov    (%edi),%eax
+    2946:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    2949:	89 d0                	mov    %edx,%eax
+    294b:	f0 0f c1 47 04       	lock xadd %eax,0x4(%edi)
+    2950:	89 d0                	mov    %edx,%eax
+    2952:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2957:	8b 0b                	mov    (%ebx),%ecx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2959:	89 de                	mov    %ebx,%esi
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    295b:	83 c0 01             	add    $0x1,%eax
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    295e:	c1 ee 02             	shr    $0x2,%esi
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2961:	39 c8                	cmp    %ecx,%eax
+    2963:	74 26                	je     298b <cond_wait+0x5b>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2965:	01 f0                	add    %esi,%eax
+    2967:	83 e0 3f             	and    $0x3f,%eax
+    296a:	8d 0c 85 c0 42 00 00 	lea    0x42c0(,%eax,4),%ecx
+    2971:	f0 0f c1 14 85 c0 42 	lock xadd %edx,0x42c0(,%eax,4)
+    2978:	00 00 
+        futex_wake(w, NPROC);
+    297a:	83 ec 08             	sub    $0x8,%esp
+    297d:	68 00 04 00 00       	push   $0x400
+    2982:	51                   	push   %ecx
+    2983:	e8 fb ea ff ff       	call   1483 <futex_wake>
+    2988:	83 c4 10             	add    $0x10,%esp
+
+    fetch_and_add(&cv->nwait, 1);
+    lock_release(lock);
+    futex_wait(&cv->seq, s);
+    298b:	83 ec 08             	sub    $0x8,%esp
+    298e:	ff 75 e4             	push   -0x1c(%ebp)
+    2991:	57                   	push   %edi
+    2992:	e8 e4 ea ff ff       	call   147b <futex_wait>
+    2997:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    299c:	f0 0f c1 47 04       	lock xadd %eax,0x4(%edi)
+    29a1:	bf 01 00 00 00       	mov    $0x1,%edi
+    29a6:	f0 0f c1 3b          	lock xadd %edi,(%ebx)
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    29aa:	01 fe                	add    %edi,%esi
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    29ac:	83 c4 10             	add    $0x10,%esp
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    29af:	83 e6 3f             	and    $0x3f,%esi
+        seq = *(volatile int*)w;
+    29b2:	8b 04 b5 c0 42 00 00 	mov    0x42c0(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    29b9:	8b 53 04             	mov    0x4(%ebx),%edx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    29bc:	8d 0c b5 c0 42 00 00 	lea    0x42c0(,%esi,4),%ecx
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    29c3:	39 fa                	cmp    %edi,%edx
+    29c5:	74 25                	je     29ec <cond_wait+0xbc>
+    29c7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    29ca:	89 cf                	mov    %ecx,%edi
+    29cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(w, seq);
+    29d0:	83 ec 08             	sub    $0x8,%esp
+    29d3:	50                   	push   %eax
+    29d4:	57                   	push   %edi
+    29d5:	e8 a1 ea ff ff       	call   147b <futex_wait>
+        seq = *(volatile int*)w;
+    29da:	8b 04 b5 c0 42 00 00 	mov    0x42c0(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    29e1:	83 c4 10             	add    $0x10,%esp
+    29e4:	8b 53 04             	mov    0x4(%ebx),%edx
+    29e7:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+    29ea:	75 e4                	jne    29d0 <cond_wait+0xa0>
+    fetch_and_add(&cv->nwait, -1);
+    lock_acquire(lock);
+}
+    29ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    29ef:	5b                   	pop    %ebx
+    29f0:	5e                   	pop    %esi
+    29f1:	5f                   	pop    %edi
+    29f2:	5d                   	pop    %ebp
+    29f3:	c3                   	ret
+    29f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    29fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    29ff:	90                   	nop
+
+00002a00 <cond_signal>:
+
+void cond_signal(struct cond *cv)
+{
+    2a00:	55                   	push   %ebp
+    2a01:	ba 01 00 00 00       	mov    $0x1,%edx
+    2a06:	89 e5                	mov    %esp,%ebp
+    2a08:	83 ec 08             	sub    $0x8,%esp
+    2a0b:	8b 45 08             	mov    0x8(%ebp),%eax
+    2a0e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    fetch_and_add(&cv->seq, 1);
+    if(*(volatile int*)&cv->nwait)
+    2a12:	8b 50 04             	mov    0x4(%eax),%edx
+    2a15:	85 d2                	test   %edx,%edx
+    2a17:	75 07                	jne    2a20 <cond_signal+0x20>
+        futex_wake(&cv->seq, 1);
+}
+    2a19:	c9                   	leave
+    2a1a:	c3                   	ret
+    2a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2a1f:	90                   	nop
+        futex_wake(&cv->seq, 1);
+    2a20:	83 ec 08             	sub    $0x8,%esp
+    2a23:	6a 01                	push   $0x1
+    2a25:	50                   	push   %eax
+    2a26:	e8 58 ea ff ff       	call   1483 <futex_wake>
+    2a2b:	83 c4 10             	add    $0x10,%esp
+}
+    2a2e:	c9                   	leave
+    2a2f:	c3                   	ret
+
+00002a30 <cond_broadcast>:
+
+void cond_broadcast(struct cond *cv)
+{
+    2a30:	55                   	push   %ebp
+    2a31:	ba 01 00 00 00       	mov    $0x1,%edx
+    2a36:	89 e5                	mov    %esp,%ebp
+    2a38:	83 ec 08             	sub    $0x8,%esp
+    2a3b:	8b 45 08             	mov    0x8(%ebp),%eax
+    2a3e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    fetch_and_add(&cv->seq, 1);
+    if(*(volatile int*)&cv->nwait)
+    2a42:	8b 50 04             	mov    0x4(%eax),%edx
+    2a45:	85 d2                	test   %edx,%edx
+    2a47:	75 07                	jne    2a50 <cond_broadcast+0x20>
+        futex_wake(&cv->seq, NPROC);
+}
+    2a49:	c9                   	leave
+    2a4a:	c3                   	ret
+    2a4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2a4f:	90                   	nop
+        futex_wake(&cv->seq, NPROC);
+    2a50:	83 ec 08             	sub    $0x8,%esp
+    2a53:	68 00 04 00 00       	push   $0x400
+    2a58:	50                   	push   %eax
+    2a59:	e8 25 ea ff ff       	call   1483 <futex_wake>
+    2a5e:	83 c4 10             	add    $0x10,%esp
+}
+    2a61:	c9                   	leave
+    2a62:	c3                   	ret
+    2a63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002a70 <barrier_init>:
+
+// barrier
+void barrier_init(struct barrier *b, int n)
+{
+    2a70:	55                   	push   %ebp
+    2a71:	89 e5                	mov    %esp,%ebp
+    2a73:	8b 45 08             	mov    0x8(%ebp),%eax
+    b->n = n;
+    2a76:	8b 55 0c             	mov    0xc(%ebp),%edx
+    b->count = 0;
+    2a79:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+    b->n = n;
+    2a80:	89 10                	mov    %edx,(%eax)
+    b->gen = 0;
+    2a82:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+    2a89:	5d                   	pop    %ebp
+    2a8a:	c3                   	ret
+    2a8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2a8f:	90                   	nop
+
+00002a90 <barrier_wait>:
+
+// The last thread to arrive starts the next round and
+// wakes the others, who sleep until the round changes.
+void barrier_wait(struct barrier *b)
+{
+    2a90:	55                   	push   %ebp
+    2a91:	ba 01 00 00 00       	mov    $0x1,%edx
+    2a96:	89 d0                	mov    %edx,%eax
+    2a98:	89 e5                	mov    %esp,%ebp
+    2a9a:	57                   	push   %edi
+    2a9b:	56                   	push   %esi
+    2a9c:	53                   	push   %ebx
+    2a9d:	83 ec 0c             	sub    $0xc,%esp
+    2aa0:	8b 75 08             	mov    0x8(%ebp),%esi
+    int gen = *(volatile int*)&b->gen;
+    2aa3:	8b 5e 08             	mov    0x8(%esi),%ebx
+    2aa6:	f0 0f c1 46 04       	lock xadd %eax,0x4(%esi)
+
+    if(fetch_and_add(&b->count, 1) + 1 == b->n){
+    2aab:	83 c0 01             	add    $0x1,%eax
+    2aae:	3b 06                	cmp    (%esi),%eax
+    2ab0:	74 2e                	je     2ae0 <barrier_wait+0x50>
+        b->count = 0;
+        fetch_and_add(&b->gen, 1);
+        futex_wake(&b->gen, NPROC);
+        return;
+    }
+    while(*(volatile int*)&b->gen == gen)
+    2ab2:	8b 46 08             	mov    0x8(%esi),%eax
+        futex_wait(&b->gen, gen);
+    2ab5:	8d 7e 08             	lea    0x8(%esi),%edi
+    while(*(volatile int*)&b->gen == gen)
+    2ab8:	39 c3                	cmp    %eax,%ebx
+    2aba:	75 18                	jne    2ad4 <barrier_wait+0x44>
+    2abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(&b->gen, gen);
+    2ac0:	83 ec 08             	sub    $0x8,%esp
+    2ac3:	53                   	push   %ebx
+    2ac4:	57                   	push   %edi
+    2ac5:	e8 b1 e9 ff ff       	call   147b <futex_wait>
+    while(*(volatile int*)&b->gen == gen)
+    2aca:	8b 46 08             	mov    0x8(%esi),%eax
+    2acd:	83 c4 10             	add    $0x10,%esp
+    2ad0:	39 d8                	cmp    %ebx,%eax
+    2ad2:	74 ec                	je     2ac0 <barrier_wait+0x30>
+}
+    2ad4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2ad7:	5b                   	pop    %ebx
+    2ad8:	5e                   	pop    %esi
+    2ad9:	5f                   	pop    %edi
+    2ada:	5d                   	pop    %ebp
+    2adb:	c3                   	ret
+    2adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        b->count = 0;
+    2ae0:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+        fetch_and_add(&b->gen, 1);
+    2ae7:	8d 46 08             	lea    0x8(%esi),%eax
+    2aea:	f0 0f c1 56 08       	lock xadd %edx,0x8(%esi)
+        futex_wake(&b->gen, NPROC);
+    2aef:	83 ec 08             	sub    $0x8,%esp
+    2af2:	68 00 04 00 00       	push   $0x400
+    2af7:	50                   	push   %eax
+    2af8:	e8 86 e9 ff ff       	call   1483 <futex_wake>
+        return;
+    2afd:	83 c4 10             	add    $0x10,%esp
+}
+    2b00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2b03:	5b                   	pop    %ebx
+    2b04:	5e                   	pop    %esi
+    2b05:	5f                   	pop    %edi
+    2b06:	5d                   	pop    %ebp
+    2b07:	c3                   	ret
@@ -0,0 +1,53 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+#include "ticketlock.h"
+#include "tpool.h"
+
+// A pool of workers runs many small tasks and a parallel_for,
+// and every task and iteration must run exactly once.
+
+#define NWORKERS 4
+#define NTASKS 200
+#define N 1000
+
+int count;
+int square[N];
+
+void task(void *arg)
+{
+	fetch_and_add(&count, (int)arg);
+}
+
+void body(int i, void *arg)
+{
+	square[i] += i * i;
+}
+
+int
+main(int argc, char *argv[])
+{
+	struct tpool *pool;
+	int i, bad;
+
+	if((pool = tpool_create(NWORKERS)) == 0){
+		printf(1, "tpool_create failed\n");
+		exit();
+	}
+
+	for(i = 0; i < NTASKS; i++)
+		tpool_submit(pool, task, (void*)1);
+	tpool_wait(pool);
+	printf(1, "%d of %d tasks ran\n", count, NTASKS);
+
+	parallel_for(pool, 0, N, body, 0);
+	bad = 0;
+	for(i = 0; i < N; i++)
+		if(square[i] != i * i)
+			bad++;
+	printf(1, "parallel_for: %d of %d iterations wrong\n", bad, N);
+
+	tpool_destroy(pool);
+	exit();
+}
@@ -6,15 +6,80 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "sleeplock.h"
+#include "mm.h"
+#include "fs.h"
+#include "file.h"
 #include "rand.h"
 #include "pstat.h"
 #include "ticketlock.h"
-
+#include "sched.h"
+#include "clone.h"
+#include "traps.h"
+
+#define STRIDE1 (1<<22)    // stride of a process holding one ticket
+#define MINQUANTUM 10      // smallest quantum fraction compensated, permille
+// Most tickets one process competes with, so that the tickets
+// of a whole run queue, NPROC processes at most, fit in an int
+// (and so does a weight times 1000, see ptickets()).
+#define MAXWEIGHT (0x7fffffff / (NPROC > 1000 ? NPROC : 1000))
+
+// Per-CPU run queue.  The lottery draws from Fenwick trees
+// holding the tickets of the queue's RUNNABLE processes,
+// indexed by ptable slot, one tree per MLFQ level; stride
+// scheduling takes the top of a heap ordered by pass.
+// Updating a process and choosing the next one are
+// O(log NPROC) either way.
+struct runq {
+  struct spinlock lock;
+  int total;               // tickets on this queue
+  int nrun;                // processes on this queue
+  int nok[NCPU];           // of those, how many each CPU may run
+  int ltotal[NMLFQ];       // tickets on each level
+  int tree[NMLFQ][NPROC+1];
+  struct proc *heap[NPROC];
+  uint pass;               // pass of the last process chosen
+};
+
+// A ticket currency: a group of processes funded with one
+// pool of tickets, split among the members that are active
+// (RUNNABLE or RUNNING) in proportion to their own tickets.
+struct group {
+  int tickets;             // funding; 0 if this slot is free
+  int active;              // tickets of active members
+  struct proc *members;    // linked by proc.gnext
+};
+
+// SLEEPING processes whose channels hash alike, oldest first,
+// linked by proc.cnext and proc.cprev.
+struct sleepq {
+  struct proc *head;
+  struct proc *tail;
+};
+
+// struct procs are carved out of whole pages as they are
+// needed and never given back, so each keeps the slot number
+// it was created with; slots index the run queues' trees.
+// A free proc is UNUSED and on the free list; a live one is
+// in the pid hash and on its parent's list of children.
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  struct proc *slot[NPROC];    // every struct proc, by proc.slot
+  int nslot;                   // struct procs carved so far
+  struct proc *free;           // UNUSED procs, linked by proc.hnext
+  struct proc *pidhash[NPIDHASH]; // live procs by pid, linked by proc.hnext
+  struct sleepq sleepq[NSLEEPQ]; // SLEEPING procs by hash of chan
+  struct runq runq[NCPU];
+  struct group group[NGROUP];
+  struct proc *rt;         // real-time processes, linked by rtnext
+  int rtutil;              // permille of a CPU they have reserved
+  uint lathist[NLATBUCKET]; // waits to run of all processes, see latency()
 } ptable;
 
+static int treebit;        // highest power of two <= NPROC
+static int policy = SCHED_LOTTERY;
+static int gangsched;      // co-schedule threads? see gang()
+
 static struct proc *initproc;
 
 int nextpid = 1;
@@ -22,11 +87,763 @@ extern void forkret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
+static void unlend(struct proc *p);
 
 void
 pinit(void)
 {
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  for(i = 0; i < NCPU; i++)
+    initlock(&ptable.runq[i].lock, "runq");
+  for(treebit = 1; treebit*2 <= NPROC; treebit *= 2)
+    ;
+}
+
+//PAGEBREAK: 30
+// Each CPU draws its lottery from its own run queue.  A process
+// becoming RUNNABLE goes back to the CPU it last ran on, unless
+// another CPU has fewer tickets competing for it, so the tickets
+// on each CPU stay balanced and a process's share of the whole
+// machine still follows its tickets.  A CPU whose queue is empty
+// steals from the busiest one.
+//
+// Each queue has its own lock.  scheduler() takes a process off
+// its own queue, or steals one holding both queues' locks, without
+// ptable.lock; it takes ptable.lock only to switch to the process.
+// Everything else that changes a queue holds ptable.lock and takes
+// the queue's lock inside it.  A claim()ed process is RUNNABLE but
+// on no queue until the CPU that claimed it runs or requeues it.
+//
+// Under SCHED_MLFQ the lottery is drawn only among the processes
+// on the highest non-empty priority level.  Every process starts
+// on level 0 and moves down a level once it has run through
+// MLFQSLICE(level) clock ticks there, so CPU hogs sink below
+// interactive processes; every MLFQBOOST ticks all processes
+// move back to level 0 so the hogs do not starve.
+
+// Add delta tickets to ptable slot i on level l of run queue rq.
+static void
+treeadd(struct runq *rq, int l, int i, int delta)
+{
+  int *tree;
+
+  rq->total += delta;
+  rq->ltotal[l] += delta;
+  tree = rq->tree[l];
+  for(i++; i <= NPROC; i += i & -i)
+    tree[i] += delta;
+}
+
+// Return the slot whose tickets on level l cover winner,
+// where 0 <= winner < rq->ltotal[l].
+static int
+treefind(struct runq *rq, int l, int winner)
+{
+  int i, bit, *tree;
+
+  tree = rq->tree[l];
+  i = 0;
+  for(bit = treebit; bit > 0; bit >>= 1){
+    if(i + bit <= NPROC && tree[i + bit] <= winner){
+      i += bit;
+      winner -= tree[i];
+    }
+  }
+  return i;
+}
+
+// Draw a lottery winner from the non-empty run queue rq:
+// over all its tickets, or under MLFQ only over those on
+// the highest level that has any.  Every process on a queue
+// holds at least one ticket, but should the total still be
+// zero, the draw falls back to the top of the heap.
+static struct proc*
+runqdraw(struct runq *rq)
+{
+  int l, winner;
+
+  if(rq->total <= 0)
+    return rq->heap[0];
+  if(policy == SCHED_MLFQ){
+    for(l = 0; l < NMLFQ - 1 && rq->ltotal[l] <= 0; l++)
+      ;
+    winner = random_at_most(rq->ltotal[l] - 1);
+  } else {
+    winner = random_at_most(rq->total - 1);
+    for(l = 0; winner >= rq->ltotal[l]; l++)
+      winner -= rq->ltotal[l];
+  }
+  return ptable.slot[treefind(rq, l, winner)];
+}
+
+// Base tickets p is worth.  A group member's tickets are in
+// its group's currency: the group's funding is split among its
+// active members, so a job is budgeted as a unit however many
+// processes it forks.  Drawing over these values is the same
+// as drawing a group first and then a member within it.
+// A member is worth at least one ticket, however thinly its
+// group's funding is spread.
+static int
+pbase(struct proc *p)
+{
+  struct group *g;
+  int share, base;
+
+  if(p->group == 0)
+    return p->tickets;
+  g = &ptable.group[p->group - 1];
+  if(g->active <= p->tickets)
+    return g->tickets;
+  share = p->tickets * 1024 / g->active;   // avoid overflow
+  base = g->tickets * share / 1024;
+  return base > 0 ? base : 1;
+}
+
+// Tickets p competes with.  A process that gave up the CPU
+// after using only a fraction f of its last quantum holds
+// compensation tickets inflating its tickets by 1/f until
+// it next runs, so blocking early does not cost it its share.
+// The result is at most MAXWEIGHT.
+static int
+ptickets(struct proc *p)
+{
+  int base, w;
+
+  if(p->borrowed >= MAXWEIGHT)
+    return MAXWEIGHT;
+  base = pbase(p) + p->borrowed;
+  if(base > MAXWEIGHT)
+    base = MAXWEIGHT;
+  if(p->quantum >= 1000)
+    w = base;
+  else if(p->quantum < MINQUANTUM)
+    w = base * (1000 / MINQUANTUM);
+  else
+    w = base * 1000 / p->quantum;
+  return w < MAXWEIGHT ? w : MAXWEIGHT;
+}
+
+// Stride a pass advances by each time a process holding t
+// tickets is chosen.  With compensation and borrowed tickets
+// t can exceed STRIDE1, but the pass must still advance or
+// the process would never give up the CPU.
+static uint
+stride(int t)
+{
+  if(t <= 0)
+    return STRIDE1;
+  if(t >= STRIDE1)
+    return 1;
+  return STRIDE1 / t;
+}
+
+// Permille of the quantum that p, just switched out of
+// CPU c, used.  A process that is RUNNABLE again was
+// preempted by the clock and used all of it.
+static int
+quantumused(struct cpu *c, struct proc *p)
+{
+  uint now, scale;
+
+  now = lapictimer();
+  scale = c->qstart / 1000;
+  if(p->state == RUNNABLE || scale == 0 || now > c->qstart)
+    return 1000;
+  return (c->qstart - now) / scale;
+}
+
+// Does pass a come before pass b?  Passes wrap around, but
+// those on one run queue are never more than a few strides
+// apart, since each queue keeps its own virtual time and a
+// process joining it brings only its lead, see enqueue().
+static int
+passbefore(uint a, uint b)
+{
+  return (int)(a - b) < 0;
+}
+
+// Move the process at index i of rq's heap up or down
+// until the heap is ordered by pass again.
+static void
+heapfix(struct runq *rq, int i)
+{
+  struct proc *p;
+  int j;
+
+  p = rq->heap[i];
+  while(i > 0 && passbefore(p->pass, rq->heap[(i-1)/2]->pass)){
+    rq->heap[i] = rq->heap[(i-1)/2];
+    rq->heap[i]->heapi = i;
+    i = (i-1)/2;
+  }
+  for(;;){
+    j = 2*i + 1;
+    if(j >= rq->nrun)
+      break;
+    if(j+1 < rq->nrun && passbefore(rq->heap[j+1]->pass, rq->heap[j]->pass))
+      j++;
+    if(!passbefore(rq->heap[j]->pass, p->pass))
+      break;
+    rq->heap[i] = rq->heap[j];
+    rq->heap[i]->heapi = i;
+    i = j;
+  }
+  rq->heap[i] = p;
+  p->heapi = i;
+}
+
+// Choose the next process to run from the non-empty
+// run queue rq, according to the scheduling policy.
+// Charges the chosen process one stride, whatever the
+// policy, so that passes stay meaningful across a switch.
+static struct proc*
+runqpick(struct runq *rq)
+{
+  struct proc *p;
+
+  if(policy == SCHED_STRIDE)
+    p = rq->heap[0];
+  else
+    p = runqdraw(rq);
+  rq->pass = p->pass;
+  p->pass += stride(p->weight);
+  return p;
+}
+
+// Lock and return the run queue p is on, or return 0 if
+// it is on none.  Caller must hold ptable.lock, so p can
+// only leave its queue meanwhile, to a claim(), and not
+// join another.
+static struct runq*
+rqlock(struct proc *p)
+{
+  struct runq *rq;
+  int q;
+
+  q = *(volatile int*)&p->rq;
+  if(q < 0)
+    return 0;
+  rq = &ptable.runq[q];
+  acquire(&rq->lock);
+  if(p->rq == q)
+    return rq;
+  release(&rq->lock);
+  return 0;
+}
+
+// Bring p's tickets on its run queue up to date.
+static void
+reweigh(struct proc *p)
+{
+  struct runq *rq;
+  int w;
+
+  w = ptickets(p);
+  if((rq = rqlock(p)) == 0)
+    return;
+  if(w != p->weight){
+    treeadd(rq, p->level, p->slot, w - p->weight);
+    p->weight = w;
+  }
+  release(&rq->lock);
+}
+
+// Lock the run queue of the CPU p is running on, if it is
+// RUNNING: schedtick() charges a running process's MLFQ slice
+// and real-time budget under that lock alone.  Caller must
+// hold ptable.lock.
+static struct runq*
+runlock(struct proc *p)
+{
+  struct runq *rq;
+
+  if(p->state != RUNNING)
+    return 0;
+  rq = &ptable.runq[p->cpu];
+  acquire(&rq->lock);
+  return rq;
+}
+
+// Move p to MLFQ level l, with a fresh allotment.
+static void
+setlevel(struct proc *p, int l)
+{
+  struct runq *rq;
+
+  if((rq = rqlock(p)) != 0){
+    treeadd(rq, p->level, p->slot, -p->weight);
+    treeadd(rq, l, p->slot, p->weight);
+  } else
+    rq = runlock(p);
+  p->level = l;
+  p->slice = 0;
+  if(rq)
+    release(&rq->lock);
+}
+
+// Tickets competing for CPU i, not counting p.
+static int
+cpuload(int i, struct proc *p)
+{
+  int n;
+
+  n = ptable.runq[i].total;
+  if(cpus[i].proc && cpus[i].proc != p)
+    n += pbase(cpus[i].proc) + cpus[i].proc->borrowed;
+  return n;
+}
+
+// May p run on CPU i?
+static int
+cpuok(struct proc *p, int i)
+{
+  return (p->affinity >> i) & 1;
+}
+
+// Choose the run queue for p among the CPUs it may run on:
+// the CPU it last ran on, where its cache is warm, unless
+// moving p would even out the load by more than p's tickets.
+static int
+pickrunq(struct proc *p)
+{
+  int i, q, light;
+
+  light = -1;
+  for(i = 0; i < ncpu; i++)
+    if(cpuok(p, i) && (light < 0 || cpuload(i, p) < cpuload(light, p)))
+      light = i;
+  q = p->cpu;
+  if(q < 0 || !cpuok(p, q) || cpuload(q, p) - cpuload(light, p) > ptickets(p))
+    q = light;
+  return q;
+}
+
+// Run queue q just got p: wake CPU q if it is halted in
+// idle(), or else some other idle CPU that may run p, which
+// can steal it.  The barrier orders our update of the queue
+// before the reads of idle; idle() does the reverse.
+static void
+kick(struct proc *p, int q)
+{
+  int i;
+
+  __sync_synchronize();
+  if(!cpus[q].idle)
+    for(i = 0; i < ncpu; i++)
+      if(cpus[i].idle && cpuok(p, i) && &cpus[i] != mycpu())
+        q = i;
+  if(cpus[q].idle && &cpus[q] != mycpu())
+    lapicipi(cpus[q].apicid, T_IRQ0 + IRQ_RESCHED);
+}
+
+// Put p on run queue q.  Each queue's passes are its own
+// virtual time, so p brings only its lead over the pass of
+// the queue it left, whichever that was; a process does not
+// get to bank the passes it missed while it was not runnable.
+// Caller must hold ptable.lock.
+static void
+enqueue(struct proc *p, int q)
+{
+  struct runq *rq;
+  int i, lead;
+
+  rq = &ptable.runq[q];
+  acquire(&rq->lock);
+  lead = p->pass - p->passbase;
+  p->pass = rq->pass + (lead > 0 ? lead : 0);
+  p->rq = q;
+  p->heapi = rq->nrun++;
+  rq->heap[p->heapi] = p;
+  heapfix(rq, p->heapi);
+  for(i = 0; i < ncpu; i++)
+    if(cpuok(p, i))
+      rq->nok[i]++;
+  p->weight = ptickets(p);
+  treeadd(rq, p->level, p->slot, p->weight);
+  release(&rq->lock);
+  kick(p, q);
+}
+
+// Take p off rq, whose lock the caller holds.
+static void
+rqremove(struct runq *rq, struct proc *p)
+{
+  int i;
+
+  for(i = 0; i < ncpu; i++)
+    if(cpuok(p, i))
+      rq->nok[i]--;
+  treeadd(rq, p->level, p->slot, -p->weight);
+  if(p->heapi < --rq->nrun){
+    rq->heap[p->heapi] = rq->heap[rq->nrun];
+    rq->heap[p->heapi]->heapi = p->heapi;
+    heapfix(rq, p->heapi);
+  }
+  p->weight = 0;
+  p->rq = -1;
+  p->passbase = rq->pass;
+}
+
+// Take p off its run queue, if it is on one, and say
+// whether it was.  Caller must hold ptable.lock.
+static int
+dequeue(struct proc *p)
+{
+  struct runq *rq;
+
+  if((rq = rqlock(p)) == 0)
+    return 0;
+  rqremove(rq, p);
+  release(&rq->lock);
+  return 1;
+}
+
+// Does p count towards its group's active tickets?
+static int
+isactive(struct proc *p)
+{
+  return p->state == RUNNABLE || p->state == RUNNING;
+}
+
+// Add delta to the active tickets of group gid, which
+// changes what each member is worth.
+static void
+groupadd(int gid, int delta)
+{
+  struct proc *p;
+
+  ptable.group[gid - 1].active += delta;
+  for(p = ptable.group[gid - 1].members; p; p = p->gnext)
+    reweigh(p);
+}
+
+// Move p from its group, if any, to group gid (0 for none).
+// A group is freed when its last member leaves.
+static void
+setgroup(struct proc *p, int gid)
+{
+  struct group *g;
+  struct proc **pp;
+
+  if(p->group){
+    g = &ptable.group[p->group - 1];
+    for(pp = &g->members; *pp != p; pp = &(*pp)->gnext)
+      ;
+    *pp = p->gnext;
+    if(isactive(p))
+      groupadd(p->group, -p->tickets);
+    if(g->members == 0)
+      g->tickets = 0;
+  }
+  p->group = gid;
+  p->gnext = 0;
+  if(gid){
+    g = &ptable.group[gid - 1];
+    p->gnext = g->members;
+    g->members = p;
+    if(isactive(p))
+      groupadd(gid, p->tickets);
+  }
+  reweigh(p);
+}
+
+// Lend p's tickets, including any it has borrowed itself,
+// to process q while p waits on it, so that a low-ticket
+// server or lock holder does not hold up a high-ticket client.
+static void
+lend(struct proc *p, struct proc *q)
+{
+  unlend(p);
+  p->lent = p->borrowed < MAXWEIGHT - pbase(p) ? pbase(p) + p->borrowed : MAXWEIGHT;
+  p->lendto = q;
+  p->lendpid = q->pid;
+  q->borrowed += p->lent;
+  reweigh(q);
+}
+
+// Take back the tickets p lent, if any.
+static void
+unlend(struct proc *p)
+{
+  struct proc *q;
+
+  q = p->lendto;
+  if(q == 0)
+    return;
+  if(q->pid == p->lendpid){
+    q->borrowed -= p->lent;
+    reweigh(q);
+  }
+  p->lendto = 0;
+}
+
+// The sleep queue holding processes sleeping on chan.
+static struct sleepq*
+sleepq(void *chan)
+{
+  uint h;
+
+  h = (uint)chan;
+  return &ptable.sleepq[(h ^ (h >> 12)) / sizeof(int) % NSLEEPQ];
+}
+
+// Add p, about to sleep on p->chan, to the tail
+// of that channel's sleep queue.
+static void
+sleepqadd(struct proc *p)
+{
+  struct sleepq *q;
+
+  q = sleepq(p->chan);
+  p->cnext = 0;
+  p->cprev = q->tail;
+  if(q->tail)
+    q->tail->cnext = p;
+  else
+    q->head = p;
+  q->tail = p;
+}
+
+// Take p off its channel's sleep queue.
+static void
+sleepqdel(struct proc *p)
+{
+  struct sleepq *q;
+
+  q = sleepq(p->chan);
+  if(p->cprev)
+    p->cprev->cnext = p->cnext;
+  else
+    q->head = p->cnext;
+  if(p->cnext)
+    p->cnext->cprev = p->cprev;
+  else
+    q->tail = p->cprev;
+}
+
+// Change p's state, moving it on or off the run queues
+// and the sleep queues.
+// A process's wait ends when it becomes RUNNABLE again,
+// and with it any loan of its tickets.
+// Caller must hold ptable.lock.
+static void
+setstate(struct proc *p, enum procstate state)
+{
+  int was, old;
+
+  old = p->state;
+  if(p->state == SLEEPING)
+    sleepqdel(p);
+  else if(state == SLEEPING)
+    sleepqadd(p);
+
+  if(state == RUNNABLE || state == ZOMBIE)
+    unlend(p);
+  if(state == RUNNABLE && p->state != RUNNABLE)
+    p->readyat = rdtsc();
+  was = isactive(p);
+  p->state = state;
+  if(p->group && was != isactive(p))
+    groupadd(p->group, was ? -p->tickets : p->tickets);
+  if(state == RUNNABLE && old != RUNNABLE)
+    enqueue(p, pickrunq(p));
+  else if(state != RUNNABLE && old == RUNNABLE)
+    dequeue(p);
+}
+
+// Take a process for CPU id, whose own queue was empty, from
+// the run queue holding the most processes it may run: the
+// one that queue would choose next if CPU id may run it, else
+// the earliest in pass that CPU id may run.  Only the stolen
+// process is charged; the victim queue's pass is left alone.
+// Holds both queues' locks, taken in index order, so that
+// work queued on CPU id meanwhile is run instead.
+static struct proc*
+steal(int id)
+{
+  int i, busy;
+  struct runq *rq, *vq;
+  struct proc *p;
+
+  busy = -1;
+  for(i = 0; i < ncpu; i++)
+    if(i != id && ptable.runq[i].nok[id] > 0 &&
+       (busy < 0 || ptable.runq[i].nok[id] > ptable.runq[busy].nok[id]))
+      busy = i;
+  if(busy < 0)
+    return 0;
+  rq = &ptable.runq[id];
+  vq = &ptable.runq[busy];
+  acquire(busy < id ? &vq->lock : &rq->lock);
+  acquire(busy < id ? &rq->lock : &vq->lock);
+  p = 0;
+  if(rq->nrun > 0){
+    p = runqpick(rq);
+    rqremove(rq, p);
+  } else if(vq->nok[id] > 0){
+    p = policy == SCHED_STRIDE ? vq->heap[0] : runqdraw(vq);
+    if(!cpuok(p, id)){
+      p = 0;
+      for(i = 0; i < vq->nrun; i++)
+        if(cpuok(vq->heap[i], id) && (p == 0 || passbefore(vq->heap[i]->pass, p->pass)))
+          p = vq->heap[i];
+    }
+    p->pass += stride(p->weight);
+    rqremove(vq, p);
+  }
+  release(&vq->lock);
+  release(&rq->lock);
+  return p;
+}
+
+// Claim the next process for CPU id from its own run queue,
+// or steal one if that is empty.  Takes only run queue locks.
+// The caller must run the process or put it back on a queue.
+static struct proc*
+claim(int id)
+{
+  struct runq *rq;
+  struct proc *p;
+
+  rq = &ptable.runq[id];
+  acquire(&rq->lock);
+  if(rq->nrun == 0){
+    release(&rq->lock);
+    return steal(id);
+  }
+  p = runqpick(rq);
+  rqremove(rq, p);
+  release(&rq->lock);
+  return p;
+}
+
+// Is there anything CPU id may run?  Called without
+// the queues' locks, so the answer is only a hint; idle() makes
+// sure a CPU that halts on a stale answer is woken again.
+static int
+runqready(int id)
+{
+  int i;
+
+  for(i = 0; i < ncpu; i++)
+    if(*(volatile int*)&ptable.runq[i].nok[id] > 0)
+      return 1;
+  return 0;
+}
+
+//PAGEBREAK: 20
+// Real-time processes reserve rtruntime ticks in every period of
+// rtperiod ticks, and the scheduler runs the RUNNABLE one with the
+// earliest deadline and reservation left before drawing any lottery.
+// Admission control keeps the total reserved below RTUTIL.  Once
+// its reservation for the period is used up a real-time process
+// competes in the lottery like any other until the next period.
+
+// Choose the real-time process to run next on CPU id, if any.
+// Called without ptable.lock the answer is only a hint, but
+// the walk is safe: procs are never freed and only pushed on
+// the head of the list.
+static struct proc*
+edfpick(int id)
+{
+  struct proc *p, *best;
+
+  best = 0;
+  for(p = ptable.rt; p; p = p->rtnext)
+    if(p->state == RUNNABLE && p->rtbudget > 0 && cpuok(p, id))
+      if(best == 0 || (int)(p->rtdeadline - best->rtdeadline) < 0)
+        best = p;
+  return best;
+}
+
+// Make p real-time with the given period and runtime,
+// or an ordinary process again if period is 0.
+static int
+setrt(struct proc *p, int period, int runtime)
+{
+  struct proc **pp;
+  int util;
+
+  util = period ? runtime * 1000 / period : 0;
+  if(p->rtperiod)
+    ptable.rtutil -= p->rtruntime * 1000 / p->rtperiod;
+  if(ptable.rtutil + util > RTUTIL){
+    if(p->rtperiod)
+      ptable.rtutil += p->rtruntime * 1000 / p->rtperiod;
+    return -1;
+  }
+  ptable.rtutil += util;
+  if(p->rtperiod && period == 0){
+    for(pp = &ptable.rt; *pp != p; pp = &(*pp)->rtnext)
+      ;
+    *pp = p->rtnext;
+  } else if(p->rtperiod == 0 && period){
+    p->rtnext = ptable.rt;
+    ptable.rt = p;
+  }
+  p->rtperiod = period;
+  p->rtruntime = runtime;
+  p->rtdeadline = ticks + period;
+  p->rtbudget = runtime;
+  return 0;
+}
+
+// Called on every clock tick on every CPU.  Charges the
+// running process for the tick under this CPU's run queue
+// lock; a running process is on no queue, so sinking it a
+// level needs no tree update.  On CPU 0 only, and only when
+// there is something to do, takes ptable.lock to start a new
+// period for each real-time process whose deadline has come,
+// counting a miss if it still had reserved work it wanted to
+// run, and for the MLFQ boost.
+void
+schedtick(void)
+{
+  struct proc *p;
+  struct runq *rq;
+  int i, boost, due;
+
+  rq = &ptable.runq[cpuid()];
+  acquire(&rq->lock);
+  p = mycpu()->proc;
+  if(p && p->rtperiod && p->rtbudget > 0)
+    p->rtbudget--;
+  if(p && policy == SCHED_MLFQ && ++p->slice >= MLFQSLICE(p->level)
+     && p->level < NMLFQ - 1){
+    p->level++;
+    p->slice = 0;
+  }
+  release(&rq->lock);
+
+  if(cpuid() != 0)
+    return;
+  boost = policy == SCHED_MLFQ && ticks % MLFQBOOST == 0;
+  due = boost;
+  for(p = ptable.rt; p && !due; p = p->rtnext)
+    due = (int)(ticks - p->rtdeadline) >= 0;
+  if(!due)
+    return;
+  acquire(&ptable.lock);
+  if(boost)
+    for(i = 0; i < ptable.nslot; i++)
+      if(ptable.slot[i]->state != UNUSED)
+        setlevel(ptable.slot[i], 0);
+  for(p = ptable.rt; p; p = p->rtnext){
+    if((int)(ticks - p->rtdeadline) < 0)
+      continue;
+    rq = runlock(p);
+    if(p->rtbudget > 0 && isactive(p))
+      p->rtmisses++;
+    p->rtdeadline += p->rtperiod;
+    if((int)(ticks - p->rtdeadline) >= 0)
+      p->rtdeadline = ticks + p->rtperiod;
+    p->rtbudget = p->rtruntime;
+    if(rq)
+      release(&rq->lock);
+  }
+  release(&ptable.lock);
 }
 
 // Must be called with interrupts disabled
@@ -68,8 +885,88 @@ myproc(void) {
   return p;
 }
 
+// Return the process with the given pid, or 0 if none.
+// Caller must hold ptable.lock.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  for(p = ptable.pidhash[pid % NPIDHASH]; p; p = p->hnext)
+    if(p->pid == pid)
+      return p;
+  return 0;
+}
+
+// Take an UNUSED proc off the free list, first carving
+// a fresh page into procs if the list is empty.
+// Caller must hold ptable.lock.
+static struct proc*
+procalloc(void)
+{
+  struct proc *p;
+  char *page;
+  int i;
+
+  if(ptable.free == 0){
+    if(ptable.nslot == NPROC || (page = kalloc()) == 0)
+      return 0;
+    memset(page, 0, PGSIZE);
+    for(i = 0; i < PGSIZE/sizeof(*p) && ptable.nslot < NPROC; i++){
+      p = (struct proc*)page + i;
+      p->slot = ptable.nslot++;
+      ptable.slot[p->slot] = p;
+      p->hnext = ptable.free;
+      ptable.free = p;
+    }
+  }
+  p = ptable.free;
+  ptable.free = p->hnext;
+  return p;
+}
+
+// Make child a child of parent.
+// Caller must hold ptable.lock.
+static void
+adopt(struct proc *parent, struct proc *child)
+{
+  child->parent = parent;
+  child->sibling = parent->children;
+  parent->children = child;
+}
+
+// Return p, which has exited or never ran, to the free list,
+// freeing its kernel stack and dropping its address space.  Caller must hold ptable.lock.
+static void
+freeproc(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp != p; pp = &(*pp)->hnext)
+    ;
+  *pp = p->hnext;
+  if(p->parent){
+    for(pp = &p->parent->children; *pp != p; pp = &(*pp)->sibling)
+      ;
+    *pp = p->sibling;
+  }
+  if(p->kstack)
+    kfree(p->kstack);
+  p->kstack = 0;
+  if(p->mm)
+    mmput(p->mm);
+  p->mm = 0;
+  p->pid = 0;
+  p->parent = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->state = UNUSED;
+  p->hnext = ptable.free;
+  ptable.free = p;
+}
+
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
+// Allocate an UNUSED proc.
 // If found, change state to EMBRYO and initialize
 // state required to run in the kernel.
 // Otherwise return 0.
@@ -81,25 +978,42 @@ allocproc(void)
 
   acquire(&ptable.lock);
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-
-  release(&ptable.lock);
-  return 0;
+  if((p = procalloc()) == 0){
+    release(&ptable.lock);
+    return 0;
+  }
 
-found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->hnext = ptable.pidhash[p->pid % NPIDHASH];
+  ptable.pidhash[p->pid % NPIDHASH] = p;
   
   p->tickets=1;
   p->ticks=0;
+  p->quantum = 1000;
+  p->borrowed = 0;
+  p->lendto = 0;
+  p->rtperiod = 0;
+  p->rtmisses = 0;
+  p->rq = -1;
+  p->cpu = -1;
+  p->affinity = ~0;
+  p->migrations = 0;
+  p->level = 0;
+  p->slice = 0;
+  memset(p->lathist, 0, sizeof(p->lathist));
+  p->utime = 0;
+  p->stime = 0;
+  p->detached = 0;
+  p->pass = p->passbase = ptable.runq[cpuid()].pass;
   
   release(&ptable.lock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(p);
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -127,15 +1041,15 @@ void
 userinit(void)
 {
   struct proc *p;
+  pde_t *pgdir;
   extern char _binary_initcode_start[], _binary_initcode_size[];
 
   p = allocproc();
   
   initproc = p;
-  if((p->pgdir = setupkvm()) == 0)
+  if((pgdir = setupkvm()) == 0 || (p->mm = mmalloc(pgdir, PGSIZE)) == 0)
     panic("userinit: out of memory?");
-  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
-  p->sz = PGSIZE;
+  inituvm(pgdir, _binary_initcode_start, (int)_binary_initcode_size);
   memset(p->tf, 0, sizeof(*p->tf));
   p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
   p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
@@ -146,7 +1060,8 @@ userinit(void)
   p->tf->eip = 0;  // beginning of initcode.S
 
   safestrcpy(p->name, "initcode", sizeof(p->name));
-  p->cwd = namei("/");
+  if((p->files = fdtalloc()) == 0 || (p->cwd = cwdalloc(namei("/"))) == 0)
+    panic("userinit: out of memory?");
 
   // this assignment to p->state lets other cores
   // run this process. the acquire forces the above
@@ -154,30 +1069,34 @@ userinit(void)
   // because the assignment might not be atomic.
   acquire(&ptable.lock);
 
-  p->state = RUNNABLE;
+  setstate(p, RUNNABLE);
 
   release(&ptable.lock);
 }
 
-// Grow current process's memory by n bytes.
-// Return 0 on success, -1 on failure.
+// Grow current process's memory, which its threads share,
+// by n bytes.  Return the old size, or -1 on failure.
 int
 growproc(int n)
 {
-  uint sz;
+  uint sz, oldsz;
   struct proc *curproc = myproc();
+  struct mm *mm = curproc->mm;
 
-  sz = curproc->sz;
+  acquiresleep(&mm->vmlock);
+  sz = oldsz = mm->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
-      return -1;
-  } else if(n < 0){
-    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if((sz = allocuvm(mm->pgdir, sz, sz + n)) == 0){
+      releasesleep(&mm->vmlock);
       return -1;
-  }
-  curproc->sz = sz;
-  switchuvm(curproc);
-  return 0;
+    }
+    acquire(&mm->lock);
+    mm->sz = sz;
+    release(&mm->lock);
+  } else if(n < 0)
+    shrinkuvm(mm, sz, sz + n);
+  releasesleep(&mm->vmlock);
+  return oldsz;
 }
 
 // Create a new process copying p as the parent.
@@ -186,7 +1105,9 @@ growproc(int n)
 int
 fork(void)
 {
-  int i, pid;
+  int pid;
+  uint sz;
+  pde_t *pgdir;
   struct proc *np;
   struct proc *curproc = myproc();
 
@@ -196,38 +1117,96 @@ fork(void)
   }
 
   // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
-    kfree(np->kstack);
-    np->kstack = 0;
-    np->state = UNUSED;
+  acquiresleep(&curproc->mm->vmlock);
+  sz = curproc->mm->sz;
+  pgdir = copyuvm(curproc->mm->pgdir, sz);
+  releasesleep(&curproc->mm->vmlock);
+  if(pgdir == 0 || (np->mm = mmalloc(pgdir, sz)) == 0){
+    if(pgdir)
+      freevm(pgdir);
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
+    return -1;
+  }
+  if((np->files = fdtcopy(curproc->files)) == 0 ||
+     (np->cwd = cwdcopy(curproc->cwd)) == 0){
+    if(np->files)
+      fdtput(np->files);
+    np->files = 0;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
     return -1;
   }
   np->tickets = curproc->tickets;
-  np->sz = curproc->sz;
-  np->parent = curproc;
+  np->affinity = curproc->affinity;
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;
 
-  for(i = 0; i < NOFILE; i++)
-    if(curproc->ofile[i])
-      np->ofile[i] = filedup(curproc->ofile[i]);
-  np->cwd = idup(curproc->cwd);
-
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
   pid = np->pid;
 
   acquire(&ptable.lock);
 
-  np->state = RUNNABLE;
+  adopt(curproc, np);
+  setgroup(np, curproc->group);
+  setstate(np, RUNNABLE);
 
   release(&ptable.lock);
 
   return pid;
 }
 
+// The word at user address va in mm, through which the
+// stacks of exited detached threads are linked, or 0 if va
+// is not a page-aligned address in mm any more.  Caller
+// must hold mm->vmlock, so the page cannot be freed under it.
+static uint*
+deadlink(struct mm *mm, uint va)
+{
+  if(va % PGSIZE != 0 || va >= mm->sz)
+    return 0;
+  return (uint*)uva2ka(mm->pgdir, (char*)va);
+}
+
+// Push stack, that of a detached thread that has exited,
+// on mm's list of dead stacks, linked through the stacks'
+// own first words so that no stack is ever dropped.
+static void
+pushdead(struct mm *mm, uint stack)
+{
+  uint *link;
+
+  acquiresleep(&mm->vmlock);
+  if((link = deadlink(mm, stack)) != 0){
+    *link = mm->deadstacks;
+    mm->deadstacks = stack;
+  }
+  releasesleep(&mm->vmlock);
+}
+
+// Pop a stack off mm's list of dead stacks, or return 0.
+// A link the program has overwritten, or a stack sbrk()
+// has since given back, ends the list.
+static void*
+popdead(struct mm *mm)
+{
+  uint stack, *link;
+
+  acquiresleep(&mm->vmlock);
+  stack = mm->deadstacks;
+  if((link = deadlink(mm, stack)) != 0)
+    mm->deadstacks = *link;
+  else
+    stack = mm->deadstacks = 0;
+  releasesleep(&mm->vmlock);
+  return (void*)stack;
+}
+
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
@@ -236,40 +1215,38 @@ exit(void)
 {
   struct proc *curproc = myproc();
   struct proc *p;
-  int fd;
 
   if(curproc == initproc)
     panic("init exiting");
 
-  // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd]){
-      fileclose(curproc->ofile[fd]);
-      curproc->ofile[fd] = 0;
-    }
-  }
-
-  begin_op();
-  iput(curproc->cwd);
-  end_op();
+  // Close all open files, unless other threads still share them.
+  fdtput(curproc->files);
+  curproc->files = 0;
+  cwdput(curproc->cwd);
   curproc->cwd = 0;
 
+  // Nobody will join a detached thread: leave its stack for
+  // the next join_any() in its address space.
+  if(curproc->detached)
+    pushdead(curproc->mm, (uint)curproc->threadstack);
+
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
   wakeup1(curproc->parent);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == curproc){
-      p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
+  while((p = curproc->children) != 0){
+    curproc->children = p->sibling;
+    adopt(initproc, p);
+    if(p->state == ZOMBIE)
+      wakeup1(initproc);
   }
 
   // Jump into the scheduler, never to return.
-  curproc->state = ZOMBIE;
+  setstate(curproc, ZOMBIE);
+  setgroup(curproc, 0);
+  setrt(curproc, 0, 0);
   sched();
   panic("zombie exit");
 }
@@ -285,23 +1262,14 @@ wait(void)
   
   acquire(&ptable.lock);
   for(;;){
-    // Scan through table looking for exited children.
+    // Scan through our children looking for exited ones.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
-        continue;
+    for(p = curproc->children; p; p = p->sibling){
       havekids = 1;
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
+        freeproc(p);
         release(&ptable.lock);
         return pid;
       }
@@ -318,22 +1286,106 @@ wait(void)
   }
 }
 
-//TODO
-//calc total no of tickets for all processes
-int
-tickets_sum(void){
+// Halt CPU c until the next interrupt, which is at the
+// latest its next clock tick, or a kick() from a CPU that
+// queued work for it.  Work queued before c announced it
+// was idle is caught by checking again afterwards.
+static void
+idle(struct cpu *c)
+{
+  cli();
+  xchg(&c->idle, 1);
+  if(!runqready(c - cpus))
+    stihlt();
+  c->idle = 0;
+  sti();
+}
+
+// Count how long p waited between becoming RUNNABLE and
+// being switched to, in bucket log2(cycles) of p's and the
+// system-wide histogram.
+static void
+latency(struct proc *p)
+{
+  uint64 wait;
+  int b;
+
+  wait = rdtsc() - p->readyat;
+  for(b = 0; wait > 1 && b < NLATBUCKET - 1; b++)
+    wait >>= 1;
+  p->lathist[b]++;
+  ptable.lathist[b]++;
+}
+
+// Take the process hinted at in *pp for CPU c, if it can
+// still run here: the one yield_to() handed c's quantum to,
+// or a thread gang() asked c to run.
+static struct proc*
+handoff(struct cpu *c, struct proc **pp)
+{
   struct proc *p;
-  int ticketsTotal=0;
 
-//loop over process table and increment total tickets if a runnable process is found 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-  {
-    if(p->state==RUNNABLE){
-      ticketsTotal+=p->tickets;
-    }
+  p = *pp;
+  *pp = 0;
+  if(p == 0 || p->state != RUNNABLE || !cpuok(p, c - cpus) || !dequeue(p))
+    return 0;
+  p->pass += stride(ptickets(p));
+  return p;
+}
+
+// May a thread of p take CPU c from what it is doing?
+// Only if c is idle, or running a lower-priority process
+// that is not itself one of p's threads.
+static int
+gangok(struct cpu *c, struct proc *p)
+{
+  struct proc *q;
+
+  q = c->proc;
+  return q == 0 || (q->mm != p->mm && q->rtperiod == 0 &&
+    (policy == SCHED_MLFQ ? q->level > p->level : ptickets(q) < ptickets(p)));
+}
+
+// If s is a RUNNABLE thread sharing p's address space and
+// not yet offered a CPU, offer it one that gangok() allows
+// other than id, and poke that CPU so it reschedules now
+// rather than at its next clock tick.
+static void
+gangoffer(struct proc *p, struct proc *s, int id)
+{
+  int i;
+
+  if(s == p || s->mm != p->mm || s->state != RUNNABLE)
+    return;
+  for(i = 0; i < ncpu; i++)
+    if(cpus[i].gang == s)
+      return;
+  for(i = 0; i < ncpu; i++){
+    if(i == id || cpus[i].gang || !cpuok(s, i) || !gangok(&cpus[i], p))
+      continue;
+    cpus[i].gang = s;
+    lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_RESCHED);
+    return;
+  }
+}
+
+// p was chosen to run on CPU id.  Offer CPUs to the threads
+// it shares its address space with: its parent, its parent's
+// other children and its own children.
+static void
+gang(struct proc *p, int id)
+{
+  struct proc *s;
+
+  if(p->parent){
+    gangoffer(p, p->parent, id);
+    for(s = p->parent->children; s; s = s->sibling)
+      gangoffer(p, s, id);
   }
-  return ticketsTotal;          // returning total number of tickets for runnable processes
+  for(s = p->children; s; s = s->sibling)
+    gangoffer(p, s, id);
 }
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -347,56 +1399,80 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
-  
-  //edit
-  long total_tickets = 0, counter = 0, winner = 0;
 
+  c->proc = 0;
   
-  c->proc = 0;  
-  
-  // 1 2 3 4 5    6 7 8 9   10 11 12 13 14 
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    
-    total_tickets = tickets_sum();
-    winner = random_at_most(total_tickets); // say 9
-    counter = 0;
-    
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-	
-      counter += p->tickets; //5 // 5+4 
-
-      if (counter < winner) { 
-            continue;
-      }
+    // Only contend for the locks when there is work.
+    if(!runqready(c - cpus)){
+      idle(c);
+      continue;
+    }
 
+    // Run the process the last one yielded to, if it is
+    // still waiting; it runs out the quantum it was given.
+    // Else a real-time process if one is due, else a thread
+    // whose sibling asked for this CPU, else a process from
+    // this CPU's run queue, or steal one if it is empty.
+    // Without any of the former, which need ptable.lock to
+    // choose, the run queue is drawn from before taking it.
+    p = 0;
+    if(c->next == 0 && c->gang == 0 && edfpick(c - cpus) == 0){
+      if((p = claim(c - cpus)) == 0)
+        continue;
+      c->qstart = lapictimer();
+    }
+    acquire(&ptable.lock);
+    if(p && !cpuok(p, c - cpus)){
+      // setaffinity() moved p off this CPU after we claimed it.
+      enqueue(p, pickrunq(p));
+      p = 0;
+    } else if(p == 0 && (p = handoff(c, &c->next)) == 0){
+      if((p = edfpick(c - cpus)) != 0 && !dequeue(p))
+        p = 0;
+      if(p == 0 && (p = handoff(c, &c->gang)) == 0)
+        p = claim(c - cpus);
+      c->qstart = lapictimer();
+    }
+    if(p && gangsched)
+      gang(p, c - cpus);
+    if(p){
       // Switch to chosen process.  It is the process's job
       // to release ptable.lock and then reacquire it
       // before jumping back to us.
       c->proc = p;
+      if(p->cpu >= 0 && p->cpu != c - cpus)
+        p->migrations++;
+      p->cpu = c - cpus;
+      latency(p);
       switchuvm(p);
-      p->state = RUNNING;
+      setstate(p, RUNNING);
+      p->tsc = rdtsc();
 
       swtch(&(c->scheduler), p->context);
       switchkvm();
+      p->stime += rdtsc() - p->tsc;
       p->ticks += 1;
+      if(c->next == 0)
+        p->quantum = quantumused(c, p);
+      reweigh(p);
+
+      // A detached thread that exited is off its kernel
+      // stack now, so its slot can go straight back.
+      if(p->state == ZOMBIE && p->detached)
+        freeproc(p);
 
       // Process is done running for now.
       // It should have changed its p->state before coming back.
       c->proc = 0;
-      break;
     }
     release(&ptable.lock);
   }
 }
 
-
 // Enter scheduler.  Must hold only ptable.lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
@@ -428,9 +1504,51 @@ void
 yield(void)
 {
   acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  setstate(myproc(), RUNNABLE);
+  sched();
+  release(&ptable.lock);
+}
+
+// Charge the CPU time the current process has used since it
+// was last charged to its user time if it has been running in
+// user mode, else to its system time.  trap() calls this on
+// every crossing between user mode and the kernel, and
+// scheduler() charges system time when switching away.
+void
+cputime(int user)
+{
+  struct proc *p;
+  uint64 now;
+
+  pushcli();
+  p = mycpu()->proc;
+  now = rdtsc();
+  if(user)
+    p->utime += now - p->tsc;
+  else
+    p->stime += now - p->tsc;
+  p->tsc = now;
+  popcli();
+}
+
+// Give the rest of this quantum to process pid, which
+// must be waiting to run, without drawing a lottery.
+int
+yield_to(int pid)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  p = findproc(pid);
+  if(p == 0 || p->state != RUNNABLE || !cpuok(p, cpuid())){
+    release(&ptable.lock);
+    return -1;
+  }
+  mycpu()->next = p;
+  setstate(myproc(), RUNNABLE);
   sched();
   release(&ptable.lock);
+  return 0;
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -479,7 +1597,7 @@ sleep(void *chan, struct spinlock *lk)
   }
   // Go to sleep.
   p->chan = chan;
-  p->state = SLEEPING;
+  setstate(p, SLEEPING);
 
   sched();
 
@@ -494,16 +1612,33 @@ sleep(void *chan, struct spinlock *lk)
 }
 
 //PAGEBREAK!
+// Wake up at most n processes sleeping on chan, those that
+// have slept longest first, and return how many woke.
+// Only chan's sleep queue is searched.
+// The ptable lock must be held.
+static int
+wakeupn(void *chan, int n)
+{
+  struct proc *p, *next;
+  int woken;
+
+  woken = 0;
+  for(p = sleepq(chan)->head; p && woken < n; p = next){
+    next = p->cnext;
+    if(p->chan == chan){
+      setstate(p, RUNNABLE);
+      woken++;
+    }
+  }
+  return woken;
+}
+
 // Wake up all processes sleeping on chan.
 // The ptable lock must be held.
 static void
 wakeup1(void *chan)
 {
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  wakeupn(chan, NPROC);
 }
 
 // Wake up all processes sleeping on chan.
@@ -515,6 +1650,16 @@ wakeup(void *chan)
   release(&ptable.lock);
 }
 
+// Wake up the process that has slept longest on chan,
+// for when only one of them could make progress anyway.
+void
+wakeone(void *chan)
+{
+  acquire(&ptable.lock);
+  wakeupn(chan, 1);
+  release(&ptable.lock);
+}
+
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
@@ -524,15 +1669,13 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
-    }
+  if((p = findproc(pid)) != 0){
+    p->killed = 1;
+    // Wake process from sleep if necessary.
+    if(p->state == SLEEPING)
+      setstate(p, RUNNABLE);
+    release(&ptable.lock);
+    return 0;
   }
   release(&ptable.lock);
   return -1;
@@ -553,12 +1696,13 @@ procdump(void)
   [RUNNING]   "run   ",
   [ZOMBIE]    "zombie"
   };
-  int i;
+  int i, j;
   struct proc *p;
   char *state;
   uint pc[10];
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(j = 0; j < ptable.nslot; j++){
+    p = ptable.slot[j];
     if(p->state == UNUSED)
       continue;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
@@ -573,54 +1717,219 @@ procdump(void)
     }
     cprintf("\n");
   }
+  for(i = 0; i < ncpu; i++)
+    cprintf("cpu%d: idle %d of %d ticks\n", i, cpus[i].idleticks, cpus[i].nticks);
 }
 
 int 
 settickets(int tickets)
 {
 
-  if(tickets < 1)
+  if(tickets < 1 || tickets > MAXTICKETS)
     return -1;
     
   struct proc *proc = myproc();
   
   acquire(&ptable.lock);
-  ptable.proc[proc-ptable.proc].tickets = tickets;
+  if(proc->group)
+    groupadd(proc->group, tickets - proc->tickets);
+  proc->tickets = tickets;
+  reweigh(proc);
   release(&ptable.lock);
   
   return 0;
 }
 
+// Reserve runtime ticks of CPU in every period ticks for the
+// caller, ahead of the lottery, or give up the reservation if
+// period is 0.  Fails if the reservation would push the total
+// reserved by all real-time processes past RTUTIL.
+int
+setdeadline(int period, int runtime)
+{
+  int r;
+
+  if(period < 0 || (period && (runtime < 1 || runtime > period)))
+    return -1;
+  acquire(&ptable.lock);
+  r = setrt(myproc(), period, runtime);
+  release(&ptable.lock);
+  return r;
+}
+
+// Restrict process pid to the CPUs whose bits are set in mask.
+// A queued process moves to an allowed CPU at once, a running
+// one the next time it is queued.
+int
+setaffinity(int pid, int mask)
+{
+  struct proc *p;
+
+  if((mask & ((1 << ncpu) - 1)) == 0)
+    return -1;
+  acquire(&ptable.lock);
+  if((p = findproc(pid)) == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  // Requeue p even if it may stay where it is, so that
+  // the queue counts which CPUs may run it afresh.
+  if(dequeue(p)){
+    p->affinity = mask;
+    enqueue(p, pickrunq(p));
+  } else
+    p->affinity = mask;
+  release(&ptable.lock);
+  return 0;
+}
+
+// Lend the caller's tickets to process pid until the caller
+// next becomes RUNNABLE, typically after blocking on pid.
+int
+transfer_tickets(int pid)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  p = findproc(pid);
+  if(p == 0 || p == myproc() || p->state == ZOMBIE){
+    release(&ptable.lock);
+    return -1;
+  }
+  lend(myproc(), p);
+  release(&ptable.lock);
+  return 0;
+}
+
+// Create a ticket group funded with tickets base tickets
+// and move the caller into it; children it forks from now
+// on join it too.  Returns the new group's id, or -1.
+int
+mkgroup(int tickets)
+{
+  int gid;
+
+  if(tickets < 1 || tickets > MAXTICKETS)
+    return -1;
+  acquire(&ptable.lock);
+  for(gid = 1; gid <= NGROUP; gid++)
+    if(ptable.group[gid - 1].tickets == 0)
+      break;
+  if(gid > NGROUP){
+    release(&ptable.lock);
+    return -1;
+  }
+  ptable.group[gid - 1].tickets = tickets;
+  setgroup(myproc(), gid);
+  release(&ptable.lock);
+  return gid;
+}
+
+// Move the caller into existing group gid, or out of
+// its group if gid is 0.
+int
+joingroup(int gid)
+{
+  if(gid < 0 || gid > NGROUP)
+    return -1;
+  acquire(&ptable.lock);
+  if(gid && ptable.group[gid - 1].tickets == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  setgroup(myproc(), gid);
+  release(&ptable.lock);
+  return 0;
+}
+
+// Switch every CPU to scheduling policy pol, with threads
+// co-scheduled if pol includes SCHED_GANG.
+// Returns the previous policy, or -1 if pol is unknown.
+int
+setsched(int pol)
+{
+  int old, base;
+
+  base = pol & ~SCHED_GANG;
+  if(base != SCHED_LOTTERY && base != SCHED_STRIDE && base != SCHED_MLFQ)
+    return -1;
+  acquire(&ptable.lock);
+  old = policy | (gangsched ? SCHED_GANG : 0);
+  policy = base;
+  gangsched = (pol & SCHED_GANG) != 0;
+  release(&ptable.lock);
+  return old;
+}
+
+// Fill ps with up to NPSTAT live processes, starting at ptable
+// slot ps->next, and set ps->next to the slot to go on from,
+// or 0 once every process has been reported; callers page
+// through the whole table by calling until it is 0 again.
 int
 getpinfo(struct pstat* ps) {
-  int i = 0;
+  int i = 0, j;
   struct proc *p;
   acquire(&ptable.lock);
   
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) 
+  j = ps->next;
+  if(j < 0)
+    j = 0;
+  memset(ps, 0, sizeof(*ps));
+  for (; j < ptable.nslot && i < NPSTAT; j++) 
   {
+    p = ptable.slot[j];
+    if(p->state == UNUSED)
+      continue;
     ps->pid[i] = p->pid;
-    ps->inuse[i] = p->state != UNUSED;
+    ps->inuse[i] = 1;
     ps->tickets[i] = p->tickets;
     ps->ticks[i] = p->ticks;
+    ps->quantum[i] = p->quantum;
+    ps->group[i] = p->group;
+    ps->misses[i] = p->rtmisses;
+    ps->migrations[i] = p->migrations;
+    ps->level[i] = p->level;
+    ps->utime[i] = p->utime >> 10;
+    ps->stime[i] = p->stime >> 10;
     i++;
   }
+  ps->next = j < ptable.nslot ? j : 0;
   
   release(&ptable.lock);
   
   return 0;
 }
 
+// Copy the scheduling latency histogram of process pid,
+// or of the whole system if pid is 0, to hist.
 int
-clone(void(*fcn)(void*, void*), void *arg1, void *arg2, void *stack)
+getlatency(int pid, uint *hist)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  if(pid == 0)
+    memmove(hist, ptable.lathist, sizeof(ptable.lathist));
+  else if((p = findproc(pid)) != 0)
+    memmove(hist, p->lathist, sizeof(p->lathist));
+  else {
+    release(&ptable.lock);
+    return -1;
+  }
+  release(&ptable.lock);
+  return 0;
+}
+
+int
+clone(void(*fcn)(void*, void*), void *arg1, void *arg2, void *stack, int flags)
 {
-  int i;
   struct proc *np;
   struct proc *curproc = myproc();
   
    //check if the stack address is page-aligned and have at least one page of memory
   if(((uint) stack % PGSIZE) != 0) return -1; 
-  if((curproc->sz < PGSIZE + (uint) stack)) return -1;
+  if((curproc->mm->sz < PGSIZE + (uint) stack)) return -1;
+  if(flags & ~(CLONE_DETACHED | CLONE_FILES | CLONE_FS)) return -1;
 
   // Allocate process.
   if((np = allocproc()) == 0){
@@ -628,11 +1937,11 @@ clone(void(*fcn)(void*, void*), void *arg1, void *arg2, void *stack)
   }
 	
   // Copy process data to the new thread
-  np->pgdir = curproc->pgdir; //make the thread share the parent's address space
+  np->mm = curproc->mm; //make the thread share the parent's address space, and its size
+  mmdup(np->mm);
   
-  np->sz = curproc->sz;  //same size as parent
-  
-  np->parent = curproc;  //make calling process as the new thread parent 
+  np->affinity = curproc->affinity;
+  np->detached = (flags & CLONE_DETACHED) != 0;
   
   *np->tf = *curproc->tf;  //parent process and thread have the same trap frame
 
@@ -655,8 +1964,11 @@ clone(void(*fcn)(void*, void*), void *arg1, void *arg2, void *stack)
   // subtract 12 bytes from the stack top to make space for the three values being saved
   stack_top -= 12;
   // copy user stack values to np's memory
-  if (copyout(np->pgdir, stack_top, user_stack, 12) < 0) {
-	return -1;
+  if (copyout(np->mm->pgdir, stack_top, user_stack, 12) < 0) {
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
+    return -1;
   }
 
 
@@ -676,21 +1988,32 @@ clone(void(*fcn)(void*, void*), void *arg1, void *arg2, void *stack)
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;	//This is the return register. The child process returning from clone should get 0 as a return value.
   
-  // Duplicate the files used by the current process(thread) to be used 
-  // also by the new thread
-  for(i = 0; i < NOFILE; i++)
-    if(curproc->ofile[i])
-      np->ofile[i] = filedup(curproc->ofile[i]);
-      
-  // Duplicate the current directory to be used by the new thread
-  np->cwd = idup(curproc->cwd);
+  // Share the files and current directory of the current process(thread)
+  // with the new thread if asked to, else give it copies of them
+  np->files = (flags & CLONE_FILES) ? fdtdup(curproc->files) : fdtcopy(curproc->files);
+  np->cwd = (flags & CLONE_FS) ? cwddup(curproc->cwd) : cwdcopy(curproc->cwd);
+  if(np->files == 0 || np->cwd == 0){
+    if(np->files)
+      fdtput(np->files);
+    if(np->cwd)
+      cwdput(np->cwd);
+    np->files = 0;
+    np->cwd = 0;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
+    return -1;
+  }
   // Make the two threads belong to the current process
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
   acquire(&ptable.lock);
   
-  // Make the state of the new thread to be runnable 
-  np->state = RUNNABLE;
+  // Make the calling process the new thread's parent,
+  // and the state of the new thread to be runnable 
+  adopt(curproc, np);
+  setgroup(np, curproc->group);
+  setstate(np, RUNNABLE);
 
   release(&ptable.lock);
 
@@ -710,12 +2033,12 @@ join(void** stack)
     // Scan through table looking for exited children (zombie children).
     havethreads = 0;
     
-    //loop over processes in the process table and check if a process have the same pgdir as the current process 
+    //loop over our children and check if a child has the same address space as the current process 
     //If they share the same page directory it means that the p must be a "child" thread of the parent process (curproc).
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-          // If the current process is not my parent or share the same address space...  
-      if(p->parent != curproc || p->pgdir != p->parent->pgdir)
-        continue; // You are not a threads
+    for(p = curproc->children; p; p = p->sibling){
+          // If the child does not share the same address space...  
+      if(p->mm != curproc->mm || p->detached)
+        continue; // You are not a threads, or nobody's to join
       
       havethreads = 1; 
       
@@ -725,19 +2048,11 @@ join(void** stack)
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
-        // Removing thread from the kernal stack
-        kfree(p->kstack);
-        p->kstack = 0;
-        
-        // Reseting thread from the process table
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
-        
-        stack = p->threadstack;
+        *stack = p->threadstack;
         p->threadstack = 0;
+
+        // Freeing the thread's kernel stack and process table entry
+        freeproc(p);
         
         release(&ptable.lock);
         
@@ -756,44 +2071,204 @@ join(void** stack)
   }
 }
 
-// Atomically release lock and sleep on chan.
-// Reacquires lock when awakened.
-void ticket_sleep(void *chan)
+// Reap up to n exited threads in one pass over our children,
+// storing their pids and stacks in pids[] and stacks[], then
+// fill what room is left with the stacks of exited detached
+// threads, with pid 0.  Waits for a thread to exit unless
+// flags has JOIN_NOHANG; with JOIN_DETACHED only collects
+// detached stacks.  Returns the number of entries filled,
+// or -1 if there is nothing to wait for.
+int
+join_any(int *pids, void **stacks, int n, int flags)
+{
+  struct proc *p, *next;
+  int havethreads, k;
+  struct proc *curproc = myproc();
+
+  acquire(&ptable.lock);
+  for(;;){
+    havethreads = 0;
+    k = 0;
+    for(p = curproc->children; p && k < n; p = next){
+      next = p->sibling;
+      if(p->mm != curproc->mm || p->detached || (flags & JOIN_DETACHED))
+        continue;
+      havethreads = 1;
+      if(p->state == ZOMBIE){
+        pids[k] = p->pid;
+        stacks[k++] = p->threadstack;
+        freeproc(p);
+      }
+    }
+    // Popping dead stacks takes the address space's sleeplock.
+    // Rescan if that found none, since a thread may have exited
+    // while ptable.lock was let go.
+    if(k < n && curproc->mm->deadstacks){
+      release(&ptable.lock);
+      while(k < n && (stacks[k] = popdead(curproc->mm)) != 0)
+        pids[k++] = 0;
+      acquire(&ptable.lock);
+      if(k == 0)
+        continue;
+    }
+
+    if(k > 0 || (flags & JOIN_NOHANG)){
+      release(&ptable.lock);
+      return k;
+    }
+    if(!havethreads || curproc->killed){
+      release(&ptable.lock);
+      return -1;
+    }
+    sleep(curproc, &ptable.lock);
+  }
+}
+
+// The kernel address of the int at user address uaddr
+// of the current process, which names it as a futex
+// whichever address space it is reached through.
+static int*
+futexkey(uint uaddr)
+{
+  char *page;
+
+  if(uaddr % sizeof(int) != 0)
+    return 0;
+  if((page = uva2ka(myproc()->mm->pgdir, (char*)PGROUNDDOWN(uaddr))) == 0)
+    return 0;
+  return (int*)(page + uaddr % PGSIZE);
+}
+
+// Sleep until futex_wake(uaddr), if the int at uaddr still
+// holds val; otherwise return -1 at once.  Checking and going
+// to sleep under ptable.lock means a waker that changes the
+// int and then calls futex_wake() cannot be missed.
+int
+futex_wait(uint uaddr, int val)
+{
+  int *key;
+
+  if((key = futexkey(uaddr)) == 0)
+    return -1;
+  acquire(&ptable.lock);
+  if(*(volatile int*)key != val){
+    release(&ptable.lock);
+    return -1;
+  }
+  sleep(key, &ptable.lock);
+  release(&ptable.lock);
+  return 0;
+}
+
+// Wake up to n processes waiting in futex_wait(uaddr),
+// and return how many woke.
+int
+futex_wake(uint uaddr, int n)
+{
+  int *key;
+
+  if((key = futexkey(uaddr)) == 0)
+    return -1;
+  acquire(&ptable.lock);
+  n = wakeupn(key, n);
+  release(&ptable.lock);
+  return n;
+}
+
+// Sleep until it is ticket's turn for lk, lending our tickets
+// to its holder in the meantime.  The turn is checked again
+// under ptable.lock, which release_t() holds to wake us, so
+// a release just before we sleep is not missed.
+void ticket_sleep(struct ticketlock *lk, int ticket)
 {
 	struct proc *p = myproc();
+	struct proc *holder;
 
 	if (p == 0)
 		panic("sleep");
 
 	acquire(&ptable.lock);
 	
-	p->chan = chan;
-	p->state = SLEEPING;
+	if(lk->current_turn == ticket){
+		release(&ptable.lock);
+		return;
+	}
+	if((holder = findproc(lk->pid)) != 0 && holder != p)
+		lend(p, holder);
+	p->chan = lk;
+	p->lockticket = ticket;
+	setstate(p, SLEEPING);
 	sched();
 	p->chan = 0;
 	
 	release(&ptable.lock);
 }
 
+// Is lk's holder running on another CPU right now?  Looks
+// at what each CPU is running without ptable.lock: a stale
+// answer only costs one spin or one sleep too many.
+static int
+holderrunning(struct ticketlock *lk)
+{
+	struct proc *q;
+	int i, pid;
+
+	pid = lk->pid;
+	for(i = 0; i < ncpu; i++){
+		q = cpus[i].proc;
+		if(pid && q && q != myproc() && q->pid == pid)
+			return 1;
+	}
+	return 0;
+}
+
 void initlock_t(struct ticketlock *lk)
 {
     lk->next_ticket = 0;
     lk->current_turn = 0;
+    lk->pid = 0;
 }
 
+// The next in line spins for up to LOCKSPIN reads while the
+// holder is running on another CPU, since it is likely to let
+// go sooner than a sleep and wakeup would take; everyone else
+// sleeps until their turn.
 void acquire_t(struct ticketlock *lk)
 {
     cli(); //clear inturrupt flag (IF) Disable inturrupts
     int myTicket = fetch_and_add(&lk->next_ticket, 1);
+    int spins = 0;
     
-    while (lk->current_turn != myTicket)
-        ticket_sleep(lk); // to prevent busy waiting.
+    while (lk->current_turn != myTicket){
+        if(spins == 0 && myTicket - lk->current_turn == 1 && holderrunning(lk)){
+            while(spins++ < LOCKSPIN && *(volatile int*)&lk->current_turn != myTicket)
+                ;
+        } else
+            ticket_sleep(lk, myTicket); // to prevent busy waiting.
+    }
+    lk->pid = myproc()->pid;
 }
 
+// Only the process holding the next ticket can go on,
+// so wake just that one, if it is asleep.  lk is a user
+// address, so another address space may have a lock of
+// its own there; only sleepers sharing ours are ours.
 void release_t(struct ticketlock *lk)
 {
-  fetch_and_add(&lk->current_turn, 1);
-  wakeup(lk); // wakup on release and reacquire lock.
+  struct proc *p;
+  int turn;
+
+  lk->pid = 0;
+  turn = fetch_and_add(&lk->current_turn, 1) + 1;
+  if(lk->next_ticket != turn){
+    acquire(&ptable.lock);
+    for(p = sleepq(lk)->head; p; p = p->cnext)
+      if(p->chan == lk && p->lockticket == turn && p->mm == myproc()->mm){
+        setstate(p, RUNNABLE);
+        break;
+      }
+    release(&ptable.lock);
+  }
   sti(); //set inturrupt flag (IF) Enable inturrupts
 }
 
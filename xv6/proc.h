@@ -8,6 +8,14 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  struct proc *next;           // Process handed the rest of the quantum
+  struct proc *gang;           // Thread whose sibling is running elsewhere
+  uint qstart;                 // Timer count left when proc was switched in
+  volatile uint idle;          // Halted in scheduler() waiting for work?
+  uint idleticks;              // Clock ticks that found this CPU idle
+  uint nticks;                 // Clock ticks seen by this CPU
+  uint rand;                   // State of this CPU's random number generator
+  volatile uint tlbflushes;    // TLB flushes done for IRQ_TLB
 };
 
 extern struct cpu cpus[NCPU];
@@ -36,22 +44,57 @@ enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
 struct proc {
-  uint sz;                     // Size of process memory (bytes)
-  pde_t* pgdir;                // Page table
+  struct mm *mm;               // Address space, shared with its threads
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
+  struct proc *children;       // Its children, linked by sibling
+  struct proc *sibling;        // Next child of the same parent
+  struct proc *hnext;          // Next in pid hash chain or free list
+  int slot;                    // Index in ptable.slot
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  int lockticket;              // Ticket it waits on if chan is a ticketlock
+  struct proc *cnext;          // Next process in chan's sleep queue
+  struct proc *cprev;          // Previous process in chan's sleep queue
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
-  struct inode *cwd;           // Current directory
+  struct fdtable *files;       // Open files, maybe shared with threads
+  struct cwd *cwd;             // Current directory, maybe shared too
   char name[16];               // Process name (debugging)
   int tickets;
   int ticks;
+  int weight;                  // Tickets counted on its run queue
+  int rq;                      // Run queue holding this process, or -1
+  int cpu;                     // CPU this process last ran on, or -1
+  uint pass;                   // Stride scheduling virtual time
+  uint passbase;               // Its run queue's pass when it left it
+  int heapi;                   // Index in its run queue's pass heap
+  uint affinity;               // Bit i set if it may run on CPU i
+  int migrations;              // Times it ran on a different CPU than before
+  int quantum;                 // Permille of its last quantum it used
+  int level;                   // MLFQ priority level, 0 highest
+  int slice;                   // Ticks run on this level
+  int group;                   // Ticket group, or 0
+  struct proc *gnext;          // Next member of the same group
+  int borrowed;                // Tickets lent to us by blocked processes
+  struct proc *lendto;         // Process holding our lent tickets, or 0
+  int lendpid;                 // Its pid, in case it exits first
+  int lent;                    // Tickets lent to it
+  int rtperiod;                // Real-time period in ticks, or 0
+  int rtruntime;               // Ticks reserved in each period
+  uint rtdeadline;             // Tick at which the current period ends
+  int rtbudget;                // Reserved ticks left in this period
+  int rtmisses;                // Periods that ended with work left undone
+  struct proc *rtnext;         // Next real-time process
+  uint64 readyat;              // TSC when it last became RUNNABLE
+  uint lathist[NLATBUCKET];    // Waits to run, by log2 of TSC cycles
+  uint64 utime;                // TSC cycles run in user mode
+  uint64 stime;                // TSC cycles run in the kernel
+  uint64 tsc;                  // TSC when utime or stime was last charged
   void *threadstack;            // Address of thread stack to be freed
+  int detached;                // Freed by the scheduler as soon as it exits
 };
 
 // Process memory is laid out contiguously, low addresses first:
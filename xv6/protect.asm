@@ -0,0 +1,1313 @@
+
+_protect:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+
+}
+
+int
+main (int argc ,char *argv[])       
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	53                   	push   %ebx
+    100e:	51                   	push   %ecx
+    100f:	8b 41 04             	mov    0x4(%ecx),%eax
+	char *option=argv[1];	
+    1012:	8b 58 04             	mov    0x4(%eax),%ebx
+		
+	if(strcmp(option,"length")==0)  	
+    1015:	83 ec 08             	sub    $0x8,%esp
+    1018:	68 36 18 00 00       	push   $0x1836
+    101d:	53                   	push   %ebx
+    101e:	e8 dd 00 00 00       	call   1100 <strcmp>
+    1023:	83 c4 10             	add    $0x10,%esp
+    1026:	85 c0                	test   %eax,%eax
+    1028:	75 0a                	jne    1034 <main+0x34>
+		length();
+    102a:	e8 21 00 00 00       	call   1050 <length>
+		
+	else if(strcmp(option ,"aligned")==0)
+		aligned();
+	
+    exit();
+    102f:	e8 df 02 00 00       	call   1313 <exit>
+	else if(strcmp(option ,"aligned")==0)
+    1034:	50                   	push   %eax
+    1035:	50                   	push   %eax
+    1036:	68 3d 18 00 00       	push   $0x183d
+    103b:	53                   	push   %ebx
+    103c:	e8 bf 00 00 00       	call   1100 <strcmp>
+    1041:	83 c4 10             	add    $0x10,%esp
+    1044:	85 c0                	test   %eax,%eax
+    1046:	75 e7                	jne    102f <main+0x2f>
+		aligned();
+    1048:	e8 43 00 00 00       	call   1090 <aligned>
+    104d:	eb e0                	jmp    102f <main+0x2f>
+    104f:	90                   	nop
+
+00001050 <length>:
+{
+    1050:	55                   	push   %ebp
+    1051:	89 e5                	mov    %esp,%ebp
+    1053:	53                   	push   %ebx
+    1054:	83 ec 10             	sub    $0x10,%esp
+	char *protectedValue = sbrk(PGSIZE);
+    1057:	68 00 10 00 00       	push   $0x1000
+    105c:	e8 3a 03 00 00       	call   139b <sbrk>
+    1061:	89 c3                	mov    %eax,%ebx
+	*protectedValue=100;
+    1063:	c6 00 64             	movb   $0x64,(%eax)
+	mprotect(protectedValue, 2) ;
+    1066:	58                   	pop    %eax
+    1067:	5a                   	pop    %edx
+    1068:	6a 02                	push   $0x2
+    106a:	53                   	push   %ebx
+    106b:	e8 53 03 00 00       	call   13c3 <mprotect>
+	*protectedValue=5; 
+    1070:	c6 03 05             	movb   $0x5,(%ebx)
+	printf(1, "\nTest Failed\n");
+    1073:	59                   	pop    %ecx
+    1074:	5b                   	pop    %ebx
+    1075:	68 28 18 00 00       	push   $0x1828
+    107a:	6a 01                	push   $0x1
+    107c:	e8 7f 04 00 00       	call   1500 <printf>
+}
+    1081:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1084:	83 c4 10             	add    $0x10,%esp
+    1087:	c9                   	leave
+    1088:	c3                   	ret
+    1089:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001090 <aligned>:
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	53                   	push   %ebx
+    1094:	83 ec 10             	sub    $0x10,%esp
+	char *protectedValue = sbrk(2*PGSIZE);
+    1097:	68 00 20 00 00       	push   $0x2000
+    109c:	e8 fa 02 00 00       	call   139b <sbrk>
+    10a1:	89 c3                	mov    %eax,%ebx
+	*protectedValue=100; 
+    10a3:	c6 00 64             	movb   $0x64,(%eax)
+	mprotect(protectedValue+1 , 1 ) ;
+    10a6:	58                   	pop    %eax
+    10a7:	8d 43 01             	lea    0x1(%ebx),%eax
+    10aa:	5a                   	pop    %edx
+    10ab:	6a 01                	push   $0x1
+    10ad:	50                   	push   %eax
+    10ae:	e8 10 03 00 00       	call   13c3 <mprotect>
+	*protectedValue=5; 
+    10b3:	c6 03 05             	movb   $0x5,(%ebx)
+	printf(1, "\nTest Failed\n");
+    10b6:	59                   	pop    %ecx
+    10b7:	5b                   	pop    %ebx
+    10b8:	68 28 18 00 00       	push   $0x1828
+    10bd:	6a 01                	push   $0x1
+    10bf:	e8 3c 04 00 00       	call   1500 <printf>
+}
+    10c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10c7:	83 c4 10             	add    $0x10,%esp
+    10ca:	c9                   	leave
+    10cb:	c3                   	ret
+    10cc:	66 90                	xchg   %ax,%ax
+    10ce:	66 90                	xchg   %ax,%ax
+
+000010d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    10d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    10d1:	31 c0                	xor    %eax,%eax
+{
+    10d3:	89 e5                	mov    %esp,%ebp
+    10d5:	53                   	push   %ebx
+    10d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    10d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    10dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    10e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    10e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    10e7:	83 c0 01             	add    $0x1,%eax
+    10ea:	84 d2                	test   %dl,%dl
+    10ec:	75 f2                	jne    10e0 <strcpy+0x10>
+    ;
+  return os;
+}
+    10ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10f1:	89 c8                	mov    %ecx,%eax
+    10f3:	c9                   	leave
+    10f4:	c3                   	ret
+    10f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001100 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	53                   	push   %ebx
+    1104:	8b 55 08             	mov    0x8(%ebp),%edx
+    1107:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    110a:	0f b6 02             	movzbl (%edx),%eax
+    110d:	84 c0                	test   %al,%al
+    110f:	75 17                	jne    1128 <strcmp+0x28>
+    1111:	eb 3a                	jmp    114d <strcmp+0x4d>
+    1113:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1117:	90                   	nop
+    1118:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    111c:	83 c2 01             	add    $0x1,%edx
+    111f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1122:	84 c0                	test   %al,%al
+    1124:	74 1a                	je     1140 <strcmp+0x40>
+    p++, q++;
+    1126:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1128:	0f b6 19             	movzbl (%ecx),%ebx
+    112b:	38 c3                	cmp    %al,%bl
+    112d:	74 e9                	je     1118 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    112f:	29 d8                	sub    %ebx,%eax
+}
+    1131:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1134:	c9                   	leave
+    1135:	c3                   	ret
+    1136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1140:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1144:	31 c0                	xor    %eax,%eax
+    1146:	29 d8                	sub    %ebx,%eax
+}
+    1148:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    114b:	c9                   	leave
+    114c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    114d:	0f b6 19             	movzbl (%ecx),%ebx
+    1150:	31 c0                	xor    %eax,%eax
+    1152:	eb db                	jmp    112f <strcmp+0x2f>
+    1154:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    115f:	90                   	nop
+
+00001160 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1166:	80 3a 00             	cmpb   $0x0,(%edx)
+    1169:	74 15                	je     1180 <strlen+0x20>
+    116b:	31 c0                	xor    %eax,%eax
+    116d:	8d 76 00             	lea    0x0(%esi),%esi
+    1170:	83 c0 01             	add    $0x1,%eax
+    1173:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1177:	89 c1                	mov    %eax,%ecx
+    1179:	75 f5                	jne    1170 <strlen+0x10>
+    ;
+  return n;
+}
+    117b:	89 c8                	mov    %ecx,%eax
+    117d:	5d                   	pop    %ebp
+    117e:	c3                   	ret
+    117f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1180:	31 c9                	xor    %ecx,%ecx
+}
+    1182:	5d                   	pop    %ebp
+    1183:	89 c8                	mov    %ecx,%eax
+    1185:	c3                   	ret
+    1186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001190 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	57                   	push   %edi
+    1194:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1197:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    119a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    119d:	89 d7                	mov    %edx,%edi
+    119f:	fc                   	cld
+    11a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    11a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    11a5:	89 d0                	mov    %edx,%eax
+    11a7:	c9                   	leave
+    11a8:	c3                   	ret
+    11a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    11ba:	0f b6 10             	movzbl (%eax),%edx
+    11bd:	84 d2                	test   %dl,%dl
+    11bf:	75 12                	jne    11d3 <strchr+0x23>
+    11c1:	eb 1d                	jmp    11e0 <strchr+0x30>
+    11c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11c7:	90                   	nop
+    11c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    11cc:	83 c0 01             	add    $0x1,%eax
+    11cf:	84 d2                	test   %dl,%dl
+    11d1:	74 0d                	je     11e0 <strchr+0x30>
+    if(*s == c)
+    11d3:	38 d1                	cmp    %dl,%cl
+    11d5:	75 f1                	jne    11c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    11d7:	5d                   	pop    %ebp
+    11d8:	c3                   	ret
+    11d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    11e0:	31 c0                	xor    %eax,%eax
+}
+    11e2:	5d                   	pop    %ebp
+    11e3:	c3                   	ret
+    11e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11ef:	90                   	nop
+
+000011f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    11f0:	55                   	push   %ebp
+    11f1:	89 e5                	mov    %esp,%ebp
+    11f3:	57                   	push   %edi
+    11f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    11f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    11f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    11f9:	31 db                	xor    %ebx,%ebx
+{
+    11fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    11fe:	eb 27                	jmp    1227 <gets+0x37>
+    cc = read(0, &c, 1);
+    1200:	83 ec 04             	sub    $0x4,%esp
+    1203:	6a 01                	push   $0x1
+    1205:	56                   	push   %esi
+    1206:	6a 00                	push   $0x0
+    1208:	e8 1e 01 00 00       	call   132b <read>
+    if(cc < 1)
+    120d:	83 c4 10             	add    $0x10,%esp
+    1210:	85 c0                	test   %eax,%eax
+    1212:	7e 1d                	jle    1231 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1214:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1218:	8b 55 08             	mov    0x8(%ebp),%edx
+    121b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    121f:	3c 0a                	cmp    $0xa,%al
+    1221:	74 10                	je     1233 <gets+0x43>
+    1223:	3c 0d                	cmp    $0xd,%al
+    1225:	74 0c                	je     1233 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1227:	89 df                	mov    %ebx,%edi
+    1229:	83 c3 01             	add    $0x1,%ebx
+    122c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    122f:	7c cf                	jl     1200 <gets+0x10>
+    1231:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1233:	8b 45 08             	mov    0x8(%ebp),%eax
+    1236:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    123a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    123d:	5b                   	pop    %ebx
+    123e:	5e                   	pop    %esi
+    123f:	5f                   	pop    %edi
+    1240:	5d                   	pop    %ebp
+    1241:	c3                   	ret
+    1242:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001250 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1250:	55                   	push   %ebp
+    1251:	89 e5                	mov    %esp,%ebp
+    1253:	56                   	push   %esi
+    1254:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1255:	83 ec 08             	sub    $0x8,%esp
+    1258:	6a 00                	push   $0x0
+    125a:	ff 75 08             	push   0x8(%ebp)
+    125d:	e8 f1 00 00 00       	call   1353 <open>
+  if(fd < 0)
+    1262:	83 c4 10             	add    $0x10,%esp
+    1265:	85 c0                	test   %eax,%eax
+    1267:	78 27                	js     1290 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1269:	83 ec 08             	sub    $0x8,%esp
+    126c:	ff 75 0c             	push   0xc(%ebp)
+    126f:	89 c3                	mov    %eax,%ebx
+    1271:	50                   	push   %eax
+    1272:	e8 f4 00 00 00       	call   136b <fstat>
+  close(fd);
+    1277:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    127a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    127c:	e8 ba 00 00 00       	call   133b <close>
+  return r;
+    1281:	83 c4 10             	add    $0x10,%esp
+}
+    1284:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1287:	89 f0                	mov    %esi,%eax
+    1289:	5b                   	pop    %ebx
+    128a:	5e                   	pop    %esi
+    128b:	5d                   	pop    %ebp
+    128c:	c3                   	ret
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1290:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1295:	eb ed                	jmp    1284 <stat+0x34>
+    1297:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129e:	66 90                	xchg   %ax,%ax
+
+000012a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    12a0:	55                   	push   %ebp
+    12a1:	89 e5                	mov    %esp,%ebp
+    12a3:	53                   	push   %ebx
+    12a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    12a7:	0f be 02             	movsbl (%edx),%eax
+    12aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    12ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    12b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    12b5:	77 1e                	ja     12d5 <atoi+0x35>
+    12b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    12c0:	83 c2 01             	add    $0x1,%edx
+    12c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    12c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    12ca:	0f be 02             	movsbl (%edx),%eax
+    12cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    12d0:	80 fb 09             	cmp    $0x9,%bl
+    12d3:	76 eb                	jbe    12c0 <atoi+0x20>
+  return n;
+}
+    12d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12d8:	89 c8                	mov    %ecx,%eax
+    12da:	c9                   	leave
+    12db:	c3                   	ret
+    12dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000012e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    12e0:	55                   	push   %ebp
+    12e1:	89 e5                	mov    %esp,%ebp
+    12e3:	57                   	push   %edi
+    12e4:	56                   	push   %esi
+    12e5:	8b 45 10             	mov    0x10(%ebp),%eax
+    12e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    12eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    12ee:	85 c0                	test   %eax,%eax
+    12f0:	7e 13                	jle    1305 <memmove+0x25>
+    12f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    12f4:	89 d7                	mov    %edx,%edi
+    12f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1300:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1301:	39 f8                	cmp    %edi,%eax
+    1303:	75 fb                	jne    1300 <memmove+0x20>
+  return vdst;
+}
+    1305:	5e                   	pop    %esi
+    1306:	89 d0                	mov    %edx,%eax
+    1308:	5f                   	pop    %edi
+    1309:	5d                   	pop    %ebp
+    130a:	c3                   	ret
+
+0000130b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    130b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1310:	cd 40                	int    $0x40
+    1312:	c3                   	ret
+
+00001313 <exit>:
+SYSCALL(exit)
+    1313:	b8 02 00 00 00       	mov    $0x2,%eax
+    1318:	cd 40                	int    $0x40
+    131a:	c3                   	ret
+
+0000131b <wait>:
+SYSCALL(wait)
+    131b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1320:	cd 40                	int    $0x40
+    1322:	c3                   	ret
+
+00001323 <pipe>:
+SYSCALL(pipe)
+    1323:	b8 04 00 00 00       	mov    $0x4,%eax
+    1328:	cd 40                	int    $0x40
+    132a:	c3                   	ret
+
+0000132b <read>:
+SYSCALL(read)
+    132b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1330:	cd 40                	int    $0x40
+    1332:	c3                   	ret
+
+00001333 <write>:
+SYSCALL(write)
+    1333:	b8 10 00 00 00       	mov    $0x10,%eax
+    1338:	cd 40                	int    $0x40
+    133a:	c3                   	ret
+
+0000133b <close>:
+SYSCALL(close)
+    133b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1340:	cd 40                	int    $0x40
+    1342:	c3                   	ret
+
+00001343 <kill>:
+SYSCALL(kill)
+    1343:	b8 06 00 00 00       	mov    $0x6,%eax
+    1348:	cd 40                	int    $0x40
+    134a:	c3                   	ret
+
+0000134b <exec>:
+SYSCALL(exec)
+    134b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1350:	cd 40                	int    $0x40
+    1352:	c3                   	ret
+
+00001353 <open>:
+SYSCALL(open)
+    1353:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1358:	cd 40                	int    $0x40
+    135a:	c3                   	ret
+
+0000135b <mknod>:
+SYSCALL(mknod)
+    135b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1360:	cd 40                	int    $0x40
+    1362:	c3                   	ret
+
+00001363 <unlink>:
+SYSCALL(unlink)
+    1363:	b8 12 00 00 00       	mov    $0x12,%eax
+    1368:	cd 40                	int    $0x40
+    136a:	c3                   	ret
+
+0000136b <fstat>:
+SYSCALL(fstat)
+    136b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1370:	cd 40                	int    $0x40
+    1372:	c3                   	ret
+
+00001373 <link>:
+SYSCALL(link)
+    1373:	b8 13 00 00 00       	mov    $0x13,%eax
+    1378:	cd 40                	int    $0x40
+    137a:	c3                   	ret
+
+0000137b <mkdir>:
+SYSCALL(mkdir)
+    137b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1380:	cd 40                	int    $0x40
+    1382:	c3                   	ret
+
+00001383 <chdir>:
+SYSCALL(chdir)
+    1383:	b8 09 00 00 00       	mov    $0x9,%eax
+    1388:	cd 40                	int    $0x40
+    138a:	c3                   	ret
+
+0000138b <dup>:
+SYSCALL(dup)
+    138b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1390:	cd 40                	int    $0x40
+    1392:	c3                   	ret
+
+00001393 <getpid>:
+SYSCALL(getpid)
+    1393:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1398:	cd 40                	int    $0x40
+    139a:	c3                   	ret
+
+0000139b <sbrk>:
+SYSCALL(sbrk)
+    139b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    13a0:	cd 40                	int    $0x40
+    13a2:	c3                   	ret
+
+000013a3 <sleep>:
+SYSCALL(sleep)
+    13a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    13a8:	cd 40                	int    $0x40
+    13aa:	c3                   	ret
+
+000013ab <uptime>:
+SYSCALL(uptime)
+    13ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+    13b0:	cd 40                	int    $0x40
+    13b2:	c3                   	ret
+
+000013b3 <settickets>:
+SYSCALL(settickets)
+    13b3:	b8 16 00 00 00       	mov    $0x16,%eax
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+
+000013bb <getpinfo>:
+SYSCALL(getpinfo)
+    13bb:	b8 17 00 00 00       	mov    $0x17,%eax
+    13c0:	cd 40                	int    $0x40
+    13c2:	c3                   	ret
+
+000013c3 <mprotect>:
+SYSCALL(mprotect)
+    13c3:	b8 18 00 00 00       	mov    $0x18,%eax
+    13c8:	cd 40                	int    $0x40
+    13ca:	c3                   	ret
+
+000013cb <munprotect>:
+SYSCALL(munprotect)
+    13cb:	b8 19 00 00 00       	mov    $0x19,%eax
+    13d0:	cd 40                	int    $0x40
+    13d2:	c3                   	ret
+
+000013d3 <clone>:
+SYSCALL(clone)
+    13d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    13d8:	cd 40                	int    $0x40
+    13da:	c3                   	ret
+
+000013db <join>:
+SYSCALL(join)
+    13db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    13e0:	cd 40                	int    $0x40
+    13e2:	c3                   	ret
+
+000013e3 <initlock_t>:
+SYSCALL(initlock_t)
+    13e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+
+000013eb <acquire_t>:
+SYSCALL(acquire_t)
+    13eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    13f0:	cd 40                	int    $0x40
+    13f2:	c3                   	ret
+
+000013f3 <release_t>:
+SYSCALL(release_t)
+    13f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    13f8:	cd 40                	int    $0x40
+    13fa:	c3                   	ret
+
+000013fb <setsched>:
+SYSCALL(setsched)
+    13fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1400:	cd 40                	int    $0x40
+    1402:	c3                   	ret
+
+00001403 <mkgroup>:
+SYSCALL(mkgroup)
+    1403:	b8 20 00 00 00       	mov    $0x20,%eax
+    1408:	cd 40                	int    $0x40
+    140a:	c3                   	ret
+
+0000140b <joingroup>:
+SYSCALL(joingroup)
+    140b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1410:	cd 40                	int    $0x40
+    1412:	c3                   	ret
+
+00001413 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1413:	b8 22 00 00 00       	mov    $0x22,%eax
+    1418:	cd 40                	int    $0x40
+    141a:	c3                   	ret
+
+0000141b <setdeadline>:
+SYSCALL(setdeadline)
+    141b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1420:	cd 40                	int    $0x40
+    1422:	c3                   	ret
+
+00001423 <setaffinity>:
+SYSCALL(setaffinity)
+    1423:	b8 24 00 00 00       	mov    $0x24,%eax
+    1428:	cd 40                	int    $0x40
+    142a:	c3                   	ret
+
+0000142b <yield_to>:
+SYSCALL(yield_to)
+    142b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1430:	cd 40                	int    $0x40
+    1432:	c3                   	ret
+
+00001433 <getlatency>:
+SYSCALL(getlatency)
+    1433:	b8 26 00 00 00       	mov    $0x26,%eax
+    1438:	cd 40                	int    $0x40
+    143a:	c3                   	ret
+
+0000143b <futex_wait>:
+SYSCALL(futex_wait)
+    143b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1440:	cd 40                	int    $0x40
+    1442:	c3                   	ret
+
+00001443 <futex_wake>:
+SYSCALL(futex_wake)
+    1443:	b8 28 00 00 00       	mov    $0x28,%eax
+    1448:	cd 40                	int    $0x40
+    144a:	c3                   	ret
+
+0000144b <mguard>:
+SYSCALL(mguard)
+    144b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1450:	cd 40                	int    $0x40
+    1452:	c3                   	ret
+
+00001453 <join_any>:
+SYSCALL(join_any)
+    1453:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1458:	cd 40                	int    $0x40
+    145a:	c3                   	ret
+    145b:	66 90                	xchg   %ax,%ax
+    145d:	66 90                	xchg   %ax,%ax
+    145f:	90                   	nop
+
+00001460 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	57                   	push   %edi
+    1464:	56                   	push   %esi
+    1465:	53                   	push   %ebx
+    1466:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1468:	89 d1                	mov    %edx,%ecx
+{
+    146a:	83 ec 3c             	sub    $0x3c,%esp
+    146d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1470:	85 d2                	test   %edx,%edx
+    1472:	0f 89 80 00 00 00    	jns    14f8 <printint+0x98>
+    1478:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    147c:	74 7a                	je     14f8 <printint+0x98>
+    x = -xx;
+    147e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1480:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1485:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1488:	31 f6                	xor    %esi,%esi
+    148a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1490:	89 c8                	mov    %ecx,%eax
+    1492:	31 d2                	xor    %edx,%edx
+    1494:	89 f7                	mov    %esi,%edi
+    1496:	f7 f3                	div    %ebx
+    1498:	8d 76 01             	lea    0x1(%esi),%esi
+    149b:	0f b6 92 a4 18 00 00 	movzbl 0x18a4(%edx),%edx
+    14a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    14a6:	89 ca                	mov    %ecx,%edx
+    14a8:	89 c1                	mov    %eax,%ecx
+    14aa:	39 da                	cmp    %ebx,%edx
+    14ac:	73 e2                	jae    1490 <printint+0x30>
+  if(neg)
+    14ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    14b1:	85 c0                	test   %eax,%eax
+    14b3:	74 07                	je     14bc <printint+0x5c>
+    buf[i++] = '-';
+    14b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    14ba:	89 f7                	mov    %esi,%edi
+    14bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    14bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    14c2:	01 df                	add    %ebx,%edi
+    14c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    14c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    14cb:	83 ec 04             	sub    $0x4,%esp
+    14ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+    14d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    14d4:	6a 01                	push   $0x1
+    14d6:	50                   	push   %eax
+    14d7:	56                   	push   %esi
+    14d8:	e8 56 fe ff ff       	call   1333 <write>
+  while(--i >= 0)
+    14dd:	89 f8                	mov    %edi,%eax
+    14df:	83 c4 10             	add    $0x10,%esp
+    14e2:	83 ef 01             	sub    $0x1,%edi
+    14e5:	39 d8                	cmp    %ebx,%eax
+    14e7:	75 df                	jne    14c8 <printint+0x68>
+}
+    14e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14ec:	5b                   	pop    %ebx
+    14ed:	5e                   	pop    %esi
+    14ee:	5f                   	pop    %edi
+    14ef:	5d                   	pop    %ebp
+    14f0:	c3                   	ret
+    14f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    14f8:	31 c0                	xor    %eax,%eax
+    14fa:	eb 89                	jmp    1485 <printint+0x25>
+    14fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001500 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1500:	55                   	push   %ebp
+    1501:	89 e5                	mov    %esp,%ebp
+    1503:	57                   	push   %edi
+    1504:	56                   	push   %esi
+    1505:	53                   	push   %ebx
+    1506:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1509:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    150c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    150f:	0f b6 1e             	movzbl (%esi),%ebx
+    1512:	83 c6 01             	add    $0x1,%esi
+    1515:	84 db                	test   %bl,%bl
+    1517:	74 67                	je     1580 <printf+0x80>
+    1519:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    151c:	31 d2                	xor    %edx,%edx
+    151e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1521:	eb 34                	jmp    1557 <printf+0x57>
+    1523:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1527:	90                   	nop
+    1528:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    152b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1530:	83 f8 25             	cmp    $0x25,%eax
+    1533:	74 18                	je     154d <printf+0x4d>
+  write(fd, &c, 1);
+    1535:	83 ec 04             	sub    $0x4,%esp
+    1538:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    153b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    153e:	6a 01                	push   $0x1
+    1540:	50                   	push   %eax
+    1541:	57                   	push   %edi
+    1542:	e8 ec fd ff ff       	call   1333 <write>
+    1547:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    154a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    154d:	0f b6 1e             	movzbl (%esi),%ebx
+    1550:	83 c6 01             	add    $0x1,%esi
+    1553:	84 db                	test   %bl,%bl
+    1555:	74 29                	je     1580 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1557:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    155a:	85 d2                	test   %edx,%edx
+    155c:	74 ca                	je     1528 <printf+0x28>
+      }
+    } else if(state == '%'){
+    155e:	83 fa 25             	cmp    $0x25,%edx
+    1561:	75 ea                	jne    154d <printf+0x4d>
+      if(c == 'd'){
+    1563:	83 f8 25             	cmp    $0x25,%eax
+    1566:	0f 84 24 01 00 00    	je     1690 <printf+0x190>
+    156c:	83 e8 63             	sub    $0x63,%eax
+    156f:	83 f8 15             	cmp    $0x15,%eax
+    1572:	77 1c                	ja     1590 <printf+0x90>
+    1574:	ff 24 85 4c 18 00 00 	jmp    *0x184c(,%eax,4)
+    157b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    157f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1583:	5b                   	pop    %ebx
+    1584:	5e                   	pop    %esi
+    1585:	5f                   	pop    %edi
+    1586:	5d                   	pop    %ebp
+    1587:	c3                   	ret
+    1588:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    158f:	90                   	nop
+  write(fd, &c, 1);
+    1590:	83 ec 04             	sub    $0x4,%esp
+    1593:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1596:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    159a:	6a 01                	push   $0x1
+    159c:	52                   	push   %edx
+    159d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    15a0:	57                   	push   %edi
+    15a1:	e8 8d fd ff ff       	call   1333 <write>
+    15a6:	83 c4 0c             	add    $0xc,%esp
+    15a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    15ac:	6a 01                	push   $0x1
+    15ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    15b1:	52                   	push   %edx
+    15b2:	57                   	push   %edi
+    15b3:	e8 7b fd ff ff       	call   1333 <write>
+        putc(fd, c);
+    15b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    15bb:	31 d2                	xor    %edx,%edx
+    15bd:	eb 8e                	jmp    154d <printf+0x4d>
+    15bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    15c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    15c3:	83 ec 0c             	sub    $0xc,%esp
+    15c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    15cb:	8b 13                	mov    (%ebx),%edx
+    15cd:	6a 00                	push   $0x0
+    15cf:	89 f8                	mov    %edi,%eax
+        ap++;
+    15d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    15d4:	e8 87 fe ff ff       	call   1460 <printint>
+        ap++;
+    15d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    15dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    15df:	31 d2                	xor    %edx,%edx
+    15e1:	e9 67 ff ff ff       	jmp    154d <printf+0x4d>
+    15e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    15f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    15f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    15f5:	83 c0 04             	add    $0x4,%eax
+    15f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    15fb:	85 db                	test   %ebx,%ebx
+    15fd:	0f 84 9d 00 00 00    	je     16a0 <printf+0x1a0>
+        while(*s != 0){
+    1603:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1606:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1608:	84 c0                	test   %al,%al
+    160a:	0f 84 3d ff ff ff    	je     154d <printf+0x4d>
+    1610:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1613:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1616:	89 de                	mov    %ebx,%esi
+    1618:	89 d3                	mov    %edx,%ebx
+    161a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1620:	83 ec 04             	sub    $0x4,%esp
+    1623:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1626:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1629:	6a 01                	push   $0x1
+    162b:	53                   	push   %ebx
+    162c:	57                   	push   %edi
+    162d:	e8 01 fd ff ff       	call   1333 <write>
+        while(*s != 0){
+    1632:	0f b6 06             	movzbl (%esi),%eax
+    1635:	83 c4 10             	add    $0x10,%esp
+    1638:	84 c0                	test   %al,%al
+    163a:	75 e4                	jne    1620 <printf+0x120>
+      state = 0;
+    163c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    163f:	31 d2                	xor    %edx,%edx
+    1641:	e9 07 ff ff ff       	jmp    154d <printf+0x4d>
+    1646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    164d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1650:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1653:	83 ec 0c             	sub    $0xc,%esp
+    1656:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    165b:	8b 13                	mov    (%ebx),%edx
+    165d:	6a 01                	push   $0x1
+    165f:	e9 6b ff ff ff       	jmp    15cf <printf+0xcf>
+    1664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1668:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    166b:	83 ec 04             	sub    $0x4,%esp
+    166e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1671:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1673:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1676:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1679:	6a 01                	push   $0x1
+    167b:	52                   	push   %edx
+    167c:	57                   	push   %edi
+    167d:	e8 b1 fc ff ff       	call   1333 <write>
+        ap++;
+    1682:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1685:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1688:	31 d2                	xor    %edx,%edx
+    168a:	e9 be fe ff ff       	jmp    154d <printf+0x4d>
+    168f:	90                   	nop
+  write(fd, &c, 1);
+    1690:	83 ec 04             	sub    $0x4,%esp
+    1693:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1696:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1699:	6a 01                	push   $0x1
+    169b:	e9 11 ff ff ff       	jmp    15b1 <printf+0xb1>
+    16a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    16a5:	bb 45 18 00 00       	mov    $0x1845,%ebx
+    16aa:	e9 61 ff ff ff       	jmp    1610 <printf+0x110>
+    16af:	90                   	nop
+
+000016b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    16b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16b1:	a1 8c 1b 00 00       	mov    0x1b8c,%eax
+{
+    16b6:	89 e5                	mov    %esp,%ebp
+    16b8:	57                   	push   %edi
+    16b9:	56                   	push   %esi
+    16ba:	53                   	push   %ebx
+    16bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    16be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16cc:	39 ca                	cmp    %ecx,%edx
+    16ce:	73 30                	jae    1700 <free+0x50>
+    16d0:	39 c1                	cmp    %eax,%ecx
+    16d2:	72 04                	jb     16d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16d4:	39 c2                	cmp    %eax,%edx
+    16d6:	72 f0                	jb     16c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    16d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    16db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    16de:	39 f8                	cmp    %edi,%eax
+    16e0:	74 2e                	je     1710 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    16e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    16e5:	8b 42 04             	mov    0x4(%edx),%eax
+    16e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    16eb:	39 f1                	cmp    %esi,%ecx
+    16ed:	74 38                	je     1727 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    16ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    16f1:	5b                   	pop    %ebx
+  freep = p;
+    16f2:	89 15 8c 1b 00 00    	mov    %edx,0x1b8c
+}
+    16f8:	5e                   	pop    %esi
+    16f9:	5f                   	pop    %edi
+    16fa:	5d                   	pop    %ebp
+    16fb:	c3                   	ret
+    16fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1700:	39 c1                	cmp    %eax,%ecx
+    1702:	72 d0                	jb     16d4 <free+0x24>
+    1704:	eb c2                	jmp    16c8 <free+0x18>
+    1706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    170d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1710:	03 70 04             	add    0x4(%eax),%esi
+    1713:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1716:	8b 02                	mov    (%edx),%eax
+    1718:	8b 00                	mov    (%eax),%eax
+    171a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    171d:	8b 42 04             	mov    0x4(%edx),%eax
+    1720:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1723:	39 f1                	cmp    %esi,%ecx
+    1725:	75 c8                	jne    16ef <free+0x3f>
+    p->s.size += bp->s.size;
+    1727:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    172a:	89 15 8c 1b 00 00    	mov    %edx,0x1b8c
+    p->s.size += bp->s.size;
+    1730:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1733:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1736:	89 0a                	mov    %ecx,(%edx)
+}
+    1738:	5b                   	pop    %ebx
+    1739:	5e                   	pop    %esi
+    173a:	5f                   	pop    %edi
+    173b:	5d                   	pop    %ebp
+    173c:	c3                   	ret
+    173d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001740 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1740:	55                   	push   %ebp
+    1741:	89 e5                	mov    %esp,%ebp
+    1743:	57                   	push   %edi
+    1744:	56                   	push   %esi
+    1745:	53                   	push   %ebx
+    1746:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1749:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    174c:	8b 15 8c 1b 00 00    	mov    0x1b8c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1752:	8d 78 07             	lea    0x7(%eax),%edi
+    1755:	c1 ef 03             	shr    $0x3,%edi
+    1758:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    175b:	85 d2                	test   %edx,%edx
+    175d:	0f 84 8d 00 00 00    	je     17f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1763:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1765:	8b 48 04             	mov    0x4(%eax),%ecx
+    1768:	39 f9                	cmp    %edi,%ecx
+    176a:	73 64                	jae    17d0 <malloc+0x90>
+  if(nu < 4096)
+    176c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1771:	39 df                	cmp    %ebx,%edi
+    1773:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1776:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    177d:	eb 0a                	jmp    1789 <malloc+0x49>
+    177f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1780:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1782:	8b 48 04             	mov    0x4(%eax),%ecx
+    1785:	39 f9                	cmp    %edi,%ecx
+    1787:	73 47                	jae    17d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1789:	89 c2                	mov    %eax,%edx
+    178b:	39 05 8c 1b 00 00    	cmp    %eax,0x1b8c
+    1791:	75 ed                	jne    1780 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1793:	83 ec 0c             	sub    $0xc,%esp
+    1796:	56                   	push   %esi
+    1797:	e8 ff fb ff ff       	call   139b <sbrk>
+  if(p == (char*)-1)
+    179c:	83 c4 10             	add    $0x10,%esp
+    179f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17a2:	74 1c                	je     17c0 <malloc+0x80>
+  hp->s.size = nu;
+    17a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    17a7:	83 ec 0c             	sub    $0xc,%esp
+    17aa:	83 c0 08             	add    $0x8,%eax
+    17ad:	50                   	push   %eax
+    17ae:	e8 fd fe ff ff       	call   16b0 <free>
+  return freep;
+    17b3:	8b 15 8c 1b 00 00    	mov    0x1b8c,%edx
+      if((p = morecore(nunits)) == 0)
+    17b9:	83 c4 10             	add    $0x10,%esp
+    17bc:	85 d2                	test   %edx,%edx
+    17be:	75 c0                	jne    1780 <malloc+0x40>
+        return 0;
+  }
+}
+    17c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    17c3:	31 c0                	xor    %eax,%eax
+}
+    17c5:	5b                   	pop    %ebx
+    17c6:	5e                   	pop    %esi
+    17c7:	5f                   	pop    %edi
+    17c8:	5d                   	pop    %ebp
+    17c9:	c3                   	ret
+    17ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    17d0:	39 cf                	cmp    %ecx,%edi
+    17d2:	74 4c                	je     1820 <malloc+0xe0>
+        p->s.size -= nunits;
+    17d4:	29 f9                	sub    %edi,%ecx
+    17d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    17d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    17dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    17df:	89 15 8c 1b 00 00    	mov    %edx,0x1b8c
+}
+    17e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    17e8:	83 c0 08             	add    $0x8,%eax
+}
+    17eb:	5b                   	pop    %ebx
+    17ec:	5e                   	pop    %esi
+    17ed:	5f                   	pop    %edi
+    17ee:	5d                   	pop    %ebp
+    17ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    17f0:	c7 05 8c 1b 00 00 90 	movl   $0x1b90,0x1b8c
+    17f7:	1b 00 00 
+    base.s.size = 0;
+    17fa:	b8 90 1b 00 00       	mov    $0x1b90,%eax
+    base.s.ptr = freep = prevp = &base;
+    17ff:	c7 05 90 1b 00 00 90 	movl   $0x1b90,0x1b90
+    1806:	1b 00 00 
+    base.s.size = 0;
+    1809:	c7 05 94 1b 00 00 00 	movl   $0x0,0x1b94
+    1810:	00 00 00 
+    if(p->s.size >= nunits){
+    1813:	e9 54 ff ff ff       	jmp    176c <malloc+0x2c>
+    1818:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    181f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1820:	8b 08                	mov    (%eax),%ecx
+    1822:	89 0a                	mov    %ecx,(%edx)
+    1824:	eb b9                	jmp    17df <malloc+0x9f>
@@ -4,10 +4,18 @@
 #include "param.h"
 
 struct pstat {
-  int inuse[NPROC];   // whether this slot of the process table is in use (1 or 0) 
-  int tickets[NPROC]; // the number of tickets this process has 
-  int pid[NPROC];     // the PID of each process 
-  int ticks[NPROC];   // the number of ticks each process has accumulated 
+  int inuse[NPSTAT];   // whether this slot of the process table is in use (1 or 0) 
+  int tickets[NPSTAT]; // the number of tickets this process has 
+  int pid[NPSTAT];     // the PID of each process 
+  int ticks[NPSTAT];   // the number of ticks each process has accumulated 
+  int quantum[NPSTAT]; // permille of its last quantum the process used
+  int group[NPSTAT];   // the ticket group of each process, or 0
+  int misses[NPSTAT];  // the deadlines each real-time process has missed
+  int migrations[NPSTAT]; // the times each process moved to another CPU
+  int level[NPSTAT];   // the MLFQ priority level of each process
+  uint utime[NPSTAT];  // the CPU time each process ran in user mode, 1024s of TSC cycles
+  uint stime[NPSTAT];  // the CPU time each process ran in the kernel, 1024s of TSC cycles
+  int next;            // in: process table slot to start at, 0 at first; out: slot to go on from, 0 once all are reported
 };
 
 #endif // _PSTAT_H_
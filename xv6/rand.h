@@ -1,3 +1,2 @@
-void sgenrand(unsigned long);
-long genrand(void);
+void srandcpu(uint);
 long random_at_most(long);
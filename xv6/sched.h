@@ -0,0 +1,5 @@
+// Scheduling policies, see setsched().
+#define SCHED_LOTTERY  0  // draw a random ticket
+#define SCHED_STRIDE   1  // run the lowest pass, pass += stride = STRIDE1/tickets
+#define SCHED_MLFQ     2  // draw a ticket among the highest level's processes
+#define SCHED_GANG 0x100  // or'd in: run a chosen thread's siblings alongside it
@@ -0,0 +1,2785 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	51                   	push   %ecx
+    100e:	83 ec 04             	sub    $0x4,%esp
+  static char buf[100];
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+    1011:	eb 0e                	jmp    1021 <main+0x21>
+    1013:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1017:	90                   	nop
+    if(fd >= 3){
+    1018:	83 f8 02             	cmp    $0x2,%eax
+    101b:	0f 8f 96 00 00 00    	jg     10b7 <main+0xb7>
+  while((fd = open("console", O_RDWR)) >= 0){
+    1021:	83 ec 08             	sub    $0x8,%esp
+    1024:	6a 02                	push   $0x2
+    1026:	68 c9 23 00 00       	push   $0x23c9
+    102b:	e8 23 0e 00 00       	call   1e53 <open>
+    1030:	83 c4 10             	add    $0x10,%esp
+    1033:	85 c0                	test   %eax,%eax
+    1035:	79 e1                	jns    1018 <main+0x18>
+    1037:	eb 2e                	jmp    1067 <main+0x67>
+    1039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+    1040:	80 3d 42 2a 00 00 20 	cmpb   $0x20,0x2a42
+    1047:	0f 84 8d 00 00 00    	je     10da <main+0xda>
+    104d:	8d 76 00             	lea    0x0(%esi),%esi
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+    1050:	e8 b6 0d 00 00       	call   1e0b <fork>
+  if(pid == -1)
+    1055:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1058:	0f 84 c1 00 00 00    	je     111f <main+0x11f>
+    if(fork1() == 0)
+    105e:	85 c0                	test   %eax,%eax
+    1060:	74 63                	je     10c5 <main+0xc5>
+    wait();
+    1062:	e8 b4 0d 00 00       	call   1e1b <wait>
+  printf(2, "$ ");
+    1067:	83 ec 08             	sub    $0x8,%esp
+    106a:	68 28 23 00 00       	push   $0x2328
+    106f:	6a 02                	push   $0x2
+    1071:	e8 8a 0f 00 00       	call   2000 <printf>
+  memset(buf, 0, nbuf);
+    1076:	83 c4 0c             	add    $0xc,%esp
+    1079:	6a 64                	push   $0x64
+    107b:	6a 00                	push   $0x0
+    107d:	68 40 2a 00 00       	push   $0x2a40
+    1082:	e8 09 0c 00 00       	call   1c90 <memset>
+  gets(buf, nbuf);
+    1087:	58                   	pop    %eax
+    1088:	5a                   	pop    %edx
+    1089:	6a 64                	push   $0x64
+    108b:	68 40 2a 00 00       	push   $0x2a40
+    1090:	e8 5b 0c 00 00       	call   1cf0 <gets>
+  if(buf[0] == 0) // EOF
+    1095:	0f b6 05 40 2a 00 00 	movzbl 0x2a40,%eax
+    109c:	83 c4 10             	add    $0x10,%esp
+    109f:	84 c0                	test   %al,%al
+    10a1:	74 0f                	je     10b2 <main+0xb2>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+    10a3:	3c 63                	cmp    $0x63,%al
+    10a5:	75 a9                	jne    1050 <main+0x50>
+    10a7:	80 3d 41 2a 00 00 64 	cmpb   $0x64,0x2a41
+    10ae:	75 a0                	jne    1050 <main+0x50>
+    10b0:	eb 8e                	jmp    1040 <main+0x40>
+  exit();
+    10b2:	e8 5c 0d 00 00       	call   1e13 <exit>
+      close(fd);
+    10b7:	83 ec 0c             	sub    $0xc,%esp
+    10ba:	50                   	push   %eax
+    10bb:	e8 7b 0d 00 00       	call   1e3b <close>
+      break;
+    10c0:	83 c4 10             	add    $0x10,%esp
+    10c3:	eb a2                	jmp    1067 <main+0x67>
+      runcmd(parsecmd(buf));
+    10c5:	83 ec 0c             	sub    $0xc,%esp
+    10c8:	68 40 2a 00 00       	push   $0x2a40
+    10cd:	e8 8e 0a 00 00       	call   1b60 <parsecmd>
+    10d2:	89 04 24             	mov    %eax,(%esp)
+    10d5:	e8 d6 00 00 00       	call   11b0 <runcmd>
+      buf[strlen(buf)-1] = 0;  // chop \n
+    10da:	83 ec 0c             	sub    $0xc,%esp
+    10dd:	68 40 2a 00 00       	push   $0x2a40
+    10e2:	e8 79 0b 00 00       	call   1c60 <strlen>
+      if(chdir(buf+3) < 0)
+    10e7:	c7 04 24 43 2a 00 00 	movl   $0x2a43,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+    10ee:	c6 80 3f 2a 00 00 00 	movb   $0x0,0x2a3f(%eax)
+      if(chdir(buf+3) < 0)
+    10f5:	e8 89 0d 00 00       	call   1e83 <chdir>
+    10fa:	83 c4 10             	add    $0x10,%esp
+    10fd:	85 c0                	test   %eax,%eax
+    10ff:	0f 89 62 ff ff ff    	jns    1067 <main+0x67>
+        printf(2, "cannot cd %s\n", buf+3);
+    1105:	51                   	push   %ecx
+    1106:	68 43 2a 00 00       	push   $0x2a43
+    110b:	68 d1 23 00 00       	push   $0x23d1
+    1110:	6a 02                	push   $0x2
+    1112:	e8 e9 0e 00 00       	call   2000 <printf>
+    1117:	83 c4 10             	add    $0x10,%esp
+    111a:	e9 48 ff ff ff       	jmp    1067 <main+0x67>
+    panic("fork");
+    111f:	83 ec 0c             	sub    $0xc,%esp
+    1122:	68 2b 23 00 00       	push   $0x232b
+    1127:	e8 44 00 00 00       	call   1170 <panic>
+    112c:	66 90                	xchg   %ax,%ax
+    112e:	66 90                	xchg   %ax,%ax
+
+00001130 <getcmd>:
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	56                   	push   %esi
+    1134:	53                   	push   %ebx
+    1135:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1138:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+    113b:	83 ec 08             	sub    $0x8,%esp
+    113e:	68 28 23 00 00       	push   $0x2328
+    1143:	6a 02                	push   $0x2
+    1145:	e8 b6 0e 00 00       	call   2000 <printf>
+  memset(buf, 0, nbuf);
+    114a:	83 c4 0c             	add    $0xc,%esp
+    114d:	56                   	push   %esi
+    114e:	6a 00                	push   $0x0
+    1150:	53                   	push   %ebx
+    1151:	e8 3a 0b 00 00       	call   1c90 <memset>
+  gets(buf, nbuf);
+    1156:	58                   	pop    %eax
+    1157:	5a                   	pop    %edx
+    1158:	56                   	push   %esi
+    1159:	53                   	push   %ebx
+    115a:	e8 91 0b 00 00       	call   1cf0 <gets>
+  if(buf[0] == 0) // EOF
+    115f:	83 c4 10             	add    $0x10,%esp
+    1162:	80 3b 01             	cmpb   $0x1,(%ebx)
+    1165:	19 c0                	sbb    %eax,%eax
+}
+    1167:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    116a:	5b                   	pop    %ebx
+    116b:	5e                   	pop    %esi
+    116c:	5d                   	pop    %ebp
+    116d:	c3                   	ret
+    116e:	66 90                	xchg   %ax,%ax
+
+00001170 <panic>:
+{
+    1170:	55                   	push   %ebp
+    1171:	89 e5                	mov    %esp,%ebp
+    1173:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+    1176:	ff 75 08             	push   0x8(%ebp)
+    1179:	68 c5 23 00 00       	push   $0x23c5
+    117e:	6a 02                	push   $0x2
+    1180:	e8 7b 0e 00 00       	call   2000 <printf>
+  exit();
+    1185:	e8 89 0c 00 00       	call   1e13 <exit>
+    118a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001190 <fork1>:
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+    1196:	e8 70 0c 00 00       	call   1e0b <fork>
+  if(pid == -1)
+    119b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    119e:	74 02                	je     11a2 <fork1+0x12>
+  return pid;
+}
+    11a0:	c9                   	leave
+    11a1:	c3                   	ret
+    panic("fork");
+    11a2:	83 ec 0c             	sub    $0xc,%esp
+    11a5:	68 2b 23 00 00       	push   $0x232b
+    11aa:	e8 c1 ff ff ff       	call   1170 <panic>
+    11af:	90                   	nop
+
+000011b0 <runcmd>:
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	53                   	push   %ebx
+    11b4:	83 ec 14             	sub    $0x14,%esp
+    11b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+    11ba:	85 db                	test   %ebx,%ebx
+    11bc:	74 42                	je     1200 <runcmd+0x50>
+  switch(cmd->type){
+    11be:	83 3b 05             	cmpl   $0x5,(%ebx)
+    11c1:	0f 87 e3 00 00 00    	ja     12aa <runcmd+0xfa>
+    11c7:	8b 03                	mov    (%ebx),%eax
+    11c9:	ff 24 85 e0 23 00 00 	jmp    *0x23e0(,%eax,4)
+    if(ecmd->argv[0] == 0)
+    11d0:	8b 43 04             	mov    0x4(%ebx),%eax
+    11d3:	85 c0                	test   %eax,%eax
+    11d5:	74 29                	je     1200 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+    11d7:	8d 53 04             	lea    0x4(%ebx),%edx
+    11da:	51                   	push   %ecx
+    11db:	51                   	push   %ecx
+    11dc:	52                   	push   %edx
+    11dd:	50                   	push   %eax
+    11de:	e8 68 0c 00 00       	call   1e4b <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+    11e3:	83 c4 0c             	add    $0xc,%esp
+    11e6:	ff 73 04             	push   0x4(%ebx)
+    11e9:	68 37 23 00 00       	push   $0x2337
+    11ee:	6a 02                	push   $0x2
+    11f0:	e8 0b 0e 00 00       	call   2000 <printf>
+    break;
+    11f5:	83 c4 10             	add    $0x10,%esp
+    11f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ff:	90                   	nop
+    exit();
+    1200:	e8 0e 0c 00 00       	call   1e13 <exit>
+    if(fork1() == 0)
+    1205:	e8 86 ff ff ff       	call   1190 <fork1>
+    120a:	85 c0                	test   %eax,%eax
+    120c:	75 f2                	jne    1200 <runcmd+0x50>
+    120e:	e9 8c 00 00 00       	jmp    129f <runcmd+0xef>
+    if(pipe(p) < 0)
+    1213:	83 ec 0c             	sub    $0xc,%esp
+    1216:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1219:	50                   	push   %eax
+    121a:	e8 04 0c 00 00       	call   1e23 <pipe>
+    121f:	83 c4 10             	add    $0x10,%esp
+    1222:	85 c0                	test   %eax,%eax
+    1224:	0f 88 a2 00 00 00    	js     12cc <runcmd+0x11c>
+    if(fork1() == 0){
+    122a:	e8 61 ff ff ff       	call   1190 <fork1>
+    122f:	85 c0                	test   %eax,%eax
+    1231:	0f 84 a2 00 00 00    	je     12d9 <runcmd+0x129>
+    if(fork1() == 0){
+    1237:	e8 54 ff ff ff       	call   1190 <fork1>
+    123c:	85 c0                	test   %eax,%eax
+    123e:	0f 84 c3 00 00 00    	je     1307 <runcmd+0x157>
+    close(p[0]);
+    1244:	83 ec 0c             	sub    $0xc,%esp
+    1247:	ff 75 f0             	push   -0x10(%ebp)
+    124a:	e8 ec 0b 00 00       	call   1e3b <close>
+    close(p[1]);
+    124f:	58                   	pop    %eax
+    1250:	ff 75 f4             	push   -0xc(%ebp)
+    1253:	e8 e3 0b 00 00       	call   1e3b <close>
+    wait();
+    1258:	e8 be 0b 00 00       	call   1e1b <wait>
+    wait();
+    125d:	e8 b9 0b 00 00       	call   1e1b <wait>
+    break;
+    1262:	83 c4 10             	add    $0x10,%esp
+    1265:	eb 99                	jmp    1200 <runcmd+0x50>
+    if(fork1() == 0)
+    1267:	e8 24 ff ff ff       	call   1190 <fork1>
+    126c:	85 c0                	test   %eax,%eax
+    126e:	74 2f                	je     129f <runcmd+0xef>
+    wait();
+    1270:	e8 a6 0b 00 00       	call   1e1b <wait>
+    runcmd(lcmd->right);
+    1275:	83 ec 0c             	sub    $0xc,%esp
+    1278:	ff 73 08             	push   0x8(%ebx)
+    127b:	e8 30 ff ff ff       	call   11b0 <runcmd>
+    close(rcmd->fd);
+    1280:	83 ec 0c             	sub    $0xc,%esp
+    1283:	ff 73 14             	push   0x14(%ebx)
+    1286:	e8 b0 0b 00 00       	call   1e3b <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+    128b:	58                   	pop    %eax
+    128c:	5a                   	pop    %edx
+    128d:	ff 73 10             	push   0x10(%ebx)
+    1290:	ff 73 08             	push   0x8(%ebx)
+    1293:	e8 bb 0b 00 00       	call   1e53 <open>
+    1298:	83 c4 10             	add    $0x10,%esp
+    129b:	85 c0                	test   %eax,%eax
+    129d:	78 18                	js     12b7 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+    129f:	83 ec 0c             	sub    $0xc,%esp
+    12a2:	ff 73 04             	push   0x4(%ebx)
+    12a5:	e8 06 ff ff ff       	call   11b0 <runcmd>
+    panic("runcmd");
+    12aa:	83 ec 0c             	sub    $0xc,%esp
+    12ad:	68 30 23 00 00       	push   $0x2330
+    12b2:	e8 b9 fe ff ff       	call   1170 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+    12b7:	51                   	push   %ecx
+    12b8:	ff 73 08             	push   0x8(%ebx)
+    12bb:	68 47 23 00 00       	push   $0x2347
+    12c0:	6a 02                	push   $0x2
+    12c2:	e8 39 0d 00 00       	call   2000 <printf>
+      exit();
+    12c7:	e8 47 0b 00 00       	call   1e13 <exit>
+      panic("pipe");
+    12cc:	83 ec 0c             	sub    $0xc,%esp
+    12cf:	68 57 23 00 00       	push   $0x2357
+    12d4:	e8 97 fe ff ff       	call   1170 <panic>
+      close(1);
+    12d9:	83 ec 0c             	sub    $0xc,%esp
+    12dc:	6a 01                	push   $0x1
+    12de:	e8 58 0b 00 00       	call   1e3b <close>
+      dup(p[1]);
+    12e3:	58                   	pop    %eax
+    12e4:	ff 75 f4             	push   -0xc(%ebp)
+    12e7:	e8 9f 0b 00 00       	call   1e8b <dup>
+      close(p[0]);
+    12ec:	58                   	pop    %eax
+    12ed:	ff 75 f0             	push   -0x10(%ebp)
+    12f0:	e8 46 0b 00 00       	call   1e3b <close>
+      close(p[1]);
+    12f5:	58                   	pop    %eax
+    12f6:	ff 75 f4             	push   -0xc(%ebp)
+    12f9:	e8 3d 0b 00 00       	call   1e3b <close>
+      runcmd(pcmd->left);
+    12fe:	5a                   	pop    %edx
+    12ff:	ff 73 04             	push   0x4(%ebx)
+    1302:	e8 a9 fe ff ff       	call   11b0 <runcmd>
+      close(0);
+    1307:	83 ec 0c             	sub    $0xc,%esp
+    130a:	6a 00                	push   $0x0
+    130c:	e8 2a 0b 00 00       	call   1e3b <close>
+      dup(p[0]);
+    1311:	5a                   	pop    %edx
+    1312:	ff 75 f0             	push   -0x10(%ebp)
+    1315:	e8 71 0b 00 00       	call   1e8b <dup>
+      close(p[0]);
+    131a:	59                   	pop    %ecx
+    131b:	ff 75 f0             	push   -0x10(%ebp)
+    131e:	e8 18 0b 00 00       	call   1e3b <close>
+      close(p[1]);
+    1323:	58                   	pop    %eax
+    1324:	ff 75 f4             	push   -0xc(%ebp)
+    1327:	e8 0f 0b 00 00       	call   1e3b <close>
+      runcmd(pcmd->right);
+    132c:	58                   	pop    %eax
+    132d:	ff 73 08             	push   0x8(%ebx)
+    1330:	e8 7b fe ff ff       	call   11b0 <runcmd>
+    1335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001340 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	53                   	push   %ebx
+    1344:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    1347:	6a 54                	push   $0x54
+    1349:	e8 f2 0e 00 00       	call   2240 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    134e:	83 c4 0c             	add    $0xc,%esp
+    1351:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+    1353:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+    1355:	6a 00                	push   $0x0
+    1357:	50                   	push   %eax
+    1358:	e8 33 09 00 00       	call   1c90 <memset>
+  cmd->type = EXEC;
+    135d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+    1363:	89 d8                	mov    %ebx,%eax
+    1365:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1368:	c9                   	leave
+    1369:	c3                   	ret
+    136a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001370 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	53                   	push   %ebx
+    1374:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    1377:	6a 18                	push   $0x18
+    1379:	e8 c2 0e 00 00       	call   2240 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    137e:	83 c4 0c             	add    $0xc,%esp
+    1381:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+    1383:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+    1385:	6a 00                	push   $0x0
+    1387:	50                   	push   %eax
+    1388:	e8 03 09 00 00       	call   1c90 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+    138d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+    1390:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+    1396:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+    1399:	8b 45 0c             	mov    0xc(%ebp),%eax
+    139c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+    139f:	8b 45 10             	mov    0x10(%ebp),%eax
+    13a2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+    13a5:	8b 45 14             	mov    0x14(%ebp),%eax
+    13a8:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+    13ab:	8b 45 18             	mov    0x18(%ebp),%eax
+    13ae:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+    13b1:	89 d8                	mov    %ebx,%eax
+    13b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13b6:	c9                   	leave
+    13b7:	c3                   	ret
+    13b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13bf:	90                   	nop
+
+000013c0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	53                   	push   %ebx
+    13c4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    13c7:	6a 0c                	push   $0xc
+    13c9:	e8 72 0e 00 00       	call   2240 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    13ce:	83 c4 0c             	add    $0xc,%esp
+    13d1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+    13d3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+    13d5:	6a 00                	push   $0x0
+    13d7:	50                   	push   %eax
+    13d8:	e8 b3 08 00 00       	call   1c90 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+    13dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+    13e0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+    13e6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+    13e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+    13ec:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+    13ef:	89 d8                	mov    %ebx,%eax
+    13f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13f4:	c9                   	leave
+    13f5:	c3                   	ret
+    13f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001400 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	53                   	push   %ebx
+    1404:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    1407:	6a 0c                	push   $0xc
+    1409:	e8 32 0e 00 00       	call   2240 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    140e:	83 c4 0c             	add    $0xc,%esp
+    1411:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+    1413:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+    1415:	6a 00                	push   $0x0
+    1417:	50                   	push   %eax
+    1418:	e8 73 08 00 00       	call   1c90 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+    141d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+    1420:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+    1426:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+    1429:	8b 45 0c             	mov    0xc(%ebp),%eax
+    142c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+    142f:	89 d8                	mov    %ebx,%eax
+    1431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1434:	c9                   	leave
+    1435:	c3                   	ret
+    1436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001440 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+    1440:	55                   	push   %ebp
+    1441:	89 e5                	mov    %esp,%ebp
+    1443:	53                   	push   %ebx
+    1444:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    1447:	6a 08                	push   $0x8
+    1449:	e8 f2 0d 00 00       	call   2240 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    144e:	83 c4 0c             	add    $0xc,%esp
+    1451:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+    1453:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+    1455:	6a 00                	push   $0x0
+    1457:	50                   	push   %eax
+    1458:	e8 33 08 00 00       	call   1c90 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+    145d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+    1460:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+    1466:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+    1469:	89 d8                	mov    %ebx,%eax
+    146b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    146e:	c9                   	leave
+    146f:	c3                   	ret
+
+00001470 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+    1470:	55                   	push   %ebp
+    1471:	89 e5                	mov    %esp,%ebp
+    1473:	57                   	push   %edi
+    1474:	56                   	push   %esi
+    1475:	53                   	push   %ebx
+    1476:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+    1479:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+    147c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    147f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+    1482:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+    1484:	39 df                	cmp    %ebx,%edi
+    1486:	72 0f                	jb     1497 <gettoken+0x27>
+    1488:	eb 25                	jmp    14af <gettoken+0x3f>
+    148a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+    1490:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+    1493:	39 fb                	cmp    %edi,%ebx
+    1495:	74 18                	je     14af <gettoken+0x3f>
+    1497:	0f be 07             	movsbl (%edi),%eax
+    149a:	83 ec 08             	sub    $0x8,%esp
+    149d:	50                   	push   %eax
+    149e:	68 28 2a 00 00       	push   $0x2a28
+    14a3:	e8 08 08 00 00       	call   1cb0 <strchr>
+    14a8:	83 c4 10             	add    $0x10,%esp
+    14ab:	85 c0                	test   %eax,%eax
+    14ad:	75 e1                	jne    1490 <gettoken+0x20>
+  if(q)
+    14af:	85 f6                	test   %esi,%esi
+    14b1:	74 02                	je     14b5 <gettoken+0x45>
+    *q = s;
+    14b3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+    14b5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+    14b8:	3c 3c                	cmp    $0x3c,%al
+    14ba:	0f 8f d0 00 00 00    	jg     1590 <gettoken+0x120>
+    14c0:	3c 3a                	cmp    $0x3a,%al
+    14c2:	0f 8f bc 00 00 00    	jg     1584 <gettoken+0x114>
+    14c8:	84 c0                	test   %al,%al
+    14ca:	75 44                	jne    1510 <gettoken+0xa0>
+    14cc:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+    14ce:	8b 4d 14             	mov    0x14(%ebp),%ecx
+    14d1:	85 c9                	test   %ecx,%ecx
+    14d3:	74 05                	je     14da <gettoken+0x6a>
+    *eq = s;
+    14d5:	8b 45 14             	mov    0x14(%ebp),%eax
+    14d8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+    14da:	39 df                	cmp    %ebx,%edi
+    14dc:	72 09                	jb     14e7 <gettoken+0x77>
+    14de:	eb 1f                	jmp    14ff <gettoken+0x8f>
+    s++;
+    14e0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+    14e3:	39 fb                	cmp    %edi,%ebx
+    14e5:	74 18                	je     14ff <gettoken+0x8f>
+    14e7:	0f be 07             	movsbl (%edi),%eax
+    14ea:	83 ec 08             	sub    $0x8,%esp
+    14ed:	50                   	push   %eax
+    14ee:	68 28 2a 00 00       	push   $0x2a28
+    14f3:	e8 b8 07 00 00       	call   1cb0 <strchr>
+    14f8:	83 c4 10             	add    $0x10,%esp
+    14fb:	85 c0                	test   %eax,%eax
+    14fd:	75 e1                	jne    14e0 <gettoken+0x70>
+  *ps = s;
+    14ff:	8b 45 08             	mov    0x8(%ebp),%eax
+    1502:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+    1504:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1507:	89 f0                	mov    %esi,%eax
+    1509:	5b                   	pop    %ebx
+    150a:	5e                   	pop    %esi
+    150b:	5f                   	pop    %edi
+    150c:	5d                   	pop    %ebp
+    150d:	c3                   	ret
+    150e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+    1510:	79 66                	jns    1578 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+    1512:	39 df                	cmp    %ebx,%edi
+    1514:	72 39                	jb     154f <gettoken+0xdf>
+  if(eq)
+    1516:	8b 55 14             	mov    0x14(%ebp),%edx
+    1519:	85 d2                	test   %edx,%edx
+    151b:	0f 84 b3 00 00 00    	je     15d4 <gettoken+0x164>
+    *eq = s;
+    1521:	8b 45 14             	mov    0x14(%ebp),%eax
+    1524:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+    1526:	e9 a9 00 00 00       	jmp    15d4 <gettoken+0x164>
+    152b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    152f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+    1530:	0f be 07             	movsbl (%edi),%eax
+    1533:	83 ec 08             	sub    $0x8,%esp
+    1536:	50                   	push   %eax
+    1537:	68 20 2a 00 00       	push   $0x2a20
+    153c:	e8 6f 07 00 00       	call   1cb0 <strchr>
+    1541:	83 c4 10             	add    $0x10,%esp
+    1544:	85 c0                	test   %eax,%eax
+    1546:	75 1f                	jne    1567 <gettoken+0xf7>
+      s++;
+    1548:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+    154b:	39 fb                	cmp    %edi,%ebx
+    154d:	74 77                	je     15c6 <gettoken+0x156>
+    154f:	0f be 07             	movsbl (%edi),%eax
+    1552:	83 ec 08             	sub    $0x8,%esp
+    1555:	50                   	push   %eax
+    1556:	68 28 2a 00 00       	push   $0x2a28
+    155b:	e8 50 07 00 00       	call   1cb0 <strchr>
+    1560:	83 c4 10             	add    $0x10,%esp
+    1563:	85 c0                	test   %eax,%eax
+    1565:	74 c9                	je     1530 <gettoken+0xc0>
+    ret = 'a';
+    1567:	be 61 00 00 00       	mov    $0x61,%esi
+    156c:	e9 5d ff ff ff       	jmp    14ce <gettoken+0x5e>
+    1571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+    1578:	3c 26                	cmp    $0x26,%al
+    157a:	74 08                	je     1584 <gettoken+0x114>
+    157c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+    157f:	80 f9 01             	cmp    $0x1,%cl
+    1582:	77 8e                	ja     1512 <gettoken+0xa2>
+  ret = *s;
+    1584:	0f be f0             	movsbl %al,%esi
+    s++;
+    1587:	83 c7 01             	add    $0x1,%edi
+    break;
+    158a:	e9 3f ff ff ff       	jmp    14ce <gettoken+0x5e>
+    158f:	90                   	nop
+  switch(*s){
+    1590:	3c 3e                	cmp    $0x3e,%al
+    1592:	75 1c                	jne    15b0 <gettoken+0x140>
+    if(*s == '>'){
+    1594:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+    1598:	74 1f                	je     15b9 <gettoken+0x149>
+    s++;
+    159a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+    159d:	be 3e 00 00 00       	mov    $0x3e,%esi
+    15a2:	e9 27 ff ff ff       	jmp    14ce <gettoken+0x5e>
+    15a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ae:	66 90                	xchg   %ax,%ax
+  switch(*s){
+    15b0:	3c 7c                	cmp    $0x7c,%al
+    15b2:	74 d0                	je     1584 <gettoken+0x114>
+    15b4:	e9 59 ff ff ff       	jmp    1512 <gettoken+0xa2>
+      s++;
+    15b9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+    15bc:	be 2b 00 00 00       	mov    $0x2b,%esi
+    15c1:	e9 08 ff ff ff       	jmp    14ce <gettoken+0x5e>
+  if(eq)
+    15c6:	8b 45 14             	mov    0x14(%ebp),%eax
+    15c9:	85 c0                	test   %eax,%eax
+    15cb:	74 05                	je     15d2 <gettoken+0x162>
+    *eq = s;
+    15cd:	8b 45 14             	mov    0x14(%ebp),%eax
+    15d0:	89 18                	mov    %ebx,(%eax)
+      s++;
+    15d2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+    15d4:	be 61 00 00 00       	mov    $0x61,%esi
+    15d9:	e9 21 ff ff ff       	jmp    14ff <gettoken+0x8f>
+    15de:	66 90                	xchg   %ax,%ax
+
+000015e0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+    15e0:	55                   	push   %ebp
+    15e1:	89 e5                	mov    %esp,%ebp
+    15e3:	57                   	push   %edi
+    15e4:	56                   	push   %esi
+    15e5:	53                   	push   %ebx
+    15e6:	83 ec 0c             	sub    $0xc,%esp
+    15e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+    15ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+    15ef:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+    15f1:	39 f3                	cmp    %esi,%ebx
+    15f3:	72 12                	jb     1607 <peek+0x27>
+    15f5:	eb 28                	jmp    161f <peek+0x3f>
+    15f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15fe:	66 90                	xchg   %ax,%ax
+    s++;
+    1600:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+    1603:	39 de                	cmp    %ebx,%esi
+    1605:	74 18                	je     161f <peek+0x3f>
+    1607:	0f be 03             	movsbl (%ebx),%eax
+    160a:	83 ec 08             	sub    $0x8,%esp
+    160d:	50                   	push   %eax
+    160e:	68 28 2a 00 00       	push   $0x2a28
+    1613:	e8 98 06 00 00       	call   1cb0 <strchr>
+    1618:	83 c4 10             	add    $0x10,%esp
+    161b:	85 c0                	test   %eax,%eax
+    161d:	75 e1                	jne    1600 <peek+0x20>
+  *ps = s;
+    161f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+    1621:	0f be 03             	movsbl (%ebx),%eax
+    1624:	31 d2                	xor    %edx,%edx
+    1626:	84 c0                	test   %al,%al
+    1628:	75 0e                	jne    1638 <peek+0x58>
+}
+    162a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    162d:	89 d0                	mov    %edx,%eax
+    162f:	5b                   	pop    %ebx
+    1630:	5e                   	pop    %esi
+    1631:	5f                   	pop    %edi
+    1632:	5d                   	pop    %ebp
+    1633:	c3                   	ret
+    1634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+    1638:	83 ec 08             	sub    $0x8,%esp
+    163b:	50                   	push   %eax
+    163c:	ff 75 10             	push   0x10(%ebp)
+    163f:	e8 6c 06 00 00       	call   1cb0 <strchr>
+    1644:	83 c4 10             	add    $0x10,%esp
+    1647:	31 d2                	xor    %edx,%edx
+    1649:	85 c0                	test   %eax,%eax
+    164b:	0f 95 c2             	setne  %dl
+}
+    164e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1651:	5b                   	pop    %ebx
+    1652:	89 d0                	mov    %edx,%eax
+    1654:	5e                   	pop    %esi
+    1655:	5f                   	pop    %edi
+    1656:	5d                   	pop    %ebp
+    1657:	c3                   	ret
+    1658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    165f:	90                   	nop
+
+00001660 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+    1660:	55                   	push   %ebp
+    1661:	89 e5                	mov    %esp,%ebp
+    1663:	57                   	push   %edi
+    1664:	56                   	push   %esi
+    1665:	53                   	push   %ebx
+    1666:	83 ec 2c             	sub    $0x2c,%esp
+    1669:	8b 75 0c             	mov    0xc(%ebp),%esi
+    166c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+    166f:	90                   	nop
+    1670:	83 ec 04             	sub    $0x4,%esp
+    1673:	68 79 23 00 00       	push   $0x2379
+    1678:	53                   	push   %ebx
+    1679:	56                   	push   %esi
+    167a:	e8 61 ff ff ff       	call   15e0 <peek>
+    167f:	83 c4 10             	add    $0x10,%esp
+    1682:	85 c0                	test   %eax,%eax
+    1684:	0f 84 f6 00 00 00    	je     1780 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+    168a:	6a 00                	push   $0x0
+    168c:	6a 00                	push   $0x0
+    168e:	53                   	push   %ebx
+    168f:	56                   	push   %esi
+    1690:	e8 db fd ff ff       	call   1470 <gettoken>
+    1695:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+    1697:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    169a:	50                   	push   %eax
+    169b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    169e:	50                   	push   %eax
+    169f:	53                   	push   %ebx
+    16a0:	56                   	push   %esi
+    16a1:	e8 ca fd ff ff       	call   1470 <gettoken>
+    16a6:	83 c4 20             	add    $0x20,%esp
+    16a9:	83 f8 61             	cmp    $0x61,%eax
+    16ac:	0f 85 d9 00 00 00    	jne    178b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+    16b2:	83 ff 3c             	cmp    $0x3c,%edi
+    16b5:	74 69                	je     1720 <parseredirs+0xc0>
+    16b7:	83 ff 3e             	cmp    $0x3e,%edi
+    16ba:	74 05                	je     16c1 <parseredirs+0x61>
+    16bc:	83 ff 2b             	cmp    $0x2b,%edi
+    16bf:	75 af                	jne    1670 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+    16c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    16c4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+    16c7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+    16ca:	89 55 d0             	mov    %edx,-0x30(%ebp)
+    16cd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+    16d0:	6a 18                	push   $0x18
+    16d2:	e8 69 0b 00 00       	call   2240 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    16d7:	83 c4 0c             	add    $0xc,%esp
+    16da:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+    16dc:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+    16de:	6a 00                	push   $0x0
+    16e0:	50                   	push   %eax
+    16e1:	e8 aa 05 00 00       	call   1c90 <memset>
+  cmd->type = REDIR;
+    16e6:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+    16ec:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+    16ef:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+    16f2:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+    16f5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    16f8:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+    16fb:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+    16fe:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+    1705:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+    1708:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+    170f:	89 7d 08             	mov    %edi,0x8(%ebp)
+    1712:	e9 59 ff ff ff       	jmp    1670 <parseredirs+0x10>
+    1717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    171e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+    1720:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1723:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+    1726:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+    1729:	89 55 d0             	mov    %edx,-0x30(%ebp)
+    172c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+    172f:	6a 18                	push   $0x18
+    1731:	e8 0a 0b 00 00       	call   2240 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    1736:	83 c4 0c             	add    $0xc,%esp
+    1739:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+    173b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+    173d:	6a 00                	push   $0x0
+    173f:	50                   	push   %eax
+    1740:	e8 4b 05 00 00       	call   1c90 <memset>
+  cmd->cmd = subcmd;
+    1745:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+    1748:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+    174b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+    174e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+    1751:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+    1757:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+    175a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+    175d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+    1760:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+    1763:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+    176a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+    1771:	e9 fa fe ff ff       	jmp    1670 <parseredirs+0x10>
+    1776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    177d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+    1780:	8b 45 08             	mov    0x8(%ebp),%eax
+    1783:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1786:	5b                   	pop    %ebx
+    1787:	5e                   	pop    %esi
+    1788:	5f                   	pop    %edi
+    1789:	5d                   	pop    %ebp
+    178a:	c3                   	ret
+      panic("missing file for redirection");
+    178b:	83 ec 0c             	sub    $0xc,%esp
+    178e:	68 5c 23 00 00       	push   $0x235c
+    1793:	e8 d8 f9 ff ff       	call   1170 <panic>
+    1798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    179f:	90                   	nop
+
+000017a0 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+    17a0:	55                   	push   %ebp
+    17a1:	89 e5                	mov    %esp,%ebp
+    17a3:	57                   	push   %edi
+    17a4:	56                   	push   %esi
+    17a5:	53                   	push   %ebx
+    17a6:	83 ec 30             	sub    $0x30,%esp
+    17a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    17ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+    17af:	68 7c 23 00 00       	push   $0x237c
+    17b4:	56                   	push   %esi
+    17b5:	53                   	push   %ebx
+    17b6:	e8 25 fe ff ff       	call   15e0 <peek>
+    17bb:	83 c4 10             	add    $0x10,%esp
+    17be:	85 c0                	test   %eax,%eax
+    17c0:	0f 85 aa 00 00 00    	jne    1870 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+    17c6:	83 ec 0c             	sub    $0xc,%esp
+    17c9:	89 c7                	mov    %eax,%edi
+    17cb:	6a 54                	push   $0x54
+    17cd:	e8 6e 0a 00 00       	call   2240 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    17d2:	83 c4 0c             	add    $0xc,%esp
+    17d5:	6a 54                	push   $0x54
+    17d7:	6a 00                	push   $0x0
+    17d9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    17dc:	50                   	push   %eax
+    17dd:	e8 ae 04 00 00       	call   1c90 <memset>
+  cmd->type = EXEC;
+    17e2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+    17e5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+    17e8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+    17ee:	56                   	push   %esi
+    17ef:	53                   	push   %ebx
+    17f0:	50                   	push   %eax
+    17f1:	e8 6a fe ff ff       	call   1660 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+    17f6:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+    17f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+    17fc:	eb 15                	jmp    1813 <parseexec+0x73>
+    17fe:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+    1800:	83 ec 04             	sub    $0x4,%esp
+    1803:	56                   	push   %esi
+    1804:	53                   	push   %ebx
+    1805:	ff 75 d4             	push   -0x2c(%ebp)
+    1808:	e8 53 fe ff ff       	call   1660 <parseredirs>
+    180d:	83 c4 10             	add    $0x10,%esp
+    1810:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+    1813:	83 ec 04             	sub    $0x4,%esp
+    1816:	68 93 23 00 00       	push   $0x2393
+    181b:	56                   	push   %esi
+    181c:	53                   	push   %ebx
+    181d:	e8 be fd ff ff       	call   15e0 <peek>
+    1822:	83 c4 10             	add    $0x10,%esp
+    1825:	85 c0                	test   %eax,%eax
+    1827:	75 5f                	jne    1888 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+    1829:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    182c:	50                   	push   %eax
+    182d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1830:	50                   	push   %eax
+    1831:	56                   	push   %esi
+    1832:	53                   	push   %ebx
+    1833:	e8 38 fc ff ff       	call   1470 <gettoken>
+    1838:	83 c4 10             	add    $0x10,%esp
+    183b:	85 c0                	test   %eax,%eax
+    183d:	74 49                	je     1888 <parseexec+0xe8>
+    if(tok != 'a')
+    183f:	83 f8 61             	cmp    $0x61,%eax
+    1842:	75 62                	jne    18a6 <parseexec+0x106>
+    cmd->argv[argc] = q;
+    1844:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1847:	8b 55 d0             	mov    -0x30(%ebp),%edx
+    184a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+    184e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1851:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+    1855:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+    1858:	83 ff 0a             	cmp    $0xa,%edi
+    185b:	75 a3                	jne    1800 <parseexec+0x60>
+      panic("too many args");
+    185d:	83 ec 0c             	sub    $0xc,%esp
+    1860:	68 85 23 00 00       	push   $0x2385
+    1865:	e8 06 f9 ff ff       	call   1170 <panic>
+    186a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+    1870:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1873:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+    1876:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1879:	5b                   	pop    %ebx
+    187a:	5e                   	pop    %esi
+    187b:	5f                   	pop    %edi
+    187c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+    187d:	e9 ae 01 00 00       	jmp    1a30 <parseblock>
+    1882:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+    1888:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    188b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+    1892:	00 
+  cmd->eargv[argc] = 0;
+    1893:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+    189a:	00 
+}
+    189b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    189e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18a1:	5b                   	pop    %ebx
+    18a2:	5e                   	pop    %esi
+    18a3:	5f                   	pop    %edi
+    18a4:	5d                   	pop    %ebp
+    18a5:	c3                   	ret
+      panic("syntax");
+    18a6:	83 ec 0c             	sub    $0xc,%esp
+    18a9:	68 7e 23 00 00       	push   $0x237e
+    18ae:	e8 bd f8 ff ff       	call   1170 <panic>
+    18b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000018c0 <parsepipe>:
+{
+    18c0:	55                   	push   %ebp
+    18c1:	89 e5                	mov    %esp,%ebp
+    18c3:	57                   	push   %edi
+    18c4:	56                   	push   %esi
+    18c5:	53                   	push   %ebx
+    18c6:	83 ec 14             	sub    $0x14,%esp
+    18c9:	8b 75 08             	mov    0x8(%ebp),%esi
+    18cc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+    18cf:	57                   	push   %edi
+    18d0:	56                   	push   %esi
+    18d1:	e8 ca fe ff ff       	call   17a0 <parseexec>
+  if(peek(ps, es, "|")){
+    18d6:	83 c4 0c             	add    $0xc,%esp
+    18d9:	68 98 23 00 00       	push   $0x2398
+  cmd = parseexec(ps, es);
+    18de:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+    18e0:	57                   	push   %edi
+    18e1:	56                   	push   %esi
+    18e2:	e8 f9 fc ff ff       	call   15e0 <peek>
+    18e7:	83 c4 10             	add    $0x10,%esp
+    18ea:	85 c0                	test   %eax,%eax
+    18ec:	75 12                	jne    1900 <parsepipe+0x40>
+}
+    18ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18f1:	89 d8                	mov    %ebx,%eax
+    18f3:	5b                   	pop    %ebx
+    18f4:	5e                   	pop    %esi
+    18f5:	5f                   	pop    %edi
+    18f6:	5d                   	pop    %ebp
+    18f7:	c3                   	ret
+    18f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ff:	90                   	nop
+    gettoken(ps, es, 0, 0);
+    1900:	6a 00                	push   $0x0
+    1902:	6a 00                	push   $0x0
+    1904:	57                   	push   %edi
+    1905:	56                   	push   %esi
+    1906:	e8 65 fb ff ff       	call   1470 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+    190b:	58                   	pop    %eax
+    190c:	5a                   	pop    %edx
+    190d:	57                   	push   %edi
+    190e:	56                   	push   %esi
+    190f:	e8 ac ff ff ff       	call   18c0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+    1914:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+    191b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+    191d:	e8 1e 09 00 00       	call   2240 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    1922:	83 c4 0c             	add    $0xc,%esp
+    1925:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+    1927:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+    1929:	6a 00                	push   $0x0
+    192b:	50                   	push   %eax
+    192c:	e8 5f 03 00 00       	call   1c90 <memset>
+  cmd->left = left;
+    1931:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+    1934:	83 c4 10             	add    $0x10,%esp
+    1937:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+    1939:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+    193f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+    1941:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+    1944:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1947:	5b                   	pop    %ebx
+    1948:	5e                   	pop    %esi
+    1949:	5f                   	pop    %edi
+    194a:	5d                   	pop    %ebp
+    194b:	c3                   	ret
+    194c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001950 <parseline>:
+{
+    1950:	55                   	push   %ebp
+    1951:	89 e5                	mov    %esp,%ebp
+    1953:	57                   	push   %edi
+    1954:	56                   	push   %esi
+    1955:	53                   	push   %ebx
+    1956:	83 ec 24             	sub    $0x24,%esp
+    1959:	8b 75 08             	mov    0x8(%ebp),%esi
+    195c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+    195f:	57                   	push   %edi
+    1960:	56                   	push   %esi
+    1961:	e8 5a ff ff ff       	call   18c0 <parsepipe>
+  while(peek(ps, es, "&")){
+    1966:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+    1969:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+    196b:	eb 3b                	jmp    19a8 <parseline+0x58>
+    196d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+    1970:	6a 00                	push   $0x0
+    1972:	6a 00                	push   $0x0
+    1974:	57                   	push   %edi
+    1975:	56                   	push   %esi
+    1976:	e8 f5 fa ff ff       	call   1470 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+    197b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+    1982:	e8 b9 08 00 00       	call   2240 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    1987:	83 c4 0c             	add    $0xc,%esp
+    198a:	6a 08                	push   $0x8
+    198c:	6a 00                	push   $0x0
+    198e:	50                   	push   %eax
+    198f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1992:	e8 f9 02 00 00       	call   1c90 <memset>
+  cmd->type = BACK;
+    1997:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+    199a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+    199d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+    19a3:	89 5a 04             	mov    %ebx,0x4(%edx)
+    19a6:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+    19a8:	83 ec 04             	sub    $0x4,%esp
+    19ab:	68 9a 23 00 00       	push   $0x239a
+    19b0:	57                   	push   %edi
+    19b1:	56                   	push   %esi
+    19b2:	e8 29 fc ff ff       	call   15e0 <peek>
+    19b7:	83 c4 10             	add    $0x10,%esp
+    19ba:	85 c0                	test   %eax,%eax
+    19bc:	75 b2                	jne    1970 <parseline+0x20>
+  if(peek(ps, es, ";")){
+    19be:	83 ec 04             	sub    $0x4,%esp
+    19c1:	68 96 23 00 00       	push   $0x2396
+    19c6:	57                   	push   %edi
+    19c7:	56                   	push   %esi
+    19c8:	e8 13 fc ff ff       	call   15e0 <peek>
+    19cd:	83 c4 10             	add    $0x10,%esp
+    19d0:	85 c0                	test   %eax,%eax
+    19d2:	75 0c                	jne    19e0 <parseline+0x90>
+}
+    19d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19d7:	89 d8                	mov    %ebx,%eax
+    19d9:	5b                   	pop    %ebx
+    19da:	5e                   	pop    %esi
+    19db:	5f                   	pop    %edi
+    19dc:	5d                   	pop    %ebp
+    19dd:	c3                   	ret
+    19de:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+    19e0:	6a 00                	push   $0x0
+    19e2:	6a 00                	push   $0x0
+    19e4:	57                   	push   %edi
+    19e5:	56                   	push   %esi
+    19e6:	e8 85 fa ff ff       	call   1470 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+    19eb:	58                   	pop    %eax
+    19ec:	5a                   	pop    %edx
+    19ed:	57                   	push   %edi
+    19ee:	56                   	push   %esi
+    19ef:	e8 5c ff ff ff       	call   1950 <parseline>
+  cmd = malloc(sizeof(*cmd));
+    19f4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+    19fb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+    19fd:	e8 3e 08 00 00       	call   2240 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    1a02:	83 c4 0c             	add    $0xc,%esp
+    1a05:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+    1a07:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+    1a09:	6a 00                	push   $0x0
+    1a0b:	50                   	push   %eax
+    1a0c:	e8 7f 02 00 00       	call   1c90 <memset>
+  cmd->left = left;
+    1a11:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+    1a14:	83 c4 10             	add    $0x10,%esp
+    1a17:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+    1a19:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+    1a1f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+    1a21:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+    1a24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a27:	5b                   	pop    %ebx
+    1a28:	5e                   	pop    %esi
+    1a29:	5f                   	pop    %edi
+    1a2a:	5d                   	pop    %ebp
+    1a2b:	c3                   	ret
+    1a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001a30 <parseblock>:
+{
+    1a30:	55                   	push   %ebp
+    1a31:	89 e5                	mov    %esp,%ebp
+    1a33:	57                   	push   %edi
+    1a34:	56                   	push   %esi
+    1a35:	53                   	push   %ebx
+    1a36:	83 ec 10             	sub    $0x10,%esp
+    1a39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1a3c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+    1a3f:	68 7c 23 00 00       	push   $0x237c
+    1a44:	56                   	push   %esi
+    1a45:	53                   	push   %ebx
+    1a46:	e8 95 fb ff ff       	call   15e0 <peek>
+    1a4b:	83 c4 10             	add    $0x10,%esp
+    1a4e:	85 c0                	test   %eax,%eax
+    1a50:	74 4a                	je     1a9c <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+    1a52:	6a 00                	push   $0x0
+    1a54:	6a 00                	push   $0x0
+    1a56:	56                   	push   %esi
+    1a57:	53                   	push   %ebx
+    1a58:	e8 13 fa ff ff       	call   1470 <gettoken>
+  cmd = parseline(ps, es);
+    1a5d:	58                   	pop    %eax
+    1a5e:	5a                   	pop    %edx
+    1a5f:	56                   	push   %esi
+    1a60:	53                   	push   %ebx
+    1a61:	e8 ea fe ff ff       	call   1950 <parseline>
+  if(!peek(ps, es, ")"))
+    1a66:	83 c4 0c             	add    $0xc,%esp
+    1a69:	68 b8 23 00 00       	push   $0x23b8
+  cmd = parseline(ps, es);
+    1a6e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+    1a70:	56                   	push   %esi
+    1a71:	53                   	push   %ebx
+    1a72:	e8 69 fb ff ff       	call   15e0 <peek>
+    1a77:	83 c4 10             	add    $0x10,%esp
+    1a7a:	85 c0                	test   %eax,%eax
+    1a7c:	74 2b                	je     1aa9 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+    1a7e:	6a 00                	push   $0x0
+    1a80:	6a 00                	push   $0x0
+    1a82:	56                   	push   %esi
+    1a83:	53                   	push   %ebx
+    1a84:	e8 e7 f9 ff ff       	call   1470 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+    1a89:	83 c4 0c             	add    $0xc,%esp
+    1a8c:	56                   	push   %esi
+    1a8d:	53                   	push   %ebx
+    1a8e:	57                   	push   %edi
+    1a8f:	e8 cc fb ff ff       	call   1660 <parseredirs>
+}
+    1a94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a97:	5b                   	pop    %ebx
+    1a98:	5e                   	pop    %esi
+    1a99:	5f                   	pop    %edi
+    1a9a:	5d                   	pop    %ebp
+    1a9b:	c3                   	ret
+    panic("parseblock");
+    1a9c:	83 ec 0c             	sub    $0xc,%esp
+    1a9f:	68 9c 23 00 00       	push   $0x239c
+    1aa4:	e8 c7 f6 ff ff       	call   1170 <panic>
+    panic("syntax - missing )");
+    1aa9:	83 ec 0c             	sub    $0xc,%esp
+    1aac:	68 a7 23 00 00       	push   $0x23a7
+    1ab1:	e8 ba f6 ff ff       	call   1170 <panic>
+    1ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001ac0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+    1ac0:	55                   	push   %ebp
+    1ac1:	89 e5                	mov    %esp,%ebp
+    1ac3:	53                   	push   %ebx
+    1ac4:	83 ec 04             	sub    $0x4,%esp
+    1ac7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+    1aca:	85 db                	test   %ebx,%ebx
+    1acc:	0f 84 7e 00 00 00    	je     1b50 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+    1ad2:	83 3b 05             	cmpl   $0x5,(%ebx)
+    1ad5:	77 20                	ja     1af7 <nulterminate+0x37>
+    1ad7:	8b 03                	mov    (%ebx),%eax
+    1ad9:	ff 24 85 f8 23 00 00 	jmp    *0x23f8(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+    1ae0:	83 ec 0c             	sub    $0xc,%esp
+    1ae3:	ff 73 04             	push   0x4(%ebx)
+    1ae6:	e8 d5 ff ff ff       	call   1ac0 <nulterminate>
+    nulterminate(lcmd->right);
+    1aeb:	58                   	pop    %eax
+    1aec:	ff 73 08             	push   0x8(%ebx)
+    1aef:	e8 cc ff ff ff       	call   1ac0 <nulterminate>
+    break;
+    1af4:	83 c4 10             	add    $0x10,%esp
+    return 0;
+    1af7:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+    1af9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1afc:	c9                   	leave
+    1afd:	c3                   	ret
+    1afe:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+    1b00:	83 ec 0c             	sub    $0xc,%esp
+    1b03:	ff 73 04             	push   0x4(%ebx)
+    1b06:	e8 b5 ff ff ff       	call   1ac0 <nulterminate>
+    break;
+    1b0b:	83 c4 10             	add    $0x10,%esp
+    1b0e:	eb e7                	jmp    1af7 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+    1b10:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    1b13:	8d 43 08             	lea    0x8(%ebx),%eax
+    1b16:	85 c9                	test   %ecx,%ecx
+    1b18:	74 dd                	je     1af7 <nulterminate+0x37>
+    1b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+    1b20:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+    1b23:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+    1b26:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+    1b29:	8b 50 fc             	mov    -0x4(%eax),%edx
+    1b2c:	85 d2                	test   %edx,%edx
+    1b2e:	75 f0                	jne    1b20 <nulterminate+0x60>
+    1b30:	eb c5                	jmp    1af7 <nulterminate+0x37>
+    1b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+    1b38:	83 ec 0c             	sub    $0xc,%esp
+    1b3b:	ff 73 04             	push   0x4(%ebx)
+    1b3e:	e8 7d ff ff ff       	call   1ac0 <nulterminate>
+    *rcmd->efile = 0;
+    1b43:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+    1b46:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+    1b49:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+    1b4c:	eb a9                	jmp    1af7 <nulterminate+0x37>
+    1b4e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1b50:	31 c0                	xor    %eax,%eax
+    1b52:	eb a5                	jmp    1af9 <nulterminate+0x39>
+    1b54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b5f:	90                   	nop
+
+00001b60 <parsecmd>:
+{
+    1b60:	55                   	push   %ebp
+    1b61:	89 e5                	mov    %esp,%ebp
+    1b63:	57                   	push   %edi
+    1b64:	56                   	push   %esi
+  cmd = parseline(&s, es);
+    1b65:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+    1b68:	53                   	push   %ebx
+    1b69:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+    1b6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1b6f:	53                   	push   %ebx
+    1b70:	e8 eb 00 00 00       	call   1c60 <strlen>
+  cmd = parseline(&s, es);
+    1b75:	59                   	pop    %ecx
+    1b76:	5e                   	pop    %esi
+  es = s + strlen(s);
+    1b77:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+    1b79:	53                   	push   %ebx
+    1b7a:	57                   	push   %edi
+    1b7b:	e8 d0 fd ff ff       	call   1950 <parseline>
+  peek(&s, es, "");
+    1b80:	83 c4 0c             	add    $0xc,%esp
+    1b83:	68 46 23 00 00       	push   $0x2346
+  cmd = parseline(&s, es);
+    1b88:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+    1b8a:	53                   	push   %ebx
+    1b8b:	57                   	push   %edi
+    1b8c:	e8 4f fa ff ff       	call   15e0 <peek>
+  if(s != es){
+    1b91:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b94:	83 c4 10             	add    $0x10,%esp
+    1b97:	39 d8                	cmp    %ebx,%eax
+    1b99:	75 13                	jne    1bae <parsecmd+0x4e>
+  nulterminate(cmd);
+    1b9b:	83 ec 0c             	sub    $0xc,%esp
+    1b9e:	56                   	push   %esi
+    1b9f:	e8 1c ff ff ff       	call   1ac0 <nulterminate>
+}
+    1ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ba7:	89 f0                	mov    %esi,%eax
+    1ba9:	5b                   	pop    %ebx
+    1baa:	5e                   	pop    %esi
+    1bab:	5f                   	pop    %edi
+    1bac:	5d                   	pop    %ebp
+    1bad:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+    1bae:	52                   	push   %edx
+    1baf:	50                   	push   %eax
+    1bb0:	68 ba 23 00 00       	push   $0x23ba
+    1bb5:	6a 02                	push   $0x2
+    1bb7:	e8 44 04 00 00       	call   2000 <printf>
+    panic("syntax");
+    1bbc:	c7 04 24 7e 23 00 00 	movl   $0x237e,(%esp)
+    1bc3:	e8 a8 f5 ff ff       	call   1170 <panic>
+    1bc8:	66 90                	xchg   %ax,%ax
+    1bca:	66 90                	xchg   %ax,%ax
+    1bcc:	66 90                	xchg   %ax,%ax
+    1bce:	66 90                	xchg   %ax,%ax
+
+00001bd0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1bd0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1bd1:	31 c0                	xor    %eax,%eax
+{
+    1bd3:	89 e5                	mov    %esp,%ebp
+    1bd5:	53                   	push   %ebx
+    1bd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1bd9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1be0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1be4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1be7:	83 c0 01             	add    $0x1,%eax
+    1bea:	84 d2                	test   %dl,%dl
+    1bec:	75 f2                	jne    1be0 <strcpy+0x10>
+    ;
+  return os;
+}
+    1bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1bf1:	89 c8                	mov    %ecx,%eax
+    1bf3:	c9                   	leave
+    1bf4:	c3                   	ret
+    1bf5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001c00 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1c00:	55                   	push   %ebp
+    1c01:	89 e5                	mov    %esp,%ebp
+    1c03:	53                   	push   %ebx
+    1c04:	8b 55 08             	mov    0x8(%ebp),%edx
+    1c07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    1c0a:	0f b6 02             	movzbl (%edx),%eax
+    1c0d:	84 c0                	test   %al,%al
+    1c0f:	75 17                	jne    1c28 <strcmp+0x28>
+    1c11:	eb 3a                	jmp    1c4d <strcmp+0x4d>
+    1c13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c17:	90                   	nop
+    1c18:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    1c1c:	83 c2 01             	add    $0x1,%edx
+    1c1f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1c22:	84 c0                	test   %al,%al
+    1c24:	74 1a                	je     1c40 <strcmp+0x40>
+    p++, q++;
+    1c26:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1c28:	0f b6 19             	movzbl (%ecx),%ebx
+    1c2b:	38 c3                	cmp    %al,%bl
+    1c2d:	74 e9                	je     1c18 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    1c2f:	29 d8                	sub    %ebx,%eax
+}
+    1c31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c34:	c9                   	leave
+    1c35:	c3                   	ret
+    1c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c3d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1c40:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1c44:	31 c0                	xor    %eax,%eax
+    1c46:	29 d8                	sub    %ebx,%eax
+}
+    1c48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c4b:	c9                   	leave
+    1c4c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    1c4d:	0f b6 19             	movzbl (%ecx),%ebx
+    1c50:	31 c0                	xor    %eax,%eax
+    1c52:	eb db                	jmp    1c2f <strcmp+0x2f>
+    1c54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c5f:	90                   	nop
+
+00001c60 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1c60:	55                   	push   %ebp
+    1c61:	89 e5                	mov    %esp,%ebp
+    1c63:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1c66:	80 3a 00             	cmpb   $0x0,(%edx)
+    1c69:	74 15                	je     1c80 <strlen+0x20>
+    1c6b:	31 c0                	xor    %eax,%eax
+    1c6d:	8d 76 00             	lea    0x0(%esi),%esi
+    1c70:	83 c0 01             	add    $0x1,%eax
+    1c73:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1c77:	89 c1                	mov    %eax,%ecx
+    1c79:	75 f5                	jne    1c70 <strlen+0x10>
+    ;
+  return n;
+}
+    1c7b:	89 c8                	mov    %ecx,%eax
+    1c7d:	5d                   	pop    %ebp
+    1c7e:	c3                   	ret
+    1c7f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1c80:	31 c9                	xor    %ecx,%ecx
+}
+    1c82:	5d                   	pop    %ebp
+    1c83:	89 c8                	mov    %ecx,%eax
+    1c85:	c3                   	ret
+    1c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001c90 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1c90:	55                   	push   %ebp
+    1c91:	89 e5                	mov    %esp,%ebp
+    1c93:	57                   	push   %edi
+    1c94:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1c97:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1c9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1c9d:	89 d7                	mov    %edx,%edi
+    1c9f:	fc                   	cld
+    1ca0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1ca2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1ca5:	89 d0                	mov    %edx,%eax
+    1ca7:	c9                   	leave
+    1ca8:	c3                   	ret
+    1ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001cb0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1cb0:	55                   	push   %ebp
+    1cb1:	89 e5                	mov    %esp,%ebp
+    1cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+    1cb6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    1cba:	0f b6 10             	movzbl (%eax),%edx
+    1cbd:	84 d2                	test   %dl,%dl
+    1cbf:	75 12                	jne    1cd3 <strchr+0x23>
+    1cc1:	eb 1d                	jmp    1ce0 <strchr+0x30>
+    1cc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1cc7:	90                   	nop
+    1cc8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    1ccc:	83 c0 01             	add    $0x1,%eax
+    1ccf:	84 d2                	test   %dl,%dl
+    1cd1:	74 0d                	je     1ce0 <strchr+0x30>
+    if(*s == c)
+    1cd3:	38 d1                	cmp    %dl,%cl
+    1cd5:	75 f1                	jne    1cc8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1cd7:	5d                   	pop    %ebp
+    1cd8:	c3                   	ret
+    1cd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1ce0:	31 c0                	xor    %eax,%eax
+}
+    1ce2:	5d                   	pop    %ebp
+    1ce3:	c3                   	ret
+    1ce4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1cef:	90                   	nop
+
+00001cf0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1cf0:	55                   	push   %ebp
+    1cf1:	89 e5                	mov    %esp,%ebp
+    1cf3:	57                   	push   %edi
+    1cf4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1cf5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1cf8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1cf9:	31 db                	xor    %ebx,%ebx
+{
+    1cfb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    1cfe:	eb 27                	jmp    1d27 <gets+0x37>
+    cc = read(0, &c, 1);
+    1d00:	83 ec 04             	sub    $0x4,%esp
+    1d03:	6a 01                	push   $0x1
+    1d05:	56                   	push   %esi
+    1d06:	6a 00                	push   $0x0
+    1d08:	e8 1e 01 00 00       	call   1e2b <read>
+    if(cc < 1)
+    1d0d:	83 c4 10             	add    $0x10,%esp
+    1d10:	85 c0                	test   %eax,%eax
+    1d12:	7e 1d                	jle    1d31 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1d14:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1d18:	8b 55 08             	mov    0x8(%ebp),%edx
+    1d1b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    1d1f:	3c 0a                	cmp    $0xa,%al
+    1d21:	74 10                	je     1d33 <gets+0x43>
+    1d23:	3c 0d                	cmp    $0xd,%al
+    1d25:	74 0c                	je     1d33 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1d27:	89 df                	mov    %ebx,%edi
+    1d29:	83 c3 01             	add    $0x1,%ebx
+    1d2c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1d2f:	7c cf                	jl     1d00 <gets+0x10>
+    1d31:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1d33:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d36:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    1d3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d3d:	5b                   	pop    %ebx
+    1d3e:	5e                   	pop    %esi
+    1d3f:	5f                   	pop    %edi
+    1d40:	5d                   	pop    %ebp
+    1d41:	c3                   	ret
+    1d42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001d50 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1d50:	55                   	push   %ebp
+    1d51:	89 e5                	mov    %esp,%ebp
+    1d53:	56                   	push   %esi
+    1d54:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1d55:	83 ec 08             	sub    $0x8,%esp
+    1d58:	6a 00                	push   $0x0
+    1d5a:	ff 75 08             	push   0x8(%ebp)
+    1d5d:	e8 f1 00 00 00       	call   1e53 <open>
+  if(fd < 0)
+    1d62:	83 c4 10             	add    $0x10,%esp
+    1d65:	85 c0                	test   %eax,%eax
+    1d67:	78 27                	js     1d90 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1d69:	83 ec 08             	sub    $0x8,%esp
+    1d6c:	ff 75 0c             	push   0xc(%ebp)
+    1d6f:	89 c3                	mov    %eax,%ebx
+    1d71:	50                   	push   %eax
+    1d72:	e8 f4 00 00 00       	call   1e6b <fstat>
+  close(fd);
+    1d77:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    1d7a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    1d7c:	e8 ba 00 00 00       	call   1e3b <close>
+  return r;
+    1d81:	83 c4 10             	add    $0x10,%esp
+}
+    1d84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1d87:	89 f0                	mov    %esi,%eax
+    1d89:	5b                   	pop    %ebx
+    1d8a:	5e                   	pop    %esi
+    1d8b:	5d                   	pop    %ebp
+    1d8c:	c3                   	ret
+    1d8d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1d90:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1d95:	eb ed                	jmp    1d84 <stat+0x34>
+    1d97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d9e:	66 90                	xchg   %ax,%ax
+
+00001da0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1da0:	55                   	push   %ebp
+    1da1:	89 e5                	mov    %esp,%ebp
+    1da3:	53                   	push   %ebx
+    1da4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1da7:	0f be 02             	movsbl (%edx),%eax
+    1daa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    1dad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1db0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1db5:	77 1e                	ja     1dd5 <atoi+0x35>
+    1db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dbe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1dc0:	83 c2 01             	add    $0x1,%edx
+    1dc3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1dc6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    1dca:	0f be 02             	movsbl (%edx),%eax
+    1dcd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1dd0:	80 fb 09             	cmp    $0x9,%bl
+    1dd3:	76 eb                	jbe    1dc0 <atoi+0x20>
+  return n;
+}
+    1dd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1dd8:	89 c8                	mov    %ecx,%eax
+    1dda:	c9                   	leave
+    1ddb:	c3                   	ret
+    1ddc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001de0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1de0:	55                   	push   %ebp
+    1de1:	89 e5                	mov    %esp,%ebp
+    1de3:	57                   	push   %edi
+    1de4:	56                   	push   %esi
+    1de5:	8b 45 10             	mov    0x10(%ebp),%eax
+    1de8:	8b 55 08             	mov    0x8(%ebp),%edx
+    1deb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    1dee:	85 c0                	test   %eax,%eax
+    1df0:	7e 13                	jle    1e05 <memmove+0x25>
+    1df2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1df4:	89 d7                	mov    %edx,%edi
+    1df6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dfd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1e00:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1e01:	39 f8                	cmp    %edi,%eax
+    1e03:	75 fb                	jne    1e00 <memmove+0x20>
+  return vdst;
+}
+    1e05:	5e                   	pop    %esi
+    1e06:	89 d0                	mov    %edx,%eax
+    1e08:	5f                   	pop    %edi
+    1e09:	5d                   	pop    %ebp
+    1e0a:	c3                   	ret
+
+00001e0b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    1e0b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1e10:	cd 40                	int    $0x40
+    1e12:	c3                   	ret
+
+00001e13 <exit>:
+SYSCALL(exit)
+    1e13:	b8 02 00 00 00       	mov    $0x2,%eax
+    1e18:	cd 40                	int    $0x40
+    1e1a:	c3                   	ret
+
+00001e1b <wait>:
+SYSCALL(wait)
+    1e1b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1e20:	cd 40                	int    $0x40
+    1e22:	c3                   	ret
+
+00001e23 <pipe>:
+SYSCALL(pipe)
+    1e23:	b8 04 00 00 00       	mov    $0x4,%eax
+    1e28:	cd 40                	int    $0x40
+    1e2a:	c3                   	ret
+
+00001e2b <read>:
+SYSCALL(read)
+    1e2b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1e30:	cd 40                	int    $0x40
+    1e32:	c3                   	ret
+
+00001e33 <write>:
+SYSCALL(write)
+    1e33:	b8 10 00 00 00       	mov    $0x10,%eax
+    1e38:	cd 40                	int    $0x40
+    1e3a:	c3                   	ret
+
+00001e3b <close>:
+SYSCALL(close)
+    1e3b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1e40:	cd 40                	int    $0x40
+    1e42:	c3                   	ret
+
+00001e43 <kill>:
+SYSCALL(kill)
+    1e43:	b8 06 00 00 00       	mov    $0x6,%eax
+    1e48:	cd 40                	int    $0x40
+    1e4a:	c3                   	ret
+
+00001e4b <exec>:
+SYSCALL(exec)
+    1e4b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1e50:	cd 40                	int    $0x40
+    1e52:	c3                   	ret
+
+00001e53 <open>:
+SYSCALL(open)
+    1e53:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1e58:	cd 40                	int    $0x40
+    1e5a:	c3                   	ret
+
+00001e5b <mknod>:
+SYSCALL(mknod)
+    1e5b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1e60:	cd 40                	int    $0x40
+    1e62:	c3                   	ret
+
+00001e63 <unlink>:
+SYSCALL(unlink)
+    1e63:	b8 12 00 00 00       	mov    $0x12,%eax
+    1e68:	cd 40                	int    $0x40
+    1e6a:	c3                   	ret
+
+00001e6b <fstat>:
+SYSCALL(fstat)
+    1e6b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1e70:	cd 40                	int    $0x40
+    1e72:	c3                   	ret
+
+00001e73 <link>:
+SYSCALL(link)
+    1e73:	b8 13 00 00 00       	mov    $0x13,%eax
+    1e78:	cd 40                	int    $0x40
+    1e7a:	c3                   	ret
+
+00001e7b <mkdir>:
+SYSCALL(mkdir)
+    1e7b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1e80:	cd 40                	int    $0x40
+    1e82:	c3                   	ret
+
+00001e83 <chdir>:
+SYSCALL(chdir)
+    1e83:	b8 09 00 00 00       	mov    $0x9,%eax
+    1e88:	cd 40                	int    $0x40
+    1e8a:	c3                   	ret
+
+00001e8b <dup>:
+SYSCALL(dup)
+    1e8b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1e90:	cd 40                	int    $0x40
+    1e92:	c3                   	ret
+
+00001e93 <getpid>:
+SYSCALL(getpid)
+    1e93:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1e98:	cd 40                	int    $0x40
+    1e9a:	c3                   	ret
+
+00001e9b <sbrk>:
+SYSCALL(sbrk)
+    1e9b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1ea0:	cd 40                	int    $0x40
+    1ea2:	c3                   	ret
+
+00001ea3 <sleep>:
+SYSCALL(sleep)
+    1ea3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1ea8:	cd 40                	int    $0x40
+    1eaa:	c3                   	ret
+
+00001eab <uptime>:
+SYSCALL(uptime)
+    1eab:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1eb0:	cd 40                	int    $0x40
+    1eb2:	c3                   	ret
+
+00001eb3 <settickets>:
+SYSCALL(settickets)
+    1eb3:	b8 16 00 00 00       	mov    $0x16,%eax
+    1eb8:	cd 40                	int    $0x40
+    1eba:	c3                   	ret
+
+00001ebb <getpinfo>:
+SYSCALL(getpinfo)
+    1ebb:	b8 17 00 00 00       	mov    $0x17,%eax
+    1ec0:	cd 40                	int    $0x40
+    1ec2:	c3                   	ret
+
+00001ec3 <mprotect>:
+SYSCALL(mprotect)
+    1ec3:	b8 18 00 00 00       	mov    $0x18,%eax
+    1ec8:	cd 40                	int    $0x40
+    1eca:	c3                   	ret
+
+00001ecb <munprotect>:
+SYSCALL(munprotect)
+    1ecb:	b8 19 00 00 00       	mov    $0x19,%eax
+    1ed0:	cd 40                	int    $0x40
+    1ed2:	c3                   	ret
+
+00001ed3 <clone>:
+SYSCALL(clone)
+    1ed3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1ed8:	cd 40                	int    $0x40
+    1eda:	c3                   	ret
+
+00001edb <join>:
+SYSCALL(join)
+    1edb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1ee0:	cd 40                	int    $0x40
+    1ee2:	c3                   	ret
+
+00001ee3 <initlock_t>:
+SYSCALL(initlock_t)
+    1ee3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1ee8:	cd 40                	int    $0x40
+    1eea:	c3                   	ret
+
+00001eeb <acquire_t>:
+SYSCALL(acquire_t)
+    1eeb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1ef0:	cd 40                	int    $0x40
+    1ef2:	c3                   	ret
+
+00001ef3 <release_t>:
+SYSCALL(release_t)
+    1ef3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1ef8:	cd 40                	int    $0x40
+    1efa:	c3                   	ret
+
+00001efb <setsched>:
+SYSCALL(setsched)
+    1efb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1f00:	cd 40                	int    $0x40
+    1f02:	c3                   	ret
+
+00001f03 <mkgroup>:
+SYSCALL(mkgroup)
+    1f03:	b8 20 00 00 00       	mov    $0x20,%eax
+    1f08:	cd 40                	int    $0x40
+    1f0a:	c3                   	ret
+
+00001f0b <joingroup>:
+SYSCALL(joingroup)
+    1f0b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1f10:	cd 40                	int    $0x40
+    1f12:	c3                   	ret
+
+00001f13 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1f13:	b8 22 00 00 00       	mov    $0x22,%eax
+    1f18:	cd 40                	int    $0x40
+    1f1a:	c3                   	ret
+
+00001f1b <setdeadline>:
+SYSCALL(setdeadline)
+    1f1b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1f20:	cd 40                	int    $0x40
+    1f22:	c3                   	ret
+
+00001f23 <setaffinity>:
+SYSCALL(setaffinity)
+    1f23:	b8 24 00 00 00       	mov    $0x24,%eax
+    1f28:	cd 40                	int    $0x40
+    1f2a:	c3                   	ret
+
+00001f2b <yield_to>:
+SYSCALL(yield_to)
+    1f2b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1f30:	cd 40                	int    $0x40
+    1f32:	c3                   	ret
+
+00001f33 <getlatency>:
+SYSCALL(getlatency)
+    1f33:	b8 26 00 00 00       	mov    $0x26,%eax
+    1f38:	cd 40                	int    $0x40
+    1f3a:	c3                   	ret
+
+00001f3b <futex_wait>:
+SYSCALL(futex_wait)
+    1f3b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1f40:	cd 40                	int    $0x40
+    1f42:	c3                   	ret
+
+00001f43 <futex_wake>:
+SYSCALL(futex_wake)
+    1f43:	b8 28 00 00 00       	mov    $0x28,%eax
+    1f48:	cd 40                	int    $0x40
+    1f4a:	c3                   	ret
+
+00001f4b <mguard>:
+SYSCALL(mguard)
+    1f4b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1f50:	cd 40                	int    $0x40
+    1f52:	c3                   	ret
+
+00001f53 <join_any>:
+SYSCALL(join_any)
+    1f53:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1f58:	cd 40                	int    $0x40
+    1f5a:	c3                   	ret
+    1f5b:	66 90                	xchg   %ax,%ax
+    1f5d:	66 90                	xchg   %ax,%ax
+    1f5f:	90                   	nop
+
+00001f60 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1f60:	55                   	push   %ebp
+    1f61:	89 e5                	mov    %esp,%ebp
+    1f63:	57                   	push   %edi
+    1f64:	56                   	push   %esi
+    1f65:	53                   	push   %ebx
+    1f66:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1f68:	89 d1                	mov    %edx,%ecx
+{
+    1f6a:	83 ec 3c             	sub    $0x3c,%esp
+    1f6d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1f70:	85 d2                	test   %edx,%edx
+    1f72:	0f 89 80 00 00 00    	jns    1ff8 <printint+0x98>
+    1f78:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    1f7c:	74 7a                	je     1ff8 <printint+0x98>
+    x = -xx;
+    1f7e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1f80:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1f85:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1f88:	31 f6                	xor    %esi,%esi
+    1f8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1f90:	89 c8                	mov    %ecx,%eax
+    1f92:	31 d2                	xor    %edx,%edx
+    1f94:	89 f7                	mov    %esi,%edi
+    1f96:	f7 f3                	div    %ebx
+    1f98:	8d 76 01             	lea    0x1(%esi),%esi
+    1f9b:	0f b6 92 70 24 00 00 	movzbl 0x2470(%edx),%edx
+    1fa2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1fa6:	89 ca                	mov    %ecx,%edx
+    1fa8:	89 c1                	mov    %eax,%ecx
+    1faa:	39 da                	cmp    %ebx,%edx
+    1fac:	73 e2                	jae    1f90 <printint+0x30>
+  if(neg)
+    1fae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1fb1:	85 c0                	test   %eax,%eax
+    1fb3:	74 07                	je     1fbc <printint+0x5c>
+    buf[i++] = '-';
+    1fb5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    1fba:	89 f7                	mov    %esi,%edi
+    1fbc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1fbf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1fc2:	01 df                	add    %ebx,%edi
+    1fc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1fc8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    1fcb:	83 ec 04             	sub    $0x4,%esp
+    1fce:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1fd1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1fd4:	6a 01                	push   $0x1
+    1fd6:	50                   	push   %eax
+    1fd7:	56                   	push   %esi
+    1fd8:	e8 56 fe ff ff       	call   1e33 <write>
+  while(--i >= 0)
+    1fdd:	89 f8                	mov    %edi,%eax
+    1fdf:	83 c4 10             	add    $0x10,%esp
+    1fe2:	83 ef 01             	sub    $0x1,%edi
+    1fe5:	39 d8                	cmp    %ebx,%eax
+    1fe7:	75 df                	jne    1fc8 <printint+0x68>
+}
+    1fe9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1fec:	5b                   	pop    %ebx
+    1fed:	5e                   	pop    %esi
+    1fee:	5f                   	pop    %edi
+    1fef:	5d                   	pop    %ebp
+    1ff0:	c3                   	ret
+    1ff1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1ff8:	31 c0                	xor    %eax,%eax
+    1ffa:	eb 89                	jmp    1f85 <printint+0x25>
+    1ffc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002000 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    2000:	55                   	push   %ebp
+    2001:	89 e5                	mov    %esp,%ebp
+    2003:	57                   	push   %edi
+    2004:	56                   	push   %esi
+    2005:	53                   	push   %ebx
+    2006:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    2009:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    200c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    200f:	0f b6 1e             	movzbl (%esi),%ebx
+    2012:	83 c6 01             	add    $0x1,%esi
+    2015:	84 db                	test   %bl,%bl
+    2017:	74 67                	je     2080 <printf+0x80>
+    2019:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    201c:	31 d2                	xor    %edx,%edx
+    201e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    2021:	eb 34                	jmp    2057 <printf+0x57>
+    2023:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2027:	90                   	nop
+    2028:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    202b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    2030:	83 f8 25             	cmp    $0x25,%eax
+    2033:	74 18                	je     204d <printf+0x4d>
+  write(fd, &c, 1);
+    2035:	83 ec 04             	sub    $0x4,%esp
+    2038:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    203b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    203e:	6a 01                	push   $0x1
+    2040:	50                   	push   %eax
+    2041:	57                   	push   %edi
+    2042:	e8 ec fd ff ff       	call   1e33 <write>
+    2047:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    204a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    204d:	0f b6 1e             	movzbl (%esi),%ebx
+    2050:	83 c6 01             	add    $0x1,%esi
+    2053:	84 db                	test   %bl,%bl
+    2055:	74 29                	je     2080 <printf+0x80>
+    c = fmt[i] & 0xff;
+    2057:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    205a:	85 d2                	test   %edx,%edx
+    205c:	74 ca                	je     2028 <printf+0x28>
+      }
+    } else if(state == '%'){
+    205e:	83 fa 25             	cmp    $0x25,%edx
+    2061:	75 ea                	jne    204d <printf+0x4d>
+      if(c == 'd'){
+    2063:	83 f8 25             	cmp    $0x25,%eax
+    2066:	0f 84 24 01 00 00    	je     2190 <printf+0x190>
+    206c:	83 e8 63             	sub    $0x63,%eax
+    206f:	83 f8 15             	cmp    $0x15,%eax
+    2072:	77 1c                	ja     2090 <printf+0x90>
+    2074:	ff 24 85 18 24 00 00 	jmp    *0x2418(,%eax,4)
+    207b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    207f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    2080:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2083:	5b                   	pop    %ebx
+    2084:	5e                   	pop    %esi
+    2085:	5f                   	pop    %edi
+    2086:	5d                   	pop    %ebp
+    2087:	c3                   	ret
+    2088:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    208f:	90                   	nop
+  write(fd, &c, 1);
+    2090:	83 ec 04             	sub    $0x4,%esp
+    2093:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    2096:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    209a:	6a 01                	push   $0x1
+    209c:	52                   	push   %edx
+    209d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    20a0:	57                   	push   %edi
+    20a1:	e8 8d fd ff ff       	call   1e33 <write>
+    20a6:	83 c4 0c             	add    $0xc,%esp
+    20a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    20ac:	6a 01                	push   $0x1
+    20ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    20b1:	52                   	push   %edx
+    20b2:	57                   	push   %edi
+    20b3:	e8 7b fd ff ff       	call   1e33 <write>
+        putc(fd, c);
+    20b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    20bb:	31 d2                	xor    %edx,%edx
+    20bd:	eb 8e                	jmp    204d <printf+0x4d>
+    20bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    20c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    20c3:	83 ec 0c             	sub    $0xc,%esp
+    20c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    20cb:	8b 13                	mov    (%ebx),%edx
+    20cd:	6a 00                	push   $0x0
+    20cf:	89 f8                	mov    %edi,%eax
+        ap++;
+    20d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    20d4:	e8 87 fe ff ff       	call   1f60 <printint>
+        ap++;
+    20d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    20dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    20df:	31 d2                	xor    %edx,%edx
+    20e1:	e9 67 ff ff ff       	jmp    204d <printf+0x4d>
+    20e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    20f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    20f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    20f5:	83 c0 04             	add    $0x4,%eax
+    20f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    20fb:	85 db                	test   %ebx,%ebx
+    20fd:	0f 84 9d 00 00 00    	je     21a0 <printf+0x1a0>
+        while(*s != 0){
+    2103:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    2106:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    2108:	84 c0                	test   %al,%al
+    210a:	0f 84 3d ff ff ff    	je     204d <printf+0x4d>
+    2110:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    2113:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    2116:	89 de                	mov    %ebx,%esi
+    2118:	89 d3                	mov    %edx,%ebx
+    211a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    2120:	83 ec 04             	sub    $0x4,%esp
+    2123:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    2126:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    2129:	6a 01                	push   $0x1
+    212b:	53                   	push   %ebx
+    212c:	57                   	push   %edi
+    212d:	e8 01 fd ff ff       	call   1e33 <write>
+        while(*s != 0){
+    2132:	0f b6 06             	movzbl (%esi),%eax
+    2135:	83 c4 10             	add    $0x10,%esp
+    2138:	84 c0                	test   %al,%al
+    213a:	75 e4                	jne    2120 <printf+0x120>
+      state = 0;
+    213c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    213f:	31 d2                	xor    %edx,%edx
+    2141:	e9 07 ff ff ff       	jmp    204d <printf+0x4d>
+    2146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    214d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    2150:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    2153:	83 ec 0c             	sub    $0xc,%esp
+    2156:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    215b:	8b 13                	mov    (%ebx),%edx
+    215d:	6a 01                	push   $0x1
+    215f:	e9 6b ff ff ff       	jmp    20cf <printf+0xcf>
+    2164:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    2168:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    216b:	83 ec 04             	sub    $0x4,%esp
+    216e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    2171:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    2173:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    2176:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    2179:	6a 01                	push   $0x1
+    217b:	52                   	push   %edx
+    217c:	57                   	push   %edi
+    217d:	e8 b1 fc ff ff       	call   1e33 <write>
+        ap++;
+    2182:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    2185:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    2188:	31 d2                	xor    %edx,%edx
+    218a:	e9 be fe ff ff       	jmp    204d <printf+0x4d>
+    218f:	90                   	nop
+  write(fd, &c, 1);
+    2190:	83 ec 04             	sub    $0x4,%esp
+    2193:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    2196:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    2199:	6a 01                	push   $0x1
+    219b:	e9 11 ff ff ff       	jmp    20b1 <printf+0xb1>
+    21a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    21a5:	bb 10 24 00 00       	mov    $0x2410,%ebx
+    21aa:	e9 61 ff ff ff       	jmp    2110 <printf+0x110>
+    21af:	90                   	nop
+
+000021b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    21b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    21b1:	a1 a4 2a 00 00       	mov    0x2aa4,%eax
+{
+    21b6:	89 e5                	mov    %esp,%ebp
+    21b8:	57                   	push   %edi
+    21b9:	56                   	push   %esi
+    21ba:	53                   	push   %ebx
+    21bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    21be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    21c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    21ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    21cc:	39 ca                	cmp    %ecx,%edx
+    21ce:	73 30                	jae    2200 <free+0x50>
+    21d0:	39 c1                	cmp    %eax,%ecx
+    21d2:	72 04                	jb     21d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    21d4:	39 c2                	cmp    %eax,%edx
+    21d6:	72 f0                	jb     21c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    21d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    21db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    21de:	39 f8                	cmp    %edi,%eax
+    21e0:	74 2e                	je     2210 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    21e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    21e5:	8b 42 04             	mov    0x4(%edx),%eax
+    21e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    21eb:	39 f1                	cmp    %esi,%ecx
+    21ed:	74 38                	je     2227 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    21ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    21f1:	5b                   	pop    %ebx
+  freep = p;
+    21f2:	89 15 a4 2a 00 00    	mov    %edx,0x2aa4
+}
+    21f8:	5e                   	pop    %esi
+    21f9:	5f                   	pop    %edi
+    21fa:	5d                   	pop    %ebp
+    21fb:	c3                   	ret
+    21fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2200:	39 c1                	cmp    %eax,%ecx
+    2202:	72 d0                	jb     21d4 <free+0x24>
+    2204:	eb c2                	jmp    21c8 <free+0x18>
+    2206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    220d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2210:	03 70 04             	add    0x4(%eax),%esi
+    2213:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2216:	8b 02                	mov    (%edx),%eax
+    2218:	8b 00                	mov    (%eax),%eax
+    221a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    221d:	8b 42 04             	mov    0x4(%edx),%eax
+    2220:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2223:	39 f1                	cmp    %esi,%ecx
+    2225:	75 c8                	jne    21ef <free+0x3f>
+    p->s.size += bp->s.size;
+    2227:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    222a:	89 15 a4 2a 00 00    	mov    %edx,0x2aa4
+    p->s.size += bp->s.size;
+    2230:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2233:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2236:	89 0a                	mov    %ecx,(%edx)
+}
+    2238:	5b                   	pop    %ebx
+    2239:	5e                   	pop    %esi
+    223a:	5f                   	pop    %edi
+    223b:	5d                   	pop    %ebp
+    223c:	c3                   	ret
+    223d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002240 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2240:	55                   	push   %ebp
+    2241:	89 e5                	mov    %esp,%ebp
+    2243:	57                   	push   %edi
+    2244:	56                   	push   %esi
+    2245:	53                   	push   %ebx
+    2246:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2249:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    224c:	8b 15 a4 2a 00 00    	mov    0x2aa4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2252:	8d 78 07             	lea    0x7(%eax),%edi
+    2255:	c1 ef 03             	shr    $0x3,%edi
+    2258:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    225b:	85 d2                	test   %edx,%edx
+    225d:	0f 84 8d 00 00 00    	je     22f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2263:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2265:	8b 48 04             	mov    0x4(%eax),%ecx
+    2268:	39 f9                	cmp    %edi,%ecx
+    226a:	73 64                	jae    22d0 <malloc+0x90>
+  if(nu < 4096)
+    226c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2271:	39 df                	cmp    %ebx,%edi
+    2273:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2276:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    227d:	eb 0a                	jmp    2289 <malloc+0x49>
+    227f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2280:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2282:	8b 48 04             	mov    0x4(%eax),%ecx
+    2285:	39 f9                	cmp    %edi,%ecx
+    2287:	73 47                	jae    22d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2289:	89 c2                	mov    %eax,%edx
+    228b:	39 05 a4 2a 00 00    	cmp    %eax,0x2aa4
+    2291:	75 ed                	jne    2280 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2293:	83 ec 0c             	sub    $0xc,%esp
+    2296:	56                   	push   %esi
+    2297:	e8 ff fb ff ff       	call   1e9b <sbrk>
+  if(p == (char*)-1)
+    229c:	83 c4 10             	add    $0x10,%esp
+    229f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    22a2:	74 1c                	je     22c0 <malloc+0x80>
+  hp->s.size = nu;
+    22a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    22a7:	83 ec 0c             	sub    $0xc,%esp
+    22aa:	83 c0 08             	add    $0x8,%eax
+    22ad:	50                   	push   %eax
+    22ae:	e8 fd fe ff ff       	call   21b0 <free>
+  return freep;
+    22b3:	8b 15 a4 2a 00 00    	mov    0x2aa4,%edx
+      if((p = morecore(nunits)) == 0)
+    22b9:	83 c4 10             	add    $0x10,%esp
+    22bc:	85 d2                	test   %edx,%edx
+    22be:	75 c0                	jne    2280 <malloc+0x40>
+        return 0;
+  }
+}
+    22c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    22c3:	31 c0                	xor    %eax,%eax
+}
+    22c5:	5b                   	pop    %ebx
+    22c6:	5e                   	pop    %esi
+    22c7:	5f                   	pop    %edi
+    22c8:	5d                   	pop    %ebp
+    22c9:	c3                   	ret
+    22ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    22d0:	39 cf                	cmp    %ecx,%edi
+    22d2:	74 4c                	je     2320 <malloc+0xe0>
+        p->s.size -= nunits;
+    22d4:	29 f9                	sub    %edi,%ecx
+    22d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    22d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    22dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    22df:	89 15 a4 2a 00 00    	mov    %edx,0x2aa4
+}
+    22e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    22e8:	83 c0 08             	add    $0x8,%eax
+}
+    22eb:	5b                   	pop    %ebx
+    22ec:	5e                   	pop    %esi
+    22ed:	5f                   	pop    %edi
+    22ee:	5d                   	pop    %ebp
+    22ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    22f0:	c7 05 a4 2a 00 00 a8 	movl   $0x2aa8,0x2aa4
+    22f7:	2a 00 00 
+    base.s.size = 0;
+    22fa:	b8 a8 2a 00 00       	mov    $0x2aa8,%eax
+    base.s.ptr = freep = prevp = &base;
+    22ff:	c7 05 a8 2a 00 00 a8 	movl   $0x2aa8,0x2aa8
+    2306:	2a 00 00 
+    base.s.size = 0;
+    2309:	c7 05 ac 2a 00 00 00 	movl   $0x0,0x2aac
+    2310:	00 00 00 
+    if(p->s.size >= nunits){
+    2313:	e9 54 ff ff ff       	jmp    226c <malloc+0x2c>
+    2318:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    231f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2320:	8b 08                	mov    (%eax),%ecx
+    2322:	89 0a                	mov    %ecx,(%edx)
+    2324:	eb b9                	jmp    22df <malloc+0x9f>
@@ -37,7 +37,7 @@ releasesleep(struct sleeplock *lk)
   acquire(&lk->lk);
   lk->locked = 0;
   lk->pid = 0;
-  wakeup(lk);
+  wakeone(lk);  // only one waiter can take the lock
   release(&lk->lk);
 }
 
@@ -0,0 +1,1334 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+    1007:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+    100c:	ff 71 fc             	push   -0x4(%ecx)
+    100f:	55                   	push   %ebp
+    1010:	89 e5                	mov    %esp,%ebp
+    1012:	57                   	push   %edi
+    1013:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+    1014:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+    101a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+    101b:	31 db                	xor    %ebx,%ebx
+{
+    101d:	51                   	push   %ecx
+    101e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+    1024:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+    102b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+    1032:	74 72 65 
+    1035:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+    103c:	73 66 73 
+  printf(1, "stressfs starting\n");
+    103f:	68 78 18 00 00       	push   $0x1878
+    1044:	6a 01                	push   $0x1
+    1046:	e8 05 05 00 00       	call   1550 <printf>
+  memset(data, 'a', sizeof(data));
+    104b:	83 c4 0c             	add    $0xc,%esp
+    104e:	68 00 02 00 00       	push   $0x200
+    1053:	6a 61                	push   $0x61
+    1055:	56                   	push   %esi
+    1056:	e8 85 01 00 00       	call   11e0 <memset>
+    105b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+    105e:	e8 f8 02 00 00       	call   135b <fork>
+    1063:	85 c0                	test   %eax,%eax
+    1065:	7f 08                	jg     106f <main+0x6f>
+  for(i = 0; i < 4; i++)
+    1067:	83 c3 01             	add    $0x1,%ebx
+    106a:	83 fb 04             	cmp    $0x4,%ebx
+    106d:	75 ef                	jne    105e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+    106f:	83 ec 04             	sub    $0x4,%esp
+    1072:	53                   	push   %ebx
+    1073:	68 8b 18 00 00       	push   $0x188b
+    1078:	6a 01                	push   $0x1
+    107a:	e8 d1 04 00 00       	call   1550 <printf>
+
+  path[8] += i;
+    107f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+    1085:	5f                   	pop    %edi
+    1086:	bb 14 00 00 00       	mov    $0x14,%ebx
+    108b:	58                   	pop    %eax
+    108c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+    1092:	68 02 02 00 00       	push   $0x202
+    1097:	50                   	push   %eax
+    1098:	e8 06 03 00 00       	call   13a3 <open>
+    109d:	83 c4 10             	add    $0x10,%esp
+    10a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+    10a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+    10a8:	83 ec 04             	sub    $0x4,%esp
+    10ab:	68 00 02 00 00       	push   $0x200
+    10b0:	56                   	push   %esi
+    10b1:	57                   	push   %edi
+    10b2:	e8 cc 02 00 00       	call   1383 <write>
+  for(i = 0; i < 20; i++)
+    10b7:	83 c4 10             	add    $0x10,%esp
+    10ba:	83 eb 01             	sub    $0x1,%ebx
+    10bd:	75 e9                	jne    10a8 <main+0xa8>
+  close(fd);
+    10bf:	83 ec 0c             	sub    $0xc,%esp
+    10c2:	57                   	push   %edi
+    10c3:	e8 c3 02 00 00       	call   138b <close>
+
+  printf(1, "read\n");
+    10c8:	58                   	pop    %eax
+    10c9:	5a                   	pop    %edx
+    10ca:	68 95 18 00 00       	push   $0x1895
+    10cf:	6a 01                	push   $0x1
+    10d1:	e8 7a 04 00 00       	call   1550 <printf>
+
+  fd = open(path, O_RDONLY);
+    10d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+    10dc:	59                   	pop    %ecx
+    10dd:	5b                   	pop    %ebx
+    10de:	6a 00                	push   $0x0
+    10e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+    10e5:	50                   	push   %eax
+    10e6:	e8 b8 02 00 00       	call   13a3 <open>
+    10eb:	83 c4 10             	add    $0x10,%esp
+    10ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+    10f0:	83 ec 04             	sub    $0x4,%esp
+    10f3:	68 00 02 00 00       	push   $0x200
+    10f8:	56                   	push   %esi
+    10f9:	57                   	push   %edi
+    10fa:	e8 7c 02 00 00       	call   137b <read>
+  for (i = 0; i < 20; i++)
+    10ff:	83 c4 10             	add    $0x10,%esp
+    1102:	83 eb 01             	sub    $0x1,%ebx
+    1105:	75 e9                	jne    10f0 <main+0xf0>
+  close(fd);
+    1107:	83 ec 0c             	sub    $0xc,%esp
+    110a:	57                   	push   %edi
+    110b:	e8 7b 02 00 00       	call   138b <close>
+
+  wait();
+    1110:	e8 56 02 00 00       	call   136b <wait>
+
+  exit();
+    1115:	e8 49 02 00 00       	call   1363 <exit>
+    111a:	66 90                	xchg   %ax,%ax
+    111c:	66 90                	xchg   %ax,%ax
+    111e:	66 90                	xchg   %ax,%ax
+
+00001120 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1121:	31 c0                	xor    %eax,%eax
+{
+    1123:	89 e5                	mov    %esp,%ebp
+    1125:	53                   	push   %ebx
+    1126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    112c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1137:	83 c0 01             	add    $0x1,%eax
+    113a:	84 d2                	test   %dl,%dl
+    113c:	75 f2                	jne    1130 <strcpy+0x10>
+    ;
+  return os;
+}
+    113e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1141:	89 c8                	mov    %ecx,%eax
+    1143:	c9                   	leave
+    1144:	c3                   	ret
+    1145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	53                   	push   %ebx
+    1154:	8b 55 08             	mov    0x8(%ebp),%edx
+    1157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    115a:	0f b6 02             	movzbl (%edx),%eax
+    115d:	84 c0                	test   %al,%al
+    115f:	75 17                	jne    1178 <strcmp+0x28>
+    1161:	eb 3a                	jmp    119d <strcmp+0x4d>
+    1163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1167:	90                   	nop
+    1168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    116c:	83 c2 01             	add    $0x1,%edx
+    116f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1172:	84 c0                	test   %al,%al
+    1174:	74 1a                	je     1190 <strcmp+0x40>
+    p++, q++;
+    1176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1178:	0f b6 19             	movzbl (%ecx),%ebx
+    117b:	38 c3                	cmp    %al,%bl
+    117d:	74 e9                	je     1168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    117f:	29 d8                	sub    %ebx,%eax
+}
+    1181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1184:	c9                   	leave
+    1185:	c3                   	ret
+    1186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1194:	31 c0                	xor    %eax,%eax
+    1196:	29 d8                	sub    %ebx,%eax
+}
+    1198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    119b:	c9                   	leave
+    119c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    119d:	0f b6 19             	movzbl (%ecx),%ebx
+    11a0:	31 c0                	xor    %eax,%eax
+    11a2:	eb db                	jmp    117f <strcmp+0x2f>
+    11a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11af:	90                   	nop
+
+000011b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    11b6:	80 3a 00             	cmpb   $0x0,(%edx)
+    11b9:	74 15                	je     11d0 <strlen+0x20>
+    11bb:	31 c0                	xor    %eax,%eax
+    11bd:	8d 76 00             	lea    0x0(%esi),%esi
+    11c0:	83 c0 01             	add    $0x1,%eax
+    11c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    11c7:	89 c1                	mov    %eax,%ecx
+    11c9:	75 f5                	jne    11c0 <strlen+0x10>
+    ;
+  return n;
+}
+    11cb:	89 c8                	mov    %ecx,%eax
+    11cd:	5d                   	pop    %ebp
+    11ce:	c3                   	ret
+    11cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    11d0:	31 c9                	xor    %ecx,%ecx
+}
+    11d2:	5d                   	pop    %ebp
+    11d3:	89 c8                	mov    %ecx,%eax
+    11d5:	c3                   	ret
+    11d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000011e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	57                   	push   %edi
+    11e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    11e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    11ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11ed:	89 d7                	mov    %edx,%edi
+    11ef:	fc                   	cld
+    11f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    11f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    11f5:	89 d0                	mov    %edx,%eax
+    11f7:	c9                   	leave
+    11f8:	c3                   	ret
+    11f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	8b 45 08             	mov    0x8(%ebp),%eax
+    1206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    120a:	0f b6 10             	movzbl (%eax),%edx
+    120d:	84 d2                	test   %dl,%dl
+    120f:	75 12                	jne    1223 <strchr+0x23>
+    1211:	eb 1d                	jmp    1230 <strchr+0x30>
+    1213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1217:	90                   	nop
+    1218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    121c:	83 c0 01             	add    $0x1,%eax
+    121f:	84 d2                	test   %dl,%dl
+    1221:	74 0d                	je     1230 <strchr+0x30>
+    if(*s == c)
+    1223:	38 d1                	cmp    %dl,%cl
+    1225:	75 f1                	jne    1218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1227:	5d                   	pop    %ebp
+    1228:	c3                   	ret
+    1229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1230:	31 c0                	xor    %eax,%eax
+}
+    1232:	5d                   	pop    %ebp
+    1233:	c3                   	ret
+    1234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    123f:	90                   	nop
+
+00001240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1249:	31 db                	xor    %ebx,%ebx
+{
+    124b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    124e:	eb 27                	jmp    1277 <gets+0x37>
+    cc = read(0, &c, 1);
+    1250:	83 ec 04             	sub    $0x4,%esp
+    1253:	6a 01                	push   $0x1
+    1255:	56                   	push   %esi
+    1256:	6a 00                	push   $0x0
+    1258:	e8 1e 01 00 00       	call   137b <read>
+    if(cc < 1)
+    125d:	83 c4 10             	add    $0x10,%esp
+    1260:	85 c0                	test   %eax,%eax
+    1262:	7e 1d                	jle    1281 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1268:	8b 55 08             	mov    0x8(%ebp),%edx
+    126b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    126f:	3c 0a                	cmp    $0xa,%al
+    1271:	74 10                	je     1283 <gets+0x43>
+    1273:	3c 0d                	cmp    $0xd,%al
+    1275:	74 0c                	je     1283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1277:	89 df                	mov    %ebx,%edi
+    1279:	83 c3 01             	add    $0x1,%ebx
+    127c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    127f:	7c cf                	jl     1250 <gets+0x10>
+    1281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1283:	8b 45 08             	mov    0x8(%ebp),%eax
+    1286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    128a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    128d:	5b                   	pop    %ebx
+    128e:	5e                   	pop    %esi
+    128f:	5f                   	pop    %edi
+    1290:	5d                   	pop    %ebp
+    1291:	c3                   	ret
+    1292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000012a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    12a0:	55                   	push   %ebp
+    12a1:	89 e5                	mov    %esp,%ebp
+    12a3:	56                   	push   %esi
+    12a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    12a5:	83 ec 08             	sub    $0x8,%esp
+    12a8:	6a 00                	push   $0x0
+    12aa:	ff 75 08             	push   0x8(%ebp)
+    12ad:	e8 f1 00 00 00       	call   13a3 <open>
+  if(fd < 0)
+    12b2:	83 c4 10             	add    $0x10,%esp
+    12b5:	85 c0                	test   %eax,%eax
+    12b7:	78 27                	js     12e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    12b9:	83 ec 08             	sub    $0x8,%esp
+    12bc:	ff 75 0c             	push   0xc(%ebp)
+    12bf:	89 c3                	mov    %eax,%ebx
+    12c1:	50                   	push   %eax
+    12c2:	e8 f4 00 00 00       	call   13bb <fstat>
+  close(fd);
+    12c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    12ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+    12cc:	e8 ba 00 00 00       	call   138b <close>
+  return r;
+    12d1:	83 c4 10             	add    $0x10,%esp
+}
+    12d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12d7:	89 f0                	mov    %esi,%eax
+    12d9:	5b                   	pop    %ebx
+    12da:	5e                   	pop    %esi
+    12db:	5d                   	pop    %ebp
+    12dc:	c3                   	ret
+    12dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    12e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    12e5:	eb ed                	jmp    12d4 <stat+0x34>
+    12e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ee:	66 90                	xchg   %ax,%ax
+
+000012f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    12f0:	55                   	push   %ebp
+    12f1:	89 e5                	mov    %esp,%ebp
+    12f3:	53                   	push   %ebx
+    12f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    12f7:	0f be 02             	movsbl (%edx),%eax
+    12fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    12fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1305:	77 1e                	ja     1325 <atoi+0x35>
+    1307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1310:	83 c2 01             	add    $0x1,%edx
+    1313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    131a:	0f be 02             	movsbl (%edx),%eax
+    131d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1320:	80 fb 09             	cmp    $0x9,%bl
+    1323:	76 eb                	jbe    1310 <atoi+0x20>
+  return n;
+}
+    1325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1328:	89 c8                	mov    %ecx,%eax
+    132a:	c9                   	leave
+    132b:	c3                   	ret
+    132c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001330 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1330:	55                   	push   %ebp
+    1331:	89 e5                	mov    %esp,%ebp
+    1333:	57                   	push   %edi
+    1334:	56                   	push   %esi
+    1335:	8b 45 10             	mov    0x10(%ebp),%eax
+    1338:	8b 55 08             	mov    0x8(%ebp),%edx
+    133b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    133e:	85 c0                	test   %eax,%eax
+    1340:	7e 13                	jle    1355 <memmove+0x25>
+    1342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1344:	89 d7                	mov    %edx,%edi
+    1346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1351:	39 f8                	cmp    %edi,%eax
+    1353:	75 fb                	jne    1350 <memmove+0x20>
+  return vdst;
+}
+    1355:	5e                   	pop    %esi
+    1356:	89 d0                	mov    %edx,%eax
+    1358:	5f                   	pop    %edi
+    1359:	5d                   	pop    %ebp
+    135a:	c3                   	ret
+
+0000135b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    135b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1360:	cd 40                	int    $0x40
+    1362:	c3                   	ret
+
+00001363 <exit>:
+SYSCALL(exit)
+    1363:	b8 02 00 00 00       	mov    $0x2,%eax
+    1368:	cd 40                	int    $0x40
+    136a:	c3                   	ret
+
+0000136b <wait>:
+SYSCALL(wait)
+    136b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1370:	cd 40                	int    $0x40
+    1372:	c3                   	ret
+
+00001373 <pipe>:
+SYSCALL(pipe)
+    1373:	b8 04 00 00 00       	mov    $0x4,%eax
+    1378:	cd 40                	int    $0x40
+    137a:	c3                   	ret
+
+0000137b <read>:
+SYSCALL(read)
+    137b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1380:	cd 40                	int    $0x40
+    1382:	c3                   	ret
+
+00001383 <write>:
+SYSCALL(write)
+    1383:	b8 10 00 00 00       	mov    $0x10,%eax
+    1388:	cd 40                	int    $0x40
+    138a:	c3                   	ret
+
+0000138b <close>:
+SYSCALL(close)
+    138b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1390:	cd 40                	int    $0x40
+    1392:	c3                   	ret
+
+00001393 <kill>:
+SYSCALL(kill)
+    1393:	b8 06 00 00 00       	mov    $0x6,%eax
+    1398:	cd 40                	int    $0x40
+    139a:	c3                   	ret
+
+0000139b <exec>:
+SYSCALL(exec)
+    139b:	b8 07 00 00 00       	mov    $0x7,%eax
+    13a0:	cd 40                	int    $0x40
+    13a2:	c3                   	ret
+
+000013a3 <open>:
+SYSCALL(open)
+    13a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    13a8:	cd 40                	int    $0x40
+    13aa:	c3                   	ret
+
+000013ab <mknod>:
+SYSCALL(mknod)
+    13ab:	b8 11 00 00 00       	mov    $0x11,%eax
+    13b0:	cd 40                	int    $0x40
+    13b2:	c3                   	ret
+
+000013b3 <unlink>:
+SYSCALL(unlink)
+    13b3:	b8 12 00 00 00       	mov    $0x12,%eax
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+
+000013bb <fstat>:
+SYSCALL(fstat)
+    13bb:	b8 08 00 00 00       	mov    $0x8,%eax
+    13c0:	cd 40                	int    $0x40
+    13c2:	c3                   	ret
+
+000013c3 <link>:
+SYSCALL(link)
+    13c3:	b8 13 00 00 00       	mov    $0x13,%eax
+    13c8:	cd 40                	int    $0x40
+    13ca:	c3                   	ret
+
+000013cb <mkdir>:
+SYSCALL(mkdir)
+    13cb:	b8 14 00 00 00       	mov    $0x14,%eax
+    13d0:	cd 40                	int    $0x40
+    13d2:	c3                   	ret
+
+000013d3 <chdir>:
+SYSCALL(chdir)
+    13d3:	b8 09 00 00 00       	mov    $0x9,%eax
+    13d8:	cd 40                	int    $0x40
+    13da:	c3                   	ret
+
+000013db <dup>:
+SYSCALL(dup)
+    13db:	b8 0a 00 00 00       	mov    $0xa,%eax
+    13e0:	cd 40                	int    $0x40
+    13e2:	c3                   	ret
+
+000013e3 <getpid>:
+SYSCALL(getpid)
+    13e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+
+000013eb <sbrk>:
+SYSCALL(sbrk)
+    13eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    13f0:	cd 40                	int    $0x40
+    13f2:	c3                   	ret
+
+000013f3 <sleep>:
+SYSCALL(sleep)
+    13f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    13f8:	cd 40                	int    $0x40
+    13fa:	c3                   	ret
+
+000013fb <uptime>:
+SYSCALL(uptime)
+    13fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1400:	cd 40                	int    $0x40
+    1402:	c3                   	ret
+
+00001403 <settickets>:
+SYSCALL(settickets)
+    1403:	b8 16 00 00 00       	mov    $0x16,%eax
+    1408:	cd 40                	int    $0x40
+    140a:	c3                   	ret
+
+0000140b <getpinfo>:
+SYSCALL(getpinfo)
+    140b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1410:	cd 40                	int    $0x40
+    1412:	c3                   	ret
+
+00001413 <mprotect>:
+SYSCALL(mprotect)
+    1413:	b8 18 00 00 00       	mov    $0x18,%eax
+    1418:	cd 40                	int    $0x40
+    141a:	c3                   	ret
+
+0000141b <munprotect>:
+SYSCALL(munprotect)
+    141b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1420:	cd 40                	int    $0x40
+    1422:	c3                   	ret
+
+00001423 <clone>:
+SYSCALL(clone)
+    1423:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1428:	cd 40                	int    $0x40
+    142a:	c3                   	ret
+
+0000142b <join>:
+SYSCALL(join)
+    142b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1430:	cd 40                	int    $0x40
+    1432:	c3                   	ret
+
+00001433 <initlock_t>:
+SYSCALL(initlock_t)
+    1433:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1438:	cd 40                	int    $0x40
+    143a:	c3                   	ret
+
+0000143b <acquire_t>:
+SYSCALL(acquire_t)
+    143b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1440:	cd 40                	int    $0x40
+    1442:	c3                   	ret
+
+00001443 <release_t>:
+SYSCALL(release_t)
+    1443:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1448:	cd 40                	int    $0x40
+    144a:	c3                   	ret
+
+0000144b <setsched>:
+SYSCALL(setsched)
+    144b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1450:	cd 40                	int    $0x40
+    1452:	c3                   	ret
+
+00001453 <mkgroup>:
+SYSCALL(mkgroup)
+    1453:	b8 20 00 00 00       	mov    $0x20,%eax
+    1458:	cd 40                	int    $0x40
+    145a:	c3                   	ret
+
+0000145b <joingroup>:
+SYSCALL(joingroup)
+    145b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1460:	cd 40                	int    $0x40
+    1462:	c3                   	ret
+
+00001463 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1463:	b8 22 00 00 00       	mov    $0x22,%eax
+    1468:	cd 40                	int    $0x40
+    146a:	c3                   	ret
+
+0000146b <setdeadline>:
+SYSCALL(setdeadline)
+    146b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1470:	cd 40                	int    $0x40
+    1472:	c3                   	ret
+
+00001473 <setaffinity>:
+SYSCALL(setaffinity)
+    1473:	b8 24 00 00 00       	mov    $0x24,%eax
+    1478:	cd 40                	int    $0x40
+    147a:	c3                   	ret
+
+0000147b <yield_to>:
+SYSCALL(yield_to)
+    147b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1480:	cd 40                	int    $0x40
+    1482:	c3                   	ret
+
+00001483 <getlatency>:
+SYSCALL(getlatency)
+    1483:	b8 26 00 00 00       	mov    $0x26,%eax
+    1488:	cd 40                	int    $0x40
+    148a:	c3                   	ret
+
+0000148b <futex_wait>:
+SYSCALL(futex_wait)
+    148b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1490:	cd 40                	int    $0x40
+    1492:	c3                   	ret
+
+00001493 <futex_wake>:
+SYSCALL(futex_wake)
+    1493:	b8 28 00 00 00       	mov    $0x28,%eax
+    1498:	cd 40                	int    $0x40
+    149a:	c3                   	ret
+
+0000149b <mguard>:
+SYSCALL(mguard)
+    149b:	b8 29 00 00 00       	mov    $0x29,%eax
+    14a0:	cd 40                	int    $0x40
+    14a2:	c3                   	ret
+
+000014a3 <join_any>:
+SYSCALL(join_any)
+    14a3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    14a8:	cd 40                	int    $0x40
+    14aa:	c3                   	ret
+    14ab:	66 90                	xchg   %ax,%ax
+    14ad:	66 90                	xchg   %ax,%ax
+    14af:	90                   	nop
+
+000014b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    14b0:	55                   	push   %ebp
+    14b1:	89 e5                	mov    %esp,%ebp
+    14b3:	57                   	push   %edi
+    14b4:	56                   	push   %esi
+    14b5:	53                   	push   %ebx
+    14b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    14b8:	89 d1                	mov    %edx,%ecx
+{
+    14ba:	83 ec 3c             	sub    $0x3c,%esp
+    14bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    14c0:	85 d2                	test   %edx,%edx
+    14c2:	0f 89 80 00 00 00    	jns    1548 <printint+0x98>
+    14c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    14cc:	74 7a                	je     1548 <printint+0x98>
+    x = -xx;
+    14ce:	f7 d9                	neg    %ecx
+    neg = 1;
+    14d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    14d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    14d8:	31 f6                	xor    %esi,%esi
+    14da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    14e0:	89 c8                	mov    %ecx,%eax
+    14e2:	31 d2                	xor    %edx,%edx
+    14e4:	89 f7                	mov    %esi,%edi
+    14e6:	f7 f3                	div    %ebx
+    14e8:	8d 76 01             	lea    0x1(%esi),%esi
+    14eb:	0f b6 92 fc 18 00 00 	movzbl 0x18fc(%edx),%edx
+    14f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    14f6:	89 ca                	mov    %ecx,%edx
+    14f8:	89 c1                	mov    %eax,%ecx
+    14fa:	39 da                	cmp    %ebx,%edx
+    14fc:	73 e2                	jae    14e0 <printint+0x30>
+  if(neg)
+    14fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1501:	85 c0                	test   %eax,%eax
+    1503:	74 07                	je     150c <printint+0x5c>
+    buf[i++] = '-';
+    1505:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    150a:	89 f7                	mov    %esi,%edi
+    150c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    150f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1512:	01 df                	add    %ebx,%edi
+    1514:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1518:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    151b:	83 ec 04             	sub    $0x4,%esp
+    151e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1521:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1524:	6a 01                	push   $0x1
+    1526:	50                   	push   %eax
+    1527:	56                   	push   %esi
+    1528:	e8 56 fe ff ff       	call   1383 <write>
+  while(--i >= 0)
+    152d:	89 f8                	mov    %edi,%eax
+    152f:	83 c4 10             	add    $0x10,%esp
+    1532:	83 ef 01             	sub    $0x1,%edi
+    1535:	39 d8                	cmp    %ebx,%eax
+    1537:	75 df                	jne    1518 <printint+0x68>
+}
+    1539:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    153c:	5b                   	pop    %ebx
+    153d:	5e                   	pop    %esi
+    153e:	5f                   	pop    %edi
+    153f:	5d                   	pop    %ebp
+    1540:	c3                   	ret
+    1541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1548:	31 c0                	xor    %eax,%eax
+    154a:	eb 89                	jmp    14d5 <printint+0x25>
+    154c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001550 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1550:	55                   	push   %ebp
+    1551:	89 e5                	mov    %esp,%ebp
+    1553:	57                   	push   %edi
+    1554:	56                   	push   %esi
+    1555:	53                   	push   %ebx
+    1556:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1559:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    155c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    155f:	0f b6 1e             	movzbl (%esi),%ebx
+    1562:	83 c6 01             	add    $0x1,%esi
+    1565:	84 db                	test   %bl,%bl
+    1567:	74 67                	je     15d0 <printf+0x80>
+    1569:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    156c:	31 d2                	xor    %edx,%edx
+    156e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1571:	eb 34                	jmp    15a7 <printf+0x57>
+    1573:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1577:	90                   	nop
+    1578:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    157b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1580:	83 f8 25             	cmp    $0x25,%eax
+    1583:	74 18                	je     159d <printf+0x4d>
+  write(fd, &c, 1);
+    1585:	83 ec 04             	sub    $0x4,%esp
+    1588:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    158b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    158e:	6a 01                	push   $0x1
+    1590:	50                   	push   %eax
+    1591:	57                   	push   %edi
+    1592:	e8 ec fd ff ff       	call   1383 <write>
+    1597:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    159a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    159d:	0f b6 1e             	movzbl (%esi),%ebx
+    15a0:	83 c6 01             	add    $0x1,%esi
+    15a3:	84 db                	test   %bl,%bl
+    15a5:	74 29                	je     15d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    15a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    15aa:	85 d2                	test   %edx,%edx
+    15ac:	74 ca                	je     1578 <printf+0x28>
+      }
+    } else if(state == '%'){
+    15ae:	83 fa 25             	cmp    $0x25,%edx
+    15b1:	75 ea                	jne    159d <printf+0x4d>
+      if(c == 'd'){
+    15b3:	83 f8 25             	cmp    $0x25,%eax
+    15b6:	0f 84 24 01 00 00    	je     16e0 <printf+0x190>
+    15bc:	83 e8 63             	sub    $0x63,%eax
+    15bf:	83 f8 15             	cmp    $0x15,%eax
+    15c2:	77 1c                	ja     15e0 <printf+0x90>
+    15c4:	ff 24 85 a4 18 00 00 	jmp    *0x18a4(,%eax,4)
+    15cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    15d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15d3:	5b                   	pop    %ebx
+    15d4:	5e                   	pop    %esi
+    15d5:	5f                   	pop    %edi
+    15d6:	5d                   	pop    %ebp
+    15d7:	c3                   	ret
+    15d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15df:	90                   	nop
+  write(fd, &c, 1);
+    15e0:	83 ec 04             	sub    $0x4,%esp
+    15e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    15e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    15ea:	6a 01                	push   $0x1
+    15ec:	52                   	push   %edx
+    15ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    15f0:	57                   	push   %edi
+    15f1:	e8 8d fd ff ff       	call   1383 <write>
+    15f6:	83 c4 0c             	add    $0xc,%esp
+    15f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    15fc:	6a 01                	push   $0x1
+    15fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1601:	52                   	push   %edx
+    1602:	57                   	push   %edi
+    1603:	e8 7b fd ff ff       	call   1383 <write>
+        putc(fd, c);
+    1608:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    160b:	31 d2                	xor    %edx,%edx
+    160d:	eb 8e                	jmp    159d <printf+0x4d>
+    160f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1610:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1613:	83 ec 0c             	sub    $0xc,%esp
+    1616:	b9 10 00 00 00       	mov    $0x10,%ecx
+    161b:	8b 13                	mov    (%ebx),%edx
+    161d:	6a 00                	push   $0x0
+    161f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1621:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1624:	e8 87 fe ff ff       	call   14b0 <printint>
+        ap++;
+    1629:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    162c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    162f:	31 d2                	xor    %edx,%edx
+    1631:	e9 67 ff ff ff       	jmp    159d <printf+0x4d>
+    1636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    163d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1640:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1643:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1645:	83 c0 04             	add    $0x4,%eax
+    1648:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    164b:	85 db                	test   %ebx,%ebx
+    164d:	0f 84 9d 00 00 00    	je     16f0 <printf+0x1a0>
+        while(*s != 0){
+    1653:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1656:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1658:	84 c0                	test   %al,%al
+    165a:	0f 84 3d ff ff ff    	je     159d <printf+0x4d>
+    1660:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1663:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1666:	89 de                	mov    %ebx,%esi
+    1668:	89 d3                	mov    %edx,%ebx
+    166a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1670:	83 ec 04             	sub    $0x4,%esp
+    1673:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1676:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1679:	6a 01                	push   $0x1
+    167b:	53                   	push   %ebx
+    167c:	57                   	push   %edi
+    167d:	e8 01 fd ff ff       	call   1383 <write>
+        while(*s != 0){
+    1682:	0f b6 06             	movzbl (%esi),%eax
+    1685:	83 c4 10             	add    $0x10,%esp
+    1688:	84 c0                	test   %al,%al
+    168a:	75 e4                	jne    1670 <printf+0x120>
+      state = 0;
+    168c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    168f:	31 d2                	xor    %edx,%edx
+    1691:	e9 07 ff ff ff       	jmp    159d <printf+0x4d>
+    1696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    169d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    16a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    16a3:	83 ec 0c             	sub    $0xc,%esp
+    16a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    16ab:	8b 13                	mov    (%ebx),%edx
+    16ad:	6a 01                	push   $0x1
+    16af:	e9 6b ff ff ff       	jmp    161f <printf+0xcf>
+    16b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    16b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    16bb:	83 ec 04             	sub    $0x4,%esp
+    16be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    16c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    16c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    16c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    16c9:	6a 01                	push   $0x1
+    16cb:	52                   	push   %edx
+    16cc:	57                   	push   %edi
+    16cd:	e8 b1 fc ff ff       	call   1383 <write>
+        ap++;
+    16d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    16d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    16d8:	31 d2                	xor    %edx,%edx
+    16da:	e9 be fe ff ff       	jmp    159d <printf+0x4d>
+    16df:	90                   	nop
+  write(fd, &c, 1);
+    16e0:	83 ec 04             	sub    $0x4,%esp
+    16e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    16e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    16e9:	6a 01                	push   $0x1
+    16eb:	e9 11 ff ff ff       	jmp    1601 <printf+0xb1>
+    16f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    16f5:	bb 9b 18 00 00       	mov    $0x189b,%ebx
+    16fa:	e9 61 ff ff ff       	jmp    1660 <printf+0x110>
+    16ff:	90                   	nop
+
+00001700 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1700:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1701:	a1 a8 1b 00 00       	mov    0x1ba8,%eax
+{
+    1706:	89 e5                	mov    %esp,%ebp
+    1708:	57                   	push   %edi
+    1709:	56                   	push   %esi
+    170a:	53                   	push   %ebx
+    170b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    170e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1711:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1718:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    171a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    171c:	39 ca                	cmp    %ecx,%edx
+    171e:	73 30                	jae    1750 <free+0x50>
+    1720:	39 c1                	cmp    %eax,%ecx
+    1722:	72 04                	jb     1728 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1724:	39 c2                	cmp    %eax,%edx
+    1726:	72 f0                	jb     1718 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1728:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    172b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    172e:	39 f8                	cmp    %edi,%eax
+    1730:	74 2e                	je     1760 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1732:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1735:	8b 42 04             	mov    0x4(%edx),%eax
+    1738:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    173b:	39 f1                	cmp    %esi,%ecx
+    173d:	74 38                	je     1777 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    173f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1741:	5b                   	pop    %ebx
+  freep = p;
+    1742:	89 15 a8 1b 00 00    	mov    %edx,0x1ba8
+}
+    1748:	5e                   	pop    %esi
+    1749:	5f                   	pop    %edi
+    174a:	5d                   	pop    %ebp
+    174b:	c3                   	ret
+    174c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1750:	39 c1                	cmp    %eax,%ecx
+    1752:	72 d0                	jb     1724 <free+0x24>
+    1754:	eb c2                	jmp    1718 <free+0x18>
+    1756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    175d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1760:	03 70 04             	add    0x4(%eax),%esi
+    1763:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1766:	8b 02                	mov    (%edx),%eax
+    1768:	8b 00                	mov    (%eax),%eax
+    176a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    176d:	8b 42 04             	mov    0x4(%edx),%eax
+    1770:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1773:	39 f1                	cmp    %esi,%ecx
+    1775:	75 c8                	jne    173f <free+0x3f>
+    p->s.size += bp->s.size;
+    1777:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    177a:	89 15 a8 1b 00 00    	mov    %edx,0x1ba8
+    p->s.size += bp->s.size;
+    1780:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1783:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1786:	89 0a                	mov    %ecx,(%edx)
+}
+    1788:	5b                   	pop    %ebx
+    1789:	5e                   	pop    %esi
+    178a:	5f                   	pop    %edi
+    178b:	5d                   	pop    %ebp
+    178c:	c3                   	ret
+    178d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001790 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1790:	55                   	push   %ebp
+    1791:	89 e5                	mov    %esp,%ebp
+    1793:	57                   	push   %edi
+    1794:	56                   	push   %esi
+    1795:	53                   	push   %ebx
+    1796:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1799:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    179c:	8b 15 a8 1b 00 00    	mov    0x1ba8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    17a2:	8d 78 07             	lea    0x7(%eax),%edi
+    17a5:	c1 ef 03             	shr    $0x3,%edi
+    17a8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    17ab:	85 d2                	test   %edx,%edx
+    17ad:	0f 84 8d 00 00 00    	je     1840 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17b3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    17b5:	8b 48 04             	mov    0x4(%eax),%ecx
+    17b8:	39 f9                	cmp    %edi,%ecx
+    17ba:	73 64                	jae    1820 <malloc+0x90>
+  if(nu < 4096)
+    17bc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    17c1:	39 df                	cmp    %ebx,%edi
+    17c3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    17c6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    17cd:	eb 0a                	jmp    17d9 <malloc+0x49>
+    17cf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17d0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    17d2:	8b 48 04             	mov    0x4(%eax),%ecx
+    17d5:	39 f9                	cmp    %edi,%ecx
+    17d7:	73 47                	jae    1820 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    17d9:	89 c2                	mov    %eax,%edx
+    17db:	39 05 a8 1b 00 00    	cmp    %eax,0x1ba8
+    17e1:	75 ed                	jne    17d0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    17e3:	83 ec 0c             	sub    $0xc,%esp
+    17e6:	56                   	push   %esi
+    17e7:	e8 ff fb ff ff       	call   13eb <sbrk>
+  if(p == (char*)-1)
+    17ec:	83 c4 10             	add    $0x10,%esp
+    17ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17f2:	74 1c                	je     1810 <malloc+0x80>
+  hp->s.size = nu;
+    17f4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    17f7:	83 ec 0c             	sub    $0xc,%esp
+    17fa:	83 c0 08             	add    $0x8,%eax
+    17fd:	50                   	push   %eax
+    17fe:	e8 fd fe ff ff       	call   1700 <free>
+  return freep;
+    1803:	8b 15 a8 1b 00 00    	mov    0x1ba8,%edx
+      if((p = morecore(nunits)) == 0)
+    1809:	83 c4 10             	add    $0x10,%esp
+    180c:	85 d2                	test   %edx,%edx
+    180e:	75 c0                	jne    17d0 <malloc+0x40>
+        return 0;
+  }
+}
+    1810:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1813:	31 c0                	xor    %eax,%eax
+}
+    1815:	5b                   	pop    %ebx
+    1816:	5e                   	pop    %esi
+    1817:	5f                   	pop    %edi
+    1818:	5d                   	pop    %ebp
+    1819:	c3                   	ret
+    181a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1820:	39 cf                	cmp    %ecx,%edi
+    1822:	74 4c                	je     1870 <malloc+0xe0>
+        p->s.size -= nunits;
+    1824:	29 f9                	sub    %edi,%ecx
+    1826:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1829:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    182c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    182f:	89 15 a8 1b 00 00    	mov    %edx,0x1ba8
+}
+    1835:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1838:	83 c0 08             	add    $0x8,%eax
+}
+    183b:	5b                   	pop    %ebx
+    183c:	5e                   	pop    %esi
+    183d:	5f                   	pop    %edi
+    183e:	5d                   	pop    %ebp
+    183f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1840:	c7 05 a8 1b 00 00 ac 	movl   $0x1bac,0x1ba8
+    1847:	1b 00 00 
+    base.s.size = 0;
+    184a:	b8 ac 1b 00 00       	mov    $0x1bac,%eax
+    base.s.ptr = freep = prevp = &base;
+    184f:	c7 05 ac 1b 00 00 ac 	movl   $0x1bac,0x1bac
+    1856:	1b 00 00 
+    base.s.size = 0;
+    1859:	c7 05 b0 1b 00 00 00 	movl   $0x0,0x1bb0
+    1860:	00 00 00 
+    if(p->s.size >= nunits){
+    1863:	e9 54 ff ff ff       	jmp    17bc <malloc+0x2c>
+    1868:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1870:	8b 08                	mov    (%eax),%ecx
+    1872:	89 0a                	mov    %ecx,(%edx)
+    1874:	eb b9                	jmp    182f <malloc+0x9f>
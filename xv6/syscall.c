@@ -4,6 +4,9 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "mm.h"
 #include "x86.h"
 #include "syscall.h"
 
@@ -19,7 +22,7 @@ fetchint(uint addr, int *ip)
 {
   struct proc *curproc = myproc();
 
-  if(addr >= curproc->sz || addr+4 > curproc->sz)
+  if(addr >= curproc->mm->sz || addr+4 > curproc->mm->sz)
     return -1;
   *ip = *(int*)(addr);
   return 0;
@@ -34,10 +37,10 @@ fetchstr(uint addr, char **pp)
   char *s, *ep;
   struct proc *curproc = myproc();
 
-  if(addr >= curproc->sz)
+  if(addr >= curproc->mm->sz)
     return -1;
   *pp = (char*)addr;
-  ep = (char*)curproc->sz;
+  ep = (char*)curproc->mm->sz;
   for(s = *pp; s < ep; s++){
     if(*s == 0)
       return s - *pp;
@@ -63,7 +66,7 @@ argptr(int n, char **pp, int size)
  
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  if(size < 0 || (uint)i >= curproc->mm->sz || (uint)i+size > curproc->mm->sz)
     return -1;
   *pp = (char*)i;
   return 0;
@@ -112,6 +115,18 @@ extern int sys_join(void);
 extern int sys_initlock_t(void);
 extern int sys_acquire_t(void);
 extern int sys_release_t(void);
+extern int sys_setsched(void);
+extern int sys_mkgroup(void);
+extern int sys_joingroup(void);
+extern int sys_transfer_tickets(void);
+extern int sys_setdeadline(void);
+extern int sys_setaffinity(void);
+extern int sys_yield_to(void);
+extern int sys_getlatency(void);
+extern int sys_futex_wait(void);
+extern int sys_futex_wake(void);
+extern int sys_mguard(void);
+extern int sys_join_any(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -144,6 +159,18 @@ static int (*syscalls[])(void) = {
 [SYS_initlock_t]   sys_initlock_t,
 [SYS_acquire_t]    sys_acquire_t,
 [SYS_release_t]    sys_release_t,
+[SYS_setsched]     sys_setsched,
+[SYS_mkgroup]      sys_mkgroup,
+[SYS_joingroup]    sys_joingroup,
+[SYS_transfer_tickets] sys_transfer_tickets,
+[SYS_setdeadline]  sys_setdeadline,
+[SYS_setaffinity]  sys_setaffinity,
+[SYS_yield_to]  sys_yield_to,
+[SYS_getlatency]  sys_getlatency,
+[SYS_futex_wait]  sys_futex_wait,
+[SYS_futex_wake]  sys_futex_wake,
+[SYS_mguard]  sys_mguard,
+[SYS_join_any]  sys_join_any,
 };
 
 void
@@ -29,3 +29,15 @@
 #define SYS_initlock_t 28
 #define SYS_acquire_t  29
 #define SYS_release_t  30
+#define SYS_setsched   31
+#define SYS_mkgroup    32
+#define SYS_joingroup  33
+#define SYS_transfer_tickets 34
+#define SYS_setdeadline 35
+#define SYS_setaffinity 36
+#define SYS_yield_to 37
+#define SYS_getlatency 38
+#define SYS_futex_wait 39
+#define SYS_futex_wake 40
+#define SYS_mguard 41
+#define SYS_join_any 42
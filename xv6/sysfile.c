@@ -17,16 +17,24 @@
 #include "fcntl.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
-// and return both the descriptor and the corresponding struct file.
+// and return both the descriptor and the corresponding struct file,
+// with a reference of its own, since a thread sharing the descriptor
+// table may close the descriptor meanwhile.  The caller drops the
+// reference with fileclose().
 static int
 argfd(int n, int *pfd, struct file **pf)
 {
   int fd;
   struct file *f;
+  struct fdtable *fdt = myproc()->files;
 
-  if(argint(n, &fd) < 0)
+  if(argint(n, &fd) < 0 || fd < 0 || fd >= NOFILE)
     return -1;
-  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+  acquire(&fdt->lock);
+  if((f = fdt->ofile[fd]) != 0)
+    filedup(f);
+  release(&fdt->lock);
+  if(f == 0)
     return -1;
   if(pfd)
     *pfd = fd;
@@ -41,14 +49,17 @@ static int
 fdalloc(struct file *f)
 {
   int fd;
-  struct proc *curproc = myproc();
+  struct fdtable *fdt = myproc()->files;
 
+  acquire(&fdt->lock);
   for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd] == 0){
-      curproc->ofile[fd] = f;
+    if(fdt->ofile[fd] == 0){
+      fdt->ofile[fd] = f;
+      release(&fdt->lock);
       return fd;
     }
   }
+  release(&fdt->lock);
   return -1;
 }
 
@@ -60,9 +71,10 @@ sys_dup(void)
 
   if(argfd(0, 0, &f) < 0)
     return -1;
-  if((fd=fdalloc(f)) < 0)
+  if((fd=fdalloc(f)) < 0){
+    fileclose(f);
     return -1;
-  filedup(f);
+  }
   return fd;
 }
 
@@ -73,9 +85,11 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argint(2, &n) < 0 || argptr(1, &p, n) < 0 || argfd(0, 0, &f) < 0)
     return -1;
-  return fileread(f, p, n);
+  n = fileread(f, p, n);
+  fileclose(f);
+  return n;
 }
 
 int
@@ -85,9 +99,11 @@ sys_write(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argint(2, &n) < 0 || argptr(1, &p, n) < 0 || argfd(0, 0, &f) < 0)
     return -1;
-  return filewrite(f, p, n);
+  n = filewrite(f, p, n);
+  fileclose(f);
+  return n;
 }
 
 int
@@ -95,10 +111,16 @@ sys_close(void)
 {
   int fd;
   struct file *f;
+  struct fdtable *fdt = myproc()->files;
 
-  if(argfd(0, &fd, &f) < 0)
+  if(argint(0, &fd) < 0 || fd < 0 || fd >= NOFILE)
+    return -1;
+  acquire(&fdt->lock);
+  f = fdt->ofile[fd];
+  fdt->ofile[fd] = 0;
+  release(&fdt->lock);
+  if(f == 0)
     return -1;
-  myproc()->ofile[fd] = 0;
   fileclose(f);
   return 0;
 }
@@ -108,10 +130,13 @@ sys_fstat(void)
 {
   struct file *f;
   struct stat *st;
+  int r;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argptr(1, (void*)&st, sizeof(*st)) < 0 || argfd(0, 0, &f) < 0)
     return -1;
-  return filestat(f, st);
+  r = filestat(f, st);
+  fileclose(f);
+  return r;
 }
 
 // Create the path new as a link to the same inode as old.
@@ -387,9 +412,8 @@ sys_chdir(void)
     return -1;
   }
   iunlock(ip);
-  iput(curproc->cwd);
+  iput(cwdset(curproc->cwd, ip));
   end_op();
-  curproc->cwd = ip;
   return 0;
 }
 
@@ -432,8 +456,11 @@ sys_pipe(void)
     return -1;
   fd0 = -1;
   if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
-    if(fd0 >= 0)
-      myproc()->ofile[fd0] = 0;
+    if(fd0 >= 0){
+      acquire(&myproc()->files->lock);
+      myproc()->files->ofile[fd0] = 0;
+      release(&myproc()->files->lock);
+    }
     fileclose(rf);
     fileclose(wf);
     return -1;
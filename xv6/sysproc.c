@@ -7,6 +7,7 @@
 #include "mmu.h"
 #include "proc.h"
 #include "pstat.h"
+#include "ticketlock.h"
 
 
 int
@@ -47,15 +48,11 @@ sys_getpid(void)
 int
 sys_sbrk(void)
 {
-  int addr;
   int n;
 
   if(argint(0, &n) < 0)
     return -1;
-  addr = myproc()->sz;
-  if(growproc(n) < 0)
-    return -1;
-  return addr;
+  return growproc(n);
 }
 
 int
@@ -144,29 +141,53 @@ sys_munprotect(void){
 int
 sys_clone(void) {
   void *fcn, *arg1, *arg2, *stack;
+  int flags;
   //check if arguments is valid before calling clone syscall
   if (argptr(0, (void *)&fcn, sizeof(void *)) < 0)	return -1;
   if (argptr(1, (void *)&arg1, sizeof(void *)) < 0)	return -1;
   if (argptr(2, (void *)&arg2, sizeof(void *)) < 0)	return -1;
   if (argptr(3, (void *)&stack, sizeof(void *)) < 0)	return -1;
+  if (argint(4, &flags) < 0)	return -1;
 	
-  return clone(fcn, arg1, arg2, stack);
+  return clone(fcn, arg1, arg2, stack, flags);
 }
 
 int
 sys_join(void)
 {
   void **stack;
-  int stackArg;
-  stackArg = argint(0, &stackArg);
-  stack = (void**) stackArg;
+  if (argptr(0, (void *)&stack, sizeof(void *)) < 0)	return -1;
   return join(stack);
 }
 
+int
+sys_join_any(void)
+{
+  int *pids, n, flags;
+  void **stacks;
+
+  if(argint(2, &n) < 0 || n <= 0 || n > NPROC || argint(3, &flags) < 0)
+    return -1;
+  if(argptr(0, (void*)&pids, n*sizeof(int)) < 0 ||
+     argptr(1, (void*)&stacks, n*sizeof(void*)) < 0)
+    return -1;
+  return join_any(pids, stacks, n, flags);
+}
+
+int
+sys_mguard(void)
+{
+  int d;
+  int n = 0;
+  if(argint(0, &d)<0 || argint(1, &n)<0)
+    return -1;
+  return mguard((void *)d, n);
+}
+
 int sys_initlock_t(void)
 {
   struct ticketlock *tl;
-  if (argptr(0, (char**)&tl, sizeof(struct ticketlock*)) < 0) return -1;
+  if (argptr(0, (char**)&tl, sizeof(struct ticketlock)) < 0) return -1;
   
   initlock_t(tl);
   return 0;
@@ -175,7 +196,7 @@ int sys_initlock_t(void)
 int sys_acquire_t(void)
 {
   struct ticketlock *tl;
-  if (argptr(0, (char**)&tl, sizeof(struct ticketlock*)) < 0) return -1;
+  if (argptr(0, (char**)&tl, sizeof(struct ticketlock)) < 0) return -1;
   
   acquire_t(tl);
   return 0;
@@ -184,10 +205,111 @@ int sys_acquire_t(void)
 int sys_release_t(void)
 {
   struct ticketlock *tl;
-  if (argptr(0, (char**)&tl, sizeof(struct ticketlock*)) < 0) return -1;
+  if (argptr(0, (char**)&tl, sizeof(struct ticketlock)) < 0) return -1;
   
   release_t(tl);
   return 0;
 }
 
+int
+sys_setsched(void)
+{
+  int policy;
+
+  if(argint(0, &policy) < 0)
+    return -1;
+  return setsched(policy);
+}
+
+int
+sys_mkgroup(void)
+{
+  int tickets;
+
+  if(argint(0, &tickets) < 0)
+    return -1;
+  return mkgroup(tickets);
+}
+
+int
+sys_joingroup(void)
+{
+  int gid;
+
+  if(argint(0, &gid) < 0)
+    return -1;
+  return joingroup(gid);
+}
+
+int
+sys_transfer_tickets(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return transfer_tickets(pid);
+}
+
+int
+sys_setdeadline(void)
+{
+  int period, runtime;
+
+  if(argint(0, &period) < 0 || argint(1, &runtime) < 0)
+    return -1;
+  return setdeadline(period, runtime);
+}
+
+int
+sys_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setaffinity(pid, mask);
+}
+
+int
+sys_yield_to(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return yield_to(pid);
+}
+
+int
+sys_getlatency(void)
+{
+  int pid;
+  uint *hist;
+
+  if(argint(0, &pid) < 0 || argptr(1, (char**)&hist, NLATBUCKET*sizeof(uint)) < 0)
+    return -1;
+  return getlatency(pid, hist);
+}
+
+int
+sys_futex_wait(void)
+{
+  int *addr;
+  int val;
+
+  if(argptr(0, (char**)&addr, sizeof(int)) < 0 || argint(1, &val) < 0)
+    return -1;
+  return futex_wait((uint)addr, val);
+}
+
+int
+sys_futex_wake(void)
+{
+  int *addr;
+  int n;
 
+  if(argptr(0, (char**)&addr, sizeof(int)) < 0 || argint(1, &n) < 0)
+    return -1;
+  return futex_wake((uint)addr, n);
+}
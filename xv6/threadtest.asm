@@ -0,0 +1,3650 @@
+
+_threadtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+}
+
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	51                   	push   %ecx
+    100e:	83 ec 04             	sub    $0x4,%esp
+  	const int NTHREADS = 4;
+
+	// "threadtest gang" runs the tests with threads co-scheduled
+	if(argc > 1 && strcmp(argv[1], "gang") == 0)
+    1011:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+    1014:	8b 41 04             	mov    0x4(%ecx),%eax
+	if(argc > 1 && strcmp(argv[1], "gang") == 0)
+    1017:	7f 62                	jg     107b <main+0x7b>
+		setsched(SCHED_LOTTERY | SCHED_GANG);
+  	
+  	test_one_thread();
+    1019:	e8 e2 04 00 00       	call   1500 <test_one_thread>
+  
+  	test_multi_threads(NTHREADS);
+    101e:	83 ec 0c             	sub    $0xc,%esp
+    1021:	6a 04                	push   $0x4
+    1023:	e8 18 05 00 00       	call   1540 <test_multi_threads>
+  	
+	printf(1, "*** Shared Variable = %d ***\n",sharedVariable);
+    1028:	83 c4 0c             	add    $0xc,%esp
+    102b:	ff 35 d0 3a 00 00    	push   0x3ad0
+    1031:	68 08 2e 00 00       	push   $0x2e08
+    1036:	6a 01                	push   $0x1
+    1038:	e8 63 0f 00 00       	call   1fa0 <printf>
+
+	test_yield_to();
+    103d:	e8 6e 05 00 00       	call   15b0 <test_yield_to>
+
+	test_stack_reuse();
+    1042:	e8 f9 05 00 00       	call   1640 <test_stack_reuse>
+
+	test_rwlock();
+    1047:	e8 a4 06 00 00       	call   16f0 <test_rwlock>
+
+	test_cond();
+    104c:	e8 3f 07 00 00       	call   1790 <test_cond>
+
+	test_barrier();
+    1051:	e8 aa 07 00 00       	call   1800 <test_barrier>
+
+	test_detached();
+    1056:	e8 25 08 00 00       	call   1880 <test_detached>
+
+	test_join_many();
+    105b:	e8 c0 08 00 00       	call   1920 <test_join_many>
+
+	test_sbrk();
+    1060:	e8 2b 09 00 00       	call   1990 <test_sbrk>
+
+	test_files();
+    1065:	e8 36 0a 00 00       	call   1aa0 <test_files>
+
+	setsched(SCHED_LOTTERY);
+    106a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    1071:	e8 25 0e 00 00       	call   1e9b <setsched>
+
+  	exit();
+    1076:	e8 38 0d 00 00       	call   1db3 <exit>
+	if(argc > 1 && strcmp(argv[1], "gang") == 0)
+    107b:	52                   	push   %edx
+    107c:	52                   	push   %edx
+    107d:	68 03 2e 00 00       	push   $0x2e03
+    1082:	ff 70 04             	push   0x4(%eax)
+    1085:	e8 16 0b 00 00       	call   1ba0 <strcmp>
+    108a:	83 c4 10             	add    $0x10,%esp
+    108d:	85 c0                	test   %eax,%eax
+    108f:	75 88                	jne    1019 <main+0x19>
+		setsched(SCHED_LOTTERY | SCHED_GANG);
+    1091:	83 ec 0c             	sub    $0xc,%esp
+    1094:	68 00 01 00 00       	push   $0x100
+    1099:	e8 fd 0d 00 00       	call   1e9b <setsched>
+    109e:	83 c4 10             	add    $0x10,%esp
+    10a1:	e9 73 ff ff ff       	jmp    1019 <main+0x19>
+    10a6:	66 90                	xchg   %ax,%ax
+    10a8:	66 90                	xchg   %ax,%ax
+    10aa:	66 90                	xchg   %ax,%ax
+    10ac:	66 90                	xchg   %ax,%ax
+    10ae:	66 90                	xchg   %ax,%ax
+
+000010b0 <increment>:
+{	
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	57                   	push   %edi
+    10b4:	56                   	push   %esi
+    10b5:	53                   	push   %ebx
+    10b6:	83 ec 0c             	sub    $0xc,%esp
+    10b9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int pid = getpid();
+    10bc:	e8 72 0d 00 00       	call   1e33 <getpid>
+	lock_acquire(&lock);
+    10c1:	83 ec 0c             	sub    $0xc,%esp
+    10c4:	68 d4 3a 00 00       	push   $0x3ad4
+	int pid = getpid();
+    10c9:	89 c6                	mov    %eax,%esi
+	lock_acquire(&lock);
+    10cb:	e8 70 18 00 00       	call   2940 <lock_acquire>
+	printf(1, "** Thread with PID: %d %s **\n",pid, str);
+    10d0:	ff 75 08             	push   0x8(%ebp)
+    10d3:	56                   	push   %esi
+    10d4:	68 e8 2c 00 00       	push   $0x2ce8
+    10d9:	6a 01                	push   $0x1
+    10db:	e8 c0 0e 00 00       	call   1fa0 <printf>
+	lock_release(&lock);
+    10e0:	83 c4 14             	add    $0x14,%esp
+    10e3:	68 d4 3a 00 00       	push   $0x3ad4
+    10e8:	e8 c3 18 00 00       	call   29b0 <lock_release>
+	for(int i = 1 ; i <= (int) iteration ; i++)
+    10ed:	83 c4 10             	add    $0x10,%esp
+    10f0:	85 ff                	test   %edi,%edi
+    10f2:	7e 45                	jle    1139 <increment+0x89>
+    10f4:	bb 01 00 00 00       	mov    $0x1,%ebx
+    10f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+		lock_acquire(&lock);
+    1100:	83 ec 0c             	sub    $0xc,%esp
+    1103:	68 d4 3a 00 00       	push   $0x3ad4
+    1108:	e8 33 18 00 00       	call   2940 <lock_acquire>
+    		printf(1, "(%d) >> %d\n", pid, i);
+    110d:	53                   	push   %ebx
+	for(int i = 1 ; i <= (int) iteration ; i++)
+    110e:	83 c3 01             	add    $0x1,%ebx
+    		printf(1, "(%d) >> %d\n", pid, i);
+    1111:	56                   	push   %esi
+    1112:	68 06 2d 00 00       	push   $0x2d06
+    1117:	6a 01                	push   $0x1
+    1119:	e8 82 0e 00 00       	call   1fa0 <printf>
+    		lock_release(&lock);
+    111e:	83 c4 14             	add    $0x14,%esp
+    		sharedVariable++;
+    1121:	83 05 d0 3a 00 00 01 	addl   $0x1,0x3ad0
+    		lock_release(&lock);
+    1128:	68 d4 3a 00 00       	push   $0x3ad4
+    112d:	e8 7e 18 00 00       	call   29b0 <lock_release>
+	for(int i = 1 ; i <= (int) iteration ; i++)
+    1132:	83 c4 10             	add    $0x10,%esp
+    1135:	39 fb                	cmp    %edi,%ebx
+    1137:	7e c7                	jle    1100 <increment+0x50>
+	lock_acquire(&lock);
+    1139:	83 ec 0c             	sub    $0xc,%esp
+    113c:	68 d4 3a 00 00       	push   $0x3ad4
+    1141:	e8 fa 17 00 00       	call   2940 <lock_acquire>
+	printf(1, "*** (%d) Finished ***\n", pid);
+    1146:	83 c4 0c             	add    $0xc,%esp
+    1149:	56                   	push   %esi
+    114a:	68 12 2d 00 00       	push   $0x2d12
+    114f:	6a 01                	push   $0x1
+    1151:	e8 4a 0e 00 00       	call   1fa0 <printf>
+	lock_release(&lock);
+    1156:	c7 04 24 d4 3a 00 00 	movl   $0x3ad4,(%esp)
+    115d:	e8 4e 18 00 00       	call   29b0 <lock_release>
+	exit();
+    1162:	e8 4c 0c 00 00       	call   1db3 <exit>
+    1167:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    116e:	66 90                	xchg   %ax,%ax
+
+00001170 <detached>:
+{
+    1170:	55                   	push   %ebp
+// Routines to let C code use special x86 instructions.
+
+// atomic fetch-and-add operation
+static inline int fetch_and_add (int *var, int value)
+{
+  asm volatile("lock; xaddl %0, %1"
+    1171:	b8 01 00 00 00       	mov    $0x1,%eax
+    1176:	89 e5                	mov    %esp,%ebp
+    1178:	83 ec 08             	sub    $0x8,%esp
+    117b:	f0 0f c1 05 60 3a 00 	lock xadd %eax,0x3a60
+    1182:	00 
+	exit();
+    1183:	e8 2b 0c 00 00       	call   1db3 <exit>
+    1188:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118f:	90                   	nop
+
+00001190 <pingpong>:
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	57                   	push   %edi
+		turn = 1 - me;
+    1194:	bf 64 00 00 00       	mov    $0x64,%edi
+{
+    1199:	56                   	push   %esi
+    119a:	53                   	push   %ebx
+		turn = 1 - me;
+    119b:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+    11a0:	83 ec 0c             	sub    $0xc,%esp
+    11a3:	8b 75 08             	mov    0x8(%ebp),%esi
+		turn = 1 - me;
+    11a6:	29 f3                	sub    %esi,%ebx
+    11a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11af:	90                   	nop
+		while(turn != me)
+    11b0:	a1 cc 3a 00 00       	mov    0x3acc,%eax
+    11b5:	39 c6                	cmp    %eax,%esi
+    11b7:	75 27                	jne    11e0 <pingpong+0x50>
+    11b9:	eb 46                	jmp    1201 <pingpong+0x71>
+    11bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11bf:	90                   	nop
+			if(tid[1 - me] == 0 || yield_to(tid[1 - me]) < 0)
+    11c0:	8b 04 9d c4 3a 00 00 	mov    0x3ac4(,%ebx,4),%eax
+    11c7:	83 ec 0c             	sub    $0xc,%esp
+    11ca:	50                   	push   %eax
+    11cb:	e8 fb 0c 00 00       	call   1ecb <yield_to>
+    11d0:	83 c4 10             	add    $0x10,%esp
+    11d3:	85 c0                	test   %eax,%eax
+    11d5:	78 14                	js     11eb <pingpong+0x5b>
+		while(turn != me)
+    11d7:	a1 cc 3a 00 00       	mov    0x3acc,%eax
+    11dc:	39 f0                	cmp    %esi,%eax
+    11de:	74 21                	je     1201 <pingpong+0x71>
+			if(tid[1 - me] == 0 || yield_to(tid[1 - me]) < 0)
+    11e0:	8b 04 9d c4 3a 00 00 	mov    0x3ac4(,%ebx,4),%eax
+    11e7:	85 c0                	test   %eax,%eax
+    11e9:	75 d5                	jne    11c0 <pingpong+0x30>
+				sleep(0);
+    11eb:	83 ec 0c             	sub    $0xc,%esp
+    11ee:	6a 00                	push   $0x0
+    11f0:	e8 4e 0c 00 00       	call   1e43 <sleep>
+		while(turn != me)
+    11f5:	a1 cc 3a 00 00       	mov    0x3acc,%eax
+				sleep(0);
+    11fa:	83 c4 10             	add    $0x10,%esp
+		while(turn != me)
+    11fd:	39 f0                	cmp    %esi,%eax
+    11ff:	75 df                	jne    11e0 <pingpong+0x50>
+		sharedVariable++;
+    1201:	83 05 d0 3a 00 00 01 	addl   $0x1,0x3ad0
+		turn = 1 - me;
+    1208:	89 1d cc 3a 00 00    	mov    %ebx,0x3acc
+	for(int i = 0 ; i < ROUNDS ; i++)
+    120e:	83 ef 01             	sub    $0x1,%edi
+    1211:	75 9d                	jne    11b0 <pingpong+0x20>
+	exit();
+    1213:	e8 9b 0b 00 00       	call   1db3 <exit>
+    1218:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121f:	90                   	nop
+
+00001220 <deepstack>:
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	81 ec 7c 17 00 00    	sub    $0x177c,%esp
+	memset(buf, 1, sizeof(buf));
+    1229:	8d 85 88 e8 ff ff    	lea    -0x1778(%ebp),%eax
+    122f:	68 70 17 00 00       	push   $0x1770
+    1234:	6a 01                	push   $0x1
+    1236:	50                   	push   %eax
+    1237:	e8 f4 09 00 00       	call   1c30 <memset>
+	exit();
+    123c:	e8 72 0b 00 00       	call   1db3 <exit>
+    1241:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1248:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    124f:	90                   	nop
+
+00001250 <grower>:
+{
+    1250:	55                   	push   %ebp
+    1251:	89 e5                	mov    %esp,%ebp
+    1253:	57                   	push   %edi
+    1254:	56                   	push   %esi
+    1255:	53                   	push   %ebx
+    1256:	83 ec 0c             	sub    $0xc,%esp
+    1259:	8b 75 08             	mov    0x8(%ebp),%esi
+	for(int i = 0 ; i < NGROW ; i++)
+    125c:	89 f3                	mov    %esi,%ebx
+			grown[me][i][0] = 'a' + me;
+    125e:	83 c6 61             	add    $0x61,%esi
+    1261:	c1 e3 05             	shl    $0x5,%ebx
+    1264:	8d bb e0 39 00 00    	lea    0x39e0(%ebx),%edi
+    126a:	81 c3 00 3a 00 00    	add    $0x3a00,%ebx
+		grown[me][i] = sbrk(4096);
+    1270:	83 ec 0c             	sub    $0xc,%esp
+    1273:	68 00 10 00 00       	push   $0x1000
+    1278:	e8 be 0b 00 00       	call   1e3b <sbrk>
+		if(grown[me][i] != (char*)-1)
+    127d:	83 c4 10             	add    $0x10,%esp
+		grown[me][i] = sbrk(4096);
+    1280:	89 07                	mov    %eax,(%edi)
+		if(grown[me][i] != (char*)-1)
+    1282:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1285:	74 04                	je     128b <grower+0x3b>
+			grown[me][i][0] = 'a' + me;
+    1287:	89 f2                	mov    %esi,%edx
+    1289:	88 10                	mov    %dl,(%eax)
+	for(int i = 0 ; i < NGROW ; i++)
+    128b:	83 c7 04             	add    $0x4,%edi
+    128e:	39 df                	cmp    %ebx,%edi
+    1290:	75 de                	jne    1270 <grower+0x20>
+	exit();
+    1292:	e8 1c 0b 00 00       	call   1db3 <exit>
+    1297:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129e:	66 90                	xchg   %ax,%ax
+
+000012a0 <reader>:
+{
+    12a0:	55                   	push   %ebp
+    12a1:	89 e5                	mov    %esp,%ebp
+    12a3:	53                   	push   %ebx
+    12a4:	bb c8 00 00 00       	mov    $0xc8,%ebx
+    12a9:	83 ec 04             	sub    $0x4,%esp
+    12ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+		rw_rdlock(&rw);
+    12b0:	83 ec 0c             	sub    $0xc,%esp
+    12b3:	68 b8 3a 00 00       	push   $0x3ab8
+    12b8:	e8 43 17 00 00       	call   2a00 <rw_rdlock>
+		if(table[0] != table[1])
+    12bd:	a1 b4 3a 00 00       	mov    0x3ab4,%eax
+    12c2:	83 c4 10             	add    $0x10,%esp
+    12c5:	39 05 b0 3a 00 00    	cmp    %eax,0x3ab0
+    12cb:	74 0a                	je     12d7 <reader+0x37>
+			torn = 1;
+    12cd:	c7 05 ac 3a 00 00 01 	movl   $0x1,0x3aac
+    12d4:	00 00 00 
+		rw_unlock(&rw);
+    12d7:	83 ec 0c             	sub    $0xc,%esp
+    12da:	68 b8 3a 00 00       	push   $0x3ab8
+    12df:	e8 dc 17 00 00       	call   2ac0 <rw_unlock>
+	for(int i = 0 ; i < 200 ; i++)
+    12e4:	83 c4 10             	add    $0x10,%esp
+    12e7:	83 eb 01             	sub    $0x1,%ebx
+    12ea:	75 c4                	jne    12b0 <reader+0x10>
+	exit();
+    12ec:	e8 c2 0a 00 00       	call   1db3 <exit>
+    12f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ff:	90                   	nop
+
+00001300 <writer>:
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	53                   	push   %ebx
+    1304:	bb 64 00 00 00       	mov    $0x64,%ebx
+    1309:	83 ec 04             	sub    $0x4,%esp
+    130c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+		rw_wrlock(&rw);
+    1310:	83 ec 0c             	sub    $0xc,%esp
+    1313:	68 b8 3a 00 00       	push   $0x3ab8
+    1318:	e8 43 17 00 00       	call   2a60 <rw_wrlock>
+		sleep(0);
+    131d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+		table[0]++;
+    1324:	83 05 b0 3a 00 00 01 	addl   $0x1,0x3ab0
+		sleep(0);
+    132b:	e8 13 0b 00 00       	call   1e43 <sleep>
+		rw_unlock(&rw);
+    1330:	c7 04 24 b8 3a 00 00 	movl   $0x3ab8,(%esp)
+		table[1]++;
+    1337:	83 05 b4 3a 00 00 01 	addl   $0x1,0x3ab4
+		rw_unlock(&rw);
+    133e:	e8 7d 17 00 00       	call   2ac0 <rw_unlock>
+	for(int i = 0 ; i < 100 ; i++)
+    1343:	83 c4 10             	add    $0x10,%esp
+    1346:	83 eb 01             	sub    $0x1,%ebx
+    1349:	75 c5                	jne    1310 <writer+0x10>
+	exit();
+    134b:	e8 63 0a 00 00       	call   1db3 <exit>
+
+00001350 <producer>:
+{
+    1350:	55                   	push   %ebp
+    1351:	89 e5                	mov    %esp,%ebp
+    1353:	53                   	push   %ebx
+	for(int i = 1 ; i <= NITEMS ; i++)
+    1354:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+    1359:	83 ec 04             	sub    $0x4,%esp
+    135c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+		lock_acquire(&lock);
+    1360:	83 ec 0c             	sub    $0xc,%esp
+    1363:	68 d4 3a 00 00       	push   $0x3ad4
+    1368:	e8 d3 15 00 00       	call   2940 <lock_acquire>
+		while(nbuf == BUFSIZE)
+    136d:	a1 88 3a 00 00       	mov    0x3a88,%eax
+    1372:	83 c4 10             	add    $0x10,%esp
+    1375:	83 f8 04             	cmp    $0x4,%eax
+    1378:	75 25                	jne    139f <producer+0x4f>
+    137a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+			cond_wait(&notfull, &lock);
+    1380:	83 ec 08             	sub    $0x8,%esp
+    1383:	68 d4 3a 00 00       	push   $0x3ad4
+    1388:	68 a4 3a 00 00       	push   $0x3aa4
+    138d:	e8 7e 17 00 00       	call   2b10 <cond_wait>
+		while(nbuf == BUFSIZE)
+    1392:	a1 88 3a 00 00       	mov    0x3a88,%eax
+    1397:	83 c4 10             	add    $0x10,%esp
+    139a:	83 f8 04             	cmp    $0x4,%eax
+    139d:	74 e1                	je     1380 <producer+0x30>
+		cond_signal(&notempty);
+    139f:	83 ec 0c             	sub    $0xc,%esp
+		buf[nbuf++] = i;
+    13a2:	89 1c 85 8c 3a 00 00 	mov    %ebx,0x3a8c(,%eax,4)
+    13a9:	8d 50 01             	lea    0x1(%eax),%edx
+	for(int i = 1 ; i <= NITEMS ; i++)
+    13ac:	83 c3 01             	add    $0x1,%ebx
+		cond_signal(&notempty);
+    13af:	68 9c 3a 00 00       	push   $0x3a9c
+		buf[nbuf++] = i;
+    13b4:	89 15 88 3a 00 00    	mov    %edx,0x3a88
+		cond_signal(&notempty);
+    13ba:	e8 21 18 00 00       	call   2be0 <cond_signal>
+		lock_release(&lock);
+    13bf:	c7 04 24 d4 3a 00 00 	movl   $0x3ad4,(%esp)
+    13c6:	e8 e5 15 00 00       	call   29b0 <lock_release>
+	for(int i = 1 ; i <= NITEMS ; i++)
+    13cb:	83 c4 10             	add    $0x10,%esp
+    13ce:	81 fb c9 00 00 00    	cmp    $0xc9,%ebx
+    13d4:	75 8a                	jne    1360 <producer+0x10>
+	exit();
+    13d6:	e8 d8 09 00 00       	call   1db3 <exit>
+    13db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13df:	90                   	nop
+
+000013e0 <consumer>:
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	53                   	push   %ebx
+    13e4:	bb c8 00 00 00       	mov    $0xc8,%ebx
+    13e9:	83 ec 04             	sub    $0x4,%esp
+    13ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+		lock_acquire(&lock);
+    13f0:	83 ec 0c             	sub    $0xc,%esp
+    13f3:	68 d4 3a 00 00       	push   $0x3ad4
+    13f8:	e8 43 15 00 00       	call   2940 <lock_acquire>
+		while(nbuf == 0)
+    13fd:	a1 88 3a 00 00       	mov    0x3a88,%eax
+    1402:	83 c4 10             	add    $0x10,%esp
+    1405:	85 c0                	test   %eax,%eax
+    1407:	75 25                	jne    142e <consumer+0x4e>
+    1409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+			cond_wait(&notempty, &lock);
+    1410:	83 ec 08             	sub    $0x8,%esp
+    1413:	68 d4 3a 00 00       	push   $0x3ad4
+    1418:	68 9c 3a 00 00       	push   $0x3a9c
+    141d:	e8 ee 16 00 00       	call   2b10 <cond_wait>
+		while(nbuf == 0)
+    1422:	a1 88 3a 00 00       	mov    0x3a88,%eax
+    1427:	83 c4 10             	add    $0x10,%esp
+    142a:	85 c0                	test   %eax,%eax
+    142c:	74 e2                	je     1410 <consumer+0x30>
+		cond_signal(&notfull);
+    142e:	83 ec 0c             	sub    $0xc,%esp
+		consumed += buf[--nbuf];
+    1431:	83 e8 01             	sub    $0x1,%eax
+		cond_signal(&notfull);
+    1434:	68 a4 3a 00 00       	push   $0x3aa4
+		consumed += buf[--nbuf];
+    1439:	a3 88 3a 00 00       	mov    %eax,0x3a88
+    143e:	8b 04 85 8c 3a 00 00 	mov    0x3a8c(,%eax,4),%eax
+    1445:	01 05 84 3a 00 00    	add    %eax,0x3a84
+		cond_signal(&notfull);
+    144b:	e8 90 17 00 00       	call   2be0 <cond_signal>
+		lock_release(&lock);
+    1450:	c7 04 24 d4 3a 00 00 	movl   $0x3ad4,(%esp)
+    1457:	e8 54 15 00 00       	call   29b0 <lock_release>
+	for(int i = 1 ; i <= NITEMS ; i++)
+    145c:	83 c4 10             	add    $0x10,%esp
+    145f:	83 eb 01             	sub    $0x1,%ebx
+    1462:	75 8c                	jne    13f0 <consumer+0x10>
+	exit();
+    1464:	e8 4a 09 00 00       	call   1db3 <exit>
+    1469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001470 <phased>:
+{
+    1470:	55                   	push   %ebp
+    1471:	89 e5                	mov    %esp,%ebp
+    1473:	56                   	push   %esi
+    1474:	53                   	push   %ebx
+    1475:	8b 75 08             	mov    0x8(%ebp),%esi
+	for(int i = 0 ; i < NPHASES ; i++)
+    1478:	31 db                	xor    %ebx,%ebx
+    147a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+		barrier_wait(&bar);
+    1480:	83 ec 0c             	sub    $0xc,%esp
+		phase[me] = i;
+    1483:	89 1c b5 68 3a 00 00 	mov    %ebx,0x3a68(,%esi,4)
+		barrier_wait(&bar);
+    148a:	68 78 3a 00 00       	push   $0x3a78
+    148f:	e8 dc 17 00 00       	call   2c70 <barrier_wait>
+    1494:	83 c4 10             	add    $0x10,%esp
+		for(int j = 0 ; j < NBARRIER ; j++)
+    1497:	31 c0                	xor    %eax,%eax
+			if(phase[j] < i)
+    1499:	39 1c 85 68 3a 00 00 	cmp    %ebx,0x3a68(,%eax,4)
+    14a0:	7d 0a                	jge    14ac <phased+0x3c>
+				early = 1;
+    14a2:	c7 05 64 3a 00 00 01 	movl   $0x1,0x3a64
+    14a9:	00 00 00 
+		for(int j = 0 ; j < NBARRIER ; j++)
+    14ac:	83 c0 01             	add    $0x1,%eax
+    14af:	83 f8 04             	cmp    $0x4,%eax
+    14b2:	75 e5                	jne    1499 <phased+0x29>
+		barrier_wait(&bar);
+    14b4:	83 ec 0c             	sub    $0xc,%esp
+	for(int i = 0 ; i < NPHASES ; i++)
+    14b7:	83 c3 01             	add    $0x1,%ebx
+		barrier_wait(&bar);
+    14ba:	68 78 3a 00 00       	push   $0x3a78
+    14bf:	e8 ac 17 00 00       	call   2c70 <barrier_wait>
+	for(int i = 0 ; i < NPHASES ; i++)
+    14c4:	83 c4 10             	add    $0x10,%esp
+    14c7:	83 fb 14             	cmp    $0x14,%ebx
+    14ca:	75 b4                	jne    1480 <phased+0x10>
+	exit();
+    14cc:	e8 e2 08 00 00       	call   1db3 <exit>
+    14d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14df:	90                   	nop
+
+000014e0 <opener>:
+{
+    14e0:	55                   	push   %ebp
+    14e1:	89 e5                	mov    %esp,%ebp
+    14e3:	83 ec 14             	sub    $0x14,%esp
+	pipe(tfd);
+    14e6:	68 c0 39 00 00       	push   $0x39c0
+    14eb:	e8 d3 08 00 00       	call   1dc3 <pipe>
+	exit();
+    14f0:	e8 be 08 00 00       	call   1db3 <exit>
+    14f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001500 <test_one_thread>:
+{	
+    1500:	55                   	push   %ebp
+    1501:	89 e5                	mov    %esp,%ebp
+    1503:	83 ec 14             	sub    $0x14,%esp
+	lock_init(&lock);
+    1506:	68 d4 3a 00 00       	push   $0x3ad4
+    150b:	e8 10 14 00 00       	call   2920 <lock_init>
+	printf(1, "*** Testing single thread ***\n");
+    1510:	58                   	pop    %eax
+    1511:	5a                   	pop    %edx
+    1512:	68 28 2e 00 00       	push   $0x2e28
+    1517:	6a 01                	push   $0x1
+    1519:	e8 82 0a 00 00       	call   1fa0 <printf>
+	thread_create(&increment, (void*) "(Single Thread)" , (void*)30);
+    151e:	83 c4 0c             	add    $0xc,%esp
+    1521:	6a 1e                	push   $0x1e
+    1523:	68 29 2d 00 00       	push   $0x2d29
+    1528:	68 b0 10 00 00       	push   $0x10b0
+    152d:	e8 3e 0f 00 00       	call   2470 <thread_create>
+  	thread_join();
+    1532:	83 c4 10             	add    $0x10,%esp
+}
+    1535:	c9                   	leave
+  	thread_join();
+    1536:	e9 75 11 00 00       	jmp    26b0 <thread_join>
+    153b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    153f:	90                   	nop
+
+00001540 <test_multi_threads>:
+{
+    1540:	55                   	push   %ebp
+    1541:	89 e5                	mov    %esp,%ebp
+    1543:	56                   	push   %esi
+    1544:	53                   	push   %ebx
+    1545:	8b 75 08             	mov    0x8(%ebp),%esi
+	lock_init(&lock);
+    1548:	83 ec 0c             	sub    $0xc,%esp
+    154b:	68 d4 3a 00 00       	push   $0x3ad4
+    1550:	e8 cb 13 00 00       	call   2920 <lock_init>
+	printf(1, "\n*** Testing multi threads ***\n");
+    1555:	58                   	pop    %eax
+    1556:	5a                   	pop    %edx
+    1557:	68 48 2e 00 00       	push   $0x2e48
+    155c:	6a 01                	push   $0x1
+    155e:	e8 3d 0a 00 00       	call   1fa0 <printf>
+	for(int i = 1 ; i <= num ; i++)
+    1563:	83 c4 10             	add    $0x10,%esp
+    1566:	85 f6                	test   %esi,%esi
+    1568:	7e 3a                	jle    15a4 <test_multi_threads+0x64>
+    156a:	bb 01 00 00 00       	mov    $0x1,%ebx
+    156f:	90                   	nop
+		thread_create(&increment, (void*) "started", (void*)50);
+    1570:	83 ec 04             	sub    $0x4,%esp
+	for(int i = 1 ; i <= num ; i++)
+    1573:	83 c3 01             	add    $0x1,%ebx
+		thread_create(&increment, (void*) "started", (void*)50);
+    1576:	6a 32                	push   $0x32
+    1578:	68 39 2d 00 00       	push   $0x2d39
+    157d:	68 b0 10 00 00       	push   $0x10b0
+    1582:	e8 e9 0e 00 00       	call   2470 <thread_create>
+	for(int i = 1 ; i <= num ; i++)
+    1587:	83 c4 10             	add    $0x10,%esp
+    158a:	39 de                	cmp    %ebx,%esi
+    158c:	7d e2                	jge    1570 <test_multi_threads+0x30>
+  	for(int i = 1 ; i <= num ; i++)
+    158e:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1593:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1597:	90                   	nop
+		thread_join();
+    1598:	e8 13 11 00 00       	call   26b0 <thread_join>
+  	for(int i = 1 ; i <= num ; i++)
+    159d:	83 c3 01             	add    $0x1,%ebx
+    15a0:	39 de                	cmp    %ebx,%esi
+    15a2:	7d f4                	jge    1598 <test_multi_threads+0x58>
+}
+    15a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    15a7:	5b                   	pop    %ebx
+    15a8:	5e                   	pop    %esi
+    15a9:	5d                   	pop    %ebp
+    15aa:	c3                   	ret
+    15ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15af:	90                   	nop
+
+000015b0 <test_yield_to>:
+{
+    15b0:	55                   	push   %ebp
+    15b1:	89 e5                	mov    %esp,%ebp
+    15b3:	83 ec 10             	sub    $0x10,%esp
+	printf(1, "\n*** Testing yield_to ***\n");
+    15b6:	68 41 2d 00 00       	push   $0x2d41
+    15bb:	6a 01                	push   $0x1
+    15bd:	e8 de 09 00 00       	call   1fa0 <printf>
+	tid[0] = thread_create(&pingpong, (void*) 0, NULL);
+    15c2:	83 c4 0c             	add    $0xc,%esp
+	turn = 0;
+    15c5:	c7 05 cc 3a 00 00 00 	movl   $0x0,0x3acc
+    15cc:	00 00 00 
+	sharedVariable = 0;
+    15cf:	c7 05 d0 3a 00 00 00 	movl   $0x0,0x3ad0
+    15d6:	00 00 00 
+	tid[0] = tid[1] = 0;
+    15d9:	c7 05 c8 3a 00 00 00 	movl   $0x0,0x3ac8
+    15e0:	00 00 00 
+    15e3:	c7 05 c4 3a 00 00 00 	movl   $0x0,0x3ac4
+    15ea:	00 00 00 
+	tid[0] = thread_create(&pingpong, (void*) 0, NULL);
+    15ed:	6a 00                	push   $0x0
+    15ef:	6a 00                	push   $0x0
+    15f1:	68 90 11 00 00       	push   $0x1190
+    15f6:	e8 75 0e 00 00       	call   2470 <thread_create>
+	tid[1] = thread_create(&pingpong, (void*) 1, NULL);
+    15fb:	83 c4 0c             	add    $0xc,%esp
+	tid[0] = thread_create(&pingpong, (void*) 0, NULL);
+    15fe:	a3 c4 3a 00 00       	mov    %eax,0x3ac4
+	tid[1] = thread_create(&pingpong, (void*) 1, NULL);
+    1603:	6a 00                	push   $0x0
+    1605:	6a 01                	push   $0x1
+    1607:	68 90 11 00 00       	push   $0x1190
+    160c:	e8 5f 0e 00 00       	call   2470 <thread_create>
+    1611:	a3 c8 3a 00 00       	mov    %eax,0x3ac8
+	thread_join();
+    1616:	e8 95 10 00 00       	call   26b0 <thread_join>
+	thread_join();
+    161b:	e8 90 10 00 00       	call   26b0 <thread_join>
+	printf(1, "*** %d turns taken, expected %d ***\n", sharedVariable, 2 * ROUNDS);
+    1620:	68 c8 00 00 00       	push   $0xc8
+    1625:	ff 35 d0 3a 00 00    	push   0x3ad0
+    162b:	68 68 2e 00 00       	push   $0x2e68
+    1630:	6a 01                	push   $0x1
+    1632:	e8 69 09 00 00       	call   1fa0 <printf>
+}
+    1637:	83 c4 20             	add    $0x20,%esp
+    163a:	c9                   	leave
+    163b:	c3                   	ret
+    163c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001640 <test_stack_reuse>:
+{
+    1640:	55                   	push   %ebp
+    1641:	89 e5                	mov    %esp,%ebp
+    1643:	56                   	push   %esi
+    1644:	53                   	push   %ebx
+	brk = sbrk(0);
+    1645:	bb 64 00 00 00       	mov    $0x64,%ebx
+	printf(1, "\n*** Testing thread stack reuse ***\n");
+    164a:	83 ec 08             	sub    $0x8,%esp
+    164d:	68 90 2e 00 00       	push   $0x2e90
+    1652:	6a 01                	push   $0x1
+    1654:	e8 47 09 00 00       	call   1fa0 <printf>
+	thread_create(&deepstack, NULL, NULL);
+    1659:	83 c4 0c             	add    $0xc,%esp
+    165c:	6a 00                	push   $0x0
+    165e:	6a 00                	push   $0x0
+    1660:	68 20 12 00 00       	push   $0x1220
+    1665:	e8 06 0e 00 00       	call   2470 <thread_create>
+	thread_join();
+    166a:	e8 41 10 00 00       	call   26b0 <thread_join>
+	brk = sbrk(0);
+    166f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    1676:	e8 c0 07 00 00       	call   1e3b <sbrk>
+    167b:	83 c4 10             	add    $0x10,%esp
+    167e:	89 c6                	mov    %eax,%esi
+		thread_create(&deepstack, NULL, NULL);
+    1680:	83 ec 04             	sub    $0x4,%esp
+    1683:	6a 00                	push   $0x0
+    1685:	6a 00                	push   $0x0
+    1687:	68 20 12 00 00       	push   $0x1220
+    168c:	e8 df 0d 00 00       	call   2470 <thread_create>
+		thread_join();
+    1691:	e8 1a 10 00 00       	call   26b0 <thread_join>
+	for(int i = 0 ; i < 100 ; i++)
+    1696:	83 c4 10             	add    $0x10,%esp
+    1699:	83 eb 01             	sub    $0x1,%ebx
+    169c:	75 e2                	jne    1680 <test_stack_reuse+0x40>
+	if(sbrk(0) == brk)
+    169e:	83 ec 0c             	sub    $0xc,%esp
+    16a1:	6a 00                	push   $0x0
+    16a3:	e8 93 07 00 00       	call   1e3b <sbrk>
+    16a8:	83 c4 10             	add    $0x10,%esp
+    16ab:	39 c6                	cmp    %eax,%esi
+    16ad:	74 26                	je     16d5 <test_stack_reuse+0x95>
+		printf(1, "*** heap grew by %d bytes ***\n", sbrk(0) - brk);
+    16af:	83 ec 0c             	sub    $0xc,%esp
+    16b2:	6a 00                	push   $0x0
+    16b4:	e8 82 07 00 00       	call   1e3b <sbrk>
+    16b9:	83 c4 0c             	add    $0xc,%esp
+    16bc:	29 f0                	sub    %esi,%eax
+    16be:	50                   	push   %eax
+    16bf:	68 e0 2e 00 00       	push   $0x2ee0
+    16c4:	6a 01                	push   $0x1
+    16c6:	e8 d5 08 00 00       	call   1fa0 <printf>
+    16cb:	83 c4 10             	add    $0x10,%esp
+}
+    16ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    16d1:	5b                   	pop    %ebx
+    16d2:	5e                   	pop    %esi
+    16d3:	5d                   	pop    %ebp
+    16d4:	c3                   	ret
+		printf(1, "*** 100 threads reused one stack ***\n");
+    16d5:	83 ec 08             	sub    $0x8,%esp
+    16d8:	68 b8 2e 00 00       	push   $0x2eb8
+    16dd:	6a 01                	push   $0x1
+    16df:	e8 bc 08 00 00       	call   1fa0 <printf>
+    16e4:	83 c4 10             	add    $0x10,%esp
+}
+    16e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    16ea:	5b                   	pop    %ebx
+    16eb:	5e                   	pop    %esi
+    16ec:	5d                   	pop    %ebp
+    16ed:	c3                   	ret
+    16ee:	66 90                	xchg   %ax,%ax
+
+000016f0 <test_rwlock>:
+{
+    16f0:	55                   	push   %ebp
+    16f1:	89 e5                	mov    %esp,%ebp
+    16f3:	53                   	push   %ebx
+	torn = 0;
+    16f4:	bb 03 00 00 00       	mov    $0x3,%ebx
+{
+    16f9:	83 ec 0c             	sub    $0xc,%esp
+	printf(1, "\n*** Testing reader-writer lock ***\n");
+    16fc:	68 00 2f 00 00       	push   $0x2f00
+    1701:	6a 01                	push   $0x1
+    1703:	e8 98 08 00 00       	call   1fa0 <printf>
+	torn = 0;
+    1708:	83 c4 10             	add    $0x10,%esp
+    170b:	c7 05 ac 3a 00 00 00 	movl   $0x0,0x3aac
+    1712:	00 00 00 
+		thread_create(&reader, NULL, NULL);
+    1715:	83 ec 04             	sub    $0x4,%esp
+    1718:	6a 00                	push   $0x0
+    171a:	6a 00                	push   $0x0
+    171c:	68 a0 12 00 00       	push   $0x12a0
+    1721:	e8 4a 0d 00 00       	call   2470 <thread_create>
+	for(int i = 0 ; i < NREADERS ; i++)
+    1726:	83 c4 10             	add    $0x10,%esp
+    1729:	83 eb 01             	sub    $0x1,%ebx
+    172c:	75 e7                	jne    1715 <test_rwlock+0x25>
+	thread_create(&writer, NULL, NULL);
+    172e:	83 ec 04             	sub    $0x4,%esp
+    1731:	6a 00                	push   $0x0
+    1733:	6a 00                	push   $0x0
+    1735:	68 00 13 00 00       	push   $0x1300
+    173a:	e8 31 0d 00 00       	call   2470 <thread_create>
+		thread_join();
+    173f:	e8 6c 0f 00 00       	call   26b0 <thread_join>
+    1744:	e8 67 0f 00 00       	call   26b0 <thread_join>
+    1749:	e8 62 0f 00 00       	call   26b0 <thread_join>
+    174e:	e8 5d 0f 00 00       	call   26b0 <thread_join>
+	printf(1, "*** table = %d, %d, %s ***\n", table[0], table[1], torn ? "torn read seen" : "no torn reads");
+    1753:	a1 ac 3a 00 00       	mov    0x3aac,%eax
+    1758:	ba 5c 2d 00 00       	mov    $0x2d5c,%edx
+    175d:	85 c0                	test   %eax,%eax
+    175f:	b8 6b 2d 00 00       	mov    $0x2d6b,%eax
+    1764:	0f 45 c2             	cmovne %edx,%eax
+    1767:	89 04 24             	mov    %eax,(%esp)
+    176a:	ff 35 b4 3a 00 00    	push   0x3ab4
+    1770:	ff 35 b0 3a 00 00    	push   0x3ab0
+    1776:	68 79 2d 00 00       	push   $0x2d79
+    177b:	6a 01                	push   $0x1
+    177d:	e8 1e 08 00 00       	call   1fa0 <printf>
+}
+    1782:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1785:	83 c4 20             	add    $0x20,%esp
+    1788:	c9                   	leave
+    1789:	c3                   	ret
+    178a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001790 <test_cond>:
+{
+    1790:	55                   	push   %ebp
+    1791:	89 e5                	mov    %esp,%ebp
+    1793:	83 ec 10             	sub    $0x10,%esp
+	printf(1, "\n*** Testing condition variables ***\n");
+    1796:	68 28 2f 00 00       	push   $0x2f28
+    179b:	6a 01                	push   $0x1
+    179d:	e8 fe 07 00 00       	call   1fa0 <printf>
+	lock_init(&lock);
+    17a2:	c7 04 24 d4 3a 00 00 	movl   $0x3ad4,(%esp)
+    17a9:	e8 72 11 00 00       	call   2920 <lock_init>
+	thread_create(&consumer, NULL, NULL);
+    17ae:	83 c4 0c             	add    $0xc,%esp
+    17b1:	6a 00                	push   $0x0
+    17b3:	6a 00                	push   $0x0
+    17b5:	68 e0 13 00 00       	push   $0x13e0
+    17ba:	e8 b1 0c 00 00       	call   2470 <thread_create>
+	thread_create(&producer, NULL, NULL);
+    17bf:	83 c4 0c             	add    $0xc,%esp
+    17c2:	6a 00                	push   $0x0
+    17c4:	6a 00                	push   $0x0
+    17c6:	68 50 13 00 00       	push   $0x1350
+    17cb:	e8 a0 0c 00 00       	call   2470 <thread_create>
+	thread_join();
+    17d0:	e8 db 0e 00 00       	call   26b0 <thread_join>
+	thread_join();
+    17d5:	e8 d6 0e 00 00       	call   26b0 <thread_join>
+	printf(1, "*** consumed %d, expected %d ***\n", consumed, NITEMS * (NITEMS + 1) / 2);
+    17da:	68 84 4e 00 00       	push   $0x4e84
+    17df:	ff 35 84 3a 00 00    	push   0x3a84
+    17e5:	68 50 2f 00 00       	push   $0x2f50
+    17ea:	6a 01                	push   $0x1
+    17ec:	e8 af 07 00 00       	call   1fa0 <printf>
+}
+    17f1:	83 c4 20             	add    $0x20,%esp
+    17f4:	c9                   	leave
+    17f5:	c3                   	ret
+    17f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001800 <test_barrier>:
+{
+    1800:	55                   	push   %ebp
+    1801:	89 e5                	mov    %esp,%ebp
+    1803:	53                   	push   %ebx
+	for(int i = 0 ; i < NBARRIER ; i++)
+    1804:	31 db                	xor    %ebx,%ebx
+{
+    1806:	83 ec 0c             	sub    $0xc,%esp
+	printf(1, "\n*** Testing barrier ***\n");
+    1809:	68 b4 2d 00 00       	push   $0x2db4
+    180e:	6a 01                	push   $0x1
+    1810:	e8 8b 07 00 00       	call   1fa0 <printf>
+	barrier_init(&bar, NBARRIER);
+    1815:	58                   	pop    %eax
+    1816:	5a                   	pop    %edx
+    1817:	6a 04                	push   $0x4
+    1819:	68 78 3a 00 00       	push   $0x3a78
+    181e:	e8 2d 14 00 00       	call   2c50 <barrier_init>
+    1823:	83 c4 10             	add    $0x10,%esp
+		thread_create(&phased, (void*) i, NULL);
+    1826:	83 ec 04             	sub    $0x4,%esp
+    1829:	6a 00                	push   $0x0
+    182b:	53                   	push   %ebx
+	for(int i = 0 ; i < NBARRIER ; i++)
+    182c:	83 c3 01             	add    $0x1,%ebx
+		thread_create(&phased, (void*) i, NULL);
+    182f:	68 70 14 00 00       	push   $0x1470
+    1834:	e8 37 0c 00 00       	call   2470 <thread_create>
+	for(int i = 0 ; i < NBARRIER ; i++)
+    1839:	83 c4 10             	add    $0x10,%esp
+    183c:	83 fb 04             	cmp    $0x4,%ebx
+    183f:	75 e5                	jne    1826 <test_barrier+0x26>
+		thread_join();
+    1841:	e8 6a 0e 00 00       	call   26b0 <thread_join>
+    1846:	e8 65 0e 00 00       	call   26b0 <thread_join>
+    184b:	e8 60 0e 00 00       	call   26b0 <thread_join>
+    1850:	e8 5b 0e 00 00       	call   26b0 <thread_join>
+	printf(1, "*** %d phases, %s ***\n", NPHASES, early ? "a thread ran ahead" : "all in step");
+    1855:	a1 64 3a 00 00       	mov    0x3a64,%eax
+    185a:	ba 95 2d 00 00       	mov    $0x2d95,%edx
+    185f:	85 c0                	test   %eax,%eax
+    1861:	b8 a8 2d 00 00       	mov    $0x2da8,%eax
+    1866:	0f 45 c2             	cmovne %edx,%eax
+    1869:	50                   	push   %eax
+    186a:	6a 14                	push   $0x14
+    186c:	68 ce 2d 00 00       	push   $0x2dce
+    1871:	6a 01                	push   $0x1
+    1873:	e8 28 07 00 00       	call   1fa0 <printf>
+}
+    1878:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    187b:	83 c4 10             	add    $0x10,%esp
+    187e:	c9                   	leave
+    187f:	c3                   	ret
+
+00001880 <test_detached>:
+{
+    1880:	55                   	push   %ebp
+    1881:	89 e5                	mov    %esp,%ebp
+    1883:	56                   	push   %esi
+    1884:	53                   	push   %ebx
+	for(int i = 0 ; i < NDETACHED ; i++)
+    1885:	31 db                	xor    %ebx,%ebx
+	printf(1, "\n*** Testing detached threads ***\n");
+    1887:	83 ec 08             	sub    $0x8,%esp
+    188a:	68 74 2f 00 00       	push   $0x2f74
+    188f:	6a 01                	push   $0x1
+    1891:	e8 0a 07 00 00       	call   1fa0 <printf>
+	start = sbrk(0);
+    1896:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    189d:	e8 99 05 00 00       	call   1e3b <sbrk>
+    18a2:	83 c4 10             	add    $0x10,%esp
+    18a5:	89 c6                	mov    %eax,%esi
+	for(int i = 0 ; i < NDETACHED ; i++)
+    18a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ae:	66 90                	xchg   %ax,%ax
+		if(thread_create_detached(&detached, NULL, NULL) < 0)
+    18b0:	83 ec 04             	sub    $0x4,%esp
+    18b3:	6a 00                	push   $0x0
+    18b5:	6a 00                	push   $0x0
+    18b7:	68 70 11 00 00       	push   $0x1170
+    18bc:	e8 cf 0c 00 00       	call   2590 <thread_create_detached>
+    18c1:	83 c4 10             	add    $0x10,%esp
+    18c4:	85 c0                	test   %eax,%eax
+    18c6:	79 15                	jns    18dd <test_detached+0x5d>
+    18c8:	eb 23                	jmp    18ed <test_detached+0x6d>
+    18ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+			sleep(1);
+    18d0:	83 ec 0c             	sub    $0xc,%esp
+    18d3:	6a 01                	push   $0x1
+    18d5:	e8 69 05 00 00       	call   1e43 <sleep>
+		while(finished <= i)
+    18da:	83 c4 10             	add    $0x10,%esp
+    18dd:	39 1d 60 3a 00 00    	cmp    %ebx,0x3a60
+    18e3:	7e eb                	jle    18d0 <test_detached+0x50>
+	for(int i = 0 ; i < NDETACHED ; i++)
+    18e5:	83 c3 01             	add    $0x1,%ebx
+    18e8:	83 fb 40             	cmp    $0x40,%ebx
+    18eb:	75 c3                	jne    18b0 <test_detached+0x30>
+		finished, sbrk(0) - start);
+    18ed:	83 ec 0c             	sub    $0xc,%esp
+    18f0:	6a 00                	push   $0x0
+    18f2:	e8 44 05 00 00       	call   1e3b <sbrk>
+	printf(1, "*** %d detached threads finished, heap grew %d bytes ***\n",
+    18f7:	29 f0                	sub    %esi,%eax
+    18f9:	50                   	push   %eax
+    18fa:	ff 35 60 3a 00 00    	push   0x3a60
+    1900:	68 98 2f 00 00       	push   $0x2f98
+    1905:	6a 01                	push   $0x1
+    1907:	e8 94 06 00 00       	call   1fa0 <printf>
+}
+    190c:	83 c4 20             	add    $0x20,%esp
+    190f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1912:	5b                   	pop    %ebx
+    1913:	5e                   	pop    %esi
+    1914:	5d                   	pop    %ebp
+    1915:	c3                   	ret
+    1916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    191d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001920 <test_join_many>:
+{
+    1920:	55                   	push   %ebp
+    1921:	89 e5                	mov    %esp,%ebp
+    1923:	56                   	push   %esi
+    1924:	53                   	push   %ebx
+	printf(1, "\n*** Testing join_many ***\n");
+    1925:	bb 08 00 00 00       	mov    $0x8,%ebx
+{
+    192a:	83 ec 18             	sub    $0x18,%esp
+	printf(1, "\n*** Testing join_many ***\n");
+    192d:	68 e5 2d 00 00       	push   $0x2de5
+    1932:	6a 01                	push   $0x1
+    1934:	e8 67 06 00 00       	call   1fa0 <printf>
+    1939:	83 c4 10             	add    $0x10,%esp
+    193c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+		thread_create(&detached, NULL, NULL);
+    1940:	83 ec 04             	sub    $0x4,%esp
+    1943:	6a 00                	push   $0x0
+    1945:	6a 00                	push   $0x0
+    1947:	68 70 11 00 00       	push   $0x1170
+    194c:	e8 1f 0b 00 00       	call   2470 <thread_create>
+	for(int i = 0 ; i < 2 * NBARRIER ; i++)
+    1951:	83 c4 10             	add    $0x10,%esp
+    1954:	83 eb 01             	sub    $0x1,%ebx
+    1957:	75 e7                	jne    1940 <test_join_many+0x20>
+	int pids[NBARRIER], n, joined = 0;
+    1959:	31 db                	xor    %ebx,%ebx
+    195b:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    195e:	eb 02                	jmp    1962 <test_join_many+0x42>
+		joined += n;
+    1960:	01 c3                	add    %eax,%ebx
+	while((n = thread_join_many(pids, NBARRIER)) > 0)
+    1962:	83 ec 08             	sub    $0x8,%esp
+    1965:	6a 04                	push   $0x4
+    1967:	56                   	push   %esi
+    1968:	e8 43 0e 00 00       	call   27b0 <thread_join_many>
+    196d:	83 c4 10             	add    $0x10,%esp
+    1970:	85 c0                	test   %eax,%eax
+    1972:	7f ec                	jg     1960 <test_join_many+0x40>
+	printf(1, "*** %d of %d threads joined ***\n", joined, 2 * NBARRIER);
+    1974:	6a 08                	push   $0x8
+    1976:	53                   	push   %ebx
+    1977:	68 d4 2f 00 00       	push   $0x2fd4
+    197c:	6a 01                	push   $0x1
+    197e:	e8 1d 06 00 00       	call   1fa0 <printf>
+}
+    1983:	83 c4 10             	add    $0x10,%esp
+    1986:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1989:	5b                   	pop    %ebx
+    198a:	5e                   	pop    %esi
+    198b:	5d                   	pop    %ebp
+    198c:	c3                   	ret
+    198d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001990 <test_sbrk>:
+{
+    1990:	55                   	push   %ebp
+    1991:	89 e5                	mov    %esp,%ebp
+    1993:	57                   	push   %edi
+    1994:	56                   	push   %esi
+    1995:	53                   	push   %ebx
+	for(int i = 0 ; i < NBARRIER ; i++)
+    1996:	31 db                	xor    %ebx,%ebx
+{
+    1998:	83 ec 34             	sub    $0x34,%esp
+	printf(1, "\n*** Testing sbrk from threads ***\n");
+    199b:	68 f8 2f 00 00       	push   $0x2ff8
+    19a0:	6a 01                	push   $0x1
+    19a2:	e8 f9 05 00 00       	call   1fa0 <printf>
+    19a7:	83 c4 10             	add    $0x10,%esp
+		thread_create(&grower, (void*) i, NULL);
+    19aa:	83 ec 04             	sub    $0x4,%esp
+    19ad:	6a 00                	push   $0x0
+    19af:	53                   	push   %ebx
+	for(int i = 0 ; i < NBARRIER ; i++)
+    19b0:	83 c3 01             	add    $0x1,%ebx
+		thread_create(&grower, (void*) i, NULL);
+    19b3:	68 50 12 00 00       	push   $0x1250
+    19b8:	e8 b3 0a 00 00       	call   2470 <thread_create>
+	for(int i = 0 ; i < NBARRIER ; i++)
+    19bd:	83 c4 10             	add    $0x10,%esp
+    19c0:	83 fb 04             	cmp    $0x4,%ebx
+    19c3:	75 e5                	jne    19aa <test_sbrk+0x1a>
+		thread_join();
+    19c5:	e8 e6 0c 00 00       	call   26b0 <thread_join>
+    19ca:	be 00 3a 00 00       	mov    $0x3a00,%esi
+	int fd[2], bad = 0;
+    19cf:	31 db                	xor    %ebx,%ebx
+		thread_join();
+    19d1:	e8 da 0c 00 00       	call   26b0 <thread_join>
+    19d6:	e8 d5 0c 00 00       	call   26b0 <thread_join>
+    19db:	e8 d0 0c 00 00       	call   26b0 <thread_join>
+	pipe(fd);
+    19e0:	83 ec 0c             	sub    $0xc,%esp
+    19e3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    19e6:	50                   	push   %eax
+    19e7:	e8 d7 03 00 00       	call   1dc3 <pipe>
+    19ec:	c7 45 d4 61 00 00 00 	movl   $0x61,-0x2c(%ebp)
+    19f3:	83 c4 10             	add    $0x10,%esp
+		for(int j = 0 ; j < NGROW ; j++)
+    19f6:	8d 7e e0             	lea    -0x20(%esi),%edi
+    19f9:	eb 0f                	jmp    1a0a <test_sbrk+0x7a>
+    19fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19ff:	90                   	nop
+    1a00:	83 c7 04             	add    $0x4,%edi
+				bad++;
+    1a03:	83 c3 01             	add    $0x1,%ebx
+		for(int j = 0 ; j < NGROW ; j++)
+    1a06:	39 f7                	cmp    %esi,%edi
+    1a08:	74 4e                	je     1a58 <test_sbrk+0xc8>
+			if(grown[i][j] == (char*)-1 || write(fd[1], grown[i][j], 1) != 1)
+    1a0a:	8b 07                	mov    (%edi),%eax
+    1a0c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a0f:	74 ef                	je     1a00 <test_sbrk+0x70>
+    1a11:	83 ec 04             	sub    $0x4,%esp
+    1a14:	6a 01                	push   $0x1
+    1a16:	50                   	push   %eax
+    1a17:	ff 75 e4             	push   -0x1c(%ebp)
+    1a1a:	e8 b4 03 00 00       	call   1dd3 <write>
+    1a1f:	83 c4 10             	add    $0x10,%esp
+    1a22:	83 f8 01             	cmp    $0x1,%eax
+    1a25:	75 d9                	jne    1a00 <test_sbrk+0x70>
+			if(read(fd[0], &c, 1) != 1 || c != 'a' + i)
+    1a27:	83 ec 04             	sub    $0x4,%esp
+    1a2a:	8d 45 df             	lea    -0x21(%ebp),%eax
+    1a2d:	6a 01                	push   $0x1
+    1a2f:	50                   	push   %eax
+    1a30:	ff 75 e0             	push   -0x20(%ebp)
+    1a33:	e8 93 03 00 00       	call   1dcb <read>
+    1a38:	83 c4 10             	add    $0x10,%esp
+    1a3b:	83 f8 01             	cmp    $0x1,%eax
+    1a3e:	75 c0                	jne    1a00 <test_sbrk+0x70>
+    1a40:	0f be 45 df          	movsbl -0x21(%ebp),%eax
+    1a44:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1a47:	39 d0                	cmp    %edx,%eax
+    1a49:	75 b5                	jne    1a00 <test_sbrk+0x70>
+		for(int j = 0 ; j < NGROW ; j++)
+    1a4b:	83 c7 04             	add    $0x4,%edi
+    1a4e:	39 f7                	cmp    %esi,%edi
+    1a50:	75 b8                	jne    1a0a <test_sbrk+0x7a>
+    1a52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+	for(int i = 0 ; i < NBARRIER ; i++)
+    1a58:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+    1a5c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1a5f:	8d 77 20             	lea    0x20(%edi),%esi
+    1a62:	83 f8 65             	cmp    $0x65,%eax
+    1a65:	75 8f                	jne    19f6 <test_sbrk+0x66>
+	close(fd[0]);
+    1a67:	83 ec 0c             	sub    $0xc,%esp
+    1a6a:	ff 75 e0             	push   -0x20(%ebp)
+    1a6d:	e8 69 03 00 00       	call   1ddb <close>
+	close(fd[1]);
+    1a72:	58                   	pop    %eax
+    1a73:	ff 75 e4             	push   -0x1c(%ebp)
+    1a76:	e8 60 03 00 00       	call   1ddb <close>
+	printf(1, "*** %d pages grown by threads, %d bad ***\n", NBARRIER * NGROW, bad);
+    1a7b:	53                   	push   %ebx
+    1a7c:	6a 20                	push   $0x20
+    1a7e:	68 1c 30 00 00       	push   $0x301c
+    1a83:	6a 01                	push   $0x1
+    1a85:	e8 16 05 00 00       	call   1fa0 <printf>
+}
+    1a8a:	83 c4 20             	add    $0x20,%esp
+    1a8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a90:	5b                   	pop    %ebx
+    1a91:	5e                   	pop    %esi
+    1a92:	5f                   	pop    %edi
+    1a93:	5d                   	pop    %ebp
+    1a94:	c3                   	ret
+    1a95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001aa0 <test_files>:
+{
+    1aa0:	55                   	push   %ebp
+    1aa1:	89 e5                	mov    %esp,%ebp
+    1aa3:	83 ec 20             	sub    $0x20,%esp
+	char c = 0;
+    1aa6:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+	printf(1, "\n*** Testing shared files ***\n");
+    1aaa:	68 48 30 00 00       	push   $0x3048
+    1aaf:	6a 01                	push   $0x1
+    1ab1:	e8 ea 04 00 00       	call   1fa0 <printf>
+	thread_create(&opener, NULL, NULL);
+    1ab6:	83 c4 0c             	add    $0xc,%esp
+    1ab9:	6a 00                	push   $0x0
+    1abb:	6a 00                	push   $0x0
+    1abd:	68 e0 14 00 00       	push   $0x14e0
+    1ac2:	e8 a9 09 00 00       	call   2470 <thread_create>
+	thread_join();
+    1ac7:	e8 e4 0b 00 00       	call   26b0 <thread_join>
+	if(tfd[0] < 0 || write(tfd[1], "x", 1) != 1 || read(tfd[0], &c, 1) != 1 || c != 'x')
+    1acc:	8b 15 c0 39 00 00    	mov    0x39c0,%edx
+    1ad2:	83 c4 10             	add    $0x10,%esp
+    1ad5:	85 d2                	test   %edx,%edx
+    1ad7:	78 1d                	js     1af6 <test_files+0x56>
+    1ad9:	83 ec 04             	sub    $0x4,%esp
+    1adc:	6a 01                	push   $0x1
+    1ade:	68 01 2e 00 00       	push   $0x2e01
+    1ae3:	ff 35 c4 39 00 00    	push   0x39c4
+    1ae9:	e8 e5 02 00 00       	call   1dd3 <write>
+    1aee:	83 c4 10             	add    $0x10,%esp
+    1af1:	83 f8 01             	cmp    $0x1,%eax
+    1af4:	74 3a                	je     1b30 <test_files+0x90>
+		printf(1, "*** pipe opened by a thread not usable ***\n");
+    1af6:	83 ec 08             	sub    $0x8,%esp
+    1af9:	68 68 30 00 00       	push   $0x3068
+    1afe:	6a 01                	push   $0x1
+    1b00:	e8 9b 04 00 00       	call   1fa0 <printf>
+    1b05:	83 c4 10             	add    $0x10,%esp
+	close(tfd[0]);
+    1b08:	83 ec 0c             	sub    $0xc,%esp
+    1b0b:	ff 35 c0 39 00 00    	push   0x39c0
+    1b11:	e8 c5 02 00 00       	call   1ddb <close>
+	close(tfd[1]);
+    1b16:	58                   	pop    %eax
+    1b17:	ff 35 c4 39 00 00    	push   0x39c4
+    1b1d:	e8 b9 02 00 00       	call   1ddb <close>
+}
+    1b22:	83 c4 10             	add    $0x10,%esp
+    1b25:	c9                   	leave
+    1b26:	c3                   	ret
+    1b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b2e:	66 90                	xchg   %ax,%ax
+	if(tfd[0] < 0 || write(tfd[1], "x", 1) != 1 || read(tfd[0], &c, 1) != 1 || c != 'x')
+    1b30:	83 ec 04             	sub    $0x4,%esp
+    1b33:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1b36:	6a 01                	push   $0x1
+    1b38:	50                   	push   %eax
+    1b39:	ff 35 c0 39 00 00    	push   0x39c0
+    1b3f:	e8 87 02 00 00       	call   1dcb <read>
+    1b44:	83 c4 10             	add    $0x10,%esp
+    1b47:	83 f8 01             	cmp    $0x1,%eax
+    1b4a:	75 aa                	jne    1af6 <test_files+0x56>
+    1b4c:	80 7d f7 78          	cmpb   $0x78,-0x9(%ebp)
+    1b50:	75 a4                	jne    1af6 <test_files+0x56>
+		printf(1, "*** pipe opened by a thread usable ***\n");
+    1b52:	83 ec 08             	sub    $0x8,%esp
+    1b55:	68 94 30 00 00       	push   $0x3094
+    1b5a:	6a 01                	push   $0x1
+    1b5c:	e8 3f 04 00 00       	call   1fa0 <printf>
+    1b61:	83 c4 10             	add    $0x10,%esp
+    1b64:	eb a2                	jmp    1b08 <test_files+0x68>
+    1b66:	66 90                	xchg   %ax,%ax
+    1b68:	66 90                	xchg   %ax,%ax
+    1b6a:	66 90                	xchg   %ax,%ax
+    1b6c:	66 90                	xchg   %ax,%ax
+    1b6e:	66 90                	xchg   %ax,%ax
+
+00001b70 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1b70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1b71:	31 c0                	xor    %eax,%eax
+{
+    1b73:	89 e5                	mov    %esp,%ebp
+    1b75:	53                   	push   %ebx
+    1b76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1b79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1b80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1b84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1b87:	83 c0 01             	add    $0x1,%eax
+    1b8a:	84 d2                	test   %dl,%dl
+    1b8c:	75 f2                	jne    1b80 <strcpy+0x10>
+    ;
+  return os;
+}
+    1b8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1b91:	89 c8                	mov    %ecx,%eax
+    1b93:	c9                   	leave
+    1b94:	c3                   	ret
+    1b95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001ba0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1ba0:	55                   	push   %ebp
+    1ba1:	89 e5                	mov    %esp,%ebp
+    1ba3:	53                   	push   %ebx
+    1ba4:	8b 55 08             	mov    0x8(%ebp),%edx
+    1ba7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    1baa:	0f b6 02             	movzbl (%edx),%eax
+    1bad:	84 c0                	test   %al,%al
+    1baf:	75 17                	jne    1bc8 <strcmp+0x28>
+    1bb1:	eb 3a                	jmp    1bed <strcmp+0x4d>
+    1bb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1bb7:	90                   	nop
+    1bb8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    1bbc:	83 c2 01             	add    $0x1,%edx
+    1bbf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1bc2:	84 c0                	test   %al,%al
+    1bc4:	74 1a                	je     1be0 <strcmp+0x40>
+    p++, q++;
+    1bc6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1bc8:	0f b6 19             	movzbl (%ecx),%ebx
+    1bcb:	38 c3                	cmp    %al,%bl
+    1bcd:	74 e9                	je     1bb8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    1bcf:	29 d8                	sub    %ebx,%eax
+}
+    1bd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1bd4:	c9                   	leave
+    1bd5:	c3                   	ret
+    1bd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bdd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1be0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1be4:	31 c0                	xor    %eax,%eax
+    1be6:	29 d8                	sub    %ebx,%eax
+}
+    1be8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1beb:	c9                   	leave
+    1bec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    1bed:	0f b6 19             	movzbl (%ecx),%ebx
+    1bf0:	31 c0                	xor    %eax,%eax
+    1bf2:	eb db                	jmp    1bcf <strcmp+0x2f>
+    1bf4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1bff:	90                   	nop
+
+00001c00 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1c00:	55                   	push   %ebp
+    1c01:	89 e5                	mov    %esp,%ebp
+    1c03:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1c06:	80 3a 00             	cmpb   $0x0,(%edx)
+    1c09:	74 15                	je     1c20 <strlen+0x20>
+    1c0b:	31 c0                	xor    %eax,%eax
+    1c0d:	8d 76 00             	lea    0x0(%esi),%esi
+    1c10:	83 c0 01             	add    $0x1,%eax
+    1c13:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1c17:	89 c1                	mov    %eax,%ecx
+    1c19:	75 f5                	jne    1c10 <strlen+0x10>
+    ;
+  return n;
+}
+    1c1b:	89 c8                	mov    %ecx,%eax
+    1c1d:	5d                   	pop    %ebp
+    1c1e:	c3                   	ret
+    1c1f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1c20:	31 c9                	xor    %ecx,%ecx
+}
+    1c22:	5d                   	pop    %ebp
+    1c23:	89 c8                	mov    %ecx,%eax
+    1c25:	c3                   	ret
+    1c26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001c30 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1c30:	55                   	push   %ebp
+    1c31:	89 e5                	mov    %esp,%ebp
+    1c33:	57                   	push   %edi
+    1c34:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1c37:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1c3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1c3d:	89 d7                	mov    %edx,%edi
+    1c3f:	fc                   	cld
+    1c40:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1c42:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1c45:	89 d0                	mov    %edx,%eax
+    1c47:	c9                   	leave
+    1c48:	c3                   	ret
+    1c49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c50 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1c50:	55                   	push   %ebp
+    1c51:	89 e5                	mov    %esp,%ebp
+    1c53:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c56:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    1c5a:	0f b6 10             	movzbl (%eax),%edx
+    1c5d:	84 d2                	test   %dl,%dl
+    1c5f:	75 12                	jne    1c73 <strchr+0x23>
+    1c61:	eb 1d                	jmp    1c80 <strchr+0x30>
+    1c63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c67:	90                   	nop
+    1c68:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    1c6c:	83 c0 01             	add    $0x1,%eax
+    1c6f:	84 d2                	test   %dl,%dl
+    1c71:	74 0d                	je     1c80 <strchr+0x30>
+    if(*s == c)
+    1c73:	38 d1                	cmp    %dl,%cl
+    1c75:	75 f1                	jne    1c68 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1c77:	5d                   	pop    %ebp
+    1c78:	c3                   	ret
+    1c79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1c80:	31 c0                	xor    %eax,%eax
+}
+    1c82:	5d                   	pop    %ebp
+    1c83:	c3                   	ret
+    1c84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c8f:	90                   	nop
+
+00001c90 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1c90:	55                   	push   %ebp
+    1c91:	89 e5                	mov    %esp,%ebp
+    1c93:	57                   	push   %edi
+    1c94:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1c95:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1c98:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1c99:	31 db                	xor    %ebx,%ebx
+{
+    1c9b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    1c9e:	eb 27                	jmp    1cc7 <gets+0x37>
+    cc = read(0, &c, 1);
+    1ca0:	83 ec 04             	sub    $0x4,%esp
+    1ca3:	6a 01                	push   $0x1
+    1ca5:	56                   	push   %esi
+    1ca6:	6a 00                	push   $0x0
+    1ca8:	e8 1e 01 00 00       	call   1dcb <read>
+    if(cc < 1)
+    1cad:	83 c4 10             	add    $0x10,%esp
+    1cb0:	85 c0                	test   %eax,%eax
+    1cb2:	7e 1d                	jle    1cd1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1cb4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1cb8:	8b 55 08             	mov    0x8(%ebp),%edx
+    1cbb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    1cbf:	3c 0a                	cmp    $0xa,%al
+    1cc1:	74 10                	je     1cd3 <gets+0x43>
+    1cc3:	3c 0d                	cmp    $0xd,%al
+    1cc5:	74 0c                	je     1cd3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1cc7:	89 df                	mov    %ebx,%edi
+    1cc9:	83 c3 01             	add    $0x1,%ebx
+    1ccc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1ccf:	7c cf                	jl     1ca0 <gets+0x10>
+    1cd1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1cd3:	8b 45 08             	mov    0x8(%ebp),%eax
+    1cd6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    1cda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cdd:	5b                   	pop    %ebx
+    1cde:	5e                   	pop    %esi
+    1cdf:	5f                   	pop    %edi
+    1ce0:	5d                   	pop    %ebp
+    1ce1:	c3                   	ret
+    1ce2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ce9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001cf0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1cf0:	55                   	push   %ebp
+    1cf1:	89 e5                	mov    %esp,%ebp
+    1cf3:	56                   	push   %esi
+    1cf4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1cf5:	83 ec 08             	sub    $0x8,%esp
+    1cf8:	6a 00                	push   $0x0
+    1cfa:	ff 75 08             	push   0x8(%ebp)
+    1cfd:	e8 f1 00 00 00       	call   1df3 <open>
+  if(fd < 0)
+    1d02:	83 c4 10             	add    $0x10,%esp
+    1d05:	85 c0                	test   %eax,%eax
+    1d07:	78 27                	js     1d30 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1d09:	83 ec 08             	sub    $0x8,%esp
+    1d0c:	ff 75 0c             	push   0xc(%ebp)
+    1d0f:	89 c3                	mov    %eax,%ebx
+    1d11:	50                   	push   %eax
+    1d12:	e8 f4 00 00 00       	call   1e0b <fstat>
+  close(fd);
+    1d17:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    1d1a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    1d1c:	e8 ba 00 00 00       	call   1ddb <close>
+  return r;
+    1d21:	83 c4 10             	add    $0x10,%esp
+}
+    1d24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1d27:	89 f0                	mov    %esi,%eax
+    1d29:	5b                   	pop    %ebx
+    1d2a:	5e                   	pop    %esi
+    1d2b:	5d                   	pop    %ebp
+    1d2c:	c3                   	ret
+    1d2d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1d30:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1d35:	eb ed                	jmp    1d24 <stat+0x34>
+    1d37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d3e:	66 90                	xchg   %ax,%ax
+
+00001d40 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1d40:	55                   	push   %ebp
+    1d41:	89 e5                	mov    %esp,%ebp
+    1d43:	53                   	push   %ebx
+    1d44:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1d47:	0f be 02             	movsbl (%edx),%eax
+    1d4a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    1d4d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1d50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1d55:	77 1e                	ja     1d75 <atoi+0x35>
+    1d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d5e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1d60:	83 c2 01             	add    $0x1,%edx
+    1d63:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1d66:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    1d6a:	0f be 02             	movsbl (%edx),%eax
+    1d6d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1d70:	80 fb 09             	cmp    $0x9,%bl
+    1d73:	76 eb                	jbe    1d60 <atoi+0x20>
+  return n;
+}
+    1d75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1d78:	89 c8                	mov    %ecx,%eax
+    1d7a:	c9                   	leave
+    1d7b:	c3                   	ret
+    1d7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001d80 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1d80:	55                   	push   %ebp
+    1d81:	89 e5                	mov    %esp,%ebp
+    1d83:	57                   	push   %edi
+    1d84:	56                   	push   %esi
+    1d85:	8b 45 10             	mov    0x10(%ebp),%eax
+    1d88:	8b 55 08             	mov    0x8(%ebp),%edx
+    1d8b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    1d8e:	85 c0                	test   %eax,%eax
+    1d90:	7e 13                	jle    1da5 <memmove+0x25>
+    1d92:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1d94:	89 d7                	mov    %edx,%edi
+    1d96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d9d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1da0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1da1:	39 f8                	cmp    %edi,%eax
+    1da3:	75 fb                	jne    1da0 <memmove+0x20>
+  return vdst;
+}
+    1da5:	5e                   	pop    %esi
+    1da6:	89 d0                	mov    %edx,%eax
+    1da8:	5f                   	pop    %edi
+    1da9:	5d                   	pop    %ebp
+    1daa:	c3                   	ret
+
+00001dab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    1dab:	b8 01 00 00 00       	mov    $0x1,%eax
+    1db0:	cd 40                	int    $0x40
+    1db2:	c3                   	ret
+
+00001db3 <exit>:
+SYSCALL(exit)
+    1db3:	b8 02 00 00 00       	mov    $0x2,%eax
+    1db8:	cd 40                	int    $0x40
+    1dba:	c3                   	ret
+
+00001dbb <wait>:
+SYSCALL(wait)
+    1dbb:	b8 03 00 00 00       	mov    $0x3,%eax
+    1dc0:	cd 40                	int    $0x40
+    1dc2:	c3                   	ret
+
+00001dc3 <pipe>:
+SYSCALL(pipe)
+    1dc3:	b8 04 00 00 00       	mov    $0x4,%eax
+    1dc8:	cd 40                	int    $0x40
+    1dca:	c3                   	ret
+
+00001dcb <read>:
+SYSCALL(read)
+    1dcb:	b8 05 00 00 00       	mov    $0x5,%eax
+    1dd0:	cd 40                	int    $0x40
+    1dd2:	c3                   	ret
+
+00001dd3 <write>:
+SYSCALL(write)
+    1dd3:	b8 10 00 00 00       	mov    $0x10,%eax
+    1dd8:	cd 40                	int    $0x40
+    1dda:	c3                   	ret
+
+00001ddb <close>:
+SYSCALL(close)
+    1ddb:	b8 15 00 00 00       	mov    $0x15,%eax
+    1de0:	cd 40                	int    $0x40
+    1de2:	c3                   	ret
+
+00001de3 <kill>:
+SYSCALL(kill)
+    1de3:	b8 06 00 00 00       	mov    $0x6,%eax
+    1de8:	cd 40                	int    $0x40
+    1dea:	c3                   	ret
+
+00001deb <exec>:
+SYSCALL(exec)
+    1deb:	b8 07 00 00 00       	mov    $0x7,%eax
+    1df0:	cd 40                	int    $0x40
+    1df2:	c3                   	ret
+
+00001df3 <open>:
+SYSCALL(open)
+    1df3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1df8:	cd 40                	int    $0x40
+    1dfa:	c3                   	ret
+
+00001dfb <mknod>:
+SYSCALL(mknod)
+    1dfb:	b8 11 00 00 00       	mov    $0x11,%eax
+    1e00:	cd 40                	int    $0x40
+    1e02:	c3                   	ret
+
+00001e03 <unlink>:
+SYSCALL(unlink)
+    1e03:	b8 12 00 00 00       	mov    $0x12,%eax
+    1e08:	cd 40                	int    $0x40
+    1e0a:	c3                   	ret
+
+00001e0b <fstat>:
+SYSCALL(fstat)
+    1e0b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1e10:	cd 40                	int    $0x40
+    1e12:	c3                   	ret
+
+00001e13 <link>:
+SYSCALL(link)
+    1e13:	b8 13 00 00 00       	mov    $0x13,%eax
+    1e18:	cd 40                	int    $0x40
+    1e1a:	c3                   	ret
+
+00001e1b <mkdir>:
+SYSCALL(mkdir)
+    1e1b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1e20:	cd 40                	int    $0x40
+    1e22:	c3                   	ret
+
+00001e23 <chdir>:
+SYSCALL(chdir)
+    1e23:	b8 09 00 00 00       	mov    $0x9,%eax
+    1e28:	cd 40                	int    $0x40
+    1e2a:	c3                   	ret
+
+00001e2b <dup>:
+SYSCALL(dup)
+    1e2b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1e30:	cd 40                	int    $0x40
+    1e32:	c3                   	ret
+
+00001e33 <getpid>:
+SYSCALL(getpid)
+    1e33:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1e38:	cd 40                	int    $0x40
+    1e3a:	c3                   	ret
+
+00001e3b <sbrk>:
+SYSCALL(sbrk)
+    1e3b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1e40:	cd 40                	int    $0x40
+    1e42:	c3                   	ret
+
+00001e43 <sleep>:
+SYSCALL(sleep)
+    1e43:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1e48:	cd 40                	int    $0x40
+    1e4a:	c3                   	ret
+
+00001e4b <uptime>:
+SYSCALL(uptime)
+    1e4b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1e50:	cd 40                	int    $0x40
+    1e52:	c3                   	ret
+
+00001e53 <settickets>:
+SYSCALL(settickets)
+    1e53:	b8 16 00 00 00       	mov    $0x16,%eax
+    1e58:	cd 40                	int    $0x40
+    1e5a:	c3                   	ret
+
+00001e5b <getpinfo>:
+SYSCALL(getpinfo)
+    1e5b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1e60:	cd 40                	int    $0x40
+    1e62:	c3                   	ret
+
+00001e63 <mprotect>:
+SYSCALL(mprotect)
+    1e63:	b8 18 00 00 00       	mov    $0x18,%eax
+    1e68:	cd 40                	int    $0x40
+    1e6a:	c3                   	ret
+
+00001e6b <munprotect>:
+SYSCALL(munprotect)
+    1e6b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1e70:	cd 40                	int    $0x40
+    1e72:	c3                   	ret
+
+00001e73 <clone>:
+SYSCALL(clone)
+    1e73:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1e78:	cd 40                	int    $0x40
+    1e7a:	c3                   	ret
+
+00001e7b <join>:
+SYSCALL(join)
+    1e7b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1e80:	cd 40                	int    $0x40
+    1e82:	c3                   	ret
+
+00001e83 <initlock_t>:
+SYSCALL(initlock_t)
+    1e83:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1e88:	cd 40                	int    $0x40
+    1e8a:	c3                   	ret
+
+00001e8b <acquire_t>:
+SYSCALL(acquire_t)
+    1e8b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1e90:	cd 40                	int    $0x40
+    1e92:	c3                   	ret
+
+00001e93 <release_t>:
+SYSCALL(release_t)
+    1e93:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1e98:	cd 40                	int    $0x40
+    1e9a:	c3                   	ret
+
+00001e9b <setsched>:
+SYSCALL(setsched)
+    1e9b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1ea0:	cd 40                	int    $0x40
+    1ea2:	c3                   	ret
+
+00001ea3 <mkgroup>:
+SYSCALL(mkgroup)
+    1ea3:	b8 20 00 00 00       	mov    $0x20,%eax
+    1ea8:	cd 40                	int    $0x40
+    1eaa:	c3                   	ret
+
+00001eab <joingroup>:
+SYSCALL(joingroup)
+    1eab:	b8 21 00 00 00       	mov    $0x21,%eax
+    1eb0:	cd 40                	int    $0x40
+    1eb2:	c3                   	ret
+
+00001eb3 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1eb3:	b8 22 00 00 00       	mov    $0x22,%eax
+    1eb8:	cd 40                	int    $0x40
+    1eba:	c3                   	ret
+
+00001ebb <setdeadline>:
+SYSCALL(setdeadline)
+    1ebb:	b8 23 00 00 00       	mov    $0x23,%eax
+    1ec0:	cd 40                	int    $0x40
+    1ec2:	c3                   	ret
+
+00001ec3 <setaffinity>:
+SYSCALL(setaffinity)
+    1ec3:	b8 24 00 00 00       	mov    $0x24,%eax
+    1ec8:	cd 40                	int    $0x40
+    1eca:	c3                   	ret
+
+00001ecb <yield_to>:
+SYSCALL(yield_to)
+    1ecb:	b8 25 00 00 00       	mov    $0x25,%eax
+    1ed0:	cd 40                	int    $0x40
+    1ed2:	c3                   	ret
+
+00001ed3 <getlatency>:
+SYSCALL(getlatency)
+    1ed3:	b8 26 00 00 00       	mov    $0x26,%eax
+    1ed8:	cd 40                	int    $0x40
+    1eda:	c3                   	ret
+
+00001edb <futex_wait>:
+SYSCALL(futex_wait)
+    1edb:	b8 27 00 00 00       	mov    $0x27,%eax
+    1ee0:	cd 40                	int    $0x40
+    1ee2:	c3                   	ret
+
+00001ee3 <futex_wake>:
+SYSCALL(futex_wake)
+    1ee3:	b8 28 00 00 00       	mov    $0x28,%eax
+    1ee8:	cd 40                	int    $0x40
+    1eea:	c3                   	ret
+
+00001eeb <mguard>:
+SYSCALL(mguard)
+    1eeb:	b8 29 00 00 00       	mov    $0x29,%eax
+    1ef0:	cd 40                	int    $0x40
+    1ef2:	c3                   	ret
+
+00001ef3 <join_any>:
+SYSCALL(join_any)
+    1ef3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1ef8:	cd 40                	int    $0x40
+    1efa:	c3                   	ret
+    1efb:	66 90                	xchg   %ax,%ax
+    1efd:	66 90                	xchg   %ax,%ax
+    1eff:	90                   	nop
+
+00001f00 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1f00:	55                   	push   %ebp
+    1f01:	89 e5                	mov    %esp,%ebp
+    1f03:	57                   	push   %edi
+    1f04:	56                   	push   %esi
+    1f05:	53                   	push   %ebx
+    1f06:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1f08:	89 d1                	mov    %edx,%ecx
+{
+    1f0a:	83 ec 3c             	sub    $0x3c,%esp
+    1f0d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1f10:	85 d2                	test   %edx,%edx
+    1f12:	0f 89 80 00 00 00    	jns    1f98 <printint+0x98>
+    1f18:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    1f1c:	74 7a                	je     1f98 <printint+0x98>
+    x = -xx;
+    1f1e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1f20:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1f25:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1f28:	31 f6                	xor    %esi,%esi
+    1f2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1f30:	89 c8                	mov    %ecx,%eax
+    1f32:	31 d2                	xor    %edx,%edx
+    1f34:	89 f7                	mov    %esi,%edi
+    1f36:	f7 f3                	div    %ebx
+    1f38:	8d 76 01             	lea    0x1(%esi),%esi
+    1f3b:	0f b6 92 1c 31 00 00 	movzbl 0x311c(%edx),%edx
+    1f42:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1f46:	89 ca                	mov    %ecx,%edx
+    1f48:	89 c1                	mov    %eax,%ecx
+    1f4a:	39 da                	cmp    %ebx,%edx
+    1f4c:	73 e2                	jae    1f30 <printint+0x30>
+  if(neg)
+    1f4e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1f51:	85 c0                	test   %eax,%eax
+    1f53:	74 07                	je     1f5c <printint+0x5c>
+    buf[i++] = '-';
+    1f55:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    1f5a:	89 f7                	mov    %esi,%edi
+    1f5c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1f5f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1f62:	01 df                	add    %ebx,%edi
+    1f64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1f68:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    1f6b:	83 ec 04             	sub    $0x4,%esp
+    1f6e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1f71:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1f74:	6a 01                	push   $0x1
+    1f76:	50                   	push   %eax
+    1f77:	56                   	push   %esi
+    1f78:	e8 56 fe ff ff       	call   1dd3 <write>
+  while(--i >= 0)
+    1f7d:	89 f8                	mov    %edi,%eax
+    1f7f:	83 c4 10             	add    $0x10,%esp
+    1f82:	83 ef 01             	sub    $0x1,%edi
+    1f85:	39 d8                	cmp    %ebx,%eax
+    1f87:	75 df                	jne    1f68 <printint+0x68>
+}
+    1f89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f8c:	5b                   	pop    %ebx
+    1f8d:	5e                   	pop    %esi
+    1f8e:	5f                   	pop    %edi
+    1f8f:	5d                   	pop    %ebp
+    1f90:	c3                   	ret
+    1f91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1f98:	31 c0                	xor    %eax,%eax
+    1f9a:	eb 89                	jmp    1f25 <printint+0x25>
+    1f9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001fa0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1fa0:	55                   	push   %ebp
+    1fa1:	89 e5                	mov    %esp,%ebp
+    1fa3:	57                   	push   %edi
+    1fa4:	56                   	push   %esi
+    1fa5:	53                   	push   %ebx
+    1fa6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1fa9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    1fac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    1faf:	0f b6 1e             	movzbl (%esi),%ebx
+    1fb2:	83 c6 01             	add    $0x1,%esi
+    1fb5:	84 db                	test   %bl,%bl
+    1fb7:	74 67                	je     2020 <printf+0x80>
+    1fb9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    1fbc:	31 d2                	xor    %edx,%edx
+    1fbe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1fc1:	eb 34                	jmp    1ff7 <printf+0x57>
+    1fc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1fc7:	90                   	nop
+    1fc8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    1fcb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1fd0:	83 f8 25             	cmp    $0x25,%eax
+    1fd3:	74 18                	je     1fed <printf+0x4d>
+  write(fd, &c, 1);
+    1fd5:	83 ec 04             	sub    $0x4,%esp
+    1fd8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1fdb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1fde:	6a 01                	push   $0x1
+    1fe0:	50                   	push   %eax
+    1fe1:	57                   	push   %edi
+    1fe2:	e8 ec fd ff ff       	call   1dd3 <write>
+    1fe7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    1fea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    1fed:	0f b6 1e             	movzbl (%esi),%ebx
+    1ff0:	83 c6 01             	add    $0x1,%esi
+    1ff3:	84 db                	test   %bl,%bl
+    1ff5:	74 29                	je     2020 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1ff7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    1ffa:	85 d2                	test   %edx,%edx
+    1ffc:	74 ca                	je     1fc8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    1ffe:	83 fa 25             	cmp    $0x25,%edx
+    2001:	75 ea                	jne    1fed <printf+0x4d>
+      if(c == 'd'){
+    2003:	83 f8 25             	cmp    $0x25,%eax
+    2006:	0f 84 24 01 00 00    	je     2130 <printf+0x190>
+    200c:	83 e8 63             	sub    $0x63,%eax
+    200f:	83 f8 15             	cmp    $0x15,%eax
+    2012:	77 1c                	ja     2030 <printf+0x90>
+    2014:	ff 24 85 c4 30 00 00 	jmp    *0x30c4(,%eax,4)
+    201b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    201f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    2020:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2023:	5b                   	pop    %ebx
+    2024:	5e                   	pop    %esi
+    2025:	5f                   	pop    %edi
+    2026:	5d                   	pop    %ebp
+    2027:	c3                   	ret
+    2028:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    202f:	90                   	nop
+  write(fd, &c, 1);
+    2030:	83 ec 04             	sub    $0x4,%esp
+    2033:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    2036:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    203a:	6a 01                	push   $0x1
+    203c:	52                   	push   %edx
+    203d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    2040:	57                   	push   %edi
+    2041:	e8 8d fd ff ff       	call   1dd3 <write>
+    2046:	83 c4 0c             	add    $0xc,%esp
+    2049:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    204c:	6a 01                	push   $0x1
+    204e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    2051:	52                   	push   %edx
+    2052:	57                   	push   %edi
+    2053:	e8 7b fd ff ff       	call   1dd3 <write>
+        putc(fd, c);
+    2058:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    205b:	31 d2                	xor    %edx,%edx
+    205d:	eb 8e                	jmp    1fed <printf+0x4d>
+    205f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    2060:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    2063:	83 ec 0c             	sub    $0xc,%esp
+    2066:	b9 10 00 00 00       	mov    $0x10,%ecx
+    206b:	8b 13                	mov    (%ebx),%edx
+    206d:	6a 00                	push   $0x0
+    206f:	89 f8                	mov    %edi,%eax
+        ap++;
+    2071:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    2074:	e8 87 fe ff ff       	call   1f00 <printint>
+        ap++;
+    2079:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    207c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    207f:	31 d2                	xor    %edx,%edx
+    2081:	e9 67 ff ff ff       	jmp    1fed <printf+0x4d>
+    2086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    208d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    2090:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    2093:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    2095:	83 c0 04             	add    $0x4,%eax
+    2098:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    209b:	85 db                	test   %ebx,%ebx
+    209d:	0f 84 9d 00 00 00    	je     2140 <printf+0x1a0>
+        while(*s != 0){
+    20a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    20a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    20a8:	84 c0                	test   %al,%al
+    20aa:	0f 84 3d ff ff ff    	je     1fed <printf+0x4d>
+    20b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    20b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    20b6:	89 de                	mov    %ebx,%esi
+    20b8:	89 d3                	mov    %edx,%ebx
+    20ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    20c0:	83 ec 04             	sub    $0x4,%esp
+    20c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    20c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    20c9:	6a 01                	push   $0x1
+    20cb:	53                   	push   %ebx
+    20cc:	57                   	push   %edi
+    20cd:	e8 01 fd ff ff       	call   1dd3 <write>
+        while(*s != 0){
+    20d2:	0f b6 06             	movzbl (%esi),%eax
+    20d5:	83 c4 10             	add    $0x10,%esp
+    20d8:	84 c0                	test   %al,%al
+    20da:	75 e4                	jne    20c0 <printf+0x120>
+      state = 0;
+    20dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    20df:	31 d2                	xor    %edx,%edx
+    20e1:	e9 07 ff ff ff       	jmp    1fed <printf+0x4d>
+    20e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    20f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    20f3:	83 ec 0c             	sub    $0xc,%esp
+    20f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    20fb:	8b 13                	mov    (%ebx),%edx
+    20fd:	6a 01                	push   $0x1
+    20ff:	e9 6b ff ff ff       	jmp    206f <printf+0xcf>
+    2104:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    2108:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    210b:	83 ec 04             	sub    $0x4,%esp
+    210e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    2111:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    2113:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    2116:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    2119:	6a 01                	push   $0x1
+    211b:	52                   	push   %edx
+    211c:	57                   	push   %edi
+    211d:	e8 b1 fc ff ff       	call   1dd3 <write>
+        ap++;
+    2122:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    2125:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    2128:	31 d2                	xor    %edx,%edx
+    212a:	e9 be fe ff ff       	jmp    1fed <printf+0x4d>
+    212f:	90                   	nop
+  write(fd, &c, 1);
+    2130:	83 ec 04             	sub    $0x4,%esp
+    2133:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    2136:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    2139:	6a 01                	push   $0x1
+    213b:	e9 11 ff ff ff       	jmp    2051 <printf+0xb1>
+    2140:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    2145:	bb bc 30 00 00       	mov    $0x30bc,%ebx
+    214a:	e9 61 ff ff ff       	jmp    20b0 <printf+0x110>
+    214f:	90                   	nop
+
+00002150 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2150:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2151:	a1 e0 3a 00 00       	mov    0x3ae0,%eax
+{
+    2156:	89 e5                	mov    %esp,%ebp
+    2158:	57                   	push   %edi
+    2159:	56                   	push   %esi
+    215a:	53                   	push   %ebx
+    215b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    215e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2161:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2168:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    216a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    216c:	39 ca                	cmp    %ecx,%edx
+    216e:	73 30                	jae    21a0 <free+0x50>
+    2170:	39 c1                	cmp    %eax,%ecx
+    2172:	72 04                	jb     2178 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2174:	39 c2                	cmp    %eax,%edx
+    2176:	72 f0                	jb     2168 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2178:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    217b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    217e:	39 f8                	cmp    %edi,%eax
+    2180:	74 2e                	je     21b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2182:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2185:	8b 42 04             	mov    0x4(%edx),%eax
+    2188:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    218b:	39 f1                	cmp    %esi,%ecx
+    218d:	74 38                	je     21c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    218f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2191:	5b                   	pop    %ebx
+  freep = p;
+    2192:	89 15 e0 3a 00 00    	mov    %edx,0x3ae0
+}
+    2198:	5e                   	pop    %esi
+    2199:	5f                   	pop    %edi
+    219a:	5d                   	pop    %ebp
+    219b:	c3                   	ret
+    219c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    21a0:	39 c1                	cmp    %eax,%ecx
+    21a2:	72 d0                	jb     2174 <free+0x24>
+    21a4:	eb c2                	jmp    2168 <free+0x18>
+    21a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    21b0:	03 70 04             	add    0x4(%eax),%esi
+    21b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    21b6:	8b 02                	mov    (%edx),%eax
+    21b8:	8b 00                	mov    (%eax),%eax
+    21ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    21bd:	8b 42 04             	mov    0x4(%edx),%eax
+    21c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    21c3:	39 f1                	cmp    %esi,%ecx
+    21c5:	75 c8                	jne    218f <free+0x3f>
+    p->s.size += bp->s.size;
+    21c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    21ca:	89 15 e0 3a 00 00    	mov    %edx,0x3ae0
+    p->s.size += bp->s.size;
+    21d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    21d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    21d6:	89 0a                	mov    %ecx,(%edx)
+}
+    21d8:	5b                   	pop    %ebx
+    21d9:	5e                   	pop    %esi
+    21da:	5f                   	pop    %edi
+    21db:	5d                   	pop    %ebp
+    21dc:	c3                   	ret
+    21dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000021e0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    21e0:	55                   	push   %ebp
+    21e1:	89 e5                	mov    %esp,%ebp
+    21e3:	57                   	push   %edi
+    21e4:	56                   	push   %esi
+    21e5:	53                   	push   %ebx
+    21e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    21e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    21ec:	8b 15 e0 3a 00 00    	mov    0x3ae0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    21f2:	8d 78 07             	lea    0x7(%eax),%edi
+    21f5:	c1 ef 03             	shr    $0x3,%edi
+    21f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    21fb:	85 d2                	test   %edx,%edx
+    21fd:	0f 84 8d 00 00 00    	je     2290 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2203:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2205:	8b 48 04             	mov    0x4(%eax),%ecx
+    2208:	39 f9                	cmp    %edi,%ecx
+    220a:	73 64                	jae    2270 <malloc+0x90>
+  if(nu < 4096)
+    220c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2211:	39 df                	cmp    %ebx,%edi
+    2213:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2216:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    221d:	eb 0a                	jmp    2229 <malloc+0x49>
+    221f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2220:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2222:	8b 48 04             	mov    0x4(%eax),%ecx
+    2225:	39 f9                	cmp    %edi,%ecx
+    2227:	73 47                	jae    2270 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2229:	89 c2                	mov    %eax,%edx
+    222b:	39 05 e0 3a 00 00    	cmp    %eax,0x3ae0
+    2231:	75 ed                	jne    2220 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2233:	83 ec 0c             	sub    $0xc,%esp
+    2236:	56                   	push   %esi
+    2237:	e8 ff fb ff ff       	call   1e3b <sbrk>
+  if(p == (char*)-1)
+    223c:	83 c4 10             	add    $0x10,%esp
+    223f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2242:	74 1c                	je     2260 <malloc+0x80>
+  hp->s.size = nu;
+    2244:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2247:	83 ec 0c             	sub    $0xc,%esp
+    224a:	83 c0 08             	add    $0x8,%eax
+    224d:	50                   	push   %eax
+    224e:	e8 fd fe ff ff       	call   2150 <free>
+  return freep;
+    2253:	8b 15 e0 3a 00 00    	mov    0x3ae0,%edx
+      if((p = morecore(nunits)) == 0)
+    2259:	83 c4 10             	add    $0x10,%esp
+    225c:	85 d2                	test   %edx,%edx
+    225e:	75 c0                	jne    2220 <malloc+0x40>
+        return 0;
+  }
+}
+    2260:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2263:	31 c0                	xor    %eax,%eax
+}
+    2265:	5b                   	pop    %ebx
+    2266:	5e                   	pop    %esi
+    2267:	5f                   	pop    %edi
+    2268:	5d                   	pop    %ebp
+    2269:	c3                   	ret
+    226a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    2270:	39 cf                	cmp    %ecx,%edi
+    2272:	74 4c                	je     22c0 <malloc+0xe0>
+        p->s.size -= nunits;
+    2274:	29 f9                	sub    %edi,%ecx
+    2276:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    2279:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    227c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    227f:	89 15 e0 3a 00 00    	mov    %edx,0x3ae0
+}
+    2285:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2288:	83 c0 08             	add    $0x8,%eax
+}
+    228b:	5b                   	pop    %ebx
+    228c:	5e                   	pop    %esi
+    228d:	5f                   	pop    %edi
+    228e:	5d                   	pop    %ebp
+    228f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2290:	c7 05 e0 3a 00 00 e4 	movl   $0x3ae4,0x3ae0
+    2297:	3a 00 00 
+    base.s.size = 0;
+    229a:	b8 e4 3a 00 00       	mov    $0x3ae4,%eax
+    base.s.ptr = freep = prevp = &base;
+    229f:	c7 05 e4 3a 00 00 e4 	movl   $0x3ae4,0x3ae4
+    22a6:	3a 00 00 
+    base.s.size = 0;
+    22a9:	c7 05 e8 3a 00 00 00 	movl   $0x0,0x3ae8
+    22b0:	00 00 00 
+    if(p->s.size >= nunits){
+    22b3:	e9 54 ff ff ff       	jmp    220c <malloc+0x2c>
+    22b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    22c0:	8b 08                	mov    (%eax),%ecx
+    22c2:	89 0a                	mov    %ecx,(%edx)
+    22c4:	eb b9                	jmp    227f <malloc+0x9f>
+    22c6:	66 90                	xchg   %ax,%ax
+    22c8:	66 90                	xchg   %ax,%ax
+    22ca:	66 90                	xchg   %ax,%ax
+    22cc:	66 90                	xchg   %ax,%ax
+    22ce:	66 90                	xchg   %ax,%ax
+
+000022d0 <stack_alloc>:
+
+static struct ticketlock stacklock;
+static void *stackpool;
+
+static void *stack_alloc(void)
+{
+    22d0:	55                   	push   %ebp
+    22d1:	89 e5                	mov    %esp,%ebp
+    22d3:	57                   	push   %edi
+    22d4:	56                   	push   %esi
+    22d5:	53                   	push   %ebx
+  asm volatile("lock; xaddl %0, %1"
+    22d6:	bb 01 00 00 00       	mov    $0x1,%ebx
+    22db:	83 ec 5c             	sub    $0x5c,%esp
+    22de:	f0 0f c1 1d 04 3c 00 	lock xadd %ebx,0x3c04
+    22e5:	00 
+#define NTURNWAIT 64
+static int turnwait[NTURNWAIT];
+
+static int *turnslot(struct ticketlock *lock, int ticket)
+{
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    22e6:	b8 04 3c 00 00       	mov    $0x3c04,%eax
+    22eb:	c1 e8 02             	shr    $0x2,%eax
+    22ee:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    22f1:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+    22f4:	83 e6 3f             	and    $0x3f,%esi
+    int myTicket = fetch_and_add(&lock->next_ticket, 1);
+    int *w = turnslot(lock, myTicket);
+    int seq;
+
+    for(;;){
+        seq = *(volatile int*)w;
+    22f7:	8b 04 b5 00 3b 00 00 	mov    0x3b00(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    22fe:	8b 15 08 3c 00 00    	mov    0x3c08,%edx
+    2304:	8d 3c b5 00 3b 00 00 	lea    0x3b00(,%esi,4),%edi
+    230b:	39 d3                	cmp    %edx,%ebx
+    230d:	74 1f                	je     232e <stack_alloc+0x5e>
+    230f:	90                   	nop
+            break;
+        futex_wait(w, seq);
+    2310:	83 ec 08             	sub    $0x8,%esp
+    2313:	50                   	push   %eax
+    2314:	57                   	push   %edi
+    2315:	e8 c1 fb ff ff       	call   1edb <futex_wait>
+        seq = *(volatile int*)w;
+    231a:	8b 04 b5 00 3b 00 00 	mov    0x3b00(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2321:	83 c4 10             	add    $0x10,%esp
+    2324:	8b 15 08 3c 00 00    	mov    0x3c08,%edx
+    232a:	39 d3                	cmp    %edx,%ebx
+    232c:	75 e2                	jne    2310 <stack_alloc+0x40>
+	if(stackpool == 0){
+    232e:	8b 35 00 3c 00 00    	mov    0x3c00,%esi
+    2334:	85 f6                	test   %esi,%esi
+    2336:	74 68                	je     23a0 <stack_alloc+0xd0>
+		stackpool = *(void**)p;
+    2338:	8b 06                	mov    (%esi),%eax
+    233a:	a3 00 3c 00 00       	mov    %eax,0x3c00
+    233f:	ba 01 00 00 00       	mov    $0x1,%edx
+    2344:	89 d0                	mov    %edx,%eax
+    2346:	f0 0f c1 05 08 3c 00 	lock xadd %eax,0x3c08
+    234d:	00 
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    int *w;
+
+    // Only bump and wake the next ticket's word if someone
+    // holds that ticket; it may or may not be asleep yet.
+    if (turn != *(volatile int*)&lock->next_ticket){
+    234e:	8b 0d 04 3c 00 00    	mov    0x3c04,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    2354:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2357:	39 c8                	cmp    %ecx,%eax
+    2359:	75 0d                	jne    2368 <stack_alloc+0x98>
+}
+    235b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    235e:	89 f0                	mov    %esi,%eax
+    2360:	5b                   	pop    %ebx
+    2361:	5e                   	pop    %esi
+    2362:	5f                   	pop    %edi
+    2363:	5d                   	pop    %ebp
+    2364:	c3                   	ret
+    2365:	8d 76 00             	lea    0x0(%esi),%esi
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2368:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+    236b:	01 c8                	add    %ecx,%eax
+    236d:	83 e0 3f             	and    $0x3f,%eax
+    2370:	8d 0c 85 00 3b 00 00 	lea    0x3b00(,%eax,4),%ecx
+    2377:	f0 0f c1 14 85 00 3b 	lock xadd %edx,0x3b00(,%eax,4)
+    237e:	00 00 
+        w = turnslot(lock, turn);
+        fetch_and_add(w, 1);
+        futex_wake(w, NPROC);
+    2380:	83 ec 08             	sub    $0x8,%esp
+    2383:	68 00 04 00 00       	push   $0x400
+    2388:	51                   	push   %ecx
+    2389:	e8 55 fb ff ff       	call   1ee3 <futex_wake>
+    238e:	83 c4 10             	add    $0x10,%esp
+}
+    2391:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2394:	89 f0                	mov    %esi,%eax
+    2396:	5b                   	pop    %ebx
+    2397:	5e                   	pop    %esi
+    2398:	5f                   	pop    %edi
+    2399:	5d                   	pop    %ebp
+    239a:	c3                   	ret
+    239b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    239f:	90                   	nop
+		n = join_any(pids, stacks, NREAP, JOIN_NOHANG | JOIN_DETACHED);
+    23a0:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+    23a3:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    23a6:	6a 03                	push   $0x3
+    23a8:	6a 08                	push   $0x8
+    23aa:	53                   	push   %ebx
+    23ab:	50                   	push   %eax
+    23ac:	e8 42 fb ff ff       	call   1ef3 <join_any>
+		for(i = 0; i < n; i++){
+    23b1:	8b 35 00 3c 00 00    	mov    0x3c00,%esi
+    23b7:	83 c4 10             	add    $0x10,%esp
+    23ba:	89 da                	mov    %ebx,%edx
+    23bc:	8d 0c 83             	lea    (%ebx,%eax,4),%ecx
+    23bf:	85 c0                	test   %eax,%eax
+    23c1:	7e 19                	jle    23dc <stack_alloc+0x10c>
+    23c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    23c7:	90                   	nop
+			*(void**)stacks[i] = stackpool;
+    23c8:	8b 02                	mov    (%edx),%eax
+		for(i = 0; i < n; i++){
+    23ca:	83 c2 04             	add    $0x4,%edx
+			*(void**)stacks[i] = stackpool;
+    23cd:	89 30                	mov    %esi,(%eax)
+			stackpool = stacks[i];
+    23cf:	8b 72 fc             	mov    -0x4(%edx),%esi
+		for(i = 0; i < n; i++){
+    23d2:	39 ca                	cmp    %ecx,%edx
+    23d4:	75 f2                	jne    23c8 <stack_alloc+0xf8>
+    23d6:	89 35 00 3c 00 00    	mov    %esi,0x3c00
+	if((p = stackpool) != 0){
+    23dc:	85 f6                	test   %esi,%esi
+    23de:	0f 85 54 ff ff ff    	jne    2338 <stack_alloc+0x68>
+	if((p = sbrk((TSTACKPAGES + 2) * PGSIZE)) == (char*)-1){
+    23e4:	83 ec 0c             	sub    $0xc,%esp
+    23e7:	68 00 60 00 00       	push   $0x6000
+    23ec:	e8 4a fa ff ff       	call   1e3b <sbrk>
+    23f1:	83 c4 10             	add    $0x10,%esp
+    23f4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    23f7:	0f 84 42 ff ff ff    	je     233f <stack_alloc+0x6f>
+	p += (PGSIZE - (uint)p % PGSIZE) % PGSIZE;
+    23fd:	89 c2                	mov    %eax,%edx
+	mguard(p, 1);
+    23ff:	83 ec 08             	sub    $0x8,%esp
+	p += (PGSIZE - (uint)p % PGSIZE) % PGSIZE;
+    2402:	f7 da                	neg    %edx
+	mguard(p, 1);
+    2404:	6a 01                	push   $0x1
+	p += (PGSIZE - (uint)p % PGSIZE) % PGSIZE;
+    2406:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+    240c:	8d 34 10             	lea    (%eax,%edx,1),%esi
+	mguard(p, 1);
+    240f:	56                   	push   %esi
+    2410:	e8 d6 fa ff ff       	call   1eeb <mguard>
+    2415:	ba 01 00 00 00       	mov    $0x1,%edx
+    241a:	89 d0                	mov    %edx,%eax
+    241c:	f0 0f c1 05 08 3c 00 	lock xadd %eax,0x3c08
+    2423:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2424:	8b 0d 04 3c 00 00    	mov    0x3c04,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    242a:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    242d:	83 c4 10             	add    $0x10,%esp
+    2430:	39 c8                	cmp    %ecx,%eax
+    2432:	74 29                	je     245d <stack_alloc+0x18d>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2434:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+    2437:	01 c8                	add    %ecx,%eax
+    2439:	83 e0 3f             	and    $0x3f,%eax
+    243c:	8d 0c 85 00 3b 00 00 	lea    0x3b00(,%eax,4),%ecx
+    2443:	f0 0f c1 14 85 00 3b 	lock xadd %edx,0x3b00(,%eax,4)
+    244a:	00 00 
+        futex_wake(w, NPROC);
+    244c:	83 ec 08             	sub    $0x8,%esp
+    244f:	68 00 04 00 00       	push   $0x400
+    2454:	51                   	push   %ecx
+    2455:	e8 89 fa ff ff       	call   1ee3 <futex_wake>
+    245a:	83 c4 10             	add    $0x10,%esp
+}
+    245d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+	return p + TSTACKPAGES * PGSIZE;
+    2460:	81 c6 00 40 00 00    	add    $0x4000,%esi
+}
+    2466:	5b                   	pop    %ebx
+    2467:	89 f0                	mov    %esi,%eax
+    2469:	5e                   	pop    %esi
+    246a:	5f                   	pop    %edi
+    246b:	5d                   	pop    %ebp
+    246c:	c3                   	ret
+    246d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002470 <thread_create>:
+{
+    2470:	55                   	push   %ebp
+    2471:	89 e5                	mov    %esp,%ebp
+    2473:	57                   	push   %edi
+    2474:	56                   	push   %esi
+    2475:	53                   	push   %ebx
+    2476:	83 ec 1c             	sub    $0x1c,%esp
+	void *stack = stack_alloc();
+    2479:	e8 52 fe ff ff       	call   22d0 <stack_alloc>
+	if(stack == 0)
+    247e:	85 c0                	test   %eax,%eax
+    2480:	0f 84 f6 00 00 00    	je     257c <thread_create+0x10c>
+	if((pid = clone(start_routine, arg1, arg2, stack, flags | CLONE_FILES | CLONE_FS)) < 0)
+    2486:	83 ec 0c             	sub    $0xc,%esp
+    2489:	89 c3                	mov    %eax,%ebx
+    248b:	6a 06                	push   $0x6
+    248d:	50                   	push   %eax
+    248e:	ff 75 10             	push   0x10(%ebp)
+    2491:	ff 75 0c             	push   0xc(%ebp)
+    2494:	ff 75 08             	push   0x8(%ebp)
+    2497:	e8 d7 f9 ff ff       	call   1e73 <clone>
+    249c:	83 c4 20             	add    $0x20,%esp
+    249f:	89 c6                	mov    %eax,%esi
+    24a1:	85 c0                	test   %eax,%eax
+    24a3:	78 0b                	js     24b0 <thread_create+0x40>
+}
+    24a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    24a8:	89 f0                	mov    %esi,%eax
+    24aa:	5b                   	pop    %ebx
+    24ab:	5e                   	pop    %esi
+    24ac:	5f                   	pop    %edi
+    24ad:	5d                   	pop    %ebp
+    24ae:	c3                   	ret
+    24af:	90                   	nop
+    24b0:	bf 01 00 00 00       	mov    $0x1,%edi
+    24b5:	f0 0f c1 3d 04 3c 00 	lock xadd %edi,0x3c04
+    24bc:	00 
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    24bd:	b8 04 3c 00 00       	mov    $0x3c04,%eax
+    24c2:	c1 e8 02             	shr    $0x2,%eax
+    24c5:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+    24c8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    24cb:	83 e1 3f             	and    $0x3f,%ecx
+    24ce:	8d 04 8d 00 3b 00 00 	lea    0x3b00(,%ecx,4),%eax
+    24d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        seq = *(volatile int*)w;
+    24d8:	8b 04 8d 00 3b 00 00 	mov    0x3b00(,%ecx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    24df:	8b 15 08 3c 00 00    	mov    0x3c08,%edx
+    24e5:	39 fa                	cmp    %edi,%edx
+    24e7:	74 33                	je     251c <thread_create+0xac>
+    24e9:	89 75 dc             	mov    %esi,-0x24(%ebp)
+    24ec:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    24ef:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+    24f2:	89 cb                	mov    %ecx,%ebx
+    24f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(w, seq);
+    24f8:	83 ec 08             	sub    $0x8,%esp
+    24fb:	50                   	push   %eax
+    24fc:	56                   	push   %esi
+    24fd:	e8 d9 f9 ff ff       	call   1edb <futex_wait>
+        seq = *(volatile int*)w;
+    2502:	8b 04 9d 00 3b 00 00 	mov    0x3b00(,%ebx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2509:	83 c4 10             	add    $0x10,%esp
+    250c:	8b 15 08 3c 00 00    	mov    0x3c08,%edx
+    2512:	39 d7                	cmp    %edx,%edi
+    2514:	75 e2                	jne    24f8 <thread_create+0x88>
+    2516:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    2519:	8b 75 dc             	mov    -0x24(%ebp),%esi
+	*(void**)stack = stackpool;
+    251c:	a1 00 3c 00 00       	mov    0x3c00,%eax
+    2521:	ba 01 00 00 00       	mov    $0x1,%edx
+	stackpool = stack;
+    2526:	89 1d 00 3c 00 00    	mov    %ebx,0x3c00
+	*(void**)stack = stackpool;
+    252c:	89 03                	mov    %eax,(%ebx)
+    252e:	89 d0                	mov    %edx,%eax
+    2530:	f0 0f c1 05 08 3c 00 	lock xadd %eax,0x3c08
+    2537:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2538:	8b 0d 04 3c 00 00    	mov    0x3c04,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    253e:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2541:	39 c8                	cmp    %ecx,%eax
+    2543:	0f 84 5c ff ff ff    	je     24a5 <thread_create+0x35>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2549:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+    254c:	01 c8                	add    %ecx,%eax
+    254e:	83 e0 3f             	and    $0x3f,%eax
+    2551:	8d 0c 85 00 3b 00 00 	lea    0x3b00(,%eax,4),%ecx
+    2558:	f0 0f c1 14 85 00 3b 	lock xadd %edx,0x3b00(,%eax,4)
+    255f:	00 00 
+        futex_wake(w, NPROC);
+    2561:	83 ec 08             	sub    $0x8,%esp
+    2564:	68 00 04 00 00       	push   $0x400
+    2569:	51                   	push   %ecx
+    256a:	e8 74 f9 ff ff       	call   1ee3 <futex_wake>
+    256f:	83 c4 10             	add    $0x10,%esp
+}
+    2572:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2575:	89 f0                	mov    %esi,%eax
+    2577:	5b                   	pop    %ebx
+    2578:	5e                   	pop    %esi
+    2579:	5f                   	pop    %edi
+    257a:	5d                   	pop    %ebp
+    257b:	c3                   	ret
+		return -1;
+    257c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+	return thread_clone(start_routine, arg1, arg2, 0);
+    2581:	e9 1f ff ff ff       	jmp    24a5 <thread_create+0x35>
+    2586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    258d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002590 <thread_create_detached>:
+{
+    2590:	55                   	push   %ebp
+    2591:	89 e5                	mov    %esp,%ebp
+    2593:	57                   	push   %edi
+    2594:	56                   	push   %esi
+    2595:	53                   	push   %ebx
+    2596:	83 ec 1c             	sub    $0x1c,%esp
+	void *stack = stack_alloc();
+    2599:	e8 32 fd ff ff       	call   22d0 <stack_alloc>
+	if(stack == 0)
+    259e:	85 c0                	test   %eax,%eax
+    25a0:	0f 84 f6 00 00 00    	je     269c <thread_create_detached+0x10c>
+	if((pid = clone(start_routine, arg1, arg2, stack, flags | CLONE_FILES | CLONE_FS)) < 0)
+    25a6:	83 ec 0c             	sub    $0xc,%esp
+    25a9:	89 c3                	mov    %eax,%ebx
+    25ab:	6a 07                	push   $0x7
+    25ad:	50                   	push   %eax
+    25ae:	ff 75 10             	push   0x10(%ebp)
+    25b1:	ff 75 0c             	push   0xc(%ebp)
+    25b4:	ff 75 08             	push   0x8(%ebp)
+    25b7:	e8 b7 f8 ff ff       	call   1e73 <clone>
+    25bc:	83 c4 20             	add    $0x20,%esp
+    25bf:	89 c6                	mov    %eax,%esi
+    25c1:	85 c0                	test   %eax,%eax
+    25c3:	78 0b                	js     25d0 <thread_create_detached+0x40>
+}
+    25c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    25c8:	89 f0                	mov    %esi,%eax
+    25ca:	5b                   	pop    %ebx
+    25cb:	5e                   	pop    %esi
+    25cc:	5f                   	pop    %edi
+    25cd:	5d                   	pop    %ebp
+    25ce:	c3                   	ret
+    25cf:	90                   	nop
+    25d0:	bf 01 00 00 00       	mov    $0x1,%edi
+    25d5:	f0 0f c1 3d 04 3c 00 	lock xadd %edi,0x3c04
+    25dc:	00 
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    25dd:	b8 04 3c 00 00       	mov    $0x3c04,%eax
+    25e2:	c1 e8 02             	shr    $0x2,%eax
+    25e5:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+    25e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    25eb:	83 e1 3f             	and    $0x3f,%ecx
+    25ee:	8d 04 8d 00 3b 00 00 	lea    0x3b00(,%ecx,4),%eax
+    25f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        seq = *(volatile int*)w;
+    25f8:	8b 04 8d 00 3b 00 00 	mov    0x3b00(,%ecx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    25ff:	8b 15 08 3c 00 00    	mov    0x3c08,%edx
+    2605:	39 fa                	cmp    %edi,%edx
+    2607:	74 33                	je     263c <thread_create_detached+0xac>
+    2609:	89 75 dc             	mov    %esi,-0x24(%ebp)
+    260c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    260f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+    2612:	89 cb                	mov    %ecx,%ebx
+    2614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(w, seq);
+    2618:	83 ec 08             	sub    $0x8,%esp
+    261b:	50                   	push   %eax
+    261c:	56                   	push   %esi
+    261d:	e8 b9 f8 ff ff       	call   1edb <futex_wait>
+        seq = *(volatile int*)w;
+    2622:	8b 04 9d 00 3b 00 00 	mov    0x3b00(,%ebx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2629:	83 c4 10             	add    $0x10,%esp
+    262c:	8b 15 08 3c 00 00    	mov    0x3c08,%edx
+    2632:	39 d7                	cmp    %edx,%edi
+    2634:	75 e2                	jne    2618 <thread_create_detached+0x88>
+    2636:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    2639:	8b 75 dc             	mov    -0x24(%ebp),%esi
+	*(void**)stack = stackpool;
+    263c:	a1 00 3c 00 00       	mov    0x3c00,%eax
+    2641:	ba 01 00 00 00       	mov    $0x1,%edx
+	stackpool = stack;
+    2646:	89 1d 00 3c 00 00    	mov    %ebx,0x3c00
+	*(void**)stack = stackpool;
+    264c:	89 03                	mov    %eax,(%ebx)
+    264e:	89 d0                	mov    %edx,%eax
+    2650:	f0 0f c1 05 08 3c 00 	lock xadd %eax,0x3c08
+    2657:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2658:	8b 0d 04 3c 00 00    	mov    0x3c04,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    265e:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2661:	39 c8                	cmp    %ecx,%eax
+    2663:	0f 84 5c ff ff ff    	je     25c5 <thread_create_detached+0x35>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2669:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+    266c:	01 c8                	add    %ecx,%eax
+    266e:	83 e0 3f             	and    $0x3f,%eax
+    2671:	8d 0c 85 00 3b 00 00 	lea    0x3b00(,%eax,4),%ecx
+    2678:	f0 0f c1 14 85 00 3b 	lock xadd %edx,0x3b00(,%eax,4)
+    267f:	00 00 
+        futex_wake(w, NPROC);
+    2681:	83 ec 08             	sub    $0x8,%esp
+    2684:	68 00 04 00 00       	push   $0x400
+    2689:	51                   	push   %ecx
+    268a:	e8 54 f8 ff ff       	call   1ee3 <futex_wake>
+    268f:	83 c4 10             	add    $0x10,%esp
+}
+    2692:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2695:	89 f0                	mov    %esi,%eax
+    2697:	5b                   	pop    %ebx
+    2698:	5e                   	pop    %esi
+    2699:	5f                   	pop    %edi
+    269a:	5d                   	pop    %ebp
+    269b:	c3                   	ret
+		return -1;
+    269c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+	return thread_clone(start_routine, arg1, arg2, CLONE_DETACHED);
+    26a1:	e9 1f ff ff ff       	jmp    25c5 <thread_create_detached+0x35>
+    26a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000026b0 <thread_join>:
+{
+    26b0:	55                   	push   %ebp
+    26b1:	89 e5                	mov    %esp,%ebp
+    26b3:	57                   	push   %edi
+    26b4:	56                   	push   %esi
+  	int result = join(&stack);	
+    26b5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+{
+    26b8:	53                   	push   %ebx
+    26b9:	83 ec 38             	sub    $0x38,%esp
+  	int result = join(&stack);	
+    26bc:	50                   	push   %eax
+    26bd:	e8 b9 f7 ff ff       	call   1e7b <join>
+  	if(result > 0 && stack)
+    26c2:	83 c4 10             	add    $0x10,%esp
+  	int result = join(&stack);	
+    26c5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  	if(result > 0 && stack)
+    26c8:	85 c0                	test   %eax,%eax
+    26ca:	0f 8e 92 00 00 00    	jle    2762 <thread_join+0xb2>
+    26d0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    26d3:	85 c9                	test   %ecx,%ecx
+    26d5:	0f 84 87 00 00 00    	je     2762 <thread_join+0xb2>
+    26db:	be 01 00 00 00       	mov    $0x1,%esi
+    26e0:	f0 0f c1 35 04 3c 00 	lock xadd %esi,0x3c04
+    26e7:	00 
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    26e8:	b8 04 3c 00 00       	mov    $0x3c04,%eax
+    26ed:	c1 e8 02             	shr    $0x2,%eax
+    26f0:	8d 3c 06             	lea    (%esi,%eax,1),%edi
+    26f3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    26f6:	83 e7 3f             	and    $0x3f,%edi
+        seq = *(volatile int*)w;
+    26f9:	8b 04 bd 00 3b 00 00 	mov    0x3b00(,%edi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2700:	8b 15 08 3c 00 00    	mov    0x3c08,%edx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2706:	8d 1c bd 00 3b 00 00 	lea    0x3b00(,%edi,4),%ebx
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    270d:	39 f2                	cmp    %esi,%edx
+    270f:	74 28                	je     2739 <thread_join+0x89>
+    2711:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    2714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(w, seq);
+    2718:	83 ec 08             	sub    $0x8,%esp
+    271b:	50                   	push   %eax
+    271c:	53                   	push   %ebx
+    271d:	e8 b9 f7 ff ff       	call   1edb <futex_wait>
+        seq = *(volatile int*)w;
+    2722:	8b 04 bd 00 3b 00 00 	mov    0x3b00(,%edi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2729:	83 c4 10             	add    $0x10,%esp
+    272c:	8b 15 08 3c 00 00    	mov    0x3c08,%edx
+    2732:	39 d6                	cmp    %edx,%esi
+    2734:	75 e2                	jne    2718 <thread_join+0x68>
+    2736:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+	*(void**)stack = stackpool;
+    2739:	a1 00 3c 00 00       	mov    0x3c00,%eax
+    273e:	ba 01 00 00 00       	mov    $0x1,%edx
+	stackpool = stack;
+    2743:	89 0d 00 3c 00 00    	mov    %ecx,0x3c00
+	*(void**)stack = stackpool;
+    2749:	89 01                	mov    %eax,(%ecx)
+    274b:	89 d0                	mov    %edx,%eax
+    274d:	f0 0f c1 05 08 3c 00 	lock xadd %eax,0x3c08
+    2754:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2755:	8b 0d 04 3c 00 00    	mov    0x3c04,%ecx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    275b:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    275e:	39 c8                	cmp    %ecx,%eax
+    2760:	75 0e                	jne    2770 <thread_join+0xc0>
+}
+    2762:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    2765:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2768:	5b                   	pop    %ebx
+    2769:	5e                   	pop    %esi
+    276a:	5f                   	pop    %edi
+    276b:	5d                   	pop    %ebp
+    276c:	c3                   	ret
+    276d:	8d 76 00             	lea    0x0(%esi),%esi
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2770:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+    2773:	01 c8                	add    %ecx,%eax
+    2775:	83 e0 3f             	and    $0x3f,%eax
+    2778:	8d 0c 85 00 3b 00 00 	lea    0x3b00(,%eax,4),%ecx
+    277f:	f0 0f c1 14 85 00 3b 	lock xadd %edx,0x3b00(,%eax,4)
+    2786:	00 00 
+        futex_wake(w, NPROC);
+    2788:	83 ec 08             	sub    $0x8,%esp
+    278b:	68 00 04 00 00       	push   $0x400
+    2790:	51                   	push   %ecx
+    2791:	e8 4d f7 ff ff       	call   1ee3 <futex_wake>
+}
+    2796:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+        futex_wake(w, NPROC);
+    2799:	83 c4 10             	add    $0x10,%esp
+}
+    279c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    279f:	5b                   	pop    %ebx
+    27a0:	5e                   	pop    %esi
+    27a1:	5f                   	pop    %edi
+    27a2:	5d                   	pop    %ebp
+    27a3:	c3                   	ret
+    27a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    27af:	90                   	nop
+
+000027b0 <thread_join_many>:
+{
+    27b0:	55                   	push   %ebp
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    27b1:	b8 04 3c 00 00       	mov    $0x3c04,%eax
+    27b6:	c1 e8 02             	shr    $0x2,%eax
+{
+    27b9:	89 e5                	mov    %esp,%ebp
+    27bb:	57                   	push   %edi
+    27bc:	56                   	push   %esi
+    27bd:	53                   	push   %ebx
+    27be:	83 ec 6c             	sub    $0x6c,%esp
+    27c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    27c4:	89 45 9c             	mov    %eax,-0x64(%ebp)
+		if((r = join_any(got, stacks, n < NREAP ? n : NREAP, 0)) < 0)
+    27c7:	b8 08 00 00 00       	mov    $0x8,%eax
+    27cc:	39 c2                	cmp    %eax,%edx
+    27ce:	0f 4e c2             	cmovle %edx,%eax
+    27d1:	89 c3                	mov    %eax,%ebx
+    27d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    27d7:	90                   	nop
+    27d8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    27db:	6a 00                	push   $0x0
+    27dd:	53                   	push   %ebx
+    27de:	50                   	push   %eax
+    27df:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    27e2:	50                   	push   %eax
+    27e3:	e8 0b f7 ff ff       	call   1ef3 <join_any>
+    27e8:	83 c4 10             	add    $0x10,%esp
+    27eb:	89 45 94             	mov    %eax,-0x6c(%ebp)
+    27ee:	85 c0                	test   %eax,%eax
+    27f0:	0f 88 11 01 00 00    	js     2907 <thread_join_many+0x157>
+		for(i = 0; i < r; i++){
+    27f6:	74 e0                	je     27d8 <thread_join_many+0x28>
+    27f8:	c7 45 98 00 00 00 00 	movl   $0x0,-0x68(%ebp)
+    27ff:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+    2806:	89 5d 90             	mov    %ebx,-0x70(%ebp)
+    2809:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+			if(got[i] != 0)
+    2810:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    2813:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    2817:	85 c0                	test   %eax,%eax
+    2819:	74 0f                	je     282a <thread_join_many+0x7a>
+				pids[k++] = got[i];
+    281b:	8b 4d 98             	mov    -0x68(%ebp),%ecx
+    281e:	8b 7d 08             	mov    0x8(%ebp),%edi
+    2821:	89 04 8f             	mov    %eax,(%edi,%ecx,4)
+    2824:	8d 41 01             	lea    0x1(%ecx),%eax
+    2827:	89 45 98             	mov    %eax,-0x68(%ebp)
+			stack_free(stacks[i]);
+    282a:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    282d:	bb 01 00 00 00       	mov    $0x1,%ebx
+    2832:	8b 4c 85 a8          	mov    -0x58(%ebp,%eax,4),%ecx
+    2836:	f0 0f c1 1d 04 3c 00 	lock xadd %ebx,0x3c04
+    283d:	00 
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    283e:	8b 45 9c             	mov    -0x64(%ebp),%eax
+    2841:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    2844:	83 e6 3f             	and    $0x3f,%esi
+        seq = *(volatile int*)w;
+    2847:	8b 04 b5 00 3b 00 00 	mov    0x3b00(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    284e:	8b 15 08 3c 00 00    	mov    0x3c08,%edx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2854:	8d 3c b5 00 3b 00 00 	lea    0x3b00(,%esi,4),%edi
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    285b:	39 da                	cmp    %ebx,%edx
+    285d:	74 2a                	je     2889 <thread_join_many+0xd9>
+    285f:	89 4d a0             	mov    %ecx,-0x60(%ebp)
+    2862:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        futex_wait(w, seq);
+    2868:	83 ec 08             	sub    $0x8,%esp
+    286b:	50                   	push   %eax
+    286c:	57                   	push   %edi
+    286d:	e8 69 f6 ff ff       	call   1edb <futex_wait>
+        seq = *(volatile int*)w;
+    2872:	8b 04 b5 00 3b 00 00 	mov    0x3b00(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2879:	83 c4 10             	add    $0x10,%esp
+    287c:	8b 15 08 3c 00 00    	mov    0x3c08,%edx
+    2882:	39 d3                	cmp    %edx,%ebx
+    2884:	75 e2                	jne    2868 <thread_join_many+0xb8>
+    2886:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+	*(void**)stack = stackpool;
+    2889:	a1 00 3c 00 00       	mov    0x3c00,%eax
+	stackpool = stack;
+    288e:	89 0d 00 3c 00 00    	mov    %ecx,0x3c00
+	*(void**)stack = stackpool;
+    2894:	89 01                	mov    %eax,(%ecx)
+    2896:	b8 01 00 00 00       	mov    $0x1,%eax
+    289b:	f0 0f c1 05 08 3c 00 	lock xadd %eax,0x3c08
+    28a2:	00 
+    if (turn != *(volatile int*)&lock->next_ticket){
+    28a3:	8b 15 04 3c 00 00    	mov    0x3c04,%edx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    28a9:	83 c0 01             	add    $0x1,%eax
+    if (turn != *(volatile int*)&lock->next_ticket){
+    28ac:	39 d0                	cmp    %edx,%eax
+    28ae:	74 2e                	je     28de <thread_join_many+0x12e>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    28b0:	8b 4d 9c             	mov    -0x64(%ebp),%ecx
+    28b3:	ba 01 00 00 00       	mov    $0x1,%edx
+    28b8:	01 c8                	add    %ecx,%eax
+    28ba:	83 e0 3f             	and    $0x3f,%eax
+    28bd:	8d 0c 85 00 3b 00 00 	lea    0x3b00(,%eax,4),%ecx
+    28c4:	f0 0f c1 14 85 00 3b 	lock xadd %edx,0x3b00(,%eax,4)
+    28cb:	00 00 
+        futex_wake(w, NPROC);
+    28cd:	83 ec 08             	sub    $0x8,%esp
+    28d0:	68 00 04 00 00       	push   $0x400
+    28d5:	51                   	push   %ecx
+    28d6:	e8 08 f6 ff ff       	call   1ee3 <futex_wake>
+    28db:	83 c4 10             	add    $0x10,%esp
+		for(i = 0; i < r; i++){
+    28de:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+    28e2:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    28e5:	39 45 94             	cmp    %eax,-0x6c(%ebp)
+    28e8:	0f 85 22 ff ff ff    	jne    2810 <thread_join_many+0x60>
+	for(k = 0; k == 0; ){
+    28ee:	8b 45 98             	mov    -0x68(%ebp),%eax
+    28f1:	8b 5d 90             	mov    -0x70(%ebp),%ebx
+    28f4:	85 c0                	test   %eax,%eax
+    28f6:	0f 84 dc fe ff ff    	je     27d8 <thread_join_many+0x28>
+}
+    28fc:	8b 45 98             	mov    -0x68(%ebp),%eax
+    28ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2902:	5b                   	pop    %ebx
+    2903:	5e                   	pop    %esi
+    2904:	5f                   	pop    %edi
+    2905:	5d                   	pop    %ebp
+    2906:	c3                   	ret
+			return -1;
+    2907:	c7 45 98 ff ff ff ff 	movl   $0xffffffff,-0x68(%ebp)
+}
+    290e:	8b 45 98             	mov    -0x68(%ebp),%eax
+    2911:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2914:	5b                   	pop    %ebx
+    2915:	5e                   	pop    %esi
+    2916:	5f                   	pop    %edi
+    2917:	5d                   	pop    %ebp
+    2918:	c3                   	ret
+    2919:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002920 <lock_init>:
+{
+    2920:	55                   	push   %ebp
+    2921:	89 e5                	mov    %esp,%ebp
+    2923:	8b 45 08             	mov    0x8(%ebp),%eax
+    lock->next_ticket = 0;
+    2926:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    lock->current_turn = 0;
+    292c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+    lock->pid = 0;
+    2933:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+    293a:	5d                   	pop    %ebp
+    293b:	c3                   	ret
+    293c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002940 <lock_acquire>:
+{
+    2940:	55                   	push   %ebp
+    2941:	89 e5                	mov    %esp,%ebp
+    2943:	57                   	push   %edi
+    2944:	56                   	push   %esi
+    2945:	be 01 00 00 00       	mov    $0x1,%esi
+    294a:	53                   	push   %ebx
+    294b:	83 ec 1c             	sub    $0x1c,%esp
+    294e:	8b 7d 08             	mov    0x8(%ebp),%edi
+    2951:	f0 0f c1 37          	lock xadd %esi,(%edi)
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2955:	89 fb                	mov    %edi,%ebx
+    2957:	c1 eb 02             	shr    $0x2,%ebx
+    295a:	01 f3                	add    %esi,%ebx
+    295c:	83 e3 3f             	and    $0x3f,%ebx
+    295f:	8d 04 9d 00 3b 00 00 	lea    0x3b00(,%ebx,4),%eax
+    2966:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        seq = *(volatile int*)w;
+    2969:	8b 04 9d 00 3b 00 00 	mov    0x3b00(,%ebx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2970:	8b 57 04             	mov    0x4(%edi),%edx
+    2973:	39 d6                	cmp    %edx,%esi
+    2975:	74 26                	je     299d <lock_acquire+0x5d>
+    2977:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    297e:	66 90                	xchg   %ax,%ax
+        futex_wait(w, seq);
+    2980:	83 ec 08             	sub    $0x8,%esp
+    2983:	50                   	push   %eax
+    2984:	ff 75 e4             	push   -0x1c(%ebp)
+    2987:	e8 4f f5 ff ff       	call   1edb <futex_wait>
+        seq = *(volatile int*)w;
+    298c:	8b 04 9d 00 3b 00 00 	mov    0x3b00(,%ebx,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2993:	8b 57 04             	mov    0x4(%edi),%edx
+    2996:	83 c4 10             	add    $0x10,%esp
+    2999:	39 f2                	cmp    %esi,%edx
+    299b:	75 e3                	jne    2980 <lock_acquire+0x40>
+}
+    299d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    29a0:	5b                   	pop    %ebx
+    29a1:	5e                   	pop    %esi
+    29a2:	5f                   	pop    %edi
+    29a3:	5d                   	pop    %ebp
+    29a4:	c3                   	ret
+    29a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    29ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000029b0 <lock_release>:
+{
+    29b0:	55                   	push   %ebp
+    29b1:	b9 01 00 00 00       	mov    $0x1,%ecx
+    29b6:	89 ca                	mov    %ecx,%edx
+    29b8:	89 e5                	mov    %esp,%ebp
+    29ba:	53                   	push   %ebx
+    29bb:	83 ec 04             	sub    $0x4,%esp
+    29be:	8b 45 08             	mov    0x8(%ebp),%eax
+    29c1:	f0 0f c1 50 04       	lock xadd %edx,0x4(%eax)
+    if (turn != *(volatile int*)&lock->next_ticket){
+    29c6:	8b 18                	mov    (%eax),%ebx
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    29c8:	83 c2 01             	add    $0x1,%edx
+    if (turn != *(volatile int*)&lock->next_ticket){
+    29cb:	39 d3                	cmp    %edx,%ebx
+    29cd:	74 29                	je     29f8 <lock_release+0x48>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    29cf:	c1 e8 02             	shr    $0x2,%eax
+    29d2:	01 d0                	add    %edx,%eax
+    29d4:	83 e0 3f             	and    $0x3f,%eax
+    29d7:	8d 14 85 00 3b 00 00 	lea    0x3b00(,%eax,4),%edx
+    29de:	f0 0f c1 0c 85 00 3b 	lock xadd %ecx,0x3b00(,%eax,4)
+    29e5:	00 00 
+        futex_wake(w, NPROC);
+    29e7:	83 ec 08             	sub    $0x8,%esp
+    29ea:	68 00 04 00 00       	push   $0x400
+    29ef:	52                   	push   %edx
+    29f0:	e8 ee f4 ff ff       	call   1ee3 <futex_wake>
+    29f5:	83 c4 10             	add    $0x10,%esp
+    }
+}
+    29f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    29fb:	c9                   	leave
+    29fc:	c3                   	ret
+    29fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002a00 <rw_rdlock>:
+    fetch_and_add(nwait, -1);
+}
+
+// reader-writer lock
+void rw_rdlock(struct rwlock *rw)
+{
+    2a00:	55                   	push   %ebp
+    2a01:	89 e5                	mov    %esp,%ebp
+    2a03:	57                   	push   %edi
+    2a04:	bf 01 00 00 00       	mov    $0x1,%edi
+    2a09:	56                   	push   %esi
+    2a0a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    2a0f:	53                   	push   %ebx
+    2a10:	83 ec 0c             	sub    $0xc,%esp
+    2a13:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    2a16:	eb 23                	jmp    2a3b <rw_rdlock+0x3b>
+    2a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a1f:	90                   	nop
+    2a20:	89 f8                	mov    %edi,%eax
+    2a22:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+    futex_wait(addr, val);
+    2a27:	83 ec 08             	sub    $0x8,%esp
+    2a2a:	52                   	push   %edx
+    2a2b:	53                   	push   %ebx
+    2a2c:	e8 aa f4 ff ff       	call   1edb <futex_wait>
+    2a31:	89 f0                	mov    %esi,%eax
+    2a33:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+    2a38:	83 c4 10             	add    $0x10,%esp
+    int s;
+
+    for(;;){
+        s = *(volatile int*)&rw->state;
+    2a3b:	8b 13                	mov    (%ebx),%edx
+        if(s >= 0 && *(volatile int*)&rw->wwait == 0 && cas(&rw->state, s, s + 1))
+    2a3d:	85 d2                	test   %edx,%edx
+    2a3f:	78 df                	js     2a20 <rw_rdlock+0x20>
+    2a41:	8b 43 04             	mov    0x4(%ebx),%eax
+    2a44:	85 c0                	test   %eax,%eax
+    2a46:	75 d8                	jne    2a20 <rw_rdlock+0x20>
+    2a48:	8d 4a 01             	lea    0x1(%edx),%ecx
+static inline int
+cas(volatile int *addr, int old, int newval)
+{
+  uchar ok;
+
+  asm volatile("lock; cmpxchgl %3, %1; sete %0" :
+    2a4b:	89 d0                	mov    %edx,%eax
+    2a4d:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    2a51:	0f 94 c1             	sete   %cl
+    2a54:	84 c9                	test   %cl,%cl
+    2a56:	74 c8                	je     2a20 <rw_rdlock+0x20>
+            return;
+        futex_sleep(&rw->state, s, &rw->nwait);
+    }
+}
+    2a58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2a5b:	5b                   	pop    %ebx
+    2a5c:	5e                   	pop    %esi
+    2a5d:	5f                   	pop    %edi
+    2a5e:	5d                   	pop    %ebp
+    2a5f:	c3                   	ret
+
+00002a60 <rw_wrlock>:
+
+void rw_wrlock(struct rwlock *rw)
+{
+    2a60:	55                   	push   %ebp
+  asm volatile("lock; xaddl %0, %1"
+    2a61:	b8 01 00 00 00       	mov    $0x1,%eax
+    2a66:	89 e5                	mov    %esp,%ebp
+    2a68:	57                   	push   %edi
+    2a69:	56                   	push   %esi
+    2a6a:	53                   	push   %ebx
+    2a6b:	83 ec 0c             	sub    $0xc,%esp
+    2a6e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    2a71:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+  asm volatile("lock; cmpxchgl %3, %1; sete %0" :
+    2a76:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    2a7b:	31 ff                	xor    %edi,%edi
+  return value;
+    2a7d:	eb 07                	jmp    2a86 <rw_wrlock+0x26>
+    2a7f:	90                   	nop
+    int s;
+
+    fetch_and_add(&rw->wwait, 1);
+    while(!cas(&rw->state, 0, -1)){
+        if((s = *(volatile int*)&rw->state) != 0)
+    2a80:	8b 03                	mov    (%ebx),%eax
+    2a82:	85 c0                	test   %eax,%eax
+    2a84:	75 1a                	jne    2aa0 <rw_wrlock+0x40>
+  asm volatile("lock; cmpxchgl %3, %1; sete %0" :
+    2a86:	89 f8                	mov    %edi,%eax
+    2a88:	f0 0f b1 33          	lock cmpxchg %esi,(%ebx)
+    2a8c:	0f 94 c2             	sete   %dl
+    while(!cas(&rw->state, 0, -1)){
+    2a8f:	84 d2                	test   %dl,%dl
+    2a91:	74 ed                	je     2a80 <rw_wrlock+0x20>
+  asm volatile("lock; xaddl %0, %1"
+    2a93:	f0 0f c1 73 04       	lock xadd %esi,0x4(%ebx)
+            futex_sleep(&rw->state, s, &rw->nwait);
+    }
+    fetch_and_add(&rw->wwait, -1);
+}
+    2a98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2a9b:	5b                   	pop    %ebx
+    2a9c:	5e                   	pop    %esi
+    2a9d:	5f                   	pop    %edi
+    2a9e:	5d                   	pop    %ebp
+    2a9f:	c3                   	ret
+    2aa0:	ba 01 00 00 00       	mov    $0x1,%edx
+    2aa5:	f0 0f c1 53 08       	lock xadd %edx,0x8(%ebx)
+    futex_wait(addr, val);
+    2aaa:	83 ec 08             	sub    $0x8,%esp
+    2aad:	50                   	push   %eax
+    2aae:	53                   	push   %ebx
+    2aaf:	e8 27 f4 ff ff       	call   1edb <futex_wait>
+    2ab4:	89 f0                	mov    %esi,%eax
+    2ab6:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+    2abb:	83 c4 10             	add    $0x10,%esp
+    2abe:	eb c6                	jmp    2a86 <rw_wrlock+0x26>
+
+00002ac0 <rw_unlock>:
+
+void rw_unlock(struct rwlock *rw)
+{
+    2ac0:	55                   	push   %ebp
+    2ac1:	89 e5                	mov    %esp,%ebp
+    2ac3:	83 ec 08             	sub    $0x8,%esp
+    2ac6:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(rw->state < 0)
+    2ac9:	8b 02                	mov    (%edx),%eax
+    2acb:	85 c0                	test   %eax,%eax
+    2acd:	78 31                	js     2b00 <rw_unlock+0x40>
+    2acf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2ad4:	f0 0f c1 02          	lock xadd %eax,(%edx)
+        xchg((uint*)&rw->state, 0);
+    else
+        fetch_and_add(&rw->state, -1);
+    if(*(volatile int*)&rw->nwait)
+    2ad8:	8b 42 08             	mov    0x8(%edx),%eax
+    2adb:	85 c0                	test   %eax,%eax
+    2add:	75 09                	jne    2ae8 <rw_unlock+0x28>
+        futex_wake(&rw->state, NPROC);
+}
+    2adf:	c9                   	leave
+    2ae0:	c3                   	ret
+    2ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        futex_wake(&rw->state, NPROC);
+    2ae8:	83 ec 08             	sub    $0x8,%esp
+    2aeb:	68 00 04 00 00       	push   $0x400
+    2af0:	52                   	push   %edx
+    2af1:	e8 ed f3 ff ff       	call   1ee3 <futex_wake>
+    2af6:	83 c4 10             	add    $0x10,%esp
+}
+    2af9:	c9                   	leave
+    2afa:	c3                   	ret
+    2afb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2aff:	90                   	nop
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    2b00:	31 c0                	xor    %eax,%eax
+    2b02:	f0 87 02             	lock xchg %eax,(%edx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    2b05:	eb d1                	jmp    2ad8 <rw_unlock+0x18>
+    2b07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2b0e:	66 90                	xchg   %ax,%ax
+
+00002b10 <cond_wait>:
+
+// condition variable
+void cond_wait(struct cond *cv, struct ticketlock *lock)
+{
+    2b10:	55                   	push   %ebp
+  asm volatile("lock; xaddl %0, %1"
+    2b11:	ba 01 00 00 00       	mov    $0x1,%edx
+    2b16:	89 e5                	mov    %esp,%ebp
+    2b18:	57                   	push   %edi
+    2b19:	56                   	push   %esi
+    2b1a:	53                   	push   %ebx
+    2b1b:	83 ec 1c             	sub    $0x1c,%esp
+    2b1e:	8b 7d 08             	mov    0x8(%ebp),%edi
+    2b21:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    int s = *(volatile int*)&cv->seq;
+    2b24:	8b 07                	mov    (%edi),%eax
+    2b26:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    2b29:	89 d0                	mov    %edx,%eax
+    2b2b:	f0 0f c1 47 04       	lock xadd %eax,0x4(%edi)
+    2b30:	89 d0                	mov    %edx,%eax
+    2b32:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2b37:	8b 0b                	mov    (%ebx),%ecx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2b39:	89 de                	mov    %ebx,%esi
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    2b3b:	83 c0 01             	add    $0x1,%eax
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2b3e:	c1 ee 02             	shr    $0x2,%esi
+    if (turn != *(volatile int*)&lock->next_ticket){
+    2b41:	39 c8                	cmp    %ecx,%eax
+    2b43:	74 26                	je     2b6b <cond_wait+0x5b>
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2b45:	01 f0                	add    %esi,%eax
+    2b47:	83 e0 3f             	and    $0x3f,%eax
+    2b4a:	8d 0c 85 00 3b 00 00 	lea    0x3b00(,%eax,4),%ecx
+    2b51:	f0 0f c1 14 85 00 3b 	lock xadd %edx,0x3b00(,%eax,4)
+    2b58:	00 00 
+        futex_wake(w, NPROC);
+    2b5a:	83 ec 08             	sub    $0x8,%esp
+    2b5d:	68 00 04 00 00       	push   $0x400
+    2b62:	51                   	push   %ecx
+    2b63:	e8 7b f3 ff ff       	call   1ee3 <futex_wake>
+    2b68:	83 c4 10             	add    $0x10,%esp
+
+    fetch_and_add(&cv->nwait, 1);
+    lock_release(lock);
+    futex_wait(&cv->seq, s);
+    2b6b:	83 ec 08             	sub    $0x8,%esp
+    2b6e:	ff 75 e4             	push   -0x1c(%ebp)
+    2b71:	57                   	push   %edi
+    2b72:	e8 64 f3 ff ff       	call   1edb <futex_wait>
+    2b77:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2b7c:	f0 0f c1 47 04       	lock xadd %eax,0x4(%edi)
+    2b81:	bf 01 00 00 00       	mov    $0x1,%edi
+    2b86:	f0 0f c1 3b          	lock xadd %edi,(%ebx)
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2b8a:	01 fe                	add    %edi,%esi
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2b8c:	83 c4 10             	add    $0x10,%esp
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2b8f:	83 e6 3f             	and    $0x3f,%esi
+        seq = *(volatile int*)w;
+    2b92:	8b 04 b5 00 3b 00 00 	mov    0x3b00(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2b99:	8b 53 04             	mov    0x4(%ebx),%edx
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+    2b9c:	8d 0c b5 00 3b 00 00 	lea    0x3b00(,%esi,4),%ecx
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2ba3:	39 fa                	cmp    %edi,%edx
+    2ba5:	74 25                	je     2bcc <cond_wait+0xbc>
+    2ba7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    2baa:	89 cf                	mov    %ecx,%edi
+    2bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(w, seq);
+    2bb0:	83 ec 08             	sub    $0x8,%esp
+    2bb3:	50                   	push   %eax
+    2bb4:	57                   	push   %edi
+    2bb5:	e8 21 f3 ff ff       	call   1edb <futex_wait>
+        seq = *(volatile int*)w;
+    2bba:	8b 04 b5 00 3b 00 00 	mov    0x3b00(,%esi,4),%eax
+        if(*(volatile int*)&lock->current_turn == myTicket)
+    2bc1:	83 c4 10             	add    $0x10,%esp
+    2bc4:	8b 53 04             	mov    0x4(%ebx),%edx
+    2bc7:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+    2bca:	75 e4                	jne    2bb0 <cond_wait+0xa0>
+    fetch_and_add(&cv->nwait, -1);
+    lock_acquire(lock);
+}
+    2bcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2bcf:	5b                   	pop    %ebx
+    2bd0:	5e                   	pop    %esi
+    2bd1:	5f                   	pop    %edi
+    2bd2:	5d                   	pop    %ebp
+    2bd3:	c3                   	ret
+    2bd4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2bdf:	90                   	nop
+
+00002be0 <cond_signal>:
+
+void cond_signal(struct cond *cv)
+{
+    2be0:	55                   	push   %ebp
+    2be1:	ba 01 00 00 00       	mov    $0x1,%edx
+    2be6:	89 e5                	mov    %esp,%ebp
+    2be8:	83 ec 08             	sub    $0x8,%esp
+    2beb:	8b 45 08             	mov    0x8(%ebp),%eax
+    2bee:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    fetch_and_add(&cv->seq, 1);
+    if(*(volatile int*)&cv->nwait)
+    2bf2:	8b 50 04             	mov    0x4(%eax),%edx
+    2bf5:	85 d2                	test   %edx,%edx
+    2bf7:	75 07                	jne    2c00 <cond_signal+0x20>
+        futex_wake(&cv->seq, 1);
+}
+    2bf9:	c9                   	leave
+    2bfa:	c3                   	ret
+    2bfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2bff:	90                   	nop
+        futex_wake(&cv->seq, 1);
+    2c00:	83 ec 08             	sub    $0x8,%esp
+    2c03:	6a 01                	push   $0x1
+    2c05:	50                   	push   %eax
+    2c06:	e8 d8 f2 ff ff       	call   1ee3 <futex_wake>
+    2c0b:	83 c4 10             	add    $0x10,%esp
+}
+    2c0e:	c9                   	leave
+    2c0f:	c3                   	ret
+
+00002c10 <cond_broadcast>:
+
+void cond_broadcast(struct cond *cv)
+{
+    2c10:	55                   	push   %ebp
+    2c11:	ba 01 00 00 00       	mov    $0x1,%edx
+    2c16:	89 e5                	mov    %esp,%ebp
+    2c18:	83 ec 08             	sub    $0x8,%esp
+    2c1b:	8b 45 08             	mov    0x8(%ebp),%eax
+    2c1e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    fetch_and_add(&cv->seq, 1);
+    if(*(volatile int*)&cv->nwait)
+    2c22:	8b 50 04             	mov    0x4(%eax),%edx
+    2c25:	85 d2                	test   %edx,%edx
+    2c27:	75 07                	jne    2c30 <cond_broadcast+0x20>
+        futex_wake(&cv->seq, NPROC);
+}
+    2c29:	c9                   	leave
+    2c2a:	c3                   	ret
+    2c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2c2f:	90                   	nop
+        futex_wake(&cv->seq, NPROC);
+    2c30:	83 ec 08             	sub    $0x8,%esp
+    2c33:	68 00 04 00 00       	push   $0x400
+    2c38:	50                   	push   %eax
+    2c39:	e8 a5 f2 ff ff       	call   1ee3 <futex_wake>
+    2c3e:	83 c4 10             	add    $0x10,%esp
+}
+    2c41:	c9                   	leave
+    2c42:	c3                   	ret
+    2c43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002c50 <barrier_init>:
+
+// barrier
+void barrier_init(struct barrier *b, int n)
+{
+    2c50:	55                   	push   %ebp
+    2c51:	89 e5                	mov    %esp,%ebp
+    2c53:	8b 45 08             	mov    0x8(%ebp),%eax
+    b->n = n;
+    2c56:	8b 55 0c             	mov    0xc(%ebp),%edx
+    b->count = 0;
+    2c59:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+    b->n = n;
+    2c60:	89 10                	mov    %edx,(%eax)
+    b->gen = 0;
+    2c62:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+    2c69:	5d                   	pop    %ebp
+    2c6a:	c3                   	ret
+    2c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2c6f:	90                   	nop
+
+00002c70 <barrier_wait>:
+
+// The last thread to arrive starts the next round and
+// wakes the others, who sleep until the round changes.
+void barrier_wait(struct barrier *b)
+{
+    2c70:	55                   	push   %ebp
+    2c71:	ba 01 00 00 00       	mov    $0x1,%edx
+    2c76:	89 d0                	mov    %edx,%eax
+    2c78:	89 e5                	mov    %esp,%ebp
+    2c7a:	57                   	push   %edi
+    2c7b:	56                   	push   %esi
+    2c7c:	53                   	push   %ebx
+    2c7d:	83 ec 0c             	sub    $0xc,%esp
+    2c80:	8b 75 08             	mov    0x8(%ebp),%esi
+    int gen = *(volatile int*)&b->gen;
+    2c83:	8b 5e 08             	mov    0x8(%esi),%ebx
+    2c86:	f0 0f c1 46 04       	lock xadd %eax,0x4(%esi)
+
+    if(fetch_and_add(&b->count, 1) + 1 == b->n){
+    2c8b:	83 c0 01             	add    $0x1,%eax
+    2c8e:	3b 06                	cmp    (%esi),%eax
+    2c90:	74 2e                	je     2cc0 <barrier_wait+0x50>
+        b->count = 0;
+        fetch_and_add(&b->gen, 1);
+        futex_wake(&b->gen, NPROC);
+        return;
+    }
+    while(*(volatile int*)&b->gen == gen)
+    2c92:	8b 46 08             	mov    0x8(%esi),%eax
+        futex_wait(&b->gen, gen);
+    2c95:	8d 7e 08             	lea    0x8(%esi),%edi
+    while(*(volatile int*)&b->gen == gen)
+    2c98:	39 c3                	cmp    %eax,%ebx
+    2c9a:	75 18                	jne    2cb4 <barrier_wait+0x44>
+    2c9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        futex_wait(&b->gen, gen);
+    2ca0:	83 ec 08             	sub    $0x8,%esp
+    2ca3:	53                   	push   %ebx
+    2ca4:	57                   	push   %edi
+    2ca5:	e8 31 f2 ff ff       	call   1edb <futex_wait>
+    while(*(volatile int*)&b->gen == gen)
+    2caa:	8b 46 08             	mov    0x8(%esi),%eax
+    2cad:	83 c4 10             	add    $0x10,%esp
+    2cb0:	39 d8                	cmp    %ebx,%eax
+    2cb2:	74 ec                	je     2ca0 <barrier_wait+0x30>
+}
+    2cb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2cb7:	5b                   	pop    %ebx
+    2cb8:	5e                   	pop    %esi
+    2cb9:	5f                   	pop    %edi
+    2cba:	5d                   	pop    %ebp
+    2cbb:	c3                   	ret
+    2cbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        b->count = 0;
+    2cc0:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+        fetch_and_add(&b->gen, 1);
+    2cc7:	8d 46 08             	lea    0x8(%esi),%eax
+    2cca:	f0 0f c1 56 08       	lock xadd %edx,0x8(%esi)
+        futex_wake(&b->gen, NPROC);
+    2ccf:	83 ec 08             	sub    $0x8,%esp
+    2cd2:	68 00 04 00 00       	push   $0x400
+    2cd7:	50                   	push   %eax
+    2cd8:	e8 06 f2 ff ff       	call   1ee3 <futex_wake>
+        return;
+    2cdd:	83 c4 10             	add    $0x10,%esp
+}
+    2ce0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2ce3:	5b                   	pop    %ebx
+    2ce4:	5e                   	pop    %esi
+    2ce5:	5f                   	pop    %edi
+    2ce6:	5d                   	pop    %ebp
+    2ce7:	c3                   	ret
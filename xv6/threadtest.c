@@ -1,7 +1,10 @@
 #include "types.h"
 #include "stat.h"
 #include "user.h"
+#include "x86.h"
 #include "ticketlock.h"
+#include "tsync.h"
+#include "sched.h"
 
 #define NULL (void *)(0)
 struct ticketlock lock;
@@ -58,10 +61,329 @@ void test_multi_threads(int num)
 
 
 
+// Two threads take turns, each handing the CPU straight
+// to the other with yield_to() instead of spinning.
+#define ROUNDS 100
+volatile int turn;
+volatile int tid[2];
+
+void pingpong(void *self, void *unused)
+{
+	int me = (int) self;
+
+	for(int i = 0 ; i < ROUNDS ; i++)
+	{
+		while(turn != me)
+			if(tid[1 - me] == 0 || yield_to(tid[1 - me]) < 0)
+				sleep(0);
+		sharedVariable++;
+		turn = 1 - me;
+	}
+	exit();
+}
+
+
+void test_yield_to()
+{
+	printf(1, "\n*** Testing yield_to ***\n");
+	turn = 0;
+	tid[0] = tid[1] = 0;
+	sharedVariable = 0;
+	tid[0] = thread_create(&pingpong, (void*) 0, NULL);
+	tid[1] = thread_create(&pingpong, (void*) 1, NULL);
+	thread_join();
+	thread_join();
+	printf(1, "*** %d turns taken, expected %d ***\n", sharedVariable, 2 * ROUNDS);
+}
+
+
+// Joined threads' stacks are reused, so creating and joining
+// threads over and over must not keep growing the heap.  Each
+// thread also uses more than a page of stack.
+void deepstack(void *unused1, void *unused2)
+{
+	char buf[6000];
+
+	memset(buf, 1, sizeof(buf));
+	exit();
+}
+
+
+void test_stack_reuse()
+{
+	char *brk;
+
+	printf(1, "\n*** Testing thread stack reuse ***\n");
+	thread_create(&deepstack, NULL, NULL);
+	thread_join();
+	brk = sbrk(0);
+	for(int i = 0 ; i < 100 ; i++)
+	{
+		thread_create(&deepstack, NULL, NULL);
+		thread_join();
+	}
+	if(sbrk(0) == brk)
+		printf(1, "*** 100 threads reused one stack ***\n");
+	else
+		printf(1, "*** heap grew by %d bytes ***\n", sbrk(0) - brk);
+}
+
+
+// Readers share a table that writers update; a reader must
+// never see a writer's update half done.
+#define NREADERS 3
+struct rwlock rw;
+int table[2];
+volatile int torn;
+
+void reader(void *unused1, void *unused2)
+{
+	for(int i = 0 ; i < 200 ; i++)
+	{
+		rw_rdlock(&rw);
+		if(table[0] != table[1])
+			torn = 1;
+		rw_unlock(&rw);
+	}
+	exit();
+}
+
+void writer(void *unused1, void *unused2)
+{
+	for(int i = 0 ; i < 100 ; i++)
+	{
+		rw_wrlock(&rw);
+		table[0]++;
+		sleep(0);
+		table[1]++;
+		rw_unlock(&rw);
+	}
+	exit();
+}
+
+
+void test_rwlock()
+{
+	printf(1, "\n*** Testing reader-writer lock ***\n");
+	torn = 0;
+	for(int i = 0 ; i < NREADERS ; i++)
+		thread_create(&reader, NULL, NULL);
+	thread_create(&writer, NULL, NULL);
+	for(int i = 0 ; i <= NREADERS ; i++)
+		thread_join();
+	printf(1, "*** table = %d, %d, %s ***\n", table[0], table[1], torn ? "torn read seen" : "no torn reads");
+}
+
+
+// A producer and a consumer pass items through a small buffer,
+// each sleeping on a condition variable while it cannot go on.
+#define NITEMS 200
+#define BUFSIZE 4
+struct cond notfull, notempty;
+int buf[BUFSIZE], nbuf, consumed;
+
+void producer(void *unused1, void *unused2)
+{
+	for(int i = 1 ; i <= NITEMS ; i++)
+	{
+		lock_acquire(&lock);
+		while(nbuf == BUFSIZE)
+			cond_wait(&notfull, &lock);
+		buf[nbuf++] = i;
+		cond_signal(&notempty);
+		lock_release(&lock);
+	}
+	exit();
+}
+
+void consumer(void *unused1, void *unused2)
+{
+	for(int i = 1 ; i <= NITEMS ; i++)
+	{
+		lock_acquire(&lock);
+		while(nbuf == 0)
+			cond_wait(&notempty, &lock);
+		consumed += buf[--nbuf];
+		cond_signal(&notfull);
+		lock_release(&lock);
+	}
+	exit();
+}
+
+
+void test_cond()
+{
+	printf(1, "\n*** Testing condition variables ***\n");
+	lock_init(&lock);
+	thread_create(&consumer, NULL, NULL);
+	thread_create(&producer, NULL, NULL);
+	thread_join();
+	thread_join();
+	printf(1, "*** consumed %d, expected %d ***\n", consumed, NITEMS * (NITEMS + 1) / 2);
+}
+
+
+// No thread may start a phase before all have finished the last.
+#define NPHASES 20
+#define NBARRIER 4
+struct barrier bar;
+int phase[NBARRIER];
+volatile int early;
+
+void phased(void *self, void *unused)
+{
+	int me = (int) self;
+
+	for(int i = 0 ; i < NPHASES ; i++)
+	{
+		phase[me] = i;
+		barrier_wait(&bar);
+		for(int j = 0 ; j < NBARRIER ; j++)
+			if(phase[j] < i)
+				early = 1;
+		barrier_wait(&bar);
+	}
+	exit();
+}
+
+
+void test_barrier()
+{
+	printf(1, "\n*** Testing barrier ***\n");
+	barrier_init(&bar, NBARRIER);
+	for(int i = 0 ; i < NBARRIER ; i++)
+		thread_create(&phased, (void*) i, NULL);
+	for(int i = 0 ; i < NBARRIER ; i++)
+		thread_join();
+	printf(1, "*** %d phases, %s ***\n", NPHASES, early ? "a thread ran ahead" : "all in step");
+}
+
+
+// Detached threads are never joined; their stacks should be
+// reused all the same, so the heap stops growing.
+#define NDETACHED 64
+int finished;
+
+void detached(void *unused1, void *unused2)
+{
+	fetch_and_add(&finished, 1);
+	exit();
+}
+
+
+void test_detached()
+{
+	char *start;
+
+	printf(1, "\n*** Testing detached threads ***\n");
+	start = sbrk(0);
+	for(int i = 0 ; i < NDETACHED ; i++)
+	{
+		if(thread_create_detached(&detached, NULL, NULL) < 0)
+			break;
+		while(finished <= i)
+			sleep(1);
+	}
+	printf(1, "*** %d detached threads finished, heap grew %d bytes ***\n",
+		finished, sbrk(0) - start);
+}
+
+
+// Threads joined in bulk by thread_join_many().
+void test_join_many()
+{
+	int pids[NBARRIER], n, joined = 0;
+
+	printf(1, "\n*** Testing join_many ***\n");
+	for(int i = 0 ; i < 2 * NBARRIER ; i++)
+		thread_create(&detached, NULL, NULL);
+	while((n = thread_join_many(pids, NBARRIER)) > 0)
+		joined += n;
+	printf(1, "*** %d of %d threads joined ***\n", joined, 2 * NBARRIER);
+}
+
+
+// Threads growing the heap at once each get pages of their
+// own, which every thread can then pass to system calls.
+#define NGROW 8
+char *grown[NBARRIER][NGROW];
+
+void grower(void *self, void *unused)
+{
+	int me = (int) self;
+
+	for(int i = 0 ; i < NGROW ; i++)
+	{
+		grown[me][i] = sbrk(4096);
+		if(grown[me][i] != (char*)-1)
+			grown[me][i][0] = 'a' + me;
+	}
+	exit();
+}
+
+
+void test_sbrk()
+{
+	int fd[2], bad = 0;
+	char c;
+
+	printf(1, "\n*** Testing sbrk from threads ***\n");
+	for(int i = 0 ; i < NBARRIER ; i++)
+		thread_create(&grower, (void*) i, NULL);
+	for(int i = 0 ; i < NBARRIER ; i++)
+		thread_join();
+	pipe(fd);
+	for(int i = 0 ; i < NBARRIER ; i++)
+		for(int j = 0 ; j < NGROW ; j++)
+		{
+			if(grown[i][j] == (char*)-1 || write(fd[1], grown[i][j], 1) != 1)
+			{
+				bad++;
+				continue;
+			}
+			if(read(fd[0], &c, 1) != 1 || c != 'a' + i)
+				bad++;
+		}
+	close(fd[0]);
+	close(fd[1]);
+	printf(1, "*** %d pages grown by threads, %d bad ***\n", NBARRIER * NGROW, bad);
+}
+
+
+// A descriptor a thread opens is open in its siblings too.
+int tfd[2] = {-1, -1};
+
+void opener(void *unused1, void *unused2)
+{
+	pipe(tfd);
+	exit();
+}
+
+
+void test_files()
+{
+	char c = 0;
+
+	printf(1, "\n*** Testing shared files ***\n");
+	thread_create(&opener, NULL, NULL);
+	thread_join();
+	if(tfd[0] < 0 || write(tfd[1], "x", 1) != 1 || read(tfd[0], &c, 1) != 1 || c != 'x')
+		printf(1, "*** pipe opened by a thread not usable ***\n");
+	else
+		printf(1, "*** pipe opened by a thread usable ***\n");
+	close(tfd[0]);
+	close(tfd[1]);
+}
+
+
 int
 main(int argc, char *argv[])
 {
   	const int NTHREADS = 4;
+
+	// "threadtest gang" runs the tests with threads co-scheduled
+	if(argc > 1 && strcmp(argv[1], "gang") == 0)
+		setsched(SCHED_LOTTERY | SCHED_GANG);
   	
   	test_one_thread();
   
@@ -69,5 +391,25 @@ main(int argc, char *argv[])
   	
 	printf(1, "*** Shared Variable = %d ***\n",sharedVariable);
 
+	test_yield_to();
+
+	test_stack_reuse();
+
+	test_rwlock();
+
+	test_cond();
+
+	test_barrier();
+
+	test_detached();
+
+	test_join_many();
+
+	test_sbrk();
+
+	test_files();
+
+	setsched(SCHED_LOTTERY);
+
   	exit();
 }
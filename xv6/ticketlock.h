@@ -4,6 +4,6 @@ struct ticketlock
 {
 	int next_ticket; // next ticket number to be given
 	int current_turn; // current ticket number being served
-	struct proc *proc; // process currently holding the lock
+	int pid; // pid of the process currently holding the lock
 };
 
@@ -0,0 +1,272 @@
+#include "types.h"
+#include "user.h"
+#include "x86.h"
+#include "param.h"
+#include "ticketlock.h"
+#include "tpool.h"
+
+// State of one parallel_for() call, on its caller's stack.
+struct tpfor {
+  void (*body)(int, void*);
+  void *arg;
+  int grain;              // split ranges longer than this
+  int left;               // iterations not yet run
+};
+
+// Bump *seq and wake the threads sleeping on it, if any.
+// Waiters count themselves in *nwait before sleeping, so a
+// waker that sees none need not make a system call.
+static void
+tp_signal(int *seq, int *nwait)
+{
+  fetch_and_add(seq, 1);
+  if(*(volatile int*)nwait)
+    futex_wake(seq, NPROC);
+}
+
+// Sleep until *seq moves on from s, which the caller read
+// before finding it had nothing to do.
+static void
+tp_sleep(int *seq, int s, int *nwait)
+{
+  fetch_and_add(nwait, 1);
+  futex_wait(seq, s);
+  fetch_and_add(nwait, -1);
+}
+
+static int
+tp_push(struct tpdeque *d, struct tptask *t)
+{
+  int ok;
+
+  lock_acquire(&d->lock);
+  if((ok = d->bottom - d->top < TPDEQSIZE))
+    d->task[d->bottom++ % TPDEQSIZE] = *t;
+  lock_release(&d->lock);
+  return ok;
+}
+
+// Take a task from the bottom of our own deque, or if
+// steal is set, from the top of someone else's.
+static int
+tp_pop(struct tpdeque *d, struct tptask *t, int steal)
+{
+  int ok;
+
+  lock_acquire(&d->lock);
+  if((ok = d->bottom > d->top)){
+    if(steal)
+      *t = d->task[d->top++ % TPDEQSIZE];
+    else
+      *t = d->task[--d->bottom % TPDEQSIZE];
+  }
+  lock_release(&d->lock);
+  return ok;
+}
+
+// Find worker w something to do: from its own deque, the
+// shared queue, or another worker's deque, in that order.
+static int
+tp_get(struct tpool *pool, int w, struct tptask *t)
+{
+  int i, ok;
+
+  if(tp_pop(&pool->deque[w], t, 0))
+    return 1;
+  lock_acquire(&pool->qlock);
+  if((ok = pool->qcount > 0)){
+    *t = pool->queue[pool->qhead];
+    pool->qhead = (pool->qhead + 1) % TPQSIZE;
+    pool->qcount--;
+  }
+  lock_release(&pool->qlock);
+  if(ok){
+    tp_signal(&pool->doneseq, &pool->ndonewait);  // a slot is free
+    return 1;
+  }
+  for(i = 1; i < pool->nworkers; i++)
+    if(tp_pop(&pool->deque[(w + i) % pool->nworkers], t, 1))
+      return 1;
+  return 0;
+}
+
+// Run task t on worker w.  A parallel_for range is halved
+// onto w's deque, where idle workers can steal it, until it
+// is no longer than the grain; then w runs what is left.
+static void
+tp_run(struct tpool *pool, int w, struct tptask *t)
+{
+  struct tpfor *pf;
+  struct tptask half;
+  int i;
+
+  if((pf = t->pf) == 0){
+    t->fn(t->arg);
+  } else {
+    while(t->hi - t->lo > pf->grain){
+      half = *t;
+      half.lo = t->lo + (t->hi - t->lo) / 2;
+      if(!tp_push(&pool->deque[w], &half))
+        break;
+      fetch_and_add(&pool->pending, 1);
+      tp_signal(&pool->workseq, &pool->nworkwait);
+      t->hi = half.lo;
+    }
+    for(i = t->lo; i < t->hi; i++)
+      pf->body(i, pf->arg);
+    fetch_and_add(&pf->left, -(t->hi - t->lo));
+  }
+  fetch_and_add(&pool->pending, -1);
+  tp_signal(&pool->doneseq, &pool->ndonewait);
+}
+
+static void
+tp_worker(void *arg, void *id)
+{
+  struct tpool *pool = arg;
+  struct tptask t;
+  int w = (int)id;
+  int s;
+
+  for(;;){
+    s = *(volatile int*)&pool->workseq;
+    if(tp_get(pool, w, &t)){
+      tp_run(pool, w, &t);
+      continue;
+    }
+    if(*(volatile int*)&pool->stop){
+      // The last touch of the pool: tpool_destroy() may free
+      // it as soon as nlive drops, and futex_wake() only uses
+      // its address.
+      fetch_and_add(&pool->nlive, -1);
+      futex_wake(&pool->nlive, 1);
+      exit();
+    }
+    tp_sleep(&pool->workseq, s, &pool->nworkwait);
+  }
+}
+
+// Start a pool of nworkers threads.  The workers are detached:
+// tpool_destroy() waits for them through pool->nlive, since
+// thread_join() would reap whichever of the program's threads
+// exited first.
+struct tpool*
+tpool_create(int nworkers)
+{
+  struct tpool *pool;
+  int i;
+
+  if(nworkers < 1 || nworkers > TPOOLMAX)
+    return 0;
+  if((pool = malloc(sizeof(*pool))) == 0)
+    return 0;
+  memset(pool, 0, sizeof(*pool));
+  pool->nworkers = nworkers;
+  for(i = 0; i < nworkers; i++){
+    fetch_and_add(&pool->nlive, 1);
+    if(thread_create_detached(tp_worker, pool, (void*)i) < 0){
+      fetch_and_add(&pool->nlive, -1);
+      pool->nworkers = i;
+      tpool_destroy(pool);
+      return 0;
+    }
+  }
+  return pool;
+}
+
+// Put t on the shared queue, waiting for room if it is full.
+static void
+tp_enqueue(struct tpool *pool, struct tptask *t)
+{
+  int s;
+
+  fetch_and_add(&pool->pending, 1);
+  for(;;){
+    s = *(volatile int*)&pool->doneseq;
+    lock_acquire(&pool->qlock);
+    if(pool->qcount < TPQSIZE)
+      break;
+    lock_release(&pool->qlock);
+    tp_sleep(&pool->doneseq, s, &pool->ndonewait);
+  }
+  pool->queue[(pool->qhead + pool->qcount) % TPQSIZE] = *t;
+  pool->qcount++;
+  lock_release(&pool->qlock);
+  tp_signal(&pool->workseq, &pool->nworkwait);
+}
+
+// Queue fn(arg) to run on some worker.
+void
+tpool_submit(struct tpool *pool, void (*fn)(void*), void *arg)
+{
+  struct tptask t;
+
+  t.fn = fn;
+  t.arg = arg;
+  t.pf = 0;
+  tp_enqueue(pool, &t);
+}
+
+// Wait until every task submitted so far has finished.
+void
+tpool_wait(struct tpool *pool)
+{
+  int s;
+
+  for(;;){
+    s = *(volatile int*)&pool->doneseq;
+    if(*(volatile int*)&pool->pending == 0)
+      return;
+    tp_sleep(&pool->doneseq, s, &pool->ndonewait);
+  }
+}
+
+// Finish all tasks, then stop the workers and wait until
+// none of them can touch the pool any more.
+void
+tpool_destroy(struct tpool *pool)
+{
+  int n;
+
+  tpool_wait(pool);
+  pool->stop = 1;
+  tp_signal(&pool->workseq, &pool->nworkwait);
+  while((n = *(volatile int*)&pool->nlive) != 0)
+    futex_wait(&pool->nlive, n);
+  free(pool);
+}
+
+// Run body(i, arg) for lo <= i < hi on the pool's workers,
+// and return when all have run.  Must not be called from
+// a task, since it sleeps until the workers are done.
+void
+parallel_for(struct tpool *pool, int lo, int hi,
+             void (*body)(int, void*), void *arg)
+{
+  struct tpfor pf;
+  struct tptask t;
+  int s;
+
+  if(hi <= lo)
+    return;
+  pf.body = body;
+  pf.arg = arg;
+  pf.grain = (hi - lo) / (4 * pool->nworkers);
+  if(pf.grain < 1)
+    pf.grain = 1;
+  pf.left = hi - lo;
+
+  t.fn = 0;
+  t.arg = 0;
+  t.pf = &pf;
+  t.lo = lo;
+  t.hi = hi;
+  tp_enqueue(pool, &t);
+
+  for(;;){
+    s = *(volatile int*)&pool->doneseq;
+    if(*(volatile int*)&pf.left == 0)
+      return;
+    tp_sleep(&pool->doneseq, s, &pool->ndonewait);
+  }
+}
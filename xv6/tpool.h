@@ -0,0 +1,50 @@
+// Thread pool: a fixed set of clone() workers running tasks.
+//
+// Tasks submitted from outside the pool go on a bounded
+// shared queue.  Each worker also has its own deque: a worker
+// pushes and pops work at its bottom, and a worker that runs
+// dry steals from the top of another's.  parallel_for() splits
+// its range onto those deques, so idle workers pick up halves.
+// Idle workers and blocked submitters sleep in futex_wait().
+
+#define TPOOLMAX  8    // most workers in a pool
+#define TPQSIZE  64    // shared queue slots
+#define TPDEQSIZE 32   // slots in each worker's deque
+
+struct tpfor;
+
+struct tptask {
+  void (*fn)(void*);      // run fn(arg)
+  void *arg;
+  struct tpfor *pf;       // or if set, iterations lo..hi-1 of a parallel_for
+  int lo, hi;
+};
+
+struct tpdeque {
+  struct ticketlock lock;
+  int top;                // next task to steal
+  int bottom;             // next free slot
+  struct tptask task[TPDEQSIZE];
+};
+
+struct tpool {
+  int nworkers;
+  int stop;               // set by tpool_destroy()
+  int nlive;              // workers that may still touch the pool
+  int pending;            // tasks submitted but not finished
+  struct ticketlock qlock;  // protects the shared queue
+  int qhead, qcount;
+  struct tptask queue[TPQSIZE];
+  int workseq;            // bumped when work is added, for futex_wait
+  int nworkwait;          // workers sleeping on workseq
+  int doneseq;            // bumped when a task finishes
+  int ndonewait;          // threads sleeping on doneseq
+  struct tpdeque deque[TPOOLMAX];
+};
+
+struct tpool *tpool_create(int nworkers);
+void tpool_submit(struct tpool *pool, void (*fn)(void*), void *arg);
+void tpool_wait(struct tpool *pool);
+void tpool_destroy(struct tpool *pool);
+void parallel_for(struct tpool *pool, int lo, int hi,
+                  void (*body)(int, void*), void *arg);
@@ -36,6 +36,11 @@ idtinit(void)
 void
 trap(struct trapframe *tf)
 {
+  // Time up to a trap from user mode was user time,
+  // time from here until we return to it is system time.
+  if((tf->cs&3) == DPL_USER)
+    cputime(1);
+
   if(tf->trapno == T_SYSCALL){
     if(myproc()->killed)
       exit();
@@ -43,17 +48,31 @@ trap(struct trapframe *tf)
     syscall();
     if(myproc()->killed)
       exit();
+    cputime(0);
     return;
   }
 
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
+    mycpu()->nticks++;
+    if(mycpu()->idle)
+      mycpu()->idleticks++;
     if(cpuid() == 0){
       acquire(&tickslock);
       ticks++;
       wakeup(&ticks);
       release(&tickslock);
     }
+    schedtick();
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_RESCHED:
+    // Only wakes an idle CPU out of hlt; see kick().
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_TLB:
+    lcr3(rcr3());
+    mycpu()->tlbflushes++;
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -107,13 +126,17 @@ trap(struct trapframe *tf)
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU on clock tick, or when
+  // another CPU asked us to reschedule.
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+     (tf->trapno == T_IRQ0+IRQ_TIMER || tf->trapno == T_IRQ0+IRQ_RESCHED))
     yield();
 
   // Check if the process has been killed since we yielded
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
+
+  if((tf->cs&3) == DPL_USER)
+    cputime(0);
 }
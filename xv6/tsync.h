@@ -0,0 +1,24 @@
+// Blocking synchronization for threads, on top of futexes.
+// All are ready to use when zeroed, except that a barrier
+// needs barrier_init() to know how many threads it waits for.
+
+// Reader-writer lock.  Readers share it; a writer has it
+// alone, and new readers wait while a writer is waiting.
+struct rwlock {
+  int state;      // readers holding it, or -1 if a writer does
+  int wwait;      // writers waiting
+  int nwait;      // threads asleep on state
+};
+
+// Condition variable, used with a ticketlock.
+struct cond {
+  int seq;        // bumped by each signal or broadcast
+  int nwait;      // threads asleep on seq
+};
+
+// Barrier for n threads.
+struct barrier {
+  int n;
+  int count;      // threads arrived in this round
+  int gen;        // round number
+};
@@ -3,8 +3,6 @@
 #include "fcntl.h"
 #include "user.h"
 #include "x86.h"
-#include "ticketlock.h"
-#define PGSIZE  4096
 
 char*
 strcpy(char *s, const char *t)
@@ -106,33 +104,3 @@ memmove(void *vdst, const void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
-
-int thread_create(void (*start_routine)(void*, void*), void *arg1, void *arg2)
-{
-	void *stack = sbrk(PGSIZE);
-	return clone(start_routine, arg1, arg2, stack);
-	
-}
-
-int thread_join()
-{
-  	void *stack;
-  	int result = join(&stack);	
-  	return result;
-}
-
-// ticket lock
-void lock_init(struct ticketlock *lock)
-{
-    initlock_t(lock);
-}
-
-void lock_acquire(struct ticketlock *lock)
-{
-    acquire_t(lock);
-}
-
-void lock_release(struct ticketlock *lock)
-{
-    release_t(lock);
-}
@@ -2,6 +2,9 @@ struct stat;
 struct rtcdate;
 struct pstat;
 struct ticketlock;
+struct rwlock;
+struct cond;
+struct barrier;
 
 // system calls
 int fork(void);
@@ -29,11 +32,23 @@ int settickets(int);
 int getpinfo(struct pstat*);
 int mprotect(void *addr, int len);
 int munprotect(void *addr, int len);
-int clone(void(*fcn)(void*, void*), void *arg1, void *arg2, void* stack);
+int clone(void(*fcn)(void*, void*), void *arg1, void *arg2, void* stack, int flags);
 int join(void**);
+int join_any(int *pids, void **stacks, int n, int flags);
 void initlock_t(struct ticketlock *lk);
 void acquire_t(struct ticketlock *lk);
 void release_t(struct ticketlock *lk);
+int setsched(int);
+int mkgroup(int);
+int joingroup(int);
+int transfer_tickets(int);
+int setdeadline(int, int);
+int setaffinity(int, int);
+int yield_to(int);
+int getlatency(int, uint*);
+int futex_wait(int*, int);
+int futex_wake(int*, int);
+int mguard(void *addr, int len);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -50,6 +65,16 @@ void free(void*);
 int atoi(const char*);
 int thread_create(void(*fcn)(void*, void*), void *arg1, void *arg2);
 int thread_join();
+int thread_create_detached(void(*fcn)(void*, void*), void *arg1, void *arg2);
+int thread_join_many(int *pids, int n);
 void lock_init(struct ticketlock *lock);
 void lock_acquire(struct ticketlock *lock);
 void lock_release(struct ticketlock *lock);
+void rw_rdlock(struct rwlock *rw);
+void rw_wrlock(struct rwlock *rw);
+void rw_unlock(struct rwlock *rw);
+void cond_wait(struct cond *cv, struct ticketlock *lock);
+void cond_signal(struct cond *cv);
+void cond_broadcast(struct cond *cv);
+void barrier_init(struct barrier *b, int n);
+void barrier_wait(struct barrier *b);
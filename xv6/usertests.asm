@@ -0,0 +1,6678 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	51                   	push   %ecx
+    100e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+    1011:	68 b6 5d 00 00       	push   $0x5db6
+    1016:	6a 01                	push   $0x1
+    1018:	e8 83 3a 00 00       	call   4aa0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+    101d:	59                   	pop    %ecx
+    101e:	58                   	pop    %eax
+    101f:	6a 00                	push   $0x0
+    1021:	68 ca 5d 00 00       	push   $0x5dca
+    1026:	e8 c8 38 00 00       	call   48f3 <open>
+    102b:	83 c4 10             	add    $0x10,%esp
+    102e:	85 c0                	test   %eax,%eax
+    1030:	78 13                	js     1045 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    1032:	52                   	push   %edx
+    1033:	52                   	push   %edx
+    1034:	68 34 65 00 00       	push   $0x6534
+    1039:	6a 01                	push   $0x1
+    103b:	e8 60 3a 00 00       	call   4aa0 <printf>
+    exit();
+    1040:	e8 6e 38 00 00       	call   48b3 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    1045:	50                   	push   %eax
+    1046:	50                   	push   %eax
+    1047:	68 00 02 00 00       	push   $0x200
+    104c:	68 ca 5d 00 00       	push   $0x5dca
+    1051:	e8 9d 38 00 00       	call   48f3 <open>
+    1056:	89 04 24             	mov    %eax,(%esp)
+    1059:	e8 7d 38 00 00       	call   48db <close>
+
+  argptest();
+    105e:	e8 7d 35 00 00       	call   45e0 <argptest>
+  createdelete();
+    1063:	e8 c8 11 00 00       	call   2230 <createdelete>
+  linkunlink();
+    1068:	e8 63 1a 00 00       	call   2ad0 <linkunlink>
+  concreate();
+    106d:	e8 5e 17 00 00       	call   27d0 <concreate>
+  fourfiles();
+    1072:	e8 b9 0f 00 00       	call   2030 <fourfiles>
+  sharedfd();
+    1077:	e8 f4 0d 00 00       	call   1e70 <sharedfd>
+
+  bigargtest();
+    107c:	e8 1f 32 00 00       	call   42a0 <bigargtest>
+  bigwrite();
+    1081:	e8 6a 23 00 00       	call   33f0 <bigwrite>
+  bigargtest();
+    1086:	e8 15 32 00 00       	call   42a0 <bigargtest>
+  bsstest();
+    108b:	e8 a0 31 00 00       	call   4230 <bsstest>
+  sbrktest();
+    1090:	e8 9b 2c 00 00       	call   3d30 <sbrktest>
+  validatetest();
+    1095:	e8 e6 30 00 00       	call   4180 <validatetest>
+
+  opentest();
+    109a:	e8 61 03 00 00       	call   1400 <opentest>
+  writetest();
+    109f:	e8 ec 03 00 00       	call   1490 <writetest>
+  writetest1();
+    10a4:	e8 c7 05 00 00       	call   1670 <writetest1>
+  createtest();
+    10a9:	e8 92 07 00 00       	call   1840 <createtest>
+
+  openiputtest();
+    10ae:	e8 4d 02 00 00       	call   1300 <openiputtest>
+  exitiputtest();
+    10b3:	e8 48 01 00 00       	call   1200 <exitiputtest>
+  iputtest();
+    10b8:	e8 63 00 00 00       	call   1120 <iputtest>
+
+  mem();
+    10bd:	e8 de 0c 00 00       	call   1da0 <mem>
+  pipe1();
+    10c2:	e8 59 09 00 00       	call   1a20 <pipe1>
+  preempt();
+    10c7:	e8 f4 0a 00 00       	call   1bc0 <preempt>
+  exitwait();
+    10cc:	e8 4f 0c 00 00       	call   1d20 <exitwait>
+
+  rmdot();
+    10d1:	e8 0a 27 00 00       	call   37e0 <rmdot>
+  fourteen();
+    10d6:	e8 c5 25 00 00       	call   36a0 <fourteen>
+  bigfile();
+    10db:	e8 f0 23 00 00       	call   34d0 <bigfile>
+  subdir();
+    10e0:	e8 2b 1c 00 00       	call   2d10 <subdir>
+  linktest();
+    10e5:	e8 d6 14 00 00       	call   25c0 <linktest>
+  unlinkread();
+    10ea:	e8 41 13 00 00       	call   2430 <unlinkread>
+  dirfile();
+    10ef:	e8 6c 28 00 00       	call   3960 <dirfile>
+  iref();
+    10f4:	e8 67 2a 00 00       	call   3b60 <iref>
+  forktest();
+    10f9:	e8 82 2b 00 00       	call   3c80 <forktest>
+  bigdir(); // slow
+    10fe:	e8 dd 1a 00 00       	call   2be0 <bigdir>
+
+  uio();
+    1103:	e8 68 34 00 00       	call   4570 <uio>
+
+  exectest();
+    1108:	e8 c3 08 00 00       	call   19d0 <exectest>
+
+  exit();
+    110d:	e8 a1 37 00 00       	call   48b3 <exit>
+    1112:	66 90                	xchg   %ax,%ax
+    1114:	66 90                	xchg   %ax,%ax
+    1116:	66 90                	xchg   %ax,%ax
+    1118:	66 90                	xchg   %ax,%ax
+    111a:	66 90                	xchg   %ax,%ax
+    111c:	66 90                	xchg   %ax,%ax
+    111e:	66 90                	xchg   %ax,%ax
+
+00001120 <iputtest>:
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+    1126:	68 5c 4e 00 00       	push   $0x4e5c
+    112b:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1131:	e8 6a 39 00 00       	call   4aa0 <printf>
+  if(mkdir("iputdir") < 0){
+    1136:	c7 04 24 ef 4d 00 00 	movl   $0x4def,(%esp)
+    113d:	e8 d9 37 00 00       	call   491b <mkdir>
+    1142:	83 c4 10             	add    $0x10,%esp
+    1145:	85 c0                	test   %eax,%eax
+    1147:	78 58                	js     11a1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+    1149:	83 ec 0c             	sub    $0xc,%esp
+    114c:	68 ef 4d 00 00       	push   $0x4def
+    1151:	e8 cd 37 00 00       	call   4923 <chdir>
+    1156:	83 c4 10             	add    $0x10,%esp
+    1159:	85 c0                	test   %eax,%eax
+    115b:	0f 88 85 00 00 00    	js     11e6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+    1161:	83 ec 0c             	sub    $0xc,%esp
+    1164:	68 ec 4d 00 00       	push   $0x4dec
+    1169:	e8 95 37 00 00       	call   4903 <unlink>
+    116e:	83 c4 10             	add    $0x10,%esp
+    1171:	85 c0                	test   %eax,%eax
+    1173:	78 5a                	js     11cf <iputtest+0xaf>
+  if(chdir("/") < 0){
+    1175:	83 ec 0c             	sub    $0xc,%esp
+    1178:	68 11 4e 00 00       	push   $0x4e11
+    117d:	e8 a1 37 00 00       	call   4923 <chdir>
+    1182:	83 c4 10             	add    $0x10,%esp
+    1185:	85 c0                	test   %eax,%eax
+    1187:	78 2f                	js     11b8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+    1189:	83 ec 08             	sub    $0x8,%esp
+    118c:	68 94 4e 00 00       	push   $0x4e94
+    1191:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1197:	e8 04 39 00 00       	call   4aa0 <printf>
+}
+    119c:	83 c4 10             	add    $0x10,%esp
+    119f:	c9                   	leave
+    11a0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+    11a1:	50                   	push   %eax
+    11a2:	50                   	push   %eax
+    11a3:	68 c8 4d 00 00       	push   $0x4dc8
+    11a8:	ff 35 a8 6e 00 00    	push   0x6ea8
+    11ae:	e8 ed 38 00 00       	call   4aa0 <printf>
+    exit();
+    11b3:	e8 fb 36 00 00       	call   48b3 <exit>
+    printf(stdout, "chdir / failed\n");
+    11b8:	50                   	push   %eax
+    11b9:	50                   	push   %eax
+    11ba:	68 13 4e 00 00       	push   $0x4e13
+    11bf:	ff 35 a8 6e 00 00    	push   0x6ea8
+    11c5:	e8 d6 38 00 00       	call   4aa0 <printf>
+    exit();
+    11ca:	e8 e4 36 00 00       	call   48b3 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+    11cf:	52                   	push   %edx
+    11d0:	52                   	push   %edx
+    11d1:	68 f7 4d 00 00       	push   $0x4df7
+    11d6:	ff 35 a8 6e 00 00    	push   0x6ea8
+    11dc:	e8 bf 38 00 00       	call   4aa0 <printf>
+    exit();
+    11e1:	e8 cd 36 00 00       	call   48b3 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+    11e6:	51                   	push   %ecx
+    11e7:	51                   	push   %ecx
+    11e8:	68 d6 4d 00 00       	push   $0x4dd6
+    11ed:	ff 35 a8 6e 00 00    	push   0x6ea8
+    11f3:	e8 a8 38 00 00       	call   4aa0 <printf>
+    exit();
+    11f8:	e8 b6 36 00 00       	call   48b3 <exit>
+    11fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001200 <exitiputtest>:
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+    1206:	68 23 4e 00 00       	push   $0x4e23
+    120b:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1211:	e8 8a 38 00 00       	call   4aa0 <printf>
+  pid = fork();
+    1216:	e8 90 36 00 00       	call   48ab <fork>
+  if(pid < 0){
+    121b:	83 c4 10             	add    $0x10,%esp
+    121e:	85 c0                	test   %eax,%eax
+    1220:	0f 88 8a 00 00 00    	js     12b0 <exitiputtest+0xb0>
+  if(pid == 0){
+    1226:	75 50                	jne    1278 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+    1228:	83 ec 0c             	sub    $0xc,%esp
+    122b:	68 ef 4d 00 00       	push   $0x4def
+    1230:	e8 e6 36 00 00       	call   491b <mkdir>
+    1235:	83 c4 10             	add    $0x10,%esp
+    1238:	85 c0                	test   %eax,%eax
+    123a:	0f 88 87 00 00 00    	js     12c7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+    1240:	83 ec 0c             	sub    $0xc,%esp
+    1243:	68 ef 4d 00 00       	push   $0x4def
+    1248:	e8 d6 36 00 00       	call   4923 <chdir>
+    124d:	83 c4 10             	add    $0x10,%esp
+    1250:	85 c0                	test   %eax,%eax
+    1252:	0f 88 86 00 00 00    	js     12de <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+    1258:	83 ec 0c             	sub    $0xc,%esp
+    125b:	68 ec 4d 00 00       	push   $0x4dec
+    1260:	e8 9e 36 00 00       	call   4903 <unlink>
+    1265:	83 c4 10             	add    $0x10,%esp
+    1268:	85 c0                	test   %eax,%eax
+    126a:	78 2c                	js     1298 <exitiputtest+0x98>
+    exit();
+    126c:	e8 42 36 00 00       	call   48b3 <exit>
+    1271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+    1278:	e8 3e 36 00 00       	call   48bb <wait>
+  printf(stdout, "exitiput test ok\n");
+    127d:	83 ec 08             	sub    $0x8,%esp
+    1280:	68 46 4e 00 00       	push   $0x4e46
+    1285:	ff 35 a8 6e 00 00    	push   0x6ea8
+    128b:	e8 10 38 00 00       	call   4aa0 <printf>
+}
+    1290:	83 c4 10             	add    $0x10,%esp
+    1293:	c9                   	leave
+    1294:	c3                   	ret
+    1295:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+    1298:	83 ec 08             	sub    $0x8,%esp
+    129b:	68 f7 4d 00 00       	push   $0x4df7
+    12a0:	ff 35 a8 6e 00 00    	push   0x6ea8
+    12a6:	e8 f5 37 00 00       	call   4aa0 <printf>
+      exit();
+    12ab:	e8 03 36 00 00       	call   48b3 <exit>
+    printf(stdout, "fork failed\n");
+    12b0:	51                   	push   %ecx
+    12b1:	51                   	push   %ecx
+    12b2:	68 09 5d 00 00       	push   $0x5d09
+    12b7:	ff 35 a8 6e 00 00    	push   0x6ea8
+    12bd:	e8 de 37 00 00       	call   4aa0 <printf>
+    exit();
+    12c2:	e8 ec 35 00 00       	call   48b3 <exit>
+      printf(stdout, "mkdir failed\n");
+    12c7:	52                   	push   %edx
+    12c8:	52                   	push   %edx
+    12c9:	68 c8 4d 00 00       	push   $0x4dc8
+    12ce:	ff 35 a8 6e 00 00    	push   0x6ea8
+    12d4:	e8 c7 37 00 00       	call   4aa0 <printf>
+      exit();
+    12d9:	e8 d5 35 00 00       	call   48b3 <exit>
+      printf(stdout, "child chdir failed\n");
+    12de:	50                   	push   %eax
+    12df:	50                   	push   %eax
+    12e0:	68 32 4e 00 00       	push   $0x4e32
+    12e5:	ff 35 a8 6e 00 00    	push   0x6ea8
+    12eb:	e8 b0 37 00 00       	call   4aa0 <printf>
+      exit();
+    12f0:	e8 be 35 00 00       	call   48b3 <exit>
+    12f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001300 <openiputtest>:
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+    1306:	68 58 4e 00 00       	push   $0x4e58
+    130b:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1311:	e8 8a 37 00 00       	call   4aa0 <printf>
+  if(mkdir("oidir") < 0){
+    1316:	c7 04 24 67 4e 00 00 	movl   $0x4e67,(%esp)
+    131d:	e8 f9 35 00 00       	call   491b <mkdir>
+    1322:	83 c4 10             	add    $0x10,%esp
+    1325:	85 c0                	test   %eax,%eax
+    1327:	0f 88 9f 00 00 00    	js     13cc <openiputtest+0xcc>
+  pid = fork();
+    132d:	e8 79 35 00 00       	call   48ab <fork>
+  if(pid < 0){
+    1332:	85 c0                	test   %eax,%eax
+    1334:	78 7f                	js     13b5 <openiputtest+0xb5>
+  if(pid == 0){
+    1336:	75 38                	jne    1370 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+    1338:	83 ec 08             	sub    $0x8,%esp
+    133b:	6a 02                	push   $0x2
+    133d:	68 67 4e 00 00       	push   $0x4e67
+    1342:	e8 ac 35 00 00       	call   48f3 <open>
+    if(fd >= 0){
+    1347:	83 c4 10             	add    $0x10,%esp
+    134a:	85 c0                	test   %eax,%eax
+    134c:	78 62                	js     13b0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+    134e:	83 ec 08             	sub    $0x8,%esp
+    1351:	68 ec 5d 00 00       	push   $0x5dec
+    1356:	ff 35 a8 6e 00 00    	push   0x6ea8
+    135c:	e8 3f 37 00 00       	call   4aa0 <printf>
+      exit();
+    1361:	e8 4d 35 00 00       	call   48b3 <exit>
+    1366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+    1370:	83 ec 0c             	sub    $0xc,%esp
+    1373:	6a 01                	push   $0x1
+    1375:	e8 c9 35 00 00       	call   4943 <sleep>
+  if(unlink("oidir") != 0){
+    137a:	c7 04 24 67 4e 00 00 	movl   $0x4e67,(%esp)
+    1381:	e8 7d 35 00 00       	call   4903 <unlink>
+    1386:	83 c4 10             	add    $0x10,%esp
+    1389:	85 c0                	test   %eax,%eax
+    138b:	75 56                	jne    13e3 <openiputtest+0xe3>
+  wait();
+    138d:	e8 29 35 00 00       	call   48bb <wait>
+  printf(stdout, "openiput test ok\n");
+    1392:	83 ec 08             	sub    $0x8,%esp
+    1395:	68 90 4e 00 00       	push   $0x4e90
+    139a:	ff 35 a8 6e 00 00    	push   0x6ea8
+    13a0:	e8 fb 36 00 00       	call   4aa0 <printf>
+}
+    13a5:	83 c4 10             	add    $0x10,%esp
+    13a8:	c9                   	leave
+    13a9:	c3                   	ret
+    13aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+    13b0:	e8 fe 34 00 00       	call   48b3 <exit>
+    printf(stdout, "fork failed\n");
+    13b5:	52                   	push   %edx
+    13b6:	52                   	push   %edx
+    13b7:	68 09 5d 00 00       	push   $0x5d09
+    13bc:	ff 35 a8 6e 00 00    	push   0x6ea8
+    13c2:	e8 d9 36 00 00       	call   4aa0 <printf>
+    exit();
+    13c7:	e8 e7 34 00 00       	call   48b3 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+    13cc:	51                   	push   %ecx
+    13cd:	51                   	push   %ecx
+    13ce:	68 6d 4e 00 00       	push   $0x4e6d
+    13d3:	ff 35 a8 6e 00 00    	push   0x6ea8
+    13d9:	e8 c2 36 00 00       	call   4aa0 <printf>
+    exit();
+    13de:	e8 d0 34 00 00       	call   48b3 <exit>
+    printf(stdout, "unlink failed\n");
+    13e3:	50                   	push   %eax
+    13e4:	50                   	push   %eax
+    13e5:	68 81 4e 00 00       	push   $0x4e81
+    13ea:	ff 35 a8 6e 00 00    	push   0x6ea8
+    13f0:	e8 ab 36 00 00       	call   4aa0 <printf>
+    exit();
+    13f5:	e8 b9 34 00 00       	call   48b3 <exit>
+    13fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001400 <opentest>:
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+    1406:	68 a2 4e 00 00       	push   $0x4ea2
+    140b:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1411:	e8 8a 36 00 00       	call   4aa0 <printf>
+  fd = open("echo", 0);
+    1416:	58                   	pop    %eax
+    1417:	5a                   	pop    %edx
+    1418:	6a 00                	push   $0x0
+    141a:	68 ad 4e 00 00       	push   $0x4ead
+    141f:	e8 cf 34 00 00       	call   48f3 <open>
+  if(fd < 0){
+    1424:	83 c4 10             	add    $0x10,%esp
+    1427:	85 c0                	test   %eax,%eax
+    1429:	78 36                	js     1461 <opentest+0x61>
+  close(fd);
+    142b:	83 ec 0c             	sub    $0xc,%esp
+    142e:	50                   	push   %eax
+    142f:	e8 a7 34 00 00       	call   48db <close>
+  fd = open("doesnotexist", 0);
+    1434:	5a                   	pop    %edx
+    1435:	59                   	pop    %ecx
+    1436:	6a 00                	push   $0x0
+    1438:	68 c5 4e 00 00       	push   $0x4ec5
+    143d:	e8 b1 34 00 00       	call   48f3 <open>
+  if(fd >= 0){
+    1442:	83 c4 10             	add    $0x10,%esp
+    1445:	85 c0                	test   %eax,%eax
+    1447:	79 2f                	jns    1478 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+    1449:	83 ec 08             	sub    $0x8,%esp
+    144c:	68 f0 4e 00 00       	push   $0x4ef0
+    1451:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1457:	e8 44 36 00 00       	call   4aa0 <printf>
+}
+    145c:	83 c4 10             	add    $0x10,%esp
+    145f:	c9                   	leave
+    1460:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+    1461:	50                   	push   %eax
+    1462:	50                   	push   %eax
+    1463:	68 b2 4e 00 00       	push   $0x4eb2
+    1468:	ff 35 a8 6e 00 00    	push   0x6ea8
+    146e:	e8 2d 36 00 00       	call   4aa0 <printf>
+    exit();
+    1473:	e8 3b 34 00 00       	call   48b3 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+    1478:	50                   	push   %eax
+    1479:	50                   	push   %eax
+    147a:	68 d2 4e 00 00       	push   $0x4ed2
+    147f:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1485:	e8 16 36 00 00       	call   4aa0 <printf>
+    exit();
+    148a:	e8 24 34 00 00       	call   48b3 <exit>
+    148f:	90                   	nop
+
+00001490 <writetest>:
+{
+    1490:	55                   	push   %ebp
+    1491:	89 e5                	mov    %esp,%ebp
+    1493:	56                   	push   %esi
+    1494:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+    1495:	83 ec 08             	sub    $0x8,%esp
+    1498:	68 fe 4e 00 00       	push   $0x4efe
+    149d:	ff 35 a8 6e 00 00    	push   0x6ea8
+    14a3:	e8 f8 35 00 00       	call   4aa0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+    14a8:	58                   	pop    %eax
+    14a9:	5a                   	pop    %edx
+    14aa:	68 02 02 00 00       	push   $0x202
+    14af:	68 0f 4f 00 00       	push   $0x4f0f
+    14b4:	e8 3a 34 00 00       	call   48f3 <open>
+  if(fd >= 0){
+    14b9:	83 c4 10             	add    $0x10,%esp
+    14bc:	85 c0                	test   %eax,%eax
+    14be:	0f 88 88 01 00 00    	js     164c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+    14c4:	83 ec 08             	sub    $0x8,%esp
+    14c7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+    14c9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+    14cb:	68 15 4f 00 00       	push   $0x4f15
+    14d0:	ff 35 a8 6e 00 00    	push   0x6ea8
+    14d6:	e8 c5 35 00 00       	call   4aa0 <printf>
+    14db:	83 c4 10             	add    $0x10,%esp
+    14de:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+    14e0:	83 ec 04             	sub    $0x4,%esp
+    14e3:	6a 0a                	push   $0xa
+    14e5:	68 4c 4f 00 00       	push   $0x4f4c
+    14ea:	56                   	push   %esi
+    14eb:	e8 e3 33 00 00       	call   48d3 <write>
+    14f0:	83 c4 10             	add    $0x10,%esp
+    14f3:	83 f8 0a             	cmp    $0xa,%eax
+    14f6:	0f 85 d9 00 00 00    	jne    15d5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+    14fc:	83 ec 04             	sub    $0x4,%esp
+    14ff:	6a 0a                	push   $0xa
+    1501:	68 57 4f 00 00       	push   $0x4f57
+    1506:	56                   	push   %esi
+    1507:	e8 c7 33 00 00       	call   48d3 <write>
+    150c:	83 c4 10             	add    $0x10,%esp
+    150f:	83 f8 0a             	cmp    $0xa,%eax
+    1512:	0f 85 d6 00 00 00    	jne    15ee <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+    1518:	83 c3 01             	add    $0x1,%ebx
+    151b:	83 fb 64             	cmp    $0x64,%ebx
+    151e:	75 c0                	jne    14e0 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+    1520:	83 ec 08             	sub    $0x8,%esp
+    1523:	68 62 4f 00 00       	push   $0x4f62
+    1528:	ff 35 a8 6e 00 00    	push   0x6ea8
+    152e:	e8 6d 35 00 00       	call   4aa0 <printf>
+  close(fd);
+    1533:	89 34 24             	mov    %esi,(%esp)
+    1536:	e8 a0 33 00 00       	call   48db <close>
+  fd = open("small", O_RDONLY);
+    153b:	5b                   	pop    %ebx
+    153c:	5e                   	pop    %esi
+    153d:	6a 00                	push   $0x0
+    153f:	68 0f 4f 00 00       	push   $0x4f0f
+    1544:	e8 aa 33 00 00       	call   48f3 <open>
+  if(fd >= 0){
+    1549:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+    154c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+    154e:	85 c0                	test   %eax,%eax
+    1550:	0f 88 b1 00 00 00    	js     1607 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+    1556:	83 ec 08             	sub    $0x8,%esp
+    1559:	68 6d 4f 00 00       	push   $0x4f6d
+    155e:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1564:	e8 37 35 00 00       	call   4aa0 <printf>
+  i = read(fd, buf, 2000);
+    1569:	83 c4 0c             	add    $0xc,%esp
+    156c:	68 d0 07 00 00       	push   $0x7d0
+    1571:	68 e0 95 00 00       	push   $0x95e0
+    1576:	53                   	push   %ebx
+    1577:	e8 4f 33 00 00       	call   48cb <read>
+  if(i == 2000){
+    157c:	83 c4 10             	add    $0x10,%esp
+    157f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+    1584:	0f 85 94 00 00 00    	jne    161e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+    158a:	83 ec 08             	sub    $0x8,%esp
+    158d:	68 a1 4f 00 00       	push   $0x4fa1
+    1592:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1598:	e8 03 35 00 00       	call   4aa0 <printf>
+  close(fd);
+    159d:	89 1c 24             	mov    %ebx,(%esp)
+    15a0:	e8 36 33 00 00       	call   48db <close>
+  if(unlink("small") < 0){
+    15a5:	c7 04 24 0f 4f 00 00 	movl   $0x4f0f,(%esp)
+    15ac:	e8 52 33 00 00       	call   4903 <unlink>
+    15b1:	83 c4 10             	add    $0x10,%esp
+    15b4:	85 c0                	test   %eax,%eax
+    15b6:	78 7d                	js     1635 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+    15b8:	83 ec 08             	sub    $0x8,%esp
+    15bb:	68 c9 4f 00 00       	push   $0x4fc9
+    15c0:	ff 35 a8 6e 00 00    	push   0x6ea8
+    15c6:	e8 d5 34 00 00       	call   4aa0 <printf>
+}
+    15cb:	83 c4 10             	add    $0x10,%esp
+    15ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    15d1:	5b                   	pop    %ebx
+    15d2:	5e                   	pop    %esi
+    15d3:	5d                   	pop    %ebp
+    15d4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+    15d5:	83 ec 04             	sub    $0x4,%esp
+    15d8:	53                   	push   %ebx
+    15d9:	68 10 5e 00 00       	push   $0x5e10
+    15de:	ff 35 a8 6e 00 00    	push   0x6ea8
+    15e4:	e8 b7 34 00 00       	call   4aa0 <printf>
+      exit();
+    15e9:	e8 c5 32 00 00       	call   48b3 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+    15ee:	83 ec 04             	sub    $0x4,%esp
+    15f1:	53                   	push   %ebx
+    15f2:	68 34 5e 00 00       	push   $0x5e34
+    15f7:	ff 35 a8 6e 00 00    	push   0x6ea8
+    15fd:	e8 9e 34 00 00       	call   4aa0 <printf>
+      exit();
+    1602:	e8 ac 32 00 00       	call   48b3 <exit>
+    printf(stdout, "error: open small failed!\n");
+    1607:	51                   	push   %ecx
+    1608:	51                   	push   %ecx
+    1609:	68 86 4f 00 00       	push   $0x4f86
+    160e:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1614:	e8 87 34 00 00       	call   4aa0 <printf>
+    exit();
+    1619:	e8 95 32 00 00       	call   48b3 <exit>
+    printf(stdout, "read failed\n");
+    161e:	52                   	push   %edx
+    161f:	52                   	push   %edx
+    1620:	68 cd 52 00 00       	push   $0x52cd
+    1625:	ff 35 a8 6e 00 00    	push   0x6ea8
+    162b:	e8 70 34 00 00       	call   4aa0 <printf>
+    exit();
+    1630:	e8 7e 32 00 00       	call   48b3 <exit>
+    printf(stdout, "unlink small failed\n");
+    1635:	50                   	push   %eax
+    1636:	50                   	push   %eax
+    1637:	68 b4 4f 00 00       	push   $0x4fb4
+    163c:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1642:	e8 59 34 00 00       	call   4aa0 <printf>
+    exit();
+    1647:	e8 67 32 00 00       	call   48b3 <exit>
+    printf(stdout, "error: creat small failed!\n");
+    164c:	50                   	push   %eax
+    164d:	50                   	push   %eax
+    164e:	68 30 4f 00 00       	push   $0x4f30
+    1653:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1659:	e8 42 34 00 00       	call   4aa0 <printf>
+    exit();
+    165e:	e8 50 32 00 00       	call   48b3 <exit>
+    1663:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    166a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001670 <writetest1>:
+{
+    1670:	55                   	push   %ebp
+    1671:	89 e5                	mov    %esp,%ebp
+    1673:	56                   	push   %esi
+    1674:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+    1675:	83 ec 08             	sub    $0x8,%esp
+    1678:	68 dd 4f 00 00       	push   $0x4fdd
+    167d:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1683:	e8 18 34 00 00       	call   4aa0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+    1688:	58                   	pop    %eax
+    1689:	5a                   	pop    %edx
+    168a:	68 02 02 00 00       	push   $0x202
+    168f:	68 57 50 00 00       	push   $0x5057
+    1694:	e8 5a 32 00 00       	call   48f3 <open>
+  if(fd < 0){
+    1699:	83 c4 10             	add    $0x10,%esp
+    169c:	85 c0                	test   %eax,%eax
+    169e:	0f 88 61 01 00 00    	js     1805 <writetest1+0x195>
+    16a4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+    16a6:	31 db                	xor    %ebx,%ebx
+    16a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16af:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+    16b0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+    16b3:	89 1d e0 95 00 00    	mov    %ebx,0x95e0
+    if(write(fd, buf, 512) != 512){
+    16b9:	68 00 02 00 00       	push   $0x200
+    16be:	68 e0 95 00 00       	push   $0x95e0
+    16c3:	56                   	push   %esi
+    16c4:	e8 0a 32 00 00       	call   48d3 <write>
+    16c9:	83 c4 10             	add    $0x10,%esp
+    16cc:	3d 00 02 00 00       	cmp    $0x200,%eax
+    16d1:	0f 85 b3 00 00 00    	jne    178a <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+    16d7:	83 c3 01             	add    $0x1,%ebx
+    16da:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+    16e0:	75 ce                	jne    16b0 <writetest1+0x40>
+  close(fd);
+    16e2:	83 ec 0c             	sub    $0xc,%esp
+    16e5:	56                   	push   %esi
+    16e6:	e8 f0 31 00 00       	call   48db <close>
+  fd = open("big", O_RDONLY);
+    16eb:	5b                   	pop    %ebx
+    16ec:	5e                   	pop    %esi
+    16ed:	6a 00                	push   $0x0
+    16ef:	68 57 50 00 00       	push   $0x5057
+    16f4:	e8 fa 31 00 00       	call   48f3 <open>
+  if(fd < 0){
+    16f9:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+    16fc:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    16fe:	85 c0                	test   %eax,%eax
+    1700:	0f 88 e8 00 00 00    	js     17ee <writetest1+0x17e>
+  n = 0;
+    1706:	31 f6                	xor    %esi,%esi
+    1708:	eb 1d                	jmp    1727 <writetest1+0xb7>
+    170a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+    1710:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1715:	0f 85 9f 00 00 00    	jne    17ba <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+    171b:	a1 e0 95 00 00       	mov    0x95e0,%eax
+    1720:	39 f0                	cmp    %esi,%eax
+    1722:	75 7f                	jne    17a3 <writetest1+0x133>
+    n++;
+    1724:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+    1727:	83 ec 04             	sub    $0x4,%esp
+    172a:	68 00 02 00 00       	push   $0x200
+    172f:	68 e0 95 00 00       	push   $0x95e0
+    1734:	53                   	push   %ebx
+    1735:	e8 91 31 00 00       	call   48cb <read>
+    if(i == 0){
+    173a:	83 c4 10             	add    $0x10,%esp
+    173d:	85 c0                	test   %eax,%eax
+    173f:	75 cf                	jne    1710 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+    1741:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+    1747:	0f 84 86 00 00 00    	je     17d3 <writetest1+0x163>
+  close(fd);
+    174d:	83 ec 0c             	sub    $0xc,%esp
+    1750:	53                   	push   %ebx
+    1751:	e8 85 31 00 00       	call   48db <close>
+  if(unlink("big") < 0){
+    1756:	c7 04 24 57 50 00 00 	movl   $0x5057,(%esp)
+    175d:	e8 a1 31 00 00       	call   4903 <unlink>
+    1762:	83 c4 10             	add    $0x10,%esp
+    1765:	85 c0                	test   %eax,%eax
+    1767:	0f 88 af 00 00 00    	js     181c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+    176d:	83 ec 08             	sub    $0x8,%esp
+    1770:	68 7e 50 00 00       	push   $0x507e
+    1775:	ff 35 a8 6e 00 00    	push   0x6ea8
+    177b:	e8 20 33 00 00       	call   4aa0 <printf>
+}
+    1780:	83 c4 10             	add    $0x10,%esp
+    1783:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1786:	5b                   	pop    %ebx
+    1787:	5e                   	pop    %esi
+    1788:	5d                   	pop    %ebp
+    1789:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+    178a:	83 ec 04             	sub    $0x4,%esp
+    178d:	53                   	push   %ebx
+    178e:	68 07 50 00 00       	push   $0x5007
+    1793:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1799:	e8 02 33 00 00       	call   4aa0 <printf>
+      exit();
+    179e:	e8 10 31 00 00       	call   48b3 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+    17a3:	50                   	push   %eax
+    17a4:	56                   	push   %esi
+    17a5:	68 58 5e 00 00       	push   $0x5e58
+    17aa:	ff 35 a8 6e 00 00    	push   0x6ea8
+    17b0:	e8 eb 32 00 00       	call   4aa0 <printf>
+      exit();
+    17b5:	e8 f9 30 00 00       	call   48b3 <exit>
+      printf(stdout, "read failed %d\n", i);
+    17ba:	83 ec 04             	sub    $0x4,%esp
+    17bd:	50                   	push   %eax
+    17be:	68 5b 50 00 00       	push   $0x505b
+    17c3:	ff 35 a8 6e 00 00    	push   0x6ea8
+    17c9:	e8 d2 32 00 00       	call   4aa0 <printf>
+      exit();
+    17ce:	e8 e0 30 00 00       	call   48b3 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+    17d3:	52                   	push   %edx
+    17d4:	68 8b 00 00 00       	push   $0x8b
+    17d9:	68 3e 50 00 00       	push   $0x503e
+    17de:	ff 35 a8 6e 00 00    	push   0x6ea8
+    17e4:	e8 b7 32 00 00       	call   4aa0 <printf>
+        exit();
+    17e9:	e8 c5 30 00 00       	call   48b3 <exit>
+    printf(stdout, "error: open big failed!\n");
+    17ee:	51                   	push   %ecx
+    17ef:	51                   	push   %ecx
+    17f0:	68 25 50 00 00       	push   $0x5025
+    17f5:	ff 35 a8 6e 00 00    	push   0x6ea8
+    17fb:	e8 a0 32 00 00       	call   4aa0 <printf>
+    exit();
+    1800:	e8 ae 30 00 00       	call   48b3 <exit>
+    printf(stdout, "error: creat big failed!\n");
+    1805:	50                   	push   %eax
+    1806:	50                   	push   %eax
+    1807:	68 ed 4f 00 00       	push   $0x4fed
+    180c:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1812:	e8 89 32 00 00       	call   4aa0 <printf>
+    exit();
+    1817:	e8 97 30 00 00       	call   48b3 <exit>
+    printf(stdout, "unlink big failed\n");
+    181c:	50                   	push   %eax
+    181d:	50                   	push   %eax
+    181e:	68 6b 50 00 00       	push   $0x506b
+    1823:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1829:	e8 72 32 00 00       	call   4aa0 <printf>
+    exit();
+    182e:	e8 80 30 00 00       	call   48b3 <exit>
+    1833:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    183a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001840 <createtest>:
+{
+    1840:	55                   	push   %ebp
+    1841:	89 e5                	mov    %esp,%ebp
+    1843:	53                   	push   %ebx
+  name[2] = '\0';
+    1844:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+    1849:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+    184c:	68 78 5e 00 00       	push   $0x5e78
+    1851:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1857:	e8 44 32 00 00       	call   4aa0 <printf>
+  name[0] = 'a';
+    185c:	c6 05 d0 95 00 00 61 	movb   $0x61,0x95d0
+  name[2] = '\0';
+    1863:	83 c4 10             	add    $0x10,%esp
+    1866:	c6 05 d2 95 00 00 00 	movb   $0x0,0x95d2
+  for(i = 0; i < 52; i++){
+    186d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+    1870:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+    1873:	88 1d d1 95 00 00    	mov    %bl,0x95d1
+  for(i = 0; i < 52; i++){
+    1879:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+    187c:	68 02 02 00 00       	push   $0x202
+    1881:	68 d0 95 00 00       	push   $0x95d0
+    1886:	e8 68 30 00 00       	call   48f3 <open>
+    close(fd);
+    188b:	89 04 24             	mov    %eax,(%esp)
+    188e:	e8 48 30 00 00       	call   48db <close>
+  for(i = 0; i < 52; i++){
+    1893:	83 c4 10             	add    $0x10,%esp
+    1896:	80 fb 64             	cmp    $0x64,%bl
+    1899:	75 d5                	jne    1870 <createtest+0x30>
+  name[0] = 'a';
+    189b:	c6 05 d0 95 00 00 61 	movb   $0x61,0x95d0
+  name[2] = '\0';
+    18a2:	bb 30 00 00 00       	mov    $0x30,%ebx
+    18a7:	c6 05 d2 95 00 00 00 	movb   $0x0,0x95d2
+  for(i = 0; i < 52; i++){
+    18ae:	66 90                	xchg   %ax,%ax
+    unlink(name);
+    18b0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+    18b3:	88 1d d1 95 00 00    	mov    %bl,0x95d1
+  for(i = 0; i < 52; i++){
+    18b9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+    18bc:	68 d0 95 00 00       	push   $0x95d0
+    18c1:	e8 3d 30 00 00       	call   4903 <unlink>
+  for(i = 0; i < 52; i++){
+    18c6:	83 c4 10             	add    $0x10,%esp
+    18c9:	80 fb 64             	cmp    $0x64,%bl
+    18cc:	75 e2                	jne    18b0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+    18ce:	83 ec 08             	sub    $0x8,%esp
+    18d1:	68 a0 5e 00 00       	push   $0x5ea0
+    18d6:	ff 35 a8 6e 00 00    	push   0x6ea8
+    18dc:	e8 bf 31 00 00       	call   4aa0 <printf>
+}
+    18e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    18e4:	83 c4 10             	add    $0x10,%esp
+    18e7:	c9                   	leave
+    18e8:	c3                   	ret
+    18e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000018f0 <dirtest>:
+{
+    18f0:	55                   	push   %ebp
+    18f1:	89 e5                	mov    %esp,%ebp
+    18f3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+    18f6:	68 8c 50 00 00       	push   $0x508c
+    18fb:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1901:	e8 9a 31 00 00       	call   4aa0 <printf>
+  if(mkdir("dir0") < 0){
+    1906:	c7 04 24 98 50 00 00 	movl   $0x5098,(%esp)
+    190d:	e8 09 30 00 00       	call   491b <mkdir>
+    1912:	83 c4 10             	add    $0x10,%esp
+    1915:	85 c0                	test   %eax,%eax
+    1917:	78 58                	js     1971 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+    1919:	83 ec 0c             	sub    $0xc,%esp
+    191c:	68 98 50 00 00       	push   $0x5098
+    1921:	e8 fd 2f 00 00       	call   4923 <chdir>
+    1926:	83 c4 10             	add    $0x10,%esp
+    1929:	85 c0                	test   %eax,%eax
+    192b:	0f 88 85 00 00 00    	js     19b6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+    1931:	83 ec 0c             	sub    $0xc,%esp
+    1934:	68 3d 56 00 00       	push   $0x563d
+    1939:	e8 e5 2f 00 00       	call   4923 <chdir>
+    193e:	83 c4 10             	add    $0x10,%esp
+    1941:	85 c0                	test   %eax,%eax
+    1943:	78 5a                	js     199f <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+    1945:	83 ec 0c             	sub    $0xc,%esp
+    1948:	68 98 50 00 00       	push   $0x5098
+    194d:	e8 b1 2f 00 00       	call   4903 <unlink>
+    1952:	83 c4 10             	add    $0x10,%esp
+    1955:	85 c0                	test   %eax,%eax
+    1957:	78 2f                	js     1988 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+    1959:	83 ec 08             	sub    $0x8,%esp
+    195c:	68 d5 50 00 00       	push   $0x50d5
+    1961:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1967:	e8 34 31 00 00       	call   4aa0 <printf>
+}
+    196c:	83 c4 10             	add    $0x10,%esp
+    196f:	c9                   	leave
+    1970:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+    1971:	50                   	push   %eax
+    1972:	50                   	push   %eax
+    1973:	68 c8 4d 00 00       	push   $0x4dc8
+    1978:	ff 35 a8 6e 00 00    	push   0x6ea8
+    197e:	e8 1d 31 00 00       	call   4aa0 <printf>
+    exit();
+    1983:	e8 2b 2f 00 00       	call   48b3 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+    1988:	50                   	push   %eax
+    1989:	50                   	push   %eax
+    198a:	68 c1 50 00 00       	push   $0x50c1
+    198f:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1995:	e8 06 31 00 00       	call   4aa0 <printf>
+    exit();
+    199a:	e8 14 2f 00 00       	call   48b3 <exit>
+    printf(stdout, "chdir .. failed\n");
+    199f:	52                   	push   %edx
+    19a0:	52                   	push   %edx
+    19a1:	68 b0 50 00 00       	push   $0x50b0
+    19a6:	ff 35 a8 6e 00 00    	push   0x6ea8
+    19ac:	e8 ef 30 00 00       	call   4aa0 <printf>
+    exit();
+    19b1:	e8 fd 2e 00 00       	call   48b3 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+    19b6:	51                   	push   %ecx
+    19b7:	51                   	push   %ecx
+    19b8:	68 9d 50 00 00       	push   $0x509d
+    19bd:	ff 35 a8 6e 00 00    	push   0x6ea8
+    19c3:	e8 d8 30 00 00       	call   4aa0 <printf>
+    exit();
+    19c8:	e8 e6 2e 00 00       	call   48b3 <exit>
+    19cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000019d0 <exectest>:
+{
+    19d0:	55                   	push   %ebp
+    19d1:	89 e5                	mov    %esp,%ebp
+    19d3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+    19d6:	68 e4 50 00 00       	push   $0x50e4
+    19db:	ff 35 a8 6e 00 00    	push   0x6ea8
+    19e1:	e8 ba 30 00 00       	call   4aa0 <printf>
+  if(exec("echo", echoargv) < 0){
+    19e6:	5a                   	pop    %edx
+    19e7:	59                   	pop    %ecx
+    19e8:	68 ac 6e 00 00       	push   $0x6eac
+    19ed:	68 ad 4e 00 00       	push   $0x4ead
+    19f2:	e8 f4 2e 00 00       	call   48eb <exec>
+    19f7:	83 c4 10             	add    $0x10,%esp
+    19fa:	85 c0                	test   %eax,%eax
+    19fc:	78 02                	js     1a00 <exectest+0x30>
+}
+    19fe:	c9                   	leave
+    19ff:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+    1a00:	50                   	push   %eax
+    1a01:	50                   	push   %eax
+    1a02:	68 ef 50 00 00       	push   $0x50ef
+    1a07:	ff 35 a8 6e 00 00    	push   0x6ea8
+    1a0d:	e8 8e 30 00 00       	call   4aa0 <printf>
+    exit();
+    1a12:	e8 9c 2e 00 00       	call   48b3 <exit>
+    1a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a1e:	66 90                	xchg   %ax,%ax
+
+00001a20 <pipe1>:
+{
+    1a20:	55                   	push   %ebp
+    1a21:	89 e5                	mov    %esp,%ebp
+    1a23:	57                   	push   %edi
+    1a24:	56                   	push   %esi
+  if(pipe(fds) != 0){
+    1a25:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+    1a28:	53                   	push   %ebx
+    1a29:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+    1a2c:	50                   	push   %eax
+    1a2d:	e8 91 2e 00 00       	call   48c3 <pipe>
+    1a32:	83 c4 10             	add    $0x10,%esp
+    1a35:	85 c0                	test   %eax,%eax
+    1a37:	0f 85 41 01 00 00    	jne    1b7e <pipe1+0x15e>
+    1a3d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+    1a3f:	e8 67 2e 00 00       	call   48ab <fork>
+  if(pid == 0){
+    1a44:	85 c0                	test   %eax,%eax
+    1a46:	0f 84 92 00 00 00    	je     1ade <pipe1+0xbe>
+  } else if(pid > 0){
+    1a4c:	0f 8e 3f 01 00 00    	jle    1b91 <pipe1+0x171>
+    close(fds[1]);
+    1a52:	83 ec 0c             	sub    $0xc,%esp
+    1a55:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+    1a58:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+    1a5a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+    1a5f:	e8 77 2e 00 00       	call   48db <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+    1a64:	83 c4 10             	add    $0x10,%esp
+    1a67:	83 ec 04             	sub    $0x4,%esp
+    1a6a:	57                   	push   %edi
+    1a6b:	68 e0 95 00 00       	push   $0x95e0
+    1a70:	ff 75 e0             	push   -0x20(%ebp)
+    1a73:	e8 53 2e 00 00       	call   48cb <read>
+    1a78:	83 c4 10             	add    $0x10,%esp
+    1a7b:	89 c1                	mov    %eax,%ecx
+    1a7d:	85 c0                	test   %eax,%eax
+    1a7f:	0f 8e b8 00 00 00    	jle    1b3d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+    1a85:	89 f0                	mov    %esi,%eax
+    1a87:	32 05 e0 95 00 00    	xor    0x95e0,%al
+    1a8d:	0f b6 c0             	movzbl %al,%eax
+    1a90:	85 c0                	test   %eax,%eax
+    1a92:	75 30                	jne    1ac4 <pipe1+0xa4>
+    1a94:	83 c6 01             	add    $0x1,%esi
+    1a97:	eb 0f                	jmp    1aa8 <pipe1+0x88>
+    1a99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1aa0:	38 90 e0 95 00 00    	cmp    %dl,0x95e0(%eax)
+    1aa6:	75 1c                	jne    1ac4 <pipe1+0xa4>
+    1aa8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+    1aab:	83 c0 01             	add    $0x1,%eax
+    1aae:	39 c1                	cmp    %eax,%ecx
+    1ab0:	75 ee                	jne    1aa0 <pipe1+0x80>
+      cc = cc * 2;
+    1ab2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+    1ab4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+    1ab9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+    1abb:	89 d6                	mov    %edx,%esi
+    1abd:	39 c7                	cmp    %eax,%edi
+    1abf:	0f 4f f8             	cmovg  %eax,%edi
+    1ac2:	eb a3                	jmp    1a67 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+    1ac4:	83 ec 08             	sub    $0x8,%esp
+    1ac7:	68 1e 51 00 00       	push   $0x511e
+    1acc:	6a 01                	push   $0x1
+    1ace:	e8 cd 2f 00 00       	call   4aa0 <printf>
+    1ad3:	83 c4 10             	add    $0x10,%esp
+}
+    1ad6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ad9:	5b                   	pop    %ebx
+    1ada:	5e                   	pop    %esi
+    1adb:	5f                   	pop    %edi
+    1adc:	5d                   	pop    %ebp
+    1add:	c3                   	ret
+    close(fds[0]);
+    1ade:	83 ec 0c             	sub    $0xc,%esp
+    1ae1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+    1ae4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+    1ae6:	e8 f0 2d 00 00       	call   48db <close>
+    1aeb:	83 c4 10             	add    $0x10,%esp
+    1aee:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+    1af0:	31 c0                	xor    %eax,%eax
+    1af2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+    1af8:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+    1afb:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+    1afe:	88 90 df 95 00 00    	mov    %dl,0x95df(%eax)
+      for(i = 0; i < 1033; i++)
+    1b04:	3d 09 04 00 00       	cmp    $0x409,%eax
+    1b09:	75 ed                	jne    1af8 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+    1b0b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+    1b0e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+    1b14:	68 09 04 00 00       	push   $0x409
+    1b19:	68 e0 95 00 00       	push   $0x95e0
+    1b1e:	ff 75 e4             	push   -0x1c(%ebp)
+    1b21:	e8 ad 2d 00 00       	call   48d3 <write>
+    1b26:	83 c4 10             	add    $0x10,%esp
+    1b29:	3d 09 04 00 00       	cmp    $0x409,%eax
+    1b2e:	75 74                	jne    1ba4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+    1b30:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+    1b36:	75 b8                	jne    1af0 <pipe1+0xd0>
+    exit();
+    1b38:	e8 76 2d 00 00       	call   48b3 <exit>
+    if(total != 5 * 1033){
+    1b3d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+    1b43:	75 26                	jne    1b6b <pipe1+0x14b>
+    close(fds[0]);
+    1b45:	83 ec 0c             	sub    $0xc,%esp
+    1b48:	ff 75 e0             	push   -0x20(%ebp)
+    1b4b:	e8 8b 2d 00 00       	call   48db <close>
+    wait();
+    1b50:	e8 66 2d 00 00       	call   48bb <wait>
+  printf(1, "pipe1 ok\n");
+    1b55:	5a                   	pop    %edx
+    1b56:	59                   	pop    %ecx
+    1b57:	68 43 51 00 00       	push   $0x5143
+    1b5c:	6a 01                	push   $0x1
+    1b5e:	e8 3d 2f 00 00       	call   4aa0 <printf>
+    1b63:	83 c4 10             	add    $0x10,%esp
+    1b66:	e9 6b ff ff ff       	jmp    1ad6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+    1b6b:	56                   	push   %esi
+    1b6c:	53                   	push   %ebx
+    1b6d:	68 2c 51 00 00       	push   $0x512c
+    1b72:	6a 01                	push   $0x1
+    1b74:	e8 27 2f 00 00       	call   4aa0 <printf>
+      exit();
+    1b79:	e8 35 2d 00 00       	call   48b3 <exit>
+    printf(1, "pipe() failed\n");
+    1b7e:	50                   	push   %eax
+    1b7f:	50                   	push   %eax
+    1b80:	68 01 51 00 00       	push   $0x5101
+    1b85:	6a 01                	push   $0x1
+    1b87:	e8 14 2f 00 00       	call   4aa0 <printf>
+    exit();
+    1b8c:	e8 22 2d 00 00       	call   48b3 <exit>
+    printf(1, "fork() failed\n");
+    1b91:	50                   	push   %eax
+    1b92:	50                   	push   %eax
+    1b93:	68 4d 51 00 00       	push   $0x514d
+    1b98:	6a 01                	push   $0x1
+    1b9a:	e8 01 2f 00 00       	call   4aa0 <printf>
+    exit();
+    1b9f:	e8 0f 2d 00 00       	call   48b3 <exit>
+        printf(1, "pipe1 oops 1\n");
+    1ba4:	57                   	push   %edi
+    1ba5:	57                   	push   %edi
+    1ba6:	68 10 51 00 00       	push   $0x5110
+    1bab:	6a 01                	push   $0x1
+    1bad:	e8 ee 2e 00 00       	call   4aa0 <printf>
+        exit();
+    1bb2:	e8 fc 2c 00 00       	call   48b3 <exit>
+    1bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bbe:	66 90                	xchg   %ax,%ax
+
+00001bc0 <preempt>:
+{
+    1bc0:	55                   	push   %ebp
+    1bc1:	89 e5                	mov    %esp,%ebp
+    1bc3:	57                   	push   %edi
+    1bc4:	56                   	push   %esi
+    1bc5:	53                   	push   %ebx
+    1bc6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+    1bc9:	68 5c 51 00 00       	push   $0x515c
+    1bce:	6a 01                	push   $0x1
+    1bd0:	e8 cb 2e 00 00       	call   4aa0 <printf>
+  pid1 = fork();
+    1bd5:	e8 d1 2c 00 00       	call   48ab <fork>
+  if(pid1 == 0)
+    1bda:	83 c4 10             	add    $0x10,%esp
+    1bdd:	85 c0                	test   %eax,%eax
+    1bdf:	75 07                	jne    1be8 <preempt+0x28>
+    for(;;)
+    1be1:	eb fe                	jmp    1be1 <preempt+0x21>
+    1be3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1be7:	90                   	nop
+    1be8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+    1bea:	e8 bc 2c 00 00       	call   48ab <fork>
+    1bef:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+    1bf1:	85 c0                	test   %eax,%eax
+    1bf3:	75 0b                	jne    1c00 <preempt+0x40>
+    for(;;)
+    1bf5:	eb fe                	jmp    1bf5 <preempt+0x35>
+    1bf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bfe:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+    1c00:	83 ec 0c             	sub    $0xc,%esp
+    1c03:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1c06:	50                   	push   %eax
+    1c07:	e8 b7 2c 00 00       	call   48c3 <pipe>
+  pid3 = fork();
+    1c0c:	e8 9a 2c 00 00       	call   48ab <fork>
+  if(pid3 == 0){
+    1c11:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+    1c14:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+    1c16:	85 c0                	test   %eax,%eax
+    1c18:	75 3e                	jne    1c58 <preempt+0x98>
+    close(pfds[0]);
+    1c1a:	83 ec 0c             	sub    $0xc,%esp
+    1c1d:	ff 75 e0             	push   -0x20(%ebp)
+    1c20:	e8 b6 2c 00 00       	call   48db <close>
+    if(write(pfds[1], "x", 1) != 1)
+    1c25:	83 c4 0c             	add    $0xc,%esp
+    1c28:	6a 01                	push   $0x1
+    1c2a:	68 21 57 00 00       	push   $0x5721
+    1c2f:	ff 75 e4             	push   -0x1c(%ebp)
+    1c32:	e8 9c 2c 00 00       	call   48d3 <write>
+    1c37:	83 c4 10             	add    $0x10,%esp
+    1c3a:	83 f8 01             	cmp    $0x1,%eax
+    1c3d:	0f 85 b8 00 00 00    	jne    1cfb <preempt+0x13b>
+    close(pfds[1]);
+    1c43:	83 ec 0c             	sub    $0xc,%esp
+    1c46:	ff 75 e4             	push   -0x1c(%ebp)
+    1c49:	e8 8d 2c 00 00       	call   48db <close>
+    1c4e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    1c51:	eb fe                	jmp    1c51 <preempt+0x91>
+    1c53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c57:	90                   	nop
+  close(pfds[1]);
+    1c58:	83 ec 0c             	sub    $0xc,%esp
+    1c5b:	ff 75 e4             	push   -0x1c(%ebp)
+    1c5e:	e8 78 2c 00 00       	call   48db <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    1c63:	83 c4 0c             	add    $0xc,%esp
+    1c66:	68 00 20 00 00       	push   $0x2000
+    1c6b:	68 e0 95 00 00       	push   $0x95e0
+    1c70:	ff 75 e0             	push   -0x20(%ebp)
+    1c73:	e8 53 2c 00 00       	call   48cb <read>
+    1c78:	83 c4 10             	add    $0x10,%esp
+    1c7b:	83 f8 01             	cmp    $0x1,%eax
+    1c7e:	75 67                	jne    1ce7 <preempt+0x127>
+  close(pfds[0]);
+    1c80:	83 ec 0c             	sub    $0xc,%esp
+    1c83:	ff 75 e0             	push   -0x20(%ebp)
+    1c86:	e8 50 2c 00 00       	call   48db <close>
+  printf(1, "kill... ");
+    1c8b:	58                   	pop    %eax
+    1c8c:	5a                   	pop    %edx
+    1c8d:	68 8d 51 00 00       	push   $0x518d
+    1c92:	6a 01                	push   $0x1
+    1c94:	e8 07 2e 00 00       	call   4aa0 <printf>
+  kill(pid1);
+    1c99:	89 1c 24             	mov    %ebx,(%esp)
+    1c9c:	e8 42 2c 00 00       	call   48e3 <kill>
+  kill(pid2);
+    1ca1:	89 34 24             	mov    %esi,(%esp)
+    1ca4:	e8 3a 2c 00 00       	call   48e3 <kill>
+  kill(pid3);
+    1ca9:	89 3c 24             	mov    %edi,(%esp)
+    1cac:	e8 32 2c 00 00       	call   48e3 <kill>
+  printf(1, "wait... ");
+    1cb1:	59                   	pop    %ecx
+    1cb2:	5b                   	pop    %ebx
+    1cb3:	68 96 51 00 00       	push   $0x5196
+    1cb8:	6a 01                	push   $0x1
+    1cba:	e8 e1 2d 00 00       	call   4aa0 <printf>
+  wait();
+    1cbf:	e8 f7 2b 00 00       	call   48bb <wait>
+  wait();
+    1cc4:	e8 f2 2b 00 00       	call   48bb <wait>
+  wait();
+    1cc9:	e8 ed 2b 00 00       	call   48bb <wait>
+  printf(1, "preempt ok\n");
+    1cce:	5e                   	pop    %esi
+    1ccf:	5f                   	pop    %edi
+    1cd0:	68 9f 51 00 00       	push   $0x519f
+    1cd5:	6a 01                	push   $0x1
+    1cd7:	e8 c4 2d 00 00       	call   4aa0 <printf>
+    1cdc:	83 c4 10             	add    $0x10,%esp
+}
+    1cdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ce2:	5b                   	pop    %ebx
+    1ce3:	5e                   	pop    %esi
+    1ce4:	5f                   	pop    %edi
+    1ce5:	5d                   	pop    %ebp
+    1ce6:	c3                   	ret
+    printf(1, "preempt read error");
+    1ce7:	83 ec 08             	sub    $0x8,%esp
+    1cea:	68 7a 51 00 00       	push   $0x517a
+    1cef:	6a 01                	push   $0x1
+    1cf1:	e8 aa 2d 00 00       	call   4aa0 <printf>
+    1cf6:	83 c4 10             	add    $0x10,%esp
+    1cf9:	eb e4                	jmp    1cdf <preempt+0x11f>
+      printf(1, "preempt write error");
+    1cfb:	83 ec 08             	sub    $0x8,%esp
+    1cfe:	68 66 51 00 00       	push   $0x5166
+    1d03:	6a 01                	push   $0x1
+    1d05:	e8 96 2d 00 00       	call   4aa0 <printf>
+    1d0a:	83 c4 10             	add    $0x10,%esp
+    1d0d:	e9 31 ff ff ff       	jmp    1c43 <preempt+0x83>
+    1d12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001d20 <exitwait>:
+{
+    1d20:	55                   	push   %ebp
+    1d21:	89 e5                	mov    %esp,%ebp
+    1d23:	56                   	push   %esi
+    1d24:	be 64 00 00 00       	mov    $0x64,%esi
+    1d29:	53                   	push   %ebx
+    1d2a:	eb 14                	jmp    1d40 <exitwait+0x20>
+    1d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+    1d30:	74 68                	je     1d9a <exitwait+0x7a>
+      if(wait() != pid){
+    1d32:	e8 84 2b 00 00       	call   48bb <wait>
+    1d37:	39 d8                	cmp    %ebx,%eax
+    1d39:	75 2d                	jne    1d68 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+    1d3b:	83 ee 01             	sub    $0x1,%esi
+    1d3e:	74 41                	je     1d81 <exitwait+0x61>
+    pid = fork();
+    1d40:	e8 66 2b 00 00       	call   48ab <fork>
+    1d45:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1d47:	85 c0                	test   %eax,%eax
+    1d49:	79 e5                	jns    1d30 <exitwait+0x10>
+      printf(1, "fork failed\n");
+    1d4b:	83 ec 08             	sub    $0x8,%esp
+    1d4e:	68 09 5d 00 00       	push   $0x5d09
+    1d53:	6a 01                	push   $0x1
+    1d55:	e8 46 2d 00 00       	call   4aa0 <printf>
+      return;
+    1d5a:	83 c4 10             	add    $0x10,%esp
+}
+    1d5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1d60:	5b                   	pop    %ebx
+    1d61:	5e                   	pop    %esi
+    1d62:	5d                   	pop    %ebp
+    1d63:	c3                   	ret
+    1d64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+    1d68:	83 ec 08             	sub    $0x8,%esp
+    1d6b:	68 ab 51 00 00       	push   $0x51ab
+    1d70:	6a 01                	push   $0x1
+    1d72:	e8 29 2d 00 00       	call   4aa0 <printf>
+        return;
+    1d77:	83 c4 10             	add    $0x10,%esp
+}
+    1d7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1d7d:	5b                   	pop    %ebx
+    1d7e:	5e                   	pop    %esi
+    1d7f:	5d                   	pop    %ebp
+    1d80:	c3                   	ret
+  printf(1, "exitwait ok\n");
+    1d81:	83 ec 08             	sub    $0x8,%esp
+    1d84:	68 bb 51 00 00       	push   $0x51bb
+    1d89:	6a 01                	push   $0x1
+    1d8b:	e8 10 2d 00 00       	call   4aa0 <printf>
+    1d90:	83 c4 10             	add    $0x10,%esp
+}
+    1d93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1d96:	5b                   	pop    %ebx
+    1d97:	5e                   	pop    %esi
+    1d98:	5d                   	pop    %ebp
+    1d99:	c3                   	ret
+      exit();
+    1d9a:	e8 14 2b 00 00       	call   48b3 <exit>
+    1d9f:	90                   	nop
+
+00001da0 <mem>:
+{
+    1da0:	55                   	push   %ebp
+    1da1:	89 e5                	mov    %esp,%ebp
+    1da3:	56                   	push   %esi
+    1da4:	31 f6                	xor    %esi,%esi
+    1da6:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    1da7:	83 ec 08             	sub    $0x8,%esp
+    1daa:	68 c8 51 00 00       	push   $0x51c8
+    1daf:	6a 01                	push   $0x1
+    1db1:	e8 ea 2c 00 00       	call   4aa0 <printf>
+  ppid = getpid();
+    1db6:	e8 78 2b 00 00       	call   4933 <getpid>
+    1dbb:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    1dbd:	e8 e9 2a 00 00       	call   48ab <fork>
+    1dc2:	83 c4 10             	add    $0x10,%esp
+    1dc5:	85 c0                	test   %eax,%eax
+    1dc7:	74 0b                	je     1dd4 <mem+0x34>
+    1dc9:	e9 8a 00 00 00       	jmp    1e58 <mem+0xb8>
+    1dce:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    1dd0:	89 30                	mov    %esi,(%eax)
+    1dd2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    1dd4:	83 ec 0c             	sub    $0xc,%esp
+    1dd7:	68 11 27 00 00       	push   $0x2711
+    1ddc:	e8 ff 2e 00 00       	call   4ce0 <malloc>
+    1de1:	83 c4 10             	add    $0x10,%esp
+    1de4:	85 c0                	test   %eax,%eax
+    1de6:	75 e8                	jne    1dd0 <mem+0x30>
+    while(m1){
+    1de8:	85 f6                	test   %esi,%esi
+    1dea:	74 18                	je     1e04 <mem+0x64>
+    1dec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    1df0:	89 f0                	mov    %esi,%eax
+      free(m1);
+    1df2:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    1df5:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    1df7:	50                   	push   %eax
+    1df8:	e8 53 2e 00 00       	call   4c50 <free>
+    while(m1){
+    1dfd:	83 c4 10             	add    $0x10,%esp
+    1e00:	85 f6                	test   %esi,%esi
+    1e02:	75 ec                	jne    1df0 <mem+0x50>
+    m1 = malloc(1024*20);
+    1e04:	83 ec 0c             	sub    $0xc,%esp
+    1e07:	68 00 50 00 00       	push   $0x5000
+    1e0c:	e8 cf 2e 00 00       	call   4ce0 <malloc>
+    if(m1 == 0){
+    1e11:	83 c4 10             	add    $0x10,%esp
+    1e14:	85 c0                	test   %eax,%eax
+    1e16:	74 20                	je     1e38 <mem+0x98>
+    free(m1);
+    1e18:	83 ec 0c             	sub    $0xc,%esp
+    1e1b:	50                   	push   %eax
+    1e1c:	e8 2f 2e 00 00       	call   4c50 <free>
+    printf(1, "mem ok\n");
+    1e21:	58                   	pop    %eax
+    1e22:	5a                   	pop    %edx
+    1e23:	68 ec 51 00 00       	push   $0x51ec
+    1e28:	6a 01                	push   $0x1
+    1e2a:	e8 71 2c 00 00       	call   4aa0 <printf>
+    exit();
+    1e2f:	e8 7f 2a 00 00       	call   48b3 <exit>
+    1e34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    1e38:	83 ec 08             	sub    $0x8,%esp
+    1e3b:	68 d2 51 00 00       	push   $0x51d2
+    1e40:	6a 01                	push   $0x1
+    1e42:	e8 59 2c 00 00       	call   4aa0 <printf>
+      kill(ppid);
+    1e47:	89 1c 24             	mov    %ebx,(%esp)
+    1e4a:	e8 94 2a 00 00       	call   48e3 <kill>
+      exit();
+    1e4f:	e8 5f 2a 00 00       	call   48b3 <exit>
+    1e54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1e58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1e5b:	5b                   	pop    %ebx
+    1e5c:	5e                   	pop    %esi
+    1e5d:	5d                   	pop    %ebp
+    wait();
+    1e5e:	e9 58 2a 00 00       	jmp    48bb <wait>
+    1e63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001e70 <sharedfd>:
+{
+    1e70:	55                   	push   %ebp
+    1e71:	89 e5                	mov    %esp,%ebp
+    1e73:	57                   	push   %edi
+    1e74:	56                   	push   %esi
+    1e75:	53                   	push   %ebx
+    1e76:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    1e79:	68 f4 51 00 00       	push   $0x51f4
+    1e7e:	6a 01                	push   $0x1
+    1e80:	e8 1b 2c 00 00       	call   4aa0 <printf>
+  unlink("sharedfd");
+    1e85:	c7 04 24 03 52 00 00 	movl   $0x5203,(%esp)
+    1e8c:	e8 72 2a 00 00       	call   4903 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    1e91:	5b                   	pop    %ebx
+    1e92:	5e                   	pop    %esi
+    1e93:	68 02 02 00 00       	push   $0x202
+    1e98:	68 03 52 00 00       	push   $0x5203
+    1e9d:	e8 51 2a 00 00       	call   48f3 <open>
+  if(fd < 0){
+    1ea2:	83 c4 10             	add    $0x10,%esp
+    1ea5:	85 c0                	test   %eax,%eax
+    1ea7:	0f 88 2a 01 00 00    	js     1fd7 <sharedfd+0x167>
+    1ead:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1eaf:	8d 75 de             	lea    -0x22(%ebp),%esi
+    1eb2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    1eb7:	e8 ef 29 00 00       	call   48ab <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1ebc:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    1ebf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1ec2:	19 c0                	sbb    %eax,%eax
+    1ec4:	83 ec 04             	sub    $0x4,%esp
+    1ec7:	83 e0 f3             	and    $0xfffffff3,%eax
+    1eca:	6a 0a                	push   $0xa
+    1ecc:	83 c0 70             	add    $0x70,%eax
+    1ecf:	50                   	push   %eax
+    1ed0:	56                   	push   %esi
+    1ed1:	e8 5a 28 00 00       	call   4730 <memset>
+    1ed6:	83 c4 10             	add    $0x10,%esp
+    1ed9:	eb 0a                	jmp    1ee5 <sharedfd+0x75>
+    1edb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1edf:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    1ee0:	83 eb 01             	sub    $0x1,%ebx
+    1ee3:	74 26                	je     1f0b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1ee5:	83 ec 04             	sub    $0x4,%esp
+    1ee8:	6a 0a                	push   $0xa
+    1eea:	56                   	push   %esi
+    1eeb:	57                   	push   %edi
+    1eec:	e8 e2 29 00 00       	call   48d3 <write>
+    1ef1:	83 c4 10             	add    $0x10,%esp
+    1ef4:	83 f8 0a             	cmp    $0xa,%eax
+    1ef7:	74 e7                	je     1ee0 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    1ef9:	83 ec 08             	sub    $0x8,%esp
+    1efc:	68 f4 5e 00 00       	push   $0x5ef4
+    1f01:	6a 01                	push   $0x1
+    1f03:	e8 98 2b 00 00       	call   4aa0 <printf>
+      break;
+    1f08:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    1f0b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1f0e:	85 c9                	test   %ecx,%ecx
+    1f10:	0f 84 f5 00 00 00    	je     200b <sharedfd+0x19b>
+    wait();
+    1f16:	e8 a0 29 00 00       	call   48bb <wait>
+  close(fd);
+    1f1b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    1f1e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    1f20:	57                   	push   %edi
+    1f21:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    1f24:	e8 b2 29 00 00       	call   48db <close>
+  fd = open("sharedfd", 0);
+    1f29:	58                   	pop    %eax
+    1f2a:	5a                   	pop    %edx
+    1f2b:	6a 00                	push   $0x0
+    1f2d:	68 03 52 00 00       	push   $0x5203
+    1f32:	e8 bc 29 00 00       	call   48f3 <open>
+  if(fd < 0){
+    1f37:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    1f3a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    1f3c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    1f3f:	85 c0                	test   %eax,%eax
+    1f41:	0f 88 aa 00 00 00    	js     1ff1 <sharedfd+0x181>
+    1f47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f4e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    1f50:	83 ec 04             	sub    $0x4,%esp
+    1f53:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1f56:	6a 0a                	push   $0xa
+    1f58:	56                   	push   %esi
+    1f59:	ff 75 d0             	push   -0x30(%ebp)
+    1f5c:	e8 6a 29 00 00       	call   48cb <read>
+    1f61:	83 c4 10             	add    $0x10,%esp
+    1f64:	85 c0                	test   %eax,%eax
+    1f66:	7e 28                	jle    1f90 <sharedfd+0x120>
+    1f68:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1f6b:	89 f0                	mov    %esi,%eax
+    1f6d:	eb 13                	jmp    1f82 <sharedfd+0x112>
+    1f6f:	90                   	nop
+        np++;
+    1f70:	80 f9 70             	cmp    $0x70,%cl
+    1f73:	0f 94 c1             	sete   %cl
+    1f76:	0f b6 c9             	movzbl %cl,%ecx
+    1f79:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    1f7b:	83 c0 01             	add    $0x1,%eax
+    1f7e:	39 f8                	cmp    %edi,%eax
+    1f80:	74 ce                	je     1f50 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1f82:	0f b6 08             	movzbl (%eax),%ecx
+    1f85:	80 f9 63             	cmp    $0x63,%cl
+    1f88:	75 e6                	jne    1f70 <sharedfd+0x100>
+        nc++;
+    1f8a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    1f8d:	eb ec                	jmp    1f7b <sharedfd+0x10b>
+    1f8f:	90                   	nop
+  close(fd);
+    1f90:	83 ec 0c             	sub    $0xc,%esp
+    1f93:	ff 75 d0             	push   -0x30(%ebp)
+    1f96:	e8 40 29 00 00       	call   48db <close>
+  unlink("sharedfd");
+    1f9b:	c7 04 24 03 52 00 00 	movl   $0x5203,(%esp)
+    1fa2:	e8 5c 29 00 00       	call   4903 <unlink>
+  if(nc == 10000 && np == 10000){
+    1fa7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1faa:	83 c4 10             	add    $0x10,%esp
+    1fad:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    1fb3:	75 5b                	jne    2010 <sharedfd+0x1a0>
+    1fb5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    1fbb:	75 53                	jne    2010 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    1fbd:	83 ec 08             	sub    $0x8,%esp
+    1fc0:	68 0c 52 00 00       	push   $0x520c
+    1fc5:	6a 01                	push   $0x1
+    1fc7:	e8 d4 2a 00 00       	call   4aa0 <printf>
+    1fcc:	83 c4 10             	add    $0x10,%esp
+}
+    1fcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1fd2:	5b                   	pop    %ebx
+    1fd3:	5e                   	pop    %esi
+    1fd4:	5f                   	pop    %edi
+    1fd5:	5d                   	pop    %ebp
+    1fd6:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1fd7:	83 ec 08             	sub    $0x8,%esp
+    1fda:	68 c8 5e 00 00       	push   $0x5ec8
+    1fdf:	6a 01                	push   $0x1
+    1fe1:	e8 ba 2a 00 00       	call   4aa0 <printf>
+    return;
+    1fe6:	83 c4 10             	add    $0x10,%esp
+}
+    1fe9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1fec:	5b                   	pop    %ebx
+    1fed:	5e                   	pop    %esi
+    1fee:	5f                   	pop    %edi
+    1fef:	5d                   	pop    %ebp
+    1ff0:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1ff1:	83 ec 08             	sub    $0x8,%esp
+    1ff4:	68 14 5f 00 00       	push   $0x5f14
+    1ff9:	6a 01                	push   $0x1
+    1ffb:	e8 a0 2a 00 00       	call   4aa0 <printf>
+    return;
+    2000:	83 c4 10             	add    $0x10,%esp
+}
+    2003:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2006:	5b                   	pop    %ebx
+    2007:	5e                   	pop    %esi
+    2008:	5f                   	pop    %edi
+    2009:	5d                   	pop    %ebp
+    200a:	c3                   	ret
+    exit();
+    200b:	e8 a3 28 00 00       	call   48b3 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    2010:	53                   	push   %ebx
+    2011:	52                   	push   %edx
+    2012:	68 19 52 00 00       	push   $0x5219
+    2017:	6a 01                	push   $0x1
+    2019:	e8 82 2a 00 00       	call   4aa0 <printf>
+    exit();
+    201e:	e8 90 28 00 00       	call   48b3 <exit>
+    2023:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    202a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002030 <fourfiles>:
+{
+    2030:	55                   	push   %ebp
+    2031:	89 e5                	mov    %esp,%ebp
+    2033:	57                   	push   %edi
+    2034:	56                   	push   %esi
+    2035:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    2036:	31 db                	xor    %ebx,%ebx
+{
+    2038:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    203b:	c7 45 d8 2e 52 00 00 	movl   $0x522e,-0x28(%ebp)
+    2042:	c7 45 dc 77 53 00 00 	movl   $0x5377,-0x24(%ebp)
+    2049:	c7 45 e0 7b 53 00 00 	movl   $0x537b,-0x20(%ebp)
+    2050:	c7 45 e4 31 52 00 00 	movl   $0x5231,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    2057:	68 34 52 00 00       	push   $0x5234
+    205c:	6a 01                	push   $0x1
+    205e:	e8 3d 2a 00 00       	call   4aa0 <printf>
+    2063:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    2066:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    206a:	83 ec 0c             	sub    $0xc,%esp
+    206d:	56                   	push   %esi
+    206e:	e8 90 28 00 00       	call   4903 <unlink>
+    pid = fork();
+    2073:	e8 33 28 00 00       	call   48ab <fork>
+    if(pid < 0){
+    2078:	83 c4 10             	add    $0x10,%esp
+    207b:	85 c0                	test   %eax,%eax
+    207d:	0f 88 65 01 00 00    	js     21e8 <fourfiles+0x1b8>
+    if(pid == 0){
+    2083:	0f 84 eb 00 00 00    	je     2174 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    2089:	83 c3 01             	add    $0x1,%ebx
+    208c:	83 fb 04             	cmp    $0x4,%ebx
+    208f:	75 d5                	jne    2066 <fourfiles+0x36>
+    wait();
+    2091:	e8 25 28 00 00       	call   48bb <wait>
+  for(i = 0; i < 2; i++){
+    2096:	31 f6                	xor    %esi,%esi
+    wait();
+    2098:	e8 1e 28 00 00       	call   48bb <wait>
+    209d:	e8 19 28 00 00       	call   48bb <wait>
+    20a2:	e8 14 28 00 00       	call   48bb <wait>
+    fname = names[i];
+    20a7:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    20ab:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    20ae:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    20b0:	6a 00                	push   $0x0
+    20b2:	53                   	push   %ebx
+    20b3:	e8 3b 28 00 00       	call   48f3 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    20b8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    20bb:	83 c4 10             	add    $0x10,%esp
+    20be:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    20c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20c8:	83 ec 04             	sub    $0x4,%esp
+    20cb:	68 00 20 00 00       	push   $0x2000
+    20d0:	68 e0 95 00 00       	push   $0x95e0
+    20d5:	ff 75 d4             	push   -0x2c(%ebp)
+    20d8:	e8 ee 27 00 00       	call   48cb <read>
+    20dd:	83 c4 10             	add    $0x10,%esp
+    20e0:	89 c3                	mov    %eax,%ebx
+    20e2:	85 c0                	test   %eax,%eax
+    20e4:	7e 28                	jle    210e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    20e6:	31 c0                	xor    %eax,%eax
+    20e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20ef:	90                   	nop
+        if(buf[j] != '0'+i){
+    20f0:	83 fe 01             	cmp    $0x1,%esi
+    20f3:	0f be 88 e0 95 00 00 	movsbl 0x95e0(%eax),%ecx
+    20fa:	19 d2                	sbb    %edx,%edx
+    20fc:	83 c2 31             	add    $0x31,%edx
+    20ff:	39 d1                	cmp    %edx,%ecx
+    2101:	75 5d                	jne    2160 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    2103:	83 c0 01             	add    $0x1,%eax
+    2106:	39 c3                	cmp    %eax,%ebx
+    2108:	75 e6                	jne    20f0 <fourfiles+0xc0>
+      total += n;
+    210a:	01 df                	add    %ebx,%edi
+    210c:	eb ba                	jmp    20c8 <fourfiles+0x98>
+    close(fd);
+    210e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    2111:	83 ec 0c             	sub    $0xc,%esp
+    2114:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    2117:	51                   	push   %ecx
+    2118:	e8 be 27 00 00       	call   48db <close>
+    if(total != 12*500){
+    211d:	83 c4 10             	add    $0x10,%esp
+    2120:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    2126:	0f 85 d0 00 00 00    	jne    21fc <fourfiles+0x1cc>
+    unlink(fname);
+    212c:	83 ec 0c             	sub    $0xc,%esp
+    212f:	53                   	push   %ebx
+    2130:	e8 ce 27 00 00       	call   4903 <unlink>
+  for(i = 0; i < 2; i++){
+    2135:	83 c4 10             	add    $0x10,%esp
+    2138:	85 f6                	test   %esi,%esi
+    213a:	75 0a                	jne    2146 <fourfiles+0x116>
+    213c:	be 01 00 00 00       	mov    $0x1,%esi
+    2141:	e9 61 ff ff ff       	jmp    20a7 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    2146:	83 ec 08             	sub    $0x8,%esp
+    2149:	68 72 52 00 00       	push   $0x5272
+    214e:	6a 01                	push   $0x1
+    2150:	e8 4b 29 00 00       	call   4aa0 <printf>
+}
+    2155:	83 c4 10             	add    $0x10,%esp
+    2158:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    215b:	5b                   	pop    %ebx
+    215c:	5e                   	pop    %esi
+    215d:	5f                   	pop    %edi
+    215e:	5d                   	pop    %ebp
+    215f:	c3                   	ret
+          printf(1, "wrong char\n");
+    2160:	83 ec 08             	sub    $0x8,%esp
+    2163:	68 55 52 00 00       	push   $0x5255
+    2168:	6a 01                	push   $0x1
+    216a:	e8 31 29 00 00       	call   4aa0 <printf>
+          exit();
+    216f:	e8 3f 27 00 00       	call   48b3 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    2174:	83 ec 08             	sub    $0x8,%esp
+    2177:	68 02 02 00 00       	push   $0x202
+    217c:	56                   	push   %esi
+    217d:	e8 71 27 00 00       	call   48f3 <open>
+      if(fd < 0){
+    2182:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    2185:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    2187:	85 c0                	test   %eax,%eax
+    2189:	78 45                	js     21d0 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    218b:	83 ec 04             	sub    $0x4,%esp
+    218e:	83 c3 30             	add    $0x30,%ebx
+    2191:	68 00 02 00 00       	push   $0x200
+    2196:	53                   	push   %ebx
+    2197:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    219c:	68 e0 95 00 00       	push   $0x95e0
+    21a1:	e8 8a 25 00 00       	call   4730 <memset>
+    21a6:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    21a9:	83 ec 04             	sub    $0x4,%esp
+    21ac:	68 f4 01 00 00       	push   $0x1f4
+    21b1:	68 e0 95 00 00       	push   $0x95e0
+    21b6:	56                   	push   %esi
+    21b7:	e8 17 27 00 00       	call   48d3 <write>
+    21bc:	83 c4 10             	add    $0x10,%esp
+    21bf:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    21c4:	75 49                	jne    220f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    21c6:	83 eb 01             	sub    $0x1,%ebx
+    21c9:	75 de                	jne    21a9 <fourfiles+0x179>
+      exit();
+    21cb:	e8 e3 26 00 00       	call   48b3 <exit>
+        printf(1, "create failed\n");
+    21d0:	51                   	push   %ecx
+    21d1:	51                   	push   %ecx
+    21d2:	68 cf 54 00 00       	push   $0x54cf
+    21d7:	6a 01                	push   $0x1
+    21d9:	e8 c2 28 00 00       	call   4aa0 <printf>
+        exit();
+    21de:	e8 d0 26 00 00       	call   48b3 <exit>
+    21e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    21e7:	90                   	nop
+      printf(1, "fork failed\n");
+    21e8:	83 ec 08             	sub    $0x8,%esp
+    21eb:	68 09 5d 00 00       	push   $0x5d09
+    21f0:	6a 01                	push   $0x1
+    21f2:	e8 a9 28 00 00       	call   4aa0 <printf>
+      exit();
+    21f7:	e8 b7 26 00 00       	call   48b3 <exit>
+      printf(1, "wrong length %d\n", total);
+    21fc:	50                   	push   %eax
+    21fd:	57                   	push   %edi
+    21fe:	68 61 52 00 00       	push   $0x5261
+    2203:	6a 01                	push   $0x1
+    2205:	e8 96 28 00 00       	call   4aa0 <printf>
+      exit();
+    220a:	e8 a4 26 00 00       	call   48b3 <exit>
+          printf(1, "write failed %d\n", n);
+    220f:	52                   	push   %edx
+    2210:	50                   	push   %eax
+    2211:	68 44 52 00 00       	push   $0x5244
+    2216:	6a 01                	push   $0x1
+    2218:	e8 83 28 00 00       	call   4aa0 <printf>
+          exit();
+    221d:	e8 91 26 00 00       	call   48b3 <exit>
+    2222:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002230 <createdelete>:
+{
+    2230:	55                   	push   %ebp
+    2231:	89 e5                	mov    %esp,%ebp
+    2233:	57                   	push   %edi
+    2234:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    2235:	31 f6                	xor    %esi,%esi
+{
+    2237:	53                   	push   %ebx
+    2238:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    223b:	68 80 52 00 00       	push   $0x5280
+    2240:	6a 01                	push   $0x1
+    2242:	e8 59 28 00 00       	call   4aa0 <printf>
+    2247:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    224a:	e8 5c 26 00 00       	call   48ab <fork>
+    224f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    2251:	85 c0                	test   %eax,%eax
+    2253:	0f 88 ac 01 00 00    	js     2405 <createdelete+0x1d5>
+    if(pid == 0){
+    2259:	0f 84 01 01 00 00    	je     2360 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    225f:	83 c6 01             	add    $0x1,%esi
+    2262:	83 fe 04             	cmp    $0x4,%esi
+    2265:	75 e3                	jne    224a <createdelete+0x1a>
+    wait();
+    2267:	e8 4f 26 00 00       	call   48bb <wait>
+  for(i = 0; i < N; i++){
+    226c:	31 ff                	xor    %edi,%edi
+    226e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    2271:	e8 45 26 00 00       	call   48bb <wait>
+    2276:	e8 40 26 00 00       	call   48bb <wait>
+    227b:	e8 3b 26 00 00       	call   48bb <wait>
+  name[0] = name[1] = name[2] = 0;
+    2280:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    2284:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    2288:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    228a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    228d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    2292:	0f 94 c2             	sete   %dl
+    2295:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    2298:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    229b:	0f 9f c0             	setg   %al
+    229e:	09 c2                	or     %eax,%edx
+    22a0:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    22a3:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    22a7:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    22aa:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    22ad:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    22b0:	6a 00                	push   $0x0
+    22b2:	56                   	push   %esi
+    22b3:	e8 3b 26 00 00       	call   48f3 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    22b8:	83 c4 10             	add    $0x10,%esp
+    22bb:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    22bf:	74 7f                	je     2340 <createdelete+0x110>
+    22c1:	85 c0                	test   %eax,%eax
+    22c3:	0f 88 27 01 00 00    	js     23f0 <createdelete+0x1c0>
+        close(fd);
+    22c9:	83 ec 0c             	sub    $0xc,%esp
+    22cc:	50                   	push   %eax
+    22cd:	e8 09 26 00 00       	call   48db <close>
+    22d2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    22d5:	83 c3 01             	add    $0x1,%ebx
+    22d8:	80 fb 74             	cmp    $0x74,%bl
+    22db:	75 c6                	jne    22a3 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    22dd:	83 c7 01             	add    $0x1,%edi
+    22e0:	83 ff 14             	cmp    $0x14,%edi
+    22e3:	75 a3                	jne    2288 <createdelete+0x58>
+    22e5:	bf 70 00 00 00       	mov    $0x70,%edi
+    22ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    22f0:	8d 47 c0             	lea    -0x40(%edi),%eax
+    22f3:	bb 04 00 00 00       	mov    $0x4,%ebx
+    22f8:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    22fb:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    22fd:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    2300:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    2303:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    2307:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    230a:	56                   	push   %esi
+    230b:	e8 f3 25 00 00       	call   4903 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    2310:	83 c4 10             	add    $0x10,%esp
+    2313:	83 eb 01             	sub    $0x1,%ebx
+    2316:	75 e3                	jne    22fb <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    2318:	83 c7 01             	add    $0x1,%edi
+    231b:	89 f8                	mov    %edi,%eax
+    231d:	3c 84                	cmp    $0x84,%al
+    231f:	75 cf                	jne    22f0 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    2321:	83 ec 08             	sub    $0x8,%esp
+    2324:	68 93 52 00 00       	push   $0x5293
+    2329:	6a 01                	push   $0x1
+    232b:	e8 70 27 00 00       	call   4aa0 <printf>
+}
+    2330:	83 c4 10             	add    $0x10,%esp
+    2333:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2336:	5b                   	pop    %ebx
+    2337:	5e                   	pop    %esi
+    2338:	5f                   	pop    %edi
+    2339:	5d                   	pop    %ebp
+    233a:	c3                   	ret
+    233b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    233f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    2340:	85 c0                	test   %eax,%eax
+    2342:	78 91                	js     22d5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    2344:	50                   	push   %eax
+    2345:	56                   	push   %esi
+    2346:	68 64 5f 00 00       	push   $0x5f64
+    234b:	6a 01                	push   $0x1
+    234d:	e8 4e 27 00 00       	call   4aa0 <printf>
+        exit();
+    2352:	e8 5c 25 00 00       	call   48b3 <exit>
+    2357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    235e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    2360:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    2363:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    2367:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    236a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    236d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    2370:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    2373:	8d 43 30             	lea    0x30(%ebx),%eax
+    2376:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    2379:	68 02 02 00 00       	push   $0x202
+    237e:	56                   	push   %esi
+    237f:	e8 6f 25 00 00       	call   48f3 <open>
+        if(fd < 0){
+    2384:	83 c4 10             	add    $0x10,%esp
+    2387:	85 c0                	test   %eax,%eax
+    2389:	0f 88 8a 00 00 00    	js     2419 <createdelete+0x1e9>
+        close(fd);
+    238f:	83 ec 0c             	sub    $0xc,%esp
+    2392:	50                   	push   %eax
+    2393:	e8 43 25 00 00       	call   48db <close>
+        if(i > 0 && (i % 2 ) == 0){
+    2398:	83 c4 10             	add    $0x10,%esp
+    239b:	85 db                	test   %ebx,%ebx
+    239d:	74 19                	je     23b8 <createdelete+0x188>
+    239f:	f6 c3 01             	test   $0x1,%bl
+    23a2:	74 1b                	je     23bf <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    23a4:	83 c3 01             	add    $0x1,%ebx
+    23a7:	83 fb 14             	cmp    $0x14,%ebx
+    23aa:	75 c4                	jne    2370 <createdelete+0x140>
+      exit();
+    23ac:	e8 02 25 00 00       	call   48b3 <exit>
+    23b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    23b8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    23bd:	eb b1                	jmp    2370 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    23bf:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    23c1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    23c4:	d1 f8                	sar    %eax
+    23c6:	83 c0 30             	add    $0x30,%eax
+    23c9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    23cc:	56                   	push   %esi
+    23cd:	e8 31 25 00 00       	call   4903 <unlink>
+    23d2:	83 c4 10             	add    $0x10,%esp
+    23d5:	85 c0                	test   %eax,%eax
+    23d7:	79 cb                	jns    23a4 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    23d9:	52                   	push   %edx
+    23da:	52                   	push   %edx
+    23db:	68 81 4e 00 00       	push   $0x4e81
+    23e0:	6a 01                	push   $0x1
+    23e2:	e8 b9 26 00 00       	call   4aa0 <printf>
+            exit();
+    23e7:	e8 c7 24 00 00       	call   48b3 <exit>
+    23ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    23f0:	83 ec 04             	sub    $0x4,%esp
+    23f3:	56                   	push   %esi
+    23f4:	68 40 5f 00 00       	push   $0x5f40
+    23f9:	6a 01                	push   $0x1
+    23fb:	e8 a0 26 00 00       	call   4aa0 <printf>
+        exit();
+    2400:	e8 ae 24 00 00       	call   48b3 <exit>
+      printf(1, "fork failed\n");
+    2405:	83 ec 08             	sub    $0x8,%esp
+    2408:	68 09 5d 00 00       	push   $0x5d09
+    240d:	6a 01                	push   $0x1
+    240f:	e8 8c 26 00 00       	call   4aa0 <printf>
+      exit();
+    2414:	e8 9a 24 00 00       	call   48b3 <exit>
+          printf(1, "create failed\n");
+    2419:	83 ec 08             	sub    $0x8,%esp
+    241c:	68 cf 54 00 00       	push   $0x54cf
+    2421:	6a 01                	push   $0x1
+    2423:	e8 78 26 00 00       	call   4aa0 <printf>
+          exit();
+    2428:	e8 86 24 00 00       	call   48b3 <exit>
+    242d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002430 <unlinkread>:
+{
+    2430:	55                   	push   %ebp
+    2431:	89 e5                	mov    %esp,%ebp
+    2433:	56                   	push   %esi
+    2434:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    2435:	83 ec 08             	sub    $0x8,%esp
+    2438:	68 a4 52 00 00       	push   $0x52a4
+    243d:	6a 01                	push   $0x1
+    243f:	e8 5c 26 00 00       	call   4aa0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    2444:	5b                   	pop    %ebx
+    2445:	5e                   	pop    %esi
+    2446:	68 02 02 00 00       	push   $0x202
+    244b:	68 b5 52 00 00       	push   $0x52b5
+    2450:	e8 9e 24 00 00       	call   48f3 <open>
+  if(fd < 0){
+    2455:	83 c4 10             	add    $0x10,%esp
+    2458:	85 c0                	test   %eax,%eax
+    245a:	0f 88 e6 00 00 00    	js     2546 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    2460:	83 ec 04             	sub    $0x4,%esp
+    2463:	89 c3                	mov    %eax,%ebx
+    2465:	6a 05                	push   $0x5
+    2467:	68 da 52 00 00       	push   $0x52da
+    246c:	50                   	push   %eax
+    246d:	e8 61 24 00 00       	call   48d3 <write>
+  close(fd);
+    2472:	89 1c 24             	mov    %ebx,(%esp)
+    2475:	e8 61 24 00 00       	call   48db <close>
+  fd = open("unlinkread", O_RDWR);
+    247a:	58                   	pop    %eax
+    247b:	5a                   	pop    %edx
+    247c:	6a 02                	push   $0x2
+    247e:	68 b5 52 00 00       	push   $0x52b5
+    2483:	e8 6b 24 00 00       	call   48f3 <open>
+  if(fd < 0){
+    2488:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    248b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    248d:	85 c0                	test   %eax,%eax
+    248f:	0f 88 10 01 00 00    	js     25a5 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    2495:	83 ec 0c             	sub    $0xc,%esp
+    2498:	68 b5 52 00 00       	push   $0x52b5
+    249d:	e8 61 24 00 00       	call   4903 <unlink>
+    24a2:	83 c4 10             	add    $0x10,%esp
+    24a5:	85 c0                	test   %eax,%eax
+    24a7:	0f 85 e5 00 00 00    	jne    2592 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    24ad:	83 ec 08             	sub    $0x8,%esp
+    24b0:	68 02 02 00 00       	push   $0x202
+    24b5:	68 b5 52 00 00       	push   $0x52b5
+    24ba:	e8 34 24 00 00       	call   48f3 <open>
+  write(fd1, "yyy", 3);
+    24bf:	83 c4 0c             	add    $0xc,%esp
+    24c2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    24c4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    24c6:	68 12 53 00 00       	push   $0x5312
+    24cb:	50                   	push   %eax
+    24cc:	e8 02 24 00 00       	call   48d3 <write>
+  close(fd1);
+    24d1:	89 34 24             	mov    %esi,(%esp)
+    24d4:	e8 02 24 00 00       	call   48db <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    24d9:	83 c4 0c             	add    $0xc,%esp
+    24dc:	68 00 20 00 00       	push   $0x2000
+    24e1:	68 e0 95 00 00       	push   $0x95e0
+    24e6:	53                   	push   %ebx
+    24e7:	e8 df 23 00 00       	call   48cb <read>
+    24ec:	83 c4 10             	add    $0x10,%esp
+    24ef:	83 f8 05             	cmp    $0x5,%eax
+    24f2:	0f 85 87 00 00 00    	jne    257f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    24f8:	80 3d e0 95 00 00 68 	cmpb   $0x68,0x95e0
+    24ff:	75 6b                	jne    256c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    2501:	83 ec 04             	sub    $0x4,%esp
+    2504:	6a 0a                	push   $0xa
+    2506:	68 e0 95 00 00       	push   $0x95e0
+    250b:	53                   	push   %ebx
+    250c:	e8 c2 23 00 00       	call   48d3 <write>
+    2511:	83 c4 10             	add    $0x10,%esp
+    2514:	83 f8 0a             	cmp    $0xa,%eax
+    2517:	75 40                	jne    2559 <unlinkread+0x129>
+  close(fd);
+    2519:	83 ec 0c             	sub    $0xc,%esp
+    251c:	53                   	push   %ebx
+    251d:	e8 b9 23 00 00       	call   48db <close>
+  unlink("unlinkread");
+    2522:	c7 04 24 b5 52 00 00 	movl   $0x52b5,(%esp)
+    2529:	e8 d5 23 00 00       	call   4903 <unlink>
+  printf(1, "unlinkread ok\n");
+    252e:	58                   	pop    %eax
+    252f:	5a                   	pop    %edx
+    2530:	68 5d 53 00 00       	push   $0x535d
+    2535:	6a 01                	push   $0x1
+    2537:	e8 64 25 00 00       	call   4aa0 <printf>
+}
+    253c:	83 c4 10             	add    $0x10,%esp
+    253f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2542:	5b                   	pop    %ebx
+    2543:	5e                   	pop    %esi
+    2544:	5d                   	pop    %ebp
+    2545:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    2546:	51                   	push   %ecx
+    2547:	51                   	push   %ecx
+    2548:	68 c0 52 00 00       	push   $0x52c0
+    254d:	6a 01                	push   $0x1
+    254f:	e8 4c 25 00 00       	call   4aa0 <printf>
+    exit();
+    2554:	e8 5a 23 00 00       	call   48b3 <exit>
+    printf(1, "unlinkread write failed\n");
+    2559:	51                   	push   %ecx
+    255a:	51                   	push   %ecx
+    255b:	68 44 53 00 00       	push   $0x5344
+    2560:	6a 01                	push   $0x1
+    2562:	e8 39 25 00 00       	call   4aa0 <printf>
+    exit();
+    2567:	e8 47 23 00 00       	call   48b3 <exit>
+    printf(1, "unlinkread wrong data\n");
+    256c:	53                   	push   %ebx
+    256d:	53                   	push   %ebx
+    256e:	68 2d 53 00 00       	push   $0x532d
+    2573:	6a 01                	push   $0x1
+    2575:	e8 26 25 00 00       	call   4aa0 <printf>
+    exit();
+    257a:	e8 34 23 00 00       	call   48b3 <exit>
+    printf(1, "unlinkread read failed");
+    257f:	56                   	push   %esi
+    2580:	56                   	push   %esi
+    2581:	68 16 53 00 00       	push   $0x5316
+    2586:	6a 01                	push   $0x1
+    2588:	e8 13 25 00 00       	call   4aa0 <printf>
+    exit();
+    258d:	e8 21 23 00 00       	call   48b3 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    2592:	50                   	push   %eax
+    2593:	50                   	push   %eax
+    2594:	68 f8 52 00 00       	push   $0x52f8
+    2599:	6a 01                	push   $0x1
+    259b:	e8 00 25 00 00       	call   4aa0 <printf>
+    exit();
+    25a0:	e8 0e 23 00 00       	call   48b3 <exit>
+    printf(1, "open unlinkread failed\n");
+    25a5:	50                   	push   %eax
+    25a6:	50                   	push   %eax
+    25a7:	68 e0 52 00 00       	push   $0x52e0
+    25ac:	6a 01                	push   $0x1
+    25ae:	e8 ed 24 00 00       	call   4aa0 <printf>
+    exit();
+    25b3:	e8 fb 22 00 00       	call   48b3 <exit>
+    25b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25bf:	90                   	nop
+
+000025c0 <linktest>:
+{
+    25c0:	55                   	push   %ebp
+    25c1:	89 e5                	mov    %esp,%ebp
+    25c3:	53                   	push   %ebx
+    25c4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    25c7:	68 6c 53 00 00       	push   $0x536c
+    25cc:	6a 01                	push   $0x1
+    25ce:	e8 cd 24 00 00       	call   4aa0 <printf>
+  unlink("lf1");
+    25d3:	c7 04 24 76 53 00 00 	movl   $0x5376,(%esp)
+    25da:	e8 24 23 00 00       	call   4903 <unlink>
+  unlink("lf2");
+    25df:	c7 04 24 7a 53 00 00 	movl   $0x537a,(%esp)
+    25e6:	e8 18 23 00 00       	call   4903 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    25eb:	58                   	pop    %eax
+    25ec:	5a                   	pop    %edx
+    25ed:	68 02 02 00 00       	push   $0x202
+    25f2:	68 76 53 00 00       	push   $0x5376
+    25f7:	e8 f7 22 00 00       	call   48f3 <open>
+  if(fd < 0){
+    25fc:	83 c4 10             	add    $0x10,%esp
+    25ff:	85 c0                	test   %eax,%eax
+    2601:	0f 88 1e 01 00 00    	js     2725 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    2607:	83 ec 04             	sub    $0x4,%esp
+    260a:	89 c3                	mov    %eax,%ebx
+    260c:	6a 05                	push   $0x5
+    260e:	68 da 52 00 00       	push   $0x52da
+    2613:	50                   	push   %eax
+    2614:	e8 ba 22 00 00       	call   48d3 <write>
+    2619:	83 c4 10             	add    $0x10,%esp
+    261c:	83 f8 05             	cmp    $0x5,%eax
+    261f:	0f 85 98 01 00 00    	jne    27bd <linktest+0x1fd>
+  close(fd);
+    2625:	83 ec 0c             	sub    $0xc,%esp
+    2628:	53                   	push   %ebx
+    2629:	e8 ad 22 00 00       	call   48db <close>
+  if(link("lf1", "lf2") < 0){
+    262e:	5b                   	pop    %ebx
+    262f:	58                   	pop    %eax
+    2630:	68 7a 53 00 00       	push   $0x537a
+    2635:	68 76 53 00 00       	push   $0x5376
+    263a:	e8 d4 22 00 00       	call   4913 <link>
+    263f:	83 c4 10             	add    $0x10,%esp
+    2642:	85 c0                	test   %eax,%eax
+    2644:	0f 88 60 01 00 00    	js     27aa <linktest+0x1ea>
+  unlink("lf1");
+    264a:	83 ec 0c             	sub    $0xc,%esp
+    264d:	68 76 53 00 00       	push   $0x5376
+    2652:	e8 ac 22 00 00       	call   4903 <unlink>
+  if(open("lf1", 0) >= 0){
+    2657:	58                   	pop    %eax
+    2658:	5a                   	pop    %edx
+    2659:	6a 00                	push   $0x0
+    265b:	68 76 53 00 00       	push   $0x5376
+    2660:	e8 8e 22 00 00       	call   48f3 <open>
+    2665:	83 c4 10             	add    $0x10,%esp
+    2668:	85 c0                	test   %eax,%eax
+    266a:	0f 89 27 01 00 00    	jns    2797 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    2670:	83 ec 08             	sub    $0x8,%esp
+    2673:	6a 00                	push   $0x0
+    2675:	68 7a 53 00 00       	push   $0x537a
+    267a:	e8 74 22 00 00       	call   48f3 <open>
+  if(fd < 0){
+    267f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    2682:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2684:	85 c0                	test   %eax,%eax
+    2686:	0f 88 f8 00 00 00    	js     2784 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    268c:	83 ec 04             	sub    $0x4,%esp
+    268f:	68 00 20 00 00       	push   $0x2000
+    2694:	68 e0 95 00 00       	push   $0x95e0
+    2699:	50                   	push   %eax
+    269a:	e8 2c 22 00 00       	call   48cb <read>
+    269f:	83 c4 10             	add    $0x10,%esp
+    26a2:	83 f8 05             	cmp    $0x5,%eax
+    26a5:	0f 85 c6 00 00 00    	jne    2771 <linktest+0x1b1>
+  close(fd);
+    26ab:	83 ec 0c             	sub    $0xc,%esp
+    26ae:	53                   	push   %ebx
+    26af:	e8 27 22 00 00       	call   48db <close>
+  if(link("lf2", "lf2") >= 0){
+    26b4:	58                   	pop    %eax
+    26b5:	5a                   	pop    %edx
+    26b6:	68 7a 53 00 00       	push   $0x537a
+    26bb:	68 7a 53 00 00       	push   $0x537a
+    26c0:	e8 4e 22 00 00       	call   4913 <link>
+    26c5:	83 c4 10             	add    $0x10,%esp
+    26c8:	85 c0                	test   %eax,%eax
+    26ca:	0f 89 8e 00 00 00    	jns    275e <linktest+0x19e>
+  unlink("lf2");
+    26d0:	83 ec 0c             	sub    $0xc,%esp
+    26d3:	68 7a 53 00 00       	push   $0x537a
+    26d8:	e8 26 22 00 00       	call   4903 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    26dd:	59                   	pop    %ecx
+    26de:	5b                   	pop    %ebx
+    26df:	68 76 53 00 00       	push   $0x5376
+    26e4:	68 7a 53 00 00       	push   $0x537a
+    26e9:	e8 25 22 00 00       	call   4913 <link>
+    26ee:	83 c4 10             	add    $0x10,%esp
+    26f1:	85 c0                	test   %eax,%eax
+    26f3:	79 56                	jns    274b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    26f5:	83 ec 08             	sub    $0x8,%esp
+    26f8:	68 76 53 00 00       	push   $0x5376
+    26fd:	68 3e 56 00 00       	push   $0x563e
+    2702:	e8 0c 22 00 00       	call   4913 <link>
+    2707:	83 c4 10             	add    $0x10,%esp
+    270a:	85 c0                	test   %eax,%eax
+    270c:	79 2a                	jns    2738 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    270e:	83 ec 08             	sub    $0x8,%esp
+    2711:	68 14 54 00 00       	push   $0x5414
+    2716:	6a 01                	push   $0x1
+    2718:	e8 83 23 00 00       	call   4aa0 <printf>
+}
+    271d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2720:	83 c4 10             	add    $0x10,%esp
+    2723:	c9                   	leave
+    2724:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    2725:	50                   	push   %eax
+    2726:	50                   	push   %eax
+    2727:	68 7e 53 00 00       	push   $0x537e
+    272c:	6a 01                	push   $0x1
+    272e:	e8 6d 23 00 00       	call   4aa0 <printf>
+    exit();
+    2733:	e8 7b 21 00 00       	call   48b3 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    2738:	50                   	push   %eax
+    2739:	50                   	push   %eax
+    273a:	68 f8 53 00 00       	push   $0x53f8
+    273f:	6a 01                	push   $0x1
+    2741:	e8 5a 23 00 00       	call   4aa0 <printf>
+    exit();
+    2746:	e8 68 21 00 00       	call   48b3 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    274b:	52                   	push   %edx
+    274c:	52                   	push   %edx
+    274d:	68 ac 5f 00 00       	push   $0x5fac
+    2752:	6a 01                	push   $0x1
+    2754:	e8 47 23 00 00       	call   4aa0 <printf>
+    exit();
+    2759:	e8 55 21 00 00       	call   48b3 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    275e:	50                   	push   %eax
+    275f:	50                   	push   %eax
+    2760:	68 da 53 00 00       	push   $0x53da
+    2765:	6a 01                	push   $0x1
+    2767:	e8 34 23 00 00       	call   4aa0 <printf>
+    exit();
+    276c:	e8 42 21 00 00       	call   48b3 <exit>
+    printf(1, "read lf2 failed\n");
+    2771:	51                   	push   %ecx
+    2772:	51                   	push   %ecx
+    2773:	68 c9 53 00 00       	push   $0x53c9
+    2778:	6a 01                	push   $0x1
+    277a:	e8 21 23 00 00       	call   4aa0 <printf>
+    exit();
+    277f:	e8 2f 21 00 00       	call   48b3 <exit>
+    printf(1, "open lf2 failed\n");
+    2784:	53                   	push   %ebx
+    2785:	53                   	push   %ebx
+    2786:	68 b8 53 00 00       	push   $0x53b8
+    278b:	6a 01                	push   $0x1
+    278d:	e8 0e 23 00 00       	call   4aa0 <printf>
+    exit();
+    2792:	e8 1c 21 00 00       	call   48b3 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    2797:	50                   	push   %eax
+    2798:	50                   	push   %eax
+    2799:	68 84 5f 00 00       	push   $0x5f84
+    279e:	6a 01                	push   $0x1
+    27a0:	e8 fb 22 00 00       	call   4aa0 <printf>
+    exit();
+    27a5:	e8 09 21 00 00       	call   48b3 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    27aa:	51                   	push   %ecx
+    27ab:	51                   	push   %ecx
+    27ac:	68 a3 53 00 00       	push   $0x53a3
+    27b1:	6a 01                	push   $0x1
+    27b3:	e8 e8 22 00 00       	call   4aa0 <printf>
+    exit();
+    27b8:	e8 f6 20 00 00       	call   48b3 <exit>
+    printf(1, "write lf1 failed\n");
+    27bd:	50                   	push   %eax
+    27be:	50                   	push   %eax
+    27bf:	68 91 53 00 00       	push   $0x5391
+    27c4:	6a 01                	push   $0x1
+    27c6:	e8 d5 22 00 00       	call   4aa0 <printf>
+    exit();
+    27cb:	e8 e3 20 00 00       	call   48b3 <exit>
+
+000027d0 <concreate>:
+{
+    27d0:	55                   	push   %ebp
+    27d1:	89 e5                	mov    %esp,%ebp
+    27d3:	57                   	push   %edi
+    27d4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    27d5:	31 f6                	xor    %esi,%esi
+{
+    27d7:	53                   	push   %ebx
+    27d8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    27db:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    27de:	68 21 54 00 00       	push   $0x5421
+    27e3:	6a 01                	push   $0x1
+    27e5:	e8 b6 22 00 00       	call   4aa0 <printf>
+  file[0] = 'C';
+    27ea:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    27ee:	83 c4 10             	add    $0x10,%esp
+    27f1:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    27f5:	eb 4c                	jmp    2843 <concreate+0x73>
+    27f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27fe:	66 90                	xchg   %ax,%ax
+    2800:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    2806:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    280b:	0f 83 8f 00 00 00    	jae    28a0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    2811:	83 ec 08             	sub    $0x8,%esp
+    2814:	68 02 02 00 00       	push   $0x202
+    2819:	53                   	push   %ebx
+    281a:	e8 d4 20 00 00       	call   48f3 <open>
+      if(fd < 0){
+    281f:	83 c4 10             	add    $0x10,%esp
+    2822:	85 c0                	test   %eax,%eax
+    2824:	78 63                	js     2889 <concreate+0xb9>
+      close(fd);
+    2826:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    2829:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    282c:	50                   	push   %eax
+    282d:	e8 a9 20 00 00       	call   48db <close>
+    2832:	83 c4 10             	add    $0x10,%esp
+      wait();
+    2835:	e8 81 20 00 00       	call   48bb <wait>
+  for(i = 0; i < 40; i++){
+    283a:	83 fe 28             	cmp    $0x28,%esi
+    283d:	0f 84 7f 00 00 00    	je     28c2 <concreate+0xf2>
+    unlink(file);
+    2843:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    2846:	8d 46 30             	lea    0x30(%esi),%eax
+    2849:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    284c:	53                   	push   %ebx
+    284d:	e8 b1 20 00 00       	call   4903 <unlink>
+    pid = fork();
+    2852:	e8 54 20 00 00       	call   48ab <fork>
+    if(pid && (i % 3) == 1){
+    2857:	83 c4 10             	add    $0x10,%esp
+    285a:	85 c0                	test   %eax,%eax
+    285c:	75 a2                	jne    2800 <concreate+0x30>
+      link("C0", file);
+    285e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    2864:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    286a:	0f 83 d0 00 00 00    	jae    2940 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    2870:	83 ec 08             	sub    $0x8,%esp
+    2873:	68 02 02 00 00       	push   $0x202
+    2878:	53                   	push   %ebx
+    2879:	e8 75 20 00 00       	call   48f3 <open>
+      if(fd < 0){
+    287e:	83 c4 10             	add    $0x10,%esp
+    2881:	85 c0                	test   %eax,%eax
+    2883:	0f 89 ea 01 00 00    	jns    2a73 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    2889:	83 ec 04             	sub    $0x4,%esp
+    288c:	53                   	push   %ebx
+    288d:	68 34 54 00 00       	push   $0x5434
+    2892:	6a 01                	push   $0x1
+    2894:	e8 07 22 00 00       	call   4aa0 <printf>
+        exit();
+    2899:	e8 15 20 00 00       	call   48b3 <exit>
+    289e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    28a0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    28a3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    28a6:	53                   	push   %ebx
+    28a7:	68 31 54 00 00       	push   $0x5431
+    28ac:	e8 62 20 00 00       	call   4913 <link>
+    28b1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    28b4:	e8 02 20 00 00       	call   48bb <wait>
+  for(i = 0; i < 40; i++){
+    28b9:	83 fe 28             	cmp    $0x28,%esi
+    28bc:	0f 85 81 ff ff ff    	jne    2843 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    28c2:	83 ec 04             	sub    $0x4,%esp
+    28c5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    28c8:	6a 28                	push   $0x28
+    28ca:	6a 00                	push   $0x0
+    28cc:	50                   	push   %eax
+    28cd:	e8 5e 1e 00 00       	call   4730 <memset>
+  fd = open(".", 0);
+    28d2:	5e                   	pop    %esi
+    28d3:	5f                   	pop    %edi
+    28d4:	6a 00                	push   $0x0
+    28d6:	68 3e 56 00 00       	push   $0x563e
+    28db:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    28de:	e8 10 20 00 00       	call   48f3 <open>
+  n = 0;
+    28e3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    28ea:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    28ed:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    28ef:	90                   	nop
+    28f0:	83 ec 04             	sub    $0x4,%esp
+    28f3:	6a 10                	push   $0x10
+    28f5:	57                   	push   %edi
+    28f6:	56                   	push   %esi
+    28f7:	e8 cf 1f 00 00       	call   48cb <read>
+    28fc:	83 c4 10             	add    $0x10,%esp
+    28ff:	85 c0                	test   %eax,%eax
+    2901:	7e 5d                	jle    2960 <concreate+0x190>
+    if(de.inum == 0)
+    2903:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    2908:	74 e6                	je     28f0 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    290a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    290e:	75 e0                	jne    28f0 <concreate+0x120>
+    2910:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    2914:	75 da                	jne    28f0 <concreate+0x120>
+      i = de.name[1] - '0';
+    2916:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    291a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    291d:	83 f8 27             	cmp    $0x27,%eax
+    2920:	0f 87 5e 01 00 00    	ja     2a84 <concreate+0x2b4>
+      if(fa[i]){
+    2926:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    292b:	0f 85 7e 01 00 00    	jne    2aaf <concreate+0x2df>
+      n++;
+    2931:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    2935:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    293a:	eb b4                	jmp    28f0 <concreate+0x120>
+    293c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    2940:	83 ec 08             	sub    $0x8,%esp
+    2943:	53                   	push   %ebx
+    2944:	68 31 54 00 00       	push   $0x5431
+    2949:	e8 c5 1f 00 00       	call   4913 <link>
+    294e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2951:	e8 5d 1f 00 00       	call   48b3 <exit>
+    2956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    295d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    2960:	83 ec 0c             	sub    $0xc,%esp
+    2963:	56                   	push   %esi
+    2964:	e8 72 1f 00 00       	call   48db <close>
+  if(n != 40){
+    2969:	83 c4 10             	add    $0x10,%esp
+    296c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    2970:	0f 85 26 01 00 00    	jne    2a9c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    2976:	31 f6                	xor    %esi,%esi
+    2978:	eb 48                	jmp    29c2 <concreate+0x1f2>
+    297a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    2980:	85 ff                	test   %edi,%edi
+    2982:	74 05                	je     2989 <concreate+0x1b9>
+    2984:	83 f8 01             	cmp    $0x1,%eax
+    2987:	74 68                	je     29f1 <concreate+0x221>
+      unlink(file);
+    2989:	83 ec 0c             	sub    $0xc,%esp
+    298c:	53                   	push   %ebx
+    298d:	e8 71 1f 00 00       	call   4903 <unlink>
+      unlink(file);
+    2992:	89 1c 24             	mov    %ebx,(%esp)
+    2995:	e8 69 1f 00 00       	call   4903 <unlink>
+      unlink(file);
+    299a:	89 1c 24             	mov    %ebx,(%esp)
+    299d:	e8 61 1f 00 00       	call   4903 <unlink>
+      unlink(file);
+    29a2:	89 1c 24             	mov    %ebx,(%esp)
+    29a5:	e8 59 1f 00 00       	call   4903 <unlink>
+    29aa:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    29ad:	85 ff                	test   %edi,%edi
+    29af:	74 a0                	je     2951 <concreate+0x181>
+      wait();
+    29b1:	e8 05 1f 00 00       	call   48bb <wait>
+  for(i = 0; i < 40; i++){
+    29b6:	83 c6 01             	add    $0x1,%esi
+    29b9:	83 fe 28             	cmp    $0x28,%esi
+    29bc:	0f 84 86 00 00 00    	je     2a48 <concreate+0x278>
+    file[1] = '0' + i;
+    29c2:	8d 46 30             	lea    0x30(%esi),%eax
+    29c5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    29c8:	e8 de 1e 00 00       	call   48ab <fork>
+    29cd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    29cf:	85 c0                	test   %eax,%eax
+    29d1:	0f 88 88 00 00 00    	js     2a5f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    29d7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    29dc:	f7 e6                	mul    %esi
+    29de:	89 d0                	mov    %edx,%eax
+    29e0:	83 e2 fe             	and    $0xfffffffe,%edx
+    29e3:	d1 e8                	shr    %eax
+    29e5:	01 c2                	add    %eax,%edx
+    29e7:	89 f0                	mov    %esi,%eax
+    29e9:	29 d0                	sub    %edx,%eax
+    29eb:	89 c1                	mov    %eax,%ecx
+    29ed:	09 f9                	or     %edi,%ecx
+    29ef:	75 8f                	jne    2980 <concreate+0x1b0>
+      close(open(file, 0));
+    29f1:	83 ec 08             	sub    $0x8,%esp
+    29f4:	6a 00                	push   $0x0
+    29f6:	53                   	push   %ebx
+    29f7:	e8 f7 1e 00 00       	call   48f3 <open>
+    29fc:	89 04 24             	mov    %eax,(%esp)
+    29ff:	e8 d7 1e 00 00       	call   48db <close>
+      close(open(file, 0));
+    2a04:	58                   	pop    %eax
+    2a05:	5a                   	pop    %edx
+    2a06:	6a 00                	push   $0x0
+    2a08:	53                   	push   %ebx
+    2a09:	e8 e5 1e 00 00       	call   48f3 <open>
+    2a0e:	89 04 24             	mov    %eax,(%esp)
+    2a11:	e8 c5 1e 00 00       	call   48db <close>
+      close(open(file, 0));
+    2a16:	59                   	pop    %ecx
+    2a17:	58                   	pop    %eax
+    2a18:	6a 00                	push   $0x0
+    2a1a:	53                   	push   %ebx
+    2a1b:	e8 d3 1e 00 00       	call   48f3 <open>
+    2a20:	89 04 24             	mov    %eax,(%esp)
+    2a23:	e8 b3 1e 00 00       	call   48db <close>
+      close(open(file, 0));
+    2a28:	58                   	pop    %eax
+    2a29:	5a                   	pop    %edx
+    2a2a:	6a 00                	push   $0x0
+    2a2c:	53                   	push   %ebx
+    2a2d:	e8 c1 1e 00 00       	call   48f3 <open>
+    2a32:	89 04 24             	mov    %eax,(%esp)
+    2a35:	e8 a1 1e 00 00       	call   48db <close>
+    2a3a:	83 c4 10             	add    $0x10,%esp
+    2a3d:	e9 6b ff ff ff       	jmp    29ad <concreate+0x1dd>
+    2a42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    2a48:	83 ec 08             	sub    $0x8,%esp
+    2a4b:	68 86 54 00 00       	push   $0x5486
+    2a50:	6a 01                	push   $0x1
+    2a52:	e8 49 20 00 00       	call   4aa0 <printf>
+}
+    2a57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2a5a:	5b                   	pop    %ebx
+    2a5b:	5e                   	pop    %esi
+    2a5c:	5f                   	pop    %edi
+    2a5d:	5d                   	pop    %ebp
+    2a5e:	c3                   	ret
+      printf(1, "fork failed\n");
+    2a5f:	83 ec 08             	sub    $0x8,%esp
+    2a62:	68 09 5d 00 00       	push   $0x5d09
+    2a67:	6a 01                	push   $0x1
+    2a69:	e8 32 20 00 00       	call   4aa0 <printf>
+      exit();
+    2a6e:	e8 40 1e 00 00       	call   48b3 <exit>
+      close(fd);
+    2a73:	83 ec 0c             	sub    $0xc,%esp
+    2a76:	50                   	push   %eax
+    2a77:	e8 5f 1e 00 00       	call   48db <close>
+    2a7c:	83 c4 10             	add    $0x10,%esp
+    2a7f:	e9 cd fe ff ff       	jmp    2951 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    2a84:	83 ec 04             	sub    $0x4,%esp
+    2a87:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    2a8a:	50                   	push   %eax
+    2a8b:	68 50 54 00 00       	push   $0x5450
+    2a90:	6a 01                	push   $0x1
+    2a92:	e8 09 20 00 00       	call   4aa0 <printf>
+        exit();
+    2a97:	e8 17 1e 00 00       	call   48b3 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    2a9c:	51                   	push   %ecx
+    2a9d:	51                   	push   %ecx
+    2a9e:	68 d0 5f 00 00       	push   $0x5fd0
+    2aa3:	6a 01                	push   $0x1
+    2aa5:	e8 f6 1f 00 00       	call   4aa0 <printf>
+    exit();
+    2aaa:	e8 04 1e 00 00       	call   48b3 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    2aaf:	83 ec 04             	sub    $0x4,%esp
+    2ab2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    2ab5:	50                   	push   %eax
+    2ab6:	68 69 54 00 00       	push   $0x5469
+    2abb:	6a 01                	push   $0x1
+    2abd:	e8 de 1f 00 00       	call   4aa0 <printf>
+        exit();
+    2ac2:	e8 ec 1d 00 00       	call   48b3 <exit>
+    2ac7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2ace:	66 90                	xchg   %ax,%ax
+
+00002ad0 <linkunlink>:
+{
+    2ad0:	55                   	push   %ebp
+    2ad1:	89 e5                	mov    %esp,%ebp
+    2ad3:	57                   	push   %edi
+    2ad4:	56                   	push   %esi
+    2ad5:	53                   	push   %ebx
+    2ad6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    2ad9:	68 94 54 00 00       	push   $0x5494
+    2ade:	6a 01                	push   $0x1
+    2ae0:	e8 bb 1f 00 00       	call   4aa0 <printf>
+  unlink("x");
+    2ae5:	c7 04 24 21 57 00 00 	movl   $0x5721,(%esp)
+    2aec:	e8 12 1e 00 00       	call   4903 <unlink>
+  pid = fork();
+    2af1:	e8 b5 1d 00 00       	call   48ab <fork>
+  if(pid < 0){
+    2af6:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    2af9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    2afc:	85 c0                	test   %eax,%eax
+    2afe:	0f 88 b6 00 00 00    	js     2bba <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    2b04:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    2b08:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    2b0d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    2b12:	19 ff                	sbb    %edi,%edi
+    2b14:	83 e7 60             	and    $0x60,%edi
+    2b17:	83 c7 01             	add    $0x1,%edi
+    2b1a:	eb 1e                	jmp    2b3a <linkunlink+0x6a>
+    2b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    2b20:	83 f8 01             	cmp    $0x1,%eax
+    2b23:	74 7b                	je     2ba0 <linkunlink+0xd0>
+      unlink("x");
+    2b25:	83 ec 0c             	sub    $0xc,%esp
+    2b28:	68 21 57 00 00       	push   $0x5721
+    2b2d:	e8 d1 1d 00 00       	call   4903 <unlink>
+    2b32:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2b35:	83 eb 01             	sub    $0x1,%ebx
+    2b38:	74 41                	je     2b7b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    2b3a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    2b40:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    2b46:	89 f8                	mov    %edi,%eax
+    2b48:	f7 e6                	mul    %esi
+    2b4a:	89 d0                	mov    %edx,%eax
+    2b4c:	83 e2 fe             	and    $0xfffffffe,%edx
+    2b4f:	d1 e8                	shr    %eax
+    2b51:	01 c2                	add    %eax,%edx
+    2b53:	89 f8                	mov    %edi,%eax
+    2b55:	29 d0                	sub    %edx,%eax
+    2b57:	75 c7                	jne    2b20 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    2b59:	83 ec 08             	sub    $0x8,%esp
+    2b5c:	68 02 02 00 00       	push   $0x202
+    2b61:	68 21 57 00 00       	push   $0x5721
+    2b66:	e8 88 1d 00 00       	call   48f3 <open>
+    2b6b:	89 04 24             	mov    %eax,(%esp)
+    2b6e:	e8 68 1d 00 00       	call   48db <close>
+    2b73:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2b76:	83 eb 01             	sub    $0x1,%ebx
+    2b79:	75 bf                	jne    2b3a <linkunlink+0x6a>
+  if(pid)
+    2b7b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2b7e:	85 c0                	test   %eax,%eax
+    2b80:	74 4b                	je     2bcd <linkunlink+0xfd>
+    wait();
+    2b82:	e8 34 1d 00 00       	call   48bb <wait>
+  printf(1, "linkunlink ok\n");
+    2b87:	83 ec 08             	sub    $0x8,%esp
+    2b8a:	68 a9 54 00 00       	push   $0x54a9
+    2b8f:	6a 01                	push   $0x1
+    2b91:	e8 0a 1f 00 00       	call   4aa0 <printf>
+}
+    2b96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2b99:	5b                   	pop    %ebx
+    2b9a:	5e                   	pop    %esi
+    2b9b:	5f                   	pop    %edi
+    2b9c:	5d                   	pop    %ebp
+    2b9d:	c3                   	ret
+    2b9e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    2ba0:	83 ec 08             	sub    $0x8,%esp
+    2ba3:	68 21 57 00 00       	push   $0x5721
+    2ba8:	68 a5 54 00 00       	push   $0x54a5
+    2bad:	e8 61 1d 00 00       	call   4913 <link>
+    2bb2:	83 c4 10             	add    $0x10,%esp
+    2bb5:	e9 7b ff ff ff       	jmp    2b35 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    2bba:	52                   	push   %edx
+    2bbb:	52                   	push   %edx
+    2bbc:	68 09 5d 00 00       	push   $0x5d09
+    2bc1:	6a 01                	push   $0x1
+    2bc3:	e8 d8 1e 00 00       	call   4aa0 <printf>
+    exit();
+    2bc8:	e8 e6 1c 00 00       	call   48b3 <exit>
+    exit();
+    2bcd:	e8 e1 1c 00 00       	call   48b3 <exit>
+    2bd2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002be0 <bigdir>:
+{
+    2be0:	55                   	push   %ebp
+    2be1:	89 e5                	mov    %esp,%ebp
+    2be3:	57                   	push   %edi
+    2be4:	56                   	push   %esi
+    2be5:	53                   	push   %ebx
+    2be6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    2be9:	68 b8 54 00 00       	push   $0x54b8
+    2bee:	6a 01                	push   $0x1
+    2bf0:	e8 ab 1e 00 00       	call   4aa0 <printf>
+  unlink("bd");
+    2bf5:	c7 04 24 c5 54 00 00 	movl   $0x54c5,(%esp)
+    2bfc:	e8 02 1d 00 00       	call   4903 <unlink>
+  fd = open("bd", O_CREATE);
+    2c01:	5a                   	pop    %edx
+    2c02:	59                   	pop    %ecx
+    2c03:	68 00 02 00 00       	push   $0x200
+    2c08:	68 c5 54 00 00       	push   $0x54c5
+    2c0d:	e8 e1 1c 00 00       	call   48f3 <open>
+  if(fd < 0){
+    2c12:	83 c4 10             	add    $0x10,%esp
+    2c15:	85 c0                	test   %eax,%eax
+    2c17:	0f 88 de 00 00 00    	js     2cfb <bigdir+0x11b>
+  close(fd);
+    2c1d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    2c20:	31 f6                	xor    %esi,%esi
+    2c22:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    2c25:	50                   	push   %eax
+    2c26:	e8 b0 1c 00 00       	call   48db <close>
+    2c2b:	83 c4 10             	add    $0x10,%esp
+    2c2e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    2c30:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    2c32:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    2c35:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2c39:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    2c3c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    2c40:	83 c0 30             	add    $0x30,%eax
+    2c43:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    2c46:	89 f0                	mov    %esi,%eax
+    2c48:	83 e0 3f             	and    $0x3f,%eax
+    2c4b:	83 c0 30             	add    $0x30,%eax
+    2c4e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    2c51:	57                   	push   %edi
+    2c52:	68 c5 54 00 00       	push   $0x54c5
+    2c57:	e8 b7 1c 00 00       	call   4913 <link>
+    2c5c:	83 c4 10             	add    $0x10,%esp
+    2c5f:	89 c3                	mov    %eax,%ebx
+    2c61:	85 c0                	test   %eax,%eax
+    2c63:	75 6e                	jne    2cd3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    2c65:	83 c6 01             	add    $0x1,%esi
+    2c68:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    2c6e:	75 c0                	jne    2c30 <bigdir+0x50>
+  unlink("bd");
+    2c70:	83 ec 0c             	sub    $0xc,%esp
+    2c73:	68 c5 54 00 00       	push   $0x54c5
+    2c78:	e8 86 1c 00 00       	call   4903 <unlink>
+    2c7d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    2c80:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    2c82:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    2c85:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2c89:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    2c8c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    2c90:	83 c0 30             	add    $0x30,%eax
+    2c93:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    2c96:	89 d8                	mov    %ebx,%eax
+    2c98:	83 e0 3f             	and    $0x3f,%eax
+    2c9b:	83 c0 30             	add    $0x30,%eax
+    2c9e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    2ca1:	57                   	push   %edi
+    2ca2:	e8 5c 1c 00 00       	call   4903 <unlink>
+    2ca7:	83 c4 10             	add    $0x10,%esp
+    2caa:	85 c0                	test   %eax,%eax
+    2cac:	75 39                	jne    2ce7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    2cae:	83 c3 01             	add    $0x1,%ebx
+    2cb1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    2cb7:	75 c7                	jne    2c80 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    2cb9:	83 ec 08             	sub    $0x8,%esp
+    2cbc:	68 07 55 00 00       	push   $0x5507
+    2cc1:	6a 01                	push   $0x1
+    2cc3:	e8 d8 1d 00 00       	call   4aa0 <printf>
+    2cc8:	83 c4 10             	add    $0x10,%esp
+}
+    2ccb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2cce:	5b                   	pop    %ebx
+    2ccf:	5e                   	pop    %esi
+    2cd0:	5f                   	pop    %edi
+    2cd1:	5d                   	pop    %ebp
+    2cd2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    2cd3:	83 ec 08             	sub    $0x8,%esp
+    2cd6:	68 de 54 00 00       	push   $0x54de
+    2cdb:	6a 01                	push   $0x1
+    2cdd:	e8 be 1d 00 00       	call   4aa0 <printf>
+      exit();
+    2ce2:	e8 cc 1b 00 00       	call   48b3 <exit>
+      printf(1, "bigdir unlink failed");
+    2ce7:	83 ec 08             	sub    $0x8,%esp
+    2cea:	68 f2 54 00 00       	push   $0x54f2
+    2cef:	6a 01                	push   $0x1
+    2cf1:	e8 aa 1d 00 00       	call   4aa0 <printf>
+      exit();
+    2cf6:	e8 b8 1b 00 00       	call   48b3 <exit>
+    printf(1, "bigdir create failed\n");
+    2cfb:	50                   	push   %eax
+    2cfc:	50                   	push   %eax
+    2cfd:	68 c8 54 00 00       	push   $0x54c8
+    2d02:	6a 01                	push   $0x1
+    2d04:	e8 97 1d 00 00       	call   4aa0 <printf>
+    exit();
+    2d09:	e8 a5 1b 00 00       	call   48b3 <exit>
+    2d0e:	66 90                	xchg   %ax,%ax
+
+00002d10 <subdir>:
+{
+    2d10:	55                   	push   %ebp
+    2d11:	89 e5                	mov    %esp,%ebp
+    2d13:	53                   	push   %ebx
+    2d14:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    2d17:	68 12 55 00 00       	push   $0x5512
+    2d1c:	6a 01                	push   $0x1
+    2d1e:	e8 7d 1d 00 00       	call   4aa0 <printf>
+  unlink("ff");
+    2d23:	c7 04 24 9b 55 00 00 	movl   $0x559b,(%esp)
+    2d2a:	e8 d4 1b 00 00       	call   4903 <unlink>
+  if(mkdir("dd") != 0){
+    2d2f:	c7 04 24 38 56 00 00 	movl   $0x5638,(%esp)
+    2d36:	e8 e0 1b 00 00       	call   491b <mkdir>
+    2d3b:	83 c4 10             	add    $0x10,%esp
+    2d3e:	85 c0                	test   %eax,%eax
+    2d40:	0f 85 b3 05 00 00    	jne    32f9 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2d46:	83 ec 08             	sub    $0x8,%esp
+    2d49:	68 02 02 00 00       	push   $0x202
+    2d4e:	68 71 55 00 00       	push   $0x5571
+    2d53:	e8 9b 1b 00 00       	call   48f3 <open>
+  if(fd < 0){
+    2d58:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2d5b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2d5d:	85 c0                	test   %eax,%eax
+    2d5f:	0f 88 81 05 00 00    	js     32e6 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    2d65:	83 ec 04             	sub    $0x4,%esp
+    2d68:	6a 02                	push   $0x2
+    2d6a:	68 9b 55 00 00       	push   $0x559b
+    2d6f:	50                   	push   %eax
+    2d70:	e8 5e 1b 00 00       	call   48d3 <write>
+  close(fd);
+    2d75:	89 1c 24             	mov    %ebx,(%esp)
+    2d78:	e8 5e 1b 00 00       	call   48db <close>
+  if(unlink("dd") >= 0){
+    2d7d:	c7 04 24 38 56 00 00 	movl   $0x5638,(%esp)
+    2d84:	e8 7a 1b 00 00       	call   4903 <unlink>
+    2d89:	83 c4 10             	add    $0x10,%esp
+    2d8c:	85 c0                	test   %eax,%eax
+    2d8e:	0f 89 3f 05 00 00    	jns    32d3 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    2d94:	83 ec 0c             	sub    $0xc,%esp
+    2d97:	68 4c 55 00 00       	push   $0x554c
+    2d9c:	e8 7a 1b 00 00       	call   491b <mkdir>
+    2da1:	83 c4 10             	add    $0x10,%esp
+    2da4:	85 c0                	test   %eax,%eax
+    2da6:	0f 85 14 05 00 00    	jne    32c0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2dac:	83 ec 08             	sub    $0x8,%esp
+    2daf:	68 02 02 00 00       	push   $0x202
+    2db4:	68 6e 55 00 00       	push   $0x556e
+    2db9:	e8 35 1b 00 00       	call   48f3 <open>
+  if(fd < 0){
+    2dbe:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2dc1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2dc3:	85 c0                	test   %eax,%eax
+    2dc5:	0f 88 24 04 00 00    	js     31ef <subdir+0x4df>
+  write(fd, "FF", 2);
+    2dcb:	83 ec 04             	sub    $0x4,%esp
+    2dce:	6a 02                	push   $0x2
+    2dd0:	68 8f 55 00 00       	push   $0x558f
+    2dd5:	50                   	push   %eax
+    2dd6:	e8 f8 1a 00 00       	call   48d3 <write>
+  close(fd);
+    2ddb:	89 1c 24             	mov    %ebx,(%esp)
+    2dde:	e8 f8 1a 00 00       	call   48db <close>
+  fd = open("dd/dd/../ff", 0);
+    2de3:	58                   	pop    %eax
+    2de4:	5a                   	pop    %edx
+    2de5:	6a 00                	push   $0x0
+    2de7:	68 92 55 00 00       	push   $0x5592
+    2dec:	e8 02 1b 00 00       	call   48f3 <open>
+  if(fd < 0){
+    2df1:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    2df4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2df6:	85 c0                	test   %eax,%eax
+    2df8:	0f 88 de 03 00 00    	js     31dc <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    2dfe:	83 ec 04             	sub    $0x4,%esp
+    2e01:	68 00 20 00 00       	push   $0x2000
+    2e06:	68 e0 95 00 00       	push   $0x95e0
+    2e0b:	50                   	push   %eax
+    2e0c:	e8 ba 1a 00 00       	call   48cb <read>
+  if(cc != 2 || buf[0] != 'f'){
+    2e11:	83 c4 10             	add    $0x10,%esp
+    2e14:	83 f8 02             	cmp    $0x2,%eax
+    2e17:	0f 85 3a 03 00 00    	jne    3157 <subdir+0x447>
+    2e1d:	80 3d e0 95 00 00 66 	cmpb   $0x66,0x95e0
+    2e24:	0f 85 2d 03 00 00    	jne    3157 <subdir+0x447>
+  close(fd);
+    2e2a:	83 ec 0c             	sub    $0xc,%esp
+    2e2d:	53                   	push   %ebx
+    2e2e:	e8 a8 1a 00 00       	call   48db <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2e33:	59                   	pop    %ecx
+    2e34:	5b                   	pop    %ebx
+    2e35:	68 d2 55 00 00       	push   $0x55d2
+    2e3a:	68 6e 55 00 00       	push   $0x556e
+    2e3f:	e8 cf 1a 00 00       	call   4913 <link>
+    2e44:	83 c4 10             	add    $0x10,%esp
+    2e47:	85 c0                	test   %eax,%eax
+    2e49:	0f 85 c6 03 00 00    	jne    3215 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    2e4f:	83 ec 0c             	sub    $0xc,%esp
+    2e52:	68 6e 55 00 00       	push   $0x556e
+    2e57:	e8 a7 1a 00 00       	call   4903 <unlink>
+    2e5c:	83 c4 10             	add    $0x10,%esp
+    2e5f:	85 c0                	test   %eax,%eax
+    2e61:	0f 85 16 03 00 00    	jne    317d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2e67:	83 ec 08             	sub    $0x8,%esp
+    2e6a:	6a 00                	push   $0x0
+    2e6c:	68 6e 55 00 00       	push   $0x556e
+    2e71:	e8 7d 1a 00 00       	call   48f3 <open>
+    2e76:	83 c4 10             	add    $0x10,%esp
+    2e79:	85 c0                	test   %eax,%eax
+    2e7b:	0f 89 2c 04 00 00    	jns    32ad <subdir+0x59d>
+  if(chdir("dd") != 0){
+    2e81:	83 ec 0c             	sub    $0xc,%esp
+    2e84:	68 38 56 00 00       	push   $0x5638
+    2e89:	e8 95 1a 00 00       	call   4923 <chdir>
+    2e8e:	83 c4 10             	add    $0x10,%esp
+    2e91:	85 c0                	test   %eax,%eax
+    2e93:	0f 85 01 04 00 00    	jne    329a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    2e99:	83 ec 0c             	sub    $0xc,%esp
+    2e9c:	68 06 56 00 00       	push   $0x5606
+    2ea1:	e8 7d 1a 00 00       	call   4923 <chdir>
+    2ea6:	83 c4 10             	add    $0x10,%esp
+    2ea9:	85 c0                	test   %eax,%eax
+    2eab:	0f 85 b9 02 00 00    	jne    316a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    2eb1:	83 ec 0c             	sub    $0xc,%esp
+    2eb4:	68 2c 56 00 00       	push   $0x562c
+    2eb9:	e8 65 1a 00 00       	call   4923 <chdir>
+    2ebe:	83 c4 10             	add    $0x10,%esp
+    2ec1:	85 c0                	test   %eax,%eax
+    2ec3:	0f 85 a1 02 00 00    	jne    316a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    2ec9:	83 ec 0c             	sub    $0xc,%esp
+    2ecc:	68 3b 56 00 00       	push   $0x563b
+    2ed1:	e8 4d 1a 00 00       	call   4923 <chdir>
+    2ed6:	83 c4 10             	add    $0x10,%esp
+    2ed9:	85 c0                	test   %eax,%eax
+    2edb:	0f 85 21 03 00 00    	jne    3202 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    2ee1:	83 ec 08             	sub    $0x8,%esp
+    2ee4:	6a 00                	push   $0x0
+    2ee6:	68 d2 55 00 00       	push   $0x55d2
+    2eeb:	e8 03 1a 00 00       	call   48f3 <open>
+  if(fd < 0){
+    2ef0:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    2ef3:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2ef5:	85 c0                	test   %eax,%eax
+    2ef7:	0f 88 e0 04 00 00    	js     33dd <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    2efd:	83 ec 04             	sub    $0x4,%esp
+    2f00:	68 00 20 00 00       	push   $0x2000
+    2f05:	68 e0 95 00 00       	push   $0x95e0
+    2f0a:	50                   	push   %eax
+    2f0b:	e8 bb 19 00 00       	call   48cb <read>
+    2f10:	83 c4 10             	add    $0x10,%esp
+    2f13:	83 f8 02             	cmp    $0x2,%eax
+    2f16:	0f 85 ae 04 00 00    	jne    33ca <subdir+0x6ba>
+  close(fd);
+    2f1c:	83 ec 0c             	sub    $0xc,%esp
+    2f1f:	53                   	push   %ebx
+    2f20:	e8 b6 19 00 00       	call   48db <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2f25:	58                   	pop    %eax
+    2f26:	5a                   	pop    %edx
+    2f27:	6a 00                	push   $0x0
+    2f29:	68 6e 55 00 00       	push   $0x556e
+    2f2e:	e8 c0 19 00 00       	call   48f3 <open>
+    2f33:	83 c4 10             	add    $0x10,%esp
+    2f36:	85 c0                	test   %eax,%eax
+    2f38:	0f 89 65 02 00 00    	jns    31a3 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    2f3e:	83 ec 08             	sub    $0x8,%esp
+    2f41:	68 02 02 00 00       	push   $0x202
+    2f46:	68 86 56 00 00       	push   $0x5686
+    2f4b:	e8 a3 19 00 00       	call   48f3 <open>
+    2f50:	83 c4 10             	add    $0x10,%esp
+    2f53:	85 c0                	test   %eax,%eax
+    2f55:	0f 89 35 02 00 00    	jns    3190 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    2f5b:	83 ec 08             	sub    $0x8,%esp
+    2f5e:	68 02 02 00 00       	push   $0x202
+    2f63:	68 ab 56 00 00       	push   $0x56ab
+    2f68:	e8 86 19 00 00       	call   48f3 <open>
+    2f6d:	83 c4 10             	add    $0x10,%esp
+    2f70:	85 c0                	test   %eax,%eax
+    2f72:	0f 89 0f 03 00 00    	jns    3287 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2f78:	83 ec 08             	sub    $0x8,%esp
+    2f7b:	68 00 02 00 00       	push   $0x200
+    2f80:	68 38 56 00 00       	push   $0x5638
+    2f85:	e8 69 19 00 00       	call   48f3 <open>
+    2f8a:	83 c4 10             	add    $0x10,%esp
+    2f8d:	85 c0                	test   %eax,%eax
+    2f8f:	0f 89 df 02 00 00    	jns    3274 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    2f95:	83 ec 08             	sub    $0x8,%esp
+    2f98:	6a 02                	push   $0x2
+    2f9a:	68 38 56 00 00       	push   $0x5638
+    2f9f:	e8 4f 19 00 00       	call   48f3 <open>
+    2fa4:	83 c4 10             	add    $0x10,%esp
+    2fa7:	85 c0                	test   %eax,%eax
+    2fa9:	0f 89 b2 02 00 00    	jns    3261 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    2faf:	83 ec 08             	sub    $0x8,%esp
+    2fb2:	6a 01                	push   $0x1
+    2fb4:	68 38 56 00 00       	push   $0x5638
+    2fb9:	e8 35 19 00 00       	call   48f3 <open>
+    2fbe:	83 c4 10             	add    $0x10,%esp
+    2fc1:	85 c0                	test   %eax,%eax
+    2fc3:	0f 89 85 02 00 00    	jns    324e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2fc9:	83 ec 08             	sub    $0x8,%esp
+    2fcc:	68 1a 57 00 00       	push   $0x571a
+    2fd1:	68 86 56 00 00       	push   $0x5686
+    2fd6:	e8 38 19 00 00       	call   4913 <link>
+    2fdb:	83 c4 10             	add    $0x10,%esp
+    2fde:	85 c0                	test   %eax,%eax
+    2fe0:	0f 84 55 02 00 00    	je     323b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2fe6:	83 ec 08             	sub    $0x8,%esp
+    2fe9:	68 1a 57 00 00       	push   $0x571a
+    2fee:	68 ab 56 00 00       	push   $0x56ab
+    2ff3:	e8 1b 19 00 00       	call   4913 <link>
+    2ff8:	83 c4 10             	add    $0x10,%esp
+    2ffb:	85 c0                	test   %eax,%eax
+    2ffd:	0f 84 25 02 00 00    	je     3228 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    3003:	83 ec 08             	sub    $0x8,%esp
+    3006:	68 d2 55 00 00       	push   $0x55d2
+    300b:	68 71 55 00 00       	push   $0x5571
+    3010:	e8 fe 18 00 00       	call   4913 <link>
+    3015:	83 c4 10             	add    $0x10,%esp
+    3018:	85 c0                	test   %eax,%eax
+    301a:	0f 84 a9 01 00 00    	je     31c9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    3020:	83 ec 0c             	sub    $0xc,%esp
+    3023:	68 86 56 00 00       	push   $0x5686
+    3028:	e8 ee 18 00 00       	call   491b <mkdir>
+    302d:	83 c4 10             	add    $0x10,%esp
+    3030:	85 c0                	test   %eax,%eax
+    3032:	0f 84 7e 01 00 00    	je     31b6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    3038:	83 ec 0c             	sub    $0xc,%esp
+    303b:	68 ab 56 00 00       	push   $0x56ab
+    3040:	e8 d6 18 00 00       	call   491b <mkdir>
+    3045:	83 c4 10             	add    $0x10,%esp
+    3048:	85 c0                	test   %eax,%eax
+    304a:	0f 84 67 03 00 00    	je     33b7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    3050:	83 ec 0c             	sub    $0xc,%esp
+    3053:	68 d2 55 00 00       	push   $0x55d2
+    3058:	e8 be 18 00 00       	call   491b <mkdir>
+    305d:	83 c4 10             	add    $0x10,%esp
+    3060:	85 c0                	test   %eax,%eax
+    3062:	0f 84 3c 03 00 00    	je     33a4 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    3068:	83 ec 0c             	sub    $0xc,%esp
+    306b:	68 ab 56 00 00       	push   $0x56ab
+    3070:	e8 8e 18 00 00       	call   4903 <unlink>
+    3075:	83 c4 10             	add    $0x10,%esp
+    3078:	85 c0                	test   %eax,%eax
+    307a:	0f 84 11 03 00 00    	je     3391 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    3080:	83 ec 0c             	sub    $0xc,%esp
+    3083:	68 86 56 00 00       	push   $0x5686
+    3088:	e8 76 18 00 00       	call   4903 <unlink>
+    308d:	83 c4 10             	add    $0x10,%esp
+    3090:	85 c0                	test   %eax,%eax
+    3092:	0f 84 e6 02 00 00    	je     337e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    3098:	83 ec 0c             	sub    $0xc,%esp
+    309b:	68 71 55 00 00       	push   $0x5571
+    30a0:	e8 7e 18 00 00       	call   4923 <chdir>
+    30a5:	83 c4 10             	add    $0x10,%esp
+    30a8:	85 c0                	test   %eax,%eax
+    30aa:	0f 84 bb 02 00 00    	je     336b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    30b0:	83 ec 0c             	sub    $0xc,%esp
+    30b3:	68 1d 57 00 00       	push   $0x571d
+    30b8:	e8 66 18 00 00       	call   4923 <chdir>
+    30bd:	83 c4 10             	add    $0x10,%esp
+    30c0:	85 c0                	test   %eax,%eax
+    30c2:	0f 84 90 02 00 00    	je     3358 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    30c8:	83 ec 0c             	sub    $0xc,%esp
+    30cb:	68 d2 55 00 00       	push   $0x55d2
+    30d0:	e8 2e 18 00 00       	call   4903 <unlink>
+    30d5:	83 c4 10             	add    $0x10,%esp
+    30d8:	85 c0                	test   %eax,%eax
+    30da:	0f 85 9d 00 00 00    	jne    317d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    30e0:	83 ec 0c             	sub    $0xc,%esp
+    30e3:	68 71 55 00 00       	push   $0x5571
+    30e8:	e8 16 18 00 00       	call   4903 <unlink>
+    30ed:	83 c4 10             	add    $0x10,%esp
+    30f0:	85 c0                	test   %eax,%eax
+    30f2:	0f 85 4d 02 00 00    	jne    3345 <subdir+0x635>
+  if(unlink("dd") == 0){
+    30f8:	83 ec 0c             	sub    $0xc,%esp
+    30fb:	68 38 56 00 00       	push   $0x5638
+    3100:	e8 fe 17 00 00       	call   4903 <unlink>
+    3105:	83 c4 10             	add    $0x10,%esp
+    3108:	85 c0                	test   %eax,%eax
+    310a:	0f 84 22 02 00 00    	je     3332 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    3110:	83 ec 0c             	sub    $0xc,%esp
+    3113:	68 4d 55 00 00       	push   $0x554d
+    3118:	e8 e6 17 00 00       	call   4903 <unlink>
+    311d:	83 c4 10             	add    $0x10,%esp
+    3120:	85 c0                	test   %eax,%eax
+    3122:	0f 88 f7 01 00 00    	js     331f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    3128:	83 ec 0c             	sub    $0xc,%esp
+    312b:	68 38 56 00 00       	push   $0x5638
+    3130:	e8 ce 17 00 00       	call   4903 <unlink>
+    3135:	83 c4 10             	add    $0x10,%esp
+    3138:	85 c0                	test   %eax,%eax
+    313a:	0f 88 cc 01 00 00    	js     330c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    3140:	83 ec 08             	sub    $0x8,%esp
+    3143:	68 1a 58 00 00       	push   $0x581a
+    3148:	6a 01                	push   $0x1
+    314a:	e8 51 19 00 00       	call   4aa0 <printf>
+}
+    314f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3152:	83 c4 10             	add    $0x10,%esp
+    3155:	c9                   	leave
+    3156:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    3157:	50                   	push   %eax
+    3158:	50                   	push   %eax
+    3159:	68 b7 55 00 00       	push   $0x55b7
+    315e:	6a 01                	push   $0x1
+    3160:	e8 3b 19 00 00       	call   4aa0 <printf>
+    exit();
+    3165:	e8 49 17 00 00       	call   48b3 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    316a:	50                   	push   %eax
+    316b:	50                   	push   %eax
+    316c:	68 12 56 00 00       	push   $0x5612
+    3171:	6a 01                	push   $0x1
+    3173:	e8 28 19 00 00       	call   4aa0 <printf>
+    exit();
+    3178:	e8 36 17 00 00       	call   48b3 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    317d:	50                   	push   %eax
+    317e:	50                   	push   %eax
+    317f:	68 dd 55 00 00       	push   $0x55dd
+    3184:	6a 01                	push   $0x1
+    3186:	e8 15 19 00 00       	call   4aa0 <printf>
+    exit();
+    318b:	e8 23 17 00 00       	call   48b3 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    3190:	51                   	push   %ecx
+    3191:	51                   	push   %ecx
+    3192:	68 8f 56 00 00       	push   $0x568f
+    3197:	6a 01                	push   $0x1
+    3199:	e8 02 19 00 00       	call   4aa0 <printf>
+    exit();
+    319e:	e8 10 17 00 00       	call   48b3 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    31a3:	53                   	push   %ebx
+    31a4:	53                   	push   %ebx
+    31a5:	68 74 60 00 00       	push   $0x6074
+    31aa:	6a 01                	push   $0x1
+    31ac:	e8 ef 18 00 00       	call   4aa0 <printf>
+    exit();
+    31b1:	e8 fd 16 00 00       	call   48b3 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    31b6:	51                   	push   %ecx
+    31b7:	51                   	push   %ecx
+    31b8:	68 23 57 00 00       	push   $0x5723
+    31bd:	6a 01                	push   $0x1
+    31bf:	e8 dc 18 00 00       	call   4aa0 <printf>
+    exit();
+    31c4:	e8 ea 16 00 00       	call   48b3 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    31c9:	53                   	push   %ebx
+    31ca:	53                   	push   %ebx
+    31cb:	68 e4 60 00 00       	push   $0x60e4
+    31d0:	6a 01                	push   $0x1
+    31d2:	e8 c9 18 00 00       	call   4aa0 <printf>
+    exit();
+    31d7:	e8 d7 16 00 00       	call   48b3 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    31dc:	50                   	push   %eax
+    31dd:	50                   	push   %eax
+    31de:	68 9e 55 00 00       	push   $0x559e
+    31e3:	6a 01                	push   $0x1
+    31e5:	e8 b6 18 00 00       	call   4aa0 <printf>
+    exit();
+    31ea:	e8 c4 16 00 00       	call   48b3 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    31ef:	51                   	push   %ecx
+    31f0:	51                   	push   %ecx
+    31f1:	68 77 55 00 00       	push   $0x5577
+    31f6:	6a 01                	push   $0x1
+    31f8:	e8 a3 18 00 00       	call   4aa0 <printf>
+    exit();
+    31fd:	e8 b1 16 00 00       	call   48b3 <exit>
+    printf(1, "chdir ./.. failed\n");
+    3202:	50                   	push   %eax
+    3203:	50                   	push   %eax
+    3204:	68 40 56 00 00       	push   $0x5640
+    3209:	6a 01                	push   $0x1
+    320b:	e8 90 18 00 00       	call   4aa0 <printf>
+    exit();
+    3210:	e8 9e 16 00 00       	call   48b3 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    3215:	52                   	push   %edx
+    3216:	52                   	push   %edx
+    3217:	68 2c 60 00 00       	push   $0x602c
+    321c:	6a 01                	push   $0x1
+    321e:	e8 7d 18 00 00       	call   4aa0 <printf>
+    exit();
+    3223:	e8 8b 16 00 00       	call   48b3 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    3228:	50                   	push   %eax
+    3229:	50                   	push   %eax
+    322a:	68 c0 60 00 00       	push   $0x60c0
+    322f:	6a 01                	push   $0x1
+    3231:	e8 6a 18 00 00       	call   4aa0 <printf>
+    exit();
+    3236:	e8 78 16 00 00       	call   48b3 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    323b:	50                   	push   %eax
+    323c:	50                   	push   %eax
+    323d:	68 9c 60 00 00       	push   $0x609c
+    3242:	6a 01                	push   $0x1
+    3244:	e8 57 18 00 00       	call   4aa0 <printf>
+    exit();
+    3249:	e8 65 16 00 00       	call   48b3 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    324e:	50                   	push   %eax
+    324f:	50                   	push   %eax
+    3250:	68 ff 56 00 00       	push   $0x56ff
+    3255:	6a 01                	push   $0x1
+    3257:	e8 44 18 00 00       	call   4aa0 <printf>
+    exit();
+    325c:	e8 52 16 00 00       	call   48b3 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    3261:	50                   	push   %eax
+    3262:	50                   	push   %eax
+    3263:	68 e6 56 00 00       	push   $0x56e6
+    3268:	6a 01                	push   $0x1
+    326a:	e8 31 18 00 00       	call   4aa0 <printf>
+    exit();
+    326f:	e8 3f 16 00 00       	call   48b3 <exit>
+    printf(1, "create dd succeeded!\n");
+    3274:	50                   	push   %eax
+    3275:	50                   	push   %eax
+    3276:	68 d0 56 00 00       	push   $0x56d0
+    327b:	6a 01                	push   $0x1
+    327d:	e8 1e 18 00 00       	call   4aa0 <printf>
+    exit();
+    3282:	e8 2c 16 00 00       	call   48b3 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    3287:	52                   	push   %edx
+    3288:	52                   	push   %edx
+    3289:	68 b4 56 00 00       	push   $0x56b4
+    328e:	6a 01                	push   $0x1
+    3290:	e8 0b 18 00 00       	call   4aa0 <printf>
+    exit();
+    3295:	e8 19 16 00 00       	call   48b3 <exit>
+    printf(1, "chdir dd failed\n");
+    329a:	50                   	push   %eax
+    329b:	50                   	push   %eax
+    329c:	68 f5 55 00 00       	push   $0x55f5
+    32a1:	6a 01                	push   $0x1
+    32a3:	e8 f8 17 00 00       	call   4aa0 <printf>
+    exit();
+    32a8:	e8 06 16 00 00       	call   48b3 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    32ad:	50                   	push   %eax
+    32ae:	50                   	push   %eax
+    32af:	68 50 60 00 00       	push   $0x6050
+    32b4:	6a 01                	push   $0x1
+    32b6:	e8 e5 17 00 00       	call   4aa0 <printf>
+    exit();
+    32bb:	e8 f3 15 00 00       	call   48b3 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    32c0:	53                   	push   %ebx
+    32c1:	53                   	push   %ebx
+    32c2:	68 53 55 00 00       	push   $0x5553
+    32c7:	6a 01                	push   $0x1
+    32c9:	e8 d2 17 00 00       	call   4aa0 <printf>
+    exit();
+    32ce:	e8 e0 15 00 00       	call   48b3 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    32d3:	50                   	push   %eax
+    32d4:	50                   	push   %eax
+    32d5:	68 04 60 00 00       	push   $0x6004
+    32da:	6a 01                	push   $0x1
+    32dc:	e8 bf 17 00 00       	call   4aa0 <printf>
+    exit();
+    32e1:	e8 cd 15 00 00       	call   48b3 <exit>
+    printf(1, "create dd/ff failed\n");
+    32e6:	50                   	push   %eax
+    32e7:	50                   	push   %eax
+    32e8:	68 37 55 00 00       	push   $0x5537
+    32ed:	6a 01                	push   $0x1
+    32ef:	e8 ac 17 00 00       	call   4aa0 <printf>
+    exit();
+    32f4:	e8 ba 15 00 00       	call   48b3 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    32f9:	50                   	push   %eax
+    32fa:	50                   	push   %eax
+    32fb:	68 1f 55 00 00       	push   $0x551f
+    3300:	6a 01                	push   $0x1
+    3302:	e8 99 17 00 00       	call   4aa0 <printf>
+    exit();
+    3307:	e8 a7 15 00 00       	call   48b3 <exit>
+    printf(1, "unlink dd failed\n");
+    330c:	50                   	push   %eax
+    330d:	50                   	push   %eax
+    330e:	68 08 58 00 00       	push   $0x5808
+    3313:	6a 01                	push   $0x1
+    3315:	e8 86 17 00 00       	call   4aa0 <printf>
+    exit();
+    331a:	e8 94 15 00 00       	call   48b3 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    331f:	52                   	push   %edx
+    3320:	52                   	push   %edx
+    3321:	68 f3 57 00 00       	push   $0x57f3
+    3326:	6a 01                	push   $0x1
+    3328:	e8 73 17 00 00       	call   4aa0 <printf>
+    exit();
+    332d:	e8 81 15 00 00       	call   48b3 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    3332:	51                   	push   %ecx
+    3333:	51                   	push   %ecx
+    3334:	68 08 61 00 00       	push   $0x6108
+    3339:	6a 01                	push   $0x1
+    333b:	e8 60 17 00 00       	call   4aa0 <printf>
+    exit();
+    3340:	e8 6e 15 00 00       	call   48b3 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    3345:	53                   	push   %ebx
+    3346:	53                   	push   %ebx
+    3347:	68 de 57 00 00       	push   $0x57de
+    334c:	6a 01                	push   $0x1
+    334e:	e8 4d 17 00 00       	call   4aa0 <printf>
+    exit();
+    3353:	e8 5b 15 00 00       	call   48b3 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    3358:	50                   	push   %eax
+    3359:	50                   	push   %eax
+    335a:	68 c6 57 00 00       	push   $0x57c6
+    335f:	6a 01                	push   $0x1
+    3361:	e8 3a 17 00 00       	call   4aa0 <printf>
+    exit();
+    3366:	e8 48 15 00 00       	call   48b3 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    336b:	50                   	push   %eax
+    336c:	50                   	push   %eax
+    336d:	68 ae 57 00 00       	push   $0x57ae
+    3372:	6a 01                	push   $0x1
+    3374:	e8 27 17 00 00       	call   4aa0 <printf>
+    exit();
+    3379:	e8 35 15 00 00       	call   48b3 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    337e:	50                   	push   %eax
+    337f:	50                   	push   %eax
+    3380:	68 92 57 00 00       	push   $0x5792
+    3385:	6a 01                	push   $0x1
+    3387:	e8 14 17 00 00       	call   4aa0 <printf>
+    exit();
+    338c:	e8 22 15 00 00       	call   48b3 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    3391:	50                   	push   %eax
+    3392:	50                   	push   %eax
+    3393:	68 76 57 00 00       	push   $0x5776
+    3398:	6a 01                	push   $0x1
+    339a:	e8 01 17 00 00       	call   4aa0 <printf>
+    exit();
+    339f:	e8 0f 15 00 00       	call   48b3 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    33a4:	50                   	push   %eax
+    33a5:	50                   	push   %eax
+    33a6:	68 59 57 00 00       	push   $0x5759
+    33ab:	6a 01                	push   $0x1
+    33ad:	e8 ee 16 00 00       	call   4aa0 <printf>
+    exit();
+    33b2:	e8 fc 14 00 00       	call   48b3 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    33b7:	52                   	push   %edx
+    33b8:	52                   	push   %edx
+    33b9:	68 3e 57 00 00       	push   $0x573e
+    33be:	6a 01                	push   $0x1
+    33c0:	e8 db 16 00 00       	call   4aa0 <printf>
+    exit();
+    33c5:	e8 e9 14 00 00       	call   48b3 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    33ca:	51                   	push   %ecx
+    33cb:	51                   	push   %ecx
+    33cc:	68 6b 56 00 00       	push   $0x566b
+    33d1:	6a 01                	push   $0x1
+    33d3:	e8 c8 16 00 00       	call   4aa0 <printf>
+    exit();
+    33d8:	e8 d6 14 00 00       	call   48b3 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    33dd:	53                   	push   %ebx
+    33de:	53                   	push   %ebx
+    33df:	68 53 56 00 00       	push   $0x5653
+    33e4:	6a 01                	push   $0x1
+    33e6:	e8 b5 16 00 00       	call   4aa0 <printf>
+    exit();
+    33eb:	e8 c3 14 00 00       	call   48b3 <exit>
+
+000033f0 <bigwrite>:
+{
+    33f0:	55                   	push   %ebp
+    33f1:	89 e5                	mov    %esp,%ebp
+    33f3:	56                   	push   %esi
+    33f4:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    33f5:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    33fa:	83 ec 08             	sub    $0x8,%esp
+    33fd:	68 25 58 00 00       	push   $0x5825
+    3402:	6a 01                	push   $0x1
+    3404:	e8 97 16 00 00       	call   4aa0 <printf>
+  unlink("bigwrite");
+    3409:	c7 04 24 34 58 00 00 	movl   $0x5834,(%esp)
+    3410:	e8 ee 14 00 00       	call   4903 <unlink>
+    3415:	83 c4 10             	add    $0x10,%esp
+    3418:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    341f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    3420:	83 ec 08             	sub    $0x8,%esp
+    3423:	68 02 02 00 00       	push   $0x202
+    3428:	68 34 58 00 00       	push   $0x5834
+    342d:	e8 c1 14 00 00       	call   48f3 <open>
+    if(fd < 0){
+    3432:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    3435:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    3437:	85 c0                	test   %eax,%eax
+    3439:	78 7e                	js     34b9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    343b:	83 ec 04             	sub    $0x4,%esp
+    343e:	53                   	push   %ebx
+    343f:	68 e0 95 00 00       	push   $0x95e0
+    3444:	50                   	push   %eax
+    3445:	e8 89 14 00 00       	call   48d3 <write>
+      if(cc != sz){
+    344a:	83 c4 10             	add    $0x10,%esp
+    344d:	39 d8                	cmp    %ebx,%eax
+    344f:	75 55                	jne    34a6 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    3451:	83 ec 04             	sub    $0x4,%esp
+    3454:	53                   	push   %ebx
+    3455:	68 e0 95 00 00       	push   $0x95e0
+    345a:	56                   	push   %esi
+    345b:	e8 73 14 00 00       	call   48d3 <write>
+      if(cc != sz){
+    3460:	83 c4 10             	add    $0x10,%esp
+    3463:	39 c3                	cmp    %eax,%ebx
+    3465:	75 3f                	jne    34a6 <bigwrite+0xb6>
+    close(fd);
+    3467:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    346a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    3470:	56                   	push   %esi
+    3471:	e8 65 14 00 00       	call   48db <close>
+    unlink("bigwrite");
+    3476:	c7 04 24 34 58 00 00 	movl   $0x5834,(%esp)
+    347d:	e8 81 14 00 00       	call   4903 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    3482:	83 c4 10             	add    $0x10,%esp
+    3485:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    348b:	75 93                	jne    3420 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    348d:	83 ec 08             	sub    $0x8,%esp
+    3490:	68 67 58 00 00       	push   $0x5867
+    3495:	6a 01                	push   $0x1
+    3497:	e8 04 16 00 00       	call   4aa0 <printf>
+}
+    349c:	83 c4 10             	add    $0x10,%esp
+    349f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    34a2:	5b                   	pop    %ebx
+    34a3:	5e                   	pop    %esi
+    34a4:	5d                   	pop    %ebp
+    34a5:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    34a6:	50                   	push   %eax
+    34a7:	53                   	push   %ebx
+    34a8:	68 55 58 00 00       	push   $0x5855
+    34ad:	6a 01                	push   $0x1
+    34af:	e8 ec 15 00 00       	call   4aa0 <printf>
+        exit();
+    34b4:	e8 fa 13 00 00       	call   48b3 <exit>
+      printf(1, "cannot create bigwrite\n");
+    34b9:	83 ec 08             	sub    $0x8,%esp
+    34bc:	68 3d 58 00 00       	push   $0x583d
+    34c1:	6a 01                	push   $0x1
+    34c3:	e8 d8 15 00 00       	call   4aa0 <printf>
+      exit();
+    34c8:	e8 e6 13 00 00       	call   48b3 <exit>
+    34cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000034d0 <bigfile>:
+{
+    34d0:	55                   	push   %ebp
+    34d1:	89 e5                	mov    %esp,%ebp
+    34d3:	57                   	push   %edi
+    34d4:	56                   	push   %esi
+    34d5:	53                   	push   %ebx
+    34d6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    34d9:	68 74 58 00 00       	push   $0x5874
+    34de:	6a 01                	push   $0x1
+    34e0:	e8 bb 15 00 00       	call   4aa0 <printf>
+  unlink("bigfile");
+    34e5:	c7 04 24 90 58 00 00 	movl   $0x5890,(%esp)
+    34ec:	e8 12 14 00 00       	call   4903 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    34f1:	58                   	pop    %eax
+    34f2:	5a                   	pop    %edx
+    34f3:	68 02 02 00 00       	push   $0x202
+    34f8:	68 90 58 00 00       	push   $0x5890
+    34fd:	e8 f1 13 00 00       	call   48f3 <open>
+  if(fd < 0){
+    3502:	83 c4 10             	add    $0x10,%esp
+    3505:	85 c0                	test   %eax,%eax
+    3507:	0f 88 5e 01 00 00    	js     366b <bigfile+0x19b>
+    350d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    350f:	31 db                	xor    %ebx,%ebx
+    3511:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    3518:	83 ec 04             	sub    $0x4,%esp
+    351b:	68 58 02 00 00       	push   $0x258
+    3520:	53                   	push   %ebx
+    3521:	68 e0 95 00 00       	push   $0x95e0
+    3526:	e8 05 12 00 00       	call   4730 <memset>
+    if(write(fd, buf, 600) != 600){
+    352b:	83 c4 0c             	add    $0xc,%esp
+    352e:	68 58 02 00 00       	push   $0x258
+    3533:	68 e0 95 00 00       	push   $0x95e0
+    3538:	56                   	push   %esi
+    3539:	e8 95 13 00 00       	call   48d3 <write>
+    353e:	83 c4 10             	add    $0x10,%esp
+    3541:	3d 58 02 00 00       	cmp    $0x258,%eax
+    3546:	0f 85 f8 00 00 00    	jne    3644 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    354c:	83 c3 01             	add    $0x1,%ebx
+    354f:	83 fb 14             	cmp    $0x14,%ebx
+    3552:	75 c4                	jne    3518 <bigfile+0x48>
+  close(fd);
+    3554:	83 ec 0c             	sub    $0xc,%esp
+    3557:	56                   	push   %esi
+    3558:	e8 7e 13 00 00       	call   48db <close>
+  fd = open("bigfile", 0);
+    355d:	5e                   	pop    %esi
+    355e:	5f                   	pop    %edi
+    355f:	6a 00                	push   $0x0
+    3561:	68 90 58 00 00       	push   $0x5890
+    3566:	e8 88 13 00 00       	call   48f3 <open>
+  if(fd < 0){
+    356b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    356e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    3570:	85 c0                	test   %eax,%eax
+    3572:	0f 88 e0 00 00 00    	js     3658 <bigfile+0x188>
+  total = 0;
+    3578:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    357a:	31 ff                	xor    %edi,%edi
+    357c:	eb 30                	jmp    35ae <bigfile+0xde>
+    357e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    3580:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    3585:	0f 85 91 00 00 00    	jne    361c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    358b:	89 fa                	mov    %edi,%edx
+    358d:	0f be 05 e0 95 00 00 	movsbl 0x95e0,%eax
+    3594:	d1 fa                	sar    %edx
+    3596:	39 d0                	cmp    %edx,%eax
+    3598:	75 6e                	jne    3608 <bigfile+0x138>
+    359a:	0f be 15 0b 97 00 00 	movsbl 0x970b,%edx
+    35a1:	39 d0                	cmp    %edx,%eax
+    35a3:	75 63                	jne    3608 <bigfile+0x138>
+    total += cc;
+    35a5:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    35ab:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    35ae:	83 ec 04             	sub    $0x4,%esp
+    35b1:	68 2c 01 00 00       	push   $0x12c
+    35b6:	68 e0 95 00 00       	push   $0x95e0
+    35bb:	56                   	push   %esi
+    35bc:	e8 0a 13 00 00       	call   48cb <read>
+    if(cc < 0){
+    35c1:	83 c4 10             	add    $0x10,%esp
+    35c4:	85 c0                	test   %eax,%eax
+    35c6:	78 68                	js     3630 <bigfile+0x160>
+    if(cc == 0)
+    35c8:	75 b6                	jne    3580 <bigfile+0xb0>
+  close(fd);
+    35ca:	83 ec 0c             	sub    $0xc,%esp
+    35cd:	56                   	push   %esi
+    35ce:	e8 08 13 00 00       	call   48db <close>
+  if(total != 20*600){
+    35d3:	83 c4 10             	add    $0x10,%esp
+    35d6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    35dc:	0f 85 9c 00 00 00    	jne    367e <bigfile+0x1ae>
+  unlink("bigfile");
+    35e2:	83 ec 0c             	sub    $0xc,%esp
+    35e5:	68 90 58 00 00       	push   $0x5890
+    35ea:	e8 14 13 00 00       	call   4903 <unlink>
+  printf(1, "bigfile test ok\n");
+    35ef:	58                   	pop    %eax
+    35f0:	5a                   	pop    %edx
+    35f1:	68 1f 59 00 00       	push   $0x591f
+    35f6:	6a 01                	push   $0x1
+    35f8:	e8 a3 14 00 00       	call   4aa0 <printf>
+}
+    35fd:	83 c4 10             	add    $0x10,%esp
+    3600:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3603:	5b                   	pop    %ebx
+    3604:	5e                   	pop    %esi
+    3605:	5f                   	pop    %edi
+    3606:	5d                   	pop    %ebp
+    3607:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    3608:	83 ec 08             	sub    $0x8,%esp
+    360b:	68 ec 58 00 00       	push   $0x58ec
+    3610:	6a 01                	push   $0x1
+    3612:	e8 89 14 00 00       	call   4aa0 <printf>
+      exit();
+    3617:	e8 97 12 00 00       	call   48b3 <exit>
+      printf(1, "short read bigfile\n");
+    361c:	83 ec 08             	sub    $0x8,%esp
+    361f:	68 d8 58 00 00       	push   $0x58d8
+    3624:	6a 01                	push   $0x1
+    3626:	e8 75 14 00 00       	call   4aa0 <printf>
+      exit();
+    362b:	e8 83 12 00 00       	call   48b3 <exit>
+      printf(1, "read bigfile failed\n");
+    3630:	83 ec 08             	sub    $0x8,%esp
+    3633:	68 c3 58 00 00       	push   $0x58c3
+    3638:	6a 01                	push   $0x1
+    363a:	e8 61 14 00 00       	call   4aa0 <printf>
+      exit();
+    363f:	e8 6f 12 00 00       	call   48b3 <exit>
+      printf(1, "write bigfile failed\n");
+    3644:	83 ec 08             	sub    $0x8,%esp
+    3647:	68 98 58 00 00       	push   $0x5898
+    364c:	6a 01                	push   $0x1
+    364e:	e8 4d 14 00 00       	call   4aa0 <printf>
+      exit();
+    3653:	e8 5b 12 00 00       	call   48b3 <exit>
+    printf(1, "cannot open bigfile\n");
+    3658:	53                   	push   %ebx
+    3659:	53                   	push   %ebx
+    365a:	68 ae 58 00 00       	push   $0x58ae
+    365f:	6a 01                	push   $0x1
+    3661:	e8 3a 14 00 00       	call   4aa0 <printf>
+    exit();
+    3666:	e8 48 12 00 00       	call   48b3 <exit>
+    printf(1, "cannot create bigfile");
+    366b:	50                   	push   %eax
+    366c:	50                   	push   %eax
+    366d:	68 82 58 00 00       	push   $0x5882
+    3672:	6a 01                	push   $0x1
+    3674:	e8 27 14 00 00       	call   4aa0 <printf>
+    exit();
+    3679:	e8 35 12 00 00       	call   48b3 <exit>
+    printf(1, "read bigfile wrong total\n");
+    367e:	51                   	push   %ecx
+    367f:	51                   	push   %ecx
+    3680:	68 05 59 00 00       	push   $0x5905
+    3685:	6a 01                	push   $0x1
+    3687:	e8 14 14 00 00       	call   4aa0 <printf>
+    exit();
+    368c:	e8 22 12 00 00       	call   48b3 <exit>
+    3691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    369f:	90                   	nop
+
+000036a0 <fourteen>:
+{
+    36a0:	55                   	push   %ebp
+    36a1:	89 e5                	mov    %esp,%ebp
+    36a3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    36a6:	68 30 59 00 00       	push   $0x5930
+    36ab:	6a 01                	push   $0x1
+    36ad:	e8 ee 13 00 00       	call   4aa0 <printf>
+  if(mkdir("12345678901234") != 0){
+    36b2:	c7 04 24 6b 59 00 00 	movl   $0x596b,(%esp)
+    36b9:	e8 5d 12 00 00       	call   491b <mkdir>
+    36be:	83 c4 10             	add    $0x10,%esp
+    36c1:	85 c0                	test   %eax,%eax
+    36c3:	0f 85 97 00 00 00    	jne    3760 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    36c9:	83 ec 0c             	sub    $0xc,%esp
+    36cc:	68 28 61 00 00       	push   $0x6128
+    36d1:	e8 45 12 00 00       	call   491b <mkdir>
+    36d6:	83 c4 10             	add    $0x10,%esp
+    36d9:	85 c0                	test   %eax,%eax
+    36db:	0f 85 de 00 00 00    	jne    37bf <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    36e1:	83 ec 08             	sub    $0x8,%esp
+    36e4:	68 00 02 00 00       	push   $0x200
+    36e9:	68 78 61 00 00       	push   $0x6178
+    36ee:	e8 00 12 00 00       	call   48f3 <open>
+  if(fd < 0){
+    36f3:	83 c4 10             	add    $0x10,%esp
+    36f6:	85 c0                	test   %eax,%eax
+    36f8:	0f 88 ae 00 00 00    	js     37ac <fourteen+0x10c>
+  close(fd);
+    36fe:	83 ec 0c             	sub    $0xc,%esp
+    3701:	50                   	push   %eax
+    3702:	e8 d4 11 00 00       	call   48db <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    3707:	58                   	pop    %eax
+    3708:	5a                   	pop    %edx
+    3709:	6a 00                	push   $0x0
+    370b:	68 e8 61 00 00       	push   $0x61e8
+    3710:	e8 de 11 00 00       	call   48f3 <open>
+  if(fd < 0){
+    3715:	83 c4 10             	add    $0x10,%esp
+    3718:	85 c0                	test   %eax,%eax
+    371a:	78 7d                	js     3799 <fourteen+0xf9>
+  close(fd);
+    371c:	83 ec 0c             	sub    $0xc,%esp
+    371f:	50                   	push   %eax
+    3720:	e8 b6 11 00 00       	call   48db <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    3725:	c7 04 24 5c 59 00 00 	movl   $0x595c,(%esp)
+    372c:	e8 ea 11 00 00       	call   491b <mkdir>
+    3731:	83 c4 10             	add    $0x10,%esp
+    3734:	85 c0                	test   %eax,%eax
+    3736:	74 4e                	je     3786 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    3738:	83 ec 0c             	sub    $0xc,%esp
+    373b:	68 84 62 00 00       	push   $0x6284
+    3740:	e8 d6 11 00 00       	call   491b <mkdir>
+    3745:	83 c4 10             	add    $0x10,%esp
+    3748:	85 c0                	test   %eax,%eax
+    374a:	74 27                	je     3773 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    374c:	83 ec 08             	sub    $0x8,%esp
+    374f:	68 7a 59 00 00       	push   $0x597a
+    3754:	6a 01                	push   $0x1
+    3756:	e8 45 13 00 00       	call   4aa0 <printf>
+}
+    375b:	83 c4 10             	add    $0x10,%esp
+    375e:	c9                   	leave
+    375f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    3760:	50                   	push   %eax
+    3761:	50                   	push   %eax
+    3762:	68 3f 59 00 00       	push   $0x593f
+    3767:	6a 01                	push   $0x1
+    3769:	e8 32 13 00 00       	call   4aa0 <printf>
+    exit();
+    376e:	e8 40 11 00 00       	call   48b3 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    3773:	50                   	push   %eax
+    3774:	50                   	push   %eax
+    3775:	68 a4 62 00 00       	push   $0x62a4
+    377a:	6a 01                	push   $0x1
+    377c:	e8 1f 13 00 00       	call   4aa0 <printf>
+    exit();
+    3781:	e8 2d 11 00 00       	call   48b3 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    3786:	52                   	push   %edx
+    3787:	52                   	push   %edx
+    3788:	68 54 62 00 00       	push   $0x6254
+    378d:	6a 01                	push   $0x1
+    378f:	e8 0c 13 00 00       	call   4aa0 <printf>
+    exit();
+    3794:	e8 1a 11 00 00       	call   48b3 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    3799:	51                   	push   %ecx
+    379a:	51                   	push   %ecx
+    379b:	68 18 62 00 00       	push   $0x6218
+    37a0:	6a 01                	push   $0x1
+    37a2:	e8 f9 12 00 00       	call   4aa0 <printf>
+    exit();
+    37a7:	e8 07 11 00 00       	call   48b3 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    37ac:	51                   	push   %ecx
+    37ad:	51                   	push   %ecx
+    37ae:	68 a8 61 00 00       	push   $0x61a8
+    37b3:	6a 01                	push   $0x1
+    37b5:	e8 e6 12 00 00       	call   4aa0 <printf>
+    exit();
+    37ba:	e8 f4 10 00 00       	call   48b3 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    37bf:	50                   	push   %eax
+    37c0:	50                   	push   %eax
+    37c1:	68 48 61 00 00       	push   $0x6148
+    37c6:	6a 01                	push   $0x1
+    37c8:	e8 d3 12 00 00       	call   4aa0 <printf>
+    exit();
+    37cd:	e8 e1 10 00 00       	call   48b3 <exit>
+    37d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    37d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000037e0 <rmdot>:
+{
+    37e0:	55                   	push   %ebp
+    37e1:	89 e5                	mov    %esp,%ebp
+    37e3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    37e6:	68 87 59 00 00       	push   $0x5987
+    37eb:	6a 01                	push   $0x1
+    37ed:	e8 ae 12 00 00       	call   4aa0 <printf>
+  if(mkdir("dots") != 0){
+    37f2:	c7 04 24 93 59 00 00 	movl   $0x5993,(%esp)
+    37f9:	e8 1d 11 00 00       	call   491b <mkdir>
+    37fe:	83 c4 10             	add    $0x10,%esp
+    3801:	85 c0                	test   %eax,%eax
+    3803:	0f 85 b0 00 00 00    	jne    38b9 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    3809:	83 ec 0c             	sub    $0xc,%esp
+    380c:	68 93 59 00 00       	push   $0x5993
+    3811:	e8 0d 11 00 00       	call   4923 <chdir>
+    3816:	83 c4 10             	add    $0x10,%esp
+    3819:	85 c0                	test   %eax,%eax
+    381b:	0f 85 1d 01 00 00    	jne    393e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    3821:	83 ec 0c             	sub    $0xc,%esp
+    3824:	68 3e 56 00 00       	push   $0x563e
+    3829:	e8 d5 10 00 00       	call   4903 <unlink>
+    382e:	83 c4 10             	add    $0x10,%esp
+    3831:	85 c0                	test   %eax,%eax
+    3833:	0f 84 f2 00 00 00    	je     392b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    3839:	83 ec 0c             	sub    $0xc,%esp
+    383c:	68 3d 56 00 00       	push   $0x563d
+    3841:	e8 bd 10 00 00       	call   4903 <unlink>
+    3846:	83 c4 10             	add    $0x10,%esp
+    3849:	85 c0                	test   %eax,%eax
+    384b:	0f 84 c7 00 00 00    	je     3918 <rmdot+0x138>
+  if(chdir("/") != 0){
+    3851:	83 ec 0c             	sub    $0xc,%esp
+    3854:	68 11 4e 00 00       	push   $0x4e11
+    3859:	e8 c5 10 00 00       	call   4923 <chdir>
+    385e:	83 c4 10             	add    $0x10,%esp
+    3861:	85 c0                	test   %eax,%eax
+    3863:	0f 85 9c 00 00 00    	jne    3905 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    3869:	83 ec 0c             	sub    $0xc,%esp
+    386c:	68 db 59 00 00       	push   $0x59db
+    3871:	e8 8d 10 00 00       	call   4903 <unlink>
+    3876:	83 c4 10             	add    $0x10,%esp
+    3879:	85 c0                	test   %eax,%eax
+    387b:	74 75                	je     38f2 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    387d:	83 ec 0c             	sub    $0xc,%esp
+    3880:	68 f9 59 00 00       	push   $0x59f9
+    3885:	e8 79 10 00 00       	call   4903 <unlink>
+    388a:	83 c4 10             	add    $0x10,%esp
+    388d:	85 c0                	test   %eax,%eax
+    388f:	74 4e                	je     38df <rmdot+0xff>
+  if(unlink("dots") != 0){
+    3891:	83 ec 0c             	sub    $0xc,%esp
+    3894:	68 93 59 00 00       	push   $0x5993
+    3899:	e8 65 10 00 00       	call   4903 <unlink>
+    389e:	83 c4 10             	add    $0x10,%esp
+    38a1:	85 c0                	test   %eax,%eax
+    38a3:	75 27                	jne    38cc <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    38a5:	83 ec 08             	sub    $0x8,%esp
+    38a8:	68 2e 5a 00 00       	push   $0x5a2e
+    38ad:	6a 01                	push   $0x1
+    38af:	e8 ec 11 00 00       	call   4aa0 <printf>
+}
+    38b4:	83 c4 10             	add    $0x10,%esp
+    38b7:	c9                   	leave
+    38b8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    38b9:	50                   	push   %eax
+    38ba:	50                   	push   %eax
+    38bb:	68 98 59 00 00       	push   $0x5998
+    38c0:	6a 01                	push   $0x1
+    38c2:	e8 d9 11 00 00       	call   4aa0 <printf>
+    exit();
+    38c7:	e8 e7 0f 00 00       	call   48b3 <exit>
+    printf(1, "unlink dots failed!\n");
+    38cc:	50                   	push   %eax
+    38cd:	50                   	push   %eax
+    38ce:	68 19 5a 00 00       	push   $0x5a19
+    38d3:	6a 01                	push   $0x1
+    38d5:	e8 c6 11 00 00       	call   4aa0 <printf>
+    exit();
+    38da:	e8 d4 0f 00 00       	call   48b3 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    38df:	52                   	push   %edx
+    38e0:	52                   	push   %edx
+    38e1:	68 01 5a 00 00       	push   $0x5a01
+    38e6:	6a 01                	push   $0x1
+    38e8:	e8 b3 11 00 00       	call   4aa0 <printf>
+    exit();
+    38ed:	e8 c1 0f 00 00       	call   48b3 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    38f2:	51                   	push   %ecx
+    38f3:	51                   	push   %ecx
+    38f4:	68 e2 59 00 00       	push   $0x59e2
+    38f9:	6a 01                	push   $0x1
+    38fb:	e8 a0 11 00 00       	call   4aa0 <printf>
+    exit();
+    3900:	e8 ae 0f 00 00       	call   48b3 <exit>
+    printf(1, "chdir / failed\n");
+    3905:	50                   	push   %eax
+    3906:	50                   	push   %eax
+    3907:	68 13 4e 00 00       	push   $0x4e13
+    390c:	6a 01                	push   $0x1
+    390e:	e8 8d 11 00 00       	call   4aa0 <printf>
+    exit();
+    3913:	e8 9b 0f 00 00       	call   48b3 <exit>
+    printf(1, "rm .. worked!\n");
+    3918:	50                   	push   %eax
+    3919:	50                   	push   %eax
+    391a:	68 cc 59 00 00       	push   $0x59cc
+    391f:	6a 01                	push   $0x1
+    3921:	e8 7a 11 00 00       	call   4aa0 <printf>
+    exit();
+    3926:	e8 88 0f 00 00       	call   48b3 <exit>
+    printf(1, "rm . worked!\n");
+    392b:	50                   	push   %eax
+    392c:	50                   	push   %eax
+    392d:	68 be 59 00 00       	push   $0x59be
+    3932:	6a 01                	push   $0x1
+    3934:	e8 67 11 00 00       	call   4aa0 <printf>
+    exit();
+    3939:	e8 75 0f 00 00       	call   48b3 <exit>
+    printf(1, "chdir dots failed\n");
+    393e:	50                   	push   %eax
+    393f:	50                   	push   %eax
+    3940:	68 ab 59 00 00       	push   $0x59ab
+    3945:	6a 01                	push   $0x1
+    3947:	e8 54 11 00 00       	call   4aa0 <printf>
+    exit();
+    394c:	e8 62 0f 00 00       	call   48b3 <exit>
+    3951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    395f:	90                   	nop
+
+00003960 <dirfile>:
+{
+    3960:	55                   	push   %ebp
+    3961:	89 e5                	mov    %esp,%ebp
+    3963:	53                   	push   %ebx
+    3964:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    3967:	68 38 5a 00 00       	push   $0x5a38
+    396c:	6a 01                	push   $0x1
+    396e:	e8 2d 11 00 00       	call   4aa0 <printf>
+  fd = open("dirfile", O_CREATE);
+    3973:	5b                   	pop    %ebx
+    3974:	58                   	pop    %eax
+    3975:	68 00 02 00 00       	push   $0x200
+    397a:	68 45 5a 00 00       	push   $0x5a45
+    397f:	e8 6f 0f 00 00       	call   48f3 <open>
+  if(fd < 0){
+    3984:	83 c4 10             	add    $0x10,%esp
+    3987:	85 c0                	test   %eax,%eax
+    3989:	0f 88 43 01 00 00    	js     3ad2 <dirfile+0x172>
+  close(fd);
+    398f:	83 ec 0c             	sub    $0xc,%esp
+    3992:	50                   	push   %eax
+    3993:	e8 43 0f 00 00       	call   48db <close>
+  if(chdir("dirfile") == 0){
+    3998:	c7 04 24 45 5a 00 00 	movl   $0x5a45,(%esp)
+    399f:	e8 7f 0f 00 00       	call   4923 <chdir>
+    39a4:	83 c4 10             	add    $0x10,%esp
+    39a7:	85 c0                	test   %eax,%eax
+    39a9:	0f 84 10 01 00 00    	je     3abf <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    39af:	83 ec 08             	sub    $0x8,%esp
+    39b2:	6a 00                	push   $0x0
+    39b4:	68 7e 5a 00 00       	push   $0x5a7e
+    39b9:	e8 35 0f 00 00       	call   48f3 <open>
+  if(fd >= 0){
+    39be:	83 c4 10             	add    $0x10,%esp
+    39c1:	85 c0                	test   %eax,%eax
+    39c3:	0f 89 e3 00 00 00    	jns    3aac <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    39c9:	83 ec 08             	sub    $0x8,%esp
+    39cc:	68 00 02 00 00       	push   $0x200
+    39d1:	68 7e 5a 00 00       	push   $0x5a7e
+    39d6:	e8 18 0f 00 00       	call   48f3 <open>
+  if(fd >= 0){
+    39db:	83 c4 10             	add    $0x10,%esp
+    39de:	85 c0                	test   %eax,%eax
+    39e0:	0f 89 c6 00 00 00    	jns    3aac <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    39e6:	83 ec 0c             	sub    $0xc,%esp
+    39e9:	68 7e 5a 00 00       	push   $0x5a7e
+    39ee:	e8 28 0f 00 00       	call   491b <mkdir>
+    39f3:	83 c4 10             	add    $0x10,%esp
+    39f6:	85 c0                	test   %eax,%eax
+    39f8:	0f 84 46 01 00 00    	je     3b44 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    39fe:	83 ec 0c             	sub    $0xc,%esp
+    3a01:	68 7e 5a 00 00       	push   $0x5a7e
+    3a06:	e8 f8 0e 00 00       	call   4903 <unlink>
+    3a0b:	83 c4 10             	add    $0x10,%esp
+    3a0e:	85 c0                	test   %eax,%eax
+    3a10:	0f 84 1b 01 00 00    	je     3b31 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    3a16:	83 ec 08             	sub    $0x8,%esp
+    3a19:	68 7e 5a 00 00       	push   $0x5a7e
+    3a1e:	68 e2 5a 00 00       	push   $0x5ae2
+    3a23:	e8 eb 0e 00 00       	call   4913 <link>
+    3a28:	83 c4 10             	add    $0x10,%esp
+    3a2b:	85 c0                	test   %eax,%eax
+    3a2d:	0f 84 eb 00 00 00    	je     3b1e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    3a33:	83 ec 0c             	sub    $0xc,%esp
+    3a36:	68 45 5a 00 00       	push   $0x5a45
+    3a3b:	e8 c3 0e 00 00       	call   4903 <unlink>
+    3a40:	83 c4 10             	add    $0x10,%esp
+    3a43:	85 c0                	test   %eax,%eax
+    3a45:	0f 85 c0 00 00 00    	jne    3b0b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    3a4b:	83 ec 08             	sub    $0x8,%esp
+    3a4e:	6a 02                	push   $0x2
+    3a50:	68 3e 56 00 00       	push   $0x563e
+    3a55:	e8 99 0e 00 00       	call   48f3 <open>
+  if(fd >= 0){
+    3a5a:	83 c4 10             	add    $0x10,%esp
+    3a5d:	85 c0                	test   %eax,%eax
+    3a5f:	0f 89 93 00 00 00    	jns    3af8 <dirfile+0x198>
+  fd = open(".", 0);
+    3a65:	83 ec 08             	sub    $0x8,%esp
+    3a68:	6a 00                	push   $0x0
+    3a6a:	68 3e 56 00 00       	push   $0x563e
+    3a6f:	e8 7f 0e 00 00       	call   48f3 <open>
+  if(write(fd, "x", 1) > 0){
+    3a74:	83 c4 0c             	add    $0xc,%esp
+    3a77:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    3a79:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    3a7b:	68 21 57 00 00       	push   $0x5721
+    3a80:	50                   	push   %eax
+    3a81:	e8 4d 0e 00 00       	call   48d3 <write>
+    3a86:	83 c4 10             	add    $0x10,%esp
+    3a89:	85 c0                	test   %eax,%eax
+    3a8b:	7f 58                	jg     3ae5 <dirfile+0x185>
+  close(fd);
+    3a8d:	83 ec 0c             	sub    $0xc,%esp
+    3a90:	53                   	push   %ebx
+    3a91:	e8 45 0e 00 00       	call   48db <close>
+  printf(1, "dir vs file OK\n");
+    3a96:	58                   	pop    %eax
+    3a97:	5a                   	pop    %edx
+    3a98:	68 15 5b 00 00       	push   $0x5b15
+    3a9d:	6a 01                	push   $0x1
+    3a9f:	e8 fc 0f 00 00       	call   4aa0 <printf>
+}
+    3aa4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3aa7:	83 c4 10             	add    $0x10,%esp
+    3aaa:	c9                   	leave
+    3aab:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    3aac:	50                   	push   %eax
+    3aad:	50                   	push   %eax
+    3aae:	68 89 5a 00 00       	push   $0x5a89
+    3ab3:	6a 01                	push   $0x1
+    3ab5:	e8 e6 0f 00 00       	call   4aa0 <printf>
+    exit();
+    3aba:	e8 f4 0d 00 00       	call   48b3 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    3abf:	52                   	push   %edx
+    3ac0:	52                   	push   %edx
+    3ac1:	68 64 5a 00 00       	push   $0x5a64
+    3ac6:	6a 01                	push   $0x1
+    3ac8:	e8 d3 0f 00 00       	call   4aa0 <printf>
+    exit();
+    3acd:	e8 e1 0d 00 00       	call   48b3 <exit>
+    printf(1, "create dirfile failed\n");
+    3ad2:	51                   	push   %ecx
+    3ad3:	51                   	push   %ecx
+    3ad4:	68 4d 5a 00 00       	push   $0x5a4d
+    3ad9:	6a 01                	push   $0x1
+    3adb:	e8 c0 0f 00 00       	call   4aa0 <printf>
+    exit();
+    3ae0:	e8 ce 0d 00 00       	call   48b3 <exit>
+    printf(1, "write . succeeded!\n");
+    3ae5:	51                   	push   %ecx
+    3ae6:	51                   	push   %ecx
+    3ae7:	68 01 5b 00 00       	push   $0x5b01
+    3aec:	6a 01                	push   $0x1
+    3aee:	e8 ad 0f 00 00       	call   4aa0 <printf>
+    exit();
+    3af3:	e8 bb 0d 00 00       	call   48b3 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    3af8:	53                   	push   %ebx
+    3af9:	53                   	push   %ebx
+    3afa:	68 f8 62 00 00       	push   $0x62f8
+    3aff:	6a 01                	push   $0x1
+    3b01:	e8 9a 0f 00 00       	call   4aa0 <printf>
+    exit();
+    3b06:	e8 a8 0d 00 00       	call   48b3 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    3b0b:	50                   	push   %eax
+    3b0c:	50                   	push   %eax
+    3b0d:	68 e9 5a 00 00       	push   $0x5ae9
+    3b12:	6a 01                	push   $0x1
+    3b14:	e8 87 0f 00 00       	call   4aa0 <printf>
+    exit();
+    3b19:	e8 95 0d 00 00       	call   48b3 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    3b1e:	50                   	push   %eax
+    3b1f:	50                   	push   %eax
+    3b20:	68 d8 62 00 00       	push   $0x62d8
+    3b25:	6a 01                	push   $0x1
+    3b27:	e8 74 0f 00 00       	call   4aa0 <printf>
+    exit();
+    3b2c:	e8 82 0d 00 00       	call   48b3 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    3b31:	50                   	push   %eax
+    3b32:	50                   	push   %eax
+    3b33:	68 c4 5a 00 00       	push   $0x5ac4
+    3b38:	6a 01                	push   $0x1
+    3b3a:	e8 61 0f 00 00       	call   4aa0 <printf>
+    exit();
+    3b3f:	e8 6f 0d 00 00       	call   48b3 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    3b44:	50                   	push   %eax
+    3b45:	50                   	push   %eax
+    3b46:	68 a7 5a 00 00       	push   $0x5aa7
+    3b4b:	6a 01                	push   $0x1
+    3b4d:	e8 4e 0f 00 00       	call   4aa0 <printf>
+    exit();
+    3b52:	e8 5c 0d 00 00       	call   48b3 <exit>
+    3b57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b5e:	66 90                	xchg   %ax,%ax
+
+00003b60 <iref>:
+{
+    3b60:	55                   	push   %ebp
+    3b61:	89 e5                	mov    %esp,%ebp
+    3b63:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    3b64:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    3b69:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    3b6c:	68 25 5b 00 00       	push   $0x5b25
+    3b71:	6a 01                	push   $0x1
+    3b73:	e8 28 0f 00 00       	call   4aa0 <printf>
+    3b78:	83 c4 10             	add    $0x10,%esp
+    3b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3b7f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    3b80:	83 ec 0c             	sub    $0xc,%esp
+    3b83:	68 36 5b 00 00       	push   $0x5b36
+    3b88:	e8 8e 0d 00 00       	call   491b <mkdir>
+    3b8d:	83 c4 10             	add    $0x10,%esp
+    3b90:	85 c0                	test   %eax,%eax
+    3b92:	0f 85 bb 00 00 00    	jne    3c53 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    3b98:	83 ec 0c             	sub    $0xc,%esp
+    3b9b:	68 36 5b 00 00       	push   $0x5b36
+    3ba0:	e8 7e 0d 00 00       	call   4923 <chdir>
+    3ba5:	83 c4 10             	add    $0x10,%esp
+    3ba8:	85 c0                	test   %eax,%eax
+    3baa:	0f 85 b7 00 00 00    	jne    3c67 <iref+0x107>
+    mkdir("");
+    3bb0:	83 ec 0c             	sub    $0xc,%esp
+    3bb3:	68 eb 51 00 00       	push   $0x51eb
+    3bb8:	e8 5e 0d 00 00       	call   491b <mkdir>
+    link("README", "");
+    3bbd:	59                   	pop    %ecx
+    3bbe:	58                   	pop    %eax
+    3bbf:	68 eb 51 00 00       	push   $0x51eb
+    3bc4:	68 e2 5a 00 00       	push   $0x5ae2
+    3bc9:	e8 45 0d 00 00       	call   4913 <link>
+    fd = open("", O_CREATE);
+    3bce:	58                   	pop    %eax
+    3bcf:	5a                   	pop    %edx
+    3bd0:	68 00 02 00 00       	push   $0x200
+    3bd5:	68 eb 51 00 00       	push   $0x51eb
+    3bda:	e8 14 0d 00 00       	call   48f3 <open>
+    if(fd >= 0)
+    3bdf:	83 c4 10             	add    $0x10,%esp
+    3be2:	85 c0                	test   %eax,%eax
+    3be4:	78 0c                	js     3bf2 <iref+0x92>
+      close(fd);
+    3be6:	83 ec 0c             	sub    $0xc,%esp
+    3be9:	50                   	push   %eax
+    3bea:	e8 ec 0c 00 00       	call   48db <close>
+    3bef:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    3bf2:	83 ec 08             	sub    $0x8,%esp
+    3bf5:	68 00 02 00 00       	push   $0x200
+    3bfa:	68 20 57 00 00       	push   $0x5720
+    3bff:	e8 ef 0c 00 00       	call   48f3 <open>
+    if(fd >= 0)
+    3c04:	83 c4 10             	add    $0x10,%esp
+    3c07:	85 c0                	test   %eax,%eax
+    3c09:	78 0c                	js     3c17 <iref+0xb7>
+      close(fd);
+    3c0b:	83 ec 0c             	sub    $0xc,%esp
+    3c0e:	50                   	push   %eax
+    3c0f:	e8 c7 0c 00 00       	call   48db <close>
+    3c14:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    3c17:	83 ec 0c             	sub    $0xc,%esp
+    3c1a:	68 20 57 00 00       	push   $0x5720
+    3c1f:	e8 df 0c 00 00       	call   4903 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    3c24:	83 c4 10             	add    $0x10,%esp
+    3c27:	83 eb 01             	sub    $0x1,%ebx
+    3c2a:	0f 85 50 ff ff ff    	jne    3b80 <iref+0x20>
+  chdir("/");
+    3c30:	83 ec 0c             	sub    $0xc,%esp
+    3c33:	68 11 4e 00 00       	push   $0x4e11
+    3c38:	e8 e6 0c 00 00       	call   4923 <chdir>
+  printf(1, "empty file name OK\n");
+    3c3d:	58                   	pop    %eax
+    3c3e:	5a                   	pop    %edx
+    3c3f:	68 64 5b 00 00       	push   $0x5b64
+    3c44:	6a 01                	push   $0x1
+    3c46:	e8 55 0e 00 00       	call   4aa0 <printf>
+}
+    3c4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3c4e:	83 c4 10             	add    $0x10,%esp
+    3c51:	c9                   	leave
+    3c52:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    3c53:	83 ec 08             	sub    $0x8,%esp
+    3c56:	68 3c 5b 00 00       	push   $0x5b3c
+    3c5b:	6a 01                	push   $0x1
+    3c5d:	e8 3e 0e 00 00       	call   4aa0 <printf>
+      exit();
+    3c62:	e8 4c 0c 00 00       	call   48b3 <exit>
+      printf(1, "chdir irefd failed\n");
+    3c67:	83 ec 08             	sub    $0x8,%esp
+    3c6a:	68 50 5b 00 00       	push   $0x5b50
+    3c6f:	6a 01                	push   $0x1
+    3c71:	e8 2a 0e 00 00       	call   4aa0 <printf>
+      exit();
+    3c76:	e8 38 0c 00 00       	call   48b3 <exit>
+    3c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3c7f:	90                   	nop
+
+00003c80 <forktest>:
+{
+    3c80:	55                   	push   %ebp
+    3c81:	89 e5                	mov    %esp,%ebp
+    3c83:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    3c84:	31 db                	xor    %ebx,%ebx
+{
+    3c86:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    3c89:	68 78 5b 00 00       	push   $0x5b78
+    3c8e:	6a 01                	push   $0x1
+    3c90:	e8 0b 0e 00 00       	call   4aa0 <printf>
+    3c95:	83 c4 10             	add    $0x10,%esp
+    3c98:	eb 13                	jmp    3cad <forktest+0x2d>
+    3c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    3ca0:	74 4d                	je     3cef <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    3ca2:	83 c3 01             	add    $0x1,%ebx
+    3ca5:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    3cab:	74 6e                	je     3d1b <forktest+0x9b>
+    pid = fork();
+    3cad:	e8 f9 0b 00 00       	call   48ab <fork>
+    if(pid < 0)
+    3cb2:	85 c0                	test   %eax,%eax
+    3cb4:	79 ea                	jns    3ca0 <forktest+0x20>
+  for(; n > 0; n--){
+    3cb6:	85 db                	test   %ebx,%ebx
+    3cb8:	74 14                	je     3cce <forktest+0x4e>
+    3cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    3cc0:	e8 f6 0b 00 00       	call   48bb <wait>
+    3cc5:	85 c0                	test   %eax,%eax
+    3cc7:	78 2b                	js     3cf4 <forktest+0x74>
+  for(; n > 0; n--){
+    3cc9:	83 eb 01             	sub    $0x1,%ebx
+    3ccc:	75 f2                	jne    3cc0 <forktest+0x40>
+  if(wait() != -1){
+    3cce:	e8 e8 0b 00 00       	call   48bb <wait>
+    3cd3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3cd6:	75 30                	jne    3d08 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    3cd8:	83 ec 08             	sub    $0x8,%esp
+    3cdb:	68 aa 5b 00 00       	push   $0x5baa
+    3ce0:	6a 01                	push   $0x1
+    3ce2:	e8 b9 0d 00 00       	call   4aa0 <printf>
+}
+    3ce7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3cea:	83 c4 10             	add    $0x10,%esp
+    3ced:	c9                   	leave
+    3cee:	c3                   	ret
+      exit();
+    3cef:	e8 bf 0b 00 00       	call   48b3 <exit>
+      printf(1, "wait stopped early\n");
+    3cf4:	83 ec 08             	sub    $0x8,%esp
+    3cf7:	68 83 5b 00 00       	push   $0x5b83
+    3cfc:	6a 01                	push   $0x1
+    3cfe:	e8 9d 0d 00 00       	call   4aa0 <printf>
+      exit();
+    3d03:	e8 ab 0b 00 00       	call   48b3 <exit>
+    printf(1, "wait got too many\n");
+    3d08:	50                   	push   %eax
+    3d09:	50                   	push   %eax
+    3d0a:	68 97 5b 00 00       	push   $0x5b97
+    3d0f:	6a 01                	push   $0x1
+    3d11:	e8 8a 0d 00 00       	call   4aa0 <printf>
+    exit();
+    3d16:	e8 98 0b 00 00       	call   48b3 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    3d1b:	52                   	push   %edx
+    3d1c:	52                   	push   %edx
+    3d1d:	68 18 63 00 00       	push   $0x6318
+    3d22:	6a 01                	push   $0x1
+    3d24:	e8 77 0d 00 00       	call   4aa0 <printf>
+    exit();
+    3d29:	e8 85 0b 00 00       	call   48b3 <exit>
+    3d2e:	66 90                	xchg   %ax,%ax
+
+00003d30 <sbrktest>:
+{
+    3d30:	55                   	push   %ebp
+    3d31:	89 e5                	mov    %esp,%ebp
+    3d33:	57                   	push   %edi
+    3d34:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    3d35:	31 f6                	xor    %esi,%esi
+{
+    3d37:	53                   	push   %ebx
+    3d38:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    3d3b:	68 b8 5b 00 00       	push   $0x5bb8
+    3d40:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3d46:	e8 55 0d 00 00       	call   4aa0 <printf>
+  oldbrk = sbrk(0);
+    3d4b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3d52:	e8 e4 0b 00 00       	call   493b <sbrk>
+    3d57:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    3d5a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3d61:	e8 d5 0b 00 00       	call   493b <sbrk>
+    3d66:	83 c4 10             	add    $0x10,%esp
+    3d69:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    3d6b:	eb 05                	jmp    3d72 <sbrktest+0x42>
+    3d6d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    3d70:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    3d72:	83 ec 0c             	sub    $0xc,%esp
+    3d75:	6a 01                	push   $0x1
+    3d77:	e8 bf 0b 00 00       	call   493b <sbrk>
+    if(b != a){
+    3d7c:	83 c4 10             	add    $0x10,%esp
+    3d7f:	39 d8                	cmp    %ebx,%eax
+    3d81:	0f 85 9c 02 00 00    	jne    4023 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    3d87:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    3d8a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    3d8d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    3d90:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3d96:	75 d8                	jne    3d70 <sbrktest+0x40>
+  pid = fork();
+    3d98:	e8 0e 0b 00 00       	call   48ab <fork>
+    3d9d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    3d9f:	85 c0                	test   %eax,%eax
+    3da1:	0f 88 02 03 00 00    	js     40a9 <sbrktest+0x379>
+  c = sbrk(1);
+    3da7:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    3daa:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    3dad:	6a 01                	push   $0x1
+    3daf:	e8 87 0b 00 00       	call   493b <sbrk>
+  c = sbrk(1);
+    3db4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3dbb:	e8 7b 0b 00 00       	call   493b <sbrk>
+  if(c != a + 1){
+    3dc0:	83 c4 10             	add    $0x10,%esp
+    3dc3:	39 c3                	cmp    %eax,%ebx
+    3dc5:	0f 85 3b 03 00 00    	jne    4106 <sbrktest+0x3d6>
+  if(pid == 0)
+    3dcb:	85 f6                	test   %esi,%esi
+    3dcd:	0f 84 2e 03 00 00    	je     4101 <sbrktest+0x3d1>
+  wait();
+    3dd3:	e8 e3 0a 00 00       	call   48bb <wait>
+  a = sbrk(0);
+    3dd8:	83 ec 0c             	sub    $0xc,%esp
+    3ddb:	6a 00                	push   $0x0
+    3ddd:	e8 59 0b 00 00       	call   493b <sbrk>
+    3de2:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3de4:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3de9:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    3deb:	89 04 24             	mov    %eax,(%esp)
+    3dee:	e8 48 0b 00 00       	call   493b <sbrk>
+  if (p != a) {
+    3df3:	83 c4 10             	add    $0x10,%esp
+    3df6:	39 c3                	cmp    %eax,%ebx
+    3df8:	0f 85 94 02 00 00    	jne    4092 <sbrktest+0x362>
+  a = sbrk(0);
+    3dfe:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    3e01:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    3e08:	6a 00                	push   $0x0
+    3e0a:	e8 2c 0b 00 00       	call   493b <sbrk>
+  c = sbrk(-4096);
+    3e0f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    3e16:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3e18:	e8 1e 0b 00 00       	call   493b <sbrk>
+  if(c == (char*)0xffffffff){
+    3e1d:	83 c4 10             	add    $0x10,%esp
+    3e20:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3e23:	0f 84 22 03 00 00    	je     414b <sbrktest+0x41b>
+  c = sbrk(0);
+    3e29:	83 ec 0c             	sub    $0xc,%esp
+    3e2c:	6a 00                	push   $0x0
+    3e2e:	e8 08 0b 00 00       	call   493b <sbrk>
+  if(c != a - 4096){
+    3e33:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    3e39:	83 c4 10             	add    $0x10,%esp
+    3e3c:	39 d0                	cmp    %edx,%eax
+    3e3e:	0f 85 f0 02 00 00    	jne    4134 <sbrktest+0x404>
+  a = sbrk(0);
+    3e44:	83 ec 0c             	sub    $0xc,%esp
+    3e47:	6a 00                	push   $0x0
+    3e49:	e8 ed 0a 00 00       	call   493b <sbrk>
+  c = sbrk(4096);
+    3e4e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    3e55:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    3e57:	e8 df 0a 00 00       	call   493b <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    3e5c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    3e5f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    3e61:	39 c3                	cmp    %eax,%ebx
+    3e63:	0f 85 b4 02 00 00    	jne    411d <sbrktest+0x3ed>
+    3e69:	83 ec 0c             	sub    $0xc,%esp
+    3e6c:	6a 00                	push   $0x0
+    3e6e:	e8 c8 0a 00 00       	call   493b <sbrk>
+    3e73:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3e79:	83 c4 10             	add    $0x10,%esp
+    3e7c:	39 c2                	cmp    %eax,%edx
+    3e7e:	0f 85 99 02 00 00    	jne    411d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    3e84:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    3e8b:	0f 84 2f 02 00 00    	je     40c0 <sbrktest+0x390>
+  a = sbrk(0);
+    3e91:	83 ec 0c             	sub    $0xc,%esp
+    3e94:	6a 00                	push   $0x0
+    3e96:	e8 a0 0a 00 00       	call   493b <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3e9b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    3ea2:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3ea4:	e8 92 0a 00 00       	call   493b <sbrk>
+    3ea9:	89 c2                	mov    %eax,%edx
+    3eab:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3eae:	29 d0                	sub    %edx,%eax
+    3eb0:	89 04 24             	mov    %eax,(%esp)
+    3eb3:	e8 83 0a 00 00       	call   493b <sbrk>
+  if(c != a){
+    3eb8:	83 c4 10             	add    $0x10,%esp
+    3ebb:	39 c3                	cmp    %eax,%ebx
+    3ebd:	0f 85 b8 01 00 00    	jne    407b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3ec3:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3ec8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3ecf:	90                   	nop
+    ppid = getpid();
+    3ed0:	e8 5e 0a 00 00       	call   4933 <getpid>
+    3ed5:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3ed7:	e8 cf 09 00 00       	call   48ab <fork>
+    if(pid < 0){
+    3edc:	85 c0                	test   %eax,%eax
+    3ede:	0f 88 5d 01 00 00    	js     4041 <sbrktest+0x311>
+    if(pid == 0){
+    3ee4:	0f 84 6f 01 00 00    	je     4059 <sbrktest+0x329>
+    wait();
+    3eea:	e8 cc 09 00 00       	call   48bb <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3eef:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3ef5:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    3efb:	75 d3                	jne    3ed0 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    3efd:	83 ec 0c             	sub    $0xc,%esp
+    3f00:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3f03:	50                   	push   %eax
+    3f04:	e8 ba 09 00 00       	call   48c3 <pipe>
+    3f09:	83 c4 10             	add    $0x10,%esp
+    3f0c:	85 c0                	test   %eax,%eax
+    3f0e:	0f 85 da 01 00 00    	jne    40ee <sbrktest+0x3be>
+    3f14:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3f17:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    3f1a:	89 df                	mov    %ebx,%edi
+    3f1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    3f20:	e8 86 09 00 00       	call   48ab <fork>
+    3f25:	89 07                	mov    %eax,(%edi)
+    3f27:	85 c0                	test   %eax,%eax
+    3f29:	0f 84 91 00 00 00    	je     3fc0 <sbrktest+0x290>
+    if(pids[i] != -1)
+    3f2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3f32:	74 14                	je     3f48 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    3f34:	83 ec 04             	sub    $0x4,%esp
+    3f37:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    3f3a:	6a 01                	push   $0x1
+    3f3c:	50                   	push   %eax
+    3f3d:	ff 75 b8             	push   -0x48(%ebp)
+    3f40:	e8 86 09 00 00       	call   48cb <read>
+    3f45:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3f48:	83 c7 04             	add    $0x4,%edi
+    3f4b:	39 f7                	cmp    %esi,%edi
+    3f4d:	75 d1                	jne    3f20 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    3f4f:	83 ec 0c             	sub    $0xc,%esp
+    3f52:	68 00 10 00 00       	push   $0x1000
+    3f57:	e8 df 09 00 00       	call   493b <sbrk>
+    3f5c:	83 c4 10             	add    $0x10,%esp
+    3f5f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3f61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3f68:	8b 03                	mov    (%ebx),%eax
+    3f6a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3f6d:	74 11                	je     3f80 <sbrktest+0x250>
+    kill(pids[i]);
+    3f6f:	83 ec 0c             	sub    $0xc,%esp
+    3f72:	50                   	push   %eax
+    3f73:	e8 6b 09 00 00       	call   48e3 <kill>
+    wait();
+    3f78:	e8 3e 09 00 00       	call   48bb <wait>
+    3f7d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3f80:	83 c3 04             	add    $0x4,%ebx
+    3f83:	39 f3                	cmp    %esi,%ebx
+    3f85:	75 e1                	jne    3f68 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3f87:	83 ff ff             	cmp    $0xffffffff,%edi
+    3f8a:	0f 84 47 01 00 00    	je     40d7 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    3f90:	83 ec 0c             	sub    $0xc,%esp
+    3f93:	6a 00                	push   $0x0
+    3f95:	e8 a1 09 00 00       	call   493b <sbrk>
+    3f9a:	83 c4 10             	add    $0x10,%esp
+    3f9d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3fa0:	72 60                	jb     4002 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    3fa2:	83 ec 08             	sub    $0x8,%esp
+    3fa5:	68 60 5c 00 00       	push   $0x5c60
+    3faa:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3fb0:	e8 eb 0a 00 00       	call   4aa0 <printf>
+}
+    3fb5:	83 c4 10             	add    $0x10,%esp
+    3fb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3fbb:	5b                   	pop    %ebx
+    3fbc:	5e                   	pop    %esi
+    3fbd:	5f                   	pop    %edi
+    3fbe:	5d                   	pop    %ebp
+    3fbf:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3fc0:	83 ec 0c             	sub    $0xc,%esp
+    3fc3:	6a 00                	push   $0x0
+    3fc5:	e8 71 09 00 00       	call   493b <sbrk>
+    3fca:	89 c2                	mov    %eax,%edx
+    3fcc:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3fd1:	29 d0                	sub    %edx,%eax
+    3fd3:	89 04 24             	mov    %eax,(%esp)
+    3fd6:	e8 60 09 00 00       	call   493b <sbrk>
+      write(fds[1], "x", 1);
+    3fdb:	83 c4 0c             	add    $0xc,%esp
+    3fde:	6a 01                	push   $0x1
+    3fe0:	68 21 57 00 00       	push   $0x5721
+    3fe5:	ff 75 bc             	push   -0x44(%ebp)
+    3fe8:	e8 e6 08 00 00       	call   48d3 <write>
+    3fed:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    3ff0:	83 ec 0c             	sub    $0xc,%esp
+    3ff3:	68 e8 03 00 00       	push   $0x3e8
+    3ff8:	e8 46 09 00 00       	call   4943 <sleep>
+    3ffd:	83 c4 10             	add    $0x10,%esp
+    4000:	eb ee                	jmp    3ff0 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    4002:	83 ec 0c             	sub    $0xc,%esp
+    4005:	6a 00                	push   $0x0
+    4007:	e8 2f 09 00 00       	call   493b <sbrk>
+    400c:	89 c2                	mov    %eax,%edx
+    400e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    4011:	29 d0                	sub    %edx,%eax
+    4013:	89 04 24             	mov    %eax,(%esp)
+    4016:	e8 20 09 00 00       	call   493b <sbrk>
+    401b:	83 c4 10             	add    $0x10,%esp
+    401e:	e9 7f ff ff ff       	jmp    3fa2 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    4023:	83 ec 0c             	sub    $0xc,%esp
+    4026:	50                   	push   %eax
+    4027:	53                   	push   %ebx
+    4028:	56                   	push   %esi
+    4029:	68 c3 5b 00 00       	push   $0x5bc3
+    402e:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4034:	e8 67 0a 00 00       	call   4aa0 <printf>
+      exit();
+    4039:	83 c4 20             	add    $0x20,%esp
+    403c:	e8 72 08 00 00       	call   48b3 <exit>
+      printf(stdout, "fork failed\n");
+    4041:	83 ec 08             	sub    $0x8,%esp
+    4044:	68 09 5d 00 00       	push   $0x5d09
+    4049:	ff 35 a8 6e 00 00    	push   0x6ea8
+    404f:	e8 4c 0a 00 00       	call   4aa0 <printf>
+      exit();
+    4054:	e8 5a 08 00 00       	call   48b3 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    4059:	0f be 03             	movsbl (%ebx),%eax
+    405c:	50                   	push   %eax
+    405d:	53                   	push   %ebx
+    405e:	68 2c 5c 00 00       	push   $0x5c2c
+    4063:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4069:	e8 32 0a 00 00       	call   4aa0 <printf>
+      kill(ppid);
+    406e:	89 34 24             	mov    %esi,(%esp)
+    4071:	e8 6d 08 00 00       	call   48e3 <kill>
+      exit();
+    4076:	e8 38 08 00 00       	call   48b3 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    407b:	50                   	push   %eax
+    407c:	53                   	push   %ebx
+    407d:	68 0c 64 00 00       	push   $0x640c
+    4082:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4088:	e8 13 0a 00 00       	call   4aa0 <printf>
+    exit();
+    408d:	e8 21 08 00 00       	call   48b3 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    4092:	56                   	push   %esi
+    4093:	56                   	push   %esi
+    4094:	68 3c 63 00 00       	push   $0x633c
+    4099:	ff 35 a8 6e 00 00    	push   0x6ea8
+    409f:	e8 fc 09 00 00       	call   4aa0 <printf>
+    exit();
+    40a4:	e8 0a 08 00 00       	call   48b3 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    40a9:	50                   	push   %eax
+    40aa:	50                   	push   %eax
+    40ab:	68 de 5b 00 00       	push   $0x5bde
+    40b0:	ff 35 a8 6e 00 00    	push   0x6ea8
+    40b6:	e8 e5 09 00 00       	call   4aa0 <printf>
+    exit();
+    40bb:	e8 f3 07 00 00       	call   48b3 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    40c0:	51                   	push   %ecx
+    40c1:	51                   	push   %ecx
+    40c2:	68 dc 63 00 00       	push   $0x63dc
+    40c7:	ff 35 a8 6e 00 00    	push   0x6ea8
+    40cd:	e8 ce 09 00 00       	call   4aa0 <printf>
+    exit();
+    40d2:	e8 dc 07 00 00       	call   48b3 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    40d7:	50                   	push   %eax
+    40d8:	50                   	push   %eax
+    40d9:	68 45 5c 00 00       	push   $0x5c45
+    40de:	ff 35 a8 6e 00 00    	push   0x6ea8
+    40e4:	e8 b7 09 00 00       	call   4aa0 <printf>
+    exit();
+    40e9:	e8 c5 07 00 00       	call   48b3 <exit>
+    printf(1, "pipe() failed\n");
+    40ee:	52                   	push   %edx
+    40ef:	52                   	push   %edx
+    40f0:	68 01 51 00 00       	push   $0x5101
+    40f5:	6a 01                	push   $0x1
+    40f7:	e8 a4 09 00 00       	call   4aa0 <printf>
+    exit();
+    40fc:	e8 b2 07 00 00       	call   48b3 <exit>
+    exit();
+    4101:	e8 ad 07 00 00       	call   48b3 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    4106:	57                   	push   %edi
+    4107:	57                   	push   %edi
+    4108:	68 f5 5b 00 00       	push   $0x5bf5
+    410d:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4113:	e8 88 09 00 00       	call   4aa0 <printf>
+    exit();
+    4118:	e8 96 07 00 00       	call   48b3 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    411d:	56                   	push   %esi
+    411e:	53                   	push   %ebx
+    411f:	68 b4 63 00 00       	push   $0x63b4
+    4124:	ff 35 a8 6e 00 00    	push   0x6ea8
+    412a:	e8 71 09 00 00       	call   4aa0 <printf>
+    exit();
+    412f:	e8 7f 07 00 00       	call   48b3 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    4134:	50                   	push   %eax
+    4135:	53                   	push   %ebx
+    4136:	68 7c 63 00 00       	push   $0x637c
+    413b:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4141:	e8 5a 09 00 00       	call   4aa0 <printf>
+    exit();
+    4146:	e8 68 07 00 00       	call   48b3 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    414b:	53                   	push   %ebx
+    414c:	53                   	push   %ebx
+    414d:	68 11 5c 00 00       	push   $0x5c11
+    4152:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4158:	e8 43 09 00 00       	call   4aa0 <printf>
+    exit();
+    415d:	e8 51 07 00 00       	call   48b3 <exit>
+    4162:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004170 <validateint>:
+}
+    4170:	c3                   	ret
+    4171:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4178:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    417f:	90                   	nop
+
+00004180 <validatetest>:
+{
+    4180:	55                   	push   %ebp
+    4181:	89 e5                	mov    %esp,%ebp
+    4183:	56                   	push   %esi
+  for(p =4096; p <= (uint)hi; p += 4096){
+    4184:	be 00 10 00 00       	mov    $0x1000,%esi
+{
+    4189:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    418a:	83 ec 08             	sub    $0x8,%esp
+    418d:	68 6e 5c 00 00       	push   $0x5c6e
+    4192:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4198:	e8 03 09 00 00       	call   4aa0 <printf>
+    419d:	83 c4 10             	add    $0x10,%esp
+    if((pid = fork()) == 0){
+    41a0:	e8 06 07 00 00       	call   48ab <fork>
+    41a5:	89 c3                	mov    %eax,%ebx
+    41a7:	85 c0                	test   %eax,%eax
+    41a9:	74 63                	je     420e <validatetest+0x8e>
+    sleep(0);
+    41ab:	83 ec 0c             	sub    $0xc,%esp
+    41ae:	6a 00                	push   $0x0
+    41b0:	e8 8e 07 00 00       	call   4943 <sleep>
+    sleep(0);
+    41b5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    41bc:	e8 82 07 00 00       	call   4943 <sleep>
+    kill(pid);
+    41c1:	89 1c 24             	mov    %ebx,(%esp)
+    41c4:	e8 1a 07 00 00       	call   48e3 <kill>
+    wait();
+    41c9:	e8 ed 06 00 00       	call   48bb <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    41ce:	58                   	pop    %eax
+    41cf:	5a                   	pop    %edx
+    41d0:	56                   	push   %esi
+    41d1:	68 7d 5c 00 00       	push   $0x5c7d
+    41d6:	e8 38 07 00 00       	call   4913 <link>
+    41db:	83 c4 10             	add    $0x10,%esp
+    41de:	83 f8 ff             	cmp    $0xffffffff,%eax
+    41e1:	75 30                	jne    4213 <validatetest+0x93>
+  for(p =4096; p <= (uint)hi; p += 4096){
+    41e3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    41e9:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    41ef:	75 af                	jne    41a0 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    41f1:	83 ec 08             	sub    $0x8,%esp
+    41f4:	68 a1 5c 00 00       	push   $0x5ca1
+    41f9:	ff 35 a8 6e 00 00    	push   0x6ea8
+    41ff:	e8 9c 08 00 00       	call   4aa0 <printf>
+}
+    4204:	83 c4 10             	add    $0x10,%esp
+    4207:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    420a:	5b                   	pop    %ebx
+    420b:	5e                   	pop    %esi
+    420c:	5d                   	pop    %ebp
+    420d:	c3                   	ret
+      exit();
+    420e:	e8 a0 06 00 00       	call   48b3 <exit>
+      printf(stdout, "link should not succeed\n");
+    4213:	83 ec 08             	sub    $0x8,%esp
+    4216:	68 88 5c 00 00       	push   $0x5c88
+    421b:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4221:	e8 7a 08 00 00       	call   4aa0 <printf>
+      exit();
+    4226:	e8 88 06 00 00       	call   48b3 <exit>
+    422b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    422f:	90                   	nop
+
+00004230 <bsstest>:
+{
+    4230:	55                   	push   %ebp
+    4231:	89 e5                	mov    %esp,%ebp
+    4233:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    4236:	68 ae 5c 00 00       	push   $0x5cae
+    423b:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4241:	e8 5a 08 00 00       	call   4aa0 <printf>
+    4246:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    4249:	31 c0                	xor    %eax,%eax
+    424b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    424f:	90                   	nop
+    if(uninit[i] != '\0'){
+    4250:	80 b8 c0 6e 00 00 00 	cmpb   $0x0,0x6ec0(%eax)
+    4257:	75 22                	jne    427b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    4259:	83 c0 01             	add    $0x1,%eax
+    425c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    4261:	75 ed                	jne    4250 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    4263:	83 ec 08             	sub    $0x8,%esp
+    4266:	68 c9 5c 00 00       	push   $0x5cc9
+    426b:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4271:	e8 2a 08 00 00       	call   4aa0 <printf>
+}
+    4276:	83 c4 10             	add    $0x10,%esp
+    4279:	c9                   	leave
+    427a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    427b:	83 ec 08             	sub    $0x8,%esp
+    427e:	68 b8 5c 00 00       	push   $0x5cb8
+    4283:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4289:	e8 12 08 00 00       	call   4aa0 <printf>
+      exit();
+    428e:	e8 20 06 00 00       	call   48b3 <exit>
+    4293:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    429a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000042a0 <bigargtest>:
+{
+    42a0:	55                   	push   %ebp
+    42a1:	89 e5                	mov    %esp,%ebp
+    42a3:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    42a6:	68 d6 5c 00 00       	push   $0x5cd6
+    42ab:	e8 53 06 00 00       	call   4903 <unlink>
+  pid = fork();
+    42b0:	e8 f6 05 00 00       	call   48ab <fork>
+  if(pid == 0){
+    42b5:	83 c4 10             	add    $0x10,%esp
+    42b8:	85 c0                	test   %eax,%eax
+    42ba:	74 44                	je     4300 <bigargtest+0x60>
+  } else if(pid < 0){
+    42bc:	0f 88 c3 00 00 00    	js     4385 <bigargtest+0xe5>
+  wait();
+    42c2:	e8 f4 05 00 00       	call   48bb <wait>
+  fd = open("bigarg-ok", 0);
+    42c7:	83 ec 08             	sub    $0x8,%esp
+    42ca:	6a 00                	push   $0x0
+    42cc:	68 d6 5c 00 00       	push   $0x5cd6
+    42d1:	e8 1d 06 00 00       	call   48f3 <open>
+  if(fd < 0){
+    42d6:	83 c4 10             	add    $0x10,%esp
+    42d9:	85 c0                	test   %eax,%eax
+    42db:	0f 88 8d 00 00 00    	js     436e <bigargtest+0xce>
+  close(fd);
+    42e1:	83 ec 0c             	sub    $0xc,%esp
+    42e4:	50                   	push   %eax
+    42e5:	e8 f1 05 00 00       	call   48db <close>
+  unlink("bigarg-ok");
+    42ea:	c7 04 24 d6 5c 00 00 	movl   $0x5cd6,(%esp)
+    42f1:	e8 0d 06 00 00       	call   4903 <unlink>
+}
+    42f6:	83 c4 10             	add    $0x10,%esp
+    42f9:	c9                   	leave
+    42fa:	c3                   	ret
+    42fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    42ff:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    4300:	c7 04 85 e0 b5 00 00 	movl   $0x6430,0xb5e0(,%eax,4)
+    4307:	30 64 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    430b:	83 c0 01             	add    $0x1,%eax
+    430e:	83 f8 1f             	cmp    $0x1f,%eax
+    4311:	75 ed                	jne    4300 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    4313:	31 c9                	xor    %ecx,%ecx
+    4315:	89 0d 5c b6 00 00    	mov    %ecx,0xb65c
+    printf(stdout, "bigarg test\n");
+    431b:	50                   	push   %eax
+    431c:	50                   	push   %eax
+    431d:	68 e0 5c 00 00       	push   $0x5ce0
+    4322:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4328:	e8 73 07 00 00       	call   4aa0 <printf>
+    exec("echo", args);
+    432d:	58                   	pop    %eax
+    432e:	5a                   	pop    %edx
+    432f:	68 e0 b5 00 00       	push   $0xb5e0
+    4334:	68 ad 4e 00 00       	push   $0x4ead
+    4339:	e8 ad 05 00 00       	call   48eb <exec>
+    printf(stdout, "bigarg test ok\n");
+    433e:	59                   	pop    %ecx
+    433f:	58                   	pop    %eax
+    4340:	68 ed 5c 00 00       	push   $0x5ced
+    4345:	ff 35 a8 6e 00 00    	push   0x6ea8
+    434b:	e8 50 07 00 00       	call   4aa0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    4350:	58                   	pop    %eax
+    4351:	5a                   	pop    %edx
+    4352:	68 00 02 00 00       	push   $0x200
+    4357:	68 d6 5c 00 00       	push   $0x5cd6
+    435c:	e8 92 05 00 00       	call   48f3 <open>
+    close(fd);
+    4361:	89 04 24             	mov    %eax,(%esp)
+    4364:	e8 72 05 00 00       	call   48db <close>
+    exit();
+    4369:	e8 45 05 00 00       	call   48b3 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    436e:	50                   	push   %eax
+    436f:	50                   	push   %eax
+    4370:	68 16 5d 00 00       	push   $0x5d16
+    4375:	ff 35 a8 6e 00 00    	push   0x6ea8
+    437b:	e8 20 07 00 00       	call   4aa0 <printf>
+    exit();
+    4380:	e8 2e 05 00 00       	call   48b3 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    4385:	52                   	push   %edx
+    4386:	52                   	push   %edx
+    4387:	68 fd 5c 00 00       	push   $0x5cfd
+    438c:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4392:	e8 09 07 00 00       	call   4aa0 <printf>
+    exit();
+    4397:	e8 17 05 00 00       	call   48b3 <exit>
+    439c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000043a0 <fsfull>:
+{
+    43a0:	55                   	push   %ebp
+    43a1:	89 e5                	mov    %esp,%ebp
+    43a3:	57                   	push   %edi
+    43a4:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    43a5:	31 f6                	xor    %esi,%esi
+{
+    43a7:	53                   	push   %ebx
+    43a8:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    43ab:	68 2b 5d 00 00       	push   $0x5d2b
+    43b0:	6a 01                	push   $0x1
+    43b2:	e8 e9 06 00 00       	call   4aa0 <printf>
+    43b7:	83 c4 10             	add    $0x10,%esp
+    43ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    43c0:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    43c5:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    43ca:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    43cd:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    43d1:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    43d3:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    43d7:	c1 ea 06             	shr    $0x6,%edx
+    43da:	8d 42 30             	lea    0x30(%edx),%eax
+    43dd:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    43e0:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    43e6:	89 f2                	mov    %esi,%edx
+    43e8:	29 c2                	sub    %eax,%edx
+    43ea:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    43ef:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    43f1:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    43f6:	c1 ea 05             	shr    $0x5,%edx
+    43f9:	83 c2 30             	add    $0x30,%edx
+    43fc:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    43ff:	f7 e6                	mul    %esi
+    4401:	c1 ea 05             	shr    $0x5,%edx
+    4404:	6b c2 64             	imul   $0x64,%edx,%eax
+    4407:	89 f2                	mov    %esi,%edx
+    4409:	29 c2                	sub    %eax,%edx
+    440b:	89 d0                	mov    %edx,%eax
+    440d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    440f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4411:	c1 ea 03             	shr    $0x3,%edx
+    4414:	83 c2 30             	add    $0x30,%edx
+    4417:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    441a:	f7 e1                	mul    %ecx
+    441c:	89 f0                	mov    %esi,%eax
+    441e:	c1 ea 03             	shr    $0x3,%edx
+    4421:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4424:	01 d2                	add    %edx,%edx
+    4426:	29 d0                	sub    %edx,%eax
+    4428:	83 c0 30             	add    $0x30,%eax
+    442b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    442e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4431:	50                   	push   %eax
+    4432:	68 38 5d 00 00       	push   $0x5d38
+    4437:	6a 01                	push   $0x1
+    4439:	e8 62 06 00 00       	call   4aa0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    443e:	58                   	pop    %eax
+    443f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4442:	5a                   	pop    %edx
+    4443:	68 02 02 00 00       	push   $0x202
+    4448:	50                   	push   %eax
+    4449:	e8 a5 04 00 00       	call   48f3 <open>
+    if(fd < 0){
+    444e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    4451:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    4453:	85 c0                	test   %eax,%eax
+    4455:	78 4f                	js     44a6 <fsfull+0x106>
+    int total = 0;
+    4457:	31 db                	xor    %ebx,%ebx
+    4459:	eb 07                	jmp    4462 <fsfull+0xc2>
+    445b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    445f:	90                   	nop
+      total += cc;
+    4460:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    4462:	83 ec 04             	sub    $0x4,%esp
+    4465:	68 00 02 00 00       	push   $0x200
+    446a:	68 e0 95 00 00       	push   $0x95e0
+    446f:	57                   	push   %edi
+    4470:	e8 5e 04 00 00       	call   48d3 <write>
+      if(cc < 512)
+    4475:	83 c4 10             	add    $0x10,%esp
+    4478:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    447d:	7f e1                	jg     4460 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    447f:	83 ec 04             	sub    $0x4,%esp
+    4482:	53                   	push   %ebx
+    4483:	68 54 5d 00 00       	push   $0x5d54
+    4488:	6a 01                	push   $0x1
+    448a:	e8 11 06 00 00       	call   4aa0 <printf>
+    close(fd);
+    448f:	89 3c 24             	mov    %edi,(%esp)
+    4492:	e8 44 04 00 00       	call   48db <close>
+    if(total == 0)
+    4497:	83 c4 10             	add    $0x10,%esp
+    449a:	85 db                	test   %ebx,%ebx
+    449c:	74 1e                	je     44bc <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    449e:	83 c6 01             	add    $0x1,%esi
+    44a1:	e9 1a ff ff ff       	jmp    43c0 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    44a6:	83 ec 04             	sub    $0x4,%esp
+    44a9:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    44ac:	50                   	push   %eax
+    44ad:	68 44 5d 00 00       	push   $0x5d44
+    44b2:	6a 01                	push   $0x1
+    44b4:	e8 e7 05 00 00       	call   4aa0 <printf>
+      break;
+    44b9:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    44bc:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    44c1:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    44c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44cd:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    44d0:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    44d2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    44d5:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    44d9:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    44db:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    44df:	c1 ea 06             	shr    $0x6,%edx
+    44e2:	8d 42 30             	lea    0x30(%edx),%eax
+    44e5:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    44e8:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    44ee:	89 f2                	mov    %esi,%edx
+    44f0:	29 c2                	sub    %eax,%edx
+    44f2:	89 d0                	mov    %edx,%eax
+    44f4:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    44f6:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    44f8:	c1 ea 05             	shr    $0x5,%edx
+    44fb:	83 c2 30             	add    $0x30,%edx
+    44fe:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4501:	f7 e3                	mul    %ebx
+    4503:	c1 ea 05             	shr    $0x5,%edx
+    4506:	6b ca 64             	imul   $0x64,%edx,%ecx
+    4509:	89 f2                	mov    %esi,%edx
+    450b:	29 ca                	sub    %ecx,%edx
+    450d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    4512:	89 d0                	mov    %edx,%eax
+    4514:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    4516:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4518:	c1 ea 03             	shr    $0x3,%edx
+    451b:	83 c2 30             	add    $0x30,%edx
+    451e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4521:	f7 e1                	mul    %ecx
+    4523:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    4525:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    4528:	c1 ea 03             	shr    $0x3,%edx
+    452b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    452e:	01 d2                	add    %edx,%edx
+    4530:	29 d0                	sub    %edx,%eax
+    4532:	83 c0 30             	add    $0x30,%eax
+    4535:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    4538:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    453b:	50                   	push   %eax
+    453c:	e8 c2 03 00 00       	call   4903 <unlink>
+  while(nfiles >= 0){
+    4541:	83 c4 10             	add    $0x10,%esp
+    4544:	83 fe ff             	cmp    $0xffffffff,%esi
+    4547:	75 87                	jne    44d0 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    4549:	83 ec 08             	sub    $0x8,%esp
+    454c:	68 64 5d 00 00       	push   $0x5d64
+    4551:	6a 01                	push   $0x1
+    4553:	e8 48 05 00 00       	call   4aa0 <printf>
+}
+    4558:	83 c4 10             	add    $0x10,%esp
+    455b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    455e:	5b                   	pop    %ebx
+    455f:	5e                   	pop    %esi
+    4560:	5f                   	pop    %edi
+    4561:	5d                   	pop    %ebp
+    4562:	c3                   	ret
+    4563:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    456a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004570 <uio>:
+{
+    4570:	55                   	push   %ebp
+    4571:	89 e5                	mov    %esp,%ebp
+    4573:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    4576:	68 7a 5d 00 00       	push   $0x5d7a
+    457b:	6a 01                	push   $0x1
+    457d:	e8 1e 05 00 00       	call   4aa0 <printf>
+  pid = fork();
+    4582:	e8 24 03 00 00       	call   48ab <fork>
+  if(pid == 0){
+    4587:	83 c4 10             	add    $0x10,%esp
+    458a:	85 c0                	test   %eax,%eax
+    458c:	74 1b                	je     45a9 <uio+0x39>
+  } else if(pid < 0){
+    458e:	78 3d                	js     45cd <uio+0x5d>
+  wait();
+    4590:	e8 26 03 00 00       	call   48bb <wait>
+  printf(1, "uio test done\n");
+    4595:	83 ec 08             	sub    $0x8,%esp
+    4598:	68 84 5d 00 00       	push   $0x5d84
+    459d:	6a 01                	push   $0x1
+    459f:	e8 fc 04 00 00       	call   4aa0 <printf>
+}
+    45a4:	83 c4 10             	add    $0x10,%esp
+    45a7:	c9                   	leave
+    45a8:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    45a9:	b8 09 00 00 00       	mov    $0x9,%eax
+    45ae:	ba 70 00 00 00       	mov    $0x70,%edx
+    45b3:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    45b4:	ba 71 00 00 00       	mov    $0x71,%edx
+    45b9:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    45ba:	52                   	push   %edx
+    45bb:	52                   	push   %edx
+    45bc:	68 10 65 00 00       	push   $0x6510
+    45c1:	6a 01                	push   $0x1
+    45c3:	e8 d8 04 00 00       	call   4aa0 <printf>
+    exit();
+    45c8:	e8 e6 02 00 00       	call   48b3 <exit>
+    printf (1, "fork failed\n");
+    45cd:	50                   	push   %eax
+    45ce:	50                   	push   %eax
+    45cf:	68 09 5d 00 00       	push   $0x5d09
+    45d4:	6a 01                	push   $0x1
+    45d6:	e8 c5 04 00 00       	call   4aa0 <printf>
+    exit();
+    45db:	e8 d3 02 00 00       	call   48b3 <exit>
+
+000045e0 <argptest>:
+{
+    45e0:	55                   	push   %ebp
+    45e1:	89 e5                	mov    %esp,%ebp
+    45e3:	53                   	push   %ebx
+    45e4:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    45e7:	6a 00                	push   $0x0
+    45e9:	68 93 5d 00 00       	push   $0x5d93
+    45ee:	e8 00 03 00 00       	call   48f3 <open>
+  if (fd < 0) {
+    45f3:	83 c4 10             	add    $0x10,%esp
+    45f6:	85 c0                	test   %eax,%eax
+    45f8:	78 39                	js     4633 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    45fa:	83 ec 0c             	sub    $0xc,%esp
+    45fd:	89 c3                	mov    %eax,%ebx
+    45ff:	6a 00                	push   $0x0
+    4601:	e8 35 03 00 00       	call   493b <sbrk>
+    4606:	83 c4 0c             	add    $0xc,%esp
+    4609:	83 e8 01             	sub    $0x1,%eax
+    460c:	6a ff                	push   $0xffffffff
+    460e:	50                   	push   %eax
+    460f:	53                   	push   %ebx
+    4610:	e8 b6 02 00 00       	call   48cb <read>
+  close(fd);
+    4615:	89 1c 24             	mov    %ebx,(%esp)
+    4618:	e8 be 02 00 00       	call   48db <close>
+  printf(1, "arg test passed\n");
+    461d:	58                   	pop    %eax
+    461e:	5a                   	pop    %edx
+    461f:	68 a5 5d 00 00       	push   $0x5da5
+    4624:	6a 01                	push   $0x1
+    4626:	e8 75 04 00 00       	call   4aa0 <printf>
+}
+    462b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    462e:	83 c4 10             	add    $0x10,%esp
+    4631:	c9                   	leave
+    4632:	c3                   	ret
+    printf(2, "open failed\n");
+    4633:	51                   	push   %ecx
+    4634:	51                   	push   %ecx
+    4635:	68 98 5d 00 00       	push   $0x5d98
+    463a:	6a 02                	push   $0x2
+    463c:	e8 5f 04 00 00       	call   4aa0 <printf>
+    exit();
+    4641:	e8 6d 02 00 00       	call   48b3 <exit>
+    4646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    464d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004650 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    4650:	69 05 a4 6e 00 00 0d 	imul   $0x19660d,0x6ea4,%eax
+    4657:	66 19 00 
+    465a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    465f:	a3 a4 6e 00 00       	mov    %eax,0x6ea4
+}
+    4664:	c3                   	ret
+    4665:	66 90                	xchg   %ax,%ax
+    4667:	66 90                	xchg   %ax,%ax
+    4669:	66 90                	xchg   %ax,%ax
+    466b:	66 90                	xchg   %ax,%ax
+    466d:	66 90                	xchg   %ax,%ax
+    466f:	90                   	nop
+
+00004670 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    4670:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    4671:	31 c0                	xor    %eax,%eax
+{
+    4673:	89 e5                	mov    %esp,%ebp
+    4675:	53                   	push   %ebx
+    4676:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4679:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    467c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    4680:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    4684:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    4687:	83 c0 01             	add    $0x1,%eax
+    468a:	84 d2                	test   %dl,%dl
+    468c:	75 f2                	jne    4680 <strcpy+0x10>
+    ;
+  return os;
+}
+    468e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4691:	89 c8                	mov    %ecx,%eax
+    4693:	c9                   	leave
+    4694:	c3                   	ret
+    4695:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    469c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000046a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    46a0:	55                   	push   %ebp
+    46a1:	89 e5                	mov    %esp,%ebp
+    46a3:	53                   	push   %ebx
+    46a4:	8b 55 08             	mov    0x8(%ebp),%edx
+    46a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    46aa:	0f b6 02             	movzbl (%edx),%eax
+    46ad:	84 c0                	test   %al,%al
+    46af:	75 17                	jne    46c8 <strcmp+0x28>
+    46b1:	eb 3a                	jmp    46ed <strcmp+0x4d>
+    46b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    46b7:	90                   	nop
+    46b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    46bc:	83 c2 01             	add    $0x1,%edx
+    46bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    46c2:	84 c0                	test   %al,%al
+    46c4:	74 1a                	je     46e0 <strcmp+0x40>
+    p++, q++;
+    46c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    46c8:	0f b6 19             	movzbl (%ecx),%ebx
+    46cb:	38 c3                	cmp    %al,%bl
+    46cd:	74 e9                	je     46b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    46cf:	29 d8                	sub    %ebx,%eax
+}
+    46d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    46d4:	c9                   	leave
+    46d5:	c3                   	ret
+    46d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    46dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    46e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    46e4:	31 c0                	xor    %eax,%eax
+    46e6:	29 d8                	sub    %ebx,%eax
+}
+    46e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    46eb:	c9                   	leave
+    46ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    46ed:	0f b6 19             	movzbl (%ecx),%ebx
+    46f0:	31 c0                	xor    %eax,%eax
+    46f2:	eb db                	jmp    46cf <strcmp+0x2f>
+    46f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    46fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    46ff:	90                   	nop
+
+00004700 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    4700:	55                   	push   %ebp
+    4701:	89 e5                	mov    %esp,%ebp
+    4703:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    4706:	80 3a 00             	cmpb   $0x0,(%edx)
+    4709:	74 15                	je     4720 <strlen+0x20>
+    470b:	31 c0                	xor    %eax,%eax
+    470d:	8d 76 00             	lea    0x0(%esi),%esi
+    4710:	83 c0 01             	add    $0x1,%eax
+    4713:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    4717:	89 c1                	mov    %eax,%ecx
+    4719:	75 f5                	jne    4710 <strlen+0x10>
+    ;
+  return n;
+}
+    471b:	89 c8                	mov    %ecx,%eax
+    471d:	5d                   	pop    %ebp
+    471e:	c3                   	ret
+    471f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    4720:	31 c9                	xor    %ecx,%ecx
+}
+    4722:	5d                   	pop    %ebp
+    4723:	89 c8                	mov    %ecx,%eax
+    4725:	c3                   	ret
+    4726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    472d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004730 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    4730:	55                   	push   %ebp
+    4731:	89 e5                	mov    %esp,%ebp
+    4733:	57                   	push   %edi
+    4734:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    4737:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    473a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    473d:	89 d7                	mov    %edx,%edi
+    473f:	fc                   	cld
+    4740:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    4742:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    4745:	89 d0                	mov    %edx,%eax
+    4747:	c9                   	leave
+    4748:	c3                   	ret
+    4749:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004750 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    4750:	55                   	push   %ebp
+    4751:	89 e5                	mov    %esp,%ebp
+    4753:	8b 45 08             	mov    0x8(%ebp),%eax
+    4756:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    475a:	0f b6 10             	movzbl (%eax),%edx
+    475d:	84 d2                	test   %dl,%dl
+    475f:	75 12                	jne    4773 <strchr+0x23>
+    4761:	eb 1d                	jmp    4780 <strchr+0x30>
+    4763:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4767:	90                   	nop
+    4768:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    476c:	83 c0 01             	add    $0x1,%eax
+    476f:	84 d2                	test   %dl,%dl
+    4771:	74 0d                	je     4780 <strchr+0x30>
+    if(*s == c)
+    4773:	38 d1                	cmp    %dl,%cl
+    4775:	75 f1                	jne    4768 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    4777:	5d                   	pop    %ebp
+    4778:	c3                   	ret
+    4779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    4780:	31 c0                	xor    %eax,%eax
+}
+    4782:	5d                   	pop    %ebp
+    4783:	c3                   	ret
+    4784:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    478b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    478f:	90                   	nop
+
+00004790 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    4790:	55                   	push   %ebp
+    4791:	89 e5                	mov    %esp,%ebp
+    4793:	57                   	push   %edi
+    4794:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    4795:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    4798:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    4799:	31 db                	xor    %ebx,%ebx
+{
+    479b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    479e:	eb 27                	jmp    47c7 <gets+0x37>
+    cc = read(0, &c, 1);
+    47a0:	83 ec 04             	sub    $0x4,%esp
+    47a3:	6a 01                	push   $0x1
+    47a5:	56                   	push   %esi
+    47a6:	6a 00                	push   $0x0
+    47a8:	e8 1e 01 00 00       	call   48cb <read>
+    if(cc < 1)
+    47ad:	83 c4 10             	add    $0x10,%esp
+    47b0:	85 c0                	test   %eax,%eax
+    47b2:	7e 1d                	jle    47d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    47b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    47b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    47bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    47bf:	3c 0a                	cmp    $0xa,%al
+    47c1:	74 10                	je     47d3 <gets+0x43>
+    47c3:	3c 0d                	cmp    $0xd,%al
+    47c5:	74 0c                	je     47d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    47c7:	89 df                	mov    %ebx,%edi
+    47c9:	83 c3 01             	add    $0x1,%ebx
+    47cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    47cf:	7c cf                	jl     47a0 <gets+0x10>
+    47d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    47d3:	8b 45 08             	mov    0x8(%ebp),%eax
+    47d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    47da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    47dd:	5b                   	pop    %ebx
+    47de:	5e                   	pop    %esi
+    47df:	5f                   	pop    %edi
+    47e0:	5d                   	pop    %ebp
+    47e1:	c3                   	ret
+    47e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    47e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000047f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    47f0:	55                   	push   %ebp
+    47f1:	89 e5                	mov    %esp,%ebp
+    47f3:	56                   	push   %esi
+    47f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    47f5:	83 ec 08             	sub    $0x8,%esp
+    47f8:	6a 00                	push   $0x0
+    47fa:	ff 75 08             	push   0x8(%ebp)
+    47fd:	e8 f1 00 00 00       	call   48f3 <open>
+  if(fd < 0)
+    4802:	83 c4 10             	add    $0x10,%esp
+    4805:	85 c0                	test   %eax,%eax
+    4807:	78 27                	js     4830 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    4809:	83 ec 08             	sub    $0x8,%esp
+    480c:	ff 75 0c             	push   0xc(%ebp)
+    480f:	89 c3                	mov    %eax,%ebx
+    4811:	50                   	push   %eax
+    4812:	e8 f4 00 00 00       	call   490b <fstat>
+  close(fd);
+    4817:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    481a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    481c:	e8 ba 00 00 00       	call   48db <close>
+  return r;
+    4821:	83 c4 10             	add    $0x10,%esp
+}
+    4824:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4827:	89 f0                	mov    %esi,%eax
+    4829:	5b                   	pop    %ebx
+    482a:	5e                   	pop    %esi
+    482b:	5d                   	pop    %ebp
+    482c:	c3                   	ret
+    482d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    4830:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    4835:	eb ed                	jmp    4824 <stat+0x34>
+    4837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    483e:	66 90                	xchg   %ax,%ax
+
+00004840 <atoi>:
+
+int
+atoi(const char *s)
+{
+    4840:	55                   	push   %ebp
+    4841:	89 e5                	mov    %esp,%ebp
+    4843:	53                   	push   %ebx
+    4844:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    4847:	0f be 02             	movsbl (%edx),%eax
+    484a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    484d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    4850:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    4855:	77 1e                	ja     4875 <atoi+0x35>
+    4857:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    485e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    4860:	83 c2 01             	add    $0x1,%edx
+    4863:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    4866:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    486a:	0f be 02             	movsbl (%edx),%eax
+    486d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    4870:	80 fb 09             	cmp    $0x9,%bl
+    4873:	76 eb                	jbe    4860 <atoi+0x20>
+  return n;
+}
+    4875:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4878:	89 c8                	mov    %ecx,%eax
+    487a:	c9                   	leave
+    487b:	c3                   	ret
+    487c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004880 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    4880:	55                   	push   %ebp
+    4881:	89 e5                	mov    %esp,%ebp
+    4883:	57                   	push   %edi
+    4884:	56                   	push   %esi
+    4885:	8b 45 10             	mov    0x10(%ebp),%eax
+    4888:	8b 55 08             	mov    0x8(%ebp),%edx
+    488b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    488e:	85 c0                	test   %eax,%eax
+    4890:	7e 13                	jle    48a5 <memmove+0x25>
+    4892:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    4894:	89 d7                	mov    %edx,%edi
+    4896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    489d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    48a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    48a1:	39 f8                	cmp    %edi,%eax
+    48a3:	75 fb                	jne    48a0 <memmove+0x20>
+  return vdst;
+}
+    48a5:	5e                   	pop    %esi
+    48a6:	89 d0                	mov    %edx,%eax
+    48a8:	5f                   	pop    %edi
+    48a9:	5d                   	pop    %ebp
+    48aa:	c3                   	ret
+
+000048ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    48ab:	b8 01 00 00 00       	mov    $0x1,%eax
+    48b0:	cd 40                	int    $0x40
+    48b2:	c3                   	ret
+
+000048b3 <exit>:
+SYSCALL(exit)
+    48b3:	b8 02 00 00 00       	mov    $0x2,%eax
+    48b8:	cd 40                	int    $0x40
+    48ba:	c3                   	ret
+
+000048bb <wait>:
+SYSCALL(wait)
+    48bb:	b8 03 00 00 00       	mov    $0x3,%eax
+    48c0:	cd 40                	int    $0x40
+    48c2:	c3                   	ret
+
+000048c3 <pipe>:
+SYSCALL(pipe)
+    48c3:	b8 04 00 00 00       	mov    $0x4,%eax
+    48c8:	cd 40                	int    $0x40
+    48ca:	c3                   	ret
+
+000048cb <read>:
+SYSCALL(read)
+    48cb:	b8 05 00 00 00       	mov    $0x5,%eax
+    48d0:	cd 40                	int    $0x40
+    48d2:	c3                   	ret
+
+000048d3 <write>:
+SYSCALL(write)
+    48d3:	b8 10 00 00 00       	mov    $0x10,%eax
+    48d8:	cd 40                	int    $0x40
+    48da:	c3                   	ret
+
+000048db <close>:
+SYSCALL(close)
+    48db:	b8 15 00 00 00       	mov    $0x15,%eax
+    48e0:	cd 40                	int    $0x40
+    48e2:	c3                   	ret
+
+000048e3 <kill>:
+SYSCALL(kill)
+    48e3:	b8 06 00 00 00       	mov    $0x6,%eax
+    48e8:	cd 40                	int    $0x40
+    48ea:	c3                   	ret
+
+000048eb <exec>:
+SYSCALL(exec)
+    48eb:	b8 07 00 00 00       	mov    $0x7,%eax
+    48f0:	cd 40                	int    $0x40
+    48f2:	c3                   	ret
+
+000048f3 <open>:
+SYSCALL(open)
+    48f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    48f8:	cd 40                	int    $0x40
+    48fa:	c3                   	ret
+
+000048fb <mknod>:
+SYSCALL(mknod)
+    48fb:	b8 11 00 00 00       	mov    $0x11,%eax
+    4900:	cd 40                	int    $0x40
+    4902:	c3                   	ret
+
+00004903 <unlink>:
+SYSCALL(unlink)
+    4903:	b8 12 00 00 00       	mov    $0x12,%eax
+    4908:	cd 40                	int    $0x40
+    490a:	c3                   	ret
+
+0000490b <fstat>:
+SYSCALL(fstat)
+    490b:	b8 08 00 00 00       	mov    $0x8,%eax
+    4910:	cd 40                	int    $0x40
+    4912:	c3                   	ret
+
+00004913 <link>:
+SYSCALL(link)
+    4913:	b8 13 00 00 00       	mov    $0x13,%eax
+    4918:	cd 40                	int    $0x40
+    491a:	c3                   	ret
+
+0000491b <mkdir>:
+SYSCALL(mkdir)
+    491b:	b8 14 00 00 00       	mov    $0x14,%eax
+    4920:	cd 40                	int    $0x40
+    4922:	c3                   	ret
+
+00004923 <chdir>:
+SYSCALL(chdir)
+    4923:	b8 09 00 00 00       	mov    $0x9,%eax
+    4928:	cd 40                	int    $0x40
+    492a:	c3                   	ret
+
+0000492b <dup>:
+SYSCALL(dup)
+    492b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    4930:	cd 40                	int    $0x40
+    4932:	c3                   	ret
+
+00004933 <getpid>:
+SYSCALL(getpid)
+    4933:	b8 0b 00 00 00       	mov    $0xb,%eax
+    4938:	cd 40                	int    $0x40
+    493a:	c3                   	ret
+
+0000493b <sbrk>:
+SYSCALL(sbrk)
+    493b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    4940:	cd 40                	int    $0x40
+    4942:	c3                   	ret
+
+00004943 <sleep>:
+SYSCALL(sleep)
+    4943:	b8 0d 00 00 00       	mov    $0xd,%eax
+    4948:	cd 40                	int    $0x40
+    494a:	c3                   	ret
+
+0000494b <uptime>:
+SYSCALL(uptime)
+    494b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    4950:	cd 40                	int    $0x40
+    4952:	c3                   	ret
+
+00004953 <settickets>:
+SYSCALL(settickets)
+    4953:	b8 16 00 00 00       	mov    $0x16,%eax
+    4958:	cd 40                	int    $0x40
+    495a:	c3                   	ret
+
+0000495b <getpinfo>:
+SYSCALL(getpinfo)
+    495b:	b8 17 00 00 00       	mov    $0x17,%eax
+    4960:	cd 40                	int    $0x40
+    4962:	c3                   	ret
+
+00004963 <mprotect>:
+SYSCALL(mprotect)
+    4963:	b8 18 00 00 00       	mov    $0x18,%eax
+    4968:	cd 40                	int    $0x40
+    496a:	c3                   	ret
+
+0000496b <munprotect>:
+SYSCALL(munprotect)
+    496b:	b8 19 00 00 00       	mov    $0x19,%eax
+    4970:	cd 40                	int    $0x40
+    4972:	c3                   	ret
+
+00004973 <clone>:
+SYSCALL(clone)
+    4973:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    4978:	cd 40                	int    $0x40
+    497a:	c3                   	ret
+
+0000497b <join>:
+SYSCALL(join)
+    497b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    4980:	cd 40                	int    $0x40
+    4982:	c3                   	ret
+
+00004983 <initlock_t>:
+SYSCALL(initlock_t)
+    4983:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    4988:	cd 40                	int    $0x40
+    498a:	c3                   	ret
+
+0000498b <acquire_t>:
+SYSCALL(acquire_t)
+    498b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    4990:	cd 40                	int    $0x40
+    4992:	c3                   	ret
+
+00004993 <release_t>:
+SYSCALL(release_t)
+    4993:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    4998:	cd 40                	int    $0x40
+    499a:	c3                   	ret
+
+0000499b <setsched>:
+SYSCALL(setsched)
+    499b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    49a0:	cd 40                	int    $0x40
+    49a2:	c3                   	ret
+
+000049a3 <mkgroup>:
+SYSCALL(mkgroup)
+    49a3:	b8 20 00 00 00       	mov    $0x20,%eax
+    49a8:	cd 40                	int    $0x40
+    49aa:	c3                   	ret
+
+000049ab <joingroup>:
+SYSCALL(joingroup)
+    49ab:	b8 21 00 00 00       	mov    $0x21,%eax
+    49b0:	cd 40                	int    $0x40
+    49b2:	c3                   	ret
+
+000049b3 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    49b3:	b8 22 00 00 00       	mov    $0x22,%eax
+    49b8:	cd 40                	int    $0x40
+    49ba:	c3                   	ret
+
+000049bb <setdeadline>:
+SYSCALL(setdeadline)
+    49bb:	b8 23 00 00 00       	mov    $0x23,%eax
+    49c0:	cd 40                	int    $0x40
+    49c2:	c3                   	ret
+
+000049c3 <setaffinity>:
+SYSCALL(setaffinity)
+    49c3:	b8 24 00 00 00       	mov    $0x24,%eax
+    49c8:	cd 40                	int    $0x40
+    49ca:	c3                   	ret
+
+000049cb <yield_to>:
+SYSCALL(yield_to)
+    49cb:	b8 25 00 00 00       	mov    $0x25,%eax
+    49d0:	cd 40                	int    $0x40
+    49d2:	c3                   	ret
+
+000049d3 <getlatency>:
+SYSCALL(getlatency)
+    49d3:	b8 26 00 00 00       	mov    $0x26,%eax
+    49d8:	cd 40                	int    $0x40
+    49da:	c3                   	ret
+
+000049db <futex_wait>:
+SYSCALL(futex_wait)
+    49db:	b8 27 00 00 00       	mov    $0x27,%eax
+    49e0:	cd 40                	int    $0x40
+    49e2:	c3                   	ret
+
+000049e3 <futex_wake>:
+SYSCALL(futex_wake)
+    49e3:	b8 28 00 00 00       	mov    $0x28,%eax
+    49e8:	cd 40                	int    $0x40
+    49ea:	c3                   	ret
+
+000049eb <mguard>:
+SYSCALL(mguard)
+    49eb:	b8 29 00 00 00       	mov    $0x29,%eax
+    49f0:	cd 40                	int    $0x40
+    49f2:	c3                   	ret
+
+000049f3 <join_any>:
+SYSCALL(join_any)
+    49f3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    49f8:	cd 40                	int    $0x40
+    49fa:	c3                   	ret
+    49fb:	66 90                	xchg   %ax,%ax
+    49fd:	66 90                	xchg   %ax,%ax
+    49ff:	90                   	nop
+
+00004a00 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4a00:	55                   	push   %ebp
+    4a01:	89 e5                	mov    %esp,%ebp
+    4a03:	57                   	push   %edi
+    4a04:	56                   	push   %esi
+    4a05:	53                   	push   %ebx
+    4a06:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    4a08:	89 d1                	mov    %edx,%ecx
+{
+    4a0a:	83 ec 3c             	sub    $0x3c,%esp
+    4a0d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    4a10:	85 d2                	test   %edx,%edx
+    4a12:	0f 89 80 00 00 00    	jns    4a98 <printint+0x98>
+    4a18:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    4a1c:	74 7a                	je     4a98 <printint+0x98>
+    x = -xx;
+    4a1e:	f7 d9                	neg    %ecx
+    neg = 1;
+    4a20:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4a25:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    4a28:	31 f6                	xor    %esi,%esi
+    4a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    4a30:	89 c8                	mov    %ecx,%eax
+    4a32:	31 d2                	xor    %edx,%edx
+    4a34:	89 f7                	mov    %esi,%edi
+    4a36:	f7 f3                	div    %ebx
+    4a38:	8d 76 01             	lea    0x1(%esi),%esi
+    4a3b:	0f b6 92 c0 65 00 00 	movzbl 0x65c0(%edx),%edx
+    4a42:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    4a46:	89 ca                	mov    %ecx,%edx
+    4a48:	89 c1                	mov    %eax,%ecx
+    4a4a:	39 da                	cmp    %ebx,%edx
+    4a4c:	73 e2                	jae    4a30 <printint+0x30>
+  if(neg)
+    4a4e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    4a51:	85 c0                	test   %eax,%eax
+    4a53:	74 07                	je     4a5c <printint+0x5c>
+    buf[i++] = '-';
+    4a55:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    4a5a:	89 f7                	mov    %esi,%edi
+    4a5c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    4a5f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    4a62:	01 df                	add    %ebx,%edi
+    4a64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    4a68:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    4a6b:	83 ec 04             	sub    $0x4,%esp
+    4a6e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    4a71:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    4a74:	6a 01                	push   $0x1
+    4a76:	50                   	push   %eax
+    4a77:	56                   	push   %esi
+    4a78:	e8 56 fe ff ff       	call   48d3 <write>
+  while(--i >= 0)
+    4a7d:	89 f8                	mov    %edi,%eax
+    4a7f:	83 c4 10             	add    $0x10,%esp
+    4a82:	83 ef 01             	sub    $0x1,%edi
+    4a85:	39 d8                	cmp    %ebx,%eax
+    4a87:	75 df                	jne    4a68 <printint+0x68>
+}
+    4a89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4a8c:	5b                   	pop    %ebx
+    4a8d:	5e                   	pop    %esi
+    4a8e:	5f                   	pop    %edi
+    4a8f:	5d                   	pop    %ebp
+    4a90:	c3                   	ret
+    4a91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    4a98:	31 c0                	xor    %eax,%eax
+    4a9a:	eb 89                	jmp    4a25 <printint+0x25>
+    4a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004aa0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    4aa0:	55                   	push   %ebp
+    4aa1:	89 e5                	mov    %esp,%ebp
+    4aa3:	57                   	push   %edi
+    4aa4:	56                   	push   %esi
+    4aa5:	53                   	push   %ebx
+    4aa6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    4aa9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    4aac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    4aaf:	0f b6 1e             	movzbl (%esi),%ebx
+    4ab2:	83 c6 01             	add    $0x1,%esi
+    4ab5:	84 db                	test   %bl,%bl
+    4ab7:	74 67                	je     4b20 <printf+0x80>
+    4ab9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    4abc:	31 d2                	xor    %edx,%edx
+    4abe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    4ac1:	eb 34                	jmp    4af7 <printf+0x57>
+    4ac3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4ac7:	90                   	nop
+    4ac8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    4acb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    4ad0:	83 f8 25             	cmp    $0x25,%eax
+    4ad3:	74 18                	je     4aed <printf+0x4d>
+  write(fd, &c, 1);
+    4ad5:	83 ec 04             	sub    $0x4,%esp
+    4ad8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    4adb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4ade:	6a 01                	push   $0x1
+    4ae0:	50                   	push   %eax
+    4ae1:	57                   	push   %edi
+    4ae2:	e8 ec fd ff ff       	call   48d3 <write>
+    4ae7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    4aea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    4aed:	0f b6 1e             	movzbl (%esi),%ebx
+    4af0:	83 c6 01             	add    $0x1,%esi
+    4af3:	84 db                	test   %bl,%bl
+    4af5:	74 29                	je     4b20 <printf+0x80>
+    c = fmt[i] & 0xff;
+    4af7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    4afa:	85 d2                	test   %edx,%edx
+    4afc:	74 ca                	je     4ac8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    4afe:	83 fa 25             	cmp    $0x25,%edx
+    4b01:	75 ea                	jne    4aed <printf+0x4d>
+      if(c == 'd'){
+    4b03:	83 f8 25             	cmp    $0x25,%eax
+    4b06:	0f 84 24 01 00 00    	je     4c30 <printf+0x190>
+    4b0c:	83 e8 63             	sub    $0x63,%eax
+    4b0f:	83 f8 15             	cmp    $0x15,%eax
+    4b12:	77 1c                	ja     4b30 <printf+0x90>
+    4b14:	ff 24 85 68 65 00 00 	jmp    *0x6568(,%eax,4)
+    4b1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4b1f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    4b20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4b23:	5b                   	pop    %ebx
+    4b24:	5e                   	pop    %esi
+    4b25:	5f                   	pop    %edi
+    4b26:	5d                   	pop    %ebp
+    4b27:	c3                   	ret
+    4b28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4b2f:	90                   	nop
+  write(fd, &c, 1);
+    4b30:	83 ec 04             	sub    $0x4,%esp
+    4b33:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4b36:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    4b3a:	6a 01                	push   $0x1
+    4b3c:	52                   	push   %edx
+    4b3d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    4b40:	57                   	push   %edi
+    4b41:	e8 8d fd ff ff       	call   48d3 <write>
+    4b46:	83 c4 0c             	add    $0xc,%esp
+    4b49:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4b4c:	6a 01                	push   $0x1
+    4b4e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    4b51:	52                   	push   %edx
+    4b52:	57                   	push   %edi
+    4b53:	e8 7b fd ff ff       	call   48d3 <write>
+        putc(fd, c);
+    4b58:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4b5b:	31 d2                	xor    %edx,%edx
+    4b5d:	eb 8e                	jmp    4aed <printf+0x4d>
+    4b5f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    4b60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4b63:	83 ec 0c             	sub    $0xc,%esp
+    4b66:	b9 10 00 00 00       	mov    $0x10,%ecx
+    4b6b:	8b 13                	mov    (%ebx),%edx
+    4b6d:	6a 00                	push   $0x0
+    4b6f:	89 f8                	mov    %edi,%eax
+        ap++;
+    4b71:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    4b74:	e8 87 fe ff ff       	call   4a00 <printint>
+        ap++;
+    4b79:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4b7c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4b7f:	31 d2                	xor    %edx,%edx
+    4b81:	e9 67 ff ff ff       	jmp    4aed <printf+0x4d>
+    4b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4b8d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    4b90:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    4b93:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    4b95:	83 c0 04             	add    $0x4,%eax
+    4b98:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    4b9b:	85 db                	test   %ebx,%ebx
+    4b9d:	0f 84 9d 00 00 00    	je     4c40 <printf+0x1a0>
+        while(*s != 0){
+    4ba3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    4ba6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    4ba8:	84 c0                	test   %al,%al
+    4baa:	0f 84 3d ff ff ff    	je     4aed <printf+0x4d>
+    4bb0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4bb3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    4bb6:	89 de                	mov    %ebx,%esi
+    4bb8:	89 d3                	mov    %edx,%ebx
+    4bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    4bc0:	83 ec 04             	sub    $0x4,%esp
+    4bc3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    4bc6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    4bc9:	6a 01                	push   $0x1
+    4bcb:	53                   	push   %ebx
+    4bcc:	57                   	push   %edi
+    4bcd:	e8 01 fd ff ff       	call   48d3 <write>
+        while(*s != 0){
+    4bd2:	0f b6 06             	movzbl (%esi),%eax
+    4bd5:	83 c4 10             	add    $0x10,%esp
+    4bd8:	84 c0                	test   %al,%al
+    4bda:	75 e4                	jne    4bc0 <printf+0x120>
+      state = 0;
+    4bdc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    4bdf:	31 d2                	xor    %edx,%edx
+    4be1:	e9 07 ff ff ff       	jmp    4aed <printf+0x4d>
+    4be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4bed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    4bf0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4bf3:	83 ec 0c             	sub    $0xc,%esp
+    4bf6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    4bfb:	8b 13                	mov    (%ebx),%edx
+    4bfd:	6a 01                	push   $0x1
+    4bff:	e9 6b ff ff ff       	jmp    4b6f <printf+0xcf>
+    4c04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4c08:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    4c0b:	83 ec 04             	sub    $0x4,%esp
+    4c0e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4c11:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4c13:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4c16:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4c19:	6a 01                	push   $0x1
+    4c1b:	52                   	push   %edx
+    4c1c:	57                   	push   %edi
+    4c1d:	e8 b1 fc ff ff       	call   48d3 <write>
+        ap++;
+    4c22:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4c25:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4c28:	31 d2                	xor    %edx,%edx
+    4c2a:	e9 be fe ff ff       	jmp    4aed <printf+0x4d>
+    4c2f:	90                   	nop
+  write(fd, &c, 1);
+    4c30:	83 ec 04             	sub    $0x4,%esp
+    4c33:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4c36:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4c39:	6a 01                	push   $0x1
+    4c3b:	e9 11 ff ff ff       	jmp    4b51 <printf+0xb1>
+    4c40:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4c45:	bb 5e 65 00 00       	mov    $0x655e,%ebx
+    4c4a:	e9 61 ff ff ff       	jmp    4bb0 <printf+0x110>
+    4c4f:	90                   	nop
+
+00004c50 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4c50:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4c51:	a1 60 b6 00 00       	mov    0xb660,%eax
+{
+    4c56:	89 e5                	mov    %esp,%ebp
+    4c58:	57                   	push   %edi
+    4c59:	56                   	push   %esi
+    4c5a:	53                   	push   %ebx
+    4c5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    4c5e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4c61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4c68:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4c6a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4c6c:	39 ca                	cmp    %ecx,%edx
+    4c6e:	73 30                	jae    4ca0 <free+0x50>
+    4c70:	39 c1                	cmp    %eax,%ecx
+    4c72:	72 04                	jb     4c78 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4c74:	39 c2                	cmp    %eax,%edx
+    4c76:	72 f0                	jb     4c68 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4c78:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    4c7b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    4c7e:	39 f8                	cmp    %edi,%eax
+    4c80:	74 2e                	je     4cb0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4c82:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    4c85:	8b 42 04             	mov    0x4(%edx),%eax
+    4c88:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4c8b:	39 f1                	cmp    %esi,%ecx
+    4c8d:	74 38                	je     4cc7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    4c8f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    4c91:	5b                   	pop    %ebx
+  freep = p;
+    4c92:	89 15 60 b6 00 00    	mov    %edx,0xb660
+}
+    4c98:	5e                   	pop    %esi
+    4c99:	5f                   	pop    %edi
+    4c9a:	5d                   	pop    %ebp
+    4c9b:	c3                   	ret
+    4c9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4ca0:	39 c1                	cmp    %eax,%ecx
+    4ca2:	72 d0                	jb     4c74 <free+0x24>
+    4ca4:	eb c2                	jmp    4c68 <free+0x18>
+    4ca6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4cad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    4cb0:	03 70 04             	add    0x4(%eax),%esi
+    4cb3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4cb6:	8b 02                	mov    (%edx),%eax
+    4cb8:	8b 00                	mov    (%eax),%eax
+    4cba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    4cbd:	8b 42 04             	mov    0x4(%edx),%eax
+    4cc0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4cc3:	39 f1                	cmp    %esi,%ecx
+    4cc5:	75 c8                	jne    4c8f <free+0x3f>
+    p->s.size += bp->s.size;
+    4cc7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    4cca:	89 15 60 b6 00 00    	mov    %edx,0xb660
+    p->s.size += bp->s.size;
+    4cd0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4cd3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    4cd6:	89 0a                	mov    %ecx,(%edx)
+}
+    4cd8:	5b                   	pop    %ebx
+    4cd9:	5e                   	pop    %esi
+    4cda:	5f                   	pop    %edi
+    4cdb:	5d                   	pop    %ebp
+    4cdc:	c3                   	ret
+    4cdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004ce0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    4ce0:	55                   	push   %ebp
+    4ce1:	89 e5                	mov    %esp,%ebp
+    4ce3:	57                   	push   %edi
+    4ce4:	56                   	push   %esi
+    4ce5:	53                   	push   %ebx
+    4ce6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    4cec:	8b 15 60 b6 00 00    	mov    0xb660,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4cf2:	8d 78 07             	lea    0x7(%eax),%edi
+    4cf5:	c1 ef 03             	shr    $0x3,%edi
+    4cf8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    4cfb:	85 d2                	test   %edx,%edx
+    4cfd:	0f 84 8d 00 00 00    	je     4d90 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4d03:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4d05:	8b 48 04             	mov    0x4(%eax),%ecx
+    4d08:	39 f9                	cmp    %edi,%ecx
+    4d0a:	73 64                	jae    4d70 <malloc+0x90>
+  if(nu < 4096)
+    4d0c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4d11:	39 df                	cmp    %ebx,%edi
+    4d13:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4d16:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    4d1d:	eb 0a                	jmp    4d29 <malloc+0x49>
+    4d1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4d20:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4d22:	8b 48 04             	mov    0x4(%eax),%ecx
+    4d25:	39 f9                	cmp    %edi,%ecx
+    4d27:	73 47                	jae    4d70 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4d29:	89 c2                	mov    %eax,%edx
+    4d2b:	39 05 60 b6 00 00    	cmp    %eax,0xb660
+    4d31:	75 ed                	jne    4d20 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    4d33:	83 ec 0c             	sub    $0xc,%esp
+    4d36:	56                   	push   %esi
+    4d37:	e8 ff fb ff ff       	call   493b <sbrk>
+  if(p == (char*)-1)
+    4d3c:	83 c4 10             	add    $0x10,%esp
+    4d3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4d42:	74 1c                	je     4d60 <malloc+0x80>
+  hp->s.size = nu;
+    4d44:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4d47:	83 ec 0c             	sub    $0xc,%esp
+    4d4a:	83 c0 08             	add    $0x8,%eax
+    4d4d:	50                   	push   %eax
+    4d4e:	e8 fd fe ff ff       	call   4c50 <free>
+  return freep;
+    4d53:	8b 15 60 b6 00 00    	mov    0xb660,%edx
+      if((p = morecore(nunits)) == 0)
+    4d59:	83 c4 10             	add    $0x10,%esp
+    4d5c:	85 d2                	test   %edx,%edx
+    4d5e:	75 c0                	jne    4d20 <malloc+0x40>
+        return 0;
+  }
+}
+    4d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4d63:	31 c0                	xor    %eax,%eax
+}
+    4d65:	5b                   	pop    %ebx
+    4d66:	5e                   	pop    %esi
+    4d67:	5f                   	pop    %edi
+    4d68:	5d                   	pop    %ebp
+    4d69:	c3                   	ret
+    4d6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    4d70:	39 cf                	cmp    %ecx,%edi
+    4d72:	74 4c                	je     4dc0 <malloc+0xe0>
+        p->s.size -= nunits;
+    4d74:	29 f9                	sub    %edi,%ecx
+    4d76:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    4d79:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    4d7c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    4d7f:	89 15 60 b6 00 00    	mov    %edx,0xb660
+}
+    4d85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    4d88:	83 c0 08             	add    $0x8,%eax
+}
+    4d8b:	5b                   	pop    %ebx
+    4d8c:	5e                   	pop    %esi
+    4d8d:	5f                   	pop    %edi
+    4d8e:	5d                   	pop    %ebp
+    4d8f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    4d90:	c7 05 60 b6 00 00 64 	movl   $0xb664,0xb660
+    4d97:	b6 00 00 
+    base.s.size = 0;
+    4d9a:	b8 64 b6 00 00       	mov    $0xb664,%eax
+    base.s.ptr = freep = prevp = &base;
+    4d9f:	c7 05 64 b6 00 00 64 	movl   $0xb664,0xb664
+    4da6:	b6 00 00 
+    base.s.size = 0;
+    4da9:	c7 05 68 b6 00 00 00 	movl   $0x0,0xb668
+    4db0:	00 00 00 
+    if(p->s.size >= nunits){
+    4db3:	e9 54 ff ff ff       	jmp    4d0c <malloc+0x2c>
+    4db8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4dbf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    4dc0:	8b 08                	mov    (%eax),%ecx
+    4dc2:	89 0a                	mov    %ecx,(%edx)
+    4dc4:	eb b9                	jmp    4d7f <malloc+0x9f>
@@ -0,0 +1,263 @@
+// Thread library: threads made with clone(), their stacks,
+// and the locks and other synchronization they share.
+// Linked only into the programs that use threads.
+
+#include "types.h"
+#include "user.h"
+#include "x86.h"
+#include "param.h"
+#include "ticketlock.h"
+#include "tsync.h"
+#include "clone.h"
+#define PGSIZE  4096
+
+// Thread stacks.  Each stack is TSTACKPAGES pages with an
+// unmapped guard page below it, so running off the bottom
+// faults.  clone() is handed the top page of the stack and
+// join() gives it back; joined stacks are kept in a pool,
+// linked through their top pages, for the next thread.
+// Stacks of detached threads come back from join_any().
+#define TSTACKPAGES 4
+#define NREAP 8
+
+static struct ticketlock stacklock;
+static void *stackpool;
+
+static void *stack_alloc(void)
+{
+	char *p;
+	int pids[NREAP];
+	void *stacks[NREAP];
+	int i, n;
+
+	lock_acquire(&stacklock);
+	if(stackpool == 0){
+		n = join_any(pids, stacks, NREAP, JOIN_NOHANG | JOIN_DETACHED);
+		for(i = 0; i < n; i++){
+			*(void**)stacks[i] = stackpool;
+			stackpool = stacks[i];
+		}
+	}
+	if((p = stackpool) != 0){
+		stackpool = *(void**)p;
+		lock_release(&stacklock);
+		return p;
+	}
+	// Other threads may grow the heap too, so align within what
+	// this sbrk() returned, which is one page more than needed.
+	if((p = sbrk((TSTACKPAGES + 2) * PGSIZE)) == (char*)-1){
+		lock_release(&stacklock);
+		return 0;
+	}
+	p += (PGSIZE - (uint)p % PGSIZE) % PGSIZE;
+	mguard(p, 1);
+	lock_release(&stacklock);
+	return p + TSTACKPAGES * PGSIZE;
+}
+
+static void stack_free(void *stack)
+{
+	lock_acquire(&stacklock);
+	*(void**)stack = stackpool;
+	stackpool = stack;
+	lock_release(&stacklock);
+}
+
+// Threads share the memory, open files and current directory
+// of the thread that made them.
+static int thread_clone(void (*start_routine)(void*, void*), void *arg1, void *arg2, int flags)
+{
+	void *stack = stack_alloc();
+	int pid;
+
+	if(stack == 0)
+		return -1;
+	if((pid = clone(start_routine, arg1, arg2, stack, flags | CLONE_FILES | CLONE_FS)) < 0)
+		stack_free(stack);
+	return pid;
+}
+
+int thread_create(void (*start_routine)(void*, void*), void *arg1, void *arg2)
+{
+	return thread_clone(start_routine, arg1, arg2, 0);
+}
+
+// A detached thread is never joined: the kernel frees it as
+// soon as it exits, and its stack is reused by a later thread.
+int thread_create_detached(void (*start_routine)(void*, void*), void *arg1, void *arg2)
+{
+	return thread_clone(start_routine, arg1, arg2, CLONE_DETACHED);
+}
+
+int thread_join()
+{
+  	void *stack;
+  	int result = join(&stack);	
+  	if(result > 0 && stack)
+  		stack_free(stack);
+  	return result;
+}
+
+// Join up to n exited threads at once, waiting for at least
+// one, and store their pids in pids[].  Returns how many were
+// joined, or -1 if there are no threads left to join.
+int thread_join_many(int *pids, int n)
+{
+	void *stacks[NREAP];
+	int got[NREAP];
+	int i, k, r;
+
+	for(k = 0; k == 0; ){
+		if((r = join_any(got, stacks, n < NREAP ? n : NREAP, 0)) < 0)
+			return -1;
+		for(i = 0; i < r; i++){
+			if(got[i] != 0)
+				pids[k++] = got[i];
+			stack_free(stacks[i]);
+		}
+	}
+	return k;
+}
+
+// ticket lock, on futexes
+// Taking or releasing a free lock is one atomic add and no
+// system call.  A thread that has to wait for its turn sleeps
+// in futex_wait() on the word of turnwait[] that the lock and
+// its ticket hash to, so a release wakes only the next holder
+// (and whoever shares its word) rather than every waiter.
+#define NTURNWAIT 64
+static int turnwait[NTURNWAIT];
+
+static int *turnslot(struct ticketlock *lock, int ticket)
+{
+    return &turnwait[((uint)lock / sizeof(int) + ticket) % NTURNWAIT];
+}
+
+void lock_init(struct ticketlock *lock)
+{
+    lock->next_ticket = 0;
+    lock->current_turn = 0;
+    lock->pid = 0;
+}
+
+void lock_acquire(struct ticketlock *lock)
+{
+    int myTicket = fetch_and_add(&lock->next_ticket, 1);
+    int *w = turnslot(lock, myTicket);
+    int seq;
+
+    for(;;){
+        seq = *(volatile int*)w;
+        if(*(volatile int*)&lock->current_turn == myTicket)
+            break;
+        futex_wait(w, seq);
+    }
+}
+
+void lock_release(struct ticketlock *lock)
+{
+    int turn = fetch_and_add(&lock->current_turn, 1) + 1;
+    int *w;
+
+    // Only bump and wake the next ticket's word if someone
+    // holds that ticket; it may or may not be asleep yet.
+    if (turn != *(volatile int*)&lock->next_ticket){
+        w = turnslot(lock, turn);
+        fetch_and_add(w, 1);
+        futex_wake(w, NPROC);
+    }
+}
+
+// Sleep on *addr while it still holds val, counted in *nwait
+// so that wakers can skip futex_wake() when nobody sleeps.
+static void futex_sleep(int *addr, int val, int *nwait)
+{
+    fetch_and_add(nwait, 1);
+    futex_wait(addr, val);
+    fetch_and_add(nwait, -1);
+}
+
+// reader-writer lock
+void rw_rdlock(struct rwlock *rw)
+{
+    int s;
+
+    for(;;){
+        s = *(volatile int*)&rw->state;
+        if(s >= 0 && *(volatile int*)&rw->wwait == 0 && cas(&rw->state, s, s + 1))
+            return;
+        futex_sleep(&rw->state, s, &rw->nwait);
+    }
+}
+
+void rw_wrlock(struct rwlock *rw)
+{
+    int s;
+
+    fetch_and_add(&rw->wwait, 1);
+    while(!cas(&rw->state, 0, -1)){
+        if((s = *(volatile int*)&rw->state) != 0)
+            futex_sleep(&rw->state, s, &rw->nwait);
+    }
+    fetch_and_add(&rw->wwait, -1);
+}
+
+void rw_unlock(struct rwlock *rw)
+{
+    if(rw->state < 0)
+        xchg((uint*)&rw->state, 0);
+    else
+        fetch_and_add(&rw->state, -1);
+    if(*(volatile int*)&rw->nwait)
+        futex_wake(&rw->state, NPROC);
+}
+
+// condition variable
+void cond_wait(struct cond *cv, struct ticketlock *lock)
+{
+    int s = *(volatile int*)&cv->seq;
+
+    fetch_and_add(&cv->nwait, 1);
+    lock_release(lock);
+    futex_wait(&cv->seq, s);
+    fetch_and_add(&cv->nwait, -1);
+    lock_acquire(lock);
+}
+
+void cond_signal(struct cond *cv)
+{
+    fetch_and_add(&cv->seq, 1);
+    if(*(volatile int*)&cv->nwait)
+        futex_wake(&cv->seq, 1);
+}
+
+void cond_broadcast(struct cond *cv)
+{
+    fetch_and_add(&cv->seq, 1);
+    if(*(volatile int*)&cv->nwait)
+        futex_wake(&cv->seq, NPROC);
+}
+
+// barrier
+void barrier_init(struct barrier *b, int n)
+{
+    b->n = n;
+    b->count = 0;
+    b->gen = 0;
+}
+
+// The last thread to arrive starts the next round and
+// wakes the others, who sleep until the round changes.
+void barrier_wait(struct barrier *b)
+{
+    int gen = *(volatile int*)&b->gen;
+
+    if(fetch_and_add(&b->count, 1) + 1 == b->n){
+        b->count = 0;
+        fetch_and_add(&b->gen, 1);
+        futex_wake(&b->gen, NPROC);
+        return;
+    }
+    while(*(volatile int*)&b->gen == gen)
+        futex_wait(&b->gen, gen);
+}
@@ -5,7 +5,11 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "mm.h"
 #include "elf.h"
+#include "traps.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
@@ -160,7 +164,7 @@ switchuvm(struct proc *p)
     panic("switchuvm: no process");
   if(p->kstack == 0)
     panic("switchuvm: no kstack");
-  if(p->pgdir == 0)
+  if(p->mm == 0 || p->mm->pgdir == 0)
     panic("switchuvm: no pgdir");
 
   pushcli();
@@ -173,7 +177,7 @@ switchuvm(struct proc *p)
   // forbids I/O instructions (e.g., inb and outb) from user space
   mycpu()->ts.iomb = (ushort) 0xFFFF;
   ltr(SEG_TSS << 3);
-  lcr3(V2P(p->pgdir));  // switch to process's address space
+  lcr3(V2P(p->mm->pgdir));  // switch to process's address space
   popcli();
 }
 
@@ -278,6 +282,72 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   return newsz;
 }
 
+// Make every CPU that may have mm's translations cached
+// flush its TLB, and wait until all of them have.  Other
+// CPUs only need it while running one of mm's threads.
+void
+tlbshootdown(struct mm *mm)
+{
+  uint seen[NCPU];
+  int i, me, sent[NCPU];
+  struct proc *p;
+
+  pushcli();
+  me = cpuid();
+  lcr3(rcr3());
+  for(i = 0; i < ncpu; i++){
+    seen[i] = cpus[i].tlbflushes;
+    p = cpus[i].proc;
+    sent[i] = i != me && p && p->mm == mm;
+    if(sent[i])
+      lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_TLB);
+  }
+  popcli();
+  // Wait with interrupts on, in case a target is shooting at us.
+  for(i = 0; i < ncpu; i++)
+    while(sent[i] && cpus[i].tlbflushes == seen[i])
+      ;
+}
+
+// Shrink mm from oldsz to newsz while its other threads may be
+// running: lower mm->sz, unmap the pages, shoot down every TLB
+// that may still map them, and only then free them.  The caller
+// holds mm->vmlock.
+void
+shrinkuvm(struct mm *mm, uint oldsz, uint newsz)
+{
+  pte_t *pte;
+  uint a;
+  char *v, *freed;
+
+  if(newsz >= oldsz)
+    return;
+  acquire(&mm->lock);
+  mm->sz = newsz;
+  release(&mm->lock);
+
+  freed = 0;
+  a = PGROUNDUP(newsz);
+  for(; a < oldsz; a += PGSIZE){
+    pte = walkpgdir(mm->pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if((*pte & PTE_P) != 0){
+      if(PTE_ADDR(*pte) == 0)
+        panic("kfree");
+      v = P2V(PTE_ADDR(*pte));
+      *pte = 0;
+      *(char**)v = freed;
+      freed = v;
+    }
+  }
+  tlbshootdown(mm);
+  while((v = freed) != 0){
+    freed = *(char**)v;
+    kfree(v);
+  }
+}
+
 // Free a page table and all the physical memory pages
 // in the user part.
 void
@@ -297,6 +367,81 @@ freevm(pde_t *pgdir)
   kfree((char*)pgdir);
 }
 
+// Address spaces not in use, carved from pages as needed.
+static struct {
+  struct spinlock lock;
+  struct mm *free;
+} mmcache;
+
+void
+mminit(void)
+{
+  initlock(&mmcache.lock, "mmcache");
+}
+
+// Make an address space of sz bytes mapped by pgdir,
+// with one reference.  Returns 0 if out of memory.
+struct mm*
+mmalloc(pde_t *pgdir, uint sz)
+{
+  struct mm *mm;
+  char *page;
+  int i;
+
+  acquire(&mmcache.lock);
+  if(mmcache.free == 0){
+    if((page = kalloc()) == 0){
+      release(&mmcache.lock);
+      return 0;
+    }
+    memset(page, 0, PGSIZE);
+    for(i = 0; i < PGSIZE/sizeof(*mm); i++){
+      mm = (struct mm*)page + i;
+      mm->next = mmcache.free;
+      mmcache.free = mm;
+    }
+  }
+  mm = mmcache.free;
+  mmcache.free = mm->next;
+  release(&mmcache.lock);
+
+  initlock(&mm->lock, "mm");
+  initsleeplock(&mm->vmlock, "mmvm");
+  mm->pgdir = pgdir;
+  mm->sz = sz;
+  mm->ref = 1;
+  mm->deadstacks = 0;
+  return mm;
+}
+
+// Add a reference to mm, for a new thread.
+void
+mmdup(struct mm *mm)
+{
+  acquire(&mm->lock);
+  mm->ref++;
+  release(&mm->lock);
+}
+
+// Drop a reference to mm, freeing it and its memory
+// with the last.  The caller must not be running on it.
+void
+mmput(struct mm *mm)
+{
+  int ref;
+
+  acquire(&mm->lock);
+  ref = --mm->ref;
+  release(&mm->lock);
+  if(ref > 0)
+    return;
+  freevm(mm->pgdir);
+  acquire(&mmcache.lock);
+  mm->next = mmcache.free;
+  mmcache.free = mm;
+  release(&mmcache.lock);
+}
+
 // Clear PTE_U on a page. Used to create an inaccessible
 // page beneath the user stack.
 void
@@ -391,7 +536,7 @@ mprotect(void *addr, int len){
   struct proc *curproc = myproc();
   
   //Check if addr points to a region that is not currently a part of the address space
-  if(len <= 0 || (int)addr+len*PGSIZE > curproc->sz){ 
+  if(len <= 0 || (int)addr+len*PGSIZE > curproc->mm->sz){ 
     cprintf("\nwrong len\n");
     return -1;
   }
@@ -408,7 +553,7 @@ mprotect(void *addr, int len){
   for (i = (int) addr; i < ((int) addr + (len) *PGSIZE); i+= PGSIZE){
     // Getting the address of the PTE in the current process's page table (pgdir)
     // that corresponds to virtual address (i)
-    pte = walkpgdir(curproc->pgdir,(void*) i, 0);
+    pte = walkpgdir(curproc->mm->pgdir,(void*) i, 0);
     if(pte && ((*pte & PTE_U) != 0) && ((*pte & PTE_P) != 0) ){//make sure user && present 
       *pte = (*pte) & (~PTE_W) ; //Clearing the write bit 
       cprintf("PTE : 0x%p\n", pte);
@@ -418,17 +563,38 @@ mprotect(void *addr, int len){
   }
   //Reloading the Control register 3 with the address of page directory 
   //to flush TLB
-  lcr3(V2P(curproc->pgdir));  
+  lcr3(V2P(curproc->mm->pgdir));  
 return 0;
 }
 
+//mguard system call makes pages inaccessible from user mode, e.g. as a guard
+//page below a thread stack, so that overflowing the stack faults instead of
+//silently corrupting the memory below it
+int
+mguard(void *addr, int len){
+  struct proc *curproc = myproc();
+  pte_t *pte;
+  int i;
+
+  if(len <= 0 || (int)addr+len*PGSIZE > curproc->mm->sz || (int)addr % PGSIZE != 0)
+    return -1;
+  for (i = (int) addr; i < ((int) addr + len*PGSIZE); i += PGSIZE){
+    pte = walkpgdir(curproc->mm->pgdir, (void*) i, 0);
+    if(pte == 0 || (*pte & PTE_P) == 0)
+      return -1;
+    *pte &= ~PTE_U;
+  }
+  tlbshootdown(curproc->mm);
+  return 0;
+}
+
 //mprotect system call makes page table entries both readable and writable
 int
 munprotect(void *addr, int len){
   struct proc *curproc = myproc();
   
   //Check if addr points to a region that is not currently a part of the address space
-  if(len <= 0 || (int)addr+len*PGSIZE>curproc->sz){
+  if(len <= 0 || (int)addr+len*PGSIZE>curproc->mm->sz){
     cprintf("\nwrong len\n");
     return -1;
   }
@@ -445,7 +611,7 @@ munprotect(void *addr, int len){
   for (i = (int) addr; i < ((int) addr + (len) *PGSIZE); i+= PGSIZE){
     // Getting the address of the PTE in the current process's page table (pgdir)
     // that corresponds to virtual address (i)
-    pte = walkpgdir(curproc->pgdir,(void*) i, 0);
+    pte = walkpgdir(curproc->mm->pgdir,(void*) i, 0);
     if(pte && ((*pte & PTE_U) != 0) && ((*pte & PTE_P) != 0) ){
       *pte = (*pte) | (PTE_W) ; //Setting the write bit 
       cprintf("PTE : 0x%p\n", pte);
@@ -456,7 +622,7 @@ munprotect(void *addr, int len){
 
   //Reloading the Control register 3 with the address of page directory 
 
-  lcr3(V2P(curproc->pgdir));
+  lcr3(V2P(curproc->mm->pgdir));
  /* after changing a page-table entry, you need to make sure the hardware knows of the change.
     On 32-bit x86, this is readily accomplished by updating the CR3 register (what we generically call the page-table 
     base register in class). When the hardware sees that you overwrote CR3 (even with the same value), 
@@ -0,0 +1,1393 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	be 01 00 00 00       	mov    $0x1,%esi
+    1014:	53                   	push   %ebx
+    1015:	51                   	push   %ecx
+    1016:	83 ec 18             	sub    $0x18,%esp
+    1019:	8b 01                	mov    (%ecx),%eax
+    101b:	8b 59 04             	mov    0x4(%ecx),%ebx
+    101e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1021:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+    1024:	83 f8 01             	cmp    $0x1,%eax
+    1027:	7f 28                	jg     1051 <main+0x51>
+    1029:	eb 54                	jmp    107f <main+0x7f>
+    102b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    102f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+    1030:	83 ec 08             	sub    $0x8,%esp
+    1033:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+    1035:	83 c6 01             	add    $0x1,%esi
+    1038:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+    103b:	50                   	push   %eax
+    103c:	e8 5f 00 00 00       	call   10a0 <wc>
+    close(fd);
+    1041:	89 3c 24             	mov    %edi,(%esp)
+    1044:	e8 a2 03 00 00       	call   13eb <close>
+  for(i = 1; i < argc; i++){
+    1049:	83 c4 10             	add    $0x10,%esp
+    104c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+    104f:	74 29                	je     107a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+    1051:	83 ec 08             	sub    $0x8,%esp
+    1054:	6a 00                	push   $0x0
+    1056:	ff 33                	push   (%ebx)
+    1058:	e8 a6 03 00 00       	call   1403 <open>
+    105d:	83 c4 10             	add    $0x10,%esp
+    1060:	89 c7                	mov    %eax,%edi
+    1062:	85 c0                	test   %eax,%eax
+    1064:	79 ca                	jns    1030 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+    1066:	50                   	push   %eax
+    1067:	ff 33                	push   (%ebx)
+    1069:	68 fb 18 00 00       	push   $0x18fb
+    106e:	6a 01                	push   $0x1
+    1070:	e8 3b 05 00 00       	call   15b0 <printf>
+      exit();
+    1075:	e8 49 03 00 00       	call   13c3 <exit>
+  }
+  exit();
+    107a:	e8 44 03 00 00       	call   13c3 <exit>
+    wc(0, "");
+    107f:	52                   	push   %edx
+    1080:	52                   	push   %edx
+    1081:	68 ed 18 00 00       	push   $0x18ed
+    1086:	6a 00                	push   $0x0
+    1088:	e8 13 00 00 00       	call   10a0 <wc>
+    exit();
+    108d:	e8 31 03 00 00       	call   13c3 <exit>
+    1092:	66 90                	xchg   %ax,%ax
+    1094:	66 90                	xchg   %ax,%ax
+    1096:	66 90                	xchg   %ax,%ax
+    1098:	66 90                	xchg   %ax,%ax
+    109a:	66 90                	xchg   %ax,%ax
+    109c:	66 90                	xchg   %ax,%ax
+    109e:	66 90                	xchg   %ax,%ax
+
+000010a0 <wc>:
+{
+    10a0:	55                   	push   %ebp
+  l = w = c = 0;
+    10a1:	31 d2                	xor    %edx,%edx
+{
+    10a3:	89 e5                	mov    %esp,%ebp
+    10a5:	57                   	push   %edi
+    10a6:	56                   	push   %esi
+  inword = 0;
+    10a7:	31 f6                	xor    %esi,%esi
+{
+    10a9:	53                   	push   %ebx
+  l = w = c = 0;
+    10aa:	31 db                	xor    %ebx,%ebx
+{
+    10ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+    10af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+    10b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    10b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    10c0:	83 ec 04             	sub    $0x4,%esp
+    10c3:	68 00 02 00 00       	push   $0x200
+    10c8:	68 60 1c 00 00       	push   $0x1c60
+    10cd:	ff 75 08             	push   0x8(%ebp)
+    10d0:	e8 06 03 00 00       	call   13db <read>
+    10d5:	83 c4 10             	add    $0x10,%esp
+    10d8:	89 c1                	mov    %eax,%ecx
+    10da:	85 c0                	test   %eax,%eax
+    10dc:	7e 62                	jle    1140 <wc+0xa0>
+    for(i=0; i<n; i++){
+    10de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    10e1:	31 ff                	xor    %edi,%edi
+    10e3:	eb 0d                	jmp    10f2 <wc+0x52>
+    10e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+    10e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+    10ea:	83 c7 01             	add    $0x1,%edi
+    10ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    10f0:	74 3e                	je     1130 <wc+0x90>
+      if(buf[i] == '\n')
+    10f2:	0f be 87 60 1c 00 00 	movsbl 0x1c60(%edi),%eax
+        l++;
+    10f9:	31 c9                	xor    %ecx,%ecx
+    10fb:	3c 0a                	cmp    $0xa,%al
+    10fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+    1100:	83 ec 08             	sub    $0x8,%esp
+    1103:	50                   	push   %eax
+        l++;
+    1104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+    1106:	68 d8 18 00 00       	push   $0x18d8
+    110b:	e8 50 01 00 00       	call   1260 <strchr>
+    1110:	83 c4 10             	add    $0x10,%esp
+    1113:	85 c0                	test   %eax,%eax
+    1115:	75 d1                	jne    10e8 <wc+0x48>
+      else if(!inword){
+    1117:	85 f6                	test   %esi,%esi
+    1119:	75 cf                	jne    10ea <wc+0x4a>
+        w++;
+    111b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+    111f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+    1124:	83 c7 01             	add    $0x1,%edi
+    1127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    112a:	75 c6                	jne    10f2 <wc+0x52>
+    112c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+    1130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+    1136:	eb 88                	jmp    10c0 <wc+0x20>
+    1138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113f:	90                   	nop
+  if(n < 0){
+    1140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    1143:	75 22                	jne    1167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+    1145:	83 ec 08             	sub    $0x8,%esp
+    1148:	ff 75 0c             	push   0xc(%ebp)
+    114b:	52                   	push   %edx
+    114c:	ff 75 e0             	push   -0x20(%ebp)
+    114f:	53                   	push   %ebx
+    1150:	68 ee 18 00 00       	push   $0x18ee
+    1155:	6a 01                	push   $0x1
+    1157:	e8 54 04 00 00       	call   15b0 <printf>
+}
+    115c:	83 c4 20             	add    $0x20,%esp
+    115f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1162:	5b                   	pop    %ebx
+    1163:	5e                   	pop    %esi
+    1164:	5f                   	pop    %edi
+    1165:	5d                   	pop    %ebp
+    1166:	c3                   	ret
+    printf(1, "wc: read error\n");
+    1167:	50                   	push   %eax
+    1168:	50                   	push   %eax
+    1169:	68 de 18 00 00       	push   $0x18de
+    116e:	6a 01                	push   $0x1
+    1170:	e8 3b 04 00 00       	call   15b0 <printf>
+    exit();
+    1175:	e8 49 02 00 00       	call   13c3 <exit>
+    117a:	66 90                	xchg   %ax,%ax
+    117c:	66 90                	xchg   %ax,%ax
+    117e:	66 90                	xchg   %ax,%ax
+
+00001180 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1181:	31 c0                	xor    %eax,%eax
+{
+    1183:	89 e5                	mov    %esp,%ebp
+    1185:	53                   	push   %ebx
+    1186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    118c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1197:	83 c0 01             	add    $0x1,%eax
+    119a:	84 d2                	test   %dl,%dl
+    119c:	75 f2                	jne    1190 <strcpy+0x10>
+    ;
+  return os;
+}
+    119e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11a1:	89 c8                	mov    %ecx,%eax
+    11a3:	c9                   	leave
+    11a4:	c3                   	ret
+    11a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000011b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	53                   	push   %ebx
+    11b4:	8b 55 08             	mov    0x8(%ebp),%edx
+    11b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    11ba:	0f b6 02             	movzbl (%edx),%eax
+    11bd:	84 c0                	test   %al,%al
+    11bf:	75 17                	jne    11d8 <strcmp+0x28>
+    11c1:	eb 3a                	jmp    11fd <strcmp+0x4d>
+    11c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11c7:	90                   	nop
+    11c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    11cc:	83 c2 01             	add    $0x1,%edx
+    11cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    11d2:	84 c0                	test   %al,%al
+    11d4:	74 1a                	je     11f0 <strcmp+0x40>
+    p++, q++;
+    11d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    11d8:	0f b6 19             	movzbl (%ecx),%ebx
+    11db:	38 c3                	cmp    %al,%bl
+    11dd:	74 e9                	je     11c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    11df:	29 d8                	sub    %ebx,%eax
+}
+    11e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11e4:	c9                   	leave
+    11e5:	c3                   	ret
+    11e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    11f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    11f4:	31 c0                	xor    %eax,%eax
+    11f6:	29 d8                	sub    %ebx,%eax
+}
+    11f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11fb:	c9                   	leave
+    11fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    11fd:	0f b6 19             	movzbl (%ecx),%ebx
+    1200:	31 c0                	xor    %eax,%eax
+    1202:	eb db                	jmp    11df <strcmp+0x2f>
+    1204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    120f:	90                   	nop
+
+00001210 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1210:	55                   	push   %ebp
+    1211:	89 e5                	mov    %esp,%ebp
+    1213:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1216:	80 3a 00             	cmpb   $0x0,(%edx)
+    1219:	74 15                	je     1230 <strlen+0x20>
+    121b:	31 c0                	xor    %eax,%eax
+    121d:	8d 76 00             	lea    0x0(%esi),%esi
+    1220:	83 c0 01             	add    $0x1,%eax
+    1223:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1227:	89 c1                	mov    %eax,%ecx
+    1229:	75 f5                	jne    1220 <strlen+0x10>
+    ;
+  return n;
+}
+    122b:	89 c8                	mov    %ecx,%eax
+    122d:	5d                   	pop    %ebp
+    122e:	c3                   	ret
+    122f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1230:	31 c9                	xor    %ecx,%ecx
+}
+    1232:	5d                   	pop    %ebp
+    1233:	89 c8                	mov    %ecx,%eax
+    1235:	c3                   	ret
+    1236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    124a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    124d:	89 d7                	mov    %edx,%edi
+    124f:	fc                   	cld
+    1250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1252:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1255:	89 d0                	mov    %edx,%eax
+    1257:	c9                   	leave
+    1258:	c3                   	ret
+    1259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001260 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	8b 45 08             	mov    0x8(%ebp),%eax
+    1266:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    126a:	0f b6 10             	movzbl (%eax),%edx
+    126d:	84 d2                	test   %dl,%dl
+    126f:	75 12                	jne    1283 <strchr+0x23>
+    1271:	eb 1d                	jmp    1290 <strchr+0x30>
+    1273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1277:	90                   	nop
+    1278:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    127c:	83 c0 01             	add    $0x1,%eax
+    127f:	84 d2                	test   %dl,%dl
+    1281:	74 0d                	je     1290 <strchr+0x30>
+    if(*s == c)
+    1283:	38 d1                	cmp    %dl,%cl
+    1285:	75 f1                	jne    1278 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1287:	5d                   	pop    %ebp
+    1288:	c3                   	ret
+    1289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1290:	31 c0                	xor    %eax,%eax
+}
+    1292:	5d                   	pop    %ebp
+    1293:	c3                   	ret
+    1294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    129f:	90                   	nop
+
+000012a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    12a0:	55                   	push   %ebp
+    12a1:	89 e5                	mov    %esp,%ebp
+    12a3:	57                   	push   %edi
+    12a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    12a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    12a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    12a9:	31 db                	xor    %ebx,%ebx
+{
+    12ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    12ae:	eb 27                	jmp    12d7 <gets+0x37>
+    cc = read(0, &c, 1);
+    12b0:	83 ec 04             	sub    $0x4,%esp
+    12b3:	6a 01                	push   $0x1
+    12b5:	56                   	push   %esi
+    12b6:	6a 00                	push   $0x0
+    12b8:	e8 1e 01 00 00       	call   13db <read>
+    if(cc < 1)
+    12bd:	83 c4 10             	add    $0x10,%esp
+    12c0:	85 c0                	test   %eax,%eax
+    12c2:	7e 1d                	jle    12e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    12c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    12c8:	8b 55 08             	mov    0x8(%ebp),%edx
+    12cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    12cf:	3c 0a                	cmp    $0xa,%al
+    12d1:	74 10                	je     12e3 <gets+0x43>
+    12d3:	3c 0d                	cmp    $0xd,%al
+    12d5:	74 0c                	je     12e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    12d7:	89 df                	mov    %ebx,%edi
+    12d9:	83 c3 01             	add    $0x1,%ebx
+    12dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    12df:	7c cf                	jl     12b0 <gets+0x10>
+    12e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    12e3:	8b 45 08             	mov    0x8(%ebp),%eax
+    12e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    12ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12ed:	5b                   	pop    %ebx
+    12ee:	5e                   	pop    %esi
+    12ef:	5f                   	pop    %edi
+    12f0:	5d                   	pop    %ebp
+    12f1:	c3                   	ret
+    12f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001300 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	56                   	push   %esi
+    1304:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1305:	83 ec 08             	sub    $0x8,%esp
+    1308:	6a 00                	push   $0x0
+    130a:	ff 75 08             	push   0x8(%ebp)
+    130d:	e8 f1 00 00 00       	call   1403 <open>
+  if(fd < 0)
+    1312:	83 c4 10             	add    $0x10,%esp
+    1315:	85 c0                	test   %eax,%eax
+    1317:	78 27                	js     1340 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1319:	83 ec 08             	sub    $0x8,%esp
+    131c:	ff 75 0c             	push   0xc(%ebp)
+    131f:	89 c3                	mov    %eax,%ebx
+    1321:	50                   	push   %eax
+    1322:	e8 f4 00 00 00       	call   141b <fstat>
+  close(fd);
+    1327:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    132a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    132c:	e8 ba 00 00 00       	call   13eb <close>
+  return r;
+    1331:	83 c4 10             	add    $0x10,%esp
+}
+    1334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1337:	89 f0                	mov    %esi,%eax
+    1339:	5b                   	pop    %ebx
+    133a:	5e                   	pop    %esi
+    133b:	5d                   	pop    %ebp
+    133c:	c3                   	ret
+    133d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1345:	eb ed                	jmp    1334 <stat+0x34>
+    1347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134e:	66 90                	xchg   %ax,%ax
+
+00001350 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1350:	55                   	push   %ebp
+    1351:	89 e5                	mov    %esp,%ebp
+    1353:	53                   	push   %ebx
+    1354:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1357:	0f be 02             	movsbl (%edx),%eax
+    135a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    135d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1365:	77 1e                	ja     1385 <atoi+0x35>
+    1367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1370:	83 c2 01             	add    $0x1,%edx
+    1373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    137a:	0f be 02             	movsbl (%edx),%eax
+    137d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1380:	80 fb 09             	cmp    $0x9,%bl
+    1383:	76 eb                	jbe    1370 <atoi+0x20>
+  return n;
+}
+    1385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1388:	89 c8                	mov    %ecx,%eax
+    138a:	c9                   	leave
+    138b:	c3                   	ret
+    138c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001390 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1390:	55                   	push   %ebp
+    1391:	89 e5                	mov    %esp,%ebp
+    1393:	57                   	push   %edi
+    1394:	56                   	push   %esi
+    1395:	8b 45 10             	mov    0x10(%ebp),%eax
+    1398:	8b 55 08             	mov    0x8(%ebp),%edx
+    139b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    139e:	85 c0                	test   %eax,%eax
+    13a0:	7e 13                	jle    13b5 <memmove+0x25>
+    13a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    13a4:	89 d7                	mov    %edx,%edi
+    13a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    13b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    13b1:	39 f8                	cmp    %edi,%eax
+    13b3:	75 fb                	jne    13b0 <memmove+0x20>
+  return vdst;
+}
+    13b5:	5e                   	pop    %esi
+    13b6:	89 d0                	mov    %edx,%eax
+    13b8:	5f                   	pop    %edi
+    13b9:	5d                   	pop    %ebp
+    13ba:	c3                   	ret
+
+000013bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    13bb:	b8 01 00 00 00       	mov    $0x1,%eax
+    13c0:	cd 40                	int    $0x40
+    13c2:	c3                   	ret
+
+000013c3 <exit>:
+SYSCALL(exit)
+    13c3:	b8 02 00 00 00       	mov    $0x2,%eax
+    13c8:	cd 40                	int    $0x40
+    13ca:	c3                   	ret
+
+000013cb <wait>:
+SYSCALL(wait)
+    13cb:	b8 03 00 00 00       	mov    $0x3,%eax
+    13d0:	cd 40                	int    $0x40
+    13d2:	c3                   	ret
+
+000013d3 <pipe>:
+SYSCALL(pipe)
+    13d3:	b8 04 00 00 00       	mov    $0x4,%eax
+    13d8:	cd 40                	int    $0x40
+    13da:	c3                   	ret
+
+000013db <read>:
+SYSCALL(read)
+    13db:	b8 05 00 00 00       	mov    $0x5,%eax
+    13e0:	cd 40                	int    $0x40
+    13e2:	c3                   	ret
+
+000013e3 <write>:
+SYSCALL(write)
+    13e3:	b8 10 00 00 00       	mov    $0x10,%eax
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+
+000013eb <close>:
+SYSCALL(close)
+    13eb:	b8 15 00 00 00       	mov    $0x15,%eax
+    13f0:	cd 40                	int    $0x40
+    13f2:	c3                   	ret
+
+000013f3 <kill>:
+SYSCALL(kill)
+    13f3:	b8 06 00 00 00       	mov    $0x6,%eax
+    13f8:	cd 40                	int    $0x40
+    13fa:	c3                   	ret
+
+000013fb <exec>:
+SYSCALL(exec)
+    13fb:	b8 07 00 00 00       	mov    $0x7,%eax
+    1400:	cd 40                	int    $0x40
+    1402:	c3                   	ret
+
+00001403 <open>:
+SYSCALL(open)
+    1403:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1408:	cd 40                	int    $0x40
+    140a:	c3                   	ret
+
+0000140b <mknod>:
+SYSCALL(mknod)
+    140b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1410:	cd 40                	int    $0x40
+    1412:	c3                   	ret
+
+00001413 <unlink>:
+SYSCALL(unlink)
+    1413:	b8 12 00 00 00       	mov    $0x12,%eax
+    1418:	cd 40                	int    $0x40
+    141a:	c3                   	ret
+
+0000141b <fstat>:
+SYSCALL(fstat)
+    141b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1420:	cd 40                	int    $0x40
+    1422:	c3                   	ret
+
+00001423 <link>:
+SYSCALL(link)
+    1423:	b8 13 00 00 00       	mov    $0x13,%eax
+    1428:	cd 40                	int    $0x40
+    142a:	c3                   	ret
+
+0000142b <mkdir>:
+SYSCALL(mkdir)
+    142b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1430:	cd 40                	int    $0x40
+    1432:	c3                   	ret
+
+00001433 <chdir>:
+SYSCALL(chdir)
+    1433:	b8 09 00 00 00       	mov    $0x9,%eax
+    1438:	cd 40                	int    $0x40
+    143a:	c3                   	ret
+
+0000143b <dup>:
+SYSCALL(dup)
+    143b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1440:	cd 40                	int    $0x40
+    1442:	c3                   	ret
+
+00001443 <getpid>:
+SYSCALL(getpid)
+    1443:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1448:	cd 40                	int    $0x40
+    144a:	c3                   	ret
+
+0000144b <sbrk>:
+SYSCALL(sbrk)
+    144b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1450:	cd 40                	int    $0x40
+    1452:	c3                   	ret
+
+00001453 <sleep>:
+SYSCALL(sleep)
+    1453:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1458:	cd 40                	int    $0x40
+    145a:	c3                   	ret
+
+0000145b <uptime>:
+SYSCALL(uptime)
+    145b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1460:	cd 40                	int    $0x40
+    1462:	c3                   	ret
+
+00001463 <settickets>:
+SYSCALL(settickets)
+    1463:	b8 16 00 00 00       	mov    $0x16,%eax
+    1468:	cd 40                	int    $0x40
+    146a:	c3                   	ret
+
+0000146b <getpinfo>:
+SYSCALL(getpinfo)
+    146b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1470:	cd 40                	int    $0x40
+    1472:	c3                   	ret
+
+00001473 <mprotect>:
+SYSCALL(mprotect)
+    1473:	b8 18 00 00 00       	mov    $0x18,%eax
+    1478:	cd 40                	int    $0x40
+    147a:	c3                   	ret
+
+0000147b <munprotect>:
+SYSCALL(munprotect)
+    147b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1480:	cd 40                	int    $0x40
+    1482:	c3                   	ret
+
+00001483 <clone>:
+SYSCALL(clone)
+    1483:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1488:	cd 40                	int    $0x40
+    148a:	c3                   	ret
+
+0000148b <join>:
+SYSCALL(join)
+    148b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1490:	cd 40                	int    $0x40
+    1492:	c3                   	ret
+
+00001493 <initlock_t>:
+SYSCALL(initlock_t)
+    1493:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1498:	cd 40                	int    $0x40
+    149a:	c3                   	ret
+
+0000149b <acquire_t>:
+SYSCALL(acquire_t)
+    149b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    14a0:	cd 40                	int    $0x40
+    14a2:	c3                   	ret
+
+000014a3 <release_t>:
+SYSCALL(release_t)
+    14a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    14a8:	cd 40                	int    $0x40
+    14aa:	c3                   	ret
+
+000014ab <setsched>:
+SYSCALL(setsched)
+    14ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    14b0:	cd 40                	int    $0x40
+    14b2:	c3                   	ret
+
+000014b3 <mkgroup>:
+SYSCALL(mkgroup)
+    14b3:	b8 20 00 00 00       	mov    $0x20,%eax
+    14b8:	cd 40                	int    $0x40
+    14ba:	c3                   	ret
+
+000014bb <joingroup>:
+SYSCALL(joingroup)
+    14bb:	b8 21 00 00 00       	mov    $0x21,%eax
+    14c0:	cd 40                	int    $0x40
+    14c2:	c3                   	ret
+
+000014c3 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    14c3:	b8 22 00 00 00       	mov    $0x22,%eax
+    14c8:	cd 40                	int    $0x40
+    14ca:	c3                   	ret
+
+000014cb <setdeadline>:
+SYSCALL(setdeadline)
+    14cb:	b8 23 00 00 00       	mov    $0x23,%eax
+    14d0:	cd 40                	int    $0x40
+    14d2:	c3                   	ret
+
+000014d3 <setaffinity>:
+SYSCALL(setaffinity)
+    14d3:	b8 24 00 00 00       	mov    $0x24,%eax
+    14d8:	cd 40                	int    $0x40
+    14da:	c3                   	ret
+
+000014db <yield_to>:
+SYSCALL(yield_to)
+    14db:	b8 25 00 00 00       	mov    $0x25,%eax
+    14e0:	cd 40                	int    $0x40
+    14e2:	c3                   	ret
+
+000014e3 <getlatency>:
+SYSCALL(getlatency)
+    14e3:	b8 26 00 00 00       	mov    $0x26,%eax
+    14e8:	cd 40                	int    $0x40
+    14ea:	c3                   	ret
+
+000014eb <futex_wait>:
+SYSCALL(futex_wait)
+    14eb:	b8 27 00 00 00       	mov    $0x27,%eax
+    14f0:	cd 40                	int    $0x40
+    14f2:	c3                   	ret
+
+000014f3 <futex_wake>:
+SYSCALL(futex_wake)
+    14f3:	b8 28 00 00 00       	mov    $0x28,%eax
+    14f8:	cd 40                	int    $0x40
+    14fa:	c3                   	ret
+
+000014fb <mguard>:
+SYSCALL(mguard)
+    14fb:	b8 29 00 00 00       	mov    $0x29,%eax
+    1500:	cd 40                	int    $0x40
+    1502:	c3                   	ret
+
+00001503 <join_any>:
+SYSCALL(join_any)
+    1503:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1508:	cd 40                	int    $0x40
+    150a:	c3                   	ret
+    150b:	66 90                	xchg   %ax,%ax
+    150d:	66 90                	xchg   %ax,%ax
+    150f:	90                   	nop
+
+00001510 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1510:	55                   	push   %ebp
+    1511:	89 e5                	mov    %esp,%ebp
+    1513:	57                   	push   %edi
+    1514:	56                   	push   %esi
+    1515:	53                   	push   %ebx
+    1516:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1518:	89 d1                	mov    %edx,%ecx
+{
+    151a:	83 ec 3c             	sub    $0x3c,%esp
+    151d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1520:	85 d2                	test   %edx,%edx
+    1522:	0f 89 80 00 00 00    	jns    15a8 <printint+0x98>
+    1528:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    152c:	74 7a                	je     15a8 <printint+0x98>
+    x = -xx;
+    152e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1530:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1535:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1538:	31 f6                	xor    %esi,%esi
+    153a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1540:	89 c8                	mov    %ecx,%eax
+    1542:	31 d2                	xor    %edx,%edx
+    1544:	89 f7                	mov    %esi,%edi
+    1546:	f7 f3                	div    %ebx
+    1548:	8d 76 01             	lea    0x1(%esi),%esi
+    154b:	0f b6 92 70 19 00 00 	movzbl 0x1970(%edx),%edx
+    1552:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1556:	89 ca                	mov    %ecx,%edx
+    1558:	89 c1                	mov    %eax,%ecx
+    155a:	39 da                	cmp    %ebx,%edx
+    155c:	73 e2                	jae    1540 <printint+0x30>
+  if(neg)
+    155e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1561:	85 c0                	test   %eax,%eax
+    1563:	74 07                	je     156c <printint+0x5c>
+    buf[i++] = '-';
+    1565:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    156a:	89 f7                	mov    %esi,%edi
+    156c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    156f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1572:	01 df                	add    %ebx,%edi
+    1574:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1578:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    157b:	83 ec 04             	sub    $0x4,%esp
+    157e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1581:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1584:	6a 01                	push   $0x1
+    1586:	50                   	push   %eax
+    1587:	56                   	push   %esi
+    1588:	e8 56 fe ff ff       	call   13e3 <write>
+  while(--i >= 0)
+    158d:	89 f8                	mov    %edi,%eax
+    158f:	83 c4 10             	add    $0x10,%esp
+    1592:	83 ef 01             	sub    $0x1,%edi
+    1595:	39 d8                	cmp    %ebx,%eax
+    1597:	75 df                	jne    1578 <printint+0x68>
+}
+    1599:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    159c:	5b                   	pop    %ebx
+    159d:	5e                   	pop    %esi
+    159e:	5f                   	pop    %edi
+    159f:	5d                   	pop    %ebp
+    15a0:	c3                   	ret
+    15a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    15a8:	31 c0                	xor    %eax,%eax
+    15aa:	eb 89                	jmp    1535 <printint+0x25>
+    15ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000015b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    15b0:	55                   	push   %ebp
+    15b1:	89 e5                	mov    %esp,%ebp
+    15b3:	57                   	push   %edi
+    15b4:	56                   	push   %esi
+    15b5:	53                   	push   %ebx
+    15b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    15b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    15bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    15bf:	0f b6 1e             	movzbl (%esi),%ebx
+    15c2:	83 c6 01             	add    $0x1,%esi
+    15c5:	84 db                	test   %bl,%bl
+    15c7:	74 67                	je     1630 <printf+0x80>
+    15c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    15cc:	31 d2                	xor    %edx,%edx
+    15ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    15d1:	eb 34                	jmp    1607 <printf+0x57>
+    15d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15d7:	90                   	nop
+    15d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    15db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    15e0:	83 f8 25             	cmp    $0x25,%eax
+    15e3:	74 18                	je     15fd <printf+0x4d>
+  write(fd, &c, 1);
+    15e5:	83 ec 04             	sub    $0x4,%esp
+    15e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    15eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    15ee:	6a 01                	push   $0x1
+    15f0:	50                   	push   %eax
+    15f1:	57                   	push   %edi
+    15f2:	e8 ec fd ff ff       	call   13e3 <write>
+    15f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    15fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    15fd:	0f b6 1e             	movzbl (%esi),%ebx
+    1600:	83 c6 01             	add    $0x1,%esi
+    1603:	84 db                	test   %bl,%bl
+    1605:	74 29                	je     1630 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1607:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    160a:	85 d2                	test   %edx,%edx
+    160c:	74 ca                	je     15d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    160e:	83 fa 25             	cmp    $0x25,%edx
+    1611:	75 ea                	jne    15fd <printf+0x4d>
+      if(c == 'd'){
+    1613:	83 f8 25             	cmp    $0x25,%eax
+    1616:	0f 84 24 01 00 00    	je     1740 <printf+0x190>
+    161c:	83 e8 63             	sub    $0x63,%eax
+    161f:	83 f8 15             	cmp    $0x15,%eax
+    1622:	77 1c                	ja     1640 <printf+0x90>
+    1624:	ff 24 85 18 19 00 00 	jmp    *0x1918(,%eax,4)
+    162b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    162f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1630:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1633:	5b                   	pop    %ebx
+    1634:	5e                   	pop    %esi
+    1635:	5f                   	pop    %edi
+    1636:	5d                   	pop    %ebp
+    1637:	c3                   	ret
+    1638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    163f:	90                   	nop
+  write(fd, &c, 1);
+    1640:	83 ec 04             	sub    $0x4,%esp
+    1643:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1646:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    164a:	6a 01                	push   $0x1
+    164c:	52                   	push   %edx
+    164d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1650:	57                   	push   %edi
+    1651:	e8 8d fd ff ff       	call   13e3 <write>
+    1656:	83 c4 0c             	add    $0xc,%esp
+    1659:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    165c:	6a 01                	push   $0x1
+    165e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1661:	52                   	push   %edx
+    1662:	57                   	push   %edi
+    1663:	e8 7b fd ff ff       	call   13e3 <write>
+        putc(fd, c);
+    1668:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    166b:	31 d2                	xor    %edx,%edx
+    166d:	eb 8e                	jmp    15fd <printf+0x4d>
+    166f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1670:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1673:	83 ec 0c             	sub    $0xc,%esp
+    1676:	b9 10 00 00 00       	mov    $0x10,%ecx
+    167b:	8b 13                	mov    (%ebx),%edx
+    167d:	6a 00                	push   $0x0
+    167f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1681:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1684:	e8 87 fe ff ff       	call   1510 <printint>
+        ap++;
+    1689:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    168c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    168f:	31 d2                	xor    %edx,%edx
+    1691:	e9 67 ff ff ff       	jmp    15fd <printf+0x4d>
+    1696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    169d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    16a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    16a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    16a5:	83 c0 04             	add    $0x4,%eax
+    16a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    16ab:	85 db                	test   %ebx,%ebx
+    16ad:	0f 84 9d 00 00 00    	je     1750 <printf+0x1a0>
+        while(*s != 0){
+    16b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    16b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    16b8:	84 c0                	test   %al,%al
+    16ba:	0f 84 3d ff ff ff    	je     15fd <printf+0x4d>
+    16c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    16c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    16c6:	89 de                	mov    %ebx,%esi
+    16c8:	89 d3                	mov    %edx,%ebx
+    16ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    16d0:	83 ec 04             	sub    $0x4,%esp
+    16d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    16d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    16d9:	6a 01                	push   $0x1
+    16db:	53                   	push   %ebx
+    16dc:	57                   	push   %edi
+    16dd:	e8 01 fd ff ff       	call   13e3 <write>
+        while(*s != 0){
+    16e2:	0f b6 06             	movzbl (%esi),%eax
+    16e5:	83 c4 10             	add    $0x10,%esp
+    16e8:	84 c0                	test   %al,%al
+    16ea:	75 e4                	jne    16d0 <printf+0x120>
+      state = 0;
+    16ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    16ef:	31 d2                	xor    %edx,%edx
+    16f1:	e9 07 ff ff ff       	jmp    15fd <printf+0x4d>
+    16f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1700:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1703:	83 ec 0c             	sub    $0xc,%esp
+    1706:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    170b:	8b 13                	mov    (%ebx),%edx
+    170d:	6a 01                	push   $0x1
+    170f:	e9 6b ff ff ff       	jmp    167f <printf+0xcf>
+    1714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1718:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    171b:	83 ec 04             	sub    $0x4,%esp
+    171e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1721:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1723:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1726:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1729:	6a 01                	push   $0x1
+    172b:	52                   	push   %edx
+    172c:	57                   	push   %edi
+    172d:	e8 b1 fc ff ff       	call   13e3 <write>
+        ap++;
+    1732:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1735:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1738:	31 d2                	xor    %edx,%edx
+    173a:	e9 be fe ff ff       	jmp    15fd <printf+0x4d>
+    173f:	90                   	nop
+  write(fd, &c, 1);
+    1740:	83 ec 04             	sub    $0x4,%esp
+    1743:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1746:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1749:	6a 01                	push   $0x1
+    174b:	e9 11 ff ff ff       	jmp    1661 <printf+0xb1>
+    1750:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1755:	bb 0f 19 00 00       	mov    $0x190f,%ebx
+    175a:	e9 61 ff ff ff       	jmp    16c0 <printf+0x110>
+    175f:	90                   	nop
+
+00001760 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1760:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1761:	a1 60 1e 00 00       	mov    0x1e60,%eax
+{
+    1766:	89 e5                	mov    %esp,%ebp
+    1768:	57                   	push   %edi
+    1769:	56                   	push   %esi
+    176a:	53                   	push   %ebx
+    176b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    176e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1771:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1778:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    177a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    177c:	39 ca                	cmp    %ecx,%edx
+    177e:	73 30                	jae    17b0 <free+0x50>
+    1780:	39 c1                	cmp    %eax,%ecx
+    1782:	72 04                	jb     1788 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1784:	39 c2                	cmp    %eax,%edx
+    1786:	72 f0                	jb     1778 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1788:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    178b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    178e:	39 f8                	cmp    %edi,%eax
+    1790:	74 2e                	je     17c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1792:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1795:	8b 42 04             	mov    0x4(%edx),%eax
+    1798:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    179b:	39 f1                	cmp    %esi,%ecx
+    179d:	74 38                	je     17d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    179f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    17a1:	5b                   	pop    %ebx
+  freep = p;
+    17a2:	89 15 60 1e 00 00    	mov    %edx,0x1e60
+}
+    17a8:	5e                   	pop    %esi
+    17a9:	5f                   	pop    %edi
+    17aa:	5d                   	pop    %ebp
+    17ab:	c3                   	ret
+    17ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17b0:	39 c1                	cmp    %eax,%ecx
+    17b2:	72 d0                	jb     1784 <free+0x24>
+    17b4:	eb c2                	jmp    1778 <free+0x18>
+    17b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    17c0:	03 70 04             	add    0x4(%eax),%esi
+    17c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17c6:	8b 02                	mov    (%edx),%eax
+    17c8:	8b 00                	mov    (%eax),%eax
+    17ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    17cd:	8b 42 04             	mov    0x4(%edx),%eax
+    17d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    17d3:	39 f1                	cmp    %esi,%ecx
+    17d5:	75 c8                	jne    179f <free+0x3f>
+    p->s.size += bp->s.size;
+    17d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    17da:	89 15 60 1e 00 00    	mov    %edx,0x1e60
+    p->s.size += bp->s.size;
+    17e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    17e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    17e6:	89 0a                	mov    %ecx,(%edx)
+}
+    17e8:	5b                   	pop    %ebx
+    17e9:	5e                   	pop    %esi
+    17ea:	5f                   	pop    %edi
+    17eb:	5d                   	pop    %ebp
+    17ec:	c3                   	ret
+    17ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000017f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    17f0:	55                   	push   %ebp
+    17f1:	89 e5                	mov    %esp,%ebp
+    17f3:	57                   	push   %edi
+    17f4:	56                   	push   %esi
+    17f5:	53                   	push   %ebx
+    17f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    17f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    17fc:	8b 15 60 1e 00 00    	mov    0x1e60,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1802:	8d 78 07             	lea    0x7(%eax),%edi
+    1805:	c1 ef 03             	shr    $0x3,%edi
+    1808:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    180b:	85 d2                	test   %edx,%edx
+    180d:	0f 84 8d 00 00 00    	je     18a0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1813:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1815:	8b 48 04             	mov    0x4(%eax),%ecx
+    1818:	39 f9                	cmp    %edi,%ecx
+    181a:	73 64                	jae    1880 <malloc+0x90>
+  if(nu < 4096)
+    181c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1821:	39 df                	cmp    %ebx,%edi
+    1823:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1826:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    182d:	eb 0a                	jmp    1839 <malloc+0x49>
+    182f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1830:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1832:	8b 48 04             	mov    0x4(%eax),%ecx
+    1835:	39 f9                	cmp    %edi,%ecx
+    1837:	73 47                	jae    1880 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1839:	89 c2                	mov    %eax,%edx
+    183b:	39 05 60 1e 00 00    	cmp    %eax,0x1e60
+    1841:	75 ed                	jne    1830 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1843:	83 ec 0c             	sub    $0xc,%esp
+    1846:	56                   	push   %esi
+    1847:	e8 ff fb ff ff       	call   144b <sbrk>
+  if(p == (char*)-1)
+    184c:	83 c4 10             	add    $0x10,%esp
+    184f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1852:	74 1c                	je     1870 <malloc+0x80>
+  hp->s.size = nu;
+    1854:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1857:	83 ec 0c             	sub    $0xc,%esp
+    185a:	83 c0 08             	add    $0x8,%eax
+    185d:	50                   	push   %eax
+    185e:	e8 fd fe ff ff       	call   1760 <free>
+  return freep;
+    1863:	8b 15 60 1e 00 00    	mov    0x1e60,%edx
+      if((p = morecore(nunits)) == 0)
+    1869:	83 c4 10             	add    $0x10,%esp
+    186c:	85 d2                	test   %edx,%edx
+    186e:	75 c0                	jne    1830 <malloc+0x40>
+        return 0;
+  }
+}
+    1870:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1873:	31 c0                	xor    %eax,%eax
+}
+    1875:	5b                   	pop    %ebx
+    1876:	5e                   	pop    %esi
+    1877:	5f                   	pop    %edi
+    1878:	5d                   	pop    %ebp
+    1879:	c3                   	ret
+    187a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1880:	39 cf                	cmp    %ecx,%edi
+    1882:	74 4c                	je     18d0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1884:	29 f9                	sub    %edi,%ecx
+    1886:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1889:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    188c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    188f:	89 15 60 1e 00 00    	mov    %edx,0x1e60
+}
+    1895:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1898:	83 c0 08             	add    $0x8,%eax
+}
+    189b:	5b                   	pop    %ebx
+    189c:	5e                   	pop    %esi
+    189d:	5f                   	pop    %edi
+    189e:	5d                   	pop    %ebp
+    189f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    18a0:	c7 05 60 1e 00 00 64 	movl   $0x1e64,0x1e60
+    18a7:	1e 00 00 
+    base.s.size = 0;
+    18aa:	b8 64 1e 00 00       	mov    $0x1e64,%eax
+    base.s.ptr = freep = prevp = &base;
+    18af:	c7 05 64 1e 00 00 64 	movl   $0x1e64,0x1e64
+    18b6:	1e 00 00 
+    base.s.size = 0;
+    18b9:	c7 05 68 1e 00 00 00 	movl   $0x0,0x1e68
+    18c0:	00 00 00 
+    if(p->s.size >= nunits){
+    18c3:	e9 54 ff ff ff       	jmp    181c <malloc+0x2c>
+    18c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    18d0:	8b 08                	mov    (%eax),%ecx
+    18d2:	89 0a                	mov    %ecx,(%edx)
+    18d4:	eb b9                	jmp    188f <malloc+0x9f>
@@ -128,6 +128,39 @@ sti(void)
   asm volatile("sti");
 }
 
+// Enable interrupts and halt until the next one.  sti takes
+// effect only after hlt has started, so an interrupt that is
+// already pending still wakes the processor.
+static inline void
+stihlt(void)
+{
+  asm volatile("sti; hlt");
+}
+
+// Read the time-stamp counter: cycles since reset.
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+  return t;
+}
+
+// Atomically set *addr to newval if it holds old.
+// Returns whether it did.
+static inline int
+cas(volatile int *addr, int old, int newval)
+{
+  uchar ok;
+
+  asm volatile("lock; cmpxchgl %3, %1; sete %0" :
+               "=q" (ok), "+m" (*addr), "+a" (old) :
+               "r" (newval) :
+               "cc", "memory");
+  return ok;
+}
+
 static inline uint
 xchg(volatile uint *addr, uint newval)
 {
@@ -155,6 +188,14 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline uint
+rcr3(void)
+{
+  uint val;
+  asm volatile("movl %%cr3,%0" : "=r" (val));
+  return val;
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().
@@ -0,0 +1,1225 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	51                   	push   %ecx
+    100e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+    1011:	e8 55 02 00 00       	call   126b <fork>
+    1016:	85 c0                	test   %eax,%eax
+    1018:	7e 0d                	jle    1027 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+    101a:	83 ec 0c             	sub    $0xc,%esp
+    101d:	6a 05                	push   $0x5
+    101f:	e8 df 02 00 00       	call   1303 <sleep>
+    1024:	83 c4 10             	add    $0x10,%esp
+  exit();
+    1027:	e8 47 02 00 00       	call   1273 <exit>
+    102c:	66 90                	xchg   %ax,%ax
+    102e:	66 90                	xchg   %ax,%ax
+
+00001030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1030:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1031:	31 c0                	xor    %eax,%eax
+{
+    1033:	89 e5                	mov    %esp,%ebp
+    1035:	53                   	push   %ebx
+    1036:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1039:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    103c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1040:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1044:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1047:	83 c0 01             	add    $0x1,%eax
+    104a:	84 d2                	test   %dl,%dl
+    104c:	75 f2                	jne    1040 <strcpy+0x10>
+    ;
+  return os;
+}
+    104e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1051:	89 c8                	mov    %ecx,%eax
+    1053:	c9                   	leave
+    1054:	c3                   	ret
+    1055:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	53                   	push   %ebx
+    1064:	8b 55 08             	mov    0x8(%ebp),%edx
+    1067:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    106a:	0f b6 02             	movzbl (%edx),%eax
+    106d:	84 c0                	test   %al,%al
+    106f:	75 17                	jne    1088 <strcmp+0x28>
+    1071:	eb 3a                	jmp    10ad <strcmp+0x4d>
+    1073:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1077:	90                   	nop
+    1078:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    107c:	83 c2 01             	add    $0x1,%edx
+    107f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1082:	84 c0                	test   %al,%al
+    1084:	74 1a                	je     10a0 <strcmp+0x40>
+    p++, q++;
+    1086:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1088:	0f b6 19             	movzbl (%ecx),%ebx
+    108b:	38 c3                	cmp    %al,%bl
+    108d:	74 e9                	je     1078 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    108f:	29 d8                	sub    %ebx,%eax
+}
+    1091:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1094:	c9                   	leave
+    1095:	c3                   	ret
+    1096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    10a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    10a4:	31 c0                	xor    %eax,%eax
+    10a6:	29 d8                	sub    %ebx,%eax
+}
+    10a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10ab:	c9                   	leave
+    10ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    10ad:	0f b6 19             	movzbl (%ecx),%ebx
+    10b0:	31 c0                	xor    %eax,%eax
+    10b2:	eb db                	jmp    108f <strcmp+0x2f>
+    10b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10bf:	90                   	nop
+
+000010c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    10c0:	55                   	push   %ebp
+    10c1:	89 e5                	mov    %esp,%ebp
+    10c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    10c6:	80 3a 00             	cmpb   $0x0,(%edx)
+    10c9:	74 15                	je     10e0 <strlen+0x20>
+    10cb:	31 c0                	xor    %eax,%eax
+    10cd:	8d 76 00             	lea    0x0(%esi),%esi
+    10d0:	83 c0 01             	add    $0x1,%eax
+    10d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    10d7:	89 c1                	mov    %eax,%ecx
+    10d9:	75 f5                	jne    10d0 <strlen+0x10>
+    ;
+  return n;
+}
+    10db:	89 c8                	mov    %ecx,%eax
+    10dd:	5d                   	pop    %ebp
+    10de:	c3                   	ret
+    10df:	90                   	nop
+  for(n = 0; s[n]; n++)
+    10e0:	31 c9                	xor    %ecx,%ecx
+}
+    10e2:	5d                   	pop    %ebp
+    10e3:	89 c8                	mov    %ecx,%eax
+    10e5:	c3                   	ret
+    10e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	57                   	push   %edi
+    10f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    10f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    10fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10fd:	89 d7                	mov    %edx,%edi
+    10ff:	fc                   	cld
+    1100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1105:	89 d0                	mov    %edx,%eax
+    1107:	c9                   	leave
+    1108:	c3                   	ret
+    1109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	8b 45 08             	mov    0x8(%ebp),%eax
+    1116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    111a:	0f b6 10             	movzbl (%eax),%edx
+    111d:	84 d2                	test   %dl,%dl
+    111f:	75 12                	jne    1133 <strchr+0x23>
+    1121:	eb 1d                	jmp    1140 <strchr+0x30>
+    1123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1127:	90                   	nop
+    1128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    112c:	83 c0 01             	add    $0x1,%eax
+    112f:	84 d2                	test   %dl,%dl
+    1131:	74 0d                	je     1140 <strchr+0x30>
+    if(*s == c)
+    1133:	38 d1                	cmp    %dl,%cl
+    1135:	75 f1                	jne    1128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1137:	5d                   	pop    %ebp
+    1138:	c3                   	ret
+    1139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1140:	31 c0                	xor    %eax,%eax
+}
+    1142:	5d                   	pop    %ebp
+    1143:	c3                   	ret
+    1144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    114f:	90                   	nop
+
+00001150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	57                   	push   %edi
+    1154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1159:	31 db                	xor    %ebx,%ebx
+{
+    115b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    115e:	eb 27                	jmp    1187 <gets+0x37>
+    cc = read(0, &c, 1);
+    1160:	83 ec 04             	sub    $0x4,%esp
+    1163:	6a 01                	push   $0x1
+    1165:	56                   	push   %esi
+    1166:	6a 00                	push   $0x0
+    1168:	e8 1e 01 00 00       	call   128b <read>
+    if(cc < 1)
+    116d:	83 c4 10             	add    $0x10,%esp
+    1170:	85 c0                	test   %eax,%eax
+    1172:	7e 1d                	jle    1191 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1178:	8b 55 08             	mov    0x8(%ebp),%edx
+    117b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    117f:	3c 0a                	cmp    $0xa,%al
+    1181:	74 10                	je     1193 <gets+0x43>
+    1183:	3c 0d                	cmp    $0xd,%al
+    1185:	74 0c                	je     1193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1187:	89 df                	mov    %ebx,%edi
+    1189:	83 c3 01             	add    $0x1,%ebx
+    118c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    118f:	7c cf                	jl     1160 <gets+0x10>
+    1191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1193:	8b 45 08             	mov    0x8(%ebp),%eax
+    1196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    119a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    119d:	5b                   	pop    %ebx
+    119e:	5e                   	pop    %esi
+    119f:	5f                   	pop    %edi
+    11a0:	5d                   	pop    %ebp
+    11a1:	c3                   	ret
+    11a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	56                   	push   %esi
+    11b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    11b5:	83 ec 08             	sub    $0x8,%esp
+    11b8:	6a 00                	push   $0x0
+    11ba:	ff 75 08             	push   0x8(%ebp)
+    11bd:	e8 f1 00 00 00       	call   12b3 <open>
+  if(fd < 0)
+    11c2:	83 c4 10             	add    $0x10,%esp
+    11c5:	85 c0                	test   %eax,%eax
+    11c7:	78 27                	js     11f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    11c9:	83 ec 08             	sub    $0x8,%esp
+    11cc:	ff 75 0c             	push   0xc(%ebp)
+    11cf:	89 c3                	mov    %eax,%ebx
+    11d1:	50                   	push   %eax
+    11d2:	e8 f4 00 00 00       	call   12cb <fstat>
+  close(fd);
+    11d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    11da:	89 c6                	mov    %eax,%esi
+  close(fd);
+    11dc:	e8 ba 00 00 00       	call   129b <close>
+  return r;
+    11e1:	83 c4 10             	add    $0x10,%esp
+}
+    11e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11e7:	89 f0                	mov    %esi,%eax
+    11e9:	5b                   	pop    %ebx
+    11ea:	5e                   	pop    %esi
+    11eb:	5d                   	pop    %ebp
+    11ec:	c3                   	ret
+    11ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    11f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    11f5:	eb ed                	jmp    11e4 <stat+0x34>
+    11f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11fe:	66 90                	xchg   %ax,%ax
+
+00001200 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	53                   	push   %ebx
+    1204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1207:	0f be 02             	movsbl (%edx),%eax
+    120a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    120d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1215:	77 1e                	ja     1235 <atoi+0x35>
+    1217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1220:	83 c2 01             	add    $0x1,%edx
+    1223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    122a:	0f be 02             	movsbl (%edx),%eax
+    122d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1230:	80 fb 09             	cmp    $0x9,%bl
+    1233:	76 eb                	jbe    1220 <atoi+0x20>
+  return n;
+}
+    1235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1238:	89 c8                	mov    %ecx,%eax
+    123a:	c9                   	leave
+    123b:	c3                   	ret
+    123c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	56                   	push   %esi
+    1245:	8b 45 10             	mov    0x10(%ebp),%eax
+    1248:	8b 55 08             	mov    0x8(%ebp),%edx
+    124b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    124e:	85 c0                	test   %eax,%eax
+    1250:	7e 13                	jle    1265 <memmove+0x25>
+    1252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1254:	89 d7                	mov    %edx,%edi
+    1256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1261:	39 f8                	cmp    %edi,%eax
+    1263:	75 fb                	jne    1260 <memmove+0x20>
+  return vdst;
+}
+    1265:	5e                   	pop    %esi
+    1266:	89 d0                	mov    %edx,%eax
+    1268:	5f                   	pop    %edi
+    1269:	5d                   	pop    %ebp
+    126a:	c3                   	ret
+
+0000126b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    126b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1270:	cd 40                	int    $0x40
+    1272:	c3                   	ret
+
+00001273 <exit>:
+SYSCALL(exit)
+    1273:	b8 02 00 00 00       	mov    $0x2,%eax
+    1278:	cd 40                	int    $0x40
+    127a:	c3                   	ret
+
+0000127b <wait>:
+SYSCALL(wait)
+    127b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1280:	cd 40                	int    $0x40
+    1282:	c3                   	ret
+
+00001283 <pipe>:
+SYSCALL(pipe)
+    1283:	b8 04 00 00 00       	mov    $0x4,%eax
+    1288:	cd 40                	int    $0x40
+    128a:	c3                   	ret
+
+0000128b <read>:
+SYSCALL(read)
+    128b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1290:	cd 40                	int    $0x40
+    1292:	c3                   	ret
+
+00001293 <write>:
+SYSCALL(write)
+    1293:	b8 10 00 00 00       	mov    $0x10,%eax
+    1298:	cd 40                	int    $0x40
+    129a:	c3                   	ret
+
+0000129b <close>:
+SYSCALL(close)
+    129b:	b8 15 00 00 00       	mov    $0x15,%eax
+    12a0:	cd 40                	int    $0x40
+    12a2:	c3                   	ret
+
+000012a3 <kill>:
+SYSCALL(kill)
+    12a3:	b8 06 00 00 00       	mov    $0x6,%eax
+    12a8:	cd 40                	int    $0x40
+    12aa:	c3                   	ret
+
+000012ab <exec>:
+SYSCALL(exec)
+    12ab:	b8 07 00 00 00       	mov    $0x7,%eax
+    12b0:	cd 40                	int    $0x40
+    12b2:	c3                   	ret
+
+000012b3 <open>:
+SYSCALL(open)
+    12b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    12b8:	cd 40                	int    $0x40
+    12ba:	c3                   	ret
+
+000012bb <mknod>:
+SYSCALL(mknod)
+    12bb:	b8 11 00 00 00       	mov    $0x11,%eax
+    12c0:	cd 40                	int    $0x40
+    12c2:	c3                   	ret
+
+000012c3 <unlink>:
+SYSCALL(unlink)
+    12c3:	b8 12 00 00 00       	mov    $0x12,%eax
+    12c8:	cd 40                	int    $0x40
+    12ca:	c3                   	ret
+
+000012cb <fstat>:
+SYSCALL(fstat)
+    12cb:	b8 08 00 00 00       	mov    $0x8,%eax
+    12d0:	cd 40                	int    $0x40
+    12d2:	c3                   	ret
+
+000012d3 <link>:
+SYSCALL(link)
+    12d3:	b8 13 00 00 00       	mov    $0x13,%eax
+    12d8:	cd 40                	int    $0x40
+    12da:	c3                   	ret
+
+000012db <mkdir>:
+SYSCALL(mkdir)
+    12db:	b8 14 00 00 00       	mov    $0x14,%eax
+    12e0:	cd 40                	int    $0x40
+    12e2:	c3                   	ret
+
+000012e3 <chdir>:
+SYSCALL(chdir)
+    12e3:	b8 09 00 00 00       	mov    $0x9,%eax
+    12e8:	cd 40                	int    $0x40
+    12ea:	c3                   	ret
+
+000012eb <dup>:
+SYSCALL(dup)
+    12eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    12f0:	cd 40                	int    $0x40
+    12f2:	c3                   	ret
+
+000012f3 <getpid>:
+SYSCALL(getpid)
+    12f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    12f8:	cd 40                	int    $0x40
+    12fa:	c3                   	ret
+
+000012fb <sbrk>:
+SYSCALL(sbrk)
+    12fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1300:	cd 40                	int    $0x40
+    1302:	c3                   	ret
+
+00001303 <sleep>:
+SYSCALL(sleep)
+    1303:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1308:	cd 40                	int    $0x40
+    130a:	c3                   	ret
+
+0000130b <uptime>:
+SYSCALL(uptime)
+    130b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1310:	cd 40                	int    $0x40
+    1312:	c3                   	ret
+
+00001313 <settickets>:
+SYSCALL(settickets)
+    1313:	b8 16 00 00 00       	mov    $0x16,%eax
+    1318:	cd 40                	int    $0x40
+    131a:	c3                   	ret
+
+0000131b <getpinfo>:
+SYSCALL(getpinfo)
+    131b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1320:	cd 40                	int    $0x40
+    1322:	c3                   	ret
+
+00001323 <mprotect>:
+SYSCALL(mprotect)
+    1323:	b8 18 00 00 00       	mov    $0x18,%eax
+    1328:	cd 40                	int    $0x40
+    132a:	c3                   	ret
+
+0000132b <munprotect>:
+SYSCALL(munprotect)
+    132b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1330:	cd 40                	int    $0x40
+    1332:	c3                   	ret
+
+00001333 <clone>:
+SYSCALL(clone)
+    1333:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1338:	cd 40                	int    $0x40
+    133a:	c3                   	ret
+
+0000133b <join>:
+SYSCALL(join)
+    133b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1340:	cd 40                	int    $0x40
+    1342:	c3                   	ret
+
+00001343 <initlock_t>:
+SYSCALL(initlock_t)
+    1343:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1348:	cd 40                	int    $0x40
+    134a:	c3                   	ret
+
+0000134b <acquire_t>:
+SYSCALL(acquire_t)
+    134b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1350:	cd 40                	int    $0x40
+    1352:	c3                   	ret
+
+00001353 <release_t>:
+SYSCALL(release_t)
+    1353:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1358:	cd 40                	int    $0x40
+    135a:	c3                   	ret
+
+0000135b <setsched>:
+SYSCALL(setsched)
+    135b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1360:	cd 40                	int    $0x40
+    1362:	c3                   	ret
+
+00001363 <mkgroup>:
+SYSCALL(mkgroup)
+    1363:	b8 20 00 00 00       	mov    $0x20,%eax
+    1368:	cd 40                	int    $0x40
+    136a:	c3                   	ret
+
+0000136b <joingroup>:
+SYSCALL(joingroup)
+    136b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1370:	cd 40                	int    $0x40
+    1372:	c3                   	ret
+
+00001373 <transfer_tickets>:
+SYSCALL(transfer_tickets)
+    1373:	b8 22 00 00 00       	mov    $0x22,%eax
+    1378:	cd 40                	int    $0x40
+    137a:	c3                   	ret
+
+0000137b <setdeadline>:
+SYSCALL(setdeadline)
+    137b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1380:	cd 40                	int    $0x40
+    1382:	c3                   	ret
+
+00001383 <setaffinity>:
+SYSCALL(setaffinity)
+    1383:	b8 24 00 00 00       	mov    $0x24,%eax
+    1388:	cd 40                	int    $0x40
+    138a:	c3                   	ret
+
+0000138b <yield_to>:
+SYSCALL(yield_to)
+    138b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1390:	cd 40                	int    $0x40
+    1392:	c3                   	ret
+
+00001393 <getlatency>:
+SYSCALL(getlatency)
+    1393:	b8 26 00 00 00       	mov    $0x26,%eax
+    1398:	cd 40                	int    $0x40
+    139a:	c3                   	ret
+
+0000139b <futex_wait>:
+SYSCALL(futex_wait)
+    139b:	b8 27 00 00 00       	mov    $0x27,%eax
+    13a0:	cd 40                	int    $0x40
+    13a2:	c3                   	ret
+
+000013a3 <futex_wake>:
+SYSCALL(futex_wake)
+    13a3:	b8 28 00 00 00       	mov    $0x28,%eax
+    13a8:	cd 40                	int    $0x40
+    13aa:	c3                   	ret
+
+000013ab <mguard>:
+SYSCALL(mguard)
+    13ab:	b8 29 00 00 00       	mov    $0x29,%eax
+    13b0:	cd 40                	int    $0x40
+    13b2:	c3                   	ret
+
+000013b3 <join_any>:
+SYSCALL(join_any)
+    13b3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+    13bb:	66 90                	xchg   %ax,%ax
+    13bd:	66 90                	xchg   %ax,%ax
+    13bf:	90                   	nop
+
+000013c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	57                   	push   %edi
+    13c4:	56                   	push   %esi
+    13c5:	53                   	push   %ebx
+    13c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    13c8:	89 d1                	mov    %edx,%ecx
+{
+    13ca:	83 ec 3c             	sub    $0x3c,%esp
+    13cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    13d0:	85 d2                	test   %edx,%edx
+    13d2:	0f 89 80 00 00 00    	jns    1458 <printint+0x98>
+    13d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    13dc:	74 7a                	je     1458 <printint+0x98>
+    x = -xx;
+    13de:	f7 d9                	neg    %ecx
+    neg = 1;
+    13e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    13e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    13e8:	31 f6                	xor    %esi,%esi
+    13ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    13f0:	89 c8                	mov    %ecx,%eax
+    13f2:	31 d2                	xor    %edx,%edx
+    13f4:	89 f7                	mov    %esi,%edi
+    13f6:	f7 f3                	div    %ebx
+    13f8:	8d 76 01             	lea    0x1(%esi),%esi
+    13fb:	0f b6 92 e8 17 00 00 	movzbl 0x17e8(%edx),%edx
+    1402:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1406:	89 ca                	mov    %ecx,%edx
+    1408:	89 c1                	mov    %eax,%ecx
+    140a:	39 da                	cmp    %ebx,%edx
+    140c:	73 e2                	jae    13f0 <printint+0x30>
+  if(neg)
+    140e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1411:	85 c0                	test   %eax,%eax
+    1413:	74 07                	je     141c <printint+0x5c>
+    buf[i++] = '-';
+    1415:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    141a:	89 f7                	mov    %esi,%edi
+    141c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    141f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1422:	01 df                	add    %ebx,%edi
+    1424:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1428:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    142b:	83 ec 04             	sub    $0x4,%esp
+    142e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1431:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1434:	6a 01                	push   $0x1
+    1436:	50                   	push   %eax
+    1437:	56                   	push   %esi
+    1438:	e8 56 fe ff ff       	call   1293 <write>
+  while(--i >= 0)
+    143d:	89 f8                	mov    %edi,%eax
+    143f:	83 c4 10             	add    $0x10,%esp
+    1442:	83 ef 01             	sub    $0x1,%edi
+    1445:	39 d8                	cmp    %ebx,%eax
+    1447:	75 df                	jne    1428 <printint+0x68>
+}
+    1449:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    144c:	5b                   	pop    %ebx
+    144d:	5e                   	pop    %esi
+    144e:	5f                   	pop    %edi
+    144f:	5d                   	pop    %ebp
+    1450:	c3                   	ret
+    1451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1458:	31 c0                	xor    %eax,%eax
+    145a:	eb 89                	jmp    13e5 <printint+0x25>
+    145c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001460 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	57                   	push   %edi
+    1464:	56                   	push   %esi
+    1465:	53                   	push   %ebx
+    1466:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1469:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    146c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    146f:	0f b6 1e             	movzbl (%esi),%ebx
+    1472:	83 c6 01             	add    $0x1,%esi
+    1475:	84 db                	test   %bl,%bl
+    1477:	74 67                	je     14e0 <printf+0x80>
+    1479:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    147c:	31 d2                	xor    %edx,%edx
+    147e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1481:	eb 34                	jmp    14b7 <printf+0x57>
+    1483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1487:	90                   	nop
+    1488:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    148b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1490:	83 f8 25             	cmp    $0x25,%eax
+    1493:	74 18                	je     14ad <printf+0x4d>
+  write(fd, &c, 1);
+    1495:	83 ec 04             	sub    $0x4,%esp
+    1498:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    149b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    149e:	6a 01                	push   $0x1
+    14a0:	50                   	push   %eax
+    14a1:	57                   	push   %edi
+    14a2:	e8 ec fd ff ff       	call   1293 <write>
+    14a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    14aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    14ad:	0f b6 1e             	movzbl (%esi),%ebx
+    14b0:	83 c6 01             	add    $0x1,%esi
+    14b3:	84 db                	test   %bl,%bl
+    14b5:	74 29                	je     14e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    14b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    14ba:	85 d2                	test   %edx,%edx
+    14bc:	74 ca                	je     1488 <printf+0x28>
+      }
+    } else if(state == '%'){
+    14be:	83 fa 25             	cmp    $0x25,%edx
+    14c1:	75 ea                	jne    14ad <printf+0x4d>
+      if(c == 'd'){
+    14c3:	83 f8 25             	cmp    $0x25,%eax
+    14c6:	0f 84 24 01 00 00    	je     15f0 <printf+0x190>
+    14cc:	83 e8 63             	sub    $0x63,%eax
+    14cf:	83 f8 15             	cmp    $0x15,%eax
+    14d2:	77 1c                	ja     14f0 <printf+0x90>
+    14d4:	ff 24 85 90 17 00 00 	jmp    *0x1790(,%eax,4)
+    14db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    14e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14e3:	5b                   	pop    %ebx
+    14e4:	5e                   	pop    %esi
+    14e5:	5f                   	pop    %edi
+    14e6:	5d                   	pop    %ebp
+    14e7:	c3                   	ret
+    14e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ef:	90                   	nop
+  write(fd, &c, 1);
+    14f0:	83 ec 04             	sub    $0x4,%esp
+    14f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    14f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    14fa:	6a 01                	push   $0x1
+    14fc:	52                   	push   %edx
+    14fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1500:	57                   	push   %edi
+    1501:	e8 8d fd ff ff       	call   1293 <write>
+    1506:	83 c4 0c             	add    $0xc,%esp
+    1509:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    150c:	6a 01                	push   $0x1
+    150e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1511:	52                   	push   %edx
+    1512:	57                   	push   %edi
+    1513:	e8 7b fd ff ff       	call   1293 <write>
+        putc(fd, c);
+    1518:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    151b:	31 d2                	xor    %edx,%edx
+    151d:	eb 8e                	jmp    14ad <printf+0x4d>
+    151f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1520:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1523:	83 ec 0c             	sub    $0xc,%esp
+    1526:	b9 10 00 00 00       	mov    $0x10,%ecx
+    152b:	8b 13                	mov    (%ebx),%edx
+    152d:	6a 00                	push   $0x0
+    152f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1531:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1534:	e8 87 fe ff ff       	call   13c0 <printint>
+        ap++;
+    1539:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    153c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    153f:	31 d2                	xor    %edx,%edx
+    1541:	e9 67 ff ff ff       	jmp    14ad <printf+0x4d>
+    1546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    154d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1550:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1553:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1555:	83 c0 04             	add    $0x4,%eax
+    1558:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    155b:	85 db                	test   %ebx,%ebx
+    155d:	0f 84 9d 00 00 00    	je     1600 <printf+0x1a0>
+        while(*s != 0){
+    1563:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1566:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1568:	84 c0                	test   %al,%al
+    156a:	0f 84 3d ff ff ff    	je     14ad <printf+0x4d>
+    1570:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1573:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1576:	89 de                	mov    %ebx,%esi
+    1578:	89 d3                	mov    %edx,%ebx
+    157a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1580:	83 ec 04             	sub    $0x4,%esp
+    1583:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1586:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1589:	6a 01                	push   $0x1
+    158b:	53                   	push   %ebx
+    158c:	57                   	push   %edi
+    158d:	e8 01 fd ff ff       	call   1293 <write>
+        while(*s != 0){
+    1592:	0f b6 06             	movzbl (%esi),%eax
+    1595:	83 c4 10             	add    $0x10,%esp
+    1598:	84 c0                	test   %al,%al
+    159a:	75 e4                	jne    1580 <printf+0x120>
+      state = 0;
+    159c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    159f:	31 d2                	xor    %edx,%edx
+    15a1:	e9 07 ff ff ff       	jmp    14ad <printf+0x4d>
+    15a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    15b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    15b3:	83 ec 0c             	sub    $0xc,%esp
+    15b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    15bb:	8b 13                	mov    (%ebx),%edx
+    15bd:	6a 01                	push   $0x1
+    15bf:	e9 6b ff ff ff       	jmp    152f <printf+0xcf>
+    15c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    15c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    15cb:	83 ec 04             	sub    $0x4,%esp
+    15ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    15d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    15d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    15d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    15d9:	6a 01                	push   $0x1
+    15db:	52                   	push   %edx
+    15dc:	57                   	push   %edi
+    15dd:	e8 b1 fc ff ff       	call   1293 <write>
+        ap++;
+    15e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    15e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    15e8:	31 d2                	xor    %edx,%edx
+    15ea:	e9 be fe ff ff       	jmp    14ad <printf+0x4d>
+    15ef:	90                   	nop
+  write(fd, &c, 1);
+    15f0:	83 ec 04             	sub    $0x4,%esp
+    15f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    15f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    15f9:	6a 01                	push   $0x1
+    15fb:	e9 11 ff ff ff       	jmp    1511 <printf+0xb1>
+    1600:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1605:	bb 88 17 00 00       	mov    $0x1788,%ebx
+    160a:	e9 61 ff ff ff       	jmp    1570 <printf+0x110>
+    160f:	90                   	nop
+
+00001610 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1610:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1611:	a1 84 1a 00 00       	mov    0x1a84,%eax
+{
+    1616:	89 e5                	mov    %esp,%ebp
+    1618:	57                   	push   %edi
+    1619:	56                   	push   %esi
+    161a:	53                   	push   %ebx
+    161b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    161e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1628:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    162a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    162c:	39 ca                	cmp    %ecx,%edx
+    162e:	73 30                	jae    1660 <free+0x50>
+    1630:	39 c1                	cmp    %eax,%ecx
+    1632:	72 04                	jb     1638 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1634:	39 c2                	cmp    %eax,%edx
+    1636:	72 f0                	jb     1628 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1638:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    163b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    163e:	39 f8                	cmp    %edi,%eax
+    1640:	74 2e                	je     1670 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1642:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1645:	8b 42 04             	mov    0x4(%edx),%eax
+    1648:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    164b:	39 f1                	cmp    %esi,%ecx
+    164d:	74 38                	je     1687 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    164f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1651:	5b                   	pop    %ebx
+  freep = p;
+    1652:	89 15 84 1a 00 00    	mov    %edx,0x1a84
+}
+    1658:	5e                   	pop    %esi
+    1659:	5f                   	pop    %edi
+    165a:	5d                   	pop    %ebp
+    165b:	c3                   	ret
+    165c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1660:	39 c1                	cmp    %eax,%ecx
+    1662:	72 d0                	jb     1634 <free+0x24>
+    1664:	eb c2                	jmp    1628 <free+0x18>
+    1666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    166d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1670:	03 70 04             	add    0x4(%eax),%esi
+    1673:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1676:	8b 02                	mov    (%edx),%eax
+    1678:	8b 00                	mov    (%eax),%eax
+    167a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    167d:	8b 42 04             	mov    0x4(%edx),%eax
+    1680:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1683:	39 f1                	cmp    %esi,%ecx
+    1685:	75 c8                	jne    164f <free+0x3f>
+    p->s.size += bp->s.size;
+    1687:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    168a:	89 15 84 1a 00 00    	mov    %edx,0x1a84
+    p->s.size += bp->s.size;
+    1690:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1693:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1696:	89 0a                	mov    %ecx,(%edx)
+}
+    1698:	5b                   	pop    %ebx
+    1699:	5e                   	pop    %esi
+    169a:	5f                   	pop    %edi
+    169b:	5d                   	pop    %ebp
+    169c:	c3                   	ret
+    169d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000016a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    16a0:	55                   	push   %ebp
+    16a1:	89 e5                	mov    %esp,%ebp
+    16a3:	57                   	push   %edi
+    16a4:	56                   	push   %esi
+    16a5:	53                   	push   %ebx
+    16a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    16a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    16ac:	8b 15 84 1a 00 00    	mov    0x1a84,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    16b2:	8d 78 07             	lea    0x7(%eax),%edi
+    16b5:	c1 ef 03             	shr    $0x3,%edi
+    16b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    16bb:	85 d2                	test   %edx,%edx
+    16bd:	0f 84 8d 00 00 00    	je     1750 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    16c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    16c5:	8b 48 04             	mov    0x4(%eax),%ecx
+    16c8:	39 f9                	cmp    %edi,%ecx
+    16ca:	73 64                	jae    1730 <malloc+0x90>
+  if(nu < 4096)
+    16cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    16d1:	39 df                	cmp    %ebx,%edi
+    16d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    16d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    16dd:	eb 0a                	jmp    16e9 <malloc+0x49>
+    16df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    16e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    16e2:	8b 48 04             	mov    0x4(%eax),%ecx
+    16e5:	39 f9                	cmp    %edi,%ecx
+    16e7:	73 47                	jae    1730 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    16e9:	89 c2                	mov    %eax,%edx
+    16eb:	39 05 84 1a 00 00    	cmp    %eax,0x1a84
+    16f1:	75 ed                	jne    16e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    16f3:	83 ec 0c             	sub    $0xc,%esp
+    16f6:	56                   	push   %esi
+    16f7:	e8 ff fb ff ff       	call   12fb <sbrk>
+  if(p == (char*)-1)
+    16fc:	83 c4 10             	add    $0x10,%esp
+    16ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1702:	74 1c                	je     1720 <malloc+0x80>
+  hp->s.size = nu;
+    1704:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1707:	83 ec 0c             	sub    $0xc,%esp
+    170a:	83 c0 08             	add    $0x8,%eax
+    170d:	50                   	push   %eax
+    170e:	e8 fd fe ff ff       	call   1610 <free>
+  return freep;
+    1713:	8b 15 84 1a 00 00    	mov    0x1a84,%edx
+      if((p = morecore(nunits)) == 0)
+    1719:	83 c4 10             	add    $0x10,%esp
+    171c:	85 d2                	test   %edx,%edx
+    171e:	75 c0                	jne    16e0 <malloc+0x40>
+        return 0;
+  }
+}
+    1720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1723:	31 c0                	xor    %eax,%eax
+}
+    1725:	5b                   	pop    %ebx
+    1726:	5e                   	pop    %esi
+    1727:	5f                   	pop    %edi
+    1728:	5d                   	pop    %ebp
+    1729:	c3                   	ret
+    172a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1730:	39 cf                	cmp    %ecx,%edi
+    1732:	74 4c                	je     1780 <malloc+0xe0>
+        p->s.size -= nunits;
+    1734:	29 f9                	sub    %edi,%ecx
+    1736:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1739:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    173c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    173f:	89 15 84 1a 00 00    	mov    %edx,0x1a84
+}
+    1745:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1748:	83 c0 08             	add    $0x8,%eax
+}
+    174b:	5b                   	pop    %ebx
+    174c:	5e                   	pop    %esi
+    174d:	5f                   	pop    %edi
+    174e:	5d                   	pop    %ebp
+    174f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1750:	c7 05 84 1a 00 00 88 	movl   $0x1a88,0x1a84
+    1757:	1a 00 00 
+    base.s.size = 0;
+    175a:	b8 88 1a 00 00       	mov    $0x1a88,%eax
+    base.s.ptr = freep = prevp = &base;
+    175f:	c7 05 88 1a 00 00 88 	movl   $0x1a88,0x1a88
+    1766:	1a 00 00 
+    base.s.size = 0;
+    1769:	c7 05 8c 1a 00 00 00 	movl   $0x0,0x1a8c
+    1770:	00 00 00 
+    if(p->s.size >= nunits){
+    1773:	e9 54 ff ff ff       	jmp    16cc <malloc+0x2c>
+    1778:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    177f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1780:	8b 08                	mov    (%eax),%ecx
+    1782:	89 0a                	mov    %ecx,(%edx)
+    1784:	eb b9                	jmp    173f <malloc+0x9f>